@@ -239,7 +239,9 @@ let package = Package(
         "src/core/ext/transport/chttp2/transport/hpack_parser_table.cc",
         "src/core/ext/transport/chttp2/transport/hpack_parser_table.h",
         "src/core/ext/transport/chttp2/transport/http2_settings.cc",
+        "src/core/ext/transport/chttp2/transport/keepalive_coordinator.cc",
         "src/core/ext/transport/chttp2/transport/http2_settings.h",
+        "src/core/ext/transport/chttp2/transport/keepalive_coordinator.h",
         "src/core/ext/transport/chttp2/transport/huffsyms.cc",
         "src/core/ext/transport/chttp2/transport/huffsyms.h",
         "src/core/ext/transport/chttp2/transport/internal.h",
@@ -1148,7 +1150,10 @@ let package = Package(
         "src/core/lib/event_engine/event_engine_context.h",
         "src/core/lib/event_engine/extensions/can_track_errors.h",
         "src/core/lib/event_engine/extensions/chaotic_good_extension.h",
+        "src/core/lib/event_engine/extensions/receive_coalescing.h",
+        "src/core/lib/event_engine/extensions/run_with_priority.h",
         "src/core/lib/event_engine/extensions/supports_fd.h",
+        "src/core/lib/event_engine/extensions/tcp_info.h",
         "src/core/lib/event_engine/extensions/tcp_trace.h",
         "src/core/lib/event_engine/forkable.cc",
         "src/core/lib/event_engine/forkable.h",
@@ -1159,12 +1164,16 @@ let package = Package(
         "src/core/lib/event_engine/poller.h",
         "src/core/lib/event_engine/posix.h",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc",
         "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h",
+        "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.cc",
         "src/core/lib/event_engine/posix_engine/ev_poll_posix.h",
         "src/core/lib/event_engine/posix_engine/event_poller.h",
         "src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc",
+        "src/core/lib/event_engine/posix_engine/sharded_event_poller.cc",
         "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h",
+        "src/core/lib/event_engine/posix_engine/sharded_event_poller.h",
         "src/core/lib/event_engine/posix_engine/grpc_polled_fd_posix.h",
         "src/core/lib/event_engine/posix_engine/internal_errqueue.cc",
         "src/core/lib/event_engine/posix_engine/internal_errqueue.h",
@@ -1186,7 +1195,9 @@ let package = Package(
         "src/core/lib/event_engine/posix_engine/timer.cc",
         "src/core/lib/event_engine/posix_engine/timer.h",
         "src/core/lib/event_engine/posix_engine/timer_heap.cc",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.cc",
         "src/core/lib/event_engine/posix_engine/timer_heap.h",
+        "src/core/lib/event_engine/posix_engine/timer_wheel.h",
         "src/core/lib/event_engine/posix_engine/timer_manager.cc",
         "src/core/lib/event_engine/posix_engine/timer_manager.h",
         "src/core/lib/event_engine/posix_engine/traced_buffer_list.cc",
@@ -1237,7 +1248,9 @@ let package = Package(
         "src/core/lib/event_engine/windows/windows_listener.cc",
         "src/core/lib/event_engine/windows/windows_listener.h",
         "src/core/lib/event_engine/work_queue/basic_work_queue.cc",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc",
         "src/core/lib/event_engine/work_queue/basic_work_queue.h",
+        "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h",
         "src/core/lib/event_engine/work_queue/work_queue.h",
         "src/core/lib/experiments/config.cc",
         "src/core/lib/experiments/config.h",
@@ -1269,6 +1282,8 @@ let package = Package(
         "src/core/lib/gprpp/linux/env.cc",
         "src/core/lib/gprpp/load_file.cc",
         "src/core/lib/gprpp/load_file.h",
+        "src/core/lib/gprpp/lock_profile.cc",
+        "src/core/lib/gprpp/lock_profile.h",
         "src/core/lib/gprpp/manual_constructor.h",
         "src/core/lib/gprpp/match.h",
         "src/core/lib/gprpp/memory.h",
@@ -1485,6 +1500,8 @@ let package = Package(
         "src/core/lib/promise/observable.h",
         "src/core/lib/promise/party.cc",
         "src/core/lib/promise/party.h",
+        "src/core/lib/promise/party_profile.cc",
+        "src/core/lib/promise/party_profile.h",
         "src/core/lib/promise/pipe.h",
         "src/core/lib/promise/poll.h",
         "src/core/lib/promise/prioritized_race.h",
@@ -1501,9 +1518,13 @@ let package = Package(
         "src/core/lib/resource_quota/arena.cc",
         "src/core/lib/resource_quota/arena.h",
         "src/core/lib/resource_quota/connection_quota.cc",
+        "src/core/lib/resource_quota/handshake_quota.cc",
         "src/core/lib/resource_quota/connection_quota.h",
+        "src/core/lib/resource_quota/handshake_quota.h",
         "src/core/lib/resource_quota/memory_quota.cc",
+        "src/core/lib/resource_quota/slab_allocator.cc",
         "src/core/lib/resource_quota/memory_quota.h",
+        "src/core/lib/resource_quota/slab_allocator.h",
         "src/core/lib/resource_quota/periodic_update.cc",
         "src/core/lib/resource_quota/periodic_update.h",
         "src/core/lib/resource_quota/resource_quota.cc",
@@ -1664,7 +1685,9 @@ let package = Package(
         "src/core/lib/surface/completion_queue.cc",
         "src/core/lib/surface/completion_queue.h",
         "src/core/lib/surface/completion_queue_factory.cc",
+        "src/core/lib/surface/deadline_scheduler.cc",
         "src/core/lib/surface/completion_queue_factory.h",
+        "src/core/lib/surface/deadline_scheduler.h",
         "src/core/lib/surface/event_string.cc",
         "src/core/lib/surface/event_string.h",
         "src/core/lib/surface/filter_stack_call.cc",
@@ -1732,8 +1755,10 @@ let package = Package(
         "src/core/load_balancing/backend_metric_parser.cc",
         "src/core/load_balancing/backend_metric_parser.h",
         "src/core/load_balancing/child_policy_handler.cc",
+        "src/core/load_balancing/deterministic_subsetting/deterministic_subsetting.cc",
         "src/core/load_balancing/child_policy_handler.h",
         "src/core/load_balancing/delegating_helper.h",
+        "src/core/load_balancing/deterministic_subsetting/deterministic_subsetting.h",
         "src/core/load_balancing/endpoint_list.cc",
         "src/core/load_balancing/endpoint_list.h",
         "src/core/load_balancing/grpclb/client_load_reporting_filter.cc",
@@ -1753,6 +1778,8 @@ let package = Package(
         "src/core/load_balancing/lb_policy.h",
         "src/core/load_balancing/lb_policy_factory.h",
         "src/core/load_balancing/lb_policy_registry.cc",
+        "src/core/load_balancing/latency_aware/latency_aware.cc",
+        "src/core/load_balancing/least_request/least_request.cc",
         "src/core/load_balancing/lb_policy_registry.h",
         "src/core/load_balancing/oob_backend_metric.cc",
         "src/core/load_balancing/oob_backend_metric.h",
@@ -1762,7 +1789,9 @@ let package = Package(
         "src/core/load_balancing/pick_first/pick_first.cc",
         "src/core/load_balancing/pick_first/pick_first.h",
         "src/core/load_balancing/priority/priority.cc",
+        "src/core/load_balancing/ring_hash/consistent_hash.cc",
         "src/core/load_balancing/ring_hash/ring_hash.cc",
+        "src/core/load_balancing/ring_hash/consistent_hash.h",
         "src/core/load_balancing/ring_hash/ring_hash.h",
         "src/core/load_balancing/rls/rls.cc",
         "src/core/load_balancing/rls/rls.h",
@@ -1794,7 +1823,9 @@ let package = Package(
         "src/core/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc",
         "src/core/resolver/dns/dns_resolver_plugin.cc",
         "src/core/resolver/dns/dns_resolver_plugin.h",
+        "src/core/resolver/dns/event_engine/caching_dns_resolver.cc",
         "src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc",
+        "src/core/resolver/dns/event_engine/caching_dns_resolver.h",
         "src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.h",
         "src/core/resolver/dns/event_engine/service_config_helper.cc",
         "src/core/resolver/dns/event_engine/service_config_helper.h",
@@ -1818,7 +1849,11 @@ let package = Package(
         "src/core/resolver/xds/xds_dependency_manager.h",
         "src/core/resolver/xds/xds_resolver.cc",
         "src/core/resolver/xds/xds_resolver_attributes.h",
+        "src/core/server/admission_control.cc",
+        "src/core/server/drain_scheduler.cc",
         "src/core/server/server.cc",
+        "src/core/server/admission_control.h",
+        "src/core/server/drain_scheduler.h",
         "src/core/server/server.h",
         "src/core/server/server_call_tracer_filter.cc",
         "src/core/server/server_call_tracer_filter.h",
@@ -1837,6 +1872,7 @@ let package = Package(
         "src/core/service_config/service_config_parser.cc",
         "src/core/service_config/service_config_parser.h",
         "src/core/telemetry/call_tracer.cc",
+        "src/core/telemetry/call_phase_timestamps.h",
         "src/core/telemetry/call_tracer.h",
         "src/core/telemetry/histogram_view.cc",
         "src/core/telemetry/histogram_view.h",
@@ -1889,12 +1925,16 @@ let package = Package(
         "src/core/tsi/local_transport_security.cc",
         "src/core/tsi/local_transport_security.h",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.cc",
+        "src/core/tsi/ssl/verification_cache/ssl_verification_cache.cc",
         "src/core/tsi/ssl/key_logging/ssl_key_logging.h",
+        "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h",
         "src/core/tsi/ssl/session_cache/ssl_session.h",
         "src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.cc",
         "src/core/tsi/ssl/session_cache/ssl_session_cache.h",
+        "src/core/tsi/ssl/session_cache/ssl_session_ticket_keys.h",
         "src/core/tsi/ssl/session_cache/ssl_session_openssl.cc",
+        "src/core/tsi/ssl/session_cache/ssl_session_ticket_keys.cc",
         "src/core/tsi/ssl_transport_security.cc",
         "src/core/tsi/ssl_transport_security.h",
         "src/core/tsi/ssl_transport_security_utils.cc",
@@ -334,6 +334,7 @@
         'src/core/ext/transport/chttp2/transport/hpack_parser.cc',
         'src/core/ext/transport/chttp2/transport/hpack_parser_table.cc',
         'src/core/ext/transport/chttp2/transport/http2_settings.cc',
+        'src/core/ext/transport/chttp2/transport/keepalive_coordinator.cc',
         'src/core/ext/transport/chttp2/transport/http_trace.cc',
         'src/core/ext/transport/chttp2/transport/huffsyms.cc',
         'src/core/ext/transport/chttp2/transport/max_concurrent_streams_policy.cc',
@@ -729,8 +730,10 @@
         'src/core/lib/event_engine/event_engine.cc',
         'src/core/lib/event_engine/forkable.cc',
         'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+        'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
         'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
         'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
+        'src/core/lib/event_engine/posix_engine/sharded_event_poller.cc',
         'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
         'src/core/lib/event_engine/posix_engine/lockfree_event.cc',
         'src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc',
@@ -741,6 +744,7 @@
         'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
+        'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
         'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
@@ -766,6 +770,7 @@
         'src/core/lib/event_engine/windows/windows_engine.cc',
         'src/core/lib/event_engine/windows/windows_listener.cc',
         'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+        'src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc',
         'src/core/lib/experiments/config.cc',
         'src/core/lib/experiments/experiments.cc',
         'src/core/lib/gprpp/load_file.cc',
@@ -872,6 +877,7 @@
         'src/core/lib/resource_quota/api.cc',
         'src/core/lib/resource_quota/arena.cc',
         'src/core/lib/resource_quota/memory_quota.cc',
+        'src/core/lib/resource_quota/slab_allocator.cc',
         'src/core/lib/resource_quota/periodic_update.cc',
         'src/core/lib/resource_quota/resource_quota.cc',
         'src/core/lib/resource_quota/thread_quota.cc',
@@ -960,6 +966,7 @@
         'src/core/lib/surface/channel_stack_type.cc',
         'src/core/lib/surface/completion_queue.cc',
         'src/core/lib/surface/completion_queue_factory.cc',
+        'src/core/lib/surface/deadline_scheduler.cc',
         'src/core/lib/surface/event_string.cc',
         'src/core/lib/surface/init.cc',
         'src/core/lib/surface/init_internally.cc',
@@ -995,6 +1002,7 @@
         'src/core/load_balancing/address_filtering.cc',
         'src/core/load_balancing/backend_metric_parser.cc',
         'src/core/load_balancing/child_policy_handler.cc',
+        'src/core/load_balancing/deterministic_subsetting/deterministic_subsetting.cc',
         'src/core/load_balancing/endpoint_list.cc',
         'src/core/load_balancing/grpclb/client_load_reporting_filter.cc',
         'src/core/load_balancing/grpclb/grpclb.cc',
@@ -1004,10 +1012,13 @@
         'src/core/load_balancing/health_check_client.cc',
         'src/core/load_balancing/lb_policy.cc',
         'src/core/load_balancing/lb_policy_registry.cc',
+        'src/core/load_balancing/latency_aware/latency_aware.cc',
+        'src/core/load_balancing/least_request/least_request.cc',
         'src/core/load_balancing/oob_backend_metric.cc',
         'src/core/load_balancing/outlier_detection/outlier_detection.cc',
         'src/core/load_balancing/pick_first/pick_first.cc',
         'src/core/load_balancing/priority/priority.cc',
+        'src/core/load_balancing/ring_hash/consistent_hash.cc',
         'src/core/load_balancing/ring_hash/ring_hash.cc',
         'src/core/load_balancing/rls/rls.cc',
         'src/core/load_balancing/round_robin/round_robin.cc',
@@ -1029,6 +1040,7 @@
         'src/core/resolver/dns/c_ares/grpc_ares_wrapper_posix.cc',
         'src/core/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc',
         'src/core/resolver/dns/dns_resolver_plugin.cc',
+        'src/core/resolver/dns/event_engine/caching_dns_resolver.cc',
         'src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc',
         'src/core/resolver/dns/event_engine/service_config_helper.cc',
         'src/core/resolver/dns/native/dns_resolver.cc',
@@ -1067,9 +1079,11 @@
         'src/core/tsi/fake_transport_security.cc',
         'src/core/tsi/local_transport_security.cc',
         'src/core/tsi/ssl/key_logging/ssl_key_logging.cc',
+        'src/core/tsi/ssl/verification_cache/ssl_verification_cache.cc',
         'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
         'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
         'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
+        'src/core/tsi/ssl/session_cache/ssl_session_ticket_keys.cc',
         'src/core/tsi/ssl_transport_security.cc',
         'src/core/tsi/ssl_transport_security_utils.cc',
         'src/core/tsi/transport_security.cc',
@@ -1201,6 +1215,7 @@
         'src/core/ext/transport/chttp2/transport/hpack_parser.cc',
         'src/core/ext/transport/chttp2/transport/hpack_parser_table.cc',
         'src/core/ext/transport/chttp2/transport/http2_settings.cc',
+        'src/core/ext/transport/chttp2/transport/keepalive_coordinator.cc',
         'src/core/ext/transport/chttp2/transport/http_trace.cc',
         'src/core/ext/transport/chttp2/transport/huffsyms.cc',
         'src/core/ext/transport/chttp2/transport/max_concurrent_streams_policy.cc',
@@ -1272,8 +1287,10 @@
         'src/core/lib/event_engine/event_engine.cc',
         'src/core/lib/event_engine/forkable.cc',
         'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+        'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
         'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
         'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
+        'src/core/lib/event_engine/posix_engine/sharded_event_poller.cc',
         'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
         'src/core/lib/event_engine/posix_engine/lockfree_event.cc',
         'src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc',
@@ -1284,6 +1301,7 @@
         'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
+        'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
         'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
@@ -1309,6 +1327,7 @@
         'src/core/lib/event_engine/windows/windows_engine.cc',
         'src/core/lib/event_engine/windows/windows_listener.cc',
         'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+        'src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc',
         'src/core/lib/experiments/config.cc',
         'src/core/lib/experiments/experiments.cc',
         'src/core/lib/gprpp/load_file.cc',
@@ -1410,6 +1429,7 @@
         'src/core/lib/resource_quota/api.cc',
         'src/core/lib/resource_quota/arena.cc',
         'src/core/lib/resource_quota/memory_quota.cc',
+        'src/core/lib/resource_quota/slab_allocator.cc',
         'src/core/lib/resource_quota/periodic_update.cc',
         'src/core/lib/resource_quota/resource_quota.cc',
         'src/core/lib/resource_quota/thread_quota.cc',
@@ -1464,6 +1484,7 @@
         'src/core/lib/surface/channel_stack_type.cc',
         'src/core/lib/surface/completion_queue.cc',
         'src/core/lib/surface/completion_queue_factory.cc',
+        'src/core/lib/surface/deadline_scheduler.cc',
         'src/core/lib/surface/event_string.cc',
         'src/core/lib/surface/init.cc',
         'src/core/lib/surface/init_internally.cc',
@@ -1499,6 +1520,7 @@
         'src/core/load_balancing/address_filtering.cc',
         'src/core/load_balancing/backend_metric_parser.cc',
         'src/core/load_balancing/child_policy_handler.cc',
+        'src/core/load_balancing/deterministic_subsetting/deterministic_subsetting.cc',
         'src/core/load_balancing/endpoint_list.cc',
         'src/core/load_balancing/grpclb/client_load_reporting_filter.cc',
         'src/core/load_balancing/grpclb/grpclb.cc',
@@ -1508,6 +1530,8 @@
         'src/core/load_balancing/health_check_client.cc',
         'src/core/load_balancing/lb_policy.cc',
         'src/core/load_balancing/lb_policy_registry.cc',
+        'src/core/load_balancing/latency_aware/latency_aware.cc',
+        'src/core/load_balancing/least_request/least_request.cc',
         'src/core/load_balancing/oob_backend_metric.cc',
         'src/core/load_balancing/outlier_detection/outlier_detection.cc',
         'src/core/load_balancing/pick_first/pick_first.cc',
@@ -1527,6 +1551,7 @@
         'src/core/resolver/dns/c_ares/grpc_ares_wrapper_posix.cc',
         'src/core/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc',
         'src/core/resolver/dns/dns_resolver_plugin.cc',
+        'src/core/resolver/dns/event_engine/caching_dns_resolver.cc',
         'src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc',
         'src/core/resolver/dns/event_engine/service_config_helper.cc',
         'src/core/resolver/dns/native/dns_resolver.cc',
@@ -1824,6 +1849,7 @@
         'src/core/ext/transport/binder/server/binder_server_credentials.cc',
         'src/core/ext/transport/binder/transport/binder_transport.cc',
         'src/core/ext/transport/binder/utils/ndk_binder.cc',
+        'src/core/ext/transport/binder/utils/shared_memory.cc',
         'src/core/ext/transport/binder/utils/transport_stream_receiver_impl.cc',
         'src/core/ext/transport/binder/wire_format/binder_android.cc',
         'src/core/ext/transport/binder/wire_format/binder_constants.cc',
@@ -1856,7 +1882,9 @@
         'src/cpp/common/validate_service_config.cc',
         'src/cpp/common/version_cc.cc',
         'src/cpp/server/async_generic_service.cc',
+        'src/cpp/server/generic_proxy.cc',
         'src/cpp/server/backend_metric_recorder.cc',
+        'src/cpp/server/method_load_stats.cc',
         'src/cpp/server/channel_argument_option.cc',
         'src/cpp/server/create_default_thread_pool.cc',
         'src/cpp/server/external_connection_acceptor_impl.cc',
@@ -1991,7 +2019,9 @@
         'src/cpp/common/validate_service_config.cc',
         'src/cpp/common/version_cc.cc',
         'src/cpp/server/async_generic_service.cc',
+        'src/cpp/server/generic_proxy.cc',
         'src/cpp/server/backend_metric_recorder.cc',
+        'src/cpp/server/method_load_stats.cc',
         'src/cpp/server/channel_argument_option.cc',
         'src/cpp/server/create_default_thread_pool.cc',
         'src/cpp/server/external_connection_acceptor_impl.cc',
@@ -2081,8 +2111,10 @@
         'src/core/lib/event_engine/event_engine.cc',
         'src/core/lib/event_engine/forkable.cc',
         'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+        'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
         'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
         'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
+        'src/core/lib/event_engine/posix_engine/sharded_event_poller.cc',
         'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
         'src/core/lib/event_engine/posix_engine/lockfree_event.cc',
         'src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc',
@@ -2093,6 +2125,7 @@
         'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
         'src/core/lib/event_engine/posix_engine/timer.cc',
         'src/core/lib/event_engine/posix_engine/timer_heap.cc',
+        'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
         'src/core/lib/event_engine/posix_engine/timer_manager.cc',
         'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
         'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
@@ -2118,6 +2151,7 @@
         'src/core/lib/event_engine/windows/windows_engine.cc',
         'src/core/lib/event_engine/windows/windows_listener.cc',
         'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+        'src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc',
         'src/core/lib/experiments/config.cc',
         'src/core/lib/experiments/experiments.cc',
         'src/core/lib/gprpp/load_file.cc',
@@ -2215,6 +2249,7 @@
         'src/core/lib/resource_quota/api.cc',
         'src/core/lib/resource_quota/arena.cc',
         'src/core/lib/resource_quota/memory_quota.cc',
+        'src/core/lib/resource_quota/slab_allocator.cc',
         'src/core/lib/resource_quota/periodic_update.cc',
         'src/core/lib/resource_quota/resource_quota.cc',
         'src/core/lib/resource_quota/thread_quota.cc',
@@ -2271,6 +2306,7 @@
         'src/core/lib/surface/channel_stack_type.cc',
         'src/core/lib/surface/completion_queue.cc',
         'src/core/lib/surface/completion_queue_factory.cc',
+        'src/core/lib/surface/deadline_scheduler.cc',
         'src/core/lib/surface/event_string.cc',
         'src/core/lib/surface/init_internally.cc',
         'src/core/lib/surface/lame_client.cc',
@@ -2298,6 +2334,8 @@
         'src/core/lib/uri/uri_parser.cc',
         'src/core/load_balancing/lb_policy.cc',
         'src/core/load_balancing/lb_policy_registry.cc',
+        'src/core/load_balancing/latency_aware/latency_aware.cc',
+        'src/core/load_balancing/least_request/least_request.cc',
         'src/core/resolver/endpoint_addresses.cc',
         'src/core/resolver/resolver.cc',
         'src/core/resolver/resolver_registry.cc',
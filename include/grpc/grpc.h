@@ -123,6 +123,21 @@ GRPCAPI grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
                                               gpr_timespec deadline,
                                               void* reserved);
 
+/** EXPERIMENTAL: Like grpc_completion_queue_next, but once an event is
+    available, also dequeues the events that are already queued behind it,
+    so that a thread serving a busy queue pays for one wakeup per batch
+    rather than per event.
+
+    Stores up to 'max_events' (which must be positive) events in 'events' and
+    returns how many were stored, always at least one. A GRPC_QUEUE_TIMEOUT
+    or GRPC_QUEUE_SHUTDOWN event is always returned alone, as the only event.
+    Only valid for completion queues of type GRPC_CQ_NEXT. */
+GRPCAPI size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                                grpc_event* events,
+                                                size_t max_events,
+                                                gpr_timespec deadline,
+                                                void* reserved);
+
 /** Blocks until an event with tag 'tag' is available, the completion queue is
     being shutdown or deadline is reached.
 
@@ -530,6 +545,18 @@ GRPCAPI void grpc_resource_quota_resize(grpc_resource_quota* resource_quota,
 GRPCAPI void grpc_resource_quota_set_max_threads(
     grpc_resource_quota* resource_quota, int new_max_threads);
 
+/** EXPERIMENTAL: Create a buffer pool named 'name' that is a child of
+    'parent', replacing any child of 'parent' already named so. Memory and
+    threads used under the child are also charged to the parent, but running
+    out of memory in the child only reclaims memory from the child.
+    The child gets 'min_memory' bytes and 'min_threads' threads of the
+    parent, plus its share, relative to the 'weight' of the other children,
+    of what the parent has beyond the minimums of all its children. This is
+    recomputed whenever the parent is resized or its children change. */
+GRPCAPI grpc_resource_quota* grpc_resource_quota_create_child(
+    grpc_resource_quota* parent, const char* name, size_t min_memory,
+    int min_threads, double weight);
+
 /** EXPERIMENTAL.  Dumps xDS configs as a serialized ClientConfig proto.
     The full name of the proto is envoy.service.status.v3.ClientConfig. */
 GRPCAPI grpc_slice grpc_dump_xds_configs(void);
@@ -67,6 +67,17 @@
    application will see the compressed message in the byte buffer. */
 #define GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION \
   "grpc.per_message_decompression"
+/** Experimental Arg. The zlib compression level (0-9) used when messages are
+   compressed with deflate or gzip: lower levels spend less CPU time for a
+   worse compression ratio. Defaults to zlib's default level (6). */
+#define GRPC_ARG_DEFLATE_COMPRESSION_LEVEL "grpc.deflate_compression_level"
+/** Experimental Arg. A preset dictionary (string valued) for messages
+   compressed with deflate: content that messages are likely to share, which
+   makes small messages compress much better. Messages received are
+   decompressed with it when they need it. Both peers must be configured with
+   the same dictionary: peers without it fail to decompress the messages. */
+#define GRPC_ARG_DEFLATE_COMPRESSION_DICTIONARY \
+  "grpc.deflate_compression_dictionary"
 /** Initial stream ID for http2 transports. Int valued. */
 #define GRPC_ARG_HTTP2_INITIAL_SEQUENCE_NUMBER \
   "grpc.http2.initial_sequence_number"
@@ -135,6 +146,13 @@
  * the startup of each connection. */
 #define GRPC_ARG_EXPERIMENTAL_HTTP2_PREFERRED_CRYPTO_FRAME_SIZE \
   "grpc.experimental.http2.enable_preferred_frame_size"
+/** Received messages at least this large, in bytes, are handed to the
+    application in a single slice aligned on 64 bytes. Where the endpoint
+    supports it, their DATA payloads are read directly into such slices,
+    sized from the message length prefix; otherwise they are copied into one.
+    Int valued, 0 (default) disables. */
+#define GRPC_ARG_HTTP2_COALESCED_READ_THRESHOLD_BYTES \
+  "grpc.experimental.http2.coalesced_read_threshold_bytes"
 /** After a duration of this time the client/server pings its peer to see if the
     transport is still alive. Int valued, milliseconds. */
 #define GRPC_ARG_KEEPALIVE_TIME_MS "grpc.keepalive_time_ms"
@@ -146,6 +164,15 @@
    outstanding streams. Int valued, 0(false)/1(true). */
 #define GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS \
   "grpc.keepalive_permit_without_calls"
+/** The number of keepalive pings in a row that a client connection may skip
+    because another connection to the same peer address got a ping ack within
+    the keepalive time. Each skip puts the ping off by a keepalive time, and
+    any read on the connection allows as many skips again. With N, a peer with
+    many idle connections gets about 1/(N+1) of their pings, and a connection
+    broken on its own is still detected within (N+1) keepalive times plus the
+    keepalive timeout. Int valued, 0 (default) disables. */
+#define GRPC_ARG_EXPERIMENTAL_HTTP2_SHARED_KEEPALIVE \
+  "grpc.experimental.http2.shared_keepalive"
 /** Default authority to pass if none specified on call construction. A string.
  * */
 #define GRPC_ARG_DEFAULT_AUTHORITY "grpc.default_authority"
@@ -184,6 +211,14 @@
  *  protector.
  */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** If non-zero, once a TLS 1.3 handshake completes, the encryption of outgoing
+    data is handed over to the kernel (kTLS) when the platform supports it, so
+    that writes go straight to the socket without user-space copies. Incoming
+    data is still decrypted in user space. Falls back silently to user-space
+    encryption when kTLS is unavailable or GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED is
+    set. Offloaded writes do not collect TCP send timestamps, and connections
+    whose peer requests a TLS key update are closed. Defaults to 0. */
+#define GRPC_ARG_TLS_KERNEL_TX_OFFLOAD "grpc.tls_kernel_tx_offload"
 /** Maximum metadata size (soft limit), in bytes. Note this limit applies to the
    max sum of all metadata key-value entries in a batch of headers. Some random
    sample of requests between this limit and
@@ -198,6 +233,25 @@
 #define GRPC_ARG_ABSOLUTE_MAX_METADATA_SIZE "grpc.absolute_max_metadata_size"
 /** If non-zero, allow the use of SO_REUSEPORT if it's available (default 1) */
 #define GRPC_ARG_ALLOW_REUSEPORT "grpc.so_reuseport"
+/** Number of SO_REUSEPORT sockets a server listens with on each address
+   (default 1). With more than one the kernel load balances new connections
+   across the sockets, and each is accepted from independently, so accepting
+   is no longer serialized on a single listening socket. Only used when
+   GRPC_ARG_ALLOW_REUSEPORT is enabled and SO_REUSEPORT is available. */
+#define GRPC_ARG_TCP_LISTENER_SHARDS "grpc.experimental.tcp_listener_shards"
+/** If non-zero, attach a BPF program to each group of sharded listening
+   sockets (see GRPC_ARG_TCP_LISTENER_SHARDS) that picks the socket by the CPU
+   which received the connection, instead of by a hash of the address. This
+   keeps a connection's accept on the listening socket serving its CPU.
+   Linux only. Defaults to 0. */
+#define GRPC_ARG_TCP_LISTENER_CPU_STEERING \
+  "grpc.experimental.tcp_listener_cpu_steering"
+/** If positive, set SO_BUSY_POLL (and SO_PREFER_BUSY_POLL where available) to
+   this many microseconds on accepted connections, so that blocking receives
+   busy poll the device queue instead of waiting for an interrupt. Raising
+   the value above net.core.busy_read requires CAP_NET_ADMIN. Linux only.
+   Defaults to 0 (unset). */
+#define GRPC_ARG_TCP_BUSY_POLL_US "grpc.experimental.tcp_busy_poll_us"
 /** If non-zero, a pointer to a buffer pool (a pointer of type
  * grpc_resource_quota*). (use grpc_resource_quota_arg_vtable() to fetch an
  * appropriate pointer arg vtable) */
@@ -245,6 +299,21 @@
   "grpc.experimental.tcp_min_read_chunk_size"
 #define GRPC_ARG_TCP_MAX_READ_CHUNK_SIZE \
   "grpc.experimental.tcp_max_read_chunk_size"
+/* If non-zero, spare read buffer space is returned to the resource quota as
+   soon as the socket has been drained instead of being kept for the next
+   read. This trades an allocation per read burst for not pinning up to
+   GRPC_ARG_TCP_MAX_READ_CHUNK_SIZE bytes on every idle connection. Only
+   effective where the kernel reports pending bytes (TCP_INQ). Defaults to 0.
+ */
+#define GRPC_ARG_TCP_RELEASE_IDLE_READ_BUFFERS \
+  "grpc.experimental.tcp_release_idle_read_buffers"
+/** If positive, the period in milliseconds at which HTTP/2 connections on
+   event engine endpoints that support it sample TCP_INFO of their socket
+   while they read or write. Samples are published on the channelz socket
+   and recorded to the tcp_info_* histograms of the global stats. Defaults to
+   0 (disabled). */
+#define GRPC_ARG_TCP_INFO_SAMPLE_PERIOD_MS \
+  "grpc.experimental.tcp_info_sample_period_ms"
 /* TCP TX Zerocopy enable state: zero is disabled, non-zero is enabled. By
    default, it is disabled. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED \
@@ -259,6 +328,14 @@
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* TCP TX Zerocopy adaptive mode: if non-zero, each connection learns its own
+   send bytes threshold, starting from GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_
+   THRESHOLD and backing off while the kernel reports that zerocopy sends were
+   copied anyway or optmem is exhausted. The pool of in-flight zerocopy writes
+   also grows beyond GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS on demand. Only
+   meaningful when GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED is set. Defaults to 0. */
+#define GRPC_ARG_TCP_TX_ZEROCOPY_ADAPTIVE \
+  "grpc.experimental.tcp_tx_zerocopy_adaptive"
 /* Overrides the TCP socket recieve buffer size, SO_RCVBUF. */
 #define GRPC_ARG_TCP_RECEIVE_BUFFER_SIZE "grpc.tcp_receive_buffer_size"
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
@@ -306,15 +383,14 @@
     retries are enabled when they are configured via the service config.
     For details, see:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    NOTE: Hedging functionality is not yet implemented, so those
-          fields in the service config will currently be ignored.  See
-          also the GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below.
+    NOTE: Hedging fields in the service config are ignored unless
+          the GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING arg below is also set.
  */
 #define GRPC_ARG_ENABLE_RETRIES "grpc.enable_retries"
 /** Enables hedging functionality, as described in:
       https://github.com/grpc/proposal/blob/master/A6-client-retries.md
-    Default is currently false, since this functionality is not yet
-    fully implemented.
+    Default is currently false, since this functionality is new.  Hedged
+    attempts are only started once the client has finished sending.
     NOTE: This channel arg is experimental and will eventually be removed.
           Once hedging functionality has been implemented and proves stable,
           this arg will be removed, and the hedging functionality will
@@ -349,6 +425,14 @@
 /** If set, inhibits health checking (which may be enabled via the
  *  service config.) */
 #define GRPC_ARG_INHIBIT_HEALTH_CHECKING "grpc.inhibit_health_checking"
+/** EXPERIMENTAL: If non-zero, the health check streams of the subchannels to
+ *  the same address, for the same health check service name, authority and
+ *  channel credentials, are shared across the process: a single stream is
+ *  opened to the backend on one of their connections, and its updates are
+ *  reported to all of them. Only subchannels with this arg share their
+ *  streams. Defaults to 0. */
+#define GRPC_ARG_SHARE_HEALTH_CHECK_STREAMS \
+  "grpc.experimental.share_health_check_streams"
 /** If enabled, the channel's DNS resolver queries for SRV records.
  *  This is useful only when using the "grpclb" load balancing policy,
  *  as described in the following documents:
@@ -365,6 +449,15 @@
  * timeouts/backoff/retry logic, and so the actual DNS resolution may time out
  * sooner than the value specified here. */
 #define GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS "grpc.dns_ares_query_timeout"
+/** If set to a positive value, the EventEngine-based DNS resolver shares
+ * lookup results with the other channels in the process and reuses them for
+ * this many milliseconds. Concurrent lookups of the same name are only sent
+ * once. The default value is 0, which disables the cache. */
+#define GRPC_ARG_DNS_CACHE_TTL_MS "grpc.dns_cache_ttl_ms"
+/** If set, the number of milliseconds for which failed DNS lookups are
+ * cached when GRPC_ARG_DNS_CACHE_TTL_MS is enabled. The default value is 0,
+ * which means failed lookups are not cached. */
+#define GRPC_ARG_DNS_CACHE_NEGATIVE_TTL_MS "grpc.dns_cache_negative_ttl_ms"
 /** If set, uses a local subchannel pool within the channel. Otherwise, uses the
  * global subchannel pool. */
 #define GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL "grpc.use_local_subchannel_pool"
@@ -382,6 +475,24 @@
  * channel arg. Int valued, milliseconds. Defaults to 10 minutes.*/
 #define GRPC_ARG_SERVER_CONFIG_CHANGE_DRAIN_GRACE_TIME_MS \
   "grpc.experimental.server_config_change_drain_grace_time_ms"
+/** EXPERIMENTAL. When a server drains its connections without shutting down,
+ * either because its configuration from a config fetcher changed, because it
+ * stopped serving, or because it was asked to send GOAWAYs, it spreads the
+ * GOAWAYs over this window, with jitter, instead of sending them all at once.
+ * Idle connections are drained first, then the oldest ones. Int valued,
+ * milliseconds. Defaults to 0 (all at once). */
+#define GRPC_ARG_SERVER_DRAIN_WINDOW_MS \
+  "grpc.experimental.server_drain_window_ms"
+/** EXPERIMENTAL. If non-zero, a server binds each connection to one of its
+ * completion queues (the one polling the connection if any, otherwise the
+ * next one in round-robin order) and only publishes the calls of the
+ * connection to that completion queue, waiting for a call to be requested on
+ * it rather than taking a request from another completion queue. This keeps
+ * the processing of a connection on the thread serving its completion queue,
+ * provided that every completion queue has calls requested on it. Boolean
+ * valued, defaults to false. */
+#define GRPC_ARG_SERVER_CQ_CONNECTION_AFFINITY \
+  "grpc.experimental.server_cq_connection_affinity"
 /** Configure the Differentiated Services Code Point used on outgoing packets.
  *  Integer value ranging from 0 to 63. */
 #define GRPC_ARG_DSCP "grpc.dscp"
@@ -389,6 +500,13 @@
  *  Defaults to 250ms. */
 #define GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS \
   "grpc.happy_eyeballs_connection_attempt_delay_ms"
+/** If non-zero, pick_first remembers process-wide the address it last
+ *  connected to for each channel target, and channels to the same target
+ *  try that address first instead of walking the address list in resolver
+ *  order. Ignored when pick_first shuffles addresses. Int valued, 0 (default)
+ *  disables. */
+#define GRPC_ARG_EXPERIMENTAL_PICK_FIRST_REMEMBER_CONNECTED_ADDRESS \
+  "grpc.experimental.pick_first_remember_connected_address"
 /** It accepts a MemoryAllocatorFactory as input and If specified, it forces
  * the default event engine to use memory allocators created using the provided
  * factory. */
@@ -398,8 +516,89 @@
  * If unspecified, it is unlimited */
 #define GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS \
   "grpc.max_allowed_incoming_connections"
+/** Configure the max number of allowed incoming connections to the server from
+ * any single peer IP address. Connections over the limit are closed before
+ * their handshake starts. If unspecified, it is unlimited */
+#define GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS_PER_PEER \
+  "grpc.max_allowed_incoming_connections_per_peer"
+/** Configure the max number of server handshakes that run at the same time
+ * among the servers sharing the resource quota of the server. Handshakes over
+ * the limit wait for one to complete, and those from peers that recently
+ * completed a handshake go first. If unspecified, it is unlimited */
+#define GRPC_ARG_MAX_CONCURRENT_HANDSHAKES "grpc.max_concurrent_handshakes"
+/** Configure the max number of server handshakes waiting to start in the
+ * resource quota of the server. Connections over the limit are closed. If
+ * unspecified, it is unlimited */
+#define GRPC_ARG_MAX_QUEUED_HANDSHAKES "grpc.max_queued_handshakes"
+/** Number of data connections a chaotic good client opens per transport and
+ * stripes messages over, if the server accepts that many. Defaults to 1. */
+#define GRPC_ARG_CHAOTIC_GOOD_DATA_CONNECTIONS \
+  "grpc.chaotic_good.data_connections"
+/** Max number of data connections a chaotic good server accepts per transport.
+ * Defaults to 16. */
+#define GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS \
+  "grpc.chaotic_good.max_data_connections"
+/** If non-zero, a chaotic good transport that is writing the frames of many
+ * streams at once holds each write back for one event engine scheduling
+ * round, so that more frames go out in the same write. Defaults to 0. */
+#define GRPC_ARG_CHAOTIC_GOOD_WRITE_COALESCING_DELAY \
+  "grpc.chaotic_good.write_coalescing_delay"
+/** If non-zero, a chaotic good transport keeps a read outstanding on its
+ * control connection, so that frame headers and payloads that arrived together
+ * are read with one endpoint read. Defaults to 0. */
+#define GRPC_ARG_CHAOTIC_GOOD_READ_AHEAD "grpc.chaotic_good.read_ahead"
+/** If non-zero, the server sheds new calls when it is overloaded, from its CPU
+ * utilization (as set on the ServerMetricRecorder of a C++ server), the
+ * queue delay of its event engine's thread pool and the memory pressure of
+ * its resource quota. Each signal has a soft limit from which calls are
+ * rejected with a growing probability and a hard limit from which all calls
+ * but critical ones are. Clients set the priority of a call with the
+ * "grpc-priority" metadata: "sheddable", "default" or "critical". Defaults
+ * to 0. */
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL "grpc.server.admission_control"
+/** Soft and hard limits, in percent, of the CPU utilization for server
+ * admission control. Default to 80 and 95. */
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_CPU_UTILIZATION_PERCENT \
+  "grpc.server.admission_control.cpu_utilization_percent"
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_CPU_UTILIZATION_PERCENT_HARD_LIMIT \
+  "grpc.server.admission_control.cpu_utilization_percent_hard_limit"
+/** Soft and hard limits, in milliseconds, of the thread pool queue delay for
+ * server admission control. Default to 20 and 100. */
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_QUEUE_DELAY_MS \
+  "grpc.server.admission_control.queue_delay_ms"
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_QUEUE_DELAY_MS_HARD_LIMIT \
+  "grpc.server.admission_control.queue_delay_ms_hard_limit"
+/** Soft and hard limits, in percent, of the memory pressure for server
+ * admission control. Default to 80 and 95. */
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_MEMORY_PRESSURE_PERCENT \
+  "grpc.server.admission_control.memory_pressure_percent"
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_MEMORY_PRESSURE_PERCENT_HARD_LIMIT \
+  "grpc.server.admission_control.memory_pressure_percent_hard_limit"
+/** Priority of the calls to some methods for server admission control, when
+ * they do not set one in their metadata, as a comma separated list of
+ * "/package.Service/Method=priority". */
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_METHOD_PRIORITIES \
+  "grpc.server.admission_control.method_priorities"
+/** Metadata key whose value names the tenant of a call for server admission
+ * control. A call whose tenant names a child of the server's resource quota
+ * (see grpc_resource_quota_create_child) is also shed on the memory pressure
+ * of that child, with the memory pressure limits. Unset by default. */
+#define GRPC_ARG_SERVER_ADMISSION_CONTROL_TENANT_METADATA_KEY \
+  "grpc.server.admission_control.tenant_metadata_key"
+/** If set to non-zero, sync and callback servers with call metric recording
+ * enabled report the queue delay of each call, from its arrival to the start
+ * of its handler, in seconds, as the ORCA request cost "grpc.queue_delay".
+ * Defaults to 0. */
+#define GRPC_ARG_SERVER_ORCA_QUEUE_DELAY \
+  "grpc.experimental.server_orca_queue_delay"
 /** Configure per-channel or per-server stats plugins. */
 #define GRPC_ARG_EXPERIMENTAL_STATS_PLUGINS "grpc.experimental.stats_plugins"
+/** If set to non-zero, calls record monotonic timestamps of their phases
+ * (first byte and initial metadata received, handler invoked, initial
+ * metadata and end of stream written), which the C++ ServerContext and
+ * ClientContext expose. Defaults to 0. */
+#define GRPC_ARG_CALL_PHASE_TIMESTAMPS \
+  "grpc.experimental.call_phase_timestamps"
 /** \} */
 
 #endif /* GRPC_IMPL_CHANNEL_ARG_NAMES_H */
@@ -343,7 +343,9 @@ typedef struct grpc_op {
       grpc_metadata* trailing_metadata;
       grpc_status_code status;
       /** optional: set to NULL if no details need sending, non-NULL if they do
-       * pointer will not be retained past the start_batch call
+       * pointer will not be retained past the start_batch call; a refcounted
+       * slice is referenced rather than copied, so servers can send a canned
+       * message without copying it per call
        */
       grpc_slice* status_details;
     } send_status_from_server;
@@ -15,6 +15,7 @@
 #define GRPC_PASSIVE_LISTENER_H
 
 #include <memory>
+#include <vector>
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
@@ -49,6 +50,25 @@ class PassiveListener {
   /// Returns a failure status if the server's active EventEngine does not
   /// support Endpoint creation from fds.
   virtual absl::Status AcceptConnectedFd(int fd) = 0;
+
+  /// A connected file descriptor, with any bytes already read from it that
+  /// are meant for the server (e.g. while sniffing the protocol).
+  struct ConnectedFd {
+    int fd = -1;
+    grpc_event_engine::experimental::SliceBuffer initial_data;
+  };
+
+  /// -- EXPERIMENTAL API --
+  ///
+  /// Like AcceptConnectedFd(), for connections handed off together: the
+  /// listener and EventEngine are looked up and the connections registered
+  /// with the server once for the whole batch rather than per connection.
+  /// The server reads each connection's \a initial_data before anything it
+  /// reads from the fd.
+  ///
+  /// Returns one status per connection, in order.
+  virtual std::vector<absl::Status> AcceptConnectedFds(
+      std::vector<ConnectedFd> fds) = 0;
 };
 
 }  // namespace experimental
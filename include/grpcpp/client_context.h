@@ -48,6 +48,7 @@
 #include <grpcpp/impl/rpc_method.h>
 #include <grpcpp/impl/sync.h>
 #include <grpcpp/security/auth_context.h>
+#include <grpcpp/support/call_phase_timestamps.h>
 #include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/slice.h>
@@ -368,6 +369,12 @@ class ClientContext {
   /// \return The call's peer URI.
   std::string peer() const;
 
+  /// EXPERIMENTAL API
+  /// Returns the timestamps of the phases of the call so far, see
+  /// GRPC_ARG_CALL_PHASE_TIMESTAMPS. It is only valid to call this once the
+  /// client call is created.
+  experimental::CallPhaseTimestamps ExperimentalGetCallPhaseTimestamps() const;
+
   /// Sets the census context.
   /// It is only valid to call this before the client call is created. A common
   /// place of setting census context is from within the DefaultConstructor
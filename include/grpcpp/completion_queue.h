@@ -64,6 +64,8 @@ class ServerWriter;
 namespace internal {
 template <class W, class R>
 class ServerReaderWriterBody;
+template <class R>
+class ServerReadAhead;
 
 template <class ResponseType>
 void UnaryRunHandlerHelper(
@@ -202,6 +204,26 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
     return AsyncNextInternal(tag, ok, deadline_tp.raw_time());
   }
 
+  /// EXPERIMENTAL: An event read from the queue by \a NextBatch.
+  struct Event {
+    void* tag;
+    /// See documentation for CompletionQueue::Next for explanation of ok.
+    bool ok;
+  };
+
+  /// EXPERIMENTAL
+  /// Like \a Next, but once an event is available, also reads the events
+  /// that are already queued behind it, so that a thread serving a busy
+  /// queue (e.g. of an async server) is woken up once per batch of events
+  /// rather than once per event.
+  ///
+  /// \param[out] events Updated with the events read.
+  /// \param[in] max_events The maximum number of events to read, at least 1.
+  ///
+  /// \return The number of events read, 0 if the queue is fully drained and
+  ///         shut down.
+  size_t NextBatch(Event* events, size_t max_events);
+
   /// EXPERIMENTAL
   /// First executes \a F, then reads from the queue, blocking up to
   /// \a deadline (or the queue's shutdown).
@@ -275,6 +297,8 @@ class CompletionQueue : private grpc::internal::GrpcLibrary {
   friend class grpc::ServerWriter;
   template <class W, class R>
   friend class grpc::internal::ServerReaderWriterBody;
+  template <class R>
+  friend class grpc::internal::ServerReadAhead;
   template <class ResponseType>
   friend void grpc::internal::UnaryRunHandlerHelper(
       const grpc::internal::MethodHandler::HandlerParameter&, ResponseType*,
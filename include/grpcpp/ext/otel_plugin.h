@@ -73,6 +73,18 @@ class OpenTelemetryPlugin {
 /// grpc.server.call.duration
 /// grpc.server.call.sent_total_compressed_message_size
 /// grpc.server.call.rcvd_total_compressed_message_size
+///
+/// The following instruments are not enabled by default, and need to be
+/// enabled with EnableMetrics(). They break the time spent sending each chunk
+/// of a call attempt down using the TCP transmit timestamps collected by the
+/// kernel, and are only recorded on platforms and endpoints that support them
+/// (Linux, with the trace_record_callops experiment enabled) -
+/// grpc.client.attempt.tcp.queue_duration (from the start of the send batch
+///   to the sendmsg() call)
+/// grpc.client.attempt.tcp.kernel_duration (from sendmsg() until the bytes are
+///   handed to the NIC)
+/// grpc.client.attempt.tcp.wire_duration (from the NIC until the bytes are
+///   acknowledged by the peer)
 class OpenTelemetryPluginBuilder {
  public:
   using ChannelScope = grpc_core::experimental::StatsPluginChannelScope;
@@ -88,6 +100,15 @@ class OpenTelemetryPluginBuilder {
   static constexpr absl::string_view
       kClientAttemptRcvdTotalCompressedMessageSizeInstrumentName =
           "grpc.client.attempt.rcvd_total_compressed_message_size";
+  static constexpr absl::string_view
+      kClientAttemptTcpQueueDurationInstrumentName =
+          "grpc.client.attempt.tcp.queue_duration";
+  static constexpr absl::string_view
+      kClientAttemptTcpKernelDurationInstrumentName =
+          "grpc.client.attempt.tcp.kernel_duration";
+  static constexpr absl::string_view
+      kClientAttemptTcpWireDurationInstrumentName =
+          "grpc.client.attempt.tcp.wire_duration";
   static constexpr absl::string_view kServerCallStartedInstrumentName =
       "grpc.server.call.started";
   static constexpr absl::string_view kServerCallDurationInstrumentName =
@@ -155,6 +176,18 @@ class OpenTelemetryPluginBuilder {
   OpenTelemetryPluginBuilder& SetChannelScopeFilter(
       absl::AnyInvocable<bool(const ChannelScope& /*scope*/) const>
           channel_scope_filter);
+  /// EXPERIMENTAL API
+  /// If enabled, the per-call metrics are aggregated inside gRPC, with one
+  /// fixed set of buckets per histogram, and reported to the meter provider
+  /// through observable instruments when it collects metrics. This makes
+  /// recording much cheaper for small calls, but changes the instruments that
+  /// are exported: counters become observable counters of the same name, and
+  /// since OpenTelemetry has no asynchronous histogram, a histogram `<name>`
+  /// is exported as the observable counters `<name>.count`, `<name>.sum` and
+  /// `<name>.bucket`. The latter has an `le` attribute with the inclusive
+  /// upper bound of the bucket ("+Inf" for the last one), and counts the
+  /// values less than or equal to it, like a Prometheus histogram.
+  OpenTelemetryPluginBuilder& EnablePerCallMetricsPreAggregation(bool enable);
   /// Builds and registers a global plugin that acts on all channels and servers
   /// running on the process. Must be called no more than once and must not be
   /// called if Build() is called.
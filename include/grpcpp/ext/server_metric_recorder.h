@@ -32,6 +32,7 @@ struct BackendMetricData;
 
 namespace grpc {
 class BackendMetricState;
+class Server;
 
 namespace experimental {
 /// Records server wide metrics to be reported to the client.
@@ -94,6 +95,8 @@ class ServerMetricRecorder {
   // To access GetMetrics().
   friend class grpc::BackendMetricState;
   friend class OrcaService;
+  // To feed the CPU utilization to server admission control.
+  friend class grpc::Server;
 
   struct BackendMetricDataState;
 
@@ -0,0 +1,82 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_GENERIC_GENERIC_PROXY_H
+#define GRPCPP_GENERIC_GENERIC_PROXY_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <grpcpp/generic/callback_generic_service.h>
+#include <grpcpp/generic/generic_stub_callback.h>
+#include <grpcpp/impl/channel_interface.h>
+
+namespace grpc {
+namespace experimental {
+
+/// EXPERIMENTAL: A generic service that forwards every call it gets to a
+/// backend channel, as a transparent L7 proxy. Register it with
+/// ServerBuilder::RegisterCallbackGenericService.
+///
+/// Each incoming call is spliced to an outgoing call of the same method on
+/// the backend. The deadline and cancellation of the incoming call are
+/// propagated. The metadata of the client and of the backend are forwarded,
+/// and so is the status of the backend. Messages are forwarded as the
+/// ByteBuffers they were received as, without copying their slices.
+/// Each direction holds at most one message: the next message is only read
+/// from one side once the previous one was written to the other side, so
+/// the flow control of each side pushes back on the other.
+class CallbackGenericProxyService : public CallbackGenericService {
+ public:
+  using Metadata = std::multimap<std::string, std::string>;
+
+  struct Options {
+    /// Called when a call starts, with the method and the metadata the call
+    /// is forwarded to the backend with, which it may rewrite. Must not
+    /// block.
+    std::function<void(const GenericCallbackServerContext& context,
+                       std::string* method, Metadata* metadata)>
+        rewrite_request;
+    /// Called with the initial metadata, then with the trailing metadata of
+    /// the backend, before they are forwarded to the client, which it may
+    /// rewrite. Must not block.
+    std::function<void(Metadata* metadata)> rewrite_response;
+  };
+
+  CallbackGenericProxyService(std::shared_ptr<ChannelInterface> backend,
+                              Options options);
+  explicit CallbackGenericProxyService(
+      std::shared_ptr<ChannelInterface> backend)
+      : CallbackGenericProxyService(std::move(backend), Options()) {}
+
+  ServerGenericBidiReactor* CreateReactor(
+      GenericCallbackServerContext* context) override;
+
+ private:
+  class Splice;
+
+  GenericStubCallback stub_;
+  const Options options_;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_GENERIC_GENERIC_PROXY_H
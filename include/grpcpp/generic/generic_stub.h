@@ -57,6 +57,16 @@ class TemplatedGenericStub final
                         false, nullptr);
   }
 
+  /// Like PrepareCall() above, for a registered \a method.
+  std::unique_ptr<ClientAsyncReaderWriter<RequestType, ResponseType>>
+  PrepareCall(ClientContext* context, const RegisteredGenericMethod& method,
+              grpc::CompletionQueue* cq) {
+    return CallInternal(
+        channel_.get(), context,
+        method.Method(grpc::internal::RpcMethod::BIDI_STREAMING), cq, false,
+        nullptr);
+  }
+
   /// Setup a unary call to a named method \a method using \a context, and don't
   /// start it. Let it be started explicitly with StartCall.
   /// The return value only indicates whether or not registration of the call
@@ -73,6 +83,17 @@ class TemplatedGenericStub final
             context, request));
   }
 
+  /// Like PrepareUnaryCall() above, for a registered \a method.
+  std::unique_ptr<ClientAsyncResponseReader<ResponseType>> PrepareUnaryCall(
+      ClientContext* context, const RegisteredGenericMethod& method,
+      const RequestType& request, grpc::CompletionQueue* cq) {
+    return std::unique_ptr<ClientAsyncResponseReader<ResponseType>>(
+        internal::ClientAsyncResponseReaderHelper::Create<ResponseType>(
+            channel_.get(), cq,
+            method.Method(grpc::internal::RpcMethod::NORMAL_RPC), context,
+            request));
+  }
+
   using internal::TemplatedGenericStubCallbackInternal<
       RequestType, ResponseType>::PrepareUnaryCall;
 
@@ -89,6 +110,17 @@ class TemplatedGenericStub final
                         true, tag);
   }
 
+  /// DEPRECATED for multi-threaded use
+  /// Like Call() above, for a registered \a method.
+  std::unique_ptr<ClientAsyncReaderWriter<RequestType, ResponseType>> Call(
+      ClientContext* context, const RegisteredGenericMethod& method,
+      grpc::CompletionQueue* cq, void* tag) {
+    return CallInternal(
+        channel_.get(), context,
+        method.Method(grpc::internal::RpcMethod::BIDI_STREAMING), cq, true,
+        tag);
+  }
+
  private:
   using internal::TemplatedGenericStubCallbackInternal<RequestType,
                                                        ResponseType>::channel_;
@@ -97,13 +129,20 @@ class TemplatedGenericStub final
   CallInternal(grpc::ChannelInterface* channel, ClientContext* context,
                const std::string& method, StubOptions options,
                grpc::CompletionQueue* cq, bool start, void* tag) {
+    return CallInternal(channel, context,
+                        grpc::internal::RpcMethod(
+                            method.c_str(), options.suffix_for_stats(),
+                            grpc::internal::RpcMethod::BIDI_STREAMING),
+                        cq, start, tag);
+  }
+
+  std::unique_ptr<ClientAsyncReaderWriter<RequestType, ResponseType>>
+  CallInternal(grpc::ChannelInterface* channel, ClientContext* context,
+               const grpc::internal::RpcMethod& method,
+               grpc::CompletionQueue* cq, bool start, void* tag) {
     return std::unique_ptr<ClientAsyncReaderWriter<RequestType, ResponseType>>(
         internal::ClientAsyncReaderWriterFactory<RequestType, ResponseType>::
-            Create(channel, cq,
-                   grpc::internal::RpcMethod(
-                       method.c_str(), options.suffix_for_stats(),
-                       grpc::internal::RpcMethod::BIDI_STREAMING),
-                   context, start, tag));
+            Create(channel, cq, method, context, start, tag));
   }
 };
 
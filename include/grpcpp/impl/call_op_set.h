@@ -382,8 +382,8 @@ Status CallOpSendMessage::SendMessage(const M& message, WriteOptions options) {
   write_options_ = options;
   // Serialize immediately since we do not have access to the message pointer
   bool own_buf;
-  Status result = SerializationTraits<M>::Serialize(
-      message, send_buf_.bbuf_ptr(), &own_buf);
+  Status result =
+      internal::SerializeMessage(message, &send_buf_, &own_buf);
   if (!own_buf) {
     send_buf_.Duplicate();
   }
@@ -407,8 +407,8 @@ Status CallOpSendMessage::SendMessagePtr(const M* message,
     // The void in the template parameter below should not be needed
     // (since it should be implicit) but is needed due to an observed
     // difference in behavior between clang and gcc for certain internal users
-    Status result = SerializationTraits<M>::Serialize(
-        *static_cast<const M*>(message), send_buf_.bbuf_ptr(), &own_buf);
+    Status result = internal::SerializeMessage(
+        *static_cast<const M*>(message), &send_buf_, &own_buf);
     if (!own_buf) {
       send_buf_.Duplicate();
     }
@@ -447,8 +447,7 @@ class CallOpRecvMessage {
     if (recv_buf_.Valid()) {
       if (*status) {
         got_message = *status =
-            SerializationTraits<R>::Deserialize(recv_buf_.bbuf_ptr(), message_)
-                .ok();
+            internal::DeserializeMessage(&recv_buf_, message_).ok();
         recv_buf_.Release();
       } else {
         got_message = false;
@@ -516,7 +515,7 @@ class DeserializeFuncType final : public DeserializeFunc {
  public:
   explicit DeserializeFuncType(R* message) : message_(message) {}
   Status Deserialize(ByteBuffer* buf) override {
-    return SerializationTraits<R>::Deserialize(buf->bbuf_ptr(), message_);
+    return internal::DeserializeMessage(buf, message_);
   }
 
   ~DeserializeFuncType() override {}
@@ -1023,7 +1022,16 @@ class CallOpSet : public CallOpSetInterface,
     this->Op4::SetFinishInterceptionHookPoint(&interceptor_methods_);
     this->Op5::SetFinishInterceptionHookPoint(&interceptor_methods_);
     this->Op6::SetFinishInterceptionHookPoint(&interceptor_methods_);
-    return interceptor_methods_.RunInterceptors();
+    if (interceptor_methods_.InterceptorsListEmpty()) {
+      return true;
+    }
+    if (interceptor_methods_.RunInterceptors()) {
+      // No interceptor subscribes to this batch, which is done without the
+      // round trip to the core that finishes an intercepted batch.
+      call_.cq()->CompleteAvalanching();
+      return true;
+    }
+    return false;
   }
 
   void* core_cq_tag_;
@@ -20,6 +20,8 @@
 #define GRPCPP_IMPL_GENERIC_STUB_INTERNAL_H
 
 #include <functional>
+#include <memory>
+#include <string>
 
 #include <grpcpp/client_context.h>
 #include <grpcpp/impl/rpc_method.h>
@@ -35,6 +37,47 @@ class TemplatedGenericStub;
 template <class RequestType, class ResponseType>
 class TemplatedGenericStubCallback;
 
+namespace internal {
+template <class RequestType, class ResponseType>
+class TemplatedGenericStubCallbackInternal;
+}  // namespace internal
+
+/// A method registered with the channel of a generic stub by its
+/// RegisterMethod(). The channel builds the method's path, and its own
+/// authority, once for all the calls made with the handle instead of once
+/// per call. Calls whose ClientContext sets an authority still build theirs.
+///
+/// Copies share the registration. A handle must outlive the calls made with
+/// it, and may only be used with stubs on the channel it was registered
+/// with.
+class RegisteredGenericMethod {
+ public:
+  const std::string& name() const { return *name_; }
+
+ private:
+  template <class Req, class Resp>
+  friend class TemplatedGenericStub;
+  template <class Req, class Resp>
+  friend class internal::TemplatedGenericStubCallbackInternal;
+
+  RegisteredGenericMethod(const std::shared_ptr<ChannelInterface>& channel,
+                          const std::string& name, StubOptions options)
+      : name_(std::make_shared<const std::string>(name)),
+        method_(name_->c_str(), options.suffix_for_stats(),
+                internal::RpcMethod::BIDI_STREAMING, channel) {}
+
+  internal::RpcMethod Method(internal::RpcMethod::RpcType type) const {
+    internal::RpcMethod method = method_;
+    method.SetMethodType(type);
+    return method;
+  }
+
+  // On the heap, so that method_ can keep pointing at it when the handle is
+  // moved.
+  std::shared_ptr<const std::string> name_;
+  internal::RpcMethod method_;
+};
+
 namespace internal {
 
 /// Generic stubs provide a type-unaware interface to call gRPC methods
@@ -47,6 +90,13 @@ class TemplatedGenericStubCallbackInternal {
       std::shared_ptr<grpc::ChannelInterface> channel)
       : channel_(channel) {}
 
+  /// Registers \a method with the channel of this stub, for calls made
+  /// through the returned handle rather than by name.
+  RegisteredGenericMethod RegisterMethod(const std::string& method,
+                                         StubOptions options = {}) {
+    return RegisteredGenericMethod(channel_, method, options);
+  }
+
   /// Setup and start a unary call to a named method \a method using
   /// \a context and specifying the \a request and \a response buffers.
   void UnaryCall(ClientContext* context, const std::string& method,
@@ -57,6 +107,15 @@ class TemplatedGenericStubCallbackInternal {
                       std::move(on_completion));
   }
 
+  /// Like UnaryCall() above, for a registered \a method.
+  void UnaryCall(ClientContext* context, const RegisteredGenericMethod& method,
+                 const RequestType* request, ResponseType* response,
+                 std::function<void(grpc::Status)> on_completion) {
+    internal::CallbackUnaryCall(
+        channel_.get(), method.Method(grpc::internal::RpcMethod::NORMAL_RPC),
+        context, request, response, std::move(on_completion));
+  }
+
   /// Setup a unary call to a named method \a method using
   /// \a context and specifying the \a request and \a response buffers.
   /// Like any other reactor-based RPC, it will not be activated until
@@ -68,6 +127,16 @@ class TemplatedGenericStubCallbackInternal {
                              reactor);
   }
 
+  /// Like PrepareUnaryCall() above, for a registered \a method.
+  void PrepareUnaryCall(ClientContext* context,
+                        const RegisteredGenericMethod& method,
+                        const RequestType* request, ResponseType* response,
+                        ClientUnaryReactor* reactor) {
+    internal::ClientCallbackUnaryFactory::Create<RequestType, ResponseType>(
+        channel_.get(), method.Method(grpc::internal::RpcMethod::NORMAL_RPC),
+        context, request, response, reactor);
+  }
+
   /// Setup a call to a named method \a method using \a context and tied to
   /// \a reactor . Like any other bidi streaming RPC, it will not be activated
   /// until StartCall is invoked on its reactor.
@@ -77,6 +146,16 @@ class TemplatedGenericStubCallbackInternal {
     PrepareBidiStreamingCallInternal(context, method, options, reactor);
   }
 
+  /// Like PrepareBidiStreamingCall() above, for a registered \a method.
+  void PrepareBidiStreamingCall(
+      ClientContext* context, const RegisteredGenericMethod& method,
+      ClientBidiReactor<RequestType, ResponseType>* reactor) {
+    internal::ClientCallbackReaderWriterFactory<RequestType, ResponseType>::
+        Create(channel_.get(),
+               method.Method(grpc::internal::RpcMethod::BIDI_STREAMING),
+               context, reactor);
+  }
+
  private:
   template <class Req, class Resp>
   friend class grpc::TemplatedGenericStub;
@@ -19,7 +19,6 @@
 #ifndef GRPCPP_IMPL_INTERCEPTOR_COMMON_H
 #define GRPCPP_IMPL_INTERCEPTOR_COMMON_H
 
-#include <array>
 #include <functional>
 
 #include "absl/log/absl_check.h"
@@ -38,20 +37,13 @@ namespace internal {
 class InterceptorBatchMethodsImpl
     : public experimental::InterceptorBatchMethods {
  public:
-  InterceptorBatchMethodsImpl() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
-    }
-  }
+  InterceptorBatchMethodsImpl() {}
 
   ~InterceptorBatchMethodsImpl() override {}
 
   bool QueryInterceptionHookPoint(
       experimental::InterceptionHookPoints type) override {
-    return hooks_[static_cast<size_t>(type)];
+    return hooks_.Contains(type);
   }
 
   void Proceed() override {
@@ -78,7 +70,7 @@ class InterceptorBatchMethodsImpl
   }
 
   void AddInterceptionHookPoint(experimental::InterceptionHookPoints type) {
-    hooks_[static_cast<size_t>(type)] = true;
+    hooks_.Add(type);
   }
 
   ByteBuffer* GetSerializedSendMessage() override {
@@ -131,8 +123,8 @@ class InterceptorBatchMethodsImpl
   Status* GetRecvStatus() override { return recv_status_; }
 
   void FailHijackedSendMessage() override {
-    ABSL_CHECK(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE)]);
+    ABSL_CHECK(hooks_.Contains(
+        experimental::InterceptionHookPoints::PRE_SEND_MESSAGE));
     *fail_send_message_ = true;
   }
 
@@ -194,8 +186,8 @@ class InterceptorBatchMethodsImpl
   }
 
   void FailHijackedRecvMessage() override {
-    ABSL_CHECK(hooks_[static_cast<size_t>(
-        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE)]);
+    ABSL_CHECK(hooks_.Contains(
+        experimental::InterceptionHookPoints::PRE_RECV_MESSAGE));
     *hijacked_recv_message_failed_ = true;
   }
 
@@ -236,17 +228,17 @@ class InterceptorBatchMethodsImpl
   // SetCallOpSetInterface should have been called before this. After all the
   // interceptors are done running, either ContinueFillOpsAfterInterception or
   // ContinueFinalizeOpsAfterInterception will be called. Note that neither of
-  // them is invoked if there were no interceptors registered.
+  // them is invoked if there were no interceptors registered, or if no client
+  // interceptor subscribes to the hook points of the batch: true is returned
+  // then.
   bool RunInterceptors() {
     ABSL_CHECK(ops_);
     auto* client_rpc_info = call_->client_rpc_info();
     if (client_rpc_info != nullptr) {
       if (client_rpc_info->interceptors_.empty()) {
         return true;
-      } else {
-        RunClientInterceptors();
-        return false;
       }
+      return !RunClientInterceptors();
     }
 
     auto* server_rpc_info = call_->server_rpc_info();
@@ -275,18 +267,52 @@ class InterceptorBatchMethodsImpl
   }
 
  private:
-  void RunClientInterceptors() {
+  // Returns false if no interceptor is run for the batch.
+  bool RunClientInterceptors() {
     auto* rpc_info = call_->client_rpc_info();
+    size_t pos;
     if (!reverse_) {
-      current_interceptor_index_ = 0;
+      pos = 0;
+      if (!NextClientInterceptor(rpc_info, &pos)) return false;
     } else {
       if (rpc_info->hijacked_) {
-        current_interceptor_index_ = rpc_info->hijacked_interceptor_;
+        pos = rpc_info->hijacked_interceptor_;
       } else {
-        current_interceptor_index_ = rpc_info->interceptors_.size() - 1;
+        pos = rpc_info->interceptors_.size() - 1;
       }
+      if (!PreviousClientInterceptor(rpc_info, &pos)) return false;
     }
+    current_interceptor_index_ = pos;
     rpc_info->RunInterceptor(this, current_interceptor_index_);
+    return true;
+  }
+
+  // Whether the client interceptor at \a pos is run for the current batch.
+  // The interceptor that hijacked the RPC is run for all of its batches.
+  bool RunsClientInterceptor(experimental::ClientRpcInfo* rpc_info,
+                             size_t pos) {
+    return (rpc_info->hijacked_ && pos == rpc_info->hijacked_interceptor_) ||
+           rpc_info->InterceptorSubscribes(pos, hooks_);
+  }
+
+  // Moves \a pos down the stack to the first interceptor run for the current
+  // batch, starting at \a pos itself. Returns false if there is none.
+  bool NextClientInterceptor(experimental::ClientRpcInfo* rpc_info,
+                             size_t* pos) {
+    for (; *pos < rpc_info->interceptors_.size(); ++*pos) {
+      if (RunsClientInterceptor(rpc_info, *pos)) return true;
+    }
+    return false;
+  }
+
+  // Moves \a pos up the stack to the first interceptor run for the current
+  // batch, starting at \a pos itself. Returns false if there is none.
+  bool PreviousClientInterceptor(experimental::ClientRpcInfo* rpc_info,
+                                 size_t* pos) {
+    for (;; --*pos) {
+      if (RunsClientInterceptor(rpc_info, *pos)) return true;
+      if (*pos == 0) return false;
+    }
   }
 
   void RunServerInterceptors() {
@@ -312,9 +338,10 @@ class InterceptorBatchMethodsImpl
       return;
     }
     if (!reverse_) {
-      current_interceptor_index_++;
+      size_t pos = current_interceptor_index_ + 1;
       // We are going down the stack of interceptors
-      if (current_interceptor_index_ < rpc_info->interceptors_.size()) {
+      if (NextClientInterceptor(rpc_info, &pos)) {
+        current_interceptor_index_ = pos;
         if (rpc_info->hijacked_ &&
             current_interceptor_index_ > rpc_info->hijacked_interceptor_) {
           // This is a hijacked RPC and we are done with hijacking
@@ -327,10 +354,12 @@ class InterceptorBatchMethodsImpl
         ops_->ContinueFillOpsAfterInterception();
       }
     } else {
+      size_t pos = current_interceptor_index_ - 1;
       // We are going up the stack of interceptors
-      if (current_interceptor_index_ > 0) {
+      if (current_interceptor_index_ > 0 &&
+          PreviousClientInterceptor(rpc_info, &pos)) {
         // Continue running interceptors
-        current_interceptor_index_--;
+        current_interceptor_index_ = pos;
         rpc_info->RunInterceptor(this, current_interceptor_index_);
       } else {
         // we are done running all the interceptors without any hijacking
@@ -362,19 +391,9 @@ class InterceptorBatchMethodsImpl
     callback_();
   }
 
-  void ClearHookPoints() {
-    for (auto i = static_cast<experimental::InterceptionHookPoints>(0);
-         i < experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS;
-         i = static_cast<experimental::InterceptionHookPoints>(
-             static_cast<size_t>(i) + 1)) {
-      hooks_[static_cast<size_t>(i)] = false;
-    }
-  }
+  void ClearHookPoints() { hooks_.Clear(); }
 
-  std::array<bool,
-             static_cast<size_t>(
-                 experimental::InterceptionHookPoints::NUM_INTERCEPTION_HOOKS)>
-      hooks_;
+  experimental::InterceptionHookPointSet hooks_;
 
   size_t current_interceptor_index_ = 0;  // Current iterator
   bool reverse_ = false;
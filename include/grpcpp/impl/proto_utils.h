@@ -40,6 +40,11 @@
 
 namespace grpc {
 
+// Messages of up to this many bytes are serialized into a single slice of
+// exactly their size, using protobuf's flat array serializer; larger ones go
+// through ProtoBufferWriter, kProtoBufferWriterMaxBufferLength at a time.
+const size_t kProtoBufferWriterMaxSingleSliceLength = 4 * 1024 * 1024;
+
 // ProtoBufferWriter must be a subclass of ::protobuf::io::ZeroCopyOutputStream.
 template <class ProtoBufferWriter, class T>
 Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
@@ -50,9 +55,11 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
                 "::protobuf::io::ZeroCopyOutputStream");
   *own_buffer = true;
   int byte_size = static_cast<int>(msg.ByteSizeLong());
-  if (static_cast<size_t>(byte_size) <= GRPC_SLICE_INLINED_SIZE) {
+  if (static_cast<size_t>(byte_size) <=
+      kProtoBufferWriterMaxSingleSliceLength) {
     Slice slice(byte_size);
-    // We serialize directly into the allocated slices memory
+    // We serialize directly into the allocated slices memory, reusing the
+    // size ByteSizeLong() just cached instead of computing it again
     ABSL_CHECK(slice.end() == msg.SerializeWithCachedSizesToArray(
                                   const_cast<uint8_t*>(slice.begin())));
     ByteBuffer tmp(&slice, 1);
@@ -51,15 +51,23 @@ class MethodHandler {
     /// \param requester : used only by the callback API. It is a function
     ///        called by the RPC Controller to request another RPC (and also
     ///        to set up the state required to make that request possible)
+    /// \param inlined : used only by the callback API. Whether the
+    ///        reactions of the call run inline, see
+    ///        RpcServiceMethod::inline_reactions
+    /// \param ahead : used only by the sync API. Whether the next message of
+    ///        the call is read ahead, see RpcServiceMethod::read_ahead
     HandlerParameter(Call* c, grpc::ServerContextBase* context, void* req,
                      Status req_status, void* handler_data,
-                     std::function<void()> requester)
+                     std::function<void()> requester,
+                     bool inlined = false, bool ahead = false)
         : call(c),
           server_context(context),
           request(req),
           status(req_status),
           internal_data(handler_data),
-          call_requester(std::move(requester)) {}
+          call_requester(std::move(requester)),
+          inline_reactions(inlined),
+          read_ahead(ahead) {}
     ~HandlerParameter() {}
     Call* const call;
     grpc::ServerContextBase* const server_context;
@@ -67,6 +75,8 @@ class MethodHandler {
     const Status status;
     void* const internal_data;
     const std::function<void()> call_requester;
+    const bool inline_reactions;
+    const bool read_ahead;
   };
   virtual void RunHandler(const HandlerParameter& param) = 0;
 
@@ -107,6 +117,18 @@ class RpcServiceMethod : public RpcMethod {
   MethodHandler* handler() const { return handler_.get(); }
   ApiType api_type() const { return api_type_; }
   void SetHandler(MethodHandler* handler) { handler_.reset(handler); }
+  /// Callback API only: whether the reactions of the calls of the method run
+  /// inline, in the thread completing the operation that triggers them,
+  /// rather than dispatched to another thread.
+  bool inline_reactions() const { return inline_reactions_; }
+  void SetInlineReactions(bool inline_reactions) {
+    inline_reactions_ = inline_reactions;
+  }
+  /// Sync API only: whether the next message of the client streaming and
+  /// bidi streaming calls of the method is received while the handler
+  /// processes the one it just read.
+  bool read_ahead() const { return read_ahead_; }
+  void SetReadAhead(bool read_ahead) { read_ahead_ = read_ahead; }
   void SetServerApiType(RpcServiceMethod::ApiType type) {
     if ((api_type_ == ApiType::SYNC) &&
         (type == ApiType::ASYNC || type == ApiType::RAW)) {
@@ -130,6 +152,8 @@ class RpcServiceMethod : public RpcMethod {
   void* server_tag_;
   ApiType api_type_;
   std::unique_ptr<MethodHandler> handler_;
+  bool inline_reactions_ = false;
+  bool read_ahead_ = false;
 
   const char* TypeToString(RpcServiceMethod::ApiType type) {
     switch (type) {
@@ -19,6 +19,8 @@
 #ifndef GRPCPP_IMPL_SERIALIZATION_TRAITS_H
 #define GRPCPP_IMPL_SERIALIZATION_TRAITS_H
 
+#include <type_traits>
+
 namespace grpc {
 
 /// Defines how to serialize and deserialize some type.
@@ -57,6 +59,20 @@ template <class Message,
           class UnusedButHereForPartialTemplateSpecialization = void>
 class SerializationTraits;
 
+/// EXPERIMENTAL: Specialize as std::true_type to let calls hand messages of
+/// type Message from the sender to a receiver of the same type without
+/// serializing them, as long as nothing on the way needs their bytes: in
+/// practice, between a client and a server of the same binary connected by an
+/// in-process channel. The sender copies the message rather than serializing
+/// it, so Message must be copy constructible and move assignable. Its
+/// SerializationTraits are still used whenever its bytes are needed, e.g. by
+/// other transports, by receivers of other types, or by interceptors. Like
+/// SerializationTraits, the specialization must be visible wherever the calls
+/// of Message are instantiated, generated code included.
+template <class Message,
+          class UnusedButHereForPartialTemplateSpecialization = void>
+struct PassMessageObjects : std::false_type {};
+
 }  // namespace grpc
 
 #endif  // GRPCPP_IMPL_SERIALIZATION_TRAITS_H
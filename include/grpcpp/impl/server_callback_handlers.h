@@ -58,6 +58,7 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
         ServerCallbackUnaryImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
             param.call, allocator_state, param.call_requester);
+    call->SetInlineReactions(param.inline_reactions);
     param.server_context->BeginCompletionOp(
         param.call, [call](bool) { call->MaybeDone(); }, call);
 
@@ -97,7 +98,7 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
     *handler_data = allocator_state;
     request = allocator_state->request();
     *status =
-        grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
+        grpc::internal::DeserializeMessage(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
@@ -155,7 +156,8 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
       // is directly invoking a user-controlled reaction
       // (OnSendInitialMetadataDone). Thus it must be dispatched to an executor
       // thread. However, any OnDone needed after that can be inlined because it
-      // is already running on an executor thread.
+      // is already running on an executor thread. Methods with inline reactions
+      // promise that their reactions do not block.
       meta_tag_.Set(
           call_.call(),
           [this](bool ok) {
@@ -164,7 +166,7 @@ class CallbackUnaryHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->inline_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -260,6 +262,14 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
           grpc::CallbackServerContext*, ResponseType*)>
           get_reactor)
       : get_reactor_(std::move(get_reactor)) {}
+
+  // Only the response of the messages the allocator returns is used: the
+  // requests are read into the messages passed to ServerCallbackReader::Read.
+  void SetMessageAllocator(
+      MessageAllocator<RequestType, ResponseType>* allocator) {
+    allocator_ = allocator;
+  }
+
   void RunHandler(const HandlerParameter& param) final {
     // Arena allocate a reader structure (that includes response)
     grpc_call_ref(param.call->call());
@@ -268,7 +278,10 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
                                               sizeof(ServerCallbackReaderImpl)))
         ServerCallbackReaderImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
-            param.call, param.call_requester);
+            param.call,
+            allocator_ == nullptr ? nullptr : allocator_->AllocateMessages(),
+            param.call_requester);
+    reader->SetInlineReactions(param.inline_reactions);
     // Inlineable OnDone can be false in the CompletionOp callback because there
     // is no read reactor that has an inlineable OnDone; this only applies to
     // the DefaultReactor (which is unary).
@@ -301,6 +314,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
   std::function<ServerReadReactor<RequestType>*(grpc::CallbackServerContext*,
                                                 ResponseType*)>
       get_reactor_;
+  MessageAllocator<RequestType, ResponseType>* allocator_ = nullptr;
 
   class ServerCallbackReaderImpl : public ServerCallbackReader<RequestType> {
    public:
@@ -341,7 +355,8 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
       this->Ref();
       // The callback for this function should not be inlined because it invokes
       // a user-controlled reaction, but any resulting OnDone can be inlined in
-      // the executor to which this callback is dispatched.
+      // the executor to which this callback is dispatched. Methods with inline
+      // reactions promise that their reactions do not block.
       meta_tag_.Set(
           call_.call(),
           [this](bool ok) {
@@ -350,7 +365,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->inline_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -370,10 +385,18 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
    private:
     friend class CallbackClientStreamingHandler<RequestType, ResponseType>;
 
-    ServerCallbackReaderImpl(grpc::CallbackServerContext* ctx,
-                             grpc::internal::Call* call,
-                             std::function<void()> call_requester)
-        : ctx_(ctx), call_(*call), call_requester_(std::move(call_requester)) {}
+    ServerCallbackReaderImpl(
+        grpc::CallbackServerContext* ctx, grpc::internal::Call* call,
+        MessageHolder<RequestType, ResponseType>* allocator_state,
+        std::function<void()> call_requester)
+        : ctx_(ctx),
+          call_(*call),
+          allocator_state_(allocator_state),
+          call_requester_(std::move(call_requester)) {
+      if (allocator_state_ != nullptr) {
+        ctx_->set_message_allocator_state(allocator_state_);
+      }
+    }
 
     grpc_call* call() override { return call_.call(); }
 
@@ -381,7 +404,8 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
       reactor_.store(reactor, std::memory_order_relaxed);
       // The callback for this function should not be inlined because it invokes
       // a user-controlled reaction, but any resulting OnDone can be inlined in
-      // the executor to which this callback is dispatched.
+      // the executor to which this callback is dispatched. Methods with inline
+      // reactions promise that their reactions do not block.
       read_tag_.Set(
           call_.call(),
           [this, reactor](bool ok) {
@@ -391,7 +415,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnReadDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &read_ops_, /*can_inline=*/false);
+          &read_ops_, /*can_inline=*/this->inline_reactions());
       read_ops_.set_core_cq_tag(&read_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -403,12 +427,18 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
 
     ~ServerCallbackReaderImpl() {}
 
-    ResponseType* response() { return &resp_; }
+    ResponseType* response() {
+      return allocator_state_ != nullptr ? allocator_state_->response()
+                                         : &resp_;
+    }
 
     void CallOnDone() override {
       reactor_.load(std::memory_order_relaxed)->OnDone();
       grpc_call* call = call_.call();
       auto call_requester = std::move(call_requester_);
+      if (allocator_state_ != nullptr) {
+        allocator_state_->Release();
+      }
       if (ctx_->context_allocator() != nullptr) {
         ctx_->context_allocator()->Release(ctx_);
       }
@@ -436,6 +466,7 @@ class CallbackClientStreamingHandler : public grpc::internal::MethodHandler {
     grpc::CallbackServerContext* const ctx_;
     grpc::internal::Call call_;
     ResponseType resp_;
+    MessageHolder<RequestType, ResponseType>* const allocator_state_;
     std::function<void()> call_requester_;
     // The memory ordering of reactor_ follows ServerCallbackUnaryImpl.
     std::atomic<ServerReadReactor<RequestType>*> reactor_;
@@ -453,6 +484,14 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
           grpc::CallbackServerContext*, const RequestType*)>
           get_reactor)
       : get_reactor_(std::move(get_reactor)) {}
+
+  // Only the request of the messages the allocator returns is used: the
+  // responses are the messages passed to ServerCallbackWriter::Write.
+  void SetMessageAllocator(
+      MessageAllocator<RequestType, ResponseType>* allocator) {
+    allocator_ = allocator;
+  }
+
   void RunHandler(const HandlerParameter& param) final {
     // Arena allocate a writer structure
     grpc_call_ref(param.call->call());
@@ -462,7 +501,10 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
         ServerCallbackWriterImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
             param.call, static_cast<RequestType*>(param.request),
+            static_cast<MessageHolder<RequestType, ResponseType>*>(
+                param.internal_data),
             param.call_requester);
+    writer->SetInlineReactions(param.inline_reactions);
     // Inlineable OnDone can be false in the CompletionOp callback because there
     // is no write reactor that has an inlineable OnDone; this only applies to
     // the DefaultReactor (which is unary).
@@ -491,18 +533,26 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
   }
 
   void* Deserialize(grpc_call* call, grpc_byte_buffer* req,
-                    grpc::Status* status, void** /*handler_data*/) final {
+                    grpc::Status* status, void** handler_data) final {
     grpc::ByteBuffer buf;
     buf.set_buffer(req);
-    auto* request =
-        new (grpc_call_arena_alloc(call, sizeof(RequestType))) RequestType();
+    RequestType* request;
+    if (allocator_ != nullptr) {
+      // The writer releases the messages, whether or not this succeeds.
+      auto* allocator_state = allocator_->AllocateMessages();
+      *handler_data = allocator_state;
+      request = allocator_state->request();
+    } else {
+      request =
+          new (grpc_call_arena_alloc(call, sizeof(RequestType))) RequestType();
+    }
     *status =
-        grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
+        grpc::internal::DeserializeMessage(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
     }
-    request->~RequestType();
+    if (allocator_ == nullptr) request->~RequestType();
     return nullptr;
   }
 
@@ -510,6 +560,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
   std::function<ServerWriteReactor<ResponseType>*(grpc::CallbackServerContext*,
                                                   const RequestType*)>
       get_reactor_;
+  MessageAllocator<RequestType, ResponseType>* allocator_ = nullptr;
 
   class ServerCallbackWriterImpl : public ServerCallbackWriter<ResponseType> {
    public:
@@ -545,7 +596,8 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
       this->Ref();
       // The callback for this function should not be inlined because it invokes
       // a user-controlled reaction, but any resulting OnDone can be inlined in
-      // the executor to which this callback is dispatched.
+      // the executor to which this callback is dispatched. Methods with inline
+      // reactions promise that their reactions do not block.
       meta_tag_.Set(
           call_.call(),
           [this](bool ok) {
@@ -554,7 +606,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->inline_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -594,13 +646,20 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
    private:
     friend class CallbackServerStreamingHandler<RequestType, ResponseType>;
 
-    ServerCallbackWriterImpl(grpc::CallbackServerContext* ctx,
-                             grpc::internal::Call* call, const RequestType* req,
-                             std::function<void()> call_requester)
+    ServerCallbackWriterImpl(
+        grpc::CallbackServerContext* ctx, grpc::internal::Call* call,
+        const RequestType* req,
+        MessageHolder<RequestType, ResponseType>* allocator_state,
+        std::function<void()> call_requester)
         : ctx_(ctx),
           call_(*call),
           req_(req),
-          call_requester_(std::move(call_requester)) {}
+          allocator_state_(allocator_state),
+          call_requester_(std::move(call_requester)) {
+      if (allocator_state_ != nullptr) {
+        ctx_->set_message_allocator_state(allocator_state_);
+      }
+    }
 
     grpc_call* call() override { return call_.call(); }
 
@@ -608,14 +667,15 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
       reactor_.store(reactor, std::memory_order_relaxed);
       // The callback for this function should not be inlined because it invokes
       // a user-controlled reaction, but any resulting OnDone can be inlined in
-      // the executor to which this callback is dispatched.
+      // the executor to which this callback is dispatched. Methods with inline
+      // reactions promise that their reactions do not block.
       write_tag_.Set(
           call_.call(),
           [this, reactor](bool ok) {
             reactor->OnWriteDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &write_ops_, /*can_inline=*/false);
+          &write_ops_, /*can_inline=*/this->inline_reactions());
       write_ops_.set_core_cq_tag(&write_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -625,7 +685,9 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
       this->MaybeDone(/*inlineable_ondone=*/false);
     }
     ~ServerCallbackWriterImpl() {
-      if (req_ != nullptr) {
+      if (allocator_state_ != nullptr) {
+        allocator_state_->Release();
+      } else if (req_ != nullptr) {
         req_->~RequestType();
       }
     }
@@ -664,6 +726,7 @@ class CallbackServerStreamingHandler : public grpc::internal::MethodHandler {
     grpc::CallbackServerContext* const ctx_;
     grpc::internal::Call call_;
     const RequestType* req_;
+    MessageHolder<RequestType, ResponseType>* const allocator_state_;
     std::function<void()> call_requester_;
     // The memory ordering of reactor_ follows ServerCallbackUnaryImpl.
     std::atomic<ServerWriteReactor<ResponseType>*> reactor_;
@@ -689,6 +752,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
         ServerCallbackReaderWriterImpl(
             static_cast<grpc::CallbackServerContext*>(param.server_context),
             param.call, param.call_requester);
+    stream->SetInlineReactions(param.inline_reactions);
     // Inlineable OnDone can be false in the CompletionOp callback because there
     // is no bidi reactor that has an inlineable OnDone; this only applies to
     // the DefaultReactor (which is unary).
@@ -757,7 +821,8 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
       this->Ref();
       // The callback for this function should not be inlined because it invokes
       // a user-controlled reaction, but any resulting OnDone can be inlined in
-      // the executor to which this callback is dispatched.
+      // the executor to which this callback is dispatched. Methods with inline
+      // reactions promise that their reactions do not block.
       meta_tag_.Set(
           call_.call(),
           [this](bool ok) {
@@ -766,7 +831,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnSendInitialMetadataDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &meta_ops_, /*can_inline=*/false);
+          &meta_ops_, /*can_inline=*/this->inline_reactions());
       meta_ops_.SendInitialMetadata(&ctx_->initial_metadata_,
                                     ctx_->initial_metadata_flags());
       if (ctx_->compression_level_set()) {
@@ -822,14 +887,15 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
       reactor_.store(reactor, std::memory_order_relaxed);
       // The callbacks for these functions should not be inlined because they
       // invoke user-controlled reactions, but any resulting OnDones can be
-      // inlined in the executor to which a callback is dispatched.
+      // inlined in the executor to which a callback is dispatched. Methods with
+      // inline reactions promise that their reactions do not block.
       write_tag_.Set(
           call_.call(),
           [this, reactor](bool ok) {
             reactor->OnWriteDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &write_ops_, /*can_inline=*/false);
+          &write_ops_, /*can_inline=*/this->inline_reactions());
       write_ops_.set_core_cq_tag(&write_tag_);
       read_tag_.Set(
           call_.call(),
@@ -840,7 +906,7 @@ class CallbackBidiHandler : public grpc::internal::MethodHandler {
             reactor->OnReadDone(ok);
             this->MaybeDone(/*inlineable_ondone=*/true);
           },
-          &read_ops_, /*can_inline=*/false);
+          &read_ops_, /*can_inline=*/this->inline_reactions());
       read_ops_.set_core_cq_tag(&read_tag_);
       this->BindReactor(reactor);
       this->MaybeCallOnCancel(reactor);
@@ -217,6 +217,48 @@ class Service {
         internal::RpcServiceMethod::ApiType::RAW_CALL_BACK);
   }
 
+  /// EXPERIMENTAL: Runs the reactions of the callback API calls of the method
+  /// (OnReadDone, OnWriteDone, OnDone...) inline, in the thread completing
+  /// the operation that triggers them, rather than dispatching each one to
+  /// another thread. Only for methods whose reactions never block, e.g. by
+  /// waiting on a lock or doing I/O: they would stall the transport. May be
+  /// called from the constructor of a callback service.
+  void MarkMethodInlineReactions(int index) {
+    size_t idx = static_cast<size_t>(index);
+    ABSL_CHECK_NE(methods_[idx].get(), nullptr)
+        << "Cannot run the reactions of a 'generic' method inline.";
+    methods_[idx]->SetInlineReactions(true);
+  }
+
+  /// EXPERIMENTAL: MarkMethodInlineReactions for all the methods of the
+  /// service that are not generic.
+  void MarkAllMethodsInlineReactions() {
+    for (auto& method : methods_) {
+      if (method != nullptr) method->SetInlineReactions(true);
+    }
+  }
+
+  /// EXPERIMENTAL: For the calls of the method, if it is a sync client
+  /// streaming or bidi streaming method, receives the next message from the
+  /// client as soon as the handler read one, so that the next Read does not
+  /// wait for a round trip to the transport. At most one message is buffered
+  /// ahead per call: the flow control of the transport pushes back on the
+  /// client beyond that. May be called from the constructor of a service.
+  void MarkMethodReadAhead(int index) {
+    size_t idx = static_cast<size_t>(index);
+    ABSL_CHECK_NE(methods_[idx].get(), nullptr)
+        << "Cannot read the messages of a 'generic' method ahead.";
+    methods_[idx]->SetReadAhead(true);
+  }
+
+  /// EXPERIMENTAL: MarkMethodReadAhead for all the methods of the service
+  /// that are not generic.
+  void MarkAllMethodsReadAhead() {
+    for (auto& method : methods_) {
+      if (method != nullptr) method->SetReadAhead(true);
+    }
+  }
+
   internal::MethodHandler* GetHandler(int index) {
     size_t idx = static_cast<size_t>(index);
     return methods_[idx]->handler();
@@ -36,6 +36,14 @@ class ResourceQuota final : private grpc::internal::GrpcLibrary {
   /// \param name - a unique name for this ResourceQuota.
   explicit ResourceQuota(const std::string& name);
   ResourceQuota();
+  /// EXPERIMENTAL: Creates a child of \a parent named \a name. Memory and
+  /// threads used under the child also count against \a parent, but running
+  /// out of memory in the child only reclaims memory from the child.
+  /// The child is sized by \a parent: it gets \a min_memory bytes and
+  /// \a min_threads threads, plus its share, by \a weight relative to the
+  /// other children, of what \a parent has beyond their minimums.
+  ResourceQuota(const std::string& name, const ResourceQuota& parent,
+                size_t min_memory, int min_threads, double weight = 1);
   ~ResourceQuota() override;
 
   /// Resize this \a ResourceQuota to a new size. If \a new_size is smaller
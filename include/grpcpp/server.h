@@ -48,6 +48,7 @@ class ServerInitializer;
 
 namespace internal {
 class ExternalConnectionAcceptorImpl;
+class ServerMethodLoadStats;
 }  // namespace internal
 
 /// Represents a gRPC server.
@@ -352,6 +353,9 @@ class Server : public ServerInterface, private internal::GrpcLibrary {
 
   // Interface to read or update server-wide metrics. Optional.
   experimental::ServerMetricRecorder* server_metric_recorder_ = nullptr;
+
+  // Concurrency and queue delay of the sync and callback methods.
+  std::unique_ptr<internal::ServerMethodLoadStats> method_load_stats_;
 };
 
 }  // namespace grpc
@@ -77,6 +77,14 @@ class ExternalConnectionAcceptor {
   // If called before grpc::Server is started or after it is shut down, the new
   // connection will be closed.
   virtual void HandleNewConnection(NewConnectionParameters* p) = 0;
+  // Hands off several connections at once. Equivalent to HandleNewConnection()
+  // on each of them, but lets implementations share the per-connection setup
+  // across the batch.
+  virtual void HandleNewConnections(std::vector<NewConnectionParameters>* p) {
+    for (NewConnectionParameters& connection : *p) {
+      HandleNewConnection(&connection);
+    }
+  }
 };
 
 }  // namespace experimental
@@ -295,6 +303,15 @@ class ServerBuilder {
     void EnableCallMetricRecording(
         experimental::ServerMetricRecorder* server_metric_recorder = nullptr);
 
+    /// Binds each connection to one of the completion queues added with
+    /// \a AddCompletionQueue, and only delivers the calls of the connection
+    /// (requested with RequestAsyncCall and the like) to that completion
+    /// queue, so that the processing of a connection stays on the threads
+    /// serving its completion queue. Every completion queue must then have
+    /// calls requested on it for every method: calls of a connection wait
+    /// for a request on their own completion queue.
+    void EnableCompletionQueueConnectionAffinity();
+
     // Creates a passive listener for Server Endpoint injection.
     ///
     /// \a PasiveListener lets applications provide pre-established connections
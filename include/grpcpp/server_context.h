@@ -38,6 +38,7 @@
 #include <grpcpp/impl/metadata_map.h>
 #include <grpcpp/impl/rpc_service_method.h>
 #include <grpcpp/security/auth_context.h>
+#include <grpcpp/support/call_phase_timestamps.h>
 #include <grpcpp/support/callback_common.h>
 #include <grpcpp/support/config.h>
 #include <grpcpp/support/message_allocator.h>
@@ -301,6 +302,11 @@ class ServerContextBase {
   /// Returns the call's authority.
   grpc::string_ref ExperimentalGetAuthority() const;
 
+  /// EXPERIMENTAL API
+  /// Returns the timestamps of the phases of the call so far, see
+  /// GRPC_ARG_CALL_PHASE_TIMESTAMPS.
+  experimental::CallPhaseTimestamps ExperimentalGetCallPhaseTimestamps() const;
+
  protected:
   /// Async only. Has to be called before the rpc starts.
   /// Returns the tag in completion queue when the rpc finishes.
@@ -314,7 +320,8 @@ class ServerContextBase {
 
   /// NOTE: This is an API for advanced users who need custom allocators.
   /// Get and maybe mutate the allocator state associated with the current RPC.
-  /// Currently only applicable for callback unary RPC methods.
+  /// Currently only applicable for callback unary, client-streaming and
+  /// server-streaming RPC methods.
   RpcAllocatorState* GetRpcAllocatorState() { return message_allocator_state_; }
 
   /// Get a library-owned default unary reactor for use in minimal reaction
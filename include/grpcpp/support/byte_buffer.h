@@ -19,8 +19,11 @@
 #ifndef GRPCPP_SUPPORT_BYTE_BUFFER_H
 #define GRPCPP_SUPPORT_BYTE_BUFFER_H
 
+#include <utility>
 #include <vector>
 
+#include "absl/strings/cord.h"
+
 #include <grpc/byte_buffer.h>
 #include <grpc/grpc.h>
 #include <grpc/support/log.h>
@@ -54,6 +57,8 @@ class ExternalConnectionAcceptorImpl;
 template <class R>
 class DeserializeFuncType;
 class GrpcByteBufferPeer;
+template <class M, bool kPassMessageObjects>
+class MessageSerializer;
 
 }  // namespace internal
 /// A sequence of bytes.
@@ -88,6 +93,10 @@ class ByteBuffer final {
         reinterpret_cast<grpc_slice*>(const_cast<Slice*>(slices)), nslices);
   }
 
+  /// Construct buffer from the contents of \a cord. Large chunks of the cord
+  /// are referenced rather than copied, and kept alive by the buffer.
+  explicit ByteBuffer(const absl::Cord& cord);
+
   /// Construct a byte buffer by referencing elements of existing buffer
   /// \a buf. Wrapper of core function grpc_byte_buffer_copy . This is not
   /// a deep copy; it is just a referencing. As a result, its performance is
@@ -124,6 +133,10 @@ class ByteBuffer final {
   /// Dump (read) the buffer contents into \a slices.
   Status Dump(std::vector<Slice>* slices) const;
 
+  /// Dump (read) the buffer contents into \a cord. Large slices are
+  /// referenced by the cord rather than copied.
+  Status DumpToCord(absl::Cord* cord) const;
+
   /// Remove all data.
   void Clear() {
     if (buffer_) {
@@ -182,6 +195,8 @@ class ByteBuffer final {
   friend class ProtoBufferWriter;
   friend class internal::GrpcByteBufferPeer;
   friend class internal::ExternalConnectionAcceptorImpl;
+  template <class M, bool kPassMessageObjects>
+  friend class internal::MessageSerializer;
 
   grpc_byte_buffer* buffer_;
 
@@ -229,6 +244,116 @@ class SerializationTraits<ByteBuffer, void> {
   }
 };
 
+namespace internal {
+
+/// The operations on message objects of one type, see PassMessageObjects.
+struct MessageObjectOps {
+  Status (*serialize)(const void* object, ByteBuffer* buffer);
+  void (*destroy)(void* object);
+};
+
+/// Returns a byte buffer that carries \a object, and takes ownership of it.
+grpc_byte_buffer* CreateMessageObjectByteBuffer(void* object,
+                                                const MessageObjectOps* ops);
+
+/// If \a buffer carries a message object with operations \a ops, takes the
+/// object out of the buffer and returns it. Returns nullptr otherwise.
+void* ReleaseMessageObject(grpc_byte_buffer* buffer,
+                           const MessageObjectOps* ops);
+
+/// Serializes and deserializes messages of type M.
+template <class M, bool kPassMessageObjects>
+class MessageSerializer {
+ public:
+  static Status Serialize(const M& message, ByteBuffer* buffer,
+                          bool* own_buffer) {
+    return SerializationTraits<M>::Serialize(message, buffer->bbuf_ptr(),
+                                             own_buffer);
+  }
+  static Status Deserialize(ByteBuffer* buffer, M* message) {
+    return SerializationTraits<M>::Deserialize(buffer->bbuf_ptr(), message);
+  }
+};
+
+/// Hands over copies of messages of type M as message objects, and only
+/// serializes them when their bytes are needed.
+template <class M>
+class MessageSerializer<M, true> {
+ public:
+  static Status Serialize(const M& message, ByteBuffer* buffer,
+                          bool* own_buffer) {
+    buffer->set_buffer(CreateMessageObjectByteBuffer(new M(message), &kOps));
+    *own_buffer = true;
+    return Status::OK;
+  }
+  static Status Deserialize(ByteBuffer* buffer, M* message) {
+    if (buffer->Valid()) {
+      void* object = ReleaseMessageObject(buffer->c_buffer(), &kOps);
+      if (object != nullptr) {
+        *message = std::move(*static_cast<M*>(object));
+        Destroy(object);
+        buffer->Clear();
+        return Status::OK;
+      }
+    }
+    return MessageSerializer<M, false>::Deserialize(buffer, message);
+  }
+
+ private:
+  static Status SerializeObject(const void* object, ByteBuffer* buffer) {
+    bool own_buffer;
+    Status status = MessageSerializer<M, false>::Serialize(
+        *static_cast<const M*>(object), buffer, &own_buffer);
+    if (status.ok() && !own_buffer) buffer->Duplicate();
+    return status;
+  }
+  static void Destroy(void* object) { delete static_cast<M*>(object); }
+
+  static const MessageObjectOps kOps;
+};
+
+template <class M>
+const MessageObjectOps MessageSerializer<M, true>::kOps = {
+    &MessageSerializer<M, true>::SerializeObject,
+    &MessageSerializer<M, true>::Destroy};
+
+/// Serializes \a message into \a buffer as SerializationTraits<M> does, or,
+/// if M passes its message objects, makes \a buffer carry a copy of it.
+template <class M>
+Status SerializeMessage(const M& message, ByteBuffer* buffer,
+                        bool* own_buffer) {
+  return MessageSerializer<M, PassMessageObjects<M>::value>::Serialize(
+      message, buffer, own_buffer);
+}
+
+/// Deserializes \a buffer into \a message as SerializationTraits<M> does, or
+/// moves the message object it carries into \a message.
+template <class M>
+Status DeserializeMessage(ByteBuffer* buffer, M* message) {
+  return MessageSerializer<M, PassMessageObjects<M>::value>::Deserialize(
+      buffer, message);
+}
+
+}  // namespace internal
+
+/// Lets cords be sent and received as messages (e.g. through the generic
+/// API) without flattening them.
+template <>
+class SerializationTraits<absl::Cord, void> {
+ public:
+  static Status Deserialize(ByteBuffer* byte_buffer, absl::Cord* dest) {
+    Status status = byte_buffer->DumpToCord(dest);
+    byte_buffer->Clear();
+    return status;
+  }
+  static Status Serialize(const absl::Cord& source, ByteBuffer* buffer,
+                          bool* own_buffer) {
+    *buffer = ByteBuffer(source);
+    *own_buffer = true;
+    return grpc::Status::OK;
+  }
+};
+
 }  // namespace grpc
 
 #endif  // GRPCPP_SUPPORT_BYTE_BUFFER_H
@@ -0,0 +1,49 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_SUPPORT_CALL_PHASE_TIMESTAMPS_H
+#define GRPCPP_SUPPORT_CALL_PHASE_TIMESTAMPS_H
+
+#include <grpc/support/time.h>
+
+namespace grpc {
+namespace experimental {
+
+/// EXPERIMENTAL: Monotonic (GPR_CLOCK_MONOTONIC) timestamps of the phases of
+/// an RPC, as seen from one side of it. They are only recorded when the
+/// channel or server sets GRPC_ARG_CALL_PHASE_TIMESTAMPS. A phase that did
+/// not happen (yet), or that the transport does not report, is
+/// gpr_inf_past(GPR_CLOCK_MONOTONIC).
+struct CallPhaseTimestamps {
+  /// The transport started parsing the initial metadata of the peer.
+  gpr_timespec first_byte_received;
+  /// The initial metadata of the peer was parsed.
+  gpr_timespec initial_metadata_received;
+  /// Server only: the RPC was handed to the application.
+  gpr_timespec handler_invoked;
+  /// The initial metadata of this side was written to the wire.
+  gpr_timespec initial_metadata_written;
+  /// The last frame of this side was written to the wire: the trailing
+  /// metadata on the server, the half-close on the client.
+  gpr_timespec end_of_stream_written;
+};
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_SUPPORT_CALL_PHASE_TIMESTAMPS_H
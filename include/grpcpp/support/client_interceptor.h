@@ -20,6 +20,7 @@
 #define GRPCPP_SUPPORT_CLIENT_INTERCEPTOR_H
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "absl/log/absl_check.h"
@@ -53,6 +54,52 @@ class ClientInterceptorFactoryInterface {
   // otherwise. If nullptr is returned, this server interceptor factory is
   // ignored for the purposes of that RPC.
   virtual Interceptor* CreateClientInterceptor(ClientRpcInfo* info) = 0;
+
+  /// EXPERIMENTAL: Returns the hook points the interceptors of this factory
+  /// act on. They are skipped for the batches that have none of them, and
+  /// may not see all the hook points of the batches they are run for. An
+  /// interceptor that hijacks an RPC must subscribe to
+  /// PRE_SEND_INITIAL_METADATA, and is run for all the later batches of that
+  /// RPC. Defaults to all the hook points.
+  virtual InterceptionHookPointSet hook_points() {
+    return InterceptionHookPointSet::All();
+  }
+
+  /// EXPERIMENTAL: Returns whether the interceptors returned by
+  /// CreateClientInterceptor are owned by this factory rather than by the
+  /// RPCs, as when the factory returns the same interceptor for every RPC.
+  /// Such an interceptor must outlive the channels the factory is registered
+  /// with, and may be run concurrently for different RPCs. Defaults to false.
+  virtual bool shares_interceptors() { return false; }
+};
+
+/// EXPERIMENTAL: A factory for an interceptor that keeps no state per RPC. A
+/// single \a InterceptorType interceptor, built from the arguments of the
+/// factory, is shared by all the RPCs, so that none is allocated per RPC. It
+/// subscribes to the \a kHookPoints hook points, or to all of them if none is
+/// given, so that it is only run for the batches it acts on.
+template <typename InterceptorType, InterceptionHookPoints... kHookPoints>
+class StatelessClientInterceptorFactory final
+    : public ClientInterceptorFactoryInterface {
+ public:
+  template <typename... Args>
+  explicit StatelessClientInterceptorFactory(Args&&... args)
+      : interceptor_(std::forward<Args>(args)...) {}
+
+  Interceptor* CreateClientInterceptor(ClientRpcInfo* /*info*/) override {
+    return &interceptor_;
+  }
+
+  InterceptionHookPointSet hook_points() override {
+    return sizeof...(kHookPoints) == 0
+               ? InterceptionHookPointSet::All()
+               : InterceptionHookPointSet({kHookPoints...});
+  }
+
+  bool shares_interceptors() override { return true; }
+
+ private:
+  InterceptorType interceptor_;
 };
 }  // namespace experimental
 
@@ -142,7 +189,23 @@ class ClientRpcInfo {
   void RunInterceptor(
       experimental::InterceptorBatchMethods* interceptor_methods, size_t pos) {
     ABSL_CHECK_LT(pos, interceptors_.size());
-    interceptors_[pos]->Intercept(interceptor_methods);
+    interceptors_[pos].interceptor->Intercept(interceptor_methods);
+  }
+
+  // Returns whether the interceptor at pos \a pos acts on any of \a hooks.
+  bool InterceptorSubscribes(size_t pos,
+                             experimental::InterceptionHookPointSet hooks) {
+    return interceptors_[pos].hook_points.Intersects(hooks);
+  }
+
+  void AddInterceptor(
+      experimental::ClientInterceptorFactoryInterface* creator) {
+    auto* interceptor = creator->CreateClientInterceptor(this);
+    if (interceptor == nullptr) return;
+    interceptors_.push_back(RegisteredInterceptor{
+        InterceptorPtr(interceptor,
+                       InterceptorDeleter{!creator->shares_interceptors()}),
+        creator->hook_points()});
   }
 
   void RegisterInterceptors(
@@ -159,36 +222,45 @@ class ClientRpcInfo {
       // No interceptors to register
       return;
     }
+    interceptors_.reserve(num_interceptors - interceptor_pos);
     if (internal::g_global_client_stats_interceptor_factory != nullptr) {
-      interceptors_.push_back(std::unique_ptr<experimental::Interceptor>(
-          internal::g_global_client_stats_interceptor_factory
-              ->CreateClientInterceptor(this)));
+      AddInterceptor(internal::g_global_client_stats_interceptor_factory);
       --interceptor_pos;
     }
     // NOTE: The following is not a range-based for loop because it will only
     //       iterate over a portion of the creators vector.
     for (auto it = creators.begin() + interceptor_pos; it != creators.end();
          ++it) {
-      auto* interceptor = (*it)->CreateClientInterceptor(this);
-      if (interceptor != nullptr) {
-        interceptors_.push_back(
-            std::unique_ptr<experimental::Interceptor>(interceptor));
-      }
+      AddInterceptor(it->get());
     }
     if (internal::g_global_client_interceptor_factory != nullptr) {
-      interceptors_.push_back(std::unique_ptr<experimental::Interceptor>(
-          internal::g_global_client_interceptor_factory
-              ->CreateClientInterceptor(this)));
+      AddInterceptor(internal::g_global_client_interceptor_factory);
     }
   }
 
+  // Deletes the interceptors owned by the RPC, and not the ones shared by
+  // their factory.
+  struct InterceptorDeleter {
+    bool owned;
+    void operator()(experimental::Interceptor* interceptor) const {
+      if (owned) delete interceptor;
+    }
+  };
+  using InterceptorPtr =
+      std::unique_ptr<experimental::Interceptor, InterceptorDeleter>;
+
+  struct RegisteredInterceptor {
+    InterceptorPtr interceptor;
+    experimental::InterceptionHookPointSet hook_points;
+  };
+
   grpc::ClientContext* ctx_ = nullptr;
   // TODO(yashykt): make type_ const once move-assignment is deleted
   Type type_{Type::UNKNOWN};
   const char* method_ = nullptr;
   const char* suffix_for_stats_ = nullptr;
   grpc::ChannelInterface* channel_ = nullptr;
-  std::vector<std::unique_ptr<experimental::Interceptor>> interceptors_;
+  std::vector<RegisteredInterceptor> interceptors_;
   bool hijacked_ = false;
   size_t hijacked_interceptor_ = 0;
 
@@ -19,6 +19,9 @@
 #ifndef GRPCPP_SUPPORT_INTERCEPTOR_H
 #define GRPCPP_SUPPORT_INTERCEPTOR_H
 
+#include <stdint.h>
+
+#include <initializer_list>
 #include <map>
 #include <memory>
 #include <string>
@@ -80,6 +83,49 @@ enum class InterceptionHookPoints {
   NUM_INTERCEPTION_HOOKS
 };
 
+/// EXPERIMENTAL: A set of interception hook points. Interceptor factories use
+/// it to subscribe their interceptors to the hook points they act on only.
+class InterceptionHookPointSet {
+ public:
+  /// The set of all the hook points
+  static constexpr InterceptionHookPointSet All() {
+    return InterceptionHookPointSet(
+        (1u << static_cast<uint32_t>(
+             InterceptionHookPoints::NUM_INTERCEPTION_HOOKS)) -
+        1);
+  }
+
+  constexpr InterceptionHookPointSet() = default;
+  constexpr InterceptionHookPointSet(
+      std::initializer_list<InterceptionHookPoints> hook_points) {
+    for (InterceptionHookPoints type : hook_points) bits_ |= Bit(type);
+  }
+
+  void Add(InterceptionHookPoints type) { bits_ |= Bit(type); }
+  void Clear() { bits_ = 0; }
+
+  constexpr bool Contains(InterceptionHookPoints type) const {
+    return (bits_ & Bit(type)) != 0;
+  }
+  constexpr bool Intersects(InterceptionHookPointSet other) const {
+    return (bits_ & other.bits_) != 0;
+  }
+  constexpr bool empty() const { return bits_ == 0; }
+
+ private:
+  static_assert(static_cast<uint32_t>(
+                    InterceptionHookPoints::NUM_INTERCEPTION_HOOKS) < 32,
+                "too many hook points for InterceptionHookPointSet");
+
+  explicit constexpr InterceptionHookPointSet(uint32_t bits) : bits_(bits) {}
+
+  static constexpr uint32_t Bit(InterceptionHookPoints type) {
+    return 1u << static_cast<uint32_t>(type);
+  }
+
+  uint32_t bits_ = 0;
+};
+
 /// Class that is passed as an argument to the \a Intercept method
 /// of the application's \a Interceptor interface implementation. It has five
 /// purposes:
@@ -58,6 +58,9 @@ class MessageHolder : public RpcAllocatorState {
 // A custom allocator can be set via the generated code to a callback unary
 // method, such as SetMessageAllocatorFor_Echo(custom_allocator). The allocator
 // needs to be alive for the lifetime of the server.
+// Client-streaming methods only use the response of the messages allocated,
+// and server-streaming methods only the request: the streamed messages are
+// always provided by the reactor, as are all the messages on the client side.
 // Implementations need to be thread-safe.
 template <typename RequestT, typename ResponseT>
 class MessageAllocator {
@@ -84,7 +84,7 @@ void* UnaryDeserializeHelper(grpc_byte_buffer* req, grpc::Status* status,
                              RequestType* request) {
   grpc::ByteBuffer buf;
   buf.set_buffer(req);
-  *status = grpc::SerializationTraits<RequestType>::Deserialize(
+  *status = grpc::internal::DeserializeMessage(
       &buf, static_cast<RequestType*>(request));
   buf.Release();
   if (status->ok()) {
@@ -151,7 +151,8 @@ class ClientStreamingHandler : public grpc::internal::MethodHandler {
 
   void RunHandler(const HandlerParameter& param) final {
     ServerReader<RequestType> reader(
-        param.call, static_cast<grpc::ServerContext*>(param.server_context));
+        param.call, static_cast<grpc::ServerContext*>(param.server_context),
+        param.read_ahead);
     ResponseType rsp;
     grpc::Status status =
         CatchingFunctionHandler([this, &param, &reader, &rsp] {
@@ -177,6 +178,7 @@ class ClientStreamingHandler : public grpc::internal::MethodHandler {
     ops.ServerSendStatus(&param.server_context->trailing_metadata_, status);
     param.call->PerformOps(&ops);
     param.call->cq()->Pluck(&ops);
+    reader.Finish();
   }
 
  private:
@@ -235,7 +237,7 @@ class ServerStreamingHandler : public grpc::internal::MethodHandler {
     auto* request =
         new (grpc_call_arena_alloc(call, sizeof(RequestType))) RequestType();
     *status =
-        grpc::SerializationTraits<RequestType>::Deserialize(&buf, request);
+        grpc::internal::DeserializeMessage(&buf, request);
     buf.Release();
     if (status->ok()) {
       return request;
@@ -267,7 +269,8 @@ class TemplatedBidiStreamingHandler : public grpc::internal::MethodHandler {
 
   void RunHandler(const HandlerParameter& param) final {
     Streamer stream(param.call,
-                    static_cast<grpc::ServerContext*>(param.server_context));
+                    static_cast<grpc::ServerContext*>(param.server_context),
+                    param.read_ahead);
     grpc::Status status = CatchingFunctionHandler([this, &param, &stream] {
       return func_(static_cast<grpc::ServerContext*>(param.server_context),
                    &stream);
@@ -295,6 +298,7 @@ class TemplatedBidiStreamingHandler : public grpc::internal::MethodHandler {
       param.call->cq()->Pluck(&param.server_context->pending_ops_);
     }
     param.call->cq()->Pluck(&ops);
+    stream.Finish();
   }
 
  private:
@@ -125,6 +125,10 @@ class ProtoBufferReader : public grpc::protobuf::io::ZeroCopyInputStream {
 
 #ifdef GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
   /// Read the next `count` bytes and append it to the given Cord.
+  /// This is what protobuf uses to parse `bytes` fields declared with
+  /// `[ctype = CORD]`: the Cord references the memory of the slices it was
+  /// read from instead of copying it, except for pieces smaller than
+  /// kMinCordAliasLength.
   // (override is conditionally omitted here to support old Protobuf which
   //  doesn't have ReadCord method)
   // NOLINTBEGIN(modernize-use-override,
@@ -194,20 +198,27 @@ class ProtoBufferReader : public grpc::protobuf::io::ZeroCopyInputStream {
 
  private:
 #ifdef GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
+  // Pieces of slices shorter than this are copied into the Cord: referencing
+  // them would cost an allocation of its own, and keep alive a buffer that
+  // may be much larger than the piece.
+  static constexpr size_t kMinCordAliasLength = 512;
+
   // This function takes ownership of slice and return a newly created Cord off
   // of it.
   static absl::Cord MakeCordFromSlice(grpc_slice slice) {
-    // slice_for_cord is created to keep inlined data of the given slice
-    grpc_slice* slice_for_cord = new grpc_slice;
-    *slice_for_cord = slice;
+    absl::string_view view(
+        reinterpret_cast<char*>(GRPC_SLICE_START_PTR(slice)),
+        GRPC_SLICE_LENGTH(slice));
+    // Inlined slices keep their data in the grpc_slice itself, so there is
+    // nothing to reference.
+    if (slice.refcount == nullptr || view.size() < kMinCordAliasLength) {
+      absl::Cord cord(view);
+      grpc_slice_unref(slice);
+      return cord;
+    }
     return absl::MakeCordFromExternal(
-        absl::string_view(
-            reinterpret_cast<char*>(GRPC_SLICE_START_PTR(*slice_for_cord)),
-            GRPC_SLICE_LENGTH(*slice_for_cord)),
-        [slice_for_cord](absl::string_view /* view */) {
-          grpc_slice_unref(*slice_for_cord);
-          delete slice_for_cord;
-        });
+        view,
+        [slice](absl::string_view /* view */) { grpc_slice_unref(slice); });
   }
 #endif  // GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
 
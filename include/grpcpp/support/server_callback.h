@@ -105,6 +105,15 @@ class ServerCallbackCall {
     }
   }
 
+  // Makes the reactions of the call run inline, in the thread completing the
+  // operation that triggers them, rather than dispatched to another thread.
+  // Only for methods whose reactions never block (see
+  // Service::MarkMethodInlineReactions). Must be called before the reactor
+  // is bound.
+  void SetInlineReactions(bool inline_reactions) {
+    inline_reactions_ = inline_reactions;
+  }
+
   // Fast version called with known reactor passed in, used from derived
   // classes, typically in non-cancel case
   void MaybeCallOnCancel(ServerReactor* reactor) {
@@ -127,6 +136,8 @@ class ServerCallbackCall {
   /// Increases the reference count
   void Ref() { callbacks_outstanding_.fetch_add(1, std::memory_order_relaxed); }
 
+  bool inline_reactions() const { return inline_reactions_; }
+
  private:
   virtual ServerReactor* reactor() = 0;
 
@@ -161,6 +172,7 @@ class ServerCallbackCall {
     return callbacks_outstanding_.fetch_sub(1, std::memory_order_acq_rel);
   }
 
+  bool inline_reactions_ = false;
   std::atomic_int on_cancel_conditions_remaining_{2};
   std::atomic_int callbacks_outstanding_{
       3};  // reserve for start, Finish, and CompletionOp
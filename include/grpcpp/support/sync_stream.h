@@ -19,6 +19,10 @@
 #ifndef GRPCPP_SUPPORT_SYNC_STREAM_H
 #define GRPCPP_SUPPORT_SYNC_STREAM_H
 
+#include <iterator>
+#include <memory>
+#include <utility>
+
 #include "absl/log/absl_check.h"
 
 #include <grpc/support/log.h>
@@ -142,6 +146,29 @@ class WriterInterface {
   void WriteLast(const W& msg, grpc::WriteOptions options) {
     Write(msg, options.set_last_message());
   }
+
+  /// Block to write the messages in [\a begin, \a end) to the stream, in
+  /// order, with WriteOptions \a options. All but the last message are written
+  /// with the buffer hint set, so that instead of flushing each message the
+  /// transport frames them into as few writes as it can. If \a options has
+  /// the last message flag set, it only applies to the last message.
+  /// This is thread-safe with respect to \a ReaderInterface::Read
+  ///
+  /// \param[in] begin, end The messages to be written to the stream.
+  /// \param[in] options The WriteOptions to be used to write the messages.
+  ///
+  /// \return \a true on success, \a false when the stream has been closed, in
+  /// which case the messages after the failed one are not written.
+  template <class Iterator>
+  bool WriteBatch(Iterator begin, Iterator end, grpc::WriteOptions options) {
+    if (begin == end) return true;
+    grpc::WriteOptions buffered_options = options;
+    buffered_options.clear_last_message().set_buffer_hint();
+    for (Iterator next = std::next(begin); next != end; begin = next++) {
+      if (!Write(*begin, buffered_options)) return false;
+    }
+    return Write(*begin, options);
+  }
 };
 
 }  // namespace internal
@@ -570,6 +597,42 @@ class ClientReaderWriter final : public ClientReaderWriterInterface<W, R> {
   }
 };
 
+namespace internal {
+/// Reads the messages of a sync server call ahead: the next message is
+/// received while the handler processes the one it just read. Core allows a
+/// single receive op in flight per call, so at most one message is buffered.
+template <class R>
+class ServerReadAhead {
+ public:
+  bool Read(grpc::internal::Call* call, R* msg) {
+    if (!pending_) Start(call);
+    pending_ = false;
+    if (!call->cq()->Pluck(&ops_) || !ops_.got_message) return false;
+    *msg = std::move(message_);
+    Start(call);
+    return true;
+  }
+
+  /// Waits for the receive op in flight, if any. Only called once the status
+  /// of the call was sent, which completes it.
+  void Finish(grpc::internal::Call* call) {
+    if (pending_) call->cq()->Pluck(&ops_);
+    pending_ = false;
+  }
+
+ private:
+  void Start(grpc::internal::Call* call) {
+    ops_.RecvMessage(&message_);
+    call->PerformOps(&ops_);
+    pending_ = true;
+  }
+
+  grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<R>> ops_;
+  R message_;
+  bool pending_ = false;
+};
+}  // namespace internal
+
 /// Server-side interface for streaming reads of message of type \a R.
 template <class R>
 class ServerReaderInterface : public internal::ServerStreamingInterface,
@@ -605,10 +668,15 @@ class ServerReader final : public ServerReaderInterface<R> {
   }
 
   bool Read(R* msg) override {
-    grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<R>> ops;
-    ops.RecvMessage(msg);
-    call_->PerformOps(&ops);
-    bool ok = call_->cq()->Pluck(&ops) && ops.got_message;
+    bool ok;
+    if (read_ahead_ != nullptr) {
+      ok = read_ahead_->Read(call_, msg);
+    } else {
+      grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<R>> ops;
+      ops.RecvMessage(msg);
+      call_->PerformOps(&ops);
+      ok = call_->cq()->Pluck(&ops) && ops.got_message;
+    }
     if (!ok) {
       ctx_->MaybeMarkCancelledOnRead();
     }
@@ -618,12 +686,22 @@ class ServerReader final : public ServerReaderInterface<R> {
  private:
   grpc::internal::Call* const call_;
   ServerContext* const ctx_;
+  std::unique_ptr<internal::ServerReadAhead<R>> read_ahead_;
 
   template <class ServiceType, class RequestType, class ResponseType>
   friend class internal::ClientStreamingHandler;
 
-  ServerReader(grpc::internal::Call* call, grpc::ServerContext* ctx)
-      : call_(call), ctx_(ctx) {}
+  ServerReader(grpc::internal::Call* call, grpc::ServerContext* ctx,
+               bool read_ahead = false)
+      : call_(call),
+        ctx_(ctx),
+        read_ahead_(read_ahead ? new internal::ServerReadAhead<R>() : nullptr) {
+  }
+
+  // Called by the handler once the status of the call was sent.
+  void Finish() {
+    if (read_ahead_ != nullptr) read_ahead_->Finish(call_);
+  }
 };
 
 /// Server-side interface for streaming writes of message of type \a W.
@@ -711,8 +789,12 @@ namespace internal {
 template <class W, class R>
 class ServerReaderWriterBody final {
  public:
-  ServerReaderWriterBody(grpc::internal::Call* call, grpc::ServerContext* ctx)
-      : call_(call), ctx_(ctx) {}
+  ServerReaderWriterBody(grpc::internal::Call* call, grpc::ServerContext* ctx,
+                         bool read_ahead = false)
+      : call_(call),
+        ctx_(ctx),
+        read_ahead_(read_ahead ? new internal::ServerReadAhead<R>() : nullptr) {
+  }
 
   void SendInitialMetadata() {
     ABSL_CHECK(!ctx_->sent_initial_metadata_);
@@ -735,10 +817,15 @@ class ServerReaderWriterBody final {
   }
 
   bool Read(R* msg) {
-    grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<R>> ops;
-    ops.RecvMessage(msg);
-    call_->PerformOps(&ops);
-    bool ok = call_->cq()->Pluck(&ops) && ops.got_message;
+    bool ok;
+    if (read_ahead_ != nullptr) {
+      ok = read_ahead_->Read(call_, msg);
+    } else {
+      grpc::internal::CallOpSet<grpc::internal::CallOpRecvMessage<R>> ops;
+      ops.RecvMessage(msg);
+      call_->PerformOps(&ops);
+      ok = call_->cq()->Pluck(&ops) && ops.got_message;
+    }
     if (!ok) {
       ctx_->MaybeMarkCancelledOnRead();
     }
@@ -772,9 +859,14 @@ class ServerReaderWriterBody final {
     return call_->cq()->Pluck(&ctx_->pending_ops_);
   }
 
+  void Finish() {
+    if (read_ahead_ != nullptr) read_ahead_->Finish(call_);
+  }
+
  private:
   grpc::internal::Call* const call_;
   grpc::ServerContext* const ctx_;
+  std::unique_ptr<internal::ServerReadAhead<R>> read_ahead_;
 };
 
 }  // namespace internal
@@ -812,8 +904,12 @@ class ServerReaderWriter final : public ServerReaderWriterInterface<W, R> {
 
   friend class internal::TemplatedBidiStreamingHandler<ServerReaderWriter<W, R>,
                                                        false>;
-  ServerReaderWriter(grpc::internal::Call* call, grpc::ServerContext* ctx)
-      : body_(call, ctx) {}
+  ServerReaderWriter(grpc::internal::Call* call, grpc::ServerContext* ctx,
+                     bool read_ahead = false)
+      : body_(call, ctx, read_ahead) {}
+
+  // Called by the handler once the status of the call was sent.
+  void Finish() { body_.Finish(); }
 };
 
 /// A class to represent a flow-controlled unary call. This is something
@@ -881,8 +977,12 @@ class ServerUnaryStreamer final
 
   friend class internal::TemplatedBidiStreamingHandler<
       ServerUnaryStreamer<RequestType, ResponseType>, true>;
-  ServerUnaryStreamer(grpc::internal::Call* call, grpc::ServerContext* ctx)
+  // Only reads a single message: there is nothing to read ahead.
+  ServerUnaryStreamer(grpc::internal::Call* call, grpc::ServerContext* ctx,
+                      bool /*read_ahead*/ = false)
       : body_(call, ctx), read_done_(false), write_done_(false) {}
+
+  void Finish() {}
 };
 
 /// A class to represent a flow-controlled server-side streaming call.
@@ -942,8 +1042,12 @@ class ServerSplitStreamer final
 
   friend class internal::TemplatedBidiStreamingHandler<
       ServerSplitStreamer<RequestType, ResponseType>, false>;
-  ServerSplitStreamer(grpc::internal::Call* call, grpc::ServerContext* ctx)
+  // Only reads a single message: there is nothing to read ahead.
+  ServerSplitStreamer(grpc::internal::Call* call, grpc::ServerContext* ctx,
+                      bool /*read_ahead*/ = false)
       : body_(call, ctx), read_done_(false) {}
+
+  void Finish() {}
 };
 
 }  // namespace grpc
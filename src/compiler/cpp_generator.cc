@@ -1101,6 +1101,31 @@ void PrintHeaderServerMethodCallback(grpc_generator::Printer* printer,
                    "{ return this->$Method$(context); }));\n");
   }
   printer->Print(*vars, "}\n");
+  if (ClientOnlyStreaming(method)) {
+    printer->Print(*vars,
+                   "void SetMessageAllocatorFor_$Method$(\n"
+                   "    ::grpc::MessageAllocator< "
+                   "$RealRequest$, $RealResponse$>* allocator) {\n"
+                   "  ::grpc::internal::MethodHandler* const handler = "
+                   "::grpc::Service::GetHandler($Idx$);\n"
+                   "  static_cast<::grpc::internal::"
+                   "CallbackClientStreamingHandler< "
+                   "$RealRequest$, $RealResponse$>*>(handler)\n"
+                   "          ->SetMessageAllocator(allocator);\n"
+                   "}\n");
+  } else if (ServerOnlyStreaming(method)) {
+    printer->Print(*vars,
+                   "void SetMessageAllocatorFor_$Method$(\n"
+                   "    ::grpc::MessageAllocator< "
+                   "$RealRequest$, $RealResponse$>* allocator) {\n"
+                   "  ::grpc::internal::MethodHandler* const handler = "
+                   "::grpc::Service::GetHandler($Idx$);\n"
+                   "  static_cast<::grpc::internal::"
+                   "CallbackServerStreamingHandler< "
+                   "$RealRequest$, $RealResponse$>*>(handler)\n"
+                   "          ->SetMessageAllocator(allocator);\n"
+                   "}\n");
+  }
   printer->Print(*vars,
                  "~WithCallbackMethod_$Method$() override {\n"
                  "  BaseClassMustBeDerivedFromService(this);\n"
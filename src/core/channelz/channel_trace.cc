@@ -19,6 +19,7 @@
 #include "src/core/channelz/channel_trace.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "absl/strings/str_cat.h"
@@ -51,6 +52,18 @@ ChannelTrace::TraceEvent::TraceEvent(Severity severity, const grpc_slice& data,
 ChannelTrace::TraceEvent::TraceEvent(Severity severity, const grpc_slice& data)
     : TraceEvent(severity, data, nullptr) {}
 
+ChannelTrace::TraceEvent::TraceEvent(Severity severity, const char* prefix,
+                                     const char* detail, absl::Status status)
+    : timestamp_(Timestamp::Now().as_timespec(GPR_CLOCK_REALTIME)),
+      severity_(severity),
+      data_(grpc_empty_slice()),
+      prefix_(prefix),
+      detail_(detail),
+      status_(std::move(status)),
+      // The status is usually shared with its owner, but count its message
+      // in case it is not.
+      memory_usage_(sizeof(TraceEvent) + status_.message().size()) {}
+
 ChannelTrace::TraceEvent::~TraceEvent() { CSliceUnref(data_); }
 
 namespace {
@@ -71,13 +84,20 @@ const char* SeverityString(ChannelTrace::Severity severity) {
 }  // anonymous namespace
 
 Json ChannelTrace::TraceEvent::RenderTraceEvent() const {
-  char* description = grpc_slice_to_c_string(data_);
+  std::string description;
+  if (prefix_ != nullptr) {
+    description = absl::StrCat(prefix_, detail_);
+    if (!status_.ok()) absl::StrAppend(&description, ": ", status_.ToString());
+  } else {
+    char* data = grpc_slice_to_c_string(data_);
+    description = data;
+    gpr_free(data);
+  }
   Json::Object object = {
-      {"description", Json::FromString(description)},
+      {"description", Json::FromString(std::move(description))},
       {"severity", Json::FromString(SeverityString(severity_))},
       {"timestamp", Json::FromString(gpr_format_timespec(timestamp_))},
   };
-  gpr_free(description);
   if (referenced_entity_ != nullptr) {
     const bool is_channel =
         (referenced_entity_->type() == BaseNode::EntityType::kTopLevelChannel ||
@@ -152,6 +172,15 @@ void ChannelTrace::AddTraceEventWithReference(
       new TraceEvent(severity, data, std::move(referenced_entity)));
 }
 
+void ChannelTrace::AddTraceEvent(Severity severity, const char* prefix,
+                                 const char* detail, absl::Status status) {
+  if (max_event_memory_ == 0) {
+    return;  // tracing is disabled if max_event_memory_ == 0
+  }
+  AddTraceEventHelper(
+      new TraceEvent(severity, prefix, detail, std::move(status)));
+}
+
 Json ChannelTrace::RenderJson() const {
   // Tracing is disabled if max_event_memory_ == 0.
   if (max_event_memory_ == 0) {
@@ -23,6 +23,7 @@
 #include <stdint.h>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
 
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
@@ -80,6 +81,14 @@ class ChannelTrace {
   void AddTraceEventWithReference(Severity severity, const grpc_slice& data,
                                   RefCountedPtr<BaseNode> referenced_entity);
 
+  // Adds a new trace event whose description is \a prefix followed by
+  // \a detail and, if it is not OK, \a status. The description is only
+  // formatted if channelz renders the trace, which most traces never are, so
+  // this is meant for events recorded on every connectivity change of every
+  // subchannel. \a prefix and \a detail must outlive the tracing object.
+  void AddTraceEvent(Severity severity, const char* prefix, const char* detail,
+                     absl::Status status);
+
   // Creates and returns the raw Json object, so a parent channelz
   // object may incorporate the json before rendering.
   Json RenderJson() const;
@@ -99,6 +108,11 @@ class ChannelTrace {
     // channel.
     TraceEvent(Severity severity, const grpc_slice& data);
 
+    // Constructor for a TraceEvent whose description is formatted when it is
+    // rendered.
+    TraceEvent(Severity severity, const char* prefix, const char* detail,
+               absl::Status status);
+
     ~TraceEvent();
 
     // Renders the data inside of this TraceEvent into a json object. This is
@@ -115,6 +129,10 @@ class ChannelTrace {
     const gpr_timespec timestamp_;
     const Severity severity_;
     const grpc_slice data_;
+    // Set instead of data_ for events formatted when rendered.
+    const char* const prefix_ = nullptr;
+    const char* const detail_ = nullptr;
+    const absl::Status status_;
     const size_t memory_usage_;
     // the tracer object for the (sub)channel that this trace event refers to.
     const RefCountedPtr<BaseNode> referenced_entity_;
@@ -570,6 +570,28 @@ void SocketNode::RecordMessageReceived() {
                                      std::memory_order_relaxed);
 }
 
+void SocketNode::PopulateTcpInfoOptions(Json::Array* options) {
+  absl::optional<TcpInfo> tcp_info;
+  {
+    MutexLock lock(&tcp_info_mu_);
+    tcp_info = tcp_info_;
+  }
+  if (!tcp_info.has_value()) return;
+  auto add_option = [options](absl::string_view name, uint64_t value) {
+    options->push_back(Json::FromObject({
+        {"name", Json::FromString(std::string(name))},
+        {"value", Json::FromString(absl::StrCat(value))},
+    }));
+  };
+  add_option("tcpiRttUs", tcp_info->rtt_us);
+  add_option("tcpiRttVarUs", tcp_info->rtt_var_us);
+  add_option("tcpiMinRttUs", tcp_info->min_rtt_us);
+  add_option("tcpiSndCwnd", tcp_info->snd_cwnd);
+  add_option("tcpiTotalRetrans", tcp_info->total_retrans);
+  add_option("tcpiPacingRate", tcp_info->pacing_rate);
+  add_option("tcpiDeliveryRate", tcp_info->delivery_rate);
+}
+
 Json SocketNode::RenderJson() {
   // Create and fill the data child.
   Json::Object data;
@@ -632,6 +654,22 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = Json::FromString(absl::StrCat(keepalives_sent));
   }
+  Json::Array options;
+  auto add_option = [&options](absl::string_view name,
+                               const std::atomic<uint64_t>& value) {
+    uint64_t v = value.load(std::memory_order_relaxed);
+    if (v == 0) return;
+    options.push_back(Json::FromObject({
+        {"name", Json::FromString(std::string(name))},
+        {"value", Json::FromString(absl::StrCat(v))},
+    }));
+  };
+  add_option("hpackDynamicTableHits", hpack_dynamic_table_hits_);
+  add_option("hpackDynamicTableInserts", hpack_dynamic_table_inserts_);
+  add_option("hpackLiteralsNotIndexed", hpack_literals_not_indexed_);
+  add_option("hpackLiteralsNeverIndexed", hpack_literals_never_indexed_);
+  PopulateTcpInfoOptions(&options);
+  if (!options.empty()) data["option"] = Json::FromArray(std::move(options));
   // Create and fill the parent object.
   Json::Object object = {
       {"ref", Json::FromObject({
@@ -29,6 +29,7 @@
 #include <utility>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
@@ -263,6 +264,10 @@ class SubchannelNode final : public BaseNode {
   void AddTraceEvent(ChannelTrace::Severity severity, const grpc_slice& data) {
     trace_.AddTraceEvent(severity, data);
   }
+  void AddTraceEvent(ChannelTrace::Severity severity, const char* prefix,
+                     const char* detail, absl::Status status) {
+    trace_.AddTraceEvent(severity, prefix, detail, std::move(status));
+  }
   void AddTraceEventWithReference(ChannelTrace::Severity severity,
                                   const grpc_slice& data,
                                   RefCountedPtr<BaseNode> referenced_channel) {
@@ -386,20 +391,59 @@ class SocketNode final : public BaseNode {
   void RecordKeepaliveSent() {
     keepalives_sent_.fetch_add(1, std::memory_order_relaxed);
   }
+  // Cumulative HPACK encoder indexing counters, published by transports that
+  // adapt their header indexing policy per connection.
+  void SetHpackEncoderStats(uint64_t dynamic_table_hits,
+                            uint64_t dynamic_table_inserts,
+                            uint64_t literals_not_indexed,
+                            uint64_t literals_never_indexed) {
+    hpack_dynamic_table_hits_.store(dynamic_table_hits,
+                                    std::memory_order_relaxed);
+    hpack_dynamic_table_inserts_.store(dynamic_table_inserts,
+                                       std::memory_order_relaxed);
+    hpack_literals_not_indexed_.store(literals_not_indexed,
+                                      std::memory_order_relaxed);
+    hpack_literals_never_indexed_.store(literals_never_indexed,
+                                        std::memory_order_relaxed);
+  }
+
+  // The last TCP_INFO sample of the connection, published by transports
+  // whose endpoint samples it.
+  struct TcpInfo {
+    uint32_t rtt_us = 0;
+    uint32_t rtt_var_us = 0;
+    uint32_t min_rtt_us = 0;
+    uint32_t snd_cwnd = 0;
+    uint32_t total_retrans = 0;
+    uint64_t pacing_rate = 0;
+    uint64_t delivery_rate = 0;
+  };
+  void SetTcpInfo(const TcpInfo& tcp_info) {
+    MutexLock lock(&tcp_info_mu_);
+    tcp_info_ = tcp_info;
+  }
 
   const std::string& remote() { return remote_; }
 
  private:
+  void PopulateTcpInfoOptions(Json::Array* options);
+
   std::atomic<int64_t> streams_started_{0};
   std::atomic<int64_t> streams_succeeded_{0};
   std::atomic<int64_t> streams_failed_{0};
   std::atomic<int64_t> messages_sent_{0};
   std::atomic<int64_t> messages_received_{0};
   std::atomic<int64_t> keepalives_sent_{0};
+  std::atomic<uint64_t> hpack_dynamic_table_hits_{0};
+  std::atomic<uint64_t> hpack_dynamic_table_inserts_{0};
+  std::atomic<uint64_t> hpack_literals_not_indexed_{0};
+  std::atomic<uint64_t> hpack_literals_never_indexed_{0};
   std::atomic<gpr_cycle_counter> last_local_stream_created_cycle_{0};
   std::atomic<gpr_cycle_counter> last_remote_stream_created_cycle_{0};
   std::atomic<gpr_cycle_counter> last_message_sent_cycle_{0};
   std::atomic<gpr_cycle_counter> last_message_received_cycle_{0};
+  Mutex tcp_info_mu_;
+  absl::optional<TcpInfo> tcp_info_ ABSL_GUARDED_BY(tcp_info_mu_);
   std::string local_;
   std::string remote_;
   RefCountedPtr<Security> const security_;
@@ -18,6 +18,8 @@
 
 #include "src/core/channelz/channelz_registry.h"
 
+#include <stddef.h>
+
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
@@ -34,6 +36,7 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/channelz/channelz.h"
+#include "src/core/lib/gprpp/lock_profile.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/util/json/json.h"
@@ -43,7 +46,14 @@ namespace grpc_core {
 namespace channelz {
 namespace {
 
-const int kPaginationLimit = 100;
+const size_t kPaginationLimit = 100;
+
+// Register and unregister run on every channel, subchannel and socket
+// creation and destruction.
+LockProfile* ShardLockProfile() {
+  static LockProfile* profile = new LockProfile("channelz_registry.shard_mu");
+  return profile;
+}
 
 }  // anonymous namespace
 
@@ -53,57 +63,71 @@ ChannelzRegistry* ChannelzRegistry::Default() {
 }
 
 void ChannelzRegistry::InternalRegister(BaseNode* node) {
-  MutexLock lock(&mu_);
-  node->uuid_ = ++uuid_generator_;
-  node_map_[node->uuid_] = node;
+  node->uuid_ = uuid_generator_.fetch_add(1, std::memory_order_relaxed) + 1;
+  Shard& shard = ShardFor(node->uuid_);
+  ProfiledMutexLock lock(&shard.mu, ShardLockProfile());
+  shard.node_map[node->uuid_] = node;
 }
 
 void ChannelzRegistry::InternalUnregister(intptr_t uuid) {
   CHECK_GE(uuid, 1);
-  MutexLock lock(&mu_);
-  CHECK(uuid <= uuid_generator_);
-  node_map_.erase(uuid);
+  CHECK(uuid <= uuid_generator_.load(std::memory_order_relaxed));
+  Shard& shard = ShardFor(uuid);
+  ProfiledMutexLock lock(&shard.mu, ShardLockProfile());
+  shard.node_map.erase(uuid);
 }
 
 RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
-  MutexLock lock(&mu_);
-  if (uuid < 1 || uuid > uuid_generator_) {
+  if (uuid < 1 || uuid > uuid_generator_.load(std::memory_order_relaxed)) {
     return nullptr;
   }
-  auto it = node_map_.find(uuid);
-  if (it == node_map_.end()) return nullptr;
+  Shard& shard = ShardFor(uuid);
+  MutexLock lock(&shard.mu);
+  auto it = shard.node_map.find(uuid);
+  if (it == shard.node_map.end()) return nullptr;
   // Found node.  Return only if its refcount is not zero (i.e., when we
   // know that there is no other thread about to destroy it).
   BaseNode* node = it->second;
   return node->RefIfNonZero();
 }
 
-std::string ChannelzRegistry::InternalGetTopChannels(
-    intptr_t start_channel_id) {
-  std::vector<RefCountedPtr<BaseNode>> top_level_channels;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_channel_id);
-         it != node_map_.end(); ++it) {
+std::vector<RefCountedPtr<BaseNode>> ChannelzRegistry::InternalGetNodes(
+    BaseNode::EntityType type, intptr_t start_id, size_t max_results,
+    bool* end) {
+  // Collect up to one more node than asked for from each shard, which tells
+  // whether there are more nodes after the page once they are merged.
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  for (Shard& shard : shards_) {
+    size_t found = 0;
+    MutexLock lock(&shard.mu);
+    for (auto it = shard.node_map.lower_bound(start_id);
+         it != shard.node_map.end() && found <= max_results; ++it) {
       BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kTopLevelChannel &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (top_level_channels.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        top_level_channels.emplace_back(std::move(node_ref));
-      }
+      if (node->type() != type) continue;
+      RefCountedPtr<BaseNode> node_ref = node->RefIfNonZero();
+      if (node_ref == nullptr) continue;
+      nodes.emplace_back(std::move(node_ref));
+      ++found;
     }
   }
+  std::sort(nodes.begin(), nodes.end(),
+            [](const RefCountedPtr<BaseNode>& a,
+               const RefCountedPtr<BaseNode>& b) {
+              return a->uuid() < b->uuid();
+            });
+  *end = nodes.size() <= max_results;
+  // The extra references are dropped here, outside of the shard locks: this
+  // may destroy nodes, which unregister themselves.
+  if (!*end) nodes.resize(max_results);
+  return nodes;
+}
+
+std::string ChannelzRegistry::InternalGetTopChannels(
+    intptr_t start_channel_id) {
+  bool end;
+  std::vector<RefCountedPtr<BaseNode>> top_level_channels =
+      InternalGetNodes(BaseNode::EntityType::kTopLevelChannel,
+                       start_channel_id, kPaginationLimit, &end);
   Json::Object object;
   if (!top_level_channels.empty()) {
     // Create list of channels.
@@ -113,37 +137,16 @@ std::string ChannelzRegistry::InternalGetTopChannels(
     }
     object["channel"] = Json::FromArray(std::move(array));
   }
-  if (node_after_pagination_limit == nullptr) {
+  if (end) {
     object["end"] = Json::FromBool(true);
   }
   return JsonDump(Json::FromObject(std::move(object)));
 }
 
 std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
-  std::vector<RefCountedPtr<BaseNode>> servers;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_server_id);
-         it != node_map_.end(); ++it) {
-      BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kServer &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (servers.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        servers.emplace_back(std::move(node_ref));
-      }
-    }
-  }
+  bool end;
+  std::vector<RefCountedPtr<BaseNode>> servers = InternalGetNodes(
+      BaseNode::EntityType::kServer, start_server_id, kPaginationLimit, &end);
   Json::Object object;
   if (!servers.empty()) {
     // Create list of servers.
@@ -153,7 +156,7 @@ std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
     }
     object["server"] = Json::FromArray(std::move(array));
   }
-  if (node_after_pagination_limit == nullptr) {
+  if (end) {
     object["end"] = Json::FromBool(true);
   }
   return JsonDump(Json::FromObject(std::move(object)));
@@ -161,9 +164,9 @@ std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
 
 void ChannelzRegistry::InternalLogAllEntities() {
   std::vector<RefCountedPtr<BaseNode>> nodes;
-  {
-    MutexLock lock(&mu_);
-    for (auto& p : node_map_) {
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    for (auto& p : shard.node_map) {
       RefCountedPtr<BaseNode> node = p.second->RefIfNonZero();
       if (node != nullptr) {
         nodes.emplace_back(std::move(node));
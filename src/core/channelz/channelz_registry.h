@@ -19,9 +19,13 @@
 #ifndef GRPC_SRC_CORE_CHANNELZ_CHANNELZ_REGISTRY_H
 #define GRPC_SRC_CORE_CHANNELZ_CHANNELZ_REGISTRY_H
 
+#include <stddef.h>
+
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 
@@ -36,6 +40,13 @@ namespace channelz {
 
 // singleton registry object to track all objects that are needed to support
 // channelz bookkeeping. All objects share globally distributed uuids.
+//
+// Every channel, subchannel, server and socket registers itself when created,
+// so nodes are spread over shards keyed by uuid, each with its own lock, and
+// uuids come from an atomic counter: creating and destroying nodes on
+// different threads rarely contends. Queries take one shard lock at a time,
+// only to collect references to the nodes they need, and render them after
+// releasing it.
 class ChannelzRegistry final {
  public:
   static void Register(BaseNode* node) {
@@ -65,9 +76,11 @@ class ChannelzRegistry final {
   // Test only helper function to reset to initial state.
   static void TestOnlyReset() {
     auto* p = Default();
-    MutexLock lock(&p->mu_);
-    p->node_map_.clear();
-    p->uuid_generator_ = 0;
+    for (Shard& shard : p->shards_) {
+      MutexLock lock(&shard.mu);
+      shard.node_map.clear();
+    }
+    p->uuid_generator_.store(0, std::memory_order_relaxed);
   }
 
  private:
@@ -85,15 +98,31 @@ class ChannelzRegistry final {
   // returns the void* associated with that uuid. Else returns nullptr.
   RefCountedPtr<BaseNode> InternalGet(intptr_t uuid);
 
+  // Returns references to the first \a max_results nodes of \a type with a
+  // uuid of at least \a start_id, in uuid order, and sets \a end if there are
+  // no more.
+  std::vector<RefCountedPtr<BaseNode>> InternalGetNodes(
+      BaseNode::EntityType type, intptr_t start_id, size_t max_results,
+      bool* end);
+
   std::string InternalGetTopChannels(intptr_t start_channel_id);
   std::string InternalGetServers(intptr_t start_server_id);
 
   void InternalLogAllEntities();
 
-  // protects members
-  Mutex mu_;
-  std::map<intptr_t, BaseNode*> node_map_ ABSL_GUARDED_BY(mu_);
-  intptr_t uuid_generator_ ABSL_GUARDED_BY(mu_) = 0;
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    Mutex mu;
+    std::map<intptr_t, BaseNode*> node_map ABSL_GUARDED_BY(mu);
+  };
+
+  Shard& ShardFor(intptr_t uuid) {
+    return shards_[static_cast<size_t>(uuid) % kNumShards];
+  }
+
+  Shard shards_[kNumShards];
+  std::atomic<intptr_t> uuid_generator_{0};
 };
 
 }  // namespace channelz
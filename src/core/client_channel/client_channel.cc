@@ -93,6 +93,8 @@
 #include "src/core/resolver/resolver_registry.h"
 #include "src/core/service_config/service_config_impl.h"
 #include "src/core/telemetry/metrics.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/useful.h"
 
@@ -237,11 +239,37 @@ class ClientChannel::SubchannelWrapper::WatcherWrapper
         << subchannel_wrapper_.get() << " subchannel "
         << subchannel_wrapper_->subchannel_.get()
         << "; hopping into work_serializer";
+    {
+      MutexLock lock(&mu_);
+      // A queued update for the same state that is yet to be applied is
+      // superseded by this one, unless it carries keepalive information.
+      if (!pending_updates_.empty() &&
+          pending_updates_.back().state == state &&
+          !pending_updates_.back()
+               .status.GetPayload(kKeepaliveThrottlingKey)
+               .has_value()) {
+        pending_updates_.back().status = status;
+        global_stats().IncrementSubchannelConnectivityNotificationsCoalesced();
+        return;
+      }
+      pending_updates_.push_back({state, status});
+      // A hop into the WorkSerializer is already queued, and will apply this
+      // update too.
+      if (pending_updates_.size() > 1) return;
+    }
     self.release();  // Held by callback.
     subchannel_wrapper_->client_channel_->work_serializer_->Run(
-        [this, state, status]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(
+        [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(
             *subchannel_wrapper_->client_channel_->work_serializer_) {
-          ApplyUpdateInControlPlaneWorkSerializer(state, status);
+          std::vector<PendingUpdate> updates;
+          {
+            MutexLock lock(&mu_);
+            updates.swap(pending_updates_);
+          }
+          for (const PendingUpdate& update : updates) {
+            ApplyUpdateInControlPlaneWorkSerializer(update.state,
+                                                    update.status);
+          }
           Unref();
         },
         DEBUG_LOCATION);
@@ -250,6 +278,11 @@ class ClientChannel::SubchannelWrapper::WatcherWrapper
   grpc_pollset_set* interested_parties() override { return nullptr; }
 
  private:
+  struct PendingUpdate {
+    grpc_connectivity_state state;
+    absl::Status status;
+  };
+
   void ApplyUpdateInControlPlaneWorkSerializer(grpc_connectivity_state state,
                                                const absl::Status& status)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(
@@ -303,6 +336,9 @@ class ClientChannel::SubchannelWrapper::WatcherWrapper
   std::unique_ptr<SubchannelInterface::ConnectivityStateWatcherInterface>
       watcher_;
   RefCountedPtr<SubchannelWrapper> subchannel_wrapper_;
+  Mutex mu_;
+  // Updates received but not yet applied in the WorkSerializer.
+  std::vector<PendingUpdate> pending_updates_ ABSL_GUARDED_BY(mu_);
 };
 
 ClientChannel::SubchannelWrapper::SubchannelWrapper(
@@ -343,6 +379,7 @@ ClientChannel::SubchannelWrapper::~SubchannelWrapper() {
       << "client_channel=" << client_channel_.get()
       << ": destroying subchannel wrapper " << this << " for subchannel "
       << subchannel_.get();
+  client_channel_->subchannel_pool_->ReleaseSubchannel(std::move(subchannel_));
 }
 
 void ClientChannel::SubchannelWrapper::Orphaned() {
@@ -665,7 +702,7 @@ void ClientChannel::Orphaned() {
       DEBUG_LOCATION);
   // IncreaseCallCount() introduces a phony call and prevents the idle
   // timer from being reset by other threads.
-  idle_state_.IncreaseCallCount();
+  (void)idle_state_.IncreaseCallCount();
   idle_activity_.Reset();
 }
 
@@ -856,7 +893,8 @@ grpc_call* ClientChannel::CreateCall(
     grpc_call* parent_call, uint32_t propagation_mask,
     grpc_completion_queue* cq, grpc_pollset_set* /*pollset_set_alternative*/,
     Slice path, absl::optional<Slice> authority, Timestamp deadline, bool) {
-  auto arena = call_arena_allocator()->MakeArena();
+  auto arena =
+      call_arena_allocator()->MakeArenaForMethod(path.as_string_view());
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       event_engine());
   return MakeClientCall(parent_call, propagation_mask, cq, std::move(path),
@@ -866,7 +904,9 @@ grpc_call* ClientChannel::CreateCall(
 
 void ClientChannel::StartCall(UnstartedCallHandler unstarted_handler) {
   // Increment call count.
-  if (idle_timeout_ != Duration::Zero()) idle_state_.IncreaseCallCount();
+  if (idle_timeout_ != Duration::Zero() && idle_state_.IncreaseCallCount()) {
+    StartIdleTimer();
+  }
   // Exit IDLE if needed.
   CheckConnectivityState(/*try_to_connect=*/true);
   // Spawn a promise to wait for the resolver result.
@@ -1278,7 +1318,7 @@ void ClientChannel::UpdateServiceConfigInDataPlaneLocked() {
   InterceptionChainBuilder builder(channel_args_.SetObject(this));
   if (idle_timeout_ != Duration::Zero()) {
     builder.AddOnServerTrailingMetadata([this](ServerMetadata&) {
-      if (idle_state_.DecreaseCallCount()) StartIdleTimer();
+      idle_state_.DecreaseCallCount();
     });
   }
   CoreConfiguration::Get().channel_init().AddToInterceptionChainBuilder(
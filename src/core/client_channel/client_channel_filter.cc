@@ -103,6 +103,8 @@
 #include "src/core/resolver/resolver_registry.h"
 #include "src/core/service_config/service_config_call_data.h"
 #include "src/core/service_config/service_config_impl.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/json/json.h"
 #include "src/core/util/useful.h"
 
@@ -539,6 +541,7 @@ class ClientChannelFilter::SubchannelWrapper final
         }
       }
     }
+    chand_->subchannel_pool_->ReleaseSubchannel(std::move(subchannel_));
     GRPC_CHANNEL_STACK_UNREF(chand_->owning_stack_, "SubchannelWrapper");
   }
 
@@ -660,11 +663,38 @@ class ClientChannelFilter::SubchannelWrapper final
           << ": connectivity change for subchannel wrapper " << parent_.get()
           << " subchannel " << parent_->subchannel_.get()
           << "hopping into work_serializer";
+      {
+        MutexLock lock(&mu_);
+        // A queued update for the same state that is yet to be applied is
+        // superseded by this one, unless it carries keepalive information.
+        if (!pending_updates_.empty() &&
+            pending_updates_.back().state == state &&
+            !pending_updates_.back()
+                 .status.GetPayload(kKeepaliveThrottlingKey)
+                 .has_value()) {
+          pending_updates_.back().status = status;
+          global_stats()
+              .IncrementSubchannelConnectivityNotificationsCoalesced();
+          return;
+        }
+        pending_updates_.push_back({state, status});
+        // A hop into the WorkSerializer is already queued, and will apply
+        // this update too.
+        if (pending_updates_.size() > 1) return;
+      }
       self.release();  // Held by callback.
       parent_->chand_->work_serializer_->Run(
-          [this, state, status]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(
+          [this]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(
               *parent_->chand_->work_serializer_) {
-            ApplyUpdateInControlPlaneWorkSerializer(state, status);
+            std::vector<PendingUpdate> updates;
+            {
+              MutexLock lock(&mu_);
+              updates.swap(pending_updates_);
+            }
+            for (const PendingUpdate& update : updates) {
+              ApplyUpdateInControlPlaneWorkSerializer(update.state,
+                                                      update.status);
+            }
             Unref();
           },
           DEBUG_LOCATION);
@@ -675,6 +705,11 @@ class ClientChannelFilter::SubchannelWrapper final
     }
 
    private:
+    struct PendingUpdate {
+      grpc_connectivity_state state;
+      absl::Status status;
+    };
+
     void ApplyUpdateInControlPlaneWorkSerializer(grpc_connectivity_state state,
                                                  const absl::Status& status)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(*parent_->chand_->work_serializer_) {
@@ -723,6 +758,9 @@ class ClientChannelFilter::SubchannelWrapper final
     std::unique_ptr<SubchannelInterface::ConnectivityStateWatcherInterface>
         watcher_;
     RefCountedPtr<SubchannelWrapper> parent_;
+    Mutex mu_;
+    // Updates received but not yet applied in the WorkSerializer.
+    std::vector<PendingUpdate> pending_updates_ ABSL_GUARDED_BY(mu_);
   };
 
   // A heterogenous lookup comparator for data watchers that allows
@@ -1601,17 +1639,72 @@ void ClientChannelFilter::UpdateStateAndPickerLocked(
     const char* reason,
     RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker) {
   UpdateStateLocked(state, status, reason);
-  // Grab the LB lock to update the picker and trigger reprocessing of the
-  // queued picks.
+  // Grab the LB lock to update the picker and take the queued picks.
   // Old picker will be unreffed after releasing the lock.
-  MutexLock lock(&lb_mu_);
-  picker_.swap(picker);
-  // Reprocess queued picks.
-  for (auto& call : lb_queued_calls_) {
-    call->RemoveCallFromLbQueuedCallsLocked();
-    call->RetryPickLocked();
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> old_picker;
+  std::vector<RefCountedPtr<LoadBalancedCall>> queued_calls;
+  {
+    MutexLock lock(&lb_mu_);
+    old_picker = std::exchange(picker_, picker);
+    queued_calls.reserve(lb_queued_calls_.size());
+    for (auto& call : lb_queued_calls_) {
+      call->RemoveCallFromLbQueuedCallsLocked();
+      call->OnRemoveFromQueueLocked();
+      queued_calls.push_back(call);
+    }
+    lb_queued_calls_.clear();
+  }
+  if (queued_calls.empty()) return;
+  // Redo the queued picks in a tight loop.  The picker cannot change
+  // while we do so, since it is only set in the WorkSerializer.
+  std::vector<std::pair<LoadBalancedCall*, grpc_error_handle>> completed;
+  std::vector<LoadBalancedCall*> still_queued;
+  completed.reserve(queued_calls.size());
+  for (auto& call : queued_calls) {
+    grpc_error_handle error;
+    if (call->RetryPick(picker.get(), &error)) {
+      completed.emplace_back(call.get(), std::move(error));
+    } else {
+      still_queued.push_back(call.get());
+    }
   }
-  lb_queued_calls_.clear();
+  if (!still_queued.empty()) {
+    MutexLock lock(&lb_mu_);
+    for (LoadBalancedCall* call : still_queued) {
+      call->AddCallToLbQueuedCallsLocked();
+    }
+  }
+  GRPC_TRACE_LOG(client_channel, INFO)
+      << "chand=" << this << ": retried " << queued_calls.size()
+      << " queued picks, " << completed.size() << " completed";
+  // Resume the calls whose pick completed once the current ExecCtx is
+  // flushed, so that we are not doing it in the WorkSerializer.  The
+  // calls are not destroyed before being resumed, because their pending
+  // batches have not been completed yet.
+  // TODO(roth): We should really be using EventEngine::Run() here
+  // instead of ExecCtx::Run().  Unfortunately, doing that seems to cause
+  // a flaky TSAN failure for reasons that I do not fully understand.
+  // However, given that we are working toward eliminating this code as
+  // part of the promise conversion, it doesn't seem worth further
+  // investigation right now.
+  ExecCtx::Run(
+      DEBUG_LOCATION,
+      NewClosure([completed = std::move(completed)](grpc_error_handle) mutable {
+        for (auto& p : completed) {
+          // If there are a lot of queued calls here, resuming them all may
+          // cause us to stay inside C-core for a long period of time. All
+          // of that work would be done using the same ExecCtx instance and
+          // therefore the same cached value of "now". The longer it takes
+          // to finish all of this work and exit from C-core, the more stale
+          // the cached value of "now" may become. This can cause problems
+          // whereby (e.g.) we calculate a timer deadline based on the stale
+          // value, which results in the timer firing too early. To avoid
+          // this, we invalidate the cached value for each call we process.
+          ExecCtx::Get()->InvalidateNow();
+          p.first->ResumeQueuedPick(std::move(p.second));
+        }
+      }),
+      absl::OkStatus());
 }
 
 namespace {
@@ -2584,21 +2677,43 @@ ClientChannelFilter::LoadBalancedCall::PickSubchannel(bool was_queued) {
       return absl::nullopt;
     }
     // Pick is complete.
-    // If it was queued, add a trace annotation.
-    if (was_queued && call_attempt_tracer() != nullptr) {
-      call_attempt_tracer()->RecordAnnotation("Delayed LB pick complete.");
-    }
-    // If the pick failed, fail the call.
-    if (!error.ok()) {
-      GRPC_TRACE_LOG(client_channel_lb_call, INFO)
-          << "chand=" << chand_ << " lb_call=" << this
-          << ": failed to pick subchannel: error=" << StatusToString(error);
-      return error;
-    }
-    // Pick succeeded.
-    Commit();
-    return absl::OkStatus();
+    return OnPickComplete(was_queued, error);
+  }
+}
+
+bool ClientChannelFilter::LoadBalancedCall::RetryPick(
+    LoadBalancingPolicy::SubchannelPicker* picker, grpc_error_handle* error) {
+  // TODO(roth): Fix race condition in channel_idle filter and any
+  // other possible causes of this.
+  if (picker == nullptr) {
+    GRPC_TRACE_LOG(client_channel_lb_call, INFO)
+        << "chand=" << chand_ << " lb_call=" << this
+        << ": picker is null, failing call";
+    *error = absl::InternalError("picker is null -- shouldn't happen");
+    return true;
   }
+  GRPC_TRACE_LOG(client_channel_lb_call, INFO)
+      << "chand=" << chand_ << " lb_call=" << this
+      << ": retrying queued pick with picker=" << picker;
+  return PickSubchannelImpl(picker, error);
+}
+
+absl::Status ClientChannelFilter::LoadBalancedCall::OnPickComplete(
+    bool was_queued, grpc_error_handle error) {
+  // If it was queued, add a trace annotation.
+  if (was_queued && call_attempt_tracer() != nullptr) {
+    call_attempt_tracer()->RecordAnnotation("Delayed LB pick complete.");
+  }
+  // If the pick failed, fail the call.
+  if (!error.ok()) {
+    GRPC_TRACE_LOG(client_channel_lb_call, INFO)
+        << "chand=" << chand_ << " lb_call=" << this
+        << ": failed to pick subchannel: error=" << StatusToString(error);
+    return error;
+  }
+  // Pick succeeded.
+  Commit();
+  return absl::OkStatus();
 }
 
 bool ClientChannelFilter::LoadBalancedCall::PickSubchannelImpl(
@@ -3083,33 +3198,20 @@ void ClientChannelFilter::FilterBasedLoadBalancedCall::OnAddToQueueLocked() {
       new LbQueuedCallCanceller(RefAsSubclass<FilterBasedLoadBalancedCall>());
 }
 
-void ClientChannelFilter::FilterBasedLoadBalancedCall::RetryPickLocked() {
+void ClientChannelFilter::FilterBasedLoadBalancedCall::
+    OnRemoveFromQueueLocked() {
   // Lame the call combiner canceller.
   lb_call_canceller_ = nullptr;
-  // Do an async callback to resume call processing, so that we're not
-  // doing it while holding the channel's LB mutex.
-  // TODO(roth): We should really be using EventEngine::Run() here
-  // instead of ExecCtx::Run().  Unfortunately, doing that seems to cause
-  // a flaky TSAN failure for reasons that I do not fully understand.
-  // However, given that we are working toward eliminating this code as
-  // part of the promise conversion, it doesn't seem worth further
-  // investigation right now.
-  ExecCtx::Run(DEBUG_LOCATION, NewClosure([this](grpc_error_handle) {
-                 // If there are a lot of queued calls here, resuming them
-                 // all may cause us to stay inside C-core for a long period
-                 // of time. All of that work would be done using the same
-                 // ExecCtx instance and therefore the same cached value of
-                 // "now". The longer it takes to finish all of this work
-                 // and exit from C-core, the more stale the cached value of
-                 // "now" may become. This can cause problems whereby (e.g.)
-                 // we calculate a timer deadline based on the stale value,
-                 // which results in the timer firing too early. To avoid
-                 // this, we invalidate the cached value for each call we
-                 // process.
-                 ExecCtx::Get()->InvalidateNow();
-                 TryPick(/*was_queued=*/true);
-               }),
-               absl::OkStatus());
+}
+
+void ClientChannelFilter::FilterBasedLoadBalancedCall::ResumeQueuedPick(
+    grpc_error_handle error) {
+  absl::Status status = OnPickComplete(/*was_queued=*/true, error);
+  if (!status.ok()) {
+    PendingBatchesFail(status, YieldCallCombiner);
+    return;
+  }
+  CreateSubchannelCall();
 }
 
 void ClientChannelFilter::FilterBasedLoadBalancedCall::CreateSubchannelCall() {
@@ -368,11 +368,25 @@ class ClientChannelFilter::LoadBalancedCall
   void RemoveCallFromLbQueuedCallsLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_);
 
+  // Adds the call to the channel's list of queued picks if not already present.
+  void AddCallToLbQueuedCallsLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_);
+
   // Called by the channel for each queued call when a new picker
-  // becomes available.
-  virtual void RetryPickLocked()
+  // becomes available, after removing the call from the queue.
+  virtual void OnRemoveFromQueueLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_) = 0;
 
+  // Retries the pick of a call removed from the queue with the
+  // channel's new picker.  Returns false if the call needs to be queued
+  // again.  Otherwise, the result of the pick is stored in *error, and
+  // ResumeQueuedPick() must later be called with it.
+  bool RetryPick(LoadBalancingPolicy::SubchannelPicker* picker,
+                 grpc_error_handle* error);
+
+  // Resumes call processing after RetryPick() completed the pick.
+  virtual void ResumeQueuedPick(grpc_error_handle error) = 0;
+
  protected:
   ClientChannelFilter* chand() const { return chand_; }
   ClientCallTracer::CallAttemptTracer* call_attempt_tracer() const {
@@ -395,9 +409,8 @@ class ClientChannelFilter::LoadBalancedCall
 
   // Attempts an LB pick.  The following outcomes are possible:
   // - No pick result is available yet.  The call will be queued and
-  //   nullopt will be returned.  The channel will later call
-  //   RetryPickLocked() when a new picker is available and the pick
-  //   should be retried.
+  //   nullopt will be returned.  The channel will later retry the pick
+  //   when a new picker is available (see RetryPick()).
   // - The pick failed.  If the call is not wait_for_ready, a non-OK
   //   status will be returned.  (If the call *is* wait_for_ready,
   //   it will be queued instead.)
@@ -405,6 +418,10 @@ class ClientChannelFilter::LoadBalancedCall
   //   stored and an OK status will be returned.
   absl::optional<absl::Status> PickSubchannel(bool was_queued);
 
+  // Handles a completed pick, whose result is \a error.  Commits the
+  // call if the pick succeeded.
+  absl::Status OnPickComplete(bool was_queued, grpc_error_handle error);
+
   void RecordCallCompletion(absl::Status status,
                             grpc_metadata_batch* recv_trailing_metadata,
                             grpc_transport_stream_stats* transport_stream_stats,
@@ -424,10 +441,6 @@ class ClientChannelFilter::LoadBalancedCall
   // Returns true if the pick is complete.
   bool PickSubchannelImpl(LoadBalancingPolicy::SubchannelPicker* picker,
                           grpc_error_handle* error);
-  // Adds the call to the channel's list of queued picks if not already present.
-  void AddCallToLbQueuedCallsLocked()
-      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_);
-
   // Called when adding the call to the LB queue.
   virtual void OnAddToQueueLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_) = 0;
@@ -524,9 +537,11 @@ class ClientChannelFilter::FilterBasedLoadBalancedCall final
   void OnAddToQueueLocked() override
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_);
 
-  void RetryPickLocked() override
+  void OnRemoveFromQueueLocked() override
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&ClientChannelFilter::lb_mu_);
 
+  void ResumeQueuedPick(grpc_error_handle error) override;
+
   void CreateSubchannelCall();
 
   // TODO(roth): Instead of duplicating these fields in every filter
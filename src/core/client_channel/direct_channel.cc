@@ -72,9 +72,11 @@ grpc_call* DirectChannel::CreateCall(
     grpc_completion_queue* cq, grpc_pollset_set* /*pollset_set_alternative*/,
     Slice path, absl::optional<Slice> authority, Timestamp deadline,
     bool /*registered_method*/) {
-  auto arena = call_arena_allocator()->MakeArena();
+  auto arena =
+      call_arena_allocator()->MakeArenaForMethod(path.as_string_view());
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       event_engine_.get());
+  if (pass_message_objects_) MessageObjectPassthrough::EnableFor(arena.get());
   return MakeClientCall(parent_call, propagation_mask, cq, std::move(path),
                         std::move(authority), false, deadline,
                         compression_options(), std::move(arena), Ref());
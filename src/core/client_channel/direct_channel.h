@@ -18,6 +18,7 @@
 #include <memory>
 
 #include "src/core/lib/surface/channel.h"
+#include "src/core/lib/transport/message.h"
 #include "src/core/lib/transport/transport.h"
 
 namespace grpc_core {
@@ -53,7 +54,9 @@ class DirectChannel final : public Channel {
       : Channel(std::move(target), args),
         transport_call_destination_(std::move(transport_call_destination)),
         interception_chain_(std::move(interception_chain)),
-        event_engine_(std::move(event_engine)) {}
+        event_engine_(std::move(event_engine)),
+        pass_message_objects_(
+            args.GetBool(GRPC_ARG_PASS_MESSAGE_OBJECTS).value_or(false)) {}
 
   void Orphaned() override;
   void StartCall(UnstartedCallHandler unstarted_handler) override;
@@ -94,6 +97,8 @@ class DirectChannel final : public Channel {
   RefCountedPtr<UnstartedCallDestination> interception_chain_;
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
+  // See GRPC_ARG_PASS_MESSAGE_OBJECTS.
+  const bool pass_message_objects_;
 };
 
 }  // namespace grpc_core
@@ -20,24 +20,44 @@
 
 #include "src/core/client_channel/global_subchannel_pool.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "src/core/client_channel/subchannel.h"
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 
 namespace grpc_core {
 
+using ::grpc_event_engine::experimental::GetDefaultEventEngine;
+
+std::atomic<size_t> GlobalSubchannelPool::warm_subchannel_count_{0};
+
 RefCountedPtr<GlobalSubchannelPool> GlobalSubchannelPool::instance() {
   static GlobalSubchannelPool* p = new GlobalSubchannelPool();
   return p->RefAsSubclass<GlobalSubchannelPool>();
 }
 
+GlobalSubchannelPool::GlobalSubchannelPool()
+    : warm_pool_size_(
+          std::max(0, ConfigVars::Get().SubchannelWarmPoolSize())),
+      warm_pool_idle_(Duration::Milliseconds(
+          std::max(0, ConfigVars::Get().SubchannelWarmPoolIdleMs()))) {}
+
 RefCountedPtr<Subchannel> GlobalSubchannelPool::RegisterSubchannel(
     const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) {
+  // Declared before the lock so that evicted subchannels are unreffed after
+  // it is released: the last unref calls UnregisterSubchannel().
+  std::vector<RefCountedPtr<Subchannel>> evicted;
   MutexLock lock(&mu_);
   auto it = subchannel_map_.find(key);
   if (it != subchannel_map_.end()) {
     RefCountedPtr<Subchannel> existing = it->second->RefIfNonZero();
-    if (existing != nullptr) return existing;
+    if (existing != nullptr) {
+      TakeWarmSubchannelLocked(existing.get(), &evicted);
+      return existing;
+    }
   }
   subchannel_map_[key] = constructed.get();
   return constructed;
@@ -56,10 +76,104 @@ void GlobalSubchannelPool::UnregisterSubchannel(const SubchannelKey& key,
 
 RefCountedPtr<Subchannel> GlobalSubchannelPool::FindSubchannel(
     const SubchannelKey& key) {
+  std::vector<RefCountedPtr<Subchannel>> evicted;
   MutexLock lock(&mu_);
   auto it = subchannel_map_.find(key);
   if (it == subchannel_map_.end()) return nullptr;
-  return it->second->RefIfNonZero();
+  RefCountedPtr<Subchannel> subchannel = it->second->RefIfNonZero();
+  if (subchannel != nullptr) {
+    TakeWarmSubchannelLocked(subchannel.get(), &evicted);
+  }
+  return subchannel;
+}
+
+void GlobalSubchannelPool::ReleaseSubchannel(
+    RefCountedPtr<Subchannel> subchannel) {
+  if (warm_pool_size_ == 0) return;
+  std::vector<RefCountedPtr<Subchannel>> evicted;
+  MutexLock lock(&mu_);
+  const Timestamp now = Timestamp::Now();
+  TakeWarmSubchannelLocked(subchannel.get(), &evicted);
+  Subchannel* key = subchannel.get();
+  warm_subchannels_.push_front({std::move(subchannel), now});
+  warm_subchannel_index_[key] = warm_subchannels_.begin();
+  EvictWarmSubchannelsLocked(now, &evicted);
+}
+
+void GlobalSubchannelPool::TakeWarmSubchannelLocked(
+    Subchannel* subchannel, std::vector<RefCountedPtr<Subchannel>>* evicted) {
+  if (warm_pool_size_ == 0) return;
+  auto it = warm_subchannel_index_.find(subchannel);
+  if (it != warm_subchannel_index_.end()) {
+    evicted->push_back(std::move(it->second->subchannel));
+    warm_subchannels_.erase(it->second);
+    warm_subchannel_index_.erase(it);
+  }
+  EvictWarmSubchannelsLocked(Timestamp::Now(), evicted);
+}
+
+void GlobalSubchannelPool::EvictWarmSubchannelsLocked(
+    Timestamp now, std::vector<RefCountedPtr<Subchannel>>* evicted) {
+  while (!warm_subchannels_.empty() &&
+         (warm_subchannels_.size() > warm_pool_size_ ||
+          now - warm_subchannels_.back().released >= warm_pool_idle_)) {
+    WarmSubchannel& oldest = warm_subchannels_.back();
+    warm_subchannel_index_.erase(oldest.subchannel.get());
+    evicted->push_back(std::move(oldest.subchannel));
+    warm_subchannels_.pop_back();
+  }
+  warm_subchannel_count_.store(warm_subchannels_.size(),
+                               std::memory_order_relaxed);
+  MaybeStartEvictionTimerLocked(now);
+}
+
+void GlobalSubchannelPool::MaybeStartEvictionTimerLocked(Timestamp now) {
+  if (eviction_timer_handle_.has_value() || warm_subchannels_.empty()) return;
+  if (event_engine_ == nullptr) event_engine_ = GetDefaultEventEngine();
+  // The pool is never destroyed, so the timer does not need a ref to it.
+  eviction_timer_handle_ = event_engine_->RunAfter(
+      warm_subchannels_.back().released + warm_pool_idle_ - now,
+      [this]() { OnEvictionTimer(); });
+}
+
+void GlobalSubchannelPool::OnEvictionTimer() {
+  ApplicationCallbackExecCtx callback_exec_ctx;
+  ExecCtx exec_ctx;
+  std::vector<RefCountedPtr<Subchannel>> evicted;
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine;
+  MutexLock lock(&mu_);
+  eviction_timer_handle_.reset();
+  EvictWarmSubchannelsLocked(Timestamp::Now(), &evicted);
+  // Don't hold on to the engine while there is nothing to evict.
+  if (!eviction_timer_handle_.has_value()) {
+    event_engine = std::move(event_engine_);
+  }
+}
+
+void GlobalSubchannelPool::FlushWarmSubchannels() {
+  if (WarmSubchannelCount() == 0) return;
+  ExecCtx exec_ctx;
+  std::vector<RefCountedPtr<Subchannel>> evicted;
+  auto pool = instance();
+  MutexLock lock(&pool->mu_);
+  pool->FlushWarmSubchannelsLocked(&evicted);
+}
+
+void GlobalSubchannelPool::FlushWarmSubchannelsLocked(
+    std::vector<RefCountedPtr<Subchannel>>* evicted) {
+  for (WarmSubchannel& warm_subchannel : warm_subchannels_) {
+    evicted->push_back(std::move(warm_subchannel.subchannel));
+  }
+  warm_subchannels_.clear();
+  warm_subchannel_index_.clear();
+  warm_subchannel_count_.store(0, std::memory_order_relaxed);
+  // If the timer can't be cancelled, it is already running and will find
+  // nothing to evict.
+  if (eviction_timer_handle_.has_value() &&
+      event_engine_->Cancel(*eviction_timer_handle_)) {
+    eviction_timer_handle_.reset();
+    event_engine_.reset();
+  }
 }
 
 }  // namespace grpc_core
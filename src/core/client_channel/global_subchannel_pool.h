@@ -21,18 +21,37 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
+#include <atomic>
+#include <list>
 #include <map>
+#include <memory>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
 
 #include "src/core/client_channel/subchannel_pool_interface.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
 
 namespace grpc_core {
 
 // The global subchannel pool. It shares subchannels among channels. There
 // should be only one instance of this class.
+//
+// If GRPC_SUBCHANNEL_WARM_POOL_SIZE is set, the pool also keeps up to that
+// many subchannels alive after the last channel using them released them,
+// together with their connections, for GRPC_SUBCHANNEL_WARM_POOL_IDLE_MS.
+// An LB policy that goes back to an endpoint it dropped shortly before then
+// finds it still connected.  Since every subchannel holds a grpc_init() ref,
+// grpc_shutdown() flushes the warm pool once nothing else is keeping gRPC
+// initialized.
 class GlobalSubchannelPool final : public SubchannelPoolInterface {
  public:
   // Gets the singleton instance.
@@ -47,14 +66,62 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
       ABSL_LOCKS_EXCLUDED(mu_);
   RefCountedPtr<Subchannel> FindSubchannel(const SubchannelKey& key) override
       ABSL_LOCKS_EXCLUDED(mu_);
+  void ReleaseSubchannel(RefCountedPtr<Subchannel> subchannel) override
+      ABSL_LOCKS_EXCLUDED(mu_);
+
+  // Number of subchannels currently kept in the warm pool.
+  static size_t WarmSubchannelCount() {
+    return warm_subchannel_count_.load(std::memory_order_relaxed);
+  }
+  // Drops every subchannel in the warm pool.
+  static void FlushWarmSubchannels();
 
  private:
-  GlobalSubchannelPool() {}
+  struct WarmSubchannel {
+    RefCountedPtr<Subchannel> subchannel;
+    Timestamp released;
+  };
+
+  GlobalSubchannelPool();
   ~GlobalSubchannelPool() override {}
 
+  // Moves \a subchannel out of the warm pool, if it is there, into
+  // \a evicted.
+  void TakeWarmSubchannelLocked(Subchannel* subchannel,
+                                std::vector<RefCountedPtr<Subchannel>>* evicted)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Moves the warm subchannels that are over the size limit or have been
+  // idle for too long into \a evicted.
+  void EvictWarmSubchannelsLocked(
+      Timestamp now, std::vector<RefCountedPtr<Subchannel>>* evicted)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Arms the eviction timer for the oldest warm subchannel, unless it is
+  // already armed or the warm pool is empty.
+  void MaybeStartEvictionTimerLocked(Timestamp now)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnEvictionTimer() ABSL_LOCKS_EXCLUDED(mu_);
+  void FlushWarmSubchannelsLocked(
+      std::vector<RefCountedPtr<Subchannel>>* evicted)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const size_t warm_pool_size_;
+  const Duration warm_pool_idle_;
   // A map from subchannel key to subchannel.
   std::map<SubchannelKey, Subchannel*> subchannel_map_ ABSL_GUARDED_BY(mu_);
-  // To protect subchannel_map_.
+  // The warm subchannels, most recently released first, and where to find
+  // each of them in the list.
+  std::list<WarmSubchannel> warm_subchannels_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<Subchannel*, std::list<WarmSubchannel>::iterator>
+      warm_subchannel_index_ ABSL_GUARDED_BY(mu_);
+  // Evicts idle warm subchannels even when the pool is not otherwise used.
+  // The engine is only held while the timer is armed.
+  std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_
+      ABSL_GUARDED_BY(mu_);
+  absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      eviction_timer_handle_ ABSL_GUARDED_BY(mu_);
+  // Mirrors warm_subchannels_.size() for grpc_shutdown().
+  static std::atomic<size_t> warm_subchannel_count_;
+  // To protect subchannel_map_ and the warm pool.
   Mutex mu_;
 };
 
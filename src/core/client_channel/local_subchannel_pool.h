@@ -48,6 +48,7 @@ class LocalSubchannelPool final : public SubchannelPoolInterface {
   void UnregisterSubchannel(const SubchannelKey& key,
                             Subchannel* subchannel) override;
   RefCountedPtr<Subchannel> FindSubchannel(const SubchannelKey& key) override;
+  void ReleaseSubchannel(RefCountedPtr<Subchannel> /*subchannel*/) override {}
 
  private:
   // A map from subchannel key to subchannel.
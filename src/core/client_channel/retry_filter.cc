@@ -81,9 +81,19 @@
 // CallAttempt object against the state in the CallData object to see
 // which batches need to be sent on the LB call for a given attempt.
 
-// TODO(roth): In subsequent PRs:
-// - implement hedging
-
+// Hedging uses the same machinery: once the client has sent all of its
+// send ops, additional CallAttempt objects are started every hedgingDelay,
+// each replaying the cached send ops.  The first attempt to commit wins,
+// and the others are cancelled and abandoned.
+//
+// Each hedged attempt does its own LB pick, just like a retry, so nothing
+// forces it onto a different subchannel than the attempts before it.
+// Pickers have no way to be told which subchannels to avoid, and adding one
+// would have to go through every LB policy; with policies that spread picks
+// (e.g. round_robin), consecutive attempts already land on different
+// subchannels, while with pick_first there is only one to choose from.
+
+using grpc_core::internal::HedgingMethodConfig;
 using grpc_core::internal::RetryGlobalConfig;
 using grpc_core::internal::RetryMethodConfig;
 using grpc_core::internal::RetryServiceConfigParser;
@@ -100,7 +110,9 @@ RetryFilter::RetryFilter(const ChannelArgs& args, grpc_error_handle* error)
       event_engine_(args.GetObject<EventEngine>()),
       per_rpc_retry_buffer_size_(GetMaxPerRpcRetryBufferSize(args)),
       service_config_parser_index_(
-          internal::RetryServiceConfigParser::ParserIndex()) {
+          internal::RetryServiceConfigParser::ParserIndex()),
+      hedging_service_config_parser_index_(
+          internal::HedgingServiceConfigParser::ParserIndex()) {
   // Get retry throttling parameters from service config.
   auto* service_config = args.GetObject<ServiceConfig>();
   if (service_config == nullptr) return;
@@ -135,6 +147,14 @@ const RetryMethodConfig* RetryFilter::GetRetryPolicy(Arena* arena) {
       svc_cfg_call_data->GetMethodParsedConfig(service_config_parser_index_));
 }
 
+const HedgingMethodConfig* RetryFilter::GetHedgingPolicy(Arena* arena) {
+  auto* svc_cfg_call_data = arena->GetContext<ServiceConfigCallData>();
+  if (svc_cfg_call_data == nullptr) return nullptr;
+  return static_cast<const HedgingMethodConfig*>(
+      svc_cfg_call_data->GetMethodParsedConfig(
+          hedging_service_config_parser_index_));
+}
+
 const grpc_channel_filter RetryFilter::kVtable = {
     RetryFilter::LegacyCallData::StartTransportStreamOpBatch,
     RetryFilter::StartTransportOp,
@@ -63,6 +63,7 @@ class RetryFilter final {
   static double BackoffJitter() { return 0.2; }
 
   const internal::RetryMethodConfig* GetRetryPolicy(Arena* arena);
+  const internal::HedgingMethodConfig* GetHedgingPolicy(Arena* arena);
 
   RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data() const {
     return retry_throttle_data_;
@@ -111,6 +112,7 @@ class RetryFilter final {
   size_t per_rpc_retry_buffer_size_;
   RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data_;
   const size_t service_config_parser_index_;
+  const size_t hedging_service_config_parser_index_;
 };
 
 }  // namespace grpc_core
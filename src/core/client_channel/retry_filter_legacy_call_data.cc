@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <new>
+#include <utility>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -117,6 +118,10 @@ RetryFilter::LegacyCallData::CallAttempt::CallAttempt(
     RetryFilter::LegacyCallData* calld, bool is_transparent_retry)
     : RefCounted(GRPC_TRACE_FLAG_ENABLED(retry) ? "CallAttempt" : nullptr),
       calld_(calld),
+      num_previous_attempts_(calld->hedging_policy_ != nullptr
+                                 ? calld->num_attempts_started_ -
+                                       (is_transparent_retry ? 1 : 0)
+                                 : calld->num_attempts_completed_),
       started_send_initial_metadata_(false),
       completed_send_initial_metadata_(false),
       started_send_trailing_metadata_(false),
@@ -175,10 +180,9 @@ RetryFilter::LegacyCallData::CallAttempt::~CallAttempt() {
 
 void RetryFilter::LegacyCallData::CallAttempt::
     FreeCachedSendOpDataAfterCommit() {
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // If hedged attempts were started, the abandoned ones may still be
+  // using this data, so it is freed when the call is destroyed instead.
+  if (calld_->num_attempts_started_ > 1) return;
   if (completed_send_initial_metadata_) {
     calld_->FreeCachedSendInitialMetadata();
   }
@@ -219,11 +223,9 @@ bool RetryFilter::LegacyCallData::CallAttempt::HaveSendOpsToReplay() {
 
 void RetryFilter::LegacyCallData::CallAttempt::MaybeSwitchToFastPath() {
   // If we're not yet committed, we can't switch yet.
-  // TODO(roth): As part of implementing hedging, this logic needs to
-  // check that *this* call attempt is the one that we've committed to.
-  // Might need to replace abandoned_ with an enum indicating whether we're
-  // in flight, abandoned, or the winning call attempt.
   if (!calld_->retry_committed_) return;
+  // Only the attempt that we've committed to can switch.
+  if (calld_->call_attempt_.get() != this) return;
   // If we've already switched to fast path, there's nothing to do here.
   if (calld_->committed_call_ != nullptr) return;
   // If the perAttemptRecvTimeout timer is pending, we can't switch yet.
@@ -537,6 +539,17 @@ void RetryFilter::LegacyCallData::CallAttempt::StartRetriableBatches() {
   closures.RunClosures(calld_->call_combiner_);
 }
 
+void RetryFilter::LegacyCallData::CallAttempt::CancelLosingHedgedAttempt(
+    grpc_error_handle error, CallCombinerClosureList* closures) {
+  if (GRPC_TRACE_FLAG_ENABLED(retry)) {
+    LOG(INFO) << "chand=" << calld_->chand_ << " calld=" << calld_
+              << " attempt=" << this << ": cancelling losing hedged attempt";
+  }
+  MaybeCancelPerAttemptRecvTimer();
+  MaybeAddBatchForCancelOp(error, closures);
+  Abandon();
+}
+
 void RetryFilter::LegacyCallData::CallAttempt::CancelFromSurface(
     grpc_transport_stream_op_batch* cancel_batch) {
   MaybeCancelPerAttemptRecvTimer();
@@ -763,10 +776,9 @@ RetryFilter::LegacyCallData::CallAttempt::BatchData::~BatchData() {
 void RetryFilter::LegacyCallData::CallAttempt::BatchData::
     FreeCachedSendOpDataForCompletedBatch() {
   auto* calld = call_attempt_->calld_;
-  // TODO(roth): When we implement hedging, this logic will need to get
-  // a bit more complex, because there may be other (now abandoned) call
-  // attempts still using this data.  We may need to do some sort of
-  // ref-counting instead.
+  // If hedged attempts were started, the abandoned ones may still be
+  // using this data, so it is freed when the call is destroyed instead.
+  if (calld->num_attempts_started_ > 1) return;
   if (batch_.send_initial_metadata) {
     calld->FreeCachedSendInitialMetadata();
   }
@@ -1153,7 +1165,12 @@ void RetryFilter::LegacyCallData::CallAttempt::BatchData::
   }
   // Check if we should retry.
   if (!is_lb_drop) {  // Never retry on LB drops.
-    enum { kNoRetry, kTransparentRetry, kConfigurableRetry } retry = kNoRetry;
+    enum {
+      kNoRetry,
+      kTransparentRetry,
+      kConfigurableRetry,
+      kHedgedAttemptFailed
+    } retry = kNoRetry;
     // Handle transparent retries.
     if (stream_network_state.has_value() && !calld->retry_committed_) {
       // If not sent on wire, then always retry.
@@ -1172,6 +1189,11 @@ void RetryFilter::LegacyCallData::CallAttempt::BatchData::
         call_attempt->ShouldRetry(status, server_pushback)) {
       retry = kConfigurableRetry;
     }
+    // With hedging, a non-fatal failure only ends this attempt.
+    if (retry == kNoRetry && calld->hedging_policy_ != nullptr &&
+        calld->ShouldContinueHedging(status, server_pushback)) {
+      retry = kHedgedAttemptFailed;
+    }
     // If we're retrying, do so.
     if (retry != kNoRetry) {
       CallCombinerClosureList closures;
@@ -1185,10 +1207,18 @@ void RetryFilter::LegacyCallData::CallAttempt::BatchData::
       // For transparent retries, add a closure to immediately start a new
       // call attempt.
       // For configurable retries, start retry timer.
+      // For hedging, the other attempts carry on, and the next one may
+      // be started.
       if (retry == kTransparentRetry) {
+        if (calld->hedging_policy_ != nullptr) {
+          calld->DropHedgedAttempt(call_attempt);
+        }
         calld->AddClosureToStartTransparentRetry(&closures);
-      } else {
+      } else if (retry == kConfigurableRetry) {
         calld->StartRetryTimer(server_pushback);
+      } else {
+        calld->DropHedgedAttempt(call_attempt);
+        calld->MaybeStartNextHedgedAttempt(server_pushback, &closures);
       }
       // Record that this attempt has been abandoned.
       call_attempt->Abandon();
@@ -1376,9 +1406,10 @@ void RetryFilter::LegacyCallData::CallAttempt::BatchData::
   // If we've already completed one or more attempts, add the
   // grpc-retry-attempts header.
   call_attempt_->send_initial_metadata_ = calld->send_initial_metadata_.Copy();
-  if (GPR_UNLIKELY(calld->num_attempts_completed_ > 0)) {
-    call_attempt_->send_initial_metadata_.Set(GrpcPreviousRpcAttemptsMetadata(),
-                                              calld->num_attempts_completed_);
+  if (GPR_UNLIKELY(call_attempt_->num_previous_attempts_ > 0)) {
+    call_attempt_->send_initial_metadata_.Set(
+        GrpcPreviousRpcAttemptsMetadata(),
+        call_attempt_->num_previous_attempts_);
   } else {
     call_attempt_->send_initial_metadata_.Remove(
         GrpcPreviousRpcAttemptsMetadata());
@@ -1524,6 +1555,7 @@ RetryFilter::LegacyCallData::LegacyCallData(RetryFilter* chand,
     : chand_(chand),
       retry_throttle_data_(chand->retry_throttle_data()),
       retry_policy_(chand->GetRetryPolicy(args.arena)),
+      hedging_policy_(chand->GetHedgingPolicy(args.arena)),
       retry_backoff_(
           BackOff::Options()
               .set_initial_backoff(retry_policy_ == nullptr
@@ -1618,6 +1650,8 @@ void RetryFilter::LegacyCallData::StartTransportStreamOpBatch(
       retry_timer_handle_.reset();
       FreeAllCachedSendOpData();
     }
+    // Cancel hedging timer if needed.
+    MaybeCancelHedgingTimer();
     // We have no call attempt, so there's nowhere to send the cancellation
     // batch.  Return it back to the surface immediately.
     // Note: This will release the call combiner.
@@ -1634,6 +1668,14 @@ void RetryFilter::LegacyCallData::StartTransportStreamOpBatch(
                             "added pending batch while retry timer pending");
     return;
   }
+  // If the hedged attempts in flight have all failed, wait for the next one
+  // to be started.  It will pick up the pending batch.
+  if (hedging_policy_ != nullptr && retry_codepath_started_ &&
+      call_attempt_ == nullptr) {
+    GRPC_CALL_COMBINER_STOP(
+        call_combiner_, "added pending batch while waiting for hedged attempt");
+    return;
+  }
   // If we do not yet have a call attempt, create one.
   if (call_attempt_ == nullptr) {
     // If this is the first batch and retries are already committed
@@ -1685,6 +1727,10 @@ void RetryFilter::LegacyCallData::StartTransportStreamOpBatch(
     LOG(INFO) << "chand=" << chand_ << " calld=" << this
               << ": starting batch on attempt=" << call_attempt_.get();
   }
+  if (hedging_policy_ != nullptr) {
+    StartRetriableBatchesOnAllAttempts();
+    return;
+  }
   call_attempt_->StartRetriableBatches();
 }
 
@@ -1703,8 +1749,28 @@ RetryFilter::LegacyCallData::CreateLoadBalancedCall(
 }
 
 void RetryFilter::LegacyCallData::CreateCallAttempt(bool is_transparent_retry) {
-  call_attempt_ = MakeRefCounted<CallAttempt>(this, is_transparent_retry);
-  call_attempt_->StartRetriableBatches();
+  if (hedging_policy_ == nullptr) {
+    call_attempt_ = MakeRefCounted<CallAttempt>(this, is_transparent_retry);
+    call_attempt_->StartRetriableBatches();
+    return;
+  }
+  auto call_attempt = MakeRefCounted<CallAttempt>(this, is_transparent_retry);
+  if (!is_transparent_retry) ++num_attempts_started_;
+  CallCombinerClosureList closures;
+  call_attempt->AddRetriableBatches(&closures);
+  if (call_attempt_ == nullptr) {
+    call_attempt_ = std::move(call_attempt);
+  } else {
+    if (GRPC_TRACE_FLAG_ENABLED(retry)) {
+      LOG(INFO) << "chand=" << chand_ << " calld=" << this
+                << ": started hedged attempt=" << call_attempt.get()
+                << ", attempts in flight: " << hedged_attempts_.size() + 2;
+    }
+    hedged_attempts_.push_back(std::move(call_attempt));
+  }
+  MaybeStartHedgingTimer();
+  // Note: This will yield the call combiner.
+  closures.RunClosures(call_combiner_);
 }
 
 //
@@ -1716,12 +1782,18 @@ void RetryFilter::LegacyCallData::MaybeCacheSendOpsForBatch(
   if (pending->send_ops_cached) return;
   pending->send_ops_cached = true;
   grpc_transport_stream_op_batch* batch = pending->batch;
-  // Save a copy of metadata for send_initial_metadata ops.
+  // Take the metadata for send_initial_metadata ops. Every attempt is sent a
+  // copy of the cache, never the surface's batch, so the surface's batch can
+  // be moved from rather than copied: the surface only clears it once the
+  // batch completes, and filters above us have already seen it. Like the
+  // send_message payload, this leaves one copy per attempt instead of one
+  // for the cache plus one per attempt.
   if (batch->send_initial_metadata) {
     seen_send_initial_metadata_ = true;
     grpc_metadata_batch* send_initial_metadata =
         batch->payload->send_initial_metadata.send_initial_metadata;
-    send_initial_metadata_ = send_initial_metadata->Copy();
+    send_initial_metadata_ = std::move(*send_initial_metadata);
+    send_initial_metadata->Clear();
   }
   // Set up cache for send_message ops.
   if (batch->send_message) {
@@ -1729,12 +1801,14 @@ void RetryFilter::LegacyCallData::MaybeCacheSendOpsForBatch(
         *std::exchange(batch->payload->send_message.send_message, nullptr)));
     send_messages_.push_back({cache, batch->payload->send_message.flags});
   }
-  // Save metadata batch for send_trailing_metadata ops.
+  // Take the metadata batch for send_trailing_metadata ops, as for
+  // send_initial_metadata.
   if (batch->send_trailing_metadata) {
     seen_send_trailing_metadata_ = true;
     grpc_metadata_batch* send_trailing_metadata =
         batch->payload->send_trailing_metadata.send_trailing_metadata;
-    send_trailing_metadata_ = send_trailing_metadata->Copy();
+    send_trailing_metadata_ = std::move(*send_trailing_metadata);
+    send_trailing_metadata->Clear();
   }
 }
 
@@ -1821,9 +1895,8 @@ RetryFilter::LegacyCallData::PendingBatchesAdd(
   if (batch->send_trailing_metadata) {
     pending_send_trailing_metadata_ = true;
   }
-  // TODO(roth): When we implement hedging, if there are currently attempts
-  // in flight, we will need to pick the one on which the max number of send
-  // ops have already been sent, and we commit to that attempt.
+  // Note that hedged attempts are only started once all send ops have been
+  // seen, so there is at most one attempt in flight here.
   if (GPR_UNLIKELY(bytes_buffered_for_retry_ >
                    chand_->per_rpc_retry_buffer_size())) {
     if (GRPC_TRACE_FLAG_ENABLED(retry)) {
@@ -1940,6 +2013,8 @@ void RetryFilter::LegacyCallData::RetryCommit(CallAttempt* call_attempt) {
               << ": committing retries";
   }
   if (call_attempt != nullptr) {
+    // With hedging, the other attempts in flight lose.
+    CancelLosingHedgedAttempts(call_attempt);
     // If the call attempt's LB call has been committed, invoke the
     // call's on_commit callback.
     // Note: If call_attempt is null, this is happening before the first
@@ -2008,14 +2083,22 @@ void RetryFilter::LegacyCallData::AddClosureToStartTransparentRetry(
               << ": scheduling transparent retry";
   }
   GRPC_CALL_STACK_REF(owning_call_, "OnRetryTimer");
-  GRPC_CLOSURE_INIT(&retry_closure_, StartTransparentRetry, this, nullptr);
-  closures->Add(&retry_closure_, absl::OkStatus(), "start transparent retry");
+  // With hedging, several attempts may be retried transparently at once,
+  // so each one gets its own closure.
+  grpc_closure* closure = hedging_policy_ == nullptr
+                              ? &retry_closure_
+                              : arena_->New<grpc_closure>();
+  GRPC_CLOSURE_INIT(closure, StartTransparentRetry, this, nullptr);
+  closures->Add(closure, absl::OkStatus(), "start transparent retry");
 }
 
 void RetryFilter::LegacyCallData::StartTransparentRetry(
     void* arg, grpc_error_handle /*error*/) {
   auto* calld = static_cast<RetryFilter::LegacyCallData*>(arg);
-  if (calld->cancelled_from_surface_.ok()) {
+  if (calld->cancelled_from_surface_.ok() &&
+      (calld->hedging_policy_ == nullptr ||
+       calld->ShouldStartScheduledHedgedAttempt(
+           /*is_transparent_retry=*/true))) {
     calld->CreateCallAttempt(/*is_transparent_retry=*/true);
   } else {
     GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
@@ -2024,4 +2107,214 @@ void RetryFilter::LegacyCallData::StartTransparentRetry(
   GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnRetryTimer");
 }
 
+void RetryFilter::LegacyCallData::StartRetriableBatchesOnAllAttempts() {
+  CallCombinerClosureList closures;
+  call_attempt_->AddRetriableBatches(&closures);
+  for (auto& call_attempt : hedged_attempts_) {
+    call_attempt->AddRetriableBatches(&closures);
+  }
+  // If this batch finished the client's send ops, start hedging.
+  MaybeStartHedgingTimer();
+  // Note: This will yield the call combiner.
+  closures.RunClosures(call_combiner_);
+}
+
+//
+// hedging code
+//
+
+bool RetryFilter::LegacyCallData::CanStartHedgedAttempt() {
+  if (hedging_stopped_ ||
+      num_attempts_started_ >= hedging_policy_->max_attempts()) {
+    return false;
+  }
+  if (retry_throttle_data_ != nullptr &&
+      !retry_throttle_data_->IsRetryAllowed()) {
+    if (GRPC_TRACE_FLAG_ENABLED(retry)) {
+      LOG(INFO) << "chand=" << chand_ << " calld=" << this
+                << ": hedged attempts throttled";
+    }
+    return false;
+  }
+  return true;
+}
+
+bool RetryFilter::LegacyCallData::ShouldContinueHedging(
+    grpc_status_code status, absl::optional<Duration> server_pushback) {
+  if (retry_committed_) return false;
+  if (status == GRPC_STATUS_OK) {
+    if (retry_throttle_data_ != nullptr) retry_throttle_data_->RecordSuccess();
+    return false;
+  }
+  if (!hedging_policy_->non_fatal_status_codes().Contains(status)) {
+    if (GRPC_TRACE_FLAG_ENABLED(retry)) {
+      LOG(INFO) << "chand=" << chand_ << " calld=" << this << ": status "
+                << grpc_status_code_to_string(status)
+                << " is fatal for hedging";
+    }
+    return false;
+  }
+  // As for retries, only non-fatal failures count for throttling.
+  if (retry_throttle_data_ != nullptr) retry_throttle_data_->RecordFailure();
+  if (server_pushback.has_value() && *server_pushback < Duration::Zero()) {
+    if (GRPC_TRACE_FLAG_ENABLED(retry)) {
+      LOG(INFO) << "chand=" << chand_ << " calld=" << this
+                << ": no more hedged attempts due to server push-back";
+    }
+    hedging_stopped_ = true;
+  }
+  const size_t num_attempts_in_flight =
+      (call_attempt_ != nullptr) + hedged_attempts_.size();
+  return num_attempts_in_flight > 1 || CanStartHedgedAttempt();
+}
+
+void RetryFilter::LegacyCallData::DropHedgedAttempt(CallAttempt* call_attempt) {
+  if (call_attempt_.get() == call_attempt) {
+    call_attempt_.reset(DEBUG_LOCATION, "DropHedgedAttempt");
+    if (!hedged_attempts_.empty()) {
+      call_attempt_ = std::move(hedged_attempts_.front());
+      hedged_attempts_.erase(hedged_attempts_.begin());
+    }
+    return;
+  }
+  for (auto it = hedged_attempts_.begin(); it != hedged_attempts_.end();
+       ++it) {
+    if (it->get() == call_attempt) {
+      hedged_attempts_.erase(it);
+      return;
+    }
+  }
+}
+
+void RetryFilter::LegacyCallData::CancelLosingHedgedAttempts(
+    CallAttempt* call_attempt) {
+  if (hedging_policy_ == nullptr) return;
+  MaybeCancelHedgingTimer();
+  if (hedged_attempts_.empty() && call_attempt_.get() == call_attempt) return;
+  const grpc_error_handle error = grpc_error_set_int(
+      GRPC_ERROR_CREATE("another hedged call attempt was committed"),
+      StatusIntProperty::kRpcStatus, GRPC_STATUS_CANCELLED);
+  CallCombinerClosureList closures;
+  RefCountedPtr<CallAttempt> committed;
+  auto cancel_unless_committed = [&](RefCountedPtr<CallAttempt> attempt) {
+    if (attempt.get() == call_attempt) {
+      committed = std::move(attempt);
+    } else {
+      attempt->CancelLosingHedgedAttempt(error, &closures);
+    }
+  };
+  cancel_unless_committed(std::move(call_attempt_));
+  for (auto& attempt : hedged_attempts_) {
+    cancel_unless_committed(std::move(attempt));
+  }
+  hedged_attempts_.clear();
+  call_attempt_ = std::move(committed);
+  closures.RunClosuresWithoutYielding(call_combiner_);
+}
+
+void RetryFilter::LegacyCallData::MaybeStartNextHedgedAttempt(
+    absl::optional<Duration> server_pushback,
+    CallCombinerClosureList* closures) {
+  if (!CanStartHedgedAttempt()) return;
+  // The next attempt does not wait for the hedging delay.
+  MaybeCancelHedgingTimer();
+  if (server_pushback.has_value()) {
+    StartHedgingTimer(*server_pushback);
+  } else {
+    AddClosureToStartHedgedAttempt(closures);
+  }
+}
+
+void RetryFilter::LegacyCallData::MaybeStartHedgingTimer() {
+  if (hedging_policy_ == nullptr || retry_committed_ ||
+      call_attempt_ == nullptr || !seen_send_trailing_metadata_ ||
+      hedging_timer_handle_.has_value() || !CanStartHedgedAttempt()) {
+    return;
+  }
+  StartHedgingTimer(hedging_policy_->hedging_delay());
+}
+
+void RetryFilter::LegacyCallData::StartHedgingTimer(Duration delay) {
+  if (GRPC_TRACE_FLAG_ENABLED(retry)) {
+    LOG(INFO) << "chand=" << chand_ << " calld=" << this
+              << ": starting hedged attempt in " << delay.millis() << " ms";
+  }
+  GRPC_CALL_STACK_REF(owning_call_, "OnHedgingTimer");
+  // A cancelled timer may already be running, so each timer gets its
+  // own closure.
+  grpc_closure* closure = arena_->New<grpc_closure>();
+  GRPC_CLOSURE_INIT(closure, OnHedgingTimerLocked, this, nullptr);
+  hedging_timer_handle_ =
+      chand_->event_engine()->RunAfter(delay, [this, closure] {
+        ApplicationCallbackExecCtx callback_exec_ctx;
+        ExecCtx exec_ctx;
+        GRPC_CALL_COMBINER_START(call_combiner_, closure, absl::OkStatus(),
+                                 "hedging timer fired");
+      });
+}
+
+void RetryFilter::LegacyCallData::MaybeCancelHedgingTimer() {
+  if (!hedging_timer_handle_.has_value()) return;
+  if (GRPC_TRACE_FLAG_ENABLED(retry)) {
+    LOG(INFO) << "chand=" << chand_ << " calld=" << this
+              << ": cancelling hedging timer";
+  }
+  if (chand_->event_engine()->Cancel(*hedging_timer_handle_)) {
+    GRPC_CALL_STACK_UNREF(owning_call_, "OnHedgingTimer");
+  }
+  hedging_timer_handle_.reset();
+}
+
+void RetryFilter::LegacyCallData::OnHedgingTimerLocked(
+    void* arg, grpc_error_handle /*error*/) {
+  auto* calld = static_cast<RetryFilter::LegacyCallData*>(arg);
+  if (calld->hedging_timer_handle_.has_value()) {
+    calld->hedging_timer_handle_.reset();
+    if (calld->ShouldStartScheduledHedgedAttempt(
+            /*is_transparent_retry=*/false)) {
+      calld->CreateCallAttempt(/*is_transparent_retry=*/false);
+      GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnHedgingTimer");
+      return;
+    }
+  }
+  GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
+                          "hedging timer fired with nothing to do");
+  GRPC_CALL_STACK_UNREF(calld->owning_call_, "OnHedgingTimer");
+}
+
+void RetryFilter::LegacyCallData::AddClosureToStartHedgedAttempt(
+    CallCombinerClosureList* closures) {
+  if (GRPC_TRACE_FLAG_ENABLED(retry)) {
+    LOG(INFO) << "chand=" << chand_ << " calld=" << this
+              << ": scheduling hedged attempt";
+  }
+  GRPC_CALL_STACK_REF(owning_call_, "StartHedgedAttempt");
+  grpc_closure* closure = arena_->New<grpc_closure>();
+  GRPC_CLOSURE_INIT(closure, StartHedgedAttempt, this, nullptr);
+  closures->Add(closure, absl::OkStatus(), "start hedged attempt");
+}
+
+void RetryFilter::LegacyCallData::StartHedgedAttempt(
+    void* arg, grpc_error_handle /*error*/) {
+  auto* calld = static_cast<RetryFilter::LegacyCallData*>(arg);
+  if (calld->ShouldStartScheduledHedgedAttempt(
+          /*is_transparent_retry=*/false)) {
+    calld->CreateCallAttempt(/*is_transparent_retry=*/false);
+  } else {
+    GRPC_CALL_COMBINER_STOP(calld->call_combiner_,
+                            "hedged attempt no longer needed");
+  }
+  GRPC_CALL_STACK_UNREF(calld->owning_call_, "StartHedgedAttempt");
+}
+
+bool RetryFilter::LegacyCallData::ShouldStartScheduledHedgedAttempt(
+    bool is_transparent_retry) {
+  if (!cancelled_from_surface_.ok()) return false;
+  // If every attempt has failed, this one has to carry the call.
+  if (call_attempt_ == nullptr) return true;
+  if (retry_committed_) return false;
+  return is_transparent_retry ||
+         num_attempts_started_ < hedging_policy_->max_attempts();
+}
+
 }  // namespace grpc_core
@@ -95,6 +95,13 @@ class RetryFilter::LegacyCallData final {
     // Cancels the call attempt.
     void CancelFromSurface(grpc_transport_stream_op_batch* cancel_batch);
 
+    // Adds whatever batches are needed on this attempt to closures.
+    void AddRetriableBatches(CallCombinerClosureList* closures);
+
+    // Cancels and abandons a hedged call attempt that lost to another one.
+    void CancelLosingHedgedAttempt(grpc_error_handle error,
+                                   CallCombinerClosureList* closures);
+
    private:
     // State used for starting a retryable batch on the call attempt's LB call.
     // This provides its own grpc_transport_stream_op_batch and other data
@@ -228,9 +235,6 @@ class RetryFilter::LegacyCallData final {
     // Adds batches for pending batches to closures.
     void AddBatchesForPendingBatches(CallCombinerClosureList* closures);
 
-    // Adds whatever batches are needed on this attempt to closures.
-    void AddRetriableBatches(CallCombinerClosureList* closures);
-
     // Returns true if any send op in the batch was not yet started on this
     // attempt.
     bool PendingBatchContainsUnstartedSendOps(PendingBatch* pending);
@@ -255,6 +259,8 @@ class RetryFilter::LegacyCallData final {
     void MaybeCancelPerAttemptRecvTimer();
 
     LegacyCallData* calld_;
+    // Value of the grpc-previous-rpc-attempts header sent on this attempt.
+    const int num_previous_attempts_;
     OrphanablePtr<ClientChannelFilter::FilterBasedLoadBalancedCall> lb_call_;
     bool lb_call_committed_ = false;
 
@@ -351,6 +357,41 @@ class RetryFilter::LegacyCallData final {
   // Commits the call so that no further retry attempts will be performed.
   void RetryCommit(CallAttempt* call_attempt);
 
+  // Starts batches from the surface on every call attempt in flight.
+  void StartRetriableBatchesOnAllAttempts();
+
+  // Returns true if another hedged attempt may be started.
+  bool CanStartHedgedAttempt();
+  // Called when call_attempt fails with the given status, before the
+  // call is committed.  Returns true if the call should go on without
+  // call_attempt, because its failure is not fatal and there are other
+  // hedged attempts in flight or another one can be started.
+  bool ShouldContinueHedging(grpc_status_code status,
+                             absl::optional<Duration> server_pushback);
+  // Removes call_attempt from the attempts in flight.
+  void DropHedgedAttempt(CallAttempt* call_attempt);
+  // Cancels every hedged attempt other than call_attempt, which becomes
+  // call_attempt_.  Does NOT yield call combiner.
+  void CancelLosingHedgedAttempts(CallAttempt* call_attempt);
+  // After a hedged attempt failed, starts the next one, either right away
+  // or, if the server asked for it, after the server pushback delay.
+  void MaybeStartNextHedgedAttempt(absl::optional<Duration> server_pushback,
+                                   CallCombinerClosureList* closures);
+
+  // Starts the timer for the next hedged attempt, if the client has sent
+  // everything and another attempt may be started.
+  void MaybeStartHedgingTimer();
+  void StartHedgingTimer(Duration delay);
+  void MaybeCancelHedgingTimer();
+  static void OnHedgingTimerLocked(void* arg, grpc_error_handle /*error*/);
+
+  // Adds a closure to closures to start a hedged attempt.
+  void AddClosureToStartHedgedAttempt(CallCombinerClosureList* closures);
+  static void StartHedgedAttempt(void* arg, grpc_error_handle error);
+  // Returns true if a hedged attempt (or a transparent retry of one) whose
+  // start was scheduled should still be started.
+  bool ShouldStartScheduledHedgedAttempt(bool is_transparent_retry);
+
   // Starts a timer to retry after appropriate back-off.
   // If server_pushback is nullopt, retry_backoff_ is used.
   void StartRetryTimer(absl::optional<Duration> server_pushback);
@@ -372,6 +413,7 @@ class RetryFilter::LegacyCallData final {
   grpc_polling_entity* pollent_;
   RefCountedPtr<internal::ServerRetryThrottleData> retry_throttle_data_;
   const internal::RetryMethodConfig* retry_policy_ = nullptr;
+  const internal::HedgingMethodConfig* hedging_policy_ = nullptr;
   BackOff retry_backoff_;
 
   grpc_slice path_;  // Request path.
@@ -384,10 +426,11 @@ class RetryFilter::LegacyCallData final {
 
   RefCountedPtr<CallStackDestructionBarrier> call_stack_destruction_barrier_;
 
-  // TODO(roth): As part of implementing hedging, we will need to maintain a
-  // list of all pending attempts, so that we can cancel them all if the call
-  // gets cancelled.
+  // The current call attempt.  With hedging, this is the oldest attempt
+  // in flight, and the others are in hedged_attempts_ until the call is
+  // committed, at which point the committed attempt becomes call_attempt_.
   RefCountedPtr<CallAttempt> call_attempt_;
+  absl::InlinedVector<RefCountedPtr<CallAttempt>, 1> hedged_attempts_;
 
   // LB call used when we've committed to a call attempt and the retry
   // state for that attempt is no longer needed.  This provides a fast
@@ -415,6 +458,14 @@ class RetryFilter::LegacyCallData final {
       retry_timer_handle_;
   grpc_closure retry_closure_;
 
+  // Hedging state.
+  // Attempts started other than transparent retries.
+  int num_attempts_started_ = 0;
+  // Set when the server asks not to be sent more hedged attempts.
+  bool hedging_stopped_ = false;
+  absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      hedging_timer_handle_;
+
   // Cached data for retrying send ops.
   // send_initial_metadata
   bool seen_send_initial_metadata_ = false;
@@ -113,6 +113,31 @@ void RetryGlobalConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+namespace {
+
+// Parses the optional list of status code names in json field field_name
+// into *status_codes.
+void ParseStatusCodes(const Json& json, const JsonArgs& args,
+                      absl::string_view field_name, ValidationErrors* errors,
+                      StatusCodeSet* status_codes) {
+  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
+      json.object(), args, field_name, errors, /*required=*/false);
+  if (!status_code_list.has_value()) return;
+  for (size_t i = 0; i < status_code_list->size(); ++i) {
+    ValidationErrors::ScopedField field(
+        errors, absl::StrCat(".", field_name, "[", i, "]"));
+    grpc_status_code status;
+    if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
+                                      &status)) {
+      errors->AddError("failed to parse status code");
+    } else {
+      status_codes->Add(status);
+    }
+  }
+}
+
+}  // namespace
+
 //
 // RetryMethodConfig
 //
@@ -170,22 +195,8 @@ void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
     }
   }
   // Parse retryableStatusCodes.
-  auto status_code_list = LoadJsonObjectField<std::vector<std::string>>(
-      json.object(), args, "retryableStatusCodes", errors,
-      /*required=*/false);
-  if (status_code_list.has_value()) {
-    for (size_t i = 0; i < status_code_list->size(); ++i) {
-      ValidationErrors::ScopedField field(
-          errors, absl::StrCat(".retryableStatusCodes[", i, "]"));
-      grpc_status_code status;
-      if (!grpc_status_code_from_string((*status_code_list)[i].c_str(),
-                                        &status)) {
-        errors->AddError("failed to parse status code");
-      } else {
-        retryable_status_codes_.Add(status);
-      }
-    }
-  }
+  ParseStatusCodes(json, args, "retryableStatusCodes", errors,
+                   &retryable_status_codes_);
   // Validate perAttemptRecvTimeout.
   if (args.IsEnabled(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING)) {
     if (per_attempt_recv_timeout_.has_value()) {
@@ -215,6 +226,43 @@ void RetryMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
   }
 }
 
+//
+// HedgingMethodConfig
+//
+
+const JsonLoaderInterface* HedgingMethodConfig::JsonLoader(const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<HedgingMethodConfig>()
+          // Note: The "nonFatalStatusCodes" field requires custom parsing,
+          // so it's handled in JsonPostLoad() instead.
+          .Field("maxAttempts", &HedgingMethodConfig::max_attempts_)
+          .OptionalField("hedgingDelay", &HedgingMethodConfig::hedging_delay_)
+          .Finish();
+  return loader;
+}
+
+void HedgingMethodConfig::JsonPostLoad(const Json& json, const JsonArgs& args,
+                                       ValidationErrors* errors) {
+  // Validate maxAttempts.
+  {
+    ValidationErrors::ScopedField field(errors, ".maxAttempts");
+    if (!errors->FieldHasErrors()) {
+      if (max_attempts_ <= 1) {
+        errors->AddError("must be at least 2");
+      } else if (max_attempts_ > MAX_MAX_RETRY_ATTEMPTS) {
+        LOG(ERROR) << "service config: clamped hedgingPolicy.maxAttempts at "
+                   << MAX_MAX_RETRY_ATTEMPTS;
+        max_attempts_ = MAX_MAX_RETRY_ATTEMPTS;
+      }
+    }
+  }
+  // Parse nonFatalStatusCodes.  Unlike retryableStatusCodes, this may be
+  // empty, in which case every failure is fatal and hedged attempts are
+  // only started by the hedging delay.
+  ParseStatusCodes(json, args, "nonFatalStatusCodes", errors,
+                   &non_fatal_status_codes_);
+}
+
 //
 // RetryServiceConfigParser
 //
@@ -278,5 +326,54 @@ RetryServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
   return std::move(method_params.retry_policy);
 }
 
+//
+// HedgingServiceConfigParser
+//
+
+size_t HedgingServiceConfigParser::ParserIndex() {
+  return CoreConfiguration::Get().service_config_parser().GetParserIndex(
+      parser_name());
+}
+
+void HedgingServiceConfigParser::Register(
+    CoreConfiguration::Builder* builder) {
+  builder->service_config_parser()->RegisterParser(
+      std::make_unique<HedgingServiceConfigParser>());
+}
+
+namespace {
+
+struct HedgingConfig {
+  std::unique_ptr<HedgingMethodConfig> hedging_policy;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<HedgingConfig>()
+            .OptionalField("hedgingPolicy", &HedgingConfig::hedging_policy)
+            .Finish();
+    return loader;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<ServiceConfigParser::ParsedConfig>
+HedgingServiceConfigParser::ParsePerMethodParams(const ChannelArgs& args,
+                                                 const Json& json,
+                                                 ValidationErrors* errors) {
+  if (!args.GetBool(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING).value_or(false)) {
+    return nullptr;
+  }
+  auto method_params =
+      LoadFromJson<HedgingConfig>(json, JsonChannelArgs(args), errors);
+  if (method_params.hedging_policy != nullptr &&
+      json.object().find("retryPolicy") != json.object().end()) {
+    ValidationErrors::ScopedField field(errors, ".hedgingPolicy");
+    errors->AddError("must not be set together with retryPolicy");
+    return nullptr;
+  }
+  return std::move(method_params.hedging_policy);
+}
+
 }  // namespace internal
 }  // namespace grpc_core
@@ -80,6 +80,24 @@ class RetryMethodConfig final : public ServiceConfigParser::ParsedConfig {
   absl::optional<Duration> per_attempt_recv_timeout_;
 };
 
+class HedgingMethodConfig final : public ServiceConfigParser::ParsedConfig {
+ public:
+  int max_attempts() const { return max_attempts_; }
+  Duration hedging_delay() const { return hedging_delay_; }
+  StatusCodeSet non_fatal_status_codes() const {
+    return non_fatal_status_codes_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+  void JsonPostLoad(const Json& json, const JsonArgs& args,
+                    ValidationErrors* errors);
+
+ private:
+  int max_attempts_ = 0;
+  Duration hedging_delay_;
+  StatusCodeSet non_fatal_status_codes_;
+};
+
 class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
  public:
   absl::string_view name() const override { return parser_name(); }
@@ -99,6 +117,24 @@ class RetryServiceConfigParser final : public ServiceConfigParser::Parser {
   static absl::string_view parser_name() { return "retry"; }
 };
 
+// Parses the per-method hedgingPolicy.  This is a separate parser from the
+// one for retryPolicy, so that the retry filter can tell the two apart.
+// The policy is only parsed if GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING is set.
+class HedgingServiceConfigParser final : public ServiceConfigParser::Parser {
+ public:
+  absl::string_view name() const override { return parser_name(); }
+
+  std::unique_ptr<ServiceConfigParser::ParsedConfig> ParsePerMethodParams(
+      const ChannelArgs& args, const Json& json,
+      ValidationErrors* errors) override;
+
+  static size_t ParserIndex();
+  static void Register(CoreConfiguration::Builder* builder);
+
+ private:
+  static absl::string_view parser_name() { return "hedging"; }
+};
+
 }  // namespace internal
 }  // namespace grpc_core
 
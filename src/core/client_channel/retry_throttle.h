@@ -52,6 +52,9 @@ class ServerRetryThrottleData final
   /// Records a success.
   void RecordSuccess();
 
+  /// Returns true if it's okay to send a retry, without recording anything.
+  bool IsRetryAllowed();
+
   uintptr_t max_milli_tokens() const { return max_milli_tokens_; }
   uintptr_t milli_token_ratio() const { return milli_token_ratio_; }
 
@@ -25,6 +25,7 @@
 #include <memory>
 #include <new>
 #include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -245,6 +246,7 @@ SubchannelCall::SubchannelCall(Args args, grpc_error_handle* error)
     : connected_subchannel_(args.connected_subchannel
                                 .TakeAsSubclass<LegacyConnectedSubchannel>()),
       deadline_(args.deadline) {
+  connected_subchannel_->CallStarted();
   grpc_call_stack* callstk = SUBCHANNEL_CALL_TO_CALL_STACK(this);
   const grpc_call_element_args call_args = {
       callstk,              // call_stack
@@ -315,6 +317,7 @@ void SubchannelCall::Destroy(void* arg, grpc_error_handle /*error*/) {
   grpc_closure* after_call_stack_destroy = self->after_call_stack_destroy_;
   RefCountedPtr<ConnectedSubchannel> connected_subchannel =
       std::move(self->connected_subchannel_);
+  connected_subchannel->CallFinished();
   // Destroy the subchannel call.
   self->~SubchannelCall();
   // Destroy the call stack. This should be after destroying the subchannel
@@ -393,8 +396,10 @@ class Subchannel::ConnectedSubchannelStateWatcher final
     : public AsyncConnectivityStateWatcherInterface {
  public:
   // Must be instantiated while holding c->mu.
-  explicit ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c)
-      : subchannel_(std::move(c)) {}
+  ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c,
+                                  ConnectedSubchannel* connected_subchannel)
+      : subchannel_(std::move(c)),
+        connected_subchannel_(connected_subchannel) {}
 
   ~ConnectedSubchannelStateWatcher() override {
     subchannel_.reset(DEBUG_LOCATION, "state_watcher");
@@ -406,33 +411,14 @@ class Subchannel::ConnectedSubchannelStateWatcher final
     Subchannel* c = subchannel_.get();
     {
       MutexLock lock(&c->mu_);
-      // If we're either shutting down or have already seen this connection
-      // failure (i.e., c->connected_subchannel_ is null), do nothing.
-      //
       // The transport reports TRANSIENT_FAILURE upon GOAWAY but SHUTDOWN
       // upon connection close.  So if the server gracefully shuts down,
       // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
       // will see only SHUTDOWN.  Either way, we react to the first one we
       // see, ignoring anything that happens after that.
-      if (c->connected_subchannel_ == nullptr) return;
       if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
           new_state == GRPC_CHANNEL_SHUTDOWN) {
-        if (GRPC_TRACE_FLAG_ENABLED(subchannel)) {
-          LOG(INFO) << "subchannel " << c << " " << c->key_.ToString()
-                    << ": Connected subchannel "
-                    << c->connected_subchannel_.get() << " reports "
-                    << ConnectivityStateName(new_state) << ": " << status;
-        }
-        c->connected_subchannel_.reset();
-        if (c->channelz_node() != nullptr) {
-          c->channelz_node()->SetChildSocket(nullptr);
-        }
-        // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
-        // pass along the status from the transport, since it may have
-        // keepalive info attached to it that the channel needs.
-        // TODO(roth): Consider whether there's a cleaner way to do this.
-        c->SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
-        c->backoff_.Reset();
+        c->OnConnectionLostLocked(connected_subchannel_, new_state, status);
       }
     }
     // Drain any connectivity state notifications after releasing the mutex.
@@ -440,6 +426,8 @@ class Subchannel::ConnectedSubchannelStateWatcher final
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
+  // Only used for identity: the subchannel holds the ref.
+  ConnectedSubchannel* const connected_subchannel_;
 };
 
 //
@@ -458,15 +446,22 @@ void Subchannel::ConnectivityStateWatcherList::RemoveWatcherLocked(
 
 void Subchannel::ConnectivityStateWatcherList::NotifyLocked(
     grpc_connectivity_state state, const absl::Status& status) {
-  for (const auto& p : watchers_) {
-    subchannel_->work_serializer_.Schedule(
-        [watcher = p.second->Ref(), state, status]() mutable {
+  if (watchers_.empty()) return;
+  // A subchannel in the global pool may have thousands of watchers, so
+  // they are all notified from a single WorkSerializer callback rather
+  // than one callback each.
+  std::vector<RefCountedPtr<ConnectivityStateWatcherInterface>> watchers;
+  watchers.reserve(watchers_.size());
+  for (const auto& p : watchers_) watchers.push_back(p.second->Ref());
+  subchannel_->work_serializer_.Schedule(
+      [watchers = std::move(watchers), state, status]() mutable {
+        for (auto& watcher : watchers) {
           auto* watcher_ptr = watcher.get();
           watcher_ptr->OnConnectivityStateChange(std::move(watcher), state,
                                                  status);
-        },
-        DEBUG_LOCATION);
-  }
+        }
+      },
+      DEBUG_LOCATION);
 }
 
 //
@@ -522,6 +517,9 @@ Subchannel::Subchannel(SubchannelKey key,
       key_(std::move(key)),
       args_(args),
       pollset_set_(grpc_pollset_set_create()),
+      max_connections_(Clamp(
+          args_.GetInt("grpc.subchannel.connections_per_address").value_or(1),
+          1, 16)),
       connector_(std::move(connector)),
       watcher_list_(this),
       work_serializer_(args_.GetObjectRef<EventEngine>()),
@@ -694,6 +692,7 @@ void Subchannel::Orphaned() {
     shutdown_ = true;
     connector_.reset();
     connected_subchannel_.reset();
+    stripes_.clear();
   }
   // Drain any connectivity state notifications after releasing the mutex.
   work_serializer_.DrainQueue();
@@ -738,10 +737,8 @@ void Subchannel::SetConnectivityStateLocked(grpc_connectivity_state state,
     channelz_node_->UpdateConnectivityState(state);
     channelz_node_->AddTraceEvent(
         channelz::ChannelTrace::Severity::Info,
-        grpc_slice_from_cpp_string(absl::StrCat(
-            "Subchannel connectivity state changed to ",
-            ConnectivityStateName(state),
-            status.ok() ? "" : absl::StrCat(": ", status_.ToString()))));
+        "Subchannel connectivity state changed to ",
+        ConnectivityStateName(state), status.ok() ? absl::OkStatus() : status_);
   }
   // Notify watchers.
   watcher_list_.NotifyLocked(state, status_);
@@ -771,6 +768,9 @@ void Subchannel::StartConnectingLocked() {
   next_attempt_time_ = backoff_.NextAttemptTime();
   // Report CONNECTING.
   SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+  // A stripe that was being connected when the last connection went away
+  // becomes this attempt.
+  if (connecting_stripe_) return;
   // Start connection attempt.
   SubchannelConnector::Args args;
   args.address = &address_for_connect_;
@@ -797,6 +797,19 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
     connecting_result_.Reset();
     return;
   }
+  if (std::exchange(connecting_stripe_, false)) {
+    if (connected_subchannel_ != nullptr) {
+      OnStripeConnectingFinishedLocked(error);
+      return;
+    }
+    // All connections were lost while this stripe was connecting.  Unless a
+    // connection attempt was requested meanwhile (in which case this is the
+    // attempt), only keep the result if it can serve as the new connection.
+    if (state_ != GRPC_CHANNEL_CONNECTING &&
+        connecting_result_.transport == nullptr) {
+      return;
+    }
+  }
   // If we didn't get a transport or we fail to publish it, report
   // TRANSIENT_FAILURE and start the retry timer.
   // Note that if the connection attempt took longer than the backoff
@@ -834,6 +847,32 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
 
 bool Subchannel::PublishTransportLocked() {
   auto socket_node = std::move(connecting_result_.socket_node);
+  connected_subchannel_ = BuildConnectedSubchannelLocked();
+  if (connected_subchannel_ == nullptr) return false;
+  // Publish.
+  if (GRPC_TRACE_FLAG_ENABLED(subchannel)) {
+    LOG(INFO) << "subchannel " << this << " " << key_.ToString()
+              << ": new connected subchannel at "
+              << connected_subchannel_.get();
+  }
+  if (channelz_node_ != nullptr) {
+    channelz_node_->SetChildSocket(std::move(socket_node));
+  }
+  // Start watching connected subchannel.
+  connected_subchannel_->StartWatch(
+      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
+                        WeakRef(DEBUG_LOCATION, "state_watcher"),
+                        connected_subchannel_.get()));
+  // Report initial state.
+  SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
+  stripe_connect_failed_ = false;
+  MaybeStartStripeConnectLocked();
+  return true;
+}
+
+RefCountedPtr<ConnectedSubchannel>
+Subchannel::BuildConnectedSubchannelLocked() {
+  RefCountedPtr<ConnectedSubchannel> connected_subchannel;
   if (connecting_result_.transport->filter_stack_transport() != nullptr) {
     // Construct channel stack.
     // Builder takes ownership of transport.
@@ -842,16 +881,16 @@ bool Subchannel::PublishTransportLocked() {
         connecting_result_.channel_args.SetObject(
             std::exchange(connecting_result_.transport, nullptr)));
     if (!CoreConfiguration::Get().channel_init().CreateStack(&builder)) {
-      return false;
+      return nullptr;
     }
     absl::StatusOr<RefCountedPtr<grpc_channel_stack>> stack = builder.Build();
     if (!stack.ok()) {
       connecting_result_.Reset();
       LOG(ERROR) << "subchannel " << this << " " << key_.ToString()
                  << ": error initializing subchannel stack: " << stack.status();
-      return false;
+      return nullptr;
     }
-    connected_subchannel_ = MakeRefCounted<LegacyConnectedSubchannel>(
+    connected_subchannel = MakeRefCounted<LegacyConnectedSubchannel>(
         std::move(*stack), args_, channelz_node_);
   } else {
     OrphanablePtr<ClientTransport> transport(
@@ -888,28 +927,133 @@ bool Subchannel::PublishTransportLocked() {
       LOG(ERROR) << "subchannel " << this << " " << key_.ToString()
                  << ": error initializing subchannel stack: "
                  << call_destination.status();
-      return false;
+      return nullptr;
     }
-    connected_subchannel_ = MakeRefCounted<NewConnectedSubchannel>(
+    connected_subchannel = MakeRefCounted<NewConnectedSubchannel>(
         std::move(*call_destination), std::move(transport_destination), args_);
   }
   connecting_result_.Reset();
-  // Publish.
+  return connected_subchannel;
+}
+
+void Subchannel::MaybeStartStripeConnectLocked() {
+  // Calls on the v3 stack are not started through connected_subchannel(), so
+  // only filter stack connections are striped.
+  if (shutdown_ || connecting_stripe_ || stripe_connect_failed_ ||
+      connected_subchannel_ == nullptr ||
+      connected_subchannel_->channel_stack() == nullptr ||
+      stripes_.size() + 1 >= max_connections_) {
+    return;
+  }
+  connecting_stripe_ = true;
+  SubchannelConnector::Args args;
+  args.address = &address_for_connect_;
+  args.interested_parties = pollset_set_;
+  args.deadline = min_connect_timeout_ + Timestamp::Now();
+  args.channel_args = args_;
+  WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
+  connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
+}
+
+void Subchannel::OnStripeConnectingFinishedLocked(grpc_error_handle error) {
+  auto socket_node = std::move(connecting_result_.socket_node);
+  RefCountedPtr<ConnectedSubchannel> stripe;
+  if (connecting_result_.transport != nullptr) {
+    stripe = BuildConnectedSubchannelLocked();
+  }
+  if (stripe == nullptr) {
+    // Don't keep retrying against a server that is refusing the extra
+    // connections: run with what we have until the next reconnect.
+    if (GRPC_TRACE_FLAG_ENABLED(subchannel)) {
+      LOG(INFO) << "subchannel " << this << " " << key_.ToString()
+                << ": stripe connect failed (" << StatusToString(error)
+                << "), continuing with " << stripes_.size() + 1
+                << " connection(s)";
+    }
+    connecting_result_.Reset();
+    stripe_connect_failed_ = true;
+    return;
+  }
   if (GRPC_TRACE_FLAG_ENABLED(subchannel)) {
     LOG(INFO) << "subchannel " << this << " " << key_.ToString()
-              << ": new connected subchannel at "
-              << connected_subchannel_.get();
+              << ": new stripe connected subchannel at " << stripe.get();
   }
-  if (channelz_node_ != nullptr) {
-    channelz_node_->SetChildSocket(std::move(socket_node));
+  stripe->StartWatch(pollset_set_,
+                     MakeOrphanable<ConnectedSubchannelStateWatcher>(
+                         WeakRef(DEBUG_LOCATION, "state_watcher"),
+                         stripe.get()));
+  stripes_.push_back(Stripe{std::move(stripe), std::move(socket_node)});
+  MaybeStartStripeConnectLocked();
+}
+
+void Subchannel::OnConnectionLostLocked(
+    ConnectedSubchannel* connected_subchannel,
+    grpc_connectivity_state new_state, const absl::Status& status) {
+  if (connected_subchannel != connected_subchannel_.get()) {
+    // If we have already seen this connection failure, do nothing.
+    auto it = std::find_if(
+        stripes_.begin(), stripes_.end(),
+        [connected_subchannel](const Stripe& stripe) {
+          return stripe.connected_subchannel.get() == connected_subchannel;
+        });
+    if (it == stripes_.end()) return;
+    if (GRPC_TRACE_FLAG_ENABLED(subchannel)) {
+      LOG(INFO) << "subchannel " << this << " " << key_.ToString()
+                << ": stripe " << connected_subchannel << " reports "
+                << ConnectivityStateName(new_state) << ": " << status;
+    }
+    stripes_.erase(it);
+    MaybeStartStripeConnectLocked();
+    return;
   }
-  // Start watching connected subchannel.
-  connected_subchannel_->StartWatch(
-      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
-                        WeakRef(DEBUG_LOCATION, "state_watcher")));
-  // Report initial state.
-  SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
-  return true;
+  if (GRPC_TRACE_FLAG_ENABLED(subchannel)) {
+    LOG(INFO) << "subchannel " << this << " " << key_.ToString()
+              << ": Connected subchannel " << connected_subchannel_.get()
+              << " reports " << ConnectivityStateName(new_state) << ": "
+              << status;
+  }
+  if (!stripes_.empty()) {
+    // The remaining connections keep the subchannel READY.
+    Stripe& stripe = stripes_.back();
+    if (GRPC_TRACE_FLAG_ENABLED(subchannel)) {
+      LOG(INFO) << "subchannel " << this << " " << key_.ToString()
+                << ": promoting stripe " << stripe.connected_subchannel.get()
+                << " to connected subchannel";
+    }
+    connected_subchannel_ = std::move(stripe.connected_subchannel);
+    if (channelz_node() != nullptr) {
+      channelz_node()->SetChildSocket(std::move(stripe.socket_node));
+    }
+    stripes_.pop_back();
+    MaybeStartStripeConnectLocked();
+    return;
+  }
+  if (channelz_node() != nullptr) {
+    channelz_node()->SetChildSocket(nullptr);
+  }
+  connected_subchannel_.reset();
+  // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
+  // pass along the status from the transport, since it may have
+  // keepalive info attached to it that the channel needs.
+  // TODO(roth): Consider whether there's a cleaner way to do this.
+  SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
+  backoff_.Reset();
+}
+
+RefCountedPtr<ConnectedSubchannel> Subchannel::PickConnectedSubchannelLocked()
+    const {
+  ConnectedSubchannel* best = connected_subchannel_.get();
+  if (best == nullptr) return nullptr;
+  // Join the shortest queue: a connection that is limited by its flow control
+  // window or by the peer's MAX_CONCURRENT_STREAMS drains calls more slowly
+  // and so accumulates more of them.
+  for (const auto& stripe : stripes_) {
+    if (stripe.connected_subchannel->calls_in_flight() <
+        best->calls_in_flight()) {
+      best = stripe.connected_subchannel.get();
+    }
+  }
+  return best->Ref();
 }
 
 ChannelArgs Subchannel::MakeSubchannelArgs(
@@ -21,9 +21,11 @@
 
 #include <stddef.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
@@ -81,11 +83,23 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
   virtual size_t GetInitialCallSizeEstimate() const = 0;
   virtual void Ping(grpc_closure* on_initiate, grpc_closure* on_ack) = 0;
 
+  // Number of subchannel calls currently using this connection.
+  size_t calls_in_flight() const {
+    return calls_in_flight_.load(std::memory_order_relaxed);
+  }
+  void CallStarted() {
+    calls_in_flight_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void CallFinished() {
+    calls_in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
  protected:
   explicit ConnectedSubchannel(const ChannelArgs& args);
 
  private:
   ChannelArgs args_;
+  std::atomic<size_t> calls_in_flight_{0};
 };
 
 class LegacyConnectedSubchannel;
@@ -217,6 +231,10 @@ class Subchannel final : public DualRefCounted<Subchannel> {
 
   const grpc_resolved_address& address() const { return key_.address(); }
 
+  // The args the subchannel was created with, which identify it in the
+  // subchannel pool along with its address.
+  const ChannelArgs& key_args() const { return key_.args(); }
+
   // Starts watching the subchannel's connectivity state.
   // The first callback to the watcher will be delivered ~immediately.
   // Subsequent callbacks will be delivered as the subchannel's state
@@ -232,10 +250,13 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   void CancelConnectivityStateWatch(ConnectivityStateWatcherInterface* watcher)
       ABSL_LOCKS_EXCLUDED(mu_);
 
+  // Returns the connection new calls should use. If the subchannel keeps
+  // more than one connection open, this is the one with the fewest calls in
+  // flight.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel()
       ABSL_LOCKS_EXCLUDED(mu_) {
     MutexLock lock(&mu_);
-    return connected_subchannel_;
+    return PickConnectedSubchannelLocked();
   }
 
   RefCountedPtr<UnstartedCallDestination> call_destination() {
@@ -329,6 +350,21 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   void OnConnectingFinishedLocked(grpc_error_handle error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Builds the connected subchannel for the transport in connecting_result_.
+  // Returns null on failure.
+  RefCountedPtr<ConnectedSubchannel> BuildConnectedSubchannelLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Methods for connection striping.
+  void MaybeStartStripeConnectLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnStripeConnectingFinishedLocked(grpc_error_handle error)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnConnectionLostLocked(ConnectedSubchannel* connected_subchannel,
+                              grpc_connectivity_state new_state,
+                              const absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  RefCountedPtr<ConnectedSubchannel> PickConnectedSubchannelLocked() const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
@@ -345,6 +381,9 @@ class Subchannel final : public DualRefCounted<Subchannel> {
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   // Minimum connection timeout.
   Duration min_connect_timeout_;
+  // Number of connections to keep open to the address once it is READY
+  // (the primary connection plus max_connections_ - 1 stripes).
+  size_t max_connections_;
 
   // Connection state.
   OrphanablePtr<SubchannelConnector> connector_;
@@ -372,6 +411,22 @@ class Subchannel final : public DualRefCounted<Subchannel> {
 
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
+  // An additional connection to the same address, along with its channelz
+  // socket node, which is registered with channelz_node_ if the stripe is
+  // promoted to be the active connection.
+  struct Stripe {
+    RefCountedPtr<ConnectedSubchannel> connected_subchannel;
+    RefCountedPtr<channelz::SocketNode> socket_node;
+  };
+  // Additional connections to the same address that calls are striped
+  // across.  Only populated while connected_subchannel_ is set.
+  std::vector<Stripe> stripes_ ABSL_GUARDED_BY(mu_);
+  // True while connector_ is establishing a stripe.  If the primary connection
+  // is lost meanwhile, the attempt is adopted as the new primary.
+  bool connecting_stripe_ ABSL_GUARDED_BY(mu_) = false;
+  // Set when a stripe fails to connect; no more stripes are attempted until a
+  // new primary connection is established.
+  bool stripe_connect_failed_ ABSL_GUARDED_BY(mu_) = false;
 
   // Backoff state.
   BackOff backoff_ ABSL_GUARDED_BY(mu_);
@@ -21,6 +21,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
 #include <string>
 
 #include "absl/strings/string_view.h"
@@ -57,6 +59,9 @@ class SubchannelKey final {
  private:
   grpc_resolved_address address_;
   ChannelArgs args_;
+  // Compared before args_, so that keys whose args differ rarely need a
+  // full comparison of the args.
+  size_t args_hash_;
 };
 
 // Interface for subchannel pool.
@@ -91,6 +96,10 @@ class SubchannelPoolInterface : public RefCounted<SubchannelPoolInterface> {
   // if no such channel exists. Thread-safe.
   virtual RefCountedPtr<Subchannel> FindSubchannel(
       const SubchannelKey& key) = 0;
+
+  // Called when a channel is done with \a subchannel. The pool may keep it,
+  // and its connection, for a while in case it is wanted again.
+  virtual void ReleaseSubchannel(RefCountedPtr<Subchannel> subchannel) = 0;
 };
 
 }  // namespace grpc_core
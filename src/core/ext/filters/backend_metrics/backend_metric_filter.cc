@@ -54,11 +54,10 @@ const NoInterceptor BackendMetricFilter::Call::OnServerToClientMessage;
 const NoInterceptor BackendMetricFilter::Call::OnFinalize;
 
 namespace {
-absl::optional<std::string> MaybeSerializeBackendMetrics(
-    BackendMetricProvider* provider) {
-  if (provider == nullptr) return absl::nullopt;
-  BackendMetricData data = provider->GetBackendMetricData();
-  upb::Arena arena;
+// Returns the serialized OrcaLoadReport, or an empty slice if there are no
+// metrics.
+Slice SerializeBackendMetrics(const BackendMetricData& data) {
+  upb::InlinedArena<1024> arena;
   xds_data_orca_v3_OrcaLoadReport* response =
       xds_data_orca_v3_OrcaLoadReport_new(arena.ptr());
   bool has_data = false;
@@ -106,13 +105,11 @@ absl::optional<std::string> MaybeSerializeBackendMetrics(
         p.second, arena.ptr());
     has_data = true;
   }
-  if (!has_data) {
-    return absl::nullopt;
-  }
+  if (!has_data) return Slice();
   size_t len;
   char* buf =
       xds_data_orca_v3_OrcaLoadReport_serialize(response, arena.ptr(), &len);
-  return std::string(buf, len);
+  return Slice::FromCopiedBuffer(buf, len);
 }
 }  // namespace
 
@@ -133,14 +130,17 @@ void BackendMetricFilter::Call::OnServerTrailingMetadata(ServerMetadata& md) {
     }
     return;
   }
-  absl::optional<std::string> serialized = MaybeSerializeBackendMetrics(ctx);
-  if (serialized.has_value() && !serialized->empty()) {
+  absl::optional<Slice> serialized = ctx->GetCachedSerializedMetrics();
+  if (!serialized.has_value()) {
+    serialized = SerializeBackendMetrics(ctx->GetBackendMetricData());
+    ctx->CacheSerializedMetrics(*serialized);
+  }
+  if (!serialized->empty()) {
     if (GRPC_TRACE_FLAG_ENABLED(backend_metric_filter)) {
       LOG(INFO) << "[" << this
                 << "] Backend metrics serialized. size: " << serialized->size();
     }
-    md.Set(EndpointLoadMetricsBinMetadata(),
-           Slice::FromCopiedString(std::move(*serialized)));
+    md.Set(EndpointLoadMetricsBinMetadata(), std::move(*serialized));
   } else if (GRPC_TRACE_FLAG_ENABLED(backend_metric_filter)) {
     LOG(INFO) << "[" << this << "] No backend metrics.";
   }
@@ -15,7 +15,10 @@
 #ifndef GRPC_SRC_CORE_EXT_FILTERS_BACKEND_METRICS_BACKEND_METRIC_PROVIDER_H
 #define GRPC_SRC_CORE_EXT_FILTERS_BACKEND_METRICS_BACKEND_METRIC_PROVIDER_H
 
+#include "absl/types/optional.h"
+
 #include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
 
 namespace grpc_core {
 
@@ -24,6 +27,15 @@ class BackendMetricProvider {
  public:
   virtual ~BackendMetricProvider() = default;
   virtual BackendMetricData GetBackendMetricData() = 0;
+  // A serialized report can be reused for as long as the metrics do not
+  // change. Returns the report serialized by an earlier call if the metrics of
+  // this call are the same, or nullopt. An empty slice means no metrics.
+  virtual absl::optional<Slice> GetCachedSerializedMetrics() {
+    return absl::nullopt;
+  }
+  // Called with the report serialized from GetBackendMetricData(), so that
+  // later calls can reuse it.
+  virtual void CacheSerializedMetrics(const Slice& /*serialized*/) {}
 };
 
 template <>
@@ -16,81 +16,51 @@
 
 #include "src/core/ext/filters/channel_idle/idle_filter_state.h"
 
-#include <assert.h>
-
 namespace grpc_core {
 
 IdleFilterState::IdleFilterState(bool start_timer)
-    : state_(start_timer ? kTimerStarted : 0) {}
+    : timer_started_(start_timer) {}
+
+bool IdleFilterState::IncreaseCallCount() {
+  // Count the call before looking at the timer flag (both sequentially
+  // consistent): CheckTimer clears the flag before taking its final look at
+  // the shards, so either it sees this call or we see the timer stopped.
+  shards_.this_cpu().calls_started.fetch_add(1);
+  if (GPR_LIKELY(timer_started_.load())) return false;
+  MutexLock lock(&mu_);
+  if (timer_started_.load(std::memory_order_relaxed)) return false;
+  timer_started_.store(true);
+  return true;
+}
 
-void IdleFilterState::IncreaseCallCount() {
-  uintptr_t state = state_.load(std::memory_order_relaxed);
-  uintptr_t new_state;
-  do {
-    // Increment the counter, and flag that there's been activity.
-    new_state = state;
-    new_state |= kCallsStartedSinceLastTimerCheck;
-    new_state += kCallIncrement;
-  } while (!state_.compare_exchange_weak(
-      state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed));
+void IdleFilterState::DecreaseCallCount() {
+  shards_.this_cpu().calls_finished.fetch_add(1);
 }
 
-bool IdleFilterState::DecreaseCallCount() {
-  uintptr_t state = state_.load(std::memory_order_relaxed);
-  uintptr_t new_state;
-  bool start_timer;
-  do {
-    start_timer = false;
-    new_state = state;
-    // Decrement call count (and assert there's at least one call outstanding!)
-    assert(new_state >= kCallIncrement);
-    new_state -= kCallIncrement;
-    // If that decrement reaches a call count of zero and we have not started a
-    // timer
-    if ((new_state >> kCallsInProgressShift) == 0 &&
-        (new_state & kTimerStarted) == 0) {
-      // Flag that we will start a timer, and mark it started so nobody else
-      // does.
-      start_timer = true;
-      new_state |= kTimerStarted;
-      new_state &= ~kCallsInProgressShift;
-    }
-  } while (!state_.compare_exchange_weak(
-      state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed));
-  return start_timer;
+bool IdleFilterState::ActiveLocked() {
+  // Sum finished calls first: every call counted there has a start that will
+  // be visible when we sum starts, so the difference never undercounts.
+  uint64_t calls_finished = 0;
+  for (const Shard& shard : shards_) calls_finished += shard.calls_finished;
+  uint64_t calls_started = 0;
+  for (const Shard& shard : shards_) calls_started += shard.calls_started;
+  if (calls_started != calls_finished) return true;
+  if (calls_started == calls_started_at_last_check_) return false;
+  calls_started_at_last_check_ = calls_started;
+  return true;
 }
 
 bool IdleFilterState::CheckTimer() {
-  uintptr_t state = state_.load(std::memory_order_relaxed);
-  uintptr_t new_state;
-  bool start_timer;
-  do {
-    if ((state >> kCallsInProgressShift) != 0) {
-      // Still calls in progress: nothing needs updating, just return
-      // and keep the timer going!
-      return true;
-    }
-    new_state = state;
-    bool is_active = false;
-    if (new_state & kCallsStartedSinceLastTimerCheck) {
-      // If any calls started since the last time we checked, then consider the
-      // channel still active and try again.
-      is_active = true;
-      new_state &= ~kCallsStartedSinceLastTimerCheck;
-    }
-    if (is_active) {
-      // If we are still active, we should signal that the timer should start
-      // again.
-      start_timer = true;
-    } else {
-      // Otherwise, we should not start the timer again, and we should signal
-      // that in the updated state.
-      start_timer = false;
-      new_state &= ~kTimerStarted;
-    }
-  } while (!state_.compare_exchange_weak(
-      state, new_state, std::memory_order_acq_rel, std::memory_order_relaxed));
-  return start_timer;
+  MutexLock lock(&mu_);
+  if (ActiveLocked()) return true;
+  timer_started_.store(false);
+  // A call may have started while we were summing and still seen the timer
+  // running; now that new calls will see it stopped, look once more.
+  if (ActiveLocked()) {
+    timer_started_.store(true, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
 }
 
 }  // namespace grpc_core
@@ -21,11 +21,22 @@
 
 #include <atomic>
 
+#include "absl/base/thread_annotations.h"
+
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
+
 namespace grpc_core {
 
 // State machine for the idle filter.
 // Keeps track of how many calls are in progress, whether there is a timer
 // started, and whether we've seen calls since the previous timer fired.
+//
+// Call starts and ends only touch a per-cpu shard (plus a read of the timer
+// flag); the shards are summed when the timer fires. Since that means nobody
+// sees the call count reach zero, the timer is started by the first call to
+// arrive while it is not running, and keeps running until it sees a full
+// cycle with no calls in progress and none started.
 class IdleFilterState {
  public:
   explicit IdleFilterState(bool start_timer);
@@ -35,32 +46,36 @@ class IdleFilterState {
   IdleFilterState& operator=(const IdleFilterState&) = delete;
 
   // Increment the number of calls in progress.
-  void IncreaseCallCount();
+  // Return true if no timer was running: the caller must start one.
+  GRPC_MUST_USE_RESULT bool IncreaseCallCount();
 
   // Decrement the number of calls in progress.
-  // Return true if we reached idle with no timer started.
-  GRPC_MUST_USE_RESULT bool DecreaseCallCount();
+  void DecreaseCallCount();
 
   // Check if there's been any activity since the last timer check.
-  // If there was, reset the activity flag and return true to indicated that
-  // a new timer should be started.
+  // If there was (or calls are still in progress), return true to indicate
+  // that a new timer should be started.
   // If there was not, reset the timer flag and return false - in this case
   // we know that the channel is idle and has been for one full cycle.
   GRPC_MUST_USE_RESULT bool CheckTimer();
 
  private:
-  // Bit in state_ indicating that the timer has been started.
-  static constexpr uintptr_t kTimerStarted = 1;
-  // Bit in state_ indicating that we've seen a call start or stop since the
-  // last timer.
-  static constexpr uintptr_t kCallsStartedSinceLastTimerCheck = 2;
-  // How much should we shift to get the number of calls in progress.
-  static constexpr uintptr_t kCallsInProgressShift = 2;
-  // How much to increment/decrement the state_ when a call is started/stopped.
-  // Ensures we don't clobber the preceding bits.
-  static constexpr uintptr_t kCallIncrement = uintptr_t{1}
-                                              << kCallsInProgressShift;
-  std::atomic<uintptr_t> state_;
+  // Counters are monotonic so that the sums stay consistent even though a call
+  // may finish on a different shard than it started on.
+  struct alignas(GPR_CACHELINE_SIZE) Shard {
+    std::atomic<uint64_t> calls_started{0};
+    std::atomic<uint64_t> calls_finished{0};
+  };
+
+  // Under mu_: true if calls are in progress or have started since the last
+  // check, recording the number of calls started for the next check.
+  bool ActiveLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
+  // Read on every call start; only written when the timer starts or stops.
+  std::atomic<bool> timer_started_;
+  Mutex mu_;
+  uint64_t calls_started_at_last_check_ ABSL_GUARDED_BY(mu_) = 0;
 };
 
 }  // namespace grpc_core
@@ -236,19 +236,19 @@ bool LegacyChannelIdleFilter::StartTransportOp(grpc_transport_op* op) {
 void LegacyChannelIdleFilter::Shutdown() {
   // IncreaseCallCount() introduces a phony call and prevent the timer from
   // being reset by other threads.
-  IncreaseCallCount();
+  (void)idle_filter_state_->IncreaseCallCount();
   activity_.Reset();
 }
 
 void LegacyChannelIdleFilter::IncreaseCallCount() {
-  idle_filter_state_->IncreaseCallCount();
+  if (idle_filter_state_->IncreaseCallCount()) {
+    // If the idle timer is not running, start it.
+    StartIdleTimer();
+  }
 }
 
 void LegacyChannelIdleFilter::DecreaseCallCount() {
-  if (idle_filter_state_->DecreaseCallCount()) {
-    // If there are no more calls in progress, start the idle timer.
-    StartIdleTimer();
-  }
+  idle_filter_state_->DecreaseCallCount();
 }
 
 void LegacyChannelIdleFilter::StartIdleTimer() {
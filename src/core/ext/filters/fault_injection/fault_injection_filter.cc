@@ -147,6 +147,23 @@ FaultInjectionFilter::FaultInjectionFilter(ChannelFilter::Args filter_args)
           FaultInjectionServiceConfigParser::ParserIndex()) {}
 
 // Construct a promise for one call.
+bool FaultInjectionFilter::IsActiveForCall(
+    const grpc_call_element_args& args) {
+  auto* service_config_call_data =
+      args.arena->GetContext<ServiceConfigCallData>();
+  if (service_config_call_data == nullptr) return true;
+  auto* method_params = static_cast<FaultInjectionMethodParsedConfig*>(
+      service_config_call_data->GetMethodParsedConfig(
+          service_config_parser_index_));
+  if (method_params == nullptr) return true;
+  const FaultInjectionMethodParsedConfig::FaultInjectionPolicy* fi_policy =
+      method_params->fault_injection_policy(index_);
+  if (fi_policy == nullptr) return true;
+  // Headers may lower the configured percentages, but never raise them.
+  return fi_policy->abort_percentage_numerator > 0 ||
+         fi_policy->delay_percentage_numerator > 0;
+}
+
 ArenaPromise<absl::Status> FaultInjectionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, FaultInjectionFilter* filter) {
   auto decision = filter->MakeInjectionDecision(md);
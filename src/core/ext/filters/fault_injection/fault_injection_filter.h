@@ -52,6 +52,9 @@ class FaultInjectionFilter
 
   explicit FaultInjectionFilter(ChannelFilter::Args filter_args);
 
+  // Calls whose policy can never inject a fault skip this filter.
+  bool IsActiveForCall(const grpc_call_element_args& args);
+
   // Construct a promise for one call.
   class Call {
    public:
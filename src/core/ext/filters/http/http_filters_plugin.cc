@@ -66,5 +66,16 @@ void RegisterHttpFilters(CoreConfiguration::Builder* builder) {
       ->RegisterFilter<HttpServerFilter>(GRPC_SERVER_CHANNEL)
       .If(IsBuildingHttpLikeTransport)
       .After<ServerMessageSizeFilter>();
+  // Compression is ordered straight after the http filter, so on v3 stacks
+  // the two are usually adjacent and can share their interceptors' operations.
+  builder->channel_init()
+      ->RegisterFusedFilters<HttpClientFilter, ClientCompressionFilter>(
+          GRPC_CLIENT_SUBCHANNEL);
+  builder->channel_init()
+      ->RegisterFusedFilters<HttpClientFilter, ClientCompressionFilter>(
+          GRPC_CLIENT_DIRECT_CHANNEL);
+  builder->channel_init()
+      ->RegisterFusedFilters<HttpServerFilter, ServerCompressionFilter>(
+          GRPC_SERVER_CHANNEL);
 }
 }  // namespace grpc_core
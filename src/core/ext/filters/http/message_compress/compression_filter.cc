@@ -27,6 +27,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/types/optional.h"
+#include "absl/types/span.h"
 
 #include <grpc/compression.h>
 #include <grpc/grpc.h>
@@ -51,6 +52,7 @@
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 
@@ -95,7 +97,15 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION).value_or(true)),
       enable_decompression_(
           args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION)
-              .value_or(true)) {
+              .value_or(true)),
+      deflate_compression_level_(
+          Clamp(args.GetInt(GRPC_ARG_DEFLATE_COMPRESSION_LEVEL).value_or(-1),
+                -1, 9)) {
+  absl::optional<absl::string_view> dictionary =
+      args.GetString(GRPC_ARG_DEFLATE_COMPRESSION_DICTIONARY);
+  if (dictionary.has_value() && !dictionary->empty()) {
+    deflate_dictionary_.emplace(*dictionary);
+  }
   // Make sure the default is enabled.
   if (!enabled_compression_algorithms_.IsSet(default_compression_algorithm_)) {
     const char* name;
@@ -111,6 +121,9 @@ ChannelCompression::ChannelCompression(const ChannelArgs& args)
 
 MessageHandle ChannelCompression::CompressMessage(
     MessageHandle message, grpc_compression_algorithm algorithm) const {
+  // Only calls over the in-process transport keep message objects this far
+  // (see MessageObjectPassthrough), and those have no bytes to compress.
+  if (message->has_object()) return message;
   if (GRPC_TRACE_FLAG_ENABLED(compression)) {
     LOG(INFO) << "CompressMessage: len=" << message->payload()->Length()
               << " alg=" << algorithm << " flags=" << message->flags();
@@ -130,8 +143,14 @@ MessageHandle ChannelCompression::CompressMessage(
   // Try to compress the payload.
   SliceBuffer tmp;
   SliceBuffer* payload = message->payload();
-  bool did_compress = grpc_msg_compress(algorithm, payload->c_slice_buffer(),
-                                        tmp.c_slice_buffer());
+  bool did_compress =
+      deflate_dictionary_.has_value()
+          ? grpc_msg_compress_with_dictionary(
+                algorithm, deflate_compression_level_, *deflate_dictionary_,
+                payload->c_slice_buffer(), tmp.c_slice_buffer())
+          : grpc_msg_compress_with_level(
+                algorithm, deflate_compression_level_,
+                payload->c_slice_buffer(), tmp.c_slice_buffer());
   // If we achieved compression send it as compressed, otherwise send it as (to
   // avoid spending cycles on the receiver decompressing).
   if (did_compress) {
@@ -166,6 +185,8 @@ MessageHandle ChannelCompression::CompressMessage(
 
 absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
     bool is_client, MessageHandle message, DecompressArgs args) const {
+  // As in CompressMessage.
+  if (message->has_object()) return std::move(message);
   if (GRPC_TRACE_FLAG_ENABLED(compression)) {
     LOG(INFO) << "DecompressMessage: len=" << message->payload()->Length()
               << " max=" << args.max_recv_message_length.value_or(-1)
@@ -192,8 +213,13 @@ absl::StatusOr<MessageHandle> ChannelCompression::DecompressMessage(
   }
   // Try to decompress the payload.
   SliceBuffer decompressed_slices;
-  if (grpc_msg_decompress(args.algorithm, message->payload()->c_slice_buffer(),
-                          decompressed_slices.c_slice_buffer()) == 0) {
+  absl::Span<const DeflateDictionary> dictionaries;
+  if (deflate_dictionary_.has_value()) {
+    dictionaries = absl::MakeConstSpan(&*deflate_dictionary_, 1);
+  }
+  if (grpc_msg_decompress_with_dictionaries(
+          args.algorithm, dictionaries, message->payload()->c_slice_buffer(),
+          decompressed_slices.c_slice_buffer()) == 0) {
     return absl::InternalError(
         absl::StrCat("Unexpected error decompressing data for algorithm ",
                      CompressionAlgorithmAsString(args.algorithm)));
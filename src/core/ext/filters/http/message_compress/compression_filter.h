@@ -34,6 +34,7 @@
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/compression/message_compress.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
@@ -104,6 +105,10 @@ class ChannelCompression {
   bool enable_compression_;
   // Is decompression enabled?
   bool enable_decompression_;
+  // zlib level for deflate and gzip compression.
+  int deflate_compression_level_;
+  // Preset dictionary for deflate, if configured.
+  absl::optional<DeflateDictionary> deflate_dictionary_;
 };
 
 class ClientCompressionFilter final
@@ -179,6 +179,23 @@ void EncodeMessageToPayload(const SliceBuffer* message, uint32_t log_len,
                             LoggingSink::Entry* entry) {
   auto* sb = message->c_slice_buffer();
   entry->payload.message_length = sb->length;
+  if (g_logging_sink->DefersMessageCopies()) {
+    // Only take refs to the part of the message to log: the sink copies it
+    // when it gets to the entry.
+    auto slices = std::make_shared<SliceBuffer>();
+    for (size_t i = 0; i < message->Count(); i++) {
+      const Slice& slice = (*message)[i];
+      if (log_len < slice.length()) {
+        if (log_len > 0) slices->Append(slice.RefSubSlice(0, log_len));
+        entry->payload_truncated = true;
+        break;
+      }
+      slices->Append(slice.Ref());
+      log_len -= slice.length();
+    }
+    entry->payload.message_slices = std::move(slices);
+    return;
+  }
   // Log the message to a max of the configured message length
   for (size_t i = 0; i < sb->count; i++) {
     absl::StrAppend(
@@ -24,6 +24,7 @@
 #include <stdint.h>
 
 #include <map>
+#include <memory>
 #include <string>
 
 #include "absl/numeric/int128.h"
@@ -31,6 +32,7 @@
 #include "absl/strings/string_view.h"
 
 #include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/slice/slice_buffer.h"
 
 namespace grpc_core {
 
@@ -118,6 +120,20 @@ class LoggingSink {
       std::string status_details;
       uint32_t message_length = 0;
       std::string message;
+      // For sinks that defer copying messages (see
+      // LoggingSink::DefersMessageCopies()), refs to the slices of the part
+      // of the message to log, which MaterializeMessage() copies into
+      // `message`.
+      std::shared_ptr<const SliceBuffer> message_slices;
+
+      void MaterializeMessage() {
+        if (message_slices == nullptr) return;
+        message.reserve(message.size() + message_slices->Length());
+        for (size_t i = 0; i < message_slices->Count(); ++i) {
+          absl::StrAppend(&message, (*message_slices)[i].as_string_view());
+        }
+        message_slices.reset();
+      }
     };
 
     struct Address {
@@ -151,6 +167,12 @@ class LoggingSink {
                            absl::string_view method) = 0;
 
   virtual void LogEntry(Entry entry) = 0;
+
+  // If true, the logging filter hands messages to LogEntry() as refs to
+  // their slices in Entry::Payload::message_slices instead of copying their
+  // bytes, and the sink calls Entry::Payload::MaterializeMessage() when it
+  // needs them, e.g. off the call path.
+  virtual bool DefersMessageCopies() const { return false; }
 };
 
 inline std::ostream& operator<<(std::ostream& out,
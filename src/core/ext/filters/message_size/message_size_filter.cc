@@ -159,6 +159,11 @@ ServerMetadataHandle CheckPayload(const Message& msg,
                                   absl::optional<uint32_t> max_length,
                                   bool is_client, bool is_send) {
   if (!max_length.has_value()) return nullptr;
+  // Only calls over the in-process transport keep message objects this far
+  // (see MessageObjectPassthrough). Such an object has no size until it is
+  // serialized, and serializing it only to check its size would defeat its
+  // purpose.
+  if (msg.has_object()) return nullptr;
   if (GRPC_TRACE_FLAG_ENABLED(call)) {
     LOG(INFO) << GetContext<Activity>()->DebugTag() << "[message_size] "
               << (is_send ? "send" : "recv")
@@ -27,6 +27,7 @@
 #include <utility>
 #include <vector>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/match.h"
@@ -169,11 +170,13 @@ absl::string_view GetClusterToUse(
   return absl::StripPrefix(arena_allocated_cluster, kClusterPrefix);
 }
 
-std::string GetCookieValue(const ClientMetadata& client_initial_metadata,
-                           absl::string_view cookie_name) {
+// Returns the base64-encoded value of the cookie, which may point into
+// buffer.
+absl::string_view GetCookieValue(const ClientMetadata& client_initial_metadata,
+                                 absl::string_view cookie_name,
+                                 std::string* buffer) {
   // Check to see if the cookie header is present.
-  std::string buffer;
-  auto header_value = client_initial_metadata.GetStringValue("cookie", &buffer);
+  auto header_value = client_initial_metadata.GetStringValue("cookie", buffer);
   if (!header_value.has_value()) return "";
   // Parse cookie header.
   std::vector<absl::string_view> values;
@@ -185,11 +188,7 @@ std::string GetCookieValue(const ClientMetadata& client_initial_metadata,
   if (values.empty()) return "";
   // TODO(roth): Figure out the right behavior for multiple cookies.
   // For now, just choose the first value.
-  std::string decoded;
-  if (absl::Base64Unescape(values.front(), &decoded)) {
-    return decoded;
-  }
-  return "";
+  return values.front();
 }
 
 bool IsConfiguredPath(absl::string_view configured_path,
@@ -219,6 +218,37 @@ bool IsConfiguredPath(absl::string_view configured_path,
 }
 }  // namespace
 
+absl::string_view SessionCookieCache::Decode(absl::string_view encoded) {
+  if (encoded.empty()) return absl::string_view();
+  Shard& shard = shards_[absl::HashOf(encoded) % kNumShards];
+  MutexLock lock(&shard.mu);
+  auto it = std::find_if(
+      shard.entries.begin(), shard.entries.end(),
+      [encoded](const Entry& entry) { return entry.encoded == encoded; });
+  if (it == shard.entries.end()) {
+    std::string decoded;
+    if (!absl::Base64Unescape(encoded, &decoded)) return absl::string_view();
+    if (shard.entries.size() == kEntriesPerShard) shard.entries.pop_back();
+    shard.entries.push_front(Entry{std::string(encoded), std::move(decoded)});
+  } else if (it != shard.entries.begin()) {
+    shard.entries.splice(shard.entries.begin(), shard.entries, it);
+  }
+  return AllocateStringOnArena(shard.entries.front().decoded);
+}
+
+bool StatefulSessionFilter::IsActiveForCall(
+    const grpc_call_element_args& args) {
+  auto* service_config_call_data =
+      args.arena->GetContext<ServiceConfigCallData>();
+  if (service_config_call_data == nullptr) return true;
+  auto* method_params = static_cast<StatefulSessionMethodParsedConfig*>(
+      service_config_call_data->GetMethodParsedConfig(
+          service_config_parser_index_));
+  if (method_params == nullptr) return true;
+  auto* cookie_config = method_params->GetConfig(index_);
+  return cookie_config == nullptr || cookie_config->name.has_value();
+}
+
 void StatefulSessionFilter::Call::OnClientInitialMetadata(
     ClientMetadata& md, StatefulSessionFilter* filter) {
   // Get config.
@@ -234,15 +264,15 @@ void StatefulSessionFilter::Call::OnClientInitialMetadata(
       !IsConfiguredPath(cookie_config_->path, md)) {
     return;
   }
-  // Base64-decode cookie value.
-  std::string cookie_value = GetCookieValue(md, *cookie_config_->name);
+  // Base64-decode cookie value. It is allocated on the arena, so that it has
+  // the right lifetime.
+  std::string buffer;
+  absl::string_view cookie_value = filter->cookie_cache_.Decode(
+      GetCookieValue(md, *cookie_config_->name, &buffer));
   // Cookie format is "host;cluster"
   std::pair<absl::string_view, absl::string_view> host_cluster =
       absl::StrSplit(cookie_value, absl::MaxSplits(';', 1));
-  // Allocate the string on the arena, so that it has the right lifetime.
-  if (!host_cluster.first.empty()) {
-    cookie_address_list_ = AllocateStringOnArena(host_cluster.first);
-  }
+  if (!host_cluster.first.empty()) cookie_address_list_ = host_cluster.first;
   // Set override host attribute.
   override_host_attribute_ =
       GetContext<Arena>()->ManagedNew<XdsOverrideHostAttribute>(
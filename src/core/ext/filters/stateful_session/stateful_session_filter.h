@@ -21,8 +21,11 @@
 
 #include <stddef.h>
 
+#include <list>
+#include <string>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 
@@ -31,6 +34,7 @@
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/promise_based_filter.h"
 #include "src/core/lib/gprpp/ref_counted_string.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/transport/transport.h"
@@ -69,6 +73,34 @@ class XdsOverrideHostAttribute
 };
 
 // A filter to provide cookie-based stateful session affinity.
+// Caches base64-decoded session cookies for a channel.  The calls of a
+// session all send the same cookie, but a channel usually carries several
+// sessions at once.  So the cache keeps a few recently used cookies in each
+// of several shards, each under its own lock, rather than a single entry
+// under a channel-wide lock.
+class SessionCookieCache {
+ public:
+  // Returns the base64 decoding of \a encoded, allocated on the arena of
+  // the current call, or an empty string if it is not valid base64.
+  absl::string_view Decode(absl::string_view encoded);
+
+ private:
+  static constexpr size_t kNumShards = 16;
+  static constexpr size_t kEntriesPerShard = 4;
+
+  struct Entry {
+    std::string encoded;
+    std::string decoded;
+  };
+  struct Shard {
+    Mutex mu;
+    // Most recently used first.
+    std::list<Entry> entries ABSL_GUARDED_BY(mu);
+  };
+
+  Shard shards_[kNumShards];
+};
+
 class StatefulSessionFilter
     : public ImplementChannelFilter<StatefulSessionFilter> {
  public:
@@ -81,6 +113,9 @@ class StatefulSessionFilter
 
   explicit StatefulSessionFilter(ChannelFilter::Args filter_args);
 
+  // Calls whose route has no session cookie configured skip this filter.
+  bool IsActiveForCall(const grpc_call_element_args& args);
+
   class Call {
    public:
     void OnClientInitialMetadata(ClientMetadata& md,
@@ -106,6 +141,7 @@ class StatefulSessionFilter
   const size_t index_;
   // Index of the service config parser.
   const size_t service_config_parser_index_;
+  SessionCookieCache cookie_cache_;
 };
 
 }  // namespace grpc_core
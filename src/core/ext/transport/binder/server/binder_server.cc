@@ -210,10 +210,13 @@ class BinderServerListener : public Server::ListenerInterface {
       return absl::InvalidArgumentError("NULL binder read from the parcel");
     }
     client_binder->Initialize();
+    // Clients that predate the features field do not send it.
+    int32_t client_features = 0;
+    if (!parcel->ReadInt32(&client_features).ok()) client_features = 0;
     // Finish the second half of SETUP_TRANSPORT in
     // grpc_create_binder_transport_server().
     Transport* server_transport = grpc_create_binder_transport_server(
-        std::move(client_binder), security_policy_);
+        std::move(client_binder), security_policy_, client_features);
     CHECK(server_transport);
     grpc_error_handle error = server_->SetupTransport(
         server_transport, nullptr, server_->channel_args(), nullptr);
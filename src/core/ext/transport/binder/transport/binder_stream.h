@@ -30,7 +30,7 @@ struct RecvMessageArgs {
   grpc_binder_stream* stream;
   grpc_binder_transport* transport;
   int tx_code;
-  absl::StatusOr<std::string> message;
+  absl::StatusOr<grpc_core::SliceBuffer> message;
 };
 
 struct RecvTrailingMetadataArgs {
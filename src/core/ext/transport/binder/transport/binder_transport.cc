@@ -246,9 +246,7 @@ static void recv_message_locked(void* arg, grpc_error_handle /*error*/) {
           return absl_status_to_grpc_error(args->message.status());
         }
       }
-      grpc_core::SliceBuffer buf;
-      buf.Append(grpc_core::Slice(grpc_slice_from_cpp_string(*args->message)));
-      *stream->recv_message = std::move(buf);
+      *stream->recv_message = std::move(*args->message);
       return absl::OkStatus();
     }();
 
@@ -507,7 +505,8 @@ static void perform_stream_op_locked(void* stream_op,
     GRPC_BINDER_STREAM_REF(stream, "recv_message");
     transport->transport_stream_receiver->RegisterRecvMessage(
         tx_code,
-        [tx_code, stream, transport](absl::StatusOr<std::string> message) {
+        [tx_code, stream,
+         transport](absl::StatusOr<grpc_core::SliceBuffer> message) {
           grpc_core::ExecCtx exec_ctx;
           stream->recv_message_args.tx_code = tx_code;
           stream->recv_message_args.message = std::move(message);
@@ -694,7 +693,8 @@ size_t grpc_binder_transport::SizeOfStream() const {
 
 grpc_binder_transport::grpc_binder_transport(
     std::unique_ptr<grpc_binder::Binder> binder, bool is_client,
-    std::shared_ptr<grpc::experimental::binder::SecurityPolicy> security_policy)
+    std::shared_ptr<grpc::experimental::binder::SecurityPolicy> security_policy,
+    int32_t peer_features)
     : is_client(is_client),
       combiner(grpc_combiner_create(
           grpc_event_engine::experimental::GetDefaultEventEngine())),
@@ -719,7 +719,8 @@ grpc_binder_transport::grpc_binder_transport(
       [this] {
         // Unref transport when destructed.
         GRPC_BINDER_UNREF_TRANSPORT(this, "wire reader");
-      });
+      },
+      peer_features);
   wire_writer = wire_reader->SetupTransport(std::move(binder));
 }
 
@@ -745,14 +746,16 @@ grpc_core::Transport* grpc_create_binder_transport_client(
 grpc_core::Transport* grpc_create_binder_transport_server(
     std::unique_ptr<grpc_binder::Binder> client_binder,
     std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
-        security_policy) {
+        security_policy,
+    int32_t client_features) {
   LOG(INFO) << __func__;
 
   CHECK(client_binder != nullptr);
   CHECK_NE(security_policy, nullptr);
 
-  grpc_binder_transport* t = new grpc_binder_transport(
-      std::move(client_binder), /*is_client=*/false, security_policy);
+  grpc_binder_transport* t =
+      new grpc_binder_transport(std::move(client_binder), /*is_client=*/false,
+                                security_policy, client_features);
 
   return t;
 }
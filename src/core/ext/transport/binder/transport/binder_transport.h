@@ -46,7 +46,8 @@ struct grpc_binder_transport final : public grpc_core::FilterStackTransport {
   explicit grpc_binder_transport(
       std::unique_ptr<grpc_binder::Binder> binder, bool is_client,
       std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
-          security_policy);
+          security_policy,
+      int32_t peer_features = 0);
   ~grpc_binder_transport() override;
 
   grpc_core::FilterStackTransport* filter_stack_transport() override {
@@ -112,9 +113,12 @@ grpc_core::Transport* grpc_create_binder_transport_client(
     std::unique_ptr<grpc_binder::Binder> endpoint_binder,
     std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
         security_policy);
+// `client_features` are the features the client advertised in its
+// SETUP_TRANSPORT request.
 grpc_core::Transport* grpc_create_binder_transport_server(
     std::unique_ptr<grpc_binder::Binder> client_binder,
     std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
-        security_policy);
+        security_policy,
+    int32_t client_features = 0);
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_TRANSPORT_BINDER_TRANSPORT_H
@@ -41,6 +41,15 @@ void* GetNdkBinderHandle() {
   return handle;
 }
 
+void* GetNdkAndroidHandle() {
+  static void* handle = dlopen("libandroid.so", RTLD_LAZY);
+  if (handle == nullptr) {
+    LOG(ERROR) << "Cannot open libandroid.so.";
+    CHECK(0);
+  }
+  return handle;
+}
+
 JavaVM* g_jvm = nullptr;
 grpc_core::Mutex g_jvm_mu;
 
@@ -93,18 +102,23 @@ namespace grpc_binder {
 namespace ndk_util {
 
 // Helper macro to obtain the function pointer corresponding to the name
-#define FORWARD(name)                                                  \
-  typedef decltype(&name) func_type;                                   \
-  static func_type ptr =                                               \
-      reinterpret_cast<func_type>(dlsym(GetNdkBinderHandle(), #name)); \
-  if (ptr == nullptr) {                                                \
-    LOG(ERROR) << "dlsym failed. Cannot find " << #name                \
-               << " in libbinder_ndk.so. "                             \
-               << "BinderTransport requires API level >= 33";          \
-    CHECK(0);                                                          \
-  }                                                                    \
+#define FORWARD_FROM(handle, library, name)                          \
+  typedef decltype(&name) func_type;                                 \
+  static func_type ptr =                                             \
+      reinterpret_cast<func_type>(dlsym(handle, #name));             \
+  if (ptr == nullptr) {                                              \
+    LOG(ERROR) << "dlsym failed. Cannot find " << #name << " in "    \
+               << library << ". "                                    \
+               << "BinderTransport requires API level >= 33";        \
+    CHECK(0);                                                        \
+  }                                                                  \
   return ptr
 
+#define FORWARD(name) \
+  FORWARD_FROM(GetNdkBinderHandle(), "libbinder_ndk.so", name)
+#define FORWARD_ANDROID(name) \
+  FORWARD_FROM(GetNdkAndroidHandle(), "libandroid.so", name)
+
 void AIBinder_Class_disableInterfaceTokenHeader(AIBinder_Class* clazz) {
   FORWARD(AIBinder_Class_disableInterfaceTokenHeader)(clazz);
 }
@@ -212,6 +226,27 @@ jobject AIBinder_toJavaBinder(JNIEnv* env, AIBinder* binder) {
   FORWARD(AIBinder_toJavaBinder)(env, binder);
 }
 
+binder_status_t AParcel_writeParcelFileDescriptor(AParcel* parcel, int fd) {
+  FORWARD(AParcel_writeParcelFileDescriptor)(parcel, fd);
+}
+
+binder_status_t AParcel_readParcelFileDescriptor(const AParcel* parcel,
+                                                 int* fd) {
+  FORWARD(AParcel_readParcelFileDescriptor)(parcel, fd);
+}
+
+int ASharedMemory_create(const char* name, size_t size) {
+  FORWARD_ANDROID(ASharedMemory_create)(name, size);
+}
+
+size_t ASharedMemory_getSize(int fd) {
+  FORWARD_ANDROID(ASharedMemory_getSize)(fd);
+}
+
+int ASharedMemory_setProt(int fd, int prot) {
+  FORWARD_ANDROID(ASharedMemory_setProt)(fd, prot);
+}
+
 }  // namespace ndk_util
 }  // namespace grpc_binder
 
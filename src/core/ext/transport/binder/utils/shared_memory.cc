@@ -0,0 +1,110 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/binder/utils/shared_memory.h"
+
+#include <grpc/support/port_platform.h>
+
+#ifndef GRPC_NO_BINDER
+
+#include <utility>
+
+#include "absl/status/status.h"
+
+#ifdef GPR_SUPPORT_BINDER_TRANSPORT
+
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "src/core/ext/transport/binder/utils/ndk_binder.h"
+
+#endif  // GPR_SUPPORT_BINDER_TRANSPORT
+
+namespace grpc_binder {
+
+SharedMemoryRegion& SharedMemoryRegion::operator=(
+    SharedMemoryRegion&& other) noexcept {
+  std::swap(fd_, other.fd_);
+  std::swap(size_, other.size_);
+  return *this;
+}
+
+#ifdef GPR_SUPPORT_BINDER_TRANSPORT
+
+namespace {
+
+void Unmap(void* addr, size_t size) { munmap(addr, size); }
+
+}  // namespace
+
+bool SharedMemoryIsSupported() { return true; }
+
+absl::StatusOr<SharedMemoryRegion> SharedMemoryRegion::Create(
+    absl::string_view data) {
+  if (data.empty()) {
+    return absl::InvalidArgumentError("Empty shared memory region");
+  }
+  int fd = ndk_util::ASharedMemory_create("grpc-binder-message", data.size());
+  if (fd < 0) return absl::InternalError("ASharedMemory_create failed");
+  SharedMemoryRegion region(fd, data.size());
+  void* addr =
+      mmap(nullptr, data.size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED) return absl::InternalError("mmap failed");
+  memcpy(addr, data.data(), data.size());
+  munmap(addr, data.size());
+  // From now on the region can only be mapped read-only, so the peer sees
+  // exactly the data we copied.
+  if (ndk_util::ASharedMemory_setProt(fd, PROT_READ) != 0) {
+    return absl::InternalError("ASharedMemory_setProt failed");
+  }
+  return region;
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+  if (fd_ >= 0) close(fd_);
+}
+
+absl::StatusOr<grpc_core::Slice> MapSharedMemory(int fd, size_t size) {
+  SharedMemoryRegion region(fd, size);
+  if (size == 0 || ndk_util::ASharedMemory_getSize(fd) < size) {
+    return absl::InvalidArgumentError("Shared memory region is too small");
+  }
+  void* addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED) return absl::InternalError("mmap failed");
+  // The mapping outlives the file descriptor.
+  return grpc_core::Slice(grpc_slice_new_with_len(addr, size, Unmap));
+}
+
+#else  // GPR_SUPPORT_BINDER_TRANSPORT
+
+bool SharedMemoryIsSupported() { return false; }
+
+absl::StatusOr<SharedMemoryRegion> SharedMemoryRegion::Create(
+    absl::string_view /*data*/) {
+  return absl::UnimplementedError("Shared memory is not supported");
+}
+
+SharedMemoryRegion::~SharedMemoryRegion() {}
+
+absl::StatusOr<grpc_core::Slice> MapSharedMemory(int /*fd*/,
+                                                 size_t /*size*/) {
+  return absl::UnimplementedError("Shared memory is not supported");
+}
+
+#endif  // GPR_SUPPORT_BINDER_TRANSPORT
+
+}  // namespace grpc_binder
+
+#endif  // GRPC_NO_BINDER
@@ -0,0 +1,69 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_UTILS_SHARED_MEMORY_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_UTILS_SHARED_MEMORY_H
+
+#include <stddef.h>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_binder {
+
+// Shared memory regions (ashmem) used to pass large messages by file
+// descriptor instead of copying them into parcels. Only supported on Android.
+
+// Returns whether shared memory regions can be created and mapped.
+bool SharedMemoryIsSupported();
+
+// A shared memory region holding a copy of some data. Closes its file
+// descriptor when destroyed.
+class SharedMemoryRegion {
+ public:
+  // Creates a region holding \a data, which can no longer be written once
+  // this returns.
+  static absl::StatusOr<SharedMemoryRegion> Create(absl::string_view data);
+
+  SharedMemoryRegion(SharedMemoryRegion&& other) noexcept
+      : fd_(other.fd_), size_(other.size_) {
+    other.fd_ = -1;
+  }
+  SharedMemoryRegion& operator=(SharedMemoryRegion&& other) noexcept;
+  ~SharedMemoryRegion();
+
+  int fd() const { return fd_; }
+  size_t size() const { return size_; }
+
+ private:
+  friend absl::StatusOr<grpc_core::Slice> MapSharedMemory(int fd, size_t size);
+
+  SharedMemoryRegion(int fd, size_t size) : fd_(fd), size_(size) {}
+
+  int fd_;
+  size_t size_;
+};
+
+// Maps the first \a size bytes of the shared memory region \a fd read-only,
+// and returns them as a slice that unmaps them once released. Takes ownership
+// of \a fd.
+absl::StatusOr<grpc_core::Slice> MapSharedMemory(int fd, size_t size);
+
+}  // namespace grpc_binder
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_UTILS_SHARED_MEMORY_H
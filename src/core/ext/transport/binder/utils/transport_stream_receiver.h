@@ -24,6 +24,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/ext/transport/binder/wire_format/transaction.h"
+#include "src/core/lib/slice/slice_buffer.h"
 
 namespace grpc_binder {
 
@@ -36,7 +37,7 @@ class TransportStreamReceiver {
   using InitialMetadataCallbackType =
       std::function<void(absl::StatusOr<Metadata>)>;
   using MessageDataCallbackType =
-      std::function<void(absl::StatusOr<std::string>)>;
+      std::function<void(absl::StatusOr<grpc_core::SliceBuffer>)>;
   using TrailingMetadataCallbackType =
       std::function<void(absl::StatusOr<Metadata>, int)>;
 
@@ -55,8 +56,8 @@ class TransportStreamReceiver {
   // we should cancel the gRPC callback as well.
   virtual void NotifyRecvInitialMetadata(
       StreamIdentifier id, absl::StatusOr<Metadata> initial_metadata) = 0;
-  virtual void NotifyRecvMessage(StreamIdentifier id,
-                                 absl::StatusOr<std::string> message) = 0;
+  virtual void NotifyRecvMessage(
+      StreamIdentifier id, absl::StatusOr<grpc_core::SliceBuffer> message) = 0;
   virtual void NotifyRecvTrailingMetadata(
       StreamIdentifier id, absl::StatusOr<Metadata> trailing_metadata,
       int status) = 0;
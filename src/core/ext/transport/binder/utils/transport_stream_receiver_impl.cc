@@ -64,7 +64,7 @@ void TransportStreamReceiverImpl::RegisterRecvInitialMetadata(
 void TransportStreamReceiverImpl::RegisterRecvMessage(
     StreamIdentifier id, MessageDataCallbackType cb) {
   LOG(INFO) << __func__ << " id = " << id << " is_client = " << is_client_;
-  absl::StatusOr<std::string> message{};
+  absl::StatusOr<grpc_core::SliceBuffer> message{};
   {
     grpc_core::MutexLock l(&m_);
     CHECK_EQ(message_cbs_.count(id), 0u);
@@ -141,7 +141,7 @@ void TransportStreamReceiverImpl::NotifyRecvInitialMetadata(
 }
 
 void TransportStreamReceiverImpl::NotifyRecvMessage(
-    StreamIdentifier id, absl::StatusOr<std::string> message) {
+    StreamIdentifier id, absl::StatusOr<grpc_core::SliceBuffer> message) {
   LOG(INFO) << __func__ << " id = " << id << " is_client = " << is_client_;
   MessageDataCallbackType cb;
   {
@@ -44,8 +44,9 @@ class TransportStreamReceiverImpl : public TransportStreamReceiver {
                                     TrailingMetadataCallbackType cb) override;
   void NotifyRecvInitialMetadata(
       StreamIdentifier id, absl::StatusOr<Metadata> initial_metadata) override;
-  void NotifyRecvMessage(StreamIdentifier id,
-                         absl::StatusOr<std::string> message) override;
+  void NotifyRecvMessage(
+      StreamIdentifier id,
+      absl::StatusOr<grpc_core::SliceBuffer> message) override;
   void NotifyRecvTrailingMetadata(StreamIdentifier id,
                                   absl::StatusOr<Metadata> trailing_metadata,
                                   int status) override;
@@ -88,7 +89,8 @@ class TransportStreamReceiverImpl : public TransportStreamReceiver {
   // TODO(waynetu): Use absl::flat_hash_map.
   std::map<StreamIdentifier, std::queue<absl::StatusOr<Metadata>>>
       pending_initial_metadata_ ABSL_GUARDED_BY(m_);
-  std::map<StreamIdentifier, std::queue<absl::StatusOr<std::string>>>
+  std::map<StreamIdentifier,
+           std::queue<absl::StatusOr<grpc_core::SliceBuffer>>>
       pending_message_ ABSL_GUARDED_BY(m_);
   std::map<StreamIdentifier,
            std::queue<std::pair<absl::StatusOr<Metadata>, int>>>
@@ -38,6 +38,12 @@ enum class BinderTransportTxCode : int32_t {
 
 ABSL_CONST_INIT extern const int kFirstCallId;
 
+// Bits of the optional int32 that follows the binder in SETUP_TRANSPORT, and
+// advertises the extensions of the wire format that its sender can read.
+// Peers that do not send it support none of them.
+// The sender can map message data passed as shared memory regions.
+ABSL_CONST_INIT extern const int32_t kSetupTransportFeatureSharedMemory;
+
 }  // namespace grpc_binder
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_WIRE_FORMAT_BINDER_CONSTANTS_H
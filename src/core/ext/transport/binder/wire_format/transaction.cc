@@ -28,6 +28,9 @@ ABSL_CONST_INIT const int kFlagExpectSingleMessage = 0x10;
 ABSL_CONST_INIT const int kFlagStatusDescription = 0x20;
 ABSL_CONST_INIT const int kFlagMessageDataIsParcelable = 0x40;
 ABSL_CONST_INIT const int kFlagMessageDataIsPartial = 0x80;
+// Not part of the BinderChannel wire format: only sent to peers that
+// advertise kSetupTransportFeatureSharedMemory.
+ABSL_CONST_INIT const int kFlagMessageDataIsSharedMemory = 0x100;
 
 }  // namespace grpc_binder
 #endif
@@ -36,6 +36,7 @@ ABSL_CONST_INIT extern const int kFlagExpectSingleMessage;
 ABSL_CONST_INIT extern const int kFlagStatusDescription;
 ABSL_CONST_INIT extern const int kFlagMessageDataIsParcelable;
 ABSL_CONST_INIT extern const int kFlagMessageDataIsPartial;
+ABSL_CONST_INIT extern const int kFlagMessageDataIsSharedMemory;
 
 using Metadata = std::vector<std::pair<std::string, std::string>>;
 
@@ -30,11 +30,14 @@
 #include "absl/memory/memory.h"
 #include "absl/status/statusor.h"
 
+#include "src/core/ext/transport/binder/utils/shared_memory.h"
 #include "src/core/ext/transport/binder/utils/transport_stream_receiver.h"
 #include "src/core/ext/transport/binder/wire_format/binder.h"
 #include "src/core/ext/transport/binder/wire_format/wire_writer.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
 
 namespace grpc_binder {
 namespace {
@@ -68,12 +71,22 @@ WireReaderImpl::WireReaderImpl(
     std::shared_ptr<TransportStreamReceiver> transport_stream_receiver,
     bool is_client,
     std::shared_ptr<grpc::experimental::binder::SecurityPolicy> security_policy,
-    std::function<void()> on_destruct_callback)
+    std::function<void()> on_destruct_callback, int32_t peer_features)
     : transport_stream_receiver_(std::move(transport_stream_receiver)),
+      peer_features_(peer_features),
       is_client_(is_client),
       security_policy_(security_policy),
       on_destruct_callback_(on_destruct_callback) {}
 
+int32_t WireReaderImpl::LocalFeatures() {
+  return SharedMemoryIsSupported() ? kSetupTransportFeatureSharedMemory : 0;
+}
+
+bool WireReaderImpl::PeerAcceptsSharedMemory() const {
+  return SharedMemoryIsSupported() &&
+         (peer_features_ & kSetupTransportFeatureSharedMemory) != 0;
+}
+
 WireReaderImpl::~WireReaderImpl() {
   if (on_destruct_callback_) {
     on_destruct_callback_();
@@ -87,7 +100,8 @@ std::shared_ptr<WireWriter> WireReaderImpl::SetupTransport(
     SendSetupTransport(binder.get());
     {
       grpc_core::MutexLock lock(&mu_);
-      wire_writer_ = std::make_shared<WireWriterImpl>(std::move(binder));
+      wire_writer_ = std::make_shared<WireWriterImpl>(
+          std::move(binder), PeerAcceptsSharedMemory());
     }
     wire_writer_ready_notification_.Notify();
     return wire_writer_;
@@ -97,8 +111,8 @@ std::shared_ptr<WireWriter> WireReaderImpl::SetupTransport(
     {
       grpc_core::MutexLock lock(&mu_);
       connected_ = true;
-      wire_writer_ =
-          std::make_shared<WireWriterImpl>(std::move(other_end_binder));
+      wire_writer_ = std::make_shared<WireWriterImpl>(
+          std::move(other_end_binder), PeerAcceptsSharedMemory());
     }
     wire_writer_ready_notification_.Notify();
     return wire_writer_;
@@ -130,6 +144,9 @@ void WireReaderImpl::SendSetupTransport(Binder* binder) {
   const absl::Status write_binder_status =
       writable_parcel->WriteBinder(tx_receiver_.get());
   VLOG(2) << "AParcel_writeStrongBinder = " << write_binder_status;
+  const absl::Status write_features_status =
+      writable_parcel->WriteInt32(LocalFeatures());
+  VLOG(2) << "write features = " << write_features_status;
   const absl::Status transact_status =
       binder->Transact(BinderTransportTxCode::SETUP_TRANSPORT);
   VLOG(2) << "AIBinder_transact = " << transact_status;
@@ -207,6 +224,9 @@ absl::Status WireReaderImpl::ProcessTransaction(transaction_code_t code,
       }
       binder->Initialize();
       other_end_binder_ = std::move(binder);
+      // Peers that predate the features field do not send it.
+      if (!parcel->ReadInt32(&peer_features_).ok()) peer_features_ = 0;
+      VLOG(2) << "The other end supports features = " << peer_features_;
       connection_noti_.Notify();
       break;
     }
@@ -406,17 +426,39 @@ absl::Status WireReaderImpl::ProcessStreamingTransactionImpl(
     int count;
     GRPC_RETURN_IF_ERROR(parcel->ReadInt32(&count));
     VLOG(2) << "count = " << count;
-    std::string msg_data{};
-    if (count > 0) {
+    if (flags & kFlagMessageDataIsSharedMemory) {
+      if ((LocalFeatures() & kSetupTransportFeatureSharedMemory) == 0) {
+        return absl::InvalidArgumentError(
+            "Unexpected shared memory message data");
+      }
+      if (count <= 0) {
+        return absl::InvalidArgumentError("Empty shared memory message data");
+      }
+      int fd = -1;
+      GRPC_RETURN_IF_ERROR(parcel->ReadFileDescriptor(&fd));
+      auto slice = MapSharedMemory(fd, count);
+      GRPC_RETURN_IF_ERROR(slice.status());
+      // Count the region for flow control, as the writer does, so that it
+      // keeps bounding the memory in flight.
+      num_incoming_bytes_ += count;
+      message_buffer_[code].Append(std::move(*slice));
+    } else if (count > 0) {
+      std::string msg_data{};
       GRPC_RETURN_IF_ERROR(parcel->ReadByteArray(&msg_data));
+      message_buffer_[code].Append(
+          grpc_core::Slice(grpc_slice_from_cpp_string(std::move(msg_data))));
+    } else {
+      // Make sure an empty message is still delivered.
+      message_buffer_[code];
     }
-    message_buffer_[code] += msg_data;
     if ((flags & kFlagMessageDataIsPartial) == 0) {
-      std::string s = std::move(message_buffer_[code]);
+      grpc_core::SliceBuffer message = std::move(message_buffer_[code]);
       message_buffer_.erase(code);
-      deferred_func_queue.emplace([this, code, s = std::move(s)]() mutable {
-        this->transport_stream_receiver_->NotifyRecvMessage(code, std::move(s));
-      });
+      deferred_func_queue.emplace(
+          [this, code, message = std::move(message)]() mutable {
+            this->transport_stream_receiver_->NotifyRecvMessage(
+                code, std::move(message));
+          });
     }
     *cancellation_flags &= ~kFlagMessageData;
   }
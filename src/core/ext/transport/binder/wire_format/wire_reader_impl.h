@@ -15,6 +15,8 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_WIRE_FORMAT_WIRE_READER_IMPL_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_BINDER_WIRE_FORMAT_WIRE_READER_IMPL_H
 
+#include <stdint.h>
+
 #include <memory>
 #include <queue>
 #include <utility>
@@ -30,6 +32,7 @@
 #include "src/core/ext/transport/binder/wire_format/wire_reader.h"
 #include "src/core/ext/transport/binder/wire_format/wire_writer.h"
 #include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/slice/slice_buffer.h"
 
 namespace grpc_binder {
 
@@ -40,7 +43,10 @@ class WireReaderImpl : public WireReader {
       bool is_client,
       std::shared_ptr<grpc::experimental::binder::SecurityPolicy>
           security_policy,
-      std::function<void()> on_destruct_callback = nullptr);
+      std::function<void()> on_destruct_callback = nullptr,
+      // Features the peer advertised, for a server whose SETUP_TRANSPORT
+      // request was already received. Clients read them from the response.
+      int32_t peer_features = 0);
   ~WireReaderImpl() override;
 
   void Orphan() override { Unref(); }
@@ -98,6 +104,11 @@ class WireReaderImpl : public WireReader {
   std::unique_ptr<Binder> RecvSetupTransport();
 
  private:
+  // Features advertised in our SETUP_TRANSPORT.
+  static int32_t LocalFeatures();
+  // Whether messages can be sent to the peer in shared memory regions.
+  bool PeerAcceptsSharedMemory() const;
+
   absl::Status ProcessStreamingTransaction(transaction_code_t code,
                                            ReadableParcel* parcel);
   absl::Status ProcessStreamingTransactionImpl(
@@ -115,10 +126,13 @@ class WireReaderImpl : public WireReader {
   // NOTE: other_end_binder_ will be moved out when RecvSetupTransport() is
   // called. Be cautious not to access it afterward.
   std::unique_ptr<Binder> other_end_binder_;
+  // Features the other end advertised in its SETUP_TRANSPORT. Written before
+  // connection_noti_ is notified on clients.
+  int32_t peer_features_ = 0;
   absl::flat_hash_map<transaction_code_t, int32_t> expected_seq_num_
       ABSL_GUARDED_BY(mu_);
-  absl::flat_hash_map<transaction_code_t, std::string> message_buffer_
-      ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<transaction_code_t, grpc_core::SliceBuffer>
+      message_buffer_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<TransactionReceiver> tx_receiver_;
   bool is_client_;
   std::shared_ptr<grpc::experimental::binder::SecurityPolicy> security_policy_;
@@ -83,8 +83,10 @@ absl::Status WriteTrailingMetadata(const Transaction& tx,
   return absl::OkStatus();
 }
 
-WireWriterImpl::WireWriterImpl(std::unique_ptr<Binder> binder)
+WireWriterImpl::WireWriterImpl(std::unique_ptr<Binder> binder,
+                               bool use_shared_memory)
     : binder_(std::move(binder)),
+      use_shared_memory_(use_shared_memory),
       combiner_(grpc_combiner_create(
           grpc_event_engine::experimental::GetDefaultEventEngine())) {}
 
@@ -100,6 +102,13 @@ WireWriterImpl::~WireWriterImpl() {
 // https://github.com/grpc/proposal/blob/master/L73-java-binderchannel/wireformat.md#flow-control
 const int64_t WireWriterImpl::kBlockSize = 16 * 1024;
 const int64_t WireWriterImpl::kFlowControlWindowSize = 128 * 1024;
+const int64_t WireWriterImpl::kSharedMemoryThreshold = 4 * kBlockSize;
+
+bool WireWriterImpl::ShouldUseSharedMemory(const Transaction& tx) const {
+  return use_shared_memory_ && (tx.GetFlags() & kFlagMessageData) &&
+         static_cast<int64_t>(tx.GetMessageData().size()) >=
+             kSharedMemoryThreshold;
+}
 
 absl::Status WireWriterImpl::MakeBinderTransaction(
     BinderTransportTxCode tx_code,
@@ -127,17 +136,27 @@ absl::Status WireWriterImpl::MakeBinderTransaction(
   return result;
 }
 
-absl::Status WireWriterImpl::RpcCallFastPath(std::unique_ptr<Transaction> tx) {
+absl::Status WireWriterImpl::RpcCallFastPath(std::unique_ptr<Transaction> tx,
+                                             const SharedMemoryRegion* region) {
   return MakeBinderTransaction(
       static_cast<BinderTransportTxCode>(tx->GetTxCode()),
-      [this, tx = tx.get()](
+      [this, tx = tx.get(), region](
           WritableParcel* parcel) ABSL_EXCLUSIVE_LOCKS_REQUIRED(write_mu_) {
-        RETURN_IF_ERROR(parcel->WriteInt32(tx->GetFlags()));
+        int flags = tx->GetFlags();
+        if (region != nullptr) flags |= kFlagMessageDataIsSharedMemory;
+        RETURN_IF_ERROR(parcel->WriteInt32(flags));
         RETURN_IF_ERROR(parcel->WriteInt32(next_seq_num_[tx->GetTxCode()]++));
         if (tx->GetFlags() & kFlagPrefix) {
           RETURN_IF_ERROR(WriteInitialMetadata(*tx, parcel));
         }
-        if (tx->GetFlags() & kFlagMessageData) {
+        if (region != nullptr) {
+          RETURN_IF_ERROR(
+              parcel->WriteInt32(static_cast<int32_t>(region->size())));
+          RETURN_IF_ERROR(parcel->WriteFileDescriptor(region->fd()));
+          // The region does not use the binder buffer, but is still counted
+          // so that flow control bounds the memory the other end holds.
+          num_outgoing_bytes_ += region->size();
+        } else if (tx->GetFlags() & kFlagMessageData) {
           RETURN_IF_ERROR(
               parcel->WriteByteArrayWithLength(tx->GetMessageData()));
         }
@@ -235,6 +254,23 @@ void WireWriterImpl::RunScheduledTxInternal(RunScheduledTxArgs* args) {
     // New transaction might be ready to be scheduled.
     TryScheduleTransaction();
   });
+  if (stream_tx->bytes_sent == 0 && ShouldUseSharedMemory(*stream_tx->tx)) {
+    auto region =
+        SharedMemoryRegion::Create(stream_tx->tx->GetMessageData());
+    if (region.ok()) {
+      // The parcel holds its own copy of the file descriptor, so the region
+      // can be closed once the transaction is sent.
+      absl::Status result = RpcCallFastPath(std::move(stream_tx->tx), &*region);
+      if (!result.ok()) {
+        LOG(ERROR) << "Failed to send shared memory RPC call " << result;
+      }
+      delete args;
+      return;
+    }
+    LOG(ERROR) << "Failed to create shared memory region, sending message in "
+                  "chunks: "
+               << region.status();
+  }
   if (CanBeSentInOneTransaction(*stream_tx->tx.get())) {  // NOLINT
     absl::Status result = RpcCallFastPath(std::move(stream_tx->tx));
     if (!result.ok()) {
@@ -23,6 +23,7 @@
 
 #include <grpc/support/port_platform.h>
 
+#include "src/core/ext/transport/binder/utils/shared_memory.h"
 #include "src/core/ext/transport/binder/wire_format/binder.h"
 #include "src/core/ext/transport/binder/wire_format/transaction.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -41,7 +42,11 @@ class WireWriter {
 
 class WireWriterImpl : public WireWriter {
  public:
-  explicit WireWriterImpl(std::unique_ptr<Binder> binder);
+  // If `use_shared_memory` is true, which requires the other end to have
+  // advertised kSetupTransportFeatureSharedMemory, large messages are sent in
+  // shared memory regions instead of being split into chunks.
+  explicit WireWriterImpl(std::unique_ptr<Binder> binder,
+                          bool use_shared_memory = false);
   ~WireWriterImpl() override;
   absl::Status RpcCall(std::unique_ptr<Transaction> tx) override;
   absl::Status SendAck(int64_t num_bytes) override;
@@ -73,9 +78,19 @@ class WireWriterImpl : public WireWriter {
   // Flow control allows sending at most 128k between acknowledgements.
   static const int64_t kFlowControlWindowSize;
 
+  // Messages at least this large are sent in a shared memory region when the
+  // other end supports it.
+  static const int64_t kSharedMemoryThreshold;
+
  private:
   // Fast path: send data in one transaction.
-  absl::Status RpcCallFastPath(std::unique_ptr<Transaction> tx);
+  // If `region` is not null, it holds the message data and is sent in place
+  // of it.
+  absl::Status RpcCallFastPath(std::unique_ptr<Transaction> tx,
+                               const SharedMemoryRegion* region = nullptr);
+
+  // Whether the message data of `tx` should be sent in a shared memory region.
+  bool ShouldUseSharedMemory(const Transaction& tx) const;
 
   // This function will acquire `write_mu_` to make sure the binder is not used
   // concurrently, so this can be called by different threads safely.
@@ -119,6 +134,8 @@ class WireWriterImpl : public WireWriter {
   // `write_mu_` multiple times on the same thread.
   std::atomic_bool is_transacting_{false};
 
+  const bool use_shared_memory_;
+
   grpc_core::Combiner* combiner_;
 };
 
@@ -15,11 +15,15 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CHAOTIC_GOOD_TRANSPORT_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CHAOTIC_GOOD_TRANSPORT_H
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
+#include <vector>
 
+#include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpc/support/port_platform.h>
 
@@ -28,8 +32,14 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/if.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/mpsc.h"
+#include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/promise.h"
+#include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/try_join.h"
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/transport/promise_endpoint.h"
@@ -37,34 +47,94 @@
 namespace grpc_core {
 namespace chaotic_good {
 
+// Wraps the data endpoint of a transport that does not stripe messages.
+inline std::vector<PromiseEndpoint> OneDataEndpoint(PromiseEndpoint endpoint) {
+  std::vector<PromiseEndpoint> data_endpoints;
+  data_endpoints.push_back(std::move(endpoint));
+  return data_endpoints;
+}
+
 class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
  public:
+  struct Options {
+    // When the recent writes carried the frames of several streams, let the
+    // streams run once more before each write, so that the frames they are
+    // about to send go out in the same write. See NextFrames().
+    bool write_coalescing_delay = false;
+    // Keep a read outstanding on the control endpoint between frames. See
+    // PromiseEndpoint::EnableReadAhead().
+    bool control_read_ahead = false;
+  };
+
   ChaoticGoodTransport(PromiseEndpoint control_endpoint,
-                       PromiseEndpoint data_endpoint, HPackParser hpack_parser,
-                       HPackCompressor hpack_encoder)
+                       std::vector<PromiseEndpoint> data_endpoints,
+                       HPackParser hpack_parser, HPackCompressor hpack_encoder,
+                       Options options)
       : control_endpoint_(std::move(control_endpoint)),
-        data_endpoint_(std::move(data_endpoint)),
         encoder_(std::move(hpack_encoder)),
-        parser_(std::move(hpack_parser)) {
-    // Enable RxMemoryAlignment and RPC receive coalescing after the transport
-    // setup is complete. At this point all the settings frames should have
-    // been read.
-    data_endpoint_.EnforceRxMemoryAlignmentAndCoalescing();
+        parser_(std::move(hpack_parser)),
+        options_(options) {
+    CHECK(!data_endpoints.empty());
+    CHECK_LE(data_endpoints.size(), FrameHeader::kMaxDataConnections);
+    if (options_.control_read_ahead) control_endpoint_.EnableReadAhead();
+    data_endpoints_.reserve(data_endpoints.size());
+    for (auto& data_endpoint : data_endpoints) {
+      // Enable RxMemoryAlignment and RPC receive coalescing after the
+      // transport setup is complete. At this point all the settings frames
+      // should have been read.
+      data_endpoint.EnforceRxMemoryAlignmentAndCoalescing();
+      data_endpoints_.emplace_back(std::move(data_endpoint));
+    }
   }
 
-  auto WriteFrame(const FrameInterface& frame) {
-    bool saw_encoding_errors = false;
-    auto buffers = frame.Serialize(&encoder_, saw_encoding_errors);
-    // ignore encoding errors: they will be logged separately already
-    if (GRPC_TRACE_FLAG_ENABLED(chaotic_good)) {
-      LOG(INFO) << "CHAOTIC_GOOD: WriteFrame to:"
-                << ResolvedAddressToString(control_endpoint_.GetPeerAddress())
-                       .value_or("<<unknown peer address>>")
-                << " " << frame.ToString();
+  // Resolves to all the frames queued in \a outgoing_frames, once there is at
+  // least one.
+  //
+  // With the write coalescing delay enabled, and while the recent writes
+  // carried several frames each, the writer yields once before taking the
+  // frames: it schedules itself to run again on the event engine instead of
+  // writing right away, so that the streams that are ready to run get to
+  // queue their frames first. The delay is one scheduling round rather than a
+  // timer, and it stops as soon as the writes go back to about one frame each.
+  template <typename Frame>
+  auto NextFrames(MpscReceiver<Frame>& outgoing_frames) {
+    return Seq(
+        outgoing_frames.NextBatch(),
+        [this, &outgoing_frames](std::vector<Frame> frames) {
+          bool delay = options_.write_coalescing_delay &&
+                             frames_per_write_ >= kCoalescingFramesPerWrite;
+          return [this, &outgoing_frames, frames = std::move(frames),
+                  delay]() mutable -> Poll<std::vector<Frame>> {
+            if (std::exchange(delay, false)) {
+              GetContext<Activity>()->MakeOwningWaker().WakeupAsync();
+              return Pending{};
+            }
+            auto more = outgoing_frames.NextBatch()();
+            if (auto* more_frames = more.value_if_ready()) {
+              for (Frame& frame : *more_frames) {
+                frames.push_back(std::move(frame));
+              }
+            }
+            frames_per_write_ =
+                (1 - kFramesPerWriteWeight) * frames_per_write_ +
+                kFramesPerWriteWeight * frames.size();
+            return std::move(frames);
+          };
+        });
+  }
+
+  // Writes \a frames with one write to the control endpoint and at most one
+  // to a data endpoint. Resolves to absl::Status once the frames are
+  // written, or, when messages are striped over several data endpoints, once
+  // their message write is started.
+  template <typename Frame>
+  auto WriteFrames(std::vector<Frame> frames) {
+    OutgoingBatch batch;
+    batch.control.reserve(frames.size());
+    for (Frame& frame : frames) {
+      AddFrameToBatch(GetFrameInterface(frame), batch);
     }
-    return TryJoin<absl::StatusOr>(
-        control_endpoint_.Write(std::move(buffers.control)),
-        data_endpoint_.Write(std::move(buffers.data)));
+    return WriteBatch(std::move(batch));
   }
 
   // Read frame header and payloads for control and data portions of one frame.
@@ -85,6 +155,12 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
                       << (frame_header.ok() ? frame_header->ToString()
                                             : frame_header.status().ToString());
           }
+          if (frame_header.ok() &&
+              frame_header->data_connection >= data_endpoints_.size()) {
+            frame_header = absl::InternalError(absl::StrCat(
+                "Frame for data connection ", frame_header->data_connection,
+                " of ", data_endpoints_.size()));
+          }
           // Read header and trailers from control endpoint.
           // Read message padding and message from data endpoint.
           return If(
@@ -95,7 +171,8 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
                 return Map(
                     TryJoin<absl::StatusOr>(
                         control_endpoint_.Read(frame_header->GetFrameLength()),
-                        data_endpoint_.Read(message_length + message_padding)),
+                        data_endpoints_[frame_header->data_connection]
+                            .endpoint.Read(message_length + message_padding)),
                     [frame_header = *frame_header, message_padding](
                         absl::StatusOr<std::tuple<SliceBuffer, SliceBuffer>>
                             buffers)
@@ -133,11 +210,126 @@ class ChaoticGoodTransport : public RefCounted<ChaoticGoodTransport> {
   }
 
  private:
+  struct DataEndpoint {
+    explicit DataEndpoint(PromiseEndpoint endpoint)
+        : endpoint(std::move(endpoint)) {}
+    PromiseEndpoint endpoint;
+    // The write in flight on this endpoint, if any.
+    Promise<absl::Status> write;
+  };
+
+  // Frames serialized to go out together.
+  struct OutgoingBatch {
+    // The control bytes of each frame, kept apart until the data connection
+    // is set in the frame headers.
+    std::vector<SliceBuffer> control;
+    // Indices in control of the frames that carry a message.
+    std::vector<size_t> frames_with_data;
+    SliceBuffer data;
+  };
+
+  // Below this many frames per write on average, there is too little
+  // concurrency for the write coalescing delay to pay off.
+  static constexpr double kCoalescingFramesPerWrite = 2;
+  // Weight of the latest write in the frames per write average.
+  static constexpr double kFramesPerWriteWeight = 0.125;
+
+  void AddFrameToBatch(const FrameInterface& frame, OutgoingBatch& batch) {
+    bool saw_encoding_errors = false;
+    auto buffers = frame.Serialize(&encoder_, saw_encoding_errors);
+    // ignore encoding errors: they will be logged separately already
+    if (GRPC_TRACE_FLAG_ENABLED(chaotic_good)) {
+      LOG(INFO) << "CHAOTIC_GOOD: WriteFrame to:"
+                << ResolvedAddressToString(control_endpoint_.GetPeerAddress())
+                       .value_or("<<unknown peer address>>")
+                << " " << frame.ToString();
+    }
+    if (buffers.data.Length() != 0) {
+      batch.frames_with_data.push_back(batch.control.size());
+      batch.data.TakeAndAppend(buffers.data);
+    }
+    batch.control.push_back(std::move(buffers.control));
+  }
+
+  static SliceBuffer JoinControl(OutgoingBatch& batch) {
+    SliceBuffer control = std::move(batch.control[0]);
+    for (size_t i = 1; i < batch.control.size(); ++i) {
+      control.TakeAndAppend(batch.control[i]);
+    }
+    return control;
+  }
+
+  auto WriteBatch(OutgoingBatch batch) {
+    return If(
+        data_endpoints_.size() == 1,
+        [this, &batch]() {
+          return Map(TryJoin<absl::StatusOr>(
+                         control_endpoint_.Write(JoinControl(batch)),
+                         data_endpoints_[0].endpoint.Write(
+                             std::move(batch.data))),
+                     [](auto result) { return result.status(); });
+        },
+        // The messages of each batch go to the next data endpoint without a
+        // write in flight, and only while every data endpoint is busy does
+        // the batch wait. Message writes are not waited for, so that one can
+        // be in flight on each data endpoint at once; the reader follows the
+        // data connection index in the frame headers.
+        [this, &batch]() {
+          return TrySeq(
+              [this, batch = std::move(batch)]() mutable
+              -> Poll<absl::StatusOr<SliceBuffer>> {
+                absl::Status status = PollDataWrites();
+                if (!status.ok()) return status;
+                if (batch.data.Length() == 0) return JoinControl(batch);
+                const size_t n = data_endpoints_.size();
+                for (size_t i = 0; i < n; ++i) {
+                  const size_t index = (next_data_endpoint_ + i) % n;
+                  DataEndpoint& data_endpoint = data_endpoints_[index];
+                  if (data_endpoint.write != nullptr) continue;
+                  next_data_endpoint_ = (index + 1) % n;
+                  for (size_t frame : batch.frames_with_data) {
+                    FrameHeader::SetDataConnection(
+                        static_cast<uint8_t>(index),
+                        GRPC_SLICE_START_PTR(
+                            batch.control[frame].c_slice_buffer()->slices[0]));
+                  }
+                  data_endpoint.write =
+                      data_endpoint.endpoint.Write(std::move(batch.data));
+                  status = PollDataWrites();
+                  if (!status.ok()) return status;
+                  return JoinControl(batch);
+                }
+                return Pending{};
+              },
+              [this](SliceBuffer control) {
+                return control_endpoint_.Write(std::move(control));
+              });
+        });
+  }
+
+
+  // Polls the message writes in flight, and returns the first error.
+  absl::Status PollDataWrites() {
+    for (DataEndpoint& data_endpoint : data_endpoints_) {
+      if (data_endpoint.write == nullptr) continue;
+      auto poll = data_endpoint.write();
+      absl::Status* status = poll.value_if_ready();
+      if (status == nullptr) continue;
+      data_endpoint.write = nullptr;
+      if (!status->ok()) return std::move(*status);
+    }
+    return absl::OkStatus();
+  }
+
   PromiseEndpoint control_endpoint_;
-  PromiseEndpoint data_endpoint_;
+  std::vector<DataEndpoint> data_endpoints_;
+  size_t next_data_endpoint_ = 0;
   HPackCompressor encoder_;
   HPackParser parser_;
   absl::BitGen bitgen_;
+  const Options options_;
+  // Moving average of the number of frames per write.
+  double frames_per_write_ = 0;
 };
 
 }  // namespace chaotic_good
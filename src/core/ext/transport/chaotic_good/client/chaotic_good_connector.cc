@@ -14,6 +14,8 @@
 
 #include "src/core/ext/transport/chaotic_good/client/chaotic_good_connector.h"
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -23,8 +25,10 @@
 #include "absl/random/bit_gen_ref.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/port_platform.h>
 
 #include "src/core/client_channel/client_channel_factory.h"
@@ -53,6 +57,7 @@
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/event_engine_wakeup_scheduler.h"
 #include "src/core/lib/promise/latch.h"
+#include "src/core/lib/promise/loop.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/sleep.h"
 #include "src/core/lib/promise/try_seq.h"
@@ -66,6 +71,7 @@
 #include "src/core/lib/surface/channel_create.h"
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/promise_endpoint.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 namespace chaotic_good {
@@ -73,6 +79,11 @@ using grpc_event_engine::experimental::EventEngine;
 namespace {
 const int32_t kDataAlignmentBytes = 64;
 const int32_t kTimeoutSecs = 120;
+
+uint32_t RequestedDataConnections(const ChannelArgs& args) {
+  return Clamp(args.GetInt(GRPC_ARG_CHAOTIC_GOOD_DATA_CONNECTIONS).value_or(1),
+               1, static_cast<int>(FrameHeader::kMaxDataConnections));
+}
 }  // namespace
 
 ChaoticGoodConnector::ChaoticGoodConnector(
@@ -91,10 +102,10 @@ ChaoticGoodConnector::~ChaoticGoodConnector() {
 }
 
 auto ChaoticGoodConnector::DataEndpointReadSettingsFrame(
-    RefCountedPtr<ChaoticGoodConnector> self) {
+    RefCountedPtr<ChaoticGoodConnector> self, size_t index) {
   return TrySeq(
-      self->data_endpoint_.ReadSlice(FrameHeader::kFrameHeaderSize),
-      [self](Slice slice) mutable {
+      self->data_endpoints_[index].ReadSlice(FrameHeader::kFrameHeaderSize),
+      [self, index](Slice slice) mutable {
         // Read setting frame;
         // Parse frame header
         auto frame_header_ =
@@ -102,70 +113,95 @@ auto ChaoticGoodConnector::DataEndpointReadSettingsFrame(
                 GRPC_SLICE_START_PTR(slice.c_slice())));
         return If(
             frame_header_.ok(),
-            [frame_header_ = *frame_header_, self]() {
+            [frame_header_ = *frame_header_, self, index]() {
               auto frame_header_length = frame_header_.GetFrameLength();
-              return TrySeq(self->data_endpoint_.Read(frame_header_length),
-                            []() { return absl::OkStatus(); });
+              return TrySeq(
+                  self->data_endpoints_[index].Read(frame_header_length),
+                  []() { return absl::OkStatus(); });
             },
             [status = frame_header_.status()]() { return status; });
       });
 }
 
 auto ChaoticGoodConnector::DataEndpointWriteSettingsFrame(
-    RefCountedPtr<ChaoticGoodConnector> self) {
+    RefCountedPtr<ChaoticGoodConnector> self, size_t index) {
   // Serialize setting frame.
   SettingsFrame frame;
   // frame.header set connectiion_type: control
-  frame.headers = SettingsMetadata{SettingsMetadata::ConnectionType::kData,
-                                   self->connection_id_, kDataAlignmentBytes}
-                      .ToMetadataBatch();
+  SettingsMetadata settings{SettingsMetadata::ConnectionType::kData,
+                            self->connection_id_, kDataAlignmentBytes};
+  // Servers that do not stripe messages do not expect a data connection index.
+  if (self->data_endpoints_.size() > 1) {
+    settings.data_connection_index = index;
+  }
+  frame.headers = settings.ToMetadataBatch();
   bool saw_encoding_errors = false;
   auto write_buffer =
       frame.Serialize(&self->hpack_compressor_, saw_encoding_errors);
   // ignore encoding errors: they will be logged separately already
-  return self->data_endpoint_.Write(std::move(write_buffer.control));
+  return self->data_endpoints_[index].Write(std::move(write_buffer.control));
 }
 
 auto ChaoticGoodConnector::WaitForDataEndpointSetup(
     RefCountedPtr<ChaoticGoodConnector> self) {
-  // Data endpoint on_connect callback.
-  grpc_event_engine::experimental::EventEngine::OnConnectCallback
-      on_data_endpoint_connect =
-          [self](absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
-                     endpoint) mutable {
-            ExecCtx exec_ctx;
-            if (!endpoint.ok() || self->handshake_mgr_ == nullptr) {
-              ExecCtx::Run(DEBUG_LOCATION,
-                           std::exchange(self->notify_, nullptr),
-                           GRPC_ERROR_CREATE("connect endpoint failed"));
-              return;
-            }
-            auto* chaotic_good_ext =
-                grpc_event_engine::experimental::QueryExtension<
-                    grpc_event_engine::experimental::ChaoticGoodExtension>(
-                    endpoint.value().get());
-            if (chaotic_good_ext != nullptr) {
-              chaotic_good_ext->EnableStatsCollection(
-                  /*is_control_channel=*/false);
-            }
-            self->data_endpoint_ =
-                PromiseEndpoint(std::move(endpoint.value()), SliceBuffer());
-            self->data_endpoint_ready_.Set();
-          };
-  self->event_engine_->Connect(
-      std::move(on_data_endpoint_connect), *self->resolved_addr_,
-      grpc_event_engine::experimental::ChannelArgsEndpointConfig(
-          self->args_.channel_args),
-      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
-          "data_endpoint_connection"),
-      std::chrono::seconds(kTimeoutSecs));
+  // Connect all the data endpoints at once.
+  self->pending_data_endpoints_.store(self->data_endpoints_.size(),
+                                      std::memory_order_relaxed);
+  for (size_t index = 0; index < self->data_endpoints_.size(); ++index) {
+    // Data endpoint on_connect callback.
+    grpc_event_engine::experimental::EventEngine::OnConnectCallback
+        on_data_endpoint_connect =
+            [self, index](absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
+                              endpoint) mutable {
+              ExecCtx exec_ctx;
+              if (!endpoint.ok() || self->handshake_mgr_ == nullptr) {
+                MutexLock lock(&self->mu_);
+                ExecCtx::Run(DEBUG_LOCATION,
+                             std::exchange(self->notify_, nullptr),
+                             GRPC_ERROR_CREATE("connect endpoint failed"));
+                return;
+              }
+              auto* chaotic_good_ext =
+                  grpc_event_engine::experimental::QueryExtension<
+                      grpc_event_engine::experimental::ChaoticGoodExtension>(
+                      endpoint.value().get());
+              if (chaotic_good_ext != nullptr) {
+                chaotic_good_ext->EnableStatsCollection(
+                    /*is_control_channel=*/false);
+              }
+              self->data_endpoints_[index] =
+                  PromiseEndpoint(std::move(endpoint.value()), SliceBuffer());
+              if (self->pending_data_endpoints_.fetch_sub(
+                      1, std::memory_order_acq_rel) == 1) {
+                self->data_endpoint_ready_.Set();
+              }
+            };
+    self->event_engine_->Connect(
+        std::move(on_data_endpoint_connect), *self->resolved_addr_,
+        grpc_event_engine::experimental::ChannelArgsEndpointConfig(
+            self->args_.channel_args),
+        ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+            "data_endpoint_connection"),
+        std::chrono::seconds(kTimeoutSecs));
+  }
 
   return TrySeq(Race(
       TrySeq(self->data_endpoint_ready_.Wait(),
              [self]() mutable {
-               return TrySeq(DataEndpointWriteSettingsFrame(self),
-                             DataEndpointReadSettingsFrame(self),
-                             []() -> absl::Status { return absl::OkStatus(); });
+               // Exchange the settings frames of one data endpoint after the
+               // other.
+               return Loop([self, index = size_t{0}]() mutable {
+                 const size_t i = index++;
+                 return TrySeq(
+                     DataEndpointWriteSettingsFrame(self, i),
+                     DataEndpointReadSettingsFrame(self, i),
+                     [self, i]() -> LoopCtl<absl::Status> {
+                       if (i + 1 < self->data_endpoints_.size()) {
+                         return Continue{};
+                       }
+                       return absl::OkStatus();
+                     });
+               });
              }),
       TrySeq(Sleep(Timestamp::Now() + Duration::Seconds(kTimeoutSecs)),
              []() -> absl::Status {
@@ -208,6 +244,18 @@ auto ChaoticGoodConnector::ControlEndpointReadSettingsFrame(
                         "no connection id in settings frame");
                   }
                   self->connection_id_ = *settings_metadata->connection_id;
+                  // Servers that do not stripe messages accept one data
+                  // connection, and do not say so.
+                  const uint32_t data_connections =
+                      settings_metadata->data_connections.value_or(1);
+                  if (data_connections == 0 ||
+                      data_connections > RequestedDataConnections(
+                                             self->args_.channel_args)) {
+                    return absl::UnavailableError(absl::StrCat(
+                        "Server accepted ", data_connections,
+                        " data connections"));
+                  }
+                  self->data_endpoints_.resize(data_connections);
                   return absl::OkStatus();
                 },
                 WaitForDataEndpointSetup(self)),
@@ -220,9 +268,12 @@ auto ChaoticGoodConnector::ControlEndpointWriteSettingsFrame(
   // Serialize setting frame.
   SettingsFrame frame;
   // frame.header set connectiion_type: control
-  frame.headers = SettingsMetadata{SettingsMetadata::ConnectionType::kControl,
-                                   absl::nullopt, absl::nullopt}
-                      .ToMetadataBatch();
+  SettingsMetadata settings{SettingsMetadata::ConnectionType::kControl,
+                            absl::nullopt, absl::nullopt};
+  const uint32_t data_connections =
+      RequestedDataConnections(self->args_.channel_args);
+  if (data_connections > 1) settings.data_connections = data_connections;
+  frame.headers = settings.ToMetadataBatch();
   bool saw_encoding_errors = false;
   auto write_buffer =
       frame.Serialize(&self->hpack_compressor_, saw_encoding_errors);
@@ -326,7 +377,7 @@ void ChaoticGoodConnector::OnHandshakeDone(
             MutexLock lock(&self->mu_);
             self->result_->transport = new ChaoticGoodClientTransport(
                 std::move(self->control_endpoint_),
-                std::move(self->data_endpoint_), self->args_.channel_args,
+                std::move(self->data_endpoints_), self->args_.channel_args,
                 self->event_engine_, std::move(self->hpack_parser_),
                 std::move(self->hpack_compressor_));
             self->result_->channel_args = self->args_.channel_args;
@@ -15,9 +15,12 @@
 #ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CLIENT_CHAOTIC_GOOD_CONNECTOR_H
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHAOTIC_GOOD_CLIENT_CHAOTIC_GOOD_CONNECTOR_H
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "absl/random/random.h"
 #include "absl/status/statusor.h"
@@ -68,9 +71,9 @@ class ChaoticGoodConnector : public SubchannelConnector {
 
  private:
   static auto DataEndpointReadSettingsFrame(
-      RefCountedPtr<ChaoticGoodConnector> self);
+      RefCountedPtr<ChaoticGoodConnector> self, size_t index);
   static auto DataEndpointWriteSettingsFrame(
-      RefCountedPtr<ChaoticGoodConnector> self);
+      RefCountedPtr<ChaoticGoodConnector> self, size_t index);
   static auto ControlEndpointReadSettingsFrame(
       RefCountedPtr<ChaoticGoodConnector> self);
   static auto ControlEndpointWriteSettingsFrame(
@@ -89,7 +92,9 @@ class ChaoticGoodConnector : public SubchannelConnector {
       resolved_addr_;
 
   PromiseEndpoint control_endpoint_;
-  PromiseEndpoint data_endpoint_;
+  std::vector<PromiseEndpoint> data_endpoints_;
+  // Data endpoints still connecting.
+  std::atomic<size_t> pending_data_endpoints_{0};
   ActivityPtr connect_activity_ ABSL_GUARDED_BY(mu_);
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
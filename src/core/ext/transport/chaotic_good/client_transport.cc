@@ -20,6 +20,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -29,6 +30,7 @@
 #include "absl/status/statusor.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 
@@ -75,11 +77,11 @@ auto ChaoticGoodClientTransport::TransportWriteLoop(
     RefCountedPtr<ChaoticGoodTransport> transport) {
   return Loop([this, transport = std::move(transport)] {
     return TrySeq(
-        // Get next outgoing frame.
-        outgoing_frames_.Next(),
-        // Serialize and write it out.
-        [transport = transport.get()](ClientFrame client_frame) {
-          return transport->WriteFrame(GetFrameInterface(client_frame));
+        // Get the frames queued by all the streams.
+        transport->NextFrames(outgoing_frames_),
+        // Serialize and write them out together.
+        [transport = transport.get()](std::vector<ClientFrame> frames) {
+          return transport->WriteFrames(std::move(frames));
         },
         []() -> LoopCtl<absl::Status> {
           // The write failures will be caught in TrySeq and exit loop.
@@ -204,13 +206,28 @@ ChaoticGoodClientTransport::ChaoticGoodClientTransport(
     const ChannelArgs& args,
     std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
     HPackParser hpack_parser, HPackCompressor hpack_encoder)
+    : ChaoticGoodClientTransport(
+          std::move(control_endpoint),
+          OneDataEndpoint(std::move(data_endpoint)), args,
+          std::move(event_engine), std::move(hpack_parser),
+          std::move(hpack_encoder)) {}
+
+ChaoticGoodClientTransport::ChaoticGoodClientTransport(
+    PromiseEndpoint control_endpoint,
+    std::vector<PromiseEndpoint> data_endpoints, const ChannelArgs& args,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
+    HPackParser hpack_parser, HPackCompressor hpack_encoder)
     : allocator_(args.GetObject<ResourceQuota>()
                      ->memory_quota()
                      ->CreateMemoryAllocator("chaotic-good")),
       outgoing_frames_(4) {
   auto transport = MakeRefCounted<ChaoticGoodTransport>(
-      std::move(control_endpoint), std::move(data_endpoint),
-      std::move(hpack_parser), std::move(hpack_encoder));
+      std::move(control_endpoint), std::move(data_endpoints),
+      std::move(hpack_parser), std::move(hpack_encoder),
+      ChaoticGoodTransport::Options{
+          args.GetBool(GRPC_ARG_CHAOTIC_GOOD_WRITE_COALESCING_DELAY)
+              .value_or(false),
+          args.GetBool(GRPC_ARG_CHAOTIC_GOOD_READ_AHEAD).value_or(false)});
   writer_ = MakeActivity(
       // Continuously write next outgoing frames to promise endpoints.
       TransportWriteLoop(transport), EventEngineWakeupScheduler(event_engine),
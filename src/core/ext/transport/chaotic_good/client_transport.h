@@ -25,6 +25,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
@@ -73,6 +74,14 @@ class ChaoticGoodClientTransport final : public ClientTransport {
       std::shared_ptr<grpc_event_engine::experimental::EventEngine>
           event_engine,
       HPackParser hpack_parser, HPackCompressor hpack_encoder);
+  // Stripes messages over all of \a data_endpoints.
+  ChaoticGoodClientTransport(
+      PromiseEndpoint control_endpoint,
+      std::vector<PromiseEndpoint> data_endpoints,
+      const ChannelArgs& channel_args,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine>
+          event_engine,
+      HPackParser hpack_parser, HPackCompressor hpack_encoder);
   ~ChaoticGoodClientTransport() override;
 
   FilterStackTransport* filter_stack_transport() override { return nullptr; }
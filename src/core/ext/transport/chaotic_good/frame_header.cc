@@ -44,7 +44,9 @@ uint32_t ReadLittleEndianUint32(const uint8_t* data) {
 // Serializes a frame header into a buffer of 24 bytes.
 void FrameHeader::Serialize(uint8_t* data) const {
   WriteLittleEndianUint32(
-      static_cast<uint32_t>(type) | (flags.ToInt<uint32_t>() << 8), data);
+      static_cast<uint32_t>(type) | (flags.ToInt<uint32_t>() << 8) |
+          (static_cast<uint32_t>(data_connection) << 24),
+      data);
   WriteLittleEndianUint32(stream_id, data + 4);
   WriteLittleEndianUint32(header_length, data + 8);
   WriteLittleEndianUint32(message_length, data + 12);
@@ -57,9 +59,10 @@ absl::StatusOr<FrameHeader> FrameHeader::Parse(const uint8_t* data) {
   FrameHeader header;
   const uint32_t type_and_flags = ReadLittleEndianUint32(data);
   header.type = static_cast<FrameType>(type_and_flags & 0xff);
-  const uint32_t flags = type_and_flags >> 8;
+  const uint32_t flags = (type_and_flags >> 8) & 0xffff;
   if (flags > 7) return absl::InvalidArgumentError("Invalid flags");
   header.flags = BitSet<3>::FromInt(flags);
+  header.data_connection = static_cast<uint8_t>(type_and_flags >> 24);
   header.stream_id = ReadLittleEndianUint32(data + 4);
   header.header_length = ReadLittleEndianUint32(data + 8);
   header.message_length = ReadLittleEndianUint32(data + 12);
@@ -55,6 +55,9 @@ struct FrameHeader {
   uint32_t message_length = 0;
   uint32_t message_padding = 0;
   uint32_t trailer_length = 0;
+  // Index of the data connection that carries the message of this frame, when
+  // a transport stripes messages over several data connections.
+  uint8_t data_connection = 0;
 
   // Parses a frame header from a buffer of 24 bytes. All 24 bytes are consumed.
   static absl::StatusOr<FrameHeader> Parse(const uint8_t* data);
@@ -70,10 +73,17 @@ struct FrameHeader {
            header_length == h.header_length &&
            message_length == h.message_length &&
            message_padding == h.message_padding &&
-           trailer_length == h.trailer_length;
+           trailer_length == h.trailer_length &&
+           data_connection == h.data_connection;
   }
   // Frame header size is fixed to 24 bytes.
   static constexpr size_t kFrameHeaderSize = 24;
+  // The data connection index is one byte of the header.
+  static constexpr size_t kMaxDataConnections = 256;
+  // Overwrites the data connection index of a serialized frame header.
+  static void SetDataConnection(uint8_t data_connection, uint8_t* data) {
+    data[3] = data_connection;
+  }
 };
 
 }  // namespace chaotic_good
@@ -26,9 +26,11 @@
 #include "absl/random/bit_gen_ref.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 
@@ -68,12 +70,20 @@
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/promise_endpoint.h"
 #include "src/core/server/server.h"
+#include "src/core/util/useful.h"
 
 namespace grpc_core {
 namespace chaotic_good {
 
 namespace {
 const Duration kConnectionDeadline = Duration::Seconds(120);
+const int kDefaultMaxDataConnections = 16;
+
+uint32_t MaxDataConnections(const ChannelArgs& args) {
+  return Clamp(args.GetInt(GRPC_ARG_CHAOTIC_GOOD_MAX_DATA_CONNECTIONS)
+                   .value_or(kDefaultMaxDataConnections),
+               1, static_cast<int>(FrameHeader::kMaxDataConnections));
+}
 }  // namespace
 
 using grpc_event_engine::experimental::EventEngine;
@@ -144,6 +154,23 @@ absl::Status ChaoticGoodServerListener::StartListening() {
   return status;
 }
 
+absl::Status ChaoticGoodServerListener::DataEndpoints::Set(
+    uint32_t index, PromiseEndpoint endpoint) {
+  MutexLock lock(&mu_);
+  if (index >= endpoints_.size()) {
+    return absl::UnavailableError(
+        absl::StrCat("Invalid data connection index: ", index));
+  }
+  if (is_set_[index]) {
+    return absl::UnavailableError(
+        absl::StrCat("Duplicate data connection index: ", index));
+  }
+  endpoints_[index] = std::move(endpoint);
+  is_set_[index] = true;
+  if (--num_pending_ == 0) ready_.Set();
+  return absl::OkStatus();
+}
+
 ChaoticGoodServerListener::ActiveConnection::ActiveConnection(
     RefCountedPtr<ChaoticGoodServerListener> listener,
     std::unique_ptr<EventEngine::Endpoint> endpoint)
@@ -184,7 +211,7 @@ void ChaoticGoodServerListener::ActiveConnection::NewConnectionID() {
     }
   }
   listener_->connectivity_map_.emplace(
-      connection_id_, std::make_shared<InterActivityLatch<PromiseEndpoint>>());
+      connection_id_, std::make_shared<DataEndpoints>(data_connections_));
 }
 
 void ChaoticGoodServerListener::ActiveConnection::Done(
@@ -256,7 +283,15 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                     const bool is_control_endpoint =
                         settings_metadata->connection_type ==
                         SettingsMetadata::ConnectionType::kControl;
-                    if (!is_control_endpoint) {
+                    if (is_control_endpoint) {
+                      // Accept as many data connections as the client asks
+                      // for, up to the limit of the server.
+                      const uint32_t max_data_connections =
+                          MaxDataConnections(self->connection_->args());
+                      self->connection_->data_connections_ = Clamp(
+                          settings_metadata->data_connections.value_or(1), 1u,
+                          max_data_connections);
+                    } else {
                       if (!settings_metadata->connection_id.has_value()) {
                         return absl::UnavailableError(
                             "no connection id in data endpoint settings frame");
@@ -270,6 +305,8 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
                           *settings_metadata->connection_id;
                       self->connection_->data_alignment_ =
                           *settings_metadata->alignment;
+                      self->connection_->data_connection_index_ =
+                          settings_metadata->data_connection_index.value_or(0);
                     }
                     return is_control_endpoint;
                   });
@@ -293,12 +330,13 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
           },
           [self]() {
             MutexLock lock(&self->connection_->listener_->mu_);
-            auto latch = self->connection_->listener_->connectivity_map_
-                             .find(self->connection_->connection_id_)
-                             ->second;
-            return latch->Wait();
+            auto data_endpoints =
+                self->connection_->listener_->connectivity_map_
+                    .find(self->connection_->connection_id_)
+                    ->second;
+            return data_endpoints->Wait();
           },
-          [self](PromiseEndpoint ret) -> absl::Status {
+          [self](std::vector<PromiseEndpoint> ret) -> absl::Status {
             MutexLock lock(&self->connection_->listener_->mu_);
             if (GRPC_TRACE_FLAG_ENABLED(chaotic_good)) {
               LOG(INFO) << self->connection_.get()
@@ -335,10 +373,12 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
     ControlEndpointWriteSettingsFrame(RefCountedPtr<HandshakingState> self) {
   self->connection_->NewConnectionID();
   SettingsFrame frame;
-  frame.headers =
-      SettingsMetadata{absl::nullopt, self->connection_->connection_id_,
-                       absl::nullopt}
-          .ToMetadataBatch();
+  SettingsMetadata settings{absl::nullopt, self->connection_->connection_id_,
+                            absl::nullopt};
+  if (self->connection_->data_connections_ > 1) {
+    settings.data_connections = self->connection_->data_connections_;
+  }
+  frame.headers = settings.ToMetadataBatch();
   bool saw_encoding_errors = false;
   auto write_buffer = frame.Serialize(&self->connection_->hpack_compressor_,
                                       saw_encoding_errors);
@@ -372,8 +412,8 @@ auto ChaoticGoodServerListener::ActiveConnection::HandshakingState::
               absl::StrCat("Connection not in map: ",
                            absl::CEscape(self->connection_->connection_id_)));
         }
-        it->second->Set(std::move(self->connection_->endpoint_));
-        return absl::OkStatus();
+        return it->second->Set(self->connection_->data_connection_index_,
+                               std::move(self->connection_->endpoint_));
       });
 }
 
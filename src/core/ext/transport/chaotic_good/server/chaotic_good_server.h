@@ -41,6 +41,7 @@
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/inter_activity_latch.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice.h"
@@ -69,6 +70,34 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
   const ChannelArgs& args() const { return args_; }
   void Orphan() override;
 
+  // The data endpoints of a transport being set up, in data connection index
+  // order, whichever order they connect in.
+  class DataEndpoints {
+   public:
+    explicit DataEndpoints(size_t num_data_endpoints)
+        : endpoints_(num_data_endpoints),
+          is_set_(num_data_endpoints, false),
+          num_pending_(num_data_endpoints) {}
+
+    // Sets the data endpoint of data connection \a index. Fails if the
+    // transport has no such data connection, or if it is already set.
+    absl::Status Set(uint32_t index, PromiseEndpoint endpoint);
+    // Resolves to all the data endpoints once each of them is set.
+    auto Wait() {
+      return Map(ready_.Wait(), [this](Empty) {
+        MutexLock lock(&mu_);
+        return std::move(endpoints_);
+      });
+    }
+
+   private:
+    Mutex mu_;
+    std::vector<PromiseEndpoint> endpoints_ ABSL_GUARDED_BY(mu_);
+    std::vector<bool> is_set_ ABSL_GUARDED_BY(mu_);
+    size_t num_pending_ ABSL_GUARDED_BY(mu_);
+    InterActivityLatch<void> ready_;
+  };
+
   class ActiveConnection : public InternallyRefCounted<ActiveConnection> {
    public:
     ActiveConnection(
@@ -125,6 +154,10 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
     absl::BitGen bitgen_;
     std::string connection_id_;
     int32_t data_alignment_;
+    // Data connections of the transport, for control endpoints.
+    uint32_t data_connections_ = 1;
+    // Which data connection of its transport a data endpoint is.
+    uint32_t data_connection_index_ = 0;
   };
 
   void Start(Server*, const std::vector<grpc_pollset*>*) override {
@@ -149,8 +182,7 @@ class ChaoticGoodServerListener final : public Server::ListenerInterface {
   Mutex mu_;
   bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
   // Map of connection id to endpoints connectivity.
-  absl::flat_hash_map<std::string,
-                      std::shared_ptr<InterActivityLatch<PromiseEndpoint>>>
+  absl::flat_hash_map<std::string, std::shared_ptr<DataEndpoints>>
       connectivity_map_ ABSL_GUARDED_BY(mu_);
   absl::flat_hash_set<OrphanablePtr<ActiveConnection>> connection_list_
       ABSL_GUARDED_BY(mu_);
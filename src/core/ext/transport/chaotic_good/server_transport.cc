@@ -17,6 +17,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -26,6 +27,7 @@
 #include "absl/status/statusor.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/grpc.h>
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
@@ -56,11 +58,11 @@ auto ChaoticGoodServerTransport::TransportWriteLoop(
     RefCountedPtr<ChaoticGoodTransport> transport) {
   return Loop([this, transport = std::move(transport)] {
     return TrySeq(
-        // Get next outgoing frame.
-        outgoing_frames_.Next(),
-        // Serialize and write it out.
-        [transport = transport.get()](ServerFrame client_frame) {
-          return transport->WriteFrame(GetFrameInterface(client_frame));
+        // Get the frames queued by all the streams.
+        transport->NextFrames(outgoing_frames_),
+        // Serialize and write them out together.
+        [transport = transport.get()](std::vector<ServerFrame> frames) {
+          return transport->WriteFrames(std::move(frames));
         },
         []() -> LoopCtl<absl::Status> {
           // The write failures will be caught in TrySeq and exit loop.
@@ -79,20 +81,28 @@ auto ChaoticGoodServerTransport::PushFragmentIntoCall(
     LOG(INFO) << "CHAOTIC_GOOD: PushFragmentIntoCall: frame="
               << frame.ToString();
   }
+  // A final message is pushed together with the half close, so the handler
+  // sees both at once (the common case for unary requests).
+  const bool finish_with_message =
+      frame.message.has_value() && frame.end_of_stream;
   return Seq(If(
                  frame.message.has_value(),
-                 [&call_initiator, &frame]() mutable {
-                   return call_initiator.PushMessage(
-                       std::move(frame.message->message));
+                 [&call_initiator, &frame, finish_with_message]() mutable {
+                   return finish_with_message
+                              ? call_initiator.PushMessageAndFinishSends(
+                                    std::move(frame.message->message))
+                              : call_initiator.PushMessage(
+                                    std::move(frame.message->message));
                  },
                  []() -> StatusFlag { return Success{}; }),
              [this, call_initiator, end_of_stream = frame.end_of_stream,
+              finish_with_message,
               stream_id](StatusFlag status) mutable -> StatusFlag {
                if (!status.ok() && GRPC_TRACE_FLAG_ENABLED(chaotic_good)) {
                  LOG(INFO) << "CHAOTIC_GOOD: Failed PushFragmentIntoCall";
                }
                if (end_of_stream || !status.ok()) {
-                 call_initiator.FinishSends();
+                 if (!finish_with_message) call_initiator.FinishSends();
                  // We have received end_of_stream. It is now safe to remove
                  // the call from the stream map.
                  MutexLock lock(&mu_);
@@ -353,6 +363,16 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
     PromiseEndpoint data_endpoint,
     std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
     HPackParser hpack_parser, HPackCompressor hpack_encoder)
+    : ChaoticGoodServerTransport(
+          args, std::move(control_endpoint),
+          OneDataEndpoint(std::move(data_endpoint)), std::move(event_engine),
+          std::move(hpack_parser), std::move(hpack_encoder)) {}
+
+ChaoticGoodServerTransport::ChaoticGoodServerTransport(
+    const ChannelArgs& args, PromiseEndpoint control_endpoint,
+    std::vector<PromiseEndpoint> data_endpoints,
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine,
+    HPackParser hpack_parser, HPackCompressor hpack_encoder)
     : call_arena_allocator_(MakeRefCounted<CallArenaAllocator>(
           args.GetObject<ResourceQuota>()
               ->memory_quota()
@@ -361,8 +381,12 @@ ChaoticGoodServerTransport::ChaoticGoodServerTransport(
       event_engine_(event_engine),
       outgoing_frames_(4) {
   auto transport = MakeRefCounted<ChaoticGoodTransport>(
-      std::move(control_endpoint), std::move(data_endpoint),
-      std::move(hpack_parser), std::move(hpack_encoder));
+      std::move(control_endpoint), std::move(data_endpoints),
+      std::move(hpack_parser), std::move(hpack_encoder),
+      ChaoticGoodTransport::Options{
+          args.GetBool(GRPC_ARG_CHAOTIC_GOOD_WRITE_COALESCING_DELAY)
+              .value_or(false),
+          args.GetBool(GRPC_ARG_CHAOTIC_GOOD_READ_AHEAD).value_or(false)});
   writer_ = MakeActivity(TransportWriteLoop(transport),
                          EventEngineWakeupScheduler(event_engine),
                          OnTransportActivityDone("writer"));
@@ -43,6 +43,14 @@ Arena::PoolPtr<grpc_metadata_batch> SettingsMetadata::ToMetadataBatch() {
   if (alignment.has_value()) {
     add("chaotic-good-alignment", absl::StrCat(alignment.value()));
   }
+  if (data_connections.has_value()) {
+    add("chaotic-good-data-connections",
+        absl::StrCat(data_connections.value()));
+  }
+  if (data_connection_index.has_value()) {
+    add("chaotic-good-data-connection-index",
+        absl::StrCat(data_connection_index.value()));
+  }
   return md;
 }
 
@@ -73,6 +81,24 @@ absl::StatusOr<SettingsMetadata> SettingsMetadata::FromMetadataBatch(
     }
     md.alignment = alignment;
   }
+  v = batch.GetStringValue("chaotic-good-data-connections", &buffer);
+  if (v.has_value()) {
+    uint32_t data_connections;
+    if (!absl::SimpleAtoi(*v, &data_connections)) {
+      return absl::UnavailableError(
+          absl::StrCat("Invalid data connections: ", *v));
+    }
+    md.data_connections = data_connections;
+  }
+  v = batch.GetStringValue("chaotic-good-data-connection-index", &buffer);
+  if (v.has_value()) {
+    uint32_t data_connection_index;
+    if (!absl::SimpleAtoi(*v, &data_connection_index)) {
+      return absl::UnavailableError(
+          absl::StrCat("Invalid data connection index: ", *v));
+    }
+    md.data_connection_index = data_connection_index;
+  }
   return md;
 }
 
@@ -34,6 +34,11 @@ struct SettingsMetadata {
   absl::optional<ConnectionType> connection_type;
   absl::optional<std::string> connection_id;
   absl::optional<uint32_t> alignment;
+  // On control connections: the number of data connections the client asks
+  // for, and in the reply the number the server accepted.
+  absl::optional<uint32_t> data_connections;
+  // On data connections: which of the data connections this is.
+  absl::optional<uint32_t> data_connection_index;
 
   Arena::PoolPtr<grpc_metadata_batch> ToMetadataBatch();
   static absl::StatusOr<SettingsMetadata> FromMetadataBatch(
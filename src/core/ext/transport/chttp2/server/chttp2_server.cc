@@ -38,8 +38,10 @@
 #include "absl/strings/string_view.h"
 #include "absl/strings/strip.h"
 #include "absl/types/optional.h"
+#include "absl/types/span.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/grpc.h>
 #include <grpc/grpc_posix.h>
 #include <grpc/impl/channel_arg_names.h>
@@ -79,6 +81,7 @@
 #include "src/core/lib/iomgr/unix_sockets_posix.h"
 #include "src/core/lib/iomgr/vsock.h"
 #include "src/core/lib/resource_quota/connection_quota.h"
+#include "src/core/lib/resource_quota/handshake_quota.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/security/credentials/credentials.h"
@@ -88,6 +91,7 @@
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/lib/uri/uri_parser.h"
+#include "src/core/server/drain_scheduler.h"
 #include "src/core/server/server.h"
 
 #ifdef GPR_SUPPORT_CHANNELS_FROM_FD
@@ -142,6 +146,12 @@ class Chttp2ServerListener : public Server::ListenerInterface {
 
   void AcceptConnectedEndpoint(std::unique_ptr<EventEngine::Endpoint> endpoint);
 
+  // Like AcceptConnectedEndpoint() for each of \a endpoints, but reads the
+  // connection manager and registers the connections under one acquisition
+  // of mu_ each.
+  void AcceptConnectedEndpoints(
+      std::vector<std::unique_ptr<EventEngine::Endpoint>> endpoints);
+
   channelz::ListenSocketNode* channelz_listen_socket_node() const override {
     return channelz_listen_socket_.get();
   }
@@ -207,13 +217,15 @@ class Chttp2ServerListener : public Server::ListenerInterface {
 
     ActiveConnection(grpc_pollset* accepting_pollset, AcceptorPtr acceptor,
                      EventEngine* event_engine, const ChannelArgs& args,
-                     MemoryOwner memory_owner);
+                     MemoryOwner memory_owner, std::string peer);
     ~ActiveConnection() override;
 
     void Orphan() override;
 
     void SendGoAway();
 
+    Timestamp created() const { return created_; }
+
     void Start(RefCountedPtr<Chttp2ServerListener> listener,
                OrphanablePtr<grpc_endpoint> endpoint, const ChannelArgs& args);
 
@@ -241,6 +253,10 @@ class Chttp2ServerListener : public Server::ListenerInterface {
     // ChannelArgs of the listener_.
     EventEngine* const event_engine_ ABSL_GUARDED_BY(&mu_);
     bool shutdown_ ABSL_GUARDED_BY(&mu_) = false;
+    // The peer the connection was admitted for by the listener's
+    // connection_quota_, to release it against when the connection closes.
+    const std::string peer_;
+    const Timestamp created_ = Timestamp::Now();
   };
 
   // To allow access to RefCounted<> like interface.
@@ -253,11 +269,46 @@ class Chttp2ServerListener : public Server::ListenerInterface {
                        grpc_pollset* accepting_pollset,
                        grpc_tcp_server_acceptor* acceptor);
 
+  // A connection that has been admitted but not yet registered in
+  // connections_.
+  struct AdmittedConnection {
+    OrphanablePtr<ActiveConnection> connection;
+    // Held to start the handshake outside the critical region.
+    RefCountedPtr<ActiveConnection> connection_ref;
+    RefCountedPtr<Chttp2ServerListener> listener_ref;
+    OrphanablePtr<grpc_endpoint> endpoint;
+    ChannelArgs args;
+    std::string peer;
+  };
+
+  // Admits \a endpoint against connection_quota_ and \a connection_manager.
+  // Returns nullopt if the connection was rejected, in which case it is
+  // closed.
+  absl::optional<AdmittedConnection> AdmitConnection(
+      OrphanablePtr<grpc_endpoint> endpoint, grpc_pollset* accepting_pollset,
+      AcceptorPtr acceptor,
+      const RefCountedPtr<grpc_server_config_fetcher::ConnectionManager>&
+          connection_manager) ABSL_LOCKS_EXCLUDED(mu_);
+
+  // Registers \a connections and starts their handshakes, or closes them if
+  // the listener has stopped serving or \a connection_manager is no longer
+  // current.
+  void StartConnections(
+      absl::Span<AdmittedConnection> connections,
+      const RefCountedPtr<grpc_server_config_fetcher::ConnectionManager>&
+          connection_manager) ABSL_LOCKS_EXCLUDED(mu_);
+
   static void TcpServerShutdownComplete(void* arg, grpc_error_handle error);
 
   static void DestroyListener(Server* /*server*/, void* arg,
                               grpc_closure* destroy_done);
 
+  // Sends GOAWAYs on \a connections, paced by DrainScheduler, and orphans
+  // each of them once its GOAWAY is sent.
+  void DrainConnections(
+      std::map<ActiveConnection*, OrphanablePtr<ActiveConnection>>
+          connections);
+
   Server* const server_ = nullptr;
   grpc_tcp_server* tcp_server_ = nullptr;
   grpc_resolved_address resolved_address_;
@@ -299,12 +350,13 @@ void Chttp2ServerListener::ConfigFetcherWatcher::UpdateConnectionManager(
       connection_manager_to_destroy;
   class GracefulShutdownExistingConnections {
    public:
+    explicit GracefulShutdownExistingConnections(Chttp2ServerListener* listener)
+        : listener_(listener) {}
+
     ~GracefulShutdownExistingConnections() {
       // Send GOAWAYs on the transports so that they get disconnected when
       // existing RPCs finish, and so that no new RPC is started on them.
-      for (auto& connection : connections_) {
-        connection.first->SendGoAway();
-      }
+      listener_->DrainConnections(std::move(connections_));
     }
 
     void set_connections(
@@ -315,8 +367,9 @@ void Chttp2ServerListener::ConfigFetcherWatcher::UpdateConnectionManager(
     }
 
    private:
+    Chttp2ServerListener* const listener_;
     std::map<ActiveConnection*, OrphanablePtr<ActiveConnection>> connections_;
-  } connections_to_shutdown;
+  } connections_to_shutdown(listener_.get());
   {
     MutexLock lock(&listener_->mu_);
     connection_manager_to_destroy = listener_->connection_manager_;
@@ -354,9 +407,7 @@ void Chttp2ServerListener::ConfigFetcherWatcher::StopServing() {
   }
   // Send GOAWAYs on the transports so that they disconnected when existing
   // RPCs finish.
-  for (auto& connection : connections) {
-    connection.first->SendGoAway();
-  }
+  listener_->DrainConnections(std::move(connections));
 }
 
 //
@@ -493,16 +544,20 @@ void Chttp2ServerListener::ActiveConnection::HandshakingState::OnHandshakeDone(
           } else {
             // Remove the connection from the connections_ map since OnClose()
             // will not be invoked when a config fetcher is set.
-            auto connection_quota =
-                connection_->listener_->connection_quota_->Ref().release();
+            struct ConnectionQuotaRelease {
+              ConnectionQuotaRefPtr connection_quota;
+              std::string peer;
+            };
+            auto* release = new ConnectionQuotaRelease{
+                connection_->listener_->connection_quota_,
+                connection_->peer_};
             auto on_close_transport = [](void* arg,
                                          grpc_error_handle /*handle*/) {
-              ConnectionQuota* connection_quota =
-                  static_cast<ConnectionQuota*>(arg);
-              connection_quota->ReleaseConnections(1);
-              connection_quota->Unref();
+              auto* release = static_cast<ConnectionQuotaRelease*>(arg);
+              release->connection_quota->ReleaseConnections(1, release->peer);
+              delete release;
             };
-            on_close = GRPC_CLOSURE_CREATE(on_close_transport, connection_quota,
+            on_close = GRPC_CLOSURE_CREATE(on_close_transport, release,
                                            grpc_schedule_on_exec_ctx_);
             cleanup_connection = true;
           }
@@ -541,7 +596,8 @@ void Chttp2ServerListener::ActiveConnection::HandshakingState::OnHandshakeDone(
   if (cleanup_connection) {
     MutexLock listener_lock(&connection_->listener_->mu_);
     if (release_connection) {
-      connection_->listener_->connection_quota_->ReleaseConnections(1);
+      connection_->listener_->connection_quota_->ReleaseConnections(
+          1, connection_->peer_);
     }
     auto it = connection_->listener_->connections_.find(connection_.get());
     if (it != connection_->listener_->connections_.end()) {
@@ -558,10 +614,11 @@ void Chttp2ServerListener::ActiveConnection::HandshakingState::OnHandshakeDone(
 Chttp2ServerListener::ActiveConnection::ActiveConnection(
     grpc_pollset* accepting_pollset, AcceptorPtr acceptor,
     EventEngine* event_engine, const ChannelArgs& args,
-    MemoryOwner memory_owner)
+    MemoryOwner memory_owner, std::string peer)
     : handshaking_state_(memory_owner.MakeOrphanable<HandshakingState>(
           Ref(), accepting_pollset, std::move(acceptor), args)),
-      event_engine_(event_engine) {
+      event_engine_(event_engine),
+      peer_(std::move(peer)) {
   GRPC_CLOSURE_INIT(&on_close_, ActiveConnection::OnClose, this,
                     grpc_schedule_on_exec_ctx);
 }
@@ -657,7 +714,7 @@ void Chttp2ServerListener::ActiveConnection::OnClose(
       self->drain_grace_timer_handle_.reset();
     }
   }
-  self->listener_->connection_quota_->ReleaseConnections(1);
+  self->listener_->connection_quota_->ReleaseConnections(1, self->peer_);
   self->Unref();
 }
 
@@ -769,6 +826,27 @@ Chttp2ServerListener::Chttp2ServerListener(
     connection_quota_->SetMaxIncomingConnections(
         max_allowed_incoming_connections.value());
   }
+  auto max_allowed_incoming_connections_per_peer =
+      args.GetInt(GRPC_ARG_MAX_ALLOWED_INCOMING_CONNECTIONS_PER_PEER);
+  if (max_allowed_incoming_connections_per_peer.has_value()) {
+    connection_quota_->SetMaxIncomingConnectionsPerPeer(
+        max_allowed_incoming_connections_per_peer.value());
+  }
+  // The handshake quota is shared by every server of the resource quota, so
+  // the limits of the last listener created apply.
+  const HandshakeQuotaRefPtr& handshake_quota =
+      args.GetObject<ResourceQuota>()->handshake_quota();
+  auto max_concurrent_handshakes =
+      args.GetInt(GRPC_ARG_MAX_CONCURRENT_HANDSHAKES);
+  if (max_concurrent_handshakes.has_value()) {
+    handshake_quota->SetMaxConcurrentHandshakes(
+        std::max(1, max_concurrent_handshakes.value()));
+  }
+  auto max_queued_handshakes = args.GetInt(GRPC_ARG_MAX_QUEUED_HANDSHAKES);
+  if (max_queued_handshakes.has_value()) {
+    handshake_quota->SetMaxQueuedHandshakes(
+        std::max(0, max_queued_handshakes.value()));
+  }
   GRPC_CLOSURE_INIT(&tcp_server_shutdown_complete_, TcpServerShutdownComplete,
                     this, grpc_schedule_on_exec_ctx);
 }
@@ -823,65 +901,144 @@ void Chttp2ServerListener::AcceptConnectedEndpoint(
            /*accepting_pollset=*/nullptr, /*acceptor=*/nullptr);
 }
 
+void Chttp2ServerListener::AcceptConnectedEndpoints(
+    std::vector<std::unique_ptr<EventEngine::Endpoint>> endpoints) {
+  RefCountedPtr<grpc_server_config_fetcher::ConnectionManager>
+      connection_manager;
+  {
+    MutexLock lock(&mu_);
+    connection_manager = connection_manager_;
+  }
+  std::vector<AdmittedConnection> connections;
+  connections.reserve(endpoints.size());
+  for (auto& endpoint : endpoints) {
+    auto admitted = AdmitConnection(
+        OrphanablePtr<grpc_endpoint>(
+            grpc_event_engine_endpoint_create(std::move(endpoint))),
+        /*accepting_pollset=*/nullptr, /*acceptor=*/nullptr,
+        connection_manager);
+    if (admitted.has_value()) connections.push_back(std::move(*admitted));
+  }
+  StartConnections(absl::MakeSpan(connections), connection_manager);
+}
+
 void Chttp2ServerListener::OnAccept(void* arg, grpc_endpoint* tcp,
                                     grpc_pollset* accepting_pollset,
                                     grpc_tcp_server_acceptor* server_acceptor) {
   Chttp2ServerListener* self = static_cast<Chttp2ServerListener*>(arg);
-  ChannelArgs args = self->args_;
-  OrphanablePtr<grpc_endpoint> endpoint(tcp);
-  AcceptorPtr acceptor(server_acceptor);
   RefCountedPtr<grpc_server_config_fetcher::ConnectionManager>
       connection_manager;
   {
     MutexLock lock(&self->mu_);
     connection_manager = self->connection_manager_;
   }
-  if (!self->connection_quota_->AllowIncomingConnection(
-          self->memory_quota_, grpc_endpoint_get_peer(endpoint.get()))) {
-    return;
+  auto admitted = self->AdmitConnection(
+      OrphanablePtr<grpc_endpoint>(tcp), accepting_pollset,
+      AcceptorPtr(server_acceptor), connection_manager);
+  if (!admitted.has_value()) return;
+  self->StartConnections(absl::MakeSpan(&*admitted, 1), connection_manager);
+}
+
+absl::optional<Chttp2ServerListener::AdmittedConnection>
+Chttp2ServerListener::AdmitConnection(
+    OrphanablePtr<grpc_endpoint> endpoint, grpc_pollset* accepting_pollset,
+    AcceptorPtr acceptor,
+    const RefCountedPtr<grpc_server_config_fetcher::ConnectionManager>&
+        connection_manager) {
+  ChannelArgs args = args_;
+  // Admission is decided here, before any handshake work is done for the
+  // connection.
+  std::string peer(grpc_endpoint_get_peer(endpoint.get()));
+  if (!connection_quota_->AllowIncomingConnection(memory_quota_, peer)) {
+    return absl::nullopt;
   }
-  if (self->config_fetcher_ != nullptr) {
+  if (config_fetcher_ != nullptr) {
     if (connection_manager == nullptr) {
-      return;
+      connection_quota_->ReleaseConnections(1, peer);
+      return absl::nullopt;
     }
     absl::StatusOr<ChannelArgs> args_result =
-        connection_manager->UpdateChannelArgsForConnection(args, tcp);
+        connection_manager->UpdateChannelArgsForConnection(args,
+                                                           endpoint.get());
     if (!args_result.ok()) {
-      return;
+      connection_quota_->ReleaseConnections(1, peer);
+      return absl::nullopt;
     }
     grpc_error_handle error;
-    args = self->args_modifier_(*args_result, &error);
+    args = args_modifier_(*args_result, &error);
     if (!error.ok()) {
-      return;
+      connection_quota_->ReleaseConnections(1, peer);
+      return absl::nullopt;
     }
   }
-  auto memory_owner = self->memory_quota_->CreateMemoryOwner();
-  EventEngine* const event_engine = self->args_.GetObject<EventEngine>();
-  auto connection = memory_owner.MakeOrphanable<ActiveConnection>(
+  auto memory_owner =
+      memory_quota_->CreateMemoryOwner("chttp2_server_connection");
+  EventEngine* const event_engine = args_.GetObject<EventEngine>();
+  AdmittedConnection admitted;
+  admitted.connection = memory_owner.MakeOrphanable<ActiveConnection>(
       accepting_pollset, std::move(acceptor), event_engine, args,
-      std::move(memory_owner));
-  // Hold a ref to connection to allow starting handshake outside the
-  // critical region
-  RefCountedPtr<ActiveConnection> connection_ref = connection->Ref();
-  RefCountedPtr<Chttp2ServerListener> listener_ref;
+      std::move(memory_owner), peer);
+  admitted.connection_ref = admitted.connection->Ref();
+  admitted.endpoint = std::move(endpoint);
+  admitted.args = std::move(args);
+  admitted.peer = std::move(peer);
+  return admitted;
+}
+
+void Chttp2ServerListener::StartConnections(
+    absl::Span<AdmittedConnection> connections,
+    const RefCountedPtr<grpc_server_config_fetcher::ConnectionManager>&
+        connection_manager) {
   {
-    MutexLock lock(&self->mu_);
-    // Shutdown the the connection if listener's stopped serving or if the
+    MutexLock lock(&mu_);
+    // Shutdown the the connections if listener's stopped serving or if the
     // connection manager has changed.
-    if (!self->shutdown_ && self->is_serving_ &&
-        connection_manager == self->connection_manager_) {
-      // This ref needs to be taken in the critical region after having made
-      // sure that the listener has not been Orphaned, so as to avoid
-      // heap-use-after-free issues where `Ref()` is invoked when the ref of
-      // tcp_server_ has already reached 0. (Ref() implementation of
-      // Chttp2ServerListener is grpc_tcp_server_ref().)
-      listener_ref = self->RefAsSubclass<Chttp2ServerListener>();
-      self->connections_.emplace(connection.get(), std::move(connection));
+    if (!shutdown_ && is_serving_ &&
+        connection_manager == connection_manager_) {
+      for (AdmittedConnection& admitted : connections) {
+        // This ref needs to be taken in the critical region after having made
+        // sure that the listener has not been Orphaned, so as to avoid
+        // heap-use-after-free issues where `Ref()` is invoked when the ref of
+        // tcp_server_ has already reached 0. (Ref() implementation of
+        // Chttp2ServerListener is grpc_tcp_server_ref().)
+        admitted.listener_ref = RefAsSubclass<Chttp2ServerListener>();
+        ActiveConnection* connection = admitted.connection.get();
+        connections_.emplace(connection, std::move(admitted.connection));
+      }
+    }
+  }
+  for (AdmittedConnection& admitted : connections) {
+    if (admitted.connection == nullptr) {
+      admitted.connection_ref->Start(std::move(admitted.listener_ref),
+                                     std::move(admitted.endpoint),
+                                     admitted.args);
+    } else {
+      connection_quota_->ReleaseConnections(1, admitted.peer);
     }
   }
-  if (connection == nullptr) {
-    connection_ref->Start(std::move(listener_ref), std::move(endpoint), args);
+}
+
+void Chttp2ServerListener::DrainConnections(
+    std::map<ActiveConnection*, OrphanablePtr<ActiveConnection>>
+        connections) {
+  std::vector<DrainScheduler::Connection> drain;
+  drain.reserve(connections.size());
+  for (auto& connection : connections) {
+    DrainScheduler::Connection c;
+    // Active calls are tracked by the server, not here: order by age only.
+    c.established = connection.first->created();
+    c.send_goaway = [connection = std::move(connection.second)]() {
+      connection->SendGoAway();
+    };
+    drain.push_back(std::move(c));
   }
+  channelz::ServerNode* channelz_node = server_->channelz_node();
+  DrainScheduler::Drain(
+      args_,
+      channelz_node == nullptr
+          ? nullptr
+          : channelz_node->RefAsSubclass<channelz::ServerNode>(),
+      std::move(drain));
 }
 
 void Chttp2ServerListener::TcpServerShutdownComplete(
@@ -1023,21 +1180,63 @@ ChannelArgs ModifyArgsForConnection(const ChannelArgs& args,
   return args.SetObject(security_connector);
 }
 
+// An endpoint whose first read returns bytes that were read from the
+// connection before it was handed to the server.
+class InitialDataEndpoint final : public EventEngine::Endpoint {
+ public:
+  InitialDataEndpoint(std::unique_ptr<EventEngine::Endpoint> endpoint,
+                      grpc_event_engine::experimental::SliceBuffer initial_data)
+      : endpoint_(std::move(endpoint)),
+        initial_data_(std::move(initial_data)) {}
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            grpc_event_engine::experimental::SliceBuffer* buffer,
+            const ReadArgs* args) override {
+    if (initial_data_.Length() > 0) {
+      grpc_slice_buffer_move_into(initial_data_.c_slice_buffer(),
+                                  buffer->c_slice_buffer());
+      return true;
+    }
+    return endpoint_->Read(std::move(on_read), buffer, args);
+  }
+
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             grpc_event_engine::experimental::SliceBuffer* data,
+             const WriteArgs* args) override {
+    return endpoint_->Write(std::move(on_writable), data, args);
+  }
+
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return endpoint_->GetPeerAddress();
+  }
+
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return endpoint_->GetLocalAddress();
+  }
+
+  void* QueryExtension(absl::string_view id) override {
+    return endpoint_->QueryExtension(id);
+  }
+
+ private:
+  std::unique_ptr<EventEngine::Endpoint> endpoint_;
+  grpc_event_engine::experimental::SliceBuffer initial_data_;
+};
+
 }  // namespace
 
 namespace experimental {
 
+RefCountedPtr<Chttp2ServerListener> PassiveListenerImpl::GetListener() {
+  MutexLock lock(&mu_);
+  if (listener_ == nullptr) return nullptr;
+  return listener_->RefIfNonZero().TakeAsSubclass<Chttp2ServerListener>();
+}
+
 absl::Status PassiveListenerImpl::AcceptConnectedEndpoint(
     std::unique_ptr<EventEngine::Endpoint> endpoint) {
   CHECK_NE(server_.get(), nullptr);
-  RefCountedPtr<Chttp2ServerListener> listener;
-  {
-    MutexLock lock(&mu_);
-    if (listener_ != nullptr) {
-      listener =
-          listener_->RefIfNonZero().TakeAsSubclass<Chttp2ServerListener>();
-    }
-  }
+  RefCountedPtr<Chttp2ServerListener> listener = GetListener();
   if (listener == nullptr) {
     return absl::UnavailableError("passive listener already shut down");
   }
@@ -1062,6 +1261,41 @@ absl::Status PassiveListenerImpl::AcceptConnectedFd(int fd) {
   return AcceptConnectedEndpoint(std::move(endpoint));
 }
 
+std::vector<absl::Status> PassiveListenerImpl::AcceptConnectedFds(
+    std::vector<ConnectedFd> fds) {
+  CHECK_NE(server_.get(), nullptr);
+  ExecCtx exec_ctx;
+  auto& args = server_->channel_args();
+  auto* supports_fd = QueryExtension<EventEngineSupportsFdExtension>(
+      /*engine=*/args.GetObjectRef<EventEngine>().get());
+  if (supports_fd == nullptr) {
+    return std::vector<absl::Status>(
+        fds.size(),
+        absl::UnimplementedError(
+            "The server's EventEngine does not support adding endpoints from "
+            "connected file descriptors."));
+  }
+  const ChannelArgsEndpointConfig config(args);
+  std::vector<std::unique_ptr<EventEngine::Endpoint>> endpoints;
+  endpoints.reserve(fds.size());
+  for (ConnectedFd& fd : fds) {
+    auto endpoint = supports_fd->CreateEndpointFromFd(fd.fd, config);
+    if (fd.initial_data.Length() > 0) {
+      endpoint = std::make_unique<InitialDataEndpoint>(
+          std::move(endpoint), std::move(fd.initial_data));
+    }
+    endpoints.push_back(std::move(endpoint));
+  }
+  RefCountedPtr<Chttp2ServerListener> listener = GetListener();
+  if (listener == nullptr) {
+    return std::vector<absl::Status>(
+        fds.size(),
+        absl::UnavailableError("passive listener already shut down"));
+  }
+  listener->AcceptConnectedEndpoints(std::move(endpoints));
+  return std::vector<absl::Status>(fds.size(), absl::OkStatus());
+}
+
 void PassiveListenerImpl::ListenerDestroyed() {
   MutexLock lock(&mu_);
   listener_ = nullptr;
@@ -20,6 +20,7 @@
 #define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_SERVER_CHTTP2_SERVER_H
 
 #include <functional>
+#include <vector>
 
 #include <grpc/passive_listener.h>
 #include <grpc/support/port_platform.h>
@@ -58,11 +59,17 @@ class PassiveListenerImpl final : public PassiveListener {
   absl::Status AcceptConnectedFd(GRPC_UNUSED int fd) override
       ABSL_LOCKS_EXCLUDED(mu_);
 
+  std::vector<absl::Status> AcceptConnectedFds(std::vector<ConnectedFd> fds)
+      override ABSL_LOCKS_EXCLUDED(mu_);
+
   void ListenerDestroyed() ABSL_LOCKS_EXCLUDED(mu_);
 
  private:
   // note: the grpc_core::Server redundant namespace qualification is
   // required for older gcc versions.
+  // A ref to the listener, or null once it has been shut down.
+  RefCountedPtr<Chttp2ServerListener> GetListener() ABSL_LOCKS_EXCLUDED(mu_);
+
   friend absl::Status(::grpc_server_add_passive_listener)(
       grpc_core::Server* server, grpc_server_credentials* credentials,
       std::shared_ptr<grpc_core::experimental::PassiveListenerImpl>
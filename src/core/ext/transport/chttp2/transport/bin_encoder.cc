@@ -94,79 +94,94 @@ grpc_slice grpc_chttp2_base64_encode(const grpc_slice& input) {
   return output;
 }
 
-grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
-  size_t nbits;
-  const uint8_t* in;
-  uint8_t* out;
-  grpc_slice output;
-  uint64_t temp = 0;
-  uint32_t temp_length = 0;
-
-  nbits = 0;
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    nbits += grpc_chttp2_huffsyms[*in].length;
+namespace {
+
+// Accumulates huffman codes most significant bit first and stores them to the
+// output a 32 bit word at a time, instead of running a flush loop per byte for
+// every symbol.
+class HuffmanBitWriter {
+ public:
+  explicit HuffmanBitWriter(uint8_t* out) : out_(out) {}
+
+  // Append a code of at most 32 bits.
+  void Add(uint32_t bits, uint32_t length) {
+    DCHECK_LE(length, 32u);
+    temp_ = (temp_ << length) | bits;
+    temp_length_ += length;
+    if (temp_length_ >= 32) {
+      temp_length_ -= 32;
+      const uint32_t word = static_cast<uint32_t>(temp_ >> temp_length_);
+      out_[0] = static_cast<uint8_t>(word >> 24);
+      out_[1] = static_cast<uint8_t>(word >> 16);
+      out_[2] = static_cast<uint8_t>(word >> 8);
+      out_[3] = static_cast<uint8_t>(word);
+      out_ += 4;
+    }
   }
 
-  output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
-  out = GRPC_SLICE_START_PTR(output);
-  for (in = GRPC_SLICE_START_PTR(input); in != GRPC_SLICE_END_PTR(input);
-       ++in) {
-    int sym = *in;
-    temp <<= grpc_chttp2_huffsyms[sym].length;
-    temp |= grpc_chttp2_huffsyms[sym].bits;
-    temp_length += grpc_chttp2_huffsyms[sym].length;
-
-    while (temp_length > 8) {
-      temp_length -= 8;
-      *out++ = static_cast<uint8_t>(temp >> temp_length);
+  // Flush all pending bits, padding the final byte with the most significant
+  // bits of EOS (all ones). Returns the new end of the output.
+  uint8_t* Finish() {
+    while (temp_length_ >= 8) {
+      temp_length_ -= 8;
+      *out_++ = static_cast<uint8_t>(temp_ >> temp_length_);
     }
+    if (temp_length_) {
+      // NB: the following integer arithmetic operation needs to be in its
+      // expanded form due to the "integral promotion" performed (see section
+      // 3.2.1.1 of the C89 draft standard). A cast to the smaller container
+      // type is then required to avoid the compiler warning
+      *out_++ = static_cast<uint8_t>(
+          static_cast<uint8_t>(temp_ << (8u - temp_length_)) |
+          static_cast<uint8_t>(0xffu >> temp_length_));
+      temp_length_ = 0;
+    }
+    return out_;
   }
 
-  if (temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out++ =
-        static_cast<uint8_t>(static_cast<uint8_t>(temp << (8u - temp_length)) |
-                             static_cast<uint8_t>(0xffu >> temp_length));
-  }
+ private:
+  // Invariant: temp_length_ < 32 between calls to Add(), so a full 32 bit code
+  // always fits in the accumulator.
+  uint64_t temp_ = 0;
+  uint32_t temp_length_ = 0;
+  uint8_t* out_;
+};
 
-  CHECK(out == GRPC_SLICE_END_PTR(output));
+}  // namespace
 
-  return output;
-}
+grpc_slice grpc_chttp2_huffman_compress(const grpc_slice& input) {
+  size_t nbits = 0;
+  for (const uint8_t* in = GRPC_SLICE_START_PTR(input);
+       in != GRPC_SLICE_END_PTR(input); ++in) {
+    nbits += grpc_chttp2_huffsyms[*in].length;
+  }
 
-struct huff_out {
-  uint32_t temp;
-  uint32_t temp_length;
-  uint8_t* out;
-};
-static void enc_flush_some(huff_out* out) {
-  while (out->temp_length > 8) {
-    out->temp_length -= 8;
-    *out->out++ = static_cast<uint8_t>(out->temp >> out->temp_length);
+  grpc_slice output = GRPC_SLICE_MALLOC(nbits / 8 + (nbits % 8 != 0));
+  HuffmanBitWriter out(GRPC_SLICE_START_PTR(output));
+  for (const uint8_t* in = GRPC_SLICE_START_PTR(input);
+       in != GRPC_SLICE_END_PTR(input); ++in) {
+    const grpc_chttp2_huffsym& sym = grpc_chttp2_huffsyms[*in];
+    out.Add(sym.bits, sym.length);
   }
+
+  CHECK(out.Finish() == GRPC_SLICE_END_PTR(output));
+
+  return output;
 }
 
-static void enc_add2(huff_out* out, uint8_t a, uint8_t b, uint32_t* wire_size) {
+static void enc_add2(HuffmanBitWriter* out, uint8_t a, uint8_t b,
+                     uint32_t* wire_size) {
   *wire_size += 2;
   b64_huff_sym sa = huff_alphabet[a];
   b64_huff_sym sb = huff_alphabet[b];
-  out->temp = (out->temp << (sa.length + sb.length)) |
-              (static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits;
-  out->temp_length +=
-      static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length);
-  enc_flush_some(out);
+  out->Add((static_cast<uint32_t>(sa.bits) << sb.length) | sb.bits,
+           static_cast<uint32_t>(sa.length) + static_cast<uint32_t>(sb.length));
 }
 
-static void enc_add1(huff_out* out, uint8_t a, uint32_t* wire_size) {
+static void enc_add1(HuffmanBitWriter* out, uint8_t a, uint32_t* wire_size) {
   *wire_size += 1;
   b64_huff_sym sa = huff_alphabet[a];
-  out->temp = (out->temp << sa.length) | sa.bits;
-  out->temp_length += sa.length;
-  enc_flush_some(out);
+  out->Add(sa.bits, sa.length);
 }
 
 grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
@@ -180,12 +195,9 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
   grpc_slice output = GRPC_SLICE_MALLOC(max_output_length);
   const uint8_t* in = GRPC_SLICE_START_PTR(input);
   uint8_t* start_out = GRPC_SLICE_START_PTR(output);
-  huff_out out;
+  HuffmanBitWriter out(start_out);
   size_t i;
 
-  out.temp = 0;
-  out.temp_length = 0;
-  out.out = start_out;
   *wire_size = 0;
 
   // encode full triplets
@@ -219,18 +231,9 @@ grpc_slice grpc_chttp2_base64_encode_and_huffman_compress(
     }
   }
 
-  if (out.temp_length) {
-    // NB: the following integer arithmetic operation needs to be in its
-    // expanded form due to the "integral promotion" performed (see section
-    // 3.2.1.1 of the C89 draft standard). A cast to the smaller container type
-    // is then required to avoid the compiler warning
-    *out.out++ = static_cast<uint8_t>(
-        static_cast<uint8_t>(out.temp << (8u - out.temp_length)) |
-        static_cast<uint8_t>(0xffu >> out.temp_length));
-  }
-
-  CHECK(out.out <= GRPC_SLICE_END_PTR(output));
-  GRPC_SLICE_SET_LENGTH(output, out.out - start_out);
+  uint8_t* end_out = out.Finish();
+  CHECK(end_out <= GRPC_SLICE_END_PTR(output));
+  GRPC_SLICE_SET_LENGTH(output, end_out - start_out);
 
   CHECK(in == GRPC_SLICE_END_PTR(input));
   return output;
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <limits>
 #include <memory>
@@ -43,6 +44,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/time.h"
 #include "absl/types/optional.h"
 #include "absl/types/variant.h"
 
@@ -64,6 +66,7 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/ext/transport/chttp2/transport/keepalive_coordinator.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/ext/transport/chttp2/transport/max_concurrent_streams_policy.h"
 #include "src/core/ext/transport/chttp2/transport/ping_abuse_policy.h"
@@ -73,6 +76,7 @@
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/event_engine/extensions/tcp_trace.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/experiments/experiments.h"
@@ -82,12 +86,14 @@
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/buffer_list.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/ev_posix.h"
 #include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/internal_errqueue.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/port.h"
 #include "src/core/lib/promise/poll.h"
@@ -113,6 +119,10 @@
 #include "src/core/util/string.h"
 #include "src/core/util/useful.h"
 
+#ifdef GRPC_LINUX_ERRQUEUE
+#include <netinet/in.h>
+#endif
+
 #define DEFAULT_CONNECTION_WINDOW_TARGET (1024 * 1024)
 #define MAX_WINDOW 0x7fffffffu
 #define MAX_WRITE_BUFFER_SIZE (64 * 1024 * 1024)
@@ -194,6 +204,10 @@ static void next_bdp_ping_timer_expired(grpc_chttp2_transport* t);
 static void next_bdp_ping_timer_expired_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> tp,
     GRPC_UNUSED grpc_error_handle error);
+static void window_update_coalesce_timer_expired(grpc_chttp2_transport* t);
+static void window_update_coalesce_timer_expired_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error);
 
 static void cancel_pings(grpc_chttp2_transport* t, grpc_error_handle error);
 static void send_ping_locked(grpc_chttp2_transport* t,
@@ -237,17 +251,31 @@ grpc_core::CallTracerAnnotationInterface* CallTracerIfSampled(
   return call_tracer;
 }
 
-std::shared_ptr<grpc_core::TcpTracerInterface> TcpTracerIfSampled(
+// Whether a TCP trace is wanted is up to the call tracer: it may want the
+// timestamps of every call (e.g. to derive latency metrics), not only those of
+// sampled calls.
+std::shared_ptr<grpc_core::TcpTracerInterface> TcpTracerIfEnabled(
     grpc_chttp2_stream* s) {
   if (!grpc_core::IsTraceRecordCallopsEnabled()) {
     return nullptr;
   }
   auto* call_attempt_tracer =
       s->arena->GetContext<grpc_core::CallTracerInterface>();
-  if (call_attempt_tracer == nullptr || !call_attempt_tracer->IsSampled()) {
+  if (call_attempt_tracer == nullptr) {
     return nullptr;
   }
-  return call_attempt_tracer->StartNewTcpTrace();
+  auto tcp_tracer = call_attempt_tracer->StartNewTcpTrace();
+  if (tcp_tracer != nullptr) {
+    // The TCP layer hands the timestamps it collects for a write back to the
+    // transport, which forwards them to the tracers of the traced streams.
+    static const bool registered = []() {
+      grpc_core::grpc_tcp_set_write_timestamps_callback(
+          grpc_core::ForEachContextListEntryExecute);
+      return true;
+    }();
+    (void)registered;
+  }
+  return tcp_tracer;
 }
 
 grpc_core::WriteTimestampsCallback g_write_timestamps_callback = nullptr;
@@ -310,10 +338,37 @@ WriteTimestampsCallback GrpcHttp2GetWriteTimestampsCallback() {
 
 CopyContextFn GrpcHttp2GetCopyContextFn() { return g_get_copied_context_fn; }
 
+namespace {
+
+// Forwards the timestamps collected for a write to \a tcp_tracer, in the
+// order the events happened. Timestamps that were not collected are skipped.
+void RecordTcpTimestamps(TcpTracerInterface* tcp_tracer, const Timestamps& ts,
+                         size_t byte_offset) {
+  const std::pair<TcpTracerInterface::Type, const BufferTimestamp*> events[] = {
+      {TcpTracerInterface::Type::kSendMsg, &ts.sendmsg_time},
+      {TcpTracerInterface::Type::kScheduled, &ts.scheduled_time},
+      {TcpTracerInterface::Type::kSent, &ts.sent_time},
+      {TcpTracerInterface::Type::kAcked, &ts.acked_time},
+  };
+  for (const auto& event : events) {
+    if (gpr_time_cmp(event.second->time, gpr_inf_past(GPR_CLOCK_REALTIME)) ==
+        0) {
+      continue;
+    }
+    const gpr_timespec& time = event.second->time;
+    tcp_tracer->RecordEvent(event.first,
+                            absl::FromUnixSeconds(time.tv_sec) +
+                                absl::Nanoseconds(time.tv_nsec),
+                            byte_offset, absl::nullopt);
+  }
+}
+
+}  // namespace
+
 // For each entry in the passed ContextList, it executes the function set using
 // GrpcHttp2SetWriteTimestampsCallback method with each context in the list
-// and \a ts. It also deletes/frees up the passed ContextList after this
-// operation.
+// and \a ts, and records \a ts on the entry's TCP tracer, if any. It also
+// deletes/frees up the passed ContextList after this operation.
 void ForEachContextListEntryExecute(void* arg, Timestamps* ts,
                                     grpc_error_handle error) {
   ContextList* context_list = reinterpret_cast<ContextList*>(arg);
@@ -325,7 +380,14 @@ void ForEachContextListEntryExecute(void* arg, Timestamps* ts,
     if (ts) {
       ts->byte_offset = static_cast<uint32_t>(entry.ByteOffsetInStream());
     }
-    g_write_timestamps_callback(entry.TraceContext(), ts, error);
+    std::shared_ptr<TcpTracerInterface> tcp_tracer = entry.ReleaseTcpTracer();
+    if (tcp_tracer != nullptr && ts != nullptr) {
+      RecordTcpTimestamps(tcp_tracer.get(), *ts, entry.ByteOffsetInStream());
+    }
+    if (entry.TraceContext() != nullptr &&
+        g_write_timestamps_callback != nullptr) {
+      g_write_timestamps_callback(entry.TraceContext(), ts, error);
+    }
   }
   delete context_list;
 }
@@ -459,6 +521,20 @@ static void read_channel_args(grpc_chttp2_transport* t,
   if (max_hpack_table_size >= 0) {
     t->hpack_compressor.SetMaxUsableSize(max_hpack_table_size);
   }
+  t->hpack_compressor.SetAdaptiveIndexing(
+      channel_args.GetBool("grpc.http2.hpack_adaptive_indexing")
+          .value_or(false));
+  t->hpack_compressor.SetHeaderBlockCaching(
+      channel_args.GetBool("grpc.http2.hpack_header_block_cache")
+          .value_or(false));
+  t->flow_control.SetReadRateStreamWindows(
+      channel_args.GetBool("grpc.http2.read_rate_stream_windows")
+          .value_or(false));
+  if (channel_args.GetBool("grpc.http2.send_queue_aware_write_size")
+          .value_or(false)) {
+    t->write_size_policy =
+        std::make_unique<grpc_core::Chttp2SendQueueAwareWriteSizePolicy>();
+  }
 
   t->write_buffer_size =
       std::max(0, channel_args.GetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE)
@@ -485,6 +561,14 @@ static void read_channel_args(grpc_chttp2_transport* t,
     t->keepalive_permit_without_calls =
         channel_args.GetBool(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS)
             .value_or(g_default_client_keepalive_permit_without_calls);
+    t->keepalive_max_skipped_pings = std::max(
+        0, channel_args.GetInt(GRPC_ARG_EXPERIMENTAL_HTTP2_SHARED_KEEPALIVE)
+               .value_or(0));
+    if (t->keepalive_time != grpc_core::Duration::Infinity() &&
+        t->keepalive_max_skipped_pings > 0) {
+      t->keepalive_peer = grpc_core::Chttp2KeepaliveCoordinator::Get()->GetPeer(
+          t->peer_string.as_string_view());
+    }
   } else {
     t->keepalive_permit_without_calls =
         channel_args.GetBool(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS)
@@ -513,6 +597,25 @@ static void read_channel_args(grpc_chttp2_transport* t,
     t->max_requests_per_read = 32;
   }
 
+  if (channel_args.GetBool("grpc.http2.fair_write_scheduling")
+          .value_or(false)) {
+    t->write_scheduler_quantum = grpc_core::Clamp(
+        channel_args.GetInt("grpc.http2.write_scheduler_quantum_bytes")
+            .value_or(16384),
+        1, 16777215);
+  }
+
+  t->write_coalesce_max_copy_bytes = grpc_core::Clamp(
+      channel_args.GetInt("grpc.http2.write_coalesce_max_copy_bytes")
+          .value_or(0),
+      0, 16384);
+
+  t->window_update_coalesce_delay = grpc_core::Clamp(
+      channel_args
+          .GetDurationFromIntMillis("grpc.http2.window_update_coalesce_ms")
+          .value_or(grpc_core::Duration::Zero()),
+      grpc_core::Duration::Zero(), grpc_core::Duration::Seconds(1));
+
   if (channel_args.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
           .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT)) {
     t->channelz_socket =
@@ -525,6 +628,36 @@ static void read_channel_args(grpc_chttp2_transport* t,
                 .GetObjectRef<grpc_core::channelz::SocketNode::Security>());
   }
 
+  const auto tcp_info_sample_period =
+      channel_args.GetDurationFromIntMillis(GRPC_ARG_TCP_INFO_SAMPLE_PERIOD_MS);
+  if (tcp_info_sample_period.has_value() &&
+      *tcp_info_sample_period > grpc_core::Duration::Zero() &&
+      grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          t->ep.get())) {
+    using grpc_event_engine::experimental::EndpointTcpInfoExtension;
+    auto* tcp_info = grpc_event_engine::experimental::QueryExtension<
+        EndpointTcpInfoExtension>(
+        grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+            t->ep.get()));
+    if (tcp_info != nullptr) {
+      tcp_info->EnableTcpInfoSampling(
+          std::chrono::milliseconds(tcp_info_sample_period->millis()),
+          [socket = t->channelz_socket](
+              const EndpointTcpInfoExtension::TcpInfo& sample) {
+            if (socket == nullptr) return;
+            grpc_core::channelz::SocketNode::TcpInfo info;
+            info.rtt_us = sample.rtt_us;
+            info.rtt_var_us = sample.rtt_var_us;
+            info.min_rtt_us = sample.min_rtt_us;
+            info.snd_cwnd = sample.snd_cwnd;
+            info.total_retrans = sample.total_retrans;
+            info.pacing_rate = sample.pacing_rate;
+            info.delivery_rate = sample.delivery_rate;
+            socket->SetTcpInfo(info);
+          });
+    }
+  }
+
   t->ack_pings = channel_args.GetBool("grpc.http2.ack_pings").value_or(true);
 
   t->allow_tarpit =
@@ -586,6 +719,10 @@ static void read_channel_args(grpc_chttp2_transport* t,
   t->max_concurrent_streams_overload_protection =
       channel_args.GetBool(GRPC_ARG_MAX_CONCURRENT_STREAMS_OVERLOAD_PROTECTION)
           .value_or(true);
+
+  t->coalesced_read_threshold = std::max(
+      0, channel_args.GetInt(GRPC_ARG_HTTP2_COALESCED_READ_THRESHOLD_BYTES)
+             .value_or(0));
 }
 
 static void init_keepalive_pings_if_enabled_locked(
@@ -608,6 +745,7 @@ static void init_keepalive_pings_if_enabled_locked(
 }
 
 using grpc_event_engine::experimental::QueryExtension;
+using grpc_event_engine::experimental::ReceiveCoalescingExtension;
 using grpc_event_engine::experimental::TcpTraceExtension;
 
 grpc_chttp2_transport::grpc_chttp2_transport(
@@ -618,7 +756,7 @@ grpc_chttp2_transport::grpc_chttp2_transport(
           grpc_core::Slice::FromCopiedString(grpc_endpoint_get_peer(ep.get()))),
       memory_owner(channel_args.GetObject<grpc_core::ResourceQuota>()
                        ->memory_quota()
-                       ->CreateMemoryOwner()),
+                       ->CreateMemoryOwner("chttp2_transport")),
       self_reservation(
           memory_owner.MakeReservation(sizeof(grpc_chttp2_transport))),
       event_engine(
@@ -671,6 +809,17 @@ grpc_chttp2_transport::grpc_chttp2_transport(
 
   read_channel_args(this, channel_args, is_client);
 
+  if (coalesced_read_threshold > 0 &&
+      grpc_event_engine::experimental::grpc_is_event_engine_endpoint(
+          ep.get())) {
+    receive_coalescing = QueryExtension<ReceiveCoalescingExtension>(
+        grpc_event_engine::experimental::grpc_get_wrapped_event_engine_endpoint(
+            ep.get()));
+    if (receive_coalescing != nullptr) {
+      receive_coalescing->EnforceRxMemoryAlignment();
+    }
+  }
+
   // Initially allow *UP TO* MAX_CONCURRENT_STREAMS incoming before we start
   // blanket cancelling them.
   num_incoming_streams_before_settings_ack =
@@ -759,6 +908,10 @@ static void close_transport_locked(grpc_chttp2_transport* t,
         t->event_engine->Cancel(t->next_bdp_ping_timer_handle)) {
       t->next_bdp_ping_timer_handle = TaskHandle::kInvalid;
     }
+    if (t->window_update_coalesce_timer_handle != TaskHandle::kInvalid &&
+        t->event_engine->Cancel(t->window_update_coalesce_timer_handle)) {
+      t->window_update_coalesce_timer_handle = TaskHandle::kInvalid;
+    }
     switch (t->keepalive_state) {
       case GRPC_CHTTP2_KEEPALIVE_STATE_WAITING:
         if (t->keepalive_ping_timer_handle != TaskHandle::kInvalid &&
@@ -1082,13 +1235,40 @@ static void write_action(grpc_chttp2_transport* t) {
   GRPC_TRACE_LOG(http2_ping, INFO)
       << (t->is_client ? "CLIENT" : "SERVER") << "[" << t << "]: Write "
       << t->outbuf.Length() << " bytes";
-  t->write_size_policy.BeginWrite(t->outbuf.Length());
+  t->write_size_policy->BeginWrite(t->outbuf.Length());
   grpc_endpoint_write(t->ep.get(), t->outbuf.c_slice_buffer(),
                       grpc_core::InitTransportClosure<write_action_end>(
                           t->Ref(), &t->write_action_end_locked),
                       cl, max_frame_size);
 }
 
+// Read how much data the kernel holds for the transport's socket, if it is a
+// TCP socket we can query.
+static bool read_send_queue_state(
+    grpc_chttp2_transport* t,
+    grpc_core::Chttp2WriteSizePolicy::SendQueueState* state) {
+#ifdef GRPC_LINUX_ERRQUEUE
+  const int fd = grpc_endpoint_get_fd(t->ep.get());
+  if (fd < 0) return false;
+  grpc_core::tcp_info info;
+  memset(&info, 0, sizeof(info));
+  info.length = offsetof(grpc_core::tcp_info, length);
+  if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &info.length) != 0 ||
+      info.length <= offsetof(grpc_core::tcp_info, tcpi_notsent_bytes)) {
+    return false;
+  }
+  state->congestion_window =
+      static_cast<size_t>(info.tcpi_snd_cwnd) * info.tcpi_snd_mss;
+  state->unacked = static_cast<size_t>(info.tcpi_unacked) * info.tcpi_snd_mss;
+  state->notsent = info.tcpi_notsent_bytes;
+  return true;
+#else
+  (void)t;
+  (void)state;
+  return false;
+#endif
+}
+
 static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
                              grpc_error_handle error) {
   auto* tp = t.get();
@@ -1104,7 +1284,13 @@ static void write_action_end(grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
 static void write_action_end_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
     grpc_error_handle error) {
-  t->write_size_policy.EndWrite(error.ok());
+  t->write_size_policy->EndWrite(error.ok());
+  if (error.ok() && t->write_size_policy->WantsSendQueueState()) {
+    grpc_core::Chttp2WriteSizePolicy::SendQueueState state;
+    if (read_send_queue_state(t.get(), &state)) {
+      t->write_size_policy->UpdateSendQueueState(state);
+    }
+  }
 
   bool closed = false;
   if (!error.ok()) {
@@ -1376,7 +1562,12 @@ static void perform_stream_op_locked(void* stream_op,
   if (!grpc_core::IsCallTracerInTransportEnabled()) {
     s->call_tracer = CallTracerIfSampled(s);
   }
-  s->tcp_tracer = TcpTracerIfSampled(s);
+  // Keep the tracer of the last batch that sent something: the timestamps of
+  // the bytes it wrote are reported to it.
+  if (op->send_initial_metadata || op->send_message ||
+      op->send_trailing_metadata) {
+    s->tcp_tracer = TcpTracerIfEnabled(s);
+  }
   if (GRPC_TRACE_FLAG_ENABLED(http)) {
     LOG(INFO) << "perform_stream_op_locked[s=" << s << "; op=" << op
               << "]: " << grpc_transport_stream_op_batch_string(op, false)
@@ -1484,8 +1675,6 @@ static void perform_stream_op_locked(void* stream_op,
 
   if (op->send_message) {
     t->num_messages_in_next_write++;
-    grpc_core::global_stats().IncrementHttp2SendMessageSize(
-        op->payload->send_message.send_message->Length());
     on_complete->next_data.scratch |= t->closure_barrier_may_cover_write;
     s->send_message_finished = add_closure_barrier(op->on_complete);
     const uint32_t flags = op_payload->send_message.flags;
@@ -1657,6 +1846,16 @@ void grpc_chttp2_transport::PerformStreamOp(
               << "]: " << grpc_transport_stream_op_batch_string(op, false);
   }
 
+  // Anything that only reads the batch is done here rather than in
+  // perform_stream_op_locked: every stream of the connection queues behind
+  // whatever runs in the combiner. The rest of the batch stays there, since
+  // framing send_message and delivering recv_message both update transport
+  // state (flow control, write scheduling and the write closure barriers).
+  if (op->send_message) {
+    grpc_core::global_stats().IncrementHttp2SendMessageSize(
+        op->payload->send_message.send_message->Length());
+  }
+
   GRPC_CHTTP2_STREAM_REF(s, "perform_stream_op");
   op->handler_private.extra_arg = gs;
   combiner->Run(GRPC_CLOSURE_INIT(&op->handler_private.closure,
@@ -2603,16 +2802,72 @@ static void WithUrgency(grpc_chttp2_transport* t,
   }
 }
 
+// With window update coalescing enabled, a window update that the flow
+// control code wants sent immediately is only queued (to go out with the next
+// write) unless the peer is about to run out of window; a timer bounds how
+// long it can wait for that write.
+static grpc_core::chttp2::FlowControlAction::Urgency MaybeCoalesceWindowUpdate(
+    grpc_chttp2_transport* t,
+    grpc_core::chttp2::FlowControlAction::Urgency urgency, bool critical) {
+  if (urgency !=
+          grpc_core::chttp2::FlowControlAction::Urgency::UPDATE_IMMEDIATELY ||
+      t->window_update_coalesce_delay == grpc_core::Duration::Zero() ||
+      critical) {
+    return urgency;
+  }
+  grpc_core::global_stats().IncrementHttp2WindowUpdatesDeferred();
+  if (t->window_update_coalesce_timer_handle == TaskHandle::kInvalid) {
+    t->window_update_coalesce_timer_handle = t->event_engine->RunAfter(
+        t->window_update_coalesce_delay, [t = t->Ref()] {
+          grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+          grpc_core::ExecCtx exec_ctx;
+          window_update_coalesce_timer_expired(t.get());
+        });
+  }
+  return grpc_core::chttp2::FlowControlAction::Urgency::QUEUE_UPDATE;
+}
+
+static void window_update_coalesce_timer_expired(grpc_chttp2_transport* t) {
+  t->combiner->Run(
+      grpc_core::InitTransportClosure<
+          window_update_coalesce_timer_expired_locked>(
+          t->Ref(), &t->window_update_coalesce_timer_expired_locked),
+      absl::OkStatus());
+}
+
+static void window_update_coalesce_timer_expired_locked(
+    grpc_core::RefCountedPtr<grpc_chttp2_transport> t,
+    GRPC_UNUSED grpc_error_handle error) {
+  DCHECK(error.ok());
+  t->window_update_coalesce_timer_handle = TaskHandle::kInvalid;
+  if (!t->closed_with_error.ok()) return;
+  grpc_chttp2_initiate_write(t.get(),
+                             GRPC_CHTTP2_INITIATE_WRITE_TRANSPORT_FLOW_CONTROL);
+}
+
 void grpc_chttp2_act_on_flowctl_action(
     const grpc_core::chttp2::FlowControlAction& action,
     grpc_chttp2_transport* t, grpc_chttp2_stream* s) {
-  WithUrgency(t, action.send_stream_update(),
+  // The peer has at most a quarter of the window left: don't hold back.
+  const bool stream_window_critical =
+      s == nullptr ||
+      s->flow_control.announced_window_delta() +
+              static_cast<int64_t>(t->flow_control.sent_init_window()) <=
+          static_cast<int64_t>(t->flow_control.sent_init_window()) / 4;
+  const bool transport_window_critical =
+      t->flow_control.announced_window() <=
+      t->flow_control.target_window() / 4;
+  WithUrgency(t,
+              MaybeCoalesceWindowUpdate(t, action.send_stream_update(),
+                                        stream_window_critical),
               GRPC_CHTTP2_INITIATE_WRITE_STREAM_FLOW_CONTROL, [t, s]() {
                 if (s->id != 0 && !s->read_closed) {
                   grpc_chttp2_mark_stream_writable(t, s);
                 }
               });
-  WithUrgency(t, action.send_transport_update(),
+  WithUrgency(t,
+              MaybeCoalesceWindowUpdate(t, action.send_transport_update(),
+                                        transport_window_critical),
               GRPC_CHTTP2_INITIATE_WRITE_TRANSPORT_FLOW_CONTROL, []() {});
   WithUrgency(t, action.send_initial_window_update(),
               GRPC_CHTTP2_INITIATE_WRITE_SEND_SETTINGS, [t, &action]() {
@@ -2734,7 +2989,10 @@ static void read_action_parse_loop_locked(
     close_transport_locked(t.get(), error);
   } else if (t->closed_with_error.ok()) {
     keep_reading = true;
-    // Since we have read a byte, reset the keepalive timer
+    // Since we have read a byte, reset the keepalive timer. The read also
+    // shows this connection alive, so it may again put off its keepalive
+    // pings for the other connections to the peer.
+    t->keepalive_skipped_pings = 0;
     if (t->keepalive_state == GRPC_CHTTP2_KEEPALIVE_STATE_WAITING) {
       maybe_reset_keepalive_ping_timer_locked(t.get());
     }
@@ -2782,6 +3040,19 @@ static void continue_read_action_locked(
     grpc_core::RefCountedPtr<grpc_chttp2_transport> t) {
   const bool urgent = !t->goaway_error.ok();
   auto* tp = t.get();
+  if (tp->receive_coalescing != nullptr) {
+    // With coalescing, the read completes once the rest of the DATA frame is
+    // in a single slice.
+    const bool coalesce = grpc_chttp2_should_coalesce_next_read(tp);
+    if (coalesce != tp->receive_coalescing_enabled) {
+      tp->receive_coalescing_enabled = coalesce;
+      if (coalesce) {
+        tp->receive_coalescing->EnableRpcReceiveCoalescing();
+      } else {
+        tp->receive_coalescing->DisableRpcReceiveCoalescing();
+      }
+    }
+  }
   grpc_endpoint_read(tp->ep.get(), &tp->read_buffer,
                      grpc_core::InitTransportClosure<read_action>(
                          std::move(t), &tp->read_action_locked),
@@ -2853,6 +3124,9 @@ static void finish_bdp_ping_locked(
     return;
   }
   t->bdp_ping_started = false;
+  if (t->keepalive_peer != nullptr) {
+    t->keepalive_peer->OnPingAck(grpc_core::Timestamp::Now());
+  }
   grpc_core::Timestamp next_ping =
       t->flow_control.bdp_estimator()->CompletePing();
   grpc_chttp2_act_on_flowctl_action(t->flow_control.PeriodicUpdate(), t.get(),
@@ -2951,7 +3225,25 @@ static void init_keepalive_ping_locked(
   if (t->destroying || !t->closed_with_error.ok()) {
     t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_DYING;
   } else {
-    if (t->keepalive_permit_without_calls || !t->stream_map.empty()) {
+    // If another connection to the peer got a ping ack within the keepalive
+    // time, put off this connection's ping by a keepalive time. An ack on
+    // another connection says nothing of this one, so it may be put off only
+    // so many times before this connection must ping for itself.
+    const bool skip_ping =
+        t->keepalive_peer != nullptr &&
+        t->keepalive_skipped_pings < t->keepalive_max_skipped_pings &&
+        t->keepalive_peer->AliveSince(grpc_core::Timestamp::Now() -
+                                      t->keepalive_time);
+    if (skip_ping) {
+      ++t->keepalive_skipped_pings;
+      if (GRPC_TRACE_FLAG_ENABLED(http) ||
+          GRPC_TRACE_FLAG_ENABLED(http_keepalive)) {
+        LOG(INFO) << t->peer_string.as_string_view()
+                  << ": Skipping keepalive ping, peer recently acked a ping";
+      }
+    }
+    if (!skip_ping &&
+        (t->keepalive_permit_without_calls || !t->stream_map.empty())) {
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_PINGING;
       send_keepalive_ping_locked(t);
       grpc_chttp2_initiate_write(t.get(),
@@ -2987,6 +3279,9 @@ static void finish_keepalive_ping_locked(
         LOG(INFO) << t->peer_string.as_string_view()
                   << ": Finish keepalive ping";
       }
+      if (t->keepalive_peer != nullptr) {
+        t->keepalive_peer->OnPingAck(grpc_core::Timestamp::Now());
+      }
       t->keepalive_state = GRPC_CHTTP2_KEEPALIVE_STATE_WAITING;
       CHECK(t->keepalive_ping_timer_handle == TaskHandle::kInvalid);
       t->keepalive_ping_timer_handle =
@@ -94,8 +94,8 @@ CopyContextFn GrpcHttp2GetCopyContextFn();
 // Interprets the passed arg as a ContextList type and for each entry in the
 // passed ContextList, it executes the function set using
 // GrpcHttp2SetWriteTimestampsCallback method with each context in the list
-// and \a ts. It also deletes/frees up the passed ContextList after this
-// operation.
+// and \a ts, and records \a ts on the entry's TCP tracer, if any. It also
+// deletes/frees up the passed ContextList after this operation.
 void ForEachContextListEntryExecute(void* arg, Timestamps* ts,
                                     grpc_error_handle error);
 
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <ostream>
 #include <string>
 #include <tuple>
@@ -38,6 +39,8 @@
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/useful.h"
 
 namespace grpc_core {
@@ -50,6 +53,16 @@ namespace {
 
 constexpr const int64_t kMaxWindowUpdateSize = (1u << 31) - 1;
 
+// Memory pressure below which the initial window is not constrained by it.
+constexpr double kAnythingGoesPressure = 0.2;
+
+// How long the application's read rate is measured for at a time, how much
+// reading time the data a slow stream keeps in flight and buffered should
+// cover, and the least it is allowed.
+constexpr Duration kReadRateSampleInterval = Duration::Milliseconds(100);
+constexpr double kReadRateWindowSeconds = 1.0;
+constexpr int64_t kMinReadRateWindow = kDefaultWindow;
+
 }  // namespace
 
 const char* FlowControlAction::UrgencyString(Urgency u) {
@@ -115,6 +128,10 @@ uint32_t TransportFlowControl::DesiredAnnounceSize(bool writing_anyway) const {
   return 0;
 }
 
+double TransportFlowControl::memory_pressure() const {
+  return memory_owner_->GetPressureInfo().pressure_control_value;
+}
+
 void TransportFlowControl::SentUpdate(uint32_t announce) {
   announced_window_ += announce;
 }
@@ -134,6 +151,7 @@ absl::Status StreamFlowControl::IncomingUpdateContext::RecvData(
 
     tfc_upd_.UpdateAnnouncedWindowDelta(&sfc_->announced_window_delta_,
                                         -incoming_frame_size);
+    sfc_->received_bytes_ += incoming_frame_size;
     sfc_->min_progress_size_ -=
         std::min(sfc_->min_progress_size_, incoming_frame_size);
     return absl::OkStatus();
@@ -211,7 +229,6 @@ TransportFlowControl::TargetInitialWindowSizeBasedOnMemoryPressureAndBdp()
   //          │Goes     │BDP          │                        │
   //          0%        20%           50%                      100% memory
   //                                                                pressure
-  const double kAnythingGoesPressure = 0.2;
   const double kAdjustedToBdpPressure = 0.5;
   const double kOneMegabyte = 1024.0 * 1024.0;
   const double kAnythingGoesWindow = std::max(4.0 * kOneMegabyte, bdp);
@@ -282,12 +299,18 @@ FlowControlAction TransportFlowControl::PeriodicUpdate() {
                    ->ComputeNextTargetInitialWindowSizeFromPeriodicUpdate(
                        target_initial_window_size_ /* current target */);
     }
+    const uint32_t initial_window_size =
+        std::min(target, Http2Settings::max_initial_window_size());
+    if (initial_window_size < target_initial_window_size_ &&
+        memory_owner_->GetPressureInfo().pressure_control_value >=
+            kAnythingGoesPressure) {
+      global_stats().IncrementHttp2InitialWindowShrunkForMemoryPressure();
+    }
     // Though initial window 'could' drop to 0, we keep the floor at
     // kMinInitialWindowSize
     UpdateSetting(Http2Settings::initial_window_size_name(),
-                  &target_initial_window_size_,
-                  std::min(target, Http2Settings::max_initial_window_size()),
-                  &action, &FlowControlAction::set_send_initial_window_update);
+                  &target_initial_window_size_, initial_window_size, &action,
+                  &FlowControlAction::set_send_initial_window_update);
     // we target the max of BDP or bandwidth in microseconds.
     UpdateSetting(Http2Settings::max_frame_size_name(), &target_frame_size_,
                   Clamp(target, Http2Settings::min_max_frame_size(),
@@ -342,12 +365,15 @@ void StreamFlowControl::SentUpdate(uint32_t announce) {
 uint32_t StreamFlowControl::DesiredAnnounceSize() const {
   int64_t desired_window_delta = [this]() {
     if (min_progress_size_ == 0) {
-      if (pending_size_.has_value() &&
-          announced_window_delta_ < -*pending_size_) {
-        return -*pending_size_;
-      } else {
-        return announced_window_delta_;
+      if (!pending_size_.has_value()) return announced_window_delta_;
+      // Let the window and the unread data add up to the initial window, or
+      // to the read rate window if that is smaller.
+      int64_t target_delta = -*pending_size_;
+      if (tfc_->read_rate_stream_windows()) {
+        const int64_t init_window = tfc_->acked_init_window();
+        target_delta -= std::max(int64_t{0}, init_window - read_rate_window_);
       }
+      return std::max(announced_window_delta_, target_delta);
     } else {
       return std::min(min_progress_size_, kMaxWindowDelta);
     }
@@ -387,6 +413,45 @@ void StreamFlowControl::IncomingUpdateContext::SetPendingSize(
     int64_t pending_size) {
   CHECK_GE(pending_size, 0);
   sfc_->pending_size_ = pending_size;
+  if (sfc_->tfc_->read_rate_stream_windows()) {
+    sfc_->UpdateReadRate(pending_size);
+  }
+}
+
+void StreamFlowControl::UpdateReadRate(int64_t pending_size) {
+  if (pending_size == 0) {
+    // The application has read everything received: it is not what limits
+    // this stream. Only time spent with data waiting for it is sampled.
+    read_rate_window_ = std::numeric_limits<int64_t>::max();
+    sample_start_ = Timestamp::InfPast();
+    return;
+  }
+  const int64_t consumed = received_bytes_ - pending_size;
+  const Timestamp now = Timestamp::Now();
+  if (sample_start_ == Timestamp::InfPast()) {
+    consumed_at_sample_start_ = consumed;
+    sample_start_ = now;
+    return;
+  }
+  const Duration elapsed = now - sample_start_;
+  if (elapsed < kReadRateSampleInterval) return;
+  const double read_rate =
+      static_cast<double>(consumed - consumed_at_sample_start_) /
+      elapsed.seconds();
+  double window = read_rate * kReadRateWindowSeconds;
+  const double memory_pressure = tfc_->memory_pressure();
+  if (memory_pressure > kAnythingGoesPressure) {
+    window *= std::max(0.0, 1.0 - memory_pressure) /
+              (1.0 - kAnythingGoesPressure);
+  }
+  read_rate_window_ =
+      std::max(kMinReadRateWindow, static_cast<int64_t>(window));
+  consumed_at_sample_start_ = consumed;
+  sample_start_ = now;
+  if (GRPC_TRACE_FLAG_ENABLED(flowctl)) {
+    LOG(INFO) << "[flowctl] stream read rate " << read_rate
+              << " bytes/s, read rate window " << read_rate_window_;
+  }
 }
 
 std::string StreamFlowControl::Stats::ToString() const {
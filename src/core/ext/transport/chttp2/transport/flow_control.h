@@ -23,6 +23,7 @@
 #include <stdint.h>
 
 #include <iosfwd>
+#include <limits>
 #include <string>
 #include <utility>
 
@@ -172,6 +173,18 @@ class TransportFlowControl final {
 
   bool bdp_probe() const { return enable_bdp_probe_; }
 
+  // Bound the data each stream lets its peer send ahead of the application by
+  // how fast the application reads it (see
+  // StreamFlowControl::read_rate_window()), rather than by the initial window
+  // alone.
+  void SetReadRateStreamWindows(bool enabled) {
+    read_rate_stream_windows_ = enabled;
+  }
+  bool read_rate_stream_windows() const { return read_rate_stream_windows_; }
+
+  // Pressure on the transport's memory quota, between 0 and 1.
+  double memory_pressure() const;
+
   // returns an announce if we should send a transport update to our peer,
   // else returns zero; writing_anyway indicates if a write would happen
   // regardless of the send - if it is false and this function returns non-zero,
@@ -350,6 +363,7 @@ class TransportFlowControl final {
 
   /// should we probe bdp?
   const bool enable_bdp_probe_;
+  bool read_rate_stream_windows_ = false;
 
   // bdp estimation
   BdpEstimator bdp_estimator_;
@@ -437,6 +451,11 @@ class StreamFlowControl final {
   int64_t remote_window_delta() const { return remote_window_delta_; }
   int64_t announced_window_delta() const { return announced_window_delta_; }
   int64_t min_progress_size() const { return min_progress_size_; }
+  // With TransportFlowControl::read_rate_stream_windows(), the most data this
+  // stream keeps in flight and buffered unread: about a second's worth at the
+  // rate the application read while data was waiting for it, less under
+  // memory pressure. Unbounded while the application keeps up.
+  int64_t read_rate_window() const { return read_rate_window_; }
 
   // A snapshot of the flow control stats to export.
   struct Stats {
@@ -463,8 +482,15 @@ class StreamFlowControl final {
   int64_t remote_window_delta_ = 0;
   int64_t announced_window_delta_ = 0;
   absl::optional<int64_t> pending_size_;
+  // Read rate sampling: bytes received on this stream, and how many of them
+  // the application had consumed when the current sample started.
+  int64_t received_bytes_ = 0;
+  int64_t consumed_at_sample_start_ = 0;
+  Timestamp sample_start_ = Timestamp::InfPast();
+  int64_t read_rate_window_ = std::numeric_limits<int64_t>::max();
 
   FlowControlAction UpdateAction(FlowControlAction action);
+  void UpdateReadRate(int64_t pending_size);
 };
 
 class TestOnlyTransportTargetWindowEstimatesMocker {
@@ -18,12 +18,14 @@
 
 #include "src/core/ext/transport/chttp2/transport/frame_data.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "absl/log/check.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_format.h"
 
+#include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/log.h>
 #include <grpc/support/port_platform.h>
@@ -34,6 +36,8 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 absl::Status grpc_chttp2_data_parser_begin_frame(uint8_t flags,
                                                  uint32_t stream_id,
@@ -80,6 +84,38 @@ void grpc_chttp2_encode_data(uint32_t id, grpc_slice_buffer* inbuf,
   call_tracer->RecordOutgoingBytes({header_size, 0, 0});
 }
 
+namespace {
+
+// Alignment of the slices holding messages above the coalesced read threshold.
+constexpr uintptr_t kCoalescedMessageAlignment = 64;
+
+// Moves the first \a length bytes of \a slices to \a out as a single slice
+// aligned on kCoalescedMessageAlignment. They are only copied if the endpoint
+// did not already read them into such a slice.
+void MoveFirstIntoAlignedSlice(grpc_slice_buffer* slices, size_t length,
+                               grpc_slice_buffer* out) {
+  const grpc_slice& first = slices->slices[0];
+  if (first.refcount != nullptr && GRPC_SLICE_LENGTH(first) >= length &&
+      reinterpret_cast<uintptr_t>(GRPC_SLICE_START_PTR(first)) %
+              kCoalescedMessageAlignment ==
+          0) {
+    grpc_slice_buffer_move_first_no_inline(slices, length, out);
+    return;
+  }
+  grpc_core::global_stats().IncrementHttp2RecvCoalescedMessageCopies();
+  grpc_slice slice =
+      grpc_slice_malloc_large(length + kCoalescedMessageAlignment - 1);
+  const size_t offset =
+      -reinterpret_cast<uintptr_t>(GRPC_SLICE_START_PTR(slice)) &
+      (kCoalescedMessageAlignment - 1);
+  slice = grpc_slice_sub_no_ref(slice, offset, offset + length);
+  grpc_slice_buffer_move_first_into_buffer(slices, length,
+                                           GRPC_SLICE_START_PTR(slice));
+  grpc_slice_buffer_add(out, slice);
+}
+
+}  // namespace
+
 grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
     grpc_chttp2_stream* s, int64_t* min_progress_size,
     grpc_core::SliceBuffer* stream_out, uint32_t* message_flags) {
@@ -128,7 +164,22 @@ grpc_core::Poll<grpc_error_handle> grpc_deframe_unprocessed_incoming_frames(
   if (stream_out != nullptr) {
     s->call_tracer_wrapper.RecordIncomingBytes({5, length, 0});
     grpc_slice_buffer_move_first_into_buffer(slices, 5, header);
-    grpc_slice_buffer_move_first(slices, length, stream_out->c_slice_buffer());
+    if (s->t->coalesced_read_threshold > 0 &&
+        length >= s->t->coalesced_read_threshold) {
+      MoveFirstIntoAlignedSlice(slices, length, stream_out->c_slice_buffer());
+      return absl::OkStatus();
+    }
+    // Hand the payload over as references into the read buffers, even where
+    // the message starts or ends part way into a slice: never copy the pieces
+    // left over at a boundary into inlined slices.
+    grpc_slice_buffer* out = stream_out->c_slice_buffer();
+    const size_t first_new_slice = out->count;
+    grpc_slice_buffer_move_first_no_inline(slices, length, out);
+    for (size_t i = first_new_slice; i < out->count; i++) {
+      if (out->slices[i].refcount == nullptr) {
+        grpc_core::global_stats().IncrementHttp2RecvDataCopiedSlices();
+      }
+    }
   }
 
   return absl::OkStatus();
@@ -20,6 +20,8 @@
 
 #include <stddef.h>
 
+#include <utility>
+
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/random/distributions.h"
@@ -36,6 +38,7 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/transport/http2_errors.h"
 #include "src/core/lib/transport/metadata_batch.h"
 
@@ -78,6 +81,34 @@ void grpc_chttp2_add_rst_stream_to_next_write(
                         grpc_chttp2_rst_stream_create(id, code, call_tracer));
 }
 
+static grpc_error_handle make_rst_stream_error(grpc_error_handle base,
+                                               uint32_t reason) {
+  return grpc_error_set_int(
+      grpc_error_set_str(
+          std::move(base), grpc_core::StatusStrProperty::kGrpcMessage,
+          absl::StrCat("Received RST_STREAM with error code ", reason)),
+      grpc_core::StatusIntProperty::kHttp2Error, static_cast<intptr_t>(reason));
+}
+
+// Peers reset streams in bulk when their calls are cancelled or time out, so
+// the errors for the standard codes are built once and shared, unless the
+// call_error tracer wants each to record where and when it was created.
+grpc_error_handle grpc_chttp2_rst_stream_error(uint32_t reason) {
+  static constexpr uint32_t kNumSharedErrors =
+      GRPC_HTTP2_INADEQUATE_SECURITY + 1;
+  if (reason >= kNumSharedErrors || grpc_error_detail_enabled()) {
+    return make_rst_stream_error(GRPC_ERROR_CREATE("RST_STREAM"), reason);
+  }
+  static const grpc_error_handle* const shared_errors = []() {
+    auto* errors = new grpc_error_handle[kNumSharedErrors];
+    for (uint32_t i = 0; i < kNumSharedErrors; ++i) {
+      errors[i] = make_rst_stream_error(absl::UnknownError("RST_STREAM"), i);
+    }
+    return errors;
+  }();
+  return shared_errors[reason];
+}
+
 grpc_error_handle grpc_chttp2_rst_stream_parser_begin_frame(
     grpc_chttp2_rst_stream_parser* parser, uint32_t length, uint8_t flags) {
   if (length != 4) {
@@ -119,13 +150,7 @@ grpc_error_handle grpc_chttp2_rst_stream_parser_parse(void* parser,
     }
     grpc_error_handle error;
     if (reason != GRPC_HTTP2_NO_ERROR || s->trailing_metadata_buffer.empty()) {
-      error = grpc_error_set_int(
-          grpc_error_set_str(
-              GRPC_ERROR_CREATE("RST_STREAM"),
-              grpc_core::StatusStrProperty::kGrpcMessage,
-              absl::StrCat("Received RST_STREAM with error code ", reason)),
-          grpc_core::StatusIntProperty::kHttp2Error,
-          static_cast<intptr_t>(reason));
+      error = grpc_chttp2_rst_stream_error(reason);
     }
     if (!t->is_client &&
         absl::Bernoulli(t->bitgen, t->ping_on_rst_stream_percent / 100.0)) {
@@ -44,6 +44,9 @@ void grpc_chttp2_add_rst_stream_to_next_write(
     grpc_chttp2_transport* t, uint32_t id, uint32_t code,
     grpc_core::CallTracerInterface* call_tracer);
 
+// The error that a stream fails with when the peer resets it with \a reason.
+grpc_error_handle grpc_chttp2_rst_stream_error(uint32_t reason);
+
 grpc_error_handle grpc_chttp2_rst_stream_parser_begin_frame(
     grpc_chttp2_rst_stream_parser* parser, uint32_t length, uint8_t flags);
 grpc_error_handle grpc_chttp2_rst_stream_parser_parse(void* parser,
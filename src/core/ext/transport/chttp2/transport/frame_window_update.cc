@@ -30,6 +30,8 @@
 
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
 #include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 grpc_slice grpc_chttp2_window_update_create(
     uint32_t id, uint32_t window_delta,
@@ -99,6 +101,7 @@ grpc_error_handle grpc_chttp2_window_update_parser_parse(
           absl::StrCat("invalid window update bytes: ", p->amount));
     }
     CHECK(is_last);
+    grpc_core::global_stats().IncrementHttp2WindowUpdatesReceived();
 
     if (t->incoming_stream_id != 0) {
       if (s != nullptr) {
@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <cstdint>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 
@@ -309,6 +310,16 @@ void Encoder::EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
   output_.Append(emit.data());
 }
 
+void Encoder::EmitLitHdrWithNonBinaryStringKeyNeverIdx(Slice key_slice,
+                                                       Slice value_slice) {
+  StringKey key(std::move(key_slice));
+  key.WritePrefix(0x10, output_.AddTiny(key.prefix_length()));
+  output_.Append(key.key());
+  NonBinaryStringValue emit(std::move(value_slice));
+  emit.WritePrefix(output_.AddTiny(emit.prefix_length()));
+  output_.Append(emit.data());
+}
+
 void Encoder::AdvertiseTableSizeChange() {
   VarintWriter<3> w(compressor_->table_.max_size());
   w.Write(0x20, output_.AddTiny(w.length()));
@@ -358,9 +369,129 @@ void SliceIndex::EmitTo(absl::string_view key, const Slice& value,
   values_.emplace_back(value.Ref(), index);
 }
 
+AdaptiveIndexer::Mode AdaptiveIndexer::Classify(uint32_t repeats,
+                                                uint32_t samples) {
+  if (repeats * 2 >= samples) return Mode::kIndexed;
+  if (repeats == 0) return Mode::kNeverIndexed;
+  return Mode::kNotIndexed;
+}
+
+AdaptiveIndexer::Mode AdaptiveIndexer::ModeForKey(absl::string_view key) const {
+  auto it = keys_.find(key);
+  if (it == keys_.end()) return Mode::kLearning;
+  return it->second.mode;
+}
+
+void AdaptiveIndexer::EmitTo(const Slice& key, const Slice& value,
+                             Encoder* encoder) {
+  auto it = keys_.find(key.as_string_view());
+  if (it == keys_.end()) {
+    if (keys_.size() >= kMaxTrackedKeys) {
+      ++stats_.literals_not_indexed;
+      encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+      return;
+    }
+    it = keys_.emplace(std::string(key.as_string_view()), KeyState()).first;
+  }
+  KeyState& state = it->second;
+  // Note whether this value was seen recently, then reclassify the key once
+  // per sample window.
+  const size_t hash = absl::Hash<absl::string_view>()(value.as_string_view());
+  const size_t* recent_begin = state.recent_hashes;
+  const size_t* recent_end = recent_begin + state.num_recent;
+  const bool repeated = std::find(recent_begin, recent_end, hash) != recent_end;
+  state.recent_hashes[state.samples % kNumRecentValues] = hash;
+  state.num_recent =
+      std::min<uint32_t>(state.num_recent + 1, kNumRecentValues);
+  ++state.samples;
+  if (repeated) ++state.repeats;
+  if (state.samples == kSampleWindow) {
+    state.mode = Classify(state.repeats, state.samples);
+    if (state.mode != Mode::kIndexed) state.values.clear();
+    state.samples = 0;
+    state.repeats = 0;
+  }
+  switch (state.mode) {
+    case Mode::kIndexed:
+      EmitIndexed(state, key, value, encoder);
+      return;
+    case Mode::kNeverIndexed:
+      ++stats_.literals_never_indexed;
+      encoder->EmitLitHdrWithNonBinaryStringKeyNeverIdx(key.Ref(),
+                                                        value.Ref());
+      return;
+    case Mode::kLearning:
+    case Mode::kNotIndexed:
+      ++stats_.literals_not_indexed;
+      encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+      return;
+  }
+}
+
+void AdaptiveIndexer::EmitIndexed(KeyState& state, const Slice& key,
+                                  const Slice& value, Encoder* encoder) {
+  if (hpack_constants::SizeForEntry(key.size(), value.size()) >
+      HPackEncoderTable::MaxEntrySize()) {
+    ++stats_.literals_not_indexed;
+    encoder->EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+    return;
+  }
+  auto& table = encoder->hpack_table();
+  for (auto& v : state.values) {
+    if (v.value != value) continue;
+    if (table.ConvertableToDynamicIndex(v.index)) {
+      ++stats_.dynamic_table_hits;
+      encoder->EmitIndexed(table.DynamicIndex(v.index));
+    } else {
+      ++stats_.dynamic_table_inserts;
+      v.index = encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(),
+                                                                value.Ref());
+    }
+    return;
+  }
+  // Forget values that have been evicted from the table, and the oldest value
+  // if we are still at capacity.
+  state.values.erase(
+      std::remove_if(state.values.begin(), state.values.end(),
+                     [&table](const ValueIndex& v) {
+                       return !table.ConvertableToDynamicIndex(v.index);
+                     }),
+      state.values.end());
+  if (state.values.size() >= kMaxIndexedValuesPerKey) {
+    state.values.erase(state.values.begin());
+  }
+  ++stats_.dynamic_table_inserts;
+  uint32_t index =
+      encoder->EmitLitHdrWithNonBinaryStringKeyIncIdx(key.Ref(), value.Ref());
+  state.values.emplace_back(value.Ref(), index);
+}
+
+const Slice* HeaderBlockCache::Lookup(absl::string_view key,
+                                     uint64_t table_state) const {
+  for (const Entry& entry : entries_) {
+    if (entry.table_state == table_state && entry.key == key) {
+      return &entry.block;
+    }
+  }
+  return nullptr;
+}
+
+void HeaderBlockCache::Insert(std::string key, uint64_t table_state,
+                              Slice block) {
+  Entry entry{std::move(key), table_state, std::move(block)};
+  if (entries_.size() < kMaxEntries) {
+    entries_.push_back(std::move(entry));
+    return;
+  }
+  entries_[next_victim_] = std::move(entry);
+  next_victim_ = (next_victim_ + 1) % kMaxEntries;
+}
+
 void Encoder::Encode(const Slice& key, const Slice& value) {
   if (absl::EndsWith(key.as_string_view(), "-bin")) {
     EmitLitHdrWithBinaryStringKeyNotIdx(key.Ref(), value.Ref());
+  } else if (compressor_->adaptive_indexing_) {
+    compressor_->adaptive_indexer_.EmitTo(key, value, this);
   } else {
     EmitLitHdrWithNonBinaryStringKeyNotIdx(key.Ref(), value.Ref());
   }
@@ -22,9 +22,12 @@
 #include <stddef.h>
 
 #include <cstdint>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -73,6 +76,8 @@ class Encoder {
                                            Slice value_slice);
   void EmitLitHdrWithNonBinaryStringKeyNotIdx(Slice key_slice,
                                               Slice value_slice);
+  void EmitLitHdrWithNonBinaryStringKeyNeverIdx(Slice key_slice,
+                                                Slice value_slice);
 
   void EncodeAlwaysIndexed(uint32_t* index, absl::string_view key, Slice value,
                            size_t transport_length);
@@ -267,6 +272,138 @@ class SliceIndex {
   std::vector<ValueIndex> values_;
 };
 
+// Indexing policy for metadata keys the encoder has no static knowledge of
+// (request ids, trace spans, auth tokens...).
+// Tracks per key how often recently sent values repeat on this connection, and
+// every kSampleWindow values reclassifies the key: keys whose values mostly
+// repeat are indexed in the dynamic table, keys whose values rarely repeat are
+// sent as literals without indexing, and keys whose values never repeat are
+// sent never-indexed so that they stop evicting reusable entries (here and in
+// any intermediary).
+class AdaptiveIndexer {
+ public:
+  enum class Mode : uint8_t { kLearning, kIndexed, kNotIndexed, kNeverIndexed };
+
+  struct Stats {
+    uint64_t dynamic_table_hits = 0;
+    uint64_t dynamic_table_inserts = 0;
+    uint64_t literals_not_indexed = 0;
+    uint64_t literals_never_indexed = 0;
+  };
+
+  // Number of values observed for a key between reclassifications.
+  static constexpr uint32_t kSampleWindow = 32;
+  // Number of recent value hashes remembered per key to detect repeats.
+  static constexpr size_t kNumRecentValues = 8;
+  // Bound on per connection state: keys beyond this are sent not indexed.
+  static constexpr size_t kMaxTrackedKeys = 64;
+  // Number of distinct values per indexed key we remember table indices for.
+  static constexpr size_t kMaxIndexedValuesPerKey = 8;
+
+  void EmitTo(const Slice& key, const Slice& value, Encoder* encoder);
+
+  Mode ModeForKey(absl::string_view key) const;
+  const Stats& stats() const { return stats_; }
+
+ private:
+  struct ValueIndex {
+    ValueIndex(Slice value, uint32_t index)
+        : value(std::move(value)), index(index) {}
+    Slice value;
+    uint32_t index;
+  };
+  struct KeyState {
+    Mode mode = Mode::kLearning;
+    uint32_t samples = 0;
+    uint32_t repeats = 0;
+    uint32_t num_recent = 0;
+    size_t recent_hashes[kNumRecentValues] = {};
+    std::vector<ValueIndex> values;
+  };
+
+  static Mode Classify(uint32_t repeats, uint32_t samples);
+  void EmitIndexed(KeyState& state, const Slice& key, const Slice& value,
+                   Encoder* encoder);
+
+  absl::flat_hash_map<std::string, KeyState> keys_;
+  Stats stats_;
+};
+
+// Collects everything that determines the wire encoding of a header set, to
+// look up previously encoded blocks for the same headers in HeaderBlockCache.
+class HeaderBlockKeyBuilder {
+ public:
+  // Header sets whose key would be larger than this are not cached.
+  static constexpr size_t kMaxKeySize = 1024;
+
+  explicit HeaderBlockKeyBuilder(bool use_true_binary_metadata) {
+    key_.push_back(use_true_binary_metadata ? 1 : 0);
+  }
+
+  void Encode(const Slice& key, const Slice& value) {
+    AppendString(key.as_string_view());
+    AppendString(value.as_string_view());
+  }
+  template <typename MetadataTrait>
+  void Encode(MetadataTrait, const typename MetadataTrait::ValueType& value) {
+    AppendString(MetadataTrait::key());
+    AppendValue(value, std::is_trivially_copyable<
+                           typename MetadataTrait::ValueType>());
+  }
+  // The encoding of a timeout depends on the current time.
+  void Encode(GrpcTimeoutMetadata, Timestamp) { cacheable_ = false; }
+
+  bool cacheable() const { return cacheable_ && key_.size() <= kMaxKeySize; }
+  std::string TakeKey() { return std::move(key_); }
+
+ private:
+  void AppendString(absl::string_view value) {
+    const uint32_t length = static_cast<uint32_t>(value.size());
+    key_.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    key_.append(value.data(), value.size());
+  }
+  void AppendValue(const Slice& value, std::false_type) {
+    AppendString(value.as_string_view());
+  }
+  template <typename T>
+  void AppendValue(const T& value, std::true_type) {
+    key_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+  template <typename T>
+  void AppendValue(const T&, std::false_type) {
+    cacheable_ = false;
+  }
+
+  std::string key_;
+  bool cacheable_ = true;
+};
+
+// Recently encoded header blocks that left the dynamic table untouched, with
+// the table state they were encoded against. Against the same table state the
+// cached bytes are a valid (and identically decoding) encoding of the same
+// headers, so repeated header sets (typically server initial metadata) are
+// emitted as a reference to the cached block instead of being re-encoded.
+class HeaderBlockCache {
+ public:
+  static constexpr size_t kMaxEntries = 8;
+
+  const Slice* Lookup(absl::string_view key, uint64_t table_state) const;
+  void Insert(std::string key, uint64_t table_state, Slice block);
+
+  uint64_t hits() const { return hits_; }
+  void RecordHit() { ++hits_; }
+
+ private:
+  struct Entry {
+    std::string key;
+    uint64_t table_state;
+    Slice block;
+  };
+  std::vector<Entry> entries_;
+  size_t next_victim_ = 0;
+  uint64_t hits_ = 0;
+};
+
 template <typename MetadataTrait>
 class Compressor<MetadataTrait, SmallSetOfValuesCompressor> {
  public:
@@ -349,6 +486,22 @@ class HPackCompressor {
     return table_.test_only_table_size();
   }
 
+  // Enable per key adaptive indexing of unknown metadata (see
+  // hpack_encoder_detail::AdaptiveIndexer).
+  void SetAdaptiveIndexing(bool enabled) { adaptive_indexing_ = enabled; }
+  bool adaptive_indexing() const { return adaptive_indexing_; }
+  const hpack_encoder_detail::AdaptiveIndexer& adaptive_indexer() const {
+    return adaptive_indexer_;
+  }
+
+  // Enable reuse of previously encoded header blocks (see
+  // hpack_encoder_detail::HeaderBlockCache). Has no effect while adaptive
+  // indexing is enabled, since that needs to observe every header sent.
+  void SetHeaderBlockCaching(bool enabled) { header_block_caching_ = enabled; }
+  const hpack_encoder_detail::HeaderBlockCache& header_block_cache() const {
+    return header_block_cache_;
+  }
+
   struct EncodeHeaderOptions {
     uint32_t stream_id;
     bool is_end_of_stream;
@@ -361,11 +514,14 @@ class HPackCompressor {
   bool EncodeHeaders(const EncodeHeaderOptions& options,
                      const HeaderSet& headers, grpc_slice_buffer* output) {
     SliceBuffer raw;
-    hpack_encoder_detail::Encoder encoder(
-        this, options.use_true_binary_metadata, raw);
-    headers.Encode(&encoder);
+    const bool ok =
+        header_block_caching_ && !adaptive_indexing_ &&
+                !advertise_table_size_change_
+            ? EncodeWithHeaderBlockCache(options.use_true_binary_metadata,
+                                         headers, raw)
+            : Encode(options.use_true_binary_metadata, headers, raw);
     Frame(options, raw, output);
-    return !encoder.saw_encoding_errors();
+    return ok;
   }
 
   template <typename HeaderSet>
@@ -383,13 +539,49 @@ class HPackCompressor {
   void Frame(const EncodeHeaderOptions& options, SliceBuffer& raw,
              grpc_slice_buffer* output);
 
+  template <typename HeaderSet>
+  bool Encode(bool use_true_binary_metadata, const HeaderSet& headers,
+              SliceBuffer& raw) {
+    hpack_encoder_detail::Encoder encoder(this, use_true_binary_metadata, raw);
+    headers.Encode(&encoder);
+    return !encoder.saw_encoding_errors();
+  }
+
+  template <typename HeaderSet>
+  bool EncodeWithHeaderBlockCache(bool use_true_binary_metadata,
+                                  const HeaderSet& headers, SliceBuffer& raw) {
+    hpack_encoder_detail::HeaderBlockKeyBuilder key_builder(
+        use_true_binary_metadata);
+    headers.Encode(&key_builder);
+    if (!key_builder.cacheable()) {
+      return Encode(use_true_binary_metadata, headers, raw);
+    }
+    std::string key = key_builder.TakeKey();
+    const uint64_t table_state = table_.state_id();
+    if (const Slice* block = header_block_cache_.Lookup(key, table_state)) {
+      header_block_cache_.RecordHit();
+      raw.Append(block->Ref());
+      return true;
+    }
+    if (!Encode(use_true_binary_metadata, headers, raw)) return false;
+    if (table_.state_id() == table_state) {
+      header_block_cache_.Insert(std::move(key), table_state,
+                                 raw.JoinIntoSlice());
+    }
+    return true;
+  }
+
   // maximum number of bytes we'll use for the decode table (to guard against
   // peers ooming us by setting decode table size high)
   uint32_t max_usable_size_ = hpack_constants::kInitialTableSize;
   // if non-zero, advertise to the decoder that we'll start using a table
   // of this size
   bool advertise_table_size_change_ = false;
+  bool adaptive_indexing_ = false;
+  bool header_block_caching_ = false;
   HPackEncoderTable table_;
+  hpack_encoder_detail::AdaptiveIndexer adaptive_indexer_;
+  hpack_encoder_detail::HeaderBlockCache header_block_cache_;
 
   grpc_metadata_batch::StatefulCompressor<hpack_encoder_detail::Compressor>
       compression_state_;
@@ -62,6 +62,12 @@ class HPackEncoderTable {
   bool ConvertableToDynamicIndex(uint32_t index) const {
     return index > tail_remote_index_;
   }
+  // Identifies the current set of entries (and so the dynamic indices they
+  // have): bytes referencing the table remain valid while this is unchanged.
+  uint64_t state_id() const {
+    return (static_cast<uint64_t>(tail_remote_index_) << 32) |
+           (tail_remote_index_ + table_elems_);
+  }
 
  private:
   void EvictOne();
@@ -570,6 +570,24 @@ class HPackParser::Parser {
         state_(state),
         log_info_(log_info) {}
 
+  // Fast path for a run of indexed fields with inline encoded indices: the
+  // usual shape of header blocks once both peers' tables are warm. Each field
+  // is emitted straight from its table entry without going through the
+  // general per-field state machine. Stops at the first byte that needs the
+  // general path (including unknown indices, so that it reports the error).
+  void ParseIndexedRun() {
+    DCHECK(state_.parse_state == ParseState::kTop);
+    while (!input_->end_of_stream()) {
+      const uint8_t cur = *input_->cur_ptr();
+      if (cur <= 0x80 || cur == 0xff) return;
+      const auto* elem = state_.hpack_table.Lookup(cur & 0x7f);
+      if (GPR_UNLIKELY(elem == nullptr)) return;
+      input_->Advance(1);
+      state_.dynamic_table_updates_allowed = 0;
+      FinishHeaderOmitFromTable(*elem);
+    }
+  }
+
   bool Parse() {
     switch (state_.parse_state) {
       case ParseState::kTop:
@@ -1166,10 +1184,13 @@ void HPackParser::ParseInputInner(Input* input) {
     }
   }
   while (!input->end_of_stream()) {
-    if (GPR_UNLIKELY(
-            !Parser(input, metadata_buffer_, state_, log_info_).Parse())) {
-      return;
+    Parser parser(input, metadata_buffer_, state_, log_info_);
+    if (state_.parse_state == ParseState::kTop) {
+      parser.ParseIndexedRun();
+      input->UpdateFrontier();
+      if (input->end_of_stream()) break;
     }
+    if (GPR_UNLIKELY(!parser.Parse())) return;
     input->UpdateFrontier();
   }
 }
@@ -51,6 +51,7 @@
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/ext/transport/chttp2/transport/http2_settings.h"
+#include "src/core/ext/transport/chttp2/transport/keepalive_coordinator.h"
 #include "src/core/ext/transport/chttp2/transport/legacy_frame.h"
 #include "src/core/ext/transport/chttp2/transport/max_concurrent_streams_policy.h"
 #include "src/core/ext/transport/chttp2/transport/ping_abuse_policy.h"
@@ -59,6 +60,7 @@
 #include "src/core/ext/transport/chttp2/transport/write_size_policy.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/extensions/receive_coalescing.h"
 #include "src/core/lib/gprpp/bitset.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -94,6 +96,9 @@ typedef enum {
   // If a stream is in the following two lists, an explicit ref is associated
   // with the stream
   GRPC_CHTTP2_LIST_WRITABLE,
+  /// writable streams whose pending data fits in one scheduling quantum; only
+  /// used when fair write scheduling is enabled
+  GRPC_CHTTP2_LIST_WRITABLE_SMALL,
   GRPC_CHTTP2_LIST_WRITING,
   // No additional ref is taken for the following refs. Make sure to remove the
   // stream from these lists when the stream is removed.
@@ -350,6 +355,39 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_slice_buffer qbuf;
 
   size_t max_requests_per_read;
+  /// If non-zero, received messages at least this large are handed up in one
+  /// slice aligned on 64 bytes (GRPC_ARG_HTTP2_COALESCED_READ_THRESHOLD_BYTES).
+  uint32_t coalesced_read_threshold = 0;
+  /// Lets the endpoint read the DATA payloads of such messages into aligned
+  /// slices itself. Null if the endpoint does not support it.
+  grpc_event_engine::experimental::ReceiveCoalescingExtension*
+      receive_coalescing = nullptr;
+  /// Whether receive_coalescing is enabled for the next read.
+  bool receive_coalescing_enabled = false;
+  /// If non-zero, at the end of each write cycle adjacent slices in outbuf no
+  /// larger than this many bytes (frame headers, small frames) are packed into
+  /// one contiguous allocation so the endpoint sees far fewer iovecs.
+  size_t write_coalesce_max_copy_bytes = 0;
+  /// If non-zero, writable streams are served deficit round robin with this
+  /// many bytes of DATA per stream per turn, and streams whose whole pending
+  /// payload fits in one quantum are served from a fast lane ahead of bulk
+  /// streams. If zero, writable streams are served FIFO until their windows
+  /// are exhausted.
+  uint32_t write_scheduler_quantum = 0;
+  /// Number of consecutive fast lane streams served since the last bulk stream
+  /// (bounds starvation of bulk streams by a stream of small ones).
+  uint32_t write_scheduler_fast_lane_run = 0;
+  /// If non-zero, WINDOW_UPDATEs that are not yet urgent (the receive window
+  /// is still at least a quarter open) do not initiate a write of their own:
+  /// they are held for up to this long so that they share a write cycle with
+  /// other frames and with each other.
+  grpc_core::Duration window_update_coalesce_delay;
+  /// Forces a write once the oldest deferred WINDOW_UPDATE has waited for
+  /// window_update_coalesce_delay.
+  grpc_event_engine::experimental::EventEngine::TaskHandle
+      window_update_coalesce_timer_handle =
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  grpc_closure window_update_coalesce_timer_expired_locked;
 
   /// Set to a grpc_error object if a goaway frame is received. By default, set
   /// to absl::OkStatus()
@@ -503,7 +541,8 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
   grpc_chttp2_write_state write_state = GRPC_CHTTP2_WRITE_STATE_IDLE;
 
   /// policy for how much data we're willing to put into one http2 write
-  grpc_core::Chttp2WriteSizePolicy write_size_policy;
+  std::unique_ptr<grpc_core::Chttp2WriteSizePolicy> write_size_policy =
+      std::make_unique<grpc_core::Chttp2WriteSizePolicy>();
 
   bool reading_paused_on_pending_induced_frames = false;
   /// Based on channel args, preferred_rx_crypto_frame_sizes are advertised to
@@ -521,6 +560,15 @@ struct grpc_chttp2_transport final : public grpc_core::FilterStackTransport,
 
   /// if keepalive pings are allowed when there's no outstanding streams
   bool keepalive_permit_without_calls = false;
+  /// liveness of the peer shared with the other connections to it, if
+  /// keepalive pings are shared
+  grpc_core::RefCountedPtr<grpc_core::Chttp2KeepaliveCoordinator::Peer>
+      keepalive_peer;
+  /// how many keepalive pings in a row may be skipped because another
+  /// connection to the peer got an ack, and how many were since this
+  /// connection last read anything
+  int keepalive_max_skipped_pings = 0;
+  int keepalive_skipped_pings = 0;
 
   // bdp estimator
   bool bdp_ping_blocked =
@@ -691,6 +739,9 @@ struct grpc_chttp2_stream {
   grpc_chttp2_write_cb* on_write_finished_cbs = nullptr;
   grpc_chttp2_write_cb* finish_after_write = nullptr;
   size_t sending_bytes = 0;
+  /// Remaining DATA byte budget for this stream's current scheduling turn when
+  /// fair write scheduling is enabled.
+  int64_t write_deficit = 0;
 
   /// Byte counter for number of bytes written
   size_t byte_counter = 0;
@@ -929,4 +980,9 @@ void schedule_bdp_ping_locked(
 
 uint32_t grpc_chttp2_min_read_progress_size(grpc_chttp2_transport* t);
 
+// Returns whether the next read is part of the DATA payload of a message of at
+// least coalesced_read_threshold bytes, and should be coalesced by the
+// endpoint.
+bool grpc_chttp2_should_coalesce_next_read(grpc_chttp2_transport* t);
+
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_INTERNAL_H
@@ -0,0 +1,59 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/keepalive_coordinator.h"
+
+#include <utility>
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/no_destruct.h"
+
+namespace grpc_core {
+
+Chttp2KeepaliveCoordinator::Peer::~Peer() {
+  MutexLock lock(&coordinator_->mu_);
+  auto it = coordinator_->peers_.find(address_);
+  // A new peer may have replaced this one while it was being destroyed.
+  if (it != coordinator_->peers_.end() && it->second == this) {
+    coordinator_->peers_.erase(it);
+  }
+}
+
+Chttp2KeepaliveCoordinator* Chttp2KeepaliveCoordinator::Get() {
+  static NoDestruct<Chttp2KeepaliveCoordinator> coordinator;
+  return coordinator.get();
+}
+
+RefCountedPtr<Chttp2KeepaliveCoordinator::Peer>
+Chttp2KeepaliveCoordinator::GetPeer(absl::string_view address) {
+  MutexLock lock(&mu_);
+  auto it = peers_.find(address);
+  if (it != peers_.end()) {
+    RefCountedPtr<Peer> peer = it->second->RefIfNonZero();
+    if (peer != nullptr) return peer;
+    // The last connection to the peer is going away: start anew.
+    peers_.erase(it);
+  }
+  RefCountedPtr<Peer> peer(new Peer(this, std::string(address)));
+  peers_.emplace(peer->address_, peer.get());
+  return peer;
+}
+
+size_t Chttp2KeepaliveCoordinator::TestOnlyNumPeers() {
+  MutexLock lock(&mu_);
+  return peers_.size();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,84 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_KEEPALIVE_COORDINATOR_H
+#define GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_KEEPALIVE_COORDINATOR_H
+
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_core {
+
+// Shares the outcome of keepalive pings between the connections to a same
+// peer (see GRPC_ARG_EXPERIMENTAL_HTTP2_SHARED_KEEPALIVE), so that they can
+// put off their own pings while the peer acks the others'.
+class Chttp2KeepaliveCoordinator {
+ public:
+  // The liveness of one peer, shared by all the connections to it.
+  class Peer : public RefCounted<Peer> {
+   public:
+    ~Peer() override;
+
+    // Notes that a connection to the peer got a ping ack at now.
+    void OnPingAck(Timestamp now) {
+      last_ping_ack_.store(now.milliseconds_after_process_epoch(),
+                           std::memory_order_relaxed);
+    }
+    // Returns true if a connection to the peer got a ping ack after since.
+    bool AliveSince(Timestamp since) const {
+      return last_ping_ack_.load(std::memory_order_relaxed) >
+             since.milliseconds_after_process_epoch();
+    }
+
+   private:
+    friend class Chttp2KeepaliveCoordinator;
+
+    Peer(Chttp2KeepaliveCoordinator* coordinator, std::string address)
+        : coordinator_(coordinator), address_(std::move(address)) {}
+
+    Chttp2KeepaliveCoordinator* const coordinator_;
+    const std::string address_;
+    std::atomic<uint64_t> last_ping_ack_{0};
+  };
+
+  static Chttp2KeepaliveCoordinator* Get();
+
+  // Returns the state of the peer at address, shared with the other
+  // connections to it for as long as they hold it.
+  RefCountedPtr<Peer> GetPeer(absl::string_view address);
+
+  size_t TestOnlyNumPeers();
+
+ private:
+  Mutex mu_;
+  std::map<std::string, Peer*, std::less<>> peers_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_KEEPALIVE_COORDINATOR_H
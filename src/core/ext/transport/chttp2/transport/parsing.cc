@@ -72,6 +72,7 @@
 #include "src/core/lib/transport/http2_errors.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/telemetry/call_phase_timestamps.h"
 #include "src/core/telemetry/call_tracer.h"
 
 using grpc_core::HPackParser;
@@ -143,6 +144,26 @@ uint32_t grpc_chttp2_min_read_progress_size(grpc_chttp2_transport* t) {
   GPR_UNREACHABLE_CODE(return 1);
 }
 
+bool grpc_chttp2_should_coalesce_next_read(grpc_chttp2_transport* t) {
+  if (t->coalesced_read_threshold == 0 || t->deframe_state != GRPC_DTS_FRAME ||
+      t->incoming_frame_type != GRPC_CHTTP2_FRAME_DATA ||
+      t->incoming_stream == nullptr) {
+    return false;
+  }
+  // The size of the message is only known once its length prefix arrived.
+  grpc_slice_buffer* frame_storage = &t->incoming_stream->frame_storage;
+  if (frame_storage->length < 5) return false;
+  uint8_t header[5];
+  grpc_slice_buffer_copy_first_into_buffer(frame_storage, 5, header);
+  const size_t length = (static_cast<uint32_t>(header[1]) << 24) |
+                        (static_cast<uint32_t>(header[2]) << 16) |
+                        (static_cast<uint32_t>(header[3]) << 8) |
+                        static_cast<uint32_t>(header[4]);
+  // If the first message is complete, it is not the one being read.
+  return length >= t->coalesced_read_threshold &&
+         frame_storage->length < length + 5;
+}
+
 namespace {
 struct KnownFlag {
   uint8_t flag;
@@ -741,6 +762,8 @@ static grpc_error_handle init_header_frame_parser(grpc_chttp2_transport* t,
   HPackParser::LogInfo::Type frame_type = HPackParser::LogInfo::kDontKnow;
   switch (s->header_frames_received) {
     case 0:
+      grpc_core::RecordCallPhase(
+          s->arena, grpc_core::CallPhaseTimestamps::Phase::kFirstByteReceived);
       if (t->is_client && t->header_eof) {
         GRPC_CHTTP2_IF_TRACING(INFO) << "parsing Trailers-Only";
         if (s->trailing_metadata_available != nullptr) {
@@ -953,6 +976,11 @@ grpc_error_handle grpc_chttp2_header_parser_parse(void* hpack_parser,
         if (s->header_frames_received == 2) {
           return GRPC_ERROR_CREATE("Too many trailer frames");
         }
+        if (s->header_frames_received == 0) {
+          grpc_core::RecordCallPhase(
+              s->arena,
+              grpc_core::CallPhaseTimestamps::Phase::kInitialMetadataReceived);
+        }
         s->published_metadata[s->header_frames_received] =
             GRPC_METADATA_PUBLISHED_FROM_WIRE;
         maybe_complete_funcs[s->header_frames_received](t, s);
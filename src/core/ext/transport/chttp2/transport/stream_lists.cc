@@ -30,6 +30,8 @@ static const char* stream_list_id_string(grpc_chttp2_stream_list_id id) {
   switch (id) {
     case GRPC_CHTTP2_LIST_WRITABLE:
       return "writable";
+    case GRPC_CHTTP2_LIST_WRITABLE_SMALL:
+      return "writable_small";
     case GRPC_CHTTP2_LIST_WRITING:
       return "writing";
     case GRPC_CHTTP2_LIST_STALLED_BY_TRANSPORT:
@@ -139,20 +141,44 @@ static bool stream_list_add(grpc_chttp2_transport* t, grpc_chttp2_stream* s,
 
 // wrappers for specializations
 
+// With fair write scheduling, the fast lane may serve this many streams in a
+// row before a bulk stream gets a turn.
+static constexpr uint32_t kMaxFastLaneRun = 8;
+
 bool grpc_chttp2_list_add_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream* s) {
   CHECK_NE(s->id, 0u);
-  return stream_list_add(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  if (t->write_scheduler_quantum == 0) {
+    return stream_list_add(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  }
+  if (s->included.is_set(GRPC_CHTTP2_LIST_WRITABLE) ||
+      s->included.is_set(GRPC_CHTTP2_LIST_WRITABLE_SMALL)) {
+    return false;
+  }
+  stream_list_add_tail(
+      t, s,
+      s->flow_controlled_buffer.length <= t->write_scheduler_quantum
+          ? GRPC_CHTTP2_LIST_WRITABLE_SMALL
+          : GRPC_CHTTP2_LIST_WRITABLE);
+  return true;
 }
 
 bool grpc_chttp2_list_pop_writable_stream(grpc_chttp2_transport* t,
                                           grpc_chttp2_stream** s) {
+  if (!stream_list_empty(t, GRPC_CHTTP2_LIST_WRITABLE_SMALL) &&
+      (t->write_scheduler_fast_lane_run < kMaxFastLaneRun ||
+       stream_list_empty(t, GRPC_CHTTP2_LIST_WRITABLE))) {
+    ++t->write_scheduler_fast_lane_run;
+    return stream_list_pop(t, s, GRPC_CHTTP2_LIST_WRITABLE_SMALL);
+  }
+  t->write_scheduler_fast_lane_run = 0;
   return stream_list_pop(t, s, GRPC_CHTTP2_LIST_WRITABLE);
 }
 
 bool grpc_chttp2_list_remove_writable_stream(grpc_chttp2_transport* t,
                                              grpc_chttp2_stream* s) {
-  return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_WRITABLE);
+  return stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_WRITABLE) ||
+         stream_list_maybe_remove(t, s, GRPC_CHTTP2_LIST_WRITABLE_SMALL);
 }
 
 bool grpc_chttp2_list_add_writing_stream(grpc_chttp2_transport* t,
@@ -58,4 +58,15 @@ void Chttp2WriteSizePolicy::EndWrite(bool success) {
   }
 }
 
+size_t Chttp2SendQueueAwareWriteSizePolicy::WriteTargetSize() {
+  const size_t target = Chttp2WriteSizePolicy::WriteTargetSize();
+  if (!have_send_queue_state_) return target;
+  const size_t budget =
+      std::max(kMaxQueuedCongestionWindows * send_queue_state_.congestion_window,
+               MinTarget());
+  const size_t queued = send_queue_state_.notsent;
+  const size_t allowed = budget > queued ? budget - queued : 0;
+  return std::max(std::min(target, allowed), MinTarget());
+}
+
 }  // namespace grpc_core
@@ -26,6 +26,18 @@ namespace grpc_core {
 
 class Chttp2WriteSizePolicy {
  public:
+  // Kernel send queue state of the connection, sampled after a write.
+  struct SendQueueState {
+    // Bytes the congestion window allows in flight.
+    size_t congestion_window = 0;
+    // Bytes sent but not yet acknowledged by the peer.
+    size_t unacked = 0;
+    // Bytes accepted by the kernel that have not been sent yet.
+    size_t notsent = 0;
+  };
+
+  virtual ~Chttp2WriteSizePolicy() = default;
+
   // Smallest possible WriteTargetSize
   static constexpr size_t MinTarget() { return 32 * 1024; }
   // Largest possible WriteTargetSize
@@ -41,13 +53,18 @@ class Chttp2WriteSizePolicy {
   }
 
   // What size should be targetted for the next write.
-  size_t WriteTargetSize();
+  virtual size_t WriteTargetSize();
   // Notify the policy that a write of some size has begun.
   // EndWrite must be called when the write completes.
   void BeginWrite(size_t size);
   // Notify the policy that a write of some size has ended.
   void EndWrite(bool success);
 
+  // Whether the transport should report SendQueueState after each write.
+  virtual bool WantsSendQueueState() const { return false; }
+  // Notify the policy of the send queue state after a write completed.
+  virtual void UpdateSendQueueState(const SendQueueState& /*state*/) {}
+
  private:
   size_t current_target_ = 128 * 1024;
   Timestamp experiment_start_time_ = Timestamp::InfFuture();
@@ -61,6 +78,28 @@ class Chttp2WriteSizePolicy {
   int8_t state_ = 0;
 };
 
+// Write size policy that additionally limits writes so that the data waiting
+// in the kernel stays within a couple of congestion windows: past that point
+// queueing more into the socket only adds latency for frames written later
+// (pings, small streams, window updates), which could otherwise still be
+// scheduled ahead of bulk data inside the transport.
+class Chttp2SendQueueAwareWriteSizePolicy final : public Chttp2WriteSizePolicy {
+ public:
+  // How many congestion windows worth of unsent data we let the kernel hold.
+  static constexpr size_t kMaxQueuedCongestionWindows = 2;
+
+  size_t WriteTargetSize() override;
+  bool WantsSendQueueState() const override { return true; }
+  void UpdateSendQueueState(const SendQueueState& state) override {
+    send_queue_state_ = state;
+    have_send_queue_state_ = true;
+  }
+
+ private:
+  SendQueueState send_queue_state_;
+  bool have_send_queue_state_ = false;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_EXT_TRANSPORT_CHTTP2_TRANSPORT_WRITE_SIZE_POLICY_H
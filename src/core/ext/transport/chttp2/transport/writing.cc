@@ -68,6 +68,7 @@
 #include "src/core/lib/transport/http2_errors.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/telemetry/call_phase_timestamps.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
@@ -300,6 +301,7 @@ class WriteContext {
           t_->outbuf.c_slice_buffer(),
           grpc_chttp2_window_update_create(0, transport_announce, nullptr));
       grpc_chttp2_reset_ping_clock(t_);
+      grpc_core::global_stats().IncrementHttp2WindowUpdatesSent();
     }
   }
 
@@ -364,7 +366,7 @@ class WriteContext {
 
  private:
   grpc_chttp2_transport* const t_;
-  size_t target_write_size_ = t_->write_size_policy.WriteTargetSize();
+  size_t target_write_size_ = t_->write_size_policy->WriteTargetSize();
 
   // stats histogram counters: we increment these throughout this function,
   // and at the end publish to the central stats histograms
@@ -396,10 +398,19 @@ class DataSendContext {
         std::min<int64_t>(
             {t_->settings.peer().max_frame_size(), stream_remote_window(),
              t_->flow_control.remote_window(),
-             static_cast<int64_t>(write_context_->target_write_size())}),
+             static_cast<int64_t>(write_context_->target_write_size()),
+             scheduler_budget()}),
         0, std::numeric_limits<uint32_t>::max());
   }
 
+  // Bytes this stream may still send in its current scheduling turn.
+  int64_t scheduler_budget() const {
+    if (t_->write_scheduler_quantum == 0) {
+      return std::numeric_limits<int64_t>::max();
+    }
+    return s_->write_deficit;
+  }
+
   bool AnyOutgoing() const { return max_outgoing() > 0; }
 
   void FlushBytes() {
@@ -414,6 +425,7 @@ class DataSendContext {
                             t_->outbuf.c_slice_buffer());
     sfc_upd_.SentData(send_bytes);
     s_->sending_bytes += send_bytes;
+    if (t_->write_scheduler_quantum != 0) s_->write_deficit -= send_bytes;
   }
 
   bool is_last_frame() const { return is_last_frame_; }
@@ -477,6 +489,9 @@ class StreamWriteContext {
 
     s_->send_initial_metadata = nullptr;
     s_->sent_initial_metadata = true;
+    grpc_core::RecordCallPhase(
+        s_->arena,
+        grpc_core::CallPhaseTimestamps::Phase::kInitialMetadataWritten);
     write_context_->NoteScheduledResults();
     grpc_chttp2_complete_closure_step(t_, &s_->send_initial_metadata_finished,
                                       absl::OkStatus(),
@@ -523,6 +538,7 @@ class StreamWriteContext {
                                          &s_->call_tracer_wrapper));
     grpc_chttp2_reset_ping_clock(t_);
     write_context_->IncWindowUpdateWrites();
+    grpc_core::global_stats().IncrementHttp2WindowUpdatesSent();
   }
 
   void FlushData() {
@@ -532,6 +548,11 @@ class StreamWriteContext {
       return;  // early out: nothing to do
     }
 
+    // Deficit round robin: every turn tops up the stream's byte budget by one
+    // quantum; budget left over by a stream that keeps data queued carries to
+    // its next turn.
+    s_->write_deficit += t_->write_scheduler_quantum;
+
     DataSendContext data_send_context(write_context_, t_, s_);
 
     if (!data_send_context.AnyOutgoing()) {
@@ -544,6 +565,7 @@ class StreamWriteContext {
         report_stall(t_, s_, "stream");
         grpc_chttp2_list_add_stalled_by_stream(t_, s_);
       }
+      s_->write_deficit = 0;
       return;  // early out: nothing to do
     }
 
@@ -560,6 +582,8 @@ class StreamWriteContext {
     if (s_->flow_controlled_buffer.length > 0) {
       GRPC_CHTTP2_STREAM_REF(s_, "chttp2_writing:fork");
       grpc_chttp2_list_add_writable_stream(t_, s_);
+    } else {
+      s_->write_deficit = 0;
     }
     write_context_->IncMessageWrites();
   }
@@ -647,6 +671,8 @@ class StreamWriteContext {
     }
     grpc_chttp2_mark_stream_closed(t_, s_, !t_->is_client, true,
                                    absl::OkStatus());
+    grpc_core::RecordCallPhase(
+        s_->arena, grpc_core::CallPhaseTimestamps::Phase::kEndOfStreamWritten);
     if (!grpc_core::IsCallTracerInTransportEnabled()) {
       if (s_->call_tracer) {
         s_->call_tracer->RecordAnnotation(
@@ -703,12 +729,19 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
       num_stream_bytes = t->outbuf.c_slice_buffer()->length - orig_len;
       s->byte_counter += static_cast<size_t>(num_stream_bytes);
       ++s->write_counter;
-      if (s->traced && grpc_endpoint_can_track_err(t->ep.get())) {
+      if ((s->traced || s->tcp_tracer != nullptr) &&
+          grpc_endpoint_can_track_err(t->ep.get())) {
+        void* trace_context = nullptr;
         grpc_core::CopyContextFn copy_context_fn =
             grpc_core::GrpcHttp2GetCopyContextFn();
-        if (copy_context_fn != nullptr &&
+        if (s->traced && copy_context_fn != nullptr &&
             grpc_core::GrpcHttp2GetWriteTimestampsCallback() != nullptr) {
-          t->context_list->emplace_back(copy_context_fn(s->arena),
+          trace_context = copy_context_fn(s->arena);
+        }
+        // Streams with a TCP tracer get the timestamps of their bytes even
+        // without a trace context.
+        if (trace_context != nullptr || s->tcp_tracer != nullptr) {
+          t->context_list->emplace_back(trace_context,
                                         outbuf_relative_start_pos,
                                         num_stream_bytes, s->byte_counter,
                                         s->write_counter - 1, s->tcp_tracer);
@@ -730,8 +763,31 @@ grpc_chttp2_begin_write_result grpc_chttp2_begin_write(
 
   ctx.FlushWindowUpdates();
 
+  // Every deferred window update rode along with this write: the coalescing
+  // deadline no longer needs to force one.
+  if (t->window_update_coalesce_timer_handle !=
+          grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid &&
+      t->outbuf.c_slice_buffer()->count > 0 &&
+      t->event_engine->Cancel(t->window_update_coalesce_timer_handle)) {
+    t->window_update_coalesce_timer_handle =
+        grpc_event_engine::experimental::EventEngine::TaskHandle::kInvalid;
+  }
+
+  if (t->channelz_socket != nullptr && t->hpack_compressor.adaptive_indexing()) {
+    const auto& stats = t->hpack_compressor.adaptive_indexer().stats();
+    t->channelz_socket->SetHpackEncoderStats(
+        stats.dynamic_table_hits, stats.dynamic_table_inserts,
+        stats.literals_not_indexed, stats.literals_never_indexed);
+  }
+
   maybe_initiate_ping(t);
 
+  // Frame prefixes and small frames for this whole write cycle end up in one
+  // contiguous arena, payload slices stay referenced: one short iovec list.
+  if (t->write_coalesce_max_copy_bytes > 0) {
+    t->outbuf.CoalesceSmallSlices(t->write_coalesce_max_copy_bytes);
+  }
+
   return ctx.Result();
 }
 
@@ -34,6 +34,7 @@
 #include "src/core/lib/promise/try_seq.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/surface/channel_create.h"
+#include "src/core/lib/transport/message.h"
 #include "src/core/lib/transport/metadata.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server.h"
@@ -115,6 +116,7 @@ class InprocServerTransport final : public ServerTransport {
     auto arena = call_arena_allocator_->MakeArena();
     arena->SetContext<grpc_event_engine::experimental::EventEngine>(
         event_engine_.get());
+    MessageObjectPassthrough::EnableFor(arena.get());
     auto server_call = MakeCallPair(std::move(md), std::move(arena));
     unstarted_call_handler_->StartCall(std::move(server_call.handler));
     return std::move(server_call.initiator);
@@ -267,7 +269,8 @@ RefCountedPtr<Channel> MakeInprocChannel(Server* server,
   auto channel = ChannelCreate(
       "inproc",
       client_channel_args.Set(GRPC_ARG_DEFAULT_AUTHORITY, "inproc.authority")
-          .Set(GRPC_ARG_USE_V3_STACK, true),
+          .Set(GRPC_ARG_USE_V3_STACK, true)
+          .Set(GRPC_ARG_PASS_MESSAGE_OBJECTS, true),
       GRPC_CLIENT_DIRECT_CHANNEL, client_transport.release());
   if (!channel.ok()) {
     return MakeLameChannel("Failed to create client channel", channel.status());
@@ -45,6 +45,9 @@
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/event_engine_shims/endpoint.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 using ::grpc_event_engine::experimental::EventEngine;
 
@@ -132,10 +135,65 @@ void HandshakeManager::DoHandshake(
         // HandshakeManager deletion might require an active ExecCtx.
         self.reset();
       });
+  // Server-side handshakes wait for the handshake quota to admit them.
+  ResourceQuota* resource_quota = args_.args.GetObject<ResourceQuota>();
+  if (acceptor != nullptr && resource_quota != nullptr) {
+    handshake_quota_ = resource_quota->handshake_quota();
+    peer_ = std::string(grpc_endpoint_get_peer(args_.endpoint.get()));
+    uint64_t ticket;
+    auto admission = handshake_quota_->Admit(
+        peer_, resource_quota->memory_quota().get(),
+        [self = Ref(), event_engine = args_.event_engine]() mutable {
+          event_engine->Run([self = std::move(self)]() mutable {
+            ApplicationCallbackExecCtx callback_exec_ctx;
+            ExecCtx exec_ctx;
+            {
+              MutexLock lock(&self->mu_);
+              self->OnAdmittedLocked();
+            }
+            // HandshakeManager deletion might require an active ExecCtx.
+            self.reset();
+          });
+        },
+        &ticket);
+    switch (admission) {
+      case HandshakeQuota::Admission::kAdmitted:
+        holds_handshake_slot_ = true;
+        break;
+      case HandshakeQuota::Admission::kQueued:
+        if (GRPC_TRACE_FLAG_ENABLED(handshaker)) {
+          LOG(INFO) << "handshake_manager " << this
+                    << ": queued by handshake quota";
+        }
+        global_stats().IncrementServerHandshakesQueued();
+        queued_ticket_ = ticket;
+        queued_at_ = Timestamp::Now();
+        return;
+      case HandshakeQuota::Admission::kRejected:
+        global_stats().IncrementServerHandshakesRejected();
+        CallNextHandshakerLocked(
+            GRPC_ERROR_CREATE("Too many handshakes in progress"));
+        return;
+    }
+  }
   // Start first handshaker.
   CallNextHandshakerLocked(absl::OkStatus());
 }
 
+void HandshakeManager::OnAdmittedLocked() {
+  if (GRPC_TRACE_FLAG_ENABLED(handshaker)) {
+    LOG(INFO) << "handshake_manager " << this
+              << ": admitted by handshake quota";
+  }
+  global_stats().IncrementServerHandshakeQueueTimeMs(
+      (Timestamp::Now() - queued_at_).millis());
+  queued_ticket_.reset();
+  holds_handshake_slot_ = true;
+  // Runs the first handshaker, or completes the handshake with an error if
+  // it was shut down while it was queued.
+  CallNextHandshakerLocked(absl::OkStatus());
+}
+
 void HandshakeManager::Shutdown(absl::Status error) {
   MutexLock lock(&mu_);
   if (!is_shutdown_) {
@@ -144,6 +202,13 @@ void HandshakeManager::Shutdown(absl::Status error) {
                 << ": Shutdown() called: " << error;
     }
     is_shutdown_ = true;
+    // Take the handshake out of the quota queue. If it was admitted in the
+    // meantime, OnAdmittedLocked() completes it instead.
+    if (queued_ticket_.has_value() &&
+        handshake_quota_->Cancel(*queued_ticket_)) {
+      queued_ticket_.reset();
+      CallNextHandshakerLocked(absl::OkStatus());
+    }
     // Shutdown the handshaker that's currently in progress, if any.
     if (index_ > 0) {
       if (GRPC_TRACE_FLAG_ENABLED(handshaker)) {
@@ -180,6 +245,10 @@ void HandshakeManager::CallNextHandshakerLocked(absl::Status error) {
     // Cancel deadline timer, since we're invoking the on_handshake_done
     // callback now.
     args_.event_engine->Cancel(deadline_timer_handle_);
+    if (holds_handshake_slot_) {
+      handshake_quota_->Release(peer_, error.ok());
+      holds_handshake_slot_ = false;
+    }
     is_shutdown_ = true;
     absl::StatusOr<HandshakerArgs*> result(&args_);
     if (!error.ok()) result = std::move(error);
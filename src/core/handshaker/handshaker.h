@@ -20,11 +20,14 @@
 #define GRPC_SRC_CORE_HANDSHAKER_HANDSHAKER_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
+#include <string>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/inlined_vector.h"
+#include "absl/types/optional.h"
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/slice.h>
@@ -40,6 +43,7 @@
 #include "src/core/lib/iomgr/endpoint.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/tcp_server.h"
+#include "src/core/lib/resource_quota/handshake_quota.h"
 #include "src/core/lib/slice/slice_buffer.h"
 
 namespace grpc_core {
@@ -125,7 +129,9 @@ class HandshakeManager : public RefCounted<HandshakeManager> {
   /// the \a on_handshake_done callback.
   /// Does NOT take ownership of \a channel_args.  Instead, makes a copy before
   /// invoking the first handshaker.
-  /// \a acceptor will be nullptr for client-side handshakers.
+  /// \a acceptor will be nullptr for client-side handshakers. Server-side
+  /// handshakes only start once admitted by the handshake quota of the
+  /// resource quota in \a channel_args.
   ///
   /// When done, invokes \a on_handshake_done with a HandshakerArgs
   /// object as its argument.  If the callback is invoked with error !=
@@ -148,6 +154,9 @@ class HandshakeManager : public RefCounted<HandshakeManager> {
   void CallNextHandshakerLocked(absl::Status error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  // Starts the handshakers once the handshake quota admitted the handshake.
+  void OnAdmittedLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   static const size_t kHandshakerListInlineSize = 2;
 
   Mutex mu_;
@@ -165,6 +174,14 @@ class HandshakeManager : public RefCounted<HandshakeManager> {
   // Deadline timer across all handshakers.
   grpc_event_engine::experimental::EventEngine::TaskHandle
       deadline_timer_handle_ ABSL_GUARDED_BY(mu_);
+  // The quota admitting server-side handshakes, along with the peer to
+  // release it for, the ticket of the handshake while it is queued and
+  // whether it holds one of its slots.
+  HandshakeQuotaRefPtr handshake_quota_ ABSL_GUARDED_BY(mu_);
+  std::string peer_ ABSL_GUARDED_BY(mu_);
+  absl::optional<uint64_t> queued_ticket_ ABSL_GUARDED_BY(mu_);
+  Timestamp queued_at_ ABSL_GUARDED_BY(mu_);
+  bool holds_handshake_slot_ ABSL_GUARDED_BY(mu_) = false;
 };
 
 }  // namespace grpc_core
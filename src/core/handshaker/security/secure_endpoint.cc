@@ -34,6 +34,7 @@
 
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/event_engine/memory_request.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
@@ -41,6 +42,7 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
@@ -88,9 +90,27 @@ struct secure_endpoint : public grpc_endpoint {
                             grpc_core::CSliceRef(leftover_slices[i]));
     }
     grpc_slice_buffer_init(&output_buffer);
+    const grpc_core::ChannelArgs args =
+        grpc_core::ChannelArgs::FromC(channel_args);
+    // Kernel TLS sockets fail MSG_ZEROCOPY sends, so a wrapped endpoint that
+    // may use them keeps user-space protection.
+    if (args.GetBool(GRPC_ARG_TLS_KERNEL_TX_OFFLOAD).value_or(false) &&
+        !args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(false)) {
+      const int fd = grpc_endpoint_get_fd(wrapped_ep.get());
+      kernel_tx_offload =
+          fd >= 0 &&
+          (zero_copy_protector != nullptr
+               ? tsi_zero_copy_grpc_protector_offload_protect(
+                     zero_copy_protector, fd)
+               : tsi_frame_protector_offload_protect(protector, fd)) ==
+              TSI_OK;
+      GRPC_TRACE_LOG(secure_endpoint, INFO)
+          << "SECENDP " << this << ": kernel TX offload "
+          << (kernel_tx_offload ? "enabled" : "unavailable");
+    }
     memory_owner = grpc_core::ResourceQuotaFromChannelArgs(channel_args)
                        ->memory_quota()
-                       ->CreateMemoryOwner();
+                       ->CreateMemoryOwner("secure_endpoint");
     self_reservation = memory_owner.MakeReservation(sizeof(*this));
     if (zero_copy_protector) {
       read_staging_buffer = grpc_empty_slice();
@@ -98,8 +118,12 @@ struct secure_endpoint : public grpc_endpoint {
     } else {
       read_staging_buffer =
           memory_owner.MakeSlice(grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
+      // Nothing is encrypted in user space when the kernel does it.
       write_staging_buffer =
-          memory_owner.MakeSlice(grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
+          kernel_tx_offload
+              ? grpc_empty_slice()
+              : memory_owner.MakeSlice(
+                    grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
     }
     has_posted_reclaimer.store(false, std::memory_order_relaxed);
     min_progress_size = 1;
@@ -144,6 +168,8 @@ struct secure_endpoint : public grpc_endpoint {
   std::atomic<bool> has_posted_reclaimer;
   int min_progress_size;
   grpc_slice_buffer protector_staging_buffer;
+  // Whether the kernel encrypts what is written to wrapped_ep.
+  bool kernel_tx_offload = false;
   gpr_refcount ref;
 };
 }  // namespace
@@ -391,6 +417,15 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
   tsi_result result = TSI_OK;
   secure_endpoint* ep = reinterpret_cast<secure_endpoint*>(secure_ep);
 
+  if (ep->kernel_tx_offload) {
+    // The socket encrypts the plaintext itself, and splits it into records.
+    // arg is not passed on: it asks for SO_TIMESTAMPING control messages,
+    // which kernel TLS sockets reject.
+    grpc_endpoint_write(ep->wrapped_ep.get(), slices, cb, nullptr,
+                        max_frame_size);
+    return;
+  }
+
   {
     grpc_core::MutexLock l(&ep->write_mu);
     uint8_t* cur = GRPC_SLICE_START_PTR(ep->write_staging_buffer);
@@ -28,6 +28,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
@@ -121,6 +122,14 @@ bool ChannelArgs::operator!=(const ChannelArgs& other) const {
   return !(*this == other);
 }
 
+size_t ChannelArgs::Hash() const {
+  size_t hash = 0;
+  args_.ForEach([&hash](const RefCountedStringValue& key, const Value& value) {
+    hash = absl::HashOf(hash, key.as_string_view(), value.Hash());
+  });
+  return hash;
+}
+
 bool ChannelArgs::WantMinimalStack() const {
   return GetBool(GRPC_ARG_MINIMAL_STACK).value_or(false);
 }
@@ -279,6 +288,17 @@ absl::optional<bool> ChannelArgs::GetBool(absl::string_view name) const {
   }
 }
 
+size_t ChannelArgs::Value::Hash() const {
+  if (rep_.c_vtable() == &string_vtable_) {
+    return absl::HashOf(
+        static_cast<RefCountedString*>(rep_.c_pointer())->as_string_view());
+  }
+  if (rep_.c_vtable() == &int_vtable_) {
+    return absl::HashOf(reinterpret_cast<intptr_t>(rep_.c_pointer()));
+  }
+  return 0;
+}
+
 absl::string_view ChannelArgs::Value::ToString(
     std::list<std::string>& backing_strings) const {
   if (rep_.c_vtable() == &string_vtable_) {
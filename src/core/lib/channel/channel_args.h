@@ -382,6 +382,10 @@ class ChannelArgs {
       return str->as_string_view() == rhs;
     }
 
+    // Hash consistent with operator==. Pointers other than ints and strings
+    // compare through their vtables, so they all hash to the same value.
+    size_t Hash() const;
+
    private:
     static const grpc_arg_pointer_vtable int_vtable_;
     static const grpc_arg_pointer_vtable string_vtable_;
@@ -552,6 +556,9 @@ class ChannelArgs {
   bool operator!=(const ChannelArgs& other) const;
   bool operator<(const ChannelArgs& other) const;
   bool operator==(const ChannelArgs& other) const;
+  // Hash consistent with operator==. Computing it visits every arg, so
+  // callers that compare the same args repeatedly should keep the result.
+  size_t Hash() const;
 
   // Helpers for commonly accessed things
 
@@ -195,26 +195,41 @@ grpc_error_handle grpc_call_stack_init(
     grpc_iomgr_cb_func destroy, void* destroy_arg,
     const grpc_call_element_args* elem_args) {
   grpc_channel_element* channel_elems = CHANNEL_ELEMS_FROM_STACK(channel_stack);
-  size_t count = channel_stack->count;
+  const size_t channel_count = channel_stack->count;
+  size_t count = 0;
   grpc_call_element* call_elems;
   char* user_data;
 
-  elem_args->call_stack->count = count;
   GRPC_STREAM_REF_INIT(&elem_args->call_stack->refcount, initial_refs, destroy,
                        destroy_arg, "CALL_STACK");
   call_elems = CALL_ELEMS_FROM_STACK(elem_args->call_stack);
   user_data = (reinterpret_cast<char*>(call_elems)) +
-              GPR_ROUND_UP_TO_ALIGNMENT_SIZE(count * sizeof(grpc_call_element));
+              GPR_ROUND_UP_TO_ALIGNMENT_SIZE(channel_count *
+                                             sizeof(grpc_call_element));
+
+  // Lay out the filters that take part in this call. The others are left out,
+  // so that grpc_call_next_op() goes straight past them.
+  for (size_t i = 0; i < channel_count; i++) {
+    grpc_channel_element* channel_elem = &channel_elems[i];
+    const grpc_channel_filter* filter = channel_elem->filter;
+    if (filter->is_active_for_call != nullptr && i != 0 &&
+        i != channel_count - 1 &&
+        !filter->is_active_for_call(channel_elem, elem_args)) {
+      GRPC_TRACE_LOG(channel_stack, INFO)
+          << "CALL_STACK: " << elem_args->call_stack << " skipping inactive "
+          << filter->name.name();
+      continue;
+    }
+    call_elems[count].filter = filter;
+    call_elems[count].channel_data = channel_elem->channel_data;
+    call_elems[count].call_data = user_data;
+    user_data += GPR_ROUND_UP_TO_ALIGNMENT_SIZE(filter->sizeof_call_data);
+    ++count;
+  }
+  elem_args->call_stack->count = count;
 
   // init per-filter data
   grpc_error_handle first_error;
-  for (size_t i = 0; i < count; i++) {
-    call_elems[i].filter = channel_elems[i].filter;
-    call_elems[i].channel_data = channel_elems[i].channel_data;
-    call_elems[i].call_data = user_data;
-    user_data +=
-        GPR_ROUND_UP_TO_ALIGNMENT_SIZE(call_elems[i].filter->sizeof_call_data);
-  }
   for (size_t i = 0; i < count; i++) {
     grpc_error_handle error =
         call_elems[i].filter->init_call_elem(&call_elems[i], elem_args);
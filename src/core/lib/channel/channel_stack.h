@@ -161,6 +161,14 @@ struct grpc_channel_filter {
 
   // The name of this filter
   grpc_core::UniqueTypeName name;
+
+  // Optional: decides, as each call is created, whether this filter takes part
+  // in the call. Filters that do not are left out of the call stack: their
+  // call data is not initialized and they see none of the call's batches.
+  // Not consulted for the first and last filters of a stack, which take part
+  // in every call. Filters that take part in every call leave this null.
+  bool (*is_active_for_call)(grpc_channel_element* elem,
+                             const grpc_call_element_args* args) = nullptr;
 };
 // A channel_element tracks its filter and the filter requested memory within
 // a channel allocation
@@ -48,4 +48,9 @@ void ChannelStackBuilder::AppendFilter(const grpc_channel_filter* filter) {
   stack_.push_back(filter);
 }
 
+void ChannelStackBuilder::AppendFilters(
+    const std::vector<const grpc_channel_filter*>& filters) {
+  stack_.insert(stack_.end(), filters.begin(), filters.end());
+}
+
 }  // namespace grpc_core
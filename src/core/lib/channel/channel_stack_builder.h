@@ -74,6 +74,9 @@ class ChannelStackBuilder {
   // Helper to add a filter to the end of the stack.
   void AppendFilter(const grpc_channel_filter* filter);
 
+  // Helper to add filters to the end of the stack, in order.
+  void AppendFilters(const std::vector<const grpc_channel_filter*>& filters);
+
   // Build the channel stack.
   // After success, *result holds the new channel stack,
   // prefix_bytes are allocated before the channel stack,
@@ -55,11 +55,7 @@ namespace grpc_core {
 
 absl::StatusOr<RefCountedPtr<grpc_channel_stack>>
 ChannelStackBuilderImpl::Build() {
-  std::vector<const grpc_channel_filter*> stack;
-
-  for (const auto* filter : this->stack()) {
-    stack.push_back(filter);
-  }
+  std::vector<const grpc_channel_filter*>& stack = *mutable_stack();
 
   // calculate the size of the channel stack
   size_t channel_stack_size =
@@ -1635,6 +1635,29 @@ struct ChannelFilterWithFlagsMethods {
   }
 };
 
+using IsActiveForCallFn = bool (*)(grpc_channel_element*,
+                                   const grpc_call_element_args*);
+
+// Filters that do nothing for some calls can declare
+//   bool IsActiveForCall(const grpc_call_element_args& args);
+// and are then left out of the legacy call stacks of calls for which it
+// returns false.
+template <typename F, typename = void>
+struct CallActivityMethods {
+  static constexpr IsActiveForCallFn IsActiveForCall() { return nullptr; }
+};
+
+template <typename F>
+struct CallActivityMethods<
+    F, absl::void_t<decltype(std::declval<F&>().IsActiveForCall(
+           std::declval<const grpc_call_element_args&>()))>> {
+  static bool Check(grpc_channel_element* elem,
+                    const grpc_call_element_args* args) {
+    return DownCast<F*>(ChannelFilterFromElem(elem))->IsActiveForCall(*args);
+  }
+  static constexpr IsActiveForCallFn IsActiveForCall() { return Check; }
+};
+
 }  // namespace promise_filter_detail
 
 // F implements ChannelFilter and :
@@ -1679,6 +1702,8 @@ MakePromiseBasedFilter() {
       promise_filter_detail::ChannelFilterMethods::GetChannelInfo,
       // name
       UniqueTypeNameFor<F>(),
+      // is_active_for_call
+      promise_filter_detail::CallActivityMethods<F>::IsActiveForCall(),
   };
 }
 
@@ -1717,6 +1742,8 @@ MakePromiseBasedFilter() {
       promise_filter_detail::ChannelFilterMethods::GetChannelInfo,
       // name
       UniqueTypeNameFor<F>(),
+      // is_active_for_call
+      promise_filter_detail::CallActivityMethods<F>::IsActiveForCall(),
   };
 }
 
@@ -20,9 +20,14 @@
 
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 #include <zconf.h>
 #include <zlib.h>
 
+#include "absl/functional/function_ref.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 
@@ -30,17 +35,138 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/util/useful.h"
+
+#define MIN_OUTPUT_BLOCK_SIZE 1024
+#define MAX_OUTPUT_BLOCK_SIZE (256 * 1024)
+
+namespace {
+
+// Output slices are sized from the ratio of output to input bytes (in 1/1024)
+// seen for recent messages, so that most messages need one or two slices
+// rather than one per kilobyte. Updated without synchronization: it is only
+// an estimate.
+std::atomic<uint32_t> g_deflate_ratio{512};
+std::atomic<uint32_t> g_inflate_ratio{4096};
+
+size_t first_output_block_size(const std::atomic<uint32_t>& ratio,
+                               size_t input_length) {
+  const size_t estimate =
+      input_length / 1024 * ratio.load(std::memory_order_relaxed) +
+      MIN_OUTPUT_BLOCK_SIZE / 4;
+  return grpc_core::Clamp<size_t>(estimate, MIN_OUTPUT_BLOCK_SIZE,
+                                  MAX_OUTPUT_BLOCK_SIZE);
+}
+
+void update_ratio(std::atomic<uint32_t>* ratio, size_t input_length,
+                  size_t output_length) {
+  if (input_length < 1024) return;
+  const uint64_t observed = grpc_core::Clamp<uint64_t>(
+      uint64_t{output_length} * 1024 / input_length, 1, 1024 * 1024);
+  const uint32_t old = ratio->load(std::memory_order_relaxed);
+  ratio->store(static_cast<uint32_t>((uint64_t{old} * 7 + observed) / 8),
+               std::memory_order_relaxed);
+}
+
+void* zalloc_gpr(void* /*opaque*/, unsigned int items, unsigned int size) {
+  return gpr_malloc(items * size);
+}
+
+void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
+
+// Deflate state is over 256KB and has to be zeroed when initialized, inflate
+// state about 40KB; so instead of being set up for every message, idle
+// streams are kept here and reset before being reused.
+class ZStreamPool {
+ public:
+  enum Kind { kDeflate, kDeflateGzip, kInflate, kInflateGzip, kNumKinds };
+
+  static ZStreamPool& Get() {
+    static ZStreamPool* pool = new ZStreamPool();
+    return *pool;
+  }
+
+  z_stream* Acquire(Kind kind) {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      std::vector<z_stream*>& idle = idle_[kind];
+      if (!idle.empty()) {
+        z_stream* zs = idle.back();
+        idle.pop_back();
+        return zs;
+      }
+    }
+    z_stream* zs = new z_stream;
+    memset(zs, 0, sizeof(*zs));
+    zs->zalloc = zalloc_gpr;
+    zs->zfree = zfree_gpr;
+    const int gzip_bits =
+        (kind == kDeflateGzip || kind == kInflateGzip) ? 16 : 0;
+    int r;
+    if (kind == kDeflate || kind == kDeflateGzip) {
+      r = deflateInit2(zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | gzip_bits, 8,
+                       Z_DEFAULT_STRATEGY);
+    } else {
+      r = inflateInit2(zs, 15 | gzip_bits);
+    }
+    CHECK(r == Z_OK);
+    return zs;
+  }
+
+  void Release(Kind kind, z_stream* zs) {
+    const bool deflating = kind == kDeflate || kind == kDeflateGzip;
+    const int r = deflating ? deflateReset(zs) : inflateReset(zs);
+    if (r == Z_OK) {
+      grpc_core::MutexLock lock(&mu_);
+      std::vector<z_stream*>& idle = idle_[kind];
+      if (idle.size() < kMaxIdlePerKind) {
+        idle.push_back(zs);
+        return;
+      }
+    }
+    if (deflating) {
+      deflateEnd(zs);
+    } else {
+      inflateEnd(zs);
+    }
+    delete zs;
+  }
+
+ private:
+  static constexpr size_t kMaxIdlePerKind = 8;
+
+  grpc_core::Mutex mu_;
+  std::vector<z_stream*> idle_[kNumKinds] ABSL_GUARDED_BY(mu_);
+};
 
-#define OUTPUT_BLOCK_SIZE 1024
+}  // namespace
+
+namespace grpc_core {
+
+namespace {
+// deflate only looks back this far, so earlier dictionary bytes are unused.
+constexpr size_t kMaxDictionarySize = 32 * 1024;
+}  // namespace
+
+DeflateDictionary::DeflateDictionary(absl::string_view data)
+    : data_(data.substr(data.size() - std::min(data.size(),
+                                               kMaxDictionarySize))),
+      id_(adler32(adler32(0, nullptr, 0),
+                  reinterpret_cast<const Bytef*>(data_.data()),
+                  static_cast<uInt>(data_.size()))) {}
+
+}  // namespace grpc_core
 
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
-                     int (*flate)(z_stream* zs, int flush)) {
+                     absl::FunctionRef<int(z_stream* zs, int flush)> flate,
+                     size_t block_size) {
   int r = Z_STREAM_END;  // Do not fail on an empty input.
   int flush;
   size_t i;
-  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(block_size);
   const uInt uint_max = ~uInt{0};
 
   CHECK(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
@@ -55,7 +181,9 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
     do {
       if (zs->avail_out == 0) {
         grpc_slice_buffer_add_indexed(output, outbuf);
-        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        // The estimate was short: grow geometrically from here on.
+        block_size = std::min(block_size * 2, size_t{MAX_OUTPUT_BLOCK_SIZE});
+        outbuf = GRPC_SLICE_MALLOC(block_size);
         CHECK(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
         zs->avail_out = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
         zs->next_out = GRPC_SLICE_START_PTR(outbuf);
@@ -78,6 +206,12 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
 
   CHECK(outbuf.refcount);
   outbuf.data.refcounted.length -= zs->avail_out;
+  if (zs->avail_out > block_size / 2 && block_size > MIN_OUTPUT_BLOCK_SIZE) {
+    // Do not keep a mostly empty block alive for as long as the message.
+    grpc_slice trimmed = grpc_slice_copy(outbuf);
+    grpc_core::CSliceUnref(outbuf);
+    outbuf = trimmed;
+  }
   grpc_slice_buffer_add_indexed(output, outbuf);
 
   return 1;
@@ -87,59 +221,90 @@ error:
   return 0;
 }
 
-static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
-                        unsigned int size) {
-  return gpr_malloc(items * size);
-}
-
-static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
-
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                         int gzip) {
-  z_stream zs;
-  int r;
+                         int gzip, int level,
+                         const grpc_core::DeflateDictionary* dictionary) {
+  const ZStreamPool::Kind kind =
+      gzip ? ZStreamPool::kDeflateGzip : ZStreamPool::kDeflate;
+  z_stream* zs = ZStreamPool::Get().Acquire(kind);
+  // Pooled streams may have been used at a different level: the stream has
+  // been reset and holds no input, so this only changes its parameters.
+  int r = deflateParams(zs, level, Z_DEFAULT_STRATEGY);
+  if (r != Z_OK) {
+    LOG(ERROR) << "deflateParams failed: " << r;
+    ZStreamPool::Get().Release(kind, zs);
+    return 0;
+  }
+  if (dictionary != nullptr && !gzip) {
+    r = deflateSetDictionary(
+        zs, reinterpret_cast<const Bytef*>(dictionary->data().data()),
+        static_cast<uInt>(dictionary->data().size()));
+    if (r != Z_OK) {
+      LOG(ERROR) << "deflateSetDictionary failed: " << r;
+      ZStreamPool::Get().Release(kind, zs);
+      return 0;
+    }
+  }
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
+  // Compressing only pays off if the output is smaller than the input.
+  const size_t block_size =
+      std::min(first_output_block_size(g_deflate_ratio, input->length),
+               std::max(input->length, size_t{MIN_OUTPUT_BLOCK_SIZE}));
+  r = zlib_body(zs, input, output, deflate, block_size) &&
+      output->length < input->length;
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
     }
     output->count = count_before;
     output->length = length_before;
+  } else {
+    update_ratio(&g_deflate_ratio, input->length,
+                 output->length - length_before);
   }
-  deflateEnd(&zs);
+  ZStreamPool::Get().Release(kind, zs);
   return r;
 }
 
-static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
-                           int gzip) {
-  z_stream zs;
+static int zlib_decompress(
+    grpc_slice_buffer* input, grpc_slice_buffer* output, int gzip,
+    absl::Span<const grpc_core::DeflateDictionary> dictionaries) {
+  const ZStreamPool::Kind kind =
+      gzip ? ZStreamPool::kInflateGzip : ZStreamPool::kInflate;
+  z_stream* zs = ZStreamPool::Get().Acquire(kind);
   int r;
   size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
-  CHECK(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
+  auto inflate_with_dictionaries = [dictionaries](z_stream* zs, int flush) {
+    int r = inflate(zs, flush);
+    if (r != Z_NEED_DICT) return r;
+    // zs->adler holds the id of the dictionary that the stream needs.
+    for (const grpc_core::DeflateDictionary& dictionary : dictionaries) {
+      if (dictionary.id() != zs->adler) continue;
+      r = inflateSetDictionary(
+          zs, reinterpret_cast<const Bytef*>(dictionary.data().data()),
+          static_cast<uInt>(dictionary.data().size()));
+      return r == Z_OK ? inflate(zs, flush) : r;
+    }
+    LOG(INFO) << "zlib: no dictionary with id " << zs->adler;
+    return Z_DATA_ERROR;
+  };
+  r = zlib_body(zs, input, output, inflate_with_dictionaries,
+                first_output_block_size(g_inflate_ratio, input->length));
   if (!r) {
     for (i = count_before; i < output->count; i++) {
       grpc_core::CSliceUnref(output->slices[i]);
     }
     output->count = count_before;
     output->length = length_before;
+  } else {
+    update_ratio(&g_inflate_ratio, input->length,
+                 output->length - length_before);
   }
-  inflateEnd(&zs);
+  ZStreamPool::Get().Release(kind, zs);
   return r;
 }
 
@@ -151,7 +316,8 @@ static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   return 1;
 }
 
-static int compress_inner(grpc_compression_algorithm algorithm,
+static int compress_inner(grpc_compression_algorithm algorithm, int level,
+                          const grpc_core::DeflateDictionary* dictionary,
                           grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
@@ -159,9 +325,9 @@ static int compress_inner(grpc_compression_algorithm algorithm,
       // rely on that here
       return 0;
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_compress(input, output, 0);
+      return zlib_compress(input, output, 0, level, dictionary);
     case GRPC_COMPRESS_GZIP:
-      return zlib_compress(input, output, 1);
+      return zlib_compress(input, output, 1, level, dictionary);
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -171,22 +337,57 @@ static int compress_inner(grpc_compression_algorithm algorithm,
 
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output) {
-  if (!compress_inner(algorithm, input, output)) {
+  return grpc_msg_compress_with_level(algorithm, Z_DEFAULT_COMPRESSION, input,
+                                      output);
+}
+
+namespace {
+
+int msg_compress(grpc_compression_algorithm algorithm, int zlib_level,
+                 const grpc_core::DeflateDictionary* dictionary,
+                 grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  if (zlib_level < Z_DEFAULT_COMPRESSION || zlib_level > Z_BEST_COMPRESSION) {
+    LOG(ERROR) << "invalid zlib compression level " << zlib_level;
+    zlib_level = Z_DEFAULT_COMPRESSION;
+  }
+  if (!compress_inner(algorithm, zlib_level, dictionary, input, output)) {
     copy(input, output);
     return 0;
   }
   return 1;
 }
 
+}  // namespace
+
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 int zlib_level, grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output) {
+  return msg_compress(algorithm, zlib_level, nullptr, input, output);
+}
+
+int grpc_msg_compress_with_dictionary(
+    grpc_compression_algorithm algorithm, int zlib_level,
+    const grpc_core::DeflateDictionary& dictionary, grpc_slice_buffer* input,
+    grpc_slice_buffer* output) {
+  return msg_compress(algorithm, zlib_level, &dictionary, input, output);
+}
+
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  return grpc_msg_decompress_with_dictionaries(algorithm, {}, input, output);
+}
+
+int grpc_msg_decompress_with_dictionaries(
+    grpc_compression_algorithm algorithm,
+    absl::Span<const grpc_core::DeflateDictionary> dictionaries,
+    grpc_slice_buffer* input, grpc_slice_buffer* output) {
   switch (algorithm) {
     case GRPC_COMPRESS_NONE:
       return copy(input, output);
     case GRPC_COMPRESS_DEFLATE:
-      return zlib_decompress(input, output, 0);
+      return zlib_decompress(input, output, 0, dictionaries);
     case GRPC_COMPRESS_GZIP:
-      return zlib_decompress(input, output, 1);
+      return zlib_decompress(input, output, 1, dictionaries);
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
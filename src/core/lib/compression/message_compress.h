@@ -19,6 +19,13 @@
 #ifndef GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
 #define GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
 
+#include <stdint.h>
+
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
 #include <grpc/impl/compression_types.h>
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
@@ -29,10 +36,53 @@
 int grpc_msg_compress(grpc_compression_algorithm algorithm,
                       grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// As grpc_msg_compress, but deflate and gzip compress at 'zlib_level' (0-9, or
+// -1 for zlib's default), trading compression ratio for CPU time.
+int grpc_msg_compress_with_level(grpc_compression_algorithm algorithm,
+                                 int zlib_level, grpc_slice_buffer* input,
+                                 grpc_slice_buffer* output);
+
+namespace grpc_core {
+
+// A zlib preset dictionary: content that small messages are likely to share
+// (field names, enum strings, common values), which deflate can then refer to
+// instead of repeating in every message. Only the last 32KB are used.
+class DeflateDictionary {
+ public:
+  explicit DeflateDictionary(absl::string_view data);
+
+  absl::string_view data() const { return data_; }
+  // The Adler-32 checksum of data(), which zlib streams compressed against
+  // this dictionary carry in their header.
+  uint32_t id() const { return id_; }
+
+ private:
+  std::string data_;
+  uint32_t id_;
+};
+
+}  // namespace grpc_core
+
+// As grpc_msg_compress_with_level, but deflate compresses against
+// 'dictionary'. The receiver needs the same dictionary to decompress the
+// result. gzip has no preset dictionaries and ignores it.
+int grpc_msg_compress_with_dictionary(
+    grpc_compression_algorithm algorithm, int zlib_level,
+    const grpc_core::DeflateDictionary& dictionary, grpc_slice_buffer* input,
+    grpc_slice_buffer* output);
+
 // decompress 'input' to 'output' using 'algorithm'.
 // On success, appends slices to output and returns 1.
 // On failure, output is unchanged, and returns 0.
 int grpc_msg_decompress(grpc_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+// As grpc_msg_decompress, but deflate streams that were compressed against a
+// preset dictionary are decompressed with the one of 'dictionaries' that has
+// the id given in the stream; they fail to decompress if there is none.
+int grpc_msg_decompress_with_dictionaries(
+    grpc_compression_algorithm algorithm,
+    absl::Span<const grpc_core::DeflateDictionary> dictionaries,
+    grpc_slice_buffer* input, grpc_slice_buffer* output);
+
 #endif  // GRPC_SRC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H
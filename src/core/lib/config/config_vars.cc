@@ -61,6 +61,94 @@ ABSL_FLAG(absl::optional<std::string>, grpc_poll_strategy, {},
           "Declares which polling engines to try when starting gRPC. This is a "
           "comma-separated list of engines, which are tried in priority order "
           "first -> last.");
+ABSL_FLAG(absl::optional<std::string>, grpc_event_engine_timer_list, {},
+          "Declares which timer list the POSIX EventEngine uses. \042heap\042 "
+          "keeps timers in sharded heaps; \042wheel\042 uses a hierarchical "
+          "timing wheel, which has constant time insertion and cancellation.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_event_engine_poller_spin_us, {},
+          "If positive, the POSIX EventEngine epoll poller polls without "
+          "blocking for up to this many microseconds before it blocks in "
+          "epoll_wait, trading CPU for lower wakeup latency.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_event_engine_poller_shards, {},
+          "If greater than one, the POSIX EventEngine runs this many "
+          "independent pollers, each on its own thread, and pins every "
+          "connection to one of them.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_event_engine_poller_inline_batch, {},
+          "If positive, each wakeup of the POSIX EventEngine poller handles "
+          "up to this many ready fds and runs their callbacks inline on the "
+          "polling thread, instead of scheduling each of them onto the "
+          "thread pool.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_work_serializer_drain_budget_us, {},
+          "If positive, a work serializer runs queued callbacks back to back "
+          "on the same thread for up to this many microseconds, instead of "
+          "going back to the EventEngine after each of them.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_call_deadline_slot_ms, {},
+          "If non-zero, call deadlines are rounded up to multiples of this "
+          "many milliseconds and the calls that share a slot are cancelled by "
+          "a single timer, instead of each call arming its own. Deadlines then "
+          "fire up to this late.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_subchannel_warm_pool_size, {},
+          "If positive, the global subchannel pool keeps up to this many "
+          "subchannels that no channel uses any more, along with their "
+          "connections, so that a channel that wants one of them again finds "
+          "it already connected.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_subchannel_warm_pool_idle_ms, {},
+          "How long, in milliseconds, the global subchannel pool keeps a "
+          "subchannel that no channel uses any more, when "
+          "GRPC_SUBCHANNEL_WARM_POOL_SIZE is positive.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_alts_parallel_protect_workers, {},
+          "If greater than one, the ALTS zero-copy frame protector splits "
+          "writes spanning many frames into up to this many consecutive runs "
+          "of frames and seals them concurrently on EventEngine threads.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_ssl_session_ticket_key_rotation_s, {},
+          "If positive, TLS servers that are not given a session ticket key "
+          "share one process-wide set of ticket keys, rotated every this many "
+          "seconds.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_ssl_verification_cache_size, {},
+          "If positive, TLS servers that verify client certificates remember "
+          "up to this many successfully verified client certificate chains, so "
+          "that repeat handshakes skip chain building and signature checks.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_lock_profiling_period, {},
+          "If positive, locks named for contention profiling record how long "
+          "one in this many acquisitions waited for and held the lock.");
+ABSL_FLAG(absl::optional<int32_t>, grpc_party_profiling_period, {},
+          "If positive, one in this many parties records how long it waits "
+          "between being woken and running, and how many polls its "
+          "participants take.");
+ABSL_FLAG(absl::optional<bool>, grpc_event_engine_numa_aware_thread_pool, {},
+          "If true, the EventEngine thread pool spreads its threads across "
+          "the NUMA nodes of the host, pins them to their node, and only "
+          "steals work from another node when there is none left on its "
+          "own.");
+ABSL_FLAG(absl::optional<bool>, grpc_event_engine_lock_free_work_queue, {},
+          "If true, the EventEngine thread pool gives each of its threads a "
+          "lock-free work-stealing queue instead of a mutex-protected one.");
+ABSL_FLAG(absl::optional<bool>, grpc_event_engine_poller_timers, {},
+          "If true, the POSIX EventEngine runs expired timers on the thread "
+          "that drives its poller, bounding each poll by the next timer "
+          "deadline, instead of on a dedicated timer thread.");
+ABSL_FLAG(absl::optional<bool>, grpc_fork_lazy_restart, {},
+          "If true, and fork support is enabled, EventEngine thread pools "
+          "stopped for fork() only start their threads again when they are "
+          "next given work, so that a parent forking many workers in a row "
+          "stops its pools only once.");
+ABSL_FLAG(absl::optional<bool>, grpc_slice_slab_allocator, {},
+          "If true, slices made by memory allocators are carved from "
+          "per-thread caches of fixed size blocks instead of being allocated "
+          "with malloc.");
+ABSL_FLAG(absl::optional<bool>, grpc_arena_block_recycling, {},
+          "If true, the initial blocks of arenas are kept in a per-thread "
+          "cache when the arena is destroyed and reused by the next arenas, "
+          "instead of being freed.");
+ABSL_FLAG(absl::optional<bool>, grpc_xds_shared_client, {},
+          "If true, all gRPC channels in the process share a single XdsClient, "
+          "and therefore a single xDS resource cache and ADS stream per xDS "
+          "server, instead of using one per data plane target. xDS client "
+          "metrics are then reported with the target label \042#shared\042.");
+ABSL_FLAG(absl::optional<bool>, grpc_ssl_zero_copy_frame_protector, {},
+          "If true, TLS connections use a frame protector that encrypts and "
+          "decrypts slice buffers directly instead of going through the "
+          "copying staging buffers of the secure endpoint.");
 ABSL_FLAG(absl::optional<bool>, grpc_abort_on_leaks, {},
           "A debugging aid to cause a call to abort() when gRPC objects are "
           "leaked past grpc_shutdown()");
@@ -80,9 +168,83 @@ ConfigVars::ConfigVars(const Overrides& overrides)
           LoadConfig(FLAGS_grpc_client_channel_backup_poll_interval_ms,
                      "GRPC_CLIENT_CHANNEL_BACKUP_POLL_INTERVAL_MS",
                      overrides.client_channel_backup_poll_interval_ms, 5000)),
+      event_engine_poller_spin_us_(
+          LoadConfig(FLAGS_grpc_event_engine_poller_spin_us,
+                     "GRPC_EVENT_ENGINE_POLLER_SPIN_US",
+                     overrides.event_engine_poller_spin_us, 0)),
+      event_engine_poller_shards_(
+          LoadConfig(FLAGS_grpc_event_engine_poller_shards,
+                     "GRPC_EVENT_ENGINE_POLLER_SHARDS",
+                     overrides.event_engine_poller_shards, 0)),
+      event_engine_poller_inline_batch_(
+          LoadConfig(FLAGS_grpc_event_engine_poller_inline_batch,
+                     "GRPC_EVENT_ENGINE_POLLER_INLINE_BATCH",
+                     overrides.event_engine_poller_inline_batch, 0)),
+      work_serializer_drain_budget_us_(
+          LoadConfig(FLAGS_grpc_work_serializer_drain_budget_us,
+                     "GRPC_WORK_SERIALIZER_DRAIN_BUDGET_US",
+                     overrides.work_serializer_drain_budget_us, 0)),
+      call_deadline_slot_ms_(
+          LoadConfig(FLAGS_grpc_call_deadline_slot_ms,
+                     "GRPC_CALL_DEADLINE_SLOT_MS",
+                     overrides.call_deadline_slot_ms, 0)),
+      subchannel_warm_pool_size_(
+          LoadConfig(FLAGS_grpc_subchannel_warm_pool_size,
+                     "GRPC_SUBCHANNEL_WARM_POOL_SIZE",
+                     overrides.subchannel_warm_pool_size, 0)),
+      subchannel_warm_pool_idle_ms_(
+          LoadConfig(FLAGS_grpc_subchannel_warm_pool_idle_ms,
+                     "GRPC_SUBCHANNEL_WARM_POOL_IDLE_MS",
+                     overrides.subchannel_warm_pool_idle_ms, 60000)),
+      alts_parallel_protect_workers_(
+          LoadConfig(FLAGS_grpc_alts_parallel_protect_workers,
+                     "GRPC_ALTS_PARALLEL_PROTECT_WORKERS",
+                     overrides.alts_parallel_protect_workers, 0)),
+      ssl_session_ticket_key_rotation_s_(
+          LoadConfig(FLAGS_grpc_ssl_session_ticket_key_rotation_s,
+                     "GRPC_SSL_SESSION_TICKET_KEY_ROTATION_S",
+                     overrides.ssl_session_ticket_key_rotation_s, 0)),
+      ssl_verification_cache_size_(
+          LoadConfig(FLAGS_grpc_ssl_verification_cache_size,
+                     "GRPC_SSL_VERIFICATION_CACHE_SIZE",
+                     overrides.ssl_verification_cache_size, 0)),
+      lock_profiling_period_(LoadConfig(FLAGS_grpc_lock_profiling_period,
+                                        "GRPC_LOCK_PROFILING_PERIOD",
+                                        overrides.lock_profiling_period, 0)),
+      party_profiling_period_(LoadConfig(FLAGS_grpc_party_profiling_period,
+                                         "GRPC_PARTY_PROFILING_PERIOD",
+                                         overrides.party_profiling_period, 0)),
       enable_fork_support_(LoadConfig(
           FLAGS_grpc_enable_fork_support, "GRPC_ENABLE_FORK_SUPPORT",
           overrides.enable_fork_support, GRPC_ENABLE_FORK_SUPPORT_DEFAULT)),
+      event_engine_numa_aware_thread_pool_(
+          LoadConfig(FLAGS_grpc_event_engine_numa_aware_thread_pool,
+                     "GRPC_EVENT_ENGINE_NUMA_AWARE_THREAD_POOL",
+                     overrides.event_engine_numa_aware_thread_pool, false)),
+      event_engine_lock_free_work_queue_(
+          LoadConfig(FLAGS_grpc_event_engine_lock_free_work_queue,
+                     "GRPC_EVENT_ENGINE_LOCK_FREE_WORK_QUEUE",
+                     overrides.event_engine_lock_free_work_queue, false)),
+      event_engine_poller_timers_(
+          LoadConfig(FLAGS_grpc_event_engine_poller_timers,
+                     "GRPC_EVENT_ENGINE_POLLER_TIMERS",
+                     overrides.event_engine_poller_timers, false)),
+      fork_lazy_restart_(LoadConfig(FLAGS_grpc_fork_lazy_restart,
+                                    "GRPC_FORK_LAZY_RESTART",
+                                    overrides.fork_lazy_restart, false)),
+      slice_slab_allocator_(LoadConfig(FLAGS_grpc_slice_slab_allocator,
+                                       "GRPC_SLICE_SLAB_ALLOCATOR",
+                                       overrides.slice_slab_allocator, false)),
+      arena_block_recycling_(LoadConfig(FLAGS_grpc_arena_block_recycling,
+                                        "GRPC_ARENA_BLOCK_RECYCLING",
+                                        overrides.arena_block_recycling, true)),
+      xds_shared_client_(LoadConfig(FLAGS_grpc_xds_shared_client,
+                                    "GRPC_XDS_SHARED_CLIENT",
+                                    overrides.xds_shared_client, false)),
+      ssl_zero_copy_frame_protector_(
+          LoadConfig(FLAGS_grpc_ssl_zero_copy_frame_protector,
+                     "GRPC_SSL_ZERO_COPY_FRAME_PROTECTOR",
+                     overrides.ssl_zero_copy_frame_protector, false)),
       abort_on_leaks_(LoadConfig(FLAGS_grpc_abort_on_leaks,
                                  "GRPC_ABORT_ON_LEAKS",
                                  overrides.abort_on_leaks, false)),
@@ -96,6 +258,9 @@ ConfigVars::ConfigVars(const Overrides& overrides)
                             GPR_DEFAULT_LOG_VERBOSITY_STRING)),
       poll_strategy_(LoadConfig(FLAGS_grpc_poll_strategy, "GRPC_POLL_STRATEGY",
                                 overrides.poll_strategy, "all")),
+      event_engine_timer_list_(LoadConfig(
+          FLAGS_grpc_event_engine_timer_list, "GRPC_EVENT_ENGINE_TIMER_LIST",
+          overrides.event_engine_timer_list, "heap")),
       ssl_cipher_suites_(LoadConfig(
           FLAGS_grpc_ssl_cipher_suites, "GRPC_SSL_CIPHER_SUITES",
           overrides.ssl_cipher_suites,
@@ -131,6 +296,31 @@ std::string ConfigVars::ToString() const {
       absl::CEscape(Verbosity()), "\"",
       ", enable_fork_support: ", EnableForkSupport() ? "true" : "false",
       ", poll_strategy: ", "\"", absl::CEscape(PollStrategy()), "\"",
+      ", event_engine_timer_list: ", "\"", absl::CEscape(EventEngineTimerList()),
+      "\"", ", event_engine_poller_spin_us: ", EventEnginePollerSpinUs(),
+      ", event_engine_poller_shards: ", EventEnginePollerShards(),
+      ", event_engine_poller_inline_batch: ", EventEnginePollerInlineBatch(),
+      ", work_serializer_drain_budget_us: ", WorkSerializerDrainBudgetUs(),
+      ", call_deadline_slot_ms: ", CallDeadlineSlotMs(),
+      ", subchannel_warm_pool_size: ", SubchannelWarmPoolSize(),
+      ", subchannel_warm_pool_idle_ms: ", SubchannelWarmPoolIdleMs(),
+      ", alts_parallel_protect_workers: ", AltsParallelProtectWorkers(),
+      ", ssl_session_ticket_key_rotation_s: ", SslSessionTicketKeyRotationS(),
+      ", ssl_verification_cache_size: ", SslVerificationCacheSize(),
+      ", lock_profiling_period: ", LockProfilingPeriod(),
+      ", party_profiling_period: ", PartyProfilingPeriod(),
+      ", event_engine_numa_aware_thread_pool: ",
+      EventEngineNumaAwareThreadPool() ? "true" : "false",
+      ", event_engine_lock_free_work_queue: ",
+      EventEngineLockFreeWorkQueue() ? "true" : "false",
+      ", event_engine_poller_timers: ",
+      EventEnginePollerTimers() ? "true" : "false",
+      ", fork_lazy_restart: ", ForkLazyRestart() ? "true" : "false",
+      ", slice_slab_allocator: ", SliceSlabAllocator() ? "true" : "false",
+      ", arena_block_recycling: ", ArenaBlockRecycling() ? "true" : "false",
+      ", xds_shared_client: ", XdsSharedClient() ? "true" : "false",
+      ", ssl_zero_copy_frame_protector: ",
+      SslZeroCopyFrameProtector() ? "true" : "false",
       ", abort_on_leaks: ", AbortOnLeaks() ? "true" : "false",
       ", system_ssl_roots_dir: ", "\"", absl::CEscape(SystemSslRootsDir()),
       "\"", ", default_ssl_roots_file_path: ", "\"",
@@ -35,12 +35,33 @@ class GPR_DLL ConfigVars {
  public:
   struct Overrides {
     absl::optional<int32_t> client_channel_backup_poll_interval_ms;
+    absl::optional<int32_t> event_engine_poller_spin_us;
+    absl::optional<int32_t> event_engine_poller_shards;
+    absl::optional<int32_t> event_engine_poller_inline_batch;
+    absl::optional<int32_t> work_serializer_drain_budget_us;
+    absl::optional<int32_t> call_deadline_slot_ms;
+    absl::optional<int32_t> subchannel_warm_pool_size;
+    absl::optional<int32_t> subchannel_warm_pool_idle_ms;
+    absl::optional<int32_t> alts_parallel_protect_workers;
+    absl::optional<int32_t> ssl_session_ticket_key_rotation_s;
+    absl::optional<int32_t> ssl_verification_cache_size;
+    absl::optional<int32_t> lock_profiling_period;
+    absl::optional<int32_t> party_profiling_period;
     absl::optional<bool> enable_fork_support;
+    absl::optional<bool> event_engine_numa_aware_thread_pool;
+    absl::optional<bool> event_engine_lock_free_work_queue;
+    absl::optional<bool> event_engine_poller_timers;
+    absl::optional<bool> fork_lazy_restart;
+    absl::optional<bool> slice_slab_allocator;
+    absl::optional<bool> arena_block_recycling;
+    absl::optional<bool> xds_shared_client;
+    absl::optional<bool> ssl_zero_copy_frame_protector;
     absl::optional<bool> abort_on_leaks;
     absl::optional<bool> not_use_system_ssl_roots;
     absl::optional<std::string> dns_resolver;
     absl::optional<std::string> verbosity;
     absl::optional<std::string> poll_strategy;
+    absl::optional<std::string> event_engine_timer_list;
     absl::optional<std::string> system_ssl_roots_dir;
     absl::optional<std::string> default_ssl_roots_file_path;
     absl::optional<std::string> ssl_cipher_suites;
@@ -86,6 +107,110 @@ class GPR_DLL ConfigVars {
   // comma-separated list of engines, which are tried in priority order first ->
   // last.
   absl::string_view PollStrategy() const { return poll_strategy_; }
+  // Declares which timer list the POSIX EventEngine uses. "heap" keeps timers
+  // in sharded heaps; "wheel" uses a hierarchical timing wheel, which has
+  // constant time insertion and cancellation.
+  absl::string_view EventEngineTimerList() const {
+    return event_engine_timer_list_;
+  }
+  // If positive, the POSIX EventEngine epoll poller polls without blocking for
+  // up to this many microseconds before it blocks in epoll_wait, trading CPU
+  // for lower wakeup latency.
+  int32_t EventEnginePollerSpinUs() const {
+    return event_engine_poller_spin_us_;
+  }
+  // If greater than one, the POSIX EventEngine runs this many independent
+  // pollers, each on its own thread, and pins every connection to one of them.
+  int32_t EventEnginePollerShards() const {
+    return event_engine_poller_shards_;
+  }
+  // If positive, each wakeup of the POSIX EventEngine poller handles up to
+  // this many ready fds and runs their callbacks inline on the polling thread,
+  // instead of scheduling each of them onto the thread pool.
+  int32_t EventEnginePollerInlineBatch() const {
+    return event_engine_poller_inline_batch_;
+  }
+  // If positive, a work serializer runs queued callbacks back to back on the
+  // same thread for up to this many microseconds, instead of going back to the
+  // EventEngine after each of them.
+  int32_t WorkSerializerDrainBudgetUs() const {
+    return work_serializer_drain_budget_us_;
+  }
+  // If non-zero, call deadlines are rounded up to multiples of this many
+  // milliseconds and the calls that share a slot are cancelled by a single
+  // timer, instead of each call arming its own. Deadlines then fire up to this
+  // late.
+  int32_t CallDeadlineSlotMs() const { return call_deadline_slot_ms_; }
+  // If positive, the global subchannel pool keeps up to this many subchannels
+  // that no channel uses any more, along with their connections, so that a
+  // channel that wants one of them again finds it already connected.
+  int32_t SubchannelWarmPoolSize() const { return subchannel_warm_pool_size_; }
+  // How long, in milliseconds, the global subchannel pool keeps a subchannel
+  // that no channel uses any more, when GRPC_SUBCHANNEL_WARM_POOL_SIZE is
+  // positive.
+  int32_t SubchannelWarmPoolIdleMs() const {
+    return subchannel_warm_pool_idle_ms_;
+  }
+  // If greater than one, the ALTS zero-copy frame protector splits writes
+  // spanning many frames into up to this many consecutive runs of frames and
+  // seals them concurrently on EventEngine threads.
+  int32_t AltsParallelProtectWorkers() const {
+    return alts_parallel_protect_workers_;
+  }
+  // If positive, TLS servers that are not given a session ticket key share one
+  // process-wide set of ticket keys, rotated every this many seconds.
+  int32_t SslSessionTicketKeyRotationS() const {
+    return ssl_session_ticket_key_rotation_s_;
+  }
+  // If positive, TLS servers that verify client certificates remember up to
+  // this many successfully verified client certificate chains, so that repeat
+  // handshakes skip chain building and signature checks.
+  int32_t SslVerificationCacheSize() const {
+    return ssl_verification_cache_size_;
+  }
+  // If positive, locks named for contention profiling record how long one in
+  // this many acquisitions waited for and held the lock.
+  int32_t LockProfilingPeriod() const { return lock_profiling_period_; }
+  // If positive, one in this many parties records how long it waits between
+  // being woken and running, and how many polls its participants take.
+  int32_t PartyProfilingPeriod() const { return party_profiling_period_; }
+  // If true, the EventEngine thread pool spreads its threads across the NUMA
+  // nodes of the host, pins them to their node, and only steals work from
+  // another node when there is none left on its own.
+  bool EventEngineNumaAwareThreadPool() const {
+    return event_engine_numa_aware_thread_pool_;
+  }
+  // If true, the EventEngine thread pool gives each of its threads a lock-free
+  // work-stealing queue instead of a mutex-protected one.
+  bool EventEngineLockFreeWorkQueue() const {
+    return event_engine_lock_free_work_queue_;
+  }
+  // If true, the POSIX EventEngine runs expired timers on the thread that
+  // drives its poller, bounding each poll by the next timer deadline, instead
+  // of on a dedicated timer thread.
+  bool EventEnginePollerTimers() const { return event_engine_poller_timers_; }
+  // If true, and fork support is enabled, EventEngine thread pools stopped for
+  // fork() only start their threads again when they are next given work, so
+  // that a parent forking many workers in a row stops its pools only once.
+  bool ForkLazyRestart() const { return fork_lazy_restart_; }
+  // If true, slices made by memory allocators are carved from per-thread
+  // caches of fixed size blocks instead of being allocated with malloc.
+  bool SliceSlabAllocator() const { return slice_slab_allocator_; }
+  // If true, the initial blocks of arenas are kept in a per-thread cache when
+  // the arena is destroyed and reused by the next arenas, instead of being
+  // freed.
+  bool ArenaBlockRecycling() const { return arena_block_recycling_; }
+  // If true, all gRPC channels in the process share a single XdsClient, and
+  // therefore a single xDS resource cache and ADS stream per xDS server,
+  // instead of using one per data plane target. xDS client metrics are then
+  // reported with the target label "#shared".
+  bool XdsSharedClient() const { return xds_shared_client_; }
+  // If true, TLS connections use a frame protector that encrypts and decrypts
+  // slice buffers directly instead of going through the copying staging
+  // buffers of the secure endpoint.
+  bool SslZeroCopyFrameProtector() const {
+    return ssl_zero_copy_frame_protector_;
+  }
   // A debugging aid to cause a call to abort() when gRPC objects are leaked
   // past grpc_shutdown()
   bool AbortOnLeaks() const { return abort_on_leaks_; }
@@ -103,12 +228,33 @@ class GPR_DLL ConfigVars {
   static const ConfigVars& Load();
   static std::atomic<ConfigVars*> config_vars_;
   int32_t client_channel_backup_poll_interval_ms_;
+  int32_t event_engine_poller_spin_us_;
+  int32_t event_engine_poller_shards_;
+  int32_t event_engine_poller_inline_batch_;
+  int32_t work_serializer_drain_budget_us_;
+  int32_t call_deadline_slot_ms_;
+  int32_t subchannel_warm_pool_size_;
+  int32_t subchannel_warm_pool_idle_ms_;
+  int32_t alts_parallel_protect_workers_;
+  int32_t ssl_session_ticket_key_rotation_s_;
+  int32_t ssl_verification_cache_size_;
+  int32_t lock_profiling_period_;
+  int32_t party_profiling_period_;
   bool enable_fork_support_;
+  bool event_engine_numa_aware_thread_pool_;
+  bool event_engine_lock_free_work_queue_;
+  bool event_engine_poller_timers_;
+  bool fork_lazy_restart_;
+  bool slice_slab_allocator_;
+  bool arena_block_recycling_;
+  bool xds_shared_client_;
+  bool ssl_zero_copy_frame_protector_;
   bool abort_on_leaks_;
   bool not_use_system_ssl_roots_;
   std::string dns_resolver_;
   std::string verbosity_;
   std::string poll_strategy_;
+  std::string event_engine_timer_list_;
   std::string ssl_cipher_suites_;
   std::string experiments_;
   std::string trace_;
@@ -68,6 +68,8 @@ TraceFlag client_idle_filter_trace(false, "client_idle_filter");
 TraceFlag compression_trace(false, "compression");
 TraceFlag connectivity_state_trace(false, "connectivity_state");
 TraceFlag cronet_trace(false, "cronet");
+TraceFlag deterministic_subsetting_lb_trace(false,
+                                           "deterministic_subsetting_lb");
 TraceFlag dns_resolver_trace(false, "dns_resolver");
 TraceFlag environment_autodetect_trace(false, "environment_autodetect");
 TraceFlag event_engine_trace(false, "event_engine");
@@ -93,6 +95,8 @@ TraceFlag http2_ping_trace(false, "http2_ping");
 TraceFlag http2_stream_state_trace(false, "http2_stream_state");
 TraceFlag http_keepalive_trace(false, "http_keepalive");
 TraceFlag inproc_trace(false, "inproc");
+TraceFlag latency_aware_lb_trace(false, "latency_aware_lb");
+TraceFlag least_request_lb_trace(false, "least_request_lb");
 TraceFlag metadata_query_trace(false, "metadata_query");
 TraceFlag op_failure_trace(false, "op_failure");
 TraceFlag orca_client_trace(false, "orca_client");
@@ -160,6 +164,7 @@ const absl::flat_hash_map<std::string, TraceFlag*>& GetAllTraceFlags() {
           {"compression", &compression_trace},
           {"connectivity_state", &connectivity_state_trace},
           {"cronet", &cronet_trace},
+          {"deterministic_subsetting_lb", &deterministic_subsetting_lb_trace},
           {"dns_resolver", &dns_resolver_trace},
           {"environment_autodetect", &environment_autodetect_trace},
           {"event_engine", &event_engine_trace},
@@ -185,6 +190,8 @@ const absl::flat_hash_map<std::string, TraceFlag*>& GetAllTraceFlags() {
           {"http2_stream_state", &http2_stream_state_trace},
           {"http_keepalive", &http_keepalive_trace},
           {"inproc", &inproc_trace},
+          {"latency_aware_lb", &latency_aware_lb_trace},
+          {"least_request_lb", &least_request_lb_trace},
           {"metadata_query", &metadata_query_trace},
           {"op_failure", &op_failure_trace},
           {"orca_client", &orca_client_trace},
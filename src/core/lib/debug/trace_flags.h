@@ -67,6 +67,7 @@ extern TraceFlag client_idle_filter_trace;
 extern TraceFlag compression_trace;
 extern TraceFlag connectivity_state_trace;
 extern TraceFlag cronet_trace;
+extern TraceFlag deterministic_subsetting_lb_trace;
 extern TraceFlag dns_resolver_trace;
 extern TraceFlag environment_autodetect_trace;
 extern TraceFlag event_engine_trace;
@@ -91,6 +92,8 @@ extern TraceFlag http2_ping_trace;
 extern TraceFlag http2_stream_state_trace;
 extern TraceFlag http_keepalive_trace;
 extern TraceFlag inproc_trace;
+extern TraceFlag latency_aware_lb_trace;
+extern TraceFlag least_request_lb_trace;
 extern TraceFlag metadata_query_trace;
 extern TraceFlag op_failure_trace;
 extern TraceFlag orca_client_trace;
@@ -0,0 +1,75 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_RUN_WITH_PRIORITY_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_RUN_WITH_PRIORITY_H
+
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+class EventEngineRunWithPriorityExtension {
+ public:
+  enum class Priority {
+    /// Work that RPCs are waiting on, which should run ahead of everything
+    /// else when the engine is saturated.
+    kHigh,
+    /// The priority of EventEngine::Run.
+    kNormal,
+    /// Background work, e.g. DNS resolution or xDS updates, which only runs
+    /// once there is no other work, apart from a small share of the engine
+    /// to guarantee progress.
+    kLow,
+  };
+
+  virtual ~EventEngineRunWithPriorityExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.run_with_priority";
+  }
+
+  /// Same as EventEngine::Run, but closures of a higher \a priority are run
+  /// before the closures of a lower priority that are still waiting. The
+  /// order of closures of the same priority is unchanged.
+  virtual void RunWithPriority(Priority priority,
+                               absl::AnyInvocable<void()> closure) = 0;
+  virtual void RunWithPriority(Priority priority,
+                               EventEngine::Closure* closure) = 0;
+};
+
+/// Runs \a closure on \a engine with the given priority if the engine supports
+/// it, and with EventEngine::Run otherwise.
+inline void RunWithPriority(
+    EventEngine* engine, EventEngineRunWithPriorityExtension::Priority priority,
+    absl::AnyInvocable<void()> closure) {
+  auto* extension = static_cast<EventEngineRunWithPriorityExtension*>(
+      engine->QueryExtension(
+          EventEngineRunWithPriorityExtension::EndpointExtensionName()));
+  if (extension != nullptr) {
+    extension->RunWithPriority(priority, std::move(closure));
+  } else {
+    engine->Run(std::move(closure));
+  }
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_RUN_WITH_PRIORITY_H
@@ -0,0 +1,63 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_H
+
+#include <stdint.h>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+class EndpointTcpInfoExtension {
+ public:
+  // The parts of TCP_INFO that help explain the throughput of a connection.
+  // Fields the kernel does not report are 0.
+  struct TcpInfo {
+    uint32_t rtt_us = 0;
+    uint32_t rtt_var_us = 0;
+    uint32_t min_rtt_us = 0;
+    // In segments.
+    uint32_t snd_cwnd = 0;
+    // Segments retransmitted over the lifetime of the connection.
+    uint32_t total_retrans = 0;
+    // In bytes per second.
+    uint64_t pacing_rate = 0;
+    uint64_t delivery_rate = 0;
+  };
+
+  virtual ~EndpointTcpInfoExtension() = default;
+  static absl::string_view EndpointExtensionName() {
+    return "io.grpc.event_engine.extension.tcp_info";
+  }
+
+  /// Samples TCP_INFO of the socket of the endpoint when it reads or writes,
+  /// at most once per \a period, and hands each sample to \a on_sample, which
+  /// may run on any thread. Returns false if the platform cannot sample
+  /// TCP_INFO. Must be called at most once, before the first Read or Write.
+  virtual bool EnableTcpInfoSampling(
+      EventEngine::Duration period,
+      absl::AnyInvocable<void(const TcpInfo&)> on_sample) = 0;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_EXTENSIONS_TCP_INFO_H
@@ -22,7 +22,10 @@
 
 #include "src/core/lib/event_engine/extensions/can_track_errors.h"
 #include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
+#include "src/core/lib/event_engine/extensions/receive_coalescing.h"
+#include "src/core/lib/event_engine/extensions/run_with_priority.h"
 #include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 
 namespace grpc_event_engine {
@@ -32,14 +35,17 @@ namespace experimental {
 /// may implement to support additional chaotic good related functionality.
 class PosixEndpointWithChaoticGoodSupport
     : public ExtendedType<EventEngine::Endpoint, ChaoticGoodExtension,
+                          ReceiveCoalescingExtension,
                           EndpointSupportsFdExtension,
                           EndpointCanTrackErrorsExtension> {};
 
 /// This defines an interface that posix specific EventEngines endpoints
-/// may implement to support additional file descriptor related functionality.
+/// may implement to support additional file descriptor related functionality,
+/// and TCP_INFO sampling.
 class PosixEndpointWithFdSupport
     : public ExtendedType<EventEngine::Endpoint, EndpointSupportsFdExtension,
-                          EndpointCanTrackErrorsExtension> {};
+                          EndpointCanTrackErrorsExtension,
+                          EndpointTcpInfoExtension> {};
 
 /// Defines an interface that posix EventEngine listeners may implement to
 /// support additional file descriptor related functionality.
@@ -48,9 +54,11 @@ class PosixListenerWithFdSupport
 };
 
 /// Defines an interface that posix EventEngines may implement to
-/// support additional file descriptor related functionality.
+/// support additional file descriptor related functionality, and prioritized
+/// closures.
 class PosixEventEngineWithFdSupport
-    : public ExtendedType<EventEngine, EventEngineSupportsFdExtension> {};
+    : public ExtendedType<EventEngine, EventEngineSupportsFdExtension,
+                          EventEngineRunWithPriorityExtension> {};
 
 }  // namespace experimental
 }  // namespace grpc_event_engine
@@ -15,7 +15,9 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <memory>
 
 #include "absl/log/check.h"
@@ -29,6 +31,7 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/event_engine/poller.h"
 #include "src/core/lib/event_engine/time_util.h"
 #include "src/core/lib/gprpp/crash.h"
@@ -52,6 +55,7 @@
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/gprpp/strerror.h"
 #include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
 
 #define MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION 1
 
@@ -71,18 +75,14 @@ class Epoll1EventHandle : public EventHandle {
     read_closure_->InitEvent();
     write_closure_->InitEvent();
     error_closure_->InitEvent();
-    pending_read_.store(false, std::memory_order_relaxed);
-    pending_write_.store(false, std::memory_order_relaxed);
-    pending_error_.store(false, std::memory_order_relaxed);
+    pending_actions_.store(0, std::memory_order_relaxed);
   }
   void ReInit(int fd) {
     fd_ = fd;
     read_closure_->InitEvent();
     write_closure_->InitEvent();
     error_closure_->InitEvent();
-    pending_read_.store(false, std::memory_order_relaxed);
-    pending_write_.store(false, std::memory_order_relaxed);
-    pending_error_.store(false, std::memory_order_relaxed);
+    pending_actions_.store(0, std::memory_order_relaxed);
   }
   Epoll1Poller* Poller() override { return poller_; }
   bool SetPendingActions(bool pending_read, bool pending_write,
@@ -92,22 +92,14 @@ class Epoll1EventHandle : public EventHandle {
     // an fd to be readable while the next instantiation of Work(...) may
     // set the fd to be writable. While the second instantiation is running,
     // ExecutePendingActions() of the first instantiation may execute in
-    // parallel and read the pending_<***>_ variables. So we need to use
-    // atomics to manipulate pending_<***>_ variables.
-
-    if (pending_read) {
-      pending_read_.store(true, std::memory_order_release);
-    }
-
-    if (pending_write) {
-      pending_write_.store(true, std::memory_order_release);
-    }
-
-    if (pending_error) {
-      pending_error_.store(true, std::memory_order_release);
-    }
-
-    return pending_read || pending_write || pending_error;
+    // parallel and read pending_actions_. So we need to use an atomic to
+    // manipulate pending_actions_.
+    const uint8_t pending = (pending_read ? kPendingRead : 0) |
+                            (pending_write ? kPendingWrite : 0) |
+                            (pending_error ? kPendingError : 0);
+    if (pending == 0) return false;
+    pending_actions_.fetch_or(pending, std::memory_order_release);
+    return true;
   }
   int WrappedFd() override { return fd_; }
   void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
@@ -123,15 +115,12 @@ class Epoll1EventHandle : public EventHandle {
   inline void ExecutePendingActions() {
     // These may execute in Parallel with ShutdownHandle. Thats not an issue
     // because the lockfree event implementation should be able to handle it.
-    if (pending_read_.exchange(false, std::memory_order_acq_rel)) {
-      read_closure_->SetReady();
-    }
-    if (pending_write_.exchange(false, std::memory_order_acq_rel)) {
-      write_closure_->SetReady();
-    }
-    if (pending_error_.exchange(false, std::memory_order_acq_rel)) {
-      error_closure_->SetReady();
-    }
+    // A single exchange picks up every direction that became ready.
+    const uint8_t pending =
+        pending_actions_.exchange(0, std::memory_order_acq_rel);
+    if (pending & kPendingRead) read_closure_->SetReady();
+    if (pending & kPendingWrite) write_closure_->SetReady();
+    if (pending & kPendingError) error_closure_->SetReady();
   }
   grpc_core::Mutex* mu() { return &mu_; }
   LockfreeEvent* ReadClosure() { return read_closure_.get(); }
@@ -146,11 +135,11 @@ class Epoll1EventHandle : public EventHandle {
   // required.
   grpc_core::Mutex mu_;
   int fd_;
-  // See Epoll1Poller::SetPendingActions for explanation on why pending_<***>_
-  // need to be atomic.
-  std::atomic<bool> pending_read_{false};
-  std::atomic<bool> pending_write_{false};
-  std::atomic<bool> pending_error_{false};
+  // Bits for the directions that became ready and have yet to be handled by
+  // ExecutePendingActions. See Epoll1Poller::SetPendingActions for
+  // explanation on why this needs to be atomic.
+  enum : uint8_t { kPendingRead = 1, kPendingWrite = 2, kPendingError = 4 };
+  std::atomic<uint8_t> pending_actions_{0};
   Epoll1Poller::HandlesList list_;
   Epoll1Poller* poller_;
   std::unique_ptr<LockfreeEvent> read_closure_;
@@ -316,9 +305,7 @@ void Epoll1EventHandle::OrphanHandle(PosixEngineClosure* on_done,
     write_closure_->DestroyEvent();
     error_closure_->DestroyEvent();
   }
-  pending_read_.store(false, std::memory_order_release);
-  pending_write_.store(false, std::memory_order_release);
-  pending_error_.store(false, std::memory_order_release);
+  pending_actions_.store(0, std::memory_order_release);
   {
     grpc_core::MutexLock lock(&poller_->mu_);
     poller_->free_epoll1_handles_list_.push_back(this);
@@ -351,7 +338,16 @@ void Epoll1EventHandle::HandleShutdownInternal(absl::Status why,
 }
 
 Epoll1Poller::Epoll1Poller(Scheduler* scheduler)
-    : scheduler_(scheduler), was_kicked_(false), closed_(false) {
+    : scheduler_(scheduler),
+      was_kicked_(false),
+      closed_(false),
+      spin_budget_(std::chrono::microseconds(std::max(
+          0, grpc_core::ConfigVars::Get().EventEnginePollerSpinUs()))),
+      max_events_per_iteration_(std::max(
+          MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION,
+          std::min(
+              MAX_EPOLL_EVENTS,
+              grpc_core::ConfigVars::Get().EventEnginePollerInlineBatch()))) {
   g_epoll_set_.epfd = EpollCreateAndCloexec();
   wakeup_fd_ = *CreateWakeupFd();
   CHECK(wakeup_fd_ != nullptr);
@@ -466,19 +462,44 @@ bool Epoll1Poller::ProcessEpollEvents(int max_epoll_events_to_handle,
 //  See ProcessEpollEvents() function for more details. It returns the number
 // of events generated by epoll_wait.
 int Epoll1Poller::DoEpollWait(EventEngine::Duration timeout) {
+  int r = -1;
+  if (spin_budget_ > EventEngine::Duration::zero() &&
+      timeout > EventEngine::Duration::zero()) {
+    // Busy poll first: an event arriving within the budget is picked up
+    // without this thread going to sleep and having to be woken up again.
+    const auto spin_start = std::chrono::steady_clock::now();
+    const auto spin_end = spin_start + std::min(spin_budget_, timeout);
+    auto now = spin_start;
+    do {
+      r = EpollWait(0);
+      if (r > 0) break;
+      now = std::chrono::steady_clock::now();
+    } while (now < spin_end);
+    timeout -= std::chrono::duration_cast<EventEngine::Duration>(now -
+                                                                 spin_start);
+  }
+  // Block for the rest of the timeout, unless spinning already found events or
+  // used it all up.
+  if (r < 0 || (r == 0 && timeout > EventEngine::Duration::zero())) {
+    r = EpollWait(static_cast<int>(
+        grpc_event_engine::experimental::Milliseconds(timeout)));
+  }
+  g_epoll_set_.num_events = r;
+  g_epoll_set_.cursor = 0;
+  return r;
+}
+
+int Epoll1Poller::EpollWait(int timeout_ms) {
   int r;
   do {
     r = epoll_wait(g_epoll_set_.epfd, g_epoll_set_.events, MAX_EPOLL_EVENTS,
-                   static_cast<int>(
-                       grpc_event_engine::experimental::Milliseconds(timeout)));
+                   timeout_ms);
   } while (r < 0 && errno == EINTR);
   if (r < 0) {
     grpc_core::Crash(absl::StrFormat(
         "(event_engine) Epoll1Poller:%p encountered epoll_wait error: %s", this,
         grpc_core::StrError(errno).c_str()));
   }
-  g_epoll_set_.num_events = r;
-  g_epoll_set_.cursor = 0;
   return r;
 }
 
@@ -529,12 +550,15 @@ Poller::WorkResult Epoll1Poller::Work(
     if (DoEpollWait(timeout) == 0) {
       return Poller::WorkResult::kDeadlineExceeded;
     }
+    // Work triggered by these events may use Timestamp::NowCoarse(), which
+    // would otherwise still hold the time from before this thread slept.
+    grpc_core::Timestamp::RefreshCoarseNow();
   }
   {
     grpc_core::MutexLock lock(&mu_);
     // If was_kicked_ is true, collect all pending events in this iteration.
     if (ProcessEpollEvents(
-            was_kicked_ ? INT_MAX : MAX_EPOLL_EVENTS_HANDLED_PER_ITERATION,
+            was_kicked_ ? INT_MAX : max_events_per_iteration_,
             pending_events)) {
       was_kicked_ = false;
       was_kicked_ext = true;
@@ -611,6 +635,10 @@ int Epoll1Poller::DoEpollWait(EventEngine::Duration /*timeout*/) {
   grpc_core::Crash("unimplemented");
 }
 
+int Epoll1Poller::EpollWait(int /*timeout_ms*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 Poller::WorkResult Epoll1Poller::Work(
     EventEngine::Duration /*timeout*/,
     absl::FunctionRef<void()> /*schedule_poll_again*/) {
@@ -92,6 +92,8 @@ class Epoll1Poller : public PosixEventPoller {
   // of events generated by epoll_wait.
   int DoEpollWait(
       grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // A single epoll_wait() call (retried on EINTR).
+  int EpollWait(int timeout_ms);
   class HandlesList {
    public:
     explicit HandlesList(Epoll1EventHandle* handle) : handle(handle) {}
@@ -125,6 +127,12 @@ class Epoll1Poller : public PosixEventPoller {
   std::list<EventHandle*> free_epoll1_handles_list_ ABSL_GUARDED_BY(mu_);
   std::unique_ptr<WakeupFd> wakeup_fd_;
   bool closed_;
+  // How long DoEpollWait polls without blocking before it blocks, see the
+  // GRPC_EVENT_ENGINE_POLLER_SPIN_US config var.
+  grpc_event_engine::experimental::EventEngine::Duration spin_budget_;
+  // How many ready fds one Work() call handles, see the
+  // GRPC_EVENT_ENGINE_POLLER_INLINE_BATCH config var.
+  int max_events_per_iteration_;
 };
 
 // Return an instance of a epoll1 based poller tied to the specified event
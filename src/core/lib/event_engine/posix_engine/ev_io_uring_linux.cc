@@ -0,0 +1,944 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_format.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/status.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/time_util.h"
+#include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <errno.h>
+#include <linux/time_types.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/lockfree_event.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/gprpp/fork.h"
+#include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/strerror.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+constexpr unsigned kSubmissionQueueEntries = 256;
+// Completions are only ever produced for submitted polls, of which there are
+// at most three per handle, so size the completion ring generously; the
+// kernel buffers overflowing completions (IORING_FEAT_NODROP) in any case.
+constexpr unsigned kCompletionQueueEntries = 16384;
+// Multishot receives of all handles select from the same ring of buffers.
+// The data is copied out as soon as the completion is seen, so the buffers
+// are only held for as long as completions wait to be processed. Must be a
+// power of two.
+constexpr unsigned kReceiveBufferCount = 256;
+constexpr unsigned kReceiveBufferSize = 16 * 1024;
+constexpr uint16_t kReceiveBufferGroup = 0;
+// A handle stops receiving once this much data waits for its owner, and
+// receives again once the owner takes it.
+constexpr size_t kMaxReceivedBytes = 256 * 1024;
+
+// user_data of a completion identifies the handle and the direction of the
+// poll, or the receive (a ReceiveOp): both are at least 4-byte aligned,
+// leaving the low two bits.
+enum Direction : uint64_t { kRead = 0, kWrite = 1, kError = 2, kReceive = 3 };
+constexpr uint64_t kDirectionMask = 3;
+// user_data of Kick() and poll cancellation completions.
+constexpr uint64_t kKickTag = ~uint64_t{0};
+constexpr uint64_t kCancelTag = ~uint64_t{0} - 1;
+
+int IoUringSetup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags, void* arg, size_t arg_size) {
+  int r;
+  do {
+    r = static_cast<int>(syscall(__NR_io_uring_enter, fd, to_submit,
+                                 min_complete, flags, arg, arg_size));
+  } while (r < 0 && errno == EINTR);
+  return r;
+}
+
+// Poll masks are passed to the kernel as two 16 bit halves.
+uint32_t PollMask(uint32_t events) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  return (events << 16) | (events >> 16);
+#else
+  return events;
+#endif
+}
+
+}  // namespace
+
+// A multishot receive submitted for a handle. It is only reused after its
+// last completion, so that completions of a receive that was stopped, or
+// submitted by a previous user of a recycled handle, can be told apart from
+// those of the receive in flight.
+struct ReceiveOp {
+  explicit ReceiveOp(IoUringEventHandle* handle) : handle(handle) {}
+  IoUringEventHandle* const handle;
+  bool in_flight = false;
+};
+
+class IoUringEventHandle : public EventHandle {
+ public:
+  IoUringEventHandle(int fd, bool track_err, IoUringPoller* poller)
+      : fd_(fd),
+        track_err_(track_err),
+        poller_(poller),
+        read_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        write_closure_(std::make_unique<LockfreeEvent>(poller->GetScheduler())),
+        error_closure_(
+            std::make_unique<LockfreeEvent>(poller->GetScheduler())) {
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+  }
+  void ReInit(int fd, bool track_err) {
+    fd_ = fd;
+    track_err_ = track_err;
+    read_closure_->InitEvent();
+    write_closure_->InitEvent();
+    error_closure_->InitEvent();
+    pending_actions_.store(0, std::memory_order_relaxed);
+    // Polls of the previous user of this handle may not have completed yet.
+    // Their completions only cause spurious wakeups, but they must not stop
+    // the new user from arming its own polls.
+    for (auto& armed : armed_) armed.store(false, std::memory_order_relaxed);
+    // Likewise, receives of the previous user stay in receive_ops_ until
+    // their last completion, which is dropped.
+    grpc_core::MutexLock lock(&receive_mu_);
+    receiving_.store(false, std::memory_order_relaxed);
+    receive_op_ = nullptr;
+    receive_paused_ = false;
+    receive_stopped_ = false;
+    received_any_ = false;
+    received_eof_ = false;
+    receive_error_ = 0;
+    received_.Clear();
+  }
+  IoUringPoller* Poller() override { return poller_; }
+  int WrappedFd() override { return fd_; }
+  void OrphanHandle(PosixEngineClosure* on_done, int* release_fd,
+                    absl::string_view reason) override;
+  void ShutdownHandle(absl::Status why) override;
+  void NotifyOnRead(PosixEngineClosure* on_read) override;
+  void NotifyOnWrite(PosixEngineClosure* on_write) override;
+  void NotifyOnError(PosixEngineClosure* on_error) override;
+  void SetReadable() override;
+  void SetWritable() override;
+  void SetHasError() override;
+  bool IsHandleShutdown() override;
+  bool StartReceiving() override;
+  int64_t ReceiveData(SliceBuffer& buffer) override;
+
+  // Record the result of a poll completion. Returns true if the handle now
+  // has pending actions. A completion may also be for a poll submitted by a
+  // previous user of a recycled handle, or a cancelled one: both just result
+  // in a spurious wakeup, which the endpoint and listener tolerate.
+  bool OnPollCompletion(Direction direction, int result) {
+    armed_[direction].store(false, std::memory_order_release);
+    const uint32_t events = result < 0 ? 0 : static_cast<uint32_t>(result);
+    bool read_ev = direction == kRead;
+    bool write_ev = direction == kWrite;
+    bool error_ev = direction == kError;
+    if (events & POLLHUP) read_ev = write_ev = true;
+    if (events & POLLERR) error_ev = true;
+    if (error_ev && !track_err_) {
+      // Without error tracking, errors are surfaced through reads and writes.
+      error_ev = false;
+      read_ev = write_ev = true;
+    }
+    return SetPendingActions(read_ev, write_ev, error_ev);
+  }
+  // Record a completion of \a op: \a result is what recv() would have
+  // returned, with the data received into \a data, and \a more tells if the
+  // receive goes on. Returns true if the handle now has pending actions.
+  bool OnReceiveCompletion(ReceiveOp* op, int result, const char* data,
+                           bool more);
+  inline void ExecutePendingActions() {
+    // These may execute in Parallel with ShutdownHandle. Thats not an issue
+    // because the lockfree event implementation should be able to handle it.
+    // A single exchange picks up every direction that became ready.
+    const uint8_t pending =
+        pending_actions_.exchange(0, std::memory_order_acq_rel);
+    if (pending & kPendingRead) read_closure_->SetReady();
+    if (pending & kPendingWrite) write_closure_->SetReady();
+    if (pending & kPendingError) error_closure_->SetReady();
+  }
+  ~IoUringEventHandle() override = default;
+
+ private:
+  bool SetPendingActions(bool pending_read, bool pending_write,
+                         bool pending_error) {
+    const uint8_t pending = (pending_read ? kPendingRead : 0) |
+                            (pending_write ? kPendingWrite : 0) |
+                            (pending_error ? kPendingError : 0);
+    if (pending == 0) return false;
+    pending_actions_.fetch_or(pending, std::memory_order_release);
+    return true;
+  }
+  uint64_t UserData(Direction direction) {
+    return reinterpret_cast<uintptr_t>(this) | direction;
+  }
+  static uint64_t UserData(ReceiveOp* op) {
+    return reinterpret_cast<uintptr_t>(op) | kReceive;
+  }
+  // Submit a one-shot poll for \a direction unless one is already in flight.
+  void Arm(Direction direction);
+  // Cancel all polls and the receive in flight for this handle.
+  void Disarm();
+  // Submit a multishot receive if the handle should be receiving and is not.
+  // Returns false if that failed.
+  bool MaybeArmReceiveLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(receive_mu_);
+  void HandleShutdownInternal(absl::Status why);
+
+  // See IoUringEventHandle::ShutdownHandle for explanation on why a mutex is
+  // required.
+  grpc_core::Mutex mu_;
+  int fd_;
+  bool track_err_;
+  // Bits for the directions that became ready and have yet to be handled by
+  // ExecutePendingActions.
+  enum : uint8_t { kPendingRead = 1, kPendingWrite = 2, kPendingError = 4 };
+  std::atomic<uint8_t> pending_actions_{0};
+  std::atomic<bool> armed_[3] = {{false}, {false}, {false}};
+  // Set while the poller receives the data of the fd, in which case reads
+  // are signalled by receive completions rather than polls.
+  std::atomic<bool> receiving_{false};
+  grpc_core::Mutex receive_mu_;
+  // The receive in flight, or nullptr.
+  ReceiveOp* receive_op_ ABSL_GUARDED_BY(receive_mu_) = nullptr;
+  // receive_op_ has been cancelled because too much data is queued. Its
+  // completions still count until the last one.
+  bool receive_paused_ ABSL_GUARDED_BY(receive_mu_) = false;
+  // The handle is shut down: nothing is received any more.
+  bool receive_stopped_ ABSL_GUARDED_BY(receive_mu_) = false;
+  bool received_any_ ABSL_GUARDED_BY(receive_mu_) = false;
+  bool received_eof_ ABSL_GUARDED_BY(receive_mu_) = false;
+  int receive_error_ ABSL_GUARDED_BY(receive_mu_) = 0;
+  // Data received and not yet taken by ReceiveData().
+  SliceBuffer received_ ABSL_GUARDED_BY(receive_mu_);
+  std::vector<std::unique_ptr<ReceiveOp>> receive_ops_
+      ABSL_GUARDED_BY(receive_mu_);
+  IoUringPoller* poller_;
+  std::unique_ptr<LockfreeEvent> read_closure_;
+  std::unique_ptr<LockfreeEvent> write_closure_;
+  std::unique_ptr<LockfreeEvent> error_closure_;
+};
+
+void IoUringEventHandle::Arm(Direction direction) {
+  if (armed_[direction].exchange(true, std::memory_order_acq_rel)) return;
+  uint32_t events = direction == kRead    ? POLLIN | POLLPRI
+                    : direction == kWrite ? POLLOUT
+                                          : POLLERR;
+  if (!poller_->Submit(IORING_OP_POLL_ADD, fd_, PollMask(events), 0,
+                       UserData(direction))) {
+    armed_[direction].store(false, std::memory_order_release);
+  }
+}
+
+void IoUringEventHandle::Disarm() {
+  for (Direction direction : {kRead, kWrite, kError}) {
+    if (armed_[direction].load(std::memory_order_acquire)) {
+      poller_->Submit(IORING_OP_POLL_REMOVE, -1, 0, UserData(direction),
+                      kCancelTag);
+    }
+  }
+  grpc_core::MutexLock lock(&receive_mu_);
+  receive_stopped_ = true;
+  if (receive_op_ != nullptr) {
+    poller_->Submit(IORING_OP_ASYNC_CANCEL, -1, 0, UserData(receive_op_),
+                    kCancelTag);
+    receive_op_ = nullptr;
+  }
+}
+
+bool IoUringEventHandle::MaybeArmReceiveLocked() {
+#ifdef GRPC_LINUX_IO_URING_RECV_MULTISHOT
+  if (!receiving_.load(std::memory_order_relaxed) || receive_stopped_ ||
+      receive_op_ != nullptr || received_eof_ || receive_error_ != 0 ||
+      received_.Length() >= kMaxReceivedBytes) {
+    return true;
+  }
+  ReceiveOp* op = nullptr;
+  for (auto& candidate : receive_ops_) {
+    if (!candidate->in_flight) {
+      op = candidate.get();
+      break;
+    }
+  }
+  if (op == nullptr) {
+    receive_ops_.push_back(std::make_unique<ReceiveOp>(this));
+    op = receive_ops_.back().get();
+  }
+  io_uring_sqe sqe;
+  memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = IORING_OP_RECV;
+  sqe.fd = fd_;
+  sqe.ioprio = IORING_RECV_MULTISHOT;
+  sqe.flags = IOSQE_BUFFER_SELECT;
+  sqe.buf_group = kReceiveBufferGroup;
+  sqe.user_data = UserData(op);
+  if (!poller_->Submit(sqe)) return false;
+  op->in_flight = true;
+  receive_op_ = op;
+  receive_paused_ = false;
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool IoUringEventHandle::StartReceiving() {
+  if (!poller_->can_receive_.load(std::memory_order_relaxed)) return false;
+  grpc_core::MutexLock lock(&receive_mu_);
+  receiving_.store(true, std::memory_order_relaxed);
+  if (!MaybeArmReceiveLocked()) {
+    receiving_.store(false, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+int64_t IoUringEventHandle::ReceiveData(SliceBuffer& buffer) {
+  grpc_core::MutexLock lock(&receive_mu_);
+  if (!receiving_.load(std::memory_order_relaxed)) {
+    errno = EOPNOTSUPP;
+    return -1;
+  }
+  const size_t length = received_.Length();
+  if (length > 0) {
+    received_.MoveFirstNBytesIntoSliceBuffer(length, buffer);
+    // Receive again if we stopped because too much data was queued.
+    if (!MaybeArmReceiveLocked()) receive_error_ = ENOBUFS;
+    return static_cast<int64_t>(length);
+  }
+  if (received_eof_) return 0;
+  errno = receive_error_ != 0 ? receive_error_ : EAGAIN;
+  return -1;
+}
+
+bool IoUringEventHandle::OnReceiveCompletion(ReceiveOp* op, int result,
+                                             const char* data, bool more) {
+  grpc_core::MutexLock lock(&receive_mu_);
+  if (!more) op->in_flight = false;
+  // Completions of a receive cancelled by Disarm(), or submitted by a
+  // previous user of this handle, are dropped.
+  if (op != receive_op_) return false;
+  if (!more) receive_op_ = nullptr;
+  bool readable = true;
+  if (result > 0) {
+    DCHECK(data != nullptr);
+    received_any_ = true;
+    received_.Append(Slice::FromCopiedBuffer(data, result));
+    if (receive_op_ != nullptr && !receive_paused_ &&
+        received_.Length() >= kMaxReceivedBytes) {
+      // Leave the rest in the socket, so that the peer is flow controlled.
+      // Whatever the receive gets before the cancellation is still queued.
+      poller_->Submit(IORING_OP_ASYNC_CANCEL, -1, 0, UserData(op),
+                      kCancelTag);
+      receive_paused_ = true;
+    }
+  } else if (result == 0) {
+    received_eof_ = true;
+  } else if (!received_any_ && (result == -EINVAL || result == -EOPNOTSUPP ||
+                                 result == -ENOBUFS)) {
+    // Multishot receive needs Linux 6.0, and some kernels accept the buffer
+    // ring but never select from it. Stop using it, and tell the owner to
+    // read the fd itself; nothing was taken from it.
+    poller_->can_receive_.store(false, std::memory_order_relaxed);
+    receiving_.store(false, std::memory_order_relaxed);
+  } else if (result == -ENOBUFS || result == -ECANCELED) {
+    // The buffer ring ran dry, or the receive was paused above. Either way,
+    // nothing new to report; receive again below if there is room.
+    readable = false;
+  } else {
+    receive_error_ = -result;
+  }
+  if (!MaybeArmReceiveLocked()) {
+    receive_error_ = ENOBUFS;
+    readable = true;
+  }
+  return SetPendingActions(readable, false, false);
+}
+
+void IoUringEventHandle::OrphanHandle(PosixEngineClosure* on_done,
+                                      int* release_fd,
+                                      absl::string_view reason) {
+  if (!read_closure_->IsShutdown()) {
+    HandleShutdownInternal(absl::Status(absl::StatusCode::kUnknown, reason));
+  }
+  // Polls hold their own reference to the file, so they must be cancelled
+  // even if we are going to close it. Data received but never taken is
+  // dropped, including when the fd is released to the caller.
+  Disarm();
+  {
+    grpc_core::MutexLock lock(&receive_mu_);
+    received_.Clear();
+  }
+  if (release_fd != nullptr) {
+    *release_fd = fd_;
+  } else {
+    shutdown(fd_, SHUT_RDWR);
+    close(fd_);
+  }
+  {
+    // See IoUringEventHandle::ShutdownHandle for explanation on why a mutex
+    // is required here.
+    grpc_core::MutexLock lock(&mu_);
+    read_closure_->DestroyEvent();
+    write_closure_->DestroyEvent();
+    error_closure_->DestroyEvent();
+  }
+  pending_actions_.store(0, std::memory_order_release);
+  {
+    grpc_core::MutexLock lock(&poller_->mu_);
+    poller_->free_io_uring_handles_list_.push_back(this);
+  }
+  if (on_done != nullptr) {
+    on_done->SetStatus(absl::OkStatus());
+    poller_->GetScheduler()->Run(on_done);
+  }
+}
+
+void IoUringEventHandle::HandleShutdownInternal(absl::Status why) {
+  grpc_core::StatusSetInt(&why, grpc_core::StatusIntProperty::kRpcStatus,
+                          GRPC_STATUS_UNAVAILABLE);
+  if (read_closure_->SetShutdown(why)) {
+    write_closure_->SetShutdown(why);
+    error_closure_->SetShutdown(why);
+  }
+}
+
+// Might be called multiple times
+void IoUringEventHandle::ShutdownHandle(absl::Status why) {
+  // A mutex is required here because, the SetShutdown method of the
+  // lockfree event may schedule a closure if it is already ready and that
+  // closure may call OrphanHandle. Execution of ShutdownHandle and OrphanHandle
+  // in parallel is not safe because some of the lockfree event types e.g, read,
+  // write, error may-not have called SetShutdown when DestroyEvent gets
+  // called in the OrphanHandle method.
+  grpc_core::MutexLock lock(&mu_);
+  HandleShutdownInternal(why);
+  Disarm();
+}
+
+bool IoUringEventHandle::IsHandleShutdown() {
+  return read_closure_->IsShutdown();
+}
+
+void IoUringEventHandle::NotifyOnRead(PosixEngineClosure* on_read) {
+  read_closure_->NotifyOn(on_read);
+  // While receiving, receive completions make the handle readable.
+  if (!read_closure_->IsShutdown() &&
+      !receiving_.load(std::memory_order_relaxed)) {
+    Arm(kRead);
+  }
+}
+
+void IoUringEventHandle::NotifyOnWrite(PosixEngineClosure* on_write) {
+  write_closure_->NotifyOn(on_write);
+  if (!write_closure_->IsShutdown()) Arm(kWrite);
+}
+
+void IoUringEventHandle::NotifyOnError(PosixEngineClosure* on_error) {
+  error_closure_->NotifyOn(on_error);
+  if (!error_closure_->IsShutdown()) Arm(kError);
+}
+
+void IoUringEventHandle::SetReadable() { read_closure_->SetReady(); }
+
+void IoUringEventHandle::SetWritable() { write_closure_->SetReady(); }
+
+void IoUringEventHandle::SetHasError() { error_closure_->SetReady(); }
+
+IoUringPoller::IoUringPoller(Scheduler* scheduler)
+    : scheduler_(scheduler), was_kicked_(false), closed_(false) {}
+
+bool IoUringPoller::Init() {
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  params.flags = IORING_SETUP_CQSIZE;
+  params.cq_entries = kCompletionQueueEntries;
+  ring_.fd = IoUringSetup(kSubmissionQueueEntries, &params);
+  if (ring_.fd < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring_setup failed: " << grpc_core::StrError(errno);
+    return false;
+  }
+  constexpr uint32_t kRequiredFeatures =
+      IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+  if ((params.features & kRequiredFeatures) != kRequiredFeatures) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring lacks required features: " << params.features;
+    return false;
+  }
+  ring_.sq_entries = params.sq_entries;
+  ring_.sq_ring_size =
+      params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring_.sq_ring = mmap(nullptr, ring_.sq_ring_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring_.fd, IORING_OFF_SQ_RING);
+  ring_.sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  ring_.sqes = static_cast<io_uring_sqe*>(
+      mmap(nullptr, ring_.sqes_size, PROT_READ | PROT_WRITE,
+           MAP_SHARED | MAP_POPULATE, ring_.fd, IORING_OFF_SQES));
+  ring_.cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  ring_.cq_ring = mmap(nullptr, ring_.cq_ring_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, ring_.fd, IORING_OFF_CQ_RING);
+  if (ring_.sq_ring == MAP_FAILED || ring_.sqes == MAP_FAILED ||
+      ring_.cq_ring == MAP_FAILED) {
+    LOG(ERROR) << "io_uring mmap failed: " << grpc_core::StrError(errno);
+    return false;
+  }
+  char* sq = static_cast<char*>(ring_.sq_ring);
+  ring_.sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  ring_.sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  ring_.sq_mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  ring_.sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  char* cq = static_cast<char*>(ring_.cq_ring);
+  ring_.cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  ring_.cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  ring_.cq_mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  ring_.cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+  GRPC_TRACE_LOG(event_engine_poller, INFO) << "grpc io_uring fd: " << ring_.fd;
+  can_receive_.store(InitReceiveBuffers(), std::memory_order_relaxed);
+  return true;
+}
+
+bool IoUringPoller::InitReceiveBuffers() {
+#ifdef GRPC_LINUX_IO_URING_RECV_MULTISHOT
+  void* buffers =
+      mmap(nullptr, kReceiveBufferCount * kReceiveBufferSize,
+           PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  void* ring = mmap(nullptr, kReceiveBufferCount * sizeof(io_uring_buf),
+                    PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buffers == MAP_FAILED || ring == MAP_FAILED) {
+    LOG(ERROR) << "io_uring receive buffer mmap failed: "
+               << grpc_core::StrError(errno);
+    if (buffers != MAP_FAILED) {
+      munmap(buffers, kReceiveBufferCount * kReceiveBufferSize);
+    }
+    if (ring != MAP_FAILED) {
+      munmap(ring, kReceiveBufferCount * sizeof(io_uring_buf));
+    }
+    return false;
+  }
+  receive_buffers_ = static_cast<char*>(buffers);
+  receive_buffer_ring_ = ring;
+  io_uring_buf_reg reg;
+  memset(&reg, 0, sizeof(reg));
+  reg.ring_addr = reinterpret_cast<uintptr_t>(ring);
+  reg.ring_entries = kReceiveBufferCount;
+  reg.bgid = kReceiveBufferGroup;
+  if (syscall(__NR_io_uring_register, ring_.fd, IORING_REGISTER_PBUF_RING,
+              &reg, 1) != 0) {
+    // Needs Linux 5.19; the poller still works, reading through polls.
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring buffer ring registration failed: "
+        << grpc_core::StrError(errno);
+    return false;
+  }
+  grpc_core::MutexLock lock(&mu_);
+  for (uint16_t id = 0; id < kReceiveBufferCount; ++id) {
+    RecycleReceiveBuffer(id);
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+void IoUringPoller::RecycleReceiveBuffer(uint16_t id) {
+#ifdef GRPC_LINUX_IO_URING_RECV_MULTISHOT
+  auto* ring = static_cast<io_uring_buf_ring*>(receive_buffer_ring_);
+  // The kernel keeps the ring tail in the last field of the first entry, so
+  // an entry is filled in field by field rather than overwritten whole.
+  io_uring_buf* buf =
+      &ring->bufs[receive_buffer_tail_ & (kReceiveBufferCount - 1)];
+  buf->addr = reinterpret_cast<uintptr_t>(ReceiveBuffer(id));
+  buf->len = kReceiveBufferSize;
+  buf->bid = id;
+  ++receive_buffer_tail_;
+  __atomic_store_n(&ring->tail, receive_buffer_tail_, __ATOMIC_RELEASE);
+#else
+  (void)id;
+#endif
+}
+
+const char* IoUringPoller::ReceiveBuffer(uint16_t id) const {
+  return receive_buffers_ + static_cast<size_t>(id) * kReceiveBufferSize;
+}
+
+void IoUringPoller::Shutdown() {}
+
+void IoUringPoller::Close() {
+  grpc_core::MutexLock lock(&mu_);
+  if (closed_) return;
+  if (ring_.sq_ring != nullptr && ring_.sq_ring != MAP_FAILED) {
+    munmap(ring_.sq_ring, ring_.sq_ring_size);
+  }
+  if (ring_.sqes != nullptr && ring_.sqes != MAP_FAILED) {
+    munmap(ring_.sqes, ring_.sqes_size);
+  }
+  if (ring_.cq_ring != nullptr && ring_.cq_ring != MAP_FAILED) {
+    munmap(ring_.cq_ring, ring_.cq_ring_size);
+  }
+  if (ring_.fd >= 0) {
+    close(ring_.fd);
+    ring_.fd = -1;
+  }
+#ifdef GRPC_LINUX_IO_URING_RECV_MULTISHOT
+  if (receive_buffer_ring_ != nullptr) {
+    munmap(receive_buffer_ring_, kReceiveBufferCount * sizeof(io_uring_buf));
+    receive_buffer_ring_ = nullptr;
+  }
+  if (receive_buffers_ != nullptr) {
+    munmap(receive_buffers_, kReceiveBufferCount * kReceiveBufferSize);
+    receive_buffers_ = nullptr;
+  }
+#endif
+  while (!free_io_uring_handles_list_.empty()) {
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        free_io_uring_handles_list_.front());
+    free_io_uring_handles_list_.pop_front();
+    delete handle;
+  }
+  closed_ = true;
+}
+
+IoUringPoller::~IoUringPoller() { Close(); }
+
+EventHandle* IoUringPoller::CreateHandle(int fd, absl::string_view /*name*/,
+                                         bool track_err) {
+  grpc_core::MutexLock lock(&mu_);
+  if (free_io_uring_handles_list_.empty()) {
+    return new IoUringEventHandle(fd, track_err, this);
+  }
+  IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+      free_io_uring_handles_list_.front());
+  free_io_uring_handles_list_.pop_front();
+  handle->ReInit(fd, track_err);
+  return handle;
+}
+
+unsigned IoUringPoller::QueuedSubmissionsLocked() {
+  // We are the only writer of the tail; the kernel advances the head.
+  return *ring_.sq_tail - __atomic_load_n(ring_.sq_head, __ATOMIC_ACQUIRE);
+}
+
+void IoUringPoller::FlushSubmissionsLocked() {
+  const unsigned to_submit = QueuedSubmissionsLocked();
+  if (to_submit == 0) return;
+  // If this fails (e.g. EBUSY while overflowed completions are drained), the
+  // entries stay queued and go out with the next successful enter.
+  if (IoUringEnter(ring_.fd, to_submit, 0, 0, nullptr, 0) < 0) {
+    GRPC_TRACE_LOG(event_engine_poller, INFO)
+        << "io_uring_enter (submit) failed: " << grpc_core::StrError(errno);
+  }
+}
+
+bool IoUringPoller::Submit(uint8_t opcode, int fd, uint32_t poll_events,
+                           uint64_t target, uint64_t user_data) {
+  io_uring_sqe sqe;
+  memset(&sqe, 0, sizeof(sqe));
+  sqe.opcode = opcode;
+  sqe.fd = fd;
+  sqe.poll32_events = poll_events;
+  sqe.addr = target;
+  sqe.user_data = user_data;
+  return Submit(sqe);
+}
+
+bool IoUringPoller::Submit(const io_uring_sqe& sqe) {
+  grpc_core::MutexLock lock(&sq_mu_);
+  if (QueuedSubmissionsLocked() >= ring_.sq_entries) {
+    FlushSubmissionsLocked();
+    if (QueuedSubmissionsLocked() >= ring_.sq_entries) {
+      LOG(ERROR) << "io_uring submission queue full";
+      return false;
+    }
+  }
+  const unsigned tail = *ring_.sq_tail;
+  const unsigned index = tail & *ring_.sq_mask;
+  ring_.sqes[index] = sqe;
+  ring_.sq_array[index] = index;
+  __atomic_store_n(ring_.sq_tail, tail + 1, __ATOMIC_RELEASE);
+  // Entries queued while no thread is in Work() go out with the next Work()'s
+  // io_uring_enter(). A thread that is already waiting would not see them
+  // though, so in that case hand them to the kernel right away.
+  if (waiters_ > 0) FlushSubmissionsLocked();
+  return true;
+}
+
+bool IoUringPoller::WaitForCompletions(EventEngine::Duration timeout) {
+  auto completions_ready = [this]() {
+    return *ring_.cq_head != __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  };
+  // Everything queued since the last Work() is submitted by the same
+  // io_uring_enter() that waits for completions. Entries queued after this
+  // point are flushed by Submit() itself while we are waiting.
+  unsigned to_submit;
+  {
+    grpc_core::MutexLock lock(&sq_mu_);
+    to_submit = QueuedSubmissionsLocked();
+    ++waiters_;
+  }
+  auto done_waiting = [this]() {
+    grpc_core::MutexLock lock(&sq_mu_);
+    --waiters_;
+  };
+  if (completions_ready()) {
+    if (to_submit > 0 &&
+        IoUringEnter(ring_.fd, to_submit, 0, 0, nullptr, 0) < 0) {
+      GRPC_TRACE_LOG(event_engine_poller, INFO)
+          << "io_uring_enter (submit) failed: " << grpc_core::StrError(errno);
+    }
+    done_waiting();
+    return true;
+  }
+  const int64_t timeout_ms =
+      grpc_event_engine::experimental::Milliseconds(timeout);
+  __kernel_timespec ts;
+  io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  if (timeout_ms >= 0) {
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (timeout_ms % 1000) * 1000000;
+    arg.ts = reinterpret_cast<uintptr_t>(&ts);
+  }
+  if (IoUringEnter(ring_.fd, to_submit, 1,
+                   IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                   sizeof(arg)) < 0 &&
+      errno != ETIME && errno != EBUSY) {
+    grpc_core::Crash(absl::StrFormat(
+        "(event_engine) IoUringPoller:%p encountered io_uring_enter error: %s",
+        this, grpc_core::StrError(errno).c_str()));
+  }
+  done_waiting();
+  return completions_ready();
+}
+
+bool IoUringPoller::ProcessCompletions(Events& pending_events) {
+  unsigned head = *ring_.cq_head;
+  const unsigned tail = __atomic_load_n(ring_.cq_tail, __ATOMIC_ACQUIRE);
+  const unsigned mask = *ring_.cq_mask;
+  bool was_kicked = false;
+  for (; head != tail; ++head) {
+    const io_uring_cqe& cqe = ring_.cqes[head & mask];
+    if (cqe.user_data == kKickTag) {
+      was_kicked = true;
+      continue;
+    }
+    if (cqe.user_data == kCancelTag) continue;
+#ifdef GRPC_LINUX_IO_URING_RECV_MULTISHOT
+    if ((cqe.user_data & kDirectionMask) == kReceive) {
+      ReceiveOp* op = reinterpret_cast<ReceiveOp*>(
+          static_cast<uintptr_t>(cqe.user_data & ~kDirectionMask));
+      const bool has_buffer = (cqe.flags & IORING_CQE_F_BUFFER) != 0;
+      const uint16_t id =
+          static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+      if (op->handle->OnReceiveCompletion(
+              op, cqe.res, has_buffer ? ReceiveBuffer(id) : nullptr,
+              (cqe.flags & IORING_CQE_F_MORE) != 0)) {
+        pending_events.push_back(op->handle);
+      }
+      if (has_buffer) RecycleReceiveBuffer(id);
+      continue;
+    }
+#endif
+    IoUringEventHandle* handle = reinterpret_cast<IoUringEventHandle*>(
+        static_cast<uintptr_t>(cqe.user_data & ~kDirectionMask));
+    if (handle->OnPollCompletion(
+            static_cast<Direction>(cqe.user_data & kDirectionMask),
+            cqe.res)) {
+      pending_events.push_back(handle);
+    }
+  }
+  __atomic_store_n(ring_.cq_head, head, __ATOMIC_RELEASE);
+  return was_kicked;
+}
+
+// Polls the registered Fds for events until timeout is reached or there is a
+// Kick(). If there is a Kick(), it collects and processes any previously
+// un-processed events. If there are no un-processed events, it returns
+// Poller::WorkResult::Kicked{}
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration timeout,
+    absl::FunctionRef<void()> schedule_poll_again) {
+  Events pending_events;
+  bool was_kicked_ext = false;
+  if (!WaitForCompletions(timeout)) {
+    return Poller::WorkResult::kDeadlineExceeded;
+  }
+  // Work triggered by these completions may use Timestamp::NowCoarse(), which
+  // would otherwise still hold the time from before this thread slept.
+  grpc_core::Timestamp::RefreshCoarseNow();
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (ProcessCompletions(pending_events)) {
+      was_kicked_ = false;
+      was_kicked_ext = true;
+    }
+    if (pending_events.empty()) {
+      return Poller::WorkResult::kKicked;
+    }
+  }
+  // Run the provided callback.
+  schedule_poll_again();
+  // Process all pending events inline.
+  for (auto& it : pending_events) {
+    it->ExecutePendingActions();
+  }
+  return was_kicked_ext ? Poller::WorkResult::kKicked : Poller::WorkResult::kOk;
+}
+
+void IoUringPoller::Kick() {
+  grpc_core::MutexLock lock(&mu_);
+  if (was_kicked_ || closed_) {
+    return;
+  }
+  was_kicked_ = true;
+  CHECK(Submit(IORING_OP_NOP, -1, 0, 0, kKickTag));
+}
+
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler) {
+  // Recreating rings and handles in a forked child is not implemented.
+  if (grpc_core::Fork::Enabled()) return nullptr;
+  auto poller = std::make_shared<IoUringPoller>(scheduler);
+  if (!poller->Init()) return nullptr;
+  return poller;
+}
+
+void IoUringPoller::PrepareFork() { Kick(); }
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#else  // defined(GRPC_LINUX_IO_URING)
+
+namespace grpc_event_engine {
+namespace experimental {
+
+IoUringPoller::IoUringPoller(Scheduler* /* scheduler */) {
+  grpc_core::Crash("unimplemented");
+}
+
+bool IoUringPoller::Init() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::Shutdown() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::Close() { grpc_core::Crash("unimplemented"); }
+
+IoUringPoller::~IoUringPoller() { grpc_core::Crash("unimplemented"); }
+
+EventHandle* IoUringPoller::CreateHandle(int /*fd*/, absl::string_view /*name*/,
+                                         bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+bool IoUringPoller::Submit(uint8_t /*opcode*/, int /*fd*/,
+                           uint32_t /*poll_events*/, uint64_t /*target*/,
+                           uint64_t /*user_data*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+bool IoUringPoller::Submit(const io_uring_sqe& /*sqe*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+bool IoUringPoller::InitReceiveBuffers() { grpc_core::Crash("unimplemented"); }
+
+void IoUringPoller::RecycleReceiveBuffer(uint16_t /*id*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+const char* IoUringPoller::ReceiveBuffer(uint16_t /*id*/) const {
+  grpc_core::Crash("unimplemented");
+}
+
+unsigned IoUringPoller::QueuedSubmissionsLocked() {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::FlushSubmissionsLocked() {
+  grpc_core::Crash("unimplemented");
+}
+
+bool IoUringPoller::WaitForCompletions(EventEngine::Duration /*timeout*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+bool IoUringPoller::ProcessCompletions(Events& /*pending_events*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+Poller::WorkResult IoUringPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void IoUringPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+// If GRPC_LINUX_IO_URING is not defined, io_uring is not available. Return
+// nullptr.
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* /*scheduler*/) {
+  return nullptr;
+}
+
+void IoUringPoller::PrepareFork() {}
+
+void IoUringPoller::PostforkParent() {}
+
+void IoUringPoller::PostforkChild() {}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // defined(GRPC_LINUX_IO_URING)
@@ -0,0 +1,180 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/internal_errqueue.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_IO_URING
+#include <linux/io_uring.h>
+#else
+struct io_uring_sqe;
+#endif
+
+namespace grpc_event_engine {
+namespace experimental {
+
+class IoUringEventHandle;
+
+// A poller built on io_uring. Readiness of each fd is requested with one-shot
+// IORING_OP_POLL_ADD submissions, armed only for the directions a closure is
+// actually waiting on, and a single io_uring_enter() both waits (with a
+// timeout) and returns every completion that is ready. Submissions are
+// batched: those queued between two calls to Work() are handed to the kernel
+// by the io_uring_enter() that waits for completions. Handles keep the
+// LockfreeEvent based semantics of the epoll1 poller, so the existing
+// readiness based endpoint and listener run on top of it unchanged.
+//
+// Where the kernel supports it, TCP endpoints do not read their socket at
+// all: EventHandle::StartReceiving() submits one multishot IORING_OP_RECV
+// per socket, which keeps receiving into buffers of a ring registered with
+// the kernel (IORING_REGISTER_PBUF_RING). Each completion copies the data
+// out onto the handle and hands the buffer straight back, so a busy
+// connection costs no syscall per read, where epoll costs an epoll_wait()
+// wakeup plus a recvmsg(). A handle stops receiving while a bounded amount
+// of data waits for its owner, which keeps TCP flow control in effect.
+class IoUringPoller : public PosixEventPoller {
+ public:
+  explicit IoUringPoller(Scheduler* scheduler);
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  std::string Name() override { return "io_uring"; }
+  void Kick() override;
+  Scheduler* GetScheduler() { return scheduler_; }
+  void Shutdown() override;
+  bool CanTrackErrors() const override {
+#ifdef GRPC_POSIX_SOCKET_TCP
+    return KernelSupportsErrqueue();
+#else
+    return false;
+#endif
+  }
+  ~IoUringPoller() override;
+
+  // Forkable
+  void PrepareFork() override;
+  void PostforkParent() override;
+  void PostforkChild() override;
+
+  void Close();
+
+  // Set up the submission and completion rings. Returns false if the kernel
+  // does not provide the io_uring features this poller relies on.
+  bool Init();
+
+ private:
+  friend class IoUringEventHandle;
+  // This initial vector size may need to be tuned
+  using Events = absl::InlinedVector<IoUringEventHandle*, 5>;
+
+  // Queue a single submission. It is handed to the kernel by the next Work(),
+  // or right away if a thread is already waiting in Work(). For POLL_ADD, \a
+  // fd and \a poll_events describe the poll; for POLL_REMOVE, \a target is
+  // the user_data of the poll to cancel.
+  bool Submit(uint8_t opcode, int fd, uint32_t poll_events, uint64_t target,
+              uint64_t user_data);
+  // Queue a submission the caller filled in completely.
+  bool Submit(const io_uring_sqe& sqe);
+  // Register the ring of buffers multishot receives select from. Returns
+  // false if the kernel cannot provide buffers this way.
+  bool InitReceiveBuffers();
+  // Hand buffer \a id back to the kernel once its data has been copied out.
+  void RecycleReceiveBuffer(uint16_t id) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  const char* ReceiveBuffer(uint16_t id) const;
+  // Number of queued submissions the kernel has not consumed yet.
+  unsigned QueuedSubmissionsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Hand every queued submission to the kernel.
+  void FlushSubmissionsLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sq_mu_);
+  // Submit the queued entries and wait until there is at least one
+  // completion, or timeout. Returns false if no completion is available.
+  bool WaitForCompletions(
+      grpc_event_engine::experimental::EventEngine::Duration timeout);
+  // Consume all available completions, collecting the handles that have
+  // pending actions. Returns true if one of them was a Kick().
+  bool ProcessCompletions(Events& pending_events)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+#ifdef GRPC_LINUX_IO_URING
+  struct Ring {
+    int fd = -1;
+    unsigned sq_entries = 0;
+    void* sq_ring = nullptr;
+    size_t sq_ring_size = 0;
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_array = nullptr;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqes_size = 0;
+    void* cq_ring = nullptr;
+    size_t cq_ring_size = 0;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+  };
+#else
+  struct Ring {};
+#endif
+  grpc_core::Mutex mu_;
+  // Serializes writers of the submission ring.
+  grpc_core::Mutex sq_mu_;
+  // Number of threads waiting for completions in Work().
+  int waiters_ ABSL_GUARDED_BY(sq_mu_) = 0;
+  Scheduler* scheduler_;
+  Ring ring_;
+  // The registered ring of receive buffers (io_uring_buf_ring) and the
+  // buffers themselves.
+  void* receive_buffer_ring_ = nullptr;
+  char* receive_buffers_ = nullptr;
+  // Local copy of the buffer ring tail, which only we advance.
+  uint16_t receive_buffer_tail_ ABSL_GUARDED_BY(mu_) = 0;
+  // Cleared once the kernel turns out not to support multishot receives.
+  std::atomic<bool> can_receive_{false};
+  bool was_kicked_ ABSL_GUARDED_BY(mu_);
+  std::list<EventHandle*> free_io_uring_handles_list_ ABSL_GUARDED_BY(mu_);
+  bool closed_;
+};
+
+// Returns nullptr if io_uring is unavailable (or fork support is enabled,
+// which this poller does not implement).
+std::shared_ptr<IoUringPoller> MakeIoUringPoller(Scheduler* scheduler);
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EV_IO_URING_LINUX_H
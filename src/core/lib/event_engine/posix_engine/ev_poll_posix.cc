@@ -817,6 +817,9 @@ Poller::WorkResult PollPoller::Work(
     }
     return Poller::WorkResult::kDeadlineExceeded;
   }
+  // Work triggered by these events may use Timestamp::NowCoarse(), which
+  // would otherwise still hold the time from before this thread slept.
+  grpc_core::Timestamp::RefreshCoarseNow();
   // Run the provided callback synchronously.
   schedule_poll_again();
   // Process all pending events inline.
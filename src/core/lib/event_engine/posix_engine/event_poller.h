@@ -14,6 +14,9 @@
 
 #ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EVENT_POLLER_H
 #define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_EVENT_POLLER_H
+#include <errno.h>
+#include <stdint.h>
+
 #include <string>
 
 #include "absl/functional/any_invocable.h"
@@ -21,6 +24,7 @@
 #include "absl/strings/string_view.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/event_engine/forkable.h"
@@ -83,6 +87,21 @@ class EventHandle {
   virtual bool IsHandleShutdown() = 0;
   // Returns the poller which was used to create this handle.
   virtual PosixEventPoller* Poller() = 0;
+  // Asks the poller to receive the data of the wrapped stream socket itself,
+  // which some pollers (io_uring) can do without a recvmsg() per read.
+  // Returns false if it cannot. Otherwise NotifyOnRead closures run once
+  // data, the end of the stream or an error is queued on the handle, and the
+  // owner takes the data with ReceiveData() instead of reading the fd.
+  virtual bool StartReceiving() { return false; }
+  // Moves the data the poller received into \a buffer. Returns the number of
+  // bytes moved, 0 at the end of the stream, or -1 with errno set: EAGAIN if
+  // nothing is queued yet, and EOPNOTSUPP if the poller turned out to be
+  // unable to receive on this socket, in which case nothing was ever taken
+  // from it and the owner reads the fd itself from then on.
+  virtual int64_t ReceiveData(SliceBuffer& /*buffer*/) {
+    errno = EOPNOTSUPP;
+    return -1;
+  }
   virtual ~EventHandle() = default;
 };
 
@@ -23,6 +23,7 @@
 #include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/event_engine/forkable.h"
 #include "src/core/lib/event_engine/posix_engine/ev_epoll1_linux.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/ev_poll_posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/gprpp/no_destruct.h"
@@ -59,6 +60,9 @@ std::shared_ptr<PosixEventPoller> MakeDefaultPoller(Scheduler* scheduler) {
     if (PollStrategyMatches(*it, "epoll1")) {
       poller = MakeEpoll1Poller(scheduler);
     }
+    if (poller == nullptr && PollStrategyMatches(*it, "io_uring")) {
+      poller = MakeIoUringPoller(scheduler);
+    }
     if (poller == nullptr && PollStrategyMatches(*it, "poll")) {
       // If epoll1 fails and if poll strategy matches "poll", use Poll poller
       poller = MakePollPoller(scheduler, /*use_phony_poll=*/false);
@@ -90,14 +90,14 @@ void LockfreeEvent::DestroyEvent() {
 }
 
 void LockfreeEvent::NotifyOn(PosixEngineClosure* closure) {
-  // This load needs to be an acquire load because this can be a shutdown
-  // error that we might need to reference. Adding acquire semantics makes
-  // sure that the shutdown error has been initialized properly before us
-  // referencing it. The load() needs to be performed only once before entry
-  // into the loop. This is because if any of the compare_exchange_strong
-  // operations inside the loop return false, they automatically update curr
-  // with the new value. So it doesn't need to be loaded again.
-  intptr_t curr = state_.load(std::memory_order_acquire);
+  // This load can be relaxed: every transition below is made by a CAS with
+  // acquire semantics, and the shutdown error (the only thing referenced
+  // without a successful CAS) is only read after an acquire fence. The load()
+  // needs to be performed only once before entry into the loop. This is
+  // because if any of the compare_exchange_strong operations inside the loop
+  // return false, they automatically update curr with the new value. So it
+  // doesn't need to be loaded again.
+  intptr_t curr = state_.load(std::memory_order_relaxed);
   while (true) {
     switch (curr) {
       case kClosureNotReady: {
@@ -131,6 +131,9 @@ void LockfreeEvent::NotifyOn(PosixEngineClosure* closure) {
         // contains a pointer to the shutdown-error). If the fd is shutdown,
         // schedule the closure with the shutdown error
         if ((curr & kShutdownBit) > 0) {
+          // Pairs with the release in SetShutdown, so that the shutdown error
+          // has been initialized properly before we reference it.
+          std::atomic_thread_fence(std::memory_order_acquire);
           absl::Status shutdown_err =
               grpc_core::internal::StatusGetFromHeapPtr(curr & ~kShutdownBit);
           closure->SetStatus(shutdown_err);
@@ -203,11 +206,13 @@ bool LockfreeEvent::SetShutdown(absl::Status shutdown_error) {
 }
 
 void LockfreeEvent::SetReady() {
-  // The load() needs to be performed only once before entry
-  // into the loop. This is because if any of the compare_exchange_strong
-  // operations inside the loop return false, they automatically update curr
-  // with the new value. So it doesn't need to be loaded again.
-  intptr_t curr = state_.load(std::memory_order_acquire);
+  // Nothing is referenced through a value loaded here without a successful
+  // CAS (which has acquire semantics), so a relaxed load suffices. The load()
+  // needs to be performed only once before entry into the loop. This is
+  // because if any of the compare_exchange_strong operations inside the loop
+  // return false, they automatically update curr with the new value. So it
+  // doesn't need to be loaded again.
+  intptr_t curr = state_.load(std::memory_order_relaxed);
   while (true) {
     switch (curr) {
       case kClosureReady: {
@@ -22,19 +22,29 @@
 #include <string.h>
 #include <sys/socket.h>
 
+#include <deque>
+#include <map>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 
+#include "src/core/lib/event_engine/extensions/run_with_priority.h"
 #include "src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.h"
 #include "src/core/lib/gprpp/host_port.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/useful.h"
 
 namespace grpc_event_engine {
@@ -91,6 +101,103 @@ LookupHostnameBlocking(absl::string_view name, absl::string_view default_port) {
   return addresses;
 }
 
+// getaddrinfo blocks a thread for as long as the lookup takes. During a
+// resolver storm (every channel reconnecting after a network blip, say) the
+// lookups would tie up the thread pool that also serves RPCs, so only a few
+// run at once and the rest wait their turn. Lookups for a name that is
+// already queued or in flight wait for that lookup's result instead.
+//
+// Each EventEngine has a queue of its own, drained by tasks run on that
+// engine, so that lookups neither wait for nor run on the threads of another
+// engine.
+class LookupQueue {
+ public:
+  void Lookup(std::shared_ptr<EventEngine> event_engine, std::string name,
+              std::string default_port,
+              EventEngine::DNSResolver::LookupHostnameCallback on_resolved) {
+    grpc_core::MutexLock lock(&mu_);
+    EngineLookups* engine_lookups = &engines_[event_engine.get()];
+    auto it = engine_lookups->lookups.emplace(
+        Key(std::move(name), std::move(default_port)), PendingLookup());
+    it.first->second.callbacks.push_back(std::move(on_resolved));
+    if (!it.second) {
+      grpc_core::global_stats().IncrementNativeDnsLookupsCoalesced();
+      return;
+    }
+    it.first->second.start = grpc_core::Timestamp::Now();
+    engine_lookups->queue.push_back(it.first->first);
+    if (engine_lookups->workers < kMaxConcurrentLookups) {
+      ++engine_lookups->workers;
+      StartWorker(std::move(event_engine), engine_lookups);
+    }
+  }
+
+ private:
+  static constexpr size_t kMaxConcurrentLookups = 4;
+
+  using Key = std::pair<std::string /*name*/, std::string /*default_port*/>;
+
+  struct PendingLookup {
+    grpc_core::Timestamp start;
+    std::vector<EventEngine::DNSResolver::LookupHostnameCallback> callbacks;
+  };
+
+  // The lookups of one engine. Guarded by mu_.
+  struct EngineLookups {
+    // Lookups queued or in flight, by name.
+    std::map<Key, PendingLookup> lookups;
+    // Names waiting for a worker.
+    std::deque<Key> queue;
+    size_t workers = 0;
+  };
+
+  // A worker keeps looking up the names queued for its engine until there
+  // are none left. The engine's entry goes away with its last worker, so it
+  // never outlives the engine.
+  void StartWorker(std::shared_ptr<EventEngine> event_engine,
+                   EngineLookups* engine_lookups) {
+    RunWithPriority(
+        event_engine.get(),
+        EventEngineRunWithPriorityExtension::Priority::kLow,
+        [this, event_engine, engine_lookups]() {
+          while (true) {
+            Key key;
+            {
+              grpc_core::MutexLock lock(&mu_);
+              if (engine_lookups->queue.empty()) {
+                if (--engine_lookups->workers == 0) {
+                  engines_.erase(event_engine.get());
+                }
+                return;
+              }
+              key = std::move(engine_lookups->queue.front());
+              engine_lookups->queue.pop_front();
+            }
+            auto result = LookupHostnameBlocking(key.first, key.second);
+            PendingLookup lookup;
+            {
+              grpc_core::MutexLock lock(&mu_);
+              auto it = engine_lookups->lookups.find(key);
+              lookup = std::move(it->second);
+              engine_lookups->lookups.erase(it);
+            }
+            grpc_core::global_stats().IncrementNativeDnsLookupLatencyMs(
+                (grpc_core::Timestamp::Now() - lookup.start).millis());
+            for (auto& on_resolved : lookup.callbacks) on_resolved(result);
+          }
+        });
+  }
+
+  grpc_core::Mutex mu_;
+  // Engines with lookups queued or in flight.
+  std::map<const EventEngine*, EngineLookups> engines_ ABSL_GUARDED_BY(mu_);
+};
+
+LookupQueue* GetLookupQueue() {
+  static grpc_core::NoDestruct<LookupQueue> queue;
+  return queue.get();
+}
+
 }  // namespace
 
 NativePosixDNSResolver::NativePosixDNSResolver(
@@ -100,10 +207,8 @@ NativePosixDNSResolver::NativePosixDNSResolver(
 void NativePosixDNSResolver::LookupHostname(
     EventEngine::DNSResolver::LookupHostnameCallback on_resolved,
     absl::string_view name, absl::string_view default_port) {
-  event_engine_->Run(
-      [name, default_port, on_resolved = std::move(on_resolved)]() mutable {
-        on_resolved(LookupHostnameBlocking(name, default_port));
-      });
+  GetLookupQueue()->Lookup(event_engine_, std::string(name),
+                           std::string(default_port), std::move(on_resolved));
 }
 
 void NativePosixDNSResolver::LookupSRV(
@@ -16,11 +16,14 @@
 #include <errno.h>
 #include <inttypes.h>
 #include <limits.h>
+#include <stddef.h>
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -55,6 +58,8 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 #ifdef GRPC_LINUX_ERRQUEUE
@@ -286,6 +291,7 @@ absl::Status PosixEndpointImpl::TcpAnnotateError(absl::Status src_error) const {
 
 // Returns true if data available to read or error other than EAGAIN.
 bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
+  if (receiving_in_poller_) return TcpDoReceive(status);
   struct msghdr msg;
   struct iovec iov[MAX_READ_IOVEC];
   ssize_t read_bytes;
@@ -434,12 +440,56 @@ bool PosixEndpointImpl::TcpDoRead(absl::Status& status) {
       incoming_buffer_->MoveFirstNBytesIntoSliceBuffer(total_read_bytes,
                                                        last_read_buffer_);
       incoming_buffer_->Swap(last_read_buffer_);
+      if (ReleaseSpareReadBuffers()) {
+        last_read_buffer_.Clear();
+      }
       return true;
     }
   }
   if (total_read_bytes < incoming_buffer_->Length()) {
-    incoming_buffer_->MoveLastNBytesIntoSliceBuffer(
-        incoming_buffer_->Length() - total_read_bytes, last_read_buffer_);
+    if (ReleaseSpareReadBuffers()) {
+      incoming_buffer_->RemoveLastNBytes(incoming_buffer_->Length() -
+                                         total_read_bytes);
+    } else {
+      incoming_buffer_->MoveLastNBytesIntoSliceBuffer(
+          incoming_buffer_->Length() - total_read_bytes, last_read_buffer_);
+    }
+  }
+  return true;
+}
+
+bool PosixEndpointImpl::TcpDoReceive(absl::Status& status) {
+  // Unlike recvmsg(), this appends the data to what incoming_buffer_ holds,
+  // which is only ever data already received in this Read().
+  const int64_t received = handle_->ReceiveData(*incoming_buffer_);
+  if (received < 0 && errno == EOPNOTSUPP) {
+    // The poller could not receive on this socket after all, and nothing
+    // was received from it: read it ourselves from now on.
+    receiving_in_poller_ = false;
+    MaybeMakeReadSlices();
+    return TcpDoRead(status);
+  }
+  if (received < 0 && errno == EAGAIN) {
+    inq_ = 0;
+    return false;
+  }
+  if (received <= 0) {
+    incoming_buffer_->Clear();
+    if (received == 0) {
+      status = TcpAnnotateError(absl::InternalError("Socket closed"));
+    } else {
+      status = TcpAnnotateError(absl::InternalError(
+          absl::StrCat("recvmsg:", grpc_core::StrError(errno))));
+    }
+    return true;
+  }
+  // More may have been received since; the next Read() looks right away.
+  inq_ = 1;
+  status = absl::OkStatus();
+  if (grpc_core::IsTcpFrameSizeTuningEnabled()) {
+    min_progress_size_ -= static_cast<int>(received);
+    if (min_progress_size_ > 0) return false;
+    min_progress_size_ = 1;
   }
   return true;
 }
@@ -509,16 +559,18 @@ void PosixEndpointImpl::UpdateRcvLowat() {
 void PosixEndpointImpl::MaybeMakeReadSlices() {
   static const int kBigAlloc = 64 * 1024;
   static const int kSmallAlloc = 8 * 1024;
+  // The poller brings its own buffers.
+  if (receiving_in_poller_) return;
   if (incoming_buffer_->Length() < std::max<size_t>(min_progress_size_, 1)) {
-    size_t allocate_length = min_progress_size_;
-    const size_t target_length = static_cast<size_t>(target_length_);
-    // If memory pressure is low and we think there will be more than
-    // min_progress_size bytes to read, allocate a bit more.
+    // If we think there will be more than min_progress_size bytes to read,
+    // allocate a bit more, less so as memory pressure rises.
+    const double memory_pressure =
+        memory_owner_.GetPressureInfo().pressure_control_value;
     const bool low_memory_pressure =
-        memory_owner_.GetPressureInfo().pressure_control_value < 0.8;
-    if (low_memory_pressure && target_length > allocate_length) {
-      allocate_length = target_length;
-    }
+        memory_pressure < grpc_core::kReadBufferHighMemoryPressure;
+    const size_t allocate_length = grpc_core::ReadBufferSizeForMemoryPressure(
+        min_progress_size_, static_cast<size_t>(target_length_),
+        memory_pressure);
     int extra_wanted = std::max<int>(
         1, allocate_length - static_cast<int>(incoming_buffer_->Length()));
     if (extra_wanted >=
@@ -579,9 +631,74 @@ void PosixEndpointImpl::HandleRead(absl::Status status) {
   Unref();
 }
 
+bool PosixEndpointImpl::EnableTcpInfoSampling(
+    EventEngine::Duration period,
+    absl::AnyInvocable<void(const EndpointTcpInfoExtension::TcpInfo&)>
+        on_sample) {
+#ifdef GRPC_LINUX_ERRQUEUE
+  CHECK(on_tcp_info_sample_ == nullptr);
+  tcp_info_sample_period_ms_ = std::max<int64_t>(
+      1, std::chrono::duration_cast<std::chrono::milliseconds>(period).count());
+  on_tcp_info_sample_ = std::move(on_sample);
+  return true;
+#else   // GRPC_LINUX_ERRQUEUE
+  (void)period;
+  (void)on_sample;
+  return false;
+#endif  // GRPC_LINUX_ERRQUEUE
+}
+
+void PosixEndpointImpl::MaybeSampleTcpInfo() {
+  if (on_tcp_info_sample_ == nullptr) return;
+#ifdef GRPC_LINUX_ERRQUEUE
+  const int64_t now =
+      grpc_core::Timestamp::Now().milliseconds_after_process_epoch();
+  int64_t next = next_tcp_info_sample_ms_.load(std::memory_order_relaxed);
+  // Of the reads and writes that see the period elapse, only one samples.
+  if (now < next ||
+      !next_tcp_info_sample_ms_.compare_exchange_strong(
+          next, now + tcp_info_sample_period_ms_,
+          std::memory_order_relaxed, std::memory_order_relaxed)) {
+    return;
+  }
+  tcp_info info;
+  if (GetSocketTcpInfo(&info, fd_) != 0) return;
+  EndpointTcpInfoExtension::TcpInfo sample;
+  sample.rtt_us = info.tcpi_rtt;
+  sample.rtt_var_us = info.tcpi_rttvar;
+  sample.snd_cwnd = info.tcpi_snd_cwnd;
+  sample.total_retrans = info.tcpi_total_retrans;
+  // Older kernels return a shorter struct.
+  if (info.length > offsetof(tcp_info, tcpi_pacing_rate)) {
+    sample.pacing_rate = info.tcpi_pacing_rate;
+  }
+  if (info.length > offsetof(tcp_info, tcpi_min_rtt)) {
+    sample.min_rtt_us = info.tcpi_min_rtt;
+  }
+  if (info.length > offsetof(tcp_info, tcpi_delivery_rate)) {
+    sample.delivery_rate = info.tcpi_delivery_rate;
+  }
+  const uint32_t last_total_retrans = last_tcp_info_total_retrans_.exchange(
+      sample.total_retrans, std::memory_order_relaxed);
+  auto clamp = [](uint64_t value) {
+    return static_cast<int>(
+        std::min<uint64_t>(value, std::numeric_limits<int>::max()));
+  };
+  auto& stats = grpc_core::global_stats();
+  stats.IncrementTcpInfoRttUs(clamp(sample.rtt_us));
+  stats.IncrementTcpInfoSndCwnd(clamp(sample.snd_cwnd));
+  stats.IncrementTcpInfoRetransmits(
+      clamp(sample.total_retrans - last_total_retrans));
+  stats.IncrementTcpInfoPacingRateKib(clamp(sample.pacing_rate / 1024));
+  stats.IncrementTcpInfoDeliveryRateKib(clamp(sample.delivery_rate / 1024));
+  on_tcp_info_sample_(sample);
+#endif  // GRPC_LINUX_ERRQUEUE
+}
+
 bool PosixEndpointImpl::Read(absl::AnyInvocable<void(absl::Status)> on_read,
                              SliceBuffer* buffer,
                              const EventEngine::Endpoint::ReadArgs* args) {
+  MaybeSampleTcpInfo();
   grpc_core::ReleasableMutexLock lock(&read_mu_);
   GRPC_TRACE_LOG(event_engine_endpoint, INFO)
       << "Endpoint[" << this << "]: Read";
@@ -663,6 +780,9 @@ TcpZerocopySendRecord* PosixEndpointImpl::TcpGetSendZerocopyRecord(
       DCHECK_EQ(buf.Length(), 0u);
       outgoing_byte_idx_ = 0;
       outgoing_buffer_ = nullptr;
+      grpc_core::global_stats().IncrementTcpZerocopySends();
+    } else {
+      grpc_core::global_stats().IncrementTcpZerocopyFallbackSends();
     }
   }
   return zerocopy_send_record;
@@ -753,16 +873,27 @@ void PosixEndpointImpl::ProcessZerocopy(struct cmsghdr* cmsg) {
   DCHECK(serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY);
   const uint32_t lo = serr->ee_info;
   const uint32_t hi = serr->ee_data;
+  // The kernel fell back to copying the data for this range of sends.
+  const bool copied = (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+  const auto now = std::chrono::steady_clock::now();
   for (uint32_t seq = lo; seq <= hi; ++seq) {
     // TODO(arjunroy): It's likely that lo and hi refer to zerocopy sequence
     // numbers that are generated by a single call to grpc_endpoint_write; ie.
     // we can batch the unref operation. So, check if record is the same for
     // both; if so, batch the unref/put.
+    std::chrono::steady_clock::time_point send_time;
     TcpZerocopySendRecord* record =
-        tcp_zerocopy_send_ctx_->ReleaseSendRecord(seq);
+        tcp_zerocopy_send_ctx_->ReleaseSendRecord(seq, &send_time);
     DCHECK(record);
+    grpc_core::global_stats().IncrementTcpZerocopyCompletionLatencyUs(
+        std::chrono::duration_cast<std::chrono::microseconds>(now - send_time)
+            .count());
     UnrefMaybePutZerocopySendRecord(record);
   }
+  if (copied) {
+    grpc_core::global_stats().IncrementTcpZerocopyCopiedCompletions();
+  }
+  tcp_zerocopy_send_ctx_->NoteCompletions(hi - lo + 1, copied);
   if (tcp_zerocopy_send_ctx_->UpdateZeroCopyOptMemStateAfterFree()) {
     handle_->SetWritable();
   }
@@ -1150,6 +1281,7 @@ bool PosixEndpointImpl::Write(
   CHECK(write_cb_ == nullptr);
   DCHECK_EQ(current_zerocopy_send_, nullptr);
   DCHECK_NE(data, nullptr);
+  MaybeSampleTcpInfo();
 
   GRPC_TRACE_LOG(event_engine_endpoint, INFO)
       << "Endpoint[" << this << "]: Write " << data->Length() << " bytes";
@@ -1259,7 +1391,7 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   CHECK(options.resource_quota != nullptr);
   auto peer_addr_string = sock.PeerAddressString();
   mem_quota_ = options.resource_quota->memory_quota();
-  memory_owner_ = mem_quota_->CreateMemoryOwner();
+  memory_owner_ = mem_quota_->CreateMemoryOwner("endpoint");
   self_reservation_ = memory_owner_.MakeReservation(sizeof(PosixEndpointImpl));
   auto local_address = sock.LocalAddress();
   if (local_address.ok()) {
@@ -1273,6 +1405,7 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
   bytes_read_this_round_ = 0;
   min_read_chunk_size_ = options.tcp_min_read_chunk_size;
   max_read_chunk_size_ = options.tcp_max_read_chunk_size;
+  release_idle_read_buffers_ = options.tcp_release_idle_read_buffers;
   bool zerocopy_enabled =
       options.tcp_tx_zero_copy_enabled && poller_->CanTrackErrors();
 #ifdef GRPC_LINUX_ERRQUEUE
@@ -1305,7 +1438,8 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
 #endif  // GRPC_LINUX_ERRQUEUE
   tcp_zerocopy_send_ctx_ = std::make_unique<TcpZerocopySendCtx>(
       zerocopy_enabled, options.tcp_tx_zerocopy_max_simultaneous_sends,
-      options.tcp_tx_zerocopy_send_bytes_threshold);
+      options.tcp_tx_zerocopy_send_bytes_threshold,
+      options.tcp_tx_zerocopy_adaptive);
 #ifdef GRPC_HAVE_TCP_INQ
   int one = 1;
   if (setsockopt(fd_, SOL_TCP, TCP_INQ, &one, sizeof(one)) == 0) {
@@ -1324,6 +1458,10 @@ PosixEndpointImpl::PosixEndpointImpl(EventHandle* handle,
       [this](absl::Status status) { HandleWrite(std::move(status)); });
   on_error_ = PosixEngineClosure::ToPermanentClosure(
       [this](absl::Status status) { HandleError(std::move(status)); });
+  {
+    grpc_core::MutexLock lock(&read_mu_);
+    receiving_in_poller_ = handle_->StartReceiving();
+  }
 
   // Start being notified on errors if poller can track errors.
   if (poller_->CanTrackErrors()) {
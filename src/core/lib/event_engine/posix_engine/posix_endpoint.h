@@ -19,11 +19,14 @@
 
 // IWYU pragma: no_include <bits/types/struct_iovec.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <new>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_map.h"
@@ -41,6 +44,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/event_engine/extensions/supports_fd.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/event_engine/posix.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
@@ -170,17 +174,30 @@ class TcpZerocopySendCtx {
  public:
   static constexpr int kDefaultMaxSends = 4;
   static constexpr size_t kDefaultSendBytesThreshold = 16 * 1024;  // 16KB
+  // In adaptive mode, the send record pool may grow up to this many records,
+  // and the threshold may back off up to this many bytes.
+  static constexpr int kMaxAdaptiveSends = 64;
+  static constexpr size_t kMaxAdaptiveThresholdBytes = 4 * 1024 * 1024;
+  // Number of completed zerocopy sendmsg() calls the adaptive threshold is
+  // re-evaluated over.
+  static constexpr int kAdaptiveWindow = 16;
 
   explicit TcpZerocopySendCtx(
       bool zerocopy_enabled, int max_sends = kDefaultMaxSends,
-      size_t send_bytes_threshold = kDefaultSendBytesThreshold)
+      size_t send_bytes_threshold = kDefaultSendBytesThreshold,
+      bool adaptive = false)
       : max_sends_(max_sends),
+        send_records_capacity_(
+            adaptive ? std::max(max_sends, kMaxAdaptiveSends) : max_sends),
+        total_send_records_(max_sends),
         free_send_records_size_(max_sends),
-        threshold_bytes_(send_bytes_threshold) {
+        adaptive_(adaptive),
+        threshold_bytes_(send_bytes_threshold),
+        min_threshold_bytes_(send_bytes_threshold) {
     send_records_ = static_cast<TcpZerocopySendRecord*>(
         gpr_malloc(max_sends * sizeof(*send_records_)));
     free_send_records_ = static_cast<TcpZerocopySendRecord**>(
-        gpr_malloc(max_sends * sizeof(*free_send_records_)));
+        gpr_malloc(send_records_capacity_ * sizeof(*free_send_records_)));
     if (send_records_ == nullptr || free_send_records_ == nullptr) {
       gpr_free(send_records_);
       gpr_free(free_send_records_);
@@ -219,10 +236,11 @@ class TcpZerocopySendCtx {
   // buffers that were sent with the corresponding call to sendmsg().
   void NoteSend(TcpZerocopySendRecord* record) {
     record->Ref();
+    const auto now = std::chrono::steady_clock::now();
     {
       grpc_core::MutexLock lock(&mu_);
       is_in_write_ = true;
-      AssociateSeqWithSendRecordLocked(last_send_, record);
+      AssociateSeqWithSendRecordLocked(last_send_, record, now);
     }
     ++last_send_;
   }
@@ -244,10 +262,11 @@ class TcpZerocopySendCtx {
 
   // Simply associate this send record (and the underlying sent data buffers)
   // with the implicit sequence number for this zerocopy sendmsg().
-  void AssociateSeqWithSendRecordLocked(uint32_t seq,
-                                        TcpZerocopySendRecord* record)
+  void AssociateSeqWithSendRecordLocked(
+      uint32_t seq, TcpZerocopySendRecord* record,
+      std::chrono::steady_clock::time_point send_time)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
-    ctx_lookup_.emplace(seq, record);
+    ctx_lookup_.emplace(seq, SendInfo{record, send_time});
   }
 
   // Get a send record for a send that we wish to do with zerocopy.
@@ -264,19 +283,24 @@ class TcpZerocopySendCtx {
   // single sequence number. This is called either when we receive the relevant
   // error queue notification (saying that we can discard the underlying
   // buffers for this sendmsg()) is received from the kernel - or, in case
-  // sendmsg() was unsuccessful to begin with.
-  TcpZerocopySendRecord* ReleaseSendRecord(uint32_t seq) {
+  // sendmsg() was unsuccessful to begin with. If \a send_time is not null, it
+  // is set to the time the corresponding sendmsg() was issued.
+  TcpZerocopySendRecord* ReleaseSendRecord(
+      uint32_t seq,
+      std::chrono::steady_clock::time_point* send_time = nullptr) {
     grpc_core::MutexLock lock(&mu_);
-    return ReleaseSendRecordLocked(seq);
+    return ReleaseSendRecordLocked(seq, send_time);
   }
 
   // After all the references to a TcpZerocopySendRecord are released, we can
-  // add it back to the pool (of size max_sends_). Note that we can only have
-  // max_sends_ tcp_write() instances with zerocopy enabled in flight at the
-  // same time.
+  // add it back to the pool (of size max_sends_, or up to
+  // send_records_capacity_ in adaptive mode). Note that we can only have that
+  // many tcp_write() instances with zerocopy enabled in flight at the same
+  // time.
   void PutSendRecord(TcpZerocopySendRecord* record) {
     grpc_core::MutexLock lock(&mu_);
-    DCHECK(record >= send_records_ && record < send_records_ + max_sends_);
+    DCHECK(adaptive_ ||
+           (record >= send_records_ && record < send_records_ + max_sends_));
     PutSendRecordLocked(record);
   }
 
@@ -288,15 +312,42 @@ class TcpZerocopySendCtx {
   // enabled.
   bool AllSendRecordsEmpty() {
     grpc_core::MutexLock lock(&mu_);
-    return free_send_records_size_ == max_sends_;
+    return free_send_records_size_ == total_send_records_;
   }
 
   bool Enabled() const { return enabled_; }
 
   // Only use zerocopy if we are sending at least this many bytes. The
   // additional overhead of reading the error queue for notifications means that
-  // zerocopy is not useful for small transfers.
-  size_t ThresholdBytes() const { return threshold_bytes_; }
+  // zerocopy is not useful for small transfers. In adaptive mode this is
+  // learned per connection, starting from (and never going below) the
+  // configured threshold.
+  size_t ThresholdBytes() const {
+    return threshold_bytes_.load(std::memory_order_relaxed);
+  }
+
+  // Feeds the outcome of \a count completed zerocopy sendmsg() calls into the
+  // adaptive threshold. \a copied is set when the kernel reported that it
+  // copied the data anyway (e.g. loopback, or a device without scatter-gather
+  // support), in which case zerocopy only added error queue overhead. If most
+  // sends in a window were copied, the threshold doubles, so only larger
+  // writes keep trying; a window without copies lets it decay back.
+  void NoteCompletions(uint32_t count, bool copied) {
+    if (!adaptive_) return;
+    grpc_core::MutexLock lock(&mu_);
+    window_sends_ += count;
+    if (copied) window_copied_ += count;
+    if (window_sends_ < kAdaptiveWindow) return;
+    if (2 * window_copied_ >= window_sends_) {
+      BackOffThresholdLocked();
+    } else if (window_copied_ == 0) {
+      threshold_bytes_.store(
+          std::max(ThresholdBytes() / 2, min_threshold_bytes_),
+          std::memory_order_relaxed);
+    }
+    window_sends_ = 0;
+    window_copied_ = 0;
+  }
 
   // Expected to be called by handler reading messages from the err queue.
   // It is used to indicate that some optmem memory is now available. It returns
@@ -372,6 +423,9 @@ class TcpZerocopySendCtx {
     is_in_write_ = false;
     constrained = false;
     if (seen_enobuf) {
+      // We are pinning more memory than optmem allows; in adaptive mode only
+      // spend it on larger writes from now on.
+      if (adaptive_) BackOffThresholdLocked();
       if (ctx_lookup_.size() == 1) {
         // There is no un-acked z-copy record. Set constrained to true to
         // indicate that we are re-source constrained because we're seeing
@@ -421,22 +475,43 @@ class TcpZerocopySendCtx {
              // check this state after the sendmsg.
   };
 
-  TcpZerocopySendRecord* ReleaseSendRecordLocked(uint32_t seq)
+  struct SendInfo {
+    TcpZerocopySendRecord* record;
+    std::chrono::steady_clock::time_point send_time;
+  };
+
+  TcpZerocopySendRecord* ReleaseSendRecordLocked(
+      uint32_t seq, std::chrono::steady_clock::time_point* send_time)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
     auto iter = ctx_lookup_.find(seq);
     DCHECK(iter != ctx_lookup_.end());
-    TcpZerocopySendRecord* record = iter->second;
+    TcpZerocopySendRecord* record = iter->second.record;
+    if (send_time != nullptr) *send_time = iter->second.send_time;
     ctx_lookup_.erase(iter);
     return record;
   }
 
+  void BackOffThresholdLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    threshold_bytes_.store(
+        std::min(std::max(ThresholdBytes(), size_t{1}) * 2,
+                 std::max(kMaxAdaptiveThresholdBytes, min_threshold_bytes_)),
+        std::memory_order_relaxed);
+  }
+
   TcpZerocopySendRecord* TryGetSendRecordLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
     if (shutdown_.load(std::memory_order_acquire)) {
       return nullptr;
     }
     if (free_send_records_size_ == 0) {
-      return nullptr;
+      if (total_send_records_ == send_records_capacity_) {
+        return nullptr;
+      }
+      // Adaptive mode: more writes are in flight than the initial pool
+      // covers, so grow it instead of falling back to copying.
+      grown_send_records_.push_back(std::make_unique<TcpZerocopySendRecord>());
+      ++total_send_records_;
+      return grown_send_records_.back().get();
     }
     free_send_records_size_--;
     return free_send_records_[free_send_records_size_];
@@ -444,22 +519,30 @@ class TcpZerocopySendCtx {
 
   void PutSendRecordLocked(TcpZerocopySendRecord* record)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
-    DCHECK(free_send_records_size_ < max_sends_);
+    DCHECK(free_send_records_size_ < total_send_records_);
     free_send_records_[free_send_records_size_] = record;
     free_send_records_size_++;
   }
 
   TcpZerocopySendRecord* send_records_ ABSL_GUARDED_BY(mu_);
   TcpZerocopySendRecord** free_send_records_ ABSL_GUARDED_BY(mu_);
+  // Records allocated on demand beyond the initial max_sends_.
+  std::vector<std::unique_ptr<TcpZerocopySendRecord>> grown_send_records_
+      ABSL_GUARDED_BY(mu_);
   int max_sends_;
+  const int send_records_capacity_;
+  int total_send_records_ ABSL_GUARDED_BY(mu_);
   int free_send_records_size_ ABSL_GUARDED_BY(mu_);
   grpc_core::Mutex mu_;
   uint32_t last_send_ = 0;
   std::atomic<bool> shutdown_{false};
   bool enabled_ = false;
-  size_t threshold_bytes_ = kDefaultSendBytesThreshold;
-  absl::flat_hash_map<uint32_t, TcpZerocopySendRecord*> ctx_lookup_
-      ABSL_GUARDED_BY(mu_);
+  const bool adaptive_;
+  std::atomic<size_t> threshold_bytes_;
+  const size_t min_threshold_bytes_;
+  int window_sends_ ABSL_GUARDED_BY(mu_) = 0;
+  int window_copied_ ABSL_GUARDED_BY(mu_) = 0;
+  absl::flat_hash_map<uint32_t, SendInfo> ctx_lookup_ ABSL_GUARDED_BY(mu_);
   bool memory_limited_ = false;
   bool is_in_write_ ABSL_GUARDED_BY(mu_) = false;
   OptMemState zcopy_enobuf_state_ ABSL_GUARDED_BY(mu_) = OptMemState::kOpen;
@@ -496,6 +579,11 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
 
   bool CanTrackErrors() const { return poller_->CanTrackErrors(); }
 
+  bool EnableTcpInfoSampling(
+      EventEngine::Duration period,
+      absl::AnyInvocable<void(const EndpointTcpInfoExtension::TcpInfo&)>
+          on_sample);
+
   void MaybeShutdown(
       absl::Status why,
       absl::AnyInvocable<void(absl::StatusOr<int> release_fd)> on_release_fd);
@@ -509,7 +597,19 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void MaybeMakeReadSlices() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   bool TcpDoRead(absl::Status& status) ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
+  // TcpDoRead() for when the poller receives the socket's data.
+  bool TcpDoReceive(absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void FinishEstimate();
+  // Samples TCP_INFO if sampling is enabled and the last sample is older than
+  // the sampling period.
+  void MaybeSampleTcpInfo();
+  // Whether the spare space left over after a read should be freed rather than
+  // kept for the next one: the kernel reported that nothing is left queued on
+  // the socket, so the connection may go idle for a long time.
+  bool ReleaseSpareReadBuffers() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_) {
+    return release_idle_read_buffers_ && inq_capable_ && inq_ == 0;
+  }
   void AddToEstimate(size_t bytes);
   void MaybePostReclaimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(read_mu_);
   void PerformReclamation() ABSL_LOCKS_EXCLUDED(read_mu_);
@@ -541,6 +641,7 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   double target_length_;
   int min_read_chunk_size_;
   int max_read_chunk_size_;
+  bool release_idle_read_buffers_;
   int set_rcvlowat_ = 0;
   double bytes_read_this_round_ = 0;
   std::atomic<int> ref_count_{1};
@@ -554,6 +655,9 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   int inq_ = 1;
   // cache whether kernel supports inq.
   bool inq_capable_ = false;
+  // The poller receives the socket's data (EventHandle::StartReceiving()),
+  // so reads take it from the handle rather than calling recvmsg().
+  bool receiving_in_poller_ ABSL_GUARDED_BY(read_mu_) = false;
 
   grpc_event_engine::experimental::SliceBuffer* outgoing_buffer_ = nullptr;
   // byte within outgoing_buffer's slices[0] to write next.
@@ -597,6 +701,12 @@ class PosixEndpointImpl : public grpc_core::RefCounted<PosixEndpointImpl> {
   // to be read to make meaningful progress.
   int min_progress_size_ = 1;
   TracedBufferList traced_buffers_;
+  // Set before the first read or write when TCP_INFO is sampled.
+  absl::AnyInvocable<void(const EndpointTcpInfoExtension::TcpInfo&)>
+      on_tcp_info_sample_;
+  int64_t tcp_info_sample_period_ms_ = 0;
+  std::atomic<int64_t> next_tcp_info_sample_ms_{0};
+  std::atomic<uint32_t> last_tcp_info_total_retrans_{0};
   // The handle is owned by the PosixEndpointImpl object.
   EventHandle* handle_;
   PosixEventPoller* poller_;
@@ -642,6 +752,12 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
 
   bool CanTrackErrors() override { return impl_->CanTrackErrors(); }
 
+  bool EnableTcpInfoSampling(
+      EventEngine::Duration period,
+      absl::AnyInvocable<void(const TcpInfo&)> on_sample) override {
+    return impl_->EnableTcpInfoSampling(period, std::move(on_sample));
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     if (!shutdown_.exchange(true, std::memory_order_acq_rel)) {
@@ -703,6 +819,13 @@ class PosixEndpoint : public PosixEndpointWithFdSupport {
         "PosixEndpoint::CanTrackErrors not supported on this platform");
   }
 
+  bool EnableTcpInfoSampling(
+      EventEngine::Duration /*period*/,
+      absl::AnyInvocable<void(const TcpInfo&)> /*on_sample*/) override {
+    grpc_core::Crash(
+        "PosixEndpoint::EnableTcpInfoSampling not supported on this platform");
+  }
+
   void Shutdown(absl::AnyInvocable<void(absl::StatusOr<int> release_fd)>
                     on_release_fd) override {
     grpc_core::Crash("PosixEndpoint::Shutdown not supported on this platform");
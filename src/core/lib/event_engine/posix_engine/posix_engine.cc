@@ -22,6 +22,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/cleanup/cleanup.h"
 #include "absl/functional/any_invocable.h"
@@ -37,8 +38,10 @@
 #include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/ares_resolver.h"
+#include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/forkable.h"
 #include "src/core/lib/event_engine/grpc_polled_fd.h"
 #include "src/core/lib/event_engine/poller.h"
@@ -63,6 +66,7 @@
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_listener.h"
+#include "src/core/lib/event_engine/posix_engine/sharded_event_poller.h"
 #endif  // GRPC_POSIX_SOCKET_TCP
 
 // IWYU pragma: no_include <ratio>
@@ -312,11 +316,30 @@ void PosixEventEngine::OnConnectFinishInternal(int connection_handle) {
   }
 }
 
+namespace {
+// Closures deferred by PosixEnginePollerManager::Run to run inline on the
+// polling thread, at the end of the current PollerWorkInternal.
+struct InlineBatch {
+  PosixEnginePollerManager* manager;
+  std::vector<EventEngine::Closure*> closures;
+};
+thread_local InlineBatch* g_inline_batch = nullptr;
+}  // namespace
+
 PosixEnginePollerManager::PosixEnginePollerManager(
     std::shared_ptr<ThreadPool> executor)
-    : poller_(grpc_event_engine::experimental::MakeDefaultPoller(this)),
+    : poller_(MakeShardedEventPoller(
+          grpc_core::ConfigVars::Get().EventEnginePollerShards())),
       executor_(std::move(executor)),
-      trigger_shutdown_called_(false) {}
+      trigger_shutdown_called_(false),
+      inline_batch_limit_(static_cast<size_t>(std::max(
+          0, grpc_core::ConfigVars::Get().EventEnginePollerInlineBatch()))) {
+  if (poller_ != nullptr) {
+    poller_is_self_driven_ = true;
+  } else {
+    poller_ = grpc_event_engine::experimental::MakeDefaultPoller(this);
+  }
+}
 
 PosixEnginePollerManager::PosixEnginePollerManager(
     std::shared_ptr<PosixEventPoller> poller)
@@ -327,14 +350,28 @@ PosixEnginePollerManager::PosixEnginePollerManager(
   DCHECK_NE(poller_, nullptr);
 }
 
+bool PosixEnginePollerManager::CanRunInline() const {
+  return g_inline_batch != nullptr && g_inline_batch->manager == this &&
+         g_inline_batch->closures.size() < inline_batch_limit_;
+}
+
 void PosixEnginePollerManager::Run(
     experimental::EventEngine::Closure* closure) {
+  if (CanRunInline()) {
+    g_inline_batch->closures.push_back(closure);
+    return;
+  }
   if (executor_ != nullptr) {
     executor_->Run(closure);
   }
 }
 
 void PosixEnginePollerManager::Run(absl::AnyInvocable<void()> cb) {
+  if (CanRunInline()) {
+    g_inline_batch->closures.push_back(
+        SelfDeletingClosure::Create(std::move(cb)));
+    return;
+  }
   if (executor_ != nullptr) {
     executor_->Run(std::move(cb));
   }
@@ -374,17 +411,36 @@ PosixEventEngine::PosixEventEngine(std::shared_ptr<PosixEventPoller> poller)
 
 PosixEventEngine::PosixEventEngine()
     : connection_shards_(std::max(2 * gpr_cpu_num_cores(), 1u)),
-      executor_(MakeThreadPool(grpc_core::Clamp(gpr_cpu_num_cores(), 4u, 16u))),
-      timer_manager_(std::make_shared<TimerManager>(executor_)) {
+      executor_(MakeThreadPool(grpc_core::Clamp(gpr_cpu_num_cores(), 4u, 16u))) {
+#if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+  poller_manager_ = std::make_shared<PosixEnginePollerManager>(executor_);
+  const bool drive_poller = poller_manager_->Poller() != nullptr &&
+                            !poller_manager_->PollerIsSelfDriven();
+  // Timers can only ride on a poller that we drive ourselves.
+  if (drive_poller && grpc_core::ConfigVars::Get().EventEnginePollerTimers()) {
+    timer_manager_ = std::make_shared<TimerManager>(
+        executor_,
+        [poller_manager = std::weak_ptr<PosixEnginePollerManager>(
+             poller_manager_)]() {
+          auto manager = poller_manager.lock();
+          if (manager != nullptr && !manager->IsShuttingDown()) {
+            manager->Poller()->Kick();
+          }
+        });
+    poller_manager_->SetTimers(timer_manager_);
+  }
+#endif  // GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
+  if (timer_manager_ == nullptr) {
+    timer_manager_ = std::make_shared<TimerManager>(executor_);
+  }
   g_timer_fork_manager->RegisterForkable(
       timer_manager_, TimerForkCallbackMethods::Prefork,
       TimerForkCallbackMethods::PostforkParent,
       TimerForkCallbackMethods::PostforkChild);
 #if GRPC_PLATFORM_SUPPORTS_POSIX_POLLING
-  poller_manager_ = std::make_shared<PosixEnginePollerManager>(executor_);
   // The threadpool must be instantiated after the poller otherwise, the
   // process will deadlock when forking.
-  if (poller_manager_->Poller() != nullptr) {
+  if (drive_poller) {
     executor_->Run([poller_manager = poller_manager_]() {
       PollerWorkInternal(poller_manager);
     });
@@ -394,18 +450,58 @@ PosixEventEngine::PosixEventEngine()
 
 void PosixEventEngine::PollerWorkInternal(
     std::shared_ptr<PosixEnginePollerManager> poller_manager) {
-  // TODO(vigneshbabu): The timeout specified here is arbitrary. For instance,
-  // this can be improved by setting the timeout to the next expiring timer.
   PosixEventPoller* poller = poller_manager->Poller();
   ThreadPool* executor = poller_manager->Executor();
-  auto result = poller->Work(24h, [executor, &poller_manager]() {
-    executor->Run([poller_manager]() mutable {
-      PollerWorkInternal(std::move(poller_manager));
-    });
-  });
-  if (result == Poller::WorkResult::kDeadlineExceeded) {
+  // Without poller-driven timers the timeout is arbitrary: the TimerManager
+  // has a thread of its own.
+  EventEngine::Duration timeout = 24h;
+  if (TimerManager* timers = poller_manager->Timers()) {
+    grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+    auto expired = timers->TimerCheck(&next);
+    if (!expired.has_value()) {
+      // Someone else is checking the timers; look again shortly.
+      timeout = 1ms;
+    } else if (!expired->empty()) {
+      // Run the expired timers on this thread, which is awake anyway, and
+      // let the executor carry on polling meanwhile.
+      executor->Run([poller_manager]() mutable {
+        PollerWorkInternal(std::move(poller_manager));
+      });
+      for (EventEngine::Closure* closure : *expired) closure->Run();
+      return;
+    } else {
+      // The next timer is still ahead of us, but may be less than a
+      // millisecond away. Wait at least 1ms rather than truncating that to a
+      // zero timeout, which would spin until the timer is due.
+      timeout = std::chrono::milliseconds(grpc_core::Clamp<int64_t>(
+          (next - timers->Now()).millis(), 1,
+          std::chrono::duration_cast<std::chrono::milliseconds>(timeout)
+              .count()));
+    }
+  }
+  // The closures made runnable by Work() are collected (up to the limit; any
+  // further ones go to the executor as usual) and run here once it returns.
+  // By then the next Work() call has been scheduled, so other fds keep being
+  // polled meanwhile.
+  InlineBatch batch{poller_manager.get(), {}};
+  if (poller_manager->InlineBatchLimit() > 0) g_inline_batch = &batch;
+  bool poll_again_scheduled = false;
+  auto result = poller->Work(
+      timeout, [executor, &poller_manager, &poll_again_scheduled]() {
+        poll_again_scheduled = true;
+        executor->Run([poller_manager]() mutable {
+          PollerWorkInternal(std::move(poller_manager));
+        });
+      });
+  g_inline_batch = nullptr;
+  for (EventEngine::Closure* closure : batch.closures) closure->Run();
+  if (result == Poller::WorkResult::kDeadlineExceeded ||
+      (result == Poller::WorkResult::kKicked && !poll_again_scheduled &&
+       poller_manager->Timers() != nullptr &&
+       !poller_manager->IsShuttingDown())) {
     // The EventEngine is not shutting down but the next asynchronous
-    // PollerWorkInternal did not get scheduled. Schedule it now.
+    // PollerWorkInternal did not get scheduled (the deadline passed, or the
+    // timers kicked us to pick up an earlier one). Schedule it now.
     executor->Run([poller_manager = std::move(poller_manager)]() {
       PollerWorkInternal(poller_manager);
     });
@@ -494,6 +590,16 @@ void PosixEventEngine::Run(EventEngine::Closure* closure) {
   executor_->Run(closure);
 }
 
+void PosixEventEngine::RunWithPriority(Priority priority,
+                                       absl::AnyInvocable<void()> closure) {
+  executor_->RunWithPriority(priority, std::move(closure));
+}
+
+void PosixEventEngine::RunWithPriority(Priority priority,
+                                       EventEngine::Closure* closure) {
+  executor_->RunWithPriority(priority, closure);
+}
+
 EventEngine::TaskHandle PosixEventEngine::RunAfterInternal(
     Duration when, absl::AnyInvocable<void()> cb) {
   if (when <= Duration::zero()) {
@@ -111,6 +111,22 @@ class PosixEnginePollerManager
 
   ThreadPool* Executor() { return executor_.get(); }
 
+  // True if the poller runs on threads of its own (see ShardedEventPoller)
+  // rather than being driven by PosixEventEngine::PollerWorkInternal.
+  bool PollerIsSelfDriven() const { return poller_is_self_driven_; }
+
+  // The maximum number of closures that become runnable during one poller
+  // Work() call and are run inline on the polling thread afterwards, see the
+  // GRPC_EVENT_ENGINE_POLLER_INLINE_BATCH config var. Zero disables this.
+  size_t InlineBatchLimit() const { return inline_batch_limit_; }
+
+  // Set if PollerWorkInternal runs the engine's timers, see the
+  // GRPC_EVENT_ENGINE_POLLER_TIMERS config var.
+  TimerManager* Timers() const { return timer_manager_.get(); }
+  void SetTimers(std::shared_ptr<TimerManager> timer_manager) {
+    timer_manager_ = std::move(timer_manager);
+  }
+
   void Run(experimental::EventEngine::Closure* closure) override;
   void Run(absl::AnyInvocable<void()>) override;
 
@@ -124,10 +140,18 @@ class PosixEnginePollerManager
 
  private:
   enum class PollerState { kExternal, kOk, kShuttingDown };
+
+  // Whether a closure made runnable now can join the inline batch of the
+  // PollerWorkInternal running on this thread.
+  bool CanRunInline() const;
+
   std::shared_ptr<grpc_event_engine::experimental::PosixEventPoller> poller_;
   std::atomic<PollerState> poller_state_{PollerState::kOk};
   std::shared_ptr<ThreadPool> executor_;
   bool trigger_shutdown_called_;
+  size_t inline_batch_limit_ = 0;
+  bool poller_is_self_driven_ = false;
+  std::shared_ptr<TimerManager> timer_manager_;
 };
 #endif  // GRPC_POSIX_SOCKET_TCP
 
@@ -201,6 +225,9 @@ class PosixEventEngine final : public PosixEventEngineWithFdSupport,
       GRPC_UNUSED const DNSResolver::ResolverOptions& options) override;
   void Run(Closure* closure) override;
   void Run(absl::AnyInvocable<void()> closure) override;
+  void RunWithPriority(Priority priority,
+                       absl::AnyInvocable<void()> closure) override;
+  void RunWithPriority(Priority priority, Closure* closure) override;
   // Caution!! The timer implementation cannot create any fds. See #20418.
   TaskHandle RunAfter(Duration when, Closure* closure) override;
   TaskHandle RunAfter(Duration when,
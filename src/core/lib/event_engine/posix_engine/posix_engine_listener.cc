@@ -207,6 +207,14 @@ void PosixEngineListenerImpl::AsyncConnectionAcceptor::NotifyOnAccept(
 
     PosixSocketWrapper sock(fd);
     (void)sock.SetSocketNoSigpipeIfPossible();
+    if (listener_->options_.busy_poll_us > 0) {
+      auto busy_poll = sock.SetSocketBusyPoll(listener_->options_.busy_poll_us);
+      if (!busy_poll.ok()) {
+        // Not fatal, the connection works without it.
+        LOG_EVERY_N_SEC(INFO, 60)
+            << "Failed to enable busy polling: " << busy_poll;
+      }
+    }
     auto result = sock.ApplySocketMutatorInOptions(
         GRPC_FD_SERVER_CONNECTION_USAGE, listener_->options_);
     if (!result.ok()) {
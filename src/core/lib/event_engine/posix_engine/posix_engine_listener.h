@@ -24,6 +24,7 @@
 
 #include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
+#include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 
@@ -137,10 +138,19 @@ class PosixEngineListenerImpl
     }
 
     void Append(ListenerSocket socket) override {
-      acceptors_.push_back(new AsyncConnectionAcceptor(
-          listener_->engine_, listener_->shared_from_this(), socket));
-      if (on_append_) {
-        on_append_(socket.sock.Fd());
+      AppendAcceptor(socket);
+      // With listener sharding, the socket is accompanied by further
+      // SO_REUSEPORT sockets on the same address, each accepted from by an
+      // acceptor of its own.
+      auto shards = CreateListenerSocketShards(listener_->options_, socket);
+      if (!shards.ok()) {
+        LOG(ERROR) << "Failed to create listener shards, accepting on a "
+                      "single socket: "
+                   << shards.status();
+        return;
+      }
+      for (auto& shard : *shards) {
+        AppendAcceptor(shard);
       }
     }
 
@@ -167,6 +177,14 @@ class PosixEngineListenerImpl
     }
 
    private:
+    void AppendAcceptor(const ListenerSocket& socket) {
+      acceptors_.push_back(new AsyncConnectionAcceptor(
+          listener_->engine_, listener_->shared_from_this(), socket));
+      if (on_append_) {
+        on_append_(socket.sock.Fd());
+      }
+    }
+
     PosixListenerWithFdSupport::OnPosixBindNewFdCallback on_append_;
     std::list<AsyncConnectionAcceptor*> acceptors_;
     PosixEngineListenerImpl* listener_;
@@ -20,6 +20,8 @@
 
 #include <cstring>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/cleanup/cleanup.h"
 #include "absl/log/check.h"
@@ -229,6 +231,44 @@ absl::StatusOr<ListenerSocket> CreateAndPrepareListenerSocket(
   return socket;
 }
 
+absl::StatusOr<std::vector<ListenerSocket>> CreateListenerSocketShards(
+    const PosixTcpOptions& options, const ListenerSocket& socket) {
+  std::vector<ListenerSocket> shards;
+  if (options.listener_shards <= 1 || !options.allow_reuse_port ||
+      !PosixSocketWrapper::IsSocketReusePortSupported() ||
+      socket.addr.address()->sa_family == AF_UNIX ||
+      ResolvedAddressIsVSock(socket.addr)) {
+    return shards;
+  }
+  auto close_shards = absl::MakeCleanup([&shards]() {
+    for (auto& shard : shards) {
+      close(shard.sock.Fd());
+    }
+  });
+  // The first socket may have been bound to an ephemeral port; the shards
+  // must join it on the port it got.
+  ResolvedAddress addr = socket.addr;
+  ResolvedAddressSetPort(addr, socket.port);
+  for (int i = 1; i < options.listener_shards; ++i) {
+    auto shard = CreateAndPrepareListenerSocket(options, addr);
+    GRPC_RETURN_IF_ERROR(shard.status());
+    shards.push_back(*shard);
+  }
+  if (options.listener_cpu_steering) {
+    // The program applies to the whole group, whose sockets are indexed in the
+    // order they started listening.
+    PosixSocketWrapper sock = socket.sock;
+    auto status =
+        sock.SetSocketReusePortCpuSteering(static_cast<int>(shards.size() + 1));
+    if (!status.ok()) {
+      // Connections are still spread across the shards by hash.
+      LOG(INFO) << "Listener CPU steering unavailable: " << status;
+    }
+  }
+  std::move(close_shards).Cancel();
+  return shards;
+}
+
 absl::StatusOr<int> ListenerContainerAddAllLocalAddresses(
     ListenerSocketsContainer& listener_sockets, const PosixTcpOptions& options,
     int requested_port) {
@@ -374,6 +414,14 @@ CreateAndPrepareListenerSocket(const PosixTcpOptions& /*options*/,
       "CreateAndPrepareListenerSocket is not supported on this platform");
 }
 
+absl::StatusOr<std::vector<ListenerSocketsContainer::ListenerSocket>>
+CreateListenerSocketShards(
+    const PosixTcpOptions& /*options*/,
+    const ListenerSocketsContainer::ListenerSocket& /*socket*/) {
+  grpc_core::Crash(
+      "CreateListenerSocketShards is not supported on this platform");
+}
+
 absl::StatusOr<int> ListenerContainerAddWildcardAddresses(
     ListenerSocketsContainer& /*listener_sockets*/,
     const PosixTcpOptions& /*options*/, int /*requested_port*/) {
@@ -14,6 +14,8 @@
 #ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_POSIX_ENGINE_LISTENER_UTILS_H
 #define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_POSIX_ENGINE_LISTENER_UTILS_H
 
+#include <vector>
+
 #include "absl/status/statusor.h"
 
 #include <grpc/event_engine/event_engine.h>
@@ -64,6 +66,18 @@ CreateAndPrepareListenerSocket(
     const PosixTcpOptions& options,
     const grpc_event_engine::experimental::EventEngine::ResolvedAddress& addr);
 
+// Creates the additional SO_REUSEPORT sockets that options.listener_shards
+// asks for, bound to the same address and port as the already prepared
+// \a socket. Together they form one SO_REUSEPORT group, across which the
+// kernel distributes incoming connections; with options.listener_cpu_steering
+// the group selects sockets by receiving CPU. Returns an empty vector if the
+// socket cannot be sharded (sharding disabled, SO_REUSEPORT unavailable, or not
+// an inet socket). On failure no sockets are left open.
+absl::StatusOr<std::vector<ListenerSocketsContainer::ListenerSocket>>
+CreateListenerSocketShards(
+    const PosixTcpOptions& options,
+    const ListenerSocketsContainer::ListenerSocket& socket);
+
 // Instead of creating and adding a socket bound to specific address, this
 // function creates and adds a socket bound to the wildcard address on the
 // server. The newly created socket is configured according to the passed
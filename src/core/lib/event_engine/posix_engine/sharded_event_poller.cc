@@ -0,0 +1,288 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/sharded_event_poller.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/support/cpu.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/common_closures.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
+#include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/fork.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/gprpp/strerror.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace grpc_event_engine {
+namespace experimental {
+
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+using namespace std::chrono_literals;
+
+class ShardedEventPoller::Shard final : public Scheduler {
+ public:
+  explicit Shard(size_t index) : index_(index) {}
+  ~Shard() override { DCHECK(local_.empty()); }
+
+  bool Init() {
+    poller_ = MakeDefaultPoller(this);
+    return poller_ != nullptr;
+  }
+
+  // Spawn the thread driving \a shard. The thread keeps the shard alive
+  // until it exits.
+  static bool Start(std::shared_ptr<Shard> shard);
+
+  // Ask the shard thread to exit, and wait for it unless called from it.
+  void Stop();
+
+  PosixEventPoller* poller() const { return poller_.get(); }
+
+  void Run(EventEngine::Closure* closure) override;
+  void Run(absl::AnyInvocable<void()> cb) override {
+    Run(SelfDeletingClosure::Create(std::move(cb)));
+  }
+
+ private:
+  void Loop();
+  void PinToCpu();
+
+  // The shard whose thread is the calling thread, if any.
+  static thread_local Shard* current_;
+
+  const size_t index_;
+  std::shared_ptr<PosixEventPoller> poller_;
+  // Closures scheduled from the shard's own thread. Only touched by it.
+  std::deque<EventEngine::Closure*> local_;
+  grpc_core::Mutex mu_;
+  // Closures handed off to the shard by other threads.
+  std::vector<EventEngine::Closure*> handoff_ ABSL_GUARDED_BY(mu_);
+  // Set once the thread has drained its queues for the last time; from then
+  // on closures run inline on the thread scheduling them.
+  bool stopped_ ABSL_GUARDED_BY(mu_) = false;
+  std::atomic<bool> stopping_{false};
+  grpc_core::Notification done_;
+};
+
+thread_local ShardedEventPoller::Shard* ShardedEventPoller::Shard::current_ =
+    nullptr;
+
+bool ShardedEventPoller::Shard::Start(std::shared_ptr<Shard> shard) {
+  bool success = false;
+  auto thread = grpc_core::Thread(
+      "grpc_poller_shard", [shard]() { shard->Loop(); }, &success,
+      grpc_core::Thread::Options().set_joinable(false));
+  if (success) thread.Start();
+  return success;
+}
+
+void ShardedEventPoller::Shard::Run(EventEngine::Closure* closure) {
+  if (current_ == this) {
+    local_.push_back(closure);
+    return;
+  }
+  bool handed_off = false;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (!stopped_) {
+      handoff_.push_back(closure);
+      handed_off = true;
+    }
+  }
+  if (handed_off) {
+    poller_->Kick();
+  } else {
+    closure->Run();
+  }
+}
+
+void ShardedEventPoller::Shard::Loop() {
+  current_ = this;
+  PinToCpu();
+  std::vector<EventEngine::Closure*> handoff;
+  while (!stopping_.load(std::memory_order_acquire)) {
+    // Do not block in the poller while there is work queued locally. Kicks
+    // (from handoffs and Stop()) wake up a blocked poller.
+    poller_->Work(local_.empty() ? EventEngine::Duration(24h)
+                                 : EventEngine::Duration::zero(),
+                  []() {});
+    {
+      grpc_core::MutexLock lock(&mu_);
+      handoff.swap(handoff_);
+    }
+    local_.insert(local_.end(), handoff.begin(), handoff.end());
+    handoff.clear();
+    // Run only what has been queued so far: closures scheduled by these wait
+    // for the next round, after the poller has been checked again.
+    for (size_t n = local_.size(); n > 0; --n) {
+      EventEngine::Closure* closure = local_.front();
+      local_.pop_front();
+      closure->Run();
+    }
+  }
+  current_ = nullptr;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    stopped_ = true;
+    handoff.swap(handoff_);
+  }
+  local_.insert(local_.end(), handoff.begin(), handoff.end());
+  std::deque<EventEngine::Closure*> remaining = std::move(local_);
+  local_.clear();
+  for (EventEngine::Closure* closure : remaining) closure->Run();
+  done_.Notify();
+}
+
+void ShardedEventPoller::Shard::Stop() {
+  stopping_.store(true, std::memory_order_release);
+  poller_->Kick();
+  if (current_ != this) done_.WaitForNotification();
+}
+
+void ShardedEventPoller::Shard::PinToCpu() {
+#ifdef GPR_LINUX
+  const unsigned num_cpus = gpr_cpu_num_cores();
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(index_ % num_cpus, &cpus);
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+  if (err != 0) {
+    LOG(INFO) << "Failed to pin poller shard " << index_ << " to cpu "
+              << index_ % num_cpus << ": " << grpc_core::StrError(err);
+  }
+#endif  // GPR_LINUX
+}
+
+ShardedEventPoller::ShardedEventPoller(
+    std::vector<std::shared_ptr<Shard>> shards)
+    : shards_(std::move(shards)) {}
+
+ShardedEventPoller::~ShardedEventPoller() { Shutdown(); }
+
+EventHandle* ShardedEventPoller::CreateHandle(int fd, absl::string_view name,
+                                              bool track_err) {
+  const size_t shard =
+      next_shard_.fetch_add(1, std::memory_order_relaxed) % shards_.size();
+  return shards_[shard]->poller()->CreateHandle(fd, name, track_err);
+}
+
+bool ShardedEventPoller::CanTrackErrors() const {
+  return shards_[0]->poller()->CanTrackErrors();
+}
+
+std::string ShardedEventPoller::Name() {
+  return absl::StrCat("sharded:", shards_[0]->poller()->Name());
+}
+
+Poller::WorkResult ShardedEventPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("ShardedEventPoller::Work: the shards poll themselves");
+}
+
+void ShardedEventPoller::Kick() {
+  for (auto& shard : shards_) shard->poller()->Kick();
+}
+
+void ShardedEventPoller::Shutdown() {
+  if (shut_down_.exchange(true)) return;
+  for (auto& shard : shards_) shard->Stop();
+  for (auto& shard : shards_) shard->poller()->Shutdown();
+}
+
+std::shared_ptr<ShardedEventPoller> MakeShardedEventPoller(int num_shards) {
+  if (num_shards < 2 || grpc_core::Fork::Enabled()) return nullptr;
+  std::vector<std::shared_ptr<ShardedEventPoller::Shard>> shards;
+  shards.reserve(num_shards);
+  for (int i = 0; i < num_shards; ++i) {
+    auto shard = std::make_shared<ShardedEventPoller::Shard>(i);
+    if (!shard->Init()) return nullptr;
+    shards.push_back(std::move(shard));
+  }
+  for (size_t i = 0; i < shards.size(); ++i) {
+    if (!ShardedEventPoller::Shard::Start(shards[i])) {
+      LOG(ERROR) << "Failed to start poller shard " << i;
+      // Stop the shards that did start, and let the others go.
+      for (size_t j = 0; j < i; ++j) shards[j]->Stop();
+      for (auto& shard : shards) shard->poller()->Shutdown();
+      return nullptr;
+    }
+  }
+  return std::shared_ptr<ShardedEventPoller>(
+      new ShardedEventPoller(std::move(shards)));
+}
+
+#else  // GRPC_POSIX_SOCKET_TCP
+
+class ShardedEventPoller::Shard {};
+
+ShardedEventPoller::ShardedEventPoller(
+    std::vector<std::shared_ptr<Shard>> shards)
+    : shards_(std::move(shards)) {}
+
+ShardedEventPoller::~ShardedEventPoller() {
+  grpc_core::Crash("unimplemented");
+}
+
+EventHandle* ShardedEventPoller::CreateHandle(int /*fd*/,
+                                              absl::string_view /*name*/,
+                                              bool /*track_err*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+bool ShardedEventPoller::CanTrackErrors() const {
+  grpc_core::Crash("unimplemented");
+}
+
+std::string ShardedEventPoller::Name() { grpc_core::Crash("unimplemented"); }
+
+Poller::WorkResult ShardedEventPoller::Work(
+    EventEngine::Duration /*timeout*/,
+    absl::FunctionRef<void()> /*schedule_poll_again*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+void ShardedEventPoller::Kick() { grpc_core::Crash("unimplemented"); }
+
+void ShardedEventPoller::Shutdown() { grpc_core::Crash("unimplemented"); }
+
+std::shared_ptr<ShardedEventPoller> MakeShardedEventPoller(
+    int /*num_shards*/) {
+  return nullptr;
+}
+
+#endif  // GRPC_POSIX_SOCKET_TCP
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
@@ -0,0 +1,89 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHARDED_EVENT_POLLER_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHARDED_EVENT_POLLER_H
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/functional/function_ref.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// A poller made of several independent pollers ("shards"), each driven by a
+// dedicated thread that is pinned to a core. Every handle is assigned to one
+// shard when it is created, and the closures scheduled for it (read, write and
+// error notifications) run on that shard's thread, so all I/O for a connection
+// stays on one core. Closures that a shard schedules for itself go to a thread
+// local queue; closures scheduled from any other thread are explicitly handed
+// off to the shard through a locked queue and a Kick().
+//
+// The shards drive themselves: Work() must not be called on this poller.
+class ShardedEventPoller final : public PosixEventPoller {
+ public:
+  ~ShardedEventPoller() override;
+
+  EventHandle* CreateHandle(int fd, absl::string_view name,
+                            bool track_err) override;
+  bool CanTrackErrors() const override;
+  std::string Name() override;
+  Poller::WorkResult Work(
+      grpc_event_engine::experimental::EventEngine::Duration timeout,
+      absl::FunctionRef<void()> schedule_poll_again) override;
+  void Kick() override;
+  // Stops the shard threads and waits for them to exit (except for the
+  // calling thread, if it is one of them).
+  void Shutdown() override;
+
+  // Forkable. Fork is not supported; sharding is disabled when fork support
+  // is enabled.
+  void PrepareFork() override {}
+  void PostforkParent() override {}
+  void PostforkChild() override {}
+
+  size_t NumShards() const { return shards_.size(); }
+
+ private:
+  class Shard;
+  friend std::shared_ptr<ShardedEventPoller> MakeShardedEventPoller(
+      int num_shards);
+
+  explicit ShardedEventPoller(std::vector<std::shared_ptr<Shard>> shards);
+
+  const std::vector<std::shared_ptr<Shard>> shards_;
+  std::atomic<size_t> next_shard_{0};
+  std::atomic<bool> shut_down_{false};
+};
+
+// Returns nullptr if fewer than two shards are requested, if fork support is
+// enabled, or if no poller is available on this platform.
+std::shared_ptr<ShardedEventPoller> MakeShardedEventPoller(int num_shards);
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHARDED_EVENT_POLLER_H
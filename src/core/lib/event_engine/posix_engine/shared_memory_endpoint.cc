@@ -0,0 +1,615 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/shared_memory_endpoint.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_LINUX_MEMFD
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/event_engine/memory_request.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
+#include "src/core/lib/event_engine/extensions/receive_coalescing.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/event_engine/posix_engine/shared_memory_ring.h"
+#include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/gprpp/strerror.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+
+#endif  // GRPC_LINUX_MEMFD
+
+namespace grpc_event_engine {
+namespace experimental {
+
+#ifdef GRPC_LINUX_MEMFD
+
+namespace {
+
+// Rings start on a cache line of their own.
+constexpr size_t kRingAlignment = 64;
+// Alignment of read slices once EnforceRxMemoryAlignment() was called.
+constexpr size_t kReadAlignment = 64;
+
+size_t RingStride(size_t capacity) {
+  const size_t size = SharedMemoryRing::RegionSize(capacity);
+  return (size + kRingAlignment - 1) / kRingAlignment * kRingAlignment;
+}
+
+absl::Status ErrnoError(absl::string_view call) {
+  return absl::InternalError(
+      absl::StrCat(call, ": ", grpc_core::StrError(errno)));
+}
+
+void CloseFd(int& fd) {
+  if (fd >= 0) close(fd);
+  fd = -1;
+}
+
+class SharedMemoryEndpointImpl {
+ public:
+  SharedMemoryEndpointImpl(void* region, size_t region_size,
+                           SharedMemoryRing outgoing, SharedMemoryRing incoming,
+                           EventHandle* handle, int peer_eventfd,
+                           std::shared_ptr<EventEngine> engine,
+                           MemoryAllocator&& allocator,
+                           const EventEngine::ResolvedAddress& local_address,
+                           const EventEngine::ResolvedAddress& peer_address)
+      : region_(region),
+        region_size_(region_size),
+        outgoing_(outgoing),
+        incoming_(incoming),
+        handle_(handle),
+        peer_eventfd_(peer_eventfd),
+        engine_(std::move(engine)),
+        allocator_(std::move(allocator)),
+        local_address_(local_address),
+        peer_address_(peer_address) {
+    on_wakeup_ = PosixEngineClosure::ToPermanentClosure(
+        [this](absl::Status status) { OnWakeup(std::move(status)); });
+  }
+
+  ~SharedMemoryEndpointImpl() {
+    handle_->OrphanHandle(nullptr, nullptr, "shared memory endpoint");
+    CloseFd(peer_eventfd_);
+    munmap(region_, region_size_);
+    delete on_wakeup_;
+  }
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            SliceBuffer* buffer, const EventEngine::Endpoint::ReadArgs* args) {
+    grpc_core::ReleasableMutexLock lock(&mu_);
+    CHECK(read_cb_ == nullptr);
+    buffer->Clear();
+    read_hint_bytes_ =
+        args == nullptr ? 0 : std::max<int64_t>(args->read_hint_bytes, 0);
+    absl::Status status;
+    if (!ReadLocked(buffer, status)) {
+      read_buffer_ = buffer;
+      read_cb_ = std::move(on_read);
+      Ref();
+      ArmLocked();
+      return false;
+    }
+    lock.Release();
+    if (status.ok()) return true;
+    engine_->Run([on_read = std::move(on_read), status]() mutable {
+      on_read(status);
+    });
+    return false;
+  }
+
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             SliceBuffer* data) {
+    grpc_core::ReleasableMutexLock lock(&mu_);
+    CHECK(write_cb_ == nullptr);
+    write_offset_ = 0;
+    absl::Status status;
+    if (!WriteLocked(data, status)) {
+      write_buffer_ = data;
+      write_cb_ = std::move(on_writable);
+      Ref();
+      ArmLocked();
+      return false;
+    }
+    lock.Release();
+    if (status.ok()) return true;
+    engine_->Run([on_writable = std::move(on_writable), status]() mutable {
+      on_writable(status);
+    });
+    return false;
+  }
+
+  const EventEngine::ResolvedAddress& GetPeerAddress() const {
+    return peer_address_;
+  }
+  const EventEngine::ResolvedAddress& GetLocalAddress() const {
+    return local_address_;
+  }
+
+  void UseMemoryQuota(grpc_core::MemoryQuotaRefPtr mem_quota) {
+    grpc_core::MutexLock lock(&mu_);
+    allocator_ = mem_quota->CreateMemoryAllocator("shared_memory_endpoint");
+  }
+
+  void SetRpcReceiveCoalescing(bool enabled) {
+    grpc_core::MutexLock lock(&mu_);
+    coalesce_reads_ = enabled;
+  }
+
+  void EnforceRxMemoryAlignment() {
+    grpc_core::MutexLock lock(&mu_);
+    align_reads_ = true;
+  }
+
+  void Shutdown() {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      shutdown_ = true;
+    }
+    // Closing both rings makes the peer fail its pending and future
+    // operations once it drained what is left.
+    outgoing_.Close();
+    incoming_.Close();
+    WakePeer();
+    handle_->ShutdownHandle(absl::UnavailableError("Endpoint closing"));
+    Unref();
+  }
+
+ private:
+  void Ref() { refs_.fetch_add(1, std::memory_order_relaxed); }
+  void Unref() {
+    if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+  }
+
+  // Returns true if the read is complete, successfully or not, and false if
+  // it has to wait for the peer.
+  bool ReadLocked(SliceBuffer* buffer, absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    while (true) {
+      if (shutdown_) {
+        status = absl::UnavailableError("Endpoint closing");
+        return true;
+      }
+      if (read_slice_.empty()) {
+        size_t length = incoming_.ReadableBytes();
+        // With coalescing, the read only completes once the whole hint is in
+        // one slice, which may take several trips around the ring.
+        if (coalesce_reads_ && read_hint_bytes_ > length) {
+          length = read_hint_bytes_;
+        }
+        if (length > 0) MakeReadSliceLocked(length);
+      }
+      if (!read_slice_.empty()) {
+        const size_t read =
+            incoming_.Read(read_slice_.begin() + read_slice_filled_,
+                           read_slice_.size() - read_slice_filled_);
+        if (read > 0 && incoming_.TakeWriterWaiting()) WakePeer();
+        read_slice_filled_ += read;
+        if (read_slice_filled_ == read_slice_.size()) {
+          buffer->Append(Slice(std::move(read_slice_)));
+          read_slice_filled_ = 0;
+          status = absl::OkStatus();
+          return true;
+        }
+      }
+      if (incoming_.IsClosed()) {
+        status = absl::UnavailableError("Shared memory peer closed");
+        return true;
+      }
+      if (incoming_.PrepareReaderWait()) return false;
+    }
+  }
+
+  void MakeReadSliceLocked(size_t length) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (!align_reads_) {
+      read_slice_ = MutableSlice(allocator_.MakeSlice(MemoryRequest(length)));
+      return;
+    }
+    MutableSlice slice(allocator_.MakeSlice(
+        MemoryRequest(length + kReadAlignment - 1)));
+    const size_t offset = -reinterpret_cast<uintptr_t>(slice.begin()) &
+                          (kReadAlignment - 1);
+    read_slice_ = slice.TakeSubSlice(offset, length);
+  }
+
+  // Returns true if all of \a data was written or the write failed, and false
+  // if it has to wait for the peer to make room.
+  bool WriteLocked(SliceBuffer* data, absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    bool wrote = false;
+    while (true) {
+      if (shutdown_ || outgoing_.IsClosed()) {
+        status = absl::UnavailableError(
+            shutdown_ ? "Endpoint closing" : "Shared memory peer closed");
+        return true;
+      }
+      while (data->Count() > 0) {
+        const Slice& slice = data->MutableSliceAt(0);
+        const size_t written =
+            outgoing_.Write(slice.begin() + write_offset_,
+                            slice.size() - write_offset_);
+        if (written == 0) break;
+        wrote = true;
+        write_offset_ += written;
+        if (write_offset_ == slice.size()) {
+          data->TakeFirst();
+          write_offset_ = 0;
+        }
+      }
+      if (wrote && outgoing_.TakeReaderWaiting()) WakePeer();
+      if (data->Count() == 0) {
+        status = absl::OkStatus();
+        return true;
+      }
+      if (outgoing_.PrepareWriterWait()) return false;
+    }
+  }
+
+  // Makes sure the next wakeup, or the shutdown of the handle, runs
+  // OnWakeup().
+  void ArmLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    if (armed_) return;
+    armed_ = true;
+    Ref();
+    handle_->NotifyOnRead(on_wakeup_);
+  }
+
+  void OnWakeup(absl::Status status) {
+    eventfd_t value;
+    while (eventfd_read(handle_->WrappedFd(), &value) < 0 && errno == EINTR) {
+    }
+    absl::AnyInvocable<void(absl::Status)> read_cb;
+    absl::AnyInvocable<void(absl::Status)> write_cb;
+    absl::Status read_status;
+    absl::Status write_status;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      armed_ = false;
+      if (!status.ok()) shutdown_ = true;
+      if (read_cb_ != nullptr && ReadLocked(read_buffer_, read_status)) {
+        read_cb = std::move(read_cb_);
+        read_cb_ = nullptr;
+        read_buffer_ = nullptr;
+      }
+      if (write_cb_ != nullptr && WriteLocked(write_buffer_, write_status)) {
+        write_cb = std::move(write_cb_);
+        write_cb_ = nullptr;
+        write_buffer_ = nullptr;
+      }
+      if (read_cb_ != nullptr || write_cb_ != nullptr) ArmLocked();
+    }
+    if (read_cb != nullptr) {
+      read_cb(std::move(read_status));
+      Unref();
+    }
+    if (write_cb != nullptr) {
+      write_cb(std::move(write_status));
+      Unref();
+    }
+    Unref();
+  }
+
+  void WakePeer() {
+    while (eventfd_write(peer_eventfd_, 1) < 0 && errno == EINTR) {
+    }
+  }
+
+  grpc_core::Mutex mu_;
+  std::atomic<int> refs_{1};
+  void* const region_;
+  const size_t region_size_;
+  SharedMemoryRing outgoing_;
+  SharedMemoryRing incoming_;
+  // Polls the eventfd the peer signals to wake this side up. Owned.
+  EventHandle* handle_;
+  int peer_eventfd_;
+  PosixEngineClosure* on_wakeup_;
+  bool armed_ ABSL_GUARDED_BY(mu_) = false;
+  bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  SliceBuffer* read_buffer_ ABSL_GUARDED_BY(mu_) = nullptr;
+  size_t read_hint_bytes_ ABSL_GUARDED_BY(mu_) = 0;
+  // The slice being filled by the current read, and how much of it is.
+  MutableSlice read_slice_ ABSL_GUARDED_BY(mu_);
+  size_t read_slice_filled_ ABSL_GUARDED_BY(mu_) = 0;
+  bool coalesce_reads_ ABSL_GUARDED_BY(mu_) = false;
+  bool align_reads_ ABSL_GUARDED_BY(mu_) = false;
+  absl::AnyInvocable<void(absl::Status)> read_cb_ ABSL_GUARDED_BY(mu_);
+  SliceBuffer* write_buffer_ ABSL_GUARDED_BY(mu_) = nullptr;
+  // Offset of the next byte to write in the first slice of write_buffer_.
+  size_t write_offset_ ABSL_GUARDED_BY(mu_) = 0;
+  absl::AnyInvocable<void(absl::Status)> write_cb_ ABSL_GUARDED_BY(mu_);
+  std::shared_ptr<EventEngine> engine_;
+  MemoryAllocator allocator_ ABSL_GUARDED_BY(mu_);
+  EventEngine::ResolvedAddress local_address_;
+  EventEngine::ResolvedAddress peer_address_;
+};
+
+class SharedMemoryEndpoint final
+    : public ExtendedType<EventEngine::Endpoint, ChaoticGoodExtension,
+                          ReceiveCoalescingExtension> {
+ public:
+  explicit SharedMemoryEndpoint(SharedMemoryEndpointImpl* impl)
+      : impl_(impl) {}
+  ~SharedMemoryEndpoint() override { impl_->Shutdown(); }
+
+  bool Read(absl::AnyInvocable<void(absl::Status)> on_read,
+            SliceBuffer* buffer, const ReadArgs* args) override {
+    return impl_->Read(std::move(on_read), buffer, args);
+  }
+  bool Write(absl::AnyInvocable<void(absl::Status)> on_writable,
+             SliceBuffer* data, const WriteArgs* /*args*/) override {
+    return impl_->Write(std::move(on_writable), data);
+  }
+  const EventEngine::ResolvedAddress& GetPeerAddress() const override {
+    return impl_->GetPeerAddress();
+  }
+  const EventEngine::ResolvedAddress& GetLocalAddress() const override {
+    return impl_->GetLocalAddress();
+  }
+
+  // There are no socket statistics to collect.
+  void EnableStatsCollection(bool /*is_control_channel*/) override {}
+  void UseMemoryQuota(grpc_core::MemoryQuotaRefPtr mem_quota) override {
+    impl_->UseMemoryQuota(std::move(mem_quota));
+  }
+  void EnableRpcReceiveCoalescing() override {
+    impl_->SetRpcReceiveCoalescing(true);
+  }
+  void DisableRpcReceiveCoalescing() override {
+    impl_->SetRpcReceiveCoalescing(false);
+  }
+  void EnforceRxMemoryAlignment() override {
+    impl_->EnforceRxMemoryAlignment();
+  }
+
+ private:
+  SharedMemoryEndpointImpl* impl_;
+};
+
+}  // namespace
+
+absl::StatusOr<SharedMemoryChannelFds> CreateSharedMemoryChannel(
+    size_t ring_capacity) {
+  if (ring_capacity < SharedMemoryRing::kMinCapacity ||
+      ring_capacity > SharedMemoryRing::kMaxCapacity ||
+      (ring_capacity & (ring_capacity - 1)) != 0) {
+    return absl::InvalidArgumentError("Invalid shared memory ring capacity");
+  }
+  SharedMemoryChannelFds fds;
+  fds.memfd = memfd_create("grpc-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fds.memfd < 0) return ErrnoError("memfd_create");
+  const size_t stride = RingStride(ring_capacity);
+  absl::Status status;
+  if (ftruncate(fds.memfd, 2 * stride) != 0) {
+    status = ErrnoError("ftruncate");
+  } else if (fcntl(fds.memfd, F_ADD_SEALS,
+                   F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+    status = ErrnoError("fcntl(F_ADD_SEALS)");
+  }
+  for (int& eventfd_fd : fds.eventfds) {
+    if (!status.ok()) break;
+    eventfd_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (eventfd_fd < 0) status = ErrnoError("eventfd");
+  }
+  void* region = MAP_FAILED;
+  if (status.ok()) {
+    region = mmap(nullptr, 2 * stride, PROT_READ | PROT_WRITE, MAP_SHARED,
+                  fds.memfd, 0);
+    if (region == MAP_FAILED) status = ErrnoError("mmap");
+  }
+  if (status.ok()) {
+    for (size_t i = 0; i < 2; ++i) {
+      auto ring = SharedMemoryRing::Create(
+          static_cast<uint8_t*>(region) + i * stride, ring_capacity);
+      if (!ring.ok()) status = ring.status();
+    }
+    munmap(region, 2 * stride);
+  }
+  if (!status.ok()) {
+    CloseSharedMemoryChannel(fds);
+    return status;
+  }
+  return fds;
+}
+
+void CloseSharedMemoryChannel(SharedMemoryChannelFds& fds) {
+  CloseFd(fds.memfd);
+  CloseFd(fds.eventfds[0]);
+  CloseFd(fds.eventfds[1]);
+}
+
+absl::Status SendSharedMemoryChannel(int socket_fd,
+                                     const SharedMemoryChannelFds& fds) {
+  const int sent_fds[3] = {fds.memfd, fds.eventfds[0], fds.eventfds[1]};
+  char byte = 0;
+  struct iovec iov = {&byte, 1};
+  alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(sent_fds))];
+  memset(control, 0, sizeof(control));
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(sent_fds));
+  memcpy(CMSG_DATA(cmsg), sent_fds, sizeof(sent_fds));
+  ssize_t sent;
+  do {
+    sent = sendmsg(socket_fd, &msg, MSG_NOSIGNAL);
+  } while (sent < 0 && errno == EINTR);
+  if (sent < 0) return ErrnoError("sendmsg");
+  return absl::OkStatus();
+}
+
+absl::StatusOr<SharedMemoryChannelFds> ReceiveSharedMemoryChannel(
+    int socket_fd) {
+  char byte;
+  struct iovec iov = {&byte, 1};
+  alignas(struct cmsghdr) char control[CMSG_SPACE(3 * sizeof(int))];
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  ssize_t received;
+  do {
+    received = recvmsg(socket_fd, &msg, MSG_CMSG_CLOEXEC);
+  } while (received < 0 && errno == EINTR);
+  if (received < 0) return ErrnoError("recvmsg");
+  SharedMemoryChannelFds fds;
+  int* slots[3] = {&fds.memfd, &fds.eventfds[0], &fds.eventfds[1]};
+  size_t count = 0;
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+      continue;
+    }
+    const size_t n = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    for (size_t i = 0; i < n; ++i) {
+      int fd;
+      memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(fd));
+      if (count < 3) {
+        *slots[count] = fd;
+      } else {
+        close(fd);
+      }
+      ++count;
+    }
+  }
+  if (received == 0 || count != 3 || (msg.msg_flags & MSG_CTRUNC) != 0) {
+    CloseSharedMemoryChannel(fds);
+    return absl::InvalidArgumentError(
+        "Peer did not send a shared memory channel");
+  }
+  return fds;
+}
+
+absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
+CreateSharedMemoryEndpoint(SharedMemoryChannelFds fds, int side,
+                           PosixEventPoller* poller,
+                           std::shared_ptr<EventEngine> engine,
+                           MemoryAllocator&& allocator,
+                           const EventEngine::ResolvedAddress& local_address,
+                           const EventEngine::ResolvedAddress& peer_address) {
+  CHECK(side == 0 || side == 1);
+  struct stat st;
+  absl::Status status;
+  if (fds.eventfds[0] < 0 || fds.eventfds[1] < 0) {
+    status = absl::InvalidArgumentError("Missing shared memory eventfds");
+  } else if (fstat(fds.memfd, &st) != 0) {
+    status = ErrnoError("fstat");
+  } else if ((fcntl(fds.memfd, F_GET_SEALS) & F_SEAL_SHRINK) == 0) {
+    // An unsealed memfd could be truncated by the peer, and every access to
+    // the part of the mapping past its end would then raise SIGBUS.
+    status = absl::InvalidArgumentError("Shared memory is not sealed");
+  } else if (st.st_size <= 0 || st.st_size % (2 * kRingAlignment) != 0) {
+    status = absl::InvalidArgumentError("Invalid shared memory size");
+  }
+  const size_t region_size = status.ok() ? st.st_size : 0;
+  void* region = MAP_FAILED;
+  if (status.ok()) {
+    region = mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                  fds.memfd, 0);
+    if (region == MAP_FAILED) status = ErrnoError("mmap");
+  }
+  // The mapping keeps the memory alive.
+  CloseFd(fds.memfd);
+  absl::StatusOr<SharedMemoryRing> rings[2];
+  if (status.ok()) {
+    const size_t stride = region_size / 2;
+    for (size_t i = 0; i < 2; ++i) {
+      rings[i] = SharedMemoryRing::Attach(
+          static_cast<uint8_t*>(region) + i * stride, stride);
+      if (!rings[i].ok()) status = rings[i].status();
+    }
+  }
+  if (!status.ok()) {
+    if (region != MAP_FAILED) munmap(region, region_size);
+    CloseSharedMemoryChannel(fds);
+    return status;
+  }
+  EventHandle* handle =
+      poller->CreateHandle(fds.eventfds[side], "shared_memory_endpoint",
+                           /*track_err=*/false);
+  return std::make_unique<SharedMemoryEndpoint>(new SharedMemoryEndpointImpl(
+      region, region_size, *rings[side], *rings[1 - side], handle,
+      fds.eventfds[1 - side], std::move(engine), std::move(allocator),
+      local_address, peer_address));
+}
+
+#else  // GRPC_LINUX_MEMFD
+
+absl::StatusOr<SharedMemoryChannelFds> CreateSharedMemoryChannel(
+    size_t /*ring_capacity*/) {
+  return absl::UnimplementedError(
+      "Shared memory channels are not supported on this platform");
+}
+
+void CloseSharedMemoryChannel(SharedMemoryChannelFds& /*fds*/) {}
+
+absl::Status SendSharedMemoryChannel(int /*socket_fd*/,
+                                     const SharedMemoryChannelFds& /*fds*/) {
+  return absl::UnimplementedError(
+      "Shared memory channels are not supported on this platform");
+}
+
+absl::StatusOr<SharedMemoryChannelFds> ReceiveSharedMemoryChannel(
+    int /*socket_fd*/) {
+  return absl::UnimplementedError(
+      "Shared memory channels are not supported on this platform");
+}
+
+absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
+CreateSharedMemoryEndpoint(
+    SharedMemoryChannelFds /*fds*/, int /*side*/,
+    PosixEventPoller* /*poller*/, std::shared_ptr<EventEngine> /*engine*/,
+    MemoryAllocator&& /*allocator*/,
+    const EventEngine::ResolvedAddress& /*local_address*/,
+    const EventEngine::ResolvedAddress& /*peer_address*/) {
+  return absl::UnimplementedError(
+      "Shared memory channels are not supported on this platform");
+}
+
+#endif  // GRPC_LINUX_MEMFD
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
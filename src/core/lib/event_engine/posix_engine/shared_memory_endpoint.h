@@ -0,0 +1,95 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHARED_MEMORY_ENDPOINT_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHARED_MEMORY_ENDPOINT_H
+
+// A shared memory channel connects two endpoints on the same host, usually in
+// two processes, without going through the kernel for the bytes themselves:
+// each direction is a SharedMemoryRing in one memfd mapped by both sides, and
+// each side has an eventfd that its peer signals when it made progress while
+// that side was waiting for it.
+//
+// Setup:
+// 1. One side calls CreateSharedMemoryChannel() and sends the channel to the
+//    other over a connected unix domain socket with SendSharedMemoryChannel().
+// 2. The other side receives it with ReceiveSharedMemoryChannel().
+// 3. Both sides call CreateSharedMemoryEndpoint(), the creator as side 0 and
+//    the receiver as side 1.
+//
+// The endpoints support the ChaoticGoodExtension: with RPC receive coalescing
+// enabled, a read given a hint only completes once that many bytes were copied
+// into one contiguous slice, so chaotic_good data frames arrive unsplit.
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// Capacity of each of the two rings of a channel, unless specified otherwise.
+constexpr size_t kDefaultSharedMemoryRingCapacity = 1024 * 1024;
+
+struct SharedMemoryChannelFds {
+  // The memory holding both rings. It is sealed against resizing, so that the
+  // peer cannot make accesses to the mapping fault.
+  int memfd = -1;
+  // eventfds[i] wakes up side i.
+  int eventfds[2] = {-1, -1};
+};
+
+// Creates a channel whose rings each hold \a ring_capacity bytes, a power of
+// two. Returns an error if shared memory channels are not supported on this
+// platform.
+absl::StatusOr<SharedMemoryChannelFds> CreateSharedMemoryChannel(
+    size_t ring_capacity = kDefaultSharedMemoryRingCapacity);
+
+// Closes the file descriptors of a channel that will not be used.
+void CloseSharedMemoryChannel(SharedMemoryChannelFds& fds);
+
+// Passes the file descriptors of \a fds to the peer of the connected unix
+// domain socket \a socket_fd. The caller keeps its own copies.
+absl::Status SendSharedMemoryChannel(int socket_fd,
+                                     const SharedMemoryChannelFds& fds);
+
+// Receives file descriptors sent with SendSharedMemoryChannel() from the unix
+// domain socket \a socket_fd.
+absl::StatusOr<SharedMemoryChannelFds> ReceiveSharedMemoryChannel(
+    int socket_fd);
+
+// Creates the endpoint of \a side (0 or 1) of a channel, taking ownership of
+// the file descriptors of \a fds whether it succeeds or not. Wakeups are
+// polled by \a poller, and read and write callbacks may run on its threads or
+// on \a engine.
+absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
+CreateSharedMemoryEndpoint(SharedMemoryChannelFds fds, int side,
+                           PosixEventPoller* poller,
+                           std::shared_ptr<EventEngine> engine,
+                           MemoryAllocator&& allocator,
+                           const EventEngine::ResolvedAddress& local_address,
+                           const EventEngine::ResolvedAddress& peer_address);
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHARED_MEMORY_ENDPOINT_H
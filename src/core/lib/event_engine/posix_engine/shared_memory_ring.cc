@@ -0,0 +1,170 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/shared_memory_ring.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <new>
+
+#include "absl/status/status.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+constexpr uint32_t kRingMagic = 0x67524e47;  // "gRNG"
+}  // namespace
+
+// The producer and consumer fields live on separate cache lines so that the
+// two sides do not bounce a line back and forth on every update.
+struct SharedMemoryRing::Header {
+  uint32_t magic;
+  uint32_t capacity;
+  std::atomic<uint32_t> closed;
+  // Written by the producer.
+  alignas(64) std::atomic<uint64_t> write_pos;
+  std::atomic<uint32_t> reader_waiting;
+  // Written by the consumer.
+  alignas(64) std::atomic<uint64_t> read_pos;
+  std::atomic<uint32_t> writer_waiting;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared memory rings need address-free atomics");
+
+size_t SharedMemoryRing::RegionSize(size_t capacity) {
+  return sizeof(Header) + capacity;
+}
+
+absl::StatusOr<SharedMemoryRing> SharedMemoryRing::Create(void* region,
+                                                          size_t capacity) {
+  if (capacity < kMinCapacity || capacity > kMaxCapacity ||
+      (capacity & (capacity - 1)) != 0) {
+    return absl::InvalidArgumentError("Invalid shared memory ring capacity");
+  }
+  Header* header = new (region) Header();
+  header->magic = kRingMagic;
+  header->capacity = static_cast<uint32_t>(capacity);
+  header->closed.store(0, std::memory_order_relaxed);
+  header->write_pos.store(0, std::memory_order_relaxed);
+  header->reader_waiting.store(0, std::memory_order_relaxed);
+  header->read_pos.store(0, std::memory_order_relaxed);
+  header->writer_waiting.store(0, std::memory_order_release);
+  return SharedMemoryRing(header, reinterpret_cast<uint8_t*>(header + 1),
+                          capacity);
+}
+
+absl::StatusOr<SharedMemoryRing> SharedMemoryRing::Attach(void* region,
+                                                          size_t region_size) {
+  if (region_size < sizeof(Header)) {
+    return absl::InvalidArgumentError("Shared memory ring region too small");
+  }
+  Header* header = static_cast<Header*>(region);
+  // The header was written by the peer, read it once.
+  const uint32_t magic = header->magic;
+  const size_t capacity = header->capacity;
+  if (magic != kRingMagic || capacity < kMinCapacity ||
+      capacity > kMaxCapacity || (capacity & (capacity - 1)) != 0 ||
+      RegionSize(capacity) > region_size) {
+    return absl::InvalidArgumentError("Invalid shared memory ring header");
+  }
+  return SharedMemoryRing(header, reinterpret_cast<uint8_t*>(header + 1),
+                          capacity);
+}
+
+size_t SharedMemoryRing::WritableBytes() const {
+  const uint64_t used =
+      header_->write_pos.load(std::memory_order_relaxed) -
+      header_->read_pos.load(std::memory_order_acquire);
+  return used >= capacity_ ? 0 : capacity_ - used;
+}
+
+size_t SharedMemoryRing::ReadableBytes() const {
+  const uint64_t used =
+      header_->write_pos.load(std::memory_order_acquire) -
+      header_->read_pos.load(std::memory_order_relaxed);
+  return std::min<uint64_t>(used, capacity_);
+}
+
+size_t SharedMemoryRing::Write(const uint8_t* data, size_t length) {
+  if (IsClosed()) return 0;
+  length = std::min(length, WritableBytes());
+  if (length == 0) return 0;
+  const uint64_t pos = header_->write_pos.load(std::memory_order_relaxed);
+  const size_t offset = pos & (capacity_ - 1);
+  const size_t first = std::min(length, capacity_ - offset);
+  memcpy(data_ + offset, data, first);
+  memcpy(data_, data + first, length - first);
+  // Sequentially consistent so that it is ordered before the load of
+  // reader_waiting in TakeReaderWaiting(), see PrepareReaderWait().
+  header_->write_pos.store(pos + length, std::memory_order_seq_cst);
+  return length;
+}
+
+size_t SharedMemoryRing::Read(uint8_t* data, size_t length) {
+  length = std::min(length, ReadableBytes());
+  if (length == 0) return 0;
+  const uint64_t pos = header_->read_pos.load(std::memory_order_relaxed);
+  const size_t offset = pos & (capacity_ - 1);
+  const size_t first = std::min(length, capacity_ - offset);
+  memcpy(data, data_ + offset, first);
+  memcpy(data + first, data_, length - first);
+  header_->read_pos.store(pos + length, std::memory_order_seq_cst);
+  return length;
+}
+
+bool SharedMemoryRing::PrepareReaderWait() {
+  // Publish the flag before looking at the ring one last time: either the
+  // producer sees the flag after its write, or we see its write here.
+  header_->reader_waiting.store(1, std::memory_order_seq_cst);
+  if (ReadableBytes() > 0 || IsClosed()) {
+    header_->reader_waiting.store(0, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+bool SharedMemoryRing::PrepareWriterWait() {
+  header_->writer_waiting.store(1, std::memory_order_seq_cst);
+  if (WritableBytes() > 0 || IsClosed()) {
+    header_->writer_waiting.store(0, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+bool SharedMemoryRing::TakeReaderWaiting() {
+  return header_->reader_waiting.load(std::memory_order_seq_cst) != 0 &&
+         header_->reader_waiting.exchange(0, std::memory_order_acq_rel) != 0;
+}
+
+bool SharedMemoryRing::TakeWriterWaiting() {
+  return header_->writer_waiting.load(std::memory_order_seq_cst) != 0 &&
+         header_->writer_waiting.exchange(0, std::memory_order_acq_rel) != 0;
+}
+
+void SharedMemoryRing::Close() {
+  header_->closed.store(1, std::memory_order_seq_cst);
+}
+
+bool SharedMemoryRing::IsClosed() const {
+  return header_->closed.load(std::memory_order_acquire) != 0;
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
@@ -0,0 +1,109 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHARED_MEMORY_RING_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHARED_MEMORY_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "absl/status/statusor.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// A single-producer single-consumer byte ring laid out in memory that may be
+// mapped by two processes: a small header with the read and write positions,
+// followed by the data. The ring itself never blocks; the producer and the
+// consumer each publish whether they are waiting for the other side, so that
+// the other side only has to send a wakeup (see SharedMemoryEndpoint) when
+// someone is actually waiting for it.
+//
+// The peer that shares the ring is not trusted: the positions it publishes are
+// validated before they are used, so a misbehaving peer can corrupt the bytes
+// of the stream but never make this side access memory outside the ring.
+class SharedMemoryRing {
+ public:
+  // Smallest and largest supported capacities. Capacities must be a power of
+  // two.
+  static constexpr size_t kMinCapacity = 4096;
+  static constexpr size_t kMaxCapacity = size_t{1} << 30;
+
+  SharedMemoryRing() = default;
+
+  // Returns the size of the memory region holding a ring of \a capacity bytes.
+  static size_t RegionSize(size_t capacity);
+
+  // Initializes an empty ring of \a capacity bytes in \a region, which must be
+  // RegionSize(capacity) bytes long and suitably aligned for atomics.
+  static absl::StatusOr<SharedMemoryRing> Create(void* region,
+                                                 size_t capacity);
+
+  // Attaches to a ring initialized by Create() in \a region, which is
+  // \a region_size bytes long. Returns an error if the region does not hold a
+  // ring that fits in it.
+  static absl::StatusOr<SharedMemoryRing> Attach(void* region,
+                                                 size_t region_size);
+
+  size_t capacity() const { return capacity_; }
+
+  // Producer side. Copies up to \a length bytes of \a data into the ring and
+  // returns how many were copied.
+  size_t Write(const uint8_t* data, size_t length);
+  // Returns the number of bytes Write() can take right now.
+  size_t WritableBytes() const;
+
+  // Consumer side. Copies up to \a length bytes out of the ring into \a data
+  // and returns how many were copied.
+  size_t Read(uint8_t* data, size_t length);
+  // Returns the number of bytes Read() can return right now.
+  size_t ReadableBytes() const;
+
+  // Records that the consumer is about to wait for data. Returns false if data
+  // is available after all, in which case the consumer should read instead of
+  // waiting.
+  bool PrepareReaderWait();
+  // Records that the producer is about to wait for space. Returns false if
+  // space is available after all.
+  bool PrepareWriterWait();
+  // Called by the producer after it wrote data: returns true, once, if the
+  // consumer is waiting and must be woken up.
+  bool TakeReaderWaiting();
+  // Called by the consumer after it read data: returns true, once, if the
+  // producer is waiting and must be woken up.
+  bool TakeWriterWaiting();
+
+  // Marks the ring closed. Either side may close it; after that reads still
+  // return the data left in the ring, but writes fail.
+  void Close();
+  bool IsClosed() const;
+
+ private:
+  struct Header;
+
+  SharedMemoryRing(Header* header, uint8_t* data, size_t capacity)
+      : header_(header), data_(data), capacity_(capacity) {}
+
+  Header* header_ = nullptr;
+  uint8_t* data_ = nullptr;
+  size_t capacity_ = 0;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_SHARED_MEMORY_RING_H
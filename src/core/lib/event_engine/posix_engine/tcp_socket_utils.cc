@@ -43,6 +43,9 @@
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#ifdef GRPC_LINUX_SOCKETUTILS
+#include <linux/filter.h>
+#endif
 #endif  //  GRPC_POSIX_SOCKET_UTILS_COMMON
 
 #include <atomic>
@@ -190,6 +193,12 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
   options.tcp_tx_zero_copy_enabled =
       (AdjustValue(PosixTcpOptions::kZerocpTxEnabledDefault, 0, 1,
                    config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED)) != 0);
+  options.tcp_tx_zerocopy_adaptive =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_TX_ZEROCOPY_ADAPTIVE)) !=
+       0);
+  options.tcp_release_idle_read_buffers =
+      (AdjustValue(0, 0, 1,
+                   config.GetInt(GRPC_ARG_TCP_RELEASE_IDLE_READ_BUFFERS)) != 0);
   options.keep_alive_time_ms =
       AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
   options.keep_alive_timeout_ms =
@@ -206,6 +215,14 @@ PosixTcpOptions TcpOptionsFromEndpointConfig(const EndpointConfig& config) {
         (AdjustValue(0, 1, INT_MAX, config.GetInt(GRPC_ARG_ALLOW_REUSEPORT)) !=
          0);
   }
+  options.listener_shards =
+      AdjustValue(1, 1, PosixTcpOptions::kMaxListenerShards,
+                  config.GetInt(GRPC_ARG_TCP_LISTENER_SHARDS));
+  options.listener_cpu_steering =
+      (AdjustValue(0, 0, 1, config.GetInt(GRPC_ARG_TCP_LISTENER_CPU_STEERING)) !=
+       0);
+  options.busy_poll_us =
+      AdjustValue(0, 0, INT_MAX, config.GetInt(GRPC_ARG_TCP_BUSY_POLL_US));
   if (options.tcp_min_read_chunk_size > options.tcp_max_read_chunk_size) {
     options.tcp_min_read_chunk_size = options.tcp_max_read_chunk_size;
   }
@@ -498,6 +515,59 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int reuse) {
 #endif
 }
 
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int group_size) {
+#if defined(GRPC_LINUX_SOCKETUTILS) && defined(SO_ATTACH_REUSEPORT_CBPF)
+  if (group_size <= 0) {
+    return absl::InvalidArgumentError("Invalid SO_REUSEPORT group size");
+  }
+  // A = cpu; A = A % group_size; return A
+  sock_filter code[] = {
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<uint32_t>(group_size)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  };
+  sock_fprog prog;
+  prog.len = sizeof(code) / sizeof(code[0]);
+  prog.filter = code;
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog,
+                      sizeof(prog))) {
+    return absl::Status(absl::StatusCode::kInternal,
+                        absl::StrCat("setsockopt(SO_ATTACH_REUSEPORT_CBPF): ",
+                                     grpc_core::StrError(errno)));
+  }
+  return absl::OkStatus();
+#else
+  (void)group_size;
+  return absl::Status(
+      absl::StatusCode::kInternal,
+      "SO_ATTACH_REUSEPORT_CBPF unavailable on compiling system");
+#endif
+}
+
+absl::Status PosixSocketWrapper::SetSocketBusyPoll(int busy_poll_us) {
+#ifdef SO_BUSY_POLL
+  if (0 != setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_us,
+                      sizeof(busy_poll_us))) {
+    return absl::Status(
+        absl::StatusCode::kInternal,
+        absl::StrCat("setsockopt(SO_BUSY_POLL): ", grpc_core::StrError(errno)));
+  }
+#ifdef SO_PREFER_BUSY_POLL
+  // Only a hint to the kernel; busy polling works without it.
+  const int prefer = 1;
+  (void)setsockopt(fd_, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer,
+                   sizeof(prefer));
+#endif
+  return absl::OkStatus();
+#else
+  (void)busy_poll_us;
+  return absl::Status(absl::StatusCode::kInternal,
+                      "SO_BUSY_POLL unavailable on compiling system");
+#endif
+}
+
 bool PosixSocketWrapper::IsSocketReusePortSupported() {
   static bool kSupportSoReusePort = []() -> bool {
     int s = socket(AF_INET, SOCK_STREAM, 0);
@@ -854,6 +924,15 @@ absl::Status PosixSocketWrapper::SetSocketReusePort(int /*reuse*/) {
   grpc_core::Crash("unimplemented");
 }
 
+absl::Status PosixSocketWrapper::SetSocketReusePortCpuSteering(
+    int /*group_size*/) {
+  grpc_core::Crash("unimplemented");
+}
+
+absl::Status PosixSocketWrapper::SetSocketBusyPoll(int /*busy_poll_us*/) {
+  grpc_core::Crash("unimplemented");
+}
+
 absl::Status PosixSocketWrapper::SetSocketDscp(int /*dscp*/) {
   grpc_core::Crash("unimplemented");
 }
@@ -46,6 +46,9 @@
 #ifndef SO_EE_ORIGIN_ZEROCOPY
 #define SO_EE_ORIGIN_ZEROCOPY 5
 #endif
+#ifndef SO_EE_CODE_ZEROCOPY_COPIED
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+#endif
 #endif  // ifdef GRPC_LINUX_ERRQUEUE
 
 namespace grpc_event_engine {
@@ -62,6 +65,7 @@ struct PosixTcpOptions {
   // Let the system decide the proper buffer size.
   static constexpr int kReadBufferSizeUnset = -1;
   static constexpr int kDscpNotSet = -1;
+  static constexpr int kMaxListenerShards = 256;
   int tcp_read_chunk_size = kDefaultReadChunkSize;
   int tcp_min_read_chunk_size = kDefaultMinReadChunksize;
   int tcp_max_read_chunk_size = kDefaultMaxReadChunksize;
@@ -69,10 +73,19 @@ struct PosixTcpOptions {
   int tcp_tx_zerocopy_max_simultaneous_sends = kDefaultMaxSends;
   int tcp_receive_buffer_size = kReadBufferSizeUnset;
   bool tcp_tx_zero_copy_enabled = kZerocpTxEnabledDefault;
+  bool tcp_tx_zerocopy_adaptive = false;
+  // Drop spare read buffer space once the socket has been drained, so that
+  // idle connections do not pin receive memory.
+  bool tcp_release_idle_read_buffers = false;
   int keep_alive_time_ms = 0;
   int keep_alive_timeout_ms = 0;
   bool expand_wildcard_addrs = false;
   bool allow_reuse_port = false;
+  // Number of SO_REUSEPORT sockets to listen with on each bound address.
+  int listener_shards = 1;
+  bool listener_cpu_steering = false;
+  // SO_BUSY_POLL value for accepted sockets, 0 to leave it unset.
+  int busy_poll_us = 0;
   int dscp = kDscpNotSet;
   grpc_core::RefCountedPtr<grpc_core::ResourceQuota> resource_quota;
   struct grpc_socket_mutator* socket_mutator = nullptr;
@@ -140,10 +153,15 @@ struct PosixTcpOptions {
     tcp_tx_zerocopy_max_simultaneous_sends =
         other.tcp_tx_zerocopy_max_simultaneous_sends;
     tcp_tx_zero_copy_enabled = other.tcp_tx_zero_copy_enabled;
+    tcp_tx_zerocopy_adaptive = other.tcp_tx_zerocopy_adaptive;
+    tcp_release_idle_read_buffers = other.tcp_release_idle_read_buffers;
     keep_alive_time_ms = other.keep_alive_time_ms;
     keep_alive_timeout_ms = other.keep_alive_timeout_ms;
     expand_wildcard_addrs = other.expand_wildcard_addrs;
     allow_reuse_port = other.allow_reuse_port;
+    listener_shards = other.listener_shards;
+    listener_cpu_steering = other.listener_cpu_steering;
+    busy_poll_us = other.busy_poll_us;
     dscp = other.dscp;
   }
 };
@@ -192,6 +210,14 @@ class PosixSocketWrapper {
   // Set SO_REUSEPORT
   absl::Status SetSocketReusePort(int reuse);
 
+  // Attach a classic BPF program to the SO_REUSEPORT group of this socket
+  // that selects the socket at index (receiving CPU % group_size) for each
+  // new connection.
+  absl::Status SetSocketReusePortCpuSteering(int group_size);
+
+  // Set SO_BUSY_POLL, and SO_PREFER_BUSY_POLL if available.
+  absl::Status SetSocketBusyPoll(int busy_poll_us);
+
   // Set Differentiated Services Code Point (DSCP)
   absl::Status SetSocketDscp(int dscp);
 
@@ -29,7 +29,9 @@
 #include <grpc/support/port_platform.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 
 static thread_local bool g_timer_thread;
 
@@ -86,8 +88,20 @@ bool TimerManager::IsTimerManagerThread() { return g_timer_thread; }
 
 TimerManager::TimerManager(
     std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool)
-    : host_(this), thread_pool_(std::move(thread_pool)) {
-  timer_list_ = std::make_unique<TimerList>(&host_);
+    : TimerManager(std::move(thread_pool), nullptr) {}
+
+TimerManager::TimerManager(
+    std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool,
+    absl::AnyInvocable<void()> kick_poller)
+    : host_(this),
+      thread_pool_(std::move(thread_pool)),
+      kick_poller_(std::move(kick_poller)) {
+  if (grpc_core::ConfigVars::Get().EventEngineTimerList() == "wheel") {
+    timer_list_ = std::make_unique<TimerWheel>(&host_);
+  } else {
+    timer_list_ = std::make_unique<TimerList>(&host_);
+  }
+  if (kick_poller_ != nullptr) return;
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
 }
@@ -125,7 +139,9 @@ void TimerManager::Shutdown() {
     // Wait on the main loop to exit.
     cv_wait_.Signal();
   }
-  main_loop_exit_signal_->WaitForNotification();
+  if (main_loop_exit_signal_.has_value()) {
+    main_loop_exit_signal_->WaitForNotification();
+  }
   if (GRPC_TRACE_FLAG_ENABLED(timer)) {
     VLOG(2) << "TimerManager::" << this << " shutdown complete";
   }
@@ -136,6 +152,10 @@ TimerManager::~TimerManager() { Shutdown(); }
 void TimerManager::Host::Kick() { timer_manager_->Kick(); }
 
 void TimerManager::Kick() {
+  if (kick_poller_ != nullptr) {
+    kick_poller_();
+    return;
+  }
   grpc_core::MutexLock lock(&mu_);
   kicked_ = true;
   cv_wait_.Signal();
@@ -148,6 +168,7 @@ void TimerManager::RestartPostFork() {
     VLOG(2) << "TimerManager::" << this << " restarting after shutdown";
   }
   shutdown_ = false;
+  if (kick_poller_ != nullptr) return;
   main_loop_exit_signal_.emplace();
   thread_pool_->Run([this]() { MainLoop(); });
 }
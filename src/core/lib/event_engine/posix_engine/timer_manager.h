@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
 #include "absl/types/optional.h"
 
 #include <grpc/event_engine/event_engine.h>
@@ -48,6 +49,12 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
  public:
   explicit TimerManager(
       std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool);
+  // A TimerManager without a thread of its own: whoever drives the poller
+  // calls TimerCheck() and polls no longer than the deadline it reports.
+  // kick_poller is called when a timer is added ahead of that deadline.
+  TimerManager(
+      std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool,
+      absl::AnyInvocable<void()> kick_poller);
   ~TimerManager() override;
 
   grpc_core::Timestamp Now() { return host_.Now(); }
@@ -56,6 +63,12 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
                  experimental::EventEngine::Closure* closure);
   bool TimerCancel(Timer* timer);
 
+  // For a poller-driven TimerManager: see TimerListInterface::TimerCheck.
+  absl::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) {
+    return timer_list_->TimerCheck(next);
+  }
+
   static bool IsTimerManagerThread();
 
   // Called on destruction, prefork, and manually when needed.
@@ -99,8 +112,10 @@ class TimerManager final : public grpc_event_engine::experimental::Forkable {
   // number of timer wakeups
   uint64_t wakeups_ ABSL_GUARDED_BY(mu_) = false;
   // actual timer implementation
-  std::unique_ptr<TimerList> timer_list_;
+  std::unique_ptr<TimerListInterface> timer_list_;
   std::shared_ptr<grpc_event_engine::experimental::ThreadPool> thread_pool_;
+  // Set if the poller drives the timers, in which case there is no MainLoop.
+  absl::AnyInvocable<void()> kick_poller_;
   absl::optional<grpc_core::Notification> main_loop_exit_signal_;
 };
 
@@ -0,0 +1,268 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "absl/log/check.h"
+#include "absl/numeric/bits.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+constexpr int64_t kNoTimers = std::numeric_limits<int64_t>::max();
+}  // namespace
+
+TimerWheel::TimerWheel(TimerListHost* host)
+    : host_(host),
+      min_timer_(host_->Now().milliseconds_after_process_epoch()),
+      current_(min_timer_.load(std::memory_order_relaxed)) {}
+
+void TimerWheel::LinkLocked(Timer* timer, size_t level, size_t slot) {
+  Level& l = levels_[level];
+  timer->heap_index = level * kSlots + slot;
+  timer->prev = nullptr;
+  timer->next = l.slots[slot];
+  if (timer->next != nullptr) timer->next->prev = timer;
+  l.slots[slot] = timer;
+  l.occupied[slot / 64] |= uint64_t{1} << (slot % 64);
+}
+
+void TimerWheel::UnlinkLocked(Timer* timer) {
+  if (timer->next != nullptr) timer->next->prev = timer->prev;
+  if (timer->prev != nullptr) {
+    timer->prev->next = timer->next;
+    return;
+  }
+  if (timer->heap_index == kDueIndex) {
+    DCHECK_EQ(due_, timer);
+    due_ = timer->next;
+    return;
+  }
+  const size_t level = timer->heap_index / kSlots;
+  const size_t slot = timer->heap_index % kSlots;
+  Level& l = levels_[level];
+  DCHECK_EQ(l.slots[slot], timer);
+  l.slots[slot] = timer->next;
+  if (timer->next == nullptr) {
+    l.occupied[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+  }
+}
+
+Timer* TimerWheel::TakeSlotLocked(size_t level, size_t slot) {
+  Level& l = levels_[level];
+  Timer* head = l.slots[slot];
+  l.slots[slot] = nullptr;
+  l.occupied[slot / 64] &= ~(uint64_t{1} << (slot % 64));
+  return head;
+}
+
+void TimerWheel::AddLocked(Timer* timer) {
+  if (timer->deadline < current_) {
+    // The wheel has already turned past this deadline.
+    timer->heap_index = kDueIndex;
+    timer->prev = nullptr;
+    timer->next = due_;
+    if (due_ != nullptr) due_->prev = timer;
+    due_ = timer;
+    return;
+  }
+  const uint64_t deadline = static_cast<uint64_t>(timer->deadline);
+  const uint64_t delta = deadline - static_cast<uint64_t>(current_);
+  for (size_t level = 0; level < kLevels; ++level) {
+    if (delta < (uint64_t{1} << (kSlotBits * (level + 1)))) {
+      LinkLocked(timer, level, (deadline >> (kSlotBits * level)) & kSlotMask);
+      return;
+    }
+  }
+  // Beyond the range of the wheel: park the timer in the top level slot that
+  // is cascaded last. It is re-placed from its real deadline at that point.
+  constexpr size_t kTop = kLevels - 1;
+  LinkLocked(timer, kTop,
+             (static_cast<uint64_t>(current_) >> (kSlotBits * kTop)) &
+                 kSlotMask);
+}
+
+void TimerWheel::CascadeLocked() {
+  DCHECK_EQ(current_ & kSlotMask, 0u);
+  for (size_t level = 1; level < kLevels; ++level) {
+    const size_t slot =
+        (static_cast<uint64_t>(current_) >> (kSlotBits * level)) & kSlotMask;
+    Timer* timer = TakeSlotLocked(level, slot);
+    while (timer != nullptr) {
+      Timer* next = timer->next;
+      AddLocked(timer);
+      timer = next;
+    }
+    // Only when this level wraps around does the next one come due as well.
+    if (slot != 0) break;
+  }
+}
+
+void TimerWheel::AdvanceLocked(
+    int64_t now, std::vector<experimental::EventEngine::Closure*>* out) {
+  for (Timer* timer = std::exchange(due_, nullptr); timer != nullptr;
+       timer = timer->next) {
+    timer->pending = false;
+    out->push_back(timer->closure);
+    --num_timers_;
+  }
+  while (current_ <= now) {
+    if (num_timers_ == 0) {
+      current_ = now + 1;
+      return;
+    }
+    const size_t index = current_ & kSlotMask;
+    if (index == 0) CascadeLocked();
+    const size_t slot = NextOccupiedSlot(levels_[0], index);
+    if (slot == kSlots) {
+      // Nothing left in this turn of the lowest level: skip ahead to the next
+      // cascade.
+      current_ =
+          std::min((current_ | static_cast<int64_t>(kSlotMask)) + 1, now + 1);
+      continue;
+    }
+    const int64_t tick = current_ + static_cast<int64_t>(slot - index);
+    if (tick > now) {
+      current_ = now + 1;
+      return;
+    }
+    current_ = tick;
+    Timer* timer = TakeSlotLocked(0, slot);
+    while (timer != nullptr) {
+      DCHECK_LE(timer->deadline, current_);
+      timer->pending = false;
+      out->push_back(timer->closure);
+      --num_timers_;
+      timer = timer->next;
+    }
+    ++current_;
+  }
+}
+
+size_t TimerWheel::NextOccupiedSlot(const Level& level, size_t from) {
+  size_t word = from / 64;
+  uint64_t bits = level.occupied[word] & (~uint64_t{0} << (from % 64));
+  while (bits == 0) {
+    if (++word == kOccupancyWords) return kSlots;
+    bits = level.occupied[word];
+  }
+  return word * 64 + absl::countr_zero(bits);
+}
+
+int64_t TimerWheel::NextCheckLocked() const {
+  if (num_timers_ == 0) return kNoTimers;
+  if (due_ != nullptr) return current_ - 1;
+  int64_t next = kNoTimers;
+  for (size_t level = 0; level < kLevels; ++level) {
+    // Slots of this level are processed (expired for level 0, cascaded
+    // otherwise) at multiples of unit, in slot order: find the first one that
+    // holds timers at or after current_.
+    const size_t shift = kSlotBits * level;
+    const uint64_t unit = uint64_t{1} << shift;
+    const uint64_t first_unit = (static_cast<uint64_t>(current_) + unit - 1) >>
+                                shift;
+    const size_t index = first_unit & kSlotMask;
+    size_t slot = NextOccupiedSlot(levels_[level], index);
+    uint64_t units_ahead = slot - index;
+    if (slot == kSlots) {
+      slot = NextOccupiedSlot(levels_[level], 0);
+      if (slot == kSlots) continue;
+      units_ahead = slot + kSlots - index;
+    }
+    next = std::min(
+        next, static_cast<int64_t>((first_unit + units_ahead) << shift));
+  }
+  return next;
+}
+
+void TimerWheel::TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                           experimental::EventEngine::Closure* closure) {
+  timer->closure = closure;
+  timer->deadline = deadline.milliseconds_after_process_epoch();
+
+#ifndef NDEBUG
+  timer->hash_table_next = nullptr;
+#endif
+
+  bool kick = false;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    if (num_timers_ == 0) {
+      // Nothing is pending, so the wheel can jump straight to the present
+      // instead of stepping through the idle period on the next check.
+      const int64_t now =
+          static_cast<int64_t>(host_->Now().milliseconds_after_process_epoch());
+      current_ = std::max(current_, now);
+    }
+    timer->pending = true;
+    ++num_timers_;
+    AddLocked(timer);
+    if (timer->deadline < min_timer_.load(std::memory_order_relaxed)) {
+      min_timer_.store(timer->deadline, std::memory_order_relaxed);
+      kick = true;
+    }
+  }
+  if (kick) host_->Kick();
+}
+
+bool TimerWheel::TimerCancel(Timer* timer) {
+  grpc_core::MutexLock lock(&mu_);
+  if (!timer->pending) return false;
+  timer->pending = false;
+  UnlinkLocked(timer);
+  --num_timers_;
+  return true;
+}
+
+absl::optional<std::vector<experimental::EventEngine::Closure*>>
+TimerWheel::TimerCheck(grpc_core::Timestamp* next) {
+  const int64_t now =
+      static_cast<int64_t>(host_->Now().milliseconds_after_process_epoch());
+  const int64_t min_timer = min_timer_.load(std::memory_order_relaxed);
+  if (now < min_timer) {
+    if (next != nullptr && min_timer != kNoTimers) {
+      *next = std::min(
+          *next,
+          grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(min_timer));
+    }
+    return std::vector<experimental::EventEngine::Closure*>();
+  }
+
+  if (!checker_mu_.TryLock()) return absl::nullopt;
+  std::vector<experimental::EventEngine::Closure*> run;
+  {
+    grpc_core::MutexLock lock(&mu_);
+    AdvanceLocked(now, &run);
+    const int64_t next_check = NextCheckLocked();
+    min_timer_.store(next_check, std::memory_order_relaxed);
+    if (next != nullptr && next_check != kNoTimers) {
+      *next = std::min(
+          *next,
+          grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(next_check));
+    }
+  }
+  checker_mu_.Unlock();
+
+  return std::move(run);
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
@@ -0,0 +1,119 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
+
+#include <stddef.h>
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// A hierarchical timing wheel with millisecond resolution.
+//
+// Level 0 has one slot per millisecond for the next 256ms; each further level
+// has slots 256 times as wide as the one below it, so four levels cover ~49
+// days (later deadlines are parked in the top level and re-placed when they
+// come around). Timers live in doubly-linked per-slot lists, so TimerInit and
+// TimerCancel are O(1) regardless of how many timers are pending. This suits
+// workloads with very many timers that are almost always cancelled before
+// they fire (deadlines, keepalives). As the wheel turns, the slots of higher
+// levels are cascaded down into the finer levels below them.
+class TimerWheel final : public TimerListInterface {
+ public:
+  explicit TimerWheel(TimerListHost* host);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  void TimerInit(Timer* timer, grpc_core::Timestamp deadline,
+                 experimental::EventEngine::Closure* closure) override;
+  GRPC_MUST_USE_RESULT bool TimerCancel(Timer* timer) override;
+  absl::optional<std::vector<experimental::EventEngine::Closure*>> TimerCheck(
+      grpc_core::Timestamp* next) override;
+
+ private:
+  static constexpr size_t kLevels = 4;
+  static constexpr size_t kSlotBits = 8;
+  static constexpr size_t kSlots = size_t{1} << kSlotBits;
+  static constexpr size_t kSlotMask = kSlots - 1;
+  static constexpr size_t kOccupancyWords = kSlots / 64;
+  // Timer::heap_index of timers on due_.
+  static constexpr size_t kDueIndex = kLevels * kSlots;
+
+  struct Level {
+    // Heads of the (nullptr terminated) per-slot timer lists.
+    Timer* slots[kSlots] = {};
+    // One bit per non-empty slot.
+    uint64_t occupied[kOccupancyWords] = {};
+  };
+
+  // Place \a timer in the slot its deadline maps to, relative to current_.
+  void AddLocked(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void LinkLocked(Timer* timer, size_t level, size_t slot)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void UnlinkLocked(Timer* timer) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Detach and return the list of timers in a slot.
+  Timer* TakeSlotLocked(size_t level, size_t slot)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Redistribute the higher level slots that come due at current_, which must
+  // be a multiple of kSlots.
+  void CascadeLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Turn the wheel up to and including \a now, collecting expired closures.
+  void AdvanceLocked(int64_t now,
+                     std::vector<experimental::EventEngine::Closure*>* out)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // The earliest time at which the wheel needs to be turned again. This may be
+  // earlier than the next deadline (when a higher level needs cascading), but
+  // never later. Returns INT64_MAX if there are no timers.
+  int64_t NextCheckLocked() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Index of the first non-empty slot at or after \a from, or kSlots.
+  static size_t NextOccupiedSlot(const Level& level, size_t from);
+
+  TimerListHost* const host_;
+  grpc_core::Mutex mu_;
+  // Allow only one TimerCheck at once (used as a TryLock, protects no fields
+  // but ensures limits on concurrency)
+  grpc_core::Mutex checker_mu_;
+  // The time (in milliseconds after the process epoch) that TimerCheck needs
+  // to run by; lets TimerCheck return without locking until then.
+  std::atomic<int64_t> min_timer_;
+  // The next millisecond tick of the wheel to be processed: every timer with a
+  // deadline before this has fired.
+  int64_t current_ ABSL_GUARDED_BY(mu_);
+  size_t num_timers_ ABSL_GUARDED_BY(mu_) = 0;
+  // Timers added with a deadline the wheel had already turned past; they fire
+  // on the next TimerCheck.
+  Timer* due_ ABSL_GUARDED_BY(mu_) = nullptr;
+  Level levels_[kLevels] ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_POSIX_ENGINE_TIMER_WHEEL_H
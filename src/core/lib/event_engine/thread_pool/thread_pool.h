@@ -16,12 +16,14 @@
 #include <stddef.h>
 
 #include <memory>
+#include <utility>
 
 #include "absl/functional/any_invocable.h"
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/event_engine/extensions/run_with_priority.h"
 #include "src/core/lib/event_engine/forkable.h"
 
 namespace grpc_event_engine {
@@ -38,6 +40,18 @@ class ThreadPool : public Forkable {
   // Run must not be called after Quiesce completes
   virtual void Run(absl::AnyInvocable<void()> callback) = 0;
   virtual void Run(EventEngine::Closure* closure) = 0;
+  // Run a closure ahead of, or behind, the closures of normal priority. Thread
+  // pools without priority lanes run everything as if with Run.
+  virtual void RunWithPriority(
+      EventEngineRunWithPriorityExtension::Priority /*priority*/,
+      absl::AnyInvocable<void()> callback) {
+    Run(std::move(callback));
+  }
+  virtual void RunWithPriority(
+      EventEngineRunWithPriorityExtension::Priority /*priority*/,
+      EventEngine::Closure* closure) {
+    Run(closure);
+  }
 };
 
 // Creates a default thread pool.
@@ -14,9 +14,11 @@
 #include <stddef.h>
 
 #include <memory>
+#include <vector>
 
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/event_engine/forkable.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
@@ -37,7 +39,12 @@ class ThreadPoolForkCallbackMethods {
 }  // namespace
 
 std::shared_ptr<ThreadPool> MakeThreadPool(size_t reserve_threads) {
-  auto thread_pool = std::make_shared<WorkStealingThreadPool>(reserve_threads);
+  const auto& config = grpc_core::ConfigVars::Get();
+  auto thread_pool = std::make_shared<WorkStealingThreadPool>(
+      reserve_threads,
+      config.EventEngineNumaAwareThreadPool() ? GetNumaNodeCpus()
+                                              : std::vector<std::vector<int>>(),
+      config.EventEngineLockFreeWorkQueue(), config.ForkLazyRestart());
   g_thread_pool_fork_manager->RegisterForkable(
       thread_pool, ThreadPoolForkCallbackMethods::Prefork,
       ThreadPoolForkCallbackMethods::PostforkParent,
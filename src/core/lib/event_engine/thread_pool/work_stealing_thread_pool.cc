@@ -18,16 +18,24 @@
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 
 #include <inttypes.h>
+#include <stdio.h>
 
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "absl/types/optional.h"
@@ -40,12 +48,16 @@
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_local.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/lib/event_engine/work_queue/work_queue.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/examine_stack.h"
+#include "src/core/lib/gprpp/strerror.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/gprpp/time.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 #ifdef GPR_POSIX_SYNC
 #include <csignal>
@@ -53,6 +65,11 @@
 #include <signal.h>
 #endif
 
+#ifdef GPR_LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 // IWYU pragma: no_include <ratio>
 
 // ## Thread Pool Fork-handling
@@ -71,6 +88,14 @@
 //  * all threads are restarted, including the Lifeguard thread, and
 //  * all previously-saved work is enqueued for execution.
 //
+// With lazy postfork restart (the GRPC_FORK_LAZY_RESTART config var), an idle
+// pool does not restart its threads after fork(): the next closure it is given
+// does. This is meant for prefork servers, where a parent warms up gRPC state
+// and then forks many workers in a row: the pool is stopped for the first
+// fork, and the later ones find nothing to stop, while each worker only starts
+// threads in the pools it uses. A pool that still holds saved work restarts
+// right away, since nothing else may come to start it.
+//
 // However, the queue may may get into trouble if one thread is attempting to
 // restart the thread pool while another thread is shutting it down. For that
 // reason, Quiesce and Start must be thread-safe, and Quiesce must wait for the
@@ -96,6 +121,35 @@
 // `lifeguard_thread_.Join()` leads to memory access errors. This implementation
 // uses Notifications to coordinate startup and shutdown states.
 //
+// ## NUMA awareness
+//
+// A pool created with the CPUs of more than one NUMA node keeps one theft
+// registry per node. New threads join the node with the fewest threads and are
+// pinned to its CPUs. An idle thread first steals from the threads of its own
+// node, and only steals from other nodes once it has waited for work once, so
+// closures (and the memory they touch) tend to stay on the node that queued
+// them, while a backlog on one node is still drained by the others.
+//
+// ## Lock-free local queues
+//
+// By default every thread-local queue is a BasicWorkQueue, and the owning
+// thread contends with thieves on its mutex. With the
+// GRPC_EVENT_ENGINE_LOCK_FREE_WORK_QUEUE config var set, they are
+// ChaseLevWorkQueues instead: the owner adds and pops without taking a lock,
+// and thieves take one compare-and-swap per closure. Either way, thieves steal
+// the oldest closure from a queue while the owner runs the most recent one.
+//
+// ## Priority lanes
+//
+// Closures run with high or low priority (see
+// EventEngineRunWithPriorityExtension) go to one of two pool-wide lanes instead
+// of the local or global queues. Before taking any other closure, every thread
+// takes one from the high priority lane, so such work waits for at most one
+// closure per thread. The low priority lane is only drained once there is
+// nothing left to run or steal, except that a thread takes one low priority
+// closure every kLowPriorityInterval closures it runs, so that background work
+// still makes progress when the pool is saturated.
+//
 // ## Debugging
 //
 // Set the environment variable GRPC_THREAD_POOL_VERBOSE_FAILURES=anything to
@@ -113,6 +167,8 @@ namespace {
 // We should probably move all usage here to std::chrono to avoid weird bugs in
 // the future.
 
+// A busy thread runs one closure out of this many from the low priority lane.
+constexpr size_t kLowPriorityInterval = 64;
 // Maximum amount of time an extra thread is allowed to idle before being
 // reclaimed.
 constexpr auto kIdleThreadLimit = std::chrono::seconds(20);
@@ -165,14 +221,89 @@ void DumpSignalHandler(int /* sig */) {
   grpc_core::Thread::Kill(gpr_thd_currentid());
 }
 
+#ifdef GPR_LINUX
+// Returns the first line of a sysfs file, or nullopt if it cannot be read.
+absl::optional<std::string> ReadSysfsLine(const std::string& path) {
+  FILE* fp = fopen(path.c_str(), "r");
+  if (fp == nullptr) return absl::nullopt;
+  char buf[4096];
+  absl::optional<std::string> line;
+  if (fgets(buf, sizeof buf, fp) != nullptr) {
+    line = std::string(absl::StripAsciiWhitespace(buf));
+  }
+  fclose(fp);
+  return line;
+}
+
+// Parses a sysfs list of ids, e.g. "0-3,8,10-11".
+absl::optional<std::vector<int>> ParseIdList(absl::string_view list) {
+  std::vector<int> ids;
+  for (absl::string_view range : absl::StrSplit(list, ',', absl::SkipEmpty())) {
+    std::pair<absl::string_view, absl::string_view> bounds =
+        absl::StrSplit(range, absl::MaxSplits('-', 1));
+    int first;
+    int last;
+    if (!absl::SimpleAtoi(bounds.first, &first)) return absl::nullopt;
+    if (bounds.second.empty()) {
+      last = first;
+    } else if (!absl::SimpleAtoi(bounds.second, &last) || last < first) {
+      return absl::nullopt;
+    }
+    for (int id = first; id <= last; ++id) ids.push_back(id);
+  }
+  return ids;
+}
+
+void PinThreadToCpus(const std::vector<int>& cpus) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus) {
+    if (cpu < CPU_SETSIZE) CPU_SET(cpu, &cpu_set);
+  }
+  int err = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  if (err != 0) {
+    GRPC_TRACE_LOG(event_engine, INFO)
+        << "Failed to pin thread pool thread to its NUMA node: "
+        << grpc_core::StrError(err);
+  }
+}
+#else   // GPR_LINUX
+void PinThreadToCpus(const std::vector<int>& /*cpus*/) {}
+#endif  // GPR_LINUX
+
 }  // namespace
 
+std::vector<std::vector<int>> GetNumaNodeCpus() {
+  std::vector<std::vector<int>> numa_nodes;
+#ifdef GPR_LINUX
+  auto online = ReadSysfsLine("/sys/devices/system/node/online");
+  if (!online.has_value()) return {};
+  auto nodes = ParseIdList(*online);
+  if (!nodes.has_value()) return {};
+  for (int node : *nodes) {
+    auto cpulist = ReadSysfsLine(
+        absl::StrCat("/sys/devices/system/node/node", node, "/cpulist"));
+    if (!cpulist.has_value()) return {};
+    auto cpus = ParseIdList(*cpulist);
+    if (!cpus.has_value()) return {};
+    // Memory-only nodes have no CPUs to run threads on.
+    if (!cpus->empty()) numa_nodes.push_back(std::move(*cpus));
+  }
+#endif  // GPR_LINUX
+  if (numa_nodes.size() < 2) return {};
+  return numa_nodes;
+}
+
 thread_local WorkQueue* g_local_queue = nullptr;
 
 // -------- WorkStealingThreadPool --------
 
-WorkStealingThreadPool::WorkStealingThreadPool(size_t reserve_threads)
-    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(reserve_threads)} {
+WorkStealingThreadPool::WorkStealingThreadPool(
+    size_t reserve_threads, std::vector<std::vector<int>> numa_nodes,
+    bool lock_free_local_queues, bool lazy_postfork_restart)
+    : pool_{std::make_shared<WorkStealingThreadPoolImpl>(
+          reserve_threads, std::move(numa_nodes), lock_free_local_queues,
+          lazy_postfork_restart)} {
   if (g_log_verbose_failures) {
     GRPC_TRACE_LOG(event_engine, INFO)
         << "WorkStealingThreadPool verbose failures are enabled";
@@ -194,6 +325,28 @@ void WorkStealingThreadPool::Run(EventEngine::Closure* closure) {
   pool_->Run(closure);
 }
 
+void WorkStealingThreadPool::RunWithPriority(
+    EventEngineRunWithPriorityExtension::Priority priority,
+    absl::AnyInvocable<void()> callback) {
+  RunWithPriority(priority, SelfDeletingClosure::Create(std::move(callback)));
+}
+
+void WorkStealingThreadPool::RunWithPriority(
+    EventEngineRunWithPriorityExtension::Priority priority,
+    EventEngine::Closure* closure) {
+  pool_->RunWithPriority(closure, priority);
+}
+
+std::vector<size_t> WorkStealingThreadPool::ThreadsPerNumaNode() const {
+  std::vector<size_t> counts;
+  counts.reserve(pool_->num_numa_nodes());
+  for (size_t i = 0; i < pool_->num_numa_nodes(); ++i) {
+    counts.push_back(
+        pool_->numa_node(i)->thread_count.load(std::memory_order_relaxed));
+  }
+  return counts;
+}
+
 // -------- WorkStealingThreadPool::TheftRegistry --------
 
 void WorkStealingThreadPool::TheftRegistry::Enroll(WorkQueue* queue) {
@@ -210,12 +363,26 @@ EventEngine::Closure* WorkStealingThreadPool::TheftRegistry::StealOne() {
   grpc_core::MutexLock lock(&mu_);
   EventEngine::Closure* closure;
   for (auto* queue : queues_) {
-    closure = queue->PopMostRecent();
+    closure = queue->PopOldest();
     if (closure != nullptr) return closure;
   }
   return nullptr;
 }
 
+// -------- WorkStealingThreadPool::PriorityLane --------
+
+void WorkStealingThreadPool::PriorityLane::Add(EventEngine::Closure* closure) {
+  queue_.Add(closure);
+  size_.fetch_add(1, std::memory_order_release);
+}
+
+EventEngine::Closure* WorkStealingThreadPool::PriorityLane::Pop() {
+  if (Empty()) return nullptr;
+  EventEngine::Closure* closure = queue_.PopOldest();
+  if (closure != nullptr) size_.fetch_sub(1, std::memory_order_relaxed);
+  return closure;
+}
+
 void WorkStealingThreadPool::PrepareFork() { pool_->PrepareFork(); }
 
 void WorkStealingThreadPool::PostforkParent() { pool_->Postfork(); }
@@ -225,8 +392,23 @@ void WorkStealingThreadPool::PostforkChild() { pool_->Postfork(); }
 // -------- WorkStealingThreadPool::WorkStealingThreadPoolImpl --------
 
 WorkStealingThreadPool::WorkStealingThreadPoolImpl::WorkStealingThreadPoolImpl(
-    size_t reserve_threads)
-    : reserve_threads_(reserve_threads), queue_(this) {}
+    size_t reserve_threads, std::vector<std::vector<int>> numa_nodes,
+    bool lock_free_local_queues, bool lazy_postfork_restart)
+    : reserve_threads_(reserve_threads),
+      lock_free_local_queues_(lock_free_local_queues),
+      lazy_postfork_restart_(lazy_postfork_restart),
+      queue_(this),
+      high_priority_lane_(this),
+      low_priority_lane_(this) {
+  if (numa_nodes.size() < 2) {
+    // Not NUMA aware: a single node, and threads are not pinned.
+    numa_nodes_.push_back(std::make_unique<NumaNode>(std::vector<int>()));
+    return;
+  }
+  for (auto& cpus : numa_nodes) {
+    numa_nodes_.push_back(std::make_unique<NumaNode>(std::move(cpus)));
+  }
+}
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
   for (size_t i = 0; i < reserve_threads_; i++) {
@@ -239,6 +421,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Start() {
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
     EventEngine::Closure* closure) {
   CHECK(!IsQuiesced());
+  MaybeStartAfterFork();
   if (g_local_queue != nullptr && g_local_queue->owner() == this) {
     g_local_queue->Add(closure);
   } else {
@@ -249,6 +432,26 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Run(
   work_signal_.Signal();
 }
 
+void WorkStealingThreadPool::WorkStealingThreadPoolImpl::RunWithPriority(
+    EventEngine::Closure* closure,
+    EventEngineRunWithPriorityExtension::Priority priority) {
+  MaybeStartAfterFork();
+  switch (priority) {
+    case EventEngineRunWithPriorityExtension::Priority::kHigh:
+      CHECK(!IsQuiesced());
+      high_priority_lane_.Add(closure);
+      break;
+    case EventEngineRunWithPriorityExtension::Priority::kNormal:
+      Run(closure);
+      return;
+    case EventEngineRunWithPriorityExtension::Priority::kLow:
+      CHECK(!IsQuiesced());
+      low_priority_lane_.Add(closure);
+      break;
+  }
+  work_signal_.Signal();
+}
+
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
   last_started_thread_.store(
       grpc_core::Timestamp::Now().milliseconds_after_process_epoch(),
@@ -260,12 +463,13 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::StartThread() {
         worker->ThreadBody();
         delete worker;
       },
-      new ThreadState(shared_from_this()), nullptr,
+      new ThreadState(shared_from_this(), PickNumaNode()), nullptr,
       grpc_core::Thread::Options().set_tracked(false).set_joinable(false))
       .Start();
 }
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
+  start_pending_.store(false, std::memory_order_relaxed);
   SetShutdown(true);
   // Wait until all threads have exited.
   // Note that if this is a threadpool thread then we won't exit this thread
@@ -281,6 +485,8 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Quiesce() {
     DumpStacksAndCrash();
   }
   CHECK(queue_.Empty());
+  CHECK(high_priority_lane_.Empty());
+  CHECK(low_priority_lane_.Empty());
   quiesced_.store(true, std::memory_order_relaxed);
   grpc_core::MutexLock lock(&lifeguard_ptr_mu_);
   lifeguard_.reset();
@@ -331,6 +537,11 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::PrepareFork() {
 
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Postfork() {
   SetForking(false);
+  if (lazy_postfork_restart_ && queue_.Empty() &&
+      high_priority_lane_.Empty() && low_priority_lane_.Empty()) {
+    start_pending_.store(true, std::memory_order_release);
+    return;
+  }
   Start();
 }
 
@@ -346,6 +557,39 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::UntrackThread(
   thds_.erase(tid);
 }
 
+size_t WorkStealingThreadPool::WorkStealingThreadPoolImpl::PickNumaNode() {
+  size_t best = 0;
+  size_t best_count = numa_nodes_[0]->thread_count.load();
+  for (size_t i = 1; i < numa_nodes_.size(); ++i) {
+    size_t count = numa_nodes_[i]->thread_count.load();
+    if (count < best_count) {
+      best = i;
+      best_count = count;
+    }
+  }
+  return best;
+}
+
+EventEngine::Closure*
+WorkStealingThreadPool::WorkStealingThreadPoolImpl::StealOne(size_t node,
+                                                             bool cross_nodes) {
+  EventEngine::Closure* closure = numa_nodes_[node]->theft_registry.StealOne();
+  if (closure != nullptr) {
+    grpc_core::global_stats().IncrementWorkStealingSameNodeSteals();
+    return closure;
+  }
+  if (!cross_nodes) return nullptr;
+  for (size_t i = 1; i < numa_nodes_.size(); ++i) {
+    closure = numa_nodes_[(node + i) % numa_nodes_.size()]
+                  ->theft_registry.StealOne();
+    if (closure != nullptr) {
+      grpc_core::global_stats().IncrementWorkStealingCrossNodeSteals();
+      return closure;
+    }
+  }
+  return nullptr;
+}
+
 void WorkStealingThreadPool::WorkStealingThreadPoolImpl::DumpStacksAndCrash() {
   grpc_core::MutexLock lock(&thd_set_mu_);
   LOG(ERROR) << "Pool did not quiesce in time, gRPC will not shut down "
@@ -434,7 +678,8 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
   const auto living_thread_count = pool_->living_thread_count()->count();
   // Wake an idle worker thread if there's global work to be had.
   if (pool_->busy_thread_count()->count() < living_thread_count) {
-    if (!pool_->queue_.Empty()) {
+    if (!pool_->queue_.Empty() || !pool_->high_priority_lane_.Empty() ||
+        !pool_->low_priority_lane_.Empty()) {
       pool_->work_signal()->Signal();
       backoff_.Reset();
     }
@@ -466,7 +711,7 @@ void WorkStealingThreadPool::WorkStealingThreadPoolImpl::Lifeguard::
 // -------- WorkStealingThreadPool::ThreadState --------
 
 WorkStealingThreadPool::ThreadState::ThreadState(
-    std::shared_ptr<WorkStealingThreadPoolImpl> pool)
+    std::shared_ptr<WorkStealingThreadPoolImpl> pool, size_t numa_node)
     : pool_(std::move(pool)),
       auto_thread_counter_(
           pool_->living_thread_count()->MakeAutoThreadCounter()),
@@ -474,7 +719,12 @@ WorkStealingThreadPool::ThreadState::ThreadState(
                    .set_initial_backoff(kWorkerThreadMinSleepBetweenChecks)
                    .set_max_backoff(kWorkerThreadMaxSleepBetweenChecks)
                    .set_multiplier(1.3)),
-      busy_count_idx_(pool_->busy_thread_count()->NextIndex()) {}
+      busy_count_idx_(pool_->busy_thread_count()->NextIndex()),
+      numa_node_(numa_node) {
+  // Counted as soon as the thread is started, so that threads started in a row
+  // are spread across the nodes.
+  pool_->numa_node(numa_node_)->thread_count.fetch_add(1);
+}
 
 void WorkStealingThreadPool::ThreadState::ThreadBody() {
   if (g_log_verbose_failures) {
@@ -485,8 +735,14 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
 #endif
     pool_->TrackThread(gpr_thd_currentid());
   }
-  g_local_queue = new BasicWorkQueue(pool_.get());
-  pool_->theft_registry()->Enroll(g_local_queue);
+  NumaNode* numa_node = pool_->numa_node(numa_node_);
+  if (!numa_node->cpus.empty()) PinThreadToCpus(numa_node->cpus);
+  if (pool_->lock_free_local_queues()) {
+    g_local_queue = new ChaseLevWorkQueue(pool_.get());
+  } else {
+    g_local_queue = new BasicWorkQueue(pool_.get());
+  }
+  numa_node->theft_registry.Enroll(g_local_queue);
   ThreadLocal::SetIsEventEngineThread(true);
   while (Step()) {
     // loop until the thread should no longer run
@@ -505,8 +761,9 @@ void WorkStealingThreadPool::ThreadState::ThreadBody() {
     FinishDraining();
   }
   CHECK(g_local_queue->Empty());
-  pool_->theft_registry()->Unenroll(g_local_queue);
+  numa_node->theft_registry.Unenroll(g_local_queue);
   delete g_local_queue;
+  numa_node->thread_count.fetch_sub(1);
   if (g_log_verbose_failures) {
     pool_->UntrackThread(gpr_thd_currentid());
   }
@@ -520,8 +777,14 @@ void WorkStealingThreadPool::ThreadState::SleepIfRunning() {
 
 bool WorkStealingThreadPool::ThreadState::Step() {
   if (pool_->IsForking()) return false;
-  auto* closure = g_local_queue->PopMostRecent();
+  auto* closure = pool_->high_priority_lane()->Pop();
+  if (closure == nullptr &&
+      ++steps_since_low_priority_ >= kLowPriorityInterval) {
+    closure = pool_->low_priority_lane()->Pop();
+    if (closure != nullptr) steps_since_low_priority_ = 0;
+  }
   // If local work is available, run it.
+  if (closure == nullptr) closure = g_local_queue->PopMostRecent();
   if (closure != nullptr) {
     auto busy =
         pool_->busy_thread_count()->MakeAutoThreadCounter(busy_count_idx_);
@@ -534,6 +797,9 @@ bool WorkStealingThreadPool::ThreadState::Step() {
   // * the global queue is empty
   // * the steal pool returns nullptr
   bool should_run_again = false;
+  // Work is only stolen from other NUMA nodes after waiting once for local
+  // work.
+  bool steal_across_nodes = false;
   auto start_time = std::chrono::steady_clock::now();
   // Wait until work is available or until shut down.
   while (!pool_->IsForking()) {
@@ -541,23 +807,32 @@ bool WorkStealingThreadPool::ThreadState::Step() {
     // TODO(hork): consider an empty check for performance wins. Depends on the
     // queue implementation, the BasicWorkQueue takes two locks when you do an
     // empty check then pop.
-    closure = pool_->queue()->PopMostRecent();
+    closure = pool_->high_priority_lane()->Pop();
+    if (closure == nullptr) closure = pool_->queue()->PopMostRecent();
     if (closure != nullptr) {
       should_run_again = true;
       break;
     };
     // Try stealing if the queue is empty
-    closure = pool_->theft_registry()->StealOne();
+    closure = pool_->StealOne(numa_node_, steal_across_nodes);
     if (closure != nullptr) {
       should_run_again = true;
       break;
     }
+    // Background work only runs when there is nothing else to do.
+    closure = pool_->low_priority_lane()->Pop();
+    if (closure != nullptr) {
+      steps_since_low_priority_ = 0;
+      should_run_again = true;
+      break;
+    }
     // No closures were retrieved from anywhere.
     // Quit the thread if the pool has been shut down.
     if (pool_->IsShutdown()) break;
     bool timed_out = pool_->work_signal()->WaitWithTimeout(
         backoff_.NextAttemptTime() - grpc_core::Timestamp::Now());
     if (pool_->IsForking() || pool_->IsShutdown()) break;
+    steal_across_nodes = true;
     // Quit a thread if the pool has more than it requires, and this thread
     // has been idle long enough.
     if (timed_out &&
@@ -587,6 +862,10 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
   // If a fork occurs at any point during shutdown, quit draining. The post-fork
   // threads will finish draining the global queue.
   while (!pool_->IsForking()) {
+    if (auto* closure = pool_->high_priority_lane()->Pop()) {
+      closure->Run();
+      continue;
+    }
     if (!g_local_queue->Empty()) {
       auto* closure = g_local_queue->PopMostRecent();
       if (closure != nullptr) {
@@ -601,6 +880,10 @@ void WorkStealingThreadPool::ThreadState::FinishDraining() {
       }
       continue;
     }
+    if (auto* closure = pool_->low_priority_lane()->Pop()) {
+      closure->Run();
+      continue;
+    }
     break;
   }
 }
@@ -23,6 +23,8 @@
 
 #include <atomic>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/container/flat_hash_set.h"
@@ -33,6 +35,7 @@
 #include <grpc/support/thd_id.h>
 
 #include "src/core/lib/backoff/backoff.h"
+#include "src/core/lib/event_engine/extensions/run_with_priority.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
@@ -46,7 +49,18 @@ namespace experimental {
 
 class WorkStealingThreadPool final : public ThreadPool {
  public:
-  explicit WorkStealingThreadPool(size_t reserve_threads);
+  // If \a numa_nodes has more than one entry, the pool is NUMA aware: each
+  // entry lists the CPUs of one node, threads are spread evenly across the
+  // nodes and pinned to the CPUs of their node, and idle threads only steal
+  // work from other nodes after having waited for work from their own.
+  // If \a lock_free_local_queues is true, the thread-local queues are
+  // ChaseLevWorkQueues rather than BasicWorkQueues.
+  // If \a lazy_postfork_restart is true, threads stopped for fork() are only
+  // started again once the pool is given work.
+  explicit WorkStealingThreadPool(size_t reserve_threads,
+                                  std::vector<std::vector<int>> numa_nodes = {},
+                                  bool lock_free_local_queues = false,
+                                  bool lazy_postfork_restart = false);
   // Asserts Quiesce was called.
   ~WorkStealingThreadPool() override;
   // Shut down the pool, and wait for all threads to exit.
@@ -55,6 +69,12 @@ class WorkStealingThreadPool final : public ThreadPool {
   // Run must not be called after Quiesce completes
   void Run(absl::AnyInvocable<void()> callback) override;
   void Run(EventEngine::Closure* closure) override;
+  // High and low priority closures go to pool-wide lanes, which idle and busy
+  // threads check before and after all other work respectively.
+  void RunWithPriority(EventEngineRunWithPriorityExtension::Priority priority,
+                       absl::AnyInvocable<void()> callback) override;
+  void RunWithPriority(EventEngineRunWithPriorityExtension::Priority priority,
+                       EventEngine::Closure* closure) override;
 
   // Forkable
   // These methods are exposed on the public object to allow for testing.
@@ -62,6 +82,10 @@ class WorkStealingThreadPool final : public ThreadPool {
   void PostforkParent() override;
   void PostforkChild() override;
 
+  // The number of living threads on each NUMA node. Has a single entry if the
+  // pool is not NUMA aware.
+  std::vector<size_t> ThreadsPerNumaNode() const;
+
  private:
   // A basic communication mechanism to signal waiting threads that work is
   // available.
@@ -97,19 +121,53 @@ class WorkStealingThreadPool final : public ThreadPool {
     absl::flat_hash_set<WorkQueue*> queues_ ABSL_GUARDED_BY(mu_);
   };
 
+  // A pool-wide queue for the closures of one priority other than normal.
+  // Its size is tracked separately so that empty lanes, the common case, are
+  // skipped without taking the queue's lock.
+  class PriorityLane {
+   public:
+    explicit PriorityLane(void* owner) : queue_(owner) {}
+    void Add(EventEngine::Closure* closure);
+    // Returns the oldest closure in the lane, or nullptr if there is none.
+    EventEngine::Closure* Pop();
+    bool Empty() const { return size_.load(std::memory_order_acquire) <= 0; }
+
+   private:
+    BasicWorkQueue queue_;
+    // May briefly be off by the number of concurrent Add() and Pop() calls.
+    std::atomic<int64_t> size_{0};
+  };
+
   // An implementation of the ThreadPool
   // This object is held as a shared_ptr between the owning ThreadPool and each
   // worker thread. This design allows a ThreadPool worker thread to be the last
   // owner of the ThreadPool itself.
+  // The threads of one NUMA node, and the queues they steal from first. A pool
+  // that is not NUMA aware has a single node owning all threads.
+  struct NumaNode {
+    explicit NumaNode(std::vector<int> cpus) : cpus(std::move(cpus)) {}
+    // The CPUs the node's threads are pinned to. Empty if they are not pinned.
+    const std::vector<int> cpus;
+    TheftRegistry theft_registry;
+    std::atomic<size_t> thread_count{0};
+  };
+
   class WorkStealingThreadPoolImpl
       : public std::enable_shared_from_this<WorkStealingThreadPoolImpl> {
    public:
-    explicit WorkStealingThreadPoolImpl(size_t reserve_threads);
+    WorkStealingThreadPoolImpl(size_t reserve_threads,
+                               std::vector<std::vector<int>> numa_nodes,
+                               bool lock_free_local_queues,
+                               bool lazy_postfork_restart);
     // Start all threads.
     void Start();
     // Add a closure to a work queue, preferably a thread-local queue if
     // available, otherwise the global queue.
     void Run(EventEngine::Closure* closure);
+    // Add a closure to the lane of its priority.
+    void RunWithPriority(
+        EventEngine::Closure* closure,
+        EventEngineRunWithPriorityExtension::Priority priority);
     // Start a new thread.
     // The reason argument determines whether thread creation is rate-limited;
     // threads created to populate the initial pool are not rate-limited, but
@@ -132,18 +190,36 @@ class WorkStealingThreadPool final : public ThreadPool {
     // Postfork parent and child have the same behavior.
     void PrepareFork();
     void Postfork();
+    // Starts the threads if Postfork() left that to the next closure.
+    void MaybeStartAfterFork() {
+      if (GPR_UNLIKELY(start_pending_.load(std::memory_order_relaxed)) &&
+          start_pending_.exchange(false, std::memory_order_acq_rel)) {
+        Start();
+      }
+    }
     // Thread ID tracking
     void TrackThread(gpr_thd_id tid);
     void UntrackThread(gpr_thd_id tid);
+    // Returns the NUMA node with the fewest threads.
+    size_t PickNumaNode();
+    // Returns one closure from another thread of NUMA node \a node, or if
+    // there is none and \a cross_nodes is true, from a thread of another node.
+    // Returns nullptr if none are available.
+    EventEngine::Closure* StealOne(size_t node, bool cross_nodes);
     // Accessor methods
     bool IsShutdown();
     bool IsForking();
     bool IsQuiesced();
     size_t reserve_threads() { return reserve_threads_; }
+    // Whether thread-local queues are ChaseLevWorkQueues.
+    bool lock_free_local_queues() const { return lock_free_local_queues_; }
     BusyThreadCount* busy_thread_count() { return &busy_thread_count_; }
     LivingThreadCount* living_thread_count() { return &living_thread_count_; }
-    TheftRegistry* theft_registry() { return &theft_registry_; }
+    size_t num_numa_nodes() const { return numa_nodes_.size(); }
+    NumaNode* numa_node(size_t node) { return numa_nodes_[node].get(); }
     WorkQueue* queue() { return &queue_; }
+    PriorityLane* high_priority_lane() { return &high_priority_lane_; }
+    PriorityLane* low_priority_lane() { return &low_priority_lane_; }
     WorkSignal* work_signal() { return &work_signal_; }
 
    private:
@@ -174,10 +250,15 @@ class WorkStealingThreadPool final : public ThreadPool {
     void DumpStacksAndCrash();
 
     const size_t reserve_threads_;
+    const bool lock_free_local_queues_;
+    const bool lazy_postfork_restart_;
     BusyThreadCount busy_thread_count_;
     LivingThreadCount living_thread_count_;
-    TheftRegistry theft_registry_;
+    // Never empty, and not modified after construction.
+    std::vector<std::unique_ptr<NumaNode>> numa_nodes_;
     BasicWorkQueue queue_;
+    PriorityLane high_priority_lane_;
+    PriorityLane low_priority_lane_;
     // Track shutdown and fork bits separately.
     // It's possible for a ThreadPool to initiate shut down while fork handlers
     // are running, and similarly possible for a fork event to occur during
@@ -185,6 +266,8 @@ class WorkStealingThreadPool final : public ThreadPool {
     std::atomic<bool> shutdown_{false};
     std::atomic<bool> forking_{false};
     std::atomic<bool> quiesced_{false};
+    // Set when Postfork() did not restart the threads.
+    std::atomic<bool> start_pending_{false};
     std::atomic<uint64_t> last_started_thread_{0};
     // After pool creation we use this to rate limit creation of threads to one
     // at a time.
@@ -199,7 +282,8 @@ class WorkStealingThreadPool final : public ThreadPool {
 
   class ThreadState {
    public:
-    explicit ThreadState(std::shared_ptr<WorkStealingThreadPoolImpl> pool);
+    ThreadState(std::shared_ptr<WorkStealingThreadPoolImpl> pool,
+                size_t numa_node);
     void ThreadBody();
     void SleepIfRunning();
     bool Step();
@@ -217,11 +301,19 @@ class WorkStealingThreadPool final : public ThreadPool {
     LivingThreadCount::AutoThreadCounter auto_thread_counter_;
     grpc_core::BackOff backoff_;
     size_t busy_count_idx_;
+    const size_t numa_node_;
+    // The number of closures this thread took from anywhere but the low
+    // priority lane since it last took one from there.
+    size_t steps_since_low_priority_ = 0;
   };
 
   const std::shared_ptr<WorkStealingThreadPoolImpl> pool_;
 };
 
+// Returns the CPUs of each NUMA node of the host, or an empty vector if the
+// topology is unknown or the host has a single node.
+std::vector<std::vector<int>> GetNumaNodeCpus();
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -51,8 +51,13 @@ class IOCP final : public Poller {
   static DWORD GetDefaultSocketFlags();
 
  private:
+  // The most completions a single Work call dequeues and dispatches.
+  static constexpr ULONG kMaxCompletionsPerWork = 64;
+
   // Initialize default flags via checking platform support
   static DWORD WSASocketFlagsInit();
+  // Queue a kick completion without counting it as a new kick.
+  void PostKick();
 
   ThreadPool* thread_pool_;
   HANDLE iocp_handle_;
@@ -0,0 +1,136 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
+
+#include <utility>
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/common_closures.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+constexpr size_t kInitialCapacity = 64;
+}  // namespace
+
+// A ring buffer of closures, indexed by the ever increasing top_ and bottom_
+// positions of the queue.
+class ChaseLevWorkQueue::Buffer {
+ public:
+  // capacity must be a power of two.
+  explicit Buffer(size_t capacity)
+      : mask_(capacity - 1),
+        slots_(new std::atomic<EventEngine::Closure*>[capacity]) {}
+
+  size_t capacity() const { return mask_ + 1; }
+
+  EventEngine::Closure* Get(int64_t i) const {
+    return slots_[static_cast<size_t>(i) & mask_].load(
+        std::memory_order_relaxed);
+  }
+
+  void Put(int64_t i, EventEngine::Closure* closure) {
+    slots_[static_cast<size_t>(i) & mask_].store(closure,
+                                                 std::memory_order_relaxed);
+  }
+
+  // Returns a buffer twice as large holding the elements in [top, bottom).
+  std::unique_ptr<Buffer> Grow(int64_t top, int64_t bottom) const {
+    auto buffer = std::make_unique<Buffer>(capacity() * 2);
+    for (int64_t i = top; i < bottom; ++i) buffer->Put(i, Get(i));
+    return buffer;
+  }
+
+ private:
+  const size_t mask_;
+  const std::unique_ptr<std::atomic<EventEngine::Closure*>[]> slots_;
+};
+
+ChaseLevWorkQueue::ChaseLevWorkQueue(void* owner) : owner_(owner) {
+  buffers_.push_back(std::make_unique<Buffer>(kInitialCapacity));
+  buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+}
+
+ChaseLevWorkQueue::~ChaseLevWorkQueue() = default;
+
+bool ChaseLevWorkQueue::Empty() const { return Size() == 0; }
+
+size_t ChaseLevWorkQueue::Size() const {
+  const int64_t top = top_.load(std::memory_order_acquire);
+  const int64_t bottom = bottom_.load(std::memory_order_acquire);
+  // PopMostRecent() transiently moves bottom_ below top_ on an empty queue.
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+void ChaseLevWorkQueue::Add(EventEngine::Closure* closure) {
+  const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  const int64_t top = top_.load(std::memory_order_acquire);
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  if (bottom - top > static_cast<int64_t>(buffer->capacity()) - 1) {
+    buffers_.push_back(buffer->Grow(top, bottom));
+    buffer = buffers_.back().get();
+    buffer_.store(buffer, std::memory_order_release);
+  }
+  buffer->Put(bottom, closure);
+  // Publishes the closure to thieves. A release store rather than the paper's
+  // release fence and relaxed store, which sanitizers do not understand.
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+void ChaseLevWorkQueue::Add(absl::AnyInvocable<void()> invocable) {
+  Add(SelfDeletingClosure::Create(std::move(invocable)));
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopMostRecent() {
+  const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t top = top_.load(std::memory_order_relaxed);
+  if (top > bottom) {
+    // Empty.
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  EventEngine::Closure* closure = buffer->Get(bottom);
+  if (top == bottom) {
+    // The last element: race the thieves for it.
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      closure = nullptr;
+    }
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return closure;
+}
+
+EventEngine::Closure* ChaseLevWorkQueue::PopOldest() {
+  int64_t top = top_.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const int64_t bottom = bottom_.load(std::memory_order_acquire);
+  if (top >= bottom) return nullptr;
+  EventEngine::Closure* closure =
+      buffer_.load(std::memory_order_acquire)->Get(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    // Lost the race to the owner or to another thief.
+    return nullptr;
+  }
+  return closure;
+}
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
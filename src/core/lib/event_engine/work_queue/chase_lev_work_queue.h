@@ -0,0 +1,87 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#define GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/work_queue/work_queue.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+// A lock-free work-stealing deque: "Dynamic Circular Work-Stealing Deque"
+// (Chase and Lev, 2005), with the memory orderings of "Correct and Efficient
+// Work-Stealing for Weak Memory Models" (Lê et al., 2013).
+//
+// The queue has a single owner that adds closures and takes back the most
+// recent ones without synchronizing with anybody else, while any number of
+// threads take the oldest ones with one compare-and-swap each. Unlike the
+// other WorkQueue implementations, Add() and PopMostRecent() must only ever be
+// called from one thread (e.g. the worker thread owning the queue); every
+// other method is thread-safe.
+//
+// PopOldest() returns nullptr when it loses a race for the oldest closure,
+// even if the queue is not empty.
+//
+// The ring buffer doubles when it is full. Replaced buffers are only freed
+// with the queue, since stealing threads may still be reading from them.
+class ChaseLevWorkQueue : public WorkQueue {
+ public:
+  ChaseLevWorkQueue() : ChaseLevWorkQueue(nullptr) {}
+  explicit ChaseLevWorkQueue(void* owner);
+  ~ChaseLevWorkQueue() override;
+  // Returns whether the queue is empty.
+  bool Empty() const override;
+  // Returns the size of the queue.
+  size_t Size() const override;
+  // Returns the most recent element from the queue, or nullptr if it is
+  // empty. Must only be called from the thread that adds closures.
+  EventEngine::Closure* PopMostRecent() override;
+  // Returns the oldest element from the queue, or nullptr if either empty
+  // or another thread took it first.
+  EventEngine::Closure* PopOldest() override;
+  // Adds a closure to the queue. Must only be called from the thread that
+  // pops the most recent closures.
+  void Add(EventEngine::Closure* closure) override;
+  // Wraps an AnyInvocable and adds it to the the queue.
+  void Add(absl::AnyInvocable<void()> invocable) override;
+  const void* owner() override { return owner_; }
+
+ private:
+  class Buffer;
+
+  // The next slot stolen from. Only ever increases.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> top_{0};
+  // The next slot written by the owner.
+  alignas(GPR_CACHELINE_SIZE) std::atomic<int64_t> bottom_{0};
+  std::atomic<Buffer*> buffer_;
+  // Every buffer allocated so far, including the current one. Owner only.
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+  const void* const owner_;
+};
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_SRC_CORE_LIB_EVENT_ENGINE_WORK_QUEUE_CHASE_LEV_WORK_QUEUE_H
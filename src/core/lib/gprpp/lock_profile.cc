@@ -0,0 +1,159 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/gprpp/lock_profile.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+
+namespace grpc_core {
+
+namespace {
+
+struct Registry {
+  Mutex mu;
+  std::vector<LockProfile*> profiles ABSL_GUARDED_BY(mu);
+};
+
+Registry* GetRegistry() {
+  static NoDestruct<Registry> registry;
+  return registry.get();
+}
+
+// Acquisitions left on this thread until the next sampled one.
+thread_local uint32_t g_acquisitions_until_sample = 0;
+
+int64_t Nanos(std::chrono::steady_clock::duration d) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+}
+
+}  // namespace
+
+std::atomic<uint32_t> LockProfile::sampling_period_{
+    LockProfile::kPeriodUnset};
+
+LockProfile::LockProfile(const char* name)
+    : name_(name)
+#ifdef GRPC_ENABLE_LATENT_SEE
+      ,
+      wait_metadata_{__FILE__, __LINE__, name}
+#endif
+{
+  Registry* registry = GetRegistry();
+  MutexLock lock(&registry->mu);
+  registry->profiles.push_back(this);
+}
+
+void LockProfile::SetSamplingPeriod(uint32_t period) {
+  sampling_period_.store(period, std::memory_order_relaxed);
+}
+
+bool LockProfile::ShouldSampleSlow(uint32_t period) {
+  if (period == kPeriodUnset) {
+    // Config vars may not be loaded when the first locks are taken, so they
+    // are only consulted here.
+    const int32_t configured = ConfigVars::Get().LockProfilingPeriod();
+    period = configured > 0 ? static_cast<uint32_t>(configured) : 0;
+    uint32_t expected = kPeriodUnset;
+    sampling_period_.compare_exchange_strong(expected, period,
+                                             std::memory_order_relaxed);
+    if (period == 0) return false;
+  }
+  if (g_acquisitions_until_sample > 0) {
+    --g_acquisitions_until_sample;
+    return false;
+  }
+  g_acquisitions_until_sample = period - 1;
+  return true;
+}
+
+std::chrono::steady_clock::time_point LockProfile::Lock(Mutex* mu) {
+  const auto start = std::chrono::steady_clock::now();
+  if (mu->TryLock()) {
+    samples_.fetch_add(1, std::memory_order_relaxed);
+    return start;
+  }
+#ifdef GRPC_ENABLE_LATENT_SEE
+  latent_see::Log::Append(&wait_metadata_, latent_see::EventType::kBegin, 0);
+#endif
+  mu->Lock();
+  const auto acquired = std::chrono::steady_clock::now();
+#ifdef GRPC_ENABLE_LATENT_SEE
+  latent_see::Log::Append(&wait_metadata_, latent_see::EventType::kEnd, 0);
+#endif
+  const int64_t wait_ns = Nanos(acquired - start);
+  samples_.fetch_add(1, std::memory_order_relaxed);
+  contended_.fetch_add(1, std::memory_order_relaxed);
+  total_wait_ns_.fetch_add(wait_ns, std::memory_order_relaxed);
+  int64_t max_wait_ns = max_wait_ns_.load(std::memory_order_relaxed);
+  while (wait_ns > max_wait_ns &&
+         !max_wait_ns_.compare_exchange_weak(max_wait_ns, wait_ns,
+                                             std::memory_order_relaxed)) {
+  }
+  return acquired;
+}
+
+void LockProfile::RecordHold(std::chrono::steady_clock::time_point acquired) {
+  total_hold_ns_.fetch_add(Nanos(std::chrono::steady_clock::now() - acquired),
+                           std::memory_order_relaxed);
+}
+
+LockProfile::Stats LockProfile::GetStats() const {
+  return Stats{
+      name_,
+      samples_.load(std::memory_order_relaxed),
+      contended_.load(std::memory_order_relaxed),
+      std::chrono::nanoseconds(total_wait_ns_.load(std::memory_order_relaxed)),
+      std::chrono::nanoseconds(max_wait_ns_.load(std::memory_order_relaxed)),
+      std::chrono::nanoseconds(total_hold_ns_.load(std::memory_order_relaxed)),
+  };
+}
+
+std::vector<LockProfile::Stats> LockProfile::TopContended(size_t max_results) {
+  std::vector<Stats> result;
+  {
+    Registry* registry = GetRegistry();
+    MutexLock lock(&registry->mu);
+    for (const LockProfile* profile : registry->profiles) {
+      Stats stats = profile->GetStats();
+      if (stats.samples != 0) result.push_back(std::move(stats));
+    }
+  }
+  std::sort(result.begin(), result.end(), [](const Stats& a, const Stats& b) {
+    return a.total_wait > b.total_wait;
+  });
+  if (result.size() > max_results) result.resize(max_results);
+  return result;
+}
+
+std::string LockProfile::TopContendedToString(size_t max_results) {
+  std::string result;
+  for (const Stats& stats : TopContended(max_results)) {
+    absl::StrAppend(&result, stats.name, ": samples=", stats.samples,
+                    " contended=", stats.contended,
+                    " total_wait_us=", stats.total_wait.count() / 1000,
+                    " max_wait_us=", stats.max_wait.count() / 1000,
+                    " total_hold_us=", stats.total_hold.count() / 1000, "\n");
+  }
+  return result;
+}
+
+}  // namespace grpc_core
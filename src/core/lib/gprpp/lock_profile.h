@@ -0,0 +1,145 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_GPRPP_LOCK_PROFILE_H
+#define GRPC_SRC_CORE_LIB_GPRPP_LOCK_PROFILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/util/latent_see.h"
+
+namespace grpc_core {
+
+// Contention accounting for a named lock.
+//
+// A lock opts in by being taken through a ProfiledMutexLock that names its
+// LockProfile, which is defined once next to the lock:
+//
+//   LockProfile* ServerCallLockProfile() {
+//     static LockProfile* profile = new LockProfile("server.mu_call");
+//     return profile;
+//   }
+//   ...
+//   ProfiledMutexLock lock(&mu_call_, ServerCallLockProfile());
+//
+// Profiling is off unless the GRPC_LOCK_PROFILING_PERIOD config var (or
+// SetSamplingPeriod()) is positive, and then one in that many acquisitions
+// on each thread records how long it waited for the lock and how long it
+// held it. Otherwise taking the lock costs one relaxed load more than a
+// MutexLock.
+class LockProfile {
+ public:
+  struct Stats {
+    std::string name;
+    // Acquisitions sampled, and how many of those found the lock held.
+    uint64_t samples;
+    uint64_t contended;
+    // Over the sampled acquisitions.
+    std::chrono::nanoseconds total_wait;
+    std::chrono::nanoseconds max_wait;
+    std::chrono::nanoseconds total_hold;
+  };
+
+  // Profiles live as long as the process: they are registered for
+  // TopContended() and never unregistered.
+  explicit LockProfile(const char* name);
+
+  LockProfile(const LockProfile&) = delete;
+  LockProfile& operator=(const LockProfile&) = delete;
+
+  // Overrides GRPC_LOCK_PROFILING_PERIOD; zero disables profiling.
+  static void SetSamplingPeriod(uint32_t period);
+
+  // The \a max_results profiles that waited longest in total, with their
+  // names, most contended first. Profiles never sampled are left out.
+  static std::vector<Stats> TopContended(size_t max_results);
+
+  // Human readable form of TopContended(), one lock per line.
+  static std::string TopContendedToString(size_t max_results);
+
+  Stats GetStats() const;
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static bool ShouldSample() {
+    const uint32_t period = sampling_period_.load(std::memory_order_relaxed);
+    if (GPR_LIKELY(period == 0)) return false;
+    return ShouldSampleSlow(period);
+  }
+
+ private:
+  friend class ProfiledMutexLock;
+
+  static constexpr uint32_t kPeriodUnset = ~uint32_t{0};
+
+  static bool ShouldSampleSlow(uint32_t period);
+
+  // Takes \a mu, recording how long that took; returns when it was acquired.
+  std::chrono::steady_clock::time_point Lock(Mutex* mu)
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mu);
+  void RecordHold(std::chrono::steady_clock::time_point acquired);
+
+  static std::atomic<uint32_t> sampling_period_;
+
+  const char* const name_;
+  std::atomic<uint64_t> samples_{0};
+  std::atomic<uint64_t> contended_{0};
+  std::atomic<int64_t> total_wait_ns_{0};
+  std::atomic<int64_t> max_wait_ns_{0};
+  std::atomic<int64_t> total_hold_ns_{0};
+#ifdef GRPC_ENABLE_LATENT_SEE
+  // Contended waits show up in latent_see traces under the lock's name.
+  latent_see::Metadata wait_metadata_;
+#endif
+};
+
+// A MutexLock whose acquisitions are sampled into \a profile.
+class ABSL_SCOPED_LOCKABLE ProfiledMutexLock {
+ public:
+  ProfiledMutexLock(Mutex* mu, LockProfile* profile)
+      ABSL_EXCLUSIVE_LOCK_FUNCTION(mu)
+      : mu_(mu) {
+    if (GPR_LIKELY(!LockProfile::ShouldSample())) {
+      mu_->Lock();
+      return;
+    }
+    profile_ = profile;
+    acquired_ = profile_->Lock(mu_);
+  }
+  ~ProfiledMutexLock() ABSL_UNLOCK_FUNCTION() {
+    if (GPR_UNLIKELY(profile_ != nullptr)) profile_->RecordHold(acquired_);
+    mu_->Unlock();
+  }
+
+  ProfiledMutexLock(const ProfiledMutexLock&) = delete;
+  ProfiledMutexLock& operator=(const ProfiledMutexLock&) = delete;
+
+ private:
+  Mutex* const mu_;
+  LockProfile* profile_ = nullptr;
+  std::chrono::steady_clock::time_point acquired_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_GPRPP_LOCK_PROFILE_H
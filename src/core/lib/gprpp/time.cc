@@ -37,11 +37,30 @@ namespace {
 
 std::atomic<int64_t> g_process_epoch_seconds;
 std::atomic<gpr_cycle_counter> g_process_epoch_cycles;
+// The latest time read from the system clock by any thread, in milliseconds
+// after the process epoch, or 0 before the first read.
+std::atomic<int64_t> g_coarse_now_millis{0};
 
 class GprNowTimeSource final : public Timestamp::Source {
  public:
   Timestamp Now() override {
-    return Timestamp::FromTimespecRoundDown(gpr_now(GPR_CLOCK_MONOTONIC));
+    const Timestamp now =
+        Timestamp::FromTimespecRoundDown(gpr_now(GPR_CLOCK_MONOTONIC));
+    // Only written when the millisecond changes, so readers on other cores
+    // mostly share the cache line.
+    const int64_t millis = now.milliseconds_after_process_epoch();
+    int64_t coarse = g_coarse_now_millis.load(std::memory_order_relaxed);
+    while (coarse < millis && !g_coarse_now_millis.compare_exchange_weak(
+                                  coarse, millis, std::memory_order_relaxed,
+                                  std::memory_order_relaxed)) {
+    }
+    return now;
+  }
+
+  Timestamp NowCoarse() override {
+    const int64_t millis = g_coarse_now_millis.load(std::memory_order_relaxed);
+    if (GPR_UNLIKELY(millis == 0)) return Now();
+    return Timestamp::FromMillisecondsAfterProcessEpoch(millis);
   }
 };
 
@@ -151,6 +170,10 @@ int64_t TimespanToMillisRoundDown(gpr_timespec ts) {
 thread_local Timestamp::Source* Timestamp::thread_local_time_source_{
     NoDestructSingleton<GprNowTimeSource>::Get()};
 
+void Timestamp::RefreshCoarseNow() {
+  NoDestructSingleton<GprNowTimeSource>::Get()->Now();
+}
+
 Timestamp ScopedTimeCache::Now() {
   if (!cached_time_.has_value()) {
     previous()->InvalidateCache();
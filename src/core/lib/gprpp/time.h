@@ -80,6 +80,8 @@ class Timestamp {
    public:
     // Return the current time.
     virtual Timestamp Now() = 0;
+    // Return the current time, possibly a few milliseconds stale.
+    virtual Timestamp NowCoarse() { return Now(); }
     virtual void InvalidateCache() {}
 
    protected:
@@ -115,6 +117,19 @@ class Timestamp {
 
   static Timestamp Now() { return thread_local_time_source_->Now(); }
 
+  // Like Now(), but when no time is cached it returns the latest time any
+  // thread in the process read from the system clock instead of reading it
+  // again. Pollers refresh that time when they wake up with events, so on a
+  // busy process it trails the real time by at most a few milliseconds, and
+  // reading it is a single relaxed atomic load. Suitable for queue ages, load
+  // estimates and similar bookkeeping; use Now() to arm timers and to compute
+  // deadlines.
+  static Timestamp NowCoarse() {
+    return thread_local_time_source_->NowCoarse();
+  }
+  // Reads the system clock to refresh the time returned by NowCoarse().
+  static void RefreshCoarseNow();
+
   static constexpr Timestamp FromMillisecondsAfterProcessEpoch(int64_t millis) {
     return Timestamp(millis);
   }
@@ -172,6 +187,10 @@ class Timestamp {
 class ScopedTimeCache final : public Timestamp::ScopedSource {
  public:
   Timestamp Now() override;
+  Timestamp NowCoarse() override {
+    if (cached_time_.has_value()) return *cached_time_;
+    return previous()->NowCoarse();
+  }
 
   void InvalidateCache() override {
     cached_time_ = absl::nullopt;
@@ -33,9 +33,11 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/lock_profile.h"
 #include "src/core/lib/gprpp/mpscq.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -284,6 +286,12 @@ void WorkSerializer::LegacyWorkSerializer::DrainQueueOwned() {
 // implementations are not starved of threads by long running work
 // serializers. We implement EventEngine::Closure directly to avoid allocating
 // once per callback in the queue when scheduling.
+//
+// With the work_serializer_drain_budget_us config var set, each dispatch
+// instead runs queued callbacks back to back until the budget (or
+// kMaxItemsPerDrain callbacks) is used up, which saves a thread hop per
+// callback when the queue is long, while still bounding how long a thread is
+// held.
 class WorkSerializer::DispatchingWorkSerializer final
     : public WorkSerializerImpl,
       public grpc_event_engine::experimental::EventEngine::Closure {
@@ -291,7 +299,9 @@ class WorkSerializer::DispatchingWorkSerializer final
   explicit DispatchingWorkSerializer(
       std::shared_ptr<grpc_event_engine::experimental::EventEngine>
           event_engine)
-      : event_engine_(std::move(event_engine)) {}
+      : event_engine_(std::move(event_engine)),
+        drain_budget_(std::chrono::microseconds(std::max<int32_t>(
+            0, ConfigVars::Get().WorkSerializerDrainBudgetUs()))) {}
   void Run(std::function<void()> callback,
            const DebugLocation& location) override;
   void Schedule(std::function<void()> callback,
@@ -313,13 +323,19 @@ class WorkSerializer::DispatchingWorkSerializer final
 #endif
 
  private:
+  // Most callbacks run by a single dispatch when draining with a budget.
+  static constexpr uint64_t kMaxItemsPerDrain = 64;
+
   // Wrapper to capture DebugLocation for the callback.
   struct CallbackWrapper {
     CallbackWrapper(std::function<void()> cb, const DebugLocation& loc)
-        : callback(std::move(cb)), location(loc) {}
+        : callback(std::move(cb)),
+          location(loc),
+          enqueue_time(std::chrono::steady_clock::now()) {}
     std::function<void()> callback;
     // GPR_NO_UNIQUE_ADDRESS means this is 0 sized in release builds.
     GPR_NO_UNIQUE_ADDRESS DebugLocation location;
+    std::chrono::steady_clock::time_point enqueue_time;
   };
   using CallbackVector = absl::InlinedVector<CallbackWrapper, 1>;
 
@@ -356,6 +372,9 @@ class WorkSerializer::DispatchingWorkSerializer final
   // EventEngine instance upon which we'll do our work.
   const std::shared_ptr<grpc_event_engine::experimental::EventEngine>
       event_engine_;
+  // How long a single dispatch may keep running callbacks for; zero to run
+  // only one.
+  const std::chrono::steady_clock::duration drain_budget_;
   std::chrono::steady_clock::time_point running_start_time_
       ABSL_GUARDED_BY(mu_);
   std::chrono::steady_clock::duration time_running_items_;
@@ -390,6 +409,14 @@ thread_local WorkSerializer::DispatchingWorkSerializer*
         nullptr;
 #endif
 
+namespace {
+// Shared by all DispatchingWorkSerializer instances.
+LockProfile* DispatchingWorkSerializerLockProfile() {
+  static LockProfile* profile = new LockProfile("work_serializer.mu");
+  return profile;
+}
+}  // namespace
+
 void WorkSerializer::DispatchingWorkSerializer::Orphan() {
   ReleasableMutexLock lock(&mu_);
   // If we're not running, then we can delete immediately.
@@ -410,7 +437,7 @@ void WorkSerializer::DispatchingWorkSerializer::Run(
               << location.file() << ":" << location.line() << "]";
   }
   global_stats().IncrementWorkSerializerItemsEnqueued();
-  MutexLock lock(&mu_);
+  ProfiledMutexLock lock(&mu_, DispatchingWorkSerializerLockProfile());
   if (!running_) {
     // If we were previously idle, insert this callback directly into the
     // empty processing_ list and start running.
@@ -435,30 +462,48 @@ void WorkSerializer::DispatchingWorkSerializer::Run() {
   // TODO(ctiller): remove these when we can deprecate ExecCtx
   ApplicationCallbackExecCtx app_exec_ctx;
   ExecCtx exec_ctx;
-  // Grab the last element of processing_ - which is the next item in our
-  // queue since processing_ is stored in reverse order.
-  auto& cb = processing_.back();
-  if (GRPC_TRACE_FLAG_ENABLED(work_serializer)) {
-    LOG(INFO) << "WorkSerializer[" << this << "] Executing callback ["
-              << cb.location.file() << ":" << cb.location.line() << "]";
+  const auto drain_start = std::chrono::steady_clock::now();
+  auto start = drain_start;
+  for (uint64_t items_this_drain = 1;; ++items_this_drain) {
+    // Grab the last element of processing_ - which is the next item in our
+    // queue since processing_ is stored in reverse order.
+    auto& cb = processing_.back();
+    if (GRPC_TRACE_FLAG_ENABLED(work_serializer)) {
+      LOG(INFO) << "WorkSerializer[" << this << "] Executing callback ["
+                << cb.location.file() << ":" << cb.location.line() << "]";
+    }
+    global_stats().IncrementWorkSerializerQueueDelayUs(
+        std::chrono::duration_cast<std::chrono::microseconds>(start -
+                                                              cb.enqueue_time)
+            .count());
+    // Run the work item.
+    SetCurrentThread();
+    cb.callback();
+    // pop_back here destroys the callback - freeing any resources it might
+    // hold. We do so before clearing the current thread in case the callback
+    // destructor wants to check that it's in the WorkSerializer too.
+    processing_.pop_back();
+    ClearCurrentThread();
+    global_stats().IncrementWorkSerializerItemsDequeued();
+    const auto end = std::chrono::steady_clock::now();
+    const auto work_time = end - start;
+    global_stats().IncrementWorkSerializerWorkTimePerItemMs(
+        std::chrono::duration_cast<std::chrono::milliseconds>(work_time)
+            .count());
+    time_running_items_ += work_time;
+    ++items_processed_during_run_;
+    // Check if we've drained the queue and if so refill it.
+    if (processing_.empty() && !Refill()) return;
+    if (items_this_drain >= kMaxItemsPerDrain ||
+        end - drain_start >= drain_budget_) {
+      break;
+    }
+    // Give the next callback what it would have had in a dispatch of its
+    // own: the closures scheduled so far run first, and a fresh time cache.
+    exec_ctx.Flush();
+    exec_ctx.InvalidateNow();
+    start = std::chrono::steady_clock::now();
   }
-  // Run the work item.
-  const auto start = std::chrono::steady_clock::now();
-  SetCurrentThread();
-  cb.callback();
-  // pop_back here destroys the callback - freeing any resources it might
-  // hold. We do so before clearing the current thread in case the callback
-  // destructor wants to check that it's in the WorkSerializer too.
-  processing_.pop_back();
-  ClearCurrentThread();
-  global_stats().IncrementWorkSerializerItemsDequeued();
-  const auto work_time = std::chrono::steady_clock::now() - start;
-  global_stats().IncrementWorkSerializerWorkTimePerItemMs(
-      std::chrono::duration_cast<std::chrono::milliseconds>(work_time).count());
-  time_running_items_ += work_time;
-  ++items_processed_during_run_;
-  // Check if we've drained the queue and if so refill it.
-  if (processing_.empty() && !Refill()) return;
   // There's still work in processing_, so schedule ourselves again on
   // EventEngine.
   flow_.Begin(GRPC_LATENT_SEE_METADATA("WorkSerializer::Link"));
@@ -470,7 +515,7 @@ WorkSerializer::DispatchingWorkSerializer::RefillInner() {
   // Recover any memory held by processing_, so that we don't grow forever.
   // Do so before acquiring a lock so we don't cause inadvertent contention.
   processing_.shrink_to_fit();
-  MutexLock lock(&mu_);
+  ProfiledMutexLock lock(&mu_, DispatchingWorkSerializerLockProfile());
   // Swap incoming_ into processing_ - effectively lets us release memory
   // (outside the lock) once per iteration for the storage vectors.
   processing_.swap(incoming_);
@@ -494,6 +539,7 @@ WorkSerializer::DispatchingWorkSerializer::RefillInner() {
       return RefillResult::kFinished;
     }
   }
+  global_stats().IncrementWorkSerializerQueueLength(processing_.size());
   return RefillResult::kRefilled;
 }
 
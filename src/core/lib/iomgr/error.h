@@ -118,6 +118,16 @@ bool grpc_error_get_str(grpc_error_handle error,
 grpc_error_handle grpc_error_add_child(grpc_error_handle src,
                                        grpc_error_handle child);
 
+/// Whether errors raised for each failed call or stream should record their
+/// causes as children, and their own creation time, even where one cause
+/// could be passed through as is or a shared error used instead. Recording
+/// them serializes the children for every call failed by a mass
+/// cancellation, deadline expiry or GOAWAY, so it is only done while the
+/// call_error tracer is on.
+inline bool grpc_error_detail_enabled() {
+  return GRPC_TRACE_FLAG_ENABLED(call_error);
+}
+
 bool grpc_log_error(const char* what, grpc_error_handle error, const char* file,
                     int line);
 inline bool grpc_log_if_error(const char* what, grpc_error_handle error,
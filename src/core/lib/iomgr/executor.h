@@ -19,26 +19,22 @@
 #ifndef GRPC_SRC_CORE_LIB_IOMGR_EXECUTOR_H
 #define GRPC_SRC_CORE_LIB_IOMGR_EXECUTOR_H
 
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+
+#include "absl/base/thread_annotations.h"
+
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/support/port_platform.h>
 
-#include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/event_engine/extensions/run_with_priority.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/closure.h"
-#include "src/core/util/spinlock.h"
 
 namespace grpc_core {
 
-struct ThreadState {
-  gpr_mu mu;
-  size_t id;         // For debugging purposes
-  const char* name;  // Thread state name
-  gpr_cv cv;
-  grpc_closure_list elems;
-  size_t depth;  // Number of closures in the closure list
-  bool shutdown;
-  bool queued_long_job;
-  Thread thd;
-};
-
 enum class ExecutorType {
   DEFAULT = 0,
   RESOLVER,
@@ -52,9 +48,17 @@ enum class ExecutorJobType {
   NUM_JOB_TYPES  // Add new values above this
 };
 
+// Runs iomgr closures that must not run on the calling thread (blocking DNS
+// resolution, backup pollers, completion queue callbacks) on the threads of
+// the default EventEngine, so that processes have a single pool of worker
+// threads. RESOLVER closures are run at low priority, so that blocking
+// resolutions yield to the work RPCs are waiting on.
 class Executor {
  public:
-  explicit Executor(const char* executor_name);
+  using Priority = grpc_event_engine::experimental::
+      EventEngineRunWithPriorityExtension::Priority;
+
+  Executor(const char* executor_name, Priority priority);
 
   void Init();
 
@@ -72,14 +76,6 @@ class Executor {
   /// a short job (i.e expected to not block and complete quickly)
   void Enqueue(grpc_closure* closure, grpc_error_handle error, bool is_short);
 
-  // TODO(sreek): Currently we have two executors (available globally): The
-  // default executor and the resolver executor.
-  //
-  // Some of the functions below operate on the DEFAULT executor only while some
-  // operate of ALL the executors. This is a bit confusing and should be cleaned
-  // up in future (where we make all the following functions take ExecutorType
-  // and/or JobType)
-
   // Initialize ALL the executors
   static void InitAll();
 
@@ -104,14 +100,30 @@ class Executor {
   static bool IsThreadedDefault();
 
  private:
-  static size_t RunClosures(const char* executor_name, grpc_closure_list list);
-  static void ThreadMain(void* arg);
-
-  const char* name_;
-  ThreadState* thd_state_;
-  size_t max_threads_;
-  gpr_atm num_threads_;
-  gpr_spinlock adding_thread_lock_;
+  // Shared with the EventEngine tasks, which may outlive the executor.
+  struct State {
+    Mutex mu;
+    CondVar cv;
+    // Set while threaded.
+    std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine
+        ABSL_GUARDED_BY(mu);
+    // Closures handed to the executor that no EventEngine task has taken
+    // yet. Each closure is followed by one task, which runs the first closure
+    // still queued, if any.
+    grpc_closure_list closures ABSL_GUARDED_BY(mu) = GRPC_CLOSURE_LIST_INIT;
+    // Closures taken by tasks that have not finished running.
+    size_t running ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  void RunClosure(grpc_closure* closure, grpc_error_handle error);
+  // Runs the next queued closure of state on executor, which is only used
+  // when there is one.
+  static void RunNext(Executor* executor, const std::shared_ptr<State>& state);
+
+  const char* const name_;
+  const Priority priority_;
+  std::atomic<bool> threaded_{false};
+  const std::shared_ptr<State> state_ = std::make_shared<State>();
 };
 
 }  // namespace grpc_core
@@ -63,6 +63,14 @@
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
+// io_uring with IORING_FEAT_EXT_ARG; availability is still checked at runtime.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 11, 0)
+#define GRPC_LINUX_IO_URING 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(5, 11, 0)
+// Multishot receive into a registered buffer ring.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 0, 0)
+#define GRPC_LINUX_IO_URING_RECV_MULTISHOT 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(6, 0, 0)
 #endif  // LINUX_VERSION_CODE
 #if defined(LINUX_VERSION_CODE) && defined(__GLIBC_PREREQ)
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 9, 0) && __GLIBC_PREREQ(2, 18)
@@ -85,6 +93,9 @@
 #if __GLIBC_PREREQ(2, 10)
 #define GRPC_LINUX_SOCKETUTILS 1
 #endif
+#if __GLIBC_PREREQ(2, 27)
+#define GRPC_LINUX_MEMFD 1
+#endif
 #if !(__GLIBC_PREREQ(2, 18))
 //
 // TCP_USER_TIMEOUT wasn't imported to glibc until 2.18. Use Linux system
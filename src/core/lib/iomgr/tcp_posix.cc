@@ -1094,15 +1094,15 @@ static void maybe_make_read_slices(grpc_tcp* tcp)
   static const int kSmallAlloc = 8 * 1024;
   if (tcp->incoming_buffer->length <
       std::max<size_t>(tcp->min_progress_size, 1)) {
-    size_t allocate_length = tcp->min_progress_size;
-    const size_t target_length = static_cast<size_t>(tcp->target_length);
-    // If memory pressure is low and we think there will be more than
-    // min_progress_size bytes to read, allocate a bit more.
+    // If we think there will be more than min_progress_size bytes to read,
+    // allocate a bit more, less so as memory pressure rises.
+    const double memory_pressure =
+        tcp->memory_owner.GetPressureInfo().pressure_control_value;
     const bool low_memory_pressure =
-        tcp->memory_owner.GetPressureInfo().pressure_control_value < 0.8;
-    if (low_memory_pressure && target_length > allocate_length) {
-      allocate_length = target_length;
-    }
+        memory_pressure < grpc_core::kReadBufferHighMemoryPressure;
+    const size_t allocate_length = grpc_core::ReadBufferSizeForMemoryPressure(
+        tcp->min_progress_size, static_cast<size_t>(tcp->target_length),
+        memory_pressure);
     int extra_wanted = std::max<int>(
         1, allocate_length - static_cast<int>(tcp->incoming_buffer->length));
     if (extra_wanted >=
@@ -1960,7 +1960,7 @@ grpc_endpoint* grpc_tcp_create(grpc_fd* em_fd,
   tcp->fd = grpc_fd_wrapped_fd(em_fd);
   CHECK(options.resource_quota != nullptr);
   tcp->memory_owner =
-      options.resource_quota->memory_quota()->CreateMemoryOwner();
+      options.resource_quota->memory_quota()->CreateMemoryOwner("endpoint");
   tcp->self_reservation = tcp->memory_owner.MakeReservation(sizeof(grpc_tcp));
   grpc_resolved_address resolved_local_addr;
   memset(&resolved_local_addr, 0, sizeof(resolved_local_addr));
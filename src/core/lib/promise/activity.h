@@ -50,7 +50,7 @@ class Activity;
 
 // WakeupMask is a bitfield representing which parts of an activity should be
 // woken up.
-using WakeupMask = uint16_t;
+using WakeupMask = uint32_t;
 
 // A Wakeable object is used by queues to wake activities.
 class Wakeable {
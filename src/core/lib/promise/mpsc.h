@@ -18,6 +18,7 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <utility>
@@ -44,80 +45,181 @@ namespace mpscpipe_detail {
 
 // "Center" of the communication pipe.
 // Contains sent but not received messages, and open/close state.
+//
+// Sent items are pushed onto a lock-free stack, which the receiver takes as a
+// whole each time it polls. The head
+// of the stack doubles as the receiver's state: besides a list of items it may
+// say that the queue is empty and the receiver is waiting (an odd value, which
+// carries the number of the receiver's waker), or that the receiver is closed.
+//
+// The mutex is only taken off the fast path: by the receiver when it has to
+// wait, by the sender that then wakes it, and by senders that are over the
+// max_queued watermark and have to wait for the receiver to catch up.
 template <typename T>
 class Center : public RefCounted<Center<T>> {
  public:
   // Construct the center with a maximum queue size.
   explicit Center(size_t max_queued) : max_queued_(max_queued) {}
 
+  ~Center() { DeleteNodes(head_.load(std::memory_order_acquire)); }
+
   static constexpr const uint64_t kClosedBatch =
       std::numeric_limits<uint64_t>::max();
 
   // Poll for new items.
-  // - Returns true if new items were obtained, in which case they are contained
-  //   in dest in the order they were added. Wakes up all pending senders since
-  //   there will now be space to send.
-  // - If no new items are available, returns
-  //   false and sets up a waker to be awoken when more items are available.
-  // TODO(ctiller): consider the problem of thundering herds here. There may be
-  // more senders than there are queue spots, and so the strategy of waking up
-  // all senders is ill-advised.
-  // That said, some senders may have been cancelled by the time we wake them,
-  // and so waking a subset could cause starvation.
+  // - Returns true if new items were obtained, in which case they replace the
+  //   contents of dest, in the order they were added. Wakes up the senders
+  //   waiting for space, since there now is some.
+  // - If no new items are available, returns false and sets up a waker to be
+  //   awoken when more items are available.
   bool PollReceiveBatch(std::vector<T>& dest) {
-    ReleasableMutexLock lock(&mu_);
-    if (queue_.empty()) {
+    uintptr_t head = head_.load(std::memory_order_acquire);
+    while (true) {
+      if (head == kClosed) return false;
+      if (IsReceiverWaiting(head)) {
+        // Still waiting from a previous poll: wait afresh.
+        if (!head_.compare_exchange_weak(head, kEmpty,
+                                         std::memory_order_acquire)) {
+          continue;
+        }
+        head = kEmpty;
+      }
+      if (head != kEmpty) break;
+      ReleasableMutexLock lock(&mu_);
       receive_waker_ = GetContext<Activity>()->MakeNonOwningWaker();
-      return false;
+      receive_waker_number_ += 2;
+      if (head_.compare_exchange_strong(head, receive_waker_number_,
+                                        std::memory_order_acq_rel)) {
+        return false;
+      }
+      lock.Release();
     }
-    dest.swap(queue_);
-    queue_.clear();
-    if (batch_ != kClosedBatch) ++batch_;
-    auto wakeups = send_wakers_.TakeWakeupSet();
-    lock.Release();
-    wakeups.Wakeup();
+    // Only the receiver leaves the list state, so this takes a list of items.
+    Node* node = ToNode(head_.exchange(kEmpty, std::memory_order_acquire));
+    // Reverse the list, to take the items in the order they were sent.
+    Node* oldest = nullptr;
+    size_t n = 0;
+    while (node != nullptr) {
+      oldest = std::exchange(node, std::exchange(node->next, oldest));
+      ++n;
+    }
+    dest.clear();
+    dest.reserve(n);
+    while (oldest != nullptr) {
+      dest.push_back(std::move(oldest->value));
+      delete std::exchange(oldest, oldest->next);
+    }
+    queued_.fetch_sub(n, std::memory_order_relaxed);
+    if (batch_.load(std::memory_order_relaxed) != kClosedBatch) {
+      batch_.fetch_add(1, std::memory_order_seq_cst);
+    }
+    WakeupSenders();
     return true;
   }
 
   // Returns the batch number that the item was sent in, or kClosedBatch if the
   // pipe is closed.
   uint64_t Send(T t) {
-    ReleasableMutexLock lock(&mu_);
-    if (batch_ == kClosedBatch) return kClosedBatch;
-    queue_.push_back(std::move(t));
-    auto receive_waker = std::move(receive_waker_);
-    const uint64_t batch = queue_.size() <= max_queued_ ? batch_ : batch_ + 1;
-    lock.Release();
-    receive_waker.Wakeup();
-    return batch;
+    // Read the batch number before pushing: if the receiver takes the batch in
+    // between, the sender at worst stops waiting one batch early.
+    const uint64_t batch = batch_.load(std::memory_order_acquire);
+    if (batch == kClosedBatch) return kClosedBatch;
+    const size_t queued = queued_.fetch_add(1, std::memory_order_relaxed) + 1;
+    Node* node = new Node{std::move(t), nullptr};
+    uintptr_t head = head_.load(std::memory_order_relaxed);
+    do {
+      if (head == kClosed) {
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        delete node;
+        return kClosedBatch;
+      }
+      node->next = IsReceiverWaiting(head) ? nullptr : ToNode(head);
+    } while (!head_.compare_exchange_weak(
+        head, reinterpret_cast<uintptr_t>(node), std::memory_order_acq_rel,
+        std::memory_order_relaxed));
+    if (IsReceiverWaiting(head)) WakeupReceiver(head);
+    return queued <= max_queued_ ? batch : batch + 1;
   }
 
   // Poll until a particular batch number is received.
   Poll<Empty> PollReceiveBatch(uint64_t batch) {
-    ReleasableMutexLock lock(&mu_);
-    if (batch_ >= batch) return Empty{};
+    if (batch_.load(std::memory_order_acquire) >= batch) return Empty{};
+    MutexLock lock(&mu_);
+    // Pairs with the receiver bumping batch_ before checking senders_waiting_:
+    // either it sees us waiting, or we see the new batch.
+    senders_waiting_.store(true, std::memory_order_seq_cst);
+    if (batch_.load(std::memory_order_seq_cst) >= batch) return Empty{};
     send_wakers_.AddPending(GetContext<Activity>()->MakeNonOwningWaker());
     return Pending{};
   }
 
   // Mark that the receiver is closed.
   void ReceiverClosed() {
+    if (batch_.exchange(kClosedBatch, std::memory_order_seq_cst) ==
+        kClosedBatch) {
+      return;
+    }
+    DeleteNodes(head_.exchange(kClosed, std::memory_order_acq_rel));
     ReleasableMutexLock lock(&mu_);
-    if (batch_ == kClosedBatch) return;
-    batch_ = kClosedBatch;
+    Waker receive_waker = std::move(receive_waker_);
+    senders_waiting_.store(false, std::memory_order_relaxed);
     auto wakeups = send_wakers_.TakeWakeupSet();
     lock.Release();
     wakeups.Wakeup();
   }
 
  private:
-  Mutex mu_;
+  struct Node {
+    T value;
+    Node* next;
+  };
+
+  // Values of head_ other than lists of nodes.
+  static constexpr uintptr_t kEmpty = 0;
+  static constexpr uintptr_t kClosed = 2;
+  static bool IsReceiverWaiting(uintptr_t head) { return (head & 1) != 0; }
+
+  static Node* ToNode(uintptr_t head) { return reinterpret_cast<Node*>(head); }
+
+  static void DeleteNodes(uintptr_t head) {
+    if (head == kClosed || IsReceiverWaiting(head)) return;
+    Node* node = ToNode(head);
+    while (node != nullptr) delete std::exchange(node, node->next);
+  }
+
+  // Called by the sender that replaced the receiver's waiting state.
+  void WakeupReceiver(uintptr_t waker_number) {
+    ReleasableMutexLock lock(&mu_);
+    // If the receiver has since waited again, it saw our item: the waker now
+    // belongs to whoever ends that wait.
+    if (receive_waker_number_ != waker_number) return;
+    Waker waker = std::move(receive_waker_);
+    lock.Release();
+    waker.Wakeup();
+  }
+
+  void WakeupSenders() {
+    if (!senders_waiting_.load(std::memory_order_seq_cst)) return;
+    ReleasableMutexLock lock(&mu_);
+    senders_waiting_.store(false, std::memory_order_relaxed);
+    auto wakeups = send_wakers_.TakeWakeupSet();
+    lock.Release();
+    wakeups.Wakeup();
+  }
+
   const size_t max_queued_;
-  std::vector<T> queue_ ABSL_GUARDED_BY(mu_);
-  // Every time we give queue_ to the receiver, we increment batch_.
+  // Sent items not yet received, newest first, or one of the states above.
+  std::atomic<uintptr_t> head_{kEmpty};
+  // Number of items sent but not yet received.
+  std::atomic<size_t> queued_{0};
+  // Every time the receiver takes the queued items, we increment batch_.
   // When the receiver is closed we set batch_ to kClosedBatch.
-  uint64_t batch_ ABSL_GUARDED_BY(mu_) = 1;
+  std::atomic<uint64_t> batch_{1};
+  std::atomic<bool> senders_waiting_{false};
+  Mutex mu_;
   Waker receive_waker_ ABSL_GUARDED_BY(mu_);
+  // Odd, and bumped each time the receiver waits.
+  uintptr_t receive_waker_number_ ABSL_GUARDED_BY(mu_) = 1;
   WaitSet send_wakers_ ABSL_GUARDED_BY(mu_);
 };
 
@@ -215,12 +317,28 @@ class MpscReceiver {
     };
   }
 
+  // Return a promise that will resolve to all the items sent and not yet
+  // received (and remove said items), once there is at least one.
+  auto NextBatch() {
+    return [this]() -> Poll<std::vector<T>> {
+      std::vector<T> batch;
+      if (buffer_it_ != buffer_.end()) {
+        batch.reserve(buffer_.end() - buffer_it_);
+        for (; buffer_it_ != buffer_.end(); ++buffer_it_) {
+          batch.push_back(std::move(*buffer_it_));
+        }
+        return batch;
+      }
+      if (center_->PollReceiveBatch(batch)) return batch;
+      return Pending{};
+    };
+  }
+
  private:
   // Received items. We move out of here one by one, but don't resize the
   // vector. Instead, when we run out of items, we poll the center for more -
-  // which swaps this buffer in for the new receive queue and clears it.
-  // In this way, upon hitting a steady state the queue ought to be allocation
-  // free.
+  // which clears this buffer and refills it. In this way, upon hitting a
+  // steady state the buffer ought to be allocation free.
   std::vector<T> buffer_;
   typename std::vector<T>::iterator buffer_it_ = buffer_.end();
   RefCountedPtr<mpscpipe_detail::Center<T>> center_;
@@ -65,10 +65,10 @@ bool PartySyncUsingAtomics::UnreffedLast() {
 
 bool PartySyncUsingAtomics::ScheduleWakeup(WakeupMask mask) {
   // Or in the wakeup bit for the participant, AND the locked bit.
-  uint64_t prev_state = state_.fetch_or((mask & kWakeupMask) | kLocked,
-                                        std::memory_order_acq_rel);
+  uint64_t prev_state =
+      state_.fetch_or(WakeupBits(mask) | kLocked, std::memory_order_acq_rel);
   LogStateChange("ScheduleWakeup", prev_state,
-                 prev_state | (mask & kWakeupMask) | kLocked);
+                 prev_state | WakeupBits(mask) | kLocked);
   // If the lock was not held now we hold it, so we need to run.
   return ((prev_state & kLocked) == 0);
 }
@@ -82,6 +82,86 @@ bool PartySyncUsingMutex::ScheduleWakeup(WakeupMask mask) {
   return !std::exchange(locked_, true);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Party::SpillBlock
+
+// Slots for participants beyond party_detail::kMaxParticipants. Each block
+// tracks allocation and wakeups of its own slots, and wakes the party with
+// party_detail::kSpillWakeup. Blocks live as long as the arena they were
+// allocated from, so their slots are reused by later spills.
+class Party::SpillBlock final : public Wakeable {
+ public:
+  static constexpr size_t kSize = 8 * sizeof(WakeupMask);
+
+  explicit SpillBlock(Party* party) : party_(party) {}
+
+  std::atomic<SpillBlock*>* next() { return &next_; }
+
+  // Claim a free slot for participant, and mark it woken up.
+  // Returns false if the block is full.
+  bool Add(Participant* participant) {
+    WakeupMask allocated = allocated_.load(std::memory_order_relaxed);
+    WakeupMask bit;
+    do {
+      if (allocated == ~WakeupMask{0}) return false;
+      bit = LowestOneBit(static_cast<WakeupMask>(~allocated));
+    } while (!allocated_.compare_exchange_weak(allocated, allocated | bit,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_relaxed));
+    participants_[CountTrailingZeros(bit)].store(participant,
+                                                 std::memory_order_release);
+    wakeups_.fetch_or(bit, std::memory_order_release);
+    return true;
+  }
+
+  Participant* participant(size_t i) const {
+    return participants_[i].load(std::memory_order_acquire);
+  }
+
+  // Remove the participant in slot i, and free the slot.
+  Participant* Take(size_t i) {
+    Participant* participant =
+        participants_[i].exchange(nullptr, std::memory_order_acquire);
+    allocated_.fetch_and(~(WakeupMask{1} << i), std::memory_order_release);
+    return participant;
+  }
+
+  WakeupMask TakeWakeups() {
+    return wakeups_.exchange(0, std::memory_order_acquire);
+  }
+
+  void WakeupAll() {
+    wakeups_.fetch_or(allocated_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+  }
+
+  // Wakeable implementation, for wakers of spilled participants: the mask
+  // selects slots of this block.
+  void Wakeup(WakeupMask wakeup_mask) override {
+    wakeups_.fetch_or(wakeup_mask, std::memory_order_release);
+    party_->Wakeup(party_detail::kSpillWakeup);
+  }
+
+  void WakeupAsync(WakeupMask wakeup_mask) override {
+    wakeups_.fetch_or(wakeup_mask, std::memory_order_release);
+    party_->WakeupAsync(party_detail::kSpillWakeup);
+  }
+
+  void Drop(WakeupMask) override { party_->Unref(); }
+
+  std::string ActivityDebugTag(WakeupMask wakeup_mask) const override {
+    return absl::StrFormat("%s [spill:%p:%x]", party_->DebugTag(), this,
+                           wakeup_mask);
+  }
+
+ private:
+  Party* const party_;
+  std::atomic<WakeupMask> allocated_{0};
+  std::atomic<WakeupMask> wakeups_{0};
+  std::atomic<Participant*> participants_[kSize] = {};
+  std::atomic<SpillBlock*> next_{nullptr};
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 // Party::Handle
 
@@ -89,7 +169,9 @@ bool PartySyncUsingMutex::ScheduleWakeup(WakeupMask mask) {
 // Handle can persist while Party goes away.
 class Party::Handle final : public Wakeable {
  public:
-  explicit Handle(Party* party) : party_(party) {}
+  // Wakeups are forwarded to wakeable, which must live as long as party.
+  Handle(Party* party, Wakeable* wakeable)
+      : party_(party), wakeable_(wakeable) {}
 
   // Ref the Handle (not the activity).
   void Ref() { refs_.fetch_add(1, std::memory_order_relaxed); }
@@ -104,7 +186,7 @@ class Party::Handle final : public Wakeable {
   }
 
   void WakeupGeneric(WakeupMask wakeup_mask,
-                     void (Party::*wakeup_method)(WakeupMask))
+                     void (Wakeable::*wakeup_method)(WakeupMask))
       ABSL_LOCKS_EXCLUDED(mu_) {
     mu_.Lock();
     // Note that activity refcount can drop to zero, but we could win the lock
@@ -115,7 +197,7 @@ class Party::Handle final : public Wakeable {
       mu_.Unlock();
       // Activity still exists and we have a reference: wake it up, which will
       // drop the ref.
-      (party->*wakeup_method)(wakeup_mask);
+      (wakeable_->*wakeup_method)(wakeup_mask);
     } else {
       // Could not get the activity - it's either gone or going. No need to wake
       // it up!
@@ -128,11 +210,11 @@ class Party::Handle final : public Wakeable {
   // Activity needs to wake up (if it still exists!) - wake it up, and drop the
   // ref that was kept for this handle.
   void Wakeup(WakeupMask wakeup_mask) override ABSL_LOCKS_EXCLUDED(mu_) {
-    WakeupGeneric(wakeup_mask, &Party::Wakeup);
+    WakeupGeneric(wakeup_mask, &Wakeable::Wakeup);
   }
 
   void WakeupAsync(WakeupMask wakeup_mask) override ABSL_LOCKS_EXCLUDED(mu_) {
-    WakeupGeneric(wakeup_mask, &Party::WakeupAsync);
+    WakeupGeneric(wakeup_mask, &Wakeable::WakeupAsync);
   }
 
   void Drop(WakeupMask) override { Unref(); }
@@ -155,11 +237,13 @@ class Party::Handle final : public Wakeable {
   std::atomic<size_t> refs_{2};
   mutable Mutex mu_;
   Party* party_ ABSL_GUARDED_BY(mu_);
+  Wakeable* const wakeable_;
 };
 
-Wakeable* Party::Participant::MakeNonOwningWakeable(Party* party) {
+Wakeable* Party::Participant::MakeNonOwningWakeable(Party* party,
+                                                    Wakeable* wakeable) {
   if (handle_ == nullptr) {
-    handle_ = new Handle(party);
+    handle_ = new Handle(party, wakeable);
     return handle_;
   }
   handle_->Ref();
@@ -175,7 +259,8 @@ Party::Participant::~Participant() {
 Party::~Party() {}
 
 void Party::CancelRemainingParticipants() {
-  if (!sync_.has_participants()) return;
+  SpillBlock* spill_blocks = spill_blocks_.load(std::memory_order_acquire);
+  if (!sync_.has_participants() && spill_blocks == nullptr) return;
   ScopedActivity activity(this);
   promise_detail::Context<Arena> arena_ctx(arena_.get());
   for (size_t i = 0; i < party_detail::kMaxParticipants; i++) {
@@ -184,6 +269,12 @@ void Party::CancelRemainingParticipants() {
       p->Destroy();
     }
   }
+  for (SpillBlock* block = spill_blocks; block != nullptr;
+       block = block->next()->load(std::memory_order_acquire)) {
+    for (size_t i = 0; i < SpillBlock::kSize; i++) {
+      if (auto* p = block->Take(i)) p->Destroy();
+    }
+  }
 }
 
 std::string Party::ActivityDebugTag(WakeupMask wakeup_mask) const {
@@ -193,19 +284,36 @@ std::string Party::ActivityDebugTag(WakeupMask wakeup_mask) const {
 Waker Party::MakeOwningWaker() {
   DCHECK(currently_polling_ != kNotPolling);
   IncrementRefCount();
+  if (currently_polling_ == party_detail::kSpillSlot) {
+    return Waker(spill_block_polling_, 1u << spill_index_polling_);
+  }
   return Waker(this, 1u << currently_polling_);
 }
 
 Waker Party::MakeNonOwningWaker() {
   DCHECK(currently_polling_ != kNotPolling);
+  if (currently_polling_ == party_detail::kSpillSlot) {
+    return Waker(spill_block_polling_->participant(spill_index_polling_)
+                     ->MakeNonOwningWakeable(this, spill_block_polling_),
+                 1u << spill_index_polling_);
+  }
   return Waker(participants_[currently_polling_]
                    .load(std::memory_order_relaxed)
-                   ->MakeNonOwningWakeable(this),
+                   ->MakeNonOwningWakeable(this, this),
                1u << currently_polling_);
 }
 
 void Party::ForceImmediateRepoll(WakeupMask mask) {
   DCHECK(is_current());
+  if (mask & party_detail::kSpillWakeup) {
+    // The mask does not say which spilled participants asked for the repoll
+    // (it may have been accumulated from several of them), so repoll all.
+    for (SpillBlock* block = spill_blocks_.load(std::memory_order_acquire);
+         block != nullptr;
+         block = block->next()->load(std::memory_order_acquire)) {
+      block->WakeupAll();
+    }
+  }
   sync_.ForceImmediateRepoll(mask);
 }
 
@@ -274,6 +382,15 @@ void Party::RunLocked(Party* party) {
 }
 
 bool Party::RunParty() {
+  if (GPR_UNLIKELY(profiled_)) {
+    if (woken_at_ != std::chrono::steady_clock::time_point()) {
+      run_delay_ = std::chrono::steady_clock::now() - woken_at_;
+      woken_at_ = std::chrono::steady_clock::time_point();
+      PartyProfile::RecordRunDelay(run_delay_);
+    } else {
+      run_delay_ = std::chrono::nanoseconds(0);
+    }
+  }
   ScopedActivity activity(this);
   promise_detail::Context<Arena> arena_ctx(arena_.get());
   return sync_.RunParty([this](int i) { return RunOneParticipant(i); });
@@ -281,6 +398,10 @@ bool Party::RunParty() {
 
 bool Party::RunOneParticipant(int i) {
   GRPC_LATENT_SEE_INNER_SCOPE("Party::RunOneParticipant");
+  if (i == party_detail::kSpillSlot) {
+    RunSpilledParticipants();
+    return false;
+  }
   // If the participant is null, skip.
   // This allows participants to complete whilst wakers still exist
   // somewhere.
@@ -298,7 +419,7 @@ bool Party::RunOneParticipant(int i) {
   }
   // Poll the participant.
   currently_polling_ = i;
-  bool done = participant->PollParticipantPromise();
+  bool done = PollParticipant(participant);
   currently_polling_ = kNotPolling;
   if (done) {
     if (!name.empty()) {
@@ -312,6 +433,65 @@ bool Party::RunOneParticipant(int i) {
   return done;
 }
 
+bool Party::PollProfiledParticipant(Participant* participant) {
+  // A participant that completes is gone by the time the poll returns, so
+  // everything needed from it is taken up front.
+  PartyProfile* profile = PartyProfile::ForName(participant->name());
+  const uint32_t polls = participant->CountPoll();
+  profile->BeginPoll();
+  const bool done = participant->PollParticipantPromise();
+  profile->EndPoll(polls, done, run_delay_);
+  return done;
+}
+
+void Party::RunSpilledParticipants() {
+  for (SpillBlock* block = spill_blocks_.load(std::memory_order_acquire);
+       block != nullptr;
+       block = block->next()->load(std::memory_order_acquire)) {
+    WakeupMask wakeups = block->TakeWakeups();
+    while (wakeups != 0) {
+      const WakeupMask t = LowestOneBit(wakeups);
+      wakeups ^= t;
+      const uint8_t i = CountTrailingZeros(t);
+      auto* participant = block->participant(i);
+      // As in RunOneParticipant: skip participants that already completed.
+      if (participant == nullptr) continue;
+      if (GRPC_TRACE_FLAG_ENABLED(promise_primitives)) {
+        LOG(INFO) << DebugTag() << "[" << participant->name()
+                  << "] begin spilled job " << block << ":" << int{i};
+      }
+      currently_polling_ = party_detail::kSpillSlot;
+      spill_block_polling_ = block;
+      spill_index_polling_ = i;
+      bool done = PollParticipant(participant);
+      currently_polling_ = kNotPolling;
+      spill_block_polling_ = nullptr;
+      if (done) block->Take(i);
+    }
+  }
+}
+
+void Party::SpillParticipant(Participant* participant) {
+  std::atomic<SpillBlock*>* link = &spill_blocks_;
+  SpillBlock* block = link->load(std::memory_order_acquire);
+  while (block != nullptr) {
+    if (block->Add(participant)) return;
+    link = block->next();
+    block = link->load(std::memory_order_acquire);
+  }
+  // All blocks are full: append a new one.
+  SpillBlock* new_block = arena_->New<SpillBlock>(this);
+  CHECK(new_block->Add(participant));
+  while (!link->compare_exchange_weak(block, new_block,
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_acquire)) {
+    if (block != nullptr) {
+      link = block->next();
+      block = nullptr;
+    }
+  }
+}
+
 void Party::AddParticipants(Participant** participants, size_t count) {
   bool run_party = sync_.AddParticipantsAndRef(count, [this, participants,
                                                        count](size_t* slots) {
@@ -321,20 +501,42 @@ void Party::AddParticipants(Participant** participants, size_t count) {
                   << participants[i]->name() << " @ " << slots[i]
                   << " [participant=" << participants[i] << "]";
       }
-      participants_[slots[i]].store(participants[i], std::memory_order_release);
+      if (slots[i] == party_detail::kSpillSlot) {
+        SpillParticipant(participants[i]);
+      } else {
+        participants_[slots[i]].store(participants[i],
+                                      std::memory_order_release);
+      }
     }
   });
-  if (run_party) RunLocked(this);
+  if (run_party) {
+    MarkWoken();
+    RunLocked(this);
+  }
   Unref();
 }
 
 void Party::Wakeup(WakeupMask wakeup_mask) {
-  if (sync_.ScheduleWakeup(wakeup_mask)) RunLocked(this);
+  if (is_current()) {
+    // Woken by one of our own participants (eg a promise made ready by a
+    // sibling in the same party): no need to go through the wakeup machinery,
+    // the participant can be repolled as part of the current run.
+    sync_.ForceImmediateRepoll(wakeup_mask);
+  } else if (sync_.ScheduleWakeup(wakeup_mask)) {
+    MarkWoken();
+    RunLocked(this);
+  }
   Unref();
 }
 
 void Party::WakeupAsync(WakeupMask wakeup_mask) {
-  if (sync_.ScheduleWakeup(wakeup_mask)) {
+  if (is_current()) {
+    // As in Wakeup(): the repoll happens after the current participant
+    // returns, so it is already out of line.
+    sync_.ForceImmediateRepoll(wakeup_mask);
+    Unref();
+  } else if (sync_.ScheduleWakeup(wakeup_mask)) {
+    MarkWoken();
     arena_->GetContext<grpc_event_engine::experimental::EventEngine>()->Run(
         [this]() {
           ApplicationCallbackExecCtx app_exec_ctx;
@@ -19,6 +19,7 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <chrono>
 #include <string>
 #include <utility>
 
@@ -40,6 +41,7 @@
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/detail/promise_factory.h"
+#include "src/core/lib/promise/party_profile.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/util/useful.h"
@@ -68,8 +70,13 @@ namespace grpc_core {
 namespace party_detail {
 
 // Number of bits reserved for wakeups gives us the maximum number of
-// participants.
+// participants that are tracked directly by the party state.
 static constexpr size_t kMaxParticipants = 16;
+// Participants spawned while all kMaxParticipants slots are taken spill over
+// into blocks kept by the party. They are polled as one pseudo-participant at
+// this index, which is woken by kSpillWakeup.
+static constexpr size_t kSpillSlot = kMaxParticipants;
+static constexpr WakeupMask kSpillWakeup = 1u << kSpillSlot;
 
 }  // namespace party_detail
 
@@ -95,17 +102,20 @@ class PartySyncUsingAtomics {
     }
     return false;
   }
+  // Must only be called by the thread running the party.
   void ForceImmediateRepoll(WakeupMask mask) {
     // Or in the bit for the currently polling participant.
-    // Will be grabbed next round to force a repoll of this promise.
-    const uint64_t prev_state =
-        state_.fetch_or(mask, std::memory_order_relaxed);
-    LogStateChange("ForceImmediateRepoll", prev_state, prev_state | mask);
+    // Will be grabbed before the current round finishes to force a repoll of
+    // this promise: since only the thread running the party touches repolls_,
+    // this needs no atomic operations, and no extra round through state_.
+    repolls_ |= WakeupBits(mask);
   }
 
   // Run the update loop: poll_one_participant is called with an integral index
   // for the participant that should be polled. It should return true if the
   // participant completed and should be removed from the allocated set.
+  // Spilled participants are polled with index party_detail::kSpillSlot, after
+  // all the others; they keep track of their own allocation.
   template <typename F>
   GRPC_MUST_USE_RESULT bool RunParty(F poll_one_participant) {
     // Grab the current state, and clear the wakeup bits & add flag.
@@ -116,7 +126,7 @@ class PartySyncUsingAtomics {
     CHECK(prev_state & kLocked);
     if (prev_state & kDestroying) return true;
     // From the previous state, extract which participants we're to wakeup.
-    uint64_t wakeups = prev_state & kWakeupMask;
+    uint64_t wakeups = prev_state & (kWakeupMask | kSpillWakeups);
     // Now update prev_state to be what we want the CAS to see below.
     prev_state &= kRefMask | kLocked | kAllocatedMask;
     for (;;) {
@@ -124,14 +134,24 @@ class PartySyncUsingAtomics {
       // For each wakeup bit...
       while (wakeups != 0) {
         uint64_t t = LowestOneBit(wakeups);
-        const int i = CountTrailingZeros(t);
         wakeups ^= t;
-        // If the bit is not set, skip.
-        if (poll_one_participant(i)) {
-          const uint64_t allocated_bit = (1u << i << kAllocatedShift);
-          keep_allocated_mask &= ~allocated_bit;
+        if (t == kSpillWakeups) {
+          poll_one_participant(party_detail::kSpillSlot);
+        } else {
+          const int i = CountTrailingZeros(t);
+          if (poll_one_participant(i)) {
+            const uint64_t allocated_bit = (1u << i << kAllocatedShift);
+            keep_allocated_mask &= ~allocated_bit;
+          }
+        }
+        // Forced repolls are run as part of this round, unless the party is
+        // being destroyed: the CAS below will fail and notice that.
+        if (wakeups == 0 && repolls_ != 0 &&
+            (state_.load(std::memory_order_relaxed) & kDestroying) == 0) {
+          wakeups = std::exchange(repolls_, 0);
         }
       }
+      repolls_ = 0;
       // Try to CAS the state we expected to have (with no wakeups or adds)
       // back to unlocked (by masking in only the ref mask - sans locked bit).
       // If this succeeds then no wakeups were added, no adds were added, and we
@@ -160,7 +180,7 @@ class PartySyncUsingAtomics {
       CHECK(prev_state & kLocked);
       if (prev_state & kDestroying) return true;
       // From the previous state, extract which participants we're to wakeup.
-      wakeups = prev_state & kWakeupMask;
+      wakeups = prev_state & (kWakeupMask | kSpillWakeups);
       // Now update prev_state to be what we want the CAS to see once wakeups
       // complete next iteration.
       prev_state &= kRefMask | kLocked | keep_allocated_mask;
@@ -170,10 +190,14 @@ class PartySyncUsingAtomics {
 
   // Add new participants to the party. Returns true if the caller should run
   // the party. store is called with an array of indices of the new
-  // participants. Adds a ref that should be dropped by the caller after
-  // RunParty has been called (if that was required).
+  // participants; those that did not fit are given party_detail::kSpillSlot,
+  // and store is expected to record them somewhere the kSpillSlot poll will
+  // find them. At most kMaxParticipants may be added at once. Adds a ref that
+  // should be dropped by the caller after RunParty has been called (if that was
+  // required).
   template <typename F>
   GRPC_MUST_USE_RESULT bool AddParticipantsAndRef(size_t count, F store) {
+    DCHECK_LE(count, party_detail::kMaxParticipants);
     uint64_t state = state_.load(std::memory_order_acquire);
     uint64_t allocated;
 
@@ -182,11 +206,16 @@ class PartySyncUsingAtomics {
     // Find slots for each new participant, ordering them from lowest available
     // slot upwards to ensure the same poll ordering as presentation ordering to
     // this function.
-    WakeupMask wakeup_mask;
+    uint64_t wakeup_mask;
     do {
       wakeup_mask = 0;
       allocated = (state & kAllocatedMask) >> kAllocatedShift;
       for (size_t i = 0; i < count; i++) {
+        if (allocated == kAllocatedMask >> kAllocatedShift) {
+          slots[i] = party_detail::kSpillSlot;
+          wakeup_mask |= kSpillWakeups;
+          continue;
+        }
         auto new_mask = LowestOneBit(~allocated);
         wakeup_mask |= new_mask;
         allocated |= new_mask;
@@ -223,6 +252,12 @@ class PartySyncUsingAtomics {
  private:
   bool UnreffedLast();
 
+  // Maps a WakeupMask onto the wakeup bits of state_.
+  static uint64_t WakeupBits(WakeupMask mask) {
+    return (mask & kWakeupMask) |
+           ((mask & party_detail::kSpillWakeup) != 0 ? kSpillWakeups : 0);
+  }
+
   void LogStateChange(const char* op, uint64_t prev_state, uint64_t new_state,
                       DebugLocation loc = {}) {
     if (GRPC_TRACE_FLAG_ENABLED(party_state)) {
@@ -246,6 +281,7 @@ class PartySyncUsingAtomics {
   //   - 16 bits, one per participant, indicating which participants have
   //   been
   //     woken up and should be polled next time the main loop runs.
+  //   - 1 bit indicating that some spilled participant has been woken up.
 
   // clang-format off
   // Bits used to store 16 bits of wakeups
@@ -254,6 +290,8 @@ class PartySyncUsingAtomics {
   static constexpr uint64_t kAllocatedMask = 0x0000'0000'ffff'0000;
   // Bit indicating destruction has begun (refs went to zero)
   static constexpr uint64_t kDestroying    = 0x0000'0001'0000'0000;
+  // Bit indicating that a spilled participant has been woken up
+  static constexpr uint64_t kSpillWakeups  = 0x0000'0002'0000'0000;
   // Bit indicating locked or not
   static constexpr uint64_t kLocked        = 0x0000'0008'0000'0000;
   // Bits used to store 24 bits of ref counts
@@ -268,6 +306,8 @@ class PartySyncUsingAtomics {
   static constexpr uint64_t kOneRef = 1ull << kRefShift;
 
   std::atomic<uint64_t> state_;
+  // Wakeup bits of forced repolls. Only accessed while locked.
+  uint64_t repolls_ = 0;
 };
 
 class PartySyncUsingMutex {
@@ -296,7 +336,9 @@ class PartySyncUsingMutex {
       lock.Release();
       for (size_t i = 0; wakeup != 0; i++, wakeup >>= 1) {
         if ((wakeup & 1) == 0) continue;
-        if (poll_one_participant(i)) freed |= 1 << i;
+        if (poll_one_participant(i) && i != party_detail::kSpillSlot) {
+          freed |= 1 << i;
+        }
       }
     }
   }
@@ -315,7 +357,10 @@ class PartySyncUsingMutex {
       wakeup_mask |= 1 << bit;
       allocated_ |= 1 << bit;
     }
-    CHECK(n == count);
+    for (; n < count; n++) {
+      slots[n] = party_detail::kSpillSlot;
+      wakeup_mask |= party_detail::kSpillWakeup;
+    }
     store(slots);
     wakeups_ |= wakeup_mask;
     return !std::exchange(locked_, true);
@@ -348,17 +393,24 @@ class Party : public Activity, private Wakeable {
     // Destroy the participant before finishing.
     virtual void Destroy() = 0;
 
-    // Return a Handle instance for this participant.
-    Wakeable* MakeNonOwningWakeable(Party* party);
+    // Return a Handle instance for this participant. Wakeups are delivered
+    // through \a wakeable, which is \a party itself unless the participant has
+    // been spilled.
+    Wakeable* MakeNonOwningWakeable(Party* party, Wakeable* wakeable);
 
     absl::string_view name() const { return name_; }
 
+    // Counts a poll of the participant, returning the total so far. Only
+    // profiled parties count polls.
+    uint32_t CountPoll() { return ++polls_; }
+
    protected:
     ~Participant();
 
    private:
     Handle* handle_ = nullptr;
     absl::string_view name_;
+    uint32_t polls_ = 0;
   };
 
  public:
@@ -375,7 +427,9 @@ class Party : public Activity, private Wakeable {
   // down.
   // The on_complete callback will be called with the result of the promise if
   // it completes.
-  // A maximum of sixteen promises can be spawned onto a party.
+  // The first sixteen concurrent promises are tracked directly in the party
+  // state; any beyond that are kept in spill blocks allocated on the arena,
+  // which costs a little more per wakeup.
   // promise_factory called to create the promise with the party lock taken;
   // after the promise is created the factory is destroyed.
   // This means that pointers or references to factory members will be
@@ -414,15 +468,18 @@ class Party : public Activity, private Wakeable {
   class BulkSpawner {
    public:
     explicit BulkSpawner(Party* party) : party_(party) {}
-    ~BulkSpawner() {
-      party_->AddParticipants(participants_, num_participants_);
-    }
+    ~BulkSpawner() { Flush(); }
 
     template <typename Factory, typename OnComplete>
     void Spawn(absl::string_view name, Factory promise_factory,
                OnComplete on_complete);
 
    private:
+    void Flush() {
+      party_->AddParticipants(participants_, num_participants_);
+      num_participants_ = 0;
+    }
+
     Party* const party_;
     size_t num_participants_ = 0;
     Participant* participants_[party_detail::kMaxParticipants];
@@ -576,6 +633,10 @@ class Party : public Activity, private Wakeable {
     std::atomic<State> state_{State::kFactory};
   };
 
+  // A block of participants that were spawned while all the directly tracked
+  // slots were taken.
+  class SpillBlock;
+
   // Destroy any remaining participants.
   // Needs to have normal context setup before calling.
   void CancelRemainingParticipants();
@@ -595,6 +656,20 @@ class Party : public Activity, private Wakeable {
   // Add a participant (backs Spawn, after type erasure to ParticipantFactory).
   void AddParticipants(Participant** participant, size_t count);
   bool RunOneParticipant(int i);
+  // Polls \a participant, returning true if it completed.
+  bool PollParticipant(Participant* participant) {
+    if (GPR_LIKELY(!profiled_)) return participant->PollParticipantPromise();
+    return PollProfiledParticipant(participant);
+  }
+  bool PollProfiledParticipant(Participant* participant);
+  // In profiled parties: notes that the party has been woken and will run.
+  void MarkWoken() {
+    if (GPR_UNLIKELY(profiled_)) woken_at_ = std::chrono::steady_clock::now();
+  }
+  // Store a participant that did not get a slot of its own in a spill block.
+  void SpillParticipant(Participant* participant);
+  // Poll the spilled participants that have been woken up.
+  void RunSpilledParticipants();
 
   // Sentinal value for currently_polling_ when no participant is being polled.
   static constexpr uint8_t kNotPolling = 255;
@@ -608,11 +683,22 @@ class Party : public Activity, private Wakeable {
 #endif
 
   uint8_t currently_polling_ = kNotPolling;
+  // When currently_polling_ is kSpillSlot: the spill block, and the index
+  // within it, of the participant being polled.
+  uint8_t spill_index_polling_ = 0;
+  SpillBlock* spill_block_polling_ = nullptr;
   // All current participants, using a tagged format.
   // If the lower bit is unset, then this is a Participant*.
   // If the lower bit is set, then this is a ParticipantFactory*.
   std::atomic<Participant*> participants_[party_detail::kMaxParticipants] = {};
+  // Linked list of spill blocks, allocated from the arena as needed.
+  std::atomic<SpillBlock*> spill_blocks_{nullptr};
   RefCountedPtr<Arena> arena_;
+  // Set for the parties sampled by PartyProfile. woken_at_ is written by
+  // whoever wins the right to run the party, and read when the run starts.
+  const bool profiled_ = PartyProfile::ShouldSample();
+  std::chrono::steady_clock::time_point woken_at_;
+  std::chrono::nanoseconds run_delay_{0};
 };
 
 template <>
@@ -626,6 +712,7 @@ void Party::BulkSpawner::Spawn(absl::string_view name, Factory promise_factory,
   GRPC_TRACE_LOG(promise_primitives, INFO)
       << party_->DebugTag() << "[bulk_spawn] On " << this << " queue " << name
       << " (" << sizeof(ParticipantImpl<Factory, OnComplete>) << " bytes)";
+  if (num_participants_ == party_detail::kMaxParticipants) Flush();
   participants_[num_participants_++] = new ParticipantImpl<Factory, OnComplete>(
       name, std::move(promise_factory), std::move(on_complete));
 }
@@ -0,0 +1,166 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/promise/party_profile.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_core {
+
+namespace {
+
+struct Registry {
+  Mutex mu;
+  std::map<std::string, PartyProfile*, std::less<>> profiles
+      ABSL_GUARDED_BY(mu);
+};
+
+Registry* GetRegistry() {
+  static NoDestruct<Registry> registry;
+  return registry.get();
+}
+
+// Parties created on this thread until the next sampled one.
+thread_local uint32_t g_parties_until_sample = 0;
+
+}  // namespace
+
+std::atomic<uint32_t> PartyProfile::sampling_period_{
+    PartyProfile::kPeriodUnset};
+
+PartyProfile::PartyProfile(std::string name)
+    : name_(std::move(name))
+#ifdef GRPC_ENABLE_LATENT_SEE
+      ,
+      poll_metadata_{__FILE__, __LINE__, name_.c_str()}
+#endif
+{
+}
+
+void PartyProfile::SetSamplingPeriod(uint32_t period) {
+  sampling_period_.store(period, std::memory_order_relaxed);
+}
+
+bool PartyProfile::ShouldSampleSlow(uint32_t period) {
+  if (period == kPeriodUnset) {
+    // As for LockProfile: config vars are only consulted once parties exist.
+    const int32_t configured = ConfigVars::Get().PartyProfilingPeriod();
+    period = configured > 0 ? static_cast<uint32_t>(configured) : 0;
+    uint32_t expected = kPeriodUnset;
+    sampling_period_.compare_exchange_strong(expected, period,
+                                             std::memory_order_relaxed);
+    if (period == 0) return false;
+  }
+  if (g_parties_until_sample > 0) {
+    --g_parties_until_sample;
+    return false;
+  }
+  g_parties_until_sample = period - 1;
+  return true;
+}
+
+PartyProfile* PartyProfile::ForName(absl::string_view name) {
+  Registry* registry = GetRegistry();
+  MutexLock lock(&registry->mu);
+  auto it = registry->profiles.find(name);
+  if (it == registry->profiles.end()) {
+    it = registry->profiles
+             .emplace(std::string(name), new PartyProfile(std::string(name)))
+             .first;
+  }
+  return it->second;
+}
+
+void PartyProfile::RecordRunDelay(std::chrono::nanoseconds delay) {
+  global_stats().IncrementPartyWakeupToRunUs(
+      std::chrono::duration_cast<std::chrono::microseconds>(delay).count());
+}
+
+void PartyProfile::BeginPoll() {
+#ifdef GRPC_ENABLE_LATENT_SEE
+  latent_see::Log::Append(&poll_metadata_, latent_see::EventType::kBegin, 0);
+#endif
+}
+
+void PartyProfile::EndPoll(uint32_t polls, bool done,
+                           std::chrono::nanoseconds run_delay) {
+#ifdef GRPC_ENABLE_LATENT_SEE
+  latent_see::Log::Append(&poll_metadata_, latent_see::EventType::kEnd, 0);
+#endif
+  polls_.fetch_add(1, std::memory_order_relaxed);
+  total_run_delay_ns_.fetch_add(run_delay.count(), std::memory_order_relaxed);
+  if (done) {
+    completed_.fetch_add(1, std::memory_order_relaxed);
+    global_stats().IncrementPartyPollsPerParticipant(polls);
+  } else if (polls > 1) {
+    // Woken and polled again, but still not done.
+    spurious_wakeups_.fetch_add(1, std::memory_order_relaxed);
+    global_stats().IncrementPartySpuriousWakeups();
+  }
+}
+
+PartyProfile::Stats PartyProfile::GetStats() const {
+  return Stats{
+      name_,
+      polls_.load(std::memory_order_relaxed),
+      completed_.load(std::memory_order_relaxed),
+      spurious_wakeups_.load(std::memory_order_relaxed),
+      std::chrono::nanoseconds(
+          total_run_delay_ns_.load(std::memory_order_relaxed)),
+  };
+}
+
+std::vector<PartyProfile::Stats> PartyProfile::TopByPolls(size_t max_results) {
+  std::vector<Stats> result;
+  {
+    Registry* registry = GetRegistry();
+    MutexLock lock(&registry->mu);
+    for (const auto& name_profile : registry->profiles) {
+      result.push_back(name_profile.second->GetStats());
+    }
+  }
+  std::sort(result.begin(), result.end(), [](const Stats& a, const Stats& b) {
+    return a.polls > b.polls;
+  });
+  if (result.size() > max_results) result.resize(max_results);
+  return result;
+}
+
+std::string PartyProfile::TopByPollsToString(size_t max_results) {
+  std::string result;
+  for (const Stats& stats : TopByPolls(max_results)) {
+    absl::StrAppend(&result, stats.name, ": polls=", stats.polls,
+                    " completed=", stats.completed,
+                    " spurious_wakeups=", stats.spurious_wakeups,
+                    " total_run_delay_us=",
+                    stats.total_run_delay.count() / 1000, "\n");
+  }
+  return result;
+}
+
+}  // namespace grpc_core
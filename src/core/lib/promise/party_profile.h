@@ -0,0 +1,113 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_PROMISE_PARTY_PROFILE_H
+#define GRPC_SRC_CORE_LIB_PROMISE_PARTY_PROFILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/util/latent_see.h"
+
+namespace grpc_core {
+
+// Scheduling statistics for party participants, keyed by participant name.
+//
+// Profiling is off unless the GRPC_PARTY_PROFILING_PERIOD config var (or
+// SetSamplingPeriod()) is positive. Then one in that many parties, chosen
+// when each is created, records for its participants:
+// - how long the party waited between being woken and running
+//   (party_wakeup_to_run_us, and summed per name over the polls it led to);
+// - how many polls each took to complete (party_polls_per_participant);
+// - spurious wakeups: repolls that left the participant pending
+//   (party_spurious_wakeups).
+// When latent_see is enabled, polls in sampled parties are also traced as
+// spans named after the participant. Unsampled parties pay one branch per
+// poll.
+class PartyProfile {
+ public:
+  struct Stats {
+    std::string name;
+    uint64_t polls;
+    uint64_t completed;
+    uint64_t spurious_wakeups;
+    // Over the polls: how long their party had waited to start the run in
+    // which they were polled.
+    std::chrono::nanoseconds total_run_delay;
+  };
+
+  PartyProfile(const PartyProfile&) = delete;
+  PartyProfile& operator=(const PartyProfile&) = delete;
+
+  // Overrides GRPC_PARTY_PROFILING_PERIOD; zero disables profiling.
+  static void SetSamplingPeriod(uint32_t period);
+
+  // Whether a party being created should be profiled.
+  static bool ShouldSample() {
+    const uint32_t period = sampling_period_.load(std::memory_order_relaxed);
+    if (GPR_LIKELY(period == 0)) return false;
+    return ShouldSampleSlow(period);
+  }
+
+  // The \a max_results participant names polled most often, most first.
+  static std::vector<Stats> TopByPolls(size_t max_results);
+
+  // Human readable form of TopByPolls(), one participant name per line.
+  static std::string TopByPollsToString(size_t max_results);
+
+  // Profiles live as long as the process, one per participant name.
+  static PartyProfile* ForName(absl::string_view name);
+
+  // Records that a sampled party started running \a delay after it was woken.
+  static void RecordRunDelay(std::chrono::nanoseconds delay);
+
+  // Brackets one poll of a participant in a sampled party. \a polls counts
+  // this poll, and \a run_delay is what was passed to RecordRunDelay() for
+  // the current run.
+  void BeginPoll();
+  void EndPoll(uint32_t polls, bool done, std::chrono::nanoseconds run_delay);
+
+  Stats GetStats() const;
+
+ private:
+  static constexpr uint32_t kPeriodUnset = ~uint32_t{0};
+
+  explicit PartyProfile(std::string name);
+
+  static bool ShouldSampleSlow(uint32_t period);
+
+  static std::atomic<uint32_t> sampling_period_;
+
+  const std::string name_;
+  std::atomic<uint64_t> polls_{0};
+  std::atomic<uint64_t> completed_{0};
+  std::atomic<uint64_t> spurious_wakeups_{0};
+  std::atomic<int64_t> total_run_delay_ns_{0};
+#ifdef GRPC_ENABLE_LATENT_SEE
+  latent_see::Metadata poll_metadata_;
+#endif
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_PROMISE_PARTY_PROFILE_H
@@ -16,6 +16,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <string>
@@ -91,14 +92,25 @@ extern "C" void grpc_resource_quota_unref(grpc_resource_quota* resource_quota) {
 extern "C" void grpc_resource_quota_resize(grpc_resource_quota* resource_quota,
                                            size_t new_size) {
   grpc_core::ExecCtx exec_ctx;
-  grpc_core::ResourceQuota::FromC(resource_quota)
-      ->memory_quota()
-      ->SetSize(new_size);
+  grpc_core::ResourceQuota::FromC(resource_quota)->SetMemorySize(new_size);
 }
 
 extern "C" void grpc_resource_quota_set_max_threads(
     grpc_resource_quota* resource_quota, int new_max_threads) {
   grpc_core::ResourceQuota::FromC(resource_quota)
-      ->thread_quota()
-      ->SetMax(new_max_threads);
+      ->SetMaxThreads(new_max_threads);
+}
+
+extern "C" grpc_resource_quota* grpc_resource_quota_create_child(
+    grpc_resource_quota* parent, const char* name, size_t min_memory,
+    int min_threads, double weight) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_core::ResourceQuota::ChildOptions options;
+  options.min_memory = min_memory;
+  options.min_threads = std::max(0, min_threads);
+  options.weight = weight;
+  return grpc_core::ResourceQuota::FromC(parent)
+      ->CreateChild(name, options)
+      .release()
+      ->c_ptr();
 }
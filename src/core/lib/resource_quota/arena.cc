@@ -18,6 +18,7 @@
 
 #include "src/core/lib/resource_quota/arena.h"
 
+#include <algorithm>
 #include <atomic>
 #include <new>
 
@@ -26,18 +27,89 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/util/alloc.h"
 namespace grpc_core {
 
 namespace {
 
+class ArenaBlockCache;
+thread_local ArenaBlockCache* g_arena_block_cache = nullptr;
+
+// Initial blocks of destroyed arenas, kept by each thread for the next arenas
+// it creates: most calls then neither malloc nor free their arena.
+class ArenaBlockCache {
+ public:
+  ArenaBlockCache() { g_arena_block_cache = this; }
+  ~ArenaBlockCache() {
+    g_arena_block_cache = nullptr;
+    for (size_t i = 0; i < count_; ++i) gpr_free_aligned(blocks_[i].block);
+  }
+
+  // Returns the calling thread's cache, or nullptr if recycling is disabled
+  // or the thread is exiting.
+  static ArenaBlockCache* Get() {
+#ifdef GRPC_ASAN_ENABLED
+    // Keep use-after-free of arena memory detectable.
+    return nullptr;
+#else
+    if (!ConfigVars::Get().ArenaBlockRecycling()) return nullptr;
+    static thread_local ArenaBlockCache cache;
+    return g_arena_block_cache;
+#endif
+  }
+
+  // Returns a cached block of \a size bytes, or nullptr if there is none.
+  // Only exact sizes are reused, so that memory accounting is unchanged; call
+  // size estimates are rounded to keep them stable.
+  void* Take(size_t size) {
+    for (size_t i = count_; i > 0; --i) {
+      Block& b = blocks_[i - 1];
+      if (b.size == size) {
+        void* block = b.block;
+        b = blocks_[--count_];
+        return block;
+      }
+    }
+    return nullptr;
+  }
+
+  // Returns true if \a block was added to the cache.
+  bool Put(void* block, size_t size) {
+    if (size > kMaxBlockSize) return false;
+    if (count_ == kMaxBlocks) {
+      // Make room by evicting the oldest block.
+      gpr_free_aligned(blocks_[0].block);
+      std::move(blocks_ + 1, blocks_ + count_, blocks_);
+      --count_;
+    }
+    blocks_[count_++] = Block{block, size};
+    return true;
+  }
+
+ private:
+  static constexpr size_t kMaxBlocks = 8;
+  static constexpr size_t kMaxBlockSize = 64 * 1024;
+
+  struct Block {
+    void* block;
+    size_t size;
+  };
+
+  Block blocks_[kMaxBlocks];
+  size_t count_ = 0;
+};
+
 void* ArenaStorage(size_t& initial_size) {
   size_t base_size = Arena::ArenaOverhead() +
                      GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
                          arena_detail::BaseArenaContextTraits::ContextSize());
   initial_size =
       std::max(GPR_ROUND_UP_TO_ALIGNMENT_SIZE(initial_size), base_size);
+  if (ArenaBlockCache* cache = ArenaBlockCache::Get()) {
+    if (void* block = cache->Take(initial_size)) return block;
+  }
   static constexpr size_t alignment =
       (GPR_CACHELINE_SIZE > GPR_MAX_ALIGNMENT &&
        GPR_CACHELINE_SIZE % GPR_MAX_ALIGNMENT == 0)
@@ -101,8 +173,13 @@ void Arena::DestroyManagedNewObjects() {
 }
 
 void Arena::Destroy() const {
+  const size_t initial_zone_size = initial_zone_size_;
   this->~Arena();
-  gpr_free_aligned(const_cast<Arena*>(this));
+  ArenaBlockCache* cache = ArenaBlockCache::Get();
+  if (cache == nullptr ||
+      !cache->Put(const_cast<Arena*>(this), initial_zone_size)) {
+    gpr_free_aligned(const_cast<Arena*>(this));
+  }
 }
 
 void* Arena::AllocZone(size_t size) {
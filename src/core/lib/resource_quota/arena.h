@@ -158,6 +158,9 @@ class Arena final : public RefCounted<Arena, NonPolymorphicRefCount,
     return total_used_.load(std::memory_order_relaxed);
   }
 
+  // Return the size of the first buffer of this arena, as passed to Create.
+  size_t InitialZoneSize() const { return initial_zone_size_; }
+
   // Allocate \a size bytes from the arena.
   void* Alloc(size_t size) {
     size = GPR_ROUND_UP_TO_ALIGNMENT_SIZE(size);
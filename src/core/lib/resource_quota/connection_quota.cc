@@ -17,13 +17,25 @@
 #include <atomic>
 #include <cstdint>
 
+#include "absl/hash/hash.h"
 #include "absl/log/check.h"
+#include "absl/strings/match.h"
 
 #include <grpc/support/log.h>
 #include <grpc/support/port_platform.h>
 
 namespace grpc_core {
 
+absl::string_view PeerAddressKey(absl::string_view peer) {
+  if (!absl::StartsWith(peer, "ipv4:") && !absl::StartsWith(peer, "ipv6:")) {
+    return absl::string_view();
+  }
+  const size_t colon = peer.rfind(':');
+  // The scheme's own colon means there is no port.
+  if (colon < 5) return peer;
+  return peer.substr(0, colon);
+}
+
 ConnectionQuota::ConnectionQuota() = default;
 
 void ConnectionQuota::SetMaxIncomingConnections(int max_incoming_connections) {
@@ -33,16 +45,30 @@ void ConnectionQuota::SetMaxIncomingConnections(int max_incoming_connections) {
             max_incoming_connections, std::memory_order_release) == INT_MAX);
 }
 
+void ConnectionQuota::SetMaxIncomingConnectionsPerPeer(
+    int max_incoming_connections_per_peer) {
+  // The maximum can only be configured once.
+  CHECK_LT(max_incoming_connections_per_peer, INT_MAX);
+  CHECK(max_incoming_connections_per_peer_.exchange(
+            max_incoming_connections_per_peer, std::memory_order_release) ==
+        INT_MAX);
+}
+
+ConnectionQuota::PeerShard& ConnectionQuota::ShardForPeer(
+    absl::string_view peer_key) {
+  return peer_shards_[absl::HashOf(peer_key) % kNumPeerShards];
+}
+
 // Returns true if the incoming connection is allowed to be accepted on the
 // server.
 bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
-                                              absl::string_view /*peer*/) {
+                                              absl::string_view peer) {
   if (mem_quota->IsMemoryPressureHigh()) {
     return false;
   }
 
   if (max_incoming_connections_.load(std::memory_order_relaxed) == INT_MAX) {
-    return true;
+    return AllowIncomingConnectionFromPeer(peer);
   }
 
   int curr_active_connections =
@@ -55,11 +81,50 @@ bool ConnectionQuota::AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
   } while (!active_incoming_connections_.compare_exchange_weak(
       curr_active_connections, curr_active_connections + 1,
       std::memory_order_acq_rel, std::memory_order_relaxed));
+  if (!AllowIncomingConnectionFromPeer(peer)) {
+    ReleaseIncomingConnections(1);
+    return false;
+  }
+  return true;
+}
+
+bool ConnectionQuota::AllowIncomingConnectionFromPeer(absl::string_view peer) {
+  const int max_per_peer =
+      max_incoming_connections_per_peer_.load(std::memory_order_relaxed);
+  if (max_per_peer == INT_MAX) return true;
+  absl::string_view peer_key = PeerAddressKey(peer);
+  if (peer_key.empty()) return true;
+  PeerShard& shard = ShardForPeer(peer_key);
+  MutexLock lock(&shard.mu);
+  int& connections = shard.connections[peer_key];
+  if (connections >= max_per_peer) {
+    if (connections == 0) shard.connections.erase(peer_key);
+    return false;
+  }
+  ++connections;
   return true;
 }
 
 // Mark connections as closed.
-void ConnectionQuota::ReleaseConnections(int num_connections) {
+void ConnectionQuota::ReleaseConnections(int num_connections,
+                                         absl::string_view peer) {
+  ReleaseIncomingConnections(num_connections);
+  if (max_incoming_connections_per_peer_.load(std::memory_order_relaxed) ==
+      INT_MAX) {
+    return;
+  }
+  absl::string_view peer_key = PeerAddressKey(peer);
+  if (peer_key.empty()) return;
+  PeerShard& shard = ShardForPeer(peer_key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.connections.find(peer_key);
+  CHECK(it != shard.connections.end());
+  CHECK_GE(it->second, num_connections);
+  it->second -= num_connections;
+  if (it->second == 0) shard.connections.erase(it);
+}
+
+void ConnectionQuota::ReleaseIncomingConnections(int num_connections) {
   if (max_incoming_connections_.load(std::memory_order_relaxed) == INT_MAX) {
     return;
   }
@@ -17,8 +17,11 @@
 
 #include <cstddef>
 #include <limits>
+#include <string>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/support/port_platform.h>
 
@@ -41,21 +44,45 @@ class ConnectionQuota : public RefCounted<ConnectionQuota> {
   // Set the maximum number of allowed incoming connections on the server.
   void SetMaxIncomingConnections(int max_incoming_connections);
 
-  // Returns true if the incoming connection is allowed to be accepted on the
-  // server.
+  // Set the maximum number of allowed incoming connections on the server from
+  // any single peer IP address (whatever the port). Connections from peers
+  // that are not IP addresses are only subject to the overall limit.
+  void SetMaxIncomingConnectionsPerPeer(int max_incoming_connections_per_peer);
+
+  // Returns true if the incoming connection from \a peer, as returned by
+  // grpc_endpoint_get_peer(), is allowed to be accepted on the server.
   bool AllowIncomingConnection(MemoryQuotaRefPtr mem_quota,
                                absl::string_view peer);
 
-  // Mark connections as closed.
-  void ReleaseConnections(int num_connections);
+  // Mark connections from \a peer as closed.
+  void ReleaseConnections(int num_connections, absl::string_view peer);
 
  private:
+  // Connections per peer are counted in a table split into shards, each with
+  // its own lock, so that accepts from different peers rarely contend.
+  static constexpr size_t kNumPeerShards = 16;
+  struct PeerShard {
+    Mutex mu;
+    absl::flat_hash_map<std::string, int> connections ABSL_GUARDED_BY(mu);
+  };
+
+  PeerShard& ShardForPeer(absl::string_view peer_key);
+  bool AllowIncomingConnectionFromPeer(absl::string_view peer);
+  void ReleaseIncomingConnections(int num_connections);
+
   std::atomic<int> active_incoming_connections_{0};
   std::atomic<int> max_incoming_connections_{std::numeric_limits<int>::max()};
+  std::atomic<int> max_incoming_connections_per_peer_{
+      std::numeric_limits<int>::max()};
+  PeerShard peer_shards_[kNumPeerShards];
 };
 
 using ConnectionQuotaRefPtr = RefCountedPtr<ConnectionQuota>;
 
+// Returns the address, without the port, of an IP \a peer, or an empty string
+// for other kinds of peers.
+absl::string_view PeerAddressKey(absl::string_view peer);
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_CONNECTION_QUOTA_H
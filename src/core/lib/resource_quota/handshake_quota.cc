@@ -0,0 +1,131 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/handshake_quota.h"
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/resource_quota/connection_quota.h"
+
+namespace grpc_core {
+
+HandshakeQuota::HandshakeQuota() = default;
+
+void HandshakeQuota::SetMaxConcurrentHandshakes(int max_concurrent_handshakes) {
+  CHECK_GT(max_concurrent_handshakes, 0);
+  std::vector<absl::AnyInvocable<void()>> admitted;
+  {
+    MutexLock lock(&mu_);
+    max_concurrent_handshakes_ = max_concurrent_handshakes;
+    while (running_handshakes_ < max_concurrent_handshakes_) {
+      WaiterList* queue =
+          !preferred_queue_.empty() ? &preferred_queue_ : &queue_;
+      if (queue->empty()) break;
+      ++running_handshakes_;
+      waiting_.erase(queue->front().ticket);
+      admitted.push_back(std::move(queue->front().on_admitted));
+      queue->pop_front();
+    }
+  }
+  for (auto& on_admitted : admitted) on_admitted();
+}
+
+void HandshakeQuota::SetMaxQueuedHandshakes(int max_queued_handshakes) {
+  CHECK_GE(max_queued_handshakes, 0);
+  MutexLock lock(&mu_);
+  max_queued_handshakes_ = max_queued_handshakes;
+}
+
+HandshakeQuota::Admission HandshakeQuota::Admit(
+    absl::string_view peer, MemoryQuota* memory_quota,
+    absl::AnyInvocable<void()> on_admitted, uint64_t* ticket) {
+  const absl::string_view peer_key = PeerAddressKey(peer);
+  MutexLock lock(&mu_);
+  if (running_handshakes_ < max_concurrent_handshakes_) {
+    ++running_handshakes_;
+    return Admission::kAdmitted;
+  }
+  // Queued handshakes hold on to their connection and its buffers, so only
+  // peers that are likely to resume a session may still wait when memory is
+  // short.
+  const bool preferred = IsReturningPeerLocked(peer_key);
+  if (waiting_.size() >= static_cast<size_t>(max_queued_handshakes_) ||
+      (!preferred && memory_quota != nullptr &&
+       memory_quota->IsMemoryPressureHigh())) {
+    return Admission::kRejected;
+  }
+  WaiterList* queue = preferred ? &preferred_queue_ : &queue_;
+  *ticket = next_ticket_++;
+  queue->push_back(Waiter{*ticket, std::move(on_admitted)});
+  waiting_.emplace(*ticket, QueuePosition{queue, std::prev(queue->end())});
+  return Admission::kQueued;
+}
+
+bool HandshakeQuota::Cancel(uint64_t ticket) {
+  MutexLock lock(&mu_);
+  auto it = waiting_.find(ticket);
+  if (it == waiting_.end()) return false;
+  it->second.queue->erase(it->second.waiter);
+  waiting_.erase(it);
+  return true;
+}
+
+void HandshakeQuota::Release(absl::string_view peer, bool succeeded) {
+  absl::AnyInvocable<void()> on_admitted;
+  {
+    MutexLock lock(&mu_);
+    CHECK_GT(running_handshakes_, 0);
+    // Returning peers are only told apart when handshakes may have to wait.
+    if (succeeded &&
+        max_concurrent_handshakes_ != std::numeric_limits<int>::max()) {
+      AddReturningPeerLocked(PeerAddressKey(peer));
+    }
+    WaiterList* queue = !preferred_queue_.empty() ? &preferred_queue_ : &queue_;
+    if (running_handshakes_ > max_concurrent_handshakes_ || queue->empty()) {
+      --running_handshakes_;
+      return;
+    }
+    // The released slot goes straight to the next queued handshake.
+    waiting_.erase(queue->front().ticket);
+    on_admitted = std::move(queue->front().on_admitted);
+    queue->pop_front();
+  }
+  on_admitted();
+}
+
+size_t HandshakeQuota::NumQueuedHandshakes() {
+  MutexLock lock(&mu_);
+  return waiting_.size();
+}
+
+bool HandshakeQuota::IsReturningPeerLocked(absl::string_view peer_key) {
+  return !peer_key.empty() && returning_peers_.contains(peer_key);
+}
+
+void HandshakeQuota::AddReturningPeerLocked(absl::string_view peer_key) {
+  if (peer_key.empty() || !returning_peers_.emplace(peer_key).second) return;
+  returning_peer_order_.emplace_back(peer_key);
+  if (returning_peer_order_.size() > kMaxReturningPeers) {
+    returning_peers_.erase(returning_peer_order_.front());
+    returning_peer_order_.pop_front();
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,126 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_HANDSHAKE_QUOTA_H
+#define GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_HANDSHAKE_QUOTA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <list>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+
+namespace grpc_core {
+
+// Limits the number of server handshakes of a resource quota that run at the
+// same time. Handshakes beyond the limit wait in a queue, where those from
+// peers that recently completed a handshake, and are thus likely to resume
+// their TLS session, go first.
+class HandshakeQuota : public RefCounted<HandshakeQuota> {
+ public:
+  enum class Admission {
+    // The handshake may start now.
+    kAdmitted,
+    // The handshake was queued; its callback runs once it may start.
+    kQueued,
+    // The handshake must not run: the queue is full, or memory pressure is
+    // too high to let more handshakes wait.
+    kRejected,
+  };
+
+  HandshakeQuota();
+  ~HandshakeQuota() override = default;
+
+  HandshakeQuota(const HandshakeQuota&) = delete;
+  HandshakeQuota& operator=(const HandshakeQuota&) = delete;
+
+  // Set the maximum number of handshakes running at the same time.
+  void SetMaxConcurrentHandshakes(int max_concurrent_handshakes);
+
+  // Set the maximum number of handshakes waiting for one to complete.
+  void SetMaxQueuedHandshakes(int max_queued_handshakes);
+
+  // Asks to start a handshake with \a peer, as returned by
+  // grpc_endpoint_get_peer(). If it gets queued, \a on_admitted is invoked
+  // once it may start, without any lock held, and \a ticket identifies it for
+  // Cancel(). Each admitted handshake must be followed by a call to Release().
+  Admission Admit(absl::string_view peer, MemoryQuota* memory_quota,
+                  absl::AnyInvocable<void()> on_admitted, uint64_t* ticket);
+
+  // Removes the handshake of \a ticket from the queue. Returns false if it was
+  // already admitted, in which case its callback has been or is being invoked.
+  bool Cancel(uint64_t ticket);
+
+  // Marks an admitted handshake as done, and admits the next queued one.
+  // If \a succeeded, the handshake peer will be preferred next time.
+  void Release(absl::string_view peer, bool succeeded);
+
+  // Returns the number of handshakes waiting to start.
+  size_t NumQueuedHandshakes();
+
+ private:
+  // Number of peers remembered as having recently completed a handshake.
+  static constexpr size_t kMaxReturningPeers = 4096;
+
+  struct Waiter {
+    uint64_t ticket;
+    absl::AnyInvocable<void()> on_admitted;
+  };
+  using WaiterList = std::list<Waiter>;
+  struct QueuePosition {
+    WaiterList* queue;
+    WaiterList::iterator waiter;
+  };
+
+  bool IsReturningPeerLocked(absl::string_view peer_key)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void AddReturningPeerLocked(absl::string_view peer_key)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  Mutex mu_;
+  int max_concurrent_handshakes_ ABSL_GUARDED_BY(mu_) =
+      std::numeric_limits<int>::max();
+  int max_queued_handshakes_ ABSL_GUARDED_BY(mu_) =
+      std::numeric_limits<int>::max();
+  int running_handshakes_ ABSL_GUARDED_BY(mu_) = 0;
+  uint64_t next_ticket_ ABSL_GUARDED_BY(mu_) = 0;
+  // Queued handshakes, in the order they are admitted in.
+  WaiterList preferred_queue_ ABSL_GUARDED_BY(mu_);
+  WaiterList queue_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<uint64_t, QueuePosition> waiting_ ABSL_GUARDED_BY(mu_);
+  // Addresses of the peers that recently completed a handshake, oldest
+  // first.
+  std::deque<std::string> returning_peer_order_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_set<std::string> returning_peers_ ABSL_GUARDED_BY(mu_);
+};
+
+using HandshakeQuotaRefPtr = RefCountedPtr<HandshakeQuota>;
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_HANDSHAKE_QUOTA_H
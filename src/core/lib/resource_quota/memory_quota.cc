@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <map>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -34,6 +35,7 @@
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/mpscq.h"
 #include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
@@ -41,7 +43,10 @@
 #include "src/core/lib/promise/map.h"
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/seq.h"
+#include "src/core/lib/resource_quota/slab_allocator.h"
 #include "src/core/lib/slice/slice_refcount.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/util/useful.h"
 
 namespace grpc_core {
@@ -102,16 +107,19 @@ class MemoryQuotaTracker {
 
 // Reference count for a slice allocated by MemoryAllocator::MakeSlice.
 // Takes care of releasing memory back when the slice is destroyed.
+// The slice is either allocated with malloc, or from a slab allocator size
+// class (size_class_ >= 0).
 class SliceRefCount : public grpc_slice_refcount {
  public:
   SliceRefCount(
       std::shared_ptr<
           grpc_event_engine::experimental::internal::MemoryAllocatorImpl>
           allocator,
-      size_t size)
+      size_t size, int size_class = -1)
       : grpc_slice_refcount(Destroy),
         allocator_(std::move(allocator)),
-        size_(size) {
+        size_(size),
+        size_class_(size_class) {
     // Nothing to do here.
   }
   ~SliceRefCount() {
@@ -122,16 +130,26 @@ class SliceRefCount : public grpc_slice_refcount {
  private:
   static void Destroy(grpc_slice_refcount* p) {
     auto* rc = static_cast<SliceRefCount*>(p);
+    const int size_class = rc->size_class_;
     rc->~SliceRefCount();
-    free(rc);
+    if (size_class >= 0) {
+      SlabAllocator::Free(size_class, rc);
+    } else {
+      free(rc);
+    }
   }
 
   std::shared_ptr<
       grpc_event_engine::experimental::internal::MemoryAllocatorImpl>
       allocator_;
   size_t size_;
+  int size_class_;
 };
 
+static_assert(sizeof(SliceRefCount) <= SlabAllocator::kHeaderBytes,
+              "slab allocator size classes leave too little room for the "
+              "slice header");
+
 }  // namespace
 
 //
@@ -245,8 +263,10 @@ Poll<RefCountedPtr<ReclaimerQueue::Handle>> ReclaimerQueue::PollNext() {
 //
 
 GrpcMemoryAllocatorImpl::GrpcMemoryAllocatorImpl(
-    std::shared_ptr<BasicMemoryQuota> memory_quota)
-    : memory_quota_(memory_quota) {
+    std::shared_ptr<BasicMemoryQuota> memory_quota, absl::string_view tag)
+    : memory_quota_(memory_quota),
+      use_slab_allocator_(ConfigVars::Get().SliceSlabAllocator()),
+      tag_(tag) {
   memory_quota_->Take(
       /*allocator=*/this, taken_bytes_);
   memory_quota_->AddNewAllocator(this);
@@ -381,8 +401,22 @@ void GrpcMemoryAllocatorImpl::Replenish() {
 
 grpc_slice GrpcMemoryAllocatorImpl::MakeSlice(MemoryRequest request) {
   auto size = Reserve(request.Increase(sizeof(SliceRefCount)));
-  void* p = malloc(size);
-  new (p) SliceRefCount(shared_from_this(), size);
+  const int size_class =
+      use_slab_allocator_ ? SlabAllocator::SizeClassFor(size) : -1;
+  void* p;
+  if (size_class >= 0) {
+    // The slice keeps the length asked for, but the whole block counts
+    // against the quota.
+    const size_t wasted = SlabAllocator::SizeOf(size_class) - size;
+    global_stats().IncrementSlabAllocatorWastedBytes(wasted);
+    p = SlabAllocator::Allocate(size_class);
+    const size_t reserved =
+        wasted > 0 ? size + Reserve(MemoryRequest(wasted)) : size;
+    new (p) SliceRefCount(shared_from_this(), reserved, size_class);
+  } else {
+    p = malloc(size);
+    new (p) SliceRefCount(shared_from_this(), size);
+  }
   grpc_slice slice;
   slice.refcount = static_cast<SliceRefCount*>(p);
   slice.data.refcounted.bytes =
@@ -415,7 +449,9 @@ class BasicMemoryQuota::WaitForSweepPromise {
   uint64_t token_;
 };
 
-BasicMemoryQuota::BasicMemoryQuota(std::string name) : name_(std::move(name)) {}
+BasicMemoryQuota::BasicMemoryQuota(std::string name,
+                                   std::shared_ptr<BasicMemoryQuota> parent)
+    : parent_(std::move(parent)), name_(std::move(name)) {}
 
 void BasicMemoryQuota::Start() {
   auto self = shared_from_this();
@@ -486,16 +522,17 @@ void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
 
 void BasicMemoryQuota::SetSize(size_t new_size) {
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
+  // Resizing a quota does not change its parent's.
   if (old_size < new_size) {
     // We're growing the quota.
-    Return(new_size - old_size);
+    free_bytes_.fetch_add(new_size - old_size, std::memory_order_relaxed);
   } else {
     // We're shrinking the quota.
-    Take(/*allocator=*/nullptr, old_size - new_size);
+    TakeFromThisQuota(old_size - new_size);
   }
 }
 
-void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
+void BasicMemoryQuota::TakeFromThisQuota(size_t amount) {
   // If there's a request for nothing, then do nothing!
   if (amount == 0) return;
   DCHECK(amount <= std::numeric_limits<intptr_t>::max());
@@ -505,6 +542,12 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
     if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
   }
+}
+
+void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
+  if (amount == 0) return;
+  TakeFromThisQuota(amount);
+  if (parent_ != nullptr) parent_->Take(/*allocator=*/nullptr, amount);
 
   if (IsFreeLargeAllocatorEnabled()) {
     if (allocator == nullptr) return;
@@ -545,6 +588,7 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 
 void BasicMemoryQuota::Return(size_t amount) {
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
+  if (parent_ != nullptr) parent_->Return(amount);
 }
 
 void BasicMemoryQuota::AddNewAllocator(GrpcMemoryAllocatorImpl* allocator) {
@@ -560,6 +604,22 @@ void BasicMemoryQuota::AddNewAllocator(GrpcMemoryAllocatorImpl* allocator) {
   }
 }
 
+std::map<absl::string_view, size_t> BasicMemoryQuota::MemoryUsageByTag() {
+  std::map<absl::string_view, size_t> usage;
+  // Allocators are removed under their shard lock before being destroyed.
+  // An allocator moving between buckets during the walk may be counted
+  // twice or not at all.
+  for (AllocatorBucket* bucket : {&small_allocators_, &big_allocators_}) {
+    for (AllocatorBucket::Shard& shard : bucket->shards) {
+      MutexLock l(&shard.shard_mu);
+      for (GrpcMemoryAllocatorImpl* allocator : shard.allocators) {
+        usage[allocator->tag()] += allocator->GetUsedBytes();
+      }
+    }
+  }
+  return usage;
+}
+
 void BasicMemoryQuota::RemoveAllocator(GrpcMemoryAllocatorImpl* allocator) {
   if (GRPC_TRACE_FLAG_ENABLED(resource_quota)) {
     LOG(INFO) << "Removing allocator " << allocator;
@@ -787,13 +847,11 @@ MemoryAllocator MemoryQuota::CreateMemoryAllocator(
   return MemoryAllocator(std::move(impl));
 }
 
-MemoryOwner MemoryQuota::CreateMemoryOwner() {
-  // Note: we will likely want to add a name or some way to distinguish
-  // between memory owners once resource quota is fully rolled out and we need
-  // full metrics. One thing to note, however, is that manipulating the name
-  // here (e.g. concatenation) can add significant memory increase when many
-  // owners are created.
-  auto impl = std::make_shared<GrpcMemoryAllocatorImpl>(memory_quota_);
+MemoryOwner MemoryQuota::CreateMemoryOwner(absl::string_view tag) {
+  // Note: the tag is not copied, as manipulating names here (e.g.
+  // concatenation) can add significant memory increase when many owners are
+  // created.
+  auto impl = std::make_shared<GrpcMemoryAllocatorImpl>(memory_quota_, tag);
   return MemoryOwner(std::move(impl));
 }
 
@@ -801,4 +859,22 @@ std::vector<std::shared_ptr<BasicMemoryQuota>> AllMemoryQuotas() {
   return MemoryQuotaTracker::Get().All();
 }
 
+size_t ReadBufferSizeForMemoryPressure(size_t min_progress_size,
+                                       size_t target_length,
+                                       double memory_pressure) {
+  if (target_length <= min_progress_size) return min_progress_size;
+  if (memory_pressure <= kReadBufferShrinkMemoryPressure) return target_length;
+  const double scale =
+      std::max(0.0, (kReadBufferHighMemoryPressure - memory_pressure) /
+                        (kReadBufferHighMemoryPressure -
+                         kReadBufferShrinkMemoryPressure));
+  const size_t size =
+      min_progress_size +
+      static_cast<size_t>((target_length - min_progress_size) * scale);
+  if (size < target_length) {
+    global_stats().IncrementTcpReadBufferShrunkForMemoryPressure();
+  }
+  return size;
+}
+
 }  // namespace grpc_core
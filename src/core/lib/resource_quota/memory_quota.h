@@ -21,6 +21,7 @@
 #include <atomic>
 #include <cstddef>
 #include <limits>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -296,7 +297,11 @@ class BasicMemoryQuota final
     size_t max_recommended_allocation_size = 0;
   };
 
-  explicit BasicMemoryQuota(std::string name);
+  // Memory taken from a quota with a parent is also taken from the parent, so
+  // that the parent's pressure covers its whole subtree. Reclamation only runs
+  // in the quota that went into overcommit, on the allocators of that quota.
+  explicit BasicMemoryQuota(std::string name,
+                            std::shared_ptr<BasicMemoryQuota> parent = nullptr);
 
   // Start the reclamation activity.
   void Start();
@@ -324,6 +329,9 @@ class BasicMemoryQuota final
                           size_t old_free_bytes, size_t new_free_bytes);
   // Instantaneous memory pressure approximation.
   PressureInfo GetPressureInfo();
+  // Bytes used by the allocators of this quota, summed by allocator tag.
+  // Only meant for profiling: it locks every shard of allocators.
+  std::map<absl::string_view, size_t> MemoryUsageByTag();
   // Get a reclamation queue
   ReclaimerQueue* reclaimer_queue(size_t i) { return &reclaimers_[i]; }
 
@@ -352,6 +360,10 @@ class BasicMemoryQuota final
 
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
 
+  const std::shared_ptr<BasicMemoryQuota> parent_;
+
+  // Take memory from this quota only.
+  void TakeFromThisQuota(size_t amount);
   // Move allocator from big bucket to small bucket.
   void MaybeMoveAllocatorBigToSmall(GrpcMemoryAllocatorImpl* allocator);
   // Move allocator from small bucket to big bucket.
@@ -391,7 +403,8 @@ class BasicMemoryQuota final
 class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
  public:
   explicit GrpcMemoryAllocatorImpl(
-      std::shared_ptr<BasicMemoryQuota> memory_quota);
+      std::shared_ptr<BasicMemoryQuota> memory_quota,
+      absl::string_view tag = "untagged");
   ~GrpcMemoryAllocatorImpl() override;
 
   // Reserve bytes from the quota.
@@ -455,6 +468,17 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
     return free_bytes_.load(std::memory_order_relaxed);
   }
 
+  // Bytes taken from the quota and in use, ie. not cached for later use.
+  // Both counters are read separately, so a concurrent update may be half
+  // seen.
+  size_t GetUsedBytes() const {
+    size_t taken = taken_bytes_.load(std::memory_order_relaxed);
+    size_t free = free_bytes_.load(std::memory_order_relaxed);
+    return taken > free ? taken - free : 0;
+  }
+
+  absl::string_view tag() const { return tag_; }
+
   size_t IncrementShardIndex() {
     return chosen_shard_idx_.fetch_add(1, std::memory_order_relaxed);
   }
@@ -479,6 +503,10 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
 
   // Backing resource quota.
   const std::shared_ptr<BasicMemoryQuota> memory_quota_;
+  // Whether MakeSlice() allocates from the SlabAllocator.
+  const bool use_slab_allocator_;
+  // The subsystem the memory is accounted to.
+  const absl::string_view tag_;
   // Amount of memory this allocator has cached for its own use: to avoid quota
   // contention, each MemoryAllocator can keep some memory in addition to what
   // it is immediately using, and the quota can pull it back under memory
@@ -548,8 +576,11 @@ class MemoryOwner final : public MemoryAllocator {
 class MemoryQuota final
     : public grpc_event_engine::experimental::MemoryAllocatorFactory {
  public:
-  explicit MemoryQuota(std::string name)
-      : memory_quota_(std::make_shared<BasicMemoryQuota>(std::move(name))) {
+  // Allocations from a quota with a \a parent are charged to both.
+  explicit MemoryQuota(std::string name, const MemoryQuota* parent = nullptr)
+      : memory_quota_(std::make_shared<BasicMemoryQuota>(
+            std::move(name),
+            parent == nullptr ? nullptr : parent->memory_quota_)) {
     memory_quota_->Start();
   }
   ~MemoryQuota() override {
@@ -562,7 +593,10 @@ class MemoryQuota final
   MemoryQuota& operator=(MemoryQuota&&) = default;
 
   MemoryAllocator CreateMemoryAllocator(absl::string_view name) override;
-  MemoryOwner CreateMemoryOwner();
+  // tag names the subsystem the memory of the owner is accounted to in
+  // MemoryUsageByTag(). It is kept by reference, so that tagging costs
+  // nothing per owner: it must have static storage duration.
+  MemoryOwner CreateMemoryOwner(absl::string_view tag = "untagged");
 
   // Resize the quota to new_size.
   void SetSize(size_t new_size) { memory_quota_->SetSize(new_size); }
@@ -574,6 +608,16 @@ class MemoryQuota final
            kMemoryPressureHighThreshold;
   }
 
+  // Instantaneous memory pressure of the quota.
+  BasicMemoryQuota::PressureInfo GetPressureInfo() const {
+    return memory_quota_->GetPressureInfo();
+  }
+
+  // Bytes in use in the quota, by tag of their owner.
+  std::map<absl::string_view, size_t> MemoryUsageByTag() const {
+    return memory_quota_->MemoryUsageByTag();
+  }
+
  private:
   friend class MemoryOwner;
   std::shared_ptr<BasicMemoryQuota> memory_quota_;
@@ -586,6 +630,22 @@ inline MemoryQuotaRefPtr MakeMemoryQuota(std::string name) {
 
 std::vector<std::shared_ptr<BasicMemoryQuota>> AllMemoryQuotas();
 
+// Memory pressure above which read buffers start to shrink.
+constexpr double kReadBufferShrinkMemoryPressure = 0.5;
+// Memory pressure from which reads only allocate what they need to make
+// progress.
+constexpr double kReadBufferHighMemoryPressure = 0.8;
+
+// Returns how many bytes a read that needs \a min_progress_size bytes to make
+// progress, and expects \a target_length bytes, should allocate at
+// \a memory_pressure. Up to kReadBufferShrinkMemoryPressure it gets its
+// target. Above that, the part of the target beyond min_progress_size shrinks
+// linearly, down to nothing at kReadBufferHighMemoryPressure and above, so
+// that buffers give way well before a reclamation pass has to take them.
+size_t ReadBufferSizeForMemoryPressure(size_t min_progress_size,
+                                       size_t target_length,
+                                       double memory_pressure);
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_MEMORY_QUOTA_H
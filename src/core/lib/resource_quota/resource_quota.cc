@@ -14,16 +14,96 @@
 
 #include "src/core/lib/resource_quota/resource_quota.h"
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+
 #include <grpc/support/port_platform.h>
 
 namespace grpc_core {
 
 ResourceQuota::ResourceQuota(std::string name)
-    : memory_quota_(MakeMemoryQuota(std::move(name))),
-      thread_quota_(MakeRefCounted<ThreadQuota>()) {}
+    : ResourceQuota(std::move(name), nullptr) {}
+
+ResourceQuota::ResourceQuota(std::string name, ResourceQuota* parent)
+    : memory_quota_(std::make_shared<MemoryQuota>(
+          std::move(name),
+          parent == nullptr ? nullptr : parent->memory_quota_.get())),
+      thread_quota_(MakeRefCounted<ThreadQuota>(
+          parent == nullptr ? nullptr : parent->thread_quota_)),
+      handshake_quota_(MakeRefCounted<HandshakeQuota>()) {}
 
 ResourceQuota::~ResourceQuota() = default;
 
+void ResourceQuota::SetMemorySize(size_t new_size) {
+  MutexLock lock(&mu_);
+  memory_size_ = new_size;
+  memory_quota_->SetSize(new_size);
+  DivideAmongChildren();
+}
+
+void ResourceQuota::SetMaxThreads(size_t new_max) {
+  MutexLock lock(&mu_);
+  max_threads_ = new_max;
+  thread_quota_->SetMax(new_max);
+  DivideAmongChildren();
+}
+
+ResourceQuotaRefPtr ResourceQuota::CreateChild(std::string name,
+                                               ChildOptions options) {
+  ResourceQuotaRefPtr child(new ResourceQuota(name, this));
+  MutexLock lock(&mu_);
+  children_[std::move(name)] = Child{child, options};
+  DivideAmongChildren();
+  return child;
+}
+
+void ResourceQuota::RemoveChild(absl::string_view name) {
+  MutexLock lock(&mu_);
+  auto it = children_.find(name);
+  if (it == children_.end()) return;
+  children_.erase(it);
+  DivideAmongChildren();
+}
+
+ResourceQuotaRefPtr ResourceQuota::FindChild(absl::string_view name) {
+  MutexLock lock(&mu_);
+  auto it = children_.find(name);
+  if (it == children_.end()) return nullptr;
+  return it->second.quota;
+}
+
+void ResourceQuota::DivideAmongChildren() {
+  size_t min_memory = 0;
+  size_t min_threads = 0;
+  double total_weight = 0;
+  for (const auto& name_and_child : children_) {
+    const ChildOptions& options = name_and_child.second.options;
+    min_memory += options.min_memory;
+    min_threads += options.min_threads;
+    total_weight += std::max(0.0, options.weight);
+  }
+  auto share = [total_weight](size_t total, size_t all_mins, size_t min,
+                              double weight) {
+    if (total <= all_mins || total_weight <= 0) return min;
+    return min + static_cast<size_t>((total - all_mins) *
+                                     (std::max(0.0, weight) / total_weight));
+  };
+  for (const auto& name_and_child : children_) {
+    const Child& child = name_and_child.second;
+    if (memory_size_.has_value()) {
+      child.quota->SetMemorySize(share(*memory_size_, min_memory,
+                                       child.options.min_memory,
+                                       child.options.weight));
+    }
+    if (max_threads_.has_value()) {
+      child.quota->SetMaxThreads(share(*max_threads_, min_threads,
+                                       child.options.min_threads,
+                                       child.options.weight));
+    }
+  }
+}
+
 ResourceQuotaRefPtr ResourceQuota::Default() {
   static auto default_resource_quota =
       MakeResourceQuota("default_resource_quota").release();
@@ -15,10 +15,16 @@
 #ifndef GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_RESOURCE_QUOTA_H
 #define GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_RESOURCE_QUOTA_H
 
+#include <stddef.h>
+
+#include <functional>
+#include <map>
 #include <string>
 #include <utility>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
@@ -27,6 +33,8 @@
 #include "src/core/lib/gprpp/cpp_impl_of.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/resource_quota/handshake_quota.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/thread_quota.h"
 #include "src/core/util/useful.h"
@@ -37,9 +45,26 @@ class ResourceQuota;
 
 using ResourceQuotaRefPtr = RefCountedPtr<ResourceQuota>;
 
+// Quotas form a tree: the memory and threads used under a child quota are
+// also charged to its parent, while reclamation and memory pressure are
+// handled per quota, so that a child running out of memory only reclaims
+// from its own allocators. Each child is guaranteed a minimum of its
+// parent's memory and threads, and shares the rest with its siblings by
+// weight.
 class ResourceQuota : public RefCounted<ResourceQuota>,
                       public CppImplOf<ResourceQuota, grpc_resource_quota> {
  public:
+  // How a child shares the memory and threads of its parent.
+  struct ChildOptions {
+    // Set aside for the child before the rest is shared. Minimums adding up
+    // to more than the parent has are still given in full.
+    size_t min_memory = 0;
+    size_t min_threads = 0;
+    // The child's share, relative to its siblings', of what the parent has
+    // beyond their minimums.
+    double weight = 1;
+  };
+
   explicit ResourceQuota(std::string name);
   ~ResourceQuota() override;
 
@@ -52,6 +77,24 @@ class ResourceQuota : public RefCounted<ResourceQuota>,
 
   const RefCountedPtr<ThreadQuota>& thread_quota() { return thread_quota_; }
 
+  const HandshakeQuotaRefPtr& handshake_quota() { return handshake_quota_; }
+
+  // Resize the memory quota, or set the max threads, and divide the new
+  // value among the children of this quota.
+  void SetMemorySize(size_t new_size);
+  void SetMaxThreads(size_t new_max);
+
+  // Creates a child of this quota named \a name, replacing any child already
+  // named so. Its memory size and max threads are recomputed from \a options
+  // whenever this quota is resized or gains or loses a child; until this
+  // quota is given a size, they are unbounded.
+  ResourceQuotaRefPtr CreateChild(std::string name, ChildOptions options);
+  // Stops sharing this quota with the child named \a name. The child keeps
+  // its current sizes, and stays charged to this quota until released.
+  void RemoveChild(absl::string_view name);
+  // Returns the child named \a name, or nullptr.
+  ResourceQuotaRefPtr FindChild(absl::string_view name);
+
   // The default global resource quota
   static ResourceQuotaRefPtr Default();
 
@@ -61,8 +104,24 @@ class ResourceQuota : public RefCounted<ResourceQuota>,
   }
 
  private:
+  struct Child {
+    ResourceQuotaRefPtr quota;
+    ChildOptions options;
+  };
+
+  ResourceQuota(std::string name, ResourceQuota* parent);
+
+  // Gives each child its minimums plus its weighted share of the rest.
+  void DivideAmongChildren() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   MemoryQuotaRefPtr memory_quota_;
   RefCountedPtr<ThreadQuota> thread_quota_;
+  HandshakeQuotaRefPtr handshake_quota_;
+  // Taken before the children's.
+  Mutex mu_;
+  absl::optional<size_t> memory_size_ ABSL_GUARDED_BY(mu_);
+  absl::optional<size_t> max_threads_ ABSL_GUARDED_BY(mu_);
+  std::map<std::string, Child, std::less<>> children_ ABSL_GUARDED_BY(mu_);
 };
 
 inline ResourceQuotaRefPtr MakeResourceQuota(std::string name) {
@@ -0,0 +1,226 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/slab_allocator.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/log/check.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "src/core/util/useful.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr size_t kSizeClasses[SlabAllocator::kNumSizeClasses] = {
+    256 + SlabAllocator::kHeaderBytes,   1024 + SlabAllocator::kHeaderBytes,
+    4096 + SlabAllocator::kHeaderBytes,  8192 + SlabAllocator::kHeaderBytes,
+    12288 + SlabAllocator::kHeaderBytes, 16384 + SlabAllocator::kHeaderBytes,
+    32768 + SlabAllocator::kHeaderBytes, 65536 + SlabAllocator::kHeaderBytes,
+};
+
+// Each thread caches up to this many bytes of blocks of each size class...
+constexpr size_t kThreadCacheBytes = 128 * 1024;
+// ... but never more than kMaxThreadCacheBlocks, nor fewer than two, blocks.
+constexpr size_t kMaxThreadCacheBlocks = 32;
+// The shared cache holds up to this many bytes of blocks of each size class.
+constexpr size_t kSharedCacheBytes = 2 * 1024 * 1024;
+
+size_t ThreadCacheCapacity(int size_class) {
+  return Clamp(kThreadCacheBytes / kSizeClasses[size_class], size_t{2},
+               kMaxThreadCacheBlocks);
+}
+
+void ReleaseBlock(void* block) {
+  global_stats().IncrementSlabAllocatorBlocksReleased();
+  free(block);
+}
+
+class SharedCache {
+ public:
+  static SharedCache& Get() {
+    static SharedCache* cache = new SharedCache();
+    return *cache;
+  }
+
+  // Moves up to \a n blocks of \a size_class to \a out, and returns how many
+  // were moved.
+  size_t Take(int size_class, void** out, size_t n) {
+    Bin& bin = bins_[size_class];
+    MutexLock lock(&bin.mu);
+    n = std::min(n, bin.blocks.size());
+    std::copy(bin.blocks.end() - n, bin.blocks.end(), out);
+    bin.blocks.resize(bin.blocks.size() - n);
+    return n;
+  }
+
+  // Takes ownership of \a n blocks of \a size_class. Those that would take the
+  // cache over its limit are released.
+  void Put(int size_class, void* const* blocks, size_t n) {
+    Bin& bin = bins_[size_class];
+    const size_t max_blocks = kSharedCacheBytes / kSizeClasses[size_class];
+    size_t i = 0;
+    {
+      MutexLock lock(&bin.mu);
+      for (; i < n && bin.blocks.size() < max_blocks; ++i) {
+        bin.blocks.push_back(blocks[i]);
+      }
+    }
+    for (; i < n; ++i) ReleaseBlock(blocks[i]);
+  }
+
+  void ReleaseAll() {
+    for (Bin& bin : bins_) {
+      std::vector<void*> blocks;
+      {
+        MutexLock lock(&bin.mu);
+        blocks.swap(bin.blocks);
+      }
+      for (void* block : blocks) free(block);
+    }
+  }
+
+ private:
+  struct Bin {
+    Mutex mu;
+    std::vector<void*> blocks ABSL_GUARDED_BY(mu);
+  };
+
+  SharedCache() = default;
+
+  Bin bins_[SlabAllocator::kNumSizeClasses];
+};
+
+class ThreadCache;
+thread_local ThreadCache* g_thread_cache = nullptr;
+
+// The blocks cached by one thread. Only touched by that thread.
+class ThreadCache {
+ public:
+  ThreadCache() { g_thread_cache = this; }
+  ~ThreadCache() {
+    g_thread_cache = nullptr;
+    Flush();
+  }
+
+  // Returns a cached block of \a size_class, or nullptr if there is none
+  // either here or in the shared cache.
+  void* Pop(int size_class) {
+    Bin& bin = bins_[size_class];
+    if (bin.count == 0) {
+      bin.count = SharedCache::Get().Take(
+          size_class, bin.blocks,
+          std::max<size_t>(1, ThreadCacheCapacity(size_class) / 2));
+      if (bin.count == 0) return nullptr;
+    }
+    return bin.blocks[--bin.count];
+  }
+
+  void Push(int size_class, void* block) {
+    Bin& bin = bins_[size_class];
+    const size_t capacity = ThreadCacheCapacity(size_class);
+    if (bin.count == capacity) {
+      // Hand the older half over to the shared cache, for other threads.
+      const size_t n = capacity / 2;
+      SharedCache::Get().Put(size_class, bin.blocks, n);
+      std::copy(bin.blocks + n, bin.blocks + bin.count, bin.blocks);
+      bin.count -= n;
+    }
+    bin.blocks[bin.count++] = block;
+  }
+
+  void Flush() {
+    for (int size_class = 0; size_class < SlabAllocator::kNumSizeClasses;
+         ++size_class) {
+      Bin& bin = bins_[size_class];
+      SharedCache::Get().Put(size_class, bin.blocks, bin.count);
+      bin.count = 0;
+    }
+  }
+
+ private:
+  struct Bin {
+    void* blocks[kMaxThreadCacheBlocks];
+    size_t count = 0;
+  };
+
+  Bin bins_[SlabAllocator::kNumSizeClasses];
+};
+
+// Returns the calling thread's cache, or nullptr if the thread is exiting and
+// its cache has already been destroyed.
+ThreadCache* GetThreadCache() {
+  // Constructed on first use; when the thread exits its destructor resets
+  // g_thread_cache, and from then on only the shared cache is used.
+  static thread_local ThreadCache cache;
+  return g_thread_cache;
+}
+
+}  // namespace
+
+int SlabAllocator::SizeClassFor(size_t size) {
+  for (int size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+    if (size <= kSizeClasses[size_class]) return size_class;
+  }
+  return -1;
+}
+
+size_t SlabAllocator::SizeOf(int size_class) {
+  DCHECK_GE(size_class, 0);
+  DCHECK_LT(size_class, kNumSizeClasses);
+  return kSizeClasses[size_class];
+}
+
+void* SlabAllocator::Allocate(int size_class) {
+  ThreadCache* cache = GetThreadCache();
+  void* block = nullptr;
+  if (cache != nullptr) {
+    block = cache->Pop(size_class);
+  } else {
+    SharedCache::Get().Take(size_class, &block, 1);
+  }
+  if (block != nullptr) {
+    global_stats().IncrementSlabAllocatorCacheHits();
+    return block;
+  }
+  global_stats().IncrementSlabAllocatorCacheMisses();
+  return malloc(kSizeClasses[size_class]);
+}
+
+void SlabAllocator::Free(int size_class, void* block) {
+  ThreadCache* cache = GetThreadCache();
+  if (cache != nullptr) {
+    cache->Push(size_class, block);
+  } else {
+    SharedCache::Get().Put(size_class, &block, 1);
+  }
+}
+
+void SlabAllocator::TestOnlyReleaseCachedBlocks() {
+  ThreadCache* cache = GetThreadCache();
+  if (cache != nullptr) cache->Flush();
+  SharedCache::Get().ReleaseAll();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,61 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_SLAB_ALLOCATOR_H
+#define GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_SLAB_ALLOCATOR_H
+
+#include <stddef.h>
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+
+// Allocates memory in a fixed set of block sizes ("size classes") and keeps
+// freed blocks around for reuse, so that the memory allocator slices that are
+// churned through by transports (read buffers, frames) do not hit malloc and
+// free every time.
+//
+// Freed blocks go to a small per-thread cache first. When that fills up half of
+// it is moved to a shared, mutex-protected cache; threads whose cache is empty
+// refill it from there. Both caches are bounded: blocks that do not fit are
+// returned to the system allocator.
+//
+// Size classes are sized for the transport read sizes (8k, 12k and 64k),
+// plus kHeaderBytes for the control structure that precedes a slice's data.
+class SlabAllocator {
+ public:
+  // Space reserved in each size class for the header of the allocation.
+  static constexpr size_t kHeaderBytes = 64;
+  static constexpr int kNumSizeClasses = 8;
+
+  // Returns the index of the smallest size class that can hold \a size bytes,
+  // or -1 if \a size is larger than the largest size class.
+  static int SizeClassFor(size_t size);
+  // Returns the number of bytes in a block of \a size_class.
+  static size_t SizeOf(int size_class);
+
+  // Returns a block of SizeOf(size_class) bytes.
+  static void* Allocate(int size_class);
+  // Returns \a block, obtained from Allocate(size_class), to the caches.
+  // May be called from any thread.
+  static void Free(int size_class, void* block);
+
+  // Returns all the blocks cached by the calling thread and by the shared
+  // cache to the system allocator. For tests.
+  static void TestOnlyReleaseCachedBlocks();
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_SLAB_ALLOCATOR_H
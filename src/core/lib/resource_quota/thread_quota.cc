@@ -14,6 +14,8 @@
 
 #include "src/core/lib/resource_quota/thread_quota.h"
 
+#include <utility>
+
 #include "absl/log/check.h"
 
 #include <grpc/support/log.h>
@@ -21,7 +23,8 @@
 
 namespace grpc_core {
 
-ThreadQuota::ThreadQuota() = default;
+ThreadQuota::ThreadQuota(RefCountedPtr<ThreadQuota> parent)
+    : parent_(std::move(parent)) {}
 
 ThreadQuota::~ThreadQuota() = default;
 
@@ -33,6 +36,7 @@ void ThreadQuota::SetMax(size_t new_max) {
 bool ThreadQuota::Reserve(size_t num_threads) {
   MutexLock lock(&mu_);
   if (allocated_ + num_threads > max_) return false;
+  if (parent_ != nullptr && !parent_->Reserve(num_threads)) return false;
   allocated_ += num_threads;
   return true;
 }
@@ -41,6 +45,7 @@ void ThreadQuota::Release(size_t num_threads) {
   MutexLock lock(&mu_);
   CHECK(num_threads <= allocated_);
   allocated_ -= num_threads;
+  if (parent_ != nullptr) parent_->Release(num_threads);
 }
 
 }  // namespace grpc_core
@@ -31,7 +31,9 @@ namespace grpc_core {
 // Tracks the amount of threads in a resource quota.
 class ThreadQuota : public RefCounted<ThreadQuota> {
  public:
-  ThreadQuota();
+  // Threads reserved from a quota with a parent are also reserved from the
+  // parent, and from its parent in turn.
+  explicit ThreadQuota(RefCountedPtr<ThreadQuota> parent = nullptr);
   ~ThreadQuota() override;
 
   ThreadQuota(const ThreadQuota&) = delete;
@@ -49,6 +51,8 @@ class ThreadQuota : public RefCounted<ThreadQuota> {
   void Release(size_t num_threads);
 
  private:
+  const RefCountedPtr<ThreadQuota> parent_;
+  // Taken before the parent's.
   Mutex mu_;
   size_t allocated_ ABSL_GUARDED_BY(mu_) = 0;
   size_t max_ ABSL_GUARDED_BY(mu_) = std::numeric_limits<size_t>::max();
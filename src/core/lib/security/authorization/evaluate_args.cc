@@ -16,6 +16,8 @@
 
 #include <string.h>
 
+#include <memory>
+
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
@@ -87,6 +89,20 @@ EvaluateArgs::PerChannelArgs::PerChannelArgs(grpc_auth_context* auth_context,
       args.GetString(GRPC_ARG_ENDPOINT_PEER_ADDRESS).value_or(""));
 }
 
+std::shared_ptr<const std::vector<bool>>
+EvaluateArgs::PerChannelArgs::PrincipalMatchCache::Get(
+    uint64_t engine_id,
+    absl::FunctionRef<std::vector<bool>()> compute_matches) {
+  MutexLock lock(&mu_);
+  for (const auto& entry : matches_) {
+    if (entry.first == engine_id) return entry.second;
+  }
+  if (matches_.size() == kMaxEngines) matches_.erase(matches_.begin());
+  matches_.emplace_back(engine_id, std::make_shared<const std::vector<bool>>(
+                                       compute_matches()));
+  return matches_.back().second;
+}
+
 absl::string_view EvaluateArgs::GetPath() const {
   if (metadata_ != nullptr) {
     const auto* path = metadata_->get_pointer(HttpPathMetadata());
@@ -216,4 +232,13 @@ absl::string_view EvaluateArgs::GetSubject() const {
   return channel_args_->subject;
 }
 
+std::shared_ptr<const std::vector<bool>> EvaluateArgs::GetPrincipalMatches(
+    uint64_t engine_id,
+    absl::FunctionRef<std::vector<bool>()> compute_matches) const {
+  if (channel_args_ == nullptr) {
+    return std::make_shared<const std::vector<bool>>(compute_matches());
+  }
+  return channel_args_->principal_match_cache->Get(engine_id, compute_matches);
+}
+
 }  // namespace grpc_core
@@ -15,9 +15,15 @@
 #ifndef GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_EVALUATE_ARGS_H
 #define GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_EVALUATE_ARGS_H
 
+#include <stdint.h>
+
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/function_ref.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
@@ -25,6 +31,7 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/resolved_address.h"
 #include "src/core/lib/transport/metadata_batch.h"
 
@@ -43,6 +50,26 @@ class EvaluateArgs final {
       int port = 0;
     };
 
+    // Principal match results of the authorization engines evaluated on the
+    // channel. They only depend on the fields above, so each engine computes
+    // them once per channel rather than once per call.
+    class PrincipalMatchCache {
+     public:
+      std::shared_ptr<const std::vector<bool>> Get(
+          uint64_t engine_id,
+          absl::FunctionRef<std::vector<bool>()> compute_matches);
+
+     private:
+      // A channel rarely sees more than an allow and a deny engine at once,
+      // beyond that the oldest results are dropped.
+      static constexpr size_t kMaxEngines = 4;
+
+      Mutex mu_;
+      std::vector<
+          std::pair<uint64_t, std::shared_ptr<const std::vector<bool>>>>
+          matches_ ABSL_GUARDED_BY(mu_);
+    };
+
     PerChannelArgs(grpc_auth_context* auth_context, const ChannelArgs& args);
 
     absl::string_view transport_security_type;
@@ -53,6 +80,8 @@ class EvaluateArgs final {
     absl::string_view subject;
     Address local_address;
     Address peer_address;
+    std::unique_ptr<PrincipalMatchCache> principal_match_cache =
+        std::make_unique<PrincipalMatchCache>();
   };
 
   EvaluateArgs(grpc_metadata_batch* metadata, PerChannelArgs* channel_args)
@@ -84,6 +113,13 @@ class EvaluateArgs final {
   absl::string_view GetCommonName() const;
   absl::string_view GetSubject() const;
 
+  // Returns the principal match results of the authorization engine
+  // \a engine_id for this channel, calling \a compute_matches only the first
+  // time they are needed on the channel.
+  std::shared_ptr<const std::vector<bool>> GetPrincipalMatches(
+      uint64_t engine_id,
+      absl::FunctionRef<std::vector<bool>()> compute_matches) const;
+
  private:
   grpc_metadata_batch* metadata_;
   PerChannelArgs* channel_args_;
@@ -15,14 +15,17 @@
 #include "src/core/lib/security/authorization/grpc_authorization_engine.h"
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <utility>
 
+#include "absl/container/flat_hash_set.h"
 #include "absl/log/check.h"
 
 #include <grpc/support/log.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/matchers/matchers.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/lib/security/authorization/authorization_engine.h"
 
@@ -44,17 +47,104 @@ bool ShouldLog(const Decision& decision,
           condition == Rbac::AuditCondition::kOnDeny);
 }
 
+uint64_t NextEngineId() {
+  static std::atomic<uint64_t> next_id{0};
+  return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Returns the paths that a call must have for \a permission to match, or
+// nullopt if it can match paths that are not known in advance.
+absl::optional<std::vector<std::string>> ExactPaths(
+    const Rbac::Permission& permission) {
+  switch (permission.type) {
+    case Rbac::Permission::RuleType::kPath:
+      if (permission.string_matcher.type() == StringMatcher::Type::kExact &&
+          permission.string_matcher.case_sensitive()) {
+        return std::vector<std::string>{
+            permission.string_matcher.string_matcher()};
+      }
+      return absl::nullopt;
+    case Rbac::Permission::RuleType::kOr: {
+      std::vector<std::string> paths;
+      for (const auto& child : permission.permissions) {
+        auto child_paths = ExactPaths(*child);
+        if (!child_paths.has_value()) return absl::nullopt;
+        paths.insert(paths.end(), child_paths->begin(), child_paths->end());
+      }
+      return paths;
+    }
+    case Rbac::Permission::RuleType::kAnd: {
+      // Any child restricts the paths, pick the most selective one.
+      absl::optional<std::vector<std::string>> paths;
+      for (const auto& child : permission.permissions) {
+        auto child_paths = ExactPaths(*child);
+        if (child_paths.has_value() &&
+            (!paths.has_value() || child_paths->size() < paths->size())) {
+          paths = std::move(child_paths);
+        }
+      }
+      return paths;
+    }
+    default:
+      return absl::nullopt;
+  }
+}
+
+// Returns true if \a principal matches the same way for every call of a
+// channel.
+bool DependsOnlyOnChannel(const Rbac::Principal& principal) {
+  switch (principal.type) {
+    case Rbac::Principal::RuleType::kHeader:
+    case Rbac::Principal::RuleType::kPath:
+      return false;
+    case Rbac::Principal::RuleType::kAnd:
+    case Rbac::Principal::RuleType::kOr:
+    case Rbac::Principal::RuleType::kNot:
+      return std::all_of(principal.principals.begin(),
+                         principal.principals.end(),
+                         [](const std::unique_ptr<Rbac::Principal>& child) {
+                           return DependsOnlyOnChannel(*child);
+                         });
+    default:
+      return true;
+  }
+}
+
 }  // namespace
 
+GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac::Action action)
+    : id_(NextEngineId()),
+      action_(action),
+      audit_condition_(Rbac::AuditCondition::kNone) {}
+
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
-    : name_(std::move(policy.name)),
+    : id_(NextEngineId()),
+      name_(std::move(policy.name)),
       action_(policy.action),
       audit_condition_(policy.audit_condition) {
   for (auto& sub_policy : policy.policies) {
+    const size_t index = policies_.size();
+    auto paths = ExactPaths(sub_policy.second.permissions);
+    if (paths.has_value()) {
+      absl::flat_hash_set<absl::string_view> seen;
+      for (const auto& path : *paths) {
+        if (seen.insert(path).second) {
+          policies_by_exact_path_[path].push_back(index);
+        }
+      }
+    } else {
+      policies_without_exact_path_.push_back(index);
+    }
     Policy policy;
     policy.name = sub_policy.first;
-    policy.matcher = std::make_unique<PolicyAuthorizationMatcher>(
-        std::move(sub_policy.second));
+    if (DependsOnlyOnChannel(sub_policy.second.principals)) {
+      policy.principal_match_index = per_channel_principal_policies_.size();
+      per_channel_principal_policies_.push_back(index);
+    }
+    policy.permissions = AuthorizationMatcher::Create(
+        std::move(sub_policy.second.permissions));
+    policy.principals = AuthorizationMatcher::Create(
+        std::move(sub_policy.second.principals));
     policies_.push_back(std::move(policy));
   }
   for (auto& logger_config : policy.logger_configs) {
@@ -67,17 +157,28 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     GrpcAuthorizationEngine&& other) noexcept
-    : name_(std::move(other.name_)),
+    : id_(other.id_),
+      name_(std::move(other.name_)),
       action_(other.action_),
       policies_(std::move(other.policies_)),
+      policies_by_exact_path_(std::move(other.policies_by_exact_path_)),
+      policies_without_exact_path_(
+          std::move(other.policies_without_exact_path_)),
+      per_channel_principal_policies_(
+          std::move(other.per_channel_principal_policies_)),
       audit_condition_(other.audit_condition_),
       audit_loggers_(std::move(other.audit_loggers_)) {}
 
 GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
     GrpcAuthorizationEngine&& other) noexcept {
+  id_ = other.id_;
   name_ = std::move(other.name_);
   action_ = other.action_;
   policies_ = std::move(other.policies_);
+  policies_by_exact_path_ = std::move(other.policies_by_exact_path_);
+  policies_without_exact_path_ = std::move(other.policies_without_exact_path_);
+  per_channel_principal_policies_ =
+      std::move(other.per_channel_principal_policies_);
   audit_condition_ = other.audit_condition_;
   audit_loggers_ = std::move(other.audit_loggers_);
   return *this;
@@ -87,8 +188,29 @@ AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
     const EvaluateArgs& args) const {
   Decision decision;
   bool matches = false;
-  for (const auto& policy : policies_) {
-    if (policy.matcher->Matches(args)) {
+  const std::vector<size_t>* path_policies = nullptr;
+  if (!policies_by_exact_path_.empty()) {
+    auto it = policies_by_exact_path_.find(args.GetPath());
+    if (it != policies_by_exact_path_.end()) path_policies = &it->second;
+  }
+  // Walks both index lists in policy order, so that the first matching policy
+  // is the same as with a linear scan.
+  std::shared_ptr<const std::vector<bool>> principal_matches;
+  size_t i = 0;
+  size_t j = 0;
+  const size_t num_path_policies =
+      path_policies == nullptr ? 0 : path_policies->size();
+  while (i < num_path_policies || j < policies_without_exact_path_.size()) {
+    size_t index;
+    if (j == policies_without_exact_path_.size() ||
+        (i < num_path_policies &&
+         (*path_policies)[i] < policies_without_exact_path_[j])) {
+      index = (*path_policies)[i++];
+    } else {
+      index = policies_without_exact_path_[j++];
+    }
+    const Policy& policy = policies_[index];
+    if (PolicyMatches(policy, args, &principal_matches)) {
       matches = true;
       decision.matching_policy_name = policy.name;
       break;
@@ -107,4 +229,28 @@ AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
   return decision;
 }
 
+bool GrpcAuthorizationEngine::PolicyMatches(
+    const Policy& policy, const EvaluateArgs& args,
+    std::shared_ptr<const std::vector<bool>>* principal_matches) const {
+  if (!policy.permissions->Matches(args)) return false;
+  if (!policy.principal_match_index.has_value()) {
+    return policy.principals->Matches(args);
+  }
+  if (*principal_matches == nullptr) {
+    *principal_matches = args.GetPrincipalMatches(
+        id_, [this, &args]() { return ComputePrincipalMatches(args); });
+  }
+  return (**principal_matches)[*policy.principal_match_index];
+}
+
+std::vector<bool> GrpcAuthorizationEngine::ComputePrincipalMatches(
+    const EvaluateArgs& args) const {
+  std::vector<bool> matches;
+  matches.reserve(per_channel_principal_policies_.size());
+  for (size_t index : per_channel_principal_policies_) {
+    matches.push_back(policies_[index].principals->Matches(args));
+  }
+  return matches;
+}
+
 }  // namespace grpc_core
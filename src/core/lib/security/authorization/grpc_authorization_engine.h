@@ -16,11 +16,15 @@
 #define GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_GRPC_AUTHORIZATION_ENGINE_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/optional.h"
+
 #include <grpc/grpc_audit_logging.h>
 #include <grpc/support/port_platform.h>
 
@@ -39,11 +43,16 @@ using experimental::AuditLogger;
 // engine type. This engine ignores condition field in RBAC config. It is the
 // caller's responsibility to provide RBAC policies that are compatible with
 // this engine.
+//
+// Policies are compiled when the engine is built: the policies whose
+// permissions can only match a fixed set of exact paths are indexed by those
+// paths, so that a call is only matched against the policies that can apply
+// to its path, and principals that only depend on the peer are matched once
+// per channel rather than once per call.
 class GrpcAuthorizationEngine : public AuthorizationEngine {
  public:
   // Builds GrpcAuthorizationEngine without any policies.
-  explicit GrpcAuthorizationEngine(Rbac::Action action)
-      : action_(action), audit_condition_(Rbac::AuditCondition::kNone) {}
+  explicit GrpcAuthorizationEngine(Rbac::Action action);
   // Builds GrpcAuthorizationEngine with allow/deny RBAC policy.
   explicit GrpcAuthorizationEngine(Rbac policy);
 
@@ -70,12 +79,30 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
  private:
   struct Policy {
     std::string name;
-    std::unique_ptr<AuthorizationMatcher> matcher;
+    std::unique_ptr<AuthorizationMatcher> permissions;
+    std::unique_ptr<AuthorizationMatcher> principals;
+    // Index of the result of principals in the per-channel principal
+    // matches, set if principals only depend on the channel.
+    absl::optional<size_t> principal_match_index;
   };
 
+  bool PolicyMatches(
+      const Policy& policy, const EvaluateArgs& args,
+      std::shared_ptr<const std::vector<bool>>* principal_matches) const;
+  std::vector<bool> ComputePrincipalMatches(const EvaluateArgs& args) const;
+
+  // Identifies the engine in the per-channel principal matches.
+  uint64_t id_;
   std::string name_;
   Rbac::Action action_;
   std::vector<Policy> policies_;
+  // Indexes in policies_, in ascending order, of the policies that can match
+  // a path, and of those that can match any path.
+  absl::flat_hash_map<std::string, std::vector<size_t>>
+      policies_by_exact_path_;
+  std::vector<size_t> policies_without_exact_path_;
+  // Indexes in policies_ of the policies with a principal_match_index.
+  std::vector<size_t> per_channel_principal_policies_;
   Rbac::AuditCondition audit_condition_;
   std::vector<std::unique_ptr<AuditLogger>> audit_loggers_;
 };
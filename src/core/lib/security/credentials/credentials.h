@@ -61,6 +61,12 @@ typedef enum {
 
 #define GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS 60
 
+// Backoff between failed attempts to refresh a token that is still valid.
+#define GRPC_SECURE_TOKEN_REFRESH_INITIAL_BACKOFF_SECS 1
+#define GRPC_SECURE_TOKEN_REFRESH_BACKOFF_MULTIPLIER 1.6
+#define GRPC_SECURE_TOKEN_REFRESH_BACKOFF_JITTER 0.2
+#define GRPC_SECURE_TOKEN_REFRESH_MAX_BACKOFF_SECS 60
+
 #define GRPC_COMPUTE_ENGINE_METADATA_HOST "metadata.google.internal."
 #define GRPC_COMPUTE_ENGINE_METADATA_TOKEN_PATH \
   "/computeMetadata/v1/instance/service-accounts/default/token"
@@ -20,6 +20,7 @@
 #include <inttypes.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -37,6 +38,7 @@
 #include <grpc/support/sync.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/promise.h"
@@ -72,29 +74,42 @@ grpc_service_account_jwt_access_credentials::GetRequestMetadata(
   }
   // See if we can return a cached jwt.
   absl::optional<grpc_core::Slice> jwt_value;
+  bool refresh = false;
   {
     gpr_mu_lock(&cache_mu_);
-    if (cached_.has_value() && cached_->service_url == *uri &&
-        (gpr_time_cmp(
-             gpr_time_sub(cached_->jwt_expiration, gpr_now(GPR_CLOCK_REALTIME)),
-             refresh_threshold) > 0)) {
-      jwt_value = cached_->jwt_value.Ref();
+    gpr_timespec now = gpr_now(GPR_CLOCK_REALTIME);
+    auto it = cache_.find(*uri);
+    if (it != cache_.end() &&
+        gpr_time_cmp(gpr_time_sub(it->second.jwt_expiration, now),
+                     refresh_threshold) > 0) {
+      jwt_value = it->second.jwt_value.Ref();
+      it->second.last_used = now;
+      if (!it->second.refresh_pending &&
+          gpr_time_cmp(now, it->second.refresh_time) >= 0) {
+        it->second.refresh_pending = true;
+        refresh = true;
+      }
     }
     gpr_mu_unlock(&cache_mu_);
   }
 
+  if (refresh) {
+    grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+        [self = RefAsSubclass<grpc_service_account_jwt_access_credentials>(),
+         uri = *uri]() {
+          grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+          grpc_core::ExecCtx exec_ctx;
+          self->RefreshJwt(uri);
+        });
+  }
+
   if (!jwt_value.has_value()) {
-    char* jwt = nullptr;
     // Generate a new jwt.
     gpr_mu_lock(&cache_mu_);
-    cached_.reset();
-    jwt = grpc_jwt_encode_and_sign(&key_, uri->c_str(), jwt_lifetime_, nullptr);
-    if (jwt != nullptr) {
-      std::string md_value = absl::StrCat("Bearer ", jwt);
-      gpr_free(jwt);
-      jwt_value = grpc_core::Slice::FromCopiedString(md_value);
-      cached_ = {jwt_value->Ref(), std::move(*uri),
-                 gpr_time_add(gpr_now(GPR_CLOCK_REALTIME), jwt_lifetime_)};
+    cache_.erase(*uri);
+    jwt_value = SignJwt(*uri);
+    if (jwt_value.has_value()) {
+      CacheJwtLocked(*uri, jwt_value->Ref(), gpr_now(GPR_CLOCK_REALTIME));
     }
     gpr_mu_unlock(&cache_mu_);
   }
@@ -110,6 +125,72 @@ grpc_service_account_jwt_access_credentials::GetRequestMetadata(
   return grpc_core::Immediate(std::move(initial_metadata));
 }
 
+absl::optional<grpc_core::Slice>
+grpc_service_account_jwt_access_credentials::SignJwt(
+    const std::string& service_url) {
+  char* jwt = grpc_jwt_encode_and_sign(&key_, service_url.c_str(),
+                                       jwt_lifetime_, nullptr);
+  if (jwt == nullptr) return absl::nullopt;
+  std::string md_value = absl::StrCat("Bearer ", jwt);
+  gpr_free(jwt);
+  return grpc_core::Slice::FromCopiedString(md_value);
+}
+
+void grpc_service_account_jwt_access_credentials::CacheJwtLocked(
+    const std::string& service_url, grpc_core::Slice jwt_value,
+    gpr_timespec now) {
+  if (cache_.size() >= kMaxCachedJwts &&
+      cache_.find(service_url) == cache_.end()) {
+    auto lru = cache_.begin();
+    for (auto it = cache_.begin(); it != cache_.end(); ++it) {
+      if (gpr_time_cmp(it->second.last_used, lru->second.last_used) < 0) {
+        lru = it;
+      }
+    }
+    cache_.erase(lru);
+  }
+  gpr_timespec refresh_delay = gpr_time_from_micros(
+      static_cast<int64_t>(gpr_timespec_to_micros(jwt_lifetime_) * 3 / 4),
+      GPR_TIMESPAN);
+  cache_[service_url] = {
+      std::move(jwt_value),
+      gpr_time_add(now, jwt_lifetime_),
+      gpr_time_add(now, refresh_delay),
+      now,
+      /*refresh_pending=*/false,
+      grpc_core::Duration::Seconds(
+          GRPC_SECURE_TOKEN_REFRESH_INITIAL_BACKOFF_SECS)};
+}
+
+void grpc_service_account_jwt_access_credentials::RefreshJwt(
+    const std::string& service_url) {
+  absl::optional<grpc_core::Slice> jwt_value = SignJwt(service_url);
+  gpr_mu_lock(&cache_mu_);
+  auto it = cache_.find(service_url);
+  // The JWT may have been evicted, or replaced by a call that found it
+  // expired, in the meantime.
+  if (it != cache_.end() && it->second.refresh_pending) {
+    if (jwt_value.has_value()) {
+      gpr_timespec last_used = it->second.last_used;
+      CacheJwtLocked(service_url, std::move(*jwt_value),
+                     gpr_now(GPR_CLOCK_REALTIME));
+      cache_[service_url].last_used = last_used;
+    } else {
+      // Calls use the current JWT until it expires. The refresh is retried
+      // after a backoff rather than on the next call.
+      Cache& cached = it->second;
+      cached.refresh_pending = false;
+      cached.refresh_time = gpr_time_add(gpr_now(GPR_CLOCK_REALTIME),
+                                         cached.refresh_backoff.as_timespec());
+      cached.refresh_backoff = std::min(
+          cached.refresh_backoff * GRPC_SECURE_TOKEN_REFRESH_BACKOFF_MULTIPLIER,
+          grpc_core::Duration::Seconds(
+              GRPC_SECURE_TOKEN_REFRESH_MAX_BACKOFF_SECS));
+    }
+  }
+  gpr_mu_unlock(&cache_mu_);
+}
+
 grpc_service_account_jwt_access_credentials::
     grpc_service_account_jwt_access_credentials(grpc_auth_json_key key,
                                                 gpr_timespec token_lifetime)
@@ -19,8 +19,10 @@
 #ifndef GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_JWT_JWT_CREDENTIALS_H
 #define GRPC_SRC_CORE_LIB_SECURITY_CREDENTIALS_JWT_JWT_CREDENTIALS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <map>
 #include <string>
 
 #include "absl/status/statusor.h"
@@ -36,6 +38,7 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/security/credentials/credentials.h"
@@ -76,15 +79,30 @@ class grpc_service_account_jwt_access_credentials
         static_cast<const grpc_call_credentials*>(this), other);
   }
 
-  // Have a simple cache for now with just 1 entry. We could have a map based on
-  // the service_url for a more sophisticated one.
+  // Returns the authorization metadata value of a new JWT for service_url.
+  absl::optional<grpc_core::Slice> SignJwt(const std::string& service_url);
+  // Caches jwt_value for service_url, evicting the least recently used JWT if
+  // the cache is full.
+  void CacheJwtLocked(const std::string& service_url,
+                      grpc_core::Slice jwt_value, gpr_timespec now);
+  // Re-signs the JWT of service_url ahead of its expiration.
+  void RefreshJwt(const std::string& service_url);
+
+  // The JWTs of the kMaxCachedJwts most recently used service URLs. A JWT
+  // that is used after three quarters of its lifetime is re-signed in the
+  // background, so that calls to a service in use do not wait for signing.
+  static constexpr size_t kMaxCachedJwts = 64;
   gpr_mu cache_mu_;
   struct Cache {
     grpc_core::Slice jwt_value;
-    std::string service_url;
     gpr_timespec jwt_expiration;
+    gpr_timespec refresh_time;
+    gpr_timespec last_used;
+    bool refresh_pending;
+    // How long to wait before retrying a refresh that fails.
+    grpc_core::Duration refresh_backoff;
   };
-  absl::optional<Cache> cached_;
+  std::map<std::string, Cache> cache_;
 
   grpc_auth_json_key key_;
   gpr_timespec jwt_lifetime_;
@@ -255,15 +255,25 @@ void grpc_oauth2_token_fetcher_credentials::on_http_response(
   // Update cache and grab list of pending requests.
   gpr_mu_lock(&mu_);
   token_fetch_pending_ = false;
-  if (access_token_value.has_value()) {
+  if (status == GRPC_CREDENTIALS_OK) {
+    gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
     access_token_value_ = access_token_value->Ref();
-  } else {
+    token_expiration_ = gpr_time_add(now, token_lifetime.as_timespec());
+    token_refresh_time_ =
+        gpr_time_add(now, (token_lifetime * 0.75).as_timespec());
+    refresh_backoff_.Reset();
+  } else if (pending_requests_ != nullptr) {
     access_token_value_ = absl::nullopt;
+    token_expiration_ = gpr_inf_past(GPR_CLOCK_MONOTONIC);
+  } else {
+    // A background refresh failed. Calls keep using the current token until
+    // it expires, and the refresh is retried after a backoff rather than on
+    // the next call.
+    grpc_core::Duration delay =
+        refresh_backoff_.NextAttemptTime() - grpc_core::Timestamp::Now();
+    token_refresh_time_ =
+        gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC), delay.as_timespec());
   }
-  token_expiration_ = status == GRPC_CREDENTIALS_OK
-                          ? gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
-                                         token_lifetime.as_timespec())
-                          : gpr_inf_past(GPR_CLOCK_MONOTONIC);
   grpc_oauth2_pending_get_request_metadata* pending_request = pending_requests_;
   pending_requests_ = nullptr;
   gpr_mu_unlock(&mu_);
@@ -292,17 +302,30 @@ grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
     grpc_core::ClientMetadataHandle initial_metadata,
     const grpc_call_credentials::GetRequestMetadataArgs*) {
   // Check if we can use the cached token.
+  grpc_core::Duration refresh_threshold =
+      grpc_core::Duration::Seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS);
   absl::optional<grpc_core::Slice> cached_access_token_value;
   gpr_mu_lock(&mu_);
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
   if (access_token_value_.has_value() &&
-      gpr_time_cmp(
-          gpr_time_sub(token_expiration_, gpr_now(GPR_CLOCK_MONOTONIC)),
-          gpr_time_from_seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS,
-                                GPR_TIMESPAN)) > 0) {
+      gpr_time_cmp(gpr_time_sub(token_expiration_, now),
+                   refresh_threshold.as_timespec()) > 0) {
     cached_access_token_value = access_token_value_->Ref();
   }
   if (cached_access_token_value.has_value()) {
+    // Refresh the token in the background if it is getting old.
+    bool start_refresh = false;
+    if (!token_fetch_pending_ &&
+        gpr_time_cmp(now, token_refresh_time_) >= 0) {
+      token_fetch_pending_ = true;
+      start_refresh = true;
+    }
     gpr_mu_unlock(&mu_);
+    if (start_refresh) {
+      fetch_oauth2(new grpc_credentials_metadata_request(Ref()), &pollent_,
+                   on_oauth2_token_fetcher_http_response,
+                   grpc_core::Timestamp::Now() + refresh_threshold);
+    }
     initial_metadata->Append(
         GRPC_AUTHORIZATION_METADATA_KEY, std::move(*cached_access_token_value),
         [](absl::string_view, const grpc_core::Slice&) { abort(); });
@@ -310,8 +333,6 @@ grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
   }
   // Couldn't get the token from the cache.
   // Add request to pending_requests_ and start a new fetch if needed.
-  grpc_core::Duration refresh_threshold =
-      grpc_core::Duration::Seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS);
   auto pending_request =
       grpc_core::MakeRefCounted<grpc_oauth2_pending_get_request_metadata>();
   pending_request->pollent = grpc_core::GetContext<grpc_polling_entity>();
@@ -353,6 +374,15 @@ grpc_oauth2_token_fetcher_credentials::GetRequestMetadata(
 
 grpc_oauth2_token_fetcher_credentials::grpc_oauth2_token_fetcher_credentials()
     : token_expiration_(gpr_inf_past(GPR_CLOCK_MONOTONIC)),
+      token_refresh_time_(gpr_inf_future(GPR_CLOCK_MONOTONIC)),
+      refresh_backoff_(
+          grpc_core::BackOff::Options()
+              .set_initial_backoff(grpc_core::Duration::Seconds(
+                  GRPC_SECURE_TOKEN_REFRESH_INITIAL_BACKOFF_SECS))
+              .set_multiplier(GRPC_SECURE_TOKEN_REFRESH_BACKOFF_MULTIPLIER)
+              .set_jitter(GRPC_SECURE_TOKEN_REFRESH_BACKOFF_JITTER)
+              .set_max_backoff(grpc_core::Duration::Seconds(
+                  GRPC_SECURE_TOKEN_REFRESH_MAX_BACKOFF_SECS))),
       pollent_(grpc_polling_entity_create_from_pollset_set(
           grpc_pollset_set_create())) {
   gpr_mu_init(&mu_);
@@ -32,6 +32,7 @@
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/backoff/backoff.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -139,6 +140,11 @@ class grpc_oauth2_token_fetcher_credentials : public grpc_call_credentials {
   gpr_mu mu_;
   absl::optional<grpc_core::Slice> access_token_value_;
   gpr_timespec token_expiration_;
+  // A token that is used after three quarters of its lifetime is fetched
+  // again in the background, so that calls do not wait for the fetch.
+  gpr_timespec token_refresh_time_;
+  // Spaces out the retries of a background refresh that failed.
+  grpc_core::BackOff refresh_backoff_;
   bool token_fetch_pending_ = false;
   grpc_oauth2_pending_get_request_metadata* pending_requests_ = nullptr;
   grpc_polling_entity pollent_;
@@ -19,6 +19,7 @@
 #include "src/core/lib/slice/percent_encoding.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <cstdint>
 #include <utility>
@@ -71,6 +72,26 @@ const BitSet<256>& LookupTableForPercentEncodingType(PercentEncodingType type) {
   // Crash if a bad PercentEncodingType was passed in.
   GPR_UNREACHABLE_CODE(abort());
 }
+
+// Returns the end of the prefix of [p, end) that needs no escaping in the
+// compatible encoding, found eight bytes at a time. Bytes after the last whole
+// word are left to the caller.
+const uint8_t* SkipCompatibleWords(const uint8_t* p, const uint8_t* end) {
+  constexpr uint64_t kOnes = 0x0101010101010101;
+  constexpr uint64_t kHighBits = 0x8080808080808080;
+  while (end - p >= 8) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    const uint64_t percent = word ^ (kOnes * '%');
+    // A byte is below 32, above 126, or '%'.
+    const uint64_t needs_escaping = ((word - kOnes * 32) & ~word) |
+                                    ((word + kOnes) | word) |
+                                    ((percent - kOnes) & ~percent);
+    if ((needs_escaping & kHighBits) != 0) break;
+    p += 8;
+  }
+  return p;
+}
 }  // namespace
 
 Slice PercentEncodeSlice(Slice slice, PercentEncodingType type) {
@@ -79,10 +100,16 @@ Slice PercentEncodeSlice(Slice slice, PercentEncodingType type) {
   const BitSet<256>& lut = LookupTableForPercentEncodingType(type);
 
   // first pass: count the number of bytes needed to output this string
-  size_t output_length = 0;
+  const uint8_t* p = slice.begin();
+  const uint8_t* const end = slice.end();
+  if (type == PercentEncodingType::Compatible) {
+    // Status messages rarely need escaping: skip to the first word that might.
+    p = SkipCompatibleWords(p, end);
+  }
+  size_t output_length = p - slice.begin();
   bool any_reserved_bytes = false;
-  for (uint8_t c : slice) {
-    bool unres = lut.is_set(c);
+  for (; p != end; ++p) {
+    bool unres = lut.is_set(*p);
     output_length += unres ? 1 : 3;
     any_reserved_bytes |= !unres;
   }
@@ -120,14 +147,9 @@ static uint8_t DeHex(uint8_t c) {
 }
 
 Slice PermissivePercentDecodeSlice(Slice slice_in) {
-  bool any_percent_encoded_stuff = false;
-  for (uint8_t c : slice_in) {
-    if (c == '%') {
-      any_percent_encoded_stuff = true;
-      break;
-    }
+  if (memchr(slice_in.data(), '%', slice_in.length()) == nullptr) {
+    return slice_in;
   }
-  if (!any_percent_encoded_stuff) return slice_in;
 
   MutableSlice out = slice_in.TakeMutable();
   uint8_t* q = out.begin();
@@ -69,6 +69,25 @@ inline void CSliceUnref(const grpc_slice& slice, DebugLocation loc = {}) {
   }
 }
 
+// Returns a new reference to slice, except that refcounted slices short enough
+// to be inlined are copied into an inlined slice instead: copying a few bytes
+// costs less than the atomic increment now and decrement later (and the cache
+// miss on the refcount), and inlined slices can be merged by slice buffers.
+inline grpc_slice CSliceRefOrInline(const grpc_slice& slice,
+                                    DebugLocation loc = {}) {
+  if (reinterpret_cast<uintptr_t>(slice.refcount) <= 1 ||
+      slice.data.refcounted.length > sizeof(slice.data.inlined.bytes)) {
+    return CSliceRef(slice, loc);
+  }
+  grpc_slice out;
+  out.refcount = nullptr;
+  out.data.inlined.length =
+      static_cast<uint8_t>(slice.data.refcounted.length);
+  memcpy(out.data.inlined.bytes, slice.data.refcounted.bytes,
+         slice.data.refcounted.length);
+  return out;
+}
+
 namespace slice_detail {
 
 // Returns an empty slice.
@@ -34,13 +34,23 @@
 
 namespace grpc_core {
 
+namespace {
+
+// Slices and cord chunks shorter than this are copied when converting between
+// slice buffers and cords: referencing them would need an allocation of its
+// own, and would keep alive memory that may be much larger than they are.
+constexpr size_t kMinCordReferenceSize = 512;
+
+}  // namespace
+
 void SliceBuffer::Append(Slice slice) {
   grpc_slice_buffer_add(&slice_buffer_, slice.TakeCSlice());
 }
 
 void SliceBuffer::Append(const SliceBuffer& other) {
   for (size_t i = 0; i < other.Count(); i++) {
-    Append(other.RefSlice(i));
+    grpc_slice_buffer_add(&slice_buffer_,
+                          CSliceRefOrInline(other.slice_buffer_.slices[i]));
   }
 }
 
@@ -86,6 +96,97 @@ Slice SliceBuffer::JoinIntoSlice() const {
   return Slice(slice);
 }
 
+absl::Cord SliceBuffer::JoinIntoCord() const {
+  absl::Cord cord;
+  for (size_t i = 0; i < slice_buffer_.count; i++) {
+    const grpc_slice& slice = slice_buffer_.slices[i];
+    absl::string_view data(
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(slice)),
+        GRPC_SLICE_LENGTH(slice));
+    // Inlined slices keep their bytes in the grpc_slice itself.
+    if (slice.refcount == nullptr || data.size() < kMinCordReferenceSize) {
+      cord.Append(data);
+      continue;
+    }
+    grpc_slice ref = CSliceRef(slice);
+    cord.Append(absl::MakeCordFromExternal(
+        data, [ref](absl::string_view) { CSliceUnref(ref); }));
+  }
+  return cord;
+}
+
+void SliceBuffer::AppendCord(const absl::Cord& cord) {
+  size_t offset = 0;
+  for (absl::string_view chunk : cord.Chunks()) {
+    if (chunk.size() < kMinCordReferenceSize) {
+      Append(Slice::FromCopiedBuffer(chunk.data(), chunk.size()));
+    } else {
+      // The subcord shares the chunk's memory, and holds a reference to it for
+      // as long as the slice lives.
+      auto* subcord = new absl::Cord(cord.Subcord(offset, chunk.size()));
+      Append(Slice(grpc_slice_new_with_user_data(
+          const_cast<char*>(chunk.data()), chunk.size(),
+          [](void* p) { delete static_cast<absl::Cord*>(p); }, subcord)));
+    }
+    offset += chunk.size();
+  }
+}
+
+void SliceBuffer::CoalesceSmallSlices(size_t max_copy_size) {
+  const size_t count = slice_buffer_.count;
+  if (count < 2) return;
+  const grpc_slice* slices = slice_buffer_.slices;
+  auto is_small = [slices, max_copy_size](size_t i) {
+    return GRPC_SLICE_LENGTH(slices[i]) <= max_copy_size;
+  };
+  // First pass: size a single arena large enough for every run of two or more
+  // small slices.
+  size_t arena_size = 0;
+  for (size_t i = 0; i < count;) {
+    if (!is_small(i)) {
+      ++i;
+      continue;
+    }
+    size_t run_end = i;
+    size_t run_bytes = 0;
+    while (run_end < count && is_small(run_end)) {
+      run_bytes += GRPC_SLICE_LENGTH(slices[run_end]);
+      ++run_end;
+    }
+    if (run_end - i > 1) arena_size += run_bytes;
+    i = run_end;
+  }
+  if (arena_size == 0) return;
+  // Second pass: copy runs into the arena and reference everything else.
+  grpc_slice arena = GRPC_SLICE_MALLOC(arena_size);
+  uint8_t* const arena_start = GRPC_SLICE_START_PTR(arena);
+  size_t arena_ofs = 0;
+  SliceBuffer coalesced;
+  for (size_t i = 0; i < count;) {
+    size_t run_end = i;
+    while (run_end < count && is_small(run_end)) ++run_end;
+    if (run_end - i > 1) {
+      const size_t run_start_ofs = arena_ofs;
+      for (; i < run_end; ++i) {
+        const size_t len = GRPC_SLICE_LENGTH(slices[i]);
+        memcpy(arena_start + arena_ofs, GRPC_SLICE_START_PTR(slices[i]), len);
+        arena_ofs += len;
+      }
+      grpc_slice_buffer_add(&coalesced.slice_buffer_,
+                            grpc_slice_sub(arena, run_start_ofs, arena_ofs));
+    } else {
+      if (run_end == i) ++run_end;
+      for (; i < run_end; ++i) {
+        grpc_slice_buffer_add(&coalesced.slice_buffer_, CSliceRef(slices[i]));
+      }
+    }
+  }
+  CHECK_EQ(arena_ofs, arena_size);
+  CSliceUnref(arena);
+  CHECK_EQ(coalesced.Length(), slice_buffer_.length);
+  Swap(&coalesced);
+}
+
 }  // namespace grpc_core
 
 // grow a buffer; requires GRPC_SLICE_BUFFER_INLINE_ELEMENTS > 1
@@ -21,6 +21,8 @@
 #include <memory>
 #include <string>
 
+#include "absl/strings/cord.h"
+
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 #include <grpc/support/port_platform.h>
@@ -158,12 +160,27 @@ class SliceBuffer {
   /// Concatenate all slices and return the resulting slice.
   Slice JoinIntoSlice() const;
 
-  // Return a copy of the slice buffer
+  /// Return a cord of the contents of this buffer. The slices are referenced
+  /// by the cord rather than copied, except for the small ones.
+  absl::Cord JoinIntoCord() const;
+
+  /// Append the contents of \a cord. Its chunks are referenced rather than
+  /// copied, except for the small ones, and the slices referencing them keep
+  /// the cord's data alive.
+  void AppendCord(const absl::Cord& cord);
+
+  /// Copy every run of two or more adjacent slices that are each no longer
+  /// than \a max_copy_size bytes into a single shared allocation, leaving
+  /// larger slices referenced without copying. The byte sequence is
+  /// unchanged; only the number of slices (and hence iovecs when this buffer
+  /// is written to an endpoint) goes down.
+  void CoalesceSmallSlices(size_t max_copy_size);
+
+  // Return a copy of the slice buffer. Large slices are shared with this
+  // buffer, small ones are copied (see CSliceRefOrInline).
   SliceBuffer Copy() const {
     SliceBuffer copy;
-    for (size_t i = 0; i < Count(); i++) {
-      copy.Append(RefSlice(i));
-    }
+    copy.Append(*this);
     return copy;
   }
 
@@ -18,6 +18,8 @@
 
 #include <stddef.h>
 
+#include "absl/log/check.h"
+
 #include <grpc/byte_buffer.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/compression_types.h>
@@ -27,7 +29,34 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/slab_allocator.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/message.h"
+
+namespace {
+
+// Every message that goes through the surface API gets a byte buffer, and
+// proxies that forward messages copy each one into another: so byte buffers
+// are recycled through the slab allocator's caches rather than malloc'd.
+int ByteBufferSizeClass() {
+  static const int size_class = []() {
+    const int size_class =
+        grpc_core::SlabAllocator::SizeClassFor(sizeof(grpc_byte_buffer));
+    CHECK_GE(size_class, 0);
+    return size_class;
+  }();
+  return size_class;
+}
+
+grpc_byte_buffer* AllocateByteBuffer() {
+  auto* bb = static_cast<grpc_byte_buffer*>(
+      grpc_core::SlabAllocator::Allocate(ByteBufferSizeClass()));
+  // Holds the message object of the buffer, if any.
+  bb->reserved = nullptr;
+  return bb;
+}
+
+}  // namespace
 
 grpc_byte_buffer* grpc_raw_byte_buffer_create(grpc_slice* slices,
                                               size_t nslices) {
@@ -39,22 +68,20 @@ grpc_byte_buffer* grpc_raw_compressed_byte_buffer_create(
     grpc_slice* slices, size_t nslices,
     grpc_compression_algorithm compression) {
   size_t i;
-  grpc_byte_buffer* bb =
-      static_cast<grpc_byte_buffer*>(gpr_malloc(sizeof(grpc_byte_buffer)));
+  grpc_byte_buffer* bb = AllocateByteBuffer();
   bb->type = GRPC_BB_RAW;
   bb->data.raw.compression = compression;
   grpc_slice_buffer_init(&bb->data.raw.slice_buffer);
   for (i = 0; i < nslices; i++) {
-    grpc_core::CSliceRef(slices[i]);
-    grpc_slice_buffer_add(&bb->data.raw.slice_buffer, slices[i]);
+    grpc_slice_buffer_add(&bb->data.raw.slice_buffer,
+                          grpc_core::CSliceRefOrInline(slices[i]));
   }
   return bb;
 }
 
 grpc_byte_buffer* grpc_raw_byte_buffer_from_reader(
     grpc_byte_buffer_reader* reader) {
-  grpc_byte_buffer* bb =
-      static_cast<grpc_byte_buffer*>(gpr_malloc(sizeof(grpc_byte_buffer)));
+  grpc_byte_buffer* bb = AllocateByteBuffer();
   grpc_slice slice;
   bb->type = GRPC_BB_RAW;
   bb->data.raw.compression = GRPC_COMPRESS_NONE;
@@ -67,6 +94,8 @@ grpc_byte_buffer* grpc_raw_byte_buffer_from_reader(
 }
 
 grpc_byte_buffer* grpc_byte_buffer_copy(grpc_byte_buffer* bb) {
+  // Message objects cannot be copied, but their bytes can.
+  grpc_core::MessageObject::Materialize(bb);
   switch (bb->type) {
     case GRPC_BB_RAW:
       return grpc_raw_compressed_byte_buffer_create(
@@ -79,15 +108,17 @@ grpc_byte_buffer* grpc_byte_buffer_copy(grpc_byte_buffer* bb) {
 void grpc_byte_buffer_destroy(grpc_byte_buffer* bb) {
   if (!bb) return;
   grpc_core::ExecCtx exec_ctx;
+  grpc_core::MessageObject::TakeFrom(bb).Reset();
   switch (bb->type) {
     case GRPC_BB_RAW:
       grpc_slice_buffer_destroy(&bb->data.raw.slice_buffer);
       break;
   }
-  gpr_free(bb);
+  grpc_core::SlabAllocator::Free(ByteBufferSizeClass(), bb);
 }
 
 size_t grpc_byte_buffer_length(grpc_byte_buffer* bb) {
+  grpc_core::MessageObject::Materialize(bb);
   switch (bb->type) {
     case GRPC_BB_RAW:
       return bb->data.raw.slice_buffer.length;
@@ -30,10 +30,12 @@
 
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/message.h"
 
 int grpc_byte_buffer_reader_init(grpc_byte_buffer_reader* reader,
                                  grpc_byte_buffer* buffer) {
   reader->buffer_in = buffer;
+  grpc_core::MessageObject::Materialize(buffer);
   switch (reader->buffer_in->type) {
     case GRPC_BB_RAW:
       reader->buffer_out = reader->buffer_in;
@@ -35,6 +35,7 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
@@ -62,6 +63,7 @@
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/status_util.h"
 #include "src/core/lib/compression/compression_internal.h"
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/event_engine/event_engine_context.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/bitset.h"
@@ -69,6 +71,7 @@
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/match.h"
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/status_helper.h"
@@ -111,6 +114,24 @@
 
 namespace grpc_core {
 
+namespace {
+
+// Shared by all calls timing out, so that expiring them does not allocate.
+grpc_error_handle DeadlineExceededCallError() {
+  if (grpc_error_detail_enabled()) {
+    return grpc_error_set_int(
+        StatusCreate(absl::StatusCode::kDeadlineExceeded, "Deadline Exceeded",
+                     DEBUG_LOCATION, {}),
+        StatusIntProperty::kRpcStatus, GRPC_STATUS_DEADLINE_EXCEEDED);
+  }
+  static const NoDestruct<grpc_error_handle> error(grpc_error_set_int(
+      absl::DeadlineExceededError("Deadline Exceeded"),
+      StatusIntProperty::kRpcStatus, GRPC_STATUS_DEADLINE_EXCEEDED));
+  return *error;
+}
+
+}  // namespace
+
 // Alias to make this type available in Call implementation without a grpc_core
 // prefix.
 using GrpcClosure = Closure;
@@ -232,22 +253,31 @@ void Call::CancelWithStatus(grpc_status_code status, const char* description) {
 
 void Call::PropagateCancellationToChildren() {
   ParentCall* pc = parent_call();
-  if (pc != nullptr) {
-    Call* child;
+  if (pc == nullptr) return;
+  // Collect the children to cancel in one pass over the list, and cancel them
+  // once the lock is released: cancelling a call runs its filter stack, and
+  // children finishing (or being created) meanwhile need the lock to unlink
+  // (or link) themselves.
+  absl::InlinedVector<Call*, 16> children;
+  {
     MutexLock lock(&pc->child_list_mu);
-    child = pc->first_child;
+    Call* child = pc->first_child;
     if (child != nullptr) {
       do {
-        Call* next_child_call = child->child_->sibling_next;
         if (child->cancellation_is_inherited_) {
           child->InternalRef("propagate_cancel");
-          child->CancelWithError(absl::CancelledError());
-          child->InternalUnref("propagate_cancel");
+          children.push_back(child);
         }
-        child = next_child_call;
+        child = child->child_->sibling_next;
       } while (child != pc->first_child);
     }
   }
+  if (children.empty()) return;
+  const absl::Status error = absl::CancelledError();
+  for (Call* child : children) {
+    child->CancelWithError(error);
+    child->InternalUnref("propagate_cancel");
+  }
 }
 
 void Call::PrepareOutgoingInitialMetadata(const grpc_op& op,
@@ -345,30 +375,39 @@ void Call::UpdateDeadline(Timestamp deadline) {
   if (deadline >= deadline_) return;
   if (deadline < Timestamp::Now()) {
     lock.Release();
-    CancelWithError(grpc_error_set_int(
-        absl::DeadlineExceededError("Deadline Exceeded"),
-        StatusIntProperty::kRpcStatus, GRPC_STATUS_DEADLINE_EXCEEDED));
+    CancelWithError(DeadlineExceededCallError());
     return;
   }
-  auto* event_engine =
-      arena_->GetContext<grpc_event_engine::experimental::EventEngine>();
   if (deadline_ != Timestamp::InfFuture()) {
-    if (!event_engine->Cancel(deadline_task_)) return;
+    if (!CancelDeadlineTimer()) return;
   } else {
     InternalRef("deadline");
   }
   deadline_ = deadline;
-  deadline_task_ = event_engine->RunAfter(deadline - Timestamp::Now(), this);
+  auto* event_engine =
+      arena_->GetContext<grpc_event_engine::experimental::EventEngine>();
+  const Duration slot_duration =
+      Duration::Milliseconds(ConfigVars::Get().CallDeadlineSlotMs());
+  deadline_coalesced_ = slot_duration > Duration::Zero();
+  if (deadline_coalesced_) {
+    DeadlineScheduler::Schedule(event_engine, deadline, slot_duration, this,
+                                &deadline_entry_);
+  } else {
+    deadline_task_ = event_engine->RunAfter(deadline - Timestamp::Now(), this);
+  }
+}
+
+bool Call::CancelDeadlineTimer() {
+  if (deadline_coalesced_) return DeadlineScheduler::Cancel(&deadline_entry_);
+  return arena_->GetContext<grpc_event_engine::experimental::EventEngine>()
+      ->Cancel(deadline_task_);
 }
 
 void Call::ResetDeadline() {
   {
     MutexLock lock(&deadline_mu_);
     if (deadline_ == Timestamp::InfFuture()) return;
-    if (!arena_->GetContext<grpc_event_engine::experimental::EventEngine>()
-             ->Cancel(deadline_task_)) {
-      return;
-    }
+    if (!CancelDeadlineTimer()) return;
     deadline_ = Timestamp::InfFuture();
   }
   InternalUnref("deadline[reset]");
@@ -380,9 +419,7 @@ void Call::Run() {
   GRPC_TRACE_LOG(call, INFO)
       << "call deadline expired "
       << GRPC_DUMP_ARGS(Timestamp::Now(), send_deadline_);
-  CancelWithError(grpc_error_set_int(
-      absl::DeadlineExceededError("Deadline Exceeded"),
-      StatusIntProperty::kRpcStatus, GRPC_STATUS_DEADLINE_EXCEEDED));
+  CancelWithError(DeadlineExceededCallError());
   InternalUnref("deadline[run]");
 }
 
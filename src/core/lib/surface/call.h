@@ -47,6 +47,7 @@
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/api_trace.h"
 #include "src/core/lib/surface/channel.h"
+#include "src/core/lib/surface/deadline_scheduler.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
 #include "src/core/util/time_precise.h"
@@ -205,6 +206,9 @@ class Call : public CppImplOf<Call, grpc_call>,
       grpc_compression_algorithm algorithm) = 0;
 
  private:
+  // Stops the deadline timer. Returns false if it has already fired.
+  bool CancelDeadlineTimer() ABSL_EXCLUSIVE_LOCKS_REQUIRED(deadline_mu_);
+
   const RefCountedPtr<Arena> arena_;
   std::atomic<ParentCall*> parent_call_{nullptr};
   ChildCall* child_ = nullptr;
@@ -227,6 +231,10 @@ class Call : public CppImplOf<Call, grpc_call>,
   Timestamp deadline_ ABSL_GUARDED_BY(deadline_mu_) = Timestamp::InfFuture();
   grpc_event_engine::experimental::EventEngine::TaskHandle ABSL_GUARDED_BY(
       deadline_mu_) deadline_task_;
+  // Used instead of deadline_task_ when call deadlines are coalesced (the
+  // call_deadline_slot_ms config var).
+  DeadlineScheduler::Entry deadline_entry_ ABSL_GUARDED_BY(deadline_mu_);
+  bool deadline_coalesced_ ABSL_GUARDED_BY(deadline_mu_) = false;
   gpr_cycle_counter start_time_ = gpr_get_cycle_counter();
 };
 
@@ -61,6 +61,7 @@
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/surface/validate_metadata.h"
+#include "src/core/lib/transport/message.h"
 #include "src/core/lib/transport/metadata.h"
 #include "src/core/lib/transport/metadata_batch.h"
 
@@ -95,6 +96,28 @@ void CToMetadata(grpc_metadata* metadata, size_t count,
   }
 }
 
+Slice StatusDetailsSlice(const grpc_slice& details) {
+  if (details.refcount == grpc_slice_refcount::NoopRefcount()) {
+    return Slice(grpc_slice_copy(details));
+  }
+  return Slice(CSliceRef(details));
+}
+
+MessageHandle TakeSendMessage(Arena* arena, grpc_byte_buffer* send_message,
+                              uint32_t flags) {
+  if (MessageObjectPassthrough::EnabledFor(arena)) {
+    MessageObject object = MessageObject::TakeFrom(send_message);
+    if (object) return arena->MakePooled<Message>(std::move(object), flags);
+  } else {
+    // The call's filters need the bytes of the message.
+    MessageObject::Materialize(send_message);
+  }
+  SliceBuffer send;
+  grpc_slice_buffer_swap(&send_message->data.raw.slice_buffer,
+                         send.c_slice_buffer());
+  return arena->MakePooled<Message>(std::move(send), flags);
+}
+
 const char* GrpcOpTypeName(grpc_op_type op) {
   switch (op) {
     case GRPC_OP_SEND_INITIAL_METADATA:
@@ -191,6 +214,16 @@ StatusFlag MessageReceiver::FinishRecvMessage(
   }
   MessageHandle& message = **result;
   test_only_last_message_flags_ = message->flags();
+  if (message->has_object()) {
+    *recv_message_ = grpc_raw_byte_buffer_create(nullptr, 0);
+    message->TakeObject().AttachTo(*recv_message_);
+    GRPC_TRACE_LOG(call, INFO)
+        << Activity::current()->DebugTag()
+        << "[call] RecvMessage: outstanding_recv "
+           "finishes: received message object";
+    recv_message_ = nullptr;
+    return Success{};
+  }
   if ((message->flags() & GRPC_WRITE_INTERNAL_COMPRESS) &&
       (incoming_compression_algorithm_ != GRPC_COMPRESS_NONE)) {
     *recv_message_ = grpc_raw_compressed_byte_buffer_create(
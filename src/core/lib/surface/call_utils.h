@@ -54,6 +54,7 @@
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/status_flag.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/transport/message.h"
 #include "src/core/lib/transport/metadata.h"
@@ -128,6 +129,16 @@ class PublishToAppEncoder {
 void PublishMetadataArray(grpc_metadata_batch* md, grpc_metadata_array* array,
                           bool is_client);
 void CToMetadata(grpc_metadata* metadata, size_t count, grpc_metadata_batch* b);
+// The grpc-message value for the status_details of a
+// GRPC_OP_SEND_STATUS_FROM_SERVER op. Refcounted slices are referenced, so
+// servers repeating a canned status message can send it without copying it;
+// static slices are copied, since callers free their bytes after the op starts.
+Slice StatusDetailsSlice(const grpc_slice& details);
+// Moves the message object or the bytes of \a send_message into a new message.
+// The object is only kept if the call passes message objects through, see
+// MessageObjectPassthrough; otherwise it is serialized.
+MessageHandle TakeSendMessage(Arena* arena, grpc_byte_buffer* send_message,
+                              uint32_t flags);
 const char* GrpcOpTypeName(grpc_op_type op);
 
 bool ValidateMetadata(size_t count, grpc_metadata* metadata);
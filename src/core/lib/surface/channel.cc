@@ -66,10 +66,12 @@ Channel::Channel(std::string target, const ChannelArgs& channel_args)
     : target_(std::move(target)),
       channelz_node_(channel_args.GetObjectRef<channelz::ChannelNode>()),
       compression_options_(CompressionOptionsFromChannelArgs(channel_args)),
+      records_call_phase_timestamps_(
+          channel_args.GetBool(GRPC_ARG_CALL_PHASE_TIMESTAMPS).value_or(false)),
       call_arena_allocator_(MakeRefCounted<CallArenaAllocator>(
           channel_args.GetObject<ResourceQuota>()
               ->memory_quota()
-              ->CreateMemoryOwner(),
+              ->CreateMemoryOwner("call_arena"),
           1024)) {}
 
 Channel::RegisteredCall* Channel::RegisterCall(const char* method,
@@ -108,6 +108,10 @@ class Channel : public UnstartedCallDestination,
   grpc_compression_options compression_options() const {
     return compression_options_;
   }
+  // Whether calls record CallPhaseTimestamps (GRPC_ARG_CALL_PHASE_TIMESTAMPS).
+  bool records_call_phase_timestamps() const {
+    return records_call_phase_timestamps_;
+  }
 
   RegisteredCall* RegisterCall(const char* method, const char* host);
 
@@ -138,6 +142,7 @@ class Channel : public UnstartedCallDestination,
   const std::string target_;
   const RefCountedPtr<channelz::ChannelNode> channelz_node_;
   const grpc_compression_options compression_options_;
+  const bool records_call_phase_timestamps_;
 
   Mutex mu_;
   // The map key needs to be owned strings rather than unowned char*'s to
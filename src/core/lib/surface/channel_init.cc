@@ -101,7 +101,8 @@ ChannelInit::FilterRegistration& ChannelInit::FilterRegistration::IfChannelArg(
 
 ChannelInit::FilterRegistration&
 ChannelInit::FilterRegistration::ExcludeFromMinimalStack() {
-  return If([](const ChannelArgs& args) { return !args.WantMinimalStack(); });
+  exclude_from_minimal_stack_ = true;
+  return *this;
 }
 
 ChannelInit::FilterRegistration& ChannelInit::Builder::RegisterFilter(
@@ -237,7 +238,8 @@ class ChannelInit::DependencyTracker {
 ChannelInit::StackConfig ChannelInit::BuildStackConfig(
     const std::vector<std::unique_ptr<ChannelInit::FilterRegistration>>&
         registrations,
-    PostProcessor* post_processors, grpc_channel_stack_type type) {
+    PostProcessor* post_processors, std::vector<FusedFilters> fused_filters,
+    grpc_channel_stack_type type) {
   // Phase 1: Build a map from filter to the set of filters that must be
   // initialized before it.
   // We order this map (and the set of dependent filters) by filter name to
@@ -254,7 +256,8 @@ ChannelInit::StackConfig ChannelInit::BuildStackConfig(
       CHECK_EQ(registration->ordering_, Ordering::kDefault);
       terminal_filters.emplace_back(
           registration->name_, registration->filter_, nullptr,
-          std::move(registration->predicates_), registration->version_,
+          std::move(registration->predicates_),
+          registration->exclude_from_minimal_stack_, registration->version_,
           registration->ordering_, registration->registration_source_);
     } else {
       dependencies.Declare(registration.get());
@@ -285,7 +288,8 @@ ChannelInit::StackConfig ChannelInit::BuildStackConfig(
   while (auto registration = dependencies.Next()) {
     filters.emplace_back(
         registration->name_, registration->filter_, registration->filter_adder_,
-        std::move(registration->predicates_), registration->version_,
+        std::move(registration->predicates_),
+        registration->exclude_from_minimal_stack_, registration->version_,
         registration->ordering_, registration->registration_source_);
   }
   // Collect post processors that need to be applied.
@@ -317,7 +321,9 @@ ChannelInit::StackConfig ChannelInit::BuildStackConfig(
                   "ChannelInit::CreateStack that never completes successfully.";
   }
   return StackConfig{std::move(filters), std::move(terminal_filters),
-                     std::move(post_processor_functions)};
+                     std::move(post_processor_functions),
+                     std::make_unique<StackTemplates>(),
+                     std::move(fused_filters)};
 };
 
 void ChannelInit::PrintChannelStackTrace(
@@ -414,74 +420,136 @@ ChannelInit ChannelInit::Builder::Build() {
   for (int i = 0; i < GRPC_NUM_CHANNEL_STACK_TYPES; i++) {
     result.stack_configs_[i] =
         BuildStackConfig(filters_[i], post_processors_[i],
+                         std::move(fused_filters_[i]),
                          static_cast<grpc_channel_stack_type>(i));
   }
   return result;
 }
 
-bool ChannelInit::Filter::CheckPredicates(const ChannelArgs& args) const {
+bool ChannelInit::Filter::CheckPredicates(const ChannelArgs& args,
+                                          bool minimal_stack) const {
+  if (minimal_stack && exclude_from_minimal_stack) return false;
   for (const auto& predicate : predicates) {
     if (!predicate(args)) return false;
   }
   return true;
 }
 
+std::shared_ptr<const ChannelInit::StackTemplates::Filters>
+ChannelInit::StackTemplates::Get(const StackConfig& stack_config,
+                                 const std::vector<bool>& selected) {
+  MutexLock lock(&mu_);
+  auto it = templates_.find(selected);
+  if (it != templates_.end()) return it->second;
+  auto filters = std::make_shared<Filters>();
+  filters->reserve(selected.size());
+  size_t i = 0;
+  for (const auto& filter : stack_config.filters) {
+    if (selected[i++]) filters->push_back(filter.filter);
+  }
+  for (const auto& terminator : stack_config.terminators) {
+    if (selected[i++]) filters->push_back(terminator.filter);
+  }
+  if (templates_.size() < kMaxTemplates) templates_.emplace(selected, filters);
+  return filters;
+}
+
 bool ChannelInit::CreateStack(ChannelStackBuilder* builder) const {
   const auto& stack_config = stack_configs_[builder->channel_stack_type()];
+  const ChannelArgs& args = builder->channel_args();
+  const bool minimal_stack = args.WantMinimalStack();
+  // The predicates are all the args can change about the stack: which of the
+  // filters they select is the key of its template.
+  std::vector<bool> selected;
+  selected.reserve(stack_config.filters.size() +
+                   stack_config.terminators.size());
   for (const auto& filter : stack_config.filters) {
-    if (SkipV2(filter.version)) continue;
-    if (!filter.CheckPredicates(builder->channel_args())) continue;
-    builder->AppendFilter(filter.filter);
+    selected.push_back(!SkipV2(filter.version) &&
+                       filter.CheckPredicates(args, minimal_stack));
   }
   int found_terminators = 0;
   for (const auto& terminator : stack_config.terminators) {
-    if (!terminator.CheckPredicates(builder->channel_args())) continue;
-    builder->AppendFilter(terminator.filter);
-    ++found_terminators;
+    selected.push_back(terminator.CheckPredicates(args, minimal_stack));
+    if (selected.back()) ++found_terminators;
   }
   if (found_terminators != 1) {
     std::string error = absl::StrCat(
         found_terminators,
         " terminating filters found creating a channel of type ",
         grpc_channel_stack_type_string(builder->channel_stack_type()),
-        " with arguments ", builder->channel_args().ToString(),
+        " with arguments ", args.ToString(),
         " (we insist upon one and only one terminating "
         "filter)\n");
     if (stack_config.terminators.empty()) {
       absl::StrAppend(&error, "  No terminal filters were registered");
     } else {
       for (const auto& terminator : stack_config.terminators) {
-        absl::StrAppend(&error, "  ", terminator.name, " registered @ ",
-                        terminator.registration_source.file(), ":",
-                        terminator.registration_source.line(), ": enabled = ",
-                        terminator.CheckPredicates(builder->channel_args())
-                            ? "true"
-                            : "false",
-                        "\n");
+        absl::StrAppend(
+            &error, "  ", terminator.name, " registered @ ",
+            terminator.registration_source.file(), ":",
+            terminator.registration_source.line(), ": enabled = ",
+            terminator.CheckPredicates(args, minimal_stack) ? "true" : "false",
+            "\n");
       }
     }
     LOG(ERROR) << error;
     return false;
   }
+  auto stack_template = stack_config.templates->Get(stack_config, selected);
+  builder->AppendFilters(*stack_template);
   for (const auto& post_processor : stack_config.post_processors) {
     post_processor(*builder);
   }
   return true;
 }
 
+const ChannelInit::FusedFilters* ChannelInit::FindFusedFilters(
+    const StackConfig& stack_config, const std::vector<const Filter*>& selected,
+    size_t start) {
+  for (const auto& fused : stack_config.fused_filters) {
+    if (fused.names.size() > selected.size() - start) continue;
+    bool matches = true;
+    for (size_t i = 0; i < fused.names.size(); i++) {
+      if (selected[start + i]->name != fused.names[i]) {
+        matches = false;
+        break;
+      }
+    }
+    if (matches) return &fused;
+  }
+  return nullptr;
+}
+
 void ChannelInit::AddToInterceptionChainBuilder(
     grpc_channel_stack_type type, InterceptionChainBuilder& builder) const {
   const auto& stack_config = stack_configs_[type];
+  const bool minimal_stack = builder.channel_args().WantMinimalStack();
   // Based on predicates build a list of filters to include in this segment.
+  std::vector<const Filter*> selected;
+  selected.reserve(stack_config.filters.size());
   for (const auto& filter : stack_config.filters) {
     if (SkipV3(filter.version)) continue;
-    if (!filter.CheckPredicates(builder.channel_args())) continue;
+    if (!filter.CheckPredicates(builder.channel_args(), minimal_stack)) {
+      continue;
+    }
     if (filter.filter_adder == nullptr) {
       builder.Fail(absl::InvalidArgumentError(
           absl::StrCat("Filter ", filter.name, " has no v3-callstack vtable")));
       return;
     }
-    filter.filter_adder(builder);
+    selected.push_back(&filter);
+  }
+  // Add runs of filters that were registered to be fused together, and the
+  // remaining filters one at a time.
+  for (size_t i = 0; i < selected.size();) {
+    const FusedFilters* fused = FindFusedFilters(stack_config, selected, i);
+    if (fused != nullptr) {
+      fused->filter_adder(builder);
+      i += fused->names.size();
+    } else {
+      selected[i]->filter_adder(builder);
+      ++i;
+    }
   }
 }
 
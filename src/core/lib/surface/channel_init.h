@@ -27,6 +27,8 @@
 #include <utility>
 #include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 
@@ -37,6 +39,7 @@
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack_builder.h"
 #include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/transport/call_filters.h"
@@ -173,6 +176,13 @@ class ChannelInit {
     return out << OrderingToString(ordering);
   }
 
+  // A run of filters registered with Builder::RegisterFusedFilters(), and
+  // the function that adds them all.
+  struct FusedFilters {
+    std::vector<UniqueTypeName> names;
+    FilterAdder filter_adder;
+  };
+
   class FilterRegistration {
    public:
     // TODO(ctiller): Remove grpc_channel_filter* arg when that can be
@@ -283,6 +293,7 @@ class ChannelInit {
     std::vector<InclusionPredicate> predicates_;
     bool terminal_ = false;
     bool before_all_ = false;
+    bool exclude_from_minimal_stack_ = false;
     Version version_ = Version::kAny;
     Ordering ordering_ = Ordering::kDefault;
     SourceLocation registration_source_;
@@ -325,6 +336,24 @@ class ChannelInit {
           .SkipV3();
     }
 
+    // Register a run of filters to be added together with
+    // InterceptionChainBuilder::AddFused(), so that their synchronous
+    // interceptors run as one operation per hook.
+    // Each filter must also be registered with RegisterFilter(): that still
+    // decides whether and where it goes in the stack. The run is fused only
+    // for the v3 stacks where all of its filters are selected, in this order
+    // and with no other filter between them; otherwise each filter is added
+    // on its own, as though the run had not been registered.
+    template <typename... Filters>
+    void RegisterFusedFilters(grpc_channel_stack_type type) {
+      static_assert(sizeof...(Filters) > 1, "nothing to fuse");
+      fused_filters_[type].push_back(
+          {{UniqueTypeNameFor<Filters>()...},
+           [](InterceptionChainBuilder& builder) {
+             builder.AddFused<Filters...>();
+           }});
+    }
+
     // Register a post processor for the builder.
     // These run after the main graph has been placed into the builder.
     // At most one filter per slot per channel stack type can be added.
@@ -344,6 +373,7 @@ class ChannelInit {
    private:
     std::vector<std::unique_ptr<FilterRegistration>>
         filters_[GRPC_NUM_CHANNEL_STACK_TYPES];
+    std::vector<FusedFilters> fused_filters_[GRPC_NUM_CHANNEL_STACK_TYPES];
     PostProcessor post_processors_[GRPC_NUM_CHANNEL_STACK_TYPES]
                                   [static_cast<int>(PostProcessorSlot::kCount)];
   };
@@ -367,13 +397,14 @@ class ChannelInit {
   struct Filter {
     Filter(UniqueTypeName name, const grpc_channel_filter* filter,
            FilterAdder filter_adder, std::vector<InclusionPredicate> predicates,
-           Version version, Ordering ordering,
+           bool exclude_from_minimal_stack, Version version, Ordering ordering,
            SourceLocation registration_source)
         : name(name),
           filter(filter),
           filter_adder(filter_adder),
           predicates(std::move(predicates)),
           registration_source(registration_source),
+          exclude_from_minimal_stack(exclude_from_minimal_stack),
           version(version),
           ordering(ordering) {}
     UniqueTypeName name;
@@ -381,21 +412,53 @@ class ChannelInit {
     const FilterAdder filter_adder;
     std::vector<InclusionPredicate> predicates;
     SourceLocation registration_source;
+    bool exclude_from_minimal_stack;
     Version version;
     Ordering ordering;
-    bool CheckPredicates(const ChannelArgs& args) const;
+    // \a minimal_stack is ChannelArgs::WantMinimalStack() for \a args, which
+    // the callers look up once for all the filters of a stack.
+    bool CheckPredicates(const ChannelArgs& args, bool minimal_stack) const;
+  };
+  // The filters of the stacks built for the channels whose args select the
+  // same filters of a StackConfig, keyed by which of them were selected.
+  // Built on the first such channel, and reused by the next ones.
+  struct StackConfig;
+  class StackTemplates {
+   public:
+    using Filters = std::vector<const grpc_channel_filter*>;
+
+    // Returns the filters \a selected from \a stack_config, in order.
+    std::shared_ptr<const Filters> Get(const StackConfig& stack_config,
+                                       const std::vector<bool>& selected);
+
+   private:
+    // Bounds the memory used by the cache should predicates depend on args
+    // that vary a lot: past the limit, templates are not kept.
+    static constexpr size_t kMaxTemplates = 64;
+
+    Mutex mu_;
+    absl::flat_hash_map<std::vector<bool>, std::shared_ptr<const Filters>>
+        templates_ ABSL_GUARDED_BY(mu_);
   };
   struct StackConfig {
     std::vector<Filter> filters;
     std::vector<Filter> terminators;
     std::vector<PostProcessor> post_processors;
+    std::unique_ptr<StackTemplates> templates;
+    std::vector<FusedFilters> fused_filters;
   };
 
   StackConfig stack_configs_[GRPC_NUM_CHANNEL_STACK_TYPES];
 
   static StackConfig BuildStackConfig(
       const std::vector<std::unique_ptr<FilterRegistration>>& registrations,
-      PostProcessor* post_processors, grpc_channel_stack_type type);
+      PostProcessor* post_processors, std::vector<FusedFilters> fused_filters,
+      grpc_channel_stack_type type);
+  // Returns the run of stack_config.fused_filters that \a selected starts
+  // with at \a start, if any.
+  static const FusedFilters* FindFusedFilters(
+      const StackConfig& stack_config,
+      const std::vector<const Filter*>& selected, size_t start);
   static void PrintChannelStackTrace(
       grpc_channel_stack_type type,
       const std::vector<std::unique_ptr<ChannelInit::FilterRegistration>>&
@@ -277,22 +277,29 @@ void ClientCall::CommitBatch(const grpc_op* ops, size_t nops, void* notify_tag,
   }
   if (!is_notify_tag_closure) grpc_cq_begin_op(cq_, notify_tag);
   BatchOpIndex op_index(ops, nops);
-  auto send_message =
-      op_index.OpHandler<GRPC_OP_SEND_MESSAGE>([this](const grpc_op& op) {
-        SliceBuffer send;
-        grpc_slice_buffer_swap(
-            &op.data.send_message.send_message->data.raw.slice_buffer,
-            send.c_slice_buffer());
-        auto msg = arena()->MakePooled<Message>(std::move(send), op.flags);
-        return [this, msg = std::move(msg)]() mutable {
-          return started_call_initiator_.PushMessage(std::move(msg));
+  // A batch with both a message and the close (as for unary calls) pushes the
+  // two together, rather than closing only once the message has been pulled.
+  const bool send_message_and_close =
+      op_index.op(GRPC_OP_SEND_MESSAGE) != nullptr &&
+      op_index.op(GRPC_OP_SEND_CLOSE_FROM_CLIENT) != nullptr;
+  auto send_message = op_index.OpHandler<GRPC_OP_SEND_MESSAGE>(
+      [this, send_message_and_close](const grpc_op& op) {
+        auto msg = TakeSendMessage(arena(), op.data.send_message.send_message,
+                                   op.flags);
+        return [this, send_message_and_close, msg = std::move(msg)]() mutable {
+          return send_message_and_close
+                     ? started_call_initiator_.PushMessageAndFinishSends(
+                           std::move(msg))
+                     : started_call_initiator_.PushMessage(std::move(msg));
         };
       });
   auto send_close_from_client =
       op_index.OpHandler<GRPC_OP_SEND_CLOSE_FROM_CLIENT>(
-          [this](const grpc_op&) {
-            return [this]() {
-              started_call_initiator_.FinishSends();
+          [this, send_message_and_close](const grpc_op&) {
+            return [this, send_message_and_close]() {
+              if (!send_message_and_close) {
+                started_call_initiator_.FinishSends();
+              }
               return Success{};
             };
           });
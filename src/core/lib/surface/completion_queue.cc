@@ -938,21 +938,23 @@ static void dump_pending_tags(grpc_completion_queue* cq) {
 static void dump_pending_tags(grpc_completion_queue* /*cq*/) {}
 #endif
 
-static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
-                          void* reserved) {
-  grpc_event ret;
-  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
+// Stores the event of \a c in \a ret and releases \a c.
+static void cq_completion_to_event(grpc_cq_completion* c, grpc_event* ret) {
+  ret->type = GRPC_OP_COMPLETE;
+  ret->success = c->next & 1u;
+  ret->tag = c->tag;
+  c->done(c->done_arg, c);
+}
 
-  GRPC_API_TRACE(
-      "grpc_completion_queue_next("
-      "cq=%p, "
-      "deadline=gpr_timespec { tv_sec: %" PRId64
-      ", tv_nsec: %d, clock_type: %d }, "
-      "reserved=%p)",
-      5,
-      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
-       reserved));
-  CHECK(!reserved);
+// Waits like cq_next for the first event, then also takes the completions
+// that are already queued, up to \a max_events events in total. Returns the
+// number of events stored in \a events, at least one: a timeout or shutdown
+// event is always the only one.
+static size_t cq_next_batch(grpc_completion_queue* cq, grpc_event* events,
+                            size_t max_events, gpr_timespec deadline) {
+  grpc_event& ret = events[0];
+  size_t num_events = 1;
+  cq_next_data* cqd = static_cast<cq_next_data*> DATA_FROM_CQ(cq);
 
   dump_pending_tags(cq);
 
@@ -974,20 +976,14 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     if (is_finished_arg.stolen_completion != nullptr) {
       grpc_cq_completion* c = is_finished_arg.stolen_completion;
       is_finished_arg.stolen_completion = nullptr;
-      ret.type = GRPC_OP_COMPLETE;
-      ret.success = c->next & 1u;
-      ret.tag = c->tag;
-      c->done(c->done_arg, c);
+      cq_completion_to_event(c, &ret);
       break;
     }
 
     grpc_cq_completion* c = cqd->queue.Pop();
 
     if (c != nullptr) {
-      ret.type = GRPC_OP_COMPLETE;
-      ret.success = c->next & 1u;
-      ret.tag = c->tag;
-      c->done(c->done_arg, c);
+      cq_completion_to_event(c, &ret);
       break;
     } else {
       // If c == NULL it means either the queue is empty OR in an transient
@@ -1048,6 +1044,16 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     is_finished_arg.first_loop = false;
   }
 
+  // Take what is already queued without polling again. Pop() may miss an
+  // item that is being pushed: it is left for the next call.
+  if (ret.type == GRPC_OP_COMPLETE) {
+    while (num_events < max_events) {
+      grpc_cq_completion* c = cqd->queue.Pop();
+      if (c == nullptr) break;
+      cq_completion_to_event(c, &events[num_events++]);
+    }
+  }
+
   if (cqd->queue.num_items() > 0 &&
       cqd->pending_events.load(std::memory_order_acquire) > 0) {
     gpr_mu_lock(cq->mu);
@@ -1055,11 +1061,31 @@ static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
     gpr_mu_unlock(cq->mu);
   }
 
-  GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &ret);
+  for (size_t i = 0; i < num_events; i++) {
+    GRPC_SURFACE_TRACE_RETURNED_EVENT(cq, &events[i]);
+  }
   GRPC_CQ_INTERNAL_UNREF(cq, "next");
 
   CHECK_EQ(is_finished_arg.stolen_completion, nullptr);
 
+  return num_events;
+}
+
+static grpc_event cq_next(grpc_completion_queue* cq, gpr_timespec deadline,
+                          void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next("
+      "cq=%p, "
+      "deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      5,
+      (cq, deadline.tv_sec, deadline.tv_nsec, (int)deadline.clock_type,
+       reserved));
+  CHECK(!reserved);
+
+  grpc_event ret;
+  cq_next_batch(cq, &ret, 1, deadline);
   return ret;
 }
 
@@ -1110,6 +1136,25 @@ grpc_event grpc_completion_queue_next(grpc_completion_queue* cq,
   return cq->vtable->next(cq, deadline, reserved);
 }
 
+size_t grpc_completion_queue_next_batch(grpc_completion_queue* cq,
+                                        grpc_event* events, size_t max_events,
+                                        gpr_timespec deadline,
+                                        void* reserved) {
+  GRPC_API_TRACE(
+      "grpc_completion_queue_next_batch("
+      "cq=%p, events=%p, max_events=%" PRIuPTR
+      ", deadline=gpr_timespec { tv_sec: %" PRId64
+      ", tv_nsec: %d, clock_type: %d }, "
+      "reserved=%p)",
+      7,
+      (cq, events, max_events, deadline.tv_sec, deadline.tv_nsec,
+       (int)deadline.clock_type, reserved));
+  CHECK(!reserved);
+  CHECK_EQ(cq->vtable->cq_completion_type, GRPC_CQ_NEXT);
+  CHECK_GT(max_events, 0u);
+  return cq_next_batch(cq, events, max_events, deadline);
+}
+
 static int add_plucker(grpc_completion_queue* cq, void* tag,
                        grpc_pollset_worker** worker) {
   cq_pluck_data* cqd = static_cast<cq_pluck_data*> DATA_FROM_CQ(cq);
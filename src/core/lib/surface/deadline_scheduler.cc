@@ -0,0 +1,137 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/deadline_scheduler.h"
+
+#include <stdint.h>
+
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/log/check.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+
+namespace {
+
+// Slots are per EventEngine: calls with different engines (in tests, or
+// with fuzzing engines) never share a timer.
+using SlotKey = std::pair<EventEngine*, int64_t>;
+
+}  // namespace
+
+class DeadlineScheduler::Shard {
+ public:
+  Mutex mu;
+  absl::flat_hash_map<SlotKey, Slot*> slots ABSL_GUARDED_BY(mu);
+};
+
+class DeadlineScheduler::Slot {
+ public:
+  Slot(Shard* shard, SlotKey key) : shard(shard), key(std::move(key)) {}
+
+  Shard* const shard;
+  const SlotKey key;
+  EventEngine::TaskHandle timer;
+  Entry* entries ABSL_GUARDED_BY(shard->mu) = nullptr;
+};
+
+void DeadlineScheduler::Schedule(EventEngine* event_engine, Timestamp deadline,
+                                 Duration slot_duration,
+                                 EventEngine::Closure* closure, Entry* entry) {
+  DCHECK_GT(slot_duration, Duration::Zero());
+  const int64_t slot_ms = slot_duration.millis();
+  const int64_t slot_index =
+      (deadline.milliseconds_after_process_epoch() + slot_ms - 1) / slot_ms;
+  static PerCpu<Shard>* shards =
+      new PerCpu<Shard>(PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32));
+  Shard* shard = &shards->this_cpu();
+  const SlotKey key(event_engine, slot_index);
+  MutexLock lock(&shard->mu);
+  Slot*& slot = shard->slots[key];
+  if (slot == nullptr) {
+    slot = new Slot(shard, key);
+    Slot* new_slot = slot;
+    slot->timer = event_engine->RunAfter(
+        Timestamp::FromMillisecondsAfterProcessEpoch(slot_index * slot_ms) -
+            Timestamp::Now(),
+        [new_slot]() { RunSlot(new_slot); });
+  }
+  entry->closure_ = closure;
+  entry->shard_ = shard;
+  entry->slot_ = slot;
+  entry->prev_ = nullptr;
+  entry->next_ = slot->entries;
+  if (entry->next_ != nullptr) entry->next_->prev_ = entry;
+  slot->entries = entry;
+}
+
+bool DeadlineScheduler::Cancel(Entry* entry) {
+  // The shard is only changed by Schedule(), which callers do not run
+  // concurrently with Cancel() for the same entry.
+  Shard* shard = entry->shard_;
+  if (shard == nullptr) return false;
+  ReleasableMutexLock lock(&shard->mu);
+  Slot* slot = entry->slot_;
+  if (slot == nullptr) return false;
+  if (entry->prev_ != nullptr) {
+    entry->prev_->next_ = entry->next_;
+  } else {
+    slot->entries = entry->next_;
+  }
+  if (entry->next_ != nullptr) entry->next_->prev_ = entry->prev_;
+  entry->slot_ = nullptr;
+  if (slot->entries != nullptr) return true;
+  // That was the last entry: stop the slot's timer, or if it is already
+  // running, leave the (empty) slot for RunSlot to delete. Either way new
+  // deadlines for this slot get a fresh one from here on.
+  auto it = shard->slots.find(slot->key);
+  if (it != shard->slots.end() && it->second == slot) shard->slots.erase(it);
+  if (!slot->key.first->Cancel(slot->timer)) return true;
+  lock.Release();
+  delete slot;
+  return true;
+}
+
+void DeadlineScheduler::RunSlot(Slot* slot) {
+  Shard* shard = slot->shard;
+  Entry* entries;
+  {
+    MutexLock lock(&shard->mu);
+    auto it = shard->slots.find(slot->key);
+    if (it != shard->slots.end() && it->second == slot) shard->slots.erase(it);
+    entries = std::exchange(slot->entries, nullptr);
+    for (Entry* entry = entries; entry != nullptr; entry = entry->next_) {
+      entry->slot_ = nullptr;
+    }
+  }
+  delete slot;
+  // Entries are detached now: Cancel() fails for them, so nothing else touches
+  // their links, but running a closure may destroy its entry.
+  while (entries != nullptr) {
+    Entry* next = entries->next_;
+    entries->closure_->Run();
+    entries = next;
+  }
+}
+
+}  // namespace grpc_core
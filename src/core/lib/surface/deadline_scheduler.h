@@ -0,0 +1,77 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SURFACE_DEADLINE_SCHEDULER_H
+#define GRPC_SRC_CORE_LIB_SURFACE_DEADLINE_SCHEDULER_H
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_core {
+
+// Runs call deadline closures from coarse, shared timers.
+//
+// Deadlines are rounded up to a multiple of a slot duration, and all the
+// closures whose deadline lands in the same slot (for the same EventEngine, on
+// the same shard - one per few CPUs) are run by a single EventEngine timer.
+// With many calls in flight that replaces one timer per call by one timer per
+// slot, and scheduling or cancelling a deadline becomes a list insertion or
+// removal under a shard mutex. Closures run at most one slot duration late,
+// never early.
+class DeadlineScheduler {
+ public:
+  class Shard;
+  class Slot;
+
+  // Links a closure into its slot. Owned by the caller, which must keep it
+  // alive until it is cancelled or its closure has run.
+  class Entry {
+   public:
+    Entry() = default;
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+
+   private:
+    friend class DeadlineScheduler;
+
+    grpc_event_engine::experimental::EventEngine::Closure* closure_ = nullptr;
+    // The shard the entry was last scheduled on.
+    Shard* shard_ = nullptr;
+    // Non-null while scheduled; guarded by the mutex of shard_.
+    Slot* slot_ = nullptr;
+    Entry* prev_ = nullptr;
+    Entry* next_ = nullptr;
+  };
+
+  // Runs \a closure on \a event_engine at \a deadline, rounded up to a
+  // multiple of \a slot_duration. \a entry must not be scheduled already.
+  static void Schedule(
+      grpc_event_engine::experimental::EventEngine* event_engine,
+      Timestamp deadline, Duration slot_duration,
+      grpc_event_engine::experimental::EventEngine::Closure* closure,
+      Entry* entry);
+
+  // Cancels a scheduled \a entry. Returns false if its closure has already
+  // run or is about to, as EventEngine::Cancel does.
+  static bool Cancel(Entry* entry);
+
+ private:
+  static void RunSlot(Slot* slot);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SURFACE_DEADLINE_SCHEDULER_H
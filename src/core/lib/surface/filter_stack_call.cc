@@ -65,9 +65,11 @@
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/surface/validate_metadata.h"
 #include "src/core/lib/transport/error_utils.h"
+#include "src/core/lib/transport/message.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
 #include "src/core/server/server_interface.h"
+#include "src/core/telemetry/call_phase_timestamps.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/telemetry/stats_data.h"
@@ -108,9 +110,16 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
       GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(FilterStackCall)) +
       channel_stack->call_stack_size;
 
-  RefCountedPtr<Arena> arena = channel->call_arena_allocator()->MakeArena();
+  RefCountedPtr<Arena> arena =
+      args->path.has_value()
+          ? channel->call_arena_allocator()->MakeArenaForMethod(
+                args->path->as_string_view())
+          : channel->call_arena_allocator()->MakeArena();
   arena->SetContext<grpc_event_engine::experimental::EventEngine>(
       args->channel->event_engine());
+  if (GPR_UNLIKELY(channel->records_call_phase_timestamps())) {
+    arena->SetContext<CallPhaseTimestamps>(arena->New<CallPhaseTimestamps>());
+  }
   call = new (arena->Alloc(call_alloc_size)) FilterStackCall(arena, *args);
   DCHECK(FromC(call->c_ptr()) == call);
   DCHECK(FromCallStack(call->call_stack()) == call);
@@ -835,6 +844,8 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
           error = GRPC_CALL_ERROR_TOO_MANY_OPERATIONS;
           goto done_with_error;
         }
+        // Filter stack transports only carry bytes.
+        MessageObject::Materialize(op->data.send_message.send_message);
         uint32_t flags = op->flags;
         // If the outgoing buffer is already compressed, mark it as so in the
         // flags. These will be picked up by the compression filter and further
@@ -915,8 +926,8 @@ grpc_call_error FilterStackCall::StartBatch(const grpc_op* ops, size_t nops,
         if (op->data.send_status_from_server.status_details != nullptr) {
           send_trailing_metadata_.Set(
               GrpcMessageMetadata(),
-              Slice(grpc_slice_copy(
-                  *op->data.send_status_from_server.status_details)));
+              StatusDetailsSlice(
+                  *op->data.send_status_from_server.status_details));
           if (!status_error.ok()) {
             status_error = grpc_error_set_str(
                 status_error, StatusStrProperty::kGrpcMessage,
@@ -30,6 +30,7 @@
 #include <grpc/support/time.h>
 
 #include "src/core/client_channel/backup_poller.h"
+#include "src/core/client_channel/global_subchannel_pool.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/posix_engine/timer_manager.h"
@@ -162,7 +163,7 @@ void grpc_shutdown_from_cleanup_thread(void* /*ignored*/) {
 
 void grpc_shutdown(void) {
   GRPC_API_TRACE("grpc_shutdown(void)", 0, ());
-  grpc_core::MutexLock lock(g_init_mu);
+  grpc_core::ReleasableMutexLock lock(g_init_mu);
 
   if (--g_initializations == 0) {
     grpc_core::ApplicationCallbackExecCtx* acec =
@@ -190,6 +191,13 @@ void grpc_shutdown(void) {
           grpc_core::Thread::Options().set_joinable(false).set_tracked(false));
       cleanup_thread.Start();
     }
+  } else if (static_cast<size_t>(g_initializations) <=
+             grpc_core::GlobalSubchannelPool::WarmSubchannelCount()) {
+    // Each subchannel holds a grpc_init() ref, so if only the ones kept warm
+    // by the global subchannel pool are left, let go of them to finish
+    // shutting down.  Destroying them calls back in here.
+    lock.Release();
+    grpc_core::GlobalSubchannelPool::FlushWarmSubchannels();
   }
 }
 
@@ -136,11 +136,8 @@ void ServerCall::CommitBatch(const grpc_op* ops, size_t nops, void* notify_tag,
       });
   auto send_message =
       op_index.OpHandler<GRPC_OP_SEND_MESSAGE>([this](const grpc_op& op) {
-        SliceBuffer send;
-        grpc_slice_buffer_swap(
-            &op.data.send_message.send_message->data.raw.slice_buffer,
-            send.c_slice_buffer());
-        auto msg = arena()->MakePooled<Message>(std::move(send), op.flags);
+        auto msg = TakeSendMessage(arena(), op.data.send_message.send_message,
+                                   op.flags);
         return [this, msg = std::move(msg)]() mutable {
           return call_handler_.PushMessage(std::move(msg));
         };
@@ -156,12 +153,8 @@ void ServerCall::CommitBatch(const grpc_op* ops, size_t nops, void* notify_tag,
                           op.data.send_status_from_server.status);
             if (auto* details =
                     op.data.send_status_from_server.status_details) {
-              // TODO(ctiller): this should not be a copy, but we have
-              // callers that allocate and pass in a slice created with
-              // grpc_slice_from_static_string and then delete the string
-              // after passing it in, which shouldn't be a supported API.
               metadata->Set(GrpcMessageMetadata(),
-                            Slice(grpc_slice_copy(*details)));
+                            StatusDetailsSlice(*details));
             }
             CHECK(metadata != nullptr);
             return [this, metadata = std::move(metadata)]() mutable {
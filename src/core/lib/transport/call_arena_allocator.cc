@@ -16,8 +16,13 @@
 
 #include <algorithm>
 
+#include "absl/hash/hash.h"
+
 #include <grpc/support/port_platform.h>
 
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
 namespace grpc_core {
 
 void CallSizeEstimator::UpdateCallSizeEstimate(size_t size) {
@@ -38,4 +43,60 @@ void CallSizeEstimator::UpdateCallSizeEstimate(size_t size) {
   }
 }
 
+CallArenaAllocator::~CallArenaAllocator() {
+  for (auto& entry : method_estimators_) {
+    delete entry.load(std::memory_order_relaxed);
+  }
+}
+
+RefCountedPtr<Arena> CallArenaAllocator::MakeArenaForMethod(
+    absl::string_view method) {
+  CallSizeEstimator* estimator = EstimatorForMethod(method);
+  if (estimator == nullptr) return MakeArena();
+  auto arena = Arena::Create(estimator->CallSizeEstimate(), Ref());
+  arena->SetContext<CallSizeEstimator>(estimator);
+  return arena;
+}
+
+void CallArenaAllocator::FinalizeArena(Arena* arena) {
+  const size_t used = arena->TotalUsedBytes();
+  call_size_estimator_.UpdateCallSizeEstimate(used);
+  // The arena has destroyed its contexts by now, but ours did not need
+  // destroying and its pointer is still there.
+  CallSizeEstimator* estimator = arena->GetContext<CallSizeEstimator>();
+  if (estimator != nullptr) estimator->UpdateCallSizeEstimate(used);
+  if (used < arena->InitialZoneSize()) {
+    global_stats().IncrementCallArenaWastedBytes(arena->InitialZoneSize() -
+                                                 used);
+  }
+}
+
+size_t CallArenaAllocator::CallSizeEstimateForMethod(absl::string_view method) {
+  CallSizeEstimator* estimator = EstimatorForMethod(method);
+  if (estimator == nullptr) return CallSizeEstimate();
+  return estimator->CallSizeEstimate();
+}
+
+CallSizeEstimator* CallArenaAllocator::EstimatorForMethod(
+    absl::string_view method) {
+  const size_t hash = absl::HashOf(method);
+  for (size_t i = 0; i < kMaxMethods; ++i) {
+    auto& slot = method_estimators_[(hash + i) % kMaxMethods];
+    MethodCallSizeEstimator* entry = slot.load(std::memory_order_acquire);
+    if (entry == nullptr) {
+      // New methods start from the channel-wide estimate.
+      auto* new_entry = new MethodCallSizeEstimator(hash, CallSizeEstimate());
+      if (slot.compare_exchange_strong(entry, new_entry,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+        return &new_entry->estimator;
+      }
+      // Lost the race: entry is now whatever was added instead.
+      delete new_entry;
+    }
+    if (entry->hash == hash) return &entry->estimator;
+  }
+  return nullptr;
+}
+
 }  // namespace grpc_core
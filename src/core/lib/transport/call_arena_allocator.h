@@ -20,6 +20,8 @@
 #include <atomic>
 #include <cstddef>
 
+#include "absl/strings/string_view.h"
+
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -52,24 +54,54 @@ class CallSizeEstimator final {
   std::atomic<size_t> call_size_estimate_;
 };
 
+// The per-method estimator an arena was sized from, if any. Estimators are
+// owned by their CallArenaAllocator.
+template <>
+struct ArenaContextType<CallSizeEstimator> {
+  static void Destroy(CallSizeEstimator*) {}
+};
+
 class CallArenaAllocator final : public ArenaFactory {
  public:
   CallArenaAllocator(MemoryAllocator allocator, size_t initial_size)
       : ArenaFactory(std::move(allocator)),
         call_size_estimator_(initial_size) {}
+  ~CallArenaAllocator() override;
 
   RefCountedPtr<Arena> MakeArena() override {
     return Arena::Create(call_size_estimator_.CallSizeEstimate(), Ref());
   }
 
-  void FinalizeArena(Arena* arena) override {
-    call_size_estimator_.UpdateCallSizeEstimate(arena->TotalUsedBytes());
-  }
+  // Make an arena for a call to \a method (the call path). The first
+  // kMaxMethods methods seen each get their own size estimate, so that a
+  // method with large calls does not inflate the arenas of the others; calls
+  // to any further methods share the channel-wide estimate.
+  RefCountedPtr<Arena> MakeArenaForMethod(absl::string_view method);
+
+  void FinalizeArena(Arena* arena) override;
 
   size_t CallSizeEstimate() { return call_size_estimator_.CallSizeEstimate(); }
+  size_t CallSizeEstimateForMethod(absl::string_view method);
+
+  static constexpr size_t kMaxMethods = 32;
 
  private:
+  struct MethodCallSizeEstimator {
+    MethodCallSizeEstimator(size_t hash, size_t initial_estimate)
+        : hash(hash), estimator(initial_estimate) {}
+    const size_t hash;
+    CallSizeEstimator estimator;
+  };
+
+  // Returns the estimator for \a method, creating it if there is still room
+  // for it, or nullptr.
+  CallSizeEstimator* EstimatorForMethod(absl::string_view method);
+
+  // Updated by every call, and used for calls with no method.
   CallSizeEstimator call_size_estimator_;
+  // Open addressed table of the per-method estimators, indexed by a hash of
+  // the method. Entries are only ever added.
+  std::atomic<MethodCallSizeEstimator*> method_estimators_[kMaxMethods]{};
 };
 
 }  // namespace grpc_core
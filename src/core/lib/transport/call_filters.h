@@ -19,9 +19,12 @@
 #include <limits>
 #include <memory>
 #include <ostream>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 #include "absl/log/check.h"
+#include "absl/meta/type_traits.h"
 
 #include <grpc/support/port_platform.h>
 
@@ -1059,6 +1062,318 @@ struct StackData {
   }
 };
 
+// Fused filters
+// StackBuilder::AddFused() adds a fixed list of filters whose interceptors for
+// a given hook can all run synchronously and in place. Each such hook gets one
+// operation in the layout, which calls every filter's interceptor directly
+// (and so inlinably), instead of one operation per filter with the indirect
+// call and layout walk that implies.
+// Hooks where some filter's interceptor cannot be fused (it returns a promise
+// or replaces the value's handle) fall back to one operation per filter, as
+// Add() would produce.
+
+template <typename R>
+struct IsFusibleResult : std::false_type {};
+template <>
+struct IsFusibleResult<void> : std::true_type {};
+template <>
+struct IsFusibleResult<absl::Status> : std::true_type {};
+template <>
+struct IsFusibleResult<ServerMetadataHandle> : std::true_type {};
+
+inline ServerMetadataHandle FusedResult(absl::Status status) {
+  if (status.ok()) return nullptr;
+  return StatusCast<ServerMetadataHandle>(std::move(status));
+}
+inline ServerMetadataHandle FusedResult(ServerMetadataHandle md) { return md; }
+
+// Runs an interceptor, and returns nullptr on success or the metadata to fail
+// the call with.
+template <typename Fn>
+absl::enable_if_t<std::is_void<decltype(std::declval<Fn>()())>::value,
+                  ServerMetadataHandle>
+RunFused(Fn fn) {
+  fn();
+  return nullptr;
+}
+template <typename Fn>
+absl::enable_if_t<!std::is_void<decltype(std::declval<Fn>()())>::value,
+                  ServerMetadataHandle>
+RunFused(Fn fn) {
+  return FusedResult(fn());
+}
+
+// FusedOp describes how one filter's interceptor runs within a fused
+// operation: kFusible is false for those that cannot.
+template <typename FilterType, typename T, typename FunctionImpl,
+          FunctionImpl impl, typename SfinaeVoid = void>
+struct FusedOp {
+  static constexpr bool kFusible = false;
+  static constexpr bool kIntercepts = true;
+};
+
+template <typename FilterType, typename T, const NoInterceptor* which>
+struct FusedOp<FilterType, T, const NoInterceptor*, which> {
+  static constexpr bool kFusible = true;
+  static constexpr bool kIntercepts = false;
+  static ServerMetadataHandle Run(void*, FilterType*,
+                                  typename T::element_type&) {
+    return nullptr;
+  }
+};
+
+// R $INTERCEPTOR_NAME($VALUE_TYPE&)
+template <typename FilterType, typename T, typename R,
+          R (FilterType::Call::*impl)(typename T::element_type&)>
+struct FusedOp<FilterType, T,
+               R (FilterType::Call::*)(typename T::element_type&), impl,
+               absl::enable_if_t<IsFusibleResult<R>::value>> {
+  static constexpr bool kFusible = true;
+  static constexpr bool kIntercepts = true;
+  static ServerMetadataHandle Run(void* call_data, FilterType*,
+                                  typename T::element_type& value) {
+    return RunFused([call_data, &value]() {
+      return (static_cast<typename FilterType::Call*>(call_data)->*impl)(value);
+    });
+  }
+};
+
+// R $INTERCEPTOR_NAME(const $VALUE_TYPE&)
+template <typename FilterType, typename T, typename R,
+          R (FilterType::Call::*impl)(const typename T::element_type&)>
+struct FusedOp<FilterType, T,
+               R (FilterType::Call::*)(const typename T::element_type&), impl,
+               absl::enable_if_t<IsFusibleResult<R>::value>> {
+  static constexpr bool kFusible = true;
+  static constexpr bool kIntercepts = true;
+  static ServerMetadataHandle Run(void* call_data, FilterType*,
+                                  typename T::element_type& value) {
+    return RunFused([call_data, &value]() {
+      return (static_cast<typename FilterType::Call*>(call_data)->*impl)(value);
+    });
+  }
+};
+
+// R $INTERCEPTOR_NAME($VALUE_TYPE&, FilterType*)
+template <typename FilterType, typename T, typename R,
+          R (FilterType::Call::*impl)(typename T::element_type&, FilterType*)>
+struct FusedOp<
+    FilterType, T,
+    R (FilterType::Call::*)(typename T::element_type&, FilterType*), impl,
+    absl::enable_if_t<IsFusibleResult<R>::value>> {
+  static constexpr bool kFusible = true;
+  static constexpr bool kIntercepts = true;
+  static ServerMetadataHandle Run(void* call_data, FilterType* channel_data,
+                                  typename T::element_type& value) {
+    return RunFused([call_data, channel_data, &value]() {
+      return (static_cast<typename FilterType::Call*>(call_data)->*impl)(
+          value, channel_data);
+    });
+  }
+};
+
+// R $INTERCEPTOR_NAME(const $VALUE_TYPE&, FilterType*)
+template <typename FilterType, typename T, typename R,
+          R (FilterType::Call::*impl)(const typename T::element_type&,
+                                      FilterType*)>
+struct FusedOp<
+    FilterType, T,
+    R (FilterType::Call::*)(const typename T::element_type&, FilterType*),
+    impl, absl::enable_if_t<IsFusibleResult<R>::value>> {
+  static constexpr bool kFusible = true;
+  static constexpr bool kIntercepts = true;
+  static ServerMetadataHandle Run(void* call_data, FilterType* channel_data,
+                                  typename T::element_type& value) {
+    return RunFused([call_data, channel_data, &value]() {
+      return (static_cast<typename FilterType::Call*>(call_data)->*impl)(
+          value, channel_data);
+    });
+  }
+};
+
+// The hooks that can be fused: for each, how to fuse a filter's interceptor,
+// which layout it goes in, and how to add it unfused.
+struct ClientInitialMetadataHook {
+  using Handle = ClientMetadataHandle;
+  static constexpr bool kServerToClient = false;
+  template <typename FilterType>
+  using Op = FusedOp<FilterType, Handle,
+                     decltype(&FilterType::Call::OnClientInitialMetadata),
+                     &FilterType::Call::OnClientInitialMetadata>;
+  static Layout<Handle>& layout(StackData& data) {
+    return data.client_initial_metadata;
+  }
+  template <typename FilterType>
+  static void AddUnfused(StackData& data, FilterType* channel_data,
+                         size_t call_offset) {
+    data.AddClientInitialMetadataOp(channel_data, call_offset);
+  }
+};
+
+struct ServerInitialMetadataHook {
+  using Handle = ServerMetadataHandle;
+  static constexpr bool kServerToClient = true;
+  template <typename FilterType>
+  using Op = FusedOp<FilterType, Handle,
+                     decltype(&FilterType::Call::OnServerInitialMetadata),
+                     &FilterType::Call::OnServerInitialMetadata>;
+  static Layout<Handle>& layout(StackData& data) {
+    return data.server_initial_metadata;
+  }
+  template <typename FilterType>
+  static void AddUnfused(StackData& data, FilterType* channel_data,
+                         size_t call_offset) {
+    data.AddServerInitialMetadataOp(channel_data, call_offset);
+  }
+};
+
+struct ClientToServerMessageHook {
+  using Handle = MessageHandle;
+  static constexpr bool kServerToClient = false;
+  template <typename FilterType>
+  using Op = FusedOp<FilterType, Handle,
+                     decltype(&FilterType::Call::OnClientToServerMessage),
+                     &FilterType::Call::OnClientToServerMessage>;
+  static Layout<Handle>& layout(StackData& data) {
+    return data.client_to_server_messages;
+  }
+  template <typename FilterType>
+  static void AddUnfused(StackData& data, FilterType* channel_data,
+                         size_t call_offset) {
+    data.AddClientToServerMessageOp(channel_data, call_offset);
+  }
+};
+
+struct ServerToClientMessageHook {
+  using Handle = MessageHandle;
+  static constexpr bool kServerToClient = true;
+  template <typename FilterType>
+  using Op = FusedOp<FilterType, Handle,
+                     decltype(&FilterType::Call::OnServerToClientMessage),
+                     &FilterType::Call::OnServerToClientMessage>;
+  static Layout<Handle>& layout(StackData& data) {
+    return data.server_to_client_messages;
+  }
+  template <typename FilterType>
+  static void AddUnfused(StackData& data, FilterType* channel_data,
+                         size_t call_offset) {
+    data.AddServerToClientMessageOp(channel_data, call_offset);
+  }
+};
+
+// The channel data of fused operations: the filters that were fused, and the
+// offsets of their call data.
+template <typename... FilterTypes>
+class FusedFilters {
+ public:
+  static constexpr size_t kNumFilters = sizeof...(FilterTypes);
+  static_assert(kNumFilters > 0, "nothing to fuse");
+
+  explicit FusedFilters(FilterTypes*... filters) : filters_(filters...) {}
+
+  void set_call_offset(size_t i, size_t call_offset) {
+    call_offsets_[i] = call_offset;
+  }
+
+  // Adds the operation (or operations) for Hook to data.
+  template <typename Hook>
+  void AddOps(StackData& data) {
+    AddOps<Hook>(data,
+                 absl::conjunction<std::integral_constant<
+                     bool, Hook::template Op<FilterTypes>::kFusible>...>(),
+                 absl::disjunction<std::integral_constant<
+                     bool, Hook::template Op<FilterTypes>::kIntercepts>...>());
+  }
+
+ private:
+  template <size_t I>
+  using Filter =
+      typename std::tuple_element<I, std::tuple<FilterTypes...>>::type;
+
+  // Fusible, but none of the filters intercept this hook.
+  template <typename Hook>
+  void AddOps(StackData&, std::true_type, std::false_type) {}
+
+  template <typename Hook>
+  void AddOps(StackData& data, std::true_type, std::true_type) {
+    using Handle = typename Hook::Handle;
+    Hook::layout(data).Add(
+        0, 0,
+        Operator<Handle>{
+            this,
+            0,
+            [](void*, void* call_data, void* channel_data,
+               Handle value) -> Poll<ResultOr<Handle>> {
+              auto* fused = static_cast<FusedFilters*>(channel_data);
+              ServerMetadataHandle error =
+                  Hook::kServerToClient
+                      ? fused->template RunReverse<Hook>(
+                            call_data, *value,
+                            std::integral_constant<size_t, kNumFilters>())
+                      : fused->template RunForward<Hook>(
+                            call_data, *value,
+                            std::integral_constant<size_t, 0>());
+              if (error != nullptr) {
+                return ResultOr<Handle>{nullptr, std::move(error)};
+              }
+              return ResultOr<Handle>{std::move(value), nullptr};
+            },
+            nullptr,
+            nullptr,
+        });
+  }
+
+  template <typename Hook, typename IgnoredIntercepts>
+  void AddOps(StackData& data, std::false_type, IgnoredIntercepts) {
+    AddUnfusedOps<Hook>(data, std::integral_constant<size_t, 0>());
+  }
+
+  template <typename Hook>
+  void AddUnfusedOps(StackData&, std::integral_constant<size_t, kNumFilters>) {}
+  template <typename Hook, size_t I>
+  void AddUnfusedOps(StackData& data, std::integral_constant<size_t, I>) {
+    Hook::AddUnfused(data, std::get<I>(filters_), call_offsets_[I]);
+    AddUnfusedOps<Hook>(data, std::integral_constant<size_t, I + 1>());
+  }
+
+  // Runs the interceptors of filters I.. in the order they were added.
+  template <typename Hook, typename Value>
+  ServerMetadataHandle RunForward(void*, Value&,
+                                  std::integral_constant<size_t, kNumFilters>) {
+    return nullptr;
+  }
+  template <typename Hook, typename Value, size_t I>
+  ServerMetadataHandle RunForward(void* call_data, Value& value,
+                                  std::integral_constant<size_t, I>) {
+    ServerMetadataHandle error = Hook::template Op<Filter<I>>::Run(
+        Offset(call_data, call_offsets_[I]), std::get<I>(filters_), value);
+    if (error != nullptr) return error;
+    return RunForward<Hook>(call_data, value,
+                            std::integral_constant<size_t, I + 1>());
+  }
+
+  // Runs the interceptors of filters ..I-1 in the reverse of the order they
+  // were added, as server to client hooks are.
+  template <typename Hook, typename Value>
+  ServerMetadataHandle RunReverse(void*, Value&,
+                                  std::integral_constant<size_t, 0>) {
+    return nullptr;
+  }
+  template <typename Hook, typename Value, size_t I>
+  ServerMetadataHandle RunReverse(void* call_data, Value& value,
+                                  std::integral_constant<size_t, I>) {
+    ServerMetadataHandle error = Hook::template Op<Filter<I - 1>>::Run(
+        Offset(call_data, call_offsets_[I - 1]), std::get<I - 1>(filters_),
+        value);
+    if (error != nullptr) return error;
+    return RunReverse<Hook>(call_data, value,
+                            std::integral_constant<size_t, I - 1>());
+  }
+
+  std::tuple<FilterTypes*...> filters_;
+  size_t call_offsets_[kNumFilters] = {};
+};
+
 // OperationExecutor is a helper class to execute a sequence of operations
 // from a layout on one value.
 // We instantiate one of these during the *Pull* promise for each operation
@@ -1240,6 +1555,26 @@ class CallFilters {
       data_.AddFinalizer(filter, call_offset, &FilterType::Call::OnFinalize);
     }
 
+    // Add filters, in order, as though by calling Add() on each: except that
+    // where every filter's interceptor for a hook can be fused (see
+    // filters_detail::FusedOp) a single operation runs all of them.
+    // Intended for the fixed sets of filters that most channels share.
+    template <typename... FilterTypes>
+    void AddFused(FilterTypes*... filters) {
+      auto fused =
+          std::make_unique<filters_detail::FusedFilters<FilterTypes...>>(
+              filters...);
+      size_t i = 0;
+      int unused[] = {(fused->set_call_offset(i++, AddUnfusedHooks(filters)),
+                       0)...};
+      (void)unused;
+      fused->template AddOps<filters_detail::ClientInitialMetadataHook>(data_);
+      fused->template AddOps<filters_detail::ServerInitialMetadataHook>(data_);
+      fused->template AddOps<filters_detail::ClientToServerMessageHook>(data_);
+      fused->template AddOps<filters_detail::ServerToClientMessageHook>(data_);
+      AddOwnedObject(std::move(fused));
+    }
+
     void AddOwnedObject(void (*destroy)(void* p), void* p) {
       data_.channel_data_destructors.push_back({destroy, p});
     }
@@ -1273,6 +1608,17 @@ class CallFilters {
     RefCountedPtr<Stack> Build();
 
    private:
+    // Adds the call data and the hooks that are never fused for filter, and
+    // returns the offset of its call data.
+    template <typename FilterType>
+    size_t AddUnfusedHooks(FilterType* filter) {
+      const size_t call_offset = data_.AddFilter<FilterType>(filter);
+      data_.AddClientToServerHalfClose(filter, call_offset);
+      data_.AddServerTrailingMetadataOp(filter, call_offset);
+      data_.AddFinalizer(filter, call_offset, &FilterType::Call::OnFinalize);
+      return call_offset;
+    }
+
     filters_detail::StackData data_;
   };
 
@@ -1410,6 +1756,18 @@ class CallFilters {
   }
   // Client: Indicate that no more messages will be sent
   void FinishClientToServerSends() { call_state_.ClientToServerHalfClose(); }
+  // Client: Push the last client to server message, and indicate that no more
+  // will be sent. The half close is visible to the server as soon as it has
+  // pulled the message, instead of after the client has seen the push
+  // complete and resumed - saving a round trip between the two for unary
+  // calls.
+  // Returns a promise that resolves to a StatusFlag indicating success
+  GRPC_MUST_USE_RESULT auto PushClientToServerMessageAndFinishSends(
+      MessageHandle message) {
+    auto push = PushClientToServerMessage(std::move(message));
+    FinishClientToServerSends();
+    return push;
+  }
   // Server: Fetch client to server message
   // Returns a promise that resolves to ValueOrFailure<MessageHandle>
   GRPC_MUST_USE_RESULT auto PullClientToServerMessage() {
@@ -100,6 +100,11 @@ class CallSpine final : public Party {
 
   void FinishSends() { call_filters().FinishClientToServerSends(); }
 
+  auto PushClientToServerMessageAndFinishSends(MessageHandle message) {
+    return call_filters().PushClientToServerMessageAndFinishSends(
+        std::move(message));
+  }
+
   auto PullClientInitialMetadata() {
     return call_filters().PullClientInitialMetadata();
   }
@@ -214,6 +219,11 @@ class CallInitiator {
 
   void FinishSends() { spine_->FinishSends(); }
 
+  // Push the final message of the call and finish sends in one step.
+  auto PushMessageAndFinishSends(MessageHandle message) {
+    return spine_->PushClientToServerMessageAndFinishSends(std::move(message));
+  }
+
   auto PullMessage() { return spine_->PullServerToClientMessage(); }
 
   auto PullServerTrailingMetadata() {
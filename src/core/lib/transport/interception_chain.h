@@ -16,8 +16,13 @@
 #define GRPC_SRC_CORE_LIB_TRANSPORT_INTERCEPTION_CHAIN_H
 
 #include <memory>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
+#include "absl/meta/type_traits.h"
+#include "absl/utility/utility.h"
+
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -174,6 +179,24 @@ class InterceptionChainBuilder final {
     return *this;
   };
 
+  // Add filters, in order, as though by calling Add() on each: except that
+  // their interceptors are fused where they can be (see
+  // CallFilters::StackBuilder::AddFused()).
+  template <typename... Ts>
+  absl::enable_if_t<sizeof...(Ts) != 0 &&
+                        absl::conjunction<std::integral_constant<
+                            bool, sizeof(typename Ts::Call) != 0>...>::value,
+                    InterceptionChainBuilder&>
+  AddFused() {
+    if (!status_.ok()) return *this;
+    // Braced initialization creates the filters in order, so their instance
+    // ids are the same as Add() would give them.
+    std::tuple<Ts*...> filters{CreateOwnedFilter<Ts>()...};
+    if (!status_.ok()) return *this;
+    AddFusedFilters(filters, absl::index_sequence_for<Ts...>());
+    return *this;
+  }
+
   // Add a filter that is an interceptor - one that can hijack calls.
   template <typename T>
   absl::enable_if_t<std::is_base_of<Interceptor, T>::value,
@@ -218,6 +241,27 @@ class InterceptionChainBuilder final {
     return stack;
   }
 
+  // Creates a filter for AddFused(), owned by the stack being built. Returns
+  // nullptr, having failed the chain, if it cannot be created.
+  template <typename T>
+  T* CreateOwnedFilter() {
+    if (!status_.ok()) return nullptr;
+    auto filter = T::Create(args_, {FilterInstanceId(FilterTypeId<T>())});
+    if (!filter.ok()) {
+      status_ = filter.status();
+      return nullptr;
+    }
+    T* p = filter.value().get();
+    stack_builder().AddOwnedObject(std::move(filter.value()));
+    return p;
+  }
+
+  template <typename... Ts, size_t... I>
+  void AddFusedFilters(const std::tuple<Ts*...>& filters,
+                       absl::index_sequence<I...>) {
+    stack_builder().AddFused(std::get<I>(filters)...);
+  }
+
   template <typename T>
   static size_t FilterTypeId() {
     static const size_t id =
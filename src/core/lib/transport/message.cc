@@ -14,15 +14,69 @@
 
 #include "src/core/lib/transport/message.h"
 
+#include <utility>
+
+#include "absl/log/log.h"
 #include "absl/strings/str_cat.h"
 
 #include <grpc/impl/grpc_types.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/port_platform.h>
 
 namespace grpc_core {
 
+bool MessageObject::SerializeAndReset(grpc_slice_buffer* out) {
+  const bool ok = vtable_->serialize(object_, out);
+  Reset();
+  return ok;
+}
+
+void MessageObject::Reset() {
+  if (object_ == nullptr) return;
+  vtable_->destroy(std::exchange(object_, nullptr));
+  vtable_ = nullptr;
+}
+
+MessageObject MessageObject::TakeFrom(grpc_byte_buffer* bb) {
+  auto* object =
+      static_cast<MessageObject*>(std::exchange(bb->reserved, nullptr));
+  if (object == nullptr) return MessageObject();
+  MessageObject taken = std::move(*object);
+  delete object;
+  return taken;
+}
+
+void MessageObject::AttachTo(grpc_byte_buffer* bb) && {
+  delete static_cast<MessageObject*>(bb->reserved);
+  bb->reserved = new MessageObject(std::move(*this));
+}
+
+void MessageObject::Materialize(grpc_byte_buffer* bb) {
+  MessageObject object = TakeFrom(bb);
+  if (object && !object.SerializeAndReset(&bb->data.raw.slice_buffer)) {
+    LOG(ERROR) << "Failed to serialize message object";
+  }
+}
+
+void MessageObjectPassthrough::EnableFor(Arena* arena) {
+  // Only the presence of the context matters.
+  static MessageObjectPassthrough passthrough;
+  arena->SetContext<MessageObjectPassthrough>(&passthrough);
+}
+
+bool MessageObjectPassthrough::EnabledFor(Arena* arena) {
+  return arena->GetContext<MessageObjectPassthrough>() != nullptr;
+}
+
+void Message::SerializeObject() const {
+  if (!object_.SerializeAndReset(payload_.c_slice_buffer())) {
+    LOG(ERROR) << "Failed to serialize message object";
+  }
+}
+
 std::string Message::DebugString() const {
-  std::string out = absl::StrCat(payload_.Length(), "b");
+  std::string out =
+      object_ ? "object" : absl::StrCat(payload_.Length(), "b");
   auto flags = flags_;
   auto explain = [&flags, &out](uint32_t flag, absl::string_view name) {
     if (flags & flag) {
@@ -15,6 +15,12 @@
 #ifndef GRPC_SRC_CORE_LIB_TRANSPORT_MESSAGE_H
 #define GRPC_SRC_CORE_LIB_TRANSPORT_MESSAGE_H
 
+#include <stdint.h>
+
+#include <utility>
+
+#include <grpc/impl/grpc_types.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/resource_quota/arena.h"
@@ -33,24 +39,115 @@
 
 namespace grpc_core {
 
+// An application message that was not serialized yet. A call hands it from the
+// sender to the receiver as it is, and only serializes it if something on the
+// way needs its bytes: so in practice it only reaches the receiver unserialized
+// over an in-process transport.
+class MessageObject {
+ public:
+  struct Vtable {
+    // Serializes the object into out. Returns false on failure.
+    bool (*serialize)(void* object, grpc_slice_buffer* out);
+    void (*destroy)(void* object);
+  };
+
+  MessageObject() = default;
+  MessageObject(void* object, const Vtable* vtable)
+      : object_(object), vtable_(vtable) {}
+  ~MessageObject() { Reset(); }
+  MessageObject(const MessageObject&) = delete;
+  MessageObject& operator=(const MessageObject&) = delete;
+  MessageObject(MessageObject&& other) noexcept
+      : object_(std::exchange(other.object_, nullptr)),
+        vtable_(std::exchange(other.vtable_, nullptr)) {}
+  MessageObject& operator=(MessageObject&& other) noexcept {
+    Reset();
+    object_ = std::exchange(other.object_, nullptr);
+    vtable_ = std::exchange(other.vtable_, nullptr);
+    return *this;
+  }
+
+  explicit operator bool() const { return object_ != nullptr; }
+  void* object() const { return object_; }
+  const Vtable* vtable() const { return vtable_; }
+
+  // Gives up ownership of the object and returns it.
+  void* Release() {
+    vtable_ = nullptr;
+    return std::exchange(object_, nullptr);
+  }
+
+  // Appends the serialized object to out, then destroys it.
+  bool SerializeAndReset(grpc_slice_buffer* out);
+
+  void Reset();
+
+  // A byte buffer carries a message object in its reserved field, and then has
+  // no bytes until it is materialized. These take the object out of \a bb,
+  // attach one to it, and replace it with its bytes, respectively.
+  static MessageObject TakeFrom(grpc_byte_buffer* bb);
+  void AttachTo(grpc_byte_buffer* bb) &&;
+  static void Materialize(grpc_byte_buffer* bb);
+
+ private:
+  void* object_ = nullptr;
+  const Vtable* vtable_ = nullptr;
+};
+
+// Set by the in-process transport on its channels, whose calls keep the
+// message objects they are sent, see MessageObjectPassthrough.
+#define GRPC_ARG_PASS_MESSAGE_OBJECTS "grpc.internal.pass_message_objects"
+
+// Marks the arena of a call whose transport hands message objects to the peer
+// as they are, which only the in-process transport does. Other calls serialize
+// the message objects they are sent before any filter sees them, so that
+// compression and message size limits apply to them.
+class MessageObjectPassthrough {
+ public:
+  static void EnableFor(Arena* arena);
+  static bool EnabledFor(Arena* arena);
+};
+
+template <>
+struct ArenaContextType<MessageObjectPassthrough> {
+  static void Destroy(MessageObjectPassthrough*) {}
+};
+
 class Message {
  public:
   Message() = default;
   ~Message() = default;
   Message(SliceBuffer payload, uint32_t flags)
       : payload_(std::move(payload)), flags_(flags) {}
+  Message(MessageObject object, uint32_t flags)
+      : object_(std::move(object)), flags_(flags) {}
   Message(const Message&) = delete;
   Message& operator=(const Message&) = delete;
 
   uint32_t flags() const { return flags_; }
   uint32_t& mutable_flags() { return flags_; }
-  SliceBuffer* payload() { return &payload_; }
-  const SliceBuffer* payload() const { return &payload_; }
+  // Accessing the payload of a message object serializes the object.
+  SliceBuffer* payload() {
+    if (object_) SerializeObject();
+    return &payload_;
+  }
+  const SliceBuffer* payload() const {
+    if (object_) SerializeObject();
+    return &payload_;
+  }
+
+  bool has_object() const { return static_cast<bool>(object_); }
+  MessageObject TakeObject() { return std::move(object_); }
 
   std::string DebugString() const;
 
  private:
-  SliceBuffer payload_;
+  void SerializeObject() const;
+
+  // Serializing the object is not a visible change of the message, so both
+  // can change in const accessors.
+  mutable SliceBuffer payload_;
+  mutable MessageObject object_;
   uint32_t flags_ = 0;
 };
 
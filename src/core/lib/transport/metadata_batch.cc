@@ -18,6 +18,8 @@
 
 #include <algorithm>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "absl/base/no_destructor.h"
 #include "absl/container/flat_hash_set.h"
@@ -95,6 +97,51 @@ bool DebugStringBuilder::IsAllowListed(const absl::string_view key) const {
   return allow_list->contains(key);
 }
 
+NameIndex::NameIndex(std::vector<absl::string_view> keys)
+    : keys_(std::move(keys)) {
+  if (keys_.empty() || keys_.size() >= kEmptySlot) return;
+  for (size_t i = 0; i < keys_.size(); ++i) {
+    if (keys_[i].empty()) return;
+    // Keys that mix to the same value collide whatever the multiplier.
+    for (size_t j = 0; j < i; ++j) {
+      if (Mix(keys_[i]) == Mix(keys_[j])) return;
+    }
+  }
+  // Keep the table at most a quarter full, so that suitable multipliers are
+  // quick to find.
+  int bits = 1;
+  while ((size_t{1} << bits) < 4 * keys_.size()) ++bits;
+  slots_.resize(size_t{1} << bits);
+  shift_ = 32 - bits;
+  // Odd multipliers from a fixed sequence, so that the table built for a given
+  // set of keys is the same from one run to the next.
+  uint32_t candidate = 0x9e3779b9u;
+  for (int attempt = 0; attempt < 100000; ++attempt) {
+    candidate = candidate * 1664525u + 1013904223u;
+    multiplier_ = candidate | 1;
+    std::fill(slots_.begin(), slots_.end(), kEmptySlot);
+    bool collided = false;
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      uint8_t& slot = slots_[Slot(keys_[i])];
+      if (slot != kEmptySlot) {
+        collided = true;
+        break;
+      }
+      slot = static_cast<uint8_t>(i);
+    }
+    if (!collided) return;
+  }
+  multiplier_ = 0;
+  slots_.clear();
+}
+
+int NameIndex::FindLinear(absl::string_view key) const {
+  for (size_t i = 0; i < keys_.size(); ++i) {
+    if (keys_[i] == key) return static_cast<int>(i);
+  }
+  return -1;
+}
+
 void UnknownMap::Append(absl::string_view key, Slice value) {
   unknown_.emplace_back(Slice::FromCopiedString(key), value.Ref());
 }
@@ -25,6 +25,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 #include "absl/functional/function_ref.h"
@@ -42,7 +43,6 @@
 #include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/chunked_vector.h"
-#include "src/core/lib/gprpp/if_list.h"
 #include "src/core/lib/gprpp/packed_table.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/type_list.h"
@@ -621,24 +621,75 @@ struct EncodableTraits<void> {
   using List = Typelist<>;
 };
 
-template <typename Trait>
-struct EncodableNameLookupKeyComparison {
-  bool operator()(absl::string_view key) { return key == Trait::key(); }
+// Maps the keys of a fixed set of traits to their index in that set.
+// Keys are hashed from their length and three of their characters into a
+// table in which no two of the keys collide, so that a lookup costs one hash
+// and at most one string comparison, however many traits there are.
+// Trait keys are not constant expressions, so the multiplier that makes the
+// hash perfect is searched for when the index is built, once per metadata map
+// type. Should no multiplier be found, lookups fall back to a linear scan.
+class NameIndex {
+ public:
+  explicit NameIndex(std::vector<absl::string_view> keys);
+
+  NameIndex(const NameIndex&) = delete;
+  NameIndex& operator=(const NameIndex&) = delete;
+
+  // Returns the index of \a key in the keys passed at construction, or -1.
+  int Find(absl::string_view key) const {
+    if (GPR_UNLIKELY(multiplier_ == 0)) return FindLinear(key);
+    if (key.empty()) return -1;
+    const uint8_t slot = slots_[Slot(key)];
+    if (slot == kEmptySlot || keys_[slot] != key) return -1;
+    return slot;
+  }
+
+ private:
+  static constexpr uint8_t kEmptySlot = 255;
+
+  static uint32_t Mix(absl::string_view key) {
+    return static_cast<uint32_t>(key.size() & 0xff) |
+           static_cast<uint32_t>(static_cast<uint8_t>(key[0])) << 8 |
+           static_cast<uint32_t>(static_cast<uint8_t>(key[key.size() / 2]))
+               << 16 |
+           static_cast<uint32_t>(static_cast<uint8_t>(key.back())) << 24;
+  }
+  size_t Slot(absl::string_view key) const {
+    return (Mix(key) * multiplier_) >> shift_;
+  }
+  int FindLinear(absl::string_view key) const;
+
+  const std::vector<absl::string_view> keys_;
+  // Zero if keys_ must be scanned linearly.
+  uint32_t multiplier_ = 0;
+  int shift_ = 32;
+  std::vector<uint8_t> slots_;
 };
 
 template <typename Trait, typename Op>
 struct EncodableNameLookupOnFound {
-  auto operator()(Op* op) { return op->Found(Trait()); }
+  static auto Found(Op* op) { return op->Found(Trait()); }
 };
 
 template <typename... Traits>
 struct EncodableNameLookup {
   template <typename Op>
   static auto Lookup(absl::string_view key, Op* op) {
-    return IfList(
-        key, op, [key](Op* op) { return op->NotFound(key); },
-        EncodableNameLookupKeyComparison<Traits>()...,
-        EncodableNameLookupOnFound<Traits, Op>()...);
+    using Result = decltype(op->NotFound(key));
+    static const NameIndex* const index = new NameIndex({Traits::key()...});
+    static constexpr Result (*const kFound[])(Op*) = {
+        &EncodableNameLookupOnFound<Traits, Op>::Found...};
+    const int i = index->Find(key);
+    if (i < 0) return op->NotFound(key);
+    return kFound[i](op);
+  }
+};
+
+template <>
+struct EncodableNameLookup<> {
+  template <typename Op>
+  static auto Lookup(absl::string_view key, Op* op) {
+    return op->NotFound(key);
   }
 };
 
@@ -1084,7 +1135,9 @@ class TransportSizeEncoder {
 // Handle unknown (non-trait-based) fields in the metadata map.
 class UnknownMap {
  public:
-  using BackingType = std::vector<std::pair<Slice, Slice>>;
+  // Sized so that the unknown metadata of typical calls is held within the
+  // (arena allocated) metadata batch itself, without any heap allocation.
+  using BackingType = absl::InlinedVector<std::pair<Slice, Slice>, 4>;
 
   void Append(absl::string_view key, Slice value);
   void Remove(absl::string_view key);
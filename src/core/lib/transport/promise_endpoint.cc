@@ -107,4 +107,91 @@ void PromiseEndpoint::ReadState::Complete(absl::Status status,
   }
 }
 
+Poll<absl::StatusOr<SliceBuffer>> PromiseEndpoint::ReadState::PollReadAhead(
+    size_t num_bytes) {
+  while (true) {
+    ReadAheadState state = read_ahead_state.load(std::memory_order_acquire);
+    if (state == kReadDone && result.ok()) {
+      pending_buffer.MoveFirstNBytesIntoSliceBuffer(pending_buffer.Length(),
+                                                    buffer);
+      DCHECK(pending_buffer.Count() == 0u);
+      state = kNoRead;
+      read_ahead_state.store(state, std::memory_order_relaxed);
+    }
+    if (buffer.Length() >= num_bytes) {
+      SliceBuffer ret;
+      grpc_slice_buffer_move_first_no_inline(buffer.c_slice_buffer(), num_bytes,
+                                             ret.c_slice_buffer());
+      // Have the endpoint read while the caller handles these bytes.
+      if (state == kNoRead) StartReadAhead(1);
+      return std::move(ret);
+    }
+    switch (state) {
+      case kNoRead:
+        StartReadAhead(num_bytes - buffer.Length());
+        break;
+      case kReading:
+        waker = GetContext<Activity>()->MakeNonOwningWaker();
+        if (read_ahead_state.compare_exchange_strong(
+                state, kReadingWithWaiter, std::memory_order_release,
+                std::memory_order_acquire)) {
+          return Pending();
+        }
+        // The read completed meanwhile.
+        waker = Waker();
+        break;
+      case kReadingWithWaiter:
+        return Pending();
+      case kReadDone: {
+        // The read failed, and what was buffered before it does not satisfy
+        // this read.
+        absl::Status status = std::exchange(result, absl::OkStatus());
+        pending_buffer.Clear();
+        buffer.Clear();
+        read_ahead_state.store(kNoRead, std::memory_order_relaxed);
+        return status;
+      }
+    }
+  }
+}
+
+void PromiseEndpoint::ReadState::StartReadAhead(size_t read_hint_bytes) {
+  DCHECK(read_ahead_state.load(std::memory_order_relaxed) == kNoRead);
+  auto ep = endpoint.lock();
+  if (ep == nullptr) {
+    result = absl::UnavailableError("Endpoint closed during read.");
+    read_ahead_state.store(kReadDone, std::memory_order_relaxed);
+    return;
+  }
+  grpc_event_engine::experimental::EventEngine::Endpoint::ReadArgs read_args = {
+      static_cast<int64_t>(read_hint_bytes)};
+  read_ahead_state.store(kReading, std::memory_order_relaxed);
+  // If `Read()` returns true immediately, the callback will not be called.
+  if (ep->Read(
+          [self = Ref()](absl::Status status) {
+            ApplicationCallbackExecCtx callback_exec_ctx;
+            ExecCtx exec_ctx;
+            self->ReadAheadComplete(std::move(status));
+          },
+          &pending_buffer, &read_args)) {
+    result = absl::OkStatus();
+    read_ahead_state.store(kReadDone, std::memory_order_relaxed);
+  }
+}
+
+void PromiseEndpoint::ReadState::ReadAheadComplete(absl::Status status) {
+  result = std::move(status);
+  ReadAheadState state = kReading;
+  if (read_ahead_state.compare_exchange_strong(state, kReadDone,
+                                               std::memory_order_release,
+                                               std::memory_order_acquire)) {
+    return;
+  }
+  // The caller is waiting: it leaves `waker` alone until woken.
+  CHECK(state == kReadingWithWaiter);
+  auto w = std::move(waker);
+  read_ahead_state.store(kReadDone, std::memory_order_release);
+  w.Wakeup();
+}
+
 }  // namespace grpc_core
@@ -37,7 +37,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/port_platform.h>
 
-#include "src/core/lib/event_engine/extensions/chaotic_good_extension.h"
+#include "src/core/lib/event_engine/extensions/receive_coalescing.h"
 #include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -133,13 +133,19 @@ class PromiseEndpoint {
   // Concurrent reads are not supported, which means callers should not call
   // `Read()` before the previous read finishes. Doing that results in
   // undefined behavior.
+  //
+  // With read-ahead enabled the endpoint is asked for more data whenever no
+  // read is outstanding, so that whatever arrives while the caller handles a
+  // result is already buffered for its next read.
   auto Read(size_t num_bytes) {
     // Assert previous read finishes.
     CHECK(!read_state_->complete.load(std::memory_order_relaxed));
+    // Read-ahead serves every read from the promise, below.
+    const bool read_ahead = read_state_->read_ahead;
     // Should not have pending reads.
-    CHECK(read_state_->pending_buffer.Count() == 0u);
-    bool complete = true;
-    while (read_state_->buffer.Length() < num_bytes) {
+    CHECK(read_ahead || read_state_->pending_buffer.Count() == 0u);
+    bool complete = !read_ahead;
+    while (complete && read_state_->buffer.Length() < num_bytes) {
       // Set read args with hinted bytes.
       grpc_event_engine::experimental::EventEngine::Endpoint::ReadArgs
           read_args = {
@@ -178,6 +184,9 @@ class PromiseEndpoint {
         [this, num_bytes]() {
           return [read_state = read_state_,
                   num_bytes]() -> Poll<absl::StatusOr<SliceBuffer>> {
+            if (read_state->read_ahead) {
+              return read_state->PollReadAhead(num_bytes);
+            }
             if (!read_state->complete.load(std::memory_order_acquire)) {
               return Pending();
             }
@@ -219,14 +228,26 @@ class PromiseEndpoint {
                });
   }
 
+  // Keeps a read outstanding on the endpoint between calls to `Read()`, so
+  // that a caller making several small reads per message (a frame header,
+  // then its payload, then the next header...) usually finds its bytes
+  // already buffered instead of issuing an endpoint read and waiting for each
+  // of them. Reads still complete as soon as the bytes asked for are
+  // available. Buffered bytes are delivered before an endpoint error is
+  // reported.
+  //
+  // Must be called before the first read.
+  void EnableReadAhead() { read_state_->read_ahead = true; }
+
   // Enables RPC receive coalescing and alignment of memory holding received
   // RPCs.
   void EnforceRxMemoryAlignmentAndCoalescing() {
-    auto* chaotic_good_ext = grpc_event_engine::experimental::QueryExtension<
-        grpc_event_engine::experimental::ChaoticGoodExtension>(endpoint_.get());
-    if (chaotic_good_ext != nullptr) {
-      chaotic_good_ext->EnforceRxMemoryAlignment();
-      chaotic_good_ext->EnableRpcReceiveCoalescing();
+    auto* coalescing_ext = grpc_event_engine::experimental::QueryExtension<
+        grpc_event_engine::experimental::ReceiveCoalescingExtension>(
+        endpoint_.get());
+    if (coalescing_ext != nullptr) {
+      coalescing_ext->EnforceRxMemoryAlignment();
+      coalescing_ext->EnableRpcReceiveCoalescing();
       if (read_state_->buffer.Length() == 0) {
         return;
       }
@@ -282,6 +303,28 @@ class PromiseEndpoint {
         endpoint;
 
     void Complete(absl::Status status, size_t num_bytes_requested);
+
+    // Read-ahead mode, where `PollReadAhead()` serves reads and the endpoint
+    // reads into `pending_buffer` in the background. `pending_buffer` and
+    // `result` belong to the endpoint read while `read_ahead_state` is
+    // `kReading` or `kReadingWithWaiter`, and `waker` while it is
+    // `kReadingWithWaiter`.
+    bool read_ahead = false;
+    enum ReadAheadState : uint8_t {
+      kNoRead,
+      kReading,
+      // The caller is waiting for the read, and must be woken.
+      kReadingWithWaiter,
+      // The read completed; its bytes are in `pending_buffer` and its status
+      // in `result`.
+      kReadDone,
+    };
+    std::atomic<ReadAheadState> read_ahead_state{kNoRead};
+
+    Poll<absl::StatusOr<SliceBuffer>> PollReadAhead(size_t num_bytes);
+    // Starts an endpoint read asking for at least `read_hint_bytes`.
+    void StartReadAhead(size_t read_hint_bytes);
+    void ReadAheadComplete(absl::Status status);
   };
 
   struct WriteState : public RefCounted<WriteState> {
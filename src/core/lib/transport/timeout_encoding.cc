@@ -18,10 +18,13 @@
 
 #include "src/core/lib/transport/timeout_encoding.h"
 
+#include <string.h>
+
 #include <limits>
 
 #include "absl/base/attributes.h"
 #include "absl/log/check.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/support/log.h>
 #include <grpc/support/port_platform.h>
@@ -44,6 +47,46 @@ bool IsAllSpace(const uint8_t* p, const uint8_t* end) {
   return p == end;
 }
 
+// Returns the timeout of x in the given unit specifier, if valid.
+absl::optional<Duration> TimeoutInUnit(int64_t x, uint8_t unit) {
+  switch (unit) {
+    case 'n':
+      return Duration::Milliseconds(x / GPR_NS_PER_MS +
+                                    (x % GPR_NS_PER_MS != 0));
+    case 'u':
+      return Duration::Milliseconds(x / GPR_US_PER_MS +
+                                    (x % GPR_US_PER_MS != 0));
+    case 'm':
+      return Duration::Milliseconds(x);
+    case 'S':
+      return Duration::Seconds(x);
+    case 'M':
+      return Duration::Minutes(x);
+    case 'H':
+      return Duration::Hours(x);
+    default:
+      return absl::nullopt;
+  }
+}
+
+// Parses the form that gRPC implementations send: up to 8 digits directly
+// followed by the unit.  Up to 8 digits cannot overflow, so this needs none
+// of the whitespace and range checks of the general parser.  Returns nullopt
+// for any other form, which is then left to the general parser.
+absl::optional<Duration> ParseCanonicalTimeout(const uint8_t* p,
+                                               const uint8_t* end) {
+  const size_t length = end - p;
+  if (length < 2 || length > 9) return absl::nullopt;
+  const uint8_t* unit = end - 1;
+  int64_t x = 0;
+  for (; p != unit; ++p) {
+    const uint8_t digit = *p - '0';
+    if (digit > 9) return absl::nullopt;
+    x = x * 10 + digit;
+  }
+  return TimeoutInUnit(x, *unit);
+}
+
 }  // namespace
 
 Timeout Timeout::FromDuration(Duration duration) {
@@ -126,41 +169,12 @@ Slice Timeout::Encode() const {
     case 1:
       *p++ = '0' + n;
   }
-  switch (unit_) {
-    case Unit::kNanoseconds:
-      *p++ = 'n';
-      break;
-    case Unit::kHundredMilliseconds:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kTenMilliseconds:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kMilliseconds:
-      *p++ = 'm';
-      break;
-    case Unit::kHundredSeconds:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kTenSeconds:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kSeconds:
-      *p++ = 'S';
-      break;
-    case Unit::kHundredMinutes:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kTenMinutes:
-      *p++ = '0';
-      ABSL_FALLTHROUGH_INTENDED;
-    case Unit::kMinutes:
-      *p++ = 'M';
-      break;
-    case Unit::kHours:
-      *p++ = 'H';
-      break;
-  }
+  // The suffix of each unit, in the order of Unit.
+  static constexpr absl::string_view kUnitSuffixes[] = {
+      "n", "m", "0m", "00m", "S", "0S", "00S", "M", "0M", "00M", "H"};
+  const absl::string_view suffix = kUnitSuffixes[static_cast<int>(unit_)];
+  memcpy(p, suffix.data(), suffix.size());
+  p += suffix.size();
   return Slice::FromCopiedBuffer(buf, p - buf);
 }
 
@@ -231,9 +245,11 @@ Timeout Timeout::FromHours(int64_t hours) {
 }
 
 absl::optional<Duration> ParseTimeout(const Slice& text) {
-  int32_t x = 0;
   const uint8_t* p = text.begin();
   const uint8_t* end = text.end();
+  auto canonical = ParseCanonicalTimeout(p, end);
+  if (canonical.has_value()) return canonical;
+  int32_t x = 0;
   int have_digit = 0;
   // skip whitespace
   for (; p != end && *p == ' '; p++) {
@@ -256,31 +272,8 @@ absl::optional<Duration> ParseTimeout(const Slice& text) {
   }
   if (p == end) return absl::nullopt;
   // decode unit specifier
-  Duration timeout;
-  switch (*p) {
-    case 'n':
-      timeout =
-          Duration::Milliseconds(x / GPR_NS_PER_MS + (x % GPR_NS_PER_MS != 0));
-      break;
-    case 'u':
-      timeout =
-          Duration::Milliseconds(x / GPR_US_PER_MS + (x % GPR_US_PER_MS != 0));
-      break;
-    case 'm':
-      timeout = Duration::Milliseconds(x);
-      break;
-    case 'S':
-      timeout = Duration::Seconds(x);
-      break;
-    case 'M':
-      timeout = Duration::Minutes(x);
-      break;
-    case 'H':
-      timeout = Duration::Hours(x);
-      break;
-    default:
-      return absl::nullopt;
-  }
+  auto timeout = TimeoutInUnit(x, *p);
+  if (!timeout.has_value()) return absl::nullopt;
   p++;
   if (!IsAllSpace(p, end)) return absl::nullopt;
   return timeout;
@@ -58,7 +58,9 @@ std::map<absl::string_view, double> ParseMap(
 const BackendMetricData* ParseBackendMetricData(
     absl::string_view serialized_load_report,
     BackendMetricAllocatorInterface* allocator) {
-  upb::Arena upb_arena;
+  // Typical reports fit in the initial block, so parsing them does not
+  // allocate beyond what is taken from allocator.
+  upb::InlinedArena<1024> upb_arena;
   xds_data_orca_v3_OrcaLoadReport* msg = xds_data_orca_v3_OrcaLoadReport_parse(
       serialized_load_report.data(), serialized_load_report.size(),
       upb_arena.ptr());
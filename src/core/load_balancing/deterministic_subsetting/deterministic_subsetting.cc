@@ -0,0 +1,326 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/deterministic_subsetting/deterministic_subsetting.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/iomgr/pollset_set.h"
+#include "src/core/load_balancing/child_policy_handler.h"
+#include "src/core/load_balancing/delegating_helper.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/load_balancing/lb_policy_registry.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+
+namespace grpc_core {
+
+std::vector<size_t> DeterministicSubset(size_t num_endpoints,
+                                        size_t subset_size,
+                                        uint64_t client_index) {
+  std::vector<size_t> indices(num_endpoints);
+  std::iota(indices.begin(), indices.end(), 0);
+  if (subset_size == 0 || num_endpoints <= subset_size) return indices;
+  const uint64_t subset_count = num_endpoints / subset_size;
+  const uint64_t round = client_index / subset_count;
+  // All clients must shuffle the same way, so this uses a generator whose
+  // output is fixed by the standard and a shuffle written out here rather
+  // than std::shuffle, whose algorithm is up to the implementation.
+  std::mt19937_64 generator(round);
+  for (size_t i = num_endpoints - 1; i > 0; --i) {
+    std::swap(indices[i], indices[generator() % (i + 1)]);
+  }
+  const size_t start = (client_index % subset_count) * subset_size;
+  return std::vector<size_t>(indices.begin() + start,
+                             indices.begin() + start + subset_size);
+}
+
+namespace {
+
+constexpr absl::string_view kDeterministicSubsetting =
+    "deterministic_subsetting_experimental";
+
+// Config for deterministic_subsetting LB policy.
+class DeterministicSubsettingLbConfig final
+    : public LoadBalancingPolicy::Config {
+ public:
+  DeterministicSubsettingLbConfig() = default;
+
+  DeterministicSubsettingLbConfig(const DeterministicSubsettingLbConfig&) =
+      delete;
+  DeterministicSubsettingLbConfig& operator=(
+      const DeterministicSubsettingLbConfig&) = delete;
+
+  DeterministicSubsettingLbConfig(DeterministicSubsettingLbConfig&&) = delete;
+  DeterministicSubsettingLbConfig& operator=(
+      DeterministicSubsettingLbConfig&&) = delete;
+
+  absl::string_view name() const override { return kDeterministicSubsetting; }
+
+  const absl::optional<uint64_t>& client_index() const {
+    return client_index_;
+  }
+  uint32_t subset_size() const { return subset_size_; }
+  bool sort_addresses() const { return sort_addresses_; }
+  RefCountedPtr<LoadBalancingPolicy::Config> child_policy() const {
+    return child_policy_;
+  }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    // Note: The "childPolicy" field requires custom processing, so
+    // it's handled in JsonPostLoad() instead.
+    static const auto* loader =
+        JsonObjectLoader<DeterministicSubsettingLbConfig>()
+            .OptionalField("clientIndex",
+                           &DeterministicSubsettingLbConfig::client_index_)
+            .Field("subsetSize", &DeterministicSubsettingLbConfig::subset_size_)
+            .OptionalField("sortAddresses",
+                           &DeterministicSubsettingLbConfig::sort_addresses_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json& json, const JsonArgs&,
+                    ValidationErrors* errors) {
+    {
+      ValidationErrors::ScopedField field(errors, ".subsetSize");
+      if (!errors->FieldHasErrors() && subset_size_ == 0) {
+        errors->AddError("must be greater than 0");
+      }
+    }
+    ValidationErrors::ScopedField field(errors, ".childPolicy");
+    auto it = json.object().find("childPolicy");
+    if (it == json.object().end()) {
+      errors->AddError("field not present");
+      return;
+    }
+    auto lb_config =
+        CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+            it->second);
+    if (!lb_config.ok()) {
+      errors->AddError(lb_config.status().message());
+      return;
+    }
+    child_policy_ = std::move(*lb_config);
+  }
+
+ private:
+  absl::optional<uint64_t> client_index_;
+  uint32_t subset_size_ = 0;
+  bool sort_addresses_ = true;
+  RefCountedPtr<LoadBalancingPolicy::Config> child_policy_;
+};
+
+// deterministic_subsetting LB policy: passes only a subset of the endpoints
+// to its child policy, so that each client connects to subsetSize endpoints
+// however large the fleet is, while the load stays spread evenly.
+class DeterministicSubsettingLb final : public LoadBalancingPolicy {
+ public:
+  explicit DeterministicSubsettingLb(Args args);
+
+  absl::string_view name() const override { return kDeterministicSubsetting; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ExitIdleLocked() override;
+  void ResetBackoffLocked() override;
+
+ private:
+  using Helper =
+      ParentOwningDelegatingChannelControlHelper<DeterministicSubsettingLb>;
+
+  ~DeterministicSubsettingLb() override;
+
+  void ShutdownLocked() override;
+
+  OrphanablePtr<LoadBalancingPolicy> CreateChildPolicyLocked(
+      const ChannelArgs& args);
+
+  // Used when the config does not set a client index.
+  const uint64_t random_client_index_;
+  OrphanablePtr<LoadBalancingPolicy> child_policy_;
+};
+
+//
+// DeterministicSubsettingLb
+//
+
+DeterministicSubsettingLb::DeterministicSubsettingLb(Args args)
+    : LoadBalancingPolicy(std::move(args)),
+      random_client_index_(absl::Uniform<uint64_t>(absl::BitGen())) {}
+
+DeterministicSubsettingLb::~DeterministicSubsettingLb() {
+  GRPC_TRACE_LOG(deterministic_subsetting_lb, INFO)
+      << "[deterministic_subsetting_lb " << this << "] destroying";
+}
+
+void DeterministicSubsettingLb::ShutdownLocked() {
+  GRPC_TRACE_LOG(deterministic_subsetting_lb, INFO)
+      << "[deterministic_subsetting_lb " << this << "] shutting down";
+  if (child_policy_ != nullptr) {
+    grpc_pollset_set_del_pollset_set(child_policy_->interested_parties(),
+                                     interested_parties());
+    child_policy_.reset();
+  }
+}
+
+void DeterministicSubsettingLb::ExitIdleLocked() {
+  if (child_policy_ != nullptr) child_policy_->ExitIdleLocked();
+}
+
+void DeterministicSubsettingLb::ResetBackoffLocked() {
+  if (child_policy_ != nullptr) child_policy_->ResetBackoffLocked();
+}
+
+absl::Status DeterministicSubsettingLb::UpdateLocked(UpdateArgs args) {
+  auto config = args.config.TakeAsSubclass<DeterministicSubsettingLbConfig>();
+  // Select the subset. It only depends on the endpoints and the client
+  // index, so every update rebalances it for the current membership.
+  if (args.addresses.ok()) {
+    EndpointAddressesList endpoints;
+    (*args.addresses)->ForEach([&](const EndpointAddresses& endpoint) {
+      endpoints.push_back(endpoint);
+    });
+    // Clients must agree on the order of the endpoints for their subsets to
+    // cover the fleet evenly, so unless told that the resolver already
+    // returns them in a consistent order, sort them by their first address.
+    if (config->sort_addresses()) {
+      std::vector<std::pair<std::string, size_t>> keys;
+      keys.reserve(endpoints.size());
+      for (size_t i = 0; i < endpoints.size(); ++i) {
+        keys.emplace_back(
+            grpc_sockaddr_to_string(&endpoints[i].address(), false)
+                .value_or(""),
+            i);
+      }
+      std::sort(keys.begin(), keys.end());
+      EndpointAddressesList sorted;
+      sorted.reserve(endpoints.size());
+      for (const auto& key : keys) {
+        sorted.push_back(std::move(endpoints[key.second]));
+      }
+      endpoints = std::move(sorted);
+    }
+    const uint64_t client_index =
+        config->client_index().value_or(random_client_index_);
+    EndpointAddressesList subset;
+    for (size_t index : DeterministicSubset(
+             endpoints.size(), config->subset_size(), client_index)) {
+      subset.push_back(std::move(endpoints[index]));
+    }
+    GRPC_TRACE_LOG(deterministic_subsetting_lb, INFO)
+        << "[deterministic_subsetting_lb " << this << "] client "
+        << client_index << " selected " << subset.size() << " of "
+        << endpoints.size() << " endpoints";
+    args.addresses =
+        std::make_shared<EndpointAddressesListIterator>(std::move(subset));
+  }
+  // Create child policy if needed (i.e., on first update).
+  if (child_policy_ == nullptr) {
+    child_policy_ = CreateChildPolicyLocked(args.args);
+  }
+  // Construct update args.
+  UpdateArgs update_args;
+  update_args.addresses = std::move(args.addresses);
+  update_args.config = config->child_policy();
+  update_args.resolution_note = std::move(args.resolution_note);
+  update_args.args = std::move(args.args);
+  GRPC_TRACE_LOG(deterministic_subsetting_lb, INFO)
+      << "[deterministic_subsetting_lb " << this << "] updating child policy "
+      << child_policy_.get();
+  return child_policy_->UpdateLocked(std::move(update_args));
+}
+
+OrphanablePtr<LoadBalancingPolicy>
+DeterministicSubsettingLb::CreateChildPolicyLocked(const ChannelArgs& args) {
+  LoadBalancingPolicy::Args lb_policy_args;
+  lb_policy_args.work_serializer = work_serializer();
+  lb_policy_args.args = args;
+  lb_policy_args.channel_control_helper = std::make_unique<Helper>(
+      RefAsSubclass<DeterministicSubsettingLb>(DEBUG_LOCATION, "Helper"));
+  OrphanablePtr<LoadBalancingPolicy> lb_policy =
+      MakeOrphanable<ChildPolicyHandler>(std::move(lb_policy_args),
+                                         &deterministic_subsetting_lb_trace);
+  GRPC_TRACE_LOG(deterministic_subsetting_lb, INFO)
+      << "[deterministic_subsetting_lb " << this
+      << "] created new child policy handler " << lb_policy.get();
+  // Add our interested_parties pollset_set to that of the newly created
+  // child policy. This will make the child policy progress upon activity on
+  // this LB policy, which in turn is tied to the application's call.
+  grpc_pollset_set_add_pollset_set(lb_policy->interested_parties(),
+                                   interested_parties());
+  return lb_policy;
+}
+
+//
+// factory
+//
+
+class DeterministicSubsettingLbFactory final
+    : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<DeterministicSubsettingLb>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kDeterministicSubsetting; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<DeterministicSubsettingLbConfig>>(
+        json, JsonArgs(),
+        "errors validating deterministic_subsetting LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterDeterministicSubsettingLbPolicy(
+    CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<DeterministicSubsettingLbFactory>());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,44 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_DETERMINISTIC_SUBSETTING_DETERMINISTIC_SUBSETTING_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_DETERMINISTIC_SUBSETTING_DETERMINISTIC_SUBSETTING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+
+// Returns the indices of the endpoints, out of \a num_endpoints, that the
+// client with index \a client_index connects to, following the deterministic
+// subsetting algorithm of the Google SRE book ("Load Balancing in the
+// Datacenter"). The endpoints are split into subsets of \a subset_size; each
+// group of consecutive client indices as large as the number of subsets
+// covers all of them ("a round"), using a shuffle of the endpoints seeded by
+// the round. Clients therefore spread evenly over the endpoints, and a given
+// client always gets the same subset for the same endpoints. If there are no
+// more than \a subset_size endpoints, all of them are returned.
+std::vector<size_t> DeterministicSubset(size_t num_endpoints,
+                                        size_t subset_size,
+                                        uint64_t client_index);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_DETERMINISTIC_SUBSETTING_DETERMINISTIC_SUBSETTING_H
@@ -59,6 +59,12 @@ class EndpointList::Endpoint::Helper final
 
   ~Helper() override { endpoint_.reset(DEBUG_LOCATION, "Helper"); }
 
+  // Hands the child policy over to a new endpoint.
+  void set_endpoint(RefCountedPtr<Endpoint> endpoint) {
+    endpoint_.reset(DEBUG_LOCATION, "Helper");
+    endpoint_ = std::move(endpoint);
+  }
+
   RefCountedPtr<SubchannelInterface> CreateSubchannel(
       const grpc_resolved_address& address, const ChannelArgs& per_address_args,
       const ChannelArgs& args) override {
@@ -72,7 +78,9 @@ class EndpointList::Endpoint::Helper final
     if (!old_state.has_value()) {
       ++endpoint_->endpoint_list_->num_endpoints_seen_initial_state_;
     }
+    endpoint_->status_ = status;
     endpoint_->picker_ = std::move(picker);
+    endpoint_->adopted_state_.reset();
     endpoint_->OnStateUpdate(old_state, state, status);
   }
 
@@ -91,14 +99,20 @@ class EndpointList::Endpoint::Helper final
 absl::Status EndpointList::Endpoint::Init(
     const EndpointAddresses& addresses, const ChannelArgs& args,
     std::shared_ptr<WorkSerializer> work_serializer) {
+  if (endpoint_list_->previous_ != nullptr &&
+      AdoptChildPolicy(addresses, work_serializer)) {
+    endpoint_list_->endpoints_by_addresses_.emplace(addresses, this);
+    return absl::OkStatus();
+  }
   ChannelArgs child_args =
       args.Set(GRPC_ARG_INTERNAL_PICK_FIRST_ENABLE_HEALTH_CHECKING, true)
           .Set(GRPC_ARG_INTERNAL_PICK_FIRST_OMIT_STATUS_MESSAGE_PREFIX, true);
   LoadBalancingPolicy::Args lb_policy_args;
   lb_policy_args.work_serializer = std::move(work_serializer);
   lb_policy_args.args = child_args;
-  lb_policy_args.channel_control_helper =
-      std::make_unique<Helper>(Ref(DEBUG_LOCATION, "Helper"));
+  auto helper = std::make_unique<Helper>(Ref(DEBUG_LOCATION, "Helper"));
+  helper_ = helper.get();
+  lb_policy_args.channel_control_helper = std::move(helper);
   child_policy_ =
       CoreConfiguration::Get().lb_policy_registry().CreateLoadBalancingPolicy(
           "pick_first", std::move(lb_policy_args));
@@ -124,15 +138,71 @@ absl::Status EndpointList::Endpoint::Init(
   update_args.addresses = std::make_shared<SingleEndpointIterator>(addresses);
   update_args.args = child_args;
   update_args.config = std::move(*config);
-  return child_policy_->UpdateLocked(std::move(update_args));
+  absl::Status status = child_policy_->UpdateLocked(std::move(update_args));
+  // A child policy that rejected its addresses is not adopted, so that the
+  // error is reported again.
+  if (status.ok()) {
+    endpoint_list_->endpoints_by_addresses_.emplace(addresses, this);
+  }
+  return status;
+}
+
+bool EndpointList::Endpoint::AdoptChildPolicy(
+    const EndpointAddresses& addresses,
+    const std::shared_ptr<WorkSerializer>& work_serializer) {
+  auto& previous_endpoints = endpoint_list_->previous_->endpoints_by_addresses_;
+  auto it = previous_endpoints.find(addresses);
+  if (it == previous_endpoints.end()) return false;
+  Endpoint* previous = it->second;
+  previous_endpoints.erase(it);
+  if (previous->child_policy_ == nullptr) return false;
+  // The pollset_set linkage is to the same policy, so it is kept.
+  child_policy_ = std::move(previous->child_policy_);
+  helper_ = std::exchange(previous->helper_, nullptr);
+  helper_->set_endpoint(Ref(DEBUG_LOCATION, "Helper"));
+  status_ = previous->status_;
+  picker_ = previous->picker_;
+  adopted_state_ = previous->connectivity_state_.has_value()
+                       ? previous->connectivity_state_
+                       : previous->adopted_state_;
+  if (GPR_UNLIKELY(endpoint_list_->tracer_ != nullptr)) {
+    LOG(INFO) << "[" << endpoint_list_->tracer_ << " "
+              << endpoint_list_->policy_.get() << "] endpoint " << this
+              << ": adopted child policy " << child_policy_.get()
+              << " from endpoint " << previous;
+  }
+  // The subclass may not be ready for state updates before the new list
+  // is in place, so the adopted state is reported asynchronously.
+  if (adopted_state_.has_value()) {
+    work_serializer->Run(
+        [self = Ref(DEBUG_LOCATION, "ReportAdoptedState")]() {
+          self->ReportAdoptedStateLocked();
+        },
+        DEBUG_LOCATION);
+  }
+  return true;
+}
+
+void EndpointList::Endpoint::ReportAdoptedStateLocked() {
+  // Skip if the endpoint was orphaned, or if the child policy has
+  // reported a new state in the meantime.
+  if (child_policy_ == nullptr || !adopted_state_.has_value()) return;
+  const grpc_connectivity_state state = *adopted_state_;
+  adopted_state_.reset();
+  connectivity_state_ = state;
+  ++endpoint_list_->num_endpoints_seen_initial_state_;
+  OnStateUpdate(absl::nullopt, state, status_);
 }
 
 void EndpointList::Endpoint::Orphan() {
-  // Remove pollset_set linkage.
-  grpc_pollset_set_del_pollset_set(
-      child_policy_->interested_parties(),
-      endpoint_list_->policy_->interested_parties());
-  child_policy_.reset();
+  // Remove pollset_set linkage, unless the child policy was adopted by
+  // another endpoint.
+  if (child_policy_ != nullptr) {
+    grpc_pollset_set_del_pollset_set(
+        child_policy_->interested_parties(),
+        endpoint_list_->policy_->interested_parties());
+    child_policy_.reset();
+  }
   picker_.reset();
   Unref();
 }
@@ -168,12 +238,16 @@ void EndpointList::Init(
     absl::FunctionRef<OrphanablePtr<Endpoint>(RefCountedPtr<EndpointList>,
                                               const EndpointAddresses&,
                                               const ChannelArgs&)>
-        create_endpoint) {
+        create_endpoint,
+    EndpointList* previous) {
   if (endpoints == nullptr) return;
+  args_ = args;
+  if (previous != nullptr && previous->args_ == args) previous_ = previous;
   endpoints->ForEach([&](const EndpointAddresses& endpoint) {
     endpoints_.push_back(
         create_endpoint(Ref(DEBUG_LOCATION, "Endpoint"), endpoint, args));
   });
+  previous_ = nullptr;
 }
 
 void EndpointList::ResetBackoffLocked() {
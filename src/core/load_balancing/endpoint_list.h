@@ -19,6 +19,7 @@
 
 #include <stdlib.h>
 
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -151,6 +152,15 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
    private:
     class Helper;
 
+    // Takes over the child policy of the endpoint with the same addresses
+    // in the list that this list replaces, if there is one.  Its last
+    // state is reported to OnStateUpdate() as this endpoint's initial
+    // state, asynchronously.
+    bool AdoptChildPolicy(
+        const EndpointAddresses& addresses,
+        const std::shared_ptr<WorkSerializer>& work_serializer);
+    void ReportAdoptedStateLocked();
+
     // Called when the child policy reports a connectivity state update.
     virtual void OnStateUpdate(
         absl::optional<grpc_connectivity_state> old_state,
@@ -164,13 +174,19 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
     RefCountedPtr<EndpointList> endpoint_list_;
 
     OrphanablePtr<LoadBalancingPolicy> child_policy_;
+    // Owned by child_policy_.
+    Helper* helper_ = nullptr;
     absl::optional<grpc_connectivity_state> connectivity_state_;
+    absl::Status status_;
     RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_;
+    // State of an adopted child policy, until it is reported.
+    absl::optional<grpc_connectivity_state> adopted_state_;
   };
 
   ~EndpointList() override { policy_.reset(DEBUG_LOCATION, "EndpointList"); }
 
   void Orphan() override {
+    endpoints_by_addresses_.clear();
     endpoints_.clear();
     Unref();
   }
@@ -190,11 +206,18 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
   EndpointList(RefCountedPtr<LoadBalancingPolicy> policy, const char* tracer)
       : policy_(std::move(policy)), tracer_(tracer) {}
 
+  // If \a previous is set, it is the list that this one replaces.  When
+  // both lists were created with the same args, each endpoint whose
+  // addresses are unchanged takes over the child policy of its
+  // counterpart in \a previous instead of creating a new one, which
+  // leaves \a previous without it.  Endpoint-only updates then only cost
+  // work for the endpoints that were added.
   void Init(EndpointAddressesIterator* endpoints, const ChannelArgs& args,
             absl::FunctionRef<OrphanablePtr<Endpoint>(
                 RefCountedPtr<EndpointList>, const EndpointAddresses&,
                 const ChannelArgs&)>
-                create_endpoint);
+                create_endpoint,
+            EndpointList* previous = nullptr);
 
   // Templated for convenience, to provide a short-hand for down-casting
   // in the caller.
@@ -217,7 +240,13 @@ class EndpointList : public InternallyRefCounted<EndpointList> {
 
   RefCountedPtr<LoadBalancingPolicy> policy_;
   const char* tracer_;
+  ChannelArgs args_;
   std::vector<OrphanablePtr<Endpoint>> endpoints_;
+  // Endpoints that still have their child policy, for the next list to
+  // adopt.
+  std::map<EndpointAddresses, Endpoint*> endpoints_by_addresses_;
+  // Set during Init() to the list to adopt child policies from.
+  EndpointList* previous_ = nullptr;
   size_t num_endpoints_seen_initial_state_ = 0;
 };
 
@@ -21,6 +21,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -48,7 +49,9 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/work_serializer.h"
@@ -57,6 +60,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/pollset_set.h"
+#include "src/core/lib/security/credentials/credentials.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/load_balancing/health_check_client_internal.h"
@@ -90,6 +94,137 @@ class AsyncWorkSerializerDrainer final {
 
 }  // namespace
 
+//
+// HealthProducer::SharedHealthStream
+//
+
+// A health stream shared by the health checkers of the process with the
+// same key. One of them, the driver, runs the stream on its connection, and
+// the updates it gets are reported to all of them. When the driver goes
+// away, another one restarts the stream on its own connection.
+class HealthProducer::SharedHealthStream final
+    : public RefCounted<SharedHealthStream> {
+ public:
+  // Returns the key of the health streams of \a subchannel for
+  // \a health_check_service_name, if they are to be shared.
+  static absl::optional<SharedHealthStreamKey> MakeKey(
+      Subchannel* subchannel, absl::string_view health_check_service_name) {
+    const ChannelArgs& args = subchannel->key_args();
+    if (!args.GetBool(GRPC_ARG_SHARE_HEALTH_CHECK_STREAMS).value_or(false)) {
+      return absl::nullopt;
+    }
+    auto address = grpc_sockaddr_to_uri(&subchannel->address());
+    if (!address.ok()) return absl::nullopt;
+    return SharedHealthStreamKey(
+        std::move(*address), std::string(health_check_service_name),
+        args.GetOwnedString(GRPC_ARG_DEFAULT_AUTHORITY).value_or(""),
+        args.GetObject<grpc_channel_credentials>());
+  }
+
+  // Returns the stream for \a key, creating it if needed.
+  static RefCountedPtr<SharedHealthStream> Get(
+      const SharedHealthStreamKey& key) {
+    MutexLock lock(&*registry_mu_);
+    auto it = registry_->find(key);
+    if (it != registry_->end()) {
+      // The stream may be on its way to being destroyed.
+      auto stream = it->second->RefIfNonZero();
+      if (stream != nullptr) return stream;
+    }
+    auto stream = MakeRefCounted<SharedHealthStream>(key);
+    (*registry_)[key] = stream.get();
+    return stream;
+  }
+
+  explicit SharedHealthStream(SharedHealthStreamKey key)
+      : key_(std::move(key)) {}
+
+  ~SharedHealthStream() override {
+    MutexLock lock(&*registry_mu_);
+    auto it = registry_->find(key_);
+    if (it != registry_->end() && it->second == this) registry_->erase(it);
+  }
+
+  // Adds \a checker, whose subchannel is connected. Returns true if it is to
+  // run the stream.
+  bool AddChecker(HealthChecker* checker) {
+    MutexLock lock(&mu_);
+    checkers_.insert(checker);
+    if (driver_ == nullptr) {
+      driver_ = checker;
+      return true;
+    }
+    if (state_.has_value()) {
+      checker->OnHealthWatchStatusChange(*state_, status_);
+    }
+    return false;
+  }
+
+  void RemoveChecker(HealthChecker* checker) {
+    MutexLock lock(&mu_);
+    checkers_.erase(checker);
+    if (checker != driver_) return;
+    driver_ = nullptr;
+    if (checkers_.empty()) {
+      state_.reset();
+      status_ = absl::OkStatus();
+      return;
+    }
+    driver_ = *checkers_.begin();
+    handing_over_ = true;
+    if (GRPC_TRACE_FLAG_ENABLED(health_check_client)) {
+      LOG(INFO) << "SharedHealthStream " << this << ": handing over from "
+                << "HealthChecker " << checker << " to HealthChecker "
+                << driver_;
+    }
+    driver_->StartSharedHealthStream();
+  }
+
+  bool IsDriver(HealthChecker* checker) {
+    MutexLock lock(&mu_);
+    return checker == driver_;
+  }
+
+  // Called by the stream of \a checker when receiving an update.
+  void OnHealthWatchStatusChange(HealthChecker* checker,
+                                 grpc_connectivity_state state,
+                                 const absl::Status& status) {
+    MutexLock lock(&mu_);
+    if (checker != driver_) return;
+    // The health checkers keep their state while the stream is restarted by
+    // a new driver, until the backend reports on it.
+    if (handing_over_ && state_.has_value() &&
+        state == GRPC_CHANNEL_CONNECTING) {
+      return;
+    }
+    handing_over_ = false;
+    state_ = state;
+    status_ = status;
+    for (HealthChecker* health_checker : checkers_) {
+      health_checker->OnHealthWatchStatusChange(state, status);
+    }
+  }
+
+ private:
+  static NoDestruct<Mutex> registry_mu_;
+  static NoDestruct<std::map<SharedHealthStreamKey, SharedHealthStream*>>
+      registry_ ABSL_GUARDED_BY(registry_mu_);
+
+  const SharedHealthStreamKey key_;
+  Mutex mu_;
+  std::set<HealthChecker*> checkers_ ABSL_GUARDED_BY(&mu_);
+  HealthChecker* driver_ ABSL_GUARDED_BY(&mu_) = nullptr;
+  // The last update, reported to the health checkers that join the stream.
+  absl::optional<grpc_connectivity_state> state_ ABSL_GUARDED_BY(&mu_);
+  absl::Status status_ ABSL_GUARDED_BY(&mu_);
+  bool handing_over_ ABSL_GUARDED_BY(&mu_) = false;
+};
+
+NoDestruct<Mutex> HealthProducer::SharedHealthStream::registry_mu_;
+NoDestruct<std::map<HealthProducer::SharedHealthStreamKey,
+                    HealthProducer::SharedHealthStream*>>
+    HealthProducer::SharedHealthStream::registry_;
+
 //
 // HealthProducer::HealthChecker
 //
@@ -99,6 +234,8 @@ HealthProducer::HealthChecker::HealthChecker(
     absl::string_view health_check_service_name)
     : producer_(std::move(producer)),
       health_check_service_name_(health_check_service_name),
+      shared_stream_key_(SharedHealthStream::MakeKey(
+          producer_->subchannel_.get(), health_check_service_name)),
       state_(producer_->state_ == GRPC_CHANNEL_READY ? GRPC_CHANNEL_CONNECTING
                                                      : producer_->state_),
       status_(producer_->status_) {
@@ -107,7 +244,7 @@ HealthProducer::HealthChecker::HealthChecker(
 }
 
 void HealthProducer::HealthChecker::Orphan() {
-  stream_client_.reset();
+  StopHealthStreamLocked();
   Unref();
 }
 
@@ -140,7 +277,7 @@ void HealthProducer::HealthChecker::OnConnectivityStateChangeLocked(
     status_ = status;
     NotifyWatchersLocked(*state_, status_);
     // We're not connected, so stop health checking.
-    stream_client_.reset();
+    StopHealthStreamLocked();
   }
 }
 
@@ -177,7 +314,8 @@ void HealthProducer::HealthChecker::OnHealthWatchStatusChange(
   work_serializer_->Schedule(
       [self = Ref(), state, status = std::move(use_status)]() mutable {
         MutexLock lock(&self->producer_->mu_);
-        if (self->stream_client_ != nullptr) {
+        if (self->stream_client_ != nullptr ||
+            self->shared_stream_ != nullptr) {
           self->state_ = state;
           self->status_ = std::move(status);
           for (HealthWatcher* watcher : self->watchers_) {
@@ -189,6 +327,17 @@ void HealthProducer::HealthChecker::OnHealthWatchStatusChange(
   new AsyncWorkSerializerDrainer(work_serializer_);
 }
 
+void HealthProducer::HealthChecker::StartSharedHealthStream() {
+  work_serializer_->Schedule(
+      [self = Ref()]() {
+        MutexLock lock(&self->producer_->mu_);
+        // Unless the subchannel was disconnected since.
+        if (self->shared_stream_ != nullptr) self->StartHealthStreamLocked();
+      },
+      DEBUG_LOCATION);
+  new AsyncWorkSerializerDrainer(work_serializer_);
+}
+
 //
 // HealthProducer::HealthChecker::HealthStreamEventHandler
 //
@@ -196,8 +345,10 @@ void HealthProducer::HealthChecker::OnHealthWatchStatusChange(
 class HealthProducer::HealthChecker::HealthStreamEventHandler final
     : public SubchannelStreamClient::CallEventHandler {
  public:
-  explicit HealthStreamEventHandler(RefCountedPtr<HealthChecker> health_checker)
-      : health_checker_(std::move(health_checker)) {}
+  HealthStreamEventHandler(RefCountedPtr<HealthChecker> health_checker,
+                           RefCountedPtr<SharedHealthStream> shared_stream)
+      : health_checker_(std::move(health_checker)),
+        shared_stream_(std::move(shared_stream)) {}
 
   Slice GetPathLocked() override {
     return Slice::FromStaticString("/grpc.health.v1.Health/Watch");
@@ -290,16 +441,31 @@ class HealthProducer::HealthChecker::HealthStreamEventHandler final
                 << ": setting state=" << ConnectivityStateName(state)
                 << " reason=" << reason;
     }
-    health_checker_->OnHealthWatchStatusChange(
-        state, state == GRPC_CHANNEL_TRANSIENT_FAILURE
-                   ? absl::UnavailableError(reason)
-                   : absl::OkStatus());
+    absl::Status status = state == GRPC_CHANNEL_TRANSIENT_FAILURE
+                              ? absl::UnavailableError(reason)
+                              : absl::OkStatus();
+    if (shared_stream_ != nullptr) {
+      shared_stream_->OnHealthWatchStatusChange(health_checker_.get(), state,
+                                                status);
+    } else {
+      health_checker_->OnHealthWatchStatusChange(state, status);
+    }
   }
 
   RefCountedPtr<HealthChecker> health_checker_;
+  // Set if the stream is shared.
+  RefCountedPtr<SharedHealthStream> shared_stream_;
 };
 
 void HealthProducer::HealthChecker::StartHealthStreamLocked() {
+  if (shared_stream_key_.has_value()) {
+    if (shared_stream_ == nullptr) {
+      shared_stream_ = SharedHealthStream::Get(*shared_stream_key_);
+      if (!shared_stream_->AddChecker(this)) return;
+    } else if (!shared_stream_->IsDriver(this)) {
+      return;
+    }
+  }
   if (GRPC_TRACE_FLAG_ENABLED(health_check_client)) {
     LOG(INFO) << "HealthProducer " << producer_.get() << " HealthChecker "
               << this << ": creating HealthClient for \""
@@ -307,10 +473,18 @@ void HealthProducer::HealthChecker::StartHealthStreamLocked() {
   }
   stream_client_ = MakeOrphanable<SubchannelStreamClient>(
       producer_->connected_subchannel_, producer_->subchannel_->pollset_set(),
-      std::make_unique<HealthStreamEventHandler>(Ref()),
+      std::make_unique<HealthStreamEventHandler>(Ref(), shared_stream_),
       GRPC_TRACE_FLAG_ENABLED(health_check_client) ? "HealthClient" : nullptr);
 }
 
+void HealthProducer::HealthChecker::StopHealthStreamLocked() {
+  stream_client_.reset();
+  if (shared_stream_ != nullptr) {
+    shared_stream_->RemoveChecker(this);
+    shared_stream_.reset();
+  }
+}
+
 //
 // HealthProducer::ConnectivityWatcher
 //
@@ -21,6 +21,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 
 #include "absl/base/thread_annotations.h"
@@ -35,6 +36,7 @@
 #include "src/core/client_channel/subchannel_interface_internal.h"
 #include "src/core/client_channel/subchannel_stream_client.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
@@ -73,6 +75,13 @@ class HealthProducer final : public Subchannel::DataProducerInterface {
 
  private:
   class ConnectivityWatcher;
+  class SharedHealthStream;
+
+  // Identifies the health streams that can be shared across the process:
+  // the address, the health check service name, the authority and the
+  // channel credentials of the subchannel.
+  using SharedHealthStreamKey =
+      std::tuple<std::string, std::string, std::string, void*>;
 
   // Health checker for a given health check service name.  Contains the
   // health check client and the list of watchers.
@@ -98,15 +107,29 @@ class HealthProducer final : public Subchannel::DataProducerInterface {
                                          const absl::Status& status)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&HealthProducer::mu_);
 
+    // Called by the health check client, or by the shared health stream,
+    // when receiving an update.
+    void OnHealthWatchStatusChange(grpc_connectivity_state state,
+                                   const absl::Status& status);
+
+    // Called by the shared health stream when this health checker is to
+    // run it, in place of the one that ran it before.
+    void StartSharedHealthStream();
+
    private:
     class HealthStreamEventHandler;
 
     // Starts a new stream if we have a connected subchannel.
     // Called whenever the subchannel transitions to state READY or when a
-    // watcher is added.
+    // watcher is added. If the stream is shared, only starts it if this
+    // health checker is the one running the shared stream.
     void StartHealthStreamLocked()
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&HealthProducer::mu_);
 
+    // Stops the stream, or leaves the shared stream.
+    void StopHealthStreamLocked()
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&HealthProducer::mu_);
+
     // Notifies watchers of a new state.
     // Called while holding the SubchannelStreamClient lock and possibly
     // the producer lock, so must notify asynchronously, but in guaranteed
@@ -115,12 +138,11 @@ class HealthProducer final : public Subchannel::DataProducerInterface {
                               absl::Status status)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&HealthProducer::mu_);
 
-    // Called by the health check client when receiving an update.
-    void OnHealthWatchStatusChange(grpc_connectivity_state state,
-                                   const absl::Status& status);
-
     WeakRefCountedPtr<HealthProducer> producer_;
     absl::string_view health_check_service_name_;
+    // Set if the stream is shared with the other health checkers of the
+    // process with the same key.
+    absl::optional<SharedHealthStreamKey> shared_stream_key_;
     std::shared_ptr<WorkSerializer> work_serializer_ =
         std::make_shared<WorkSerializer>(
             producer_->subchannel_->event_engine());
@@ -130,6 +152,9 @@ class HealthProducer final : public Subchannel::DataProducerInterface {
     absl::Status status_ ABSL_GUARDED_BY(&HealthProducer::mu_);
     OrphanablePtr<SubchannelStreamClient> stream_client_
         ABSL_GUARDED_BY(&HealthProducer::mu_);
+    // The shared stream, joined while the subchannel is connected.
+    RefCountedPtr<SharedHealthStream> shared_stream_
+        ABSL_GUARDED_BY(&HealthProducer::mu_);
     std::set<HealthWatcher*> watchers_ ABSL_GUARDED_BY(&HealthProducer::mu_);
   };
 
@@ -0,0 +1,685 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "absl/types/variant.h"
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+#include "src/core/util/time_precise.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kLatencyAware = "latency_aware_experimental";
+
+// Same bounds as least_request.
+constexpr uint32_t kMinChoiceCount = 2;
+constexpr uint32_t kMaxChoiceCount = 10;
+
+//
+// config
+//
+
+class LatencyAwareConfig final : public LoadBalancingPolicy::Config {
+ public:
+  LatencyAwareConfig() = default;
+
+  LatencyAwareConfig(const LatencyAwareConfig&) = delete;
+  LatencyAwareConfig& operator=(const LatencyAwareConfig&) = delete;
+
+  LatencyAwareConfig(LatencyAwareConfig&&) = delete;
+  LatencyAwareConfig& operator=(LatencyAwareConfig&&) = delete;
+
+  absl::string_view name() const override { return kLatencyAware; }
+
+  uint32_t choice_count() const { return choice_count_; }
+  Duration decay_time() const { return decay_time_; }
+  bool peak_ewma() const { return peak_ewma_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<LatencyAwareConfig>()
+            .OptionalField("choiceCount", &LatencyAwareConfig::choice_count_)
+            .OptionalField("decayTime", &LatencyAwareConfig::decay_time_)
+            .OptionalField("peakEwma", &LatencyAwareConfig::peak_ewma_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    {
+      ValidationErrors::ScopedField field(errors, ".choiceCount");
+      if (!errors->FieldHasErrors() && choice_count_ < kMinChoiceCount) {
+        errors->AddError(absl::StrCat("must be at least ", kMinChoiceCount));
+      }
+      choice_count_ = std::min(choice_count_, kMaxChoiceCount);
+    }
+    ValidationErrors::ScopedField field(errors, ".decayTime");
+    if (!errors->FieldHasErrors() && decay_time_ <= Duration::Zero()) {
+      errors->AddError("must be greater than 0");
+    }
+  }
+
+ private:
+  uint32_t choice_count_ = kMinChoiceCount;
+  Duration decay_time_ = Duration::Seconds(10);
+  bool peak_ewma_ = false;
+};
+
+//
+// latency_aware LB policy
+//
+
+// Picks, for each call, the cheapest out of choice_count randomly chosen
+// READY endpoints ("power of N choices"), where the cost of an endpoint is
+// the moving average of the latency of its calls, as observed by this
+// client, times its number of calls in flight plus one. Unlike ORCA-based
+// weights, this accounts for the network distance to the endpoint.
+class LatencyAware final : public LoadBalancingPolicy {
+ public:
+  explicit LatencyAware(Args args);
+
+  absl::string_view name() const override { return kLatencyAware; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  // The latency estimate and the number of calls in flight of an endpoint.
+  //
+  // The estimate is an exponentially weighted moving average whose weights
+  // decay with time rather than with the number of samples, so that an
+  // endpoint's estimate follows the same curve however busy it is: a sample
+  // taken decay_time ago weighs 1/e as much as one taken now. With peak
+  // EWMA, a sample above the estimate replaces it altogether, so latency
+  // spikes are penalized at once and forgiven gradually. Estimates also
+  // decay when they are read, so that an endpoint that got no calls for a
+  // while because it looked slow gets tried again.
+  class EndpointLatency final : public RefCounted<EndpointLatency> {
+   public:
+    EndpointLatency(Duration decay_time, bool peak_ewma)
+        : decay_micros_(decay_time.millis() * 1000.0), peak_ewma_(peak_ewma) {}
+
+    void AddInFlight(int64_t delta) {
+      in_flight_.this_cpu().calls.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    // Records the latency of a finished call. Failed calls only count if
+    // they raise the estimate: fast failures must not attract traffic.
+    void AddSample(gpr_cycle_counter start, gpr_cycle_counter end, bool ok)
+        ABSL_LOCKS_EXCLUDED(mu_);
+
+    // Returns the cost of sending one more call to the endpoint.
+    double Cost(gpr_cycle_counter now) const;
+
+   private:
+    struct alignas(GPR_CACHELINE_SIZE) Shard {
+      std::atomic<int64_t> calls{0};
+    };
+
+    double Decay(double micros_since_update) const {
+      return std::exp(-std::max(0.0, micros_since_update) / decay_micros_);
+    }
+
+    const double decay_micros_;
+    const bool peak_ewma_;
+    // Serializes updates; picks read the atomics without it.
+    Mutex mu_;
+    bool has_sample_ ABSL_GUARDED_BY(mu_) = false;
+    std::atomic<double> latency_micros_{0};
+    std::atomic<gpr_cycle_counter> last_update_{0};
+    PerCpu<Shard> in_flight_{
+        PerCpuOptions().SetCpusPerShard(4).SetMaxShards(8)};
+  };
+
+  class LatencyAwareEndpointList final : public EndpointList {
+   public:
+    LatencyAwareEndpointList(RefCountedPtr<LatencyAware> latency_aware,
+                             EndpointAddressesIterator* endpoints,
+                             const ChannelArgs& args,
+                             std::vector<std::string>* errors)
+        : EndpointList(std::move(latency_aware),
+                       GRPC_TRACE_FLAG_ENABLED(latency_aware_lb)
+                           ? "LatencyAwareEndpointList"
+                           : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<LatencyAwareEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<LatencyAware>()->work_serializer(), errors);
+           });
+    }
+
+   private:
+    class LatencyAwareEndpoint final : public Endpoint {
+     public:
+      LatencyAwareEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                           const EndpointAddresses& addresses,
+                           const ChannelArgs& args,
+                           std::shared_ptr<WorkSerializer> work_serializer,
+                           std::vector<std::string>* errors)
+          : Endpoint(std::move(endpoint_list)) {
+        const auto& config = policy<LatencyAware>()->config_;
+        latency_ = MakeRefCounted<EndpointLatency>(config->decay_time(),
+                                                   config->peak_ewma());
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      RefCountedPtr<EndpointLatency> latency() const { return latency_; }
+
+     private:
+      // Called when the child policy reports a connectivity state update.
+      void OnStateUpdate(absl::optional<grpc_connectivity_state> old_state,
+                         grpc_connectivity_state new_state,
+                         const absl::Status& status) override;
+
+      RefCountedPtr<EndpointLatency> latency_;
+    };
+
+    LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
+        const override {
+      return policy<LatencyAware>()->channel_control_helper();
+    }
+
+    // Updates the counters of children in each state when a
+    // child transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        absl::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right child list is used and then updates
+    // the policy's connectivity state based on the child list's
+    // state counters.
+    void MaybeUpdateLatencyAwareConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+    std::string CountersString() const {
+      return absl::StrCat("num_children=", size(), " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  class Picker final : public SubchannelPicker {
+   public:
+    struct EndpointInfo {
+      RefCountedPtr<SubchannelPicker> picker;
+      RefCountedPtr<EndpointLatency> latency;
+    };
+
+    Picker(LatencyAware* parent, uint32_t choice_count,
+           std::vector<EndpointInfo> endpoints);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // Counts the call as in flight to its endpoint from the moment it starts
+    // until it finishes, and then records its latency.
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<EndpointLatency> latency,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : latency_(std::move(latency)),
+            child_tracker_(std::move(child_tracker)) {}
+
+      void Start() override {
+        latency_->AddInFlight(1);
+        start_ = gpr_get_cycle_counter();
+        if (child_tracker_ != nullptr) child_tracker_->Start();
+      }
+
+      void Finish(FinishArgs args) override {
+        if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+        latency_->AddSample(start_, gpr_get_cycle_counter(), args.status.ok());
+        latency_->AddInFlight(-1);
+      }
+
+     private:
+      RefCountedPtr<EndpointLatency> latency_;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+      gpr_cycle_counter start_ = 0;
+    };
+
+    // Returns the index into endpoints_ to be picked.
+    size_t PickIndex();
+
+    // Using pointer value only, no ref held -- do not dereference!
+    LatencyAware* parent_;
+
+    const uint32_t choice_count_;
+    std::vector<EndpointInfo> endpoints_;
+  };
+
+  ~LatencyAware() override;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<LatencyAwareConfig> config_;
+
+  // Current child list.
+  OrphanablePtr<LatencyAwareEndpointList> endpoint_list_;
+  // Latest pending child list.
+  // When we get an updated address list, we create a new child list
+  // for it here, and we wait to swap it into endpoint_list_ until the new
+  // list becomes READY.
+  OrphanablePtr<LatencyAwareEndpointList> latest_pending_endpoint_list_;
+
+  bool shutdown_ = false;
+};
+
+//
+// LatencyAware::EndpointLatency
+//
+
+void LatencyAware::EndpointLatency::AddSample(gpr_cycle_counter start,
+                                              gpr_cycle_counter end, bool ok) {
+  const double sample =
+      gpr_timespec_to_micros(gpr_cycle_counter_sub(end, start));
+  MutexLock lock(&mu_);
+  const double latency = latency_micros_.load(std::memory_order_relaxed);
+  if (!ok && sample <= latency) return;
+  double updated = sample;
+  if (has_sample_ && !(peak_ewma_ && sample > latency)) {
+    const double weight = Decay(gpr_timespec_to_micros(gpr_cycle_counter_sub(
+        end, last_update_.load(std::memory_order_relaxed))));
+    updated = latency * weight + sample * (1 - weight);
+  }
+  has_sample_ = true;
+  latency_micros_.store(updated, std::memory_order_relaxed);
+  last_update_.store(end, std::memory_order_relaxed);
+}
+
+double LatencyAware::EndpointLatency::Cost(gpr_cycle_counter now) const {
+  int64_t in_flight = 0;
+  for (const Shard& shard : in_flight_) {
+    in_flight += shard.calls.load(std::memory_order_relaxed);
+  }
+  in_flight = std::max<int64_t>(in_flight, 0);
+  const double latency = latency_micros_.load(std::memory_order_relaxed);
+  // Until its first call finishes, an endpoint is worth trying, but only
+  // with one call at a time.
+  if (latency == 0) {
+    // As in finagle's peak EWMA balancer.
+    constexpr double kPenalty = 1e30;
+    return in_flight == 0 ? 0 : kPenalty + in_flight;
+  }
+  const double decayed =
+      latency * Decay(gpr_timespec_to_micros(gpr_cycle_counter_sub(
+                    now, last_update_.load(std::memory_order_relaxed))));
+  return decayed * (in_flight + 1);
+}
+
+//
+// LatencyAware::Picker
+//
+
+LatencyAware::Picker::Picker(LatencyAware* parent, uint32_t choice_count,
+                             std::vector<EndpointInfo> endpoints)
+    : parent_(parent),
+      choice_count_(choice_count),
+      endpoints_(std::move(endpoints)) {
+  GRPC_TRACE_LOG(latency_aware_lb, INFO)
+      << "[LA " << parent_ << " picker " << this
+      << "] created picker from endpoint_list="
+      << parent_->endpoint_list_.get() << " with " << endpoints_.size()
+      << " READY children; choice_count=" << choice_count_;
+}
+
+size_t LatencyAware::Picker::PickIndex() {
+  if (endpoints_.size() == 1) return 0;
+  // Picks run concurrently on any number of threads.
+  thread_local absl::InsecureBitGen bit_gen;
+  const gpr_cycle_counter now = gpr_get_cycle_counter();
+  size_t best = absl::Uniform<size_t>(bit_gen, 0, endpoints_.size());
+  double best_cost = endpoints_[best].latency->Cost(now);
+  // Candidates are drawn with replacement, as in least_request.
+  for (uint32_t i = 1; i < choice_count_; ++i) {
+    const size_t candidate =
+        absl::Uniform<size_t>(bit_gen, 0, endpoints_.size());
+    const double cost = endpoints_[candidate].latency->Cost(now);
+    if (cost < best_cost) {
+      best = candidate;
+      best_cost = cost;
+    }
+  }
+  return best;
+}
+
+LatencyAware::PickResult LatencyAware::Picker::Pick(PickArgs args) {
+  const size_t index = PickIndex();
+  EndpointInfo& endpoint = endpoints_[index];
+  GRPC_TRACE_LOG(latency_aware_lb, INFO)
+      << "[LA " << parent_ << " picker " << this << "] using picker index "
+      << index << ", picker=" << endpoint.picker.get();
+  PickResult result = endpoint.picker->Pick(args);
+  auto* complete = absl::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    complete->subchannel_call_tracker =
+        std::make_unique<SubchannelCallTracker>(
+            endpoint.latency, std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
+//
+// LatencyAware
+//
+
+LatencyAware::LatencyAware(Args args) : LoadBalancingPolicy(std::move(args)) {
+  GRPC_TRACE_LOG(latency_aware_lb, INFO) << "[LA " << this << "] Created";
+}
+
+LatencyAware::~LatencyAware() {
+  GRPC_TRACE_LOG(latency_aware_lb, INFO)
+      << "[LA " << this << "] Destroying Latency Aware policy";
+  CHECK(endpoint_list_ == nullptr);
+  CHECK(latest_pending_endpoint_list_ == nullptr);
+}
+
+void LatencyAware::ShutdownLocked() {
+  GRPC_TRACE_LOG(latency_aware_lb, INFO) << "[LA " << this << "] Shutting down";
+  shutdown_ = true;
+  endpoint_list_.reset();
+  latest_pending_endpoint_list_.reset();
+}
+
+void LatencyAware::ResetBackoffLocked() {
+  endpoint_list_->ResetBackoffLocked();
+  if (latest_pending_endpoint_list_ != nullptr) {
+    latest_pending_endpoint_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status LatencyAware::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<LatencyAwareConfig>();
+  EndpointAddressesIterator* addresses = nullptr;
+  if (args.addresses.ok()) {
+    GRPC_TRACE_LOG(latency_aware_lb, INFO)
+        << "[LA " << this << "] received update";
+    addresses = args.addresses->get();
+  } else {
+    GRPC_TRACE_LOG(latency_aware_lb, INFO)
+        << "[LA " << this << "] received update with address error: "
+        << args.addresses.status();
+    // If we already have a child list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (endpoint_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new child list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(latency_aware_lb) &&
+      latest_pending_endpoint_list_ != nullptr) {
+    LOG(INFO) << "[LA " << this << "] replacing previous pending child list "
+              << latest_pending_endpoint_list_.get();
+  }
+  std::vector<std::string> errors;
+  latest_pending_endpoint_list_ = MakeOrphanable<LatencyAwareEndpointList>(
+      RefAsSubclass<LatencyAware>(DEBUG_LOCATION, "LatencyAwareEndpointList"),
+      addresses, args.args, &errors);
+  // If the new list is empty, immediately promote it to
+  // endpoint_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_endpoint_list_->size() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(latency_aware_lb) &&
+        endpoint_list_ != nullptr) {
+      LOG(INFO) << "[LA " << this << "] replacing previous child list "
+                << endpoint_list_.get();
+    }
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    absl::Status status =
+        args.addresses.ok() ? absl::UnavailableError(absl::StrCat(
+                                  "empty address list: ", args.resolution_note))
+                            : args.addresses.status();
+    channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, status,
+        MakeRefCounted<TransientFailurePicker>(status));
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // endpoint_list_.
+  if (endpoint_list_ == nullptr) {
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  }
+  if (!errors.empty()) {
+    return absl::UnavailableError(absl::StrCat(
+        "errors from children: [", absl::StrJoin(errors, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+//
+// LatencyAware::LatencyAwareEndpointList::LatencyAwareEndpoint
+//
+
+void LatencyAware::LatencyAwareEndpointList::LatencyAwareEndpoint::
+    OnStateUpdate(absl::optional<grpc_connectivity_state> old_state,
+                  grpc_connectivity_state new_state,
+                  const absl::Status& status) {
+  auto* la_endpoint_list = endpoint_list<LatencyAwareEndpointList>();
+  auto* latency_aware = policy<LatencyAware>();
+  GRPC_TRACE_LOG(latency_aware_lb, INFO)
+      << "[LA " << latency_aware << "] connectivity changed for child " << this
+      << ", endpoint_list " << la_endpoint_list << " (index " << Index()
+      << " of " << la_endpoint_list->size() << "): prev_state="
+      << (old_state.has_value() ? ConnectivityStateName(*old_state) : "N/A")
+      << " new_state=" << ConnectivityStateName(new_state) << " (" << status
+      << ")";
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    GRPC_TRACE_LOG(latency_aware_lb, INFO)
+        << "[LA " << latency_aware << "] child " << this
+        << " reported IDLE; requesting connection";
+    ExitIdleLocked();
+  }
+  // If state changed, update state counters.
+  if (!old_state.has_value() || *old_state != new_state) {
+    la_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
+  }
+  // Update the policy state.
+  la_endpoint_list->MaybeUpdateLatencyAwareConnectivityStateLocked(status);
+}
+
+//
+// LatencyAware::LatencyAwareEndpointList
+//
+
+void LatencyAware::LatencyAwareEndpointList::UpdateStateCountersLocked(
+    absl::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  // We treat IDLE the same as CONNECTING, since it will immediately
+  // transition into that state anyway.
+  if (old_state.has_value()) {
+    CHECK(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      CHECK_GT(num_ready_, 0u);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING ||
+               *old_state == GRPC_CHANNEL_IDLE) {
+      CHECK_GT(num_connecting_, 0u);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      CHECK_GT(num_transient_failure_, 0u);
+      --num_transient_failure_;
+    }
+  }
+  CHECK(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING ||
+             new_state == GRPC_CHANNEL_IDLE) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void LatencyAware::LatencyAwareEndpointList::
+    MaybeUpdateLatencyAwareConnectivityStateLocked(absl::Status status_for_tf) {
+  auto* latency_aware = policy<LatencyAware>();
+  // If this is latest_pending_endpoint_list_, then swap it into
+  // endpoint_list_ in the following cases:
+  // - endpoint_list_ has no READY children.
+  // - This list has at least one READY child and we have seen the
+  //   initial connectivity state notification for all children.
+  // - All of the children in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (latency_aware->latest_pending_endpoint_list_.get() == this &&
+      (latency_aware->endpoint_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllEndpointsSeenInitialState()) ||
+       num_transient_failure_ == size())) {
+    if (GRPC_TRACE_FLAG_ENABLED(latency_aware_lb)) {
+      const std::string old_counters_string =
+          latency_aware->endpoint_list_ != nullptr
+              ? latency_aware->endpoint_list_->CountersString()
+              : "";
+      LOG(INFO) << "[LA " << latency_aware << "] swapping out child list "
+                << latency_aware->endpoint_list_.get() << " ("
+                << old_counters_string << ") in favor of " << this << " ("
+                << CountersString() << ")";
+    }
+    latency_aware->endpoint_list_ =
+        std::move(latency_aware->latest_pending_endpoint_list_);
+  }
+  // Only set connectivity state if this is the current child list.
+  if (latency_aware->endpoint_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY child is READY => policy is READY.
+  // 2) ANY child is CONNECTING => policy is CONNECTING.
+  // 3) ALL children are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    GRPC_TRACE_LOG(latency_aware_lb, INFO)
+        << "[LA " << latency_aware << "] reporting READY with child list "
+        << this;
+    std::vector<Picker::EndpointInfo> endpoints;
+    for (const auto& endpoint : this->endpoints()) {
+      auto state = endpoint->connectivity_state();
+      if (state.has_value() && *state == GRPC_CHANNEL_READY) {
+        endpoints.push_back(
+            {endpoint->picker(),
+             static_cast<LatencyAwareEndpoint*>(endpoint.get())->latency()});
+      }
+    }
+    CHECK(!endpoints.empty());
+    latency_aware->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_READY, absl::OkStatus(),
+        MakeRefCounted<Picker>(latency_aware,
+                               latency_aware->config_->choice_count(),
+                               std::move(endpoints)));
+  } else if (num_connecting_ > 0) {
+    GRPC_TRACE_LOG(latency_aware_lb, INFO)
+        << "[LA " << latency_aware << "] reporting CONNECTING with child list "
+        << this;
+    latency_aware->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::Status(),
+        MakeRefCounted<QueuePicker>(nullptr));
+  } else if (num_transient_failure_ == size()) {
+    GRPC_TRACE_LOG(latency_aware_lb, INFO)
+        << "[LA " << latency_aware
+        << "] reporting TRANSIENT_FAILURE with child list " << this << ": "
+        << status_for_tf;
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.message()));
+    }
+    latency_aware->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, last_failure_,
+        MakeRefCounted<TransientFailurePicker>(last_failure_));
+  }
+}
+
+//
+// factory
+//
+
+class LatencyAwareFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<LatencyAware>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kLatencyAware; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<LatencyAwareConfig>>(
+        json, JsonArgs(), "errors validating latency_aware LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterLatencyAwareLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<LatencyAwareFactory>());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,603 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/log/log.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "absl/types/variant.h"
+
+#include <grpc/impl/connectivity_state.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/lib/transport/connectivity_state.h"
+#include "src/core/load_balancing/endpoint_list.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/lb_policy_factory.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_args.h"
+#include "src/core/util/json/json_object_loader.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr absl::string_view kLeastRequest = "least_request_experimental";
+
+// Same bounds as the choice_count of envoy's LeastRequestLbConfig (lower),
+// and of the other gRPC implementations (upper).
+constexpr uint32_t kMinChoiceCount = 2;
+constexpr uint32_t kMaxChoiceCount = 10;
+
+//
+// config
+//
+
+class LeastRequestConfig final : public LoadBalancingPolicy::Config {
+ public:
+  LeastRequestConfig() = default;
+
+  LeastRequestConfig(const LeastRequestConfig&) = delete;
+  LeastRequestConfig& operator=(const LeastRequestConfig&) = delete;
+
+  LeastRequestConfig(LeastRequestConfig&&) = delete;
+  LeastRequestConfig& operator=(LeastRequestConfig&&) = delete;
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  uint32_t choice_count() const { return choice_count_; }
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<LeastRequestConfig>()
+            .OptionalField("choiceCount", &LeastRequestConfig::choice_count_)
+            .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    ValidationErrors::ScopedField field(errors, ".choiceCount");
+    if (!errors->FieldHasErrors() && choice_count_ < kMinChoiceCount) {
+      errors->AddError(absl::StrCat("must be at least ", kMinChoiceCount));
+    }
+    choice_count_ = std::min(choice_count_, kMaxChoiceCount);
+  }
+
+ private:
+  uint32_t choice_count_ = kMinChoiceCount;
+};
+
+//
+// least_request LB policy
+//
+
+// Picks, for each call, the endpoint with the fewest calls in flight out of
+// choice_count randomly chosen READY endpoints ("power of N choices").
+class LeastRequest final : public LoadBalancingPolicy {
+ public:
+  explicit LeastRequest(Args args);
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::Status UpdateLocked(UpdateArgs args) override;
+  void ResetBackoffLocked() override;
+
+ private:
+  // The number of calls in flight to an endpoint. Updated by every call
+  // started on the endpoint, so it is spread over per-CPU shards; reads sum
+  // them up.
+  class InFlightCounter final : public RefCounted<InFlightCounter> {
+   public:
+    void Add(int64_t delta) {
+      shards_.this_cpu().calls.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    int64_t Get() const {
+      int64_t calls = 0;
+      for (const Shard& shard : shards_) {
+        calls += shard.calls.load(std::memory_order_relaxed);
+      }
+      return calls;
+    }
+
+   private:
+    struct alignas(GPR_CACHELINE_SIZE) Shard {
+      std::atomic<int64_t> calls{0};
+    };
+
+    PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(8)};
+  };
+
+  class LeastRequestEndpointList final : public EndpointList {
+   public:
+    LeastRequestEndpointList(RefCountedPtr<LeastRequest> least_request,
+                             EndpointAddressesIterator* endpoints,
+                             const ChannelArgs& args,
+                             EndpointList* previous,
+                             std::vector<std::string>* errors)
+        : EndpointList(std::move(least_request),
+                       GRPC_TRACE_FLAG_ENABLED(least_request_lb)
+                           ? "LeastRequestEndpointList"
+                           : nullptr) {
+      Init(endpoints, args,
+           [&](RefCountedPtr<EndpointList> endpoint_list,
+               const EndpointAddresses& addresses, const ChannelArgs& args) {
+             return MakeOrphanable<LeastRequestEndpoint>(
+                 std::move(endpoint_list), addresses, args,
+                 policy<LeastRequest>()->work_serializer(), errors);
+           },
+           previous);
+    }
+
+   private:
+    class LeastRequestEndpoint final : public Endpoint {
+     public:
+      LeastRequestEndpoint(RefCountedPtr<EndpointList> endpoint_list,
+                           const EndpointAddresses& addresses,
+                           const ChannelArgs& args,
+                           std::shared_ptr<WorkSerializer> work_serializer,
+                           std::vector<std::string>* errors)
+          : Endpoint(std::move(endpoint_list)),
+            in_flight_(MakeRefCounted<InFlightCounter>()) {
+        absl::Status status = Init(addresses, args, std::move(work_serializer));
+        if (!status.ok()) {
+          errors->emplace_back(absl::StrCat("endpoint ", addresses.ToString(),
+                                            ": ", status.ToString()));
+        }
+      }
+
+      RefCountedPtr<InFlightCounter> in_flight() const { return in_flight_; }
+
+     private:
+      // Called when the child policy reports a connectivity state update.
+      void OnStateUpdate(absl::optional<grpc_connectivity_state> old_state,
+                         grpc_connectivity_state new_state,
+                         const absl::Status& status) override;
+
+      RefCountedPtr<InFlightCounter> in_flight_;
+    };
+
+    LoadBalancingPolicy::ChannelControlHelper* channel_control_helper()
+        const override {
+      return policy<LeastRequest>()->channel_control_helper();
+    }
+
+    // Updates the counters of children in each state when a
+    // child transitions from old_state to new_state.
+    void UpdateStateCountersLocked(
+        absl::optional<grpc_connectivity_state> old_state,
+        grpc_connectivity_state new_state);
+
+    // Ensures that the right child list is used and then updates
+    // the policy's connectivity state based on the child list's
+    // state counters.
+    void MaybeUpdateLeastRequestConnectivityStateLocked(
+        absl::Status status_for_tf);
+
+    std::string CountersString() const {
+      return absl::StrCat("num_children=", size(), " num_ready=", num_ready_,
+                          " num_connecting=", num_connecting_,
+                          " num_transient_failure=", num_transient_failure_);
+    }
+
+    size_t num_ready_ = 0;
+    size_t num_connecting_ = 0;
+    size_t num_transient_failure_ = 0;
+
+    absl::Status last_failure_;
+  };
+
+  class Picker final : public SubchannelPicker {
+   public:
+    struct EndpointInfo {
+      RefCountedPtr<SubchannelPicker> picker;
+      RefCountedPtr<InFlightCounter> in_flight;
+    };
+
+    Picker(LeastRequest* parent, uint32_t choice_count,
+           std::vector<EndpointInfo> endpoints);
+
+    PickResult Pick(PickArgs args) override;
+
+   private:
+    // Counts the call as in flight to its endpoint from the moment it starts
+    // until it finishes.
+    class SubchannelCallTracker final : public SubchannelCallTrackerInterface {
+     public:
+      SubchannelCallTracker(
+          RefCountedPtr<InFlightCounter> in_flight,
+          std::unique_ptr<SubchannelCallTrackerInterface> child_tracker)
+          : in_flight_(std::move(in_flight)),
+            child_tracker_(std::move(child_tracker)) {}
+
+      void Start() override {
+        in_flight_->Add(1);
+        if (child_tracker_ != nullptr) child_tracker_->Start();
+      }
+
+      void Finish(FinishArgs args) override {
+        if (child_tracker_ != nullptr) child_tracker_->Finish(args);
+        in_flight_->Add(-1);
+      }
+
+     private:
+      RefCountedPtr<InFlightCounter> in_flight_;
+      std::unique_ptr<SubchannelCallTrackerInterface> child_tracker_;
+    };
+
+    // Returns the index into endpoints_ to be picked.
+    size_t PickIndex();
+
+    // Using pointer value only, no ref held -- do not dereference!
+    LeastRequest* parent_;
+
+    const uint32_t choice_count_;
+    std::vector<EndpointInfo> endpoints_;
+  };
+
+  ~LeastRequest() override;
+
+  void ShutdownLocked() override;
+
+  RefCountedPtr<LeastRequestConfig> config_;
+
+  // Current child list.
+  OrphanablePtr<LeastRequestEndpointList> endpoint_list_;
+  // Latest pending child list.
+  // When we get an updated address list, we create a new child list
+  // for it here, and we wait to swap it into endpoint_list_ until the new
+  // list becomes READY.
+  OrphanablePtr<LeastRequestEndpointList> latest_pending_endpoint_list_;
+
+  bool shutdown_ = false;
+};
+
+//
+// LeastRequest::Picker
+//
+
+LeastRequest::Picker::Picker(LeastRequest* parent, uint32_t choice_count,
+                             std::vector<EndpointInfo> endpoints)
+    : parent_(parent),
+      choice_count_(choice_count),
+      endpoints_(std::move(endpoints)) {
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LR " << parent_ << " picker " << this
+      << "] created picker from endpoint_list="
+      << parent_->endpoint_list_.get() << " with " << endpoints_.size()
+      << " READY children; choice_count=" << choice_count_;
+}
+
+size_t LeastRequest::Picker::PickIndex() {
+  if (endpoints_.size() == 1) return 0;
+  // Picks run concurrently on any number of threads.
+  thread_local absl::InsecureBitGen bit_gen;
+  size_t best = absl::Uniform<size_t>(bit_gen, 0, endpoints_.size());
+  int64_t best_in_flight = endpoints_[best].in_flight->Get();
+  // Candidates are drawn with replacement, as in envoy's implementation.
+  for (uint32_t i = 1; i < choice_count_; ++i) {
+    const size_t candidate =
+        absl::Uniform<size_t>(bit_gen, 0, endpoints_.size());
+    const int64_t in_flight = endpoints_[candidate].in_flight->Get();
+    if (in_flight < best_in_flight) {
+      best = candidate;
+      best_in_flight = in_flight;
+    }
+  }
+  return best;
+}
+
+LeastRequest::PickResult LeastRequest::Picker::Pick(PickArgs args) {
+  const size_t index = PickIndex();
+  EndpointInfo& endpoint = endpoints_[index];
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LR " << parent_ << " picker " << this << "] using picker index "
+      << index << ", picker=" << endpoint.picker.get();
+  PickResult result = endpoint.picker->Pick(args);
+  auto* complete = absl::get_if<PickResult::Complete>(&result.result);
+  if (complete != nullptr) {
+    complete->subchannel_call_tracker =
+        std::make_unique<SubchannelCallTracker>(
+            endpoint.in_flight, std::move(complete->subchannel_call_tracker));
+  }
+  return result;
+}
+
+//
+// LeastRequest
+//
+
+LeastRequest::LeastRequest(Args args) : LoadBalancingPolicy(std::move(args)) {
+  GRPC_TRACE_LOG(least_request_lb, INFO) << "[LR " << this << "] Created";
+}
+
+LeastRequest::~LeastRequest() {
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LR " << this << "] Destroying Least Request policy";
+  CHECK(endpoint_list_ == nullptr);
+  CHECK(latest_pending_endpoint_list_ == nullptr);
+}
+
+void LeastRequest::ShutdownLocked() {
+  GRPC_TRACE_LOG(least_request_lb, INFO) << "[LR " << this << "] Shutting down";
+  shutdown_ = true;
+  endpoint_list_.reset();
+  latest_pending_endpoint_list_.reset();
+}
+
+void LeastRequest::ResetBackoffLocked() {
+  endpoint_list_->ResetBackoffLocked();
+  if (latest_pending_endpoint_list_ != nullptr) {
+    latest_pending_endpoint_list_->ResetBackoffLocked();
+  }
+}
+
+absl::Status LeastRequest::UpdateLocked(UpdateArgs args) {
+  config_ = args.config.TakeAsSubclass<LeastRequestConfig>();
+  EndpointAddressesIterator* addresses = nullptr;
+  if (args.addresses.ok()) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << this << "] received update";
+    addresses = args.addresses->get();
+  } else {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << this << "] received update with address error: "
+        << args.addresses.status();
+    // If we already have a child list, then keep using the existing
+    // list, but still report back that the update was not accepted.
+    if (endpoint_list_ != nullptr) return args.addresses.status();
+  }
+  // Create new child list, replacing the previous pending list, if any.
+  if (GRPC_TRACE_FLAG_ENABLED(least_request_lb) &&
+      latest_pending_endpoint_list_ != nullptr) {
+    LOG(INFO) << "[LR " << this << "] replacing previous pending child list "
+              << latest_pending_endpoint_list_.get();
+  }
+  // Unchanged endpoints take over their child policies from the most
+  // recent list.
+  EndpointList* previous = latest_pending_endpoint_list_ != nullptr
+                               ? latest_pending_endpoint_list_.get()
+                               : endpoint_list_.get();
+  std::vector<std::string> errors;
+  latest_pending_endpoint_list_ = MakeOrphanable<LeastRequestEndpointList>(
+      RefAsSubclass<LeastRequest>(DEBUG_LOCATION, "LeastRequestEndpointList"),
+      addresses, args.args, previous, &errors);
+  // If the new list is empty, immediately promote it to
+  // endpoint_list_ and report TRANSIENT_FAILURE.
+  if (latest_pending_endpoint_list_->size() == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(least_request_lb) &&
+        endpoint_list_ != nullptr) {
+      LOG(INFO) << "[LR " << this << "] replacing previous child list "
+                << endpoint_list_.get();
+    }
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+    absl::Status status =
+        args.addresses.ok() ? absl::UnavailableError(absl::StrCat(
+                                  "empty address list: ", args.resolution_note))
+                            : args.addresses.status();
+    channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, status,
+        MakeRefCounted<TransientFailurePicker>(status));
+    return status;
+  }
+  // Otherwise, if this is the initial update, immediately promote it to
+  // endpoint_list_.
+  if (endpoint_list_ == nullptr) {
+    endpoint_list_ = std::move(latest_pending_endpoint_list_);
+  }
+  if (!errors.empty()) {
+    return absl::UnavailableError(absl::StrCat(
+        "errors from children: [", absl::StrJoin(errors, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+//
+// LeastRequest::LeastRequestEndpointList::LeastRequestEndpoint
+//
+
+void LeastRequest::LeastRequestEndpointList::LeastRequestEndpoint::
+    OnStateUpdate(absl::optional<grpc_connectivity_state> old_state,
+                  grpc_connectivity_state new_state,
+                  const absl::Status& status) {
+  auto* lr_endpoint_list = endpoint_list<LeastRequestEndpointList>();
+  auto* least_request = policy<LeastRequest>();
+  GRPC_TRACE_LOG(least_request_lb, INFO)
+      << "[LR " << least_request << "] connectivity changed for child " << this
+      << ", endpoint_list " << lr_endpoint_list << " (index " << Index()
+      << " of " << lr_endpoint_list->size() << "): prev_state="
+      << (old_state.has_value() ? ConnectivityStateName(*old_state) : "N/A")
+      << " new_state=" << ConnectivityStateName(new_state) << " (" << status
+      << ")";
+  if (new_state == GRPC_CHANNEL_IDLE) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << least_request << "] child " << this
+        << " reported IDLE; requesting connection";
+    ExitIdleLocked();
+  }
+  // If state changed, update state counters.
+  if (!old_state.has_value() || *old_state != new_state) {
+    lr_endpoint_list->UpdateStateCountersLocked(old_state, new_state);
+  }
+  // Update the policy state.
+  lr_endpoint_list->MaybeUpdateLeastRequestConnectivityStateLocked(status);
+}
+
+//
+// LeastRequest::LeastRequestEndpointList
+//
+
+void LeastRequest::LeastRequestEndpointList::UpdateStateCountersLocked(
+    absl::optional<grpc_connectivity_state> old_state,
+    grpc_connectivity_state new_state) {
+  // We treat IDLE the same as CONNECTING, since it will immediately
+  // transition into that state anyway.
+  if (old_state.has_value()) {
+    CHECK(*old_state != GRPC_CHANNEL_SHUTDOWN);
+    if (*old_state == GRPC_CHANNEL_READY) {
+      CHECK_GT(num_ready_, 0u);
+      --num_ready_;
+    } else if (*old_state == GRPC_CHANNEL_CONNECTING ||
+               *old_state == GRPC_CHANNEL_IDLE) {
+      CHECK_GT(num_connecting_, 0u);
+      --num_connecting_;
+    } else if (*old_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+      CHECK_GT(num_transient_failure_, 0u);
+      --num_transient_failure_;
+    }
+  }
+  CHECK(new_state != GRPC_CHANNEL_SHUTDOWN);
+  if (new_state == GRPC_CHANNEL_READY) {
+    ++num_ready_;
+  } else if (new_state == GRPC_CHANNEL_CONNECTING ||
+             new_state == GRPC_CHANNEL_IDLE) {
+    ++num_connecting_;
+  } else if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+    ++num_transient_failure_;
+  }
+}
+
+void LeastRequest::LeastRequestEndpointList::
+    MaybeUpdateLeastRequestConnectivityStateLocked(absl::Status status_for_tf) {
+  auto* least_request = policy<LeastRequest>();
+  // If this is latest_pending_endpoint_list_, then swap it into
+  // endpoint_list_ in the following cases:
+  // - endpoint_list_ has no READY children.
+  // - This list has at least one READY child and we have seen the
+  //   initial connectivity state notification for all children.
+  // - All of the children in this list are in TRANSIENT_FAILURE.
+  //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
+  //   but we're doing what the control plane told us to do.)
+  if (least_request->latest_pending_endpoint_list_.get() == this &&
+      (least_request->endpoint_list_->num_ready_ == 0 ||
+       (num_ready_ > 0 && AllEndpointsSeenInitialState()) ||
+       num_transient_failure_ == size())) {
+    if (GRPC_TRACE_FLAG_ENABLED(least_request_lb)) {
+      const std::string old_counters_string =
+          least_request->endpoint_list_ != nullptr
+              ? least_request->endpoint_list_->CountersString()
+              : "";
+      LOG(INFO) << "[LR " << least_request << "] swapping out child list "
+                << least_request->endpoint_list_.get() << " ("
+                << old_counters_string << ") in favor of " << this << " ("
+                << CountersString() << ")";
+    }
+    least_request->endpoint_list_ =
+        std::move(least_request->latest_pending_endpoint_list_);
+  }
+  // Only set connectivity state if this is the current child list.
+  if (least_request->endpoint_list_.get() != this) return;
+  // First matching rule wins:
+  // 1) ANY child is READY => policy is READY.
+  // 2) ANY child is CONNECTING => policy is CONNECTING.
+  // 3) ALL children are TRANSIENT_FAILURE => policy is TRANSIENT_FAILURE.
+  if (num_ready_ > 0) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << least_request << "] reporting READY with child list "
+        << this;
+    std::vector<Picker::EndpointInfo> endpoints;
+    for (const auto& endpoint : this->endpoints()) {
+      auto state = endpoint->connectivity_state();
+      if (state.has_value() && *state == GRPC_CHANNEL_READY) {
+        endpoints.push_back(
+            {endpoint->picker(),
+             static_cast<LeastRequestEndpoint*>(endpoint.get())
+                 ->in_flight()});
+      }
+    }
+    CHECK(!endpoints.empty());
+    least_request->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_READY, absl::OkStatus(),
+        MakeRefCounted<Picker>(least_request,
+                               least_request->config_->choice_count(),
+                               std::move(endpoints)));
+  } else if (num_connecting_ > 0) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << least_request << "] reporting CONNECTING with child list "
+        << this;
+    least_request->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_CONNECTING, absl::Status(),
+        MakeRefCounted<QueuePicker>(nullptr));
+  } else if (num_transient_failure_ == size()) {
+    GRPC_TRACE_LOG(least_request_lb, INFO)
+        << "[LR " << least_request
+        << "] reporting TRANSIENT_FAILURE with child list " << this << ": "
+        << status_for_tf;
+    if (!status_for_tf.ok()) {
+      last_failure_ = absl::UnavailableError(
+          absl::StrCat("connections to all backends failing; last error: ",
+                       status_for_tf.message()));
+    }
+    least_request->channel_control_helper()->UpdateState(
+        GRPC_CHANNEL_TRANSIENT_FAILURE, last_failure_,
+        MakeRefCounted<TransientFailurePicker>(last_failure_));
+  }
+}
+
+//
+// factory
+//
+
+class LeastRequestFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<LeastRequest>(std::move(args));
+  }
+
+  absl::string_view name() const override { return kLeastRequest; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    return LoadFromJson<RefCountedPtr<LeastRequestConfig>>(
+        json, JsonArgs(), "errors validating least_request LB policy config");
+  }
+};
+
+}  // namespace
+
+void RegisterLeastRequestLbPolicy(CoreConfiguration::Builder* builder) {
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<LeastRequestFactory>());
+}
+
+}  // namespace grpc_core
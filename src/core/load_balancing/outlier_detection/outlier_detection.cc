@@ -52,6 +52,7 @@
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -284,29 +285,41 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
       }
     }
 
+    // Ends the current interval: the counts of the calls that finished
+    // during it become the ones GetSuccessRateAndVolume() reports, and
+    // counting starts again from zero. Only called from the ejection timer
+    // and on config updates, so the sums over the shards stay off the call
+    // path.
     void RotateBucket() {
-      backup_bucket_->successes = 0;
-      backup_bucket_->failures = 0;
-      current_bucket_.swap(backup_bucket_);
-      active_bucket_.store(current_bucket_.get());
+      uint64_t successes = 0;
+      uint64_t failures = 0;
+      for (const CallCounts& counts : call_counts_) {
+        successes += counts.successes.load(std::memory_order_relaxed);
+        failures += counts.failures.load(std::memory_order_relaxed);
+      }
+      interval_successes_ = successes - total_successes_;
+      interval_failures_ = failures - total_failures_;
+      total_successes_ = successes;
+      total_failures_ = failures;
     }
 
     absl::optional<std::pair<double, uint64_t>> GetSuccessRateAndVolume() {
-      uint64_t total_request =
-          backup_bucket_->successes + backup_bucket_->failures;
+      const uint64_t total_request = interval_successes_ + interval_failures_;
       if (total_request == 0) {
         return absl::nullopt;
       }
-      double success_rate =
-          backup_bucket_->successes * 100.0 /
-          (backup_bucket_->successes + backup_bucket_->failures);
-      return {
-          {success_rate, backup_bucket_->successes + backup_bucket_->failures}};
+      double success_rate = interval_successes_ * 100.0 / total_request;
+      return {{success_rate, total_request}};
     }
 
-    void AddSuccessCount() { active_bucket_.load()->successes.fetch_add(1); }
+    void AddSuccessCount() {
+      call_counts_.this_cpu().successes.fetch_add(1,
+                                                  std::memory_order_relaxed);
+    }
 
-    void AddFailureCount() { active_bucket_.load()->failures.fetch_add(1); }
+    void AddFailureCount() {
+      call_counts_.this_cpu().failures.fetch_add(1, std::memory_order_relaxed);
+    }
 
     absl::optional<Timestamp> ejection_time() const { return ejection_time_; }
 
@@ -352,18 +365,24 @@ class OutlierDetectionLb final : public LoadBalancingPolicy {
     }
 
    private:
-    struct Bucket {
-      std::atomic<uint64_t> successes;
-      std::atomic<uint64_t> failures;
+    // Counts of finished calls since the endpoint was created, sharded so
+    // that calls finishing on different CPUs do not write the same cache
+    // line.
+    struct alignas(GPR_CACHELINE_SIZE) CallCounts {
+      std::atomic<uint64_t> successes{0};
+      std::atomic<uint64_t> failures{0};
     };
 
     const std::set<SubchannelState*> subchannels_;
 
-    std::unique_ptr<Bucket> current_bucket_ = std::make_unique<Bucket>();
-    std::unique_ptr<Bucket> backup_bucket_ = std::make_unique<Bucket>();
-    // The bucket used to update call counts.
-    // Points to either current_bucket or active_bucket.
-    std::atomic<Bucket*> active_bucket_{current_bucket_.get()};
+    PerCpu<CallCounts> call_counts_{
+        PerCpuOptions().SetCpusPerShard(4).SetMaxShards(8)};
+    // The sums of call_counts_ at the last RotateBucket(), and the counts of
+    // the interval that it ended.
+    uint64_t total_successes_ = 0;
+    uint64_t total_failures_ = 0;
+    uint64_t interval_successes_ = 0;
+    uint64_t interval_failures_ = 0;
     uint32_t multiplier_ = 0;
     absl::optional<Timestamp> ejection_time_;
   };
@@ -872,10 +891,15 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
     LOG(INFO) << "[outlier_detection_lb " << parent_.get()
               << "] ejection timer running";
   }
-  std::map<EndpointState*, double> success_rate_ejection_candidates;
-  std::map<EndpointState*, double> failure_percentage_ejection_candidates;
+  // Candidates and their success rates, in the order of the endpoint map.
+  std::vector<std::pair<EndpointState*, double>>
+      success_rate_ejection_candidates;
+  std::vector<std::pair<EndpointState*, double>>
+      failure_percentage_ejection_candidates;
+  success_rate_ejection_candidates.reserve(parent_->endpoint_state_map_.size());
   size_t ejected_host_count = 0;
   double success_rate_sum = 0;
+  double success_rate_square_sum = 0;
   auto time_now = Timestamp::Now();
   auto& config = parent_->config_->outlier_detection_config();
   for (auto& state : parent_->endpoint_state_map_) {
@@ -897,14 +921,17 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
     uint64_t request_volume = host_success_rate_and_volume->second;
     if (config.success_rate_ejection.has_value()) {
       if (request_volume >= config.success_rate_ejection->request_volume) {
-        success_rate_ejection_candidates[endpoint_state] = success_rate;
+        success_rate_ejection_candidates.emplace_back(endpoint_state,
+                                                      success_rate);
         success_rate_sum += success_rate;
+        success_rate_square_sum += success_rate * success_rate;
       }
     }
     if (config.failure_percentage_ejection.has_value()) {
       if (request_volume >=
           config.failure_percentage_ejection->request_volume) {
-        failure_percentage_ejection_candidates[endpoint_state] = success_rate;
+        failure_percentage_ejection_candidates.emplace_back(endpoint_state,
+                                                            success_rate);
       }
     }
   }
@@ -930,12 +957,13 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
     }
     // calculate ejection threshold: (mean - stdev *
     // (success_rate_ejection.stdev_factor / 1000))
-    double mean = success_rate_sum / success_rate_ejection_candidates.size();
-    double variance = 0;
-    for (const auto& p : success_rate_ejection_candidates) {
-      variance += std::pow(p.second - mean, 2);
-    }
-    variance /= success_rate_ejection_candidates.size();
+    // The sums were gathered in the same pass as the candidates. Success
+    // rates are percentages, so computing the variance from them loses no
+    // meaningful precision; rounding can still make it slightly negative.
+    const double count = success_rate_ejection_candidates.size();
+    double mean = success_rate_sum / count;
+    double variance =
+        std::max(0.0, success_rate_square_sum / count - mean * mean);
     double stdev = std::sqrt(variance);
     const double success_rate_stdev_factor =
         static_cast<double>(config.success_rate_ejection->stdev_factor) / 1000;
@@ -19,6 +19,9 @@
 #include <inttypes.h>
 #include <string.h>
 
+#include <algorithm>
+#include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -27,6 +30,7 @@
 #include <vector>
 
 #include "absl/algorithm/container.h"
+#include "absl/base/thread_annotations.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
@@ -48,8 +52,10 @@
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/no_destruct.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/work_serializer.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -102,6 +108,43 @@ const auto kMetricConnectionAttemptsFailed =
         .Labels(kMetricLabelTarget)
         .Build();
 
+// Remembers, across channels, the address that pick_first last connected
+// to for each target.  Used when
+// GRPC_ARG_EXPERIMENTAL_PICK_FIRST_REMEMBER_CONNECTED_ADDRESS is set.
+class ConnectedAddressCache final {
+ public:
+  static ConnectedAddressCache* Get() {
+    static NoDestruct<ConnectedAddressCache> cache;
+    return cache.get();
+  }
+
+  void Set(absl::string_view target, const grpc_resolved_address& address) {
+    MutexLock lock(&mu_);
+    auto it = addresses_.find(target);
+    if (it != addresses_.end()) {
+      it->second = address;
+      return;
+    }
+    // Bound the memory used by processes creating channels to many targets.
+    if (addresses_.size() >= kMaxTargets) addresses_.erase(addresses_.begin());
+    addresses_.emplace(std::string(target), address);
+  }
+
+  absl::optional<grpc_resolved_address> Lookup(absl::string_view target) {
+    MutexLock lock(&mu_);
+    auto it = addresses_.find(target);
+    if (it == addresses_.end()) return absl::nullopt;
+    return it->second;
+  }
+
+ private:
+  static constexpr size_t kMaxTargets = 1024;
+
+  Mutex mu_;
+  std::map<std::string, grpc_resolved_address, std::less<>> addresses_
+      ABSL_GUARDED_BY(mu_);
+};
+
 class PickFirstConfig final : public LoadBalancingPolicy::Config {
  public:
   absl::string_view name() const override { return kPickFirst; }
@@ -206,8 +249,11 @@ class PickFirst final : public LoadBalancingPolicy {
       };
 
       SubchannelData(SubchannelList* subchannel_list, size_t index,
+                     const grpc_resolved_address& address,
                      RefCountedPtr<SubchannelInterface> subchannel);
 
+      const grpc_resolved_address& address() const { return address_; }
+
       absl::optional<grpc_connectivity_state> connectivity_state() const {
         return connectivity_state_;
       }
@@ -238,6 +284,7 @@ class PickFirst final : public LoadBalancingPolicy {
       SubchannelList* subchannel_list_;
       // Our index within subchannel_list_.
       const size_t index_;
+      const grpc_resolved_address address_;
       // Subchannel state.
       OrphanablePtr<SubchannelState> subchannel_state_;
       // Data updated by the watcher.
@@ -363,6 +410,10 @@ class PickFirst final : public LoadBalancingPolicy {
 
   void AttemptToConnectUsingLatestUpdateArgsLocked();
 
+  // Moves the address last connected to for the target, if in the list of
+  // flattened endpoints, to the front of it.
+  void MoveConnectedAddressToFront(EndpointAddressesList* endpoints);
+
   void UnsetSelectedSubchannel();
 
   void GoIdle();
@@ -381,6 +432,8 @@ class PickFirst final : public LoadBalancingPolicy {
   const bool omit_status_message_prefix_;
   // Connection Attempt Delay for Happy Eyeballs.
   const Duration connection_attempt_delay_;
+  // Whether to try first the address last connected to for the target.
+  const bool remember_connected_address_;
 
   // Lateset update args.
   UpdateArgs latest_update_args_;
@@ -419,7 +472,12 @@ PickFirst::PickFirst(Args args)
           Clamp(channel_args()
                     .GetInt(GRPC_ARG_HAPPY_EYEBALLS_CONNECTION_ATTEMPT_DELAY_MS)
                     .value_or(250),
-                100, 2000))) {
+                100, 2000))),
+      remember_connected_address_(
+          channel_args()
+              .GetBool(
+                  GRPC_ARG_EXPERIMENTAL_PICK_FIRST_REMEMBER_CONNECTED_ADDRESS)
+              .value_or(false)) {
   if (GRPC_TRACE_FLAG_ENABLED(pick_first)) {
     LOG(INFO) << "Pick First " << this << " created.";
   }
@@ -542,24 +600,28 @@ absl::Status PickFirst::UpdateLocked(UpdateArgs args) {
         absl::c_shuffle(endpoints, bit_gen_);
       }
       // Flatten the list so that we have one address per endpoint.
-      // While we're iterating, also determine the desired address family
-      // order and the index of the first element of each family, for use in
-      // the interleaving below.
-      std::set<absl::string_view> address_families;
-      std::vector<AddressFamilyIterator> address_family_order;
       EndpointAddressesList flattened_endpoints;
       for (const auto& endpoint : endpoints) {
         for (const auto& address : endpoint.addresses()) {
           flattened_endpoints.emplace_back(address, endpoint.args());
-          absl::string_view scheme = GetAddressFamily(address);
-          bool inserted = address_families.insert(scheme).second;
-          if (inserted) {
-            address_family_order.emplace_back(scheme,
-                                              flattened_endpoints.size() - 1);
-          }
         }
       }
       endpoints = std::move(flattened_endpoints);
+      // Try first the address that a channel to the same target last
+      // connected to, which also puts its address family first.  Not done
+      // when shuffling, as it would send all channels to the same address.
+      if (remember_connected_address_ && !config->shuffle_addresses()) {
+        MoveConnectedAddressToFront(&endpoints);
+      }
+      // Determine the desired address family order and the index of the
+      // first element of each family, for use in the interleaving below.
+      std::set<absl::string_view> address_families;
+      std::vector<AddressFamilyIterator> address_family_order;
+      for (size_t i = 0; i < endpoints.size(); ++i) {
+        absl::string_view scheme = GetAddressFamily(endpoints[i].address());
+        bool inserted = address_families.insert(scheme).second;
+        if (inserted) address_family_order.emplace_back(scheme, i);
+      }
       // Interleave addresses as per RFC-8305 section 4.
       EndpointAddressesList interleaved_endpoints;
       interleaved_endpoints.reserve(endpoints.size());
@@ -594,6 +656,26 @@ absl::Status PickFirst::UpdateLocked(UpdateArgs args) {
   return status;
 }
 
+void PickFirst::MoveConnectedAddressToFront(EndpointAddressesList* endpoints) {
+  absl::optional<grpc_resolved_address> connected =
+      ConnectedAddressCache::Get()->Lookup(
+          channel_control_helper()->GetTarget());
+  if (!connected.has_value()) return;
+  auto it = std::find_if(
+      endpoints->begin(), endpoints->end(),
+      [&](const EndpointAddresses& endpoint) {
+        const grpc_resolved_address& address = endpoint.address();
+        return address.len == connected->len &&
+               memcmp(address.addr, connected->addr, address.len) == 0;
+      });
+  if (it == endpoints->end() || it == endpoints->begin()) return;
+  if (GRPC_TRACE_FLAG_ENABLED(pick_first)) {
+    LOG(INFO) << "Pick First " << this << " trying first " << it->ToString()
+              << ", last connected to for the target";
+  }
+  std::rotate(endpoints->begin(), it, it + 1);
+}
+
 void PickFirst::UpdateState(grpc_connectivity_state state,
                             const absl::Status& status,
                             RefCountedPtr<SubchannelPicker> picker) {
@@ -703,6 +785,11 @@ void PickFirst::SubchannelList::SubchannelData::SubchannelState::Select() {
   CHECK_NE(subchannel_data_, nullptr);
   pick_first_->UnsetSelectedSubchannel();  // Cancel health watch, if any.
   pick_first_->selected_ = std::move(subchannel_data_->subchannel_state_);
+  if (pick_first_->remember_connected_address_) {
+    ConnectedAddressCache::Get()->Set(
+        pick_first_->channel_control_helper()->GetTarget(),
+        subchannel_data_->address());
+  }
   // If health checking is enabled, start the health watch, but don't
   // report a new picker -- we want to stay in CONNECTING while we wait
   // for the health status notification.
@@ -791,8 +878,9 @@ void PickFirst::SubchannelList::SubchannelData::SubchannelState::
 
 PickFirst::SubchannelList::SubchannelData::SubchannelData(
     SubchannelList* subchannel_list, size_t index,
+    const grpc_resolved_address& address,
     RefCountedPtr<SubchannelInterface> subchannel)
-    : subchannel_list_(subchannel_list), index_(index) {
+    : subchannel_list_(subchannel_list), index_(index), address_(address) {
   if (GRPC_TRACE_FLAG_ENABLED(pick_first)) {
     LOG(INFO) << "[PF " << subchannel_list_->policy_.get()
               << "] subchannel list " << subchannel_list_ << " index " << index_
@@ -1032,7 +1120,7 @@ PickFirst::SubchannelList::SubchannelList(RefCountedPtr<PickFirst> policy,
                 << subchannel.get() << " for address " << address.ToString();
     }
     subchannels_.emplace_back(std::make_unique<SubchannelData>(
-        this, subchannels_.size(), std::move(subchannel)));
+        this, subchannels_.size(), address.address(), std::move(subchannel)));
   });
 }
 
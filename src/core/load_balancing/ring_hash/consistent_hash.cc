@@ -0,0 +1,257 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/ring_hash/consistent_hash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/xxhash_inline.h"
+
+namespace grpc_core {
+
+//
+// HashRing
+//
+
+HashRing::HashRing(absl::Span<const ConsistentHashEndpoint> endpoints,
+                   size_t min_ring_size, size_t max_ring_size,
+                   const HashRing* previous) {
+  size_t sum = 0;
+  for (const auto& endpoint : endpoints) sum += endpoint.weight;
+  // Calculating normalized weights and find min and max.
+  std::vector<double> normalized_weights;
+  normalized_weights.reserve(endpoints.size());
+  double min_normalized_weight = 1.0;
+  double max_normalized_weight = 0.0;
+  for (const auto& endpoint : endpoints) {
+    const double normalized_weight =
+        static_cast<double>(endpoint.weight) / sum;
+    normalized_weights.push_back(normalized_weight);
+    min_normalized_weight = std::min(normalized_weight, min_normalized_weight);
+    max_normalized_weight = std::max(normalized_weight, max_normalized_weight);
+  }
+  // Scale up the number of hashes per host such that the least-weighted host
+  // gets a whole number of hashes on the ring. Other hosts might not end up
+  // with whole numbers, and that's fine (the ring-building algorithm below can
+  // handle this). This preserves the original implementation's behavior: when
+  // weights aren't provided, all hosts should get an equal number of hashes. In
+  // the case where this number exceeds the max_ring_size, it's scaled back down
+  // to fit.
+  const double scale = std::min(
+      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
+      static_cast<double>(max_ring_size));
+  // Find the number of hashes for each host by walking through the (host,
+  // weight) pairs and generating (scale * weight) hashes for each host.
+  // Since these aren't necessarily whole numbers, we maintain running sums
+  // -- current_hashes and target_hashes -- which allows us to populate the
+  // ring in a mostly stable way. The i-th hash of a host is the hash of
+  // "<key>_<i>", so it does not depend on the other hosts.
+  keys_.reserve(endpoints.size());
+  point_counts_.reserve(endpoints.size());
+  double current_hashes = 0.0;
+  double target_hashes = 0.0;
+  size_t ring_size = 0;
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    keys_.push_back(endpoints[i].key);
+    target_hashes += scale * normalized_weights[i];
+    uint32_t count = 0;
+    while (current_hashes < target_hashes) {
+      ++count;
+      ++current_hashes;
+    }
+    point_counts_.push_back(count);
+    ring_size += count;
+  }
+  // Keep the entries of the previous ring that are still wanted, so that
+  // only the hashes of added endpoints, or of endpoints whose count grew,
+  // need to be computed and sorted. Endpoints are matched by key; if
+  // several share a key, only the first one of each ring is matched, and
+  // the others are hashed again. When the ring has fewer entries than there
+  // are endpoints, matching costs more than it saves.
+  std::vector<uint32_t> first_new_point(endpoints.size(), 0);
+  std::vector<RingEntry> kept;
+  if (previous != nullptr && ring_size > keys_.size()) {
+    constexpr uint32_t kRemoved = UINT32_MAX;
+    std::vector<uint32_t> new_index(previous->keys_.size(), kRemoved);
+    if (previous->keys_ == keys_) {
+      // Only weights changed, which is the common case.
+      for (size_t i = 0; i < keys_.size(); ++i) new_index[i] = i;
+    } else {
+      absl::flat_hash_map<absl::string_view, uint32_t> index_by_key;
+      index_by_key.reserve(keys_.size());
+      for (size_t i = 0; i < keys_.size(); ++i) {
+        index_by_key.emplace(keys_[i], i);
+      }
+      std::vector<bool> matched(endpoints.size(), false);
+      for (size_t i = 0; i < previous->keys_.size(); ++i) {
+        auto it = index_by_key.find(previous->keys_[i]);
+        if (it == index_by_key.end() || matched[it->second]) continue;
+        matched[it->second] = true;
+        new_index[i] = it->second;
+      }
+    }
+    for (size_t i = 0; i < new_index.size(); ++i) {
+      if (new_index[i] == kRemoved) continue;
+      first_new_point[new_index[i]] =
+          std::min(previous->point_counts_[i], point_counts_[new_index[i]]);
+    }
+    kept.reserve(ring_size);
+    for (const RingEntry& entry : previous->ring_) {
+      const uint32_t index = new_index[entry.endpoint_index];
+      if (index == kRemoved || entry.point >= point_counts_[index]) continue;
+      kept.push_back({entry.hash, index, entry.point});
+    }
+  }
+  std::vector<RingEntry> added;
+  added.reserve(ring_size - kept.size());
+  absl::InlinedVector<char, 196> hash_key_buffer;
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    const std::string& address_string = keys_[i];
+    hash_key_buffer.assign(address_string.begin(), address_string.end());
+    hash_key_buffer.emplace_back('_');
+    auto offset_start = hash_key_buffer.end();
+    for (uint32_t point = first_new_point[i]; point < point_counts_[i];
+         ++point) {
+      const std::string count_str = absl::StrCat(point);
+      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
+      absl::string_view hash_key(hash_key_buffer.data(),
+                                 hash_key_buffer.size());
+      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
+      added.push_back({hash, static_cast<uint32_t>(i), point});
+      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
+    }
+  }
+  // Ties are broken by endpoint, so that updating a ring gives the same
+  // order as building it from scratch.
+  auto by_hash = [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
+    return std::tie(lhs.hash, lhs.endpoint_index, lhs.point) <
+           std::tie(rhs.hash, rhs.endpoint_index, rhs.point);
+  };
+  std::sort(added.begin(), added.end(), by_hash);
+  // Renumbering endpoints can only reorder entries with equal hashes.
+  if (!std::is_sorted(kept.begin(), kept.end(), by_hash)) {
+    std::sort(kept.begin(), kept.end(), by_hash);
+  }
+  if (kept.empty()) {
+    ring_ = std::move(added);
+    return;
+  }
+  ring_.resize(ring_size);
+  std::merge(kept.begin(), kept.end(), added.begin(), added.end(),
+             ring_.begin(), by_hash);
+}
+
+size_t HashRing::Find(uint64_t hash) const {
+  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
+  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
+  // for lowp, highp, and index. Do not change them!
+  int64_t lowp = 0;
+  int64_t highp = ring_.size();
+  int64_t index = 0;
+  while (true) {
+    index = (lowp + highp) / 2;
+    if (index == static_cast<int64_t>(ring_.size())) return 0;
+    uint64_t midval = ring_[index].hash;
+    uint64_t midval1 = index == 0 ? 0 : ring_[index - 1].hash;
+    if (hash <= midval && hash > midval1) return index;
+    if (midval < hash) {
+      lowp = index + 1;
+    } else {
+      highp = index - 1;
+    }
+    if (lowp > highp) return 0;
+  }
+}
+
+//
+// MaglevTable
+//
+
+constexpr uint64_t MaglevTable::kDefaultTableSize;
+constexpr uint64_t MaglevTable::kMaxTableSize;
+
+MaglevTable::MaglevTable(absl::Span<const ConsistentHashEndpoint> endpoints,
+                         uint64_t table_size) {
+  DCHECK(IsValidTableSize(table_size));
+  if (endpoints.empty()) return;
+  // Each endpoint walks its own permutation of the table, given by an offset
+  // and a skip derived from its key. As in Envoy, an endpoint with the
+  // highest weight takes an entry in every round, and an endpoint with a
+  // third of that weight in every third round.
+  struct BuildEntry {
+    uint64_t position;
+    uint64_t skip;
+    double weight;
+    double target_weight;
+  };
+  std::vector<BuildEntry> build_entries;
+  build_entries.reserve(endpoints.size());
+  size_t sum = 0;
+  for (const auto& endpoint : endpoints) sum += endpoint.weight;
+  double max_normalized_weight = 0.0;
+  for (const auto& endpoint : endpoints) {
+    const uint64_t offset =
+        XXH64(endpoint.key.data(), endpoint.key.size(), 0) % table_size;
+    const uint64_t skip =
+        XXH64(endpoint.key.data(), endpoint.key.size(), 1) % (table_size - 1) +
+        1;
+    const double weight = static_cast<double>(endpoint.weight) / sum;
+    max_normalized_weight = std::max(weight, max_normalized_weight);
+    build_entries.push_back({offset, skip, weight, 0.0});
+  }
+  constexpr uint32_t kUnset = UINT32_MAX;
+  table_.assign(table_size, kUnset);
+  uint64_t filled = 0;
+  for (uint64_t round = 1; filled < table_size; ++round) {
+    for (size_t i = 0; i < build_entries.size() && filled < table_size; ++i) {
+      BuildEntry& entry = build_entries[i];
+      if (round * entry.weight < entry.target_weight) continue;
+      entry.target_weight += max_normalized_weight;
+      // position and skip are both below table_size, so stepping needs no
+      // division.
+      auto step = [&]() {
+        entry.position += entry.skip;
+        if (entry.position >= table_size) entry.position -= table_size;
+      };
+      while (table_[entry.position] != kUnset) step();
+      table_[entry.position] = i;
+      step();
+      ++filled;
+    }
+  }
+}
+
+bool MaglevTable::IsValidTableSize(uint64_t table_size) {
+  if (table_size < 2 || table_size > kMaxTableSize) return false;
+  for (uint64_t divisor = 2; divisor * divisor <= table_size; ++divisor) {
+    if (table_size % divisor == 0) return false;
+  }
+  return true;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,115 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_CONSISTENT_HASH_H
+#define GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_CONSISTENT_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include <grpc/support/port_platform.h>
+
+namespace grpc_core {
+
+// The lookups below map a request hash to a position, and each position to
+// an endpoint. When the endpoint at a position cannot be used, callers walk
+// the following positions (wrapping around) until they find one that can.
+
+// An endpoint to build a lookup for.
+struct ConsistentHashEndpoint {
+  // Hashed to place the endpoint; usually its first address.
+  std::string key;
+  // Must be non-zero.
+  uint32_t weight = 1;
+};
+
+// A ketama-style hash ring: each endpoint is hashed onto the ring a number of
+// times proportional to its weight, and a request goes to the first entry at
+// or after its hash. Picks are a binary search over the ring.
+class HashRing {
+ public:
+  // If \a previous is set, the entries it shares with the new ring are
+  // copied from it rather than hashed and sorted again: the cost of the
+  // update is then linear in the ring size, plus the cost of hashing and
+  // sorting the entries of the endpoints that were added or got more.
+  HashRing(absl::Span<const ConsistentHashEndpoint> endpoints,
+           size_t min_ring_size, size_t max_ring_size,
+           const HashRing* previous = nullptr);
+
+  size_t size() const { return ring_.size(); }
+
+  // Returns the position for \a hash.
+  size_t Find(uint64_t hash) const;
+
+  // Returns the index in the endpoints the ring was built from of the
+  // endpoint at \a position.
+  size_t endpoint_index(size_t position) const {
+    return ring_[position].endpoint_index;
+  }
+
+ private:
+  struct RingEntry {
+    uint64_t hash;
+    uint32_t endpoint_index;
+    // Which of the endpoint's hashes this is.
+    uint32_t point;
+  };
+
+  std::vector<RingEntry> ring_;
+  // For each endpoint, its key and its number of entries.
+  std::vector<std::string> keys_;
+  std::vector<uint32_t> point_counts_;
+};
+
+// A Maglev lookup table (Eisenbud et al., "Maglev: A Fast and Reliable
+// Software Network Load Balancer", NSDI 2016), as in Envoy's MAGLEV policy:
+// each endpoint fills table entries in the order of its own permutation of
+// the table, as many as its weight allows. Picks are a single lookup, and
+// adding or removing an endpoint only moves a small share of the entries
+// owned by the others.
+class MaglevTable {
+ public:
+  static constexpr uint64_t kDefaultTableSize = 65537;
+  static constexpr uint64_t kMaxTableSize = 5000011;
+
+  // \a table_size must be prime.
+  MaglevTable(absl::Span<const ConsistentHashEndpoint> endpoints,
+              uint64_t table_size);
+
+  // Returns true if \a table_size is a valid table size.
+  static bool IsValidTableSize(uint64_t table_size);
+
+  size_t size() const { return table_.size(); }
+
+  // Returns the position for \a hash.
+  size_t Find(uint64_t hash) const { return hash % table_.size(); }
+
+  // Returns the index in the endpoints the table was built from of the
+  // endpoint at \a position.
+  size_t endpoint_index(size_t position) const { return table_[position]; }
+
+ private:
+  std::vector<uint32_t> table_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LOAD_BALANCING_RING_HASH_CONSISTENT_HASH_H
@@ -20,7 +20,6 @@
 #include <stdlib.h>
 
 #include <algorithm>
-#include <cmath>
 #include <map>
 #include <memory>
 #include <string>
@@ -28,7 +27,6 @@
 #include <vector>
 
 #include "absl/base/attributes.h"
-#include "absl/container/inlined_vector.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
@@ -36,6 +34,7 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
+#include "absl/types/variant.h"
 
 #include <grpc/impl/channel_arg_names.h>
 #include <grpc/impl/connectivity_state.h>
@@ -54,7 +53,6 @@
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/gprpp/work_serializer.h"
-#include "src/core/lib/gprpp/xxhash_inline.h"
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
@@ -66,6 +64,7 @@
 #include "src/core/load_balancing/lb_policy_factory.h"
 #include "src/core/load_balancing/lb_policy_registry.h"
 #include "src/core/load_balancing/pick_first/pick_first.h"
+#include "src/core/load_balancing/ring_hash/consistent_hash.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/json/json.h"
 
@@ -111,18 +110,49 @@ void RingHashConfig::JsonPostLoad(const Json&, const JsonArgs&,
 namespace {
 
 constexpr absl::string_view kRingHash = "ring_hash_experimental";
+constexpr absl::string_view kMaglev = "maglev_experimental";
 
+struct MaglevConfig {
+  uint64_t table_size = MaglevTable::kDefaultTableSize;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader = JsonObjectLoader<MaglevConfig>()
+                                    .OptionalField("tableSize",
+                                                   &MaglevConfig::table_size)
+                                    .Finish();
+    return loader;
+  }
+
+  void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors) {
+    ValidationErrors::ScopedField field(errors, ".tableSize");
+    if (!errors->FieldHasErrors() &&
+        !MaglevTable::IsValidTableSize(table_size)) {
+      errors->AddError(absl::StrCat("must be a prime number no larger than ",
+                                    MaglevTable::kMaxTableSize));
+    }
+  }
+};
+
+// Config for both ring_hash and maglev, which share the implementation
+// below and only differ in how they compute the ring.
 class RingHashLbConfig final : public LoadBalancingPolicy::Config {
  public:
   RingHashLbConfig(size_t min_ring_size, size_t max_ring_size)
       : min_ring_size_(min_ring_size), max_ring_size_(max_ring_size) {}
-  absl::string_view name() const override { return kRingHash; }
+  explicit RingHashLbConfig(uint64_t maglev_table_size)
+      : maglev_table_size_(maglev_table_size) {}
+  absl::string_view name() const override {
+    return maglev_table_size_ == 0 ? kRingHash : kMaglev;
+  }
   size_t min_ring_size() const { return min_ring_size_; }
   size_t max_ring_size() const { return max_ring_size_; }
+  // Non-zero for maglev.
+  uint64_t maglev_table_size() const { return maglev_table_size_; }
 
  private:
-  size_t min_ring_size_;
-  size_t max_ring_size_;
+  size_t min_ring_size_ = 0;
+  size_t max_ring_size_ = 0;
+  uint64_t maglev_table_size_ = 0;
 };
 
 //
@@ -133,28 +163,45 @@ constexpr size_t kRingSizeCapDefault = 4096;
 
 class RingHash final : public LoadBalancingPolicy {
  public:
-  explicit RingHash(Args args);
+  RingHash(Args args, absl::string_view name);
 
-  absl::string_view name() const override { return kRingHash; }
+  absl::string_view name() const override { return name_; }
 
   absl::Status UpdateLocked(UpdateArgs args) override;
   void ResetBackoffLocked() override;
 
  private:
-  // A ring computed based on a config and address list.
+  // A ring computed based on a config and address list: either a hash
+  // ring or, for maglev, a Maglev lookup table.
   class Ring final : public RefCounted<Ring> {
    public:
-    struct RingEntry {
-      uint64_t hash;
-      size_t endpoint_index;  // Index into RingHash::endpoints_.
-    };
-
     Ring(RingHash* ring_hash, RingHashLbConfig* config);
 
-    const std::vector<RingEntry>& ring() const { return ring_; }
+    size_t size() const {
+      return absl::visit([](const auto& ring) { return ring.size(); }, ring_);
+    }
+
+    // Returns the position on the ring to start the search for \a hash.
+    size_t Find(uint64_t hash) const {
+      return absl::visit([hash](const auto& ring) { return ring.Find(hash); },
+                         ring_);
+    }
+
+    // Returns the index into RingHash::endpoints_ of the endpoint at
+    // \a position.
+    size_t endpoint_index(size_t position) const {
+      return absl::visit(
+          [position](const auto& ring) {
+            return ring.endpoint_index(position);
+          },
+          ring_);
+    }
 
    private:
-    std::vector<RingEntry> ring_;
+    static absl::variant<HashRing, MaglevTable> Build(
+        RingHash* ring_hash, RingHashLbConfig* config);
+
+    absl::variant<HashRing, MaglevTable> ring_;
   };
 
   // State for a particular endpoint.  Delegates to a pick_first child policy.
@@ -292,6 +339,8 @@ class RingHash final : public LoadBalancingPolicy {
 
   // indicating if we are shutting down.
   bool shutdown_ = false;
+
+  const absl::string_view name_;
 };
 
 //
@@ -305,39 +354,13 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
     return PickResult::Fail(absl::InternalError("hash attribute not present"));
   }
   uint64_t request_hash = hash_attribute->request_hash();
-  const auto& ring = ring_->ring();
   // Find the index in the ring to use for this RPC.
-  // Ported from https://github.com/RJ/ketama/blob/master/libketama/ketama.c
-  // (ketama_get_server) NOTE: The algorithm depends on using signed integers
-  // for lowp, highp, and index. Do not change them!
-  int64_t lowp = 0;
-  int64_t highp = ring.size();
-  int64_t index = 0;
-  while (true) {
-    index = (lowp + highp) / 2;
-    if (index == static_cast<int64_t>(ring.size())) {
-      index = 0;
-      break;
-    }
-    uint64_t midval = ring[index].hash;
-    uint64_t midval1 = index == 0 ? 0 : ring[index - 1].hash;
-    if (request_hash <= midval && request_hash > midval1) {
-      break;
-    }
-    if (midval < request_hash) {
-      lowp = index + 1;
-    } else {
-      highp = index - 1;
-    }
-    if (lowp > highp) {
-      index = 0;
-      break;
-    }
-  }
+  const size_t index = ring_->Find(request_hash);
   // Find the first endpoint we can use from the selected index.
-  for (size_t i = 0; i < ring.size(); ++i) {
-    const auto& entry = ring[(index + i) % ring.size()];
-    const auto& endpoint_info = endpoints_[entry.endpoint_index];
+  const size_t ring_size = ring_->size();
+  for (size_t i = 0; i < ring_size; ++i) {
+    const auto& endpoint_info =
+        endpoints_[ring_->endpoint_index((index + i) % ring_size)];
     switch (endpoint_info.state) {
       case GRPC_CHANNEL_READY:
         return endpoint_info.picker->Pick(args);
@@ -354,105 +377,50 @@ RingHash::PickResult RingHash::Picker::Pick(PickArgs args) {
   }
   return PickResult::Fail(absl::UnavailableError(absl::StrCat(
       "ring hash cannot find a connected endpoint; first failure: ",
-      endpoints_[ring[index].endpoint_index].status.message())));
+      endpoints_[ring_->endpoint_index(index)].status.message())));
 }
 
 //
 // RingHash::Ring
 //
 
-RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config) {
-  // Store the weights while finding the sum.
-  struct EndpointWeight {
-    std::string address;  // Key by endpoint's first address.
-    // Default weight is 1 for the cases where a weight is not provided,
-    // each occurrence of the address will be counted a weight value of 1.
-    uint32_t weight = 1;
-    double normalized_weight;
-  };
-  std::vector<EndpointWeight> endpoint_weights;
-  size_t sum = 0;
+RingHash::Ring::Ring(RingHash* ring_hash, RingHashLbConfig* config)
+    : ring_(Build(ring_hash, config)) {}
+
+absl::variant<HashRing, MaglevTable> RingHash::Ring::Build(
+    RingHash* ring_hash, RingHashLbConfig* config) {
   const EndpointAddressesList& endpoints = ring_hash->endpoints_;
-  endpoint_weights.reserve(endpoints.size());
+  std::vector<ConsistentHashEndpoint> hash_endpoints;
+  hash_endpoints.reserve(endpoints.size());
   for (const auto& endpoint : endpoints) {
-    EndpointWeight endpoint_weight;
-    endpoint_weight.address =
+    ConsistentHashEndpoint hash_endpoint;
+    // Key by endpoint's first address.
+    hash_endpoint.key =
         grpc_sockaddr_to_string(&endpoint.addresses().front(), false).value();
     // Weight should never be zero, but ignore it just in case, since
     // that value would screw up the ring-building algorithm.
     auto weight_arg = endpoint.args().GetInt(GRPC_ARG_ADDRESS_WEIGHT);
     if (weight_arg.value_or(0) > 0) {
-      endpoint_weight.weight = *weight_arg;
+      hash_endpoint.weight = *weight_arg;
     }
-    sum += endpoint_weight.weight;
-    endpoint_weights.push_back(std::move(endpoint_weight));
-  }
-  // Calculating normalized weights and find min and max.
-  double min_normalized_weight = 1.0;
-  double max_normalized_weight = 0.0;
-  for (auto& endpoint_weight : endpoint_weights) {
-    endpoint_weight.normalized_weight =
-        static_cast<double>(endpoint_weight.weight) / sum;
-    min_normalized_weight =
-        std::min(endpoint_weight.normalized_weight, min_normalized_weight);
-    max_normalized_weight =
-        std::max(endpoint_weight.normalized_weight, max_normalized_weight);
-  }
-  // Scale up the number of hashes per host such that the least-weighted host
-  // gets a whole number of hashes on the ring. Other hosts might not end up
-  // with whole numbers, and that's fine (the ring-building algorithm below can
-  // handle this). This preserves the original implementation's behavior: when
-  // weights aren't provided, all hosts should get an equal number of hashes. In
-  // the case where this number exceeds the max_ring_size, it's scaled back down
-  // to fit.
+    hash_endpoints.push_back(std::move(hash_endpoint));
+  }
+  if (config->maglev_table_size() != 0) {
+    return MaglevTable(hash_endpoints, config->maglev_table_size());
+  }
   const size_t ring_size_cap =
       ring_hash->args_.GetInt(GRPC_ARG_RING_HASH_LB_RING_SIZE_CAP)
           .value_or(kRingSizeCapDefault);
-  const size_t min_ring_size = std::min(config->min_ring_size(), ring_size_cap);
-  const size_t max_ring_size = std::min(config->max_ring_size(), ring_size_cap);
-  const double scale = std::min(
-      std::ceil(min_normalized_weight * min_ring_size) / min_normalized_weight,
-      static_cast<double>(max_ring_size));
-  // Reserve memory for the entire ring up front.
-  const uint64_t ring_size = std::ceil(scale);
-  ring_.reserve(ring_size);
-  // Populate the hash ring by walking through the (host, weight) pairs in
-  // normalized_host_weights, and generating (scale * weight) hashes for each
-  // host. Since these aren't necessarily whole numbers, we maintain running
-  // sums -- current_hashes and target_hashes -- which allows us to populate the
-  // ring in a mostly stable way.
-  absl::InlinedVector<char, 196> hash_key_buffer;
-  double current_hashes = 0.0;
-  double target_hashes = 0.0;
-  uint64_t min_hashes_per_host = ring_size;
-  uint64_t max_hashes_per_host = 0;
-  for (size_t i = 0; i < endpoints.size(); ++i) {
-    const std::string& address_string = endpoint_weights[i].address;
-    hash_key_buffer.assign(address_string.begin(), address_string.end());
-    hash_key_buffer.emplace_back('_');
-    auto offset_start = hash_key_buffer.end();
-    target_hashes += scale * endpoint_weights[i].normalized_weight;
-    size_t count = 0;
-    while (current_hashes < target_hashes) {
-      const std::string count_str = absl::StrCat(count);
-      hash_key_buffer.insert(offset_start, count_str.begin(), count_str.end());
-      absl::string_view hash_key(hash_key_buffer.data(),
-                                 hash_key_buffer.size());
-      const uint64_t hash = XXH64(hash_key.data(), hash_key.size(), 0);
-      ring_.push_back({hash, i});
-      ++count;
-      ++current_hashes;
-      hash_key_buffer.erase(offset_start, hash_key_buffer.end());
-    }
-    min_hashes_per_host =
-        std::min(static_cast<uint64_t>(i), min_hashes_per_host);
-    max_hashes_per_host =
-        std::max(static_cast<uint64_t>(i), max_hashes_per_host);
-  }
-  std::sort(ring_.begin(), ring_.end(),
-            [](const RingEntry& lhs, const RingEntry& rhs) -> bool {
-              return lhs.hash < rhs.hash;
-            });
+  // Start from the current ring, if any, so that only the entries of the
+  // endpoints that changed are computed again. Pickers keep using the
+  // current ring until the new one is swapped in.
+  const HashRing* previous = nullptr;
+  if (ring_hash->ring_ != nullptr) {
+    previous = absl::get_if<HashRing>(&ring_hash->ring_->ring_);
+  }
+  return HashRing(hash_endpoints,
+                  std::min(config->min_ring_size(), ring_size_cap),
+                  std::min(config->max_ring_size(), ring_size_cap), previous);
 }
 
 //
@@ -596,7 +564,8 @@ void RingHash::RingHashEndpoint::OnStateUpdate(
 // RingHash
 //
 
-RingHash::RingHash(Args args) : LoadBalancingPolicy(std::move(args)) {
+RingHash::RingHash(Args args, absl::string_view name)
+    : LoadBalancingPolicy(std::move(args)), name_(name) {
   if (GRPC_TRACE_FLAG_ENABLED(ring_hash_lb)) {
     LOG(INFO) << "[RH " << this << "] Created";
   }
@@ -862,7 +831,7 @@ class RingHashFactory final : public LoadBalancingPolicyFactory {
  public:
   OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
       LoadBalancingPolicy::Args args) const override {
-    return MakeOrphanable<RingHash>(std::move(args));
+    return MakeOrphanable<RingHash>(std::move(args), kRingHash);
   }
 
   absl::string_view name() const override { return kRingHash; }
@@ -877,11 +846,31 @@ class RingHashFactory final : public LoadBalancingPolicyFactory {
   }
 };
 
+class MaglevFactory final : public LoadBalancingPolicyFactory {
+ public:
+  OrphanablePtr<LoadBalancingPolicy> CreateLoadBalancingPolicy(
+      LoadBalancingPolicy::Args args) const override {
+    return MakeOrphanable<RingHash>(std::move(args), kMaglev);
+  }
+
+  absl::string_view name() const override { return kMaglev; }
+
+  absl::StatusOr<RefCountedPtr<LoadBalancingPolicy::Config>>
+  ParseLoadBalancingConfig(const Json& json) const override {
+    auto config = LoadFromJson<MaglevConfig>(
+        json, JsonArgs(), "errors validating maglev LB policy config");
+    if (!config.ok()) return config.status();
+    return MakeRefCounted<RingHashLbConfig>(config->table_size);
+  }
+};
+
 }  // namespace
 
 void RegisterRingHashLbPolicy(CoreConfiguration::Builder* builder) {
   builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
       std::make_unique<RingHashFactory>());
+  builder->lb_policy_registry()->RegisterLoadBalancingPolicyFactory(
+      std::make_unique<MaglevFactory>());
 }
 
 }  // namespace grpc_core
@@ -74,6 +74,7 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/dual_ref_counted.h"
+#include "src/core/lib/gprpp/lock_profile.h"
 #include "src/core/lib/gprpp/match.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -509,6 +510,19 @@ class RlsLb final : public LoadBalancingPolicy {
       // Moves entry to the end of the LRU list.
       void MarkUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
+      // Marks the entry as used without moving it in the LRU list, which
+      // is cheap enough for every pick: eviction gives the entry a second
+      // chance instead.
+      void MarkRecentlyUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        if (!recently_used_) recently_used_ = true;
+      }
+
+      // Returns true if the entry was marked as recently used, and clears
+      // the mark.
+      bool TakeRecentlyUsed() ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_) {
+        return std::exchange(recently_used_, false);
+      }
+
      private:
       class BackoffTimer final : public InternallyRefCounted<BackoffTimer> {
        public:
@@ -551,13 +565,14 @@ class RlsLb final : public LoadBalancingPolicy {
 
       Timestamp min_expiration_time_ ABSL_GUARDED_BY(&RlsLb::mu_);
       Cache::Iterator lru_iterator_ ABSL_GUARDED_BY(&RlsLb::mu_);
+      bool recently_used_ ABSL_GUARDED_BY(&RlsLb::mu_) = false;
     };
 
     explicit Cache(RlsLb* lb_policy);
 
     // Finds an entry from the cache that corresponds to a key. If an entry is
-    // not found, nullptr is returned. Otherwise, the entry is considered
-    // recently used and its order in the LRU list of the cache is updated.
+    // not found, nullptr is returned. Otherwise, the entry is marked as
+    // recently used, which eviction accounts for (CLOCK style).
     Entry* Find(const RequestKey& key)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&RlsLb::mu_);
 
@@ -1025,6 +1040,12 @@ std::map<std::string, std::string> BuildKeyMap(
   return key_map;
 }
 
+// Picks take the policy lock on every RPC, racing the cache updates.
+LockProfile* RlsLbPickerLockProfile() {
+  static LockProfile* profile = new LockProfile("rls_lb.mu");
+  return profile;
+}
+
 RlsLb::Picker::Picker(RefCountedPtr<RlsLb> lb_policy)
     : lb_policy_(std::move(lb_policy)), config_(lb_policy_->config_) {
   if (lb_policy_->default_child_policy_ != nullptr) {
@@ -1044,7 +1065,7 @@ LoadBalancingPolicy::PickResult RlsLb::Picker::Pick(PickArgs args) {
               << ": request keys: " << key.ToString();
   }
   Timestamp now = Timestamp::Now();
-  MutexLock lock(&lb_policy_->mu_);
+  ProfiledMutexLock lock(&lb_policy_->mu_, RlsLbPickerLockProfile());
   if (lb_policy_->is_shutdown_) {
     return PickResult::Fail(
         absl::UnavailableError("LB policy already shut down"));
@@ -1288,9 +1309,8 @@ bool RlsLb::Cache::Entry::CanEvict() const {
 
 void RlsLb::Cache::Entry::MarkUsed() {
   auto& lru_list = lb_policy_->cache_.lru_list_;
-  auto new_it = lru_list.insert(lru_list.end(), *lru_iterator_);
-  lru_list.erase(lru_iterator_);
-  lru_iterator_ = new_it;
+  lru_list.splice(lru_list.end(), lru_list, lru_iterator_);
+  recently_used_ = false;
 }
 
 std::vector<RlsLb::ChildPolicyWrapper*>
@@ -1389,7 +1409,7 @@ RlsLb::Cache::Cache(RlsLb* lb_policy) : lb_policy_(lb_policy) {
 RlsLb::Cache::Entry* RlsLb::Cache::Find(const RequestKey& key) {
   auto it = map_.find(key);
   if (it == map_.end()) return nullptr;
-  it->second->MarkUsed();
+  it->second->MarkRecentlyUsed();
   return it->second.get();
 }
 
@@ -1506,6 +1526,12 @@ void RlsLb::Cache::MaybeShrinkSize(size_t bytes) {
     if (GPR_UNLIKELY(lru_it == lru_list_.end())) break;
     auto map_it = map_.find(*lru_it);
     CHECK(map_it != map_.end());
+    // Entries used since they were last at the front of the list get a
+    // second chance. This terminates, since it clears their mark.
+    if (map_it->second->TakeRecentlyUsed()) {
+      lru_list_.splice(lru_list_.end(), lru_list_, lru_it);
+      continue;
+    }
     if (!map_it->second->CanEvict()) break;
     if (GRPC_TRACE_FLAG_ENABLED(rls_lb)) {
       LOG(INFO) << "[rlslb " << lb_policy_ << "] LRU eviction: removing entry "
@@ -73,6 +73,7 @@ class RoundRobin final : public LoadBalancingPolicy {
     RoundRobinEndpointList(RefCountedPtr<RoundRobin> round_robin,
                            EndpointAddressesIterator* endpoints,
                            const ChannelArgs& args,
+                           EndpointList* previous,
                            std::vector<std::string>* errors)
         : EndpointList(std::move(round_robin),
                        GRPC_TRACE_FLAG_ENABLED(round_robin)
@@ -84,7 +85,8 @@ class RoundRobin final : public LoadBalancingPolicy {
              return MakeOrphanable<RoundRobinEndpoint>(
                  std::move(endpoint_list), addresses, args,
                  policy<RoundRobin>()->work_serializer(), errors);
-           });
+           },
+           previous);
     }
 
    private:
@@ -260,10 +262,15 @@ absl::Status RoundRobin::UpdateLocked(UpdateArgs args) {
     LOG(INFO) << "[RR " << this << "] replacing previous pending child list "
               << latest_pending_endpoint_list_.get();
   }
+  // Unchanged endpoints take over their child policies from the most
+  // recent list.
+  EndpointList* previous = latest_pending_endpoint_list_ != nullptr
+                               ? latest_pending_endpoint_list_.get()
+                               : endpoint_list_.get();
   std::vector<std::string> errors;
   latest_pending_endpoint_list_ = MakeOrphanable<RoundRobinEndpointList>(
       RefAsSubclass<RoundRobin>(DEBUG_LOCATION, "RoundRobinEndpointList"),
-      addresses, args.args, &errors);
+      addresses, args.args, previous, &errors);
   // If the new list is empty, immediately promote it to
   // endpoint_list_ and report TRANSIENT_FAILURE.
   if (latest_pending_endpoint_list_->size() == 0) {
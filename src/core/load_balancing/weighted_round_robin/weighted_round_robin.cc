@@ -18,11 +18,13 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -50,6 +52,7 @@
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -367,6 +370,12 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
 
     void Orphaned() override;
 
+    // Counts the picks that may be using the scheduler, for each parity of
+    // epoch_.
+    struct alignas(GPR_CACHELINE_SIZE) ReaderShard {
+      std::array<std::atomic<intptr_t>, 2> readers{};
+    };
+
     // Returns the index into endpoints_ to be picked.
     size_t PickIndex();
 
@@ -375,15 +384,25 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
     void BuildSchedulerAndStartTimerLocked()
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&timer_mu_);
 
+    // Swaps the scheduler that picks use, and deletes the old one once no
+    // pick is using it any more.
+    void SwapScheduler(std::unique_ptr<StaticStrideScheduler> scheduler)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&timer_mu_);
+
     RefCountedPtr<WeightedRoundRobin> wrr_;
     RefCountedPtr<WeightedRoundRobinConfig> config_;
     std::vector<EndpointInfo> endpoints_;
 
-    Mutex scheduler_mu_;
-    std::shared_ptr<StaticStrideScheduler> scheduler_
-        ABSL_GUARDED_BY(&scheduler_mu_);
+    // Picks load the scheduler without taking a lock. A pick first adds
+    // itself to the reader count for the current epoch on its CPU's shard;
+    // a swap then advances the epoch and waits for the readers of the
+    // previous one to finish before deleting the old scheduler.
+    std::atomic<StaticStrideScheduler*> scheduler_{nullptr};
+    std::atomic<uint32_t> epoch_{0};
+    PerCpu<ReaderShard> reader_shards_{
+        PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 
-    Mutex timer_mu_ ABSL_ACQUIRED_BEFORE(&scheduler_mu_);
+    Mutex timer_mu_;
     absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
         timer_handle_ ABSL_GUARDED_BY(&timer_mu_);
 
@@ -418,8 +437,14 @@ class WeightedRoundRobin final : public LoadBalancingPolicy {
 
   absl::BitGen bit_gen_;
 
-  // Accessed by picker.
-  std::atomic<uint32_t> scheduler_state_{absl::Uniform<uint32_t>(bit_gen_)};
+  // Sequence for the scheduler, accessed by picker. Sharded so that
+  // concurrent picks on different CPUs do not bounce a cache line; each
+  // shard starts at a random point.
+  struct alignas(GPR_CACHELINE_SIZE) SchedulerState {
+    std::atomic<uint32_t> sequence{0};
+  };
+  PerCpu<SchedulerState> scheduler_state_{
+      PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 };
 
 //
@@ -568,6 +593,7 @@ WeightedRoundRobin::Picker::~Picker() {
     LOG(INFO) << "[WRR " << wrr_.get() << " picker " << this
               << "] destroying picker";
   }
+  delete scheduler_.load(std::memory_order_relaxed);
 }
 
 void WeightedRoundRobin::Picker::Orphaned() {
@@ -605,14 +631,24 @@ WeightedRoundRobin::PickResult WeightedRoundRobin::Picker::Pick(PickArgs args) {
 }
 
 size_t WeightedRoundRobin::Picker::PickIndex() {
-  // Grab a ref to the scheduler.
-  std::shared_ptr<StaticStrideScheduler> scheduler;
-  {
-    MutexLock lock(&scheduler_mu_);
-    scheduler = scheduler_;
+  // Register as a reader of the scheduler. If a swap advanced the epoch in
+  // the meantime, it may not wait for us: register again.
+  ReaderShard& shard = reader_shards_.this_cpu();
+  uint32_t epoch = epoch_.load(std::memory_order_acquire);
+  while (true) {
+    shard.readers[epoch & 1].fetch_add(1, std::memory_order_seq_cst);
+    const uint32_t current_epoch = epoch_.load(std::memory_order_seq_cst);
+    if (current_epoch == epoch) break;
+    shard.readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+    epoch = current_epoch;
   }
+  StaticStrideScheduler* scheduler =
+      scheduler_.load(std::memory_order_acquire);
   // If we have a scheduler, use it to do a WRR pick.
-  if (scheduler != nullptr) return scheduler->Pick();
+  absl::optional<size_t> index;
+  if (scheduler != nullptr) index = scheduler->Pick();
+  shard.readers[epoch & 1].fetch_sub(1, std::memory_order_release);
+  if (index.has_value()) return *index;
   // We don't have a scheduler (i.e., either all of the weights are 0 or
   // there is only one subchannel), so fall back to RR.
   return last_picked_index_.fetch_add(1) % endpoints_.size();
@@ -645,12 +681,14 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
     LOG(INFO) << "[WRR " << wrr_.get() << " picker " << this
               << "] new weights: " << absl::StrJoin(weights, " ");
   }
-  auto scheduler_or = StaticStrideScheduler::Make(
-      weights, [this]() { return wrr_->scheduler_state_.fetch_add(1); });
-  std::shared_ptr<StaticStrideScheduler> scheduler;
+  auto scheduler_or = StaticStrideScheduler::Make(weights, [this]() {
+    return wrr_->scheduler_state_.this_cpu().sequence.fetch_add(
+        1, std::memory_order_relaxed);
+  });
+  std::unique_ptr<StaticStrideScheduler> scheduler;
   if (scheduler_or.has_value()) {
     scheduler =
-        std::make_shared<StaticStrideScheduler>(std::move(*scheduler_or));
+        std::make_unique<StaticStrideScheduler>(std::move(*scheduler_or));
     if (GRPC_TRACE_FLAG_ENABLED(weighted_round_robin_lb)) {
       LOG(INFO) << "[WRR " << wrr_.get() << " picker " << this
                 << "] new scheduler: " << scheduler.get();
@@ -664,10 +702,7 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
                              {wrr_->channel_control_helper()->GetTarget()},
                              {wrr_->locality_name_});
   }
-  {
-    MutexLock lock(&scheduler_mu_);
-    scheduler_ = std::move(scheduler);
-  }
+  SwapScheduler(std::move(scheduler));
   // Start timer.
   if (GRPC_TRACE_FLAG_ENABLED(weighted_round_robin_lb)) {
     LOG(INFO) << "[WRR " << wrr_.get() << " picker " << this
@@ -699,6 +734,23 @@ void WeightedRoundRobin::Picker::BuildSchedulerAndStartTimerLocked() {
       });
 }
 
+void WeightedRoundRobin::Picker::SwapScheduler(
+    std::unique_ptr<StaticStrideScheduler> scheduler) {
+  StaticStrideScheduler* old_scheduler =
+      scheduler_.exchange(scheduler.release(), std::memory_order_acq_rel);
+  if (old_scheduler == nullptr) return;
+  // Picks that register from now on see the new epoch, and so the new
+  // scheduler. Wait for the ones registered for the old epoch, which only
+  // hold it for the duration of a scheduler pick.
+  const uint32_t old_epoch = epoch_.fetch_add(1, std::memory_order_seq_cst);
+  for (ReaderShard& shard : reader_shards_) {
+    while (shard.readers[old_epoch & 1].load(std::memory_order_seq_cst) != 0) {
+      std::this_thread::yield();
+    }
+  }
+  delete old_scheduler;
+}
+
 //
 // WeightedRoundRobin
 //
@@ -708,6 +760,10 @@ WeightedRoundRobin::WeightedRoundRobin(Args args)
       locality_name_(channel_args()
                          .GetString(GRPC_ARG_LB_WEIGHTED_TARGET_CHILD)
                          .value_or("")) {
+  for (SchedulerState& state : scheduler_state_) {
+    state.sequence.store(absl::Uniform<uint32_t>(bit_gen_),
+                         std::memory_order_relaxed);
+  }
   if (GRPC_TRACE_FLAG_ENABLED(weighted_round_robin_lb)) {
     LOG(INFO) << "[WRR " << this << "] Created -- locality_name=\""
               << std::string(locality_name_) << "\"";
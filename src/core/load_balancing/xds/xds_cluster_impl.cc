@@ -45,6 +45,7 @@
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/match.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/ref_counted_string.h"
@@ -91,20 +92,66 @@ class CircuitBreakerCallCounterMap final {
   using Key =
       std::pair<std::string /*cluster*/, std::string /*eds_service_name*/>;
 
+  // Calls in flight for one cluster, shared by every channel in the process.
+  // Starting and finishing a call only touches a per-cpu shard: each shard
+  // holds a few tokens leased from reserved_, so reserved_ is an upper bound
+  // on the calls in flight that changes once per lease rather than per call.
   class CallCounter final : public RefCounted<CallCounter> {
    public:
     explicit CallCounter(Key key) : key_(std::move(key)) {}
     ~CallCounter() override;
 
-    uint32_t Load() {
-      return concurrent_requests_.load(std::memory_order_seq_cst);
+    // Returns true if fewer than max_requests calls are in flight.
+    bool BelowLimit(uint32_t max_requests) {
+      int64_t reserved = reserved_.load(std::memory_order_acquire);
+      if (reserved < max_requests) return true;
+      // Close to the limit: take the tokens still sitting in the shards out
+      // of the estimate.
+      for (const Shard& shard : shards_) {
+        reserved -= shard.tokens.load(std::memory_order_relaxed);
+      }
+      return reserved < max_requests;
+    }
+
+    void Increment() {
+      Shard& shard = shards_.this_cpu();
+      int64_t tokens = shard.tokens.load(std::memory_order_relaxed);
+      while (tokens > 0) {
+        if (shard.tokens.compare_exchange_weak(tokens, tokens - 1,
+                                               std::memory_order_relaxed)) {
+          return;
+        }
+      }
+      // Reserve before handing out, so reserved_ never undercounts.
+      reserved_.fetch_add(kLeaseSize, std::memory_order_acq_rel);
+      shard.tokens.fetch_add(kLeaseSize - 1, std::memory_order_relaxed);
+    }
+
+    void Decrement() {
+      Shard& shard = shards_.this_cpu();
+      int64_t tokens = shard.tokens.fetch_add(1, std::memory_order_relaxed) + 1;
+      // Calls may finish on a different shard than they started on: hand
+      // surplus tokens back so they don't pile up here.
+      while (tokens > 2 * kLeaseSize) {
+        if (shard.tokens.compare_exchange_weak(tokens, tokens - kLeaseSize,
+                                               std::memory_order_relaxed)) {
+          reserved_.fetch_sub(kLeaseSize, std::memory_order_acq_rel);
+          return;
+        }
+      }
     }
-    uint32_t Increment() { return concurrent_requests_.fetch_add(1); }
-    void Decrement() { concurrent_requests_.fetch_sub(1); }
 
    private:
+    static constexpr int64_t kLeaseSize = 8;
+
+    struct alignas(GPR_CACHELINE_SIZE) Shard {
+      std::atomic<int64_t> tokens{0};
+    };
+
     Key key_;
-    std::atomic<uint32_t> concurrent_requests_{0};
+    // Calls in flight plus tokens held by the shards.
+    std::atomic<int64_t> reserved_{0};
+    PerCpu<Shard> shards_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
   };
 
   RefCountedPtr<CallCounter> GetOrCreate(const std::string& cluster,
@@ -435,7 +482,7 @@ LoadBalancingPolicy::PickResult XdsClusterImplLb::Picker::Pick(
   // counter for the current request until the channel calls the subchannel
   // call tracker's Start() method.  This means that we may wind up
   // allowing more concurrent requests than the configured limit.
-  if (call_counter_->Load() >= max_concurrent_requests_) {
+  if (!call_counter_->BelowLimit(max_concurrent_requests_)) {
     if (drop_stats_ != nullptr) drop_stats_->AddUncategorizedDrops();
     return PickResult::Drop(absl::UnavailableError("circuit breaker drop"));
   }
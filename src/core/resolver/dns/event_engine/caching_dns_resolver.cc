@@ -0,0 +1,277 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/resolver/dns/event_engine/caching_dns_resolver.h"
+
+#include <stddef.h>
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/functional/function_ref.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+
+// A result that is used after this fraction of its TTL has elapsed is
+// refreshed in the background.
+constexpr double kRefreshFraction = 0.8;
+// Expired entries are cleaned up once the cache holds more than this many.
+constexpr size_t kCleanupThreshold = 256;
+
+// Process-wide cache of the results of one kind of lookup.
+template <typename T>
+class DnsCache {
+ public:
+  using Result = absl::StatusOr<T>;
+  using Callback = absl::AnyInvocable<void(Result)>;
+  // Starts the lookup on the underlying resolver.
+  using StartLookupFn =
+      absl::FunctionRef<void(EventEngine::DNSResolver*, Callback)>;
+
+  static DnsCache& Get() {
+    static NoDestruct<DnsCache> cache;
+    return *cache;
+  }
+
+  void Lookup(const std::string& key, const void* owner,
+              const std::shared_ptr<EventEngine>& engine,
+              const std::string& dns_server,
+              const CachingDNSResolver::Options& options, Callback on_resolve,
+              StartLookupFn start_lookup) {
+    absl::optional<Result> cached;
+    {
+      MutexLock lock(&mu_);
+      Entry& entry = entries_[key];
+      const Timestamp now = Timestamp::Now();
+      if (entry.result.has_value() && now < entry.expiration) {
+        cached = *entry.result;
+        if (now >= entry.refresh_time && entry.resolver == nullptr) {
+          StartLookupLocked(key, &entry, engine, dns_server, options,
+                            start_lookup);
+        }
+      } else {
+        entry.waiters.push_back({owner, std::move(on_resolve)});
+        if (entry.resolver == nullptr) {
+          StartLookupLocked(key, &entry, engine, dns_server, options,
+                            start_lookup);
+          if (entry.resolver == nullptr) entries_.erase(key);
+        }
+        return;
+      }
+    }
+    engine->Run([on_resolve = std::move(on_resolve),
+                 result = std::move(*cached)]() mutable {
+      on_resolve(std::move(result));
+    });
+  }
+
+  // Fails the pending lookups of \a owner with CANCELLED. The lookups
+  // themselves keep going, so that their results still reach the cache.
+  void CancelLookups(const void* owner, EventEngine* engine) {
+    std::vector<Callback> cancelled;
+    {
+      MutexLock lock(&mu_);
+      for (auto& p : entries_) {
+        auto& waiters = p.second.waiters;
+        for (auto it = waiters.begin(); it != waiters.end();) {
+          if (it->owner == owner) {
+            cancelled.push_back(std::move(it->callback));
+            it = waiters.erase(it);
+          } else {
+            ++it;
+          }
+        }
+      }
+    }
+    for (auto& callback : cancelled) {
+      engine->Run([callback = std::move(callback)]() mutable {
+        callback(absl::CancelledError("DNS lookup cancelled"));
+      });
+    }
+  }
+
+  void Reset() {
+    MutexLock lock(&mu_);
+    entries_.clear();
+  }
+
+ private:
+  struct Waiter {
+    const void* owner;
+    Callback callback;
+  };
+
+  struct Entry {
+    absl::optional<Result> result;
+    Timestamp expiration;
+    Timestamp refresh_time;
+    // Set while a lookup is in flight.
+    std::shared_ptr<EventEngine> engine;
+    std::unique_ptr<EventEngine::DNSResolver> resolver;
+    std::vector<Waiter> waiters;
+  };
+
+  void StartLookupLocked(const std::string& key, Entry* entry,
+                         const std::shared_ptr<EventEngine>& engine,
+                         const std::string& dns_server,
+                         const CachingDNSResolver::Options& options,
+                         StartLookupFn start_lookup)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_) {
+    auto resolver = engine->GetDNSResolver({dns_server});
+    if (!resolver.ok()) {
+      // Callbacks are never run inline, since callers may hold locks that
+      // their callbacks acquire.
+      for (auto& waiter : entry->waiters) {
+        engine->Run([callback = std::move(waiter.callback),
+                     status = resolver.status()]() mutable {
+          callback(status);
+        });
+      }
+      entry->waiters.clear();
+      return;
+    }
+    entry->engine = engine;
+    entry->resolver = std::move(*resolver);
+    start_lookup(entry->resolver.get(),
+                 [this, key, options](Result result) mutable {
+                   OnLookupDone(key, options, std::move(result));
+                 });
+  }
+
+  void OnLookupDone(const std::string& key,
+                    const CachingDNSResolver::Options& options,
+                    Result result) {
+    std::vector<Waiter> waiters;
+    std::shared_ptr<EventEngine> engine;
+    std::unique_ptr<EventEngine::DNSResolver> resolver;
+    {
+      MutexLock lock(&mu_);
+      auto it = entries_.find(key);
+      if (it == entries_.end()) return;
+      Entry& entry = it->second;
+      engine = std::move(entry.engine);
+      resolver = std::move(entry.resolver);
+      waiters = std::move(entry.waiters);
+      entry.waiters.clear();
+      const Timestamp now = Timestamp::Now();
+      const bool have_valid_result = entry.result.has_value() &&
+                                     entry.result->ok() &&
+                                     now < entry.expiration;
+      if (!result.ok() && have_valid_result) {
+        // A failed refresh does not replace a result that is still valid.
+        entry.refresh_time = entry.expiration;
+      } else {
+        const Duration ttl = result.ok() ? options.ttl : options.negative_ttl;
+        if (ttl > Duration::Zero()) {
+          entry.result = result;
+          entry.expiration = now + ttl;
+          entry.refresh_time = now + ttl * kRefreshFraction;
+        } else {
+          entry.result.reset();
+        }
+      }
+      if (!entry.result.has_value()) entries_.erase(it);
+      if (entries_.size() > kCleanupThreshold) RemoveExpiredLocked(now);
+    }
+    for (auto& waiter : waiters) waiter.callback(result);
+    // The resolver is destroyed outside of its own callback.
+    engine->Run([resolver = std::move(resolver)]() {});
+  }
+
+  void RemoveExpiredLocked(Timestamp now) ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_) {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      const Entry& entry = it->second;
+      if (entry.resolver == nullptr && entry.waiters.empty() &&
+          now >= entry.expiration) {
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  Mutex mu_;
+  std::map<std::string, Entry> entries_ ABSL_GUARDED_BY(&mu_);
+};
+
+using HostnameCache = DnsCache<std::vector<EventEngine::ResolvedAddress>>;
+using SRVCache = DnsCache<std::vector<EventEngine::DNSResolver::SRVRecord>>;
+using TXTCache = DnsCache<std::vector<std::string>>;
+
+}  // namespace
+
+CachingDNSResolver::CachingDNSResolver(std::shared_ptr<EventEngine> engine,
+                                       std::string dns_server, Options options)
+    : engine_(std::move(engine)),
+      dns_server_(std::move(dns_server)),
+      options_(options) {}
+
+CachingDNSResolver::~CachingDNSResolver() {
+  HostnameCache::Get().CancelLookups(this, engine_.get());
+  SRVCache::Get().CancelLookups(this, engine_.get());
+  TXTCache::Get().CancelLookups(this, engine_.get());
+}
+
+void CachingDNSResolver::LookupHostname(LookupHostnameCallback on_resolve,
+                                        absl::string_view name,
+                                        absl::string_view default_port) {
+  HostnameCache::Get().Lookup(
+      absl::StrCat(dns_server_, "/", name, ":", default_port), this, engine_,
+      dns_server_, options_, std::move(on_resolve),
+      [&](DNSResolver* resolver, HostnameCache::Callback on_done) {
+        resolver->LookupHostname(std::move(on_done), name, default_port);
+      });
+}
+
+void CachingDNSResolver::LookupSRV(LookupSRVCallback on_resolve,
+                                   absl::string_view name) {
+  SRVCache::Get().Lookup(
+      absl::StrCat(dns_server_, "/", name), this, engine_, dns_server_,
+      options_, std::move(on_resolve),
+      [&](DNSResolver* resolver, SRVCache::Callback on_done) {
+        resolver->LookupSRV(std::move(on_done), name);
+      });
+}
+
+void CachingDNSResolver::LookupTXT(LookupTXTCallback on_resolve,
+                                   absl::string_view name) {
+  TXTCache::Get().Lookup(
+      absl::StrCat(dns_server_, "/", name), this, engine_, dns_server_,
+      options_, std::move(on_resolve),
+      [&](DNSResolver* resolver, TXTCache::Callback on_done) {
+        resolver->LookupTXT(std::move(on_done), name);
+      });
+}
+
+void CachingDNSResolver::ResetCacheForTesting() {
+  HostnameCache::Get().Reset();
+  SRVCache::Get().Reset();
+  TXTCache::Get().Reset();
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,70 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
+#define GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
+
+#include <memory>
+#include <string>
+
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_core {
+
+// An EventEngine DNS resolver that shares lookup results through a
+// process-wide cache. Concurrent lookups of the same name are sent to DNS
+// only once, results are reused until they expire, and a result that is
+// used close to its expiration is refreshed in the background so that
+// callers rarely wait on DNS. The EventEngine API does not expose record
+// TTLs, so the lifetime of cached results is set by the caller.
+class CachingDNSResolver final
+    : public grpc_event_engine::experimental::EventEngine::DNSResolver {
+ public:
+  using EventEngine = grpc_event_engine::experimental::EventEngine;
+
+  struct Options {
+    // How long successful lookups are reused.
+    Duration ttl;
+    // How long failed lookups are reused. Zero disables negative caching.
+    Duration negative_ttl;
+  };
+
+  CachingDNSResolver(std::shared_ptr<EventEngine> engine,
+                     std::string dns_server, Options options);
+  // Lookups still waiting on DNS complete with a CANCELLED status.
+  ~CachingDNSResolver() override;
+
+  void LookupHostname(LookupHostnameCallback on_resolve, absl::string_view name,
+                      absl::string_view default_port) override;
+  void LookupSRV(LookupSRVCallback on_resolve,
+                 absl::string_view name) override;
+  void LookupTXT(LookupTXTCallback on_resolve,
+                 absl::string_view name) override;
+
+  // Drops all cached results. Must not be called while lookups are pending.
+  static void ResetCacheForTesting();
+
+ private:
+  std::shared_ptr<EventEngine> engine_;
+  const std::string dns_server_;
+  const Options options_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_RESOLVER_DNS_EVENT_ENGINE_CACHING_DNS_RESOLVER_H
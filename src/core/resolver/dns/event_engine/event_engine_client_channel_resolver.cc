@@ -50,6 +50,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/resolve_address.h"
 #include "src/core/load_balancing/grpclb/grpclb_balancer_addresses.h"
+#include "src/core/resolver/dns/event_engine/caching_dns_resolver.h"
 #include "src/core/resolver/dns/event_engine/service_config_helper.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/resolver/polling_resolver.h"
@@ -165,6 +166,8 @@ class EventEngineClientChannelDNSResolver final : public PollingResolver {
   const bool enable_srv_queries_;
   // timeout in milliseconds for active DNS queries
   EventEngine::Duration query_timeout_ms_;
+  // set if lookup results are shared through the process-wide DNS cache
+  absl::optional<CachingDNSResolver::Options> cache_options_;
   std::shared_ptr<EventEngine> event_engine_;
 };
 
@@ -191,22 +194,42 @@ EventEngineClientChannelDNSResolver::EventEngineClientChannelDNSResolver(
           std::max(0, channel_args()
                           .GetInt(GRPC_ARG_DNS_ARES_QUERY_TIMEOUT_MS)
                           .value_or(GRPC_DNS_DEFAULT_QUERY_TIMEOUT_MS)))),
-      event_engine_(channel_args().GetObjectRef<EventEngine>()) {}
+      event_engine_(channel_args().GetObjectRef<EventEngine>()) {
+  const Duration cache_ttl =
+      channel_args()
+          .GetDurationFromIntMillis(GRPC_ARG_DNS_CACHE_TTL_MS)
+          .value_or(Duration::Zero());
+  if (cache_ttl > Duration::Zero()) {
+    const Duration negative_ttl =
+        channel_args()
+            .GetDurationFromIntMillis(GRPC_ARG_DNS_CACHE_NEGATIVE_TTL_MS)
+            .value_or(Duration::Zero());
+    cache_options_ = CachingDNSResolver::Options{
+        cache_ttl, std::max(Duration::Zero(), negative_ttl)};
+  }
+}
 
 OrphanablePtr<Orphanable> EventEngineClientChannelDNSResolver::StartRequest() {
-  auto dns_resolver =
-      event_engine_->GetDNSResolver({/*dns_server=*/authority()});
-  if (!dns_resolver.ok()) {
-    Result result;
-    result.addresses = dns_resolver.status();
-    result.service_config = dns_resolver.status();
-    OnRequestComplete(std::move(result));
-    return nullptr;
+  std::unique_ptr<EventEngine::DNSResolver> dns_resolver;
+  if (cache_options_.has_value()) {
+    dns_resolver = std::make_unique<CachingDNSResolver>(
+        event_engine_, authority(), *cache_options_);
+  } else {
+    auto resolver =
+        event_engine_->GetDNSResolver({/*dns_server=*/authority()});
+    if (!resolver.ok()) {
+      Result result;
+      result.addresses = resolver.status();
+      result.service_config = resolver.status();
+      OnRequestComplete(std::move(result));
+      return nullptr;
+    }
+    dns_resolver = std::move(*resolver);
   }
   return MakeOrphanable<EventEngineDNSRequestWrapper>(
       RefAsSubclass<EventEngineClientChannelDNSResolver>(DEBUG_LOCATION,
                                                          "dns-resolving"),
-      std::move(*dns_resolver));
+      std::move(dns_resolver));
 }
 
 // ----------------------------------------------------------------------------
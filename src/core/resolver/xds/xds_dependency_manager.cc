@@ -543,9 +543,12 @@ void XdsDependencyManager::OnRouteConfigUpdate(
   // Find the relevant VirtualHost from the RouteConfiguration.
   // If the resource doesn't have the right vhost, fail without updating
   // our data.
-  auto vhost_index = XdsRouting::FindVirtualHostForDomain(
-      XdsVirtualHostListIterator(&route_config->virtual_hosts),
-      data_plane_authority_);
+  auto vhost_index =
+      route_config->virtual_host_index != nullptr
+          ? route_config->virtual_host_index->Find(data_plane_authority_)
+          : XdsRouting::FindVirtualHostForDomain(
+                XdsVirtualHostListIterator(&route_config->virtual_hosts),
+                data_plane_authority_);
   if (!vhost_index.has_value()) {
     OnError(route_config_name_.empty() ? listener_resource_name_
                                        : route_config_name_,
@@ -261,6 +261,8 @@ class XdsResolver final : public Resolver {
 
     std::map<absl::string_view, RefCountedPtr<ClusterRef>> clusters_;
     std::vector<RouteEntry> routes_;
+    // Compiled from routes_, for selecting the route of each call.
+    absl::optional<XdsRouting::RouteTable> route_table_;
   };
 
   class XdsConfigSelector final : public ConfigSelector {
@@ -440,14 +442,14 @@ XdsResolver::RouteConfigData::Create(
       return status;
     }
   }
+  data->route_table_.emplace(RouteListIterator(data.get()));
   return data;
 }
 
 XdsResolver::RouteConfigData::RouteEntry*
 XdsResolver::RouteConfigData::GetRouteForRequest(
     absl::string_view path, grpc_metadata_batch* initial_metadata) {
-  auto route_index = XdsRouting::GetRouteForRequest(RouteListIterator(this),
-                                                    path, initial_metadata);
+  auto route_index = route_table_->GetRouteForRequest(path, initial_metadata);
   if (!route_index.has_value()) {
     return nullptr;
   }
@@ -0,0 +1,260 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/server/admission_control.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "absl/log/log.h"
+#include "absl/random/distributions.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/strip.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+
+constexpr Duration ServerAdmissionController::kUpdateInterval;
+
+namespace {
+
+ServerAdmissionController::Limits LimitsFromChannelArgs(
+    const ChannelArgs& args, absl::string_view soft_name,
+    absl::string_view hard_name, ServerAdmissionController::Limits defaults,
+    double scale) {
+  auto get = [&args, scale](absl::string_view name, double default_value) {
+    auto value = args.GetInt(name);
+    return value.has_value() ? std::max(0, *value) / scale : default_value;
+  };
+  ServerAdmissionController::Limits limits;
+  limits.soft = get(soft_name, defaults.soft);
+  limits.hard = get(hard_name, defaults.hard);
+  limits.hard = std::max(limits.soft, limits.hard);
+  return limits;
+}
+
+// Maps \a value to [0, 1] between the soft and hard limits.
+double SignalLoad(double value, ServerAdmissionController::Limits limits) {
+  if (value < limits.soft) return 0;
+  if (value >= limits.hard) return 1;
+  return (value - limits.soft) / (limits.hard - limits.soft);
+}
+
+}  // namespace
+
+absl::optional<AdmissionPriority> ParseAdmissionPriority(
+    absl::string_view value) {
+  if (value == "sheddable") return AdmissionPriority::kSheddable;
+  if (value == "default") return AdmissionPriority::kDefault;
+  if (value == "critical") return AdmissionPriority::kCritical;
+  return absl::nullopt;
+}
+
+RefCountedPtr<ServerAdmissionController>
+ServerAdmissionController::CreateFromChannelArgs(const ChannelArgs& args) {
+  if (!args.GetBool(GRPC_ARG_SERVER_ADMISSION_CONTROL).value_or(false)) {
+    return nullptr;
+  }
+  Options defaults;
+  Options options;
+  options.cpu_utilization = LimitsFromChannelArgs(
+      args, GRPC_ARG_SERVER_ADMISSION_CONTROL_CPU_UTILIZATION_PERCENT,
+      GRPC_ARG_SERVER_ADMISSION_CONTROL_CPU_UTILIZATION_PERCENT_HARD_LIMIT,
+      defaults.cpu_utilization, 100);
+  options.queue_delay_ms = LimitsFromChannelArgs(
+      args, GRPC_ARG_SERVER_ADMISSION_CONTROL_QUEUE_DELAY_MS,
+      GRPC_ARG_SERVER_ADMISSION_CONTROL_QUEUE_DELAY_MS_HARD_LIMIT,
+      defaults.queue_delay_ms, 1);
+  options.memory_pressure = LimitsFromChannelArgs(
+      args, GRPC_ARG_SERVER_ADMISSION_CONTROL_MEMORY_PRESSURE_PERCENT,
+      GRPC_ARG_SERVER_ADMISSION_CONTROL_MEMORY_PRESSURE_PERCENT_HARD_LIMIT,
+      defaults.memory_pressure, 100);
+  auto method_priorities =
+      args.GetString(GRPC_ARG_SERVER_ADMISSION_CONTROL_METHOD_PRIORITIES);
+  if (method_priorities.has_value()) {
+    for (absl::string_view entry :
+         absl::StrSplit(*method_priorities, ',', absl::SkipWhitespace())) {
+      std::pair<absl::string_view, absl::string_view> method_and_priority =
+          absl::StrSplit(entry, absl::MaxSplits('=', 1));
+      auto priority = ParseAdmissionPriority(
+          absl::StripAsciiWhitespace(method_and_priority.second));
+      if (!priority.has_value()) {
+        LOG(ERROR) << "Invalid admission control method priority: " << entry;
+        continue;
+      }
+      options.method_priorities.emplace(
+          absl::StripAsciiWhitespace(method_and_priority.first), *priority);
+    }
+  }
+  options.tenant_metadata_key = std::string(
+      args.GetString(GRPC_ARG_SERVER_ADMISSION_CONTROL_TENANT_METADATA_KEY)
+          .value_or(""));
+  std::shared_ptr<EventEngine> engine = args.GetObjectRef<EventEngine>();
+  if (engine == nullptr) {
+    engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  }
+  ResourceQuota* resource_quota = args.GetObject<ResourceQuota>();
+  auto controller = MakeRefCounted<ServerAdmissionController>(
+      std::move(options), std::move(engine),
+      resource_quota == nullptr ? nullptr : resource_quota->memory_quota());
+  if (resource_quota != nullptr) {
+    controller->SetTenantQuotas(resource_quota->Ref());
+  }
+  return controller;
+}
+
+ServerAdmissionController::ServerAdmissionController(
+    Options options, std::shared_ptr<EventEngine> engine,
+    MemoryQuotaRefPtr memory_quota)
+    : options_(std::move(options)),
+      engine_(std::move(engine)),
+      memory_quota_(std::move(memory_quota)) {}
+
+absl::Status ServerAdmissionController::AdmitCall(const ClientMetadata& md) {
+  const double load = std::max(Load(), TenantLoad(md));
+  if (load <= 0) return absl::OkStatus();
+  const AdmissionPriority priority = PriorityOf(md);
+  bool reject;
+  {
+    MutexLock lock(&mu_);
+    reject = Reject(priority, load, bitgen_);
+  }
+  if (!reject) return absl::OkStatus();
+  global_stats().IncrementServerCallsShed();
+  return absl::ResourceExhaustedError("Server overloaded: call was shed");
+}
+
+bool ServerAdmissionController::Reject(AdmissionPriority priority,
+                                       double load, absl::BitGenRef bitsrc) {
+  double probability = 0;
+  switch (priority) {
+    case AdmissionPriority::kSheddable:
+      probability = 2 * load;
+      break;
+    case AdmissionPriority::kDefault:
+      probability = load;
+      break;
+    case AdmissionPriority::kCritical:
+      probability = load >= 1 ? 1 : 0;
+      break;
+  }
+  if (probability <= 0) return false;
+  if (probability >= 1) return true;
+  return absl::Bernoulli(bitsrc, probability);
+}
+
+double ServerAdmissionController::Load() {
+  // Called for every call, so the check for whether the load is due for an
+  // update doesn't read the clock.
+  const Timestamp now = Timestamp::NowCoarse();
+  const uint64_t now_ms = now.milliseconds_after_process_epoch();
+  uint64_t next_update = next_update_.load(std::memory_order_relaxed);
+  // Only one caller per interval recomputes the load.
+  if (now_ms < next_update ||
+      !next_update_.compare_exchange_strong(
+          next_update,
+          (now + kUpdateInterval).milliseconds_after_process_epoch(),
+          std::memory_order_relaxed)) {
+    return load_.load(std::memory_order_relaxed);
+  }
+  const double load = ComputeLoad(Timestamp::Now());
+  load_.store(load, std::memory_order_relaxed);
+  return load;
+}
+
+AdmissionPriority ServerAdmissionController::PriorityOf(
+    const ClientMetadata& md) const {
+  std::string buffer;
+  auto value = md.GetStringValue(kAdmissionPriorityMetadataKey, &buffer);
+  if (value.has_value()) {
+    auto priority = ParseAdmissionPriority(*value);
+    if (priority.has_value()) return *priority;
+  }
+  if (!options_.method_priorities.empty()) {
+    auto* path = md.get_pointer(HttpPathMetadata());
+    if (path != nullptr) {
+      auto it = options_.method_priorities.find(path->as_string_view());
+      if (it != options_.method_priorities.end()) return it->second;
+    }
+  }
+  return AdmissionPriority::kDefault;
+}
+
+double ServerAdmissionController::TenantLoad(const ClientMetadata& md) {
+  if (tenant_quotas_ == nullptr || options_.tenant_metadata_key.empty()) {
+    return 0;
+  }
+  std::string buffer;
+  auto tenant = md.GetStringValue(options_.tenant_metadata_key, &buffer);
+  if (!tenant.has_value()) return 0;
+  ResourceQuotaRefPtr quota = tenant_quotas_->FindChild(*tenant);
+  if (quota == nullptr) return 0;
+  return SignalLoad(
+      quota->memory_quota()->GetPressureInfo().instantaneous_pressure,
+      options_.memory_pressure);
+}
+
+double ServerAdmissionController::ComputeLoad(Timestamp now) {
+  double load = SignalLoad(QueueDelay(now).millis(), options_.queue_delay_ms);
+  if (cpu_utilization_source_ != nullptr) {
+    const double cpu_utilization = cpu_utilization_source_();
+    if (cpu_utilization >= 0) {
+      load = std::max(load,
+                      SignalLoad(cpu_utilization, options_.cpu_utilization));
+    }
+  }
+  if (memory_quota_ != nullptr) {
+    const double memory_pressure =
+        memory_quota_->GetPressureInfo().instantaneous_pressure;
+    load = std::max(load,
+                    SignalLoad(memory_pressure, options_.memory_pressure));
+  }
+  return load;
+}
+
+Duration ServerAdmissionController::QueueDelay(Timestamp now) {
+  const uint64_t now_ms = now.milliseconds_after_process_epoch();
+  Duration delay = Duration::Milliseconds(
+      queue_delay_ms_.load(std::memory_order_relaxed));
+  if (probe_in_flight_.exchange(true, std::memory_order_acq_rel)) {
+    // A probe that has been queued for longer than the last measured delay
+    // is a better estimate: the queue may be stuck.
+    const uint64_t start = probe_start_.load(std::memory_order_relaxed);
+    if (now_ms > start) {
+      delay = std::max(delay, Duration::Milliseconds(now_ms - start));
+    }
+    return delay;
+  }
+  probe_start_.store(now_ms, std::memory_order_relaxed);
+  engine_->Run([self = Ref(), now_ms]() {
+    const uint64_t end_ms = Timestamp::Now().milliseconds_after_process_epoch();
+    self->queue_delay_ms_.store(end_ms > now_ms ? end_ms - now_ms : 0,
+                                std::memory_order_relaxed);
+    self->probe_in_flight_.store(false, std::memory_order_release);
+  });
+  return delay;
+}
+
+}  // namespace grpc_core
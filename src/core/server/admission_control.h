@@ -0,0 +1,169 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_SERVER_ADMISSION_CONTROL_H
+#define GRPC_SRC_CORE_SERVER_ADMISSION_CONTROL_H
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/random/bit_gen_ref.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/metadata.h"
+
+namespace grpc_core {
+
+// How willing a call is to be shed when the server is overloaded.
+enum class AdmissionPriority : uint8_t {
+  // Shed first: rejected with a probability that reaches 1 halfway between
+  // the soft and hard limits.
+  kSheddable,
+  // Rejected with a probability that grows linearly from 0 at the soft limit
+  // to 1 at the hard limit, like RandomEarlyDetection.
+  kDefault,
+  // Only rejected once a signal reaches its hard limit.
+  kCritical,
+};
+
+// Parses "sheddable", "default" or "critical".
+absl::optional<AdmissionPriority> ParseAdmissionPriority(
+    absl::string_view value);
+
+// Metadata key clients use to set the priority of a call.
+constexpr absl::string_view kAdmissionPriorityMetadataKey = "grpc-priority";
+
+// Server wide admission control: decides whether to accept a new call from
+// the load of the server, so that an overloaded server sheds calls as soon as
+// their initial metadata arrives instead of queueing work it cannot do in
+// time.
+//
+// The load combines three signals, each with a soft and a hard limit:
+//  - CPU utilization, as reported by the application (the C++ server uses the
+//    value set on its ServerMetricRecorder);
+//  - the delay of the event engine's thread pool queue, measured by running a
+//    probe closure on it;
+//  - the memory pressure of the server's resource quota.
+// The load is the highest of the signals, each mapped to [0, 1] between its
+// soft and hard limits, and is recomputed at most once per kUpdateInterval.
+//
+// Calls can also name a tenant in their metadata. The memory pressure of the
+// tenant's child of the server's resource quota then adds to the load of
+// those calls only, so that a tenant running out of memory sheds its own
+// calls rather than everyone's.
+class ServerAdmissionController
+    : public RefCounted<ServerAdmissionController> {
+ public:
+  struct Limits {
+    double soft;
+    double hard;
+  };
+
+  struct Options {
+    // Fraction of the CPU in use.
+    Limits cpu_utilization{0.8, 0.95};
+    // Thread pool queue delay, in milliseconds.
+    Limits queue_delay_ms{20, 100};
+    // Memory pressure of the resource quota, between 0 and 1.
+    Limits memory_pressure{0.8, 0.95};
+    // Priority of calls to a method path that do not set their own.
+    absl::flat_hash_map<std::string, AdmissionPriority> method_priorities;
+    // Metadata key naming the tenant of a call, if any.
+    std::string tenant_metadata_key;
+  };
+
+  static constexpr Duration kUpdateInterval = Duration::Milliseconds(10);
+
+  // Returns nullptr unless GRPC_ARG_SERVER_ADMISSION_CONTROL is set in
+  // \a args.
+  static RefCountedPtr<ServerAdmissionController> CreateFromChannelArgs(
+      const ChannelArgs& args);
+
+  ServerAdmissionController(
+      Options options,
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine,
+      MemoryQuotaRefPtr memory_quota);
+
+  // Sets the function returning the current CPU utilization, between 0 and 1,
+  // or a negative value if it is unknown. Must be called before the server
+  // starts.
+  void SetCpuUtilizationSource(absl::AnyInvocable<double()> source) {
+    cpu_utilization_source_ = std::move(source);
+  }
+
+  // Sets the quota whose children, named by tenant, are the tenants' quotas.
+  // Must be called before the server starts.
+  void SetTenantQuotas(ResourceQuotaRefPtr parent) {
+    tenant_quotas_ = std::move(parent);
+  }
+
+  // Returns an error if the call with initial metadata \a md should be shed.
+  absl::Status AdmitCall(const ClientMetadata& md);
+
+  // Returns whether a call of \a priority should be rejected at \a load.
+  static bool Reject(AdmissionPriority priority, double load,
+                     absl::BitGenRef bitsrc);
+
+  // Returns the current load, between 0 and 1.
+  double Load();
+
+ private:
+  AdmissionPriority PriorityOf(const ClientMetadata& md) const;
+  // The load from the memory pressure of the tenant of the call, if any.
+  double TenantLoad(const ClientMetadata& md);
+  double ComputeLoad(Timestamp now);
+  // Returns the thread pool queue delay, and starts a new probe if none is in
+  // flight.
+  Duration QueueDelay(Timestamp now);
+
+  const Options options_;
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
+  const MemoryQuotaRefPtr memory_quota_;
+  absl::AnyInvocable<double()> cpu_utilization_source_;
+  ResourceQuotaRefPtr tenant_quotas_;
+
+  std::atomic<double> load_{0};
+  // In milliseconds since the process epoch.
+  std::atomic<uint64_t> next_update_{0};
+  std::atomic<bool> probe_in_flight_{false};
+  std::atomic<uint64_t> probe_start_{0};
+  std::atomic<int64_t> queue_delay_ms_{0};
+
+  Mutex mu_;
+  absl::BitGen bitgen_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_SERVER_ADMISSION_CONTROL_H
@@ -0,0 +1,138 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/server/drain_scheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/random/distributions.h"
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
+
+namespace grpc_core {
+
+using grpc_event_engine::experimental::EventEngine;
+
+Duration DrainScheduler::WindowFromChannelArgs(const ChannelArgs& args) {
+  return std::max(
+      Duration::Zero(),
+      args.GetDurationFromIntMillis(GRPC_ARG_SERVER_DRAIN_WINDOW_MS)
+          .value_or(Duration::Zero()));
+}
+
+void DrainScheduler::Drain(const ChannelArgs& args,
+                           RefCountedPtr<channelz::ServerNode> channelz_node,
+                           std::vector<Connection> connections) {
+  const Duration window = WindowFromChannelArgs(args);
+  if (window == Duration::Zero() || connections.size() <= 1) {
+    for (Connection& connection : connections) connection.send_goaway();
+    return;
+  }
+  std::shared_ptr<EventEngine> engine = args.GetObjectRef<EventEngine>();
+  if (engine == nullptr) {
+    engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  }
+  absl::BitGen bitgen;
+  MakeRefCounted<DrainScheduler>(std::move(engine), std::move(channelz_node),
+                                 window, std::move(connections), bitgen)
+      ->Start();
+}
+
+DrainScheduler::DrainScheduler(
+    std::shared_ptr<EventEngine> engine,
+    RefCountedPtr<channelz::ServerNode> channelz_node, Duration window,
+    std::vector<Connection> connections, absl::BitGenRef bitsrc)
+    : engine_(std::move(engine)),
+      channelz_node_(std::move(channelz_node)),
+      window_(window),
+      connections_(std::move(connections)) {
+  std::stable_sort(connections_.begin(), connections_.end(),
+                   [](const Connection& a, const Connection& b) {
+                     if (a.active_calls != b.active_calls) {
+                       return a.active_calls < b.active_calls;
+                     }
+                     return a.established < b.established;
+                   });
+  // Connection i is sent its GOAWAY at a random time in the i-th slot of the
+  // window, which keeps the order above while spreading GOAWAYs evenly.
+  send_offsets_.reserve(connections_.size());
+  const double slot = static_cast<double>(connections_.size());
+  for (size_t i = 0; i < connections_.size(); ++i) {
+    send_offsets_.push_back(window_ *
+                            ((i + absl::Uniform(bitsrc, 0.0, 1.0)) / slot));
+  }
+}
+
+DrainScheduler::~DrainScheduler() {
+  // The event engine dropped our timer: do not leave connections undrained.
+  ExecCtx exec_ctx;
+  MutexLock lock(&mu_);
+  for (size_t i = next_; i < connections_.size(); ++i) {
+    connections_[i].send_goaway();
+    connections_[i].send_goaway = nullptr;
+  }
+}
+
+void DrainScheduler::Start() {
+  start_ = Timestamp::Now();
+  if (channelz_node_ != nullptr) {
+    channelz_node_->AddTraceEvent(
+        channelz::ChannelTrace::Severity::Info,
+        grpc_slice_from_cpp_string(absl::StrCat(
+            "Draining ", connections_.size(), " connections over ",
+            window_.ToString())));
+  }
+  SendDueGoaways();
+}
+
+void DrainScheduler::SendDueGoaways() {
+  Duration next_delay;
+  {
+    MutexLock lock(&mu_);
+    const Duration elapsed = Timestamp::Now() - start_;
+    while (next_ < connections_.size() && send_offsets_[next_] <= elapsed) {
+      connections_[next_].send_goaway();
+      // Releases whatever the closure holds on to the connection.
+      connections_[next_].send_goaway = nullptr;
+      ++next_;
+      goaways_sent_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (next_ == connections_.size()) {
+      if (channelz_node_ != nullptr) {
+        channelz_node_->AddTraceEvent(
+            channelz::ChannelTrace::Severity::Info,
+            grpc_slice_from_cpp_string(absl::StrCat(
+                "Sent GOAWAY to all ", connections_.size(), " connections")));
+      }
+      return;
+    }
+    next_delay = send_offsets_[next_] - elapsed;
+  }
+  engine_->RunAfter(next_delay, [self = Ref()]() {
+    ApplicationCallbackExecCtx callback_exec_ctx;
+    ExecCtx exec_ctx;
+    self->SendDueGoaways();
+  });
+}
+
+}  // namespace grpc_core
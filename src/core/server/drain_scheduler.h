@@ -0,0 +1,103 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_SERVER_DRAIN_SCHEDULER_H
+#define GRPC_SRC_CORE_SERVER_DRAIN_SCHEDULER_H
+
+#include <stddef.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/random/bit_gen_ref.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/channelz/channelz.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc_core {
+
+// Sends GOAWAYs to a set of server connections spread over a window instead
+// of all at once, so that their clients do not all reconnect to other
+// backends, and handshake with them, in the same instant.
+//
+// Each connection gets its own slot of the window and a random time within
+// it. Idle connections go first, so that the first clients to move are the
+// ones that lose no work, then the oldest ones, which max_connection_age
+// would have recycled soonest anyway.
+//
+// Progress is reported as channelz trace events of the server.
+class DrainScheduler final : public RefCounted<DrainScheduler> {
+ public:
+  struct Connection {
+    // Calls in progress on the connection when the drain started.
+    size_t active_calls = 0;
+    // When the connection was established.
+    Timestamp established;
+    // Sends the GOAWAY on the connection.
+    absl::AnyInvocable<void()> send_goaway;
+  };
+
+  // Returns the drain window configured by GRPC_ARG_SERVER_DRAIN_WINDOW_MS,
+  // or zero if GOAWAYs should all be sent at once.
+  static Duration WindowFromChannelArgs(const ChannelArgs& args);
+
+  // Sends GOAWAYs to \a connections over the window configured in \a args,
+  // using its event engine, or to all of them right away if there is none.
+  static void Drain(const ChannelArgs& args,
+                    RefCountedPtr<channelz::ServerNode> channelz_node,
+                    std::vector<Connection> connections);
+
+  DrainScheduler(
+      std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine,
+      RefCountedPtr<channelz::ServerNode> channelz_node, Duration window,
+      std::vector<Connection> connections, absl::BitGenRef bitsrc);
+  ~DrainScheduler() override;
+
+  // Sends the GOAWAYs that are due now and schedules the others.
+  void Start();
+
+  size_t connections() const { return connections_.size(); }
+  // Number of GOAWAYs sent so far.
+  size_t goaways_sent() const {
+    return goaways_sent_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  void SendDueGoaways();
+
+  const std::shared_ptr<grpc_event_engine::experimental::EventEngine> engine_;
+  const RefCountedPtr<channelz::ServerNode> channelz_node_;
+  const Duration window_;
+  Timestamp start_;
+  // Sorted by send time.
+  std::vector<Connection> connections_;
+  std::vector<Duration> send_offsets_;
+  Mutex mu_;
+  size_t next_ ABSL_GUARDED_BY(mu_) = 0;
+  std::atomic<size_t> goaways_sent_{0};
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_SERVER_DRAIN_SCHEDULER_H
@@ -34,6 +34,7 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/random/random.h"
 #include "absl/status/status.h"
 #include "absl/types/optional.h"
 
@@ -43,6 +44,7 @@
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/slice.h>
 #include <grpc/status.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/port_platform.h>
 #include <grpc/support/time.h>
 
@@ -54,6 +56,7 @@
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/debug_location.h"
+#include "src/core/lib/gprpp/lock_profile.h"
 #include "src/core/lib/gprpp/mpscq.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/status_helper.h"
@@ -82,6 +85,9 @@
 #include "src/core/lib/transport/connectivity_state.h"
 #include "src/core/lib/transport/error_utils.h"
 #include "src/core/lib/transport/interception_chain.h"
+#include "src/core/lib/transport/message.h"
+#include "src/core/server/drain_scheduler.h"
+#include "src/core/telemetry/call_phase_timestamps.h"
 #include "src/core/telemetry/stats.h"
 #include "src/core/util/useful.h"
 
@@ -252,7 +258,12 @@ struct Server::RequestedCall {
         md.Remove(HttpPathMetadata());
         *data.registered.deadline = deadline.as_timespec(GPR_CLOCK_MONOTONIC);
         if (data.registered.optional_payload != nullptr) {
-          if (payload.has_value()) {
+          if (payload.has_value() && payload.value()->has_object()) {
+            *data.registered.optional_payload =
+                grpc_raw_byte_buffer_create(nullptr, 0);
+            payload.value()->TakeObject().AttachTo(
+                *data.registered.optional_payload);
+          } else if (payload.has_value()) {
             auto* sb = payload.value()->payload()->c_slice_buffer();
             *data.registered.optional_payload =
                 grpc_raw_byte_buffer_create(sb->slices, sb->count);
@@ -285,34 +296,67 @@ struct Server::RequestedCall {
   } data;
 };
 
+namespace {
+
+LockProfile* RequestMatcherShardLockProfile() {
+  static LockProfile* profile =
+      new LockProfile("server.request_matcher_shard_mu");
+  return profile;
+}
+
+LockProfile* ServerCallLockProfile() {
+  static LockProfile* profile = new LockProfile("server.mu_call");
+  return profile;
+}
+
+}  // namespace
+
 // The RealRequestMatcher is an implementation of RequestMatcherInterface that
 // actually uses all the features of RequestMatcherInterface: expecting the
 // application to explicitly request RPCs and then matching those to incoming
 // RPCs, along with a slow path by which incoming RPCs are put on a locked
 // pending list if they aren't able to be matched to an application request.
+//
+// The pending lists are sharded per request queue: an incoming RPC waits in
+// the shard of the request queue it started matching from, and an application
+// request that finds its own shard empty steals from the other shards, unless
+// the server has CQ connection affinity. Each
+// shard publishes how many RPCs are waiting in it, so that requests only take
+// the locks of the shards that have some.
 class Server::RealRequestMatcher : public RequestMatcherInterface {
  public:
   explicit RealRequestMatcher(Server* server)
-      : server_(server), requests_per_cq_(server->cqs_.size()) {}
+      : server_(server),
+        requests_per_cq_(server->cqs_.size()),
+        shards_(server->cqs_.size()) {}
 
   ~RealRequestMatcher() override {
     for (LockedMultiProducerSingleConsumerQueue& queue : requests_per_cq_) {
       CHECK_EQ(queue.Pop(), nullptr);
     }
-    CHECK(pending_filter_stack_.empty());
-    CHECK(pending_promises_.empty());
+    for (PendingShard& shard : shards_) {
+      MutexLock lock(&shard.mu);
+      CHECK(shard.filter_stack.empty());
+      CHECK(shard.promises.empty());
+    }
   }
 
   void ZombifyPending() override {
-    while (!pending_filter_stack_.empty()) {
-      pending_filter_stack_.front().calld->SetState(
-          CallData::CallState::ZOMBIED);
-      pending_filter_stack_.front().calld->KillZombie();
-      pending_filter_stack_.pop();
-    }
-    while (!pending_promises_.empty()) {
-      pending_promises_.front()->Finish(absl::InternalError("Server closed"));
-      pending_promises_.pop();
+    for (PendingShard& shard : shards_) {
+      MutexLock lock(&shard.mu);
+      while (!shard.filter_stack.empty()) {
+        shard.filter_stack.front().calld->SetState(
+            CallData::CallState::ZOMBIED);
+        shard.filter_stack.front().calld->KillZombie();
+        shard.filter_stack.pop();
+        shard.size.fetch_sub(1, std::memory_order_relaxed);
+      }
+      while (!shard.promises.empty()) {
+        shard.promises.front()->Finish(absl::InternalError("Server closed"));
+        shard.promises.pop();
+        shard.size.fetch_sub(1, std::memory_order_relaxed);
+        pending_promises_count_.fetch_sub(1, std::memory_order_relaxed);
+      }
     }
   }
 
@@ -333,41 +377,20 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   void RequestCallWithPossiblePublish(size_t request_queue_index,
                                       RequestedCall* call) override {
     if (requests_per_cq_[request_queue_index].Push(&call->mpscq_node)) {
-      // this was the first queued request: we need to lock and start
-      // matching calls
-      struct NextPendingCall {
-        RequestedCall* rc = nullptr;
-        CallData* pending_filter_stack = nullptr;
-        PendingCallPromises pending_promise;
-      };
+      // this was the first queued request: we need to start matching pending
+      // calls, from our own shard first and then from the others.
+      // Pairs with the fence in AddPending(): either we see the size of a
+      // shard that a call is being added to, or that call sees our request.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
       while (true) {
         NextPendingCall pending_call;
-        {
-          MutexLock lock(&server_->mu_call_);
-          while (!pending_filter_stack_.empty() &&
-                 pending_filter_stack_.front().Age() >
-                     server_->max_time_in_pending_queue_) {
-            pending_filter_stack_.front().calld->SetState(
-                CallData::CallState::ZOMBIED);
-            pending_filter_stack_.front().calld->KillZombie();
-            pending_filter_stack_.pop();
-          }
-          if (!pending_promises_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.pending_promise =
-                  std::move(pending_promises_.front());
-              pending_promises_.pop();
-            }
-          } else if (!pending_filter_stack_.empty()) {
-            pending_call.rc = reinterpret_cast<RequestedCall*>(
-                requests_per_cq_[request_queue_index].Pop());
-            if (pending_call.rc != nullptr) {
-              pending_call.pending_filter_stack =
-                  pending_filter_stack_.front().calld;
-              pending_filter_stack_.pop();
-            }
+        for (size_t i = 0; i < match_queue_count(); i++) {
+          PendingShard& shard =
+              shards_[(request_queue_index + i) % shards_.size()];
+          if (shard.size.load(std::memory_order_relaxed) == 0) continue;
+          if (!TakePendingCall(shard, request_queue_index, &pending_call) ||
+              pending_call.rc != nullptr) {
+            break;
           }
         }
         if (pending_call.rc == nullptr) break;
@@ -394,7 +417,8 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
 
   void MatchOrQueue(size_t start_request_queue_index,
                     CallData* calld) override {
-    for (size_t i = 0; i < requests_per_cq_.size(); i++) {
+    start_request_queue_index %= requests_per_cq_.size();
+    for (size_t i = 0; i < match_queue_count(); i++) {
       size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
       RequestedCall* rc =
           reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].TryPop());
@@ -404,27 +428,21 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
         return;
       }
     }
-    // No cq to take the request found; queue it on the slow list.
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
+    // No cq to take the request found; queue it on the slow list of our
+    // shard. We need to ensure that all the queues are empty: the shard
+    // counts the call before we look at the queues one last time, so that if
+    // something is added to an empty request queue after that, its requester
+    // comes to the shard and blocks on its lock until the call is actually
     // added to the pending list.
-    RequestedCall* rc = nullptr;
-    size_t cq_idx = 0;
-    size_t loop_count;
+    PendingShard& shard = shards_[start_request_queue_index];
+    RequestedCall* rc;
+    size_t cq_idx;
     {
-      MutexLock lock(&server_->mu_call_);
-      for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
-        cq_idx =
-            (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
-        if (rc != nullptr) {
-          break;
-        }
-      }
+      ProfiledMutexLock lock(&shard.mu, RequestMatcherShardLockProfile());
+      rc = AddPending(shard, start_request_queue_index, &cq_idx);
       if (rc == nullptr) {
         calld->SetState(CallData::CallState::PENDING);
-        pending_filter_stack_.push(PendingCallFilterStack{calld});
+        shard.filter_stack.push(PendingCallFilterStack{calld});
         return;
       }
     }
@@ -434,7 +452,8 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
 
   ArenaPromise<absl::StatusOr<MatchResult>> MatchRequest(
       size_t start_request_queue_index) override {
-    for (size_t i = 0; i < requests_per_cq_.size(); i++) {
+    start_request_queue_index %= requests_per_cq_.size();
+    for (size_t i = 0; i < match_queue_count(); i++) {
       size_t cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
       RequestedCall* rc =
           reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].TryPop());
@@ -442,38 +461,35 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
         return Immediate(MatchResult(server(), cq_idx, rc));
       }
     }
-    // No cq to take the request found; queue it on the slow list.
-    // We need to ensure that all the queues are empty.  We do this under
-    // the server mu_call_ lock to ensure that if something is added to
-    // an empty request queue, it will block until the call is actually
-    // added to the pending list.
-    RequestedCall* rc = nullptr;
-    size_t cq_idx = 0;
-    size_t loop_count;
+    // No cq to take the request found; queue it on the slow list of our
+    // shard, see MatchOrQueue().
+    PendingShard& shard = shards_[start_request_queue_index];
+    RequestedCall* rc;
+    size_t cq_idx;
     {
       std::vector<std::shared_ptr<ActivityWaiter>> removed_pending;
-      MutexLock lock(&server_->mu_call_);
-      while (!pending_promises_.empty() &&
-             pending_promises_.front()->Age() >
+      ProfiledMutexLock lock(&shard.mu, RequestMatcherShardLockProfile());
+      while (!shard.promises.empty() &&
+             shard.promises.front()->Age() >
                  server_->max_time_in_pending_queue_) {
-        removed_pending.push_back(std::move(pending_promises_.front()));
-        pending_promises_.pop();
-      }
-      for (loop_count = 0; loop_count < requests_per_cq_.size(); loop_count++) {
-        cq_idx =
-            (start_request_queue_index + loop_count) % requests_per_cq_.size();
-        rc = reinterpret_cast<RequestedCall*>(requests_per_cq_[cq_idx].Pop());
-        if (rc != nullptr) break;
+        removed_pending.push_back(std::move(shard.promises.front()));
+        shard.promises.pop();
+        shard.size.fetch_sub(1, std::memory_order_relaxed);
+        pending_promises_count_.fetch_sub(1, std::memory_order_relaxed);
       }
+      rc = AddPending(shard, start_request_queue_index, &cq_idx);
       if (rc == nullptr) {
-        if (server_->pending_backlog_protector_.Reject(pending_promises_.size(),
-                                                       server_->bitgen_)) {
+        if (server_->pending_backlog_protector_.Reject(
+                pending_promises_count_.load(std::memory_order_relaxed),
+                shard.bitgen)) {
+          shard.size.fetch_sub(1, std::memory_order_relaxed);
           return Immediate(absl::ResourceExhaustedError(
               "Too many pending requests for this server"));
         }
         auto w = std::make_shared<ActivityWaiter>(
             GetContext<Activity>()->MakeOwningWaker());
-        pending_promises_.push(w);
+        shard.promises.push(w);
+        pending_promises_count_.fetch_add(1, std::memory_order_relaxed);
         return OnCancel(
             [w]() -> Poll<absl::StatusOr<MatchResult>> {
               std::unique_ptr<absl::StatusOr<MatchResult>> r(
@@ -493,8 +509,8 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
   Server* const server_;
   struct PendingCallFilterStack {
     CallData* calld;
-    Timestamp created = Timestamp::Now();
-    Duration Age() { return Timestamp::Now() - created; }
+    Timestamp created = Timestamp::NowCoarse();
+    Duration Age() { return Timestamp::NowCoarse() - created; }
   };
   struct ActivityWaiter {
     using ResultType = absl::StatusOr<MatchResult>;
@@ -525,15 +541,92 @@ class Server::RealRequestMatcher : public RequestMatcherInterface {
       delete result.exchange(new ResultType(absl::CancelledError()),
                              std::memory_order_acq_rel);
     }
-    Duration Age() { return Timestamp::Now() - created; }
+    Duration Age() { return Timestamp::NowCoarse() - created; }
     Waker waker;
     std::atomic<ResultType*> result{nullptr};
-    const Timestamp created = Timestamp::Now();
+    const Timestamp created = Timestamp::NowCoarse();
   };
   using PendingCallPromises = std::shared_ptr<ActivityWaiter>;
-  std::queue<PendingCallFilterStack> pending_filter_stack_;
-  std::queue<PendingCallPromises> pending_promises_;
+  struct PendingShard {
+    Mutex mu;
+    std::queue<PendingCallFilterStack> filter_stack ABSL_GUARDED_BY(mu);
+    std::queue<PendingCallPromises> promises ABSL_GUARDED_BY(mu);
+    // Number of calls in the pending lists, plus those about to be added.
+    // Written under mu, read without it by requesters looking for calls.
+    std::atomic<size_t> size{0};
+    absl::BitGen bitgen ABSL_GUARDED_BY(mu);
+  };
+  struct NextPendingCall {
+    RequestedCall* rc = nullptr;
+    CallData* pending_filter_stack = nullptr;
+    PendingCallPromises pending_promise;
+  };
+
+  // Counts a call in \a shard, then pops a requested call for it from the
+  // queues starting at \a start_request_queue_index. If there is none, the
+  // caller must add the call to the pending lists of the shard before
+  // releasing its lock; otherwise the call is not counted anymore.
+  RequestedCall* AddPending(PendingShard& shard,
+                            size_t start_request_queue_index, size_t* cq_idx)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu) {
+    shard.size.fetch_add(1, std::memory_order_relaxed);
+    // Pairs with the fence in RequestCallWithPossiblePublish().
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (size_t i = 0; i < match_queue_count(); i++) {
+      *cq_idx = (start_request_queue_index + i) % requests_per_cq_.size();
+      RequestedCall* rc =
+          reinterpret_cast<RequestedCall*>(requests_per_cq_[*cq_idx].Pop());
+      if (rc != nullptr) {
+        shard.size.fetch_sub(1, std::memory_order_relaxed);
+        return rc;
+      }
+    }
+    return nullptr;
+  }
+
+  // Takes the oldest pending call of \a shard, along with a requested call
+  // from \a request_queue_index to publish it to. Returns false if there was
+  // a pending call but no more requested calls.
+  bool TakePendingCall(PendingShard& shard, size_t request_queue_index,
+                       NextPendingCall* pending_call) {
+    ProfiledMutexLock lock(&shard.mu, RequestMatcherShardLockProfile());
+    while (!shard.filter_stack.empty() &&
+           shard.filter_stack.front().Age() >
+               server_->max_time_in_pending_queue_) {
+      shard.filter_stack.front().calld->SetState(CallData::CallState::ZOMBIED);
+      shard.filter_stack.front().calld->KillZombie();
+      shard.filter_stack.pop();
+      shard.size.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if (shard.promises.empty() && shard.filter_stack.empty()) return true;
+    pending_call->rc = reinterpret_cast<RequestedCall*>(
+        requests_per_cq_[request_queue_index].Pop());
+    if (pending_call->rc == nullptr) return false;
+    if (!shard.promises.empty()) {
+      pending_call->pending_promise = std::move(shard.promises.front());
+      shard.promises.pop();
+      pending_promises_count_.fetch_sub(1, std::memory_order_relaxed);
+    } else {
+      pending_call->pending_filter_stack = shard.filter_stack.front().calld;
+      shard.filter_stack.pop();
+    }
+    shard.size.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // How many request queues a call tries, starting from its own, and how
+  // many shards a request takes pending calls from, starting from its own.
+  // With CQ connection affinity, calls and requests stay on their CQ.
+  size_t match_queue_count() const {
+    return server_->cq_connection_affinity_ ? 1 : requests_per_cq_.size();
+  }
+
   std::vector<LockedMultiProducerSingleConsumerQueue> requests_per_cq_;
+  // One shard of pending calls per request queue.
+  std::vector<PendingShard> shards_;
+  // Number of promise based calls pending in all the shards, which the
+  // server's pending backlog protector limits.
+  std::atomic<size_t> pending_promises_count_{0};
 };
 
 // AllocatingRequestMatchers don't allow the application to request an RPC in
@@ -712,6 +805,8 @@ class ChannelBroadcaster {
     delete a;
   }
 
+ public:
+  // Sends a shutdown on a single channel.
   static void SendShutdown(Channel* channel, bool send_goaway,
                            grpc_error_handle send_disconnect) {
     ShutdownCleanupArgs* sc = new ShutdownCleanupArgs;
@@ -730,6 +825,7 @@ class ChannelBroadcaster {
     elem->filter->start_transport_op(elem, op);
   }
 
+ private:
   std::vector<RefCountedPtr<Channel>> channels_;
 };
 
@@ -820,6 +916,15 @@ auto Server::MatchAndPublishCall(CallHandler call_handler) {
     return TrySeq(
         // Wait for initial metadata to pass through all filters
         Map(call_handler.PullClientInitialMetadata(), CheckClientMetadata),
+        // Shed the call if the server is overloaded
+        [this](ClientMetadataHandle md)
+            -> absl::StatusOr<ClientMetadataHandle> {
+          if (admission_controller_ != nullptr) {
+            absl::Status status = admission_controller_->AdmitCall(*md);
+            if (!status.ok()) return status;
+          }
+          return std::move(md);
+        },
         // Match request with requested call
         [this, call_handler](ClientMetadataHandle md) mutable {
           auto* registered_method = static_cast<RegisteredMethod*>(
@@ -841,7 +946,8 @@ auto Server::MatchAndPublishCall(CallHandler call_handler) {
                     absl::nullopt);
               });
           return TryJoin<absl::StatusOr>(
-              std::move(maybe_read_first_message), rm->MatchRequest(0),
+              std::move(maybe_read_first_message),
+              rm->MatchRequest(gpr_cpu_current_cpu()),
               [md = std::move(md)]() mutable {
                 return ValueOrFailure<ClientMetadataHandle>(std::move(md));
               });
@@ -885,10 +991,15 @@ Server::Server(const ChannelArgs& args)
       channelz_node_(CreateChannelzNode(args)),
       server_call_tracer_factory_(ServerCallTracerFactory::Get(args)),
       compression_options_(CompressionOptionsFromChannelArgs(args)),
+      admission_controller_(
+          ServerAdmissionController::CreateFromChannelArgs(args)),
       max_time_in_pending_queue_(Duration::Seconds(
           channel_args_
               .GetInt(GRPC_ARG_SERVER_MAX_UNREQUESTED_TIME_IN_SERVER_SECONDS)
-              .value_or(30))) {}
+              .value_or(30))),
+      cq_connection_affinity_(
+          channel_args_.GetBool(GRPC_ARG_SERVER_CQ_CONNECTION_AFFINITY)
+              .value_or(false)) {}
 
 Server::~Server() {
   // Remove the cq pollsets from the config_fetcher.
@@ -924,10 +1035,18 @@ void Server::Start() {
   if (unregistered_request_matcher_ == nullptr) {
     unregistered_request_matcher_ = std::make_unique<RealRequestMatcher>(this);
   }
+  registered_methods_by_path_.reserve(registered_methods_.size());
   for (auto& rm : registered_methods_) {
     if (rm.second->matcher == nullptr) {
       rm.second->matcher = std::make_unique<RealRequestMatcher>(this);
     }
+    RegisteredMethodsForPath& for_path =
+        registered_methods_by_path_[rm.second->method];
+    if (rm.second->host.empty()) {
+      for_path.any_host = rm.second.get();
+    } else {
+      for_path.by_host.emplace_back(rm.second->host, rm.second.get());
+    }
   }
   {
     MutexLock lock(&mu_global_);
@@ -996,8 +1115,15 @@ grpc_error_handle Server::SetupTransport(
       if (grpc_cq_pollset(cqs_[cq_idx]) == accepting_pollset) break;
     }
     if (cq_idx == cqs_.size()) {
-      // Completion queue not found.  Pick a random one to publish new calls to.
-      cq_idx = static_cast<size_t>(rand()) % std::max<size_t>(1, cqs_.size());
+      // Completion queue not found.  Pick a random one to publish new calls to,
+      // or spread connections evenly when they stay on their CQ.
+      if (cq_connection_affinity_) {
+        cq_idx =
+            next_connection_cq_idx_.fetch_add(1, std::memory_order_relaxed) %
+            std::max<size_t>(1, cqs_.size());
+      } else {
+        cq_idx = static_cast<size_t>(rand()) % std::max<size_t>(1, cqs_.size());
+      }
     }
     intptr_t channelz_socket_uuid = 0;
     if (socket_node != nullptr) {
@@ -1089,7 +1215,7 @@ void Server::MaybeFinishShutdown() {
     return;
   }
   {
-    MutexLock lock(&mu_call_);
+    ProfiledMutexLock lock(&mu_call_, ServerCallLockProfile());
     KillPendingWorkLocked(GRPC_ERROR_CREATE("Server Shutdown"));
   }
   if (!channels_.empty() || connections_open_ > 0 ||
@@ -1188,7 +1314,7 @@ void Server::ShutdownAndNotify(grpc_completion_queue* cq, void* tag) {
     removing_connections.swap(connections_);
     // Collect all unregistered then registered calls.
     {
-      MutexLock lock(&mu_call_);
+      ProfiledMutexLock lock(&mu_call_, ServerCallLockProfile());
       KillPendingWorkLocked(GRPC_ERROR_CREATE("Server Shutdown"));
     }
     ShutdownUnrefOnShutdownCall();
@@ -1224,12 +1350,25 @@ void Server::CancelAllCalls() {
 }
 
 void Server::SendGoaways() {
-  ChannelBroadcaster broadcaster;
+  // Paced by DrainScheduler when GRPC_ARG_SERVER_DRAIN_WINDOW_MS is set.
+  std::vector<DrainScheduler::Connection> connections;
   {
     MutexLock lock(&mu_global_);
-    broadcaster.FillChannelsLocked(GetChannelsLocked());
+    connections.reserve(channels_.size());
+    for (const ChannelData* chand : channels_) {
+      DrainScheduler::Connection connection;
+      connection.active_calls = chand->active_calls();
+      connection.established = chand->established();
+      connection.send_goaway =
+          [channel = chand->channel()->RefAsSubclass<Channel>()]() {
+            ChannelBroadcaster::SendShutdown(channel.get(),
+                                             /*send_goaway=*/true,
+                                             absl::OkStatus());
+          };
+      connections.push_back(std::move(connection));
+    }
   }
-  broadcaster.BroadcastShutdown(/*send_goaway=*/true, absl::OkStatus());
+  DrainScheduler::Drain(channel_args_, channelz_node_, std::move(connections));
 }
 
 void Server::Orphan() {
@@ -1380,6 +1519,7 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
   channel_ = std::move(channel);
   cq_idx_ = cq_idx;
   channelz_socket_uuid_ = channelz_socket_uuid;
+  established_ = Timestamp::Now();
   // Publish channel.
   {
     MutexLock lock(&server_->mu_global_);
@@ -1406,18 +1546,15 @@ void Server::ChannelData::InitTransport(RefCountedPtr<Server> server,
 
 Server::RegisteredMethod* Server::GetRegisteredMethod(
     const absl::string_view& host, const absl::string_view& path) {
-  if (registered_methods_.empty()) return nullptr;
+  if (registered_methods_by_path_.empty()) return nullptr;
+  auto it = registered_methods_by_path_.find(path);
+  if (it == registered_methods_by_path_.end()) return nullptr;
   // check for an exact match with host
-  auto it = registered_methods_.find(std::make_pair(host, path));
-  if (it != registered_methods_.end()) {
-    return it->second.get();
-  }
-  // check for wildcard method definition (no host set)
-  it = registered_methods_.find(std::make_pair("", path));
-  if (it != registered_methods_.end()) {
-    return it->second.get();
+  for (const auto& by_host : it->second.by_host) {
+    if (by_host.first == host) return by_host.second;
   }
-  return nullptr;
+  // fall back to the wildcard method definition (no host set)
+  return it->second.any_host;
 }
 
 void Server::SetRegisteredMethodOnMetadata(ClientMetadata& metadata) {
@@ -1595,6 +1732,8 @@ void Server::CallData::Publish(size_t cq_idx, RequestedCall* rc) {
     default:
       GPR_UNREACHABLE_CODE(return);
   }
+  RecordCallPhase(grpc_call_get_arena(call_),
+                  CallPhaseTimestamps::Phase::kHandlerInvoked);
   grpc_cq_end_op(cq_new_, rc->tag, absl::OkStatus(), Server::DoneRequestEvent,
                  rc, &rc->completion, true);
 }
@@ -1700,6 +1839,14 @@ void Server::CallData::RecvInitialMetadataReady(void* arg,
                                                 grpc_error_handle error) {
   grpc_call_element* elem = static_cast<grpc_call_element*>(arg);
   CallData* calld = static_cast<CallData*>(elem->call_data);
+  // Shed the call if the server is overloaded, before the path is taken out
+  // of the metadata.
+  ServerAdmissionController* admission_controller =
+      calld->server_->admission_controller_.get();
+  if (error.ok() && admission_controller != nullptr) {
+    error = admission_controller->AdmitCall(*calld->recv_initial_metadata_);
+    if (!error.ok()) calld->recv_initial_metadata_error_ = error;
+  }
   if (error.ok()) {
     calld->path_ = calld->recv_initial_metadata_->Take(HttpPathMetadata());
     auto* host =
@@ -1753,6 +1900,7 @@ grpc_error_handle Server::CallData::InitCallElement(
     grpc_call_element* elem, const grpc_call_element_args* args) {
   auto* chand = static_cast<ChannelData*>(elem->channel_data);
   new (elem->call_data) Server::CallData(elem, *args, chand->server());
+  chand->CallStarted();
   return absl::OkStatus();
 }
 
@@ -1761,6 +1909,7 @@ void Server::CallData::DestroyCallElement(
     grpc_closure* /*ignored*/) {
   auto* calld = static_cast<CallData*>(elem->call_data);
   calld->~CallData();
+  static_cast<ChannelData*>(elem->channel_data)->CallDone();
 }
 
 void Server::CallData::StartTransportStreamOpBatch(
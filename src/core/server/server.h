@@ -33,7 +33,6 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/hash/hash.h"
-#include "absl/random/random.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
@@ -68,6 +67,7 @@
 #include "src/core/lib/surface/completion_queue.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/lib/transport/transport.h"
+#include "src/core/server/admission_control.h"
 #include "src/core/server/server_interface.h"
 #include "src/core/telemetry/call_tracer.h"
 
@@ -152,6 +152,11 @@ class Server : public ServerInterface,
     return config_fetcher_.get();
   }
 
+  // Returns nullptr unless admission control is enabled in the channel args.
+  ServerAdmissionController* admission_controller() const {
+    return admission_controller_.get();
+  }
+
   ServerCallTracerFactory* server_call_tracer_factory() const override {
     return server_call_tracer_factory_;
   }
@@ -247,6 +252,15 @@ class Server : public ServerInterface,
     RefCountedPtr<Server> server() const { return server_; }
     Channel* channel() const { return channel_.get(); }
     size_t cq_idx() const { return cq_idx_; }
+    // Calls in progress on the channel.
+    size_t active_calls() const {
+      return active_calls_.load(std::memory_order_relaxed);
+    }
+    void CallStarted() {
+      active_calls_.fetch_add(1, std::memory_order_relaxed);
+    }
+    void CallDone() { active_calls_.fetch_sub(1, std::memory_order_relaxed); }
+    Timestamp established() const { return established_; }
 
     // Filter vtable functions.
     static grpc_error_handle InitChannelElement(
@@ -271,6 +285,8 @@ class Server : public ServerInterface,
     absl::optional<std::list<ChannelData*>::iterator> list_position_;
     grpc_closure finish_destroy_channel_closure_;
     intptr_t channelz_socket_uuid_;
+    std::atomic<size_t> active_calls_{0};
+    Timestamp established_;
   };
 
   class CallData {
@@ -388,6 +404,14 @@ class Server : public ServerInterface,
     using is_transparent = void;
   };
 
+  // The registered methods for one path.
+  struct RegisteredMethodsForPath {
+    // The method registered for any host, if any.
+    RegisteredMethod* any_host = nullptr;
+    // Methods registered for specific hosts. Rare, so searched linearly.
+    std::vector<std::pair<absl::string_view, RegisteredMethod*>> by_host;
+  };
+
   class TransportConnectivityWatcher;
 
   RegisteredMethod* GetRegisteredMethod(const absl::string_view& host,
@@ -468,6 +492,7 @@ class Server : public ServerInterface,
   std::vector<grpc_pollset*> pollsets_;
   bool started_ = false;
   const grpc_compression_options compression_options_;
+  const RefCountedPtr<ServerAdmissionController> admission_controller_;
 
   // The two following mutexes control access to server-state.
   // mu_global_ controls access to non-call-related state (e.g., channel state).
@@ -489,6 +514,12 @@ class Server : public ServerInterface,
                       std::unique_ptr<RegisteredMethod>,
                       StringViewStringViewPairHash, StringViewStringViewPairEq>
       registered_methods_;
+  // registered_methods_ indexed by path, built by Start() once no more
+  // methods can be registered. Looking a call up hashes only its path, once,
+  // and does not need to hash the authority unless the path was registered
+  // for specific hosts. Views point into the RegisteredMethod objects.
+  absl::flat_hash_map<absl::string_view, RegisteredMethodsForPath>
+      registered_methods_by_path_;
 
   // Request matcher for unregistered methods.
   std::unique_ptr<RequestMatcherInterface> unregistered_request_matcher_;
@@ -503,7 +534,7 @@ class Server : public ServerInterface,
   bool shutdown_published_ ABSL_GUARDED_BY(mu_global_) = false;
   std::vector<ShutdownTag> shutdown_tags_ ABSL_GUARDED_BY(mu_global_);
 
-  RandomEarlyDetection pending_backlog_protector_ ABSL_GUARDED_BY(mu_call_){
+  const RandomEarlyDetection pending_backlog_protector_{
       static_cast<uint64_t>(
           std::max(0, channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS)
                           .value_or(1000))),
@@ -512,7 +543,12 @@ class Server : public ServerInterface,
           channel_args_.GetInt(GRPC_ARG_SERVER_MAX_PENDING_REQUESTS_HARD_LIMIT)
               .value_or(3000)))};
   const Duration max_time_in_pending_queue_;
-  absl::BitGen bitgen_ ABSL_GUARDED_BY(mu_call_);
+  // Set by GRPC_ARG_SERVER_CQ_CONNECTION_AFFINITY: calls are only matched
+  // to requests of the CQ of their connection.
+  const bool cq_connection_affinity_;
+  // The CQ to bind the next connection that is not polled by any CQ to, with
+  // cq_connection_affinity_.
+  std::atomic<size_t> next_connection_cq_idx_{0};
 
   std::list<ChannelData*> channels_;
   absl::flat_hash_set<OrphanablePtr<ServerTransport>> connections_
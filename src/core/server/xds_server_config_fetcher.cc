@@ -381,6 +381,8 @@ class XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   };
 
   std::vector<VirtualHost> virtual_hosts_;
+  // Index of the domains of virtual_hosts_, if any.
+  std::shared_ptr<const XdsVirtualHostIndex> virtual_host_index_;
 };
 
 // An XdsServerConfigSelectorProvider implementation for when the
@@ -1170,6 +1172,7 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
             XdsListenerResource::HttpConnectionManager::HttpFilter>&
             http_filters) {
   auto config_selector = MakeRefCounted<XdsServerConfigSelector>();
+  config_selector->virtual_host_index_ = rds_update->virtual_host_index;
   for (auto& vhost : rds_update->virtual_hosts) {
     config_selector->virtual_hosts_.emplace_back();
     auto& virtual_host = config_selector->virtual_hosts_.back();
@@ -1225,8 +1228,11 @@ XdsServerConfigFetcher::ListenerWatcher::FilterChainMatchManager::
   }
   absl::string_view authority =
       metadata->get_pointer(HttpAuthorityMetadata())->as_string_view();
-  auto vhost_index = XdsRouting::FindVirtualHostForDomain(
-      VirtualHostListIterator(&virtual_hosts_), authority);
+  auto vhost_index = virtual_host_index_ != nullptr
+                         ? virtual_host_index_->Find(authority)
+                         : XdsRouting::FindVirtualHostForDomain(
+                               VirtualHostListIterator(&virtual_hosts_),
+                               authority);
   if (!vhost_index.has_value()) {
     return absl::UnavailableError(
         absl::StrCat("could not find VirtualHost for ", authority,
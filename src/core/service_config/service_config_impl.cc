@@ -19,6 +19,7 @@
 #include <string.h>
 
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "absl/status/status.h"
@@ -120,21 +121,39 @@ RefCountedPtr<ServiceConfig> ServiceConfigImpl::Create(
   if (method_configs.has_value()) {
     service_config->parsed_method_config_vectors_storage_.reserve(
         method_configs->size());
+    // Large configs often list many method configs that differ only in
+    // their names, so the parsed configs are shared between method configs
+    // whose parameters are identical, keyed by the serialized parameters.
+    std::unordered_map<std::string,
+                       const ServiceConfigParser::ParsedConfigVector*>
+        vectors_by_params;
     for (size_t i = 0; i < method_configs->size(); ++i) {
+      Json::Object params = (*method_configs)[i];
+      params.erase("name");
+      const ServiceConfigParser::ParsedConfigVector*& shared_vector_ptr =
+          vectors_by_params[JsonDump(Json::FromObject(std::move(params)))];
       const Json method_config_json =
           Json::FromObject(std::move((*method_configs)[i]));
       ValidationErrors::ScopedField field(
           errors, absl::StrCat(".methodConfig[", i, "]"));
-      // Have each parser read this method config.
-      auto parsed_configs =
-          CoreConfiguration::Get()
-              .service_config_parser()
-              .ParsePerMethodParameters(args, method_config_json, errors);
-      // Store the parsed configs.
-      service_config->parsed_method_config_vectors_storage_.push_back(
-          std::move(parsed_configs));
       const ServiceConfigParser::ParsedConfigVector* vector_ptr =
-          &service_config->parsed_method_config_vectors_storage_.back();
+          shared_vector_ptr;
+      if (vector_ptr == nullptr) {
+        const size_t num_errors = errors->size();
+        // Have each parser read this method config.
+        auto parsed_configs =
+            CoreConfiguration::Get()
+                .service_config_parser()
+                .ParsePerMethodParameters(args, method_config_json, errors);
+        // Store the parsed configs.
+        service_config->parsed_method_config_vectors_storage_.push_back(
+            std::move(parsed_configs));
+        vector_ptr =
+            &service_config->parsed_method_config_vectors_storage_.back();
+        // Parameters with errors are parsed again for each method config,
+        // so that the errors are reported for all of them.
+        if (errors->size() == num_errors) shared_vector_ptr = vector_ptr;
+      }
       // Parse the names.
       auto method_config =
           LoadFromJson<MethodConfig>(method_config_json, JsonArgs(), errors);
@@ -0,0 +1,111 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_TELEMETRY_CALL_PHASE_TIMESTAMPS_H
+#define GRPC_SRC_CORE_TELEMETRY_CALL_PHASE_TIMESTAMPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <limits>
+
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/resource_quota/arena.h"
+
+namespace grpc_core {
+
+// Monotonic timestamps of the phases of a call, as seen from this side of
+// the call. Each phase is recorded at most once, by whichever layer sees it
+// first, so that a breakdown of where the time of a call went can be read
+// back after (or during) the call.
+//
+// Only calls on channels and servers with GRPC_ARG_CALL_PHASE_TIMESTAMPS set
+// carry one, in their arena.
+class CallPhaseTimestamps {
+ public:
+  enum class Phase : uint8_t {
+    // The transport started parsing the initial metadata of the peer.
+    kFirstByteReceived,
+    // The initial metadata of the peer was parsed.
+    kInitialMetadataReceived,
+    // Server only: the call was handed to the application.
+    kHandlerInvoked,
+    // The initial metadata of this side was written to the wire.
+    kInitialMetadataWritten,
+    // The last frame of this side (trailing metadata on the server, the
+    // half-close on the client) was written to the wire.
+    kEndOfStreamWritten,
+    kCount,
+  };
+
+  CallPhaseTimestamps() {
+    for (auto& nanos : nanos_) nanos.store(kUnset, std::memory_order_relaxed);
+  }
+
+  // Records \a now as the time of \a phase, unless it was already recorded.
+  void Record(Phase phase, gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC)) {
+    int64_t expected = kUnset;
+    nanos_[static_cast<size_t>(phase)].compare_exchange_strong(
+        expected, now.tv_sec * GPR_NS_PER_SEC + now.tv_nsec,
+        std::memory_order_relaxed, std::memory_order_relaxed);
+  }
+
+  // Returns the time \a phase was recorded at, or gpr_inf_past if it was not.
+  gpr_timespec Get(Phase phase) const {
+    const int64_t nanos =
+        nanos_[static_cast<size_t>(phase)].load(std::memory_order_relaxed);
+    if (nanos == kUnset) return gpr_inf_past(GPR_CLOCK_MONOTONIC);
+    return gpr_time_from_nanos(nanos, GPR_CLOCK_MONOTONIC);
+  }
+
+  // Copies the phases into the gpr_timespec fields of the same name of
+  // \a out, e.g. a grpc::experimental::CallPhaseTimestamps.
+  template <typename Timestamps>
+  void ExportTo(Timestamps& out) const {
+    out.first_byte_received = Get(Phase::kFirstByteReceived);
+    out.initial_metadata_received = Get(Phase::kInitialMetadataReceived);
+    out.handler_invoked = Get(Phase::kHandlerInvoked);
+    out.initial_metadata_written = Get(Phase::kInitialMetadataWritten);
+    out.end_of_stream_written = Get(Phase::kEndOfStreamWritten);
+  }
+
+  // Exports the phases of no call: all of them unset.
+  template <typename Timestamps>
+  static void ExportUnsetTo(Timestamps& out) {
+    CallPhaseTimestamps().ExportTo(out);
+  }
+
+ private:
+  static constexpr int64_t kUnset = std::numeric_limits<int64_t>::min();
+
+  std::atomic<int64_t> nanos_[static_cast<size_t>(Phase::kCount)];
+};
+
+template <>
+struct ArenaContextType<CallPhaseTimestamps> {
+  static void Destroy(CallPhaseTimestamps*) {}
+};
+
+// Records \a phase for the call owning \a arena, if it records phases.
+inline void RecordCallPhase(Arena* arena, CallPhaseTimestamps::Phase phase) {
+  auto* timestamps = arena->GetContext<CallPhaseTimestamps>();
+  if (timestamps != nullptr) timestamps->Record(phase);
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_TELEMETRY_CALL_PHASE_TIMESTAMPS_H
@@ -76,6 +76,13 @@ class CallTracerAnnotationInterface {
   // annotations.
   virtual void RecordAnnotation(absl::string_view annotation) = 0;
   virtual void RecordAnnotation(const Annotation& annotation) = 0;
+  // Records the annotation returned by \a make_annotation, which is only
+  // invoked if the call is sampled. Unsampled calls, which drop annotations
+  // anyway, thus never pay for building them.
+  template <typename MakeAnnotation>
+  void RecordLazyAnnotation(MakeAnnotation make_annotation) {
+    if (IsSampled()) RecordAnnotation(make_annotation());
+  }
   virtual std::string TraceId() = 0;
   virtual std::string SpanId() = 0;
   virtual bool IsSampled() = 0;
@@ -15,13 +15,19 @@
 #include "src/core/telemetry/metrics.h"
 
 #include <memory>
+#include <string>
+#include <utility>
 
 #include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
 #include "absl/types/optional.h"
 
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/telemetry/histogram_view.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 namespace grpc_core {
 
@@ -121,14 +127,160 @@ void GlobalStatsPluginRegistry::StatsPluginGroup::AddServerCallTracers(
   }
 }
 
+namespace {
+
+constexpr int kNumGlobalStatsCounters =
+    static_cast<int>(GlobalStats::Counter::COUNT);
+constexpr int kNumGlobalStatsHistograms =
+    static_cast<int>(GlobalStats::Histogram::COUNT);
+
+using GlobalStatsCounterHandle =
+    GlobalInstrumentsRegistry::TypedGlobalInstrumentHandle<
+        GlobalInstrumentsRegistry::ValueType::kInt64,
+        GlobalInstrumentsRegistry::InstrumentType::kCallbackGauge, 0, 0>;
+using GlobalStatsHistogramHandle =
+    GlobalInstrumentsRegistry::TypedGlobalInstrumentHandle<
+        GlobalInstrumentsRegistry::ValueType::kInt64,
+        GlobalInstrumentsRegistry::InstrumentType::kCallbackGauge, 1, 0>;
+
+// The instruments of the counters and histograms of global_stats(), which are
+// registered at startup like any other instrument.
+class GlobalStatsInstruments {
+ public:
+  GlobalStatsInstruments() {
+    names_.reserve(kNumGlobalStatsCounters + kNumGlobalStatsHistograms);
+    for (int i = 0; i < kNumGlobalStatsCounters; ++i) {
+      names_.push_back(
+          absl::StrCat("grpc.core.stats.", GlobalStats::counter_name[i]));
+    }
+    for (int i = 0; i < kNumGlobalStatsHistograms; ++i) {
+      names_.push_back(
+          absl::StrCat("grpc.core.stats.", GlobalStats::histogram_name[i]));
+    }
+    // Instruments keep views of their names, so only register them once
+    // names_ is complete.
+    for (int i = 0; i < kNumGlobalStatsCounters; ++i) {
+      GlobalInstrumentsRegistry::RegisterCallbackInt64Gauge(
+          names_[i], GlobalStats::counter_doc[i], "{count}",
+          /*enable_by_default=*/false)
+          .Build();
+    }
+    GlobalStats stats;
+    for (int i = 0; i < kNumGlobalStatsHistograms; ++i) {
+      GlobalInstrumentsRegistry::RegisterCallbackInt64Gauge(
+          names_[kNumGlobalStatsCounters + i], GlobalStats::histogram_doc[i],
+          "{count}", /*enable_by_default=*/false)
+          .Labels("le")
+          .Build();
+      // Bucket j holds the values in [boundaries[j], boundaries[j + 1]), and
+      // the last one everything above.
+      const HistogramView view =
+          stats.histogram(static_cast<GlobalStats::Histogram>(i));
+      std::vector<std::string>& bounds = bucket_bounds_[i];
+      for (int j = 0; j + 1 < view.num_buckets; ++j) {
+        bounds.push_back(absl::StrCat(view.bucket_boundaries[j + 1] - 1));
+      }
+      bounds.push_back("+Inf");
+    }
+  }
+
+  // Unset once the instrument registry was reset, which only tests do.
+  absl::optional<GlobalStatsCounterHandle> counter(int i) const {
+    return Find<GlobalStatsCounterHandle>(names_[i]);
+  }
+  absl::optional<GlobalStatsHistogramHandle> histogram(int i) const {
+    return Find<GlobalStatsHistogramHandle>(
+        names_[kNumGlobalStatsCounters + i]);
+  }
+  // The `le` label of each bucket of histogram \a i.
+  const std::vector<std::string>& bucket_bounds(int i) const {
+    return bucket_bounds_[i];
+  }
+
+ private:
+  template <typename Handle>
+  static absl::optional<Handle> Find(absl::string_view name) {
+    auto handle = GlobalInstrumentsRegistry::FindInstrumentByName(name);
+    if (!handle.has_value()) return absl::nullopt;
+    Handle typed_handle;
+    typed_handle.index = handle->index;
+    return typed_handle;
+  }
+
+  std::vector<std::string> names_;
+  std::vector<std::string> bucket_bounds_[kNumGlobalStatsHistograms];
+};
+
+NoDestruct<GlobalStatsInstruments> g_global_stats_instruments;
+
+}  // namespace
+
 NoDestruct<Mutex> GlobalStatsPluginRegistry::mutex_;
 NoDestruct<std::vector<std::shared_ptr<StatsPlugin>>>
     GlobalStatsPluginRegistry::plugins_;
+NoDestruct<std::vector<
+    std::unique_ptr<GlobalStatsPluginRegistry::GlobalStatsExport>>>
+    GlobalStatsPluginRegistry::global_stats_exports_;
+
+std::unique_ptr<GlobalStatsPluginRegistry::GlobalStatsExport>
+GlobalStatsPluginRegistry::ExportGlobalStats(
+    std::shared_ptr<StatsPlugin> plugin) {
+  std::vector<GlobalInstrumentsRegistry::GlobalInstrumentHandle> handles;
+  std::vector<std::pair<int, GlobalStatsCounterHandle>> counters;
+  std::vector<std::pair<int, GlobalStatsHistogramHandle>> histograms;
+  for (int i = 0; i < kNumGlobalStatsCounters; ++i) {
+    auto handle = g_global_stats_instruments->counter(i);
+    if (!handle.has_value() || !plugin->IsInstrumentEnabled(*handle)) continue;
+    handles.push_back(*handle);
+    counters.emplace_back(i, *handle);
+  }
+  for (int i = 0; i < kNumGlobalStatsHistograms; ++i) {
+    auto handle = g_global_stats_instruments->histogram(i);
+    if (!handle.has_value() || !plugin->IsInstrumentEnabled(*handle)) continue;
+    handles.push_back(*handle);
+    histograms.emplace_back(i, *handle);
+  }
+  if (handles.empty()) return nullptr;
+  auto global_stats_export = std::make_unique<GlobalStatsExport>();
+  global_stats_export->group.AddStatsPlugin(std::move(plugin), nullptr);
+  // The values are collected from the per-CPU shards of global_stats() only
+  // when the plugin asks for them, so incrementing them costs no more.
+  global_stats_export->callback = std::make_unique<RegisteredMetricCallback>(
+      global_stats_export->group,
+      [counters = std::move(counters), histograms = std::move(histograms)](
+          CallbackMetricReporter& reporter) {
+        std::unique_ptr<GlobalStats> stats = global_stats().Collect();
+        for (const auto& counter : counters) {
+          reporter.Report(
+              counter.second,
+              static_cast<int64_t>(stats->counters[counter.first]), {}, {});
+        }
+        for (const auto& histogram : histograms) {
+          const HistogramView view = stats->histogram(
+              static_cast<GlobalStats::Histogram>(histogram.first));
+          const std::vector<std::string>& bounds =
+              g_global_stats_instruments->bucket_bounds(histogram.first);
+          uint64_t count = 0;
+          for (int i = 0; i < view.num_buckets; ++i) {
+            count += view.buckets[i];
+            reporter.Report(histogram.second, static_cast<int64_t>(count),
+                            {absl::string_view(bounds[i])}, {});
+          }
+        }
+      },
+      std::move(handles), Duration::Seconds(5));
+  return global_stats_export;
+}
 
 void GlobalStatsPluginRegistry::RegisterStatsPlugin(
     std::shared_ptr<StatsPlugin> plugin) {
+  std::unique_ptr<GlobalStatsExport> global_stats_export =
+      ExportGlobalStats(plugin);
   MutexLock lock(&*mutex_);
   plugins_->push_back(std::move(plugin));
+  if (global_stats_export != nullptr) {
+    global_stats_exports_->push_back(std::move(global_stats_export));
+  }
 }
 
 GlobalStatsPluginRegistry::StatsPluginGroup
@@ -501,6 +501,11 @@ class GlobalStatsPluginRegistry {
   };
 
   // Registers a stats plugin with the global stats plugin registry.
+  // The counters and histograms of global_stats() are also reported to the
+  // plugin, as the callback gauges named `grpc.core.stats.<name>` that it
+  // enables (they are disabled by default). A histogram reports, for each
+  // bucket, the number of values less than or equal to the bound in its
+  // `le` label ("+Inf" for the last bucket).
   static void RegisterStatsPlugin(std::shared_ptr<StatsPlugin> plugin);
 
   // The following functions can be invoked to get a StatsPluginGroup for
@@ -512,11 +517,24 @@ class GlobalStatsPluginRegistry {
  private:
   friend class GlobalStatsPluginRegistryTestPeer;
 
+  // Reports global_stats() to a registered stats plugin.
+  struct GlobalStatsExport {
+    StatsPluginGroup group;
+    std::unique_ptr<RegisteredMetricCallback> callback;
+  };
+
   GlobalStatsPluginRegistry() = default;
 
+  // Returns nullptr if \a plugin enables none of the global_stats()
+  // instruments.
+  static std::unique_ptr<GlobalStatsExport> ExportGlobalStats(
+      std::shared_ptr<StatsPlugin> plugin);
+
   static NoDestruct<Mutex> mutex_;
   static NoDestruct<std::vector<std::shared_ptr<StatsPlugin>>> plugins_
       ABSL_GUARDED_BY(mutex_);
+  static NoDestruct<std::vector<std::unique_ptr<GlobalStatsExport>>>
+      global_stats_exports_ ABSL_GUARDED_BY(mutex_);
 };
 
 // A metric callback that is registered with a stats plugin group.
@@ -113,22 +113,50 @@ const absl::string_view
         "client_channels_created",
         "client_subchannels_created",
         "server_channels_created",
+        "server_calls_shed",
         "insecure_connections_created",
         "syscall_write",
         "syscall_read",
         "tcp_read_alloc_8k",
         "tcp_read_alloc_64k",
+        "tcp_read_buffer_shrunk_for_memory_pressure",
+        "slab_allocator_cache_hits",
+        "slab_allocator_cache_misses",
+        "slab_allocator_blocks_released",
+        "tcp_zerocopy_sends",
+        "tcp_zerocopy_fallback_sends",
+        "tcp_zerocopy_copied_completions",
         "http2_settings_writes",
         "http2_pings_sent",
         "http2_writes_begun",
         "http2_transport_stalls",
         "http2_stream_stalls",
+        "http2_window_updates_sent",
+        "http2_window_updates_received",
+        "http2_window_updates_deferred",
+        "http2_recv_data_copied_slices",
+        "http2_recv_coalesced_message_copies",
+        "http2_initial_window_shrunk_for_memory_pressure",
         "cq_pluck_creates",
         "cq_next_creates",
         "cq_callback_creates",
+        "sync_server_threads_created",
+        "sync_server_threads_destroyed",
+        "sync_server_warm_threads_reused",
+        "sync_server_thread_quota_rejections",
         "wrr_updates",
         "work_serializer_items_enqueued",
         "work_serializer_items_dequeued",
+        "subchannel_connectivity_notifications_coalesced",
+        "work_stealing_same_node_steals",
+        "work_stealing_cross_node_steals",
+        "ssl_server_handshakes",
+        "ssl_server_session_resumptions",
+        "ssl_verification_cache_hits",
+        "ssl_verification_cache_misses",
+        "server_handshakes_queued",
+        "server_handshakes_rejected",
+        "native_dns_lookups_coalesced",
         "econnaborted_count",
         "econnreset_count",
         "epipe_count",
@@ -140,6 +168,7 @@ const absl::string_view
         "enobufs_count",
         "uncommon_io_error_count",
         "msg_errqueue_error_count",
+        "party_spurious_wakeups",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -148,12 +177,25 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of client channels created",
     "Number of client subchannels created",
     "Number of server channels created",
+    "Number of server calls rejected by admission control because the server "
+    "was overloaded",
     "Number of insecure connections created",
     "Number of write syscalls (or equivalent - eg sendmsg) made by this "
     "process",
     "Number of read syscalls (or equivalent - eg recvmsg) made by this process",
     "Number of 8k allocations by the TCP subsystem for reading",
     "Number of 64k allocations by the TCP subsystem for reading",
+    "Number of TCP read buffer allocations made smaller than the read target "
+    "because of memory pressure",
+    "Number of memory allocator slices served from a slab allocator cache",
+    "Number of memory allocator slices for which the slab allocator had to "
+    "allocate a new block",
+    "Number of freed slab allocator blocks that did not fit in its caches and "
+    "were returned to the system allocator",
+    "Number of writes sent with MSG_ZEROCOPY",
+    "Number of writes large enough for MSG_ZEROCOPY that were copied instead",
+    "Number of MSG_ZEROCOPY completions for which the kernel copied the data "
+    "anyway",
     "Number of settings frames sent",
     "Number of HTTP2 pings sent by process",
     "Number of HTTP2 writes initiated",
@@ -161,15 +203,48 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "control window",
     "Number of times sending was completely stalled by the stream flow control "
     "window",
+    "Number of HTTP2 WINDOW_UPDATE frames sent",
+    "Number of HTTP2 WINDOW_UPDATE frames received",
+    "Number of times sending a WINDOW_UPDATE was deferred so it could be "
+    "coalesced with a later write",
+    "Number of received message slices holding DATA payload that was copied "
+    "instead of referenced from the read buffers",
+    "Number of large received messages copied into one aligned slice, see "
+    "GRPC_ARG_HTTP2_COALESCED_READ_THRESHOLD_BYTES",
+    "Number of times the HTTP/2 initial window was lowered while under memory "
+    "pressure",
     "Number of completion queues created for cq_pluck (indicates sync api "
     "usage)",
     "Number of completion queues created for cq_next (indicates cq async api "
     "usage)",
     "Number of completion queues created for cq_callback (indicates callback "
     "api usage)",
+    "Number of threads created by C++ sync server thread managers",
+    "Number of C++ sync server thread manager threads that exited",
+    "Number of times a C++ sync server thread manager woke a parked thread "
+    "instead of creating one",
+    "Number of times a C++ sync server thread manager could not get thread "
+    "quota for a new thread",
     "Number of wrr updates that have been received",
     "Number of items enqueued onto work serializers",
     "Number of items dequeued from work serializers",
+    "Number of subchannel connectivity state notifications folded into one "
+    "already queued on the client channel work serializer",
+    "Number of closures an EventEngine thread pool thread stole from another "
+    "thread on its own NUMA node",
+    "Number of closures an EventEngine thread pool thread stole from a thread "
+    "on another NUMA node",
+    "Number of TLS handshakes completed by servers",
+    "Number of TLS handshakes completed by servers that resumed a previous "
+    "session",
+    "Number of TLS peer certificate chains accepted from the verification "
+    "cache",
+    "Number of TLS peer certificate chains verified with the verification "
+    "cache enabled",
+    "Number of server handshakes that waited for the handshake quota to admit "
+    "them",
+    "Number of server handshakes rejected by the handshake quota",
+    "Number of native DNS lookups that joined an identical lookup in flight",
     "Number of ECONNABORTED errors",
     "Number of ECONNRESET errors",
     "Number of EPIPE errors",
@@ -181,6 +256,8 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "Number of ENOBUFS errors",
     "Number of uncommon io errors",
     "Number of uncommon errors returned by MSG_ERRQUEUE",
+    "Number of times a participant of a profiled party was polled again and "
+    "was still pending",
 };
 const absl::string_view
     GlobalStats::histogram_name[static_cast<int>(Histogram::COUNT)] = {
@@ -190,6 +267,12 @@ const absl::string_view
         "tcp_read_size",
         "tcp_read_offer",
         "tcp_read_offer_iov_size",
+        "tcp_zerocopy_completion_latency_us",
+        "tcp_info_rtt_us",
+        "tcp_info_snd_cwnd",
+        "tcp_info_retransmits",
+        "tcp_info_pacing_rate_kib",
+        "tcp_info_delivery_rate_kib",
         "http2_send_message_size",
         "http2_metadata_size",
         "wrr_subchannel_list_size",
@@ -198,6 +281,8 @@ const absl::string_view
         "work_serializer_work_time_ms",
         "work_serializer_work_time_per_item_ms",
         "work_serializer_items_per_run",
+        "server_handshake_queue_time_ms",
+        "native_dns_lookup_latency_ms",
         "chaotic_good_sendmsgs_per_write_control",
         "chaotic_good_recvmsgs_per_read_control",
         "chaotic_good_sendmsgs_per_write_data",
@@ -212,6 +297,12 @@ const absl::string_view
         "chaotic_good_tcp_read_offer_control",
         "chaotic_good_tcp_write_size_data",
         "chaotic_good_tcp_write_size_control",
+        "slab_allocator_wasted_bytes",
+        "call_arena_wasted_bytes",
+        "work_serializer_queue_length",
+        "work_serializer_queue_delay_us",
+        "party_wakeup_to_run_us",
+        "party_polls_per_participant",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
@@ -221,6 +312,12 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes received by each syscall_read",
     "Number of bytes offered to each syscall_read",
     "Number of byte segments offered to each syscall_read",
+    "Microseconds from a MSG_ZEROCOPY sendmsg to its error queue completion",
+    "Smoothed RTT in microseconds of each TCP_INFO sample of a connection",
+    "Congestion window in segments of each TCP_INFO sample of a connection",
+    "Segments retransmitted since the previous TCP_INFO sample of a connection",
+    "Pacing rate in KiB/s of each TCP_INFO sample of a connection",
+    "Delivery rate in KiB/s of each TCP_INFO sample of a connection",
     "Size of messages received by HTTP2 transport",
     "Number of bytes consumed by metadata, according to HPACK accounting rules",
     "Number of subchannels in a subchannel list at picker creation time",
@@ -230,6 +327,8 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "work",
     "How long do individual items take to process in work serializers",
     "How many callbacks are executed when a work serializer runs",
+    "Milliseconds server handshakes waited for the handshake quota",
+    "Milliseconds taken by native DNS lookups, including time queued",
     "Number of sendmsgs per control channel endpoint write",
     "Number of recvmsgs per control channel endpoint read",
     "Number of sendmsgs per data channel endpoint write",
@@ -244,6 +343,16 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of bytes offered to each syscall_read in the control channel",
     "Number of bytes offered to each syscall_write in the data channel",
     "Number of bytes offered to each syscall_write in the control channel",
+    "Number of bytes each slab allocator slice was rounded up by to fit its "
+    "size class",
+    "Number of bytes of the initial arena zone each call left unused",
+    "Number of callbacks queued on a work serializer each time it takes a new "
+    "batch of them",
+    "How many microseconds callbacks wait on a work serializer queue before "
+    "they start running",
+    "How many microseconds a profiled party waits between being woken and "
+    "starting to poll its participants",
+    "Number of polls each participant of a profiled party took to complete",
 };
 namespace {
 const int kStatsTable0[21] = {0,    1,    2,    4,     8,     15,    27,
@@ -411,22 +520,50 @@ GlobalStats::GlobalStats()
       client_channels_created{0},
       client_subchannels_created{0},
       server_channels_created{0},
+      server_calls_shed{0},
       insecure_connections_created{0},
       syscall_write{0},
       syscall_read{0},
       tcp_read_alloc_8k{0},
       tcp_read_alloc_64k{0},
+      tcp_read_buffer_shrunk_for_memory_pressure{0},
+      slab_allocator_cache_hits{0},
+      slab_allocator_cache_misses{0},
+      slab_allocator_blocks_released{0},
+      tcp_zerocopy_sends{0},
+      tcp_zerocopy_fallback_sends{0},
+      tcp_zerocopy_copied_completions{0},
       http2_settings_writes{0},
       http2_pings_sent{0},
       http2_writes_begun{0},
       http2_transport_stalls{0},
       http2_stream_stalls{0},
+      http2_window_updates_sent{0},
+      http2_window_updates_received{0},
+      http2_window_updates_deferred{0},
+      http2_recv_data_copied_slices{0},
+      http2_recv_coalesced_message_copies{0},
+      http2_initial_window_shrunk_for_memory_pressure{0},
       cq_pluck_creates{0},
       cq_next_creates{0},
       cq_callback_creates{0},
+      sync_server_threads_created{0},
+      sync_server_threads_destroyed{0},
+      sync_server_warm_threads_reused{0},
+      sync_server_thread_quota_rejections{0},
       wrr_updates{0},
       work_serializer_items_enqueued{0},
       work_serializer_items_dequeued{0},
+      subchannel_connectivity_notifications_coalesced{0},
+      work_stealing_same_node_steals{0},
+      work_stealing_cross_node_steals{0},
+      ssl_server_handshakes{0},
+      ssl_server_session_resumptions{0},
+      ssl_verification_cache_hits{0},
+      ssl_verification_cache_misses{0},
+      server_handshakes_queued{0},
+      server_handshakes_rejected{0},
+      native_dns_lookups_coalesced{0},
       econnaborted_count{0},
       econnreset_count{0},
       epipe_count{0},
@@ -437,7 +574,8 @@ GlobalStats::GlobalStats()
       enotconn_count{0},
       enobufs_count{0},
       uncommon_io_error_count{0},
-      msg_errqueue_error_count{0} {}
+      msg_errqueue_error_count{0},
+      party_spurious_wakeups{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -460,6 +598,24 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kTcpReadOfferIovSize:
       return HistogramView{&Histogram_80_10::BucketFor, kStatsTable8, 10,
                            tcp_read_offer_iov_size.buckets()};
+    case Histogram::kTcpZerocopyCompletionLatencyUs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           tcp_zerocopy_completion_latency_us.buckets()};
+    case Histogram::kTcpInfoRttUs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           tcp_info_rtt_us.buckets()};
+    case Histogram::kTcpInfoSndCwnd:
+      return HistogramView{&Histogram_10000_20::BucketFor, kStatsTable10, 20,
+                           tcp_info_snd_cwnd.buckets()};
+    case Histogram::kTcpInfoRetransmits:
+      return HistogramView{&Histogram_10000_20::BucketFor, kStatsTable10, 20,
+                           tcp_info_retransmits.buckets()};
+    case Histogram::kTcpInfoPacingRateKib:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
+                           tcp_info_pacing_rate_kib.buckets()};
+    case Histogram::kTcpInfoDeliveryRateKib:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
+                           tcp_info_delivery_rate_kib.buckets()};
     case Histogram::kHttp2SendMessageSize:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
                            http2_send_message_size.buckets()};
@@ -484,6 +640,12 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kWorkSerializerItemsPerRun:
       return HistogramView{&Histogram_10000_20::BucketFor, kStatsTable10, 20,
                            work_serializer_items_per_run.buckets()};
+    case Histogram::kServerHandshakeQueueTimeMs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           server_handshake_queue_time_ms.buckets()};
+    case Histogram::kNativeDnsLookupLatencyMs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           native_dns_lookup_latency_ms.buckets()};
     case Histogram::kChaoticGoodSendmsgsPerWriteControl:
       return HistogramView{&Histogram_100_20::BucketFor, kStatsTable4, 20,
                            chaotic_good_sendmsgs_per_write_control.buckets()};
@@ -527,6 +689,24 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kChaoticGoodTcpWriteSizeControl:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable6, 20,
                            chaotic_good_tcp_write_size_control.buckets()};
+    case Histogram::kSlabAllocatorWastedBytes:
+      return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable2, 26,
+                           slab_allocator_wasted_bytes.buckets()};
+    case Histogram::kCallArenaWastedBytes:
+      return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable2, 26,
+                           call_arena_wasted_bytes.buckets()};
+    case Histogram::kWorkSerializerQueueLength:
+      return HistogramView{&Histogram_10000_20::BucketFor, kStatsTable10, 20,
+                           work_serializer_queue_length.buckets()};
+    case Histogram::kWorkSerializerQueueDelayUs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           work_serializer_queue_delay_us.buckets()};
+    case Histogram::kPartyWakeupToRunUs:
+      return HistogramView{&Histogram_100000_20::BucketFor, kStatsTable0, 20,
+                           party_wakeup_to_run_us.buckets()};
+    case Histogram::kPartyPollsPerParticipant:
+      return HistogramView{&Histogram_10000_20::BucketFor, kStatsTable10, 20,
+                           party_polls_per_participant.buckets()};
   }
 }
 std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
@@ -542,6 +722,8 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.client_subchannels_created.load(std::memory_order_relaxed);
     result->server_channels_created +=
         data.server_channels_created.load(std::memory_order_relaxed);
+    result->server_calls_shed +=
+        data.server_calls_shed.load(std::memory_order_relaxed);
     result->insecure_connections_created +=
         data.insecure_connections_created.load(std::memory_order_relaxed);
     result->syscall_write += data.syscall_write.load(std::memory_order_relaxed);
@@ -550,6 +732,21 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.tcp_read_alloc_8k.load(std::memory_order_relaxed);
     result->tcp_read_alloc_64k +=
         data.tcp_read_alloc_64k.load(std::memory_order_relaxed);
+    result->tcp_read_buffer_shrunk_for_memory_pressure +=
+        data.tcp_read_buffer_shrunk_for_memory_pressure.load(
+            std::memory_order_relaxed);
+    result->slab_allocator_cache_hits +=
+        data.slab_allocator_cache_hits.load(std::memory_order_relaxed);
+    result->slab_allocator_cache_misses +=
+        data.slab_allocator_cache_misses.load(std::memory_order_relaxed);
+    result->slab_allocator_blocks_released +=
+        data.slab_allocator_blocks_released.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_sends +=
+        data.tcp_zerocopy_sends.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_fallback_sends +=
+        data.tcp_zerocopy_fallback_sends.load(std::memory_order_relaxed);
+    result->tcp_zerocopy_copied_completions +=
+        data.tcp_zerocopy_copied_completions.load(std::memory_order_relaxed);
     result->http2_settings_writes +=
         data.http2_settings_writes.load(std::memory_order_relaxed);
     result->http2_pings_sent +=
@@ -560,17 +757,61 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.http2_transport_stalls.load(std::memory_order_relaxed);
     result->http2_stream_stalls +=
         data.http2_stream_stalls.load(std::memory_order_relaxed);
+    result->http2_window_updates_sent +=
+        data.http2_window_updates_sent.load(std::memory_order_relaxed);
+    result->http2_window_updates_received +=
+        data.http2_window_updates_received.load(std::memory_order_relaxed);
+    result->http2_window_updates_deferred +=
+        data.http2_window_updates_deferred.load(std::memory_order_relaxed);
+    result->http2_recv_data_copied_slices +=
+        data.http2_recv_data_copied_slices.load(std::memory_order_relaxed);
+    result->http2_recv_coalesced_message_copies +=
+        data.http2_recv_coalesced_message_copies.load(
+            std::memory_order_relaxed);
+    result->http2_initial_window_shrunk_for_memory_pressure +=
+        data.http2_initial_window_shrunk_for_memory_pressure.load(
+            std::memory_order_relaxed);
     result->cq_pluck_creates +=
         data.cq_pluck_creates.load(std::memory_order_relaxed);
     result->cq_next_creates +=
         data.cq_next_creates.load(std::memory_order_relaxed);
     result->cq_callback_creates +=
         data.cq_callback_creates.load(std::memory_order_relaxed);
+    result->sync_server_threads_created +=
+        data.sync_server_threads_created.load(std::memory_order_relaxed);
+    result->sync_server_threads_destroyed +=
+        data.sync_server_threads_destroyed.load(std::memory_order_relaxed);
+    result->sync_server_warm_threads_reused +=
+        data.sync_server_warm_threads_reused.load(std::memory_order_relaxed);
+    result->sync_server_thread_quota_rejections +=
+        data.sync_server_thread_quota_rejections.load(
+            std::memory_order_relaxed);
     result->wrr_updates += data.wrr_updates.load(std::memory_order_relaxed);
     result->work_serializer_items_enqueued +=
         data.work_serializer_items_enqueued.load(std::memory_order_relaxed);
     result->work_serializer_items_dequeued +=
         data.work_serializer_items_dequeued.load(std::memory_order_relaxed);
+    result->subchannel_connectivity_notifications_coalesced +=
+        data.subchannel_connectivity_notifications_coalesced.load(
+            std::memory_order_relaxed);
+    result->work_stealing_same_node_steals +=
+        data.work_stealing_same_node_steals.load(std::memory_order_relaxed);
+    result->work_stealing_cross_node_steals +=
+        data.work_stealing_cross_node_steals.load(std::memory_order_relaxed);
+    result->ssl_server_handshakes +=
+        data.ssl_server_handshakes.load(std::memory_order_relaxed);
+    result->ssl_server_session_resumptions +=
+        data.ssl_server_session_resumptions.load(std::memory_order_relaxed);
+    result->ssl_verification_cache_hits +=
+        data.ssl_verification_cache_hits.load(std::memory_order_relaxed);
+    result->ssl_verification_cache_misses +=
+        data.ssl_verification_cache_misses.load(std::memory_order_relaxed);
+    result->server_handshakes_queued +=
+        data.server_handshakes_queued.load(std::memory_order_relaxed);
+    result->server_handshakes_rejected +=
+        data.server_handshakes_rejected.load(std::memory_order_relaxed);
+    result->native_dns_lookups_coalesced +=
+        data.native_dns_lookups_coalesced.load(std::memory_order_relaxed);
     result->econnaborted_count +=
         data.econnaborted_count.load(std::memory_order_relaxed);
     result->econnreset_count +=
@@ -590,12 +831,22 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.uncommon_io_error_count.load(std::memory_order_relaxed);
     result->msg_errqueue_error_count +=
         data.msg_errqueue_error_count.load(std::memory_order_relaxed);
+    result->party_spurious_wakeups +=
+        data.party_spurious_wakeups.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
     data.tcp_read_size.Collect(&result->tcp_read_size);
     data.tcp_read_offer.Collect(&result->tcp_read_offer);
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
+    data.tcp_zerocopy_completion_latency_us.Collect(
+        &result->tcp_zerocopy_completion_latency_us);
+    data.tcp_info_rtt_us.Collect(&result->tcp_info_rtt_us);
+    data.tcp_info_snd_cwnd.Collect(&result->tcp_info_snd_cwnd);
+    data.tcp_info_retransmits.Collect(&result->tcp_info_retransmits);
+    data.tcp_info_pacing_rate_kib.Collect(&result->tcp_info_pacing_rate_kib);
+    data.tcp_info_delivery_rate_kib.Collect(
+        &result->tcp_info_delivery_rate_kib);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
     data.http2_metadata_size.Collect(&result->http2_metadata_size);
     data.wrr_subchannel_list_size.Collect(&result->wrr_subchannel_list_size);
@@ -608,6 +859,10 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->work_serializer_work_time_per_item_ms);
     data.work_serializer_items_per_run.Collect(
         &result->work_serializer_items_per_run);
+    data.server_handshake_queue_time_ms.Collect(
+        &result->server_handshake_queue_time_ms);
+    data.native_dns_lookup_latency_ms.Collect(
+        &result->native_dns_lookup_latency_ms);
     data.chaotic_good_sendmsgs_per_write_control.Collect(
         &result->chaotic_good_sendmsgs_per_write_control);
     data.chaotic_good_recvmsgs_per_read_control.Collect(
@@ -636,6 +891,16 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         &result->chaotic_good_tcp_write_size_data);
     data.chaotic_good_tcp_write_size_control.Collect(
         &result->chaotic_good_tcp_write_size_control);
+    data.slab_allocator_wasted_bytes.Collect(
+        &result->slab_allocator_wasted_bytes);
+    data.call_arena_wasted_bytes.Collect(&result->call_arena_wasted_bytes);
+    data.work_serializer_queue_length.Collect(
+        &result->work_serializer_queue_length);
+    data.work_serializer_queue_delay_us.Collect(
+        &result->work_serializer_queue_delay_us);
+    data.party_wakeup_to_run_us.Collect(&result->party_wakeup_to_run_us);
+    data.party_polls_per_participant.Collect(
+        &result->party_polls_per_participant);
   }
   return result;
 }
@@ -651,12 +916,27 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       client_subchannels_created - other.client_subchannels_created;
   result->server_channels_created =
       server_channels_created - other.server_channels_created;
+  result->server_calls_shed = server_calls_shed - other.server_calls_shed;
   result->insecure_connections_created =
       insecure_connections_created - other.insecure_connections_created;
   result->syscall_write = syscall_write - other.syscall_write;
   result->syscall_read = syscall_read - other.syscall_read;
   result->tcp_read_alloc_8k = tcp_read_alloc_8k - other.tcp_read_alloc_8k;
   result->tcp_read_alloc_64k = tcp_read_alloc_64k - other.tcp_read_alloc_64k;
+  result->tcp_read_buffer_shrunk_for_memory_pressure =
+      tcp_read_buffer_shrunk_for_memory_pressure -
+      other.tcp_read_buffer_shrunk_for_memory_pressure;
+  result->slab_allocator_cache_hits =
+      slab_allocator_cache_hits - other.slab_allocator_cache_hits;
+  result->slab_allocator_cache_misses =
+      slab_allocator_cache_misses - other.slab_allocator_cache_misses;
+  result->slab_allocator_blocks_released =
+      slab_allocator_blocks_released - other.slab_allocator_blocks_released;
+  result->tcp_zerocopy_sends = tcp_zerocopy_sends - other.tcp_zerocopy_sends;
+  result->tcp_zerocopy_fallback_sends =
+      tcp_zerocopy_fallback_sends - other.tcp_zerocopy_fallback_sends;
+  result->tcp_zerocopy_copied_completions =
+      tcp_zerocopy_copied_completions - other.tcp_zerocopy_copied_completions;
   result->http2_settings_writes =
       http2_settings_writes - other.http2_settings_writes;
   result->http2_pings_sent = http2_pings_sent - other.http2_pings_sent;
@@ -664,14 +944,58 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->http2_transport_stalls =
       http2_transport_stalls - other.http2_transport_stalls;
   result->http2_stream_stalls = http2_stream_stalls - other.http2_stream_stalls;
+  result->http2_window_updates_sent =
+      http2_window_updates_sent - other.http2_window_updates_sent;
+  result->http2_window_updates_received =
+      http2_window_updates_received - other.http2_window_updates_received;
+  result->http2_window_updates_deferred =
+      http2_window_updates_deferred - other.http2_window_updates_deferred;
+  result->http2_recv_data_copied_slices =
+      http2_recv_data_copied_slices - other.http2_recv_data_copied_slices;
+  result->http2_recv_coalesced_message_copies =
+      http2_recv_coalesced_message_copies -
+      other.http2_recv_coalesced_message_copies;
+  result->http2_initial_window_shrunk_for_memory_pressure =
+      http2_initial_window_shrunk_for_memory_pressure -
+      other.http2_initial_window_shrunk_for_memory_pressure;
   result->cq_pluck_creates = cq_pluck_creates - other.cq_pluck_creates;
   result->cq_next_creates = cq_next_creates - other.cq_next_creates;
   result->cq_callback_creates = cq_callback_creates - other.cq_callback_creates;
+  result->sync_server_threads_created =
+      sync_server_threads_created - other.sync_server_threads_created;
+  result->sync_server_threads_destroyed =
+      sync_server_threads_destroyed - other.sync_server_threads_destroyed;
+  result->sync_server_warm_threads_reused =
+      sync_server_warm_threads_reused - other.sync_server_warm_threads_reused;
+  result->sync_server_thread_quota_rejections =
+      sync_server_thread_quota_rejections -
+      other.sync_server_thread_quota_rejections;
   result->wrr_updates = wrr_updates - other.wrr_updates;
   result->work_serializer_items_enqueued =
       work_serializer_items_enqueued - other.work_serializer_items_enqueued;
   result->work_serializer_items_dequeued =
       work_serializer_items_dequeued - other.work_serializer_items_dequeued;
+  result->subchannel_connectivity_notifications_coalesced =
+      subchannel_connectivity_notifications_coalesced -
+      other.subchannel_connectivity_notifications_coalesced;
+  result->work_stealing_same_node_steals =
+      work_stealing_same_node_steals - other.work_stealing_same_node_steals;
+  result->work_stealing_cross_node_steals =
+      work_stealing_cross_node_steals - other.work_stealing_cross_node_steals;
+  result->ssl_server_handshakes =
+      ssl_server_handshakes - other.ssl_server_handshakes;
+  result->ssl_server_session_resumptions =
+      ssl_server_session_resumptions - other.ssl_server_session_resumptions;
+  result->ssl_verification_cache_hits =
+      ssl_verification_cache_hits - other.ssl_verification_cache_hits;
+  result->ssl_verification_cache_misses =
+      ssl_verification_cache_misses - other.ssl_verification_cache_misses;
+  result->server_handshakes_queued =
+      server_handshakes_queued - other.server_handshakes_queued;
+  result->server_handshakes_rejected =
+      server_handshakes_rejected - other.server_handshakes_rejected;
+  result->native_dns_lookups_coalesced =
+      native_dns_lookups_coalesced - other.native_dns_lookups_coalesced;
   result->econnaborted_count = econnaborted_count - other.econnaborted_count;
   result->econnreset_count = econnreset_count - other.econnreset_count;
   result->epipe_count = epipe_count - other.epipe_count;
@@ -685,6 +1009,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       uncommon_io_error_count - other.uncommon_io_error_count;
   result->msg_errqueue_error_count =
       msg_errqueue_error_count - other.msg_errqueue_error_count;
+  result->party_spurious_wakeups =
+      party_spurious_wakeups - other.party_spurious_wakeups;
   result->call_initial_size = call_initial_size - other.call_initial_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
@@ -692,6 +1018,17 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->tcp_read_offer = tcp_read_offer - other.tcp_read_offer;
   result->tcp_read_offer_iov_size =
       tcp_read_offer_iov_size - other.tcp_read_offer_iov_size;
+  result->tcp_zerocopy_completion_latency_us =
+      tcp_zerocopy_completion_latency_us -
+      other.tcp_zerocopy_completion_latency_us;
+  result->tcp_info_rtt_us = tcp_info_rtt_us - other.tcp_info_rtt_us;
+  result->tcp_info_snd_cwnd = tcp_info_snd_cwnd - other.tcp_info_snd_cwnd;
+  result->tcp_info_retransmits =
+      tcp_info_retransmits - other.tcp_info_retransmits;
+  result->tcp_info_pacing_rate_kib =
+      tcp_info_pacing_rate_kib - other.tcp_info_pacing_rate_kib;
+  result->tcp_info_delivery_rate_kib =
+      tcp_info_delivery_rate_kib - other.tcp_info_delivery_rate_kib;
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
   result->http2_metadata_size = http2_metadata_size - other.http2_metadata_size;
@@ -708,6 +1045,10 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
       other.work_serializer_work_time_per_item_ms;
   result->work_serializer_items_per_run =
       work_serializer_items_per_run - other.work_serializer_items_per_run;
+  result->server_handshake_queue_time_ms =
+      server_handshake_queue_time_ms - other.server_handshake_queue_time_ms;
+  result->native_dns_lookup_latency_ms =
+      native_dns_lookup_latency_ms - other.native_dns_lookup_latency_ms;
   result->chaotic_good_sendmsgs_per_write_control =
       chaotic_good_sendmsgs_per_write_control -
       other.chaotic_good_sendmsgs_per_write_control;
@@ -747,6 +1088,18 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->chaotic_good_tcp_write_size_control =
       chaotic_good_tcp_write_size_control -
       other.chaotic_good_tcp_write_size_control;
+  result->slab_allocator_wasted_bytes =
+      slab_allocator_wasted_bytes - other.slab_allocator_wasted_bytes;
+  result->call_arena_wasted_bytes =
+      call_arena_wasted_bytes - other.call_arena_wasted_bytes;
+  result->work_serializer_queue_length =
+      work_serializer_queue_length - other.work_serializer_queue_length;
+  result->work_serializer_queue_delay_us =
+      work_serializer_queue_delay_us - other.work_serializer_queue_delay_us;
+  result->party_wakeup_to_run_us =
+      party_wakeup_to_run_us - other.party_wakeup_to_run_us;
+  result->party_polls_per_participant =
+      party_polls_per_participant - other.party_polls_per_participant;
   return result;
 }
 }  // namespace grpc_core
@@ -175,22 +175,50 @@ struct GlobalStats {
     kClientChannelsCreated,
     kClientSubchannelsCreated,
     kServerChannelsCreated,
+    kServerCallsShed,
     kInsecureConnectionsCreated,
     kSyscallWrite,
     kSyscallRead,
     kTcpReadAlloc8k,
     kTcpReadAlloc64k,
+    kTcpReadBufferShrunkForMemoryPressure,
+    kSlabAllocatorCacheHits,
+    kSlabAllocatorCacheMisses,
+    kSlabAllocatorBlocksReleased,
+    kTcpZerocopySends,
+    kTcpZerocopyFallbackSends,
+    kTcpZerocopyCopiedCompletions,
     kHttp2SettingsWrites,
     kHttp2PingsSent,
     kHttp2WritesBegun,
     kHttp2TransportStalls,
     kHttp2StreamStalls,
+    kHttp2WindowUpdatesSent,
+    kHttp2WindowUpdatesReceived,
+    kHttp2WindowUpdatesDeferred,
+    kHttp2RecvDataCopiedSlices,
+    kHttp2RecvCoalescedMessageCopies,
+    kHttp2InitialWindowShrunkForMemoryPressure,
     kCqPluckCreates,
     kCqNextCreates,
     kCqCallbackCreates,
+    kSyncServerThreadsCreated,
+    kSyncServerThreadsDestroyed,
+    kSyncServerWarmThreadsReused,
+    kSyncServerThreadQuotaRejections,
     kWrrUpdates,
     kWorkSerializerItemsEnqueued,
     kWorkSerializerItemsDequeued,
+    kSubchannelConnectivityNotificationsCoalesced,
+    kWorkStealingSameNodeSteals,
+    kWorkStealingCrossNodeSteals,
+    kSslServerHandshakes,
+    kSslServerSessionResumptions,
+    kSslVerificationCacheHits,
+    kSslVerificationCacheMisses,
+    kServerHandshakesQueued,
+    kServerHandshakesRejected,
+    kNativeDnsLookupsCoalesced,
     kEconnabortedCount,
     kEconnresetCount,
     kEpipeCount,
@@ -202,6 +230,7 @@ struct GlobalStats {
     kEnobufsCount,
     kUncommonIoErrorCount,
     kMsgErrqueueErrorCount,
+    kPartySpuriousWakeups,
     COUNT
   };
   enum class Histogram {
@@ -211,6 +240,12 @@ struct GlobalStats {
     kTcpReadSize,
     kTcpReadOffer,
     kTcpReadOfferIovSize,
+    kTcpZerocopyCompletionLatencyUs,
+    kTcpInfoRttUs,
+    kTcpInfoSndCwnd,
+    kTcpInfoRetransmits,
+    kTcpInfoPacingRateKib,
+    kTcpInfoDeliveryRateKib,
     kHttp2SendMessageSize,
     kHttp2MetadataSize,
     kWrrSubchannelListSize,
@@ -219,6 +254,8 @@ struct GlobalStats {
     kWorkSerializerWorkTimeMs,
     kWorkSerializerWorkTimePerItemMs,
     kWorkSerializerItemsPerRun,
+    kServerHandshakeQueueTimeMs,
+    kNativeDnsLookupLatencyMs,
     kChaoticGoodSendmsgsPerWriteControl,
     kChaoticGoodRecvmsgsPerReadControl,
     kChaoticGoodSendmsgsPerWriteData,
@@ -233,6 +270,12 @@ struct GlobalStats {
     kChaoticGoodTcpReadOfferControl,
     kChaoticGoodTcpWriteSizeData,
     kChaoticGoodTcpWriteSizeControl,
+    kSlabAllocatorWastedBytes,
+    kCallArenaWastedBytes,
+    kWorkSerializerQueueLength,
+    kWorkSerializerQueueDelayUs,
+    kPartyWakeupToRunUs,
+    kPartyPollsPerParticipant,
     COUNT
   };
   GlobalStats();
@@ -249,22 +292,50 @@ struct GlobalStats {
       uint64_t client_channels_created;
       uint64_t client_subchannels_created;
       uint64_t server_channels_created;
+      uint64_t server_calls_shed;
       uint64_t insecure_connections_created;
       uint64_t syscall_write;
       uint64_t syscall_read;
       uint64_t tcp_read_alloc_8k;
       uint64_t tcp_read_alloc_64k;
+      uint64_t tcp_read_buffer_shrunk_for_memory_pressure;
+      uint64_t slab_allocator_cache_hits;
+      uint64_t slab_allocator_cache_misses;
+      uint64_t slab_allocator_blocks_released;
+      uint64_t tcp_zerocopy_sends;
+      uint64_t tcp_zerocopy_fallback_sends;
+      uint64_t tcp_zerocopy_copied_completions;
       uint64_t http2_settings_writes;
       uint64_t http2_pings_sent;
       uint64_t http2_writes_begun;
       uint64_t http2_transport_stalls;
       uint64_t http2_stream_stalls;
+      uint64_t http2_window_updates_sent;
+      uint64_t http2_window_updates_received;
+      uint64_t http2_window_updates_deferred;
+      uint64_t http2_recv_data_copied_slices;
+      uint64_t http2_recv_coalesced_message_copies;
+      uint64_t http2_initial_window_shrunk_for_memory_pressure;
       uint64_t cq_pluck_creates;
       uint64_t cq_next_creates;
       uint64_t cq_callback_creates;
+      uint64_t sync_server_threads_created;
+      uint64_t sync_server_threads_destroyed;
+      uint64_t sync_server_warm_threads_reused;
+      uint64_t sync_server_thread_quota_rejections;
       uint64_t wrr_updates;
       uint64_t work_serializer_items_enqueued;
       uint64_t work_serializer_items_dequeued;
+      uint64_t subchannel_connectivity_notifications_coalesced;
+      uint64_t work_stealing_same_node_steals;
+      uint64_t work_stealing_cross_node_steals;
+      uint64_t ssl_server_handshakes;
+      uint64_t ssl_server_session_resumptions;
+      uint64_t ssl_verification_cache_hits;
+      uint64_t ssl_verification_cache_misses;
+      uint64_t server_handshakes_queued;
+      uint64_t server_handshakes_rejected;
+      uint64_t native_dns_lookups_coalesced;
       uint64_t econnaborted_count;
       uint64_t econnreset_count;
       uint64_t epipe_count;
@@ -276,6 +347,7 @@ struct GlobalStats {
       uint64_t enobufs_count;
       uint64_t uncommon_io_error_count;
       uint64_t msg_errqueue_error_count;
+      uint64_t party_spurious_wakeups;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
@@ -285,6 +357,12 @@ struct GlobalStats {
   Histogram_16777216_20 tcp_read_size;
   Histogram_16777216_20 tcp_read_offer;
   Histogram_80_10 tcp_read_offer_iov_size;
+  Histogram_100000_20 tcp_zerocopy_completion_latency_us;
+  Histogram_100000_20 tcp_info_rtt_us;
+  Histogram_10000_20 tcp_info_snd_cwnd;
+  Histogram_10000_20 tcp_info_retransmits;
+  Histogram_16777216_20 tcp_info_pacing_rate_kib;
+  Histogram_16777216_20 tcp_info_delivery_rate_kib;
   Histogram_16777216_20 http2_send_message_size;
   Histogram_65536_26 http2_metadata_size;
   Histogram_10000_20 wrr_subchannel_list_size;
@@ -293,6 +371,8 @@ struct GlobalStats {
   Histogram_100000_20 work_serializer_work_time_ms;
   Histogram_100000_20 work_serializer_work_time_per_item_ms;
   Histogram_10000_20 work_serializer_items_per_run;
+  Histogram_100000_20 server_handshake_queue_time_ms;
+  Histogram_100000_20 native_dns_lookup_latency_ms;
   Histogram_100_20 chaotic_good_sendmsgs_per_write_control;
   Histogram_100_20 chaotic_good_recvmsgs_per_read_control;
   Histogram_100_20 chaotic_good_sendmsgs_per_write_data;
@@ -307,6 +387,12 @@ struct GlobalStats {
   Histogram_16777216_20 chaotic_good_tcp_read_offer_control;
   Histogram_16777216_20 chaotic_good_tcp_write_size_data;
   Histogram_16777216_20 chaotic_good_tcp_write_size_control;
+  Histogram_65536_26 slab_allocator_wasted_bytes;
+  Histogram_65536_26 call_arena_wasted_bytes;
+  Histogram_10000_20 work_serializer_queue_length;
+  Histogram_100000_20 work_serializer_queue_delay_us;
+  Histogram_100000_20 party_wakeup_to_run_us;
+  Histogram_10000_20 party_polls_per_participant;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -333,6 +419,9 @@ class GlobalStatsCollector {
     data_.this_cpu().server_channels_created.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementServerCallsShed() {
+    data_.this_cpu().server_calls_shed.fetch_add(1, std::memory_order_relaxed);
+  }
   void IncrementInsecureConnectionsCreated() {
     data_.this_cpu().insecure_connections_created.fetch_add(
         1, std::memory_order_relaxed);
@@ -349,6 +438,33 @@ class GlobalStatsCollector {
   void IncrementTcpReadAlloc64k() {
     data_.this_cpu().tcp_read_alloc_64k.fetch_add(1, std::memory_order_relaxed);
   }
+  void IncrementTcpReadBufferShrunkForMemoryPressure() {
+    data_.this_cpu().tcp_read_buffer_shrunk_for_memory_pressure.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSlabAllocatorCacheHits() {
+    data_.this_cpu().slab_allocator_cache_hits.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSlabAllocatorCacheMisses() {
+    data_.this_cpu().slab_allocator_cache_misses.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSlabAllocatorBlocksReleased() {
+    data_.this_cpu().slab_allocator_blocks_released.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopySends() {
+    data_.this_cpu().tcp_zerocopy_sends.fetch_add(1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopyFallbackSends() {
+    data_.this_cpu().tcp_zerocopy_fallback_sends.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTcpZerocopyCopiedCompletions() {
+    data_.this_cpu().tcp_zerocopy_copied_completions.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementHttp2SettingsWrites() {
     data_.this_cpu().http2_settings_writes.fetch_add(1,
                                                      std::memory_order_relaxed);
@@ -367,6 +483,30 @@ class GlobalStatsCollector {
     data_.this_cpu().http2_stream_stalls.fetch_add(1,
                                                    std::memory_order_relaxed);
   }
+  void IncrementHttp2WindowUpdatesSent() {
+    data_.this_cpu().http2_window_updates_sent.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2WindowUpdatesReceived() {
+    data_.this_cpu().http2_window_updates_received.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2WindowUpdatesDeferred() {
+    data_.this_cpu().http2_window_updates_deferred.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2RecvDataCopiedSlices() {
+    data_.this_cpu().http2_recv_data_copied_slices.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2RecvCoalescedMessageCopies() {
+    data_.this_cpu().http2_recv_coalesced_message_copies.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementHttp2InitialWindowShrunkForMemoryPressure() {
+    data_.this_cpu().http2_initial_window_shrunk_for_memory_pressure.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCqPluckCreates() {
     data_.this_cpu().cq_pluck_creates.fetch_add(1, std::memory_order_relaxed);
   }
@@ -377,6 +517,22 @@ class GlobalStatsCollector {
     data_.this_cpu().cq_callback_creates.fetch_add(1,
                                                    std::memory_order_relaxed);
   }
+  void IncrementSyncServerThreadsCreated() {
+    data_.this_cpu().sync_server_threads_created.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSyncServerThreadsDestroyed() {
+    data_.this_cpu().sync_server_threads_destroyed.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSyncServerWarmThreadsReused() {
+    data_.this_cpu().sync_server_warm_threads_reused.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSyncServerThreadQuotaRejections() {
+    data_.this_cpu().sync_server_thread_quota_rejections.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementWrrUpdates() {
     data_.this_cpu().wrr_updates.fetch_add(1, std::memory_order_relaxed);
   }
@@ -388,6 +544,46 @@ class GlobalStatsCollector {
     data_.this_cpu().work_serializer_items_dequeued.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementSubchannelConnectivityNotificationsCoalesced() {
+    data_.this_cpu().subchannel_connectivity_notifications_coalesced.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementWorkStealingSameNodeSteals() {
+    data_.this_cpu().work_stealing_same_node_steals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementWorkStealingCrossNodeSteals() {
+    data_.this_cpu().work_stealing_cross_node_steals.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslServerHandshakes() {
+    data_.this_cpu().ssl_server_handshakes.fetch_add(1,
+                                                     std::memory_order_relaxed);
+  }
+  void IncrementSslServerSessionResumptions() {
+    data_.this_cpu().ssl_server_session_resumptions.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslVerificationCacheHits() {
+    data_.this_cpu().ssl_verification_cache_hits.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementSslVerificationCacheMisses() {
+    data_.this_cpu().ssl_verification_cache_misses.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementServerHandshakesQueued() {
+    data_.this_cpu().server_handshakes_queued.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementServerHandshakesRejected() {
+    data_.this_cpu().server_handshakes_rejected.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementNativeDnsLookupsCoalesced() {
+    data_.this_cpu().native_dns_lookups_coalesced.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementEconnabortedCount() {
     data_.this_cpu().econnaborted_count.fetch_add(1, std::memory_order_relaxed);
   }
@@ -423,6 +619,10 @@ class GlobalStatsCollector {
     data_.this_cpu().msg_errqueue_error_count.fetch_add(
         1, std::memory_order_relaxed);
   }
+  void IncrementPartySpuriousWakeups() {
+    data_.this_cpu().party_spurious_wakeups.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
@@ -441,6 +641,24 @@ class GlobalStatsCollector {
   void IncrementTcpReadOfferIovSize(int value) {
     data_.this_cpu().tcp_read_offer_iov_size.Increment(value);
   }
+  void IncrementTcpZerocopyCompletionLatencyUs(int value) {
+    data_.this_cpu().tcp_zerocopy_completion_latency_us.Increment(value);
+  }
+  void IncrementTcpInfoRttUs(int value) {
+    data_.this_cpu().tcp_info_rtt_us.Increment(value);
+  }
+  void IncrementTcpInfoSndCwnd(int value) {
+    data_.this_cpu().tcp_info_snd_cwnd.Increment(value);
+  }
+  void IncrementTcpInfoRetransmits(int value) {
+    data_.this_cpu().tcp_info_retransmits.Increment(value);
+  }
+  void IncrementTcpInfoPacingRateKib(int value) {
+    data_.this_cpu().tcp_info_pacing_rate_kib.Increment(value);
+  }
+  void IncrementTcpInfoDeliveryRateKib(int value) {
+    data_.this_cpu().tcp_info_delivery_rate_kib.Increment(value);
+  }
   void IncrementHttp2SendMessageSize(int value) {
     data_.this_cpu().http2_send_message_size.Increment(value);
   }
@@ -465,6 +683,12 @@ class GlobalStatsCollector {
   void IncrementWorkSerializerItemsPerRun(int value) {
     data_.this_cpu().work_serializer_items_per_run.Increment(value);
   }
+  void IncrementServerHandshakeQueueTimeMs(int value) {
+    data_.this_cpu().server_handshake_queue_time_ms.Increment(value);
+  }
+  void IncrementNativeDnsLookupLatencyMs(int value) {
+    data_.this_cpu().native_dns_lookup_latency_ms.Increment(value);
+  }
   void IncrementChaoticGoodSendmsgsPerWriteControl(int value) {
     data_.this_cpu().chaotic_good_sendmsgs_per_write_control.Increment(value);
   }
@@ -508,6 +732,24 @@ class GlobalStatsCollector {
   void IncrementChaoticGoodTcpWriteSizeControl(int value) {
     data_.this_cpu().chaotic_good_tcp_write_size_control.Increment(value);
   }
+  void IncrementSlabAllocatorWastedBytes(int value) {
+    data_.this_cpu().slab_allocator_wasted_bytes.Increment(value);
+  }
+  void IncrementCallArenaWastedBytes(int value) {
+    data_.this_cpu().call_arena_wasted_bytes.Increment(value);
+  }
+  void IncrementWorkSerializerQueueLength(int value) {
+    data_.this_cpu().work_serializer_queue_length.Increment(value);
+  }
+  void IncrementWorkSerializerQueueDelayUs(int value) {
+    data_.this_cpu().work_serializer_queue_delay_us.Increment(value);
+  }
+  void IncrementPartyWakeupToRunUs(int value) {
+    data_.this_cpu().party_wakeup_to_run_us.Increment(value);
+  }
+  void IncrementPartyPollsPerParticipant(int value) {
+    data_.this_cpu().party_polls_per_participant.Increment(value);
+  }
 
  private:
   struct Data {
@@ -516,22 +758,50 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> client_channels_created{0};
     std::atomic<uint64_t> client_subchannels_created{0};
     std::atomic<uint64_t> server_channels_created{0};
+    std::atomic<uint64_t> server_calls_shed{0};
     std::atomic<uint64_t> insecure_connections_created{0};
     std::atomic<uint64_t> syscall_write{0};
     std::atomic<uint64_t> syscall_read{0};
     std::atomic<uint64_t> tcp_read_alloc_8k{0};
     std::atomic<uint64_t> tcp_read_alloc_64k{0};
+    std::atomic<uint64_t> tcp_read_buffer_shrunk_for_memory_pressure{0};
+    std::atomic<uint64_t> slab_allocator_cache_hits{0};
+    std::atomic<uint64_t> slab_allocator_cache_misses{0};
+    std::atomic<uint64_t> slab_allocator_blocks_released{0};
+    std::atomic<uint64_t> tcp_zerocopy_sends{0};
+    std::atomic<uint64_t> tcp_zerocopy_fallback_sends{0};
+    std::atomic<uint64_t> tcp_zerocopy_copied_completions{0};
     std::atomic<uint64_t> http2_settings_writes{0};
     std::atomic<uint64_t> http2_pings_sent{0};
     std::atomic<uint64_t> http2_writes_begun{0};
     std::atomic<uint64_t> http2_transport_stalls{0};
     std::atomic<uint64_t> http2_stream_stalls{0};
+    std::atomic<uint64_t> http2_window_updates_sent{0};
+    std::atomic<uint64_t> http2_window_updates_received{0};
+    std::atomic<uint64_t> http2_window_updates_deferred{0};
+    std::atomic<uint64_t> http2_recv_data_copied_slices{0};
+    std::atomic<uint64_t> http2_recv_coalesced_message_copies{0};
+    std::atomic<uint64_t> http2_initial_window_shrunk_for_memory_pressure{0};
     std::atomic<uint64_t> cq_pluck_creates{0};
     std::atomic<uint64_t> cq_next_creates{0};
     std::atomic<uint64_t> cq_callback_creates{0};
+    std::atomic<uint64_t> sync_server_threads_created{0};
+    std::atomic<uint64_t> sync_server_threads_destroyed{0};
+    std::atomic<uint64_t> sync_server_warm_threads_reused{0};
+    std::atomic<uint64_t> sync_server_thread_quota_rejections{0};
     std::atomic<uint64_t> wrr_updates{0};
     std::atomic<uint64_t> work_serializer_items_enqueued{0};
     std::atomic<uint64_t> work_serializer_items_dequeued{0};
+    std::atomic<uint64_t> subchannel_connectivity_notifications_coalesced{0};
+    std::atomic<uint64_t> work_stealing_same_node_steals{0};
+    std::atomic<uint64_t> work_stealing_cross_node_steals{0};
+    std::atomic<uint64_t> ssl_server_handshakes{0};
+    std::atomic<uint64_t> ssl_server_session_resumptions{0};
+    std::atomic<uint64_t> ssl_verification_cache_hits{0};
+    std::atomic<uint64_t> ssl_verification_cache_misses{0};
+    std::atomic<uint64_t> server_handshakes_queued{0};
+    std::atomic<uint64_t> server_handshakes_rejected{0};
+    std::atomic<uint64_t> native_dns_lookups_coalesced{0};
     std::atomic<uint64_t> econnaborted_count{0};
     std::atomic<uint64_t> econnreset_count{0};
     std::atomic<uint64_t> epipe_count{0};
@@ -543,12 +813,19 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> enobufs_count{0};
     std::atomic<uint64_t> uncommon_io_error_count{0};
     std::atomic<uint64_t> msg_errqueue_error_count{0};
+    std::atomic<uint64_t> party_spurious_wakeups{0};
     HistogramCollector_65536_26 call_initial_size;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
     HistogramCollector_16777216_20 tcp_read_size;
     HistogramCollector_16777216_20 tcp_read_offer;
     HistogramCollector_80_10 tcp_read_offer_iov_size;
+    HistogramCollector_100000_20 tcp_zerocopy_completion_latency_us;
+    HistogramCollector_100000_20 tcp_info_rtt_us;
+    HistogramCollector_10000_20 tcp_info_snd_cwnd;
+    HistogramCollector_10000_20 tcp_info_retransmits;
+    HistogramCollector_16777216_20 tcp_info_pacing_rate_kib;
+    HistogramCollector_16777216_20 tcp_info_delivery_rate_kib;
     HistogramCollector_16777216_20 http2_send_message_size;
     HistogramCollector_65536_26 http2_metadata_size;
     HistogramCollector_10000_20 wrr_subchannel_list_size;
@@ -557,6 +834,8 @@ class GlobalStatsCollector {
     HistogramCollector_100000_20 work_serializer_work_time_ms;
     HistogramCollector_100000_20 work_serializer_work_time_per_item_ms;
     HistogramCollector_10000_20 work_serializer_items_per_run;
+    HistogramCollector_100000_20 server_handshake_queue_time_ms;
+    HistogramCollector_100000_20 native_dns_lookup_latency_ms;
     HistogramCollector_100_20 chaotic_good_sendmsgs_per_write_control;
     HistogramCollector_100_20 chaotic_good_recvmsgs_per_read_control;
     HistogramCollector_100_20 chaotic_good_sendmsgs_per_write_data;
@@ -571,6 +850,12 @@ class GlobalStatsCollector {
     HistogramCollector_16777216_20 chaotic_good_tcp_read_offer_control;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_data;
     HistogramCollector_16777216_20 chaotic_good_tcp_write_size_control;
+    HistogramCollector_65536_26 slab_allocator_wasted_bytes;
+    HistogramCollector_65536_26 call_arena_wasted_bytes;
+    HistogramCollector_10000_20 work_serializer_queue_length;
+    HistogramCollector_100000_20 work_serializer_queue_delay_us;
+    HistogramCollector_100000_20 party_wakeup_to_run_us;
+    HistogramCollector_10000_20 party_polls_per_participant;
   };
   PerCpu<Data> data_{PerCpuOptions().SetCpusPerShard(4).SetMaxShards(32)};
 };
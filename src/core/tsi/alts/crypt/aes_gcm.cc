@@ -307,38 +307,14 @@ static grpc_status_code aes_gcm_rekey_if_required(
   return GRPC_STATUS_OK;
 }
 
-static grpc_status_code gsec_aes_gcm_aead_crypter_encrypt_iovec(
-    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+// Encrypts one message whose nonce and buffers have been checked by the
+// caller, reusing the cipher context of aes_gcm_crypter.
+static grpc_status_code aes_gcm_encrypt_frame(
+    gsec_aes_gcm_aead_crypter* aes_gcm_crypter, const uint8_t* nonce,
     const struct iovec* aad_vec, size_t aad_vec_length,
     const struct iovec* plaintext_vec, size_t plaintext_vec_length,
     struct iovec ciphertext_vec, size_t* ciphertext_bytes_written,
     char** error_details) {
-  gsec_aes_gcm_aead_crypter* aes_gcm_crypter =
-      reinterpret_cast<gsec_aes_gcm_aead_crypter*>(crypter);
-  // Input checks
-  if (nonce == nullptr) {
-    aes_gcm_format_errors("Nonce buffer is nullptr.", error_details);
-    return GRPC_STATUS_INVALID_ARGUMENT;
-  }
-  if (kAesGcmNonceLength != nonce_length) {
-    aes_gcm_format_errors("Nonce buffer has the wrong length.", error_details);
-    return GRPC_STATUS_INVALID_ARGUMENT;
-  }
-  if (aad_vec_length > 0 && aad_vec == nullptr) {
-    aes_gcm_format_errors("Non-zero aad_vec_length but aad_vec is nullptr.",
-                          error_details);
-    return GRPC_STATUS_INVALID_ARGUMENT;
-  }
-  if (plaintext_vec_length > 0 && plaintext_vec == nullptr) {
-    aes_gcm_format_errors(
-        "Non-zero plaintext_vec_length but plaintext_vec is nullptr.",
-        error_details);
-    return GRPC_STATUS_INVALID_ARGUMENT;
-  }
-  if (ciphertext_bytes_written == nullptr) {
-    aes_gcm_format_errors("bytes_written is nullptr.", error_details);
-    return GRPC_STATUS_INVALID_ARGUMENT;
-  }
   *ciphertext_bytes_written = 0;
   // rekey if required
   if (aes_gcm_rekey_if_required(aes_gcm_crypter, nonce, error_details) !=
@@ -445,6 +421,85 @@ static grpc_status_code gsec_aes_gcm_aead_crypter_encrypt_iovec(
   return GRPC_STATUS_OK;
 }
 
+static grpc_status_code gsec_aes_gcm_aead_crypter_encrypt_iovec(
+    gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
+    const struct iovec* aad_vec, size_t aad_vec_length,
+    const struct iovec* plaintext_vec, size_t plaintext_vec_length,
+    struct iovec ciphertext_vec, size_t* ciphertext_bytes_written,
+    char** error_details) {
+  gsec_aes_gcm_aead_crypter* aes_gcm_crypter =
+      reinterpret_cast<gsec_aes_gcm_aead_crypter*>(crypter);
+  // Input checks
+  if (nonce == nullptr) {
+    aes_gcm_format_errors("Nonce buffer is nullptr.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (kAesGcmNonceLength != nonce_length) {
+    aes_gcm_format_errors("Nonce buffer has the wrong length.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (aad_vec_length > 0 && aad_vec == nullptr) {
+    aes_gcm_format_errors("Non-zero aad_vec_length but aad_vec is nullptr.",
+                          error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (plaintext_vec_length > 0 && plaintext_vec == nullptr) {
+    aes_gcm_format_errors(
+        "Non-zero plaintext_vec_length but plaintext_vec is nullptr.",
+        error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (ciphertext_bytes_written == nullptr) {
+    aes_gcm_format_errors("bytes_written is nullptr.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  return aes_gcm_encrypt_frame(aes_gcm_crypter, nonce, aad_vec, aad_vec_length,
+                               plaintext_vec, plaintext_vec_length,
+                               ciphertext_vec, ciphertext_bytes_written,
+                               error_details);
+}
+
+static grpc_status_code gsec_aes_gcm_aead_crypter_encrypt_iovec_batch(
+    gsec_aead_crypter* crypter, size_t nonce_length, gsec_aead_frame* frames,
+    size_t num_frames, char** error_details) {
+  gsec_aes_gcm_aead_crypter* aes_gcm_crypter =
+      reinterpret_cast<gsec_aes_gcm_aead_crypter*>(crypter);
+  // Input checks
+  if (kAesGcmNonceLength != nonce_length) {
+    aes_gcm_format_errors("Nonce buffer has the wrong length.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (num_frames > 0 && frames == nullptr) {
+    aes_gcm_format_errors("Non-zero num_frames but frames is nullptr.",
+                          error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  for (size_t i = 0; i < num_frames; i++) {
+    gsec_aead_frame& frame = frames[i];
+    if (frame.nonce == nullptr) {
+      aes_gcm_format_errors("Nonce buffer is nullptr.", error_details);
+      return GRPC_STATUS_INVALID_ARGUMENT;
+    }
+    if (frame.plaintext_vec_length > 0 && frame.plaintext_vec == nullptr) {
+      aes_gcm_format_errors(
+          "Non-zero plaintext_vec_length but plaintext_vec is nullptr.",
+          error_details);
+      return GRPC_STATUS_INVALID_ARGUMENT;
+    }
+    // The key is only derived again when the nonce of a frame crosses into
+    // the range of a new KDF counter, so consecutive frames of the batch keep
+    // the expanded key of the cipher context.
+    grpc_status_code status = aes_gcm_encrypt_frame(
+        aes_gcm_crypter, frame.nonce, /*aad_vec=*/nullptr,
+        /*aad_vec_length=*/0, frame.plaintext_vec, frame.plaintext_vec_length,
+        frame.ciphertext_vec, &frame.ciphertext_bytes_written, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+  }
+  return GRPC_STATUS_OK;
+}
+
 static grpc_status_code gsec_aes_gcm_aead_crypter_decrypt_iovec(
     gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
     const struct iovec* aad_vec, size_t aad_vec_length,
@@ -650,6 +705,7 @@ static void gsec_aes_gcm_aead_crypter_destroy(gsec_aead_crypter* crypter) {
 static const gsec_aead_crypter_vtable vtable = {
     gsec_aes_gcm_aead_crypter_encrypt_iovec,
     gsec_aes_gcm_aead_crypter_decrypt_iovec,
+    gsec_aes_gcm_aead_crypter_encrypt_iovec_batch,
     gsec_aes_gcm_aead_crypter_max_ciphertext_and_tag_length,
     gsec_aes_gcm_aead_crypter_max_plaintext_length,
     gsec_aes_gcm_aead_crypter_nonce_length,
@@ -74,6 +74,34 @@ grpc_status_code gsec_aead_crypter_encrypt_iovec(
   return GRPC_STATUS_INVALID_ARGUMENT;
 }
 
+grpc_status_code gsec_aead_crypter_encrypt_iovec_batch(
+    gsec_aead_crypter* crypter, size_t nonce_length, gsec_aead_frame* frames,
+    size_t num_frames, char** error_details) {
+  if (crypter != nullptr && crypter->vtable != nullptr &&
+      crypter->vtable->encrypt_iovec_batch != nullptr) {
+    return crypter->vtable->encrypt_iovec_batch(crypter, nonce_length, frames,
+                                                num_frames, error_details);
+  }
+  // Implementations without a batched encrypt encrypt one frame at a time.
+  if (crypter != nullptr && crypter->vtable != nullptr &&
+      crypter->vtable->encrypt_iovec != nullptr) {
+    for (size_t i = 0; i < num_frames; i++) {
+      grpc_status_code status = crypter->vtable->encrypt_iovec(
+          crypter, frames[i].nonce, nonce_length, /*aad_vec=*/nullptr,
+          /*aad_vec_length=*/0, frames[i].plaintext_vec,
+          frames[i].plaintext_vec_length, frames[i].ciphertext_vec,
+          &frames[i].ciphertext_bytes_written, error_details);
+      if (status != GRPC_STATUS_OK) {
+        return status;
+      }
+    }
+    return GRPC_STATUS_OK;
+  }
+  // An error occurred.
+  maybe_copy_error_msg(vtable_error_msg, error_details);
+  return GRPC_STATUS_INVALID_ARGUMENT;
+}
+
 grpc_status_code gsec_aead_crypter_decrypt(
     gsec_aead_crypter* crypter, const uint8_t* nonce, size_t nonce_length,
     const uint8_t* aad, size_t aad_length, const uint8_t* ciphertext_and_tag,
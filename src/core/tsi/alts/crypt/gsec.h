@@ -126,6 +126,20 @@ const size_t kAes128GcmRekeyKeyLength = 44;
 
 typedef struct gsec_aead_crypter gsec_aead_crypter;
 
+// One frame of a batched AEAD encrypt operation. The frames of a batch are
+// independent messages, each with its own nonce.
+typedef struct gsec_aead_frame {
+  // Buffer containing the nonce of the frame.
+  const uint8_t* nonce;
+  // An iovec array containing the plaintext of the frame.
+  const struct iovec* plaintext_vec;
+  size_t plaintext_vec_length;
+  // An iovec containing the buffer the ciphertext and tag are written to.
+  struct iovec ciphertext_vec;
+  // Set to the actual number of bytes written to ciphertext_vec.
+  size_t ciphertext_bytes_written;
+} gsec_aead_frame;
+
 //
 // The gsec_aead_crypter is an API for different AEAD implementations such as
 // AES_GCM. It encapsulates all AEAD-related operations in the format of
@@ -227,6 +241,11 @@ typedef struct gsec_aead_crypter_vtable {
       const struct iovec* ciphertext_vec, size_t ciphertext_vec_length,
       struct iovec plaintext_vec, size_t* plaintext_bytes_written,
       char** error_details);
+  grpc_status_code (*encrypt_iovec_batch)(gsec_aead_crypter* crypter,
+                                          size_t nonce_length,
+                                          gsec_aead_frame* frames,
+                                          size_t num_frames,
+                                          char** error_details);
   grpc_status_code (*max_ciphertext_and_tag_length)(
       const gsec_aead_crypter* crypter, size_t plaintext_length,
       size_t* max_ciphertext_and_tag_length_to_return, char** error_details);
@@ -323,6 +342,31 @@ grpc_status_code gsec_aead_crypter_encrypt_iovec(
     struct iovec ciphertext_vec, size_t* ciphertext_bytes_written,
     char** error_details);
 
+//
+// This method performs an AEAD encrypt operation on each of a batch of frames,
+// in order. It is equivalent to calling gsec_aead_crypter_encrypt_iovec on
+// each frame without aad, but lets the implementation check its arguments and
+// state once for the whole batch.
+//
+//- crypter: AEAD crypter instance.
+//- nonce_length: size of the nonce buffer of each frame, and must be equal to
+//  the value returned from method gsec_aead_crypter_nonce_length.
+//- frames: an array of frames to encrypt. The ciphertext_bytes_written field
+//  of each frame is set by the method.
+//- num_frames: the array length of frames.
+//- error_details: a buffer containing an error message if the method does not
+//  function correctly. It is legal to pass nullptr into error_details, and
+//  otherwise, the parameter should be freed with gpr_free.
+//
+// On the success of encryption of all the frames, the method returns
+// GRPC_STATUS_OK. Otherwise, it returns an error status code along with its
+// details specified in error_details (if error_details is not nullptr), and
+// the frames following the one that failed are not encrypted.
+//
+grpc_status_code gsec_aead_crypter_encrypt_iovec_batch(
+    gsec_aead_crypter* crypter, size_t nonce_length, gsec_aead_frame* frames,
+    size_t num_frames, char** error_details);
+
 //
 // This method performs an AEAD decrypt operation.
 //
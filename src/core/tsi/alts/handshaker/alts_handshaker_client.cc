@@ -18,6 +18,7 @@
 
 #include "src/core/tsi/alts/handshaker/alts_handshaker_client.h"
 
+#include <algorithm>
 #include <list>
 
 #include "absl/log/check.h"
@@ -376,9 +377,12 @@ class HandshakeQueue {
   void RequestHandshake(alts_grpc_handshaker_client* client) {
     {
       grpc_core::MutexLock lock(&mu_);
+      ++total_requested_;
       if (outstanding_handshakes_ == max_outstanding_handshakes_) {
         // Max number already running, add to queue.
         queued_handshakes_.push_back(client);
+        ++total_queued_;
+        max_queued_ = std::max(max_queued_, queued_handshakes_.size());
         return;
       }
       // Start the handshake immediately.
@@ -403,11 +407,21 @@ class HandshakeQueue {
     continue_make_grpc_call(client, true /* is_start */);
   }
 
+  AltsHandshakeQueueStats GetStats() {
+    grpc_core::MutexLock lock(&mu_);
+    return AltsHandshakeQueueStats{outstanding_handshakes_,
+                                   queued_handshakes_.size(), max_queued_,
+                                   total_requested_, total_queued_};
+  }
+
  private:
   grpc_core::Mutex mu_;
   std::list<alts_grpc_handshaker_client*> queued_handshakes_;
   size_t outstanding_handshakes_ = 0;
   const size_t max_outstanding_handshakes_;
+  size_t max_queued_ = 0;
+  uint64_t total_requested_ = 0;
+  uint64_t total_queued_ = 0;
 };
 
 gpr_once g_queued_handshakes_init = GPR_ONCE_INIT;
@@ -929,6 +943,13 @@ void alts_handshaker_client_destroy(alts_handshaker_client* c) {
   }
 }
 
+AltsHandshakeQueueStats GetAltsHandshakeQueueStats(bool is_client) {
+  gpr_once_init(&g_queued_handshakes_init, DoHandshakeQueuesInit);
+  HandshakeQueue* queue =
+      is_client ? g_client_handshake_queue : g_server_handshake_queue;
+  return queue->GetStats();
+}
+
 size_t MaxNumberOfConcurrentHandshakes() {
   size_t max_concurrent_handshakes = 40;
   absl::optional<std::string> env_var_max_concurrent_handshakes =
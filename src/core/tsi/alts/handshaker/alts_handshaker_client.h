@@ -19,6 +19,9 @@
 #ifndef GRPC_SRC_CORE_TSI_ALTS_HANDSHAKER_ALTS_HANDSHAKER_CLIENT_H
 #define GRPC_SRC_CORE_TSI_ALTS_HANDSHAKER_ALTS_HANDSHAKER_CLIENT_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <grpc/byte_buffer.h>
 #include <grpc/byte_buffer_reader.h>
 #include <grpc/grpc.h>
@@ -156,6 +159,22 @@ alts_handshaker_client* alts_grpc_handshaker_client_create(
 void alts_handshaker_client_handle_response(alts_handshaker_client* client,
                                             bool is_ok);
 
+// A snapshot of the queue that holds handshakes back once
+// MaxNumberOfConcurrentHandshakes() are in flight. Client and server
+// handshakes are queued separately.
+struct AltsHandshakeQueueStats {
+  // Handshakes talking to the handshaker service, and waiting to.
+  size_t outstanding;
+  size_t queued;
+  // The longest the queue has been.
+  size_t max_queued;
+  // Handshakes requested so far, and how many of those had to wait.
+  uint64_t total_requested;
+  uint64_t total_queued;
+};
+
+AltsHandshakeQueueStats GetAltsHandshakeQueueStats(bool is_client);
+
 // Returns the max number of concurrent handshakes that are permitted.
 //
 // Exposed for testing purposes only.
@@ -22,8 +22,15 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/numbers.h"
+#include "absl/types/optional.h"
 #include "upb/mem/arena.hpp"
 
 #include <grpc/credentials.h>
@@ -34,6 +41,7 @@
 #include <grpc/support/sync.h>
 #include <grpc/support/thd_id.h>
 
+#include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/closure.h"
@@ -44,6 +52,9 @@
 #include "src/core/tsi/alts/handshaker/alts_shared_resource.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_zero_copy_grpc_protector.h"
 
+const char kChannelPoolSizeEnvironmentVariable[] =
+    "GRPC_ALTS_HANDSHAKER_CHANNEL_POOL_SIZE";
+
 // Main struct for ALTS TSI handshaker.
 struct alts_tsi_handshaker {
   tsi_handshaker base;
@@ -492,21 +503,118 @@ struct alts_tsi_handshaker_continue_handshaker_next_args {
   std::string* error = nullptr;
 };
 
+namespace {
+
+// Channels to the handshaker service, shared by the handshakes in flight
+// instead of each handshake dialing its own. A channel is closed once the
+// last handshake using it is destroyed, so an idle process holds none.
+class HandshakerChannelPool {
+ public:
+  explicit HandshakerChannelPool(size_t max_channels_per_url)
+      : max_channels_per_url_(max_channels_per_url) {}
+
+  // Returns a channel to \a url to hand back to Release(). Up to
+  // max_channels_per_url_ channels are opened before handshakes start
+  // sharing them, least used first.
+  grpc_channel* Acquire(const char* url) {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      Entry* least_used = nullptr;
+      size_t channels = 0;
+      for (Entry& entry : entries_) {
+        if (entry.url != url) continue;
+        ++channels;
+        if (least_used == nullptr || entry.users < least_used->users) {
+          least_used = &entry;
+        }
+      }
+      if (least_used != nullptr && channels >= max_channels_per_url_) {
+        ++least_used->users;
+        return least_used->channel;
+      }
+    }
+    // Created without holding mu_, since channel creation takes g_init_mu.
+    grpc_channel* channel = CreateChannel(url);
+    grpc_core::MutexLock lock(&mu_);
+    entries_.push_back(Entry{url, channel, 1});
+    return channel;
+  }
+
+  void Release(grpc_channel* channel) {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      auto it = std::find_if(
+          entries_.begin(), entries_.end(),
+          [channel](const Entry& entry) { return entry.channel == channel; });
+      CHECK(it != entries_.end());
+      if (--it->users > 0) return;
+      entries_.erase(it);
+    }
+    grpc_channel_destroy_internal(channel);
+  }
+
+ private:
+  struct Entry {
+    std::string url;
+    grpc_channel* channel;
+    size_t users;
+  };
+
+  grpc_channel* CreateChannel(const char* url) {
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    grpc_arg args[2];
+    size_t num_args = 0;
+    // Disable retries so that we quickly get a signal when the
+    // handshake server is not reachable.
+    args[num_args++] = grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_ENABLE_RETRIES), 0);
+    // Channels with the same target and args would otherwise share one
+    // subchannel, and with it one connection.
+    if (max_channels_per_url_ > 1) {
+      args[num_args++] = grpc_channel_arg_integer_create(
+          const_cast<char*>(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL), 1);
+    }
+    grpc_channel_args channel_args = {num_args, args};
+    grpc_channel* channel = grpc_channel_create(url, creds, &channel_args);
+    grpc_channel_credentials_release(creds);
+    return channel;
+  }
+
+  const size_t max_channels_per_url_;
+  grpc_core::Mutex mu_;
+  std::vector<Entry> entries_ ABSL_GUARDED_BY(mu_);
+};
+
+HandshakerChannelPool* GetHandshakerChannelPool() {
+  static HandshakerChannelPool* pool =
+      new HandshakerChannelPool(AltsHandshakerChannelPoolSize());
+  return pool;
+}
+
+}  // namespace
+
+size_t AltsHandshakerChannelPoolSize() {
+  size_t pool_size = 1;
+  absl::optional<std::string> env_var_pool_size =
+      grpc_core::GetEnv(kChannelPoolSizeEnvironmentVariable);
+  if (env_var_pool_size.has_value()) {
+    size_t effective_pool_size;
+    if (absl::SimpleAtoi(*env_var_pool_size, &effective_pool_size) &&
+        effective_pool_size > 0) {
+      pool_size = effective_pool_size;
+    }
+  }
+  return pool_size;
+}
+
 static void alts_tsi_handshaker_create_channel(
     void* arg, grpc_error_handle /* unused_error */) {
   alts_tsi_handshaker_continue_handshaker_next_args* next_args =
       static_cast<alts_tsi_handshaker_continue_handshaker_next_args*>(arg);
   alts_tsi_handshaker* handshaker = next_args->handshaker;
   CHECK_EQ(handshaker->channel, nullptr);
-  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
-  // Disable retries so that we quickly get a signal when the
-  // handshake server is not reachable.
-  grpc_arg disable_retries_arg = grpc_channel_arg_integer_create(
-      const_cast<char*>(GRPC_ARG_ENABLE_RETRIES), 0);
-  grpc_channel_args args = {1, &disable_retries_arg};
-  handshaker->channel = grpc_channel_create(
-      next_args->handshaker->handshaker_service_url, creds, &args);
-  grpc_channel_credentials_release(creds);
+  handshaker->channel =
+      GetHandshakerChannelPool()->Acquire(handshaker->handshaker_service_url);
   tsi_result continue_next_result =
       alts_tsi_handshaker_continue_handshaker_next(
           handshaker, next_args->received_bytes.get(),
@@ -612,7 +720,7 @@ static void handshaker_destroy(tsi_handshaker* self) {
   grpc_core::CSliceUnref(handshaker->target_name);
   grpc_alts_credentials_options_destroy(handshaker->options);
   if (handshaker->channel != nullptr) {
-    grpc_channel_destroy_internal(handshaker->channel);
+    GetHandshakerChannelPool()->Release(handshaker->channel);
   }
   gpr_free(handshaker->handshaker_service_url);
   delete handshaker;
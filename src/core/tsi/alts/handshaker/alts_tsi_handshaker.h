@@ -100,4 +100,10 @@ void alts_tsi_handshaker_result_set_unused_bytes(tsi_handshaker_result* result,
 ///
 bool alts_tsi_handshaker_has_shutdown(alts_tsi_handshaker* handshaker);
 
+// Returns how many channels to each handshaker service the handshakes in
+// flight are spread over, from GRPC_ALTS_HANDSHAKER_CHANNEL_POOL_SIZE.
+//
+// Exposed for testing purposes only.
+size_t AltsHandshakerChannelPoolSize();
+
 #endif  // GRPC_SRC_CORE_TSI_ALTS_HANDSHAKER_ALTS_TSI_HANDSHAKER_H
@@ -49,6 +49,28 @@ tsi_result alts_grpc_record_protocol_protect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* unprotected_slices,
     grpc_slice_buffer* protected_slices);
 
+///
+/// This methods performs protect operation on unprotected data of any length,
+/// splitting it into frames of at most max_unprotected_data_size bytes, and
+/// appends the protected frames to protected_slices. The input unprotected
+/// data slice buffer will be cleared, although the actual unprotected data
+/// bytes are not modified.
+///
+///- self: an alts_grpc_record_protocol instance.
+///- max_unprotected_data_size: maximum size of the unprotected data of a
+///  frame.
+///- unprotected_slices: the unprotected data to be protected.
+///- protected_slices: slice buffer where the protected frames are appended.
+///
+/// This method returns TSI_OK in case of success, TSI_UNIMPLEMENTED if the
+/// instance can only protect one frame at a time with
+/// alts_grpc_record_protocol_protect, or a specific error code in case of
+/// failure.
+///
+tsi_result alts_grpc_record_protocol_protect_frames(
+    alts_grpc_record_protocol* self, size_t max_unprotected_data_size,
+    grpc_slice_buffer* unprotected_slices, grpc_slice_buffer* protected_slices);
+
 ///
 /// This methods performs unprotect operation on a full frame of protected data
 /// and appends unprotected data to unprotected_slices. It is the caller's
@@ -80,6 +102,23 @@ tsi_result alts_grpc_record_protocol_unprotect(
 size_t alts_grpc_record_protocol_max_unprotected_data_size(
     const alts_grpc_record_protocol* self, size_t max_protected_frame_size);
 
+///
+/// This method sets the frame counter of dst to the one src will have after
+/// processing num_frames more frames, so that dst can process the frames that
+/// follow them concurrently with src. Both objects must have been created with
+/// the same key, side, direction and protection mode.
+///
+///- src: the alts_grpc_record_protocol instance whose counter is read.
+///- num_frames: number of frames to skip ahead of the counter of src.
+///- dst: the alts_grpc_record_protocol instance whose counter is set.
+///
+/// This method returns TSI_OK in case of success or a specific error code in
+/// case of failure.
+///
+tsi_result alts_grpc_record_protocol_copy_counter(
+    const alts_grpc_record_protocol* src, size_t num_frames,
+    alts_grpc_record_protocol* dst);
+
 ///
 /// This method destroys an alts_grpc_record_protocol instance by de-allocating
 /// all of its occupied memory.
@@ -138,6 +138,21 @@ tsi_result alts_grpc_record_protocol_protect(
   return self->vtable->protect(self, unprotected_slices, protected_slices);
 }
 
+tsi_result alts_grpc_record_protocol_protect_frames(
+    alts_grpc_record_protocol* self, size_t max_unprotected_data_size,
+    grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  if (self == nullptr || self->vtable == nullptr ||
+      unprotected_slices == nullptr || protected_slices == nullptr) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->protect_frames == nullptr) {
+    return TSI_UNIMPLEMENTED;
+  }
+  return self->vtable->protect_frames(self, max_unprotected_data_size,
+                                      unprotected_slices, protected_slices);
+}
+
 tsi_result alts_grpc_record_protocol_unprotect(
     alts_grpc_record_protocol* self, grpc_slice_buffer* protected_slices,
     grpc_slice_buffer* unprotected_slices) {
@@ -175,3 +190,22 @@ size_t alts_grpc_record_protocol_max_unprotected_data_size(
   return alts_iovec_record_protocol_max_unprotected_data_size(
       self->iovec_rp, max_protected_frame_size);
 }
+
+tsi_result alts_grpc_record_protocol_copy_counter(
+    const alts_grpc_record_protocol* src, size_t num_frames,
+    alts_grpc_record_protocol* dst) {
+  if (src == nullptr || dst == nullptr) {
+    LOG(ERROR) << "Invalid nullptr arguments to alts_grpc_record_protocol "
+                  "copy_counter.";
+    return TSI_INVALID_ARGUMENT;
+  }
+  char* error_details = nullptr;
+  grpc_status_code status = alts_iovec_record_protocol_copy_counter(
+      src->iovec_rp, num_frames, dst->iovec_rp, &error_details);
+  if (status != GRPC_STATUS_OK) {
+    LOG(ERROR) << "Failed to copy record protocol counter, " << error_details;
+    gpr_free(error_details);
+    return TSI_INTERNAL_ERROR;
+  }
+  return TSI_OK;
+}
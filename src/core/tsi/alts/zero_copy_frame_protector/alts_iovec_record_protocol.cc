@@ -21,6 +21,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/port_platform.h>
@@ -185,6 +188,32 @@ size_t alts_iovec_record_protocol_max_unprotected_data_size(
   return max_protected_frame_size - overhead_bytes_size;
 }
 
+grpc_status_code alts_iovec_record_protocol_copy_counter(
+    const alts_iovec_record_protocol* src, size_t num_frames,
+    alts_iovec_record_protocol* dst, char** error_details) {
+  if (src == nullptr || dst == nullptr) {
+    maybe_copy_error_msg("Input iovec_record_protocol is nullptr.",
+                         error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (src->is_integrity_only != dst->is_integrity_only ||
+      src->is_protect != dst->is_protect ||
+      src->ctr->size != dst->ctr->size ||
+      src->ctr->overflow_size != dst->ctr->overflow_size) {
+    maybe_copy_error_msg("Incompatible iovec_record_protocol objects.",
+                         error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (src != dst) {
+    memcpy(dst->ctr->counter, src->ctr->counter, src->ctr->size);
+  }
+  for (size_t i = 0; i < num_frames; ++i) {
+    grpc_status_code status = increment_counter(dst->ctr, error_details);
+    if (status != GRPC_STATUS_OK) return status;
+  }
+  return GRPC_STATUS_OK;
+}
+
 grpc_status_code alts_iovec_record_protocol_integrity_only_protect(
     alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
     size_t unprotected_vec_length, iovec_t header, iovec_t tag,
@@ -354,6 +383,123 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
   return increment_counter(rp->ctr, error_details);
 }
 
+size_t alts_iovec_record_protocol_num_frames(size_t data_length,
+                                             size_t max_frame_data_size) {
+  if (data_length == 0 || max_frame_data_size == 0) {
+    return 1;
+  }
+  return (data_length + max_frame_data_size - 1) / max_frame_data_size;
+}
+
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_frames(
+    alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, size_t max_frame_data_size,
+    iovec_t protected_frames, char** error_details) {
+  // Input sanity checks.
+  if (rp == nullptr) {
+    maybe_copy_error_msg("Input iovec_record_protocol is nullptr.",
+                         error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (rp->is_integrity_only) {
+    maybe_copy_error_msg(
+        "Privacy-integrity operations are not allowed for this object.",
+        error_details);
+    return GRPC_STATUS_FAILED_PRECONDITION;
+  }
+  if (!rp->is_protect) {
+    maybe_copy_error_msg("Protect operations are not allowed for this object.",
+                         error_details);
+    return GRPC_STATUS_FAILED_PRECONDITION;
+  }
+  if (max_frame_data_size == 0) {
+    maybe_copy_error_msg("Maximum frame data size is zero.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  if (protected_frames.iov_base == nullptr) {
+    maybe_copy_error_msg("Protected frames buffer is nullptr.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  const size_t header_length = alts_iovec_record_protocol_get_header_length();
+  size_t data_length =
+      get_total_length(unprotected_vec, unprotected_vec_length);
+  size_t num_frames =
+      alts_iovec_record_protocol_num_frames(data_length, max_frame_data_size);
+  if (protected_frames.iov_len !=
+      data_length + num_frames * (header_length + rp->tag_length)) {
+    maybe_copy_error_msg("Protected frames size is incorrect.", error_details);
+    return GRPC_STATUS_INVALID_ARGUMENT;
+  }
+  // Lays out the frames back to back: each one gets its header written, a
+  // copy of the counter as its nonce, and the iovecs of its share of the
+  // unprotected data, split at frame boundaries. They are then sealed in one
+  // batch.
+  const size_t counter_size = alts_counter_get_size(rp->ctr);
+  std::vector<unsigned char> nonces(num_frames * counter_size);
+  std::vector<iovec_t> plaintext_vecs;
+  plaintext_vecs.reserve(unprotected_vec_length + num_frames);
+  std::vector<size_t> plaintext_vec_starts(num_frames);
+  std::vector<gsec_aead_frame> frames(num_frames);
+  unsigned char* frame_buffer =
+      static_cast<unsigned char*>(protected_frames.iov_base);
+  size_t vec_index = 0;
+  size_t vec_offset = 0;
+  for (size_t i = 0; i < num_frames; ++i) {
+    size_t frame_data_length = std::min(data_length, max_frame_data_size);
+    data_length -= frame_data_length;
+    grpc_status_code status = write_frame_header(
+        frame_data_length + rp->tag_length, frame_buffer, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+    memcpy(nonces.data() + i * counter_size, alts_counter_get_counter(rp->ctr),
+           counter_size);
+    status = increment_counter(rp->ctr, error_details);
+    if (status != GRPC_STATUS_OK) {
+      return status;
+    }
+    plaintext_vec_starts[i] = plaintext_vecs.size();
+    for (size_t remaining = frame_data_length; remaining > 0;) {
+      const iovec_t& vec = unprotected_vec[vec_index];
+      size_t length = std::min(vec.iov_len - vec_offset, remaining);
+      if (length > 0) {
+        plaintext_vecs.push_back(
+            {static_cast<unsigned char*>(vec.iov_base) + vec_offset, length});
+      }
+      remaining -= length;
+      vec_offset += length;
+      if (vec_offset == vec.iov_len) {
+        ++vec_index;
+        vec_offset = 0;
+      }
+    }
+    frames[i].nonce = nonces.data() + i * counter_size;
+    frames[i].ciphertext_vec = {frame_buffer + header_length,
+                                frame_data_length + rp->tag_length};
+    frame_buffer += header_length + frame_data_length + rp->tag_length;
+  }
+  for (size_t i = 0; i < num_frames; ++i) {
+    size_t end = i + 1 < num_frames ? plaintext_vec_starts[i + 1]
+                                    : plaintext_vecs.size();
+    frames[i].plaintext_vec = plaintext_vecs.data() + plaintext_vec_starts[i];
+    frames[i].plaintext_vec_length = end - plaintext_vec_starts[i];
+  }
+  grpc_status_code status = gsec_aead_crypter_encrypt_iovec_batch(
+      rp->crypter, counter_size, frames.data(), num_frames, error_details);
+  if (status != GRPC_STATUS_OK) {
+    return status;
+  }
+  for (const gsec_aead_frame& frame : frames) {
+    if (frame.ciphertext_bytes_written != frame.ciphertext_vec.iov_len) {
+      maybe_copy_error_msg(
+          "Bytes written expects to be data length plus tag length.",
+          error_details);
+      return GRPC_STATUS_INTERNAL;
+    }
+  }
+  return GRPC_STATUS_OK;
+}
+
 grpc_status_code alts_iovec_record_protocol_privacy_integrity_unprotect(
     alts_iovec_record_protocol* rp, iovec_t header,
     const iovec_t* protected_vec, size_t protected_vec_length,
@@ -70,6 +70,26 @@ size_t alts_iovec_record_protocol_get_tag_length(
 size_t alts_iovec_record_protocol_max_unprotected_data_size(
     const alts_iovec_record_protocol* rp, size_t max_protected_frame_size);
 
+///
+/// This method sets the counter of dst to the counter src will have after
+/// processing num_frames more frames. Both objects must have been created with
+/// the same key, side and direction. It lets several objects process
+/// consecutive runs of frames of the same stream concurrently.
+///
+///- src: the alts_iovec_record_protocol instance whose counter is read.
+///- num_frames: number of frames to skip ahead of the counter of src.
+///- dst: the alts_iovec_record_protocol instance whose counter is set.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr).
+///
+grpc_status_code alts_iovec_record_protocol_copy_counter(
+    const alts_iovec_record_protocol* src, size_t num_frames,
+    alts_iovec_record_protocol* dst, char** error_details);
+
 ///
 /// This method performs integrity-only protect operation on a
 /// alts_iovec_record_protocol instance, i.e., compute frame header and tag. The
@@ -136,6 +156,44 @@ grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect(
     size_t unprotected_vec_length, iovec_t protected_frame,
     char** error_details);
 
+///
+/// This method returns the number of frames that
+/// alts_iovec_record_protocol_privacy_integrity_protect_frames splits
+/// data_length bytes of unprotected data into. Empty data still takes one
+/// frame.
+///
+size_t alts_iovec_record_protocol_num_frames(size_t data_length,
+                                             size_t max_frame_data_size);
+
+///
+/// This method performs privacy-integrity protect operation on unprotected
+/// data that may span several frames, i.e., it splits the data into frames of
+/// at most max_frame_data_size bytes and computes them back to back in one
+/// buffer. The output is the same as that of calling
+/// alts_iovec_record_protocol_privacy_integrity_protect on each frame in turn,
+/// but the frames are sealed in one batch. The caller needs to allocate the
+/// memory for the protected frames prior to calling this method.
+///
+///- rp: an alts_iovec_record_protocol instance.
+///- unprotected_vec: an iovec array containing unprotected data.
+///- unprotected_vec_length: the array length of unprotected_vec.
+///- max_frame_data_size: maximum size of the unprotected data of a frame.
+///- protected_frames: an iovec containing the output protected frames. Its
+///  length must be the unprotected data length plus the header and tag
+///  lengths of each frame, as counted by
+///  alts_iovec_record_protocol_num_frames.
+///- error_details: a buffer containing an error message if the method does not
+///  function correctly. It is OK to pass nullptr into error_details.
+///
+/// On success, the method returns GRPC_STATUS_OK. Otherwise, it returns an
+/// error status code along with its details specified in error_details (if
+/// error_details is not nullptr).
+///
+grpc_status_code alts_iovec_record_protocol_privacy_integrity_protect_frames(
+    alts_iovec_record_protocol* rp, const iovec_t* unprotected_vec,
+    size_t unprotected_vec_length, size_t max_frame_data_size,
+    iovec_t protected_frames, char** error_details);
+
 ///
 /// This method performs privacy-integrity unprotect operation on a
 /// alts_iovec_record_protocol instance given a full protected frame, i.e.,
@@ -20,15 +20,24 @@
 
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/tsi/alts/crypt/gsec.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_integrity_only_record_protocol.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_grpc_privacy_integrity_record_protocol.h"
@@ -39,6 +48,11 @@
 constexpr size_t kMinFrameLength = 1024;
 constexpr size_t kDefaultFrameLength = 16 * 1024;
 constexpr size_t kMaxFrameLength = 16 * 1024 * 1024;
+// A write is only split across threads if every run of frames is at least
+// this long, so that sealing a run outweighs handing it to another thread.
+constexpr size_t kMinFramesPerParallelRun = 4;
+// Upper bound on the number of runs a write is split into.
+constexpr size_t kMaxParallelProtectRuns = 16;
 
 ///
 /// Main struct for alts_zero_copy_grpc_protector.
@@ -57,6 +71,11 @@ typedef struct alts_zero_copy_grpc_protector {
   grpc_slice_buffer protected_sb;
   grpc_slice_buffer protected_staging_sb;
   uint32_t parsed_frame_size;
+  // Extra protect record protocols created from the same key as
+  // record_protocol. Each run of frames of a large write but the first is
+  // sealed by one of them, concurrently with the others.
+  alts_grpc_record_protocol** parallel_record_protocols;
+  size_t num_parallel_record_protocols;
 } alts_zero_copy_grpc_protector;
 
 ///
@@ -146,6 +165,157 @@ static tsi_result create_alts_grpc_record_protocol(
   return TSI_OK;
 }
 
+///
+/// Protects unprotected_slices with record_protocol in frames of at most
+/// max_unprotected_data_size bytes, and appends the frames to
+/// protected_slices. Record protocols that cannot seal all the frames in one
+/// batch protect one frame at a time, using staging_sb as scratch space.
+///
+static tsi_result protect_frames(alts_grpc_record_protocol* record_protocol,
+                                 size_t max_unprotected_data_size,
+                                 grpc_slice_buffer* unprotected_slices,
+                                 grpc_slice_buffer* staging_sb,
+                                 grpc_slice_buffer* protected_slices) {
+  tsi_result status = alts_grpc_record_protocol_protect_frames(
+      record_protocol, max_unprotected_data_size, unprotected_slices,
+      protected_slices);
+  if (status != TSI_UNIMPLEMENTED) {
+    return status;
+  }
+  // Calls alts_grpc_record_protocol protect repeatly.
+  while (unprotected_slices->length > max_unprotected_data_size) {
+    grpc_slice_buffer_move_first(unprotected_slices, max_unprotected_data_size,
+                                 staging_sb);
+    status = alts_grpc_record_protocol_protect(record_protocol, staging_sb,
+                                               protected_slices);
+    if (status != TSI_OK) {
+      return status;
+    }
+  }
+  return alts_grpc_record_protocol_protect(record_protocol, unprotected_slices,
+                                           protected_slices);
+}
+
+namespace {
+
+///
+/// The runs of frames of one write, sealed by the writing thread and by the
+/// EventEngine closures helping it. Each of them claims runs until none are
+/// left, so the writer never waits for a closure that has not started yet.
+///
+class ParallelProtect {
+ public:
+  struct Run {
+    alts_grpc_record_protocol* record_protocol = nullptr;
+    grpc_slice_buffer unprotected_sb;
+    grpc_slice_buffer staging_sb;
+    grpc_slice_buffer protected_sb;
+    tsi_result status = TSI_OK;
+  };
+
+  ParallelProtect(size_t num_runs, size_t max_unprotected_data_size)
+      : max_unprotected_data_size_(max_unprotected_data_size), runs_(num_runs) {
+    for (Run& run : runs_) {
+      grpc_slice_buffer_init(&run.unprotected_sb);
+      grpc_slice_buffer_init(&run.staging_sb);
+      grpc_slice_buffer_init(&run.protected_sb);
+    }
+  }
+
+  ~ParallelProtect() {
+    for (Run& run : runs_) {
+      grpc_slice_buffer_destroy(&run.unprotected_sb);
+      grpc_slice_buffer_destroy(&run.staging_sb);
+      grpc_slice_buffer_destroy(&run.protected_sb);
+    }
+  }
+
+  std::vector<Run>& runs() { return runs_; }
+
+  // Seals unclaimed runs until there are none left.
+  void SealRuns() {
+    while (true) {
+      size_t index = next_run_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= runs_.size()) return;
+      Run& run = runs_[index];
+      run.status =
+          protect_frames(run.record_protocol, max_unprotected_data_size_,
+                         &run.unprotected_sb, &run.staging_sb,
+                         &run.protected_sb);
+      grpc_core::MutexLock lock(&mu_);
+      if (++runs_sealed_ == runs_.size()) cv_.SignalAll();
+    }
+  }
+
+  // Blocks until all runs are sealed.
+  void WaitForRuns() {
+    grpc_core::MutexLock lock(&mu_);
+    while (runs_sealed_ < runs_.size()) cv_.Wait(&mu_);
+  }
+
+ private:
+  const size_t max_unprotected_data_size_;
+  std::vector<Run> runs_;
+  std::atomic<size_t> next_run_{0};
+  grpc_core::Mutex mu_;
+  grpc_core::CondVar cv_;
+  size_t runs_sealed_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+}  // namespace
+
+///
+/// Splits unprotected_slices into num_runs runs of frames_per_run frames (the
+/// last one may be shorter), seals them concurrently with record_protocol and
+/// parallel_record_protocols, and appends the frames to protected_slices in
+/// order. Each parallel record protocol starts from the counter of frame the
+/// run begins with, and record_protocol ends up with the counter following the
+/// last frame, so the output is the same as that of a serial protect.
+///
+static tsi_result parallel_protect(alts_zero_copy_grpc_protector* protector,
+                                   size_t num_runs, size_t frames_per_run,
+                                   grpc_slice_buffer* unprotected_slices,
+                                   grpc_slice_buffer* protected_slices) {
+  auto parallel_protect = std::make_shared<ParallelProtect>(
+      num_runs, protector->max_unprotected_data_size);
+  std::vector<ParallelProtect::Run>& runs = parallel_protect->runs();
+  const size_t run_size =
+      frames_per_run * protector->max_unprotected_data_size;
+  for (size_t i = 0; i < num_runs; ++i) {
+    ParallelProtect::Run& run = runs[i];
+    if (i == 0) {
+      run.record_protocol = protector->record_protocol;
+    } else {
+      run.record_protocol = protector->parallel_record_protocols[i - 1];
+      tsi_result status = alts_grpc_record_protocol_copy_counter(
+          protector->record_protocol, i * frames_per_run, run.record_protocol);
+      if (status != TSI_OK) return status;
+    }
+    grpc_slice_buffer_move_first(
+        unprotected_slices,
+        i + 1 == num_runs ? unprotected_slices->length
+                          : std::min(run_size, unprotected_slices->length),
+        &run.unprotected_sb);
+  }
+  auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  for (size_t i = 1; i < num_runs; ++i) {
+    engine->Run([parallel_protect]() {
+      grpc_core::ExecCtx exec_ctx;
+      parallel_protect->SealRuns();
+    });
+  }
+  parallel_protect->SealRuns();
+  parallel_protect->WaitForRuns();
+  for (ParallelProtect::Run& run : runs) {
+    if (run.status != TSI_OK) return run.status;
+  }
+  for (ParallelProtect::Run& run : runs) {
+    grpc_slice_buffer_move_into(&run.protected_sb, protected_slices);
+  }
+  return alts_grpc_record_protocol_copy_counter(
+      runs.back().record_protocol, 0, protector->record_protocol);
+}
+
 // --- tsi_zero_copy_grpc_protector methods implementation. ---
 
 static tsi_result alts_zero_copy_grpc_protector_protect(
@@ -158,20 +328,24 @@ static tsi_result alts_zero_copy_grpc_protector_protect(
   }
   alts_zero_copy_grpc_protector* protector =
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
-  // Calls alts_grpc_record_protocol protect repeatly.
-  while (unprotected_slices->length > protector->max_unprotected_data_size) {
-    grpc_slice_buffer_move_first(unprotected_slices,
-                                 protector->max_unprotected_data_size,
-                                 &protector->unprotected_staging_sb);
-    tsi_result status = alts_grpc_record_protocol_protect(
-        protector->record_protocol, &protector->unprotected_staging_sb,
-        protected_slices);
-    if (status != TSI_OK) {
-      return status;
+  if (protector->num_parallel_record_protocols > 0) {
+    const size_t num_frames = (unprotected_slices->length +
+                               protector->max_unprotected_data_size - 1) /
+                              protector->max_unprotected_data_size;
+    size_t num_runs =
+        std::min(protector->num_parallel_record_protocols + 1,
+                 num_frames / kMinFramesPerParallelRun);
+    if (num_runs > 1) {
+      const size_t frames_per_run = (num_frames + num_runs - 1) / num_runs;
+      num_runs = (num_frames + frames_per_run - 1) / frames_per_run;
+      return parallel_protect(protector, num_runs, frames_per_run,
+                              unprotected_slices, protected_slices);
     }
   }
-  return alts_grpc_record_protocol_protect(
-      protector->record_protocol, unprotected_slices, protected_slices);
+  return protect_frames(protector->record_protocol,
+                        protector->max_unprotected_data_size,
+                        unprotected_slices, &protector->unprotected_staging_sb,
+                        protected_slices);
 }
 
 static tsi_result alts_zero_copy_grpc_protector_unprotect(
@@ -227,6 +401,15 @@ static tsi_result alts_zero_copy_grpc_protector_unprotect(
   return TSI_OK;
 }
 
+static void destroy_parallel_record_protocols(
+    alts_zero_copy_grpc_protector* protector) {
+  for (size_t i = 0; i < protector->num_parallel_record_protocols; ++i) {
+    alts_grpc_record_protocol_destroy(
+        protector->parallel_record_protocols[i]);
+  }
+  gpr_free(protector->parallel_record_protocols);
+}
+
 static void alts_zero_copy_grpc_protector_destroy(
     tsi_zero_copy_grpc_protector* self) {
   if (self == nullptr) {
@@ -236,6 +419,7 @@ static void alts_zero_copy_grpc_protector_destroy(
       reinterpret_cast<alts_zero_copy_grpc_protector*>(self);
   alts_grpc_record_protocol_destroy(protector->record_protocol);
   alts_grpc_record_protocol_destroy(protector->unrecord_protocol);
+  destroy_parallel_record_protocols(protector);
   grpc_slice_buffer_destroy(&protector->unprotected_staging_sb);
   grpc_slice_buffer_destroy(&protector->protected_sb);
   grpc_slice_buffer_destroy(&protector->protected_staging_sb);
@@ -256,7 +440,33 @@ static const tsi_zero_copy_grpc_protector_vtable
         alts_zero_copy_grpc_protector_protect,
         alts_zero_copy_grpc_protector_unprotect,
         alts_zero_copy_grpc_protector_destroy,
-        alts_zero_copy_grpc_protector_max_frame_size};
+        alts_zero_copy_grpc_protector_max_frame_size,
+        nullptr /* offload_protect */};
+
+///
+/// Creates the extra record protocols that seal large writes in parallel, if
+/// GRPC_ALTS_PARALLEL_PROTECT_WORKERS asks for more than one worker.
+///
+static tsi_result create_parallel_record_protocols(
+    const grpc_core::GsecKeyFactoryInterface& key_factory, bool is_client,
+    bool is_integrity_only, bool enable_extra_copy,
+    alts_zero_copy_grpc_protector* impl) {
+  const int workers = grpc_core::ConfigVars::Get().AltsParallelProtectWorkers();
+  if (workers <= 1) return TSI_OK;
+  impl->num_parallel_record_protocols =
+      std::min(static_cast<size_t>(workers), kMaxParallelProtectRuns) - 1;
+  impl->parallel_record_protocols = static_cast<alts_grpc_record_protocol**>(
+      gpr_zalloc(impl->num_parallel_record_protocols *
+                 sizeof(alts_grpc_record_protocol*)));
+  for (size_t i = 0; i < impl->num_parallel_record_protocols; ++i) {
+    tsi_result status = create_alts_grpc_record_protocol(
+        key_factory.Create(), is_client, is_integrity_only,
+        /*is_protect=*/true, enable_extra_copy,
+        &impl->parallel_record_protocols[i]);
+    if (status != TSI_OK) return status;
+  }
+  return TSI_OK;
+}
 
 tsi_result alts_zero_copy_grpc_protector_create(
     const grpc_core::GsecKeyFactoryInterface& key_factory, bool is_client,
@@ -280,6 +490,10 @@ tsi_result alts_zero_copy_grpc_protector_create(
     status = create_alts_grpc_record_protocol(
         key_factory.Create(), is_client, is_integrity_only,
         /*is_protect=*/false, enable_extra_copy, &impl->unrecord_protocol);
+    if (status == TSI_OK) {
+      status = create_parallel_record_protocols(
+          key_factory, is_client, is_integrity_only, enable_extra_copy, impl);
+    }
     if (status == TSI_OK) {
       // Sets maximum frame size.
       size_t max_protected_frame_size_to_set = kDefaultFrameLength;
@@ -309,6 +523,7 @@ tsi_result alts_zero_copy_grpc_protector_create(
   // Cleanup if create failed.
   alts_grpc_record_protocol_destroy(impl->record_protocol);
   alts_grpc_record_protocol_destroy(impl->unrecord_protocol);
+  destroy_parallel_record_protocols(impl);
   gpr_free(impl);
   return TSI_INTERNAL_ERROR;
 }
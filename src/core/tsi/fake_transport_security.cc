@@ -425,6 +425,7 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     fake_protector_protect_flush,
     fake_protector_unprotect,
     fake_protector_destroy,
+    nullptr,  // offload_protect
 };
 
 // --- tsi_zero_copy_grpc_protector methods implementation. ---
@@ -521,6 +522,7 @@ static const tsi_zero_copy_grpc_protector_vtable
         fake_zero_copy_grpc_protector_unprotect,
         fake_zero_copy_grpc_protector_destroy,
         fake_zero_copy_grpc_protector_max_frame_size,
+        nullptr,  // offload_protect
 };
 
 // --- tsi_handshaker_result methods implementation. ---
@@ -0,0 +1,161 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/tsi/ssl/session_cache/ssl_session_ticket_keys.h"
+
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+#include "absl/log/check.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/no_destruct.h"
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000 && !defined(OPENSSL_IS_BORINGSSL)
+#include <openssl/core_names.h>
+#define TSI_SSL_TICKET_KEY_EVP_MAC
+#else
+#include <openssl/hmac.h>
+#endif
+
+namespace tsi {
+
+namespace {
+
+SslSessionTicketKeys* g_process_wide_keys = nullptr;
+
+void GenerateKey(SslSessionTicketKeys::Key* key) {
+  CHECK_EQ(RAND_bytes(reinterpret_cast<uint8_t*>(key), sizeof(*key)), 1);
+}
+
+#ifdef TSI_SSL_TICKET_KEY_EVP_MAC
+bool InitMac(EVP_MAC_CTX* ctx, const SslSessionTicketKeys::Key& key) {
+  OSSL_PARAM params[] = {
+      OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                       const_cast<char*>("SHA256"), 0),
+      OSSL_PARAM_construct_end()};
+  return EVP_MAC_init(ctx, key.hmac_key, sizeof(key.hmac_key), params) == 1;
+}
+#else
+bool InitMac(HMAC_CTX* ctx, const SslSessionTicketKeys::Key& key) {
+  return HMAC_Init_ex(ctx, key.hmac_key, sizeof(key.hmac_key), EVP_sha256(),
+                      nullptr) == 1;
+}
+#endif
+
+// Ticket key callback of SSL_CTX_set_tlsext_ticket_key_cb() (or of its
+// EVP_MAC_CTX flavor on OpenSSL 3). Returns 1 to use the key it set up, 2 to
+// use it and issue a new ticket, 0 to reject the ticket and -1 on errors.
+template <typename MacCtx>
+int TicketKeyCallback(SSL* /*ssl*/, uint8_t* key_name, uint8_t* iv,
+                      EVP_CIPHER_CTX* cipher_ctx, MacCtx* mac_ctx,
+                      int encrypt) {
+  SslSessionTicketKeys::Key key;
+  int result = -1;
+  const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+  if (encrypt) {
+    key = g_process_wide_keys->EncryptionKey(now);
+    memcpy(key_name, key.name, sizeof(key.name));
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) == 1 &&
+        EVP_EncryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key,
+                           iv) == 1 &&
+        InitMac(mac_ctx, key)) {
+      result = 1;
+    }
+  } else {
+    switch (g_process_wide_keys->DecryptionKey(key_name, now, &key)) {
+      case SslSessionTicketKeys::Match::kNone:
+        return 0;
+      case SslSessionTicketKeys::Match::kCurrent:
+        result = 1;
+        break;
+      case SslSessionTicketKeys::Match::kPrevious:
+        result = 2;
+        break;
+    }
+    if (EVP_DecryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key.aes_key,
+                           iv) != 1 ||
+        !InitMac(mac_ctx, key)) {
+      result = -1;
+    }
+  }
+  OPENSSL_cleanse(&key, sizeof(key));
+  return result;
+}
+
+}  // namespace
+
+SslSessionTicketKeys::SslSessionTicketKeys(grpc_core::Duration rotation_period)
+    : rotation_period_(rotation_period) {}
+
+SslSessionTicketKeys::~SslSessionTicketKeys() {
+  OPENSSL_cleanse(&current_, sizeof(current_));
+  OPENSSL_cleanse(&previous_, sizeof(previous_));
+}
+
+bool SslSessionTicketKeys::InstallProcessWideKeys(
+    SSL_CTX* ctx, grpc_core::Duration rotation_period) {
+  static grpc_core::NoDestruct<SslSessionTicketKeys> keys(rotation_period);
+  g_process_wide_keys = keys.get();
+#ifdef TSI_SSL_TICKET_KEY_EVP_MAC
+  return SSL_CTX_set_tlsext_ticket_key_evp_cb(
+             ctx, TicketKeyCallback<EVP_MAC_CTX>) == 1;
+#else
+  return SSL_CTX_set_tlsext_ticket_key_cb(ctx, TicketKeyCallback<HMAC_CTX>) ==
+         1;
+#endif
+}
+
+SslSessionTicketKeys::Key SslSessionTicketKeys::EncryptionKey(
+    grpc_core::Timestamp now) {
+  grpc_core::MutexLock lock(&mu_);
+  MaybeRotateLocked(now);
+  return current_;
+}
+
+SslSessionTicketKeys::Match SslSessionTicketKeys::DecryptionKey(
+    const uint8_t* key_name, grpc_core::Timestamp now, Key* key) {
+  grpc_core::MutexLock lock(&mu_);
+  MaybeRotateLocked(now);
+  if (memcmp(key_name, current_.name, kKeyNameSize) == 0) {
+    *key = current_;
+    return Match::kCurrent;
+  }
+  if (has_previous_ && memcmp(key_name, previous_.name, kKeyNameSize) == 0) {
+    *key = previous_;
+    return Match::kPrevious;
+  }
+  return Match::kNone;
+}
+
+void SslSessionTicketKeys::MaybeRotateLocked(grpc_core::Timestamp now) {
+  if (has_current_ && now - current_created_ < rotation_period_) return;
+  // The current key becomes the previous one, unless it has been idle for so
+  // long that its tickets already expired.
+  has_previous_ = has_current_ && now - current_created_ < rotation_period_ * 2;
+  if (has_previous_) previous_ = current_;
+  GenerateKey(&current_);
+  has_current_ = true;
+  current_created_ = now;
+}
+
+}  // namespace tsi
@@ -0,0 +1,107 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_SESSION_CACHE_SSL_SESSION_TICKET_KEYS_H
+#define GRPC_SRC_CORE_TSI_SSL_SESSION_CACHE_SSL_SESSION_TICKET_KEYS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openssl/ssl.h>
+
+#include "absl/base/thread_annotations.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+/// Session ticket encryption keys for TLS servers.
+///
+/// Keys are rotated every rotation period: new tickets are always issued
+/// under the newest key, and tickets issued under the key before it are still
+/// accepted, and renewed, until the next rotation. A ticket is therefore
+/// accepted for at least one and at most two rotation periods.
+///
+/// The process-wide instance is shared by every server handshaker factory that
+/// is not given a session ticket key of its own, so that a client can resume
+/// its session with any listener of the process, and across credential
+/// reloads.
+///
+/// This class is thread safe.
+
+namespace tsi {
+
+class SslSessionTicketKeys {
+ public:
+  static constexpr size_t kKeyNameSize = 16;
+  static constexpr size_t kAesKeySize = 32;
+  static constexpr size_t kHmacKeySize = 32;
+
+  struct Key {
+    uint8_t name[kKeyNameSize];
+    uint8_t aes_key[kAesKeySize];
+    uint8_t hmac_key[kHmacKeySize];
+  };
+
+  enum class Match {
+    // No key has the name of the ticket: it is too old or was not issued by
+    // this process.
+    kNone,
+    // The ticket was issued under the newest key.
+    kCurrent,
+    // The ticket was issued under the previous key and should be renewed.
+    kPrevious,
+  };
+
+  explicit SslSessionTicketKeys(grpc_core::Duration rotation_period);
+  ~SslSessionTicketKeys();
+
+  SslSessionTicketKeys(const SslSessionTicketKeys&) = delete;
+  SslSessionTicketKeys& operator=(const SslSessionTicketKeys&) = delete;
+
+  /// Makes \a ctx issue and accept session tickets with the process-wide
+  /// keys, which are created with \a rotation_period the first time this is
+  /// called. Returns false if the TLS library rejected the ticket callback.
+  static bool InstallProcessWideKeys(SSL_CTX* ctx,
+                                     grpc_core::Duration rotation_period);
+
+  /// Returns the key to issue a new ticket with at \a now.
+  Key EncryptionKey(grpc_core::Timestamp now);
+
+  /// Looks up the key that the ticket named \a key_name was issued with and
+  /// copies it into \a key if it is still accepted at \a now.
+  Match DecryptionKey(const uint8_t* key_name, grpc_core::Timestamp now,
+                      Key* key);
+
+ private:
+  void MaybeRotateLocked(grpc_core::Timestamp now)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const grpc_core::Duration rotation_period_;
+  grpc_core::Mutex mu_;
+  Key current_ ABSL_GUARDED_BY(mu_);
+  Key previous_ ABSL_GUARDED_BY(mu_);
+  bool has_current_ ABSL_GUARDED_BY(mu_) = false;
+  bool has_previous_ ABSL_GUARDED_BY(mu_) = false;
+  grpc_core::Timestamp current_created_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_SESSION_CACHE_SSL_SESSION_TICKET_KEYS_H
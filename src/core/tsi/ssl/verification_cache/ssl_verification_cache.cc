@@ -0,0 +1,174 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include <openssl/asn1.h>
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+
+#include <grpc/support/port_platform.h>
+
+namespace tsi {
+
+namespace {
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000 && !defined(LIBRESSL_VERSION_NUMBER)
+bool DigestCert(EVP_MD_CTX* md_ctx, X509* cert) {
+  if (cert == nullptr) return false;
+  int der_length = i2d_X509(cert, nullptr);
+  if (der_length <= 0) return false;
+  std::string der(static_cast<size_t>(der_length), '\0');
+  unsigned char* der_ptr = reinterpret_cast<unsigned char*>(&der[0]);
+  if (i2d_X509(cert, &der_ptr) != der_length) return false;
+  return EVP_DigestUpdate(md_ctx, der.data(), der.size()) == 1;
+}
+#endif
+
+void X509Ref(X509* cert) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+  X509_up_ref(cert);
+#else
+  CRYPTO_add(&cert->references, 1, CRYPTO_LOCK_X509);
+#endif
+}
+
+const ASN1_TIME* NotAfter(X509* cert) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+  return X509_get0_notAfter(cert);
+#else
+  return X509_get_notAfter(cert);
+#endif
+}
+
+}  // namespace
+
+SslVerificationCache::SslVerificationCache(size_t capacity)
+    : capacity_(capacity) {}
+
+SslVerificationCache::~SslVerificationCache() {
+  for (Entry& entry : entries_) X509_free(entry.root);
+}
+
+absl::optional<std::string> SslVerificationCache::KeyForPeerChain(
+    X509_STORE_CTX* ctx) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000 && !defined(LIBRESSL_VERSION_NUMBER)
+  // The leaf followed by the untrusted certificates sent along with it. DER
+  // encodings are self-delimiting, so no two chains digest the same input.
+  X509* leaf = X509_STORE_CTX_get0_cert(ctx);
+  STACK_OF(X509)* untrusted = X509_STORE_CTX_get0_untrusted(ctx);
+  if (leaf == nullptr) return absl::nullopt;
+  EVP_MD_CTX* md_ctx = EVP_MD_CTX_new();
+  if (md_ctx == nullptr) return absl::nullopt;
+  bool ok = EVP_DigestInit_ex(md_ctx, EVP_sha256(), nullptr) == 1 &&
+            DigestCert(md_ctx, leaf);
+  // See CheckChainRevocation() in ssl_transport_security.cc for why the size
+  // is read as a size_t: a -1 from OpenSSL makes sk_X509_value() fail.
+  size_t untrusted_length = untrusted == nullptr ? 0 : sk_X509_num(untrusted);
+  for (size_t i = 0; ok && i < untrusted_length; i++) {
+    ok = DigestCert(md_ctx, sk_X509_value(untrusted, i));
+  }
+  unsigned char digest[EVP_MAX_MD_SIZE];
+  unsigned int digest_length = 0;
+  ok = ok && EVP_DigestFinal_ex(md_ctx, digest, &digest_length) == 1;
+  EVP_MD_CTX_free(md_ctx);
+  if (!ok) return absl::nullopt;
+  return std::string(reinterpret_cast<const char*>(digest), digest_length);
+#else
+  (void)ctx;
+  return absl::nullopt;
+#endif
+}
+
+X509* SslVerificationCache::Lookup(
+    absl::string_view key, grpc_core::experimental::CrlProvider* crl_provider,
+    grpc_core::Timestamp now) {
+  grpc_core::MutexLock lock(&mu_);
+  auto it = index_.find(key);
+  if (it == index_.end()) return nullptr;
+  EntryList::iterator entry = it->second;
+  bool valid = now < entry->expiration;
+  // A provider that reloaded its CRLs returns new Crl objects, so comparing
+  // them by identity tells whether the revocation data changed.
+  for (const CrlDependency& dependency : entry->crl_dependencies) {
+    if (!valid) break;
+    valid = crl_provider != nullptr &&
+            crl_provider->GetCrl(dependency.certificate_info) == dependency.crl;
+  }
+  if (!valid) {
+    RemoveLocked(entry);
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, entry);
+  X509Ref(entry->root);
+  return entry->root;
+}
+
+void SslVerificationCache::Insert(std::string key,
+                                  STACK_OF(X509)* verified_chain,
+                                  std::vector<CrlDependency> crl_dependencies,
+                                  grpc_core::Timestamp now) {
+  if (verified_chain == nullptr) return;
+  size_t chain_length = sk_X509_num(verified_chain);
+  if (chain_length == 0) return;
+  grpc_core::Timestamp expiration = grpc_core::Timestamp::InfFuture();
+  for (size_t i = 0; i < chain_length; i++) {
+    X509* cert = sk_X509_value(verified_chain, i);
+    int days;
+    int seconds;
+    if (cert == nullptr ||
+        ASN1_TIME_diff(&days, &seconds, nullptr, NotAfter(cert)) != 1) {
+      return;
+    }
+    expiration = std::min(
+        expiration,
+        now + grpc_core::Duration::Seconds(days * int64_t{86400} + seconds));
+  }
+  if (expiration <= now) return;
+  // The root is the last certificate of the chain.
+  X509* root = sk_X509_value(verified_chain, chain_length - 1);
+  X509Ref(root);
+  grpc_core::MutexLock lock(&mu_);
+  auto it = index_.find(key);
+  if (it != index_.end()) RemoveLocked(it->second);
+  entries_.push_front(
+      Entry{std::move(key), root, expiration, std::move(crl_dependencies)});
+  index_.emplace(entries_.front().key, entries_.begin());
+  while (entries_.size() > capacity_) {
+    RemoveLocked(std::prev(entries_.end()));
+  }
+}
+
+size_t SslVerificationCache::Size() {
+  grpc_core::MutexLock lock(&mu_);
+  return entries_.size();
+}
+
+void SslVerificationCache::RemoveLocked(EntryList::iterator entry) {
+  X509_free(entry->root);
+  index_.erase(entry->key);
+  entries_.erase(entry);
+}
+
+}  // namespace tsi
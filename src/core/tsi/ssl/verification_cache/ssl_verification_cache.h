@@ -0,0 +1,115 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_VERIFICATION_CACHE_SSL_VERIFICATION_CACHE_H
+#define GRPC_SRC_CORE_TSI_SSL_VERIFICATION_CACHE_SSL_VERIFICATION_CACHE_H
+
+#include <stddef.h>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <openssl/x509.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include <grpc/grpc_crl_provider.h>
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/security/credentials/tls/grpc_tls_crl_provider.h"
+
+/// Cache of successful peer certificate chain verifications.
+///
+/// Entries are keyed by a digest of the chain presented by the peer and hold
+/// the root the chain was verified against. An entry is only returned until
+/// the first certificate of its verified chain expires, and only while the
+/// CRL provider still returns the very CRLs the verification relied on. The
+/// trust bundle is not part of the key: a cache must only be shared by
+/// SSL_CTXs that trust the same roots, which is why each handshaker factory
+/// owns its own.
+///
+/// This class is thread safe.
+
+namespace tsi {
+
+class SslVerificationCache {
+ public:
+  /// A CRL that the revocation checks of a verification were made against,
+  /// or the absence of one, together with what it was looked up by.
+  struct CrlDependency {
+    grpc_core::experimental::CertificateInfoImpl certificate_info;
+    std::shared_ptr<grpc_core::experimental::Crl> crl;
+  };
+
+  explicit SslVerificationCache(size_t capacity);
+  ~SslVerificationCache();
+
+  SslVerificationCache(const SslVerificationCache&) = delete;
+  SslVerificationCache& operator=(const SslVerificationCache&) = delete;
+
+  /// Returns the cache key of the chain that the peer presented in \a ctx,
+  /// or nullopt if it cannot be computed.
+  static absl::optional<std::string> KeyForPeerChain(X509_STORE_CTX* ctx);
+
+  /// Returns a new reference to the root that the chain of \a key was
+  /// verified against, or null if there is no entry for it or the entry is
+  /// no longer valid at \a now or under \a crl_provider.
+  X509* Lookup(absl::string_view key,
+               grpc_core::experimental::CrlProvider* crl_provider,
+               grpc_core::Timestamp now);
+
+  /// Records that \a verified_chain was successfully verified at \a now with
+  /// the revocation data of \a crl_dependencies. This operation may discard
+  /// older entries.
+  void Insert(std::string key, STACK_OF(X509)* verified_chain,
+              std::vector<CrlDependency> crl_dependencies,
+              grpc_core::Timestamp now);
+
+  /// Returns current number of entries in the cache.
+  size_t Size();
+
+ private:
+  struct Entry {
+    std::string key;
+    X509* root;
+    grpc_core::Timestamp expiration;
+    std::vector<CrlDependency> crl_dependencies;
+  };
+  using EntryList = std::list<Entry>;
+
+  void RemoveLocked(EntryList::iterator entry)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const size_t capacity_;
+  grpc_core::Mutex mu_;
+  // Most recently used first.
+  EntryList entries_ ABSL_GUARDED_BY(mu_);
+  absl::flat_hash_map<absl::string_view, EntryList::iterator> index_
+      ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_VERIFICATION_CACHE_SSL_VERIFICATION_CACHE_H
@@ -35,8 +35,11 @@
 #include <sys/socket.h>
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <openssl/bio.h>
 #include <openssl/crypto.h>  // For OPENSSL_free
@@ -47,26 +50,42 @@
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
 #include <grpc/grpc_crl_provider.h>
 #include <grpc/grpc_security.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/thd_id.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_crl_provider.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
+#include "src/core/tsi/ssl/session_cache/ssl_session_ticket_keys.h"
+#include "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/util/useful.h"
 
 // --- Constants. ---
@@ -121,8 +140,12 @@ struct tsi_ssl_server_handshaker_factory {
   unsigned char* alpn_protocol_list;
   size_t alpn_protocol_list_length;
   grpc_core::RefCountedPtr<TlsSessionKeyLogger> key_logger;
+  // Shared by all the contexts, which trust the same client roots.
+  std::unique_ptr<tsi::SslVerificationCache> verification_cache;
 };
 
+class SslPrivateKeyOperation;
+
 struct tsi_ssl_handshaker {
   tsi_handshaker base;
   SSL* ssl;
@@ -131,6 +154,20 @@ struct tsi_ssl_handshaker {
   unsigned char* outgoing_bytes_buffer;
   size_t outgoing_bytes_buffer_size;
   tsi_ssl_handshaker_factory* factory_ref;
+  // The private key operation of the handshake, if one was started with a
+  // tsi::SslPrivateKeySigner.
+  SslPrivateKeyOperation* private_key_op;
+  // The state of a tsi_handshaker_next() call suspended on private_key_op:
+  // the received bytes not fed to |ssl| yet, the size of the bytes to send
+  // that are already in |outgoing_bytes_buffer|, the total size of the
+  // received bytes and the arguments to resume the call with.
+  unsigned char* pending_received_bytes;
+  size_t pending_received_bytes_size;
+  size_t pending_bytes_to_send_size;
+  size_t pending_total_received_bytes_size;
+  tsi_handshaker_on_next_done_cb pending_cb;
+  void* pending_user_data;
+  std::string* pending_error;
 };
 struct tsi_ssl_handshaker_result {
   tsi_handshaker_result base;
@@ -146,14 +183,64 @@ struct tsi_ssl_frame_protector {
   unsigned char* buffer;
   size_t buffer_size;
   size_t buffer_offset;
+  // Whether the kernel protects the outgoing data (see offload_protect).
+  bool kernel_tx_offload;
 };
+static void ssl_handshaker_on_private_key_op_done(tsi_ssl_handshaker* impl);
+
+// The state of a signature computed by a tsi::SslPrivateKeySigner, shared by
+// the handshaker and the callback of the signer.
+class SslPrivateKeyOperation
+    : public grpc_core::RefCounted<SslPrivateKeyOperation> {
+ public:
+  // Called by the signer when the signature is ready.
+  void OnDone(absl::StatusOr<std::string> signature) {
+    tsi_ssl_handshaker* suspended_handshaker;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      signature_ = std::move(signature);
+      done_ = true;
+      suspended_handshaker = std::exchange(suspended_handshaker_, nullptr);
+    }
+    if (suspended_handshaker != nullptr) {
+      ssl_handshaker_on_private_key_op_done(suspended_handshaker);
+    }
+  }
+
+  // Returns false if the signature is already available. Otherwise returns
+  // true, and |impl| is resumed once the signature is available.
+  bool SuspendHandshake(tsi_ssl_handshaker* impl) {
+    grpc_core::MutexLock lock(&mu_);
+    if (done_) return false;
+    suspended_handshaker_ = impl;
+    return true;
+  }
+
+  // Moves the signature to |signature| if it is available.
+  bool TakeSignature(absl::StatusOr<std::string>* signature) {
+    grpc_core::MutexLock lock(&mu_);
+    if (!done_) return false;
+    *signature = std::move(signature_);
+    return true;
+  }
+
+ private:
+  grpc_core::Mutex mu_;
+  bool done_ ABSL_GUARDED_BY(mu_) = false;
+  absl::StatusOr<std::string> signature_ ABSL_GUARDED_BY(mu_);
+  tsi_ssl_handshaker* suspended_handshaker_ ABSL_GUARDED_BY(mu_) = nullptr;
+};
+
 // --- Library Initialization. ---
 
 static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
 static int g_ssl_ctx_ex_factory_index = -1;
 static int g_ssl_ctx_ex_crl_provider_index = -1;
+static int g_ssl_ctx_ex_private_key_signer_index = -1;
+static int g_ssl_ctx_ex_verification_cache_index = -1;
 static const unsigned char kSslSessionIdContext[] = {'g', 'r', 'p', 'c'};
 static int g_ssl_ex_verified_root_cert_index = -1;
+static int g_ssl_ex_handshaker_index = -1;
 #if !defined(OPENSSL_IS_BORINGSSL) && !defined(OPENSSL_NO_ENGINE)
 static const char kSslEnginePrefix[] = "engine:";
 #endif
@@ -217,9 +304,21 @@ static void init_openssl(void) {
       SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
   CHECK_NE(g_ssl_ctx_ex_crl_provider_index, -1);
 
+  g_ssl_ctx_ex_private_key_signer_index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  CHECK_NE(g_ssl_ctx_ex_private_key_signer_index, -1);
+
+  g_ssl_ctx_ex_verification_cache_index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  CHECK_NE(g_ssl_ctx_ex_verification_cache_index, -1);
+
   g_ssl_ex_verified_root_cert_index = SSL_get_ex_new_index(
       0, nullptr, nullptr, nullptr, verified_root_cert_free);
   CHECK_NE(g_ssl_ex_verified_root_cert_index, -1);
+
+  g_ssl_ex_handshaker_index =
+      SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  CHECK_NE(g_ssl_ex_handshaker_index, -1);
 }
 
 // --- Ssl utils. ---
@@ -697,6 +796,91 @@ static tsi_result ssl_ctx_use_private_key(SSL_CTX* context, const char* pem_key,
   }
 }
 
+#if defined(OPENSSL_IS_BORINGSSL)
+// Starts signing the handshake with the tsi::SslPrivateKeySigner of the SSL
+// context. The handshake retries until ssl_private_key_complete() has the
+// signature.
+static enum ssl_private_key_result_t ssl_private_key_sign(
+    SSL* ssl, uint8_t* /*out*/, size_t* /*out_len*/, size_t /*max_out*/,
+    uint16_t signature_algorithm, const uint8_t* in, size_t in_len) {
+  tsi_ssl_handshaker* impl = static_cast<tsi_ssl_handshaker*>(
+      SSL_get_ex_data(ssl, g_ssl_ex_handshaker_index));
+  tsi::SslPrivateKeySigner* signer = static_cast<tsi::SslPrivateKeySigner*>(
+      SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl),
+                          g_ssl_ctx_ex_private_key_signer_index));
+  if (impl == nullptr || signer == nullptr || impl->private_key_op != nullptr) {
+    LOG(ERROR) << "Unexpected private key operation.";
+    return ssl_private_key_failure;
+  }
+  impl->private_key_op = new SslPrivateKeyOperation();
+  signer->Sign(
+      absl::string_view(reinterpret_cast<const char*>(in), in_len),
+      signature_algorithm,
+      [op = impl->private_key_op->Ref()](
+          absl::StatusOr<std::string> signature) mutable {
+        op->OnDone(std::move(signature));
+      });
+  return ssl_private_key_retry;
+}
+
+static enum ssl_private_key_result_t ssl_private_key_decrypt(
+    SSL* /*ssl*/, uint8_t* /*out*/, size_t* /*out_len*/, size_t /*max_out*/,
+    const uint8_t* /*in*/, size_t /*in_len*/) {
+  // Only reached with the RSA key exchange cipher suites, which gRPC does not
+  // offer by default.
+  LOG(ERROR) << "Private key signers do not support RSA decryption.";
+  return ssl_private_key_failure;
+}
+
+static enum ssl_private_key_result_t ssl_private_key_complete(
+    SSL* ssl, uint8_t* out, size_t* out_len, size_t max_out) {
+  tsi_ssl_handshaker* impl = static_cast<tsi_ssl_handshaker*>(
+      SSL_get_ex_data(ssl, g_ssl_ex_handshaker_index));
+  if (impl == nullptr || impl->private_key_op == nullptr) {
+    return ssl_private_key_failure;
+  }
+  absl::StatusOr<std::string> signature;
+  if (!impl->private_key_op->TakeSignature(&signature)) {
+    return ssl_private_key_retry;
+  }
+  impl->private_key_op->Unref();
+  impl->private_key_op = nullptr;
+  if (!signature.ok()) {
+    LOG(ERROR) << "Private key operation failed: " << signature.status();
+    return ssl_private_key_failure;
+  }
+  if (signature->size() > max_out) {
+    LOG(ERROR) << "Signature of " << signature->size()
+               << " bytes is larger than " << max_out << " bytes.";
+    return ssl_private_key_failure;
+  }
+  memcpy(out, signature->data(), signature->size());
+  *out_len = signature->size();
+  return ssl_private_key_success;
+}
+
+static const SSL_PRIVATE_KEY_METHOD kSslPrivateKeyMethod = {
+    ssl_private_key_sign, ssl_private_key_decrypt, ssl_private_key_complete};
+#endif  // defined(OPENSSL_IS_BORINGSSL)
+
+// Makes |signer| sign the handshakes of the SSL context.
+static tsi_result ssl_ctx_use_private_key_signer(
+    SSL_CTX* context, tsi::SslPrivateKeySigner* signer) {
+#if defined(OPENSSL_IS_BORINGSSL)
+  if (!SSL_CTX_set_ex_data(context, g_ssl_ctx_ex_private_key_signer_index,
+                           signer)) {
+    return TSI_INTERNAL_ERROR;
+  }
+  SSL_CTX_set_private_key_method(context, &kSslPrivateKeyMethod);
+  return TSI_OK;
+#else
+  (void)context;
+  (void)signer;
+  LOG(ERROR) << "Private key signers are only supported with BoringSSL.";
+  return TSI_UNIMPLEMENTED;
+#endif  // defined(OPENSSL_IS_BORINGSSL)
+}
+
 // Loads in-memory PEM verification certs into the SSL context and optionally
 // returns the verification cert names (root_names can be NULL).
 static tsi_result x509_store_load_certs(X509_STORE* cert_store,
@@ -784,7 +968,7 @@ static tsi_result ssl_ctx_load_verification_certs(SSL_CTX* context,
 // cipher list and the ephemeral ECDH key.
 static tsi_result populate_ssl_context(
     SSL_CTX* context, const tsi_ssl_pem_key_cert_pair* key_cert_pair,
-    const char* cipher_list) {
+    const char* cipher_list, tsi::SslPrivateKeySigner* private_key_signer) {
   tsi_result result = TSI_OK;
   if (key_cert_pair != nullptr) {
     if (key_cert_pair->cert_chain != nullptr) {
@@ -795,7 +979,10 @@ static tsi_result populate_ssl_context(
         return result;
       }
     }
-    if (key_cert_pair->private_key != nullptr) {
+    if (private_key_signer != nullptr) {
+      result = ssl_ctx_use_private_key_signer(context, private_key_signer);
+      if (result != TSI_OK) return result;
+    } else if (key_cert_pair->private_key != nullptr) {
       result = ssl_ctx_use_private_key(context, key_cert_pair->private_key,
                                        strlen(key_cert_pair->private_key));
       if (result != TSI_OK || !SSL_CTX_check_private_key(context)) {
@@ -911,6 +1098,42 @@ static int NullVerifyCallback(X509_STORE_CTX* /*ctx*/, void* /*arg*/) {
   return 1;
 }
 
+static SSL* GetSsl(X509_STORE_CTX* ctx) {
+  ERR_clear_error();
+  int ssl_index = SSL_get_ex_data_X509_STORE_CTX_idx();
+  if (ssl_index < 0) {
+    char err_str[256];
+    ERR_error_string_n(ERR_get_error(), err_str, sizeof(err_str));
+    LOG(ERROR) << "error getting the SSL index from the X509_STORE_CTX: "
+               << err_str;
+    return nullptr;
+  }
+  return static_cast<SSL*>(X509_STORE_CTX_get_ex_data(ctx, ssl_index));
+}
+
+// Puts \a root_cert on \a ssl so that we have access to it when populating
+// the tsi_peer.
+static void SetVerifiedRootCert(SSL* ssl, X509* root_cert) {
+  // Free the old root and save the new one. There should not be an old root,
+  // but if renegotiation is not disabled (required by RFC 9113, Section
+  // 9.2.1), it is possible that this callback run multiple times for a single
+  // connection. gRPC does not always disable renegotiation. See
+  // https://github.com/grpc/grpc/issues/35368
+  X509_free(static_cast<X509*>(
+      SSL_get_ex_data(ssl, g_ssl_ex_verified_root_cert_index)));
+  int success =
+      SSL_set_ex_data(ssl, g_ssl_ex_verified_root_cert_index, root_cert);
+  if (success == 0) {
+    LOG(INFO) << "Could not set verified root cert in SSL's ex_data";
+  } else {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+    X509_up_ref(root_cert);
+#else
+    CRYPTO_add(&root_cert->references, 1, CRYPTO_LOCK_X509);
+#endif
+  }
+}
+
 static int RootCertExtractCallback(X509_STORE_CTX* ctx, void* /*arg*/) {
   int ret = 1;
   // Verification was successful. Get the verified chain from the X509_STORE_CTX
@@ -937,38 +1160,11 @@ static int RootCertExtractCallback(X509_STORE_CTX* ctx, void* /*arg*/) {
     return ret;
   }
 
-  ERR_clear_error();
-  int ssl_index = SSL_get_ex_data_X509_STORE_CTX_idx();
-  if (ssl_index < 0) {
-    char err_str[256];
-    ERR_error_string_n(ERR_get_error(), err_str, sizeof(err_str));
-    LOG(ERROR) << "error getting the SSL index from the X509_STORE_CTX: "
-               << err_str;
-    return ret;
-  }
-  SSL* ssl = static_cast<SSL*>(X509_STORE_CTX_get_ex_data(ctx, ssl_index));
+  SSL* ssl = GetSsl(ctx);
   if (ssl == nullptr) {
     return ret;
   }
-
-  // Free the old root and save the new one. There should not be an old root,
-  // but if renegotiation is not disabled (required by RFC 9113, Section
-  // 9.2.1), it is possible that this callback run multiple times for a single
-  // connection. gRPC does not always disable renegotiation. See
-  // https://github.com/grpc/grpc/issues/35368
-  X509_free(static_cast<X509*>(
-      SSL_get_ex_data(ssl, g_ssl_ex_verified_root_cert_index)));
-  int success =
-      SSL_set_ex_data(ssl, g_ssl_ex_verified_root_cert_index, root_cert);
-  if (success == 0) {
-    LOG(INFO) << "Could not set verified root cert in SSL's ex_data";
-  } else {
-#if OPENSSL_VERSION_NUMBER >= 0x10100000L
-    X509_up_ref(root_cert);
-#else
-    CRYPTO_add(&root_cert->references, 1, CRYPTO_LOCK_X509);
-#endif
-  }
+  SetVerifiedRootCert(ssl, root_cert);
   return ret;
 }
 
@@ -997,9 +1193,11 @@ static grpc_core::experimental::CrlProvider* GetCrlProvider(
 }
 
 // If a CRL is returned, the caller is the owner of the CRL and must make sure
-// it is freed.
+// it is freed. If \a crl_dependencies is not null, the lookup is recorded in
+// it.
 static absl::StatusOr<X509_CRL*> GetCrlFromProvider(
-    grpc_core::experimental::CrlProvider* provider, X509* cert) {
+    grpc_core::experimental::CrlProvider* provider, X509* cert,
+    std::vector<tsi::SslVerificationCache::CrlDependency>* crl_dependencies) {
   if (provider == nullptr) {
     return absl::InvalidArgumentError("CrlProvider is null.");
   }
@@ -1020,6 +1218,9 @@ static absl::StatusOr<X509_CRL*> GetCrlFromProvider(
                                                          akid_to_use);
   std::shared_ptr<grpc_core::experimental::Crl> internal_crl =
       provider->GetCrl(cert_impl);
+  if (crl_dependencies != nullptr) {
+    crl_dependencies->push_back({std::move(cert_impl), internal_crl});
+  }
   // There wasn't a CRL found in the provider. Returning 0 will end up causing
   // OpenSSL to return X509_V_ERR_UNABLE_TO_GET_CRL. We then catch that error
   // and behave how we want for a missing CRL.
@@ -1067,9 +1268,10 @@ static bool ValidateCrl(X509* cert, X509* issuer, X509_CRL* crl) {
 
 // Check if a given certificate is revoked
 // Returns 1 if the certificate is not revoked, 0 if the certificate is revoked
-static int CheckCertRevocation(grpc_core::experimental::CrlProvider* provider,
-                               X509* cert, X509* issuer) {
-  auto crl = GetCrlFromProvider(provider, cert);
+static int CheckCertRevocation(
+    grpc_core::experimental::CrlProvider* provider, X509* cert, X509* issuer,
+    std::vector<tsi::SslVerificationCache::CrlDependency>* crl_dependencies) {
+  auto crl = GetCrlFromProvider(provider, cert, crl_dependencies);
   // Not finding a CRL is a specific behavior. Per RFC5280, not having a CRL to
   // check for a given certificate means that we cannot know for certain if the
   // status is Revoked or Unrevoked and instead is Undetermined. How a user
@@ -1110,7 +1312,8 @@ static int CheckCertRevocation(grpc_core::experimental::CrlProvider* provider,
 // Checks each certificate in the chain for revocation
 // returns 0 if any cert in the chain is revoked, 1 otherwise.
 static int CheckChainRevocation(
-    X509_STORE_CTX* ctx, grpc_core::experimental::CrlProvider* provider) {
+    X509_STORE_CTX* ctx, grpc_core::experimental::CrlProvider* provider,
+    std::vector<tsi::SslVerificationCache::CrlDependency>* crl_dependencies) {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
   STACK_OF(X509)* chain = X509_STORE_CTX_get0_chain(ctx);
 #else
@@ -1133,7 +1336,7 @@ static int CheckChainRevocation(
   for (size_t i = 0; i < chain_length - 1; i++) {
     X509* cert = sk_X509_value(chain, i);
     X509* issuer = sk_X509_value(chain, i + 1);
-    int ret = CheckCertRevocation(provider, cert, issuer);
+    int ret = CheckCertRevocation(provider, cert, issuer, crl_dependencies);
     if (ret != 1) {
       return ret;
     }
@@ -1141,13 +1344,40 @@ static int CheckChainRevocation(
   return 1;
 }
 
+static tsi::SslVerificationCache* GetVerificationCache(X509_STORE_CTX* ctx) {
+  SSL* ssl = GetSsl(ctx);
+  if (ssl == nullptr) return nullptr;
+  return static_cast<tsi::SslVerificationCache*>(SSL_CTX_get_ex_data(
+      SSL_get_SSL_CTX(ssl), g_ssl_ctx_ex_verification_cache_index));
+}
+
 // The custom verification function to set in OpenSSL using
 // X509_set_cert_verify_callback. This calls the standard OpenSSL procedure
 // (X509_verify_cert), then also extracts the root certificate in the built
 // chain and does revocation checks when a user has configured CrlProviders.
+// If the context has a verification cache, a chain found in it is accepted
+// without being verified again, and a successfully verified one is added.
 // returns 1 on success, indicating a trusted chain to a root of trust was
 // found, 0 if a trusted chain could not be built.
 static int CustomVerificationFunction(X509_STORE_CTX* ctx, void* arg) {
+  grpc_core::experimental::CrlProvider* provider = GetCrlProvider(ctx);
+  tsi::SslVerificationCache* cache = GetVerificationCache(ctx);
+  absl::optional<std::string> cache_key;
+  if (cache != nullptr) {
+    cache_key = tsi::SslVerificationCache::KeyForPeerChain(ctx);
+  }
+  if (cache_key.has_value()) {
+    X509* root_cert =
+        cache->Lookup(*cache_key, provider, grpc_core::Timestamp::Now());
+    if (root_cert != nullptr) {
+      grpc_core::global_stats().IncrementSslVerificationCacheHits();
+      SSL* ssl = GetSsl(ctx);
+      if (ssl != nullptr) SetVerifiedRootCert(ssl, root_cert);
+      X509_free(root_cert);
+      return 1;
+    }
+    grpc_core::global_stats().IncrementSslVerificationCacheMisses();
+  }
   int ret = X509_verify_cert(ctx);
   if (ret <= 0) {
     VLOG(2) << "Failed to verify cert chain.";
@@ -1156,14 +1386,25 @@ static int CustomVerificationFunction(X509_STORE_CTX* ctx, void* arg) {
     // revocation, or check anything else.
     return ret;
   }
-  grpc_core::experimental::CrlProvider* provider = GetCrlProvider(ctx);
+  std::vector<tsi::SslVerificationCache::CrlDependency> crl_dependencies;
   if (provider != nullptr) {
-    ret = CheckChainRevocation(ctx, provider);
+    ret = CheckChainRevocation(ctx, provider,
+                               cache_key.has_value() ? &crl_dependencies
+                                                     : nullptr);
     if (ret <= 0) {
       VLOG(2) << "The chain failed revocation checks.";
       return ret;
     }
   }
+  if (cache_key.has_value()) {
+#if OPENSSL_VERSION_NUMBER >= 0x10100000
+    STACK_OF(X509)* chain = X509_STORE_CTX_get0_chain(ctx);
+#else
+    STACK_OF(X509)* chain = X509_STORE_CTX_get_chain(ctx);
+#endif
+    cache->Insert(std::move(*cache_key), chain, std::move(crl_dependencies),
+                  grpc_core::Timestamp::Now());
+  }
   return RootCertExtractCallback(ctx, arg);
 }
 
@@ -1314,9 +1555,21 @@ static tsi_result ssl_protector_unprotect(
     size_t* unprotected_bytes_size) {
   tsi_ssl_frame_protector* impl =
       reinterpret_cast<tsi_ssl_frame_protector*>(self);
-  return grpc_core::SslProtectorUnprotect(
+  tsi_result result = grpc_core::SslProtectorUnprotect(
       protected_frames_bytes, impl->ssl, impl->network_io,
       protected_frames_bytes_size, unprotected_bytes, unprotected_bytes_size);
+  // Reading a TLS 1.3 KeyUpdate that requests one back makes SSL queue its
+  // own KeyUpdate and move to a new write key. Once the kernel owns the write
+  // side neither can reach the peer: the queued record is sealed with SSL's
+  // stale sequence number and the kernel keeps the old key. Fail rather than
+  // carry on with a connection that no longer follows the protocol.
+  if (result == TSI_OK && impl->kernel_tx_offload &&
+      BIO_pending(impl->network_io) > 0) {
+    LOG(ERROR) << "Peer requested a TLS key update, which is not supported "
+                  "with kernel TLS transmit offload.";
+    return TSI_UNIMPLEMENTED;
+  }
+  return result;
 }
 
 static void ssl_protector_destroy(tsi_frame_protector* self) {
@@ -1328,11 +1581,246 @@ static void ssl_protector_destroy(tsi_frame_protector* self) {
   gpr_free(self);
 }
 
+static tsi_result ssl_protector_offload_protect(tsi_frame_protector* self,
+                                                int fd) {
+  tsi_ssl_frame_protector* impl =
+      reinterpret_cast<tsi_ssl_frame_protector*>(self);
+  // Plaintext still buffered or protected frames not yet flushed would be lost
+  // once the kernel takes over the record sequence.
+  if (impl->buffer_offset != 0 || BIO_pending(impl->network_io) > 0) {
+    return TSI_FAILED_PRECONDITION;
+  }
+  tsi_result result = grpc_core::SslEnableKernelTlsTx(impl->ssl, fd);
+  impl->kernel_tx_offload = result == TSI_OK;
+  return result;
+}
+
 static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_protect,
     ssl_protector_protect_flush,
     ssl_protector_unprotect,
     ssl_protector_destroy,
+    ssl_protector_offload_protect,
+};
+
+// --- tsi_zero_copy_grpc_protector methods implementation. ---
+
+// Content type, legacy version and length of a TLS record.
+constexpr size_t kTlsRecordHeaderSize = 5;
+
+// Outputs the size, header included, of the TLS record at the start of |sb|.
+// Returns false if |sb| does not hold a full record header yet.
+static bool ssl_zero_copy_next_record_size(grpc_slice_buffer* sb,
+                                           size_t* record_size) {
+  if (sb->length < kTlsRecordHeaderSize) return false;
+  uint8_t header[kTlsRecordHeaderSize];
+  grpc_slice_buffer_copy_first_into_buffer(sb, kTlsRecordHeaderSize, header);
+  *record_size = kTlsRecordHeaderSize + ((static_cast<size_t>(header[3]) << 8) |
+                                         static_cast<size_t>(header[4]));
+  return true;
+}
+
+// Moves all the protected bytes |ssl| wrote to |network_io| into |sb|.
+static tsi_result ssl_zero_copy_drain_network_io(BIO* network_io,
+                                                 grpc_slice_buffer* sb) {
+  size_t pending;
+  while ((pending = BIO_pending(network_io)) > 0) {
+    grpc_slice slice = GRPC_SLICE_MALLOC(pending);
+    int read_from_bio = BIO_read(network_io, GRPC_SLICE_START_PTR(slice),
+                                 static_cast<int>(pending));
+    if (read_from_bio <= 0) {
+      LOG(ERROR) << "Could not read from BIO even though some data is pending";
+      grpc_core::CSliceUnref(slice);
+      return TSI_INTERNAL_ERROR;
+    }
+    grpc_slice_buffer_add(
+        sb, grpc_slice_split_head(&slice, static_cast<size_t>(read_from_bio)));
+    grpc_core::CSliceUnref(slice);
+  }
+  return TSI_OK;
+}
+
+// Protects and unprotects one TLS record per SSL_write and SSL_read, reading
+// from and writing to slices directly. The plaintext of a record is only
+// copied when it spans several slices.
+struct tsi_ssl_zero_copy_grpc_protector {
+  tsi_zero_copy_grpc_protector base;
+  // SSL_read and SSL_write must not run concurrently on |ssl|.
+  grpc_core::Mutex mu;
+  SSL* ssl = nullptr;
+  BIO* network_io = nullptr;
+  size_t max_protected_frame_size = 0;
+  // Maximum plaintext size of the records produced.
+  size_t max_unprotected_data_size = 0;
+  // Contiguous copy of the plaintext of a record spanning several slices.
+  unsigned char* record_buffer = nullptr;
+  grpc_slice_buffer unprotected_staging_sb;
+  // Received protected bytes not forming a complete record yet.
+  grpc_slice_buffer protected_staging_sb;
+  grpc_slice_buffer record_sb;
+  // Whether the kernel protects the outgoing data (see offload_protect).
+  bool kernel_tx_offload = false;
+};
+
+static tsi_result ssl_zero_copy_grpc_protector_protect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  grpc_core::MutexLock lock(&impl->mu);
+  while (unprotected_slices->length > 0) {
+    const size_t record_size = std::min(unprotected_slices->length,
+                                        impl->max_unprotected_data_size);
+    grpc_slice_buffer_move_first(unprotected_slices, record_size,
+                                 &impl->unprotected_staging_sb);
+    unsigned char* plaintext;
+    if (impl->unprotected_staging_sb.count == 1) {
+      plaintext = GRPC_SLICE_START_PTR(impl->unprotected_staging_sb.slices[0]);
+    } else {
+      grpc_slice_buffer_copy_first_into_buffer(
+          &impl->unprotected_staging_sb, record_size, impl->record_buffer);
+      plaintext = impl->record_buffer;
+    }
+    tsi_result result =
+        grpc_core::DoSslWrite(impl->ssl, plaintext, record_size);
+    grpc_slice_buffer_reset_and_unref(&impl->unprotected_staging_sb);
+    if (result == TSI_OK) {
+      result = ssl_zero_copy_drain_network_io(impl->network_io,
+                                              protected_slices);
+    }
+    if (result != TSI_OK) return result;
+  }
+  return TSI_OK;
+}
+
+// Decrypts whatever |impl->ssl| can out of the bytes given to it so far.
+static tsi_result ssl_zero_copy_read_plaintext(
+    tsi_ssl_zero_copy_grpc_protector* impl, size_t max_plaintext_size,
+    grpc_slice_buffer* unprotected_slices) {
+  while (true) {
+    grpc_slice slice = GRPC_SLICE_MALLOC(max_plaintext_size);
+    size_t plaintext_size = max_plaintext_size;
+    tsi_result result = grpc_core::DoSslRead(
+        impl->ssl, GRPC_SLICE_START_PTR(slice), &plaintext_size);
+    if (result == TSI_OK && plaintext_size > 0) {
+      grpc_slice_buffer_add(unprotected_slices,
+                            grpc_slice_split_head(&slice, plaintext_size));
+    }
+    grpc_core::CSliceUnref(slice);
+    if (result != TSI_OK || plaintext_size == 0) return result;
+  }
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices, int* min_progress_size) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  grpc_core::MutexLock lock(&impl->mu);
+  grpc_slice_buffer_move_into(protected_slices, &impl->protected_staging_sb);
+  size_t record_size = 0;
+  // Only complete records are handed to |ssl|, so that the size of the next
+  // one is known.
+  while (ssl_zero_copy_next_record_size(&impl->protected_staging_sb,
+                                        &record_size) &&
+         impl->protected_staging_sb.length >= record_size) {
+    grpc_slice_buffer_move_first(&impl->protected_staging_sb, record_size,
+                                 &impl->record_sb);
+    // A record never decrypts to more than its payload.
+    const size_t max_plaintext_size = record_size - kTlsRecordHeaderSize;
+    tsi_result result = TSI_OK;
+    for (size_t i = 0; i < impl->record_sb.count && result == TSI_OK; ++i) {
+      const unsigned char* bytes =
+          GRPC_SLICE_START_PTR(impl->record_sb.slices[i]);
+      size_t remaining = GRPC_SLICE_LENGTH(impl->record_sb.slices[i]);
+      while (remaining > 0 && result == TSI_OK) {
+        int written_into_ssl = BIO_write(impl->network_io, bytes,
+                                         static_cast<int>(remaining));
+        if (written_into_ssl > 0) {
+          bytes += written_into_ssl;
+          remaining -= static_cast<size_t>(written_into_ssl);
+          continue;
+        }
+        // The BIO is full: let |ssl| consume some of it.
+        const size_t pending = BIO_ctrl_pending(SSL_get_rbio(impl->ssl));
+        result = ssl_zero_copy_read_plaintext(impl, max_plaintext_size,
+                                              unprotected_slices);
+        if (result == TSI_OK &&
+            BIO_ctrl_pending(SSL_get_rbio(impl->ssl)) == pending) {
+          LOG(ERROR) << "Could not write to memory BIO.";
+          result = TSI_INTERNAL_ERROR;
+        }
+      }
+    }
+    grpc_slice_buffer_reset_and_unref(&impl->record_sb);
+    if (result == TSI_OK) {
+      result = ssl_zero_copy_read_plaintext(impl, max_plaintext_size,
+                                            unprotected_slices);
+    }
+    // As in ssl_protector_unprotect, a reply |ssl| queued cannot be sent.
+    if (result == TSI_OK && impl->kernel_tx_offload &&
+        BIO_pending(impl->network_io) > 0) {
+      LOG(ERROR) << "Peer requested a TLS key update, which is not supported "
+                    "with kernel TLS transmit offload.";
+      result = TSI_UNIMPLEMENTED;
+    }
+    if (result != TSI_OK) {
+      grpc_slice_buffer_reset_and_unref(unprotected_slices);
+      return result;
+    }
+  }
+  if (min_progress_size != nullptr) {
+    if (ssl_zero_copy_next_record_size(&impl->protected_staging_sb,
+                                       &record_size)) {
+      *min_progress_size =
+          static_cast<int>(record_size - impl->protected_staging_sb.length);
+    } else {
+      *min_progress_size = 1;
+    }
+  }
+  return TSI_OK;
+}
+
+static void ssl_zero_copy_grpc_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  grpc_slice_buffer_destroy(&impl->unprotected_staging_sb);
+  grpc_slice_buffer_destroy(&impl->protected_staging_sb);
+  grpc_slice_buffer_destroy(&impl->record_sb);
+  gpr_free(impl->record_buffer);
+  SSL_free(impl->ssl);
+  BIO_free(impl->network_io);
+  delete impl;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  *max_frame_size = reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self)
+                        ->max_protected_frame_size;
+  return TSI_OK;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_offload_protect(
+    tsi_zero_copy_grpc_protector* self, int fd) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  grpc_core::MutexLock lock(&impl->mu);
+  // Protect drains the BIO before returning, so nothing can be pending here
+  // unless an alert was queued.
+  if (BIO_pending(impl->network_io) > 0) return TSI_FAILED_PRECONDITION;
+  tsi_result result = grpc_core::SslEnableKernelTlsTx(impl->ssl, fd);
+  impl->kernel_tx_offload = result == TSI_OK;
+  return result;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable
+    zero_copy_grpc_protector_vtable = {
+        ssl_zero_copy_grpc_protector_protect,
+        ssl_zero_copy_grpc_protector_unprotect,
+        ssl_zero_copy_grpc_protector_destroy,
+        ssl_zero_copy_grpc_protector_max_frame_size,
+        ssl_zero_copy_grpc_protector_offload_protect,
 };
 
 // --- tsi_server_handshaker_factory methods implementation. ---
@@ -1487,7 +1975,57 @@ static tsi_result ssl_handshaker_result_extract_peer(
 static tsi_result ssl_handshaker_result_get_frame_protector_type(
     const tsi_handshaker_result* /*self*/,
     tsi_frame_protector_type* frame_protector_type) {
-  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+  *frame_protector_type =
+      grpc_core::ConfigVars::Get().SslZeroCopyFrameProtector()
+          ? TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY
+          : TSI_FRAME_PROTECTOR_NORMAL;
+  return TSI_OK;
+}
+
+// Clamps the requested maximum protected frame size, if any, to the supported
+// range and returns the size to use.
+static size_t ssl_max_protected_frame_size(
+    size_t* max_output_protected_frame_size) {
+  if (max_output_protected_frame_size == nullptr) {
+    return TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  }
+  if (*max_output_protected_frame_size >
+      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  } else if (*max_output_protected_frame_size <
+             TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
+  }
+  return *max_output_protected_frame_size;
+}
+
+static tsi_result ssl_handshaker_result_create_zero_copy_grpc_protector(
+    const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  tsi_ssl_zero_copy_grpc_protector* protector_impl =
+      new tsi_ssl_zero_copy_grpc_protector();
+  protector_impl->max_protected_frame_size =
+      ssl_max_protected_frame_size(max_output_protected_frame_size);
+  protector_impl->max_unprotected_data_size =
+      protector_impl->max_protected_frame_size -
+      TSI_SSL_MAX_PROTECTION_OVERHEAD;
+  protector_impl->record_buffer = static_cast<unsigned char*>(
+      gpr_malloc(protector_impl->max_unprotected_data_size));
+  grpc_slice_buffer_init(&protector_impl->unprotected_staging_sb);
+  grpc_slice_buffer_init(&protector_impl->protected_staging_sb);
+  grpc_slice_buffer_init(&protector_impl->record_sb);
+  // Transfer ownership of ssl and network_io to the frame protector.
+  protector_impl->ssl = impl->ssl;
+  impl->ssl = nullptr;
+  protector_impl->network_io = impl->network_io;
+  impl->network_io = nullptr;
+  protector_impl->base.vtable = &zero_copy_grpc_protector_vtable;
+  *protector = &protector_impl->base;
   return TSI_OK;
 }
 
@@ -1495,7 +2033,7 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_frame_protector** protector) {
   size_t actual_max_output_protected_frame_size =
-      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+      ssl_max_protected_frame_size(max_output_protected_frame_size);
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(
           const_cast<tsi_handshaker_result*>(self));
@@ -1503,18 +2041,6 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
       static_cast<tsi_ssl_frame_protector*>(
           gpr_zalloc(sizeof(*protector_impl)));
 
-  if (max_output_protected_frame_size != nullptr) {
-    if (*max_output_protected_frame_size >
-        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
-    } else if (*max_output_protected_frame_size <
-               TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
-    }
-    actual_max_output_protected_frame_size = *max_output_protected_frame_size;
-  }
   protector_impl->buffer_size =
       actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
   protector_impl->buffer =
@@ -1557,7 +2083,7 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
     ssl_handshaker_result_get_frame_protector_type,
-    nullptr,  // create_zero_copy_grpc_protector
+    ssl_handshaker_result_create_zero_copy_grpc_protector,
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
@@ -1578,6 +2104,7 @@ static tsi_result ssl_handshaker_result_create(
   // Transfer ownership of ssl and network_io to the handshaker result.
   result->ssl = handshaker->ssl;
   handshaker->ssl = nullptr;
+  SSL_set_ex_data(result->ssl, g_ssl_ex_handshaker_index, nullptr);
   result->network_io = handshaker->network_io;
   handshaker->network_io = nullptr;
   // Transfer ownership of |unused_bytes| to the handshaker result.
@@ -1644,6 +2171,11 @@ static tsi_result ssl_handshaker_do_handshake(tsi_ssl_handshaker* impl,
         return TSI_OK;
       case SSL_ERROR_WANT_WRITE:
         return TSI_DRAIN_BUFFER;
+#if defined(OPENSSL_IS_BORINGSSL)
+      case SSL_ERROR_WANT_PRIVATE_KEY_OPERATION:
+        // Waiting for the signature of a tsi::SslPrivateKeySigner.
+        return TSI_ASYNC;
+#endif
       default: {
         char err_str[256];
         ERR_error_string_n(ERR_get_error(), err_str, sizeof(err_str));
@@ -1694,6 +2226,8 @@ static void ssl_handshaker_destroy(tsi_handshaker* self) {
   SSL_free(impl->ssl);
   BIO_free(impl->network_io);
   gpr_free(impl->outgoing_bytes_buffer);
+  gpr_free(impl->pending_received_bytes);
+  if (impl->private_key_op != nullptr) impl->private_key_op->Unref();
   tsi_ssl_handshaker_factory_unref(impl->factory_ref);
   gpr_free(impl);
 }
@@ -1758,25 +2292,15 @@ static tsi_result ssl_handshaker_write_output_buffer(tsi_handshaker* self,
   return status;
 }
 
-static tsi_result ssl_handshaker_next(tsi_handshaker* self,
-                                      const unsigned char* received_bytes,
-                                      size_t received_bytes_size,
-                                      const unsigned char** bytes_to_send,
-                                      size_t* bytes_to_send_size,
-                                      tsi_handshaker_result** handshaker_result,
-                                      tsi_handshaker_on_next_done_cb /*cb*/,
-                                      void* /*user_data*/, std::string* error) {
-  // Input sanity check.
-  if ((received_bytes_size > 0 && received_bytes == nullptr) ||
-      bytes_to_send == nullptr || bytes_to_send_size == nullptr ||
-      handshaker_result == nullptr) {
-    if (error != nullptr) *error = "invalid argument";
-    return TSI_INVALID_ARGUMENT;
-  }
-  // If there are received bytes, process them first.
-  tsi_ssl_handshaker* impl = reinterpret_cast<tsi_ssl_handshaker*>(self);
+// Feeds |received_bytes| to the handshake and appends the bytes to send to the
+// peer to |impl->outgoing_bytes_buffer| from |*bytes_written| on. If the
+// handshake waits for a private key operation, returns TSI_ASYNC and keeps a
+// copy of the bytes that are not fed yet in |impl->pending_received_bytes|.
+static tsi_result ssl_handshaker_feed_received_bytes(
+    tsi_ssl_handshaker* impl, const unsigned char* received_bytes,
+    size_t received_bytes_size, size_t* bytes_written, std::string* error) {
+  tsi_handshaker* self = &impl->base;
   tsi_result status = TSI_OK;
-  size_t bytes_written = 0;
   if (received_bytes_size > 0) {
     unsigned char* remaining_bytes_to_write_to_openssl =
         const_cast<unsigned char*>(received_bytes);
@@ -1796,8 +2320,7 @@ static tsi_result ssl_handshaker_next(tsi_handshaker* self,
       // from the BIO. If the SSL handshake returns any bytes, write them to
       // the peer.
       while (status == TSI_DRAIN_BUFFER) {
-        status =
-            ssl_handshaker_write_output_buffer(self, &bytes_written, error);
+        status = ssl_handshaker_write_output_buffer(self, bytes_written, error);
         if (status != TSI_OK) return status;
         status = ssl_handshaker_do_handshake(impl, error);
       }
@@ -1806,6 +2329,62 @@ static tsi_result ssl_handshaker_next(tsi_handshaker* self,
       remaining_bytes_to_write_to_openssl_size -= bytes_written_to_openssl;
       remaining_bytes_to_write_to_openssl += bytes_written_to_openssl;
     }
+    if (status == TSI_ASYNC && remaining_bytes_to_write_to_openssl_size > 0) {
+      impl->pending_received_bytes = static_cast<unsigned char*>(
+          gpr_malloc(remaining_bytes_to_write_to_openssl_size));
+      memcpy(impl->pending_received_bytes, remaining_bytes_to_write_to_openssl,
+             remaining_bytes_to_write_to_openssl_size);
+      impl->pending_received_bytes_size =
+          remaining_bytes_to_write_to_openssl_size;
+    }
+  }
+  return status;
+}
+
+// Resumes a handshake whose private key operation is done, and feeds it the
+// received bytes that were left pending.
+static tsi_result ssl_handshaker_resume(tsi_ssl_handshaker* impl,
+                                        size_t* bytes_written,
+                                        std::string* error) {
+  tsi_result status = ssl_handshaker_do_handshake(impl, error);
+  while (status == TSI_DRAIN_BUFFER) {
+    status =
+        ssl_handshaker_write_output_buffer(&impl->base, bytes_written, error);
+    if (status != TSI_OK) return status;
+    status = ssl_handshaker_do_handshake(impl, error);
+  }
+  if ((status == TSI_OK || status == TSI_INCOMPLETE_DATA) &&
+      impl->pending_received_bytes != nullptr) {
+    unsigned char* pending_received_bytes =
+        std::exchange(impl->pending_received_bytes, nullptr);
+    size_t pending_received_bytes_size =
+        std::exchange(impl->pending_received_bytes_size, 0);
+    status = ssl_handshaker_feed_received_bytes(
+        impl, pending_received_bytes, pending_received_bytes_size,
+        bytes_written, error);
+    gpr_free(pending_received_bytes);
+  }
+  return status;
+}
+
+// Completes a tsi_handshaker_next() call once the received bytes are fed to
+// the handshake with |status|. Returns TSI_ASYNC if the handshake is suspended
+// on a private key operation, in which case the call is completed by
+// ssl_handshaker_on_private_key_op_done().
+static tsi_result ssl_handshaker_complete_next(
+    tsi_ssl_handshaker* impl, tsi_result status, size_t bytes_written,
+    const unsigned char** bytes_to_send, size_t* bytes_to_send_size,
+    tsi_handshaker_result** handshaker_result, std::string* error) {
+  tsi_handshaker* self = &impl->base;
+  const size_t received_bytes_size = impl->pending_total_received_bytes_size;
+  while (status == TSI_ASYNC) {
+    impl->pending_bytes_to_send_size = bytes_written;
+    if (impl->private_key_op == nullptr) {
+      if (error != nullptr) *error = "no private key operation to wait for";
+      return TSI_INTERNAL_ERROR;
+    }
+    if (impl->private_key_op->SuspendHandshake(impl)) return TSI_ASYNC;
+    status = ssl_handshaker_resume(impl, &bytes_written, error);
   }
   if (status != TSI_OK) return status;
   // Get bytes to send to the peer, if available.
@@ -1835,6 +2414,15 @@ static tsi_result ssl_handshaker_next(tsi_handshaker* self,
     status = ssl_handshaker_result_create(impl, unused_bytes, unused_bytes_size,
                                           handshaker_result, error);
     if (status == TSI_OK) {
+      // |impl->ssl| now belongs to the handshaker result.
+      SSL* ssl =
+          reinterpret_cast<tsi_ssl_handshaker_result*>(*handshaker_result)->ssl;
+      if (SSL_is_server(ssl)) {
+        grpc_core::global_stats().IncrementSslServerHandshakes();
+        if (SSL_session_reused(ssl)) {
+          grpc_core::global_stats().IncrementSslServerSessionResumptions();
+        }
+      }
       // Indicates that the handshake has completed and that a
       // handshaker_result has been created.
       self->handshaker_result_created = true;
@@ -1854,6 +2442,52 @@ static tsi_result ssl_handshaker_next(tsi_handshaker* self,
   return status;
 }
 
+static void ssl_handshaker_on_private_key_op_done(tsi_ssl_handshaker* impl) {
+  grpc_core::ApplicationCallbackExecCtx callback_exec_ctx;
+  grpc_core::ExecCtx exec_ctx;
+  const unsigned char* bytes_to_send = nullptr;
+  size_t bytes_to_send_size = 0;
+  tsi_handshaker_result* handshaker_result = nullptr;
+  size_t bytes_written = impl->pending_bytes_to_send_size;
+  tsi_result status =
+      ssl_handshaker_resume(impl, &bytes_written, impl->pending_error);
+  status = ssl_handshaker_complete_next(
+      impl, status, bytes_written, &bytes_to_send, &bytes_to_send_size,
+      &handshaker_result, impl->pending_error);
+  if (status == TSI_ASYNC) return;
+  impl->pending_cb(status, impl->pending_user_data, bytes_to_send,
+                   bytes_to_send_size, handshaker_result);
+}
+
+static tsi_result ssl_handshaker_next(tsi_handshaker* self,
+                                      const unsigned char* received_bytes,
+                                      size_t received_bytes_size,
+                                      const unsigned char** bytes_to_send,
+                                      size_t* bytes_to_send_size,
+                                      tsi_handshaker_result** handshaker_result,
+                                      tsi_handshaker_on_next_done_cb cb,
+                                      void* user_data, std::string* error) {
+  // Input sanity check.
+  if ((received_bytes_size > 0 && received_bytes == nullptr) ||
+      bytes_to_send == nullptr || bytes_to_send_size == nullptr ||
+      handshaker_result == nullptr) {
+    if (error != nullptr) *error = "invalid argument";
+    return TSI_INVALID_ARGUMENT;
+  }
+  // If there are received bytes, process them first.
+  tsi_ssl_handshaker* impl = reinterpret_cast<tsi_ssl_handshaker*>(self);
+  size_t bytes_written = 0;
+  impl->pending_total_received_bytes_size = received_bytes_size;
+  impl->pending_cb = cb;
+  impl->pending_user_data = user_data;
+  impl->pending_error = error;
+  tsi_result status = ssl_handshaker_feed_received_bytes(
+      impl, received_bytes, received_bytes_size, &bytes_written, error);
+  return ssl_handshaker_complete_next(impl, status, bytes_written,
+                                      bytes_to_send, bytes_to_send_size,
+                                      handshaker_result, error);
+}
+
 static const tsi_handshaker_vtable handshaker_vtable = {
     nullptr,  // get_bytes_to_send_to_peer -- deprecated
     nullptr,  // process_bytes_from_peer   -- deprecated
@@ -1953,6 +2587,7 @@ static tsi_result create_tsi_ssl_handshaker(SSL_CTX* ctx, int is_client,
       static_cast<unsigned char*>(gpr_zalloc(impl->outgoing_bytes_buffer_size));
   impl->base.vtable = &handshaker_vtable;
   impl->factory_ref = tsi_ssl_handshaker_factory_ref(factory);
+  SSL_set_ex_data(ssl, g_ssl_ex_handshaker_index, impl);
   *handshaker = &impl->base;
   return TSI_OK;
 }
@@ -2068,6 +2703,7 @@ static void tsi_ssl_server_handshaker_factory_destroy(
   }
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
   self->key_logger.reset();
+  self->verification_cache.reset();
   gpr_free(self);
 }
 
@@ -2277,7 +2913,8 @@ tsi_result tsi_create_ssl_client_handshaker_factory_with_options(
 
   do {
     result = populate_ssl_context(ssl_context, options->pem_key_cert_pair,
-                                  options->cipher_suites);
+                                  options->cipher_suites,
+                                  options->private_key_signer.get());
     if (result != TSI_OK) break;
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
@@ -2445,6 +3082,24 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
     impl->key_logger = options->key_logger->Ref();
   }
 
+  const grpc_core::Duration ticket_key_rotation_period =
+      grpc_core::Duration::Seconds(
+          grpc_core::ConfigVars::Get().SslSessionTicketKeyRotationS());
+  // Results of CRL lookups that OpenSSL makes itself in the CRL directory
+  // cannot be told apart from one handshake to the next, so chains are not
+  // cached when it is used.
+  const int verification_cache_size =
+      grpc_core::ConfigVars::Get().SslVerificationCacheSize();
+  if (verification_cache_size > 0 &&
+      (options->client_certificate_request ==
+           TSI_REQUEST_CLIENT_CERTIFICATE_AND_VERIFY ||
+       options->client_certificate_request ==
+           TSI_REQUEST_AND_REQUIRE_CLIENT_CERTIFICATE_AND_VERIFY) &&
+      (options->crl_directory == nullptr ||
+       strcmp(options->crl_directory, "") == 0)) {
+    impl->verification_cache = std::make_unique<tsi::SslVerificationCache>(
+        static_cast<size_t>(verification_cache_size));
+  }
   for (i = 0; i < options->num_key_cert_pairs; i++) {
     do {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
@@ -2469,7 +3124,8 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
 
       result = populate_ssl_context(impl->ssl_contexts[i],
                                     &options->pem_key_cert_pairs[i],
-                                    options->cipher_suites);
+                                    options->cipher_suites,
+                                    options->private_key_signer.get());
       if (result != TSI_OK) break;
 
       // TODO(elessar): Provide ability to disable session ticket keys.
@@ -2493,6 +3149,13 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
           result = TSI_INVALID_ARGUMENT;
           break;
         }
+      } else if (ticket_key_rotation_period > grpc_core::Duration::Zero()) {
+        if (!tsi::SslSessionTicketKeys::InstallProcessWideKeys(
+                impl->ssl_contexts[i], ticket_key_rotation_period)) {
+          LOG(ERROR) << "Failed to set session ticket key callback.";
+          result = TSI_INTERNAL_ERROR;
+          break;
+        }
       }
 
       if (options->pem_client_root_certs != nullptr) {
@@ -2538,6 +3201,11 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
                                            CustomVerificationFunction, nullptr);
           break;
       }
+      if (impl->verification_cache != nullptr) {
+        SSL_CTX_set_ex_data(impl->ssl_contexts[i],
+                            g_ssl_ctx_ex_verification_cache_index,
+                            impl->verification_cache.get());
+      }
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000 && !defined(LIBRESSL_VERSION_NUMBER)
       if (options->crl_provider != nullptr) {
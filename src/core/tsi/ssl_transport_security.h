@@ -19,10 +19,15 @@
 #ifndef GRPC_SRC_CORE_TSI_SSL_TRANSPORT_SECURITY_H
 #define GRPC_SRC_CORE_TSI_SSL_TRANSPORT_SECURITY_H
 
+#include <stdint.h>
+
 #include <memory>
+#include <string>
 
 #include <openssl/x509.h>
 
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 
 #include <grpc/grpc_crl_provider.h>
@@ -94,6 +99,30 @@ static constexpr bool tsi_tls_session_key_logging_supported() {
 #endif
 }
 
+// --- tsi::SslPrivateKeySigner object ---
+
+namespace tsi {
+
+// Signs the handshakes of a handshaker factory in place of its in-memory
+// private keys, so that signing can run on a dedicated thread pool or in a
+// hardware or remote key service. The handshake is suspended while a signature
+// is pending: tsi_handshaker_next() returns TSI_ASYNC and calls back when the
+// handshake has resumed. Only supported with BoringSSL.
+class SslPrivateKeySigner {
+ public:
+  virtual ~SslPrivateKeySigner() = default;
+
+  // Signs input with signature_algorithm, a TLS SignatureScheme code point
+  // such as SSL_SIGN_ECDSA_SECP256R1_SHA256, and invokes on_done with the
+  // signature, or with an error to fail the handshake. on_done may be invoked
+  // on any thread, including inline, and the handshake resumes on that thread.
+  virtual void Sign(
+      absl::string_view input, uint16_t signature_algorithm,
+      absl::AnyInvocable<void(absl::StatusOr<std::string>)> on_done) = 0;
+};
+
+}  // namespace tsi
+
 // --- tsi_ssl_client_handshaker_factory object ---
 
 // This object creates a client tsi_handshaker objects implemented in terms of
@@ -192,6 +221,11 @@ struct tsi_ssl_client_handshaker_options {
   // options as a shared_ptr.
   std::shared_ptr<grpc_core::experimental::CrlProvider> crl_provider;
 
+  // If set, the private key of pem_key_cert_pair is ignored and handshakes are
+  // signed by this signer. It is created and owned by the user and must
+  // outlive the factory.
+  std::shared_ptr<tsi::SslPrivateKeySigner> private_key_signer;
+
   tsi_ssl_client_handshaker_options()
       : pem_key_cert_pair(nullptr),
         pem_root_certs(nullptr),
@@ -357,6 +391,11 @@ struct tsi_ssl_server_handshaker_options {
   // will be unusable.
   bool send_client_ca_list;
 
+  // If set, the private keys of pem_key_cert_pairs are ignored and handshakes
+  // are signed by this signer, whichever certificate is selected. It is
+  // created and owned by the user and must outlive the factory.
+  std::shared_ptr<tsi::SslPrivateKeySigner> private_key_signer;
+
   tsi_ssl_server_handshaker_options()
       : pem_key_cert_pairs(nullptr),
         num_key_cert_pairs(0),
@@ -18,6 +18,7 @@
 
 #include "src/core/tsi/ssl_transport_security_utils.h"
 
+#include <errno.h>
 #include <openssl/bio.h>
 #include <openssl/crypto.h>
 #include <openssl/ec.h>
@@ -28,16 +29,40 @@
 #include <openssl/ssl.h>
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
+#include <string.h>
+
+#include <string>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/support/port_platform.h>
 
 #include "src/core/tsi/transport_security_interface.h"
 
+// Kernel TLS needs the TLS 1.3 traffic secrets and record sequence numbers,
+// which only BoringSSL exposes.
+#if defined(OPENSSL_IS_BORINGSSL) && defined(GPR_LINUX) && \
+    defined(__has_include)
+#if __has_include(<linux/tls.h>)
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <openssl/hkdf.h>
+#include <sys/socket.h>
+#if defined(TLS_1_3_VERSION) && defined(TCP_ULP)
+#define TSI_SSL_KTLS_SUPPORT 1
+#endif
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#endif  // __has_include(<linux/tls.h>)
+#endif
+
 namespace grpc_core {
 
 const char* SslErrorString(int error) {
@@ -257,6 +282,122 @@ tsi_result SslProtectorUnprotect(const unsigned char* protected_frames_bytes,
   return result;
 }
 
+#ifdef TSI_SSL_KTLS_SUPPORT
+
+namespace {
+
+// HKDF-Expand-Label with an empty context, from RFC 8446 section 7.1.
+bool Tls13HkdfExpandLabel(const EVP_MD* digest,
+                          bssl::Span<const uint8_t> secret,
+                          absl::string_view label, uint8_t* out,
+                          size_t out_len) {
+  const std::string full_label = absl::StrCat("tls13 ", label);
+  std::string info;
+  info.push_back(static_cast<char>(out_len >> 8));
+  info.push_back(static_cast<char>(out_len & 0xff));
+  info.push_back(static_cast<char>(full_label.size()));
+  info.append(full_label);
+  info.push_back(0);
+  return HKDF_expand(out, out_len, digest, secret.data(), secret.size(),
+                     reinterpret_cast<const uint8_t*>(info.data()),
+                     info.size()) == 1;
+}
+
+// Fills one of the tls12_crypto_info_* structs of <linux/tls.h>. For TLS 1.3
+// the kernel takes the per-connection IV as salt followed by iv.
+template <typename CryptoInfo>
+bool FillKernelTlsCryptoInfo(uint16_t cipher_type, const EVP_MD* digest,
+                             bssl::Span<const uint8_t> secret,
+                             uint64_t sequence, CryptoInfo* info) {
+  info->info.version = TLS_1_3_VERSION;
+  info->info.cipher_type = cipher_type;
+  uint8_t iv[sizeof(info->salt) + sizeof(info->iv)];
+  if (!Tls13HkdfExpandLabel(digest, secret, "key", info->key,
+                            sizeof(info->key)) ||
+      !Tls13HkdfExpandLabel(digest, secret, "iv", iv, sizeof(iv))) {
+    return false;
+  }
+  memcpy(info->salt, iv, sizeof(info->salt));
+  memcpy(info->iv, iv + sizeof(info->salt), sizeof(info->iv));
+  OPENSSL_cleanse(iv, sizeof(iv));
+  for (size_t i = 0; i < sizeof(info->rec_seq); ++i) {
+    info->rec_seq[i] =
+        static_cast<uint8_t>(sequence >> (8 * (sizeof(info->rec_seq) - 1 - i)));
+  }
+  return true;
+}
+
+}  // namespace
+
+tsi_result SslEnableKernelTlsTx(SSL* ssl, int fd) {
+  if (SSL_version(ssl) != TLS1_3_VERSION) return TSI_UNIMPLEMENTED;
+  bssl::Span<const uint8_t> read_secret;
+  bssl::Span<const uint8_t> write_secret;
+  if (!bssl::SSL_get_traffic_secrets(ssl, &read_secret, &write_secret)) {
+    return TSI_UNIMPLEMENTED;
+  }
+  // Session tickets sent by a server already used some sequence numbers.
+  const uint64_t sequence = SSL_get_write_sequence(ssl);
+  union {
+    tls12_crypto_info_aes_gcm_128 aes_gcm_128;
+    tls12_crypto_info_aes_gcm_256 aes_gcm_256;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    tls12_crypto_info_chacha20_poly1305 chacha20_poly1305;
+#endif
+  } crypto_info;
+  size_t crypto_info_size;
+  bool filled;
+  switch (SSL_CIPHER_get_protocol_id(SSL_get_current_cipher(ssl))) {
+    case TLS1_3_CK_AES_128_GCM_SHA256 & 0xffff:
+      filled = FillKernelTlsCryptoInfo(TLS_CIPHER_AES_GCM_128, EVP_sha256(),
+                                       write_secret, sequence,
+                                       &crypto_info.aes_gcm_128);
+      crypto_info_size = sizeof(crypto_info.aes_gcm_128);
+      break;
+    case TLS1_3_CK_AES_256_GCM_SHA384 & 0xffff:
+      filled = FillKernelTlsCryptoInfo(TLS_CIPHER_AES_GCM_256, EVP_sha384(),
+                                       write_secret, sequence,
+                                       &crypto_info.aes_gcm_256);
+      crypto_info_size = sizeof(crypto_info.aes_gcm_256);
+      break;
+#ifdef TLS_CIPHER_CHACHA20_POLY1305
+    case TLS1_3_CK_CHACHA20_POLY1305_SHA256 & 0xffff:
+      filled = FillKernelTlsCryptoInfo(TLS_CIPHER_CHACHA20_POLY1305,
+                                       EVP_sha256(), write_secret, sequence,
+                                       &crypto_info.chacha20_poly1305);
+      crypto_info_size = sizeof(crypto_info.chacha20_poly1305);
+      break;
+#endif
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  tsi_result result = TSI_UNIMPLEMENTED;
+  if (!filled) {
+    LogSslErrorStack();
+    result = TSI_INTERNAL_ERROR;
+  } else if (setsockopt(fd, IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+    // Most likely the tls kernel module is not loaded.
+    VLOG(2) << "Could not attach the kernel TLS ULP: " << strerror(errno);
+  } else if (setsockopt(fd, SOL_TLS, TLS_TX, &crypto_info,
+                        crypto_info_size) != 0) {
+    // Without TLS_TX the socket keeps sending the data as it is given.
+    VLOG(2) << "Could not set the kernel TLS transmit keys: "
+            << strerror(errno);
+  } else {
+    result = TSI_OK;
+  }
+  OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+  return result;
+}
+
+#else  // TSI_SSL_KTLS_SUPPORT
+
+tsi_result SslEnableKernelTlsTx(SSL* /*ssl*/, int /*fd*/) {
+  return TSI_UNIMPLEMENTED;
+}
+
+#endif  // TSI_SSL_KTLS_SUPPORT
+
 bool VerifyCrlSignature(X509_CRL* crl, X509* issuer) {
   if (issuer == nullptr || crl == nullptr) {
     return false;
@@ -144,6 +144,19 @@ tsi_result SslProtectorUnprotect(const unsigned char* protected_frames_bytes,
                                  unsigned char* unprotected_bytes,
                                  size_t* unprotected_bytes_size);
 
+// Installs the write keys of the TLS 1.3 connection |ssl| into the kernel TLS
+// (kTLS) implementation of the socket |fd|, after which the kernel encrypts the
+// data written to |fd|. |ssl| must not be used to protect data afterwards.
+//
+// ssl: the |SSL| object of a connection whose handshake is complete, and that
+//      has not protected any data since.
+// fd: the connected TCP socket of the connection.
+//
+// return: TSI_OK on success. TSI_UNIMPLEMENTED if the platform, the kernel, the
+//         TLS version or the cipher suite does not support it, in which case
+//         |ssl| can still be used as before.
+tsi_result SslEnableKernelTlsTx(SSL* ssl, int fd);
+
 // Verifies that `crl` was signed by `issuer.
 // return: true if valid, false otherwise.
 bool VerifyCrlSignature(X509_CRL* crl, X509* issuer);
@@ -127,6 +127,15 @@ tsi_result tsi_frame_protector_unprotect(
                                  unprotected_bytes_size);
 }
 
+tsi_result tsi_frame_protector_offload_protect(tsi_frame_protector* self,
+                                               int fd) {
+  if (self == nullptr || self->vtable == nullptr || fd < 0) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (self->vtable->offload_protect == nullptr) return TSI_UNIMPLEMENTED;
+  return self->vtable->offload_protect(self, fd);
+}
+
 void tsi_frame_protector_destroy(tsi_frame_protector* self) {
   if (self == nullptr) return;
   self->vtable->destroy(self);
@@ -45,6 +45,7 @@ struct tsi_frame_protector_vtable {
                           unsigned char* unprotected_bytes,
                           size_t* unprotected_bytes_size);
   void (*destroy)(tsi_frame_protector* self);
+  tsi_result (*offload_protect)(tsi_frame_protector* self, int fd);
 };
 struct tsi_frame_protector {
   const tsi_frame_protector_vtable* vtable;
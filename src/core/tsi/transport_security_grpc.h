@@ -62,6 +62,10 @@ void tsi_zero_copy_grpc_protector_destroy(tsi_zero_copy_grpc_protector* self);
 tsi_result tsi_zero_copy_grpc_protector_max_frame_size(
     tsi_zero_copy_grpc_protector* self, size_t* max_frame_size);
 
+// Same as tsi_frame_protector_offload_protect, for zero-copy protectors.
+tsi_result tsi_zero_copy_grpc_protector_offload_protect(
+    tsi_zero_copy_grpc_protector* self, int fd);
+
 // Base for tsi_zero_copy_grpc_protector implementations.
 struct tsi_zero_copy_grpc_protector_vtable {
   tsi_result (*protect)(tsi_zero_copy_grpc_protector* self,
@@ -74,6 +78,7 @@ struct tsi_zero_copy_grpc_protector_vtable {
   void (*destroy)(tsi_zero_copy_grpc_protector* self);
   tsi_result (*max_frame_size)(tsi_zero_copy_grpc_protector* self,
                                size_t* max_frame_size);
+  tsi_result (*offload_protect)(tsi_zero_copy_grpc_protector* self, int fd);
 };
 struct tsi_zero_copy_grpc_protector {
   const tsi_zero_copy_grpc_protector_vtable* vtable;
@@ -210,6 +210,25 @@ tsi_result tsi_frame_protector_unprotect(
     size_t* protected_frames_bytes_size, unsigned char* unprotected_bytes,
     size_t* unprotected_bytes_size);
 
+// Hands the protection of outgoing data over to the kernel's implementation of
+// the security protocol for the connected socket fd, so that plaintext written
+// to fd goes out protected (e.g. kernel TLS on Linux).
+// - On success, the caller must no longer call tsi_frame_protector_protect or
+//   tsi_frame_protector_protect_flush and writes its data to fd directly.
+//   Incoming data still has to be unprotected with
+//   tsi_frame_protector_unprotect, which then fails with TSI_UNIMPLEMENTED if
+//   the peer sends something that needs a protocol reply (e.g. a TLS 1.3
+//   KeyUpdate that requests one back).
+// - Writes to fd must then be plain sends: kernel TLS rejects MSG_ZEROCOPY
+//   and ancillary data such as SO_TIMESTAMPING requests.
+// - This method returns TSI_UNIMPLEMENTED if the protector, the negotiated
+//   parameters or the platform do not support the offload, and
+//   TSI_FAILED_PRECONDITION if data was already given to
+//   tsi_frame_protector_protect and not flushed. In both cases the protector
+//   can still be used as before.
+tsi_result tsi_frame_protector_offload_protect(tsi_frame_protector* self,
+                                               int fd);
+
 // Destroys the tsi_frame_protector object.
 void tsi_frame_protector_destroy(tsi_frame_protector* self);
 
@@ -18,6 +18,7 @@
 
 #include <inttypes.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <map>
@@ -125,6 +126,7 @@ class JsonReader {
 
   Status Run();
   uint32_t ReadChar();
+  void ConsumePlainStringChars();
   bool IsComplete();
 
   size_t CurrentIndex() const { return input_ - original_input_ - 1; }
@@ -253,6 +255,47 @@ uint32_t JsonReader::ReadChar() {
   return r;
 }
 
+// Characters that need no processing by the state machine when in a string:
+// printable ASCII, other than '"' and '\\'.
+bool IsPlainStringChar(uint8_t c) {
+  return c >= 0x20 && c < 0x80 && c != '"' && c != '\\';
+}
+
+constexpr uint64_t kEachByte = 0x0101010101010101;
+constexpr uint64_t kHighBits = 0x8080808080808080;
+
+bool HasZeroByte(uint64_t word) {
+  return ((word - kEachByte) & ~word & kHighBits) != 0;
+}
+
+// Returns true if the 8 characters in word are all plain, using the usual
+// bit tricks to test all of them at once.
+bool IsPlainStringWord(uint64_t word) {
+  // Any byte >= 0x80, or < 0x20.
+  if (((word | (word - kEachByte * 0x20)) & kHighBits) != 0) return false;
+  return !HasZeroByte(word ^ (kEachByte * '"')) &&
+         !HasZeroByte(word ^ (kEachByte * '\\'));
+}
+
+// Copies the run of plain characters at the current position to string_ in
+// one go, instead of passing them one by one through the state machine. Most
+// strings in configs are made of those only.
+void JsonReader::ConsumePlainStringChars() {
+  const uint8_t* p = input_;
+  const uint8_t* const end = input_ + remaining_input_;
+  while (end - p >= 8) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    if (!IsPlainStringWord(word)) break;
+    p += 8;
+  }
+  while (p != end && IsPlainStringChar(*p)) ++p;
+  const size_t n = p - input_;
+  string_.append(reinterpret_cast<const char*>(input_), n);
+  input_ = p;
+  remaining_input_ -= n;
+}
+
 Json* JsonReader::CreateAndLinkValue() {
   if (stack_.empty()) return &root_value_;
   return MatchMutable(
@@ -355,6 +398,11 @@ JsonReader::Status JsonReader::Run() {
 
   // This state-machine is a strict implementation of ECMA-404
   while (true) {
+    if ((state_ == State::GRPC_JSON_STATE_OBJECT_KEY_STRING ||
+         state_ == State::GRPC_JSON_STATE_VALUE_STRING) &&
+        utf8_bytes_remaining_ == 0 && unicode_high_surrogate_ == 0) {
+      ConsumePlainStringChars();
+    }
     c = ReadChar();
     switch (c) {
       // Let's process the error case first.
@@ -15,6 +15,7 @@
 #include "src/core/util/latent_see.h"
 
 #ifdef GRPC_ENABLE_LATENT_SEE
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 
@@ -27,12 +28,45 @@ namespace latent_see {
 thread_local std::vector<Log::Event> Log::thread_events_;
 thread_local uint64_t Log::thread_id_ = Log::Get().next_thread_id_.fetch_add(1);
 std::atomic<uint64_t> Flow::next_flow_id_{1};
+std::atomic<uint32_t> Log::flow_sampling_period_{1};
 
-std::string Log::GenerateJson() {
+void Log::RecordContinuously(size_t max_events_per_shard,
+                             uint32_t flow_sampling_period) {
+  auto& log = Get();
+  log.max_events_per_shard_.store(std::max<size_t>(max_events_per_shard, 1),
+                                  std::memory_order_relaxed);
+  flow_sampling_period_.store(flow_sampling_period, std::memory_order_relaxed);
+  for (auto& fragment : log.fragments_) {
+    MutexLock lock(&fragment.mu);
+    fragment.events.clear();
+    fragment.events.shrink_to_fit();
+    fragment.oldest = 0;
+  }
+}
+
+std::string Log::CollectJson(
+    absl::optional<std::chrono::steady_clock::duration> window) {
+  return Get().GenerateJson(window);
+}
+
+std::string Log::GenerateJson(
+    absl::optional<std::chrono::steady_clock::duration> window) {
   std::vector<RecordedEvent> events;
   for (auto& fragment : fragments_) {
     MutexLock lock(&fragment.mu);
-    events.insert(events.end(), fragment.events.begin(), fragment.events.end());
+    // Oldest events first.
+    events.insert(events.end(), fragment.events.begin() + fragment.oldest,
+                  fragment.events.end());
+    events.insert(events.end(), fragment.events.begin(),
+                  fragment.events.begin() + fragment.oldest);
+  }
+  if (window.has_value()) {
+    const auto cutoff = std::chrono::steady_clock::now() - *window;
+    events.erase(std::remove_if(events.begin(), events.end(),
+                                [cutoff](const RecordedEvent& event) {
+                                  return event.event.timestamp < cutoff;
+                                }),
+                 events.end());
   }
   absl::optional<std::chrono::steady_clock::time_point> start_time;
   for (auto& event : events) {
@@ -99,10 +133,19 @@ void Log::FlushThreadLog() {
       log.next_batch_id_.fetch_add(1, std::memory_order_relaxed);
   auto& fragment = log.fragments_.this_cpu();
   const auto thread_id = thread_id_;
+  const size_t max_events =
+      log.max_events_per_shard_.load(std::memory_order_relaxed);
   {
     MutexLock lock(&fragment.mu);
     for (auto event : thread_events) {
-      fragment.events.push_back(RecordedEvent{thread_id, batch_id, event});
+      RecordedEvent recorded{thread_id, batch_id, event};
+      if (max_events == 0 || fragment.events.size() < max_events) {
+        fragment.events.push_back(recorded);
+      } else {
+        // The shard is full: overwrite its oldest event.
+        fragment.events[fragment.oldest] = recorded;
+        fragment.oldest = (fragment.oldest + 1) % fragment.events.size();
+      }
     }
   }
   thread_events.clear();
@@ -18,12 +18,17 @@
 #include <grpc/support/port_platform.h>
 
 #ifdef GRPC_ENABLE_LATENT_SEE
+#include <stddef.h>
+
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "absl/log/log.h"
+#include "absl/types/optional.h"
 
 #include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -39,10 +44,32 @@ struct Metadata {
 
 enum class EventType : uint8_t { kBegin, kEnd, kFlowStart, kFlowEnd, kMark };
 
+// By default every event is kept, and the log is written to latent_see.json
+// when the process exits. RecordContinuously() switches to a mode suitable
+// for long running processes, where only the latest events are kept, flows
+// are sampled, and the log is collected on demand with CollectJson().
 class Log {
  public:
   static void FlushThreadLog();
 
+  // Keeps at most \a max_events_per_shard events in each per-CPU shard of
+  // the log, dropping the oldest ones, and records one in
+  // \a flow_sampling_period flows. Drops the events recorded so far, and
+  // disables writing the log at exit.
+  static void RecordContinuously(size_t max_events_per_shard,
+                                 uint32_t flow_sampling_period);
+
+  // Returns the events of the last \a window, or all the events kept if
+  // unset, in the chrome event trace format.
+  static std::string CollectJson(
+      absl::optional<std::chrono::steady_clock::duration> window);
+
+  GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static bool SampleFlow(uint64_t id) {
+    const uint32_t period =
+        flow_sampling_period_.load(std::memory_order_relaxed);
+    return period <= 1 || id % period == 0;
+  }
+
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static void Append(
       const Metadata* metadata, EventType type, uint64_t id) {
     thread_events_.push_back(
@@ -55,10 +82,13 @@ class Log {
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION static Log& Get() {
     static Log* log = []() {
       atexit([] {
+        if (log->max_events_per_shard_.load(std::memory_order_relaxed) != 0) {
+          return;
+        }
         LOG(INFO) << "Writing latent_see.json in " << get_current_dir_name();
         FILE* f = fopen("latent_see.json", "w");
         if (f == nullptr) return;
-        fprintf(f, "%s", log->GenerateJson().c_str());
+        fprintf(f, "%s", log->GenerateJson(absl::nullopt).c_str());
         fclose(f);
       });
       return new Log();
@@ -66,7 +96,9 @@ class Log {
     return *log;
   }
 
-  std::string GenerateJson();
+  // Only includes the events of the last \a window, if set.
+  std::string GenerateJson(
+      absl::optional<std::chrono::steady_clock::duration> window);
 
   struct Event {
     const Metadata* metadata;
@@ -86,7 +118,12 @@ class Log {
   struct Fragment {
     Mutex mu;
     std::vector<RecordedEvent> events ABSL_GUARDED_BY(mu);
+    // In a bounded log, the index of the oldest event once events is full.
+    size_t oldest ABSL_GUARDED_BY(mu) = 0;
   };
+  // Zero if the log is unbounded.
+  std::atomic<size_t> max_events_per_shard_{0};
+  static std::atomic<uint32_t> flow_sampling_period_;
   PerCpu<Fragment> fragments_{PerCpuOptions()};
 };
 
@@ -116,9 +153,8 @@ class Flow {
  public:
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION Flow() : metadata_(nullptr) {}
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION explicit Flow(const Metadata* metadata)
-      : metadata_(metadata),
-        id_(next_flow_id_.fetch_add(1, std::memory_order_relaxed)) {
-    Log::Append(metadata_, EventType::kFlowStart, id_);
+      : metadata_(nullptr) {
+    Begin(metadata);
   }
   GPR_ATTRIBUTE_ALWAYS_INLINE_FUNCTION ~Flow() {
     if (metadata_ != nullptr) {
@@ -150,6 +186,11 @@ class Flow {
     metadata_ = metadata;
     if (metadata_ == nullptr) return;
     id_ = next_flow_id_.fetch_add(1, std::memory_order_relaxed);
+    // A flow that is not sampled stays inactive.
+    if (!Log::SampleFlow(id_)) {
+      metadata_ = nullptr;
+      return;
+    }
     Log::Append(metadata_, EventType::kFlowStart, id_);
   }
 
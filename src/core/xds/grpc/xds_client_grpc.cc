@@ -40,6 +40,7 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
@@ -115,6 +116,16 @@ const auto kMetricResourceUpdatesInvalid =
                 kMetricLabelXdsResourceType)
         .Build();
 
+const auto kMetricResourceDecodesSkipped =
+    GlobalInstrumentsRegistry::RegisterUInt64Counter(
+        "grpc.xds_client.resource_decodes_skipped",
+        "EXPERIMENTAL.  A counter of valid resources received that were not "
+        "decoded because they were identical to the cached version.",
+        "{resource}", false)
+        .Labels(kMetricLabelTarget, kMetricLabelXdsServer,
+                kMetricLabelXdsResourceType)
+        .Build();
+
 const auto kMetricServerFailure =
     GlobalInstrumentsRegistry::RegisterUInt64Counter(
         "grpc.xds_client.server_failure",
@@ -170,6 +181,14 @@ class GrpcXdsClient::MetricsReporter final : public XdsMetricsReporter {
         {xds_client_.key_, xds_server, resource_type}, {});
   }
 
+  void ReportResourceDecodesSkipped(absl::string_view xds_server,
+                                    absl::string_view resource_type,
+                                    uint64_t num_skipped) override {
+    xds_client_.stats_plugin_group_.AddCounter(
+        kMetricResourceDecodesSkipped, num_skipped,
+        {xds_client_.key_, xds_server, resource_type}, {});
+  }
+
   void ReportServerFailure(absl::string_view xds_server) override {
     xds_client_.stats_plugin_group_.AddCounter(
         kMetricServerFailure, 1, {xds_client_.key_, xds_server}, {});
@@ -184,6 +203,7 @@ class GrpcXdsClient::MetricsReporter final : public XdsMetricsReporter {
 //
 
 constexpr absl::string_view GrpcXdsClient::kServerKey;
+constexpr absl::string_view GrpcXdsClient::kSharedClientKey;
 
 namespace {
 
@@ -246,7 +266,11 @@ absl::StatusOr<RefCountedPtr<GrpcXdsClient>> GrpcXdsClient::GetOrCreate(
         key, std::move(*bootstrap), channel_args,
         MakeOrphanable<GrpcXdsTransportFactory>(channel_args));
   }
-  // Otherwise, use the global instance.
+  // Otherwise, use the global instance.  Channels for all targets use
+  // the same instance if configured to do so.
+  if (key != kServerKey && ConfigVars::Get().XdsSharedClient()) {
+    key = kSharedClientKey;
+  }
   MutexLock lock(g_mu);
   auto it = g_xds_client_map->find(key);
   if (it != g_xds_client_map->end()) {
@@ -353,23 +377,27 @@ std::vector<RefCountedPtr<GrpcXdsClient>> GetAllXdsClients() {
 
 }  // namespace
 
-// ABSL_NO_THREAD_SAFETY_ANALYSIS because we have to manually manage locks for
-// individual XdsClients and compiler struggles with checking the validity
-grpc_slice GrpcXdsClient::DumpAllClientConfigs()
-    ABSL_NO_THREAD_SAFETY_ANALYSIS {
+grpc_slice GrpcXdsClient::DumpAllClientConfigs() {
   auto xds_clients = GetAllXdsClients();
   upb::Arena arena;
   // Contains strings that should survive till serialization
   std::set<std::string> string_pool;
+  // Each XdsClient is locked only long enough to copy out its resources'
+  // metadata; the message is built and serialized from these copies, which
+  // share the serialized resources with the cache.
+  std::vector<std::vector<ResourceConfigSnapshot>> snapshots;
+  snapshots.reserve(xds_clients.size());
   auto response = envoy_service_status_v3_ClientStatusResponse_new(arena.ptr());
-  // We lock each XdsClient mutex till we are done with the serialization to
-  // ensure that all data referenced from the UPB proto message stays alive.
   for (const auto& xds_client : xds_clients) {
+    {
+      MutexLock lock(xds_client->mu());
+      snapshots.push_back(xds_client->SnapshotResourceConfigs());
+    }
     auto client_config =
         envoy_service_status_v3_ClientStatusResponse_add_config(response,
                                                                 arena.ptr());
-    xds_client->mu()->Lock();
-    xds_client->DumpClientConfig(&string_pool, arena.ptr(), client_config);
+    xds_client->DumpClientConfig(snapshots.back(), &string_pool, arena.ptr(),
+                                 client_config);
     envoy_service_status_v3_ClientConfig_set_client_scope(
         client_config, StdStringToUpbString(xds_client->key()));
   }
@@ -377,10 +405,7 @@ grpc_slice GrpcXdsClient::DumpAllClientConfigs()
   size_t output_length;
   char* output = envoy_service_status_v3_ClientStatusResponse_serialize(
       response, arena.ptr(), &output_length);
-  for (const auto& xds_client : xds_clients) {
-    xds_client->mu()->Unlock();
-  }
-  return grpc_slice_from_cpp_string(std::string(output, output_length));
+  return grpc_slice_from_copied_buffer(output, output_length);
 }
 
 void GrpcXdsClient::ReportCallbackMetrics(CallbackMetricReporter& reporter) {
@@ -43,6 +43,9 @@ class GrpcXdsClient final : public XdsClient {
  public:
   // The key to pass to GetOrCreate() for gRPC servers.
   static constexpr absl::string_view kServerKey = "#server";
+  // The key used for all channels when the xds_shared_client config var
+  // is set.
+  static constexpr absl::string_view kSharedClientKey = "#shared";
 
   // Factory function to get or create the global XdsClient instance.
   static absl::StatusOr<RefCountedPtr<GrpcXdsClient>> GetOrCreate(
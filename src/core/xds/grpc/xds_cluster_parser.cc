@@ -53,6 +53,7 @@
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/validation_errors.h"
 #include "src/core/load_balancing/lb_policy_registry.h"
+#include "src/core/load_balancing/ring_hash/consistent_hash.h"
 #include "src/core/util/upb_utils.h"
 #include "src/core/xds/grpc/xds_bootstrap_grpc.h"
 #include "src/core/xds/grpc/xds_common_types.h"
@@ -291,6 +292,38 @@ void ParseLbPolicyConfig(const XdsResourceType::DecodeContext& context,
              })},
         }),
     };
+  } else if (envoy_config_cluster_v3_Cluster_lb_policy(cluster) ==
+             envoy_config_cluster_v3_Cluster_LEAST_REQUEST) {
+    uint32_t choice_count = 2;
+    auto* least_request_config =
+        envoy_config_cluster_v3_Cluster_least_request_lb_config(cluster);
+    if (least_request_config != nullptr) {
+      const google_protobuf_UInt32Value* uint32_value =
+          envoy_config_cluster_v3_Cluster_LeastRequestLbConfig_choice_count(
+              least_request_config);
+      if (uint32_value != nullptr) {
+        ValidationErrors::ScopedField field(
+            errors, ".least_request_lb_config.choice_count");
+        choice_count = google_protobuf_UInt32Value_value(uint32_value);
+        if (choice_count < 2) errors->AddError("must be at least 2");
+      }
+    }
+    cds_update->lb_policy_config = {
+        Json::FromObject({
+            {"xds_wrr_locality_experimental",
+             Json::FromObject({
+                 {"childPolicy",
+                  Json::FromArray({
+                      Json::FromObject({
+                          {"least_request_experimental",
+                           Json::FromObject({
+                               {"choiceCount", Json::FromNumber(choice_count)},
+                           })},
+                      }),
+                  })},
+             })},
+        }),
+    };
   } else if (envoy_config_cluster_v3_Cluster_lb_policy(cluster) ==
              envoy_config_cluster_v3_Cluster_RING_HASH) {
     // Record ring hash lb config
@@ -339,6 +372,35 @@ void ParseLbPolicyConfig(const XdsResourceType::DecodeContext& context,
              })},
         }),
     };
+  } else if (envoy_config_cluster_v3_Cluster_lb_policy(cluster) ==
+             envoy_config_cluster_v3_Cluster_MAGLEV) {
+    // Record maglev lb config
+    auto* maglev_config =
+        envoy_config_cluster_v3_Cluster_maglev_lb_config(cluster);
+    uint64_t table_size = MaglevTable::kDefaultTableSize;
+    if (maglev_config != nullptr) {
+      const google_protobuf_UInt64Value* uint64_value =
+          envoy_config_cluster_v3_Cluster_MaglevLbConfig_table_size(
+              maglev_config);
+      if (uint64_value != nullptr) {
+        ValidationErrors::ScopedField field(
+            errors, ".maglev_lb_config.table_size");
+        table_size = google_protobuf_UInt64Value_value(uint64_value);
+        if (!MaglevTable::IsValidTableSize(table_size)) {
+          errors->AddError(
+              absl::StrCat("must be a prime number no larger than ",
+                           MaglevTable::kMaxTableSize));
+        }
+      }
+    }
+    cds_update->lb_policy_config = {
+        Json::FromObject({
+            {"maglev_experimental",
+             Json::FromObject({
+                 {"tableSize", Json::FromNumber(table_size)},
+             })},
+        }),
+    };
   } else {
     ValidationErrors::ScopedField field(errors, ".lb_policy");
     errors->AddError("LB policy is not supported");
@@ -38,6 +38,8 @@
 
 namespace grpc_core {
 
+class XdsVirtualHostIndex;
+
 struct XdsRouteConfigResource : public XdsResourceType::ResourceData {
   using TypedPerFilterConfig =
       std::map<std::string, XdsHttpFilterImpl::FilterConfig>;
@@ -208,6 +210,9 @@ struct XdsRouteConfigResource : public XdsResourceType::ResourceData {
 
   std::vector<VirtualHost> virtual_hosts;
   ClusterSpecifierPluginMap cluster_specifier_plugin_map;
+  // Index of the domains of virtual_hosts, set by the parser.  Derived
+  // from virtual_hosts, so not compared or printed.
+  std::shared_ptr<const XdsVirtualHostIndex> virtual_host_index;
 
   bool operator==(const XdsRouteConfigResource& other) const {
     return virtual_hosts == other.virtual_hosts &&
@@ -815,6 +815,24 @@ absl::optional<XdsRouteConfigResource::Route> ParseRoute(
   return route;
 }
 
+class VirtualHostListIterator final
+    : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHostListIterator(
+      const std::vector<XdsRouteConfigResource::VirtualHost>* virtual_hosts)
+      : virtual_hosts_(virtual_hosts) {}
+
+  size_t Size() const override { return virtual_hosts_->size(); }
+
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return (*virtual_hosts_)[index].domains;
+  }
+
+ private:
+  const std::vector<XdsRouteConfigResource::VirtualHost>* virtual_hosts_;
+};
+
 }  // namespace
 
 std::shared_ptr<const XdsRouteConfigResource> XdsRouteConfigResourceParse(
@@ -902,6 +920,8 @@ std::shared_ptr<const XdsRouteConfigResource> XdsRouteConfigResourceParse(
   for (auto& unused_plugin : cluster_specifier_plugins_not_seen) {
     rds_update->cluster_specifier_plugin_map.erase(std::string(unused_plugin));
   }
+  rds_update->virtual_host_index = std::make_shared<XdsVirtualHostIndex>(
+      VirtualHostListIterator(&rds_update->virtual_hosts));
   return rds_update;
 }
 
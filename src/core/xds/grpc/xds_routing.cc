@@ -23,11 +23,14 @@
 
 #include <algorithm>
 #include <cctype>
+#include <functional>
+#include <memory>
 #include <utility>
 
 #include "absl/log/check.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 
@@ -137,6 +140,74 @@ absl::optional<size_t> XdsRouting::FindVirtualHostForDomain(
   return target_index;
 }
 
+//
+// XdsVirtualHostIndex
+//
+
+void XdsVirtualHostIndex::WildcardIndex::Add(std::string value,
+                                             size_t index) {
+  lengths.push_back(value.size());
+  patterns.emplace(std::move(value), index);
+}
+
+void XdsVirtualHostIndex::WildcardIndex::Finish() {
+  std::sort(lengths.begin(), lengths.end(), std::greater<size_t>());
+  lengths.erase(std::unique(lengths.begin(), lengths.end()), lengths.end());
+}
+
+XdsVirtualHostIndex::XdsVirtualHostIndex(
+    const XdsRouting::VirtualHostListIterator& vhost_iterator) {
+  for (size_t i = 0; i < vhost_iterator.Size(); ++i) {
+    for (const std::string& domain_pattern :
+         vhost_iterator.GetDomainsForVirtualHost(i)) {
+      // Domain matching is case-insensitive.
+      std::string pattern = absl::AsciiStrToLower(domain_pattern);
+      switch (DomainPatternMatchType(pattern)) {
+        case EXACT_MATCH:
+          exact_.emplace(std::move(pattern), i);
+          break;
+        case SUFFIX_MATCH:
+          suffixes_.Add(pattern.substr(1), i);
+          break;
+        case PREFIX_MATCH:
+          pattern.pop_back();
+          prefixes_.Add(std::move(pattern), i);
+          break;
+        case UNIVERSE_MATCH:
+          if (!universe_.has_value()) universe_ = i;
+          break;
+        case INVALID_MATCH:
+          // This should be caught by RouteConfigParse().
+          break;
+      }
+    }
+  }
+  suffixes_.Finish();
+  prefixes_.Finish();
+}
+
+absl::optional<size_t> XdsVirtualHostIndex::Find(
+    absl::string_view domain) const {
+  // Same search order as XdsRouting::FindVirtualHostForDomain().
+  const std::string host = absl::AsciiStrToLower(domain);
+  auto it = exact_.find(host);
+  if (it != exact_.end()) return it->second;
+  // Asterisk must match at least one char, so only patterns shorter than
+  // the host are considered.
+  for (size_t length : suffixes_.lengths) {
+    if (length >= host.size()) continue;
+    it = suffixes_.patterns.find(
+        absl::string_view(host).substr(host.size() - length));
+    if (it != suffixes_.patterns.end()) return it->second;
+  }
+  for (size_t length : prefixes_.lengths) {
+    if (length >= host.size()) continue;
+    it = prefixes_.patterns.find(absl::string_view(host).substr(0, length));
+    if (it != prefixes_.patterns.end()) return it->second;
+  }
+  return universe_;
+}
+
 namespace {
 
 bool HeadersMatch(const std::vector<HeaderMatcher>& header_matchers,
@@ -175,6 +246,120 @@ absl::optional<size_t> XdsRouting::GetRouteForRequest(
   return absl::nullopt;
 }
 
+//
+// XdsRouting::RouteTable
+//
+
+XdsRouting::RouteTable::RouteTable(
+    const RouteListIterator& route_list_iterator) {
+  matchers_.reserve(route_list_iterator.Size());
+  std::vector<const std::string*> regexes;
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    const XdsRouteConfigResource::Route::Matchers& matchers =
+        route_list_iterator.GetMatchersForRoute(i);
+    matchers_.push_back(&matchers);
+    const StringMatcher& path_matcher = matchers.path_matcher;
+    const uint32_t index = static_cast<uint32_t>(i);
+    PathIndex& path_index = path_matcher.case_sensitive() ? case_sensitive_
+                                                          : case_insensitive_;
+    std::string value = path_matcher.case_sensitive()
+                            ? path_matcher.string_matcher()
+                            : absl::AsciiStrToLower(
+                                  path_matcher.string_matcher());
+    switch (path_matcher.type()) {
+      case StringMatcher::Type::kExact:
+        path_index.exact[value].push_back(index);
+        break;
+      case StringMatcher::Type::kPrefix:
+        path_index.prefix_lengths.push_back(value.size());
+        path_index.prefix[value].push_back(index);
+        break;
+      case StringMatcher::Type::kSafeRegex:
+        regex_routes_.push_back(index);
+        regexes.push_back(&path_matcher.regex_matcher()->pattern());
+        break;
+      default:
+        other_routes_.push_back(index);
+    }
+  }
+  for (PathIndex* path_index : {&case_sensitive_, &case_insensitive_}) {
+    std::vector<size_t>& lengths = path_index->prefix_lengths;
+    std::sort(lengths.begin(), lengths.end());
+    lengths.erase(std::unique(lengths.begin(), lengths.end()), lengths.end());
+  }
+  if (regexes.empty()) return;
+  // StringMatcher uses RE2::FullMatch() with the default options.
+  regex_set_ =
+      std::make_unique<RE2::Set>(RE2::DefaultOptions, RE2::ANCHOR_BOTH);
+  bool ok = true;
+  for (const std::string* regex : regexes) {
+    if (regex_set_->Add(*regex, nullptr) < 0) {
+      ok = false;
+      break;
+    }
+  }
+  if (ok) ok = regex_set_->Compile();
+  if (!ok) {
+    // Should not happen, since each regex was already compiled on its
+    // own, but if it does, evaluate them one by one instead.
+    regex_set_.reset();
+    other_routes_.insert(other_routes_.end(), regex_routes_.begin(),
+                         regex_routes_.end());
+    regex_routes_.clear();
+  }
+}
+
+void XdsRouting::RouteTable::PathIndex::AddCandidates(
+    absl::string_view path, Candidates* candidates) const {
+  auto add = [&](const RouteIndexes& indexes) {
+    candidates->insert(candidates->end(), indexes.begin(), indexes.end());
+  };
+  if (!exact.empty()) {
+    auto it = exact.find(path);
+    if (it != exact.end()) add(it->second);
+  }
+  for (size_t length : prefix_lengths) {
+    if (length > path.size()) break;
+    auto it = prefix.find(path.substr(0, length));
+    if (it != prefix.end()) add(it->second);
+  }
+}
+
+absl::optional<size_t> XdsRouting::RouteTable::GetRouteForRequest(
+    absl::string_view path, grpc_metadata_batch* initial_metadata) const {
+  // Find all routes whose path matcher matches.
+  Candidates candidates;
+  case_sensitive_.AddCandidates(path, &candidates);
+  if (!case_insensitive_.empty()) {
+    case_insensitive_.AddCandidates(absl::AsciiStrToLower(path), &candidates);
+  }
+  if (regex_set_ != nullptr) {
+    std::vector<int> matches;
+    if (regex_set_->Match(re2::StringPiece(path.data(), path.size()),
+                          &matches)) {
+      for (int match : matches) candidates.push_back(regex_routes_[match]);
+    }
+  }
+  for (uint32_t index : other_routes_) {
+    if (matchers_[index]->path_matcher.Match(path)) {
+      candidates.push_back(index);
+    }
+  }
+  // Each route is in only one of the lists above, so there are no
+  // duplicates.  Evaluate the rest of the matchers in route order.
+  std::sort(candidates.begin(), candidates.end());
+  for (uint32_t index : candidates) {
+    const XdsRouteConfigResource::Route::Matchers& matchers =
+        *matchers_[index];
+    if (HeadersMatch(matchers.header_matchers, initial_metadata) &&
+        (!matchers.fraction_per_million.has_value() ||
+         UnderFraction(*matchers.fraction_per_million))) {
+      return index;
+    }
+  }
+  return absl::nullopt;
+}
+
 bool XdsRouting::IsValidDomainPattern(absl::string_view domain_pattern) {
   return DomainPatternMatchType(domain_pattern) != INVALID_MATCH;
 }
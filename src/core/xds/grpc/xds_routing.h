@@ -20,14 +20,19 @@
 #define GRPC_SRC_CORE_XDS_GRPC_XDS_ROUTING_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
+#include "re2/set.h"
 
 #include <grpc/support/port_platform.h>
 
@@ -62,6 +67,8 @@ class XdsRouting final {
   };
 
   // Returns the index of the selected virtual host in the list.
+  // When there is an XdsVirtualHostIndex for the list, its Find() method
+  // gives the same result faster.
   static absl::optional<size_t> FindVirtualHostForDomain(
       const VirtualHostListIterator& vhost_iterator, absl::string_view domain);
 
@@ -71,6 +78,52 @@ class XdsRouting final {
       const RouteListIterator& route_list_iterator, absl::string_view path,
       grpc_metadata_batch* initial_metadata);
 
+  // A list of routes compiled for selecting the route of a request
+  // without evaluating the routes one by one: the routes with exact and
+  // prefix path matchers are indexed by path, and the regexes of the
+  // routes with regex path matchers are combined into a single RE2::Set.
+  // Header matchers and fractions are then only evaluated for the routes
+  // whose path matcher matches, in order.  Gives the same result as
+  // GetRouteForRequest().
+  class RouteTable final {
+   public:
+    // The matchers returned by \a route_list_iterator must outlive the
+    // table.
+    explicit RouteTable(const RouteListIterator& route_list_iterator);
+
+    // Returns the index of the route to use for a request with the
+    // specified path and metadata, or nullopt if no route matches.
+    absl::optional<size_t> GetRouteForRequest(
+        absl::string_view path, grpc_metadata_batch* initial_metadata) const;
+
+   private:
+    using RouteIndexes = absl::InlinedVector<uint32_t, 1>;
+    using Candidates = absl::InlinedVector<uint32_t, 8>;
+
+    // Routes with exact or prefix path matchers.  Strings are lower-case
+    // for case-insensitive matchers.
+    struct PathIndex {
+      absl::flat_hash_map<std::string, RouteIndexes> exact;
+      absl::flat_hash_map<std::string, RouteIndexes> prefix;
+      // Sorted, distinct lengths of the strings in prefix.
+      std::vector<size_t> prefix_lengths;
+
+      bool empty() const { return exact.empty() && prefix.empty(); }
+      void AddCandidates(absl::string_view path,
+                         Candidates* candidates) const;
+    };
+
+    std::vector<const XdsRouteConfigResource::Route::Matchers*> matchers_;
+    PathIndex case_sensitive_;
+    PathIndex case_insensitive_;
+    // Routes with regex path matchers, in the order of the regexes in
+    // regex_set_.
+    std::vector<uint32_t> regex_routes_;
+    std::unique_ptr<RE2::Set> regex_set_;
+    // Routes whose path matcher needs to be evaluated for each request.
+    std::vector<uint32_t> other_routes_;
+  };
+
   // Returns true if \a domain_pattern is a valid domain pattern, false
   // otherwise.
   static bool IsValidDomainPattern(absl::string_view domain_pattern);
@@ -101,6 +154,39 @@ class XdsRouting final {
       const ChannelArgs& args);
 };
 
+// An index of the domain patterns of a list of virtual hosts, built
+// when the list is received, for finding the virtual host for a domain
+// without matching it against each pattern in turn.  The exact domains,
+// and the suffixes and prefixes of the wildcard patterns, are keyed by
+// lower-cased value in hash maps, so that a lookup costs one probe per
+// distinct wildcard pattern length.
+class XdsVirtualHostIndex final {
+ public:
+  explicit XdsVirtualHostIndex(
+      const XdsRouting::VirtualHostListIterator& vhost_iterator);
+
+  // Same as XdsRouting::FindVirtualHostForDomain() with the list the
+  // index was built from.
+  absl::optional<size_t> Find(absl::string_view domain) const;
+
+ private:
+  // Suffixes or prefixes of wildcard patterns, without the asterisk.
+  struct WildcardIndex {
+    // Value to index of the first virtual host with a pattern for it.
+    absl::flat_hash_map<std::string, size_t> patterns;
+    // Distinct lengths of the keys in patterns, longest first.
+    std::vector<size_t> lengths;
+
+    void Add(std::string value, size_t index);
+    void Finish();
+  };
+
+  absl::flat_hash_map<std::string, size_t> exact_;
+  WildcardIndex suffixes_;
+  WildcardIndex prefixes_;
+  absl::optional<size_t> universe_;
+};
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_XDS_GRPC_XDS_ROUTING_H
@@ -40,6 +40,8 @@ constexpr absl::string_view kServerFeatureIgnoreResourceDeletion =
 constexpr absl::string_view kServerFeatureTrustedXdsServer =
     "trusted_xds_server";
 
+constexpr absl::string_view kServerFeatureDeltaXds = "delta_xds";
+
 }  // namespace
 
 bool GrpcXdsServer::IgnoreResourceDeletion() const {
@@ -47,6 +49,11 @@ bool GrpcXdsServer::IgnoreResourceDeletion() const {
              kServerFeatureIgnoreResourceDeletion)) != server_features_.end();
 }
 
+bool GrpcXdsServer::UseDeltaProtocol() const {
+  return server_features_.find(std::string(kServerFeatureDeltaXds)) !=
+         server_features_.end();
+}
+
 bool GrpcXdsServer::TrustedXdsServer() const {
   return server_features_.find(std::string(kServerFeatureTrustedXdsServer)) !=
          server_features_.end();
@@ -127,7 +134,8 @@ void GrpcXdsServer::JsonPostLoad(const Json& json, const JsonArgs& args,
         for (const Json& feature_json : array) {
           if (feature_json.type() == Json::Type::kString &&
               (feature_json.string() == kServerFeatureIgnoreResourceDeletion ||
-               feature_json.string() == kServerFeatureTrustedXdsServer)) {
+               feature_json.string() == kServerFeatureTrustedXdsServer ||
+               feature_json.string() == kServerFeatureDeltaXds)) {
             server_features_.insert(feature_json.string());
           }
         }
@@ -36,6 +36,8 @@ class GrpcXdsServer final : public XdsBootstrap::XdsServer {
 
   bool IgnoreResourceDeletion() const override;
 
+  bool UseDeltaProtocol() const override;
+
   bool TrustedXdsServer() const;
 
   bool Equals(const XdsServer& other) const override;
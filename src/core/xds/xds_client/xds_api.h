@@ -20,6 +20,7 @@
 #include <stddef.h>
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -69,11 +70,16 @@ class XdsApi final {
 
     // Called to parse each individual resource in the ADS response.
     // Note that resource_name is non-empty only when the resource was
-    // wrapped in a Resource wrapper proto.
+    // wrapped in a Resource wrapper proto.  resource_version is set only
+    // in delta responses.
     virtual void ParseResource(upb_Arena* arena, size_t idx,
                                absl::string_view type_url,
                                absl::string_view resource_name,
-                               absl::string_view serialized_resource) = 0;
+                               absl::string_view serialized_resource,
+                               absl::string_view resource_version) = 0;
+
+    // Called for each resource removed by a delta ADS response.
+    virtual void ResourceRemoved(absl::string_view resource_name) = 0;
 
     // Called when a resource is wrapped in a Resource wrapper proto but
     // we fail to parse the Resource wrapper.
@@ -114,8 +120,9 @@ class XdsApi final {
 
     // The client status of this resource.
     ClientResourceStatus client_status = REQUESTED;
-    // The serialized bytes of the last successfully updated raw xDS resource.
-    std::string serialized_proto;
+    // The serialized bytes of the last successfully updated raw xDS resource,
+    // or null if there is none. Shared so that CSDS dumps need not copy it.
+    std::shared_ptr<const std::string> serialized_proto;
     // The timestamp when the resource was last successfully updated.
     Timestamp update_time;
     // The last successfully updated version of the resource.
@@ -160,6 +167,20 @@ class XdsApi final {
   absl::Status ParseAdsResponse(absl::string_view encoded_response,
                                 AdsResponseParserInterface* parser);
 
+  // Creates a delta ADS request.  initial_resource_versions is only
+  // sent in the first request for a resource type on a stream.
+  std::string CreateDeltaAdsRequest(
+      absl::string_view type_url, absl::string_view nonce,
+      const std::vector<std::string>& resource_names_subscribe,
+      const std::vector<std::string>& resource_names_unsubscribe,
+      const std::map<std::string, std::string>& initial_resource_versions,
+      absl::Status status, bool populate_node);
+
+  // Same as ParseAdsResponse() for a delta ADS response.  The
+  // system_version_info field is reported as the version.
+  absl::Status ParseDeltaAdsResponse(absl::string_view encoded_response,
+                                     AdsResponseParserInterface* parser);
+
   // Creates an initial LRS request.
   std::string CreateLrsInitialRequest();
 
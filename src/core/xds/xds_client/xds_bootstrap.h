@@ -47,6 +47,9 @@ class XdsBootstrap {
 
     virtual const std::string& server_uri() const = 0;
     virtual bool IgnoreResourceDeletion() const = 0;
+    // If true, the XdsClient uses the incremental (delta) variant of
+    // ADS with this server instead of the state-of-the-world variant.
+    virtual bool UseDeltaProtocol() const = 0;
 
     virtual bool Equals(const XdsServer& other) const = 0;
 
@@ -21,7 +21,10 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -51,6 +54,7 @@
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/xxhash_inline.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/uri/uri_parser.h"
 #include "src/core/util/upb_utils.h"
@@ -152,6 +156,7 @@ class XdsClient::XdsChannel::AdsCall final
           resources_seen;
       uint64_t num_valid_resources = 0;
       uint64_t num_invalid_resources = 0;
+      uint64_t num_decodes_skipped = 0;
       RefCountedPtr<ReadDelayHandle> read_delay_handle;
     };
 
@@ -162,7 +167,11 @@ class XdsClient::XdsChannel::AdsCall final
 
     void ParseResource(upb_Arena* arena, size_t idx, absl::string_view type_url,
                        absl::string_view resource_name,
-                       absl::string_view serialized_resource) override
+                       absl::string_view serialized_resource,
+                       absl::string_view resource_version) override
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+    void ResourceRemoved(absl::string_view resource_name) override
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
     void ResourceWrapperParsingFailed(size_t idx,
@@ -173,6 +182,17 @@ class XdsClient::XdsChannel::AdsCall final
    private:
     XdsClient* xds_client() const { return ads_call_->xds_client(); }
 
+    // Cancels the does-not-exist timer for the resource on this stream.
+    void MarkResourceSeen(const XdsResourceName& name)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+    // Returns true if the resource is identical to the cached version,
+    // in which case it does not need to be decoded.
+    bool SkipUnchangedResource(absl::string_view resource_name,
+                               absl::string_view serialized_resource,
+                               uint64_t serialized_hash)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
     AdsCall* ads_call_;
     const Timestamp update_time_ = Timestamp::Now();
     Result result_;
@@ -317,10 +337,18 @@ class XdsClient::XdsChannel::AdsCall final
     std::map<std::string /*authority*/,
              std::map<XdsResourceKey, OrphanablePtr<ResourceTimer>>>
         subscribed_resources;
+
+    // Delta only: the resource names the server currently thinks we are
+    // subscribed to on this stream, and whether we have sent a request
+    // for this type yet.
+    std::set<std::string> resource_names_sent;
+    bool sent_delta_request = false;
   };
 
   void SendMessageLocked(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+  std::string CreateDeltaRequestLocked(const XdsResourceType* type)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
   void OnRequestSent(bool ok);
   void OnRecvMessage(absl::string_view payload);
@@ -339,6 +367,8 @@ class XdsClient::XdsChannel::AdsCall final
   OrphanablePtr<XdsTransportFactory::XdsTransport::StreamingCall>
       streaming_call_;
 
+  // True if the stream uses the delta variant of ADS.
+  bool delta_ = false;
   bool sent_initial_message_ = false;
   bool seen_response_ = false;
 
@@ -814,7 +844,8 @@ namespace {
 XdsApi::ResourceMetadata CreateResourceMetadataAcked(
     std::string serialized_proto, std::string version, Timestamp update_time) {
   XdsApi::ResourceMetadata resource_metadata;
-  resource_metadata.serialized_proto = std::move(serialized_proto);
+  resource_metadata.serialized_proto =
+      std::make_shared<const std::string>(std::move(serialized_proto));
   resource_metadata.update_time = update_time;
   resource_metadata.version = std::move(version);
   resource_metadata.client_status = XdsApi::ResourceMetadata::ACKED;
@@ -836,7 +867,12 @@ void UpdateResourceMetadataNacked(const std::string& version,
 
 void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
     upb_Arena* arena, size_t idx, absl::string_view type_url,
-    absl::string_view resource_name, absl::string_view serialized_resource) {
+    absl::string_view resource_name, absl::string_view serialized_resource,
+    absl::string_view resource_version) {
+  // In delta, each resource has its own version.
+  const std::string version = resource_version.empty()
+                                  ? result_.version
+                                  : std::string(resource_version);
   std::string error_prefix = absl::StrCat(
       "resource index ", idx, ": ",
       resource_name.empty() ? "" : absl::StrCat(resource_name, ": "));
@@ -848,6 +884,14 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
     ++result_.num_invalid_resources;
     return;
   }
+  // Skip decoding if the server resent the resource we already have.
+  const uint64_t serialized_hash =
+      XXH3_64bits(serialized_resource.data(), serialized_resource.size());
+  if (SkipUnchangedResource(resource_name, serialized_resource,
+                            serialized_hash)) {
+    return;
+  }
+  const bool resource_wrapped = !resource_name.empty();
   // Parse the resource.
   XdsResourceType::DecodeContext context = {
       xds_client(), ads_call_->xds_channel()->server_, &xds_client_trace,
@@ -886,17 +930,7 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
     return;
   }
   // Cancel resource-does-not-exist timer, if needed.
-  auto timer_it = ads_call_->state_map_.find(result_.type);
-  if (timer_it != ads_call_->state_map_.end()) {
-    auto it = timer_it->second.subscribed_resources.find(
-        parsed_resource_name->authority);
-    if (it != timer_it->second.subscribed_resources.end()) {
-      auto res_it = it->second.find(parsed_resource_name->key);
-      if (res_it != it->second.end()) {
-        res_it->second->MarkSeen();
-      }
-    }
-  }
+  MarkResourceSeen(*parsed_resource_name);
   // Lookup the authority in the cache.
   auto authority_it =
       xds_client()->authority_state_map_.find(parsed_resource_name->authority);
@@ -938,7 +972,7 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
         absl::UnavailableError(
             absl::StrCat("invalid resource: ", decode_status.ToString())),
         result_.read_delay_handle);
-    UpdateResourceMetadataNacked(result_.version, decode_status.ToString(),
+    UpdateResourceMetadataNacked(version, decode_status.ToString(),
                                  update_time_, &resource_state.meta);
     ++result_.num_invalid_resources;
     return;
@@ -959,7 +993,10 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
   // Update the resource state.
   resource_state.resource = std::move(*decode_result.resource);
   resource_state.meta = CreateResourceMetadataAcked(
-      std::string(serialized_resource), result_.version, update_time_);
+      std::string(serialized_resource), version, update_time_);
+  xds_client()->UpdateResourceHashLocked(
+      result_.type, *parsed_resource_name, /*index_by_hash=*/!resource_wrapped,
+      serialized_hash, &resource_state);
   // Notify watchers.
   auto& watchers_list = resource_state.watchers;
   xds_client()->work_serializer_.Schedule(
@@ -973,6 +1010,98 @@ void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ParseResource(
       DEBUG_LOCATION);
 }
 
+void XdsClient::XdsChannel::AdsCall::AdsResponseParser::MarkResourceSeen(
+    const XdsResourceName& name) {
+  auto timer_it = ads_call_->state_map_.find(result_.type);
+  if (timer_it == ads_call_->state_map_.end()) return;
+  auto it = timer_it->second.subscribed_resources.find(name.authority);
+  if (it == timer_it->second.subscribed_resources.end()) return;
+  auto res_it = it->second.find(name.key);
+  if (res_it != it->second.end()) res_it->second->MarkSeen();
+}
+
+bool XdsClient::XdsChannel::AdsCall::AdsResponseParser::SkipUnchangedResource(
+    absl::string_view resource_name, absl::string_view serialized_resource,
+    uint64_t serialized_hash) {
+  // Find the resource name, either from the Resource wrapper or by
+  // looking up the hash of resources we have cached.
+  XdsResourceName name;
+  if (!resource_name.empty()) {
+    auto parsed_resource_name =
+        xds_client()->ParseXdsResourceName(resource_name, result_.type);
+    if (!parsed_resource_name.ok()) return false;
+    name = std::move(*parsed_resource_name);
+  } else {
+    auto type_it = xds_client()->resource_hash_index_.find(result_.type);
+    if (type_it == xds_client()->resource_hash_index_.end()) return false;
+    auto it = type_it->second.find(serialized_hash);
+    if (it == type_it->second.end()) return false;
+    name = it->second;
+  }
+  auto authority_it = xds_client()->authority_state_map_.find(name.authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) return false;
+  auto type_it = authority_it->second.resource_map.find(result_.type);
+  if (type_it == authority_it->second.resource_map.end()) return false;
+  auto it = type_it->second.find(name.key);
+  if (it == type_it->second.end()) return false;
+  const ResourceState& resource_state = it->second;
+  // Let resources for which we ignored a deletion go through the normal
+  // path, so that the re-addition is logged.
+  if (resource_state.resource == nullptr || resource_state.ignored_deletion ||
+      resource_state.serialized_hash != serialized_hash ||
+      resource_state.meta.serialized_proto == nullptr ||
+      *resource_state.meta.serialized_proto != serialized_resource) {
+    return false;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(xds_client)) {
+    LOG(INFO) << "[xds_client " << xds_client() << "] " << result_.type_url
+              << " resource "
+              << XdsClient::ConstructFullXdsResourceName(
+                     name.authority, result_.type_url, name.key)
+              << " identical to cached serialized resource, skipping decode.";
+  }
+  MarkResourceSeen(name);
+  if (result_.type->AllResourcesRequiredInSotW()) {
+    result_.resources_seen[name.authority].insert(name.key);
+  }
+  ++result_.num_valid_resources;
+  ++result_.num_decodes_skipped;
+  return true;
+}
+
+void XdsClient::XdsChannel::AdsCall::AdsResponseParser::ResourceRemoved(
+    absl::string_view resource_name) {
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, result_.type);
+  if (!parsed_resource_name.ok()) return;
+  // The server has answered for this resource, so it doesn't need the
+  // does-not-exist timer anymore.
+  MarkResourceSeen(*parsed_resource_name);
+  auto authority_it =
+      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) return;
+  auto type_it = authority_it->second.resource_map.find(result_.type);
+  if (type_it == authority_it->second.resource_map.end()) return;
+  auto it = type_it->second.find(parsed_resource_name->key);
+  if (it == type_it->second.end()) return;
+  ResourceState& resource_state = it->second;
+  if (resource_state.resource != nullptr &&
+      ads_call_->xds_channel()->server_.IgnoreResourceDeletion()) {
+    if (!resource_state.ignored_deletion) {
+      LOG(ERROR) << "[xds_client " << xds_client() << "] xds server "
+                 << ads_call_->xds_channel()->server_.server_uri()
+                 << ": ignoring deletion for resource type "
+                 << result_.type_url << " name " << resource_name;
+      resource_state.ignored_deletion = true;
+    }
+    return;
+  }
+  resource_state.resource.reset();
+  resource_state.meta.client_status = XdsApi::ResourceMetadata::DOES_NOT_EXIST;
+  xds_client()->NotifyWatchersOnResourceDoesNotExist(
+      resource_state.watchers, result_.read_delay_handle);
+}
+
 void XdsClient::XdsChannel::AdsCall::AdsResponseParser::
     ResourceWrapperParsingFailed(size_t idx, absl::string_view message) {
   result_.errors.emplace_back(
@@ -991,9 +1120,12 @@ XdsClient::XdsChannel::AdsCall::AdsCall(
       retryable_call_(std::move(retryable_call)) {
   CHECK_NE(xds_client(), nullptr);
   // Init the ADS call.
+  delta_ = xds_channel()->server_.UseDeltaProtocol();
   const char* method =
-      "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
-      "StreamAggregatedResources";
+      delta_ ? "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+               "DeltaAggregatedResources"
+             : "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+               "StreamAggregatedResources";
   streaming_call_ = xds_channel()->transport_->CreateStreamingCall(
       method, std::make_unique<StreamEventHandler>(
                   // Passing the initial ref here.  This ref will go away when
@@ -1049,10 +1181,13 @@ void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
     return;
   }
   auto& state = state_map_[type];
-  std::string serialized_message = xds_client()->api_.CreateAdsRequest(
-      type->type_url(), xds_channel()->resource_type_version_map_[type],
-      state.nonce, ResourceNamesForRequest(type), state.status,
-      !sent_initial_message_);
+  std::string serialized_message =
+      delta_ ? CreateDeltaRequestLocked(type)
+             : xds_client()->api_.CreateAdsRequest(
+                   type->type_url(),
+                   xds_channel()->resource_type_version_map_[type],
+                   state.nonce, ResourceNamesForRequest(type), state.status,
+                   !sent_initial_message_);
   sent_initial_message_ = true;
   if (GRPC_TRACE_FLAG_ENABLED(xds_client)) {
     LOG(INFO) << "[xds_client " << xds_client() << "] xds server "
@@ -1066,6 +1201,49 @@ void XdsClient::XdsChannel::AdsCall::SendMessageLocked(
   send_message_pending_ = type;
 }
 
+std::string XdsClient::XdsChannel::AdsCall::CreateDeltaRequestLocked(
+    const XdsResourceType* type) {
+  auto& state = state_map_[type];
+  // Send only the changes since the last request on this stream.
+  std::vector<std::string> resource_names = ResourceNamesForRequest(type);
+  std::set<std::string> names(resource_names.begin(), resource_names.end());
+  std::vector<std::string> subscribe;
+  std::set_difference(names.begin(), names.end(),
+                      state.resource_names_sent.begin(),
+                      state.resource_names_sent.end(),
+                      std::back_inserter(subscribe));
+  std::vector<std::string> unsubscribe;
+  std::set_difference(state.resource_names_sent.begin(),
+                      state.resource_names_sent.end(), names.begin(),
+                      names.end(), std::back_inserter(unsubscribe));
+  // In the first request for the type, tell the server which versions
+  // we already have cached from a previous stream.
+  std::map<std::string, std::string> initial_resource_versions;
+  if (!state.sent_delta_request) {
+    for (const auto& a : state.subscribed_resources) {
+      auto authority_it = xds_client()->authority_state_map_.find(a.first);
+      if (authority_it == xds_client()->authority_state_map_.end()) continue;
+      auto type_it = authority_it->second.resource_map.find(type);
+      if (type_it == authority_it->second.resource_map.end()) continue;
+      for (const auto& r : a.second) {
+        auto it = type_it->second.find(r.first);
+        if (it == type_it->second.end() || it->second.resource == nullptr) {
+          continue;
+        }
+        initial_resource_versions.emplace(
+            XdsClient::ConstructFullXdsResourceName(a.first, type->type_url(),
+                                                    r.first),
+            it->second.meta.version);
+      }
+    }
+  }
+  state.sent_delta_request = true;
+  state.resource_names_sent = std::move(names);
+  return xds_client()->api_.CreateDeltaAdsRequest(
+      type->type_url(), state.nonce, subscribe, unsubscribe,
+      initial_resource_versions, state.status, !sent_initial_message_);
+}
+
 void XdsClient::XdsChannel::AdsCall::SubscribeLocked(
     const XdsResourceType* type, const XdsResourceName& name, bool delay_send) {
   auto& state = state_map_[type].subscribed_resources[name.authority][name.key];
@@ -1138,8 +1316,11 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
     MutexLock lock(&xds_client()->mu_);
     if (!IsCurrentCallOnChannel()) return;
     // Parse and validate the response.
+    xds_client()->MaybePopulateDefPoolLocked();
     AdsResponseParser parser(this);
-    absl::Status status = xds_client()->api_.ParseAdsResponse(payload, &parser);
+    absl::Status status =
+        delta_ ? xds_client()->api_.ParseDeltaAdsResponse(payload, &parser)
+               : xds_client()->api_.ParseAdsResponse(payload, &parser);
     // This includes a handle that will trigger an ADS read.
     AdsResponseParser::Result result = parser.TakeResult();
     read_delay_handle = std::move(result.read_delay_handle);
@@ -1167,8 +1348,9 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
                    << ", will NACK: nonce=" << state.nonce
                    << " status=" << state.status;
       }
-      // Delete resources not seen in update if needed.
-      if (result.type->AllResourcesRequiredInSotW()) {
+      // Delete resources not seen in update if needed.  Delta responses
+      // list removed resources explicitly instead.
+      if (!delta_ && result.type->AllResourcesRequiredInSotW()) {
         for (auto& a : xds_client()->authority_state_map_) {
           const std::string& authority = a.first;
           AuthorityState& authority_state = a.second;
@@ -1227,6 +1409,11 @@ void XdsClient::XdsChannel::AdsCall::OnRecvMessage(absl::string_view payload) {
     }
     // Update metrics.
     if (xds_client()->metrics_reporter_ != nullptr) {
+      if (result.num_decodes_skipped > 0) {
+        xds_client()->metrics_reporter_->ReportResourceDecodesSkipped(
+            xds_channel()->server_.server_uri(), result.type_url,
+            result.num_decodes_skipped);
+      }
       xds_client()->metrics_reporter_->ReportResourceUpdates(
           xds_channel()->server_.server_uri(), result.type_url,
           result.num_valid_resources, result.num_invalid_resources);
@@ -1801,6 +1988,7 @@ void XdsClient::CancelResourceWatch(const XdsResourceType* type,
       xds_channel->UnsubscribeLocked(type, *resource_name,
                                      delay_unsubscription);
     }
+    RemoveResourceHashLocked(type, *resource_name, resource_state);
     type_map.erase(resource_it);
     if (type_map.empty()) {
       authority_state.resource_map.erase(type_it);
@@ -1811,6 +1999,32 @@ void XdsClient::CancelResourceWatch(const XdsResourceType* type,
   }
 }
 
+void XdsClient::UpdateResourceHashLocked(const XdsResourceType* type,
+                                         const XdsResourceName& name,
+                                         bool index_by_hash,
+                                         uint64_t serialized_hash,
+                                         ResourceState* resource_state) {
+  RemoveResourceHashLocked(type, name, *resource_state);
+  resource_state->serialized_hash = serialized_hash;
+  if (index_by_hash) resource_hash_index_[type][serialized_hash] = name;
+}
+
+void XdsClient::RemoveResourceHashLocked(const XdsResourceType* type,
+                                         const XdsResourceName& name,
+                                         const ResourceState& resource_state) {
+  if (!resource_state.serialized_hash.has_value()) return;
+  auto type_it = resource_hash_index_.find(type);
+  if (type_it == resource_hash_index_.end()) return;
+  auto it = type_it->second.find(*resource_state.serialized_hash);
+  // The entry may belong to a different resource with the same hash.
+  if (it == type_it->second.end() || it->second.authority != name.authority ||
+      it->second.key < name.key || name.key < it->second.key) {
+    return;
+  }
+  type_it->second.erase(it);
+  if (type_it->second.empty()) resource_hash_index_.erase(type_it);
+}
+
 void XdsClient::MaybeRegisterResourceTypeLocked(
     const XdsResourceType* resource_type) {
   auto it = resource_types_.find(resource_type->type_url());
@@ -1819,7 +2033,19 @@ void XdsClient::MaybeRegisterResourceTypeLocked(
     return;
   }
   resource_types_.emplace(resource_type->type_url(), resource_type);
-  resource_type->InitUpbSymtab(this, def_pool_.ptr());
+  if (def_pool_populated_) resource_type->InitUpbSymtab(this, def_pool_.ptr());
+}
+
+void XdsClient::MaybePopulateDefPoolLocked() {
+  // Building the defs of the xDS protos takes a while. The messages that are
+  // printed are loaded on demand, but the resources in the Any fields of a
+  // response are only printed if their types were loaded beforehand, which
+  // only matters when tracing.
+  if (def_pool_populated_ || !GRPC_TRACE_FLAG_ENABLED(xds_client)) return;
+  def_pool_populated_ = true;
+  for (const auto& p : resource_types_) {
+    p.second->InitUpbSymtab(this, def_pool_.ptr());
+  }
 }
 
 const XdsResourceType* XdsClient::GetResourceTypeLocked(
@@ -2153,7 +2379,8 @@ void FillGenericXdsConfig(
                                                                  resource_name);
   envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_client_status(
       entry, metadata.client_status);
-  if (!metadata.serialized_proto.empty()) {
+  if (metadata.serialized_proto != nullptr &&
+      !metadata.serialized_proto->empty()) {
     envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_version_info(
         entry, StdStringToUpbString(metadata.version));
     envoy_service_status_v3_ClientConfig_GenericXdsConfig_set_last_updated(
@@ -2163,7 +2390,7 @@ void FillGenericXdsConfig(
             entry, arena);
     google_protobuf_Any_set_type_url(any_field, type_url);
     google_protobuf_Any_set_value(
-        any_field, StdStringToUpbString(metadata.serialized_proto));
+        any_field, StdStringToUpbString(*metadata.serialized_proto));
   }
   if (metadata.client_status == XdsApi::ResourceMetadata::NACKED) {
     auto* update_failure_state = envoy_admin_v3_UpdateFailureState_new(arena);
@@ -2181,7 +2408,26 @@ void FillGenericXdsConfig(
 
 }  // namespace
 
+std::vector<XdsClient::ResourceConfigSnapshot>
+XdsClient::SnapshotResourceConfigs() {
+  std::vector<ResourceConfigSnapshot> snapshot;
+  for (const auto& a : authority_state_map_) {  // authority
+    const std::string& authority = a.first;
+    for (const auto& t : a.second.resource_map) {  // type
+      const XdsResourceType* type = t.first;
+      for (const auto& r : t.second) {  // resource id
+        snapshot.push_back(ResourceConfigSnapshot{
+            type,
+            ConstructFullXdsResourceName(authority, type->type_url(), r.first),
+            r.second.meta});
+      }
+    }
+  }
+  return snapshot;
+}
+
 void XdsClient::DumpClientConfig(
+    const std::vector<ResourceConfigSnapshot>& snapshot,
     std::set<std::string>* string_pool, upb_Arena* arena,
     envoy_service_status_v3_ClientConfig* client_config) {
   // Assemble config dump messages
@@ -2190,28 +2436,17 @@ void XdsClient::DumpClientConfig(
       envoy_service_status_v3_ClientConfig_mutable_node(client_config, arena);
   api_.PopulateNode(node, arena);
   // Dump each resource.
-  for (const auto& a : authority_state_map_) {  // authority
-    const std::string& authority = a.first;
-    for (const auto& t : a.second.resource_map) {  // type
-      const XdsResourceType* type = t.first;
-      auto it =
-          string_pool
-              ->emplace(absl::StrCat("type.googleapis.com/", type->type_url()))
-              .first;
-      upb_StringView type_url = StdStringToUpbString(*it);
-      for (const auto& r : t.second) {  // resource id
-        auto it2 = string_pool
-                       ->emplace(ConstructFullXdsResourceName(
-                           authority, type->type_url(), r.first))
-                       .first;
-        upb_StringView resource_name = StdStringToUpbString(*it2);
-        envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry =
-            envoy_service_status_v3_ClientConfig_add_generic_xds_configs(
-                client_config, arena);
-        FillGenericXdsConfig(r.second.meta, type_url, resource_name, arena,
-                             entry);
-      }
-    }
+  for (const ResourceConfigSnapshot& resource : snapshot) {
+    auto it = string_pool
+                  ->emplace(absl::StrCat("type.googleapis.com/",
+                                         resource.type->type_url()))
+                  .first;
+    upb_StringView type_url = StdStringToUpbString(*it);
+    envoy_service_status_v3_ClientConfig_GenericXdsConfig* entry =
+        envoy_service_status_v3_ClientConfig_add_generic_xds_configs(
+            client_config, arena);
+    FillGenericXdsConfig(resource.meta, type_url,
+                         StdStringToUpbString(resource.name), arena, entry);
   }
 }
 
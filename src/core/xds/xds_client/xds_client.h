@@ -17,6 +17,8 @@
 #ifndef GRPC_SRC_CORE_XDS_XDS_CLIENT_XDS_CLIENT_H
 #define GRPC_SRC_CORE_XDS_XDS_CLIENT_XDS_CLIENT_H
 
+#include <stdint.h>
+
 #include <map>
 #include <memory>
 #include <set>
@@ -25,9 +27,11 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "upb/reflection/def.hpp"
 
 #include <grpc/event_engine/event_engine.h>
@@ -159,13 +163,26 @@ class XdsClient : public DualRefCounted<XdsClient> {
 
   Mutex* mu() ABSL_LOCK_RETURNED(&mu_) { return &mu_; }
 
-  // Dumps the active xDS config to the provided
-  // envoy.service.status.v3.ClientConfig message including the config status
-  // (e.g., CLIENT_REQUESTED, CLIENT_ACKED, CLIENT_NACKED).
-  void DumpClientConfig(std::set<std::string>* string_pool, upb_Arena* arena,
-                        envoy_service_status_v3_ClientConfig* client_config)
+  // The CSDS state of one resource, copied out under the lock so that the
+  // dump can be built after releasing it. The serialized resource is
+  // shared with the cache rather than copied.
+  struct ResourceConfigSnapshot {
+    const XdsResourceType* type;
+    std::string name;
+    XdsApi::ResourceMetadata meta;
+  };
+  std::vector<ResourceConfigSnapshot> SnapshotResourceConfigs()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&mu_);
 
+  // Dumps the resources in \a snapshot to the provided
+  // envoy.service.status.v3.ClientConfig message including the config status
+  // (e.g., CLIENT_REQUESTED, CLIENT_ACKED, CLIENT_NACKED). Does not need the
+  // lock; the message points into \a snapshot and \a string_pool, which must
+  // outlive it.
+  void DumpClientConfig(const std::vector<ResourceConfigSnapshot>& snapshot,
+                        std::set<std::string>* string_pool, upb_Arena* arena,
+                        envoy_service_status_v3_ClientConfig* client_config);
+
   // Invokes func once for each combination of labels to report the
   // resource count for those labels.
   struct ResourceCountLabels {
@@ -284,6 +301,9 @@ class XdsClient : public DualRefCounted<XdsClient> {
     std::shared_ptr<const XdsResourceType::ResourceData> resource;
     XdsApi::ResourceMetadata meta;
     bool ignored_deletion = false;
+    // Hash of meta.serialized_proto, used to skip decoding when the
+    // server resends the same resource.
+    absl::optional<uint64_t> serialized_hash;
   };
 
   struct AuthorityState {
@@ -330,6 +350,10 @@ class XdsClient : public DualRefCounted<XdsClient> {
   void MaybeRegisterResourceTypeLocked(const XdsResourceType* resource_type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  // Loads the messages of the registered resource types into def_pool_ the
+  // first time they may be printed, that is once tracing is enabled.
+  void MaybePopulateDefPoolLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   // Gets the type for resource_type, or null if the type is unknown.
   const XdsResourceType* GetResourceTypeLocked(absl::string_view resource_type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
@@ -348,6 +372,19 @@ class XdsClient : public DualRefCounted<XdsClient> {
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   bool HasUncachedResources(const AuthorityState& authority_state);
 
+  // Records the hash of a newly cached resource.  If the resource was
+  // not wrapped in a Resource proto, it is also added to
+  // resource_hash_index_, so it can be found before it is decoded.
+  void UpdateResourceHashLocked(const XdsResourceType* type,
+                                const XdsResourceName& name,
+                                bool index_by_hash, uint64_t serialized_hash,
+                                ResourceState* resource_state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void RemoveResourceHashLocked(const XdsResourceType* type,
+                                const XdsResourceName& name,
+                                const ResourceState& resource_state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   std::unique_ptr<XdsBootstrap> bootstrap_;
   OrphanablePtr<XdsTransportFactory> transport_factory_;
   const Duration request_timeout_;
@@ -363,6 +400,8 @@ class XdsClient : public DualRefCounted<XdsClient> {
   std::map<absl::string_view /*resource_type*/, const XdsResourceType*>
       resource_types_ ABSL_GUARDED_BY(mu_);
   upb::DefPool def_pool_ ABSL_GUARDED_BY(mu_);
+  // Whether the messages of resource_types_ were loaded into def_pool_.
+  bool def_pool_populated_ ABSL_GUARDED_BY(mu_) = false;
 
   // Map of existing xDS server channels.
   std::map<std::string /*XdsServer key*/, XdsChannel*> xds_channel_map_
@@ -371,6 +410,12 @@ class XdsClient : public DualRefCounted<XdsClient> {
   std::map<std::string /*authority*/, AuthorityState> authority_state_map_
       ABSL_GUARDED_BY(mu_);
 
+  // Names of cached resources by the hash of their serialized form, for
+  // resources that the server does not wrap in a Resource proto.
+  std::map<const XdsResourceType*,
+           absl::flat_hash_map<uint64_t /*serialized_hash*/, XdsResourceName>>
+      resource_hash_index_ ABSL_GUARDED_BY(mu_);
+
   std::map<std::string /*XdsServer key*/, LoadReportServer, std::less<>>
       xds_load_report_server_map_ ABSL_GUARDED_BY(mu_);
 
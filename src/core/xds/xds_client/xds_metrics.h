@@ -33,6 +33,12 @@ class XdsMetricsReporter {
                                      uint64_t num_valid,
                                      uint64_t num_invalid) = 0;
 
+  // Reports resources whose decoding was skipped because they were
+  // identical to the cached version.
+  virtual void ReportResourceDecodesSkipped(absl::string_view xds_server,
+                                            absl::string_view resource_type,
+                                            uint64_t num_skipped) = 0;
+
   virtual void ReportServerFailure(absl::string_view xds_server) = 0;
 };
 
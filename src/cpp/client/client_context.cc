@@ -43,6 +43,9 @@
 #include <grpcpp/support/client_interceptor.h>
 
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/surface/call.h"
+#include "src/core/telemetry/call_phase_timestamps.h"
 
 namespace grpc {
 
@@ -165,8 +168,12 @@ void ClientContext::TryCancel() {
 
 void ClientContext::SendCancelToInterceptors() {
   internal::CancelInterceptorBatchMethods cancel_methods;
+  const experimental::InterceptionHookPointSet cancel_hooks = {
+      experimental::InterceptionHookPoints::PRE_SEND_CANCEL};
   for (size_t i = 0; i < rpc_info_.interceptors_.size(); i++) {
-    rpc_info_.RunInterceptor(&cancel_methods, i);
+    if (rpc_info_.InterceptorSubscribes(i, cancel_hooks)) {
+      rpc_info_.RunInterceptor(&cancel_methods, i);
+    }
   }
 }
 
@@ -180,6 +187,21 @@ std::string ClientContext::peer() const {
   return peer;
 }
 
+experimental::CallPhaseTimestamps
+ClientContext::ExperimentalGetCallPhaseTimestamps() const {
+  experimental::CallPhaseTimestamps timestamps;
+  auto* phases = call_ == nullptr
+                     ? nullptr
+                     : grpc_call_get_arena(call_)
+                           ->GetContext<grpc_core::CallPhaseTimestamps>();
+  if (phases != nullptr) {
+    phases->ExportTo(timestamps);
+  } else {
+    grpc_core::CallPhaseTimestamps::ExportUnsetTo(timestamps);
+  }
+  return timestamps;
+}
+
 void ClientContext::SetGlobalCallbacks(GlobalCallbacks* client_callbacks) {
   CHECK(g_client_callbacks == g_default_client_callbacks);
   CHECK_NE(client_callbacks, nullptr);
@@ -15,6 +15,7 @@
 //
 //
 
+#include <algorithm>
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
@@ -162,6 +163,38 @@ CompletionQueue::NextStatus CompletionQueue::AsyncNextInternal(
   }
 }
 
+size_t CompletionQueue::NextBatch(Event* events, size_t max_events) {
+  // Events are taken from the core queue in chunks, so that no allocation is
+  // needed for any max_events.
+  constexpr size_t kMaxChunk = 32;
+  grpc_event chunk[kMaxChunk];
+  size_t num_events = 0;
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_REALTIME);
+  while (num_events < max_events) {
+    const size_t chunk_size = std::min(max_events - num_events, kMaxChunk);
+    const size_t n = grpc_completion_queue_next_batch(cq_, chunk, chunk_size,
+                                                      deadline, nullptr);
+    // A timeout or shutdown event is always alone in its chunk.
+    if (chunk[0].type != GRPC_OP_COMPLETE) break;
+    for (size_t i = 0; i < n; i++) {
+      auto core_cq_tag =
+          static_cast<grpc::internal::CompletionQueueTag*>(chunk[i].tag);
+      void* tag = core_cq_tag;
+      bool ok = chunk[i].success != 0;
+      if (core_cq_tag->FinalizeResult(&tag, &ok)) {
+        events[num_events++] = Event{tag, ok};
+      }
+    }
+    // Once there is an event for the application, only take what is already
+    // queued: poll without blocking, and only if the chunk came back full.
+    if (num_events > 0) {
+      if (n < chunk_size) break;
+      deadline = gpr_inf_past(GPR_CLOCK_REALTIME);
+    }
+  }
+  return num_events;
+}
+
 CompletionQueue::CompletionQueueTLSCache::CompletionQueueTLSCache(
     CompletionQueue* cq)
     : cq_(cq), flushed_(false) {
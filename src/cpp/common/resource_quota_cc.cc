@@ -30,6 +30,13 @@ ResourceQuota::ResourceQuota() : impl_(grpc_resource_quota_create(nullptr)) {}
 ResourceQuota::ResourceQuota(const std::string& name)
     : impl_(grpc_resource_quota_create(name.c_str())) {}
 
+ResourceQuota::ResourceQuota(const std::string& name,
+                             const ResourceQuota& parent, size_t min_memory,
+                             int min_threads, double weight)
+    : impl_(grpc_resource_quota_create_child(parent.impl_, name.c_str(),
+                                             min_memory, min_threads,
+                                             weight)) {}
+
 ResourceQuota::~ResourceQuota() { grpc_resource_quota_unref(impl_); }
 
 ResourceQuota& ResourceQuota::Resize(size_t new_size) {
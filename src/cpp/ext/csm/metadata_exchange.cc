@@ -23,9 +23,11 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <memory>
 #include <unordered_map>
 
-#include "absl/log/check.h"
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/escaping.h"
 #include "absl/strings/str_split.h"
@@ -34,13 +36,17 @@
 #include "absl/types/optional.h"
 #include "absl/types/variant.h"
 #include "opentelemetry/sdk/resource/semantic_conventions.h"
+#include "google/protobuf/struct.upb.h"
 #include "upb/base/string_view.h"
+#include "upb/mem/arena.hpp"
 
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/load_file.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/telemetry/call_tracer.h"
@@ -89,18 +95,17 @@ constexpr absl::string_view kPeerCanonicalServiceAttribute =
 constexpr absl::string_view kGkeType = "gcp_kubernetes_engine";
 constexpr absl::string_view kGceType = "gcp_compute_engine";
 
-// A helper method that decodes the remote metadata \a slice as a protobuf
+// A helper method that decodes the remote metadata \a value as a protobuf
 // Struct allocated on \a arena.
-google_protobuf_Struct* DecodeMetadata(grpc_core::Slice slice,
+google_protobuf_Struct* DecodeMetadata(absl::string_view value,
                                        upb_Arena* arena) {
-  // Treat an empty slice as an invalid metadata value.
-  if (slice.empty()) {
+  // Treat an empty value as an invalid metadata value.
+  if (value.empty()) {
     return nullptr;
   }
-  // Decode the slice.
+  // Decode the value.
   std::string decoded_metadata;
-  bool metadata_decoded =
-      absl::Base64Unescape(slice.as_string_view(), &decoded_metadata);
+  bool metadata_decoded = absl::Base64Unescape(value, &decoded_metadata);
   if (metadata_decoded) {
     return google_protobuf_Struct_parse(decoded_metadata.c_str(),
                                         decoded_metadata.size(), arena);
@@ -259,21 +264,83 @@ absl::Span<const RemoteAttribute> GetAttributesForType(
   }
 }
 
-absl::optional<std::pair<absl::string_view, absl::string_view>>
-NextFromAttributeList(absl::Span<const RemoteAttribute> attributes,
-                      size_t start_index, size_t curr,
-                      google_protobuf_Struct* decoded_metadata,
-                      upb_Arena* arena) {
-  DCHECK_GE(curr, start_index);
-  const size_t index = curr - start_index;
-  if (index >= attributes.size()) return absl::nullopt;
-  const auto& attribute = attributes[index];
-  return std::make_pair(
-      attribute.otel_attribute,
-      GetStringValueFromUpbStruct(decoded_metadata,
-                                  attribute.metadata_attribute, arena));
+}  // namespace
+
+struct MeshLabelsIterable::RemoteLabels {
+  bool got_remote_labels = false;
+  // The fixed attributes, followed by the attributes of the resource type of
+  // the peer.
+  std::vector<std::pair<absl::string_view, std::string>> labels;
+};
+
+namespace {
+
+std::shared_ptr<const MeshLabelsIterable::RemoteLabels> DecodeRemoteLabels(
+    absl::string_view remote_metadata) {
+  upb::Arena arena;
+  google_protobuf_Struct* struct_pb =
+      DecodeMetadata(remote_metadata, arena.ptr());
+  auto remote_labels = std::make_shared<MeshLabelsIterable::RemoteLabels>();
+  remote_labels->got_remote_labels = struct_pb != nullptr;
+  auto add_labels = [&](absl::Span<const RemoteAttribute> attributes) {
+    for (const auto& attribute : attributes) {
+      remote_labels->labels.emplace_back(
+          attribute.otel_attribute,
+          std::string(GetStringValueFromUpbStruct(
+              struct_pb, attribute.metadata_attribute, arena.ptr())));
+    }
+  };
+  add_labels(kFixedAttributes);
+  add_labels(GetAttributesForType(StringToGcpResourceType(
+      GetStringValueFromUpbStruct(struct_pb, kMetadataExchangeTypeKey,
+                                  arena.ptr()))));
+  return remote_labels;
 }
 
+// A peer sends the same "x-envoy-peer-metadata" on every call, so the labels
+// decoded from each value are cached instead of being decoded on every call.
+// Lookups go to the shard of the current CPU so that calls do not contend,
+// at the cost of decoding each value once per shard.
+class RemoteLabelsCache {
+ public:
+  static RemoteLabelsCache& Get() {
+    static RemoteLabelsCache* cache = new RemoteLabelsCache();
+    return *cache;
+  }
+
+  std::shared_ptr<const MeshLabelsIterable::RemoteLabels> Lookup(
+      absl::string_view remote_metadata) {
+    if (remote_metadata.empty()) return no_remote_labels_;
+    Shard& shard = shards_.this_cpu();
+    grpc_core::MutexLock lock(&shard.mu);
+    auto it = shard.remote_labels.find(remote_metadata);
+    if (it != shard.remote_labels.end()) return it->second;
+    // Peers that send a different value on every call would otherwise grow
+    // the cache without bound.
+    if (shard.remote_labels.size() >= kMaxEntriesPerShard) {
+      shard.remote_labels.clear();
+    }
+    auto remote_labels = DecodeRemoteLabels(remote_metadata);
+    shard.remote_labels.emplace(remote_metadata, remote_labels);
+    return remote_labels;
+  }
+
+ private:
+  static constexpr size_t kMaxEntriesPerShard = 64;
+
+  struct Shard {
+    grpc_core::Mutex mu;
+    absl::flat_hash_map<std::string,
+                        std::shared_ptr<const MeshLabelsIterable::RemoteLabels>>
+        remote_labels ABSL_GUARDED_BY(mu);
+  };
+
+  const std::shared_ptr<const MeshLabelsIterable::RemoteLabels>
+      no_remote_labels_ = DecodeRemoteLabels("");
+  grpc_core::PerCpu<Shard> shards_{
+      grpc_core::PerCpuOptions().SetCpusPerShard(2).SetMaxShards(32)};
+};
+
 }  // namespace
 
 //
@@ -283,31 +350,29 @@ NextFromAttributeList(absl::Span<const RemoteAttribute> attributes,
 MeshLabelsIterable::MeshLabelsIterable(
     const std::vector<std::pair<absl::string_view, std::string>>& local_labels,
     grpc_core::Slice remote_metadata)
-    : struct_pb_(DecodeMetadata(std::move(remote_metadata), arena_.ptr())),
-      local_labels_(local_labels),
-      remote_type_(StringToGcpResourceType(GetStringValueFromUpbStruct(
-          struct_pb_, kMetadataExchangeTypeKey, arena_.ptr()))) {}
+    : remote_labels_(RemoteLabelsCache::Get().Lookup(
+          remote_metadata.as_string_view())),
+      local_labels_(local_labels) {}
 
 absl::optional<std::pair<absl::string_view, absl::string_view>>
 MeshLabelsIterable::Next() {
-  size_t local_labels_size = local_labels_.size();
+  const size_t local_labels_size = local_labels_.size();
   if (pos_ < local_labels_size) {
     return local_labels_[pos_++];
   }
-  const size_t fixed_attribute_end =
-      local_labels_size + kFixedAttributes.size();
-  if (pos_ < fixed_attribute_end) {
-    return NextFromAttributeList(kFixedAttributes, local_labels_size, pos_++,
-                                 struct_pb_, arena_.ptr());
-  }
-  return NextFromAttributeList(GetAttributesForType(remote_type_),
-                               fixed_attribute_end, pos_++, struct_pb_,
-                               arena_.ptr());
+  const size_t index = pos_ - local_labels_size;
+  if (index >= remote_labels_->labels.size()) return absl::nullopt;
+  ++pos_;
+  const auto& label = remote_labels_->labels[index];
+  return std::make_pair(label.first, absl::string_view(label.second));
 }
 
 size_t MeshLabelsIterable::Size() const {
-  return local_labels_.size() + kFixedAttributes.size() +
-         GetAttributesForType(remote_type_).size();
+  return local_labels_.size() + remote_labels_->labels.size();
+}
+
+bool MeshLabelsIterable::GotRemoteLabels() const {
+  return remote_labels_->got_remote_labels;
 }
 
 // Returns the mesh ID by reading and parsing the bootstrap file. Returns
@@ -25,9 +25,7 @@
 #include <vector>
 
 #include "absl/strings/string_view.h"
-#include "google/protobuf/struct.upb.h"
 #include "opentelemetry/sdk/common/attribute_utils.h"
-#include "upb/mem/arena.hpp"
 
 #include <grpc/support/port_platform.h>
 
@@ -89,6 +87,9 @@ class MeshLabelsIterable : public LabelsIterable {
  public:
   enum class GcpResourceType : std::uint8_t { kGke, kGce, kUnknown };
 
+  // The remote labels decoded from an "x-envoy-peer-metadata" value.
+  struct RemoteLabels;
+
   MeshLabelsIterable(
       const std::vector<std::pair<absl::string_view, std::string>>&
           local_labels,
@@ -103,13 +104,12 @@ class MeshLabelsIterable : public LabelsIterable {
 
   // Returns true if the peer sent a non-empty base64 encoded
   // "x-envoy-peer-metadata" metadata.
-  bool GotRemoteLabels() const { return struct_pb_ != nullptr; }
+  bool GotRemoteLabels() const;
 
  private:
-  upb::Arena arena_;
-  google_protobuf_Struct* struct_pb_ = nullptr;
+  // Shared by the calls that got the same metadata from their peer.
+  std::shared_ptr<const RemoteLabels> remote_labels_;
   const std::vector<std::pair<absl::string_view, std::string>>& local_labels_;
-  GcpResourceType remote_type_ = GcpResourceType::kUnknown;
   uint32_t pos_ = 0;
 };
 
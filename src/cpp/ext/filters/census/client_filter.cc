@@ -158,30 +158,38 @@ void OpenCensusCallTracer::OpenCensusCallAttemptTracer::
 
 void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordSendMessage(
     const grpc_core::SliceBuffer& send_message) {
-  RecordAnnotation(
-      absl::StrFormat("Send message: %ld bytes", send_message.Length()));
+  RecordLazyAnnotation([&]() {
+    return absl::StrFormat("Send message: %ld bytes",
+                           send_message.Length());
+  });
   ++sent_message_count_;
 }
 
 void OpenCensusCallTracer::OpenCensusCallAttemptTracer::
     RecordSendCompressedMessage(
         const grpc_core::SliceBuffer& send_compressed_message) {
-  RecordAnnotation(absl::StrFormat("Send compressed message: %ld bytes",
-                                   send_compressed_message.Length()));
+  RecordLazyAnnotation([&]() {
+    return absl::StrFormat("Send compressed message: %ld bytes",
+                           send_compressed_message.Length());
+  });
 }
 
 void OpenCensusCallTracer::OpenCensusCallAttemptTracer::RecordReceivedMessage(
     const grpc_core::SliceBuffer& recv_message) {
-  RecordAnnotation(
-      absl::StrFormat("Received message: %ld bytes", recv_message.Length()));
+  RecordLazyAnnotation([&]() {
+    return absl::StrFormat("Received message: %ld bytes",
+                           recv_message.Length());
+  });
   ++recv_message_count_;
 }
 
 void OpenCensusCallTracer::OpenCensusCallAttemptTracer::
     RecordReceivedDecompressedMessage(
         const grpc_core::SliceBuffer& recv_decompressed_message) {
-  RecordAnnotation(absl::StrFormat("Received decompressed message: %ld bytes",
-                                   recv_decompressed_message.Length()));
+  RecordLazyAnnotation([&]() {
+    return absl::StrFormat("Received decompressed message: %ld bytes",
+                           recv_decompressed_message.Length());
+  });
 }
 
 namespace {
@@ -172,6 +172,7 @@ void PayloadToJsonStructProto(LoggingSink::Entry::Payload payload,
     (*payload_proto->mutable_fields())["messageLength"].set_number_value(
         payload.message_length);
   }
+  payload.MaterializeMessage();
   if (!payload.message.empty()) {
     (*payload_proto->mutable_fields())["message"].set_string_value(
         absl::Base64Escape(payload.message));
@@ -236,6 +237,10 @@ void EntryToJsonStructProto(LoggingSink::Entry entry,
 
 namespace {
 
+// Past these limits, new entries are dropped until a flush makes room.
+constexpr size_t kMaxEntriesBeforeDrop = 100000;
+constexpr uint64_t kMaxMemoryFootprintBeforeDrop = 10 * 1024 * 1024;
+
 uint64_t EstimateEntrySize(const LoggingSink::Entry& entry) {
   uint64_t size = sizeof(entry);
   for (const auto& pair : entry.payload.metadata) {
@@ -244,6 +249,9 @@ uint64_t EstimateEntrySize(const LoggingSink::Entry& entry) {
   size += entry.payload.status_message.size();
   size += entry.payload.status_details.size();
   size += entry.payload.message.size();
+  if (entry.payload.message_slices != nullptr) {
+    size += entry.payload.message_slices->Length();
+  }
   size += entry.authority.size();
   size += entry.service_name.size();
   size += entry.method_name.size();
@@ -256,11 +264,26 @@ void ObservabilityLoggingSink::LogEntry(Entry entry) {
   auto entry_size = EstimateEntrySize(entry);
   grpc_core::MutexLock lock(&mu_);
   if (sink_closed_) return;
-  entries_.push_back(std::move(entry));
-  entries_memory_footprint_ += entry_size;
+  if (entries_.size() >= kMaxEntriesBeforeDrop ||
+      entries_memory_footprint_ + entry_size > kMaxMemoryFootprintBeforeDrop) {
+    // Serializing or dumping entries here would stall the call, so drop the
+    // entry instead.
+    ++entries_dropped_;
+    LOG_EVERY_N_SEC(WARNING, 10)
+        << "GCP Observability Logging buffer full. " << entries_dropped_
+        << " log entries dropped so far.";
+  } else {
+    entries_.push_back(std::move(entry));
+    entries_memory_footprint_ += entry_size;
+  }
   MaybeTriggerFlushLocked();
 }
 
+uint64_t ObservabilityLoggingSink::entries_dropped() {
+  grpc_core::MutexLock lock(&mu_);
+  return entries_dropped_;
+}
+
 void ObservabilityLoggingSink::RegisterEnvironmentResource(
     const EnvironmentAutoDetect::ResourceType* resource) {
   grpc_core::MutexLock lock(&mu_);
@@ -393,8 +416,6 @@ void ObservabilityLoggingSink::MaybeTriggerFlush() {
 }
 
 void ObservabilityLoggingSink::MaybeTriggerFlushLocked() {
-  constexpr int kMaxEntriesBeforeDump = 100000;
-  constexpr int kMaxMemoryFootprintBeforeDump = 10 * 1024 * 1024;
   constexpr int kMinEntriesBeforeFlush = 1000;
   constexpr int kMinMemoryFootprintBeforeFlush = 1 * 1024 * 1024;
   // Use this opportunity to fetch environment resource if not fetched already
@@ -410,22 +431,7 @@ void ObservabilityLoggingSink::MaybeTriggerFlushLocked() {
     }
   }
   if (entries_.empty()) return;
-  if (entries_.size() > kMaxEntriesBeforeDump ||
-      entries_memory_footprint_ > kMaxMemoryFootprintBeforeDump) {
-    // Buffer limits have been reached. Dump entries with LOG
-    LOG(INFO) << "Buffer limit reached. Dumping log entries.";
-    for (auto& entry : entries_) {
-      google::protobuf::Struct proto;
-      std::string timestamp = entry.timestamp.ToString();
-      EntryToJsonStructProto(std::move(entry), &proto);
-      std::string output;
-      ::google::protobuf::TextFormat::PrintToString(proto, &output);
-      LOG(INFO) << "Log Entry recorded at time: " << timestamp << " : "
-                << output;
-    }
-    entries_.clear();
-    entries_memory_footprint_ = 0;
-  } else if (resource_ != nullptr && !flush_in_progress_) {
+  if (resource_ != nullptr && !flush_in_progress_) {
     // Environment resource has been detected. Trigger flush if conditions
     // suffice.
     if ((entries_.size() >= kMinEntriesBeforeFlush ||
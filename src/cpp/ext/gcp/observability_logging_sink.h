@@ -56,6 +56,13 @@ class ObservabilityLoggingSink : public grpc_core::LoggingSink {
 
   void LogEntry(Entry entry) override;
 
+  // Messages are copied by the flush, off the call path.
+  bool DefersMessageCopies() const override { return true; }
+
+  // Number of entries dropped because the buffer was full, e.g. because
+  // flushes could not keep up.
+  uint64_t entries_dropped();
+
   // Triggers a final flush of all the currently buffered logging entries and
   // closes the sink preventing any more entries to be logged.
   void FlushAndClose();
@@ -102,6 +109,7 @@ class ObservabilityLoggingSink : public grpc_core::LoggingSink {
       ABSL_GUARDED_BY(mu_);
   std::vector<Entry> entries_ ABSL_GUARDED_BY(mu_);
   uint64_t entries_memory_footprint_ ABSL_GUARDED_BY(mu_) = 0;
+  uint64_t entries_dropped_ ABSL_GUARDED_BY(mu_) = 0;
   const EnvironmentAutoDetect::ResourceType* resource_ ABSL_GUARDED_BY(mu_) =
       nullptr;
   bool flush_triggered_ ABSL_GUARDED_BY(mu_) = false;
@@ -20,12 +20,15 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <array>
 #include <functional>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/functional/any_invocable.h"
 #include "absl/log/check.h"
 #include "absl/status/status.h"
@@ -36,8 +39,6 @@
 #include "absl/time/time.h"
 #include "absl/types/optional.h"
 #include "absl/types/span.h"
-#include "opentelemetry/context/context.h"
-#include "opentelemetry/metrics/sync_instruments.h"
 
 #include <grpc/status.h>
 #include <grpc/support/log.h>
@@ -61,6 +62,89 @@
 namespace grpc {
 namespace internal {
 
+//
+// OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
+//     TcpLatencyTracer
+//
+
+// Records the TCP latency breakdown of the chunks written for one send batch
+// of a call attempt. The transport reports the timestamps of a chunk once it
+// has been acknowledged (or the connection was closed), which may be after the
+// call attempt is gone, so everything needed to record them is copied in.
+class OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
+    TcpLatencyTracer final : public grpc_core::TcpTracerInterface {
+ public:
+  TcpLatencyTracer(std::weak_ptr<OpenTelemetryPluginImpl> otel_plugin,
+                   absl::string_view method, absl::string_view target)
+      : otel_plugin_(std::move(otel_plugin)),
+        method_(method),
+        target_(target),
+        start_time_(absl::Now()) {}
+
+  void RecordEvent(Type type, absl::Time time, size_t /*byte_offset*/,
+                   absl::optional<ConnectionMetrics> /*metrics*/) override {
+    grpc_core::MutexLock lock(&mu_);
+    switch (type) {
+      case Type::kSendMsg:
+        sendmsg_time_ = time;
+        sent_time_.reset();
+        break;
+      case Type::kSent:
+        sent_time_ = time;
+        break;
+      case Type::kAcked:
+        RecordChunkLocked(time);
+        sendmsg_time_.reset();
+        sent_time_.reset();
+        break;
+      default:
+        break;
+    }
+  }
+
+ private:
+  void RecordChunkLocked(absl::Time acked_time)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    auto otel_plugin = otel_plugin_.lock();
+    if (otel_plugin == nullptr || !sendmsg_time_.has_value()) return;
+    std::array<std::pair<absl::string_view, absl::string_view>, 2>
+        additional_labels = {
+            {{OpenTelemetryMethodKey(), method_},
+             {OpenTelemetryTargetKey(), target_}}};
+    // Held by reference by the iterable.
+    const std::vector<std::unique_ptr<LabelsIterable>> injected_labels;
+    KeyValueIterable labels(
+        injected_labels, additional_labels,
+        /*active_plugin_options_view=*/nullptr, /*optional_labels=*/{},
+        /*is_client=*/true, otel_plugin.get());
+    const auto& attempt = otel_plugin->client_.attempt;
+    if (attempt.tcp_queue_duration != nullptr) {
+      attempt.tcp_queue_duration->Record(
+          absl::ToDoubleSeconds(
+              std::max(*sendmsg_time_ - start_time_, absl::ZeroDuration())),
+          labels);
+    }
+    if (!sent_time_.has_value()) return;
+    if (attempt.tcp_kernel_duration != nullptr) {
+      attempt.tcp_kernel_duration->Record(
+          absl::ToDoubleSeconds(*sent_time_ - *sendmsg_time_), labels);
+    }
+    if (attempt.tcp_wire_duration != nullptr) {
+      attempt.tcp_wire_duration->Record(
+          absl::ToDoubleSeconds(acked_time - *sent_time_), labels);
+    }
+  }
+
+  const std::weak_ptr<OpenTelemetryPluginImpl> otel_plugin_;
+  const std::string method_;
+  const std::string target_;
+  // When the send batch reached the transport.
+  const absl::Time start_time_;
+  grpc_core::Mutex mu_;
+  absl::optional<absl::Time> sendmsg_time_ ABSL_GUARDED_BY(mu_);
+  absl::optional<absl::Time> sent_time_ ABSL_GUARDED_BY(mu_);
+};
+
 //
 // OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer
 //
@@ -115,28 +199,36 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
 
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordSendMessage(const grpc_core::SliceBuffer& send_message) {
-  RecordAnnotation(
-      absl::StrFormat("Send message: %ld bytes", send_message.Length()));
+  RecordLazyAnnotation([&]() {
+    return absl::StrFormat("Send message: %ld bytes",
+                           send_message.Length());
+  });
 }
 
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordSendCompressedMessage(
         const grpc_core::SliceBuffer& send_compressed_message) {
-  RecordAnnotation(absl::StrFormat("Send compressed message: %ld bytes",
-                                   send_compressed_message.Length()));
+  RecordLazyAnnotation([&]() {
+    return absl::StrFormat("Send compressed message: %ld bytes",
+                           send_compressed_message.Length());
+  });
 }
 
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordReceivedMessage(const grpc_core::SliceBuffer& recv_message) {
-  RecordAnnotation(
-      absl::StrFormat("Received message: %ld bytes", recv_message.Length()));
+  RecordLazyAnnotation([&]() {
+    return absl::StrFormat("Received message: %ld bytes",
+                           recv_message.Length());
+  });
 }
 
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
     RecordReceivedDecompressedMessage(
         const grpc_core::SliceBuffer& recv_decompressed_message) {
-  RecordAnnotation(absl::StrFormat("Received decompressed message: %ld bytes",
-                                   recv_decompressed_message.Length()));
+  RecordLazyAnnotation([&]() {
+    return absl::StrFormat("Received decompressed message: %ld bytes",
+                           recv_decompressed_message.Length());
+  });
 }
 
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
@@ -160,8 +252,7 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
       /*is_client=*/true, parent_->otel_plugin_);
   if (parent_->otel_plugin_->client_.attempt.duration != nullptr) {
     parent_->otel_plugin_->client_.attempt.duration->Record(
-        absl::ToDoubleSeconds(absl::Now() - start_time_), labels,
-        opentelemetry::context::Context{});
+        absl::ToDoubleSeconds(absl::Now() - start_time_), labels);
   }
   uint64_t outgoing_bytes = 0;
   uint64_t incoming_bytes = 0;
@@ -175,12 +266,12 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
   if (parent_->otel_plugin_->client_.attempt
           .sent_total_compressed_message_size != nullptr) {
     parent_->otel_plugin_->client_.attempt.sent_total_compressed_message_size
-        ->Record(outgoing_bytes, labels, opentelemetry::context::Context{});
+        ->Record(outgoing_bytes, labels);
   }
   if (parent_->otel_plugin_->client_.attempt
           .rcvd_total_compressed_message_size != nullptr) {
     parent_->otel_plugin_->client_.attempt.rcvd_total_compressed_message_size
-        ->Record(incoming_bytes, labels, opentelemetry::context::Context{});
+        ->Record(incoming_bytes, labels);
   }
 }
 
@@ -218,8 +309,15 @@ void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
 
 std::shared_ptr<grpc_core::TcpTracerInterface> OpenTelemetryPluginImpl::
     ClientCallTracer::CallAttemptTracer::StartNewTcpTrace() {
-  // No TCP trace.
-  return nullptr;
+  const auto& attempt = parent_->otel_plugin_->client_.attempt;
+  if (attempt.tcp_queue_duration == nullptr &&
+      attempt.tcp_kernel_duration == nullptr &&
+      attempt.tcp_wire_duration == nullptr) {
+    return nullptr;
+  }
+  return std::make_shared<TcpLatencyTracer>(
+      parent_->otel_plugin_->weak_from_this(), parent_->MethodForStats(),
+      parent_->scope_config_->filtered_target());
 }
 
 void OpenTelemetryPluginImpl::ClientCallTracer::CallAttemptTracer::
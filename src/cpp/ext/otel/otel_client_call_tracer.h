@@ -99,6 +99,8 @@ class OpenTelemetryPluginImpl::ClientCallTracer
                           grpc_core::RefCountedStringValue value) override;
 
    private:
+    class TcpLatencyTracer;
+
     void PopulateLabelInjectors(grpc_metadata_batch* metadata);
 
     const ClientCallTracer* parent_;
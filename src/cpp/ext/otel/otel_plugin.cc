@@ -226,6 +226,13 @@ OpenTelemetryPluginBuilderImpl::SetChannelScopeFilter(
   return *this;
 }
 
+OpenTelemetryPluginBuilderImpl&
+OpenTelemetryPluginBuilderImpl::EnablePerCallMetricsPreAggregation(
+    bool enable) {
+  pre_aggregate_per_call_metrics_ = enable;
+  return *this;
+}
+
 absl::Status OpenTelemetryPluginBuilderImpl::BuildAndRegisterGlobal() {
   if (meter_provider_ == nullptr) {
     return absl::InvalidArgumentError(
@@ -236,7 +243,8 @@ absl::Status OpenTelemetryPluginBuilderImpl::BuildAndRegisterGlobal() {
           metrics_, meter_provider_, std::move(target_attribute_filter_),
           std::move(generic_method_attribute_filter_),
           std::move(server_selector_), std::move(plugin_options_),
-          std::move(optional_label_keys_), std::move(channel_scope_filter_)));
+          std::move(optional_label_keys_), std::move(channel_scope_filter_),
+          pre_aggregate_per_call_metrics_));
   return absl::OkStatus();
 }
 
@@ -250,7 +258,7 @@ OpenTelemetryPluginBuilderImpl::Build() {
       metrics_, meter_provider_, std::move(target_attribute_filter_),
       std::move(generic_method_attribute_filter_), std::move(server_selector_),
       std::move(plugin_options_), std::move(optional_label_keys_),
-      std::move(channel_scope_filter_));
+      std::move(channel_scope_filter_), pre_aggregate_per_call_metrics_);
 }
 
 OpenTelemetryPluginImpl::CallbackMetricReporter::CallbackMetricReporter(
@@ -365,7 +373,8 @@ OpenTelemetryPluginImpl::OpenTelemetryPluginImpl(
     const std::set<absl::string_view>& optional_label_keys,
     absl::AnyInvocable<
         bool(const OpenTelemetryPluginBuilder::ChannelScope& /*scope*/) const>
-        channel_scope_filter)
+        channel_scope_filter,
+    bool pre_aggregate_per_call_metrics)
     : meter_provider_(std::move(meter_provider)),
       server_selector_(std::move(server_selector)),
       target_attribute_filter_(std::move(target_attribute_filter)),
@@ -375,75 +384,116 @@ OpenTelemetryPluginImpl::OpenTelemetryPluginImpl(
       channel_scope_filter_(std::move(channel_scope_filter)) {
   auto meter = meter_provider_->GetMeter("grpc-c++", GRPC_CPP_VERSION_STRING);
   // Per-call metrics.
+  const std::vector<double>* latency_bounds =
+      pre_aggregate_per_call_metrics ? &PreAggregatedLatencyBounds() : nullptr;
+  const std::vector<double>* size_bounds =
+      pre_aggregate_per_call_metrics ? &PreAggregatedSizeBounds() : nullptr;
   if (metrics.contains(grpc::OpenTelemetryPluginBuilder::
                            kClientAttemptStartedInstrumentName)) {
-    client_.attempt.started = meter->CreateUInt64Counter(
-        std::string(grpc::OpenTelemetryPluginBuilder::
-                        kClientAttemptStartedInstrumentName),
-        "Number of client call attempts started", "{attempt}");
+    client_.attempt.started = CreatePerCallCounter(
+        *meter,
+        grpc::OpenTelemetryPluginBuilder::kClientAttemptStartedInstrumentName,
+        "Number of client call attempts started", "{attempt}",
+        pre_aggregate_per_call_metrics);
   }
   if (metrics.contains(grpc::OpenTelemetryPluginBuilder::
                            kClientAttemptDurationInstrumentName)) {
-    client_.attempt.duration = meter->CreateDoubleHistogram(
-        std::string(grpc::OpenTelemetryPluginBuilder::
-                        kClientAttemptDurationInstrumentName),
-        "End-to-end time taken to complete a client call attempt", "s");
+    client_.attempt.duration = CreatePerCallDoubleHistogram(
+        *meter,
+        grpc::OpenTelemetryPluginBuilder::kClientAttemptDurationInstrumentName,
+        "End-to-end time taken to complete a client call attempt", "s",
+        latency_bounds);
   }
   if (metrics.contains(
           grpc::OpenTelemetryPluginBuilder::
               kClientAttemptSentTotalCompressedMessageSizeInstrumentName)) {
     client_.attempt.sent_total_compressed_message_size =
-        meter->CreateUInt64Histogram(
-            std::string(
-                grpc::OpenTelemetryPluginBuilder::
-                    kClientAttemptSentTotalCompressedMessageSizeInstrumentName),
-            "Compressed message bytes sent per client call attempt", "By");
+        CreatePerCallUInt64Histogram(
+            *meter,
+            grpc::OpenTelemetryPluginBuilder::
+                kClientAttemptSentTotalCompressedMessageSizeInstrumentName,
+            "Compressed message bytes sent per client call attempt", "By",
+            size_bounds);
   }
   if (metrics.contains(
           grpc::OpenTelemetryPluginBuilder::
               kClientAttemptRcvdTotalCompressedMessageSizeInstrumentName)) {
     client_.attempt.rcvd_total_compressed_message_size =
-        meter->CreateUInt64Histogram(
-            std::string(
-                grpc::OpenTelemetryPluginBuilder::
-                    kClientAttemptRcvdTotalCompressedMessageSizeInstrumentName),
-            "Compressed message bytes received per call attempt", "By");
+        CreatePerCallUInt64Histogram(
+            *meter,
+            grpc::OpenTelemetryPluginBuilder::
+                kClientAttemptRcvdTotalCompressedMessageSizeInstrumentName,
+            "Compressed message bytes received per call attempt", "By",
+            size_bounds);
+  }
+  if (metrics.contains(grpc::OpenTelemetryPluginBuilder::
+                           kClientAttemptTcpQueueDurationInstrumentName)) {
+    client_.attempt.tcp_queue_duration = CreatePerCallDoubleHistogram(
+        *meter,
+        grpc::OpenTelemetryPluginBuilder::
+            kClientAttemptTcpQueueDurationInstrumentName,
+        "Time from the start of a client send batch until its bytes were "
+        "passed to sendmsg",
+        "s", latency_bounds);
+  }
+  if (metrics.contains(grpc::OpenTelemetryPluginBuilder::
+                           kClientAttemptTcpKernelDurationInstrumentName)) {
+    client_.attempt.tcp_kernel_duration = CreatePerCallDoubleHistogram(
+        *meter,
+        grpc::OpenTelemetryPluginBuilder::
+            kClientAttemptTcpKernelDurationInstrumentName,
+        "Time from sendmsg until the bytes of a client call attempt were "
+        "handed to the NIC",
+        "s", latency_bounds);
+  }
+  if (metrics.contains(grpc::OpenTelemetryPluginBuilder::
+                           kClientAttemptTcpWireDurationInstrumentName)) {
+    client_.attempt.tcp_wire_duration = CreatePerCallDoubleHistogram(
+        *meter,
+        grpc::OpenTelemetryPluginBuilder::
+            kClientAttemptTcpWireDurationInstrumentName,
+        "Time from the NIC until the bytes of a client call attempt were "
+        "acknowledged by the peer",
+        "s", latency_bounds);
   }
   if (metrics.contains(
           grpc::OpenTelemetryPluginBuilder::kServerCallStartedInstrumentName)) {
-    server_.call.started = meter->CreateUInt64Counter(
-        std::string(
-            grpc::OpenTelemetryPluginBuilder::kServerCallStartedInstrumentName),
-        "Number of server calls started", "{call}");
+    server_.call.started = CreatePerCallCounter(
+        *meter,
+        grpc::OpenTelemetryPluginBuilder::kServerCallStartedInstrumentName,
+        "Number of server calls started", "{call}",
+        pre_aggregate_per_call_metrics);
   }
   if (metrics.contains(grpc::OpenTelemetryPluginBuilder::
                            kServerCallDurationInstrumentName)) {
-    server_.call.duration = meter->CreateDoubleHistogram(
-        std::string(grpc::OpenTelemetryPluginBuilder::
-                        kServerCallDurationInstrumentName),
+    server_.call.duration = CreatePerCallDoubleHistogram(
+        *meter,
+        grpc::OpenTelemetryPluginBuilder::kServerCallDurationInstrumentName,
         "End-to-end time taken to complete a call from server transport's "
         "perspective",
-        "s");
+        "s", latency_bounds);
   }
   if (metrics.contains(
           grpc::OpenTelemetryPluginBuilder::
               kServerCallSentTotalCompressedMessageSizeInstrumentName)) {
     server_.call.sent_total_compressed_message_size =
-        meter->CreateUInt64Histogram(
-            std::string(
-                grpc::OpenTelemetryPluginBuilder::
-                    kServerCallSentTotalCompressedMessageSizeInstrumentName),
-            "Compressed message bytes sent per server call", "By");
+        CreatePerCallUInt64Histogram(
+            *meter,
+            grpc::OpenTelemetryPluginBuilder::
+                kServerCallSentTotalCompressedMessageSizeInstrumentName,
+            "Compressed message bytes sent per server call", "By",
+            size_bounds);
   }
   if (metrics.contains(
           grpc::OpenTelemetryPluginBuilder::
               kServerCallRcvdTotalCompressedMessageSizeInstrumentName)) {
     server_.call.rcvd_total_compressed_message_size =
-        meter->CreateUInt64Histogram(
-            std::string(
-                grpc::OpenTelemetryPluginBuilder::
-                    kServerCallRcvdTotalCompressedMessageSizeInstrumentName),
-            "Compressed message bytes received per server call", "By");
+        CreatePerCallUInt64Histogram(
+            *meter,
+            grpc::OpenTelemetryPluginBuilder::
+                kServerCallRcvdTotalCompressedMessageSizeInstrumentName,
+            "Compressed message bytes received per server call", "By",
+            size_bounds);
   }
   // Store optional label keys for per call metrics
   CHECK(static_cast<size_t>(grpc_core::ClientCallTracer::CallAttemptTracer::
@@ -984,6 +1034,12 @@ constexpr absl::string_view OpenTelemetryPluginBuilder::
     kClientAttemptSentTotalCompressedMessageSizeInstrumentName;
 constexpr absl::string_view OpenTelemetryPluginBuilder::
     kClientAttemptRcvdTotalCompressedMessageSizeInstrumentName;
+constexpr absl::string_view
+    OpenTelemetryPluginBuilder::kClientAttemptTcpQueueDurationInstrumentName;
+constexpr absl::string_view
+    OpenTelemetryPluginBuilder::kClientAttemptTcpKernelDurationInstrumentName;
+constexpr absl::string_view
+    OpenTelemetryPluginBuilder::kClientAttemptTcpWireDurationInstrumentName;
 constexpr absl::string_view
     OpenTelemetryPluginBuilder::kServerCallStartedInstrumentName;
 constexpr absl::string_view
@@ -1064,6 +1120,12 @@ OpenTelemetryPluginBuilder& OpenTelemetryPluginBuilder::SetChannelScopeFilter(
   return *this;
 }
 
+OpenTelemetryPluginBuilder&
+OpenTelemetryPluginBuilder::EnablePerCallMetricsPreAggregation(bool enable) {
+  impl_->EnablePerCallMetricsPreAggregation(enable);
+  return *this;
+}
+
 absl::Status OpenTelemetryPluginBuilder::BuildAndRegisterGlobal() {
   return impl_->BuildAndRegisterGlobal();
 }
@@ -45,6 +45,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/transport/metadata_batch.h"
 #include "src/core/telemetry/metrics.h"
+#include "src/cpp/ext/otel/preaggregated_metrics.h"
 
 namespace grpc {
 namespace internal {
@@ -176,6 +177,11 @@ class OpenTelemetryPluginBuilderImpl {
       absl::AnyInvocable<
           bool(const OpenTelemetryPluginBuilder::ChannelScope& /*scope*/) const>
           channel_scope_filter);
+  // If enabled, the per-call metrics are aggregated by gRPC and reported
+  // through observable instruments. See
+  // OpenTelemetryPluginBuilder::EnablePerCallMetricsPreAggregation().
+  OpenTelemetryPluginBuilderImpl& EnablePerCallMetricsPreAggregation(
+      bool enable);
   absl::Status BuildAndRegisterGlobal();
   absl::StatusOr<std::shared_ptr<grpc::experimental::OpenTelemetryPlugin>>
   Build();
@@ -200,6 +206,7 @@ class OpenTelemetryPluginBuilderImpl {
   absl::AnyInvocable<bool(
       const OpenTelemetryPluginBuilder::ChannelScope& /*scope*/) const>
       channel_scope_filter_;
+  bool pre_aggregate_per_call_metrics_ = false;
 };
 
 class OpenTelemetryPluginImpl
@@ -222,7 +229,8 @@ class OpenTelemetryPluginImpl
       const std::set<absl::string_view>& optional_label_keys,
       absl::AnyInvocable<
           bool(const OpenTelemetryPluginBuilder::ChannelScope& /*scope*/) const>
-          channel_scope_filter);
+          channel_scope_filter,
+      bool pre_aggregate_per_call_metrics = false);
 
  private:
   class ClientCallTracer;
@@ -323,21 +331,24 @@ class OpenTelemetryPluginImpl
 
   struct ClientMetrics {
     struct Attempt {
-      std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> started;
-      std::unique_ptr<opentelemetry::metrics::Histogram<double>> duration;
-      std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>>
+      std::unique_ptr<PerCallCounter> started;
+      std::unique_ptr<PerCallHistogram<double>> duration;
+      std::unique_ptr<PerCallHistogram<uint64_t>>
           sent_total_compressed_message_size;
-      std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>>
+      std::unique_ptr<PerCallHistogram<uint64_t>>
           rcvd_total_compressed_message_size;
+      std::unique_ptr<PerCallHistogram<double>> tcp_queue_duration;
+      std::unique_ptr<PerCallHistogram<double>> tcp_kernel_duration;
+      std::unique_ptr<PerCallHistogram<double>> tcp_wire_duration;
     } attempt;
   };
   struct ServerMetrics {
     struct Call {
-      std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> started;
-      std::unique_ptr<opentelemetry::metrics::Histogram<double>> duration;
-      std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>>
+      std::unique_ptr<PerCallCounter> started;
+      std::unique_ptr<PerCallHistogram<double>> duration;
+      std::unique_ptr<PerCallHistogram<uint64_t>>
           sent_total_compressed_message_size;
-      std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>>
+      std::unique_ptr<PerCallHistogram<uint64_t>>
           rcvd_total_compressed_message_size;
     } call;
   };
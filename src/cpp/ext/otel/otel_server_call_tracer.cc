@@ -30,8 +30,6 @@
 #include "absl/time/time.h"
 #include "absl/types/optional.h"
 #include "absl/types/span.h"
-#include "opentelemetry/context/context.h"
-#include "opentelemetry/metrics/sync_instruments.h"
 
 #include <grpc/support/port_platform.h>
 
@@ -118,8 +116,7 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordEnd(
       /*is_client=*/false, otel_plugin_);
   if (otel_plugin_->server_.call.duration != nullptr) {
     otel_plugin_->server_.call.duration->Record(
-        absl::ToDoubleSeconds(elapsed_time_), labels,
-        opentelemetry::context::Context{});
+        absl::ToDoubleSeconds(elapsed_time_), labels);
   }
   if (otel_plugin_->server_.call.sent_total_compressed_message_size !=
       nullptr) {
@@ -127,7 +124,7 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordEnd(
         grpc_core::IsCallTracerInTransportEnabled()
             ? outgoing_bytes_.load()
             : final_info->stats.transport_stream_stats.outgoing.data_bytes,
-        labels, opentelemetry::context::Context{});
+        labels);
   }
   if (otel_plugin_->server_.call.rcvd_total_compressed_message_size !=
       nullptr) {
@@ -135,7 +132,7 @@ void OpenTelemetryPluginImpl::ServerCallTracer::RecordEnd(
         grpc_core::IsCallTracerInTransportEnabled()
             ? incoming_bytes_.load()
             : final_info->stats.transport_stream_stats.incoming.data_bytes,
-        labels, opentelemetry::context::Context{});
+        labels);
   }
 }
 
@@ -68,13 +68,17 @@ class OpenTelemetryPluginImpl::ServerCallTracer
       grpc_metadata_batch* /*send_trailing_metadata*/) override;
 
   void RecordSendMessage(const grpc_core::SliceBuffer& send_message) override {
-    RecordAnnotation(
-        absl::StrFormat("Send message: %ld bytes", send_message.Length()));
+    RecordLazyAnnotation([&]() {
+      return absl::StrFormat("Send message: %ld bytes",
+                             send_message.Length());
+    });
   }
   void RecordSendCompressedMessage(
       const grpc_core::SliceBuffer& send_compressed_message) override {
-    RecordAnnotation(absl::StrFormat("Send compressed message: %ld bytes",
-                                     send_compressed_message.Length()));
+    RecordLazyAnnotation([&]() {
+      return absl::StrFormat("Send compressed message: %ld bytes",
+                             send_compressed_message.Length());
+    });
   }
 
   void RecordReceivedInitialMetadata(
@@ -82,13 +86,17 @@ class OpenTelemetryPluginImpl::ServerCallTracer
 
   void RecordReceivedMessage(
       const grpc_core::SliceBuffer& recv_message) override {
-    RecordAnnotation(
-        absl::StrFormat("Received message: %ld bytes", recv_message.Length()));
+    RecordLazyAnnotation([&]() {
+      return absl::StrFormat("Received message: %ld bytes",
+                             recv_message.Length());
+    });
   }
   void RecordReceivedDecompressedMessage(
       const grpc_core::SliceBuffer& recv_decompressed_message) override {
-    RecordAnnotation(absl::StrFormat("Received decompressed message: %ld bytes",
-                                     recv_decompressed_message.Length()));
+    RecordLazyAnnotation([&]() {
+      return absl::StrFormat("Received decompressed message: %ld bytes",
+                             recv_decompressed_message.Length());
+    });
   }
 
   void RecordReceivedTrailingMetadata(
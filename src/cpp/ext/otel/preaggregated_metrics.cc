@@ -0,0 +1,408 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/cpp/ext/otel/preaggregated_metrics.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/strings/str_cat.h"
+#include "opentelemetry/context/context.h"
+#include "opentelemetry/metrics/async_instruments.h"
+#include "opentelemetry/metrics/observer_result.h"
+#include "opentelemetry/metrics/sync_instruments.h"
+#include "opentelemetry/nostd/shared_ptr.h"
+#include "opentelemetry/nostd/string_view.h"
+#include "opentelemetry/nostd/variant.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/cpp/ext/otel/key_value_iterable.h"
+
+namespace grpc {
+namespace internal {
+
+namespace {
+
+// An attribute set is encoded as the concatenation of its keys and values,
+// each prefixed by its length.
+void AppendEncoded(absl::string_view str, std::string* out) {
+  const uint32_t size = static_cast<uint32_t>(str.size());
+  out->append(reinterpret_cast<const char*>(&size), sizeof(size));
+  out->append(str.data(), str.size());
+}
+
+absl::string_view ConsumeEncoded(absl::string_view* in) {
+  uint32_t size;
+  memcpy(&size, in->data(), sizeof(size));
+  absl::string_view str = in->substr(sizeof(size), size);
+  in->remove_prefix(sizeof(size) + size);
+  return str;
+}
+
+void AtomicAdd(std::atomic<double>* sum, double value) {
+  double current = sum->load(std::memory_order_relaxed);
+  while (!sum->compare_exchange_weak(current, current + value,
+                                     std::memory_order_relaxed)) {
+  }
+}
+
+template <typename T>
+void ObserveValue(opentelemetry::metrics::ObserverResult& result, T value,
+                  const opentelemetry::common::KeyValueIterable& attributes) {
+  opentelemetry::nostd::get<opentelemetry::nostd::shared_ptr<
+      opentelemetry::metrics::ObserverResultT<T>>>(result)
+      ->Observe(value, attributes);
+}
+
+//
+// Instruments forwarding to the OpenTelemetry SDK
+//
+
+class SdkCounter final : public PerCallCounter {
+ public:
+  explicit SdkCounter(
+      std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> counter)
+      : counter_(std::move(counter)) {}
+
+  void Add(uint64_t value,
+           const opentelemetry::common::KeyValueIterable& attributes) override {
+    counter_->Add(value, attributes);
+  }
+
+ private:
+  std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> counter_;
+};
+
+template <typename T>
+class SdkHistogram final : public PerCallHistogram<T> {
+ public:
+  explicit SdkHistogram(
+      std::unique_ptr<opentelemetry::metrics::Histogram<T>> histogram)
+      : histogram_(std::move(histogram)) {}
+
+  void Record(
+      T value,
+      const opentelemetry::common::KeyValueIterable& attributes) override {
+    histogram_->Record(value, attributes, opentelemetry::context::Context{});
+  }
+
+ private:
+  std::unique_ptr<opentelemetry::metrics::Histogram<T>> histogram_;
+};
+
+//
+// Pre-aggregated instruments
+//
+
+// Reports the totals of a PreAggregatedMetric to an observable counter.
+// OpenTelemetry calls Observe() with its observable registry's lock held, and
+// RemoveCallback() takes that lock, so the callback is not running anymore
+// once the exporter is destroyed.
+class PreAggregatedExporter {
+ public:
+  enum class Kind { kCount, kSum, kBuckets };
+
+  PreAggregatedExporter(
+      PreAggregatedMetric* metric, Kind kind,
+      opentelemetry::nostd::shared_ptr<
+          opentelemetry::metrics::ObservableInstrument>
+          instrument)
+      : metric_(metric), kind_(kind), instrument_(std::move(instrument)) {
+    instrument_->AddCallback(&PreAggregatedExporter::Observe, this);
+  }
+
+  ~PreAggregatedExporter() {
+    instrument_->RemoveCallback(&PreAggregatedExporter::Observe, this);
+  }
+
+  PreAggregatedExporter(const PreAggregatedExporter&) = delete;
+  PreAggregatedExporter& operator=(const PreAggregatedExporter&) = delete;
+
+ private:
+  static void Observe(opentelemetry::metrics::ObserverResult result,
+                      void* arg) {
+    auto* self = static_cast<PreAggregatedExporter*>(arg);
+    const auto& bounds = self->metric_->bounds();
+    for (const auto& entry : self->metric_->Collect()) {
+      const PreAggregatedMetric::Totals& totals = entry.second;
+      switch (self->kind_) {
+        case Kind::kCount:
+          ObserveValue<int64_t>(
+              result, static_cast<int64_t>(totals.count),
+              PreAggregatedMetric::DecodedAttributes(entry.first));
+          break;
+        case Kind::kSum:
+          ObserveValue<double>(
+              result, totals.sum,
+              PreAggregatedMetric::DecodedAttributes(entry.first));
+          break;
+        case Kind::kBuckets: {
+          uint64_t cumulative = 0;
+          for (size_t i = 0; i < totals.buckets.size(); ++i) {
+            cumulative += totals.buckets[i];
+            const std::string le =
+                i < bounds.size() ? absl::StrCat(bounds[i]) : "+Inf";
+            ObserveValue<int64_t>(
+                result, static_cast<int64_t>(cumulative),
+                PreAggregatedMetric::DecodedAttributes(
+                    entry.first, std::make_pair(absl::string_view("le"),
+                                                   absl::string_view(le))));
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  PreAggregatedMetric* const metric_;
+  const Kind kind_;
+  const opentelemetry::nostd::shared_ptr<
+      opentelemetry::metrics::ObservableInstrument>
+      instrument_;
+};
+
+class PreAggregatedCounter final : public PerCallCounter {
+ public:
+  PreAggregatedCounter(opentelemetry::metrics::Meter& meter,
+                       absl::string_view name, absl::string_view description,
+                       absl::string_view unit)
+      : exporter_(&metric_, PreAggregatedExporter::Kind::kCount,
+                  meter.CreateInt64ObservableCounter(std::string(name),
+                                                     std::string(description),
+                                                     std::string(unit))) {}
+
+  void Add(uint64_t value,
+           const opentelemetry::common::KeyValueIterable& attributes) override {
+    metric_.Add(value, attributes);
+  }
+
+ private:
+  PreAggregatedMetric metric_;
+  PreAggregatedExporter exporter_;
+};
+
+template <typename T>
+class PreAggregatedHistogram final : public PerCallHistogram<T> {
+ public:
+  PreAggregatedHistogram(opentelemetry::metrics::Meter& meter,
+                         absl::string_view name, absl::string_view description,
+                         absl::string_view unit, std::vector<double> bounds)
+      : metric_(std::move(bounds)),
+        count_exporter_(&metric_, PreAggregatedExporter::Kind::kCount,
+                        meter.CreateInt64ObservableCounter(
+                            absl::StrCat(name, ".count"),
+                            std::string(description), "{count}")),
+        sum_exporter_(&metric_, PreAggregatedExporter::Kind::kSum,
+                      meter.CreateDoubleObservableCounter(
+                          absl::StrCat(name, ".sum"),
+                          std::string(description), std::string(unit))),
+        bucket_exporter_(&metric_, PreAggregatedExporter::Kind::kBuckets,
+                         meter.CreateInt64ObservableCounter(
+                             absl::StrCat(name, ".bucket"),
+                             std::string(description), "{count}")) {}
+
+  void Record(
+      T value,
+      const opentelemetry::common::KeyValueIterable& attributes) override {
+    metric_.Record(static_cast<double>(value), attributes);
+  }
+
+ private:
+  PreAggregatedMetric metric_;
+  PreAggregatedExporter count_exporter_;
+  PreAggregatedExporter sum_exporter_;
+  PreAggregatedExporter bucket_exporter_;
+};
+
+}  // namespace
+
+//
+// PreAggregatedMetric
+//
+
+PreAggregatedMetric::PreAggregatedMetric(std::vector<double> bounds)
+    : bounds_(std::move(bounds)) {}
+
+PreAggregatedMetric::Cell* PreAggregatedMetric::GetCell(
+    const opentelemetry::common::KeyValueIterable& attributes) {
+  // Reused across calls to avoid allocating in the common case.
+  thread_local std::string key;
+  key.clear();
+  attributes.ForEachKeyValue(
+      [](opentelemetry::nostd::string_view attribute_key,
+         opentelemetry::common::AttributeValue value) {
+        // All the attributes recorded by gRPC are strings.
+        if (!opentelemetry::nostd::holds_alternative<
+                opentelemetry::nostd::string_view>(value)) {
+          return true;
+        }
+        auto attribute_value =
+            opentelemetry::nostd::get<opentelemetry::nostd::string_view>(
+                value);
+        AppendEncoded(
+            absl::string_view(attribute_key.data(), attribute_key.size()),
+            &key);
+        AppendEncoded(
+            absl::string_view(attribute_value.data(), attribute_value.size()),
+            &key);
+        return true;
+      });
+  Shard& shard = shards_.this_cpu();
+  grpc_core::MutexLock lock(&shard.mu);
+  auto it = shard.cells.find(absl::string_view(key));
+  if (it == shard.cells.end()) {
+    it = shard.cells
+             .emplace(key, std::make_unique<Cell>(
+                               bounds_.empty() ? 0 : bounds_.size() + 1))
+             .first;
+  }
+  // Cells are never removed, so the pointer stays valid after unlocking.
+  return it->second.get();
+}
+
+void PreAggregatedMetric::Add(
+    uint64_t value, const opentelemetry::common::KeyValueIterable& attributes) {
+  GetCell(attributes)->count.fetch_add(value, std::memory_order_relaxed);
+}
+
+void PreAggregatedMetric::Record(
+    double value, const opentelemetry::common::KeyValueIterable& attributes) {
+  Cell* cell = GetCell(attributes);
+  cell->count.fetch_add(1, std::memory_order_relaxed);
+  AtomicAdd(&cell->sum, value);
+  const size_t bucket =
+      std::lower_bound(bounds_.begin(), bounds_.end(), value) -
+      bounds_.begin();
+  cell->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+absl::flat_hash_map<std::string, PreAggregatedMetric::Totals>
+PreAggregatedMetric::Collect() {
+  absl::flat_hash_map<std::string, Totals> totals;
+  for (Shard& shard : shards_) {
+    grpc_core::MutexLock lock(&shard.mu);
+    for (const auto& entry : shard.cells) {
+      const Cell& cell = *entry.second;
+      Totals& t = totals[entry.first];
+      t.count += cell.count.load(std::memory_order_relaxed);
+      t.sum += cell.sum.load(std::memory_order_relaxed);
+      t.buckets.resize(cell.buckets.size());
+      for (size_t i = 0; i < cell.buckets.size(); ++i) {
+        t.buckets[i] += cell.buckets[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+  return totals;
+}
+
+bool PreAggregatedMetric::DecodedAttributes::ForEachKeyValue(
+    opentelemetry::nostd::function_ref<
+        bool(opentelemetry::nostd::string_view,
+             opentelemetry::common::AttributeValue)>
+        callback) const noexcept {
+  absl::string_view encoded = encoded_;
+  while (!encoded.empty()) {
+    absl::string_view key = ConsumeEncoded(&encoded);
+    absl::string_view value = ConsumeEncoded(&encoded);
+    if (!callback(AbslStrViewToOpenTelemetryStrView(key),
+                  AbslStrViewToOpenTelemetryStrView(value))) {
+      return false;
+    }
+  }
+  if (extra_attribute_.has_value()) {
+    return callback(
+        AbslStrViewToOpenTelemetryStrView(extra_attribute_->first),
+        AbslStrViewToOpenTelemetryStrView(extra_attribute_->second));
+  }
+  return true;
+}
+
+size_t PreAggregatedMetric::DecodedAttributes::size() const noexcept {
+  size_t size = extra_attribute_.has_value() ? 1 : 0;
+  absl::string_view encoded = encoded_;
+  while (!encoded.empty()) {
+    ConsumeEncoded(&encoded);
+    ConsumeEncoded(&encoded);
+    ++size;
+  }
+  return size;
+}
+
+//
+// Factories
+//
+
+const std::vector<double>& PreAggregatedLatencyBounds() {
+  static const auto* const kBounds = new std::vector<double>{
+      0,     0.00001, 0.00005, 0.0001, 0.0003, 0.0006, 0.0008, 0.001, 0.002,
+      0.003, 0.004,   0.005,   0.006,  0.008,  0.01,   0.013,  0.016, 0.02,
+      0.025, 0.03,    0.04,    0.05,   0.065,  0.08,   0.1,    0.13,  0.16,
+      0.2,   0.25,    0.3,     0.4,    0.5,    0.65,   0.8,    1,     2,
+      5,     10,      20,      50,     100};
+  return *kBounds;
+}
+
+const std::vector<double>& PreAggregatedSizeBounds() {
+  static const auto* const kBounds = new std::vector<double>{
+      0,        1024,      2048,      4096,       16384,
+      65536,    262144,    1048576,   4194304,    16777216,
+      67108864, 268435456, 1073741824, 4294967296};
+  return *kBounds;
+}
+
+std::unique_ptr<PerCallCounter> CreatePerCallCounter(
+    opentelemetry::metrics::Meter& meter, absl::string_view name,
+    absl::string_view description, absl::string_view unit,
+    bool pre_aggregate) {
+  if (pre_aggregate) {
+    return std::make_unique<PreAggregatedCounter>(meter, name, description,
+                                                  unit);
+  }
+  return std::make_unique<SdkCounter>(meter.CreateUInt64Counter(
+      std::string(name), std::string(description), std::string(unit)));
+}
+
+std::unique_ptr<PerCallHistogram<double>> CreatePerCallDoubleHistogram(
+    opentelemetry::metrics::Meter& meter, absl::string_view name,
+    absl::string_view description, absl::string_view unit,
+    const std::vector<double>* pre_aggregate_bounds) {
+  if (pre_aggregate_bounds != nullptr) {
+    return std::make_unique<PreAggregatedHistogram<double>>(
+        meter, name, description, unit, *pre_aggregate_bounds);
+  }
+  return std::make_unique<SdkHistogram<double>>(meter.CreateDoubleHistogram(
+      std::string(name), std::string(description), std::string(unit)));
+}
+
+std::unique_ptr<PerCallHistogram<uint64_t>> CreatePerCallUInt64Histogram(
+    opentelemetry::metrics::Meter& meter, absl::string_view name,
+    absl::string_view description, absl::string_view unit,
+    const std::vector<double>* pre_aggregate_bounds) {
+  if (pre_aggregate_bounds != nullptr) {
+    return std::make_unique<PreAggregatedHistogram<uint64_t>>(
+        meter, name, description, unit, *pre_aggregate_bounds);
+  }
+  return std::make_unique<SdkHistogram<uint64_t>>(meter.CreateUInt64Histogram(
+      std::string(name), std::string(description), std::string(unit)));
+}
+
+}  // namespace internal
+}  // namespace grpc
@@ -0,0 +1,175 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CPP_EXT_OTEL_PREAGGREGATED_METRICS_H
+#define GRPC_SRC_CPP_EXT_OTEL_PREAGGREGATED_METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "opentelemetry/common/attribute_value.h"
+#include "opentelemetry/common/key_value_iterable.h"
+#include "opentelemetry/metrics/meter.h"
+#include "opentelemetry/nostd/function_ref.h"
+#include "opentelemetry/nostd/string_view.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc {
+namespace internal {
+
+// Instruments for the per-call metrics. They either forward each value to
+// the OpenTelemetry SDK, or pre-aggregate values inside gRPC (see
+// PreAggregatedMetric).
+class PerCallCounter {
+ public:
+  virtual ~PerCallCounter() = default;
+  virtual void Add(
+      uint64_t value,
+      const opentelemetry::common::KeyValueIterable& attributes) = 0;
+};
+
+template <typename T>
+class PerCallHistogram {
+ public:
+  virtual ~PerCallHistogram() = default;
+  virtual void Record(
+      T value, const opentelemetry::common::KeyValueIterable& attributes) = 0;
+};
+
+// Aggregates the values of a metric inside gRPC, so that recording a value
+// costs a lookup of its attribute set in a per-CPU shard and a few relaxed
+// atomic increments, instead of a call into the OpenTelemetry SDK. Each
+// attribute set is interned once per shard, the first time it is recorded,
+// and its totals are never reset.
+//
+// A counter has no bucket bounds. A histogram with bounds b0 < b1 < ... < bn
+// has the buckets (-inf, b0], (b0, b1], ..., (bn, +inf).
+class PreAggregatedMetric {
+ public:
+  struct Totals {
+    // For a counter, the sum of the values added.
+    uint64_t count = 0;
+    double sum = 0;
+    // Not cumulative.
+    std::vector<uint64_t> buckets;
+  };
+
+  explicit PreAggregatedMetric(std::vector<double> bounds = {});
+
+  void Add(uint64_t value,
+           const opentelemetry::common::KeyValueIterable& attributes);
+  void Record(double value,
+              const opentelemetry::common::KeyValueIterable& attributes);
+
+  // Returns the totals of each attribute set recorded so far, keyed by the
+  // encoding of the attribute set. Use DecodedAttributes to iterate over it.
+  absl::flat_hash_map<std::string, Totals> Collect();
+
+  const std::vector<double>& bounds() const { return bounds_; }
+
+  // Iterates over an attribute set encoded by PreAggregatedMetric, followed
+  // by \a extra_attribute if set.
+  class DecodedAttributes : public opentelemetry::common::KeyValueIterable {
+   public:
+    explicit DecodedAttributes(
+        absl::string_view encoded,
+        absl::optional<std::pair<absl::string_view, absl::string_view>>
+            extra_attribute = absl::nullopt)
+        : encoded_(encoded), extra_attribute_(extra_attribute) {}
+
+    bool ForEachKeyValue(opentelemetry::nostd::function_ref<
+                         bool(opentelemetry::nostd::string_view,
+                              opentelemetry::common::AttributeValue)>
+                             callback) const noexcept override;
+    size_t size() const noexcept override;
+
+   private:
+    absl::string_view encoded_;
+    absl::optional<std::pair<absl::string_view, absl::string_view>>
+        extra_attribute_;
+  };
+
+ private:
+  struct Cell {
+    explicit Cell(size_t num_buckets) : buckets(num_buckets) {}
+    std::atomic<uint64_t> count{0};
+    std::atomic<double> sum{0};
+    std::vector<std::atomic<uint64_t>> buckets;
+  };
+
+  struct Shard {
+    grpc_core::Mutex mu;
+    absl::flat_hash_map<std::string, std::unique_ptr<Cell>> cells
+        ABSL_GUARDED_BY(mu);
+  };
+
+  // Returns the cell of \a attributes in the shard of the current CPU.
+  Cell* GetCell(const opentelemetry::common::KeyValueIterable& attributes);
+
+  const std::vector<double> bounds_;
+  grpc_core::PerCpu<Shard> shards_{
+      grpc_core::PerCpuOptions().SetCpusPerShard(2).SetMaxShards(32)};
+};
+
+// Default bucket bounds for pre-aggregated histograms, following the
+// recommendations of gRFC A66.
+const std::vector<double>& PreAggregatedLatencyBounds();
+const std::vector<double>& PreAggregatedSizeBounds();
+
+// If \a pre_aggregate is set, the counter is exported as an observable
+// counter named \a name.
+std::unique_ptr<PerCallCounter> CreatePerCallCounter(
+    opentelemetry::metrics::Meter& meter, absl::string_view name,
+    absl::string_view description, absl::string_view unit,
+    bool pre_aggregate);
+
+// If \a pre_aggregate_bounds is set, the histogram is pre-aggregated with
+// these buckets. Since OpenTelemetry has no asynchronous histogram
+// instrument, it is then exported as three observable counters:
+//  - `<name>.count`, the number of values recorded;
+//  - `<name>.sum`, the sum of these values;
+//  - `<name>.bucket`, the number of values less than or equal to the bound
+//    in its `le` attribute (the last bucket has `le` "+Inf"), like the
+//    cumulative buckets of Prometheus histograms.
+std::unique_ptr<PerCallHistogram<double>> CreatePerCallDoubleHistogram(
+    opentelemetry::metrics::Meter& meter, absl::string_view name,
+    absl::string_view description, absl::string_view unit,
+    const std::vector<double>* pre_aggregate_bounds);
+std::unique_ptr<PerCallHistogram<uint64_t>> CreatePerCallUInt64Histogram(
+    opentelemetry::metrics::Meter& meter, absl::string_view name,
+    absl::string_view description, absl::string_view unit,
+    const std::vector<double>* pre_aggregate_bounds);
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // GRPC_SRC_CPP_EXT_OTEL_PREAGGREGATED_METRICS_H
@@ -26,6 +26,9 @@
 #if !defined(GRPC_NO_XDS) && !defined(DISABLED_XDS_PROTO_IN_CC)
 #include "src/cpp/server/csds/csds.h"
 #endif  // GRPC_NO_XDS or DISABLED_XDS_PROTO_IN_CC
+#ifdef GRPC_ENABLE_LATENT_SEE
+#include "src/cpp/server/latent_see/latent_see_service.h"
+#endif  // GRPC_ENABLE_LATENT_SEE
 namespace grpc {
 
 namespace {
@@ -42,6 +45,13 @@ void AddAdminServices(ServerBuilder* builder) {
 #if !defined(GRPC_NO_XDS) && !defined(DISABLED_XDS_PROTO_IN_CC)
   builder->RegisterService(g_csds);
 #endif  // GRPC_NO_XDS or DISABLED_XDS_PROTO_IN_CC
+#ifdef GRPC_ENABLE_LATENT_SEE
+  // Created with the first admin server rather than at startup, since it
+  // switches the whole process to continuous recording.
+  static LatentSeeService* latent_see =
+      new LatentSeeService(LatentSeeService::Options());
+  builder->RegisterService(latent_see);
+#endif  // GRPC_ENABLE_LATENT_SEE
 }
 
 }  // namespace grpc
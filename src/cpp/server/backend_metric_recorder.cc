@@ -62,9 +62,10 @@ ServerMetricRecorder::ServerMetricRecorder()
 void ServerMetricRecorder::UpdateBackendMetricDataState(
     std::function<void(BackendMetricData*)> updater) {
   internal::MutexLock lock(&mu_);
-  auto new_state = std::make_shared<BackendMetricDataState>(*metric_state_);
+  auto new_state = std::make_shared<BackendMetricDataState>();
+  new_state->data = metric_state_->data;
   updater(&new_state->data);
-  ++new_state->sequence_number;
+  new_state->sequence_number = metric_state_->sequence_number + 1;
   metric_state_ = std::move(new_state);
 }
 
@@ -372,7 +373,8 @@ BackendMetricData BackendMetricState::GetBackendMetricData() {
   // to CallMetricRecorder takes a higher precedence.
   BackendMetricData data;
   if (server_metric_recorder_ != nullptr) {
-    data = server_metric_recorder_->GetMetrics();
+    server_metric_state_ = server_metric_recorder_->GetMetricsIfChanged();
+    data = server_metric_state_->data;
   }
   // Only overwrite if the value is set i.e. in the valid range.
   const double cpu = cpu_utilization_.load(std::memory_order_relaxed);
@@ -420,4 +422,41 @@ BackendMetricData BackendMetricState::GetBackendMetricData() {
   return data;
 }
 
+bool BackendMetricState::HasCallMetrics() {
+  if (cpu_utilization_.load(std::memory_order_relaxed) != -1 ||
+      mem_utilization_.load(std::memory_order_relaxed) != -1 ||
+      application_utilization_.load(std::memory_order_relaxed) != -1 ||
+      qps_.load(std::memory_order_relaxed) != -1 ||
+      eps_.load(std::memory_order_relaxed) != -1) {
+    return true;
+  }
+  internal::MutexLock lock(&mu_);
+  return !utilization_.empty() || !request_cost_.empty() ||
+         !named_metrics_.empty();
+}
+
+absl::optional<grpc_core::Slice>
+BackendMetricState::GetCachedSerializedMetrics() {
+  if (server_metric_recorder_ == nullptr || HasCallMetrics()) {
+    return absl::nullopt;
+  }
+  server_metric_state_ = server_metric_recorder_->GetMetricsIfChanged();
+  internal::MutexLock lock(&server_metric_state_->mu);
+  if (!server_metric_state_->serialized.has_value()) return absl::nullopt;
+  if (GRPC_TRACE_FLAG_ENABLED(backend_metric)) {
+    LOG(INFO) << "[" << this << "] Reusing serialized backend metrics. seq:"
+              << server_metric_state_->sequence_number;
+  }
+  return server_metric_state_->serialized->Ref();
+}
+
+void BackendMetricState::CacheSerializedMetrics(
+    const grpc_core::Slice& serialized) {
+  if (server_metric_state_ == nullptr || HasCallMetrics()) return;
+  internal::MutexLock lock(&server_metric_state_->mu);
+  if (!server_metric_state_->serialized.has_value()) {
+    server_metric_state_->serialized = serialized.Ref();
+  }
+}
+
 }  // namespace grpc
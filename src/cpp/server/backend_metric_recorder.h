@@ -23,9 +23,11 @@
 
 #include <atomic>
 #include <map>
+#include <memory>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 
 #include <grpcpp/ext/call_metric_recorder.h>
 #include <grpcpp/ext/server_metric_recorder.h>
@@ -33,6 +35,7 @@
 #include <grpcpp/support/string_ref.h>
 
 #include "src/core/ext/filters/backend_metrics/backend_metric_provider.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/load_balancing/backend_metric_data.h"
 
 namespace grpc {
@@ -42,6 +45,10 @@ namespace experimental {
 struct ServerMetricRecorder::BackendMetricDataState {
   grpc_core::BackendMetricData data;
   uint64_t sequence_number = 0;
+  // The report serialized from data, for calls that record no metrics of
+  // their own. Set by the first such call.
+  mutable internal::Mutex mu;
+  mutable absl::optional<grpc_core::Slice> serialized ABSL_GUARDED_BY(mu);
 };
 
 }  // namespace experimental
@@ -70,9 +77,19 @@ class BackendMetricState : public grpc_core::BackendMetricProvider,
                                                       double value) override;
   // This clears metrics currently recorded. Don't call twice.
   grpc_core::BackendMetricData GetBackendMetricData() override;
+  // Calls that record no metrics report those of server_metric_recorder_,
+  // which is serialized once per update.
+  absl::optional<grpc_core::Slice> GetCachedSerializedMetrics() override;
+  void CacheSerializedMetrics(const grpc_core::Slice& serialized) override;
 
  private:
+  bool HasCallMetrics();
+
   experimental::ServerMetricRecorder* server_metric_recorder_;
+  // The state of server_metric_recorder_ the metrics were read from.
+  std::shared_ptr<const experimental::ServerMetricRecorder::
+                      BackendMetricDataState>
+      server_metric_state_;
   std::atomic<double> cpu_utilization_{-1.0};
   std::atomic<double> mem_utilization_{-1.0};
   std::atomic<double> application_utilization_{-1.0};
@@ -18,7 +18,6 @@
 
 #include "src/cpp/server/csds/csds.h"
 
-#include <string>
 #include <utility>
 
 #include "absl/status/status.h"
@@ -27,7 +26,6 @@
 #include <grpc/slice.h>
 #include <grpc/support/port_platform.h>
 #include <grpcpp/support/interceptor.h>
-#include <grpcpp/support/slice.h>
 
 namespace grpc {
 namespace xds {
@@ -41,9 +39,13 @@ namespace {
 absl::StatusOr<ClientStatusResponse> DumpClientStatusResponse() {
   ClientStatusResponse response;
   grpc_slice serialized_client_config = grpc_dump_xds_configs();
-  std::string bytes = StringFromCopiedSlice(serialized_client_config);
+  // Parsed in place: the dump can be large enough that another copy of it
+  // matters.
+  bool parsed = response.ParseFromArray(
+      GRPC_SLICE_START_PTR(serialized_client_config),
+      static_cast<int>(GRPC_SLICE_LENGTH(serialized_client_config)));
   grpc_slice_unref(serialized_client_config);
-  if (!response.ParseFromString(bytes)) {
+  if (!parsed) {
     return absl::InternalError("Failed to parse ClientStatusResponse.");
   }
   return response;
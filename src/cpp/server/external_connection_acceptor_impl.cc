@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -40,6 +41,9 @@ class AcceptorWrapper : public experimental::ExternalConnectionAcceptor {
   void HandleNewConnection(NewConnectionParameters* p) override {
     impl_->HandleNewConnection(p);
   }
+  void HandleNewConnections(std::vector<NewConnectionParameters>* p) override {
+    impl_->HandleNewConnections(p);
+  }
 
  private:
   std::shared_ptr<ExternalConnectionAcceptorImpl> impl_;
@@ -78,6 +82,24 @@ void ExternalConnectionAcceptorImpl::HandleNewConnection(
   }
 }
 
+void ExternalConnectionAcceptorImpl::HandleNewConnections(
+    std::vector<
+        experimental::ExternalConnectionAcceptor::NewConnectionParameters>* p) {
+  grpc_core::MutexLock lock(&mu_);
+  if (shutdown_ || !started_) {
+    LOG(ERROR) << "NOT handling " << p->size()
+               << " external connections, started " << started_
+               << ", shutdown " << shutdown_;
+    return;
+  }
+  if (handler_) {
+    for (auto& connection : *p) {
+      handler_->Handle(connection.listener_fd, connection.fd,
+                       connection.read_buffer.c_buffer());
+    }
+  }
+}
+
 void ExternalConnectionAcceptorImpl::Shutdown() {
   grpc_core::MutexLock lock(&mu_);
   shutdown_ = true;
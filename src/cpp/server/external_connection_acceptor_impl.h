@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server_builder.h>
@@ -45,6 +46,12 @@ class ExternalConnectionAcceptorImpl
   void HandleNewConnection(
       experimental::ExternalConnectionAcceptor::NewConnectionParameters* p);
 
+  // Like HandleNewConnection() on each of \a p, taking mu_ once.
+  void HandleNewConnections(
+      std::vector<
+          experimental::ExternalConnectionAcceptor::NewConnectionParameters>*
+          p);
+
   void Shutdown();
 
   void Start();
@@ -0,0 +1,282 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/generic/generic_proxy.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/match.h"
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/status.h>
+#include <grpcpp/support/string_ref.h>
+
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc {
+namespace experimental {
+
+namespace {
+
+CallbackGenericProxyService::Metadata ToMetadata(
+    const std::multimap<string_ref, string_ref>& metadata) {
+  CallbackGenericProxyService::Metadata result;
+  for (const auto& entry : metadata) {
+    result.emplace(std::string(entry.first.data(), entry.first.size()),
+                   std::string(entry.second.data(), entry.second.size()));
+  }
+  return result;
+}
+
+// Pseudo-headers and the metadata reserved to gRPC are recreated by each call.
+bool IsForwarded(const std::string& key) {
+  return !absl::StartsWith(key, ":") && !absl::StartsWith(key, "grpc-");
+}
+
+}  // namespace
+
+// Splices a call to the proxy to a call to the backend. Requests flow from
+// the server side to the backend side, through request_, and responses the
+// other way, through response_: each buffer is only read into again once
+// the message it holds was written to the other side.
+//
+// The backend call is held open while requests may still be forwarded to it,
+// and while a response is being written to the client, so that the backend
+// call only finishes when there is nothing left to start on it. Its status
+// then finishes the server call.
+class CallbackGenericProxyService::Splice {
+ public:
+  Splice(CallbackGenericProxyService* service,
+         GenericCallbackServerContext* context)
+      : service_(service),
+        context_(context),
+        backend_context_(ClientContext::FromCallbackServerContext(*context)),
+        server_(this),
+        backend_(this) {
+    std::string method = context->method();
+    Metadata metadata = ToMetadata(context->client_metadata());
+    if (service_->options_.rewrite_request != nullptr) {
+      service_->options_.rewrite_request(*context, &method, &metadata);
+    }
+    for (const auto& entry : metadata) {
+      if (IsForwarded(entry.first)) {
+        backend_context_->AddMetadata(entry.first, entry.second);
+      }
+    }
+    service_->stub_.PrepareBidiStreamingCall(backend_context_.get(), method,
+                                             StubOptions(), &backend_);
+    // Released once no more requests are forwarded.
+    backend_.AddHold();
+    backend_.StartCall();
+    server_.StartRead(&request_);
+  }
+
+  ServerGenericBidiReactor* server_reactor() { return &server_; }
+
+ private:
+  class ServerSide : public ServerGenericBidiReactor {
+   public:
+    explicit ServerSide(Splice* splice) : splice_(splice) {}
+
+    void OnReadDone(bool ok) override { splice_->OnRequestRead(ok); }
+    void OnWriteDone(bool ok) override { splice_->OnResponseWritten(ok); }
+    void OnCancel() override { splice_->backend_context_->TryCancel(); }
+    void OnDone() override { splice_->Unref(); }
+
+   private:
+    Splice* const splice_;
+  };
+
+  class BackendSide : public ClientBidiReactor<ByteBuffer, ByteBuffer> {
+   public:
+    explicit BackendSide(Splice* splice) : splice_(splice) {}
+
+    void OnReadInitialMetadataDone(bool ok) override {
+      splice_->OnBackendInitialMetadata(ok);
+    }
+    void OnReadDone(bool ok) override { splice_->OnResponseRead(ok); }
+    void OnWriteDone(bool ok) override { splice_->OnRequestWritten(ok); }
+    void OnDone(const Status& status) override {
+      splice_->OnBackendDone(status);
+    }
+
+   private:
+    Splice* const splice_;
+  };
+
+  // What to do next with requests once the lock is released.
+  enum class RequestAction { kNone, kRead, kWrite, kWritesDone, kRelease };
+
+  void OnRequestRead(bool ok) {
+    RequestAction action;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      server_read_pending_ = false;
+      if (requests_released_) return;
+      if (ok) {
+        action = RequestAction::kWrite;
+      } else {
+        // The client half-closed: so does the backend call.
+        action = RequestAction::kWritesDone;
+        requests_released_ = true;
+      }
+    }
+    DoRequestAction(action);
+  }
+
+  void OnRequestWritten(bool ok) {
+    RequestAction action;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      if (!ok || backend_responses_done_) {
+        // The backend call is over: no need to wait for more requests.
+        action = RequestAction::kRelease;
+        requests_released_ = true;
+      } else {
+        action = RequestAction::kRead;
+        server_read_pending_ = true;
+      }
+    }
+    DoRequestAction(action);
+  }
+
+  void DoRequestAction(RequestAction action) {
+    switch (action) {
+      case RequestAction::kNone:
+        break;
+      case RequestAction::kRead:
+        server_.StartRead(&request_);
+        break;
+      case RequestAction::kWrite:
+        backend_.StartWrite(&request_);
+        break;
+      case RequestAction::kWritesDone:
+        backend_.StartWritesDone();
+        backend_.RemoveHold();
+        break;
+      case RequestAction::kRelease:
+        backend_.RemoveHold();
+        break;
+    }
+  }
+
+  void OnBackendInitialMetadata(bool ok) {
+    if (!ok) {
+      // The backend call failed: no responses will come.
+      OnResponseRead(false);
+      return;
+    }
+    Metadata metadata =
+        ToMetadata(backend_context_->GetServerInitialMetadata());
+    if (service_->options_.rewrite_response != nullptr) {
+      service_->options_.rewrite_response(&metadata);
+    }
+    for (const auto& entry : metadata) {
+      if (IsForwarded(entry.first)) {
+        context_->AddInitialMetadata(entry.first, entry.second);
+      }
+    }
+    // Responses are only read now, so that the initial metadata is complete
+    // before the first response is written to the client.
+    backend_.StartRead(&response_);
+  }
+
+  void OnResponseRead(bool ok) {
+    if (ok) {
+      // Released once the response is written.
+      backend_.AddHold();
+      server_.StartWrite(&response_);
+      return;
+    }
+    // The backend is done sending: if the client is not sending anything
+    // either, stop waiting for it so that the backend call can finish.
+    RequestAction action = RequestAction::kNone;
+    {
+      grpc_core::MutexLock lock(&mu_);
+      backend_responses_done_ = true;
+      if (server_read_pending_ && !requests_released_) {
+        action = RequestAction::kRelease;
+        requests_released_ = true;
+      }
+    }
+    DoRequestAction(action);
+  }
+
+  void OnResponseWritten(bool ok) {
+    if (ok) {
+      backend_.StartRead(&response_);
+    } else {
+      backend_context_->TryCancel();
+    }
+    backend_.RemoveHold();
+  }
+
+  void OnBackendDone(const Status& status) {
+    Metadata metadata =
+        ToMetadata(backend_context_->GetServerTrailingMetadata());
+    if (service_->options_.rewrite_response != nullptr) {
+      service_->options_.rewrite_response(&metadata);
+    }
+    for (const auto& entry : metadata) {
+      if (IsForwarded(entry.first)) {
+        context_->AddTrailingMetadata(entry.first, entry.second);
+      }
+    }
+    server_.Finish(status);
+    Unref();
+  }
+
+  // Both sides are done with the splice once they saw their OnDone.
+  void Unref() {
+    if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) delete this;
+  }
+
+  CallbackGenericProxyService* const service_;
+  GenericCallbackServerContext* const context_;
+  const std::unique_ptr<ClientContext> backend_context_;
+  ServerSide server_;
+  BackendSide backend_;
+  ByteBuffer request_;
+  ByteBuffer response_;
+  std::atomic<int> refs_{2};
+  grpc_core::Mutex mu_;
+  // A request is being read from the client.
+  bool server_read_pending_ ABSL_GUARDED_BY(mu_) = true;
+  // No more requests are forwarded to the backend, which is not held anymore
+  // for them.
+  bool requests_released_ ABSL_GUARDED_BY(mu_) = false;
+  // The backend is not sending responses anymore.
+  bool backend_responses_done_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+CallbackGenericProxyService::CallbackGenericProxyService(
+    std::shared_ptr<ChannelInterface> backend, Options options)
+    : stub_(std::move(backend)), options_(std::move(options)) {}
+
+ServerGenericBidiReactor* CallbackGenericProxyService::CreateReactor(
+    GenericCallbackServerContext* context) {
+  return (new Splice(this, context))->server_reactor();
+}
+
+}  // namespace experimental
+}  // namespace grpc
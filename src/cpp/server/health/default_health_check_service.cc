@@ -121,6 +121,8 @@ DefaultHealthCheckService::GetHealthCheckService() {
 
 void DefaultHealthCheckService::ServiceData::SetServingStatus(
     ServingStatus status) {
+  // Watchers are only sent changes of the status.
+  if (status == status_) return;
   status_ = status;
   for (const auto& p : watchers_) {
     p.first->SendHealth(status);
@@ -149,14 +151,20 @@ const char kHealthWatchMethodName[] = "/grpc.health.v1.Health/Watch";
 DefaultHealthCheckService::HealthCheckServiceImpl::HealthCheckServiceImpl(
     DefaultHealthCheckService* database)
     : database_(database) {
+  for (ServingStatus status : {NOT_FOUND, SERVING, NOT_SERVING}) {
+    if (!EncodeResponse(status, &responses_[status])) {
+      LOG(ERROR) << "[HCS " << this << "] could not encode response for "
+                 << "ServingStatus " << status;
+    }
+  }
   // Add Check() method.
   AddMethod(new internal::RpcServiceMethod(
       kHealthCheckMethodName, internal::RpcMethod::NORMAL_RPC, nullptr));
   MarkMethodCallback(
       0, new internal::CallbackUnaryHandler<ByteBuffer, ByteBuffer>(
-             [database](CallbackServerContext* context,
-                        const ByteBuffer* request, ByteBuffer* response) {
-               return HandleCheckRequest(database, context, request, response);
+             [this](CallbackServerContext* context, const ByteBuffer* request,
+                    ByteBuffer* response) {
+               return HandleCheckRequest(this, context, request, response);
              }));
   // Add Watch() method.
   AddMethod(new internal::RpcServiceMethod(
@@ -170,7 +178,7 @@ DefaultHealthCheckService::HealthCheckServiceImpl::HealthCheckServiceImpl(
 
 DefaultHealthCheckService::HealthCheckServiceImpl::~HealthCheckServiceImpl() {
   grpc::internal::MutexLock lock(&mu_);
-  shutdown_ = true;
+  shutdown_.store(true, std::memory_order_relaxed);
   while (num_watches_ > 0) {
     shutdown_condition_.Wait(&mu_);
   }
@@ -178,7 +186,7 @@ DefaultHealthCheckService::HealthCheckServiceImpl::~HealthCheckServiceImpl() {
 
 ServerUnaryReactor*
 DefaultHealthCheckService::HealthCheckServiceImpl::HandleCheckRequest(
-    DefaultHealthCheckService* database, CallbackServerContext* context,
+    HealthCheckServiceImpl* service, CallbackServerContext* context,
     const ByteBuffer* request, ByteBuffer* response) {
   auto* reactor = context->DefaultReactor();
   std::string service_name;
@@ -187,15 +195,18 @@ DefaultHealthCheckService::HealthCheckServiceImpl::HandleCheckRequest(
         Status(StatusCode::INVALID_ARGUMENT, "could not parse request"));
     return reactor;
   }
-  ServingStatus serving_status = database->GetServingStatus(service_name);
+  ServingStatus serving_status =
+      service->database_->GetServingStatus(service_name);
   if (serving_status == NOT_FOUND) {
     reactor->Finish(Status(StatusCode::NOT_FOUND, "service name unknown"));
     return reactor;
   }
-  if (!EncodeResponse(serving_status, response)) {
+  const ByteBuffer* encoded_response = service->GetResponse(serving_status);
+  if (encoded_response == nullptr) {
     reactor->Finish(Status(StatusCode::INTERNAL, "could not encode response"));
     return reactor;
   }
+  *response = *encoded_response;
   reactor->Finish(Status::OK);
   return reactor;
 }
@@ -291,17 +302,14 @@ void DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor::
   // Do nothing if Finish() has already been called.
   if (finish_called_) return;
   // Check if we're shutting down.
-  {
-    grpc::internal::MutexLock lock(&service_->mu_);
-    if (service_->shutdown_) {
-      MaybeFinishLocked(
-          Status(StatusCode::CANCELLED, "not writing due to shutdown"));
-      return;
-    }
+  if (service_->shutdown_.load(std::memory_order_relaxed)) {
+    MaybeFinishLocked(
+        Status(StatusCode::CANCELLED, "not writing due to shutdown"));
+    return;
   }
   // Send response.
-  bool success = EncodeResponse(status, &response_);
-  if (!success) {
+  const ByteBuffer* response = service_->GetResponse(status);
+  if (response == nullptr) {
     MaybeFinishLocked(
         Status(StatusCode::INTERNAL, "could not encode response"));
     return;
@@ -309,14 +317,14 @@ void DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor::
   VLOG(2) << "[HCS " << service_ << "] watcher " << this << " \""
           << service_name_ << "\": starting write for ServingStatus " << status;
   write_pending_ = true;
-  StartWrite(&response_);
+  written_status_ = status;
+  StartWrite(response);
 }
 
 void DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor::
     OnWriteDone(bool ok) {
   VLOG(2) << "[HCS " << service_ << "] watcher " << this << " \""
           << service_name_ << "\": OnWriteDone(): ok=" << ok;
-  response_.Clear();
   grpc::internal::MutexLock lock(&mu_);
   if (!ok) {
     MaybeFinishLocked(Status(StatusCode::CANCELLED, "OnWriteDone() ok=false"));
@@ -324,11 +332,11 @@ void DefaultHealthCheckService::HealthCheckServiceImpl::WatchReactor::
   }
   write_pending_ = false;
   // If we got a new status since we started the last send, start a
-  // new send for it.
+  // new send for it, unless it changed back to the status just sent.
   if (pending_status_ != NOT_FOUND) {
     auto status = pending_status_;
     pending_status_ = NOT_FOUND;
-    SendHealthLocked(status);
+    if (status != written_status_) SendHealthLocked(status);
   }
 }
 
@@ -21,6 +21,8 @@
 
 #include <stddef.h>
 
+#include <array>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -69,11 +71,12 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
 
       HealthCheckServiceImpl* service_;
       std::string service_name_;
-      ByteBuffer response_;
 
       grpc::internal::Mutex mu_;
       bool write_pending_ ABSL_GUARDED_BY(mu_) = false;
       ServingStatus pending_status_ ABSL_GUARDED_BY(mu_) = NOT_FOUND;
+      // The status of the last write started.
+      ServingStatus written_status_ ABSL_GUARDED_BY(mu_) = NOT_FOUND;
       bool finish_called_ ABSL_GUARDED_BY(mu_) = false;
     };
 
@@ -84,7 +87,7 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
    private:
     // Request handler for Check method.
     static ServerUnaryReactor* HandleCheckRequest(
-        DefaultHealthCheckService* database, CallbackServerContext* context,
+        HealthCheckServiceImpl* service, CallbackServerContext* context,
         const ByteBuffer* request, ByteBuffer* response);
 
     // Returns true on success.
@@ -92,11 +95,22 @@ class DefaultHealthCheckService final : public HealthCheckServiceInterface {
                               std::string* service_name);
     static bool EncodeResponse(ServingStatus status, ByteBuffer* response);
 
+    // Returns the response for \a status, or nullptr if it could not be
+    // encoded. The responses are encoded once and shared by all the calls,
+    // which only take a ref to their slices to write them.
+    const ByteBuffer* GetResponse(ServingStatus status) const {
+      const ByteBuffer& response = responses_[status];
+      return response.Valid() ? &response : nullptr;
+    }
+
     DefaultHealthCheckService* database_;
+    std::array<ByteBuffer, 3> responses_;
 
     grpc::internal::Mutex mu_;
     grpc::internal::CondVar shutdown_condition_;
-    bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+    // Only written with mu_ held, but read without it by the watchers about
+    // to write, so that notifying them does not serialize them on mu_.
+    std::atomic<bool> shutdown_{false};
     size_t num_watches_ ABSL_GUARDED_BY(mu_) = 0;
   };
 
@@ -0,0 +1,59 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/cpp/server/latent_see/latent_see_service.h"
+
+#include <chrono>
+
+#include "absl/types/optional.h"
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/util/latent_see.h"
+
+namespace grpc {
+
+LatentSeeService::LatentSeeService(const Options& options) {
+#ifdef GRPC_ENABLE_LATENT_SEE
+  grpc_core::latent_see::Log::RecordContinuously(
+      options.max_events_per_shard, options.flow_sampling_period);
+#else
+  (void)options;
+#endif
+}
+
+Status LatentSeeService::GetTrace(
+    ServerContext* /*unused*/, const latent_see::v1::GetTraceRequest* request,
+    latent_see::v1::GetTraceResponse* response) {
+#ifdef GRPC_ENABLE_LATENT_SEE
+  absl::optional<std::chrono::steady_clock::duration> window;
+  if (request->has_window()) {
+    window = std::chrono::seconds(request->window().seconds()) +
+             std::chrono::nanoseconds(request->window().nanos());
+  }
+  response->set_trace_json(grpc_core::latent_see::Log::CollectJson(window));
+  return Status::OK;
+#else
+  (void)request;
+  (void)response;
+  return Status(StatusCode::UNIMPLEMENTED,
+                "gRPC was built without GRPC_ENABLE_LATENT_SEE");
+#endif
+}
+
+}  // namespace grpc
@@ -0,0 +1,57 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CPP_SERVER_LATENT_SEE_LATENT_SEE_SERVICE_H
+#define GRPC_SRC_CPP_SERVER_LATENT_SEE_LATENT_SEE_SERVICE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <grpc/support/port_platform.h>
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/support/status.h>
+
+#include "src/proto/grpc/latent_see/latent_see.grpc.pb.h"
+
+namespace grpc {
+
+// Serves the latency profile recorded by latent-see, in builds where it is
+// enabled with GRPC_ENABLE_LATENT_SEE.
+class LatentSeeService final : public latent_see::v1::LatentSee::Service {
+ public:
+  struct Options {
+    // Events kept in each per-CPU shard of the log.
+    size_t max_events_per_shard = 64 * 1024;
+    // One in this many flows is recorded.
+    uint32_t flow_sampling_period = 16;
+  };
+
+  // Switches latent-see to recording continuously with \a options (see
+  // grpc_core::latent_see::Log::RecordContinuously()).
+  explicit LatentSeeService(const Options& options);
+
+ private:
+  // implementation of GetTrace rpc
+  Status GetTrace(ServerContext* unused,
+                  const latent_see::v1::GetTraceRequest* request,
+                  latent_see::v1::GetTraceResponse* response) override;
+};
+
+}  // namespace grpc
+
+#endif  // GRPC_SRC_CPP_SERVER_LATENT_SEE_LATENT_SEE_SERVICE_H
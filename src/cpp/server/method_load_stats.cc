@@ -0,0 +1,128 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/cpp/server/method_load_stats.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/support/port_platform.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gprpp/time.h"
+
+namespace grpc {
+namespace internal {
+
+namespace {
+
+constexpr absl::string_view kMetricLabelMethod = "grpc.method";
+
+const auto kMetricConcurrency =
+    grpc_core::GlobalInstrumentsRegistry::RegisterCallbackInt64Gauge(
+        "grpc.server.call.concurrency",
+        "EXPERIMENTAL.  Number of handlers of a method running on a sync or "
+        "callback server.",
+        "{call}", false)
+        .Labels(kMetricLabelMethod)
+        .Build();
+
+const auto kMetricQueueDelay =
+    grpc_core::GlobalInstrumentsRegistry::RegisterDoubleHistogram(
+        "grpc.server.call.queue_delay",
+        "EXPERIMENTAL.  Time between the arrival of a call at a sync or "
+        "callback server and the start of its handler.",
+        "s", false)
+        .Labels(kMetricLabelMethod)
+        .Build();
+
+// Outlives the calls it is reported for, as ORCA requires.
+constexpr char kQueueDelayRequestCostName[] = "grpc.queue_delay";
+
+}  // namespace
+
+void ServerMethodLoadStats::Method::HandlerStarted(
+    gpr_cycle_counter arrival, experimental::CallMetricRecorder* recorder) {
+  shards_.this_cpu().running.fetch_add(1, std::memory_order_relaxed);
+  gpr_timespec delay = gpr_cycle_counter_sub(gpr_get_cycle_counter(), arrival);
+  const double seconds = std::max(
+      0.0, delay.tv_sec + static_cast<double>(delay.tv_nsec) / GPR_NS_PER_SEC);
+  if (stats_->record_queue_delay_) {
+    stats_->stats_plugins_.RecordHistogram(kMetricQueueDelay, seconds,
+                                           {name_}, {});
+  }
+  if (recorder != nullptr && stats_->report_queue_delay_to_orca_) {
+    recorder->RecordRequestCostMetric(kQueueDelayRequestCostName, seconds);
+  }
+}
+
+void ServerMethodLoadStats::Method::HandlerFinished() {
+  shards_.this_cpu().running.fetch_sub(1, std::memory_order_relaxed);
+}
+
+int64_t ServerMethodLoadStats::Method::Concurrency() const {
+  int64_t running = 0;
+  for (const Shard& shard : shards_) {
+    running += shard.running.load(std::memory_order_relaxed);
+  }
+  // Handlers may finish on another CPU than they started on, and a sum that
+  // races with them can be briefly negative.
+  return std::max<int64_t>(running, 0);
+}
+
+ServerMethodLoadStats::ServerMethodLoadStats(
+    const grpc_core::ChannelArgs& args)
+    : stats_plugins_(
+          grpc_core::GlobalStatsPluginRegistry::GetStatsPluginsForServer(
+              args)),
+      record_queue_delay_(
+          stats_plugins_.IsInstrumentEnabled(kMetricQueueDelay)),
+      report_queue_delay_to_orca_(
+          args.GetBool(GRPC_ARG_SERVER_ORCA_QUEUE_DELAY).value_or(false)) {
+  if (stats_plugins_.IsInstrumentEnabled(kMetricConcurrency)) {
+    callback_ = stats_plugins_.RegisterCallback(
+        [this](grpc_core::CallbackMetricReporter& reporter) {
+          ReportConcurrency(reporter);
+        },
+        grpc_core::Duration::Seconds(5), kMetricConcurrency);
+  }
+}
+
+ServerMethodLoadStats::Method* ServerMethodLoadStats::AddMethod(
+    absl::string_view name) {
+  grpc_core::MutexLock lock(&mu_);
+  // A method registered for several hosts is counted once.
+  for (const auto& method : methods_) {
+    if (method->name() == name) return method.get();
+  }
+  methods_.emplace_back(new Method(this, name));
+  return methods_.back().get();
+}
+
+void ServerMethodLoadStats::ReportConcurrency(
+    grpc_core::CallbackMetricReporter& reporter) {
+  grpc_core::MutexLock lock(&mu_);
+  for (const auto& method : methods_) {
+    reporter.Report(kMetricConcurrency, method->Concurrency(), {method->name()},
+                    {});
+  }
+}
+
+}  // namespace internal
+}  // namespace grpc
@@ -0,0 +1,111 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CPP_SERVER_METHOD_LOAD_STATS_H
+#define GRPC_SRC_CPP_SERVER_METHOD_LOAD_STATS_H
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/support/port_platform.h>
+#include <grpcpp/ext/call_metric_recorder.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/telemetry/metrics.h"
+#include "src/core/util/time_precise.h"
+
+namespace grpc {
+namespace internal {
+
+// Per-method load of a sync or callback server: how many handlers of each
+// method are running, and how long calls waited between their arrival at
+// the server and the start of their handler, e.g. for a free thread of the
+// sync server.
+//
+// The number of running handlers is counted in per-CPU storage and exported
+// as the callback gauge grpc.server.call.concurrency, and queue delays are
+// recorded to the histogram grpc.server.call.queue_delay, both labeled with
+// the method. With GRPC_ARG_SERVER_ORCA_QUEUE_DELAY, queue delays are also
+// reported to ORCA as a request cost.
+class ServerMethodLoadStats {
+ public:
+  class Method {
+   public:
+    // Records the start of the handler of a call that arrived at \a arrival,
+    // and reports its queue delay to \a recorder, the ORCA recorder of the
+    // call if it has one, when the server is configured to.
+    void HandlerStarted(gpr_cycle_counter arrival,
+                        experimental::CallMetricRecorder* recorder);
+    void HandlerFinished();
+
+    // Number of handlers of the method running.
+    int64_t Concurrency() const;
+
+    absl::string_view name() const { return name_; }
+
+   private:
+    friend class ServerMethodLoadStats;
+
+    // Alone on its cache line, so that CPUs do not fight over it.
+    struct Shard {
+      std::atomic<int64_t> running{0};
+      uint8_t padding[GPR_CACHELINE_SIZE - sizeof(std::atomic<int64_t>)];
+    };
+
+    Method(ServerMethodLoadStats* stats, absl::string_view name)
+        : stats_(stats), name_(name) {}
+
+    ServerMethodLoadStats* const stats_;
+    const std::string name_;
+    grpc_core::PerCpu<Shard> shards_{
+        grpc_core::PerCpuOptions().SetCpusPerShard(2).SetMaxShards(32)};
+  };
+
+  // \a args are the channel args of the server, which select its stats
+  // plugins.
+  explicit ServerMethodLoadStats(const grpc_core::ChannelArgs& args);
+
+  // Adds a method, or returns it if it was already added. The method lives
+  // as long as this.
+  Method* AddMethod(absl::string_view name);
+
+ private:
+  void ReportConcurrency(grpc_core::CallbackMetricReporter& reporter);
+
+  grpc_core::GlobalStatsPluginRegistry::StatsPluginGroup stats_plugins_;
+  const bool record_queue_delay_;
+  const bool report_queue_delay_to_orca_;
+  grpc_core::Mutex mu_;
+  std::vector<std::unique_ptr<Method>> methods_ ABSL_GUARDED_BY(mu_);
+  // Set only when a stats plugin wants the concurrency of methods.
+  std::unique_ptr<grpc_core::RegisteredMetricCallback> callback_;
+};
+
+}  // namespace internal
+}  // namespace grpc
+
+#endif  // GRPC_SRC_CPP_SERVER_METHOD_LOAD_STATS_H
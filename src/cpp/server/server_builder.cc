@@ -75,6 +75,11 @@ class PassiveListenerOwner final
     return listener_->AcceptConnectedFd(fd);
   }
 
+  std::vector<absl::Status> AcceptConnectedFds(
+      std::vector<ConnectedFd> fds) override {
+    return listener_->AcceptConnectedFds(std::move(fds));
+  }
+
  private:
   std::shared_ptr<PassiveListener> listener_;
 };
@@ -192,6 +197,11 @@ void ServerBuilder::experimental_type::EnableCallMetricRecording(
   builder_->server_metric_recorder_ = server_metric_recorder;
 }
 
+void ServerBuilder::experimental_type::
+    EnableCompletionQueueConnectionAffinity() {
+  builder_->AddChannelArgument(GRPC_ARG_SERVER_CQ_CONNECTION_AFFINITY, 1);
+}
+
 ServerBuilder& ServerBuilder::SetOption(
     std::unique_ptr<ServerBuilderOption> option) {
   options_.push_back(std::move(option));
@@ -41,6 +41,7 @@
 #include <grpc/support/time.h>
 #include <grpcpp/channel.h>
 #include <grpcpp/completion_queue.h>
+#include <grpcpp/ext/server_metric_recorder.h>
 #include <grpcpp/generic/async_generic_service.h>
 #include <grpcpp/health_check_service_interface.h>
 #include <grpcpp/impl/call.h>
@@ -69,15 +70,20 @@
 #include <grpcpp/support/status.h>
 
 #include "src/core/ext/transport/inproc/inproc_transport.h"
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/resource_quota/api.h"
+#include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/completion_queue.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/server/admission_control.h"
 #include "src/core/server/server.h"
 #include "src/cpp/client/create_channel_internal.h"
 #include "src/cpp/server/external_connection_acceptor_impl.h"
 #include "src/cpp/server/health/default_health_check_service.h"
+#include "src/cpp/server/method_load_stats.h"
 #include "src/cpp/thread_manager/thread_manager.h"
 
 namespace grpc {
@@ -375,8 +381,10 @@ class Server::UnimplementedAsyncResponse final
 class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
  public:
   SyncRequest(Server* server, grpc::internal::RpcServiceMethod* method,
+              grpc::internal::ServerMethodLoadStats::Method* load,
               grpc_core::Server::RegisteredCallAllocation* data)
       : SyncRequest(server, method) {
+    load_ = load;
     CommonSetup(data);
     data->deadline = &deadline_;
     data->optional_payload = has_request_payload_ ? &request_payload_ : nullptr;
@@ -468,9 +476,15 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
     global_callbacks_->PreSynchronousRequest(&ctx_->ctx);
     auto* handler = resources_ ? method_->handler()
                                : server_->resource_exhausted_handler_.get();
+    if (load_ != nullptr) {
+      load_->HandlerStarted(grpc_core::Call::FromC(call_)->start_time(),
+                            ctx_->ctx.ExperimentalGetCallMetricRecorder());
+    }
     handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
         &*wrapped_call_, &ctx_->ctx, deserialized_request_, request_status_,
-        nullptr, nullptr));
+        nullptr, nullptr, /*inlined=*/false,
+        resources_ && method_->read_ahead()));
+    if (load_ != nullptr) load_->HandlerFinished();
     global_callbacks_->PostSynchronousRequest(&ctx_->ctx);
 
     cq_.Shutdown();
@@ -518,6 +532,7 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
 
   Server* const server_;
   grpc::internal::RpcServiceMethod* const method_;
+  grpc::internal::ServerMethodLoadStats::Method* load_ = nullptr;
   const bool has_request_payload_;
   grpc_call* call_;
   grpc_call_details* call_details_ = nullptr;
@@ -556,10 +571,12 @@ class Server::CallbackRequest final
   // characteristics of the method being requested. For generic services, method
   // is nullptr since these services don't have pre-defined methods.
   CallbackRequest(Server* server, grpc::internal::RpcServiceMethod* method,
+                  grpc::internal::ServerMethodLoadStats::Method* load,
                   grpc::CompletionQueue* cq,
                   grpc_core::Server::RegisteredCallAllocation* data)
       : server_(server),
         method_(method),
+        load_(load),
         has_request_payload_(method->method_type() ==
                                  grpc::internal::RpcMethod::NORMAL_RPC ||
                              method->method_type() ==
@@ -709,9 +726,19 @@ class Server::CallbackRequest final
       auto* handler = (req_->method_ != nullptr)
                           ? req_->method_->handler()
                           : req_->server_->generic_handler_.get();
+      if (req_->load_ != nullptr) {
+        req_->load_->HandlerStarted(
+            grpc_core::Call::FromC(req_->call_)->start_time(),
+            req_->ctx_->ExperimentalGetCallMetricRecorder());
+      }
       handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
           call_, req_->ctx_, req_->request_, req_->request_status_,
-          req_->handler_data_, [this] { delete req_; }));
+          req_->handler_data_,
+          [this] {
+            if (req_->load_ != nullptr) req_->load_->HandlerFinished();
+            delete req_;
+          },
+          req_->method_ != nullptr && req_->method_->inline_reactions()));
     }
   };
 
@@ -733,6 +760,7 @@ class Server::CallbackRequest final
 
   Server* const server_;
   grpc::internal::RpcServiceMethod* const method_;
+  grpc::internal::ServerMethodLoadStats::Method* const load_ = nullptr;
   const bool has_request_payload_;
   grpc_byte_buffer* request_payload_ = nullptr;
   void* request_ = nullptr;
@@ -830,13 +858,16 @@ class Server::SyncRequestThreadManager : public grpc::ThreadManager {
     sync_req->Run(global_callbacks_, resources);
   }
 
-  void AddSyncMethod(grpc::internal::RpcServiceMethod* method, void* tag) {
+  void AddSyncMethod(grpc::internal::RpcServiceMethod* method,
+                     grpc::internal::ServerMethodLoadStats::Method* load,
+                     void* tag) {
     grpc_core::Server::FromC(server_->server())
-        ->SetRegisteredMethodAllocator(server_cq_->cq(), tag, [this, method] {
-          grpc_core::Server::RegisteredCallAllocation result;
-          new SyncRequest(server_, method, &result);
-          return result;
-        });
+        ->SetRegisteredMethodAllocator(
+            server_cq_->cq(), tag, [this, method, load] {
+              grpc_core::Server::RegisteredCallAllocation result;
+              new SyncRequest(server_, method, load, &result);
+              return result;
+            });
     has_sync_method_ = true;
   }
 
@@ -961,6 +992,8 @@ Server::Server(
       call_metric_recording_enabled_ = channel_args.args[i].value.integer;
     }
   }
+  method_load_stats_ = std::make_unique<grpc::internal::ServerMethodLoadStats>(
+      grpc_core::ChannelArgs::FromC(&channel_args));
   server_ = grpc_server_create(&channel_args, nullptr);
   grpc_server_set_config_fetcher(server_, server_config_fetcher);
 }
@@ -1066,19 +1099,21 @@ bool Server::RegisterService(const std::string* addr, grpc::Service* service) {
       method->set_server_tag(method_registration_tag);
     } else if (method->api_type() ==
                grpc::internal::RpcServiceMethod::ApiType::SYNC) {
+      auto* load = method_load_stats_->AddMethod(method->name());
       for (const auto& value : sync_req_mgrs_) {
-        value->AddSyncMethod(method.get(), method_registration_tag);
+        value->AddSyncMethod(method.get(), load, method_registration_tag);
       }
     } else {
       has_callback_methods_ = true;
       grpc::internal::RpcServiceMethod* method_value = method.get();
+      auto* load = method_load_stats_->AddMethod(method->name());
       grpc::CompletionQueue* cq = CallbackCQ();
       grpc_server_register_completion_queue(server_, cq->cq(), nullptr);
       grpc_core::Server::FromC(server_)->SetRegisteredMethodAllocator(
-          cq->cq(), method_registration_tag, [this, cq, method_value] {
+          cq->cq(), method_registration_tag, [this, cq, method_value, load] {
             grpc_core::Server::RegisteredCallAllocation result;
-            new CallbackRequest<grpc::CallbackServerContext>(this, method_value,
-                                                             cq, &result);
+            new CallbackRequest<grpc::CallbackServerContext>(
+                this, method_value, load, cq, &result);
             return result;
           });
     }
@@ -1208,6 +1243,17 @@ void Server::Start(grpc::ServerCompletionQueue** cqs, size_t num_cqs) {
     unknown_rpc_needed = false;
   }
 
+  // Admission control sheds calls from the same CPU utilization as the one
+  // reported in backend metrics.
+  grpc_core::ServerAdmissionController* admission_controller =
+      grpc_core::Server::FromC(server_)->admission_controller();
+  if (admission_controller != nullptr && server_metric_recorder_ != nullptr) {
+    admission_controller->SetCpuUtilizationSource(
+        [recorder = server_metric_recorder_]() {
+          return recorder->GetMetrics().cpu_utilization;
+        });
+  }
+
   grpc_server_start(server_);
 
   if (unknown_rpc_needed) {
@@ -61,6 +61,7 @@
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/surface/call.h"
+#include "src/core/telemetry/call_phase_timestamps.h"
 #include "src/cpp/server/backend_metric_recorder.h"
 
 namespace grpc {
@@ -417,4 +418,20 @@ grpc::string_ref ServerContextBase::ExperimentalGetAuthority() const {
   return grpc::string_ref(authority.data(), authority.size());
 }
 
+experimental::CallPhaseTimestamps
+ServerContextBase::ExperimentalGetCallPhaseTimestamps() const {
+  experimental::CallPhaseTimestamps timestamps;
+  auto* phases =
+      call_.call == nullptr
+          ? nullptr
+          : grpc_call_get_arena(call_.call)
+                ->GetContext<grpc_core::CallPhaseTimestamps>();
+  if (phases != nullptr) {
+    phases->ExportTo(timestamps);
+  } else {
+    grpc_core::CallPhaseTimestamps::ExportUnsetTo(timestamps);
+  }
+  return timestamps;
+}
+
 }  // namespace grpc
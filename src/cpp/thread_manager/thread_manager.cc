@@ -18,7 +18,9 @@
 
 #include "src/cpp/thread_manager/thread_manager.h"
 
+#include <algorithm>
 #include <climits>
+#include <cmath>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -28,9 +30,25 @@
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 
 namespace grpc {
 
+namespace {
+
+// How long a thread waits in the warm pool to be reused before it exits.
+constexpr absl::Duration kWarmThreadLinger = absl::Seconds(1);
+// Never keep more than this many threads parked in the warm pool.
+constexpr int kMaxWarmThreads = 32;
+// Weight of the newest sample in the arrival and work duration estimates.
+constexpr double kEstimateAlpha = 0.1;
+// Gaps between work items longer than this are treated as this long, so that
+// one idle period does not take long to recover from.
+constexpr double kMaxInterarrivalUs = 1e6;
+
+}  // namespace
+
 ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
     : thd_mgr_(thd_mgr) {
   // Make thread creation exclusive with respect to its join happening in
@@ -47,6 +65,7 @@ ThreadManager::WorkerThread::WorkerThread(ThreadManager* thd_mgr)
 void ThreadManager::WorkerThread::Run() {
   thd_mgr_->MainWorkLoop();
   thd_mgr_->MarkAsCompleted(this);
+  grpc_core::global_stats().IncrementSyncServerThreadsDestroyed();
 }
 
 ThreadManager::WorkerThread::~WorkerThread() {
@@ -84,6 +103,7 @@ void ThreadManager::Wait() {
 void ThreadManager::Shutdown() {
   grpc_core::MutexLock lock(&mu_);
   shutdown_ = true;
+  warm_cv_.SignalAll();
 }
 
 bool ThreadManager::IsShutdown() {
@@ -114,6 +134,45 @@ void ThreadManager::MarkAsCompleted(WorkerThread* thd) {
   thread_quota_->Release(1);
 }
 
+void ThreadManager::RecordArrival() {
+  const absl::Time now = absl::Now();
+  if (last_arrival_ != absl::InfinitePast()) {
+    const double sample = std::min(
+        absl::ToDoubleMicroseconds(now - last_arrival_), kMaxInterarrivalUs);
+    interarrival_us_ += kEstimateAlpha * (sample - interarrival_us_);
+  }
+  last_arrival_ = now;
+}
+
+void ThreadManager::RecordWorkDuration(absl::Duration duration) {
+  const double sample = absl::ToDoubleMicroseconds(duration);
+  work_duration_us_ += kEstimateAlpha * (sample - work_duration_us_);
+}
+
+int ThreadManager::WarmPoolTarget() {
+  if (interarrival_us_ <= 0) return 0;
+  // Little's law: the arrival rate times the time each item spends in DoWork()
+  // is the number of items in DoWork() at once.
+  const double busy = std::ceil(work_duration_us_ / interarrival_us_);
+  return static_cast<int>(std::min<double>(busy, kMaxWarmThreads));
+}
+
+bool ThreadManager::ParkInWarmPool() {
+  num_warm_threads_++;
+  const absl::Time deadline = absl::Now() + kWarmThreadLinger;
+  while (warm_claims_ == 0 && !shutdown_) {
+    if (warm_cv_.WaitWithDeadline(&mu_, deadline)) break;
+  }
+  if (warm_claims_ > 0) {
+    // Whoever claimed a parked thread already took it out of the pool and
+    // counted it as a poller; it does not matter which parked thread answers.
+    warm_claims_--;
+    return true;
+  }
+  num_warm_threads_--;
+  return false;
+}
+
 void ThreadManager::CleanupCompletedThreads() {
   std::list<WorkerThread*> completed_threads;
   {
@@ -144,6 +203,7 @@ void ThreadManager::Initialize() {
     WorkerThread* worker = new WorkerThread(this);
     CHECK(worker->created());  // Must be able to create the minimum
     worker->Start();
+    grpc_core::global_stats().IncrementSyncServerThreadsCreated();
   }
 }
 
@@ -167,12 +227,22 @@ void ThreadManager::MainWorkLoop() {
         // If the thread manager is shutdown, finish this thread
         done = true;
         break;
-      case WORK_FOUND:
-        // If we got work and there are now insufficient pollers and there is
-        // quota available to create a new thread, start a new poller thread
+      case WORK_FOUND: {
+        RecordArrival();
+        // If we got work and there are now insufficient pollers, wake a parked
+        // thread to poll or, if there is none but there is quota available to
+        // create a new thread, start a new poller thread
         bool resource_exhausted = false;
         if (!shutdown_ && num_pollers_ < min_pollers_) {
-          if (thread_quota_->Reserve(1)) {
+          if (num_warm_threads_ > 0) {
+            // The parked thread already holds its thread quota
+            num_warm_threads_--;
+            warm_claims_++;
+            num_pollers_++;
+            warm_cv_.Signal();
+            lock.Release();
+            grpc_core::global_stats().IncrementSyncServerWarmThreadsReused();
+          } else if (thread_quota_->Reserve(1)) {
             // We can allocate a new poller thread
             num_pollers_++;
             num_threads_++;
@@ -184,6 +254,7 @@ void ThreadManager::MainWorkLoop() {
             WorkerThread* worker = new WorkerThread(this);
             if (worker->created()) {
               worker->Start();
+              grpc_core::global_stats().IncrementSyncServerThreadsCreated();
             } else {
               // Get lock again to undo changes to poller/thread counters.
               grpc_core::MutexLock failure_lock(&mu_);
@@ -192,16 +263,20 @@ void ThreadManager::MainWorkLoop() {
               resource_exhausted = true;
               delete worker;
             }
-          } else if (num_pollers_ > 0) {
-            // There is still at least some thread polling, so we can go on
-            // even though we are below the number of pollers that we would
-            // like to have (min_pollers_)
-            lock.Release();
           } else {
-            // There are no pollers to spare and we couldn't allocate
-            // a new thread, so resources are exhausted!
-            lock.Release();
-            resource_exhausted = true;
+            grpc_core::global_stats()
+                .IncrementSyncServerThreadQuotaRejections();
+            if (num_pollers_ > 0) {
+              // There is still at least some thread polling, so we can go on
+              // even though we are below the number of pollers that we would
+              // like to have (min_pollers_)
+              lock.Release();
+            } else {
+              // There are no pollers to spare and we couldn't allocate
+              // a new thread, so resources are exhausted!
+              lock.Release();
+              resource_exhausted = true;
+            }
           }
         } else {
           // There are a sufficient number of pollers available so we can do
@@ -211,12 +286,16 @@ void ThreadManager::MainWorkLoop() {
         // Lock is always released at this point - do the application work
         // or return resource exhausted if there is new work but we couldn't
         // get a thread in which to do it.
+        const absl::Time work_start = absl::Now();
         DoWork(tag, ok, !resource_exhausted);
+        const absl::Duration work_duration = absl::Now() - work_start;
         // Take the lock again to check post conditions
         lock.Lock();
+        RecordWorkDuration(work_duration);
         // If we're shutdown, we should finish at this point.
         if (shutdown_) done = true;
         break;
+      }
     }
     // If we decided to finish the thread, break out of the while loop
     if (done) break;
@@ -248,9 +327,17 @@ void ThreadManager::MainWorkLoop() {
     // pollset mutex) that makes DoWork() take longer to finish thereby causing
     // new poller threads to be created even faster. This results in a thread
     // avalanche.
+    //
+    // A thread that just did some work while the thread manager was busy
+    // enough to expect more parks for a while instead of exiting: the next
+    // dip below min_pollers_ reuses it rather than creating a new thread.
+    // Parked threads do not poll, so they do not add to the avalanche above,
+    // and they only linger for kWarmThreadLinger, which keeps a short lull
+    // from tearing the pool down and building it up again.
     if (num_pollers_ < max_pollers_) {
       num_pollers_++;
-    } else {
+    } else if (work_status != WORK_FOUND || shutdown_ ||
+               num_warm_threads_ >= WarmPoolTarget() || !ParkInWarmPool()) {
       break;
     }
   };
@@ -21,6 +21,8 @@
 
 #include <list>
 
+#include "absl/time/time.h"
+
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/resource_quota/api.h"
@@ -139,13 +141,43 @@ class ThreadManager {
   void MarkAsCompleted(WorkerThread* thd);
   void CleanupCompletedThreads();
 
-  // Protects shutdown_, num_pollers_, num_threads_ and
-  // max_active_threads_sofar_
+  // Folds the arrival of one work item, and the time the previous one took to
+  // process, into the estimates used by WarmPoolTarget().
+  void RecordArrival() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void RecordWorkDuration(absl::Duration duration)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // The number of idle threads worth keeping around instead of exiting: the
+  // number of work items expected to be in DoWork() at any one time, given the
+  // recent arrival rate and work duration.
+  int WarmPoolTarget() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Parks the calling thread, which would otherwise exit, in the warm pool.
+  // Returns true if it was claimed to poll again before its linger time was
+  // up, false if it should exit.
+  bool ParkInWarmPool() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Protects shutdown_, num_pollers_, num_threads_,
+  // max_active_threads_sofar_ and the warm pool
   grpc_core::Mutex mu_;
 
   bool shutdown_;
   grpc_core::CondVar shutdown_cv_;
 
+  // Threads that finished their work when there were already enough pollers
+  // wait here for a while before exiting, so that the next burst of work can
+  // reuse them instead of creating new threads. They keep their thread quota
+  // while parked.
+  grpc_core::CondVar warm_cv_;
+  int num_warm_threads_ = 0;
+  // Number of parked threads that have been asked to go back to polling but
+  // have not woken up yet. Already counted in num_pollers_.
+  int warm_claims_ = 0;
+
+  // Exponentially weighted moving averages of the time between work items and
+  // of the time DoWork() takes, in microseconds.
+  absl::Time last_arrival_ = absl::InfinitePast();
+  double interarrival_us_ = 0;
+  double work_duration_us_ = 0;
+
   // The resource user object to use when requesting quota to create threads
   //
   // Note: The user of this ThreadManager object must create grpc_resource_quota
@@ -17,6 +17,7 @@
 //
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include <grpc/byte_buffer.h>
@@ -24,16 +25,29 @@
 #include <grpc/grpc.h>
 #include <grpc/impl/compression_types.h>
 #include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpcpp/support/byte_buffer.h>
 #include <grpcpp/support/slice.h>
 #include <grpcpp/support/status.h>
 
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/transport/message.h"
+
 namespace grpc {
 
+ByteBuffer::ByteBuffer(const absl::Cord& cord) {
+  grpc_core::SliceBuffer slices;
+  slices.AppendCord(cord);
+  buffer_ = grpc_raw_byte_buffer_create(slices.c_slice_buffer()->slices,
+                                        slices.Count());
+}
+
 Status ByteBuffer::TrySingleSlice(Slice* slice) const {
   if (!buffer_) {
     return Status(StatusCode::FAILED_PRECONDITION, "Buffer not initialized");
   }
+  grpc_core::MessageObject::Materialize(buffer_);
   if ((buffer_->type == GRPC_BB_RAW) &&
       (buffer_->data.raw.compression == GRPC_COMPRESS_NONE) &&
       (buffer_->data.raw.slice_buffer.count == 1)) {
@@ -79,4 +93,87 @@ Status ByteBuffer::Dump(std::vector<Slice>* slices) const {
   return Status::OK;
 }
 
+Status ByteBuffer::DumpToCord(absl::Cord* cord) const {
+  cord->Clear();
+  if (!buffer_) {
+    return Status(StatusCode::FAILED_PRECONDITION, "Buffer not initialized");
+  }
+  grpc_byte_buffer_reader reader;
+  if (!grpc_byte_buffer_reader_init(&reader, buffer_)) {
+    return Status(StatusCode::INTERNAL,
+                  "Couldn't initialize byte buffer reader");
+  }
+  grpc_core::SliceBuffer slices;
+  grpc_slice s;
+  while (grpc_byte_buffer_reader_next(&reader, &s)) {
+    slices.Append(grpc_core::Slice(s));
+  }
+  grpc_byte_buffer_reader_destroy(&reader);
+  *cord = slices.JoinIntoCord();
+  return Status::OK;
+}
+
+namespace internal {
+namespace {
+
+// A message object of the C++ API as core sees it: the object together with
+// the operations of its type.
+struct CppMessageObject {
+  void* object;
+  const MessageObjectOps* ops;
+};
+
+bool SerializeCppMessageObject(void* object, grpc_slice_buffer* out) {
+  auto* cpp_object = static_cast<CppMessageObject*>(object);
+  ByteBuffer buffer;
+  std::vector<Slice> slices;
+  if (!cpp_object->ops->serialize(cpp_object->object, &buffer).ok() ||
+      !buffer.Dump(&slices).ok()) {
+    return false;
+  }
+  for (const Slice& slice : slices) {
+    grpc_slice_buffer_add(out, slice.c_slice());
+  }
+  return true;
+}
+
+void DestroyCppMessageObject(void* object) {
+  auto* cpp_object = static_cast<CppMessageObject*>(object);
+  cpp_object->ops->destroy(cpp_object->object);
+  delete cpp_object;
+}
+
+const grpc_core::MessageObject::Vtable kCppMessageObjectVtable = {
+    SerializeCppMessageObject, DestroyCppMessageObject};
+
+}  // namespace
+
+grpc_byte_buffer* CreateMessageObjectByteBuffer(void* object,
+                                                const MessageObjectOps* ops) {
+  grpc_byte_buffer* buffer = grpc_raw_byte_buffer_create(nullptr, 0);
+  grpc_core::MessageObject(new CppMessageObject{object, ops},
+                           &kCppMessageObjectVtable)
+      .AttachTo(buffer);
+  return buffer;
+}
+
+void* ReleaseMessageObject(grpc_byte_buffer* buffer,
+                           const MessageObjectOps* ops) {
+  grpc_core::MessageObject object =
+      grpc_core::MessageObject::TakeFrom(buffer);
+  if (!object) return nullptr;
+  auto* cpp_object = static_cast<CppMessageObject*>(object.object());
+  if (object.vtable() != &kCppMessageObjectVtable || cpp_object->ops != ops) {
+    // Not of the receiver's type: put it back, to be serialized.
+    std::move(object).AttachTo(buffer);
+    return nullptr;
+  }
+  object.Release();
+  void* released = cpp_object->object;
+  delete cpp_object;
+  return released;
+}
+
+}  // namespace internal
+
 }  // namespace grpc
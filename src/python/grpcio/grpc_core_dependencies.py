@@ -74,6 +74,7 @@ CORE_SOURCE_FILES = [
     'src/core/ext/transport/chttp2/transport/hpack_parser.cc',
     'src/core/ext/transport/chttp2/transport/hpack_parser_table.cc',
     'src/core/ext/transport/chttp2/transport/http2_settings.cc',
+    'src/core/ext/transport/chttp2/transport/keepalive_coordinator.cc',
     'src/core/ext/transport/chttp2/transport/huffsyms.cc',
     'src/core/ext/transport/chttp2/transport/max_concurrent_streams_policy.cc',
     'src/core/ext/transport/chttp2/transport/parsing.cc',
@@ -444,8 +445,10 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/event_engine.cc',
     'src/core/lib/event_engine/forkable.cc',
     'src/core/lib/event_engine/posix_engine/ev_epoll1_linux.cc',
+    'src/core/lib/event_engine/posix_engine/ev_io_uring_linux.cc',
     'src/core/lib/event_engine/posix_engine/ev_poll_posix.cc',
     'src/core/lib/event_engine/posix_engine/event_poller_posix_default.cc',
+    'src/core/lib/event_engine/posix_engine/sharded_event_poller.cc',
     'src/core/lib/event_engine/posix_engine/internal_errqueue.cc',
     'src/core/lib/event_engine/posix_engine/lockfree_event.cc',
     'src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.cc',
@@ -456,6 +459,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/posix_engine/tcp_socket_utils.cc',
     'src/core/lib/event_engine/posix_engine/timer.cc',
     'src/core/lib/event_engine/posix_engine/timer_heap.cc',
+    'src/core/lib/event_engine/posix_engine/timer_wheel.cc',
     'src/core/lib/event_engine/posix_engine/timer_manager.cc',
     'src/core/lib/event_engine/posix_engine/traced_buffer_list.cc',
     'src/core/lib/event_engine/posix_engine/wakeup_fd_eventfd.cc',
@@ -481,6 +485,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/event_engine/windows/windows_engine.cc',
     'src/core/lib/event_engine/windows/windows_listener.cc',
     'src/core/lib/event_engine/work_queue/basic_work_queue.cc',
+    'src/core/lib/event_engine/work_queue/chase_lev_work_queue.cc',
     'src/core/lib/experiments/config.cc',
     'src/core/lib/experiments/experiments.cc',
     'src/core/lib/gprpp/crash.cc',
@@ -491,6 +496,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/gprpp/host_port.cc',
     'src/core/lib/gprpp/linux/env.cc',
     'src/core/lib/gprpp/load_file.cc',
+    'src/core/lib/gprpp/lock_profile.cc',
     'src/core/lib/gprpp/mpscq.cc',
     'src/core/lib/gprpp/per_cpu.cc',
     'src/core/lib/gprpp/posix/directory_reader.cc',
@@ -590,11 +596,14 @@ CORE_SOURCE_FILES = [
     'src/core/lib/matchers/matchers.cc',
     'src/core/lib/promise/activity.cc',
     'src/core/lib/promise/party.cc',
+    'src/core/lib/promise/party_profile.cc',
     'src/core/lib/promise/sleep.cc',
     'src/core/lib/resource_quota/api.cc',
     'src/core/lib/resource_quota/arena.cc',
     'src/core/lib/resource_quota/connection_quota.cc',
+    'src/core/lib/resource_quota/handshake_quota.cc',
     'src/core/lib/resource_quota/memory_quota.cc',
+    'src/core/lib/resource_quota/slab_allocator.cc',
     'src/core/lib/resource_quota/periodic_update.cc',
     'src/core/lib/resource_quota/resource_quota.cc',
     'src/core/lib/resource_quota/thread_quota.cc',
@@ -677,6 +686,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/surface/client_call.cc',
     'src/core/lib/surface/completion_queue.cc',
     'src/core/lib/surface/completion_queue_factory.cc',
+    'src/core/lib/surface/deadline_scheduler.cc',
     'src/core/lib/surface/event_string.cc',
     'src/core/lib/surface/filter_stack_call.cc',
     'src/core/lib/surface/init.cc',
@@ -709,6 +719,7 @@ CORE_SOURCE_FILES = [
     'src/core/load_balancing/address_filtering.cc',
     'src/core/load_balancing/backend_metric_parser.cc',
     'src/core/load_balancing/child_policy_handler.cc',
+    'src/core/load_balancing/deterministic_subsetting/deterministic_subsetting.cc',
     'src/core/load_balancing/endpoint_list.cc',
     'src/core/load_balancing/grpclb/client_load_reporting_filter.cc',
     'src/core/load_balancing/grpclb/grpclb.cc',
@@ -718,10 +729,13 @@ CORE_SOURCE_FILES = [
     'src/core/load_balancing/health_check_client.cc',
     'src/core/load_balancing/lb_policy.cc',
     'src/core/load_balancing/lb_policy_registry.cc',
+    'src/core/load_balancing/latency_aware/latency_aware.cc',
+    'src/core/load_balancing/least_request/least_request.cc',
     'src/core/load_balancing/oob_backend_metric.cc',
     'src/core/load_balancing/outlier_detection/outlier_detection.cc',
     'src/core/load_balancing/pick_first/pick_first.cc',
     'src/core/load_balancing/priority/priority.cc',
+    'src/core/load_balancing/ring_hash/consistent_hash.cc',
     'src/core/load_balancing/ring_hash/ring_hash.cc',
     'src/core/load_balancing/rls/rls.cc',
     'src/core/load_balancing/round_robin/round_robin.cc',
@@ -743,6 +757,7 @@ CORE_SOURCE_FILES = [
     'src/core/resolver/dns/c_ares/grpc_ares_wrapper_posix.cc',
     'src/core/resolver/dns/c_ares/grpc_ares_wrapper_windows.cc',
     'src/core/resolver/dns/dns_resolver_plugin.cc',
+    'src/core/resolver/dns/event_engine/caching_dns_resolver.cc',
     'src/core/resolver/dns/event_engine/event_engine_client_channel_resolver.cc',
     'src/core/resolver/dns/event_engine/service_config_helper.cc',
     'src/core/resolver/dns/native/dns_resolver.cc',
@@ -755,6 +770,8 @@ CORE_SOURCE_FILES = [
     'src/core/resolver/sockaddr/sockaddr_resolver.cc',
     'src/core/resolver/xds/xds_dependency_manager.cc',
     'src/core/resolver/xds/xds_resolver.cc',
+    'src/core/server/admission_control.cc',
+    'src/core/server/drain_scheduler.cc',
     'src/core/server/server.cc',
     'src/core/server/server_call_tracer_filter.cc',
     'src/core/server/server_config_selector_filter.cc',
@@ -790,9 +807,11 @@ CORE_SOURCE_FILES = [
     'src/core/tsi/fake_transport_security.cc',
     'src/core/tsi/local_transport_security.cc',
     'src/core/tsi/ssl/key_logging/ssl_key_logging.cc',
+    'src/core/tsi/ssl/verification_cache/ssl_verification_cache.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
     'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
+    'src/core/tsi/ssl/session_cache/ssl_session_ticket_keys.cc',
     'src/core/tsi/ssl_transport_security.cc',
     'src/core/tsi/ssl_transport_security_utils.cc',
     'src/core/tsi/transport_security.cc',
@@ -169,6 +169,22 @@ BatchBuilder& BatchBuilder::SendMessage(Slice payload, uint32_t flags) {
   return *this;
 }
 
+BatchBuilder& BatchBuilder::SendMessageObject(MessageObject object,
+                                              uint32_t flags) {
+  grpc_op op;
+  memset(&op, 0, sizeof(op));
+  op.op = GRPC_OP_SEND_MESSAGE;
+  grpc_byte_buffer* buffer =
+      Make<ByteBufferUniquePtr>(grpc_raw_byte_buffer_create(nullptr, 0),
+                                grpc_byte_buffer_destroy)
+          .get();
+  std::move(object).AttachTo(buffer);
+  op.data.send_message.send_message = buffer;
+  op.flags = flags;
+  ops_.push_back(op);
+  return *this;
+}
+
 BatchBuilder& BatchBuilder::SendCloseFromClient() {
   grpc_op op;
   memset(&op, 0, sizeof(op));
@@ -19,6 +19,7 @@
 #include "gtest/gtest.h"
 
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/message.h"
 #include "test/core/end2end/cq_verifier.h"
 
 namespace grpc_core {
@@ -182,6 +183,8 @@ class BatchBuilder {
   BatchBuilder& SendMessage(absl::string_view payload, uint32_t flags = 0) {
     return SendMessage(Slice::FromCopiedString(payload), flags);
   }
+  // Add a GRPC_OP_SEND_MESSAGE op carrying \a object rather than bytes.
+  BatchBuilder& SendMessageObject(MessageObject object, uint32_t flags = 0);
 
   // Add a GRPC_OP_SEND_CLOSE_FROM_CLIENT op.
   BatchBuilder& SendCloseFromClient();
@@ -154,6 +154,19 @@ class ShareableObject : public std::enable_shared_from_this<ShareableObject> {
   static absl::string_view ChannelArgName() { return "grpc.test"; }
 };
 
+TEST(ChannelArgsTest, HashIsConsistentWithEquality) {
+  const ChannelArgs a = ChannelArgs().Set("a", 1).Set("b", "foo");
+  const ChannelArgs b = ChannelArgs().Set("b", "foo").Set("a", 1);
+  ASSERT_EQ(a, b);
+  EXPECT_EQ(a.Hash(), b.Hash());
+  EXPECT_NE(a.Hash(), a.Set("a", 2).Hash());
+  EXPECT_NE(a.Hash(), a.Set("b", "bar").Hash());
+  EXPECT_NE(a.Hash(), a.Set("c", 1).Hash());
+  int x = 0;
+  EXPECT_EQ(a.Set("p", ChannelArgs::UnownedPointer(&x)).Hash(),
+            b.Set("p", ChannelArgs::UnownedPointer(&x)).Hash());
+}
+
 TEST(ChannelArgsTest, StoreAndRetrieveSharedPtr) {
   std::shared_ptr<ShareableObject> copied_obj;
   {
@@ -149,6 +149,91 @@ TEST(ChannelStackTest, CreateChannelStack) {
   grpc_slice_unref(path);
 }
 
+static grpc_error_handle multi_filter_channel_init_func(
+    grpc_channel_element* elem, grpc_channel_element_args* /*args*/) {
+  *static_cast<int*>(elem->channel_data) = 0;
+  return absl::OkStatus();
+}
+
+static bool never_active_for_call(grpc_channel_element* /*elem*/,
+                                  const grpc_call_element_args* /*args*/) {
+  return false;
+}
+
+TEST(ChannelStackTest, SkipsFiltersInactiveForCall) {
+  const grpc_channel_filter filter = {
+      call_func,
+      channel_func,
+      sizeof(int),
+      call_init_func,
+      grpc_call_stack_ignore_set_pollset_or_pollset_set,
+      call_destroy_func,
+      sizeof(int),
+      multi_filter_channel_init_func,
+      grpc_channel_stack_no_post_init,
+      channel_destroy_func,
+      grpc_channel_next_get_info,
+      GRPC_UNIQUE_TYPE_NAME_HERE("some_test_filter")};
+  grpc_channel_filter inactive_filter = filter;
+  inactive_filter.is_active_for_call = never_active_for_call;
+  // The first and last filters take part in every call, however they answer.
+  const grpc_channel_filter* filters[] = {&inactive_filter, &inactive_filter,
+                                          &filter, &inactive_filter};
+  grpc_core::ExecCtx exec_ctx;
+  grpc_slice path = grpc_slice_from_static_string("/service/method");
+
+  auto* channel_stack = static_cast<grpc_channel_stack*>(
+      gpr_malloc(grpc_channel_stack_size(filters, 4)));
+  auto channel_args = grpc_core::CoreConfiguration::Get()
+                          .channel_args_preconditioning()
+                          .PreconditionChannelArgs(nullptr);
+  ASSERT_TRUE(GRPC_LOG_IF_ERROR(
+      "grpc_channel_stack_init",
+      grpc_channel_stack_init(1, free_channel, channel_stack, filters, 4,
+                              channel_args, "test", channel_stack)));
+  EXPECT_EQ(channel_stack->count, 4);
+
+  auto* call_stack =
+      static_cast<grpc_call_stack*>(gpr_malloc(channel_stack->call_stack_size));
+  const grpc_call_element_args args = {
+      call_stack,                         // call_stack
+      nullptr,                            // server_transport_data
+      path,                               // path
+      gpr_get_cycle_counter(),            // start_time
+      grpc_core::Timestamp::InfFuture(),  // deadline
+      nullptr,                            // arena
+      nullptr,                            // call_combiner
+  };
+  grpc_error_handle error =
+      grpc_call_stack_init(channel_stack, 1, free_call, call_stack, &args);
+  ASSERT_TRUE(error.ok()) << grpc_core::StatusToString(error);
+  ASSERT_EQ(call_stack->count, 3);
+  for (size_t i = 0; i < 3; ++i) {
+    grpc_channel_element* channel_elem =
+        grpc_channel_stack_element(channel_stack, i == 0 ? 0 : i + 1);
+    EXPECT_EQ(grpc_call_stack_element(call_stack, i)->channel_data,
+              channel_elem->channel_data);
+    EXPECT_EQ(*static_cast<int*>(channel_elem->channel_data), 1);
+  }
+  int* skipped_channel_data = static_cast<int*>(
+      grpc_channel_stack_element(channel_stack, 1)->channel_data);
+  EXPECT_EQ(*skipped_channel_data, 0);
+
+  // Batches go from the first filter straight to the third.
+  grpc_transport_stream_op_batch op;
+  grpc_call_next_op(grpc_call_stack_element(call_stack, 0), &op);
+  EXPECT_EQ(
+      *static_cast<int*>(grpc_call_stack_element(call_stack, 1)->call_data), 1);
+
+  GRPC_CALL_STACK_UNREF(call_stack, "done");
+  grpc_core::ExecCtx::Get()->Flush();
+  EXPECT_EQ(*skipped_channel_data, 0);
+
+  GRPC_CHANNEL_STACK_UNREF(channel_stack, "done");
+
+  grpc_slice_unref(path);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -24,6 +24,7 @@
 #include <string>
 #include <thread>
 
+#include "absl/status/status.h"
 #include "absl/synchronization/notification.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -207,6 +208,26 @@ TEST(ChannelTracerTest, BasicTest) {
       << JsonDump(json);
 }
 
+TEST(ChannelTracerTest, FormatsStructuredEventsWhenRendered) {
+  ExecCtx exec_ctx;
+  ChannelTrace tracer(kEventListMemoryLimit);
+  tracer.AddTraceEvent(ChannelTrace::Severity::Info, "state changed to ",
+                       "READY", absl::OkStatus());
+  tracer.AddTraceEvent(ChannelTrace::Severity::Info, "state changed to ",
+                       "TRANSIENT_FAILURE", absl::UnavailableError("gone"));
+  Json json = tracer.RenderJson();
+  ValidateJsonProtoTranslation(json);
+  EXPECT_THAT(
+      json,
+      IsChannelTrace(
+          2, ::testing::ElementsAre(
+                 IsTraceEvent("state changed to READY", "CT_INFO"),
+                 IsTraceEvent("state changed to TRANSIENT_FAILURE: "
+                              "UNAVAILABLE: gone",
+                              "CT_INFO"))))
+      << JsonDump(json);
+}
+
 // Tests more complex functionality, like a parent channel tracking
 // subchannles. This exercises the ref/unref patterns since the parent tracer
 // and this function will both hold refs to the subchannel.
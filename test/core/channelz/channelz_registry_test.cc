@@ -21,11 +21,16 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <set>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 
 #include "src/core/channelz/channelz.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc_core {
@@ -128,6 +133,65 @@ TEST_F(ChannelzRegistryTest, TestUnregistration) {
   }
 }
 
+TEST_F(ChannelzRegistryTest, ConcurrentRegistration) {
+  const int kThreads = 8;
+  const int kNodesPerThread = 1000;
+  std::vector<std::vector<RefCountedPtr<BaseNode>>> nodes(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&nodes, t]() {
+      for (int i = 0; i < kNodesPerThread; ++i) {
+        nodes[t].push_back(CreateTestNode());
+        // Every other node goes away right away.
+        if (i % 2 == 0) nodes[t].pop_back();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  std::set<intptr_t> uuids;
+  for (const auto& thread_nodes : nodes) {
+    for (const auto& node : thread_nodes) {
+      EXPECT_TRUE(uuids.insert(node->uuid()).second);
+      EXPECT_EQ(ChannelzRegistry::Get(node->uuid()), node);
+    }
+  }
+  EXPECT_EQ(uuids.size(), kThreads * kNodesPerThread / 2);
+}
+
+TEST_F(ChannelzRegistryTest, GetServersPaginatesInUuidOrder) {
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  for (int i = 0; i < 150; ++i) {
+    nodes.push_back(MakeRefCounted<ServerNode>(0));
+    // Nodes of other types are skipped.
+    nodes.push_back(CreateTestNode());
+  }
+  auto get_page = [](intptr_t start_id, bool* end) {
+    auto json = JsonParse(ChannelzRegistry::GetServers(start_id));
+    EXPECT_TRUE(json.ok());
+    *end = json->object().count("end") != 0;
+    std::vector<intptr_t> ids;
+    for (const Json& server : json->object().at("server").array()) {
+      ids.push_back(std::stoll(server.object()
+                                   .at("ref")
+                                   .object()
+                                   .at("serverId")
+                                   .string()));
+    }
+    return ids;
+  };
+  bool end;
+  std::vector<intptr_t> first_page = get_page(0, &end);
+  EXPECT_FALSE(end);
+  ASSERT_EQ(first_page.size(), 100);
+  EXPECT_TRUE(std::is_sorted(first_page.begin(), first_page.end()));
+  EXPECT_EQ(first_page.front(), nodes[0]->uuid());
+  std::vector<intptr_t> second_page = get_page(first_page.back() + 1, &end);
+  EXPECT_TRUE(end);
+  ASSERT_EQ(second_page.size(), 50);
+  EXPECT_TRUE(std::is_sorted(second_page.begin(), second_page.end()));
+  EXPECT_EQ(second_page.back(), nodes[298]->uuid());
+}
+
 }  // namespace testing
 }  // namespace channelz
 }  // namespace grpc_core
@@ -23,7 +23,9 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "absl/status/status.h"
@@ -593,6 +595,29 @@ TEST_F(ChannelzRegistryBasedTest, ManyServersTest) {
   ValidateGetServers(10);
 }
 
+TEST(ChannelzSocketTest, RendersTcpInfoOptions) {
+  auto socket = MakeRefCounted<SocketNode>(
+      "ipv4:127.0.0.1:10000", "ipv4:127.0.0.1:20000", "socket", nullptr);
+  Json json = socket->RenderJson();
+  EXPECT_EQ(json.object().at("data").object().count("option"), 0);
+  SocketNode::TcpInfo tcp_info;
+  tcp_info.rtt_us = 1500;
+  tcp_info.snd_cwnd = 10;
+  tcp_info.delivery_rate = 1 << 20;
+  socket->SetTcpInfo(tcp_info);
+  json = socket->RenderJson();
+  std::map<std::string, std::string> options;
+  for (const Json& option :
+       json.object().at("data").object().at("option").array()) {
+    options[option.object().at("name").string()] =
+        option.object().at("value").string();
+  }
+  EXPECT_EQ(options["tcpiRttUs"], "1500");
+  EXPECT_EQ(options["tcpiSndCwnd"], "10");
+  EXPECT_EQ(options["tcpiDeliveryRate"], "1048576");
+  EXPECT_EQ(options["tcpiTotalRetrans"], "0");
+}
+
 INSTANTIATE_TEST_SUITE_P(ChannelzChannelTestSweep, ChannelzChannelTest,
                          ::testing::Values(0, 8, 64, 1024, 1024 * 1024));
 
@@ -0,0 +1,172 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/client_channel/global_subchannel_pool.h"
+
+#include <functional>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/client_channel/connector.h"
+#include "src/core/client_channel/subchannel.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_args_preconditioning.h"
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/util/uri/uri_parser.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kWarmPoolSize = 2;
+constexpr int kWarmPoolIdleMs = 500;
+
+// The subchannels in these tests are never asked to connect.
+class NoOpConnector final : public SubchannelConnector {
+ public:
+  void Connect(const Args&, Result*, grpc_closure*) override {
+    Crash("unexpected connection attempt");
+  }
+  void Shutdown(grpc_error_handle) override {}
+};
+
+class GlobalSubchannelPoolTest : public ::testing::Test {
+ protected:
+  void SetUp() override { grpc_init(); }
+
+  void TearDown() override {
+    grpc_shutdown();
+    WaitForShutdown();
+  }
+
+  static RefCountedPtr<Subchannel> CreateSubchannel(int port) {
+    grpc_resolved_address address;
+    CHECK(grpc_parse_uri(
+        URI::Parse(absl::StrCat("ipv4:127.0.0.1:", port)).value(), &address));
+    ExecCtx exec_ctx;
+    return Subchannel::Create(
+        MakeOrphanable<NoOpConnector>(), address,
+        CoreConfiguration::Get()
+            .channel_args_preconditioning()
+            .PreconditionChannelArgs(nullptr)
+            .SetObject(GlobalSubchannelPool::instance()));
+  }
+
+  // What the client channel does when its last wrapper for the subchannel
+  // goes away.
+  static void Release(RefCountedPtr<Subchannel> subchannel) {
+    ExecCtx exec_ctx;
+    GlobalSubchannelPool::instance()->ReleaseSubchannel(std::move(subchannel));
+  }
+
+  // Returns true if the subchannel has been orphaned, i.e. neither a channel
+  // nor the warm pool holds it any more.
+  static bool IsOrphaned(const WeakRefCountedPtr<Subchannel>& subchannel) {
+    ExecCtx exec_ctx;
+    return subchannel->RefIfNonZero() == nullptr;
+  }
+
+  static bool WaitFor(const std::function<bool()>& condition) {
+    const absl::Time deadline = absl::Now() + absl::Seconds(30);
+    while (!condition()) {
+      if (absl::Now() > deadline) return false;
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    return true;
+  }
+
+  static void WaitForShutdown() {
+    ASSERT_TRUE(WaitFor([]() { return !grpc_is_initialized(); }));
+    grpc_maybe_wait_for_async_shutdown();
+  }
+};
+
+TEST_F(GlobalSubchannelPoolTest, ReusedWithinIdleTime) {
+  auto subchannel = CreateSubchannel(1001);
+  Subchannel* released = subchannel.get();
+  Release(std::move(subchannel));
+  EXPECT_EQ(GlobalSubchannelPool::WarmSubchannelCount(), 1);
+  // A channel that asks for the same address gets the warm subchannel back,
+  // which takes it out of the warm pool.
+  subchannel = CreateSubchannel(1001);
+  EXPECT_EQ(subchannel.get(), released);
+  EXPECT_EQ(GlobalSubchannelPool::WarmSubchannelCount(), 0);
+  Release(std::move(subchannel));
+}
+
+TEST_F(GlobalSubchannelPoolTest, EvictedAfterIdleTime) {
+  auto subchannel = CreateSubchannel(1002);
+  auto weak = subchannel->WeakRef();
+  Release(std::move(subchannel));
+  EXPECT_FALSE(IsOrphaned(weak));
+  // Nothing uses the pool from here on, so only the eviction timer can drop
+  // the subchannel.
+  EXPECT_TRUE(WaitFor([&]() { return IsOrphaned(weak); }));
+  EXPECT_EQ(GlobalSubchannelPool::WarmSubchannelCount(), 0);
+  ExecCtx exec_ctx;
+  weak.reset();
+}
+
+TEST_F(GlobalSubchannelPoolTest, EvictsLeastRecentlyReleasedOverSize) {
+  std::vector<WeakRefCountedPtr<Subchannel>> weak;
+  for (int i = 0; i < kWarmPoolSize + 1; ++i) {
+    auto subchannel = CreateSubchannel(1010 + i);
+    weak.push_back(subchannel->WeakRef());
+    Release(std::move(subchannel));
+  }
+  EXPECT_EQ(GlobalSubchannelPool::WarmSubchannelCount(), kWarmPoolSize);
+  EXPECT_TRUE(IsOrphaned(weak[0]));
+  for (int i = 1; i < kWarmPoolSize + 1; ++i) {
+    EXPECT_FALSE(IsOrphaned(weak[i]));
+  }
+  ExecCtx exec_ctx;
+  weak.clear();
+}
+
+TEST_F(GlobalSubchannelPoolTest, FlushedByShutdown) {
+  Release(CreateSubchannel(1020));
+  Release(CreateSubchannel(1021));
+  EXPECT_EQ(GlobalSubchannelPool::WarmSubchannelCount(), 2);
+  // The warm subchannels hold grpc_init() refs of their own, but must not
+  // keep gRPC from shutting down once the application is done with it.
+  grpc_shutdown();
+  WaitForShutdown();
+  EXPECT_EQ(GlobalSubchannelPool::WarmSubchannelCount(), 0);
+  // For TearDown().
+  grpc_init();
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.subchannel_warm_pool_size = grpc_core::kWarmPoolSize;
+  overrides.subchannel_warm_pool_idle_ms = grpc_core::kWarmPoolIdleMs;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  return RUN_ALL_TESTS();
+}
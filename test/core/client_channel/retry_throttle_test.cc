@@ -65,6 +65,24 @@ TEST(ServerRetryThrottleData, Basic) {
   EXPECT_TRUE(throttle_data->RecordFailure());
 }
 
+TEST(ServerRetryThrottleData, IsRetryAllowed) {
+  // Max token count is 4, so threshold for retrying is 2.
+  auto throttle_data =
+      MakeRefCounted<ServerRetryThrottleData>(4000, 1000, nullptr);
+  // token_count=4.  Checking does not consume a token.
+  EXPECT_TRUE(throttle_data->IsRetryAllowed());
+  EXPECT_TRUE(throttle_data->IsRetryAllowed());
+  // Failure: token_count=3.  Above threshold.
+  EXPECT_TRUE(throttle_data->RecordFailure());
+  EXPECT_TRUE(throttle_data->IsRetryAllowed());
+  // Failure: token_count=2.  At threshold, so no retries.
+  EXPECT_FALSE(throttle_data->RecordFailure());
+  EXPECT_FALSE(throttle_data->IsRetryAllowed());
+  // Success: token_count=3.
+  throttle_data->RecordSuccess();
+  EXPECT_TRUE(throttle_data->IsRetryAllowed());
+}
+
 TEST(ServerRetryThrottleData, Replacement) {
   // Create old throttle data.
   // Max token count is 4, so threshold for retrying is 2.
@@ -0,0 +1,323 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/numbers.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+
+#include "src/core/channelz/channelz.h"
+#include "src/core/client_channel/connector.h"
+#include "src/core/client_channel/local_subchannel_pool.h"
+#include "src/core/client_channel/subchannel.h"
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_args_preconditioning.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/surface/completion_queue.h"
+#include "src/core/lib/transport/transport.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/uri/uri_parser.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// The connections made by a TestConnector.  Each one is a chttp2 client
+// transport talking to a chttp2 server transport over an endpoint pair.
+// Connection attempts are held until the test completes them, so that the
+// test decides when each stripe shows up.
+class Connections {
+ public:
+  explicit Connections(grpc_pollset* pollset) : pollset_(pollset) {}
+
+  void Connect(const SubchannelConnector::Args& args,
+               SubchannelConnector::Result* result, grpc_closure* notify) {
+    grpc_endpoint_pair fds =
+        grpc_iomgr_create_endpoint_pair("subchannel_stripe", nullptr);
+    grpc_endpoint_add_to_pollset(fds.client, pollset_);
+    grpc_endpoint_add_to_pollset(fds.server, pollset_);
+    Transport* server = grpc_create_chttp2_transport(
+        args.channel_args, OrphanablePtr<grpc_endpoint>(fds.server),
+        /*is_client=*/false);
+    grpc_chttp2_transport_start_reading(server, nullptr, nullptr, nullptr,
+                                        nullptr);
+    Transport* client = grpc_create_chttp2_transport(
+        args.channel_args, OrphanablePtr<grpc_endpoint>(fds.client),
+        /*is_client=*/true);
+    grpc_chttp2_transport_start_reading(client, nullptr, nullptr, nullptr,
+                                        nullptr);
+    result->channel_args = args.channel_args;
+    result->socket_node = grpc_chttp2_transport_get_socket_node(client);
+    result->transport = client;
+    MutexLock lock(&mu_);
+    connections_.push_back(
+        Connection{server, result->socket_node->uuid(), notify});
+  }
+
+  // Fails every connection attempt that has not completed yet.
+  void Shutdown() {
+    std::vector<grpc_closure*> pending;
+    {
+      MutexLock lock(&mu_);
+      for (auto& connection : connections_) {
+        if (connection.notify != nullptr) {
+          pending.push_back(std::exchange(connection.notify, nullptr));
+        }
+      }
+    }
+    for (grpc_closure* notify : pending) {
+      ExecCtx::Run(DEBUG_LOCATION, notify,
+                   absl::UnavailableError("connector shutdown"));
+    }
+  }
+
+  size_t size() {
+    MutexLock lock(&mu_);
+    return connections_.size();
+  }
+
+  intptr_t socket_uuid(size_t i) {
+    MutexLock lock(&mu_);
+    return connections_[i].socket_uuid;
+  }
+
+  // Reports the i-th connection attempt as successful.  By the time this
+  // returns, the subchannel has taken the connection.
+  void Complete(size_t i) {
+    ExecCtx exec_ctx;
+    grpc_closure* notify;
+    {
+      MutexLock lock(&mu_);
+      notify = std::exchange(connections_[i].notify, nullptr);
+    }
+    CHECK_NE(notify, nullptr);
+    ExecCtx::Run(DEBUG_LOCATION, notify, absl::OkStatus());
+  }
+
+  // Shuts down the server side of the i-th connection.
+  void Close(size_t i) {
+    ExecCtx exec_ctx;
+    Transport* server;
+    {
+      MutexLock lock(&mu_);
+      server = std::exchange(connections_[i].server, nullptr);
+    }
+    if (server != nullptr) server->Orphan();
+  }
+
+  void CloseAll() {
+    for (size_t i = 0; i < size(); ++i) Close(i);
+  }
+
+ private:
+  struct Connection {
+    Transport* server;
+    intptr_t socket_uuid;
+    grpc_closure* notify;
+  };
+
+  grpc_pollset* const pollset_;
+  Mutex mu_;
+  std::vector<Connection> connections_ ABSL_GUARDED_BY(mu_);
+};
+
+class TestConnector final : public SubchannelConnector {
+ public:
+  explicit TestConnector(std::shared_ptr<Connections> connections)
+      : connections_(std::move(connections)) {}
+
+  void Connect(const Args& args, Result* result,
+               grpc_closure* notify) override {
+    connections_->Connect(args, result, notify);
+  }
+
+  void Shutdown(grpc_error_handle) override { connections_->Shutdown(); }
+
+ private:
+  std::shared_ptr<Connections> connections_;
+};
+
+class SubchannelStripeTest : public ::testing::Test {
+ protected:
+  SubchannelStripeTest() {
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    poller_ = std::thread([this]() {
+      while (!shutdown_.load()) {
+        CHECK(grpc_completion_queue_next(
+                  cq_, grpc_timeout_milliseconds_to_deadline(10), nullptr)
+                  .type == GRPC_QUEUE_TIMEOUT);
+      }
+    });
+    connections_ = std::make_shared<Connections>(grpc_cq_pollset(cq_));
+  }
+
+  ~SubchannelStripeTest() override {
+    {
+      ExecCtx exec_ctx;
+      subchannel_.reset();
+    }
+    connections_->CloseAll();
+    shutdown_.store(true);
+    poller_.join();
+    grpc_completion_queue_shutdown(cq_);
+    CHECK(grpc_completion_queue_next(cq_, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                     nullptr)
+              .type == GRPC_QUEUE_SHUTDOWN);
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  void CreateSubchannel(int connections_per_address) {
+    grpc_resolved_address address;
+    CHECK(grpc_parse_uri(URI::Parse("ipv4:127.0.0.1:1234").value(),
+                         &address));
+    ChannelArgs args =
+        CoreConfiguration::Get()
+            .channel_args_preconditioning()
+            .PreconditionChannelArgs(nullptr)
+            .Set(GRPC_ARG_DEFAULT_AUTHORITY, "test-authority")
+            .Set(GRPC_ARG_ENABLE_CHANNELZ, true)
+            .Set("grpc.subchannel.connections_per_address",
+                 connections_per_address)
+            .SetObject(MakeRefCounted<LocalSubchannelPool>());
+    ExecCtx exec_ctx;
+    subchannel_ = Subchannel::Create(
+        MakeOrphanable<TestConnector>(connections_), address, args);
+    subchannel_->RequestConnection();
+  }
+
+  // Returns the uuid of the socket that channelz lists for the subchannel,
+  // or 0 if there is none.
+  intptr_t ChildSocketUuid() {
+    Json json = subchannel_->channelz_node()->RenderJson();
+    auto it = json.object().find("socketRef");
+    if (it == json.object().end()) return 0;
+    intptr_t uuid = 0;
+    CHECK(absl::SimpleAtoi(
+        it->second.array()[0].object().at("socketId").string(), &uuid));
+    return uuid;
+  }
+
+  static bool WaitFor(const std::function<bool()>& condition) {
+    const absl::Time deadline = absl::Now() + absl::Seconds(30);
+    while (!condition()) {
+      if (absl::Now() > deadline) return false;
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    return true;
+  }
+
+  std::shared_ptr<Connections> connections_;
+  RefCountedPtr<Subchannel> subchannel_;
+
+ private:
+  grpc_completion_queue* cq_;
+  std::atomic<bool> shutdown_{false};
+  std::thread poller_;
+};
+
+TEST_F(SubchannelStripeTest, OpensStripesOneAtATime) {
+  CreateSubchannel(3);
+  ASSERT_EQ(connections_->size(), 1);
+  connections_->Complete(0);
+  ASSERT_NE(subchannel_->connected_subchannel(), nullptr);
+  EXPECT_EQ(ChildSocketUuid(), connections_->socket_uuid(0));
+  // The first stripe is started once the subchannel is READY, and the next
+  // one only once the first has connected.
+  ASSERT_EQ(connections_->size(), 2);
+  connections_->Complete(1);
+  ASSERT_EQ(connections_->size(), 3);
+  connections_->Complete(2);
+  // That makes three connections, so no more are attempted.
+  EXPECT_EQ(connections_->size(), 3);
+  // Channelz keeps listing the primary connection.
+  EXPECT_EQ(ChildSocketUuid(), connections_->socket_uuid(0));
+}
+
+TEST_F(SubchannelStripeTest, PromotedStripeIsRegisteredInChannelz) {
+  CreateSubchannel(2);
+  connections_->Complete(0);
+  connections_->Complete(1);
+  ConnectedSubchannel* primary = subchannel_->connected_subchannel().get();
+  ASSERT_NE(primary, nullptr);
+  EXPECT_EQ(ChildSocketUuid(), connections_->socket_uuid(0));
+  // Losing the primary connection promotes the stripe: the subchannel stays
+  // READY, and channelz lists the stripe's socket instead.
+  connections_->Close(0);
+  ASSERT_TRUE(WaitFor([&]() {
+    return ChildSocketUuid() == connections_->socket_uuid(1);
+  }));
+  ConnectedSubchannel* promoted = subchannel_->connected_subchannel().get();
+  ASSERT_NE(promoted, nullptr);
+  EXPECT_NE(promoted, primary);
+  // A replacement stripe is started.
+  EXPECT_TRUE(WaitFor([&]() { return connections_->size() == 3; }));
+}
+
+TEST_F(SubchannelStripeTest, FailsOverFromStripeToStripe) {
+  CreateSubchannel(3);
+  connections_->Complete(0);
+  connections_->Complete(1);
+  connections_->Complete(2);
+  // Losing a stripe other than the primary leaves channelz alone and starts
+  // a replacement.
+  connections_->Close(1);
+  ASSERT_TRUE(WaitFor([&]() { return connections_->size() == 4; }));
+  EXPECT_EQ(ChildSocketUuid(), connections_->socket_uuid(0));
+  // Each time the active connection is lost, a remaining stripe takes over
+  // and is listed in channelz.
+  connections_->Close(0);
+  ASSERT_TRUE(WaitFor([&]() {
+    return ChildSocketUuid() == connections_->socket_uuid(2);
+  }));
+  ASSERT_NE(subchannel_->connected_subchannel(), nullptr);
+  connections_->Complete(3);
+  connections_->Close(2);
+  ASSERT_TRUE(WaitFor([&]() {
+    return ChildSocketUuid() == connections_->socket_uuid(3);
+  }));
+  ASSERT_NE(subchannel_->connected_subchannel(), nullptr);
+  // Once the last connection is gone, the subchannel drops it from channelz
+  // and goes IDLE.
+  connections_->Close(3);
+  ASSERT_TRUE(WaitFor([&]() { return ChildSocketUuid() == 0; }));
+  EXPECT_EQ(subchannel_->connected_subchannel(), nullptr);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
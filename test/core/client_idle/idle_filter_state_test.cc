@@ -14,6 +14,7 @@
 
 #include "src/core/ext/filters/channel_idle/idle_filter_state.h"
 
+#include <atomic>
 #include <chrono>
 #include <random>
 #include <thread>
@@ -22,18 +23,20 @@
 
 #include "gtest/gtest.h"
 
+#include "src/core/lib/gprpp/sync.h"
+
 namespace grpc_core {
 namespace testing {
 
-TEST(IdleFilterStateTest, IdlenessStartsTimer) {
+TEST(IdleFilterStateTest, FirstCallStartsTimer) {
   IdleFilterState s(false);
-  s.IncreaseCallCount();
-  // First idle should start the timer
-  EXPECT_TRUE(s.DecreaseCallCount());
+  // First call should start the timer
+  EXPECT_TRUE(s.IncreaseCallCount());
+  s.DecreaseCallCount();
   for (int i = 0; i < 10; i++) {
-    // Next idle should not!
-    s.IncreaseCallCount();
-    EXPECT_FALSE(s.DecreaseCallCount());
+    // Next calls should not!
+    EXPECT_FALSE(s.IncreaseCallCount());
+    s.DecreaseCallCount();
   }
 }
 
@@ -45,37 +48,63 @@ TEST(IdleFilterStateTest, TimerStopsAfterIdle) {
 TEST(IdleFilterStateTest, TimerKeepsGoingWithActivity) {
   IdleFilterState s(true);
   for (int i = 0; i < 10; i++) {
-    s.IncreaseCallCount();
-    (void)s.DecreaseCallCount();
+    EXPECT_FALSE(s.IncreaseCallCount());
+    s.DecreaseCallCount();
+    EXPECT_TRUE(s.CheckTimer());
+  }
+  EXPECT_FALSE(s.CheckTimer());
+}
+
+TEST(IdleFilterStateTest, TimerKeepsGoingWithCallsInProgress) {
+  IdleFilterState s(true);
+  EXPECT_FALSE(s.IncreaseCallCount());
+  for (int i = 0; i < 10; i++) {
     EXPECT_TRUE(s.CheckTimer());
   }
+  s.DecreaseCallCount();
+  EXPECT_TRUE(s.CheckTimer());
+  EXPECT_FALSE(s.CheckTimer());
+  // Once stopped, the next call restarts the timer.
+  EXPECT_TRUE(s.IncreaseCallCount());
+}
+
+TEST(IdleFilterStateTest, CallsMayFinishOnAnotherThread) {
+  IdleFilterState s(false);
+  EXPECT_TRUE(s.IncreaseCallCount());
+  std::thread([&] { s.DecreaseCallCount(); }).join();
+  EXPECT_TRUE(s.CheckTimer());
   EXPECT_FALSE(s.CheckTimer());
 }
 
 TEST(IdleFilterStateTest, StressTest) {
   IdleFilterState s(false);
   std::atomic<bool> done{false};
-  int idle_polls = 0;
-  int thread_jumps = 0;
+  std::atomic<int> idle_polls{0};
+  std::atomic<int> timers_started{0};
+  std::vector<std::thread> timer_threads;
+  Mutex timer_threads_mu;
   std::vector<std::thread> threads;
   for (int idx = 0; idx < 10; idx++) {
     std::thread t([&] {
       int ctr = 0;
       auto increase = [&] {
-        s.IncreaseCallCount();
         ctr++;
+        if (s.IncreaseCallCount()) {
+          if (timers_started.fetch_add(1) + 1 == 10) {
+            done.store(true, std::memory_order_relaxed);
+          }
+          MutexLock lock(&timer_threads_mu);
+          timer_threads.emplace_back([&] {
+            do {
+              idle_polls.fetch_add(1);
+              std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            } while (s.CheckTimer());
+          });
+        }
       };
       auto decrease = [&] {
         ctr--;
-        if (s.DecreaseCallCount()) {
-          thread_jumps++;
-          if (thread_jumps == 10) done.store(true, std::memory_order_relaxed);
-          EXPECT_EQ(ctr, 0);
-          do {
-            idle_polls++;
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-          } while (s.CheckTimer());
-        }
+        s.DecreaseCallCount();
       };
       std::mt19937 g{std::random_device()()};
       while (!done.load(std::memory_order_relaxed)) {
@@ -98,6 +127,8 @@ TEST(IdleFilterStateTest, StressTest) {
     threads.emplace_back(std::move(t));
   }
   for (auto& thread : threads) thread.join();
+  MutexLock lock(&timer_threads_mu);
+  for (auto& thread : timer_threads) thread.join();
 }
 
 }  // namespace testing
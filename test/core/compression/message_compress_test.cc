@@ -25,12 +25,15 @@
 #include <memory>
 
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
 
 #include <grpc/compression.h>
 #include <grpc/slice_buffer.h>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/util/useful.h"
 #include "test/core/test_util/slice_splitter.h"
 #include "test/core/test_util/test_config.h"
@@ -161,6 +164,82 @@ TEST(MessageCompressTest, TinyDataCompress) {
   grpc_slice_buffer_destroy(&output);
 }
 
+TEST(MessageCompressTest, CompressionLevels) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_MB_A));
+  grpc_core::ExecCtx exec_ctx;
+  for (grpc_compression_algorithm algorithm :
+       {GRPC_COMPRESS_DEFLATE, GRPC_COMPRESS_GZIP}) {
+    // Alternate between levels so that pooled streams get reused at a
+    // different level than they were last used at.
+    for (int level : {1, 9, 0, 6, -1, 1}) {
+      grpc_slice_buffer compressed;
+      grpc_slice_buffer decompressed;
+      grpc_slice_buffer_init(&compressed);
+      grpc_slice_buffer_init(&decompressed);
+      // Level 0 stores the data, which does not make it any smaller.
+      ASSERT_EQ(level != 0 ? 1 : 0,
+                grpc_msg_compress_with_level(algorithm, level, &input,
+                                             &compressed))
+          << "level " << level;
+      if (level != 0) {
+        ASSERT_EQ(1, grpc_msg_decompress(algorithm, &compressed,
+                                         &decompressed));
+        grpc_slice merged =
+            grpc_slice_merge(decompressed.slices, decompressed.count);
+        EXPECT_TRUE(grpc_slice_eq(input.slices[0], merged));
+        grpc_slice_unref(merged);
+      }
+      grpc_slice_buffer_destroy(&compressed);
+      grpc_slice_buffer_destroy(&decompressed);
+    }
+  }
+  grpc_slice_buffer_destroy(&input);
+}
+
+TEST(MessageCompressTest, PresetDictionary) {
+  constexpr absl::string_view kMessage =
+      "{\"user_id\":12345,\"event\":\"page_view\",\"country\":\"DE\"}";
+  const grpc_core::DeflateDictionary dictionary(
+      absl::StrCat("\"event\":\"click\"", kMessage));
+  const grpc_core::DeflateDictionary other_dictionary("something else");
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, grpc_slice_from_copied_buffer(
+                                    kMessage.data(), kMessage.size()));
+  grpc_core::ExecCtx exec_ctx;
+  // Too small to compress on its own...
+  ASSERT_EQ(0,
+            grpc_msg_compress(GRPC_COMPRESS_DEFLATE, &input, &compressed));
+  grpc_slice_buffer_reset_and_unref(&compressed);
+  // ... but not against the dictionary.
+  ASSERT_EQ(1, grpc_msg_compress_with_dictionary(GRPC_COMPRESS_DEFLATE, -1,
+                                                 dictionary, &input,
+                                                 &compressed));
+  EXPECT_LT(compressed.length, kMessage.size() / 2);
+  EXPECT_EQ(0, grpc_msg_decompress(GRPC_COMPRESS_DEFLATE, &compressed,
+                                   &output));
+  EXPECT_EQ(0, grpc_msg_decompress_with_dictionaries(
+                   GRPC_COMPRESS_DEFLATE, {&other_dictionary, 1}, &compressed,
+                   &output));
+  EXPECT_EQ(output.length, 0);
+  const grpc_core::DeflateDictionary dictionaries[] = {other_dictionary,
+                                                       dictionary};
+  ASSERT_EQ(1, grpc_msg_decompress_with_dictionaries(
+                   GRPC_COMPRESS_DEFLATE, dictionaries, &compressed, &output));
+  grpc_slice merged = grpc_slice_merge(output.slices, output.count);
+  EXPECT_EQ(grpc_core::StringViewFromSlice(merged), kMessage);
+  grpc_slice_unref(merged);
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
 TEST(MessageCompressTest, BadDecompressionDataCrc) {
   grpc_slice_buffer input;
   grpc_slice_buffer corrupted;
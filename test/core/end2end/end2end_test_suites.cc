@@ -801,6 +801,38 @@ std::vector<CoreTestConfiguration> DefaultConfigs() {
             [](const ChannelArgs&, const ChannelArgs&) {
               return std::make_unique<SslTlsFixture>(grpc_tls_version::TLS1_3);
             }},
+        CoreTestConfiguration{
+            "Chttp2SimplSslFullstackTls13KernelTxOffload",
+            FEATURE_MASK_IS_SECURE |
+                FEATURE_MASK_SUPPORTS_PER_CALL_CREDENTIALS |
+                FEATURE_MASK_SUPPORTS_CLIENT_CHANNEL |
+                FEATURE_MASK_DOES_NOT_SUPPORT_CLIENT_HANDSHAKE_COMPLETE_FIRST |
+                FEATURE_MASK_IS_HTTP2 |
+                FEATURE_MASK_EXCLUDE_FROM_EXPERIMENT_RUNS,
+            "foo.test.google.fr",
+            [](const ChannelArgs&, const ChannelArgs&) {
+              return std::make_unique<SslTlsFixture>(
+                  grpc_tls_version::TLS1_3,
+                  ChannelArgs().Set(GRPC_ARG_TLS_KERNEL_TX_OFFLOAD, true));
+            }},
+        CoreTestConfiguration{
+            // Zerocopy sends keep the encryption in user space.
+            "Chttp2SimplSslFullstackTls13KernelTxOffloadZeroCopy",
+            FEATURE_MASK_IS_SECURE |
+                FEATURE_MASK_SUPPORTS_PER_CALL_CREDENTIALS |
+                FEATURE_MASK_SUPPORTS_CLIENT_CHANNEL |
+                FEATURE_MASK_DOES_NOT_SUPPORT_CLIENT_HANDSHAKE_COMPLETE_FIRST |
+                FEATURE_MASK_IS_HTTP2 |
+                FEATURE_MASK_EXCLUDE_FROM_EXPERIMENT_RUNS,
+            "foo.test.google.fr",
+            [](const ChannelArgs&, const ChannelArgs&) {
+              return std::make_unique<SslTlsFixture>(
+                  grpc_tls_version::TLS1_3,
+                  ChannelArgs()
+                      .Set(GRPC_ARG_TLS_KERNEL_TX_OFFLOAD, true)
+                      .Set(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED, true)
+                      .Set(GRPC_ARG_TCP_TX_ZEROCOPY_SEND_BYTES_THRESHOLD, 0));
+            }},
         CoreTestConfiguration{
             "Chttp2SocketPair",
             FEATURE_MASK_IS_HTTP2 | FEATURE_MASK_DO_NOT_FUZZ |
@@ -17,6 +17,8 @@
 
 #include <string.h>
 
+#include <utility>
+
 #include "absl/log/check.h"
 
 #include <grpc/credentials.h>
@@ -37,8 +39,11 @@
 
 class SslTlsFixture : public SecureFixture {
  public:
-  explicit SslTlsFixture(grpc_tls_version tls_version)
-      : tls_version_(tls_version) {}
+  // extra_args are added to both the client and the server channel args.
+  explicit SslTlsFixture(
+      grpc_tls_version tls_version,
+      grpc_core::ChannelArgs extra_args = grpc_core::ChannelArgs())
+      : tls_version_(tls_version), extra_args_(std::move(extra_args)) {}
 
   static const char* CaCertPath() { return "src/core/tsi/test_creds/ca.pem"; }
   static const char* ServerCertPath() {
@@ -51,7 +56,13 @@ class SslTlsFixture : public SecureFixture {
  private:
   grpc_core::ChannelArgs MutateClientArgs(
       grpc_core::ChannelArgs args) override {
-    return args.Set(GRPC_SSL_TARGET_NAME_OVERRIDE_ARG, "foo.test.google.fr");
+    return args.UnionWith(extra_args_)
+        .Set(GRPC_SSL_TARGET_NAME_OVERRIDE_ARG, "foo.test.google.fr");
+  }
+
+  grpc_core::ChannelArgs MutateServerArgs(
+      grpc_core::ChannelArgs args) override {
+    return args.UnionWith(extra_args_);
   }
 
   grpc_channel_credentials* MakeClientCreds(
@@ -103,6 +114,7 @@ class SslTlsFixture : public SecureFixture {
   }
 
   grpc_tls_version tls_version_;
+  grpc_core::ChannelArgs extra_args_;
 };
 
 #endif  // GRPC_TEST_CORE_END2END_FIXTURES_H2_SSL_TLS_COMMON_H
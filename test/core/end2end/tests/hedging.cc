@@ -0,0 +1,255 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpc/status.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/end2end/end2end_tests.h"
+
+namespace grpc_core {
+namespace {
+
+ChannelArgs HedgingChannelArgs(int max_attempts,
+                               absl::string_view hedging_delay) {
+  return ChannelArgs()
+      .Set(GRPC_ARG_EXPERIMENTAL_ENABLE_HEDGING, true)
+      .Set(GRPC_ARG_SERVICE_CONFIG,
+           absl::StrCat("{\n"
+                        "  \"methodConfig\": [ {\n"
+                        "    \"name\": [\n"
+                        "      { \"service\": \"service\", \"method\": "
+                        "\"method\" }\n"
+                        "    ],\n"
+                        "    \"hedgingPolicy\": {\n"
+                        "      \"maxAttempts\": ",
+                        max_attempts,
+                        ",\n"
+                        "      \"hedgingDelay\": \"",
+                        hedging_delay,
+                        "\",\n"
+                        "      \"nonFatalStatusCodes\": [ \"ABORTED\" ]\n"
+                        "    }\n"
+                        "  } ]\n"
+                        "}"));
+}
+
+// Tests that a hedged attempt is started once hedgingDelay has passed
+// without a response, and that the attempt that commits wins:
+// - 2 attempts allowed, 1 second apart
+// - first attempt gets no response
+// - second attempt starts after the delay and returns OK
+CORE_END2END_TEST(RetryTest, HedgedAttemptStartsAfterHedgingDelay) {
+  InitServer(ChannelArgs());
+  InitClient(HedgingChannelArgs(2, "1s"));
+  const auto start = Timestamp::Now();
+  auto c =
+      NewClientCall("/service/method").Timeout(Duration::Minutes(1)).Create();
+  IncomingStatusOnClient server_status;
+  IncomingMetadata server_initial_metadata;
+  IncomingMessage server_message;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendMessage("foo")
+      .RecvMessage(server_message)
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  auto s = RequestCall(101);
+  Expect(101, true);
+  Step();
+  EXPECT_EQ(s.GetInitialMetadata("grpc-previous-rpc-attempts"), absl::nullopt);
+  auto s2 = RequestCall(201);
+  Expect(201, true);
+  Step(Duration::Seconds(20));
+  // To avoid flakiness, we allow some fudge factor here.
+  EXPECT_GE(Timestamp::Now() - start, Duration::Milliseconds(900));
+  EXPECT_EQ(s2.GetInitialMetadata("grpc-previous-rpc-attempts"), "1");
+  IncomingCloseOnServer client_close;
+  s.NewBatch(102).RecvCloseOnServer(client_close);
+  IncomingMessage client_message2;
+  s2.NewBatch(202)
+      .SendInitialMetadata({})
+      .RecvMessage(client_message2)
+      .SendMessage("bar");
+  IncomingCloseOnServer client_close2;
+  s2.NewBatch(203)
+      .SendStatusFromServer(GRPC_STATUS_OK, "xyz", {})
+      .RecvCloseOnServer(client_close2);
+  Expect(102, true);
+  Expect(202, true);
+  Expect(203, true);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_OK);
+  EXPECT_EQ(server_status.message(), "xyz");
+  EXPECT_EQ(server_message.payload(), "bar");
+  EXPECT_EQ(client_message2.payload(), "foo");
+  EXPECT_TRUE(client_close.was_cancelled());
+  EXPECT_FALSE(client_close2.was_cancelled());
+}
+
+// Tests that the first attempt to commit cancels every other attempt:
+// - 3 attempts allowed, 100ms apart
+// - all three attempts reach the server
+// - the second one sends initial metadata and commits
+// - the first and third ones are cancelled
+CORE_END2END_TEST(RetryTest, FirstHedgedAttemptToCommitCancelsOthers) {
+  InitServer(ChannelArgs());
+  InitClient(HedgingChannelArgs(3, "0.1s"));
+  auto c =
+      NewClientCall("/service/method").Timeout(Duration::Minutes(1)).Create();
+  IncomingStatusOnClient server_status;
+  IncomingMetadata server_initial_metadata;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendMessage("foo")
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  auto s = RequestCall(101);
+  Expect(101, true);
+  Step();
+  auto s2 = RequestCall(201);
+  Expect(201, true);
+  Step();
+  auto s3 = RequestCall(301);
+  Expect(301, true);
+  Step();
+  EXPECT_EQ(s3.GetInitialMetadata("grpc-previous-rpc-attempts"), "2");
+  IncomingCloseOnServer client_close;
+  s.NewBatch(102).RecvCloseOnServer(client_close);
+  IncomingCloseOnServer client_close3;
+  s3.NewBatch(302).RecvCloseOnServer(client_close3);
+  s2.NewBatch(202).SendInitialMetadata({});
+  Expect(102, true);
+  Expect(202, true);
+  Expect(302, true);
+  Step();
+  EXPECT_TRUE(client_close.was_cancelled());
+  EXPECT_TRUE(client_close3.was_cancelled());
+  IncomingCloseOnServer client_close2;
+  s2.NewBatch(203)
+      .SendStatusFromServer(GRPC_STATUS_OK, "xyz", {})
+      .RecvCloseOnServer(client_close2);
+  Expect(203, true);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_OK);
+  EXPECT_EQ(server_status.message(), "xyz");
+  EXPECT_FALSE(client_close2.was_cancelled());
+}
+
+// Tests that a non-fatal status only ends that attempt, and that the next
+// one starts right away rather than after hedgingDelay:
+// - 3 attempts allowed, 10 seconds apart
+// - first attempt returns ABORTED, which is non-fatal
+// - second attempt starts right away and returns OK
+CORE_END2END_TEST(RetryTest, NonFatalStatusStartsNextHedgedAttempt) {
+  InitServer(ChannelArgs());
+  InitClient(HedgingChannelArgs(3, "10s"));
+  auto c =
+      NewClientCall("/service/method").Timeout(Duration::Minutes(1)).Create();
+  IncomingStatusOnClient server_status;
+  IncomingMetadata server_initial_metadata;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendMessage("foo")
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  auto s = RequestCall(101);
+  Expect(101, true);
+  Step();
+  IncomingCloseOnServer client_close;
+  s.NewBatch(102)
+      .SendInitialMetadata({})
+      .SendStatusFromServer(GRPC_STATUS_ABORTED, "message1", {})
+      .RecvCloseOnServer(client_close);
+  Expect(102, true);
+  Step();
+  const auto before_next_attempt = Timestamp::Now();
+  auto s2 = RequestCall(201);
+  Expect(201, true);
+  Step();
+  EXPECT_LT(Timestamp::Now() - before_next_attempt, Duration::Seconds(5));
+  EXPECT_EQ(s2.GetInitialMetadata("grpc-previous-rpc-attempts"), "1");
+  IncomingCloseOnServer client_close2;
+  s2.NewBatch(202)
+      .SendInitialMetadata({})
+      .SendStatusFromServer(GRPC_STATUS_OK, "message2", {})
+      .RecvCloseOnServer(client_close2);
+  Expect(202, true);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_OK);
+  EXPECT_EQ(server_status.message(), "message2");
+  EXPECT_FALSE(client_close2.was_cancelled());
+}
+
+// Tests that a fatal status is returned to the application right away, and
+// that the other attempts in flight are cancelled:
+// - 2 attempts allowed, 100ms apart
+// - both attempts reach the server
+// - first attempt returns INVALID_ARGUMENT, which is not in
+//   nonFatalStatusCodes
+CORE_END2END_TEST(RetryTest, FatalStatusCommitsHedgedAttempt) {
+  InitServer(ChannelArgs());
+  InitClient(HedgingChannelArgs(2, "0.1s"));
+  auto c =
+      NewClientCall("/service/method").Timeout(Duration::Minutes(1)).Create();
+  IncomingStatusOnClient server_status;
+  IncomingMetadata server_initial_metadata;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendMessage("foo")
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  auto s = RequestCall(101);
+  Expect(101, true);
+  Step();
+  auto s2 = RequestCall(201);
+  Expect(201, true);
+  Step();
+  IncomingCloseOnServer client_close;
+  s.NewBatch(102)
+      .SendInitialMetadata({})
+      .SendStatusFromServer(GRPC_STATUS_INVALID_ARGUMENT, "message1", {})
+      .RecvCloseOnServer(client_close);
+  IncomingCloseOnServer client_close2;
+  s2.NewBatch(202).RecvCloseOnServer(client_close2);
+  Expect(102, true);
+  Expect(202, true);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_INVALID_ARGUMENT);
+  EXPECT_EQ(server_status.message(), "message1");
+  EXPECT_TRUE(client_close2.was_cancelled());
+}
+
+}  // namespace
+}  // namespace grpc_core
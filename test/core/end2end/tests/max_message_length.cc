@@ -22,9 +22,12 @@
 #include "gtest/gtest.h"
 
 #include <grpc/impl/channel_arg_names.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/status.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/transport/message.h"
 #include "test/core/end2end/end2end_tests.h"
 
 using testing::StartsWith;
@@ -32,6 +35,19 @@ using testing::StartsWith;
 namespace grpc_core {
 namespace {
 
+MessageObject MakeStringMessageObject(std::string payload) {
+  static const MessageObject::Vtable kVtable = {
+      [](void* object, grpc_slice_buffer* out) {
+        auto* s = static_cast<std::string*>(object);
+        grpc_slice_buffer_add(
+            out, grpc_slice_from_copied_buffer(s->data(), s->size()));
+        return true;
+      },
+      [](void* object) { delete static_cast<std::string*>(object); },
+  };
+  return MessageObject(new std::string(std::move(payload)), &kVtable);
+}
+
 void TestMaxMessageLengthOnClientOnRequest(CoreEnd2endTest& test) {
   auto c = test.NewClientCall("/service/method").Create();
   IncomingStatusOnClient server_status;
@@ -316,5 +332,28 @@ CORE_END2END_TEST(Http2Test,
               StartsWith("CLIENT: Received message larger than max"));
 }
 
+// Message objects are only handed over as they are by the in-process
+// transport: over HTTP/2 they must be serialized before the message size
+// filter runs, so that the send limit still applies to them.
+CORE_END2END_TEST(Http2Test, MaxMessageLengthOnClientOnRequestWithObject) {
+  SKIP_IF_MINSTACK();
+  InitServer(ChannelArgs());
+  InitClient(ChannelArgs().Set(GRPC_ARG_MAX_SEND_MESSAGE_LENGTH, 5));
+  auto c = NewClientCall("/service/method").Create();
+  IncomingStatusOnClient server_status;
+  IncomingMetadata server_initial_metadata;
+  c.NewBatch(1)
+      .SendInitialMetadata({})
+      .SendMessageObject(MakeStringMessageObject("hello world"))
+      .SendCloseFromClient()
+      .RecvInitialMetadata(server_initial_metadata)
+      .RecvStatusOnClient(server_status);
+  Expect(1, true);
+  Step();
+  EXPECT_EQ(server_status.status(), GRPC_STATUS_RESOURCE_EXHAUSTED);
+  EXPECT_THAT(server_status.message(),
+              StartsWith("CLIENT: Sent message larger than max"));
+}
+
 }  // namespace
 }  // namespace grpc_core
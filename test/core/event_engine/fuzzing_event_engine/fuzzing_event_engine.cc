@@ -78,7 +78,8 @@ gpr_timespec (*g_orig_gpr_now_impl)(gpr_clock_type clock_type);
 
 FuzzingEventEngine::FuzzingEventEngine(
     Options options, const fuzzing_event_engine::Actions& actions)
-    : max_delay_{options.max_delay_write, options.max_delay_run_after} {
+    : max_delay_{options.max_delay_write, options.max_delay_run_after},
+      network_model_(options.network_model) {
   tasks_by_id_.clear();
   tasks_by_time_.clear();
   next_task_id_ = 1;
@@ -126,6 +127,19 @@ FuzzingEventEngine::FuzzingEventEngine(
                                +[](int) {}});
 }
 
+EventEngine::Duration FuzzingEventEngine::NetworkModel::TransmissionTime(
+    size_t bytes) const {
+  if (bandwidth == 0) return Duration::zero();
+  return std::chrono::nanoseconds(
+      static_cast<int64_t>(static_cast<double>(bytes) * 1e9 / bandwidth));
+}
+
+EventEngine::Duration FuzzingEventEngine::NetworkModel::CpuCost(
+    size_t bytes) const {
+  return std::chrono::nanoseconds(
+      static_cast<int64_t>(static_cast<double>(bytes) * cpu_cost_ns_per_byte));
+}
+
 void FuzzingEventEngine::FuzzingDone() {
   grpc_core::MutexLock lock(&*mu_);
   while (!task_delays_.empty()) task_delays_.pop();
@@ -321,21 +335,24 @@ bool FuzzingEventEngine::EndpointMiddle::Write(SliceBuffer* data, int index) {
   pending[index].resize(prev_len + write_len);
   // Move bytes from the to-write data into the pending buffer.
   data->MoveFirstNBytesIntoBuffer(write_len, pending[index].data() + prev_len);
-  // If there was a pending read, then we can fulfill it.
-  if (pending_read[peer_index].has_value()) {
-    pending_read[peer_index]->buffer->Append(
-        Slice::FromCopiedBuffer(pending[index]));
-    pending[index].clear();
-    g_fuzzing_event_engine->RunLocked(
-        RunType::kWrite,
-        [cb = std::move(pending_read[peer_index]->on_read)]() mutable {
-          cb(absl::OkStatus());
-        });
-    pending_read[peer_index].reset();
-  }
+  FulfillPendingRead(index);
   return data->Length() == 0;
 }
 
+void FuzzingEventEngine::EndpointMiddle::FulfillPendingRead(int index) {
+  const int peer_index = 1 - index;
+  if (!pending_read[peer_index].has_value()) return;
+  pending_read[peer_index]->buffer->Append(
+      Slice::FromCopiedBuffer(pending[index]));
+  pending[index].clear();
+  g_fuzzing_event_engine->RunLocked(
+      RunType::kWrite,
+      [cb = std::move(pending_read[peer_index]->on_read)]() mutable {
+        cb(absl::OkStatus());
+      });
+  pending_read[peer_index].reset();
+}
+
 bool FuzzingEventEngine::FuzzingEndpoint::Write(
     absl::AnyInvocable<void(absl::Status)> on_writable, SliceBuffer* data,
     const WriteArgs*) {
@@ -343,6 +360,12 @@ bool FuzzingEventEngine::FuzzingEndpoint::Write(
   grpc_core::MutexLock lock(&*mu_);
   CHECK(!middle_->closed[my_index()]);
   CHECK(!middle_->writing[my_index()]);
+  if (g_fuzzing_event_engine->network_model_.enabled() &&
+      data->Length() != 0) {
+    WriteThroughNetworkModel(middle_, my_index(), std::move(on_writable),
+                             data);
+    return false;
+  }
   // If the write succeeds immediately, then we return true.
   if (middle_->Write(data, my_index())) return true;
   middle_->writing[my_index()] = true;
@@ -377,6 +400,51 @@ void FuzzingEventEngine::FuzzingEndpoint::ScheduleDelayedWrite(
       });
 }
 
+void FuzzingEventEngine::FuzzingEndpoint::WriteThroughNetworkModel(
+    std::shared_ptr<EndpointMiddle> middle, int index,
+    absl::AnyInvocable<void(absl::Status)> on_writable, SliceBuffer* data) {
+  const NetworkModel& model = g_fuzzing_event_engine->network_model_;
+  std::vector<uint8_t> bytes(data->Length());
+  data->MoveFirstNBytesIntoBuffer(bytes.size(), bytes.data());
+  Time now;
+  {
+    grpc_core::MutexLock lock(&*now_mu_);
+    now = g_fuzzing_event_engine->now_;
+  }
+  // Bytes are transmitted after those of previous writes.
+  const Time sent = std::max(now, middle->link_free[index]) +
+                    model.TransmissionTime(bytes.size());
+  middle->link_free[index] = sent;
+  middle->in_flight[index] += bytes.size();
+  middle->writing[index] = true;
+  GRPC_TRACE_LOG(fuzzing_ee_writes, INFO)
+      << "WRITE[" << middle.get() << ":" << index << "]: " << bytes.size()
+      << " bytes, sent in " << (sent - now).count() << "ns";
+  const Duration cpu_cost = model.CpuCost(bytes.size());
+  g_fuzzing_event_engine->RunAfterLocked(
+      RunType::kExact, sent - now + model.cpu_cost_per_write + cpu_cost,
+      [middle, index, on_writable = std::move(on_writable)]() mutable {
+        grpc_core::ReleasableMutexLock lock(&*mu_);
+        CHECK(middle->writing[index]);
+        middle->writing[index] = false;
+        const bool closed = middle->closed[index];
+        lock.Release();
+        on_writable(closed ? absl::InternalError("Endpoint closed")
+                           : absl::OkStatus());
+      });
+  // The reader sees the bytes once they have crossed the network, and it has
+  // spent the CPU to receive them.
+  g_fuzzing_event_engine->RunAfterLocked(
+      RunType::kExact, sent - now + model.latency + cpu_cost,
+      [middle = std::move(middle), index, bytes = std::move(bytes)]() {
+        grpc_core::MutexLock lock(&*mu_);
+        middle->in_flight[index] -= bytes.size();
+        middle->pending[index].insert(middle->pending[index].end(),
+                                      bytes.begin(), bytes.end());
+        middle->FulfillPendingRead(index);
+      });
+}
+
 FuzzingEventEngine::FuzzingEndpoint::~FuzzingEndpoint() {
   grpc_core::MutexLock lock(&*mu_);
   middle_->closed[my_index()] = true;
@@ -388,7 +456,7 @@ FuzzingEventEngine::FuzzingEndpoint::~FuzzingEndpoint() {
         });
     middle_->pending_read[my_index()].reset();
   }
-  if (!middle_->writing[peer_index()] &&
+  if (!middle_->writing[peer_index()] && middle_->in_flight[my_index()] == 0 &&
       middle_->pending_read[peer_index()].has_value()) {
     g_fuzzing_event_engine->RunLocked(
         RunType::kRunAfter,
@@ -407,8 +475,10 @@ bool FuzzingEventEngine::FuzzingEndpoint::Read(
   grpc_core::MutexLock lock(&*mu_);
   CHECK(!middle_->closed[my_index()]);
   if (middle_->pending[peer_index()].empty()) {
-    // If the endpoint is closed, fail asynchronously.
-    if (middle_->closed[peer_index()]) {
+    // If the endpoint is closed, and none of the bytes it wrote are still
+    // crossing the network, fail asynchronously.
+    if (middle_->closed[peer_index()] &&
+        middle_->in_flight[peer_index()] == 0) {
       g_fuzzing_event_engine->RunLocked(
           RunType::kRunAfter, [on_read = std::move(on_read)]() mutable {
             on_read(absl::InternalError("Endpoint closed"));
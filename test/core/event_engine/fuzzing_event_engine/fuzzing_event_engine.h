@@ -53,9 +53,32 @@ namespace experimental {
 // It's only allowed to have one FuzzingEventEngine instantiated at a time.
 class FuzzingEventEngine : public EventEngine {
  public:
+  // Simulated network and CPU costs, applied to every connection, to study
+  // performance in simulated time. With the default model, bytes written are
+  // visible to the peer right away.
+  struct NetworkModel {
+    // One way delay between bytes leaving the writer and reaching the reader.
+    Duration latency = Duration::zero();
+    // Bytes per second in each direction of each connection: writes complete
+    // once their bytes have been transmitted. Zero is unlimited.
+    uint64_t bandwidth = 0;
+    // Delay added to each write, and per byte on each side. Operations do not
+    // contend for CPU.
+    Duration cpu_cost_per_write = Duration::zero();
+    double cpu_cost_ns_per_byte = 0;
+
+    bool enabled() const {
+      return latency != Duration::zero() || bandwidth != 0 ||
+             cpu_cost_per_write != Duration::zero() ||
+             cpu_cost_ns_per_byte != 0;
+    }
+    Duration TransmissionTime(size_t bytes) const;
+    Duration CpuCost(size_t bytes) const;
+  };
   struct Options {
     Duration max_delay_run_after = std::chrono::seconds(30);
     Duration max_delay_write = std::chrono::seconds(30);
+    NetworkModel network_model;
   };
   explicit FuzzingEventEngine(Options options,
                               const fuzzing_event_engine::Actions& actions);
@@ -205,10 +228,16 @@ class FuzzingEventEngine : public EventEngine {
     std::queue<size_t> write_sizes[2] ABSL_GUARDED_BY(mu_);
     // The next read that's pending (or nullopt).
     absl::optional<PendingRead> pending_read[2] ABSL_GUARDED_BY(mu_);
+    // With a network model: when the bytes written so far will have left each
+    // endpoint, and the number of bytes on their way to the peer.
+    Time link_free[2] ABSL_GUARDED_BY(mu_) = {};
+    size_t in_flight[2] ABSL_GUARDED_BY(mu_) = {0, 0};
 
     // Helper to take some bytes from data and queue them into pending[index].
     // Returns true if all bytes were consumed, false if more writes are needed.
     bool Write(SliceBuffer* data, int index) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+    // Hands the bytes in pending[index] to the peer's pending read, if any.
+    void FulfillPendingRead(int index) ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   };
 
   // Implementation of Endpoint.
@@ -245,6 +274,12 @@ class FuzzingEventEngine : public EventEngine {
         std::shared_ptr<EndpointMiddle> middle, int index,
         absl::AnyInvocable<void(absl::Status)> on_writable, SliceBuffer* data)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+    // Write all of data through the network model: schedules the completion
+    // of the write, and the delivery of the bytes to the peer.
+    static void WriteThroughNetworkModel(
+        std::shared_ptr<EndpointMiddle> middle, int index,
+        absl::AnyInvocable<void(absl::Status)> on_writable, SliceBuffer* data)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
     const std::shared_ptr<EndpointMiddle> middle_;
     const int index_;
   };
@@ -280,6 +315,7 @@ class FuzzingEventEngine : public EventEngine {
   Duration exponential_gate_time_increment_ ABSL_GUARDED_BY(mu_) =
       std::chrono::milliseconds(1);
   const Duration max_delay_[2];
+  const NetworkModel network_model_;
   intptr_t next_task_id_ ABSL_GUARDED_BY(mu_);
   intptr_t current_tick_ ABSL_GUARDED_BY(now_mu_);
   Time now_ ABSL_GUARDED_BY(now_mu_);
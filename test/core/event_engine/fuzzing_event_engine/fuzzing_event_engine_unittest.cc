@@ -16,14 +16,33 @@
 
 #include "test/core/event_engine/fuzzing_event_engine/fuzzing_event_engine.h"
 
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
 #include "absl/synchronization/notification.h"
+#include "absl/types/optional.h"
 #include "gtest/gtest.h"
 
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
 
+using ::grpc_event_engine::experimental::ChannelArgsEndpointConfig;
+using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::FuzzingEventEngine;
+using ::grpc_event_engine::experimental::MemoryAllocator;
+using ::grpc_event_engine::experimental::Slice;
+using ::grpc_event_engine::experimental::SliceBuffer;
+using ::grpc_event_engine::experimental::URIToResolvedAddress;
 
 TEST(FuzzingEventEngine, RunAfterAndTickForDuration) {
   auto fuzzing_ee = std::make_shared<FuzzingEventEngine>(
@@ -43,6 +62,149 @@ TEST(FuzzingEventEngine, RunAfterAndTickForDuration) {
   EXPECT_TRUE(notification2.HasBeenNotified());
 }
 
+// A connection between two endpoints, through a network model.
+class NetworkModelTest : public ::testing::Test {
+ protected:
+  void Connect(FuzzingEventEngine::NetworkModel model) {
+    FuzzingEventEngine::Options options;
+    options.network_model = model;
+    engine_ = std::make_shared<FuzzingEventEngine>(
+        options, fuzzing_event_engine::Actions());
+    ChannelArgsEndpointConfig config;
+    auto listener = engine_->CreateListener(
+        [this](std::unique_ptr<EventEngine::Endpoint> endpoint,
+               MemoryAllocator) { server_ = std::move(endpoint); },
+        [](absl::Status) {}, config,
+        std::make_unique<grpc_core::MemoryQuota>("listener"));
+    ASSERT_TRUE(listener.ok()) << listener.status();
+    listener_ = std::move(*listener);
+    auto port = listener_->Bind(*URIToResolvedAddress("ipv4:127.0.0.1:0"));
+    ASSERT_TRUE(port.ok()) << port.status();
+    ASSERT_TRUE(listener_->Start().ok());
+    engine_->Connect(
+        [this](absl::StatusOr<std::unique_ptr<EventEngine::Endpoint>>
+                   endpoint) {
+          ASSERT_TRUE(endpoint.ok()) << endpoint.status();
+          client_ = std::move(*endpoint);
+        },
+        *URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", *port)), config,
+        memory_quota_.CreateMemoryAllocator("client"), std::chrono::seconds(5));
+    while (client_ == nullptr || server_ == nullptr) engine_->Tick();
+  }
+
+  void TearDown() override {
+    client_.reset();
+    server_.reset();
+    listener_.reset();
+    engine_->TickUntilIdle();
+    engine_->UnsetGlobalHooks();
+  }
+
+  void ClientWrite(std::string data) {
+    write_status_.reset();
+    write_buffer_.Clear();
+    write_buffer_.Append(Slice::FromCopiedString(std::move(data)));
+    EventEngine::Endpoint::WriteArgs args;
+    if (client_->Write([this](absl::Status status) { write_status_ = status; },
+                       &write_buffer_, &args)) {
+      write_status_ = absl::OkStatus();
+    }
+  }
+
+  void ServerRead() {
+    read_status_.reset();
+    EventEngine::Endpoint::ReadArgs args;
+    if (server_->Read([this](absl::Status status) { read_status_ = status; },
+                      &read_buffer_, &args)) {
+      read_status_ = absl::OkStatus();
+    }
+  }
+
+  std::string TakeReadData() {
+    std::string data(read_buffer_.Length(), '\0');
+    read_buffer_.MoveFirstNBytesIntoBuffer(data.size(), &data[0]);
+    return data;
+  }
+
+  std::shared_ptr<FuzzingEventEngine> engine_;
+  grpc_core::MemoryQuota memory_quota_{"client"};
+  std::unique_ptr<EventEngine::Listener> listener_;
+  std::unique_ptr<EventEngine::Endpoint> client_;
+  std::unique_ptr<EventEngine::Endpoint> server_;
+  SliceBuffer write_buffer_;
+  SliceBuffer read_buffer_;
+  absl::optional<absl::Status> write_status_;
+  absl::optional<absl::Status> read_status_;
+};
+
+TEST_F(NetworkModelTest, LatencyDelaysReads) {
+  FuzzingEventEngine::NetworkModel model;
+  model.latency = std::chrono::milliseconds(20);
+  Connect(model);
+  ServerRead();
+  ClientWrite("hello");
+  engine_->TickForDuration(std::chrono::milliseconds(15));
+  EXPECT_EQ(write_status_, absl::OkStatus());
+  EXPECT_FALSE(read_status_.has_value());
+  engine_->TickForDuration(std::chrono::milliseconds(10));
+  ASSERT_EQ(read_status_, absl::OkStatus());
+  EXPECT_EQ(TakeReadData(), "hello");
+}
+
+TEST_F(NetworkModelTest, BandwidthDelaysWrites) {
+  FuzzingEventEngine::NetworkModel model;
+  model.bandwidth = 1000 * 1000;
+  Connect(model);
+  // Takes 100ms to transmit.
+  ClientWrite(std::string(100 * 1000, 'a'));
+  engine_->TickForDuration(std::chrono::milliseconds(90));
+  EXPECT_FALSE(write_status_.has_value());
+  engine_->TickForDuration(std::chrono::milliseconds(20));
+  EXPECT_EQ(write_status_, absl::OkStatus());
+  ServerRead();
+  engine_->TickForDuration(std::chrono::milliseconds(1));
+  ASSERT_EQ(read_status_, absl::OkStatus());
+  EXPECT_EQ(read_buffer_.Length(), 100 * 1000);
+}
+
+TEST_F(NetworkModelTest, CpuCostDelaysWritesAndReads) {
+  FuzzingEventEngine::NetworkModel model;
+  model.cpu_cost_per_write = std::chrono::milliseconds(10);
+  model.cpu_cost_ns_per_byte = 1000 * 1000;
+  Connect(model);
+  ServerRead();
+  // 10ms + 5ms to write, 5ms to read.
+  ClientWrite("hello");
+  engine_->TickForDuration(std::chrono::milliseconds(3));
+  EXPECT_FALSE(write_status_.has_value());
+  EXPECT_FALSE(read_status_.has_value());
+  engine_->TickForDuration(std::chrono::milliseconds(5));
+  EXPECT_FALSE(write_status_.has_value());
+  EXPECT_EQ(read_status_, absl::OkStatus());
+  engine_->TickForDuration(std::chrono::milliseconds(10));
+  EXPECT_EQ(write_status_, absl::OkStatus());
+}
+
+TEST_F(NetworkModelTest, BytesInFlightAreReadAfterClose) {
+  FuzzingEventEngine::NetworkModel model;
+  model.latency = std::chrono::milliseconds(20);
+  Connect(model);
+  ServerRead();
+  ClientWrite("bye");
+  engine_->TickForDuration(std::chrono::milliseconds(5));
+  EXPECT_EQ(write_status_, absl::OkStatus());
+  client_.reset();
+  engine_->TickForDuration(std::chrono::milliseconds(5));
+  EXPECT_FALSE(read_status_.has_value());
+  engine_->TickForDuration(std::chrono::milliseconds(15));
+  ASSERT_EQ(read_status_, absl::OkStatus());
+  EXPECT_EQ(TakeReadData(), "bye");
+  ServerRead();
+  engine_->TickForDuration(std::chrono::milliseconds(1));
+  ASSERT_TRUE(read_status_.has_value());
+  EXPECT_FALSE(read_status_->ok());
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -20,8 +20,11 @@
 #include <chrono>
 #include <cstring>
 #include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
+#include "absl/functional/function_ref.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
@@ -29,6 +32,8 @@
 #include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
 
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/grpc.h>
 
 #include "src/core/lib/config/config_vars.h"
@@ -60,6 +65,7 @@
 
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
@@ -701,6 +707,271 @@ TEST_F(EventPollerTest, TestMultipleHandles) {
   worker->Wait();
 }
 
+// Runs the same scenarios against the io_uring poller, which is not one of the
+// strategies the test is otherwise run with. The tests return early if the
+// kernel does not support io_uring.
+class IoUringPollerTest : public ::testing::Test {
+  void SetUp() override {
+    engine_ =
+        std::make_unique<grpc_event_engine::experimental::PosixEventEngine>();
+    scheduler_ =
+        std::make_unique<grpc_event_engine::experimental::TestScheduler>(
+            engine_.get());
+    g_event_poller = MakeIoUringPoller(scheduler_.get());
+    if (g_event_poller == nullptr) {
+      LOG(INFO) << "io_uring is not available, skipping";
+      return;
+    }
+    engine_ = PosixEventEngine::MakeTestOnlyPosixEventEngine(g_event_poller);
+    scheduler_->ChangeCurrentEventEngine(engine_.get());
+  }
+
+  void TearDown() override {
+    if (g_event_poller != nullptr) {
+      g_event_poller->Shutdown();
+    }
+    g_event_poller.reset();
+  }
+
+ public:
+  TestScheduler* Scheduler() { return scheduler_.get(); }
+
+ private:
+  std::shared_ptr<grpc_event_engine::experimental::PosixEventEngine> engine_;
+  std::unique_ptr<grpc_event_engine::experimental::TestScheduler> scheduler_;
+};
+
+// Calls Work() until \a done returns true, failing if that takes too long.
+void WorkUntil(absl::FunctionRef<bool()> done) {
+  const auto deadline = std::chrono::steady_clock::now() + 30s;
+  while (!done()) {
+    ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+    g_event_poller->Work(100ms, []() {});
+  }
+}
+
+void MakeNonBlockingSocketPair(int sv[2]) {
+  EXPECT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+  for (int i = 0; i < 2; ++i) {
+    int flags = fcntl(sv[i], F_GETFL, 0);
+    EXPECT_EQ(fcntl(sv[i], F_SETFL, flags | O_NONBLOCK), 0);
+  }
+}
+
+TEST_F(IoUringPollerTest, TestEventPollerHandle) {
+  server sv;
+  client cl;
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  ServerInit(&sv);
+  int port = ServerStart(&sv);
+  ClientInit(&cl);
+  ClientStart(&cl, port);
+  WaitAndShutdown(&sv, &cl);
+  EXPECT_EQ(sv.read_bytes_total, cl.write_bytes_total);
+}
+
+TEST_F(IoUringPollerTest, TestMultipleHandles) {
+  static constexpr int kNumHandles = 100;
+  static constexpr int kNumWakeupsPerHandle = 100;
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  Worker* worker = new Worker(Scheduler(), g_event_poller.get(), kNumHandles,
+                              kNumWakeupsPerHandle);
+  worker->Start();
+  worker->Wait();
+}
+
+// Polls armed while no thread is in Work() are only queued; the next Work()
+// submits all of them with the same io_uring_enter() it waits in, and picks
+// up every fd that is ready.
+TEST_F(IoUringPollerTest, QueuedPollsAreSubmittedByWork) {
+  static constexpr int kNumHandles = 16;
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  int fds[kNumHandles][2];
+  EventHandle* handles[kNumHandles];
+  std::atomic<int> num_ready{0};
+  for (int i = 0; i < kNumHandles; ++i) {
+    MakeNonBlockingSocketPair(fds[i]);
+    handles[i] = g_event_poller->CreateHandle(fds[i][0], "queued", false);
+    handles[i]->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+        [&num_ready](absl::Status status) {
+          EXPECT_TRUE(status.ok());
+          ++num_ready;
+        }));
+  }
+  char data = 0;
+  for (int i = 0; i < kNumHandles; ++i) {
+    EXPECT_EQ(write(fds[i][1], &data, 1), 1);
+  }
+  WorkUntil([&num_ready]() { return num_ready.load() == kNumHandles; });
+  for (int i = 0; i < kNumHandles; ++i) {
+    handles[i]->OrphanHandle(nullptr, nullptr, "done");
+    close(fds[i][1]);
+  }
+}
+
+// A recycled handle must be able to arm its own polls even though those of
+// its previous user have not completed yet.
+TEST_F(IoUringPollerTest, RecycledHandleCanBeArmed) {
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  int first[2];
+  int second[2];
+  MakeNonBlockingSocketPair(first);
+  MakeNonBlockingSocketPair(second);
+  EventHandle* handle = g_event_poller->CreateHandle(first[0], "first", false);
+  handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [](absl::Status status) { EXPECT_FALSE(status.ok()); }));
+  int released_fd = -1;
+  handle->OrphanHandle(nullptr, &released_fd, "recycle");
+  EXPECT_EQ(released_fd, first[0]);
+  EventHandle* recycled =
+      g_event_poller->CreateHandle(second[0], "second", false);
+  EXPECT_EQ(recycled, handle);
+  std::atomic<bool> readable{false};
+  recycled->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [&readable](absl::Status status) {
+        EXPECT_TRUE(status.ok());
+        readable.store(true);
+      }));
+  char data = 0;
+  EXPECT_EQ(write(second[1], &data, 1), 1);
+  WorkUntil([&readable]() { return readable.load(); });
+  recycled->OrphanHandle(nullptr, nullptr, "done");
+  close(first[0]);
+  close(first[1]);
+  close(second[1]);
+}
+
+// Waits for the handle to become readable, then takes what it received.
+// Returns false once the poller hands reading back to the owner.
+bool ReceiveAll(EventHandle* handle, std::string& out, bool& eof) {
+  std::atomic<bool> readable{false};
+  handle->NotifyOnRead(PosixEngineClosure::TestOnlyToClosure(
+      [&readable](absl::Status status) {
+        EXPECT_TRUE(status.ok());
+        readable.store(true);
+      }));
+  WorkUntil([&readable]() { return readable.load(); });
+  while (true) {
+    SliceBuffer buffer;
+    const int64_t received = handle->ReceiveData(buffer);
+    if (received < 0) {
+      if (errno == EOPNOTSUPP) return false;
+      EXPECT_EQ(errno, EAGAIN);
+      return true;
+    }
+    if (received == 0) {
+      eof = true;
+      return true;
+    }
+    EXPECT_EQ(static_cast<size_t>(received), buffer.Length());
+    while (buffer.Count() > 0) {
+      out.append(std::string(buffer.TakeFirst().as_string_view()));
+    }
+  }
+}
+
+// A receiving handle queues the data of its socket, in order, until the end
+// of the stream; nothing is left for a read of the fd. If the kernel turns
+// out not to support multishot receives, the data is left in the socket.
+TEST_F(IoUringPollerTest, ReceivesUntilEndOfStream) {
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  int fds[2];
+  MakeNonBlockingSocketPair(fds);
+  EventHandle* handle = g_event_poller->CreateHandle(fds[0], "recv", false);
+  if (!handle->StartReceiving()) {
+    LOG(INFO) << "multishot receive is not available, skipping";
+    handle->OrphanHandle(nullptr, nullptr, "done");
+    close(fds[1]);
+    return;
+  }
+  const std::string message = "hello, world";
+  EXPECT_EQ(write(fds[1], message.data(), message.size()),
+            static_cast<ssize_t>(message.size()));
+  std::string received;
+  bool eof = false;
+  if (!ReceiveAll(handle, received, eof)) {
+    char data[64];
+    EXPECT_EQ(read(fds[0], data, sizeof(data)),
+              static_cast<ssize_t>(message.size()));
+    handle->OrphanHandle(nullptr, nullptr, "done");
+    close(fds[1]);
+    return;
+  }
+  close(fds[1]);
+  while (!eof) {
+    ASSERT_TRUE(ReceiveAll(handle, received, eof));
+  }
+  EXPECT_EQ(received, message);
+  char data;
+  EXPECT_EQ(read(fds[0], &data, 1), 0);
+  handle->OrphanHandle(nullptr, nullptr, "done");
+}
+
+// Much more than a handle queues before it pauses is written while the
+// owner only takes the data now and then: pausing and resuming the receive
+// must neither lose nor reorder any of it.
+TEST_F(IoUringPollerTest, ReceivePausesWithoutLosingData) {
+  static constexpr size_t kBytes = 8 * 1024 * 1024;
+  if (g_event_poller == nullptr) {
+    return;
+  }
+  int fds[2];
+  MakeNonBlockingSocketPair(fds);
+  EventHandle* handle = g_event_poller->CreateHandle(fds[0], "recv", false);
+  if (!handle->StartReceiving()) {
+    LOG(INFO) << "multishot receive is not available, skipping";
+    handle->OrphanHandle(nullptr, nullptr, "done");
+    close(fds[1]);
+    return;
+  }
+  std::string sent(kBytes, '\0');
+  for (size_t i = 0; i < kBytes; ++i) {
+    sent[i] = static_cast<char>(i * 7 + i / 4096);
+  }
+  std::thread writer([&sent, fd = fds[1]]() {
+    int flags = fcntl(fd, F_GETFL, 0);
+    EXPECT_EQ(fcntl(fd, F_SETFL, flags & ~O_NONBLOCK), 0);
+    size_t written = 0;
+    while (written < sent.size()) {
+      ssize_t n = write(fd, sent.data() + written, sent.size() - written);
+      ASSERT_GT(n, 0);
+      written += n;
+    }
+    close(fd);
+  });
+  std::string received;
+  bool eof = false;
+  bool receiving = true;
+  while (receiving && !eof) {
+    // Let completions pile up before taking them.
+    for (int i = 0; i < 8; ++i) g_event_poller->Work(1ms, []() {});
+    receiving = ReceiveAll(handle, received, eof);
+  }
+  if (!receiving) {
+    LOG(INFO) << "multishot receive is not available, skipping";
+    int flags = fcntl(fds[0], F_GETFL, 0);
+    EXPECT_EQ(fcntl(fds[0], F_SETFL, flags & ~O_NONBLOCK), 0);
+    char data[4096];
+    while (read(fds[0], data, sizeof(data)) > 0) {
+    }
+  } else {
+    EXPECT_EQ(received.size(), sent.size());
+    EXPECT_TRUE(received == sent);
+  }
+  writer.join();
+  handle->OrphanHandle(nullptr, nullptr, "done");
+}
+
 }  // namespace
 }  // namespace experimental
 }  // namespace grpc_event_engine
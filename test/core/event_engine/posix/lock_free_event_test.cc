@@ -187,6 +187,25 @@ void BM_LockFreeEvent(benchmark::State& state) {
 }
 BENCHMARK(BM_LockFreeEvent)->ThreadRange(1, 64);
 
+// The same as BM_LockFreeEvent, but the event becomes ready before the
+// callback is registered: the common case for writes, and for reads when data
+// arrives faster than it is consumed.
+void BM_LockFreeEventReadyBeforeNotify(benchmark::State& state) {
+  BechmarkCallbackScheduler cb_scheduler;
+  LockfreeEvent event(&cb_scheduler);
+  event.InitEvent();
+  PosixEngineClosure* notify_on_closure =
+      PosixEngineClosure::ToPermanentClosure([](absl::Status /*status*/) {});
+  for (auto s : state) {
+    event.SetReady();
+    event.NotifyOn(notify_on_closure);
+  }
+  event.SetShutdown(absl::CancelledError("Shutting down"));
+  delete notify_on_closure;
+  event.DestroyEvent();
+}
+BENCHMARK(BM_LockFreeEventReadyBeforeNotify)->ThreadRange(1, 64);
+
 }  // namespace
 
 }  // namespace experimental
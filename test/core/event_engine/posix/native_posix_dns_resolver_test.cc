@@ -0,0 +1,155 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/native_posix_dns_resolver.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/port.h"
+#include "test/core/event_engine/util/aborting_event_engine.h"
+#include "test/core/test_util/test_config.h"
+
+#ifdef GRPC_POSIX_SOCKET_RESOLVE_ADDRESS
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+// An engine that holds on to the closures it is asked to run until the test
+// runs them.
+class HoldingEventEngine : public AbortingEventEngine {
+ public:
+  void Run(absl::AnyInvocable<void()> closure) override {
+    grpc_core::MutexLock lock(&mu_);
+    closures_.push_back(std::move(closure));
+  }
+
+  size_t NumHeld() {
+    grpc_core::MutexLock lock(&mu_);
+    return closures_.size();
+  }
+
+  // Runs the held closures, including those they add, on this thread.
+  void RunHeld() {
+    while (true) {
+      absl::AnyInvocable<void()> closure;
+      {
+        grpc_core::MutexLock lock(&mu_);
+        if (closures_.empty()) return;
+        closure = std::move(closures_.front());
+        closures_.erase(closures_.begin());
+      }
+      closure();
+    }
+  }
+
+ private:
+  grpc_core::Mutex mu_;
+  std::vector<absl::AnyInvocable<void()>> closures_ ABSL_GUARDED_BY(mu_);
+};
+
+class LookupResults {
+ public:
+  EventEngine::DNSResolver::LookupHostnameCallback Callback() {
+    return [this](absl::StatusOr<std::vector<EventEngine::ResolvedAddress>>
+                      addresses) {
+      grpc_core::MutexLock lock(&mu_);
+      EXPECT_TRUE(addresses.ok()) << addresses.status();
+      ++count_;
+    };
+  }
+
+  int count() {
+    grpc_core::MutexLock lock(&mu_);
+    return count_;
+  }
+
+ private:
+  grpc_core::Mutex mu_;
+  int count_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+TEST(NativePosixDNSResolverTest, LookupsOfOneNameAreCoalesced) {
+  auto engine = std::make_shared<HoldingEventEngine>();
+  NativePosixDNSResolver resolver(engine);
+  LookupResults results;
+  for (int i = 0; i < 3; ++i) {
+    resolver.LookupHostname(results.Callback(), "localhost:1", "");
+  }
+  // A single task looks up the name for all three.
+  EXPECT_EQ(engine->NumHeld(), 1u);
+  engine->RunHeld();
+  EXPECT_EQ(results.count(), 3);
+}
+
+TEST(NativePosixDNSResolverTest, AtMostFourLookupsAreInFlightPerEngine) {
+  auto engine = std::make_shared<HoldingEventEngine>();
+  NativePosixDNSResolver resolver(engine);
+  LookupResults results;
+  for (int i = 0; i < 10; ++i) {
+    resolver.LookupHostname(results.Callback(), absl::StrCat("localhost:", i),
+                            "");
+  }
+  EXPECT_EQ(engine->NumHeld(), 4u);
+  engine->RunHeld();
+  EXPECT_EQ(results.count(), 10);
+}
+
+// The lookups of an engine whose tasks cannot run, e.g. because its threads
+// are all busy, must not hold up the lookups of another engine, nor may the
+// other engine's lookups run on its threads.
+TEST(NativePosixDNSResolverTest, EnginesDoNotShareLookups) {
+  auto engine1 = std::make_shared<HoldingEventEngine>();
+  auto engine2 = std::make_shared<HoldingEventEngine>();
+  NativePosixDNSResolver resolver1(engine1);
+  NativePosixDNSResolver resolver2(engine2);
+  LookupResults results1;
+  LookupResults results2;
+  for (int i = 0; i < 5; ++i) {
+    resolver1.LookupHostname(results1.Callback(),
+                             absl::StrCat("localhost:", i), "");
+  }
+  EXPECT_EQ(engine1->NumHeld(), 4u);
+  // The same name as one queued on the first engine.
+  resolver2.LookupHostname(results2.Callback(), "localhost:1", "");
+  EXPECT_EQ(engine2->NumHeld(), 1u);
+  engine2->RunHeld();
+  EXPECT_EQ(results2.count(), 1);
+  EXPECT_EQ(results1.count(), 0);
+  engine1->RunHeld();
+  EXPECT_EQ(results1.count(), 5);
+  EXPECT_EQ(results2.count(), 1);
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+#endif  // GRPC_POSIX_SOCKET_RESOLVE_ADDRESS
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Tests of the POSIX EventEngine's timers with GRPC_EVENT_ENGINE_POLLER_TIMERS
+// set, i.e. with the timers run from the poller loop.
+
+#include <sys/resource.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "test/core/event_engine/event_engine_test_utils.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+using namespace std::chrono_literals;
+
+// CPU time used by the whole process so far.
+absl::Duration ProcessCpuTime() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return absl::DurationFromTimeval(usage.ru_utime) +
+         absl::DurationFromTimeval(usage.ru_stime);
+}
+
+TEST(PollerTimersTest, TimersFireNoEarlierThanTheirDeadline) {
+  auto engine = std::make_shared<PosixEventEngine>();
+  const std::vector<EventEngine::Duration> delays = {0ms,  500us, 1ms,
+                                                     5ms,  20ms,  100ms};
+  std::vector<grpc_core::Notification> fired(delays.size());
+  std::vector<absl::Time> fired_at(delays.size());
+  const absl::Time start = absl::Now();
+  for (size_t i = 0; i < delays.size(); ++i) {
+    engine->RunAfter(delays[i], [&fired, &fired_at, i]() {
+      fired_at[i] = absl::Now();
+      fired[i].Notify();
+    });
+  }
+  for (size_t i = 0; i < delays.size(); ++i) {
+    ASSERT_TRUE(fired[i].WaitForNotificationWithTimeout(absl::Seconds(30)));
+    EXPECT_GE(fired_at[i] - start, absl::FromChrono(delays[i]));
+  }
+  WaitForSingleOwner(std::move(engine));
+}
+
+// A timer that is due in less than a millisecond must not turn the poll
+// timeout into zero, which would spin the poller thread until the timer is
+// due. Back to back sub-millisecond timers would then keep a core busy.
+TEST(PollerTimersTest, SubMillisecondTimersDoNotSpin) {
+  auto engine = std::make_shared<PosixEventEngine>();
+  constexpr int kNumTimers = 300;
+  std::atomic<int> remaining{kNumTimers};
+  grpc_core::Notification done;
+  std::function<void()> schedule_next = [&]() {
+    engine->RunAfter(500us, [&]() {
+      if (--remaining == 0) {
+        done.Notify();
+        return;
+      }
+      schedule_next();
+    });
+  };
+  const absl::Time start = absl::Now();
+  const absl::Duration start_cpu = ProcessCpuTime();
+  schedule_next();
+  ASSERT_TRUE(done.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  const absl::Duration wall = absl::Now() - start;
+  const absl::Duration cpu = ProcessCpuTime() - start_cpu;
+  // A spinning poller thread uses about as much CPU as wall time passes.
+  EXPECT_LT(cpu, wall / 2) << "cpu=" << cpu << " wall=" << wall;
+  WaitForSingleOwner(std::move(engine));
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.event_engine_poller_timers = true;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -14,13 +14,22 @@
 
 #include "src/core/lib/event_engine/posix_engine/posix_endpoint.h"
 
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <memory>
+#include <set>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "absl/log/check.h"
@@ -29,25 +38,33 @@
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "gtest/gtest.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
 #include <grpc/grpc.h>
 #include <grpc/impl/channel_arg_names.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/event_engine/extensions/tcp_info.h"
 #include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/ev_io_uring_linux.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller.h"
 #include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine.h"
 #include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
 #include "src/core/lib/event_engine/posix_engine/tcp_socket_utils.h"
+#include "src/core/lib/event_engine/query_extensions.h"
 #include "src/core/lib/event_engine/tcp_socket_utils.h"
 #include "src/core/lib/gprpp/dual_ref_counted.h"
 #include "src/core/lib/gprpp/notification.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/event_engine/event_engine_test_utils.h"
 #include "test/core/event_engine/posix/posix_engine_test_utils.h"
@@ -144,8 +161,14 @@ std::list<Connection> CreateConnectedEndpoints(
 
 }  // namespace
 
-std::string TestScenarioName(const ::testing::TestParamInfo<bool>& info) {
-  return absl::StrCat("is_zero_copy_enabled_", info.param);
+// Whether zero copy is enabled, and whether to use the io_uring poller,
+// which receives the data of the sockets itself where the kernel supports it.
+using TestScenario = std::tuple<bool, bool>;
+
+std::string TestScenarioName(
+    const ::testing::TestParamInfo<TestScenario>& info) {
+  return absl::StrCat("is_zero_copy_enabled_", std::get<0>(info.param),
+                      std::get<1>(info.param) ? "_io_uring" : "");
 }
 
 // A helper class to drive the polling of Fds. It repeatedly calls the Work(..)
@@ -192,14 +215,18 @@ class Worker : public grpc_core::DualRefCounted<Worker> {
   grpc_core::Notification signal;
 };
 
-class PosixEndpointTest : public ::testing::TestWithParam<bool> {
+class PosixEndpointTest : public ::testing::TestWithParam<TestScenario> {
   void SetUp() override {
     oracle_ee_ = std::make_shared<PosixOracleEventEngine>();
     scheduler_ =
         std::make_unique<grpc_event_engine::experimental::TestScheduler>(
             posix_ee_.get());
     EXPECT_NE(scheduler_, nullptr);
-    poller_ = MakeDefaultPoller(scheduler_.get());
+    if (std::get<1>(GetParam())) {
+      poller_ = MakeIoUringPoller(scheduler_.get());
+    } else {
+      poller_ = MakeDefaultPoller(scheduler_.get());
+    }
     posix_ee_ = PosixEventEngine::MakeTestOnlyPosixEventEngine(poller_);
     EXPECT_NE(posix_ee_, nullptr);
     scheduler_->ChangeCurrentEventEngine(posix_ee_.get());
@@ -225,6 +252,8 @@ class PosixEndpointTest : public ::testing::TestWithParam<bool> {
 
   PosixEventPoller* PosixPoller() { return poller_.get(); }
 
+  bool ZeroCopyEnabled() const { return std::get<0>(GetParam()); }
+
  private:
   std::shared_ptr<PosixEventPoller> poller_;
   std::unique_ptr<TestScheduler> scheduler_;
@@ -239,8 +268,9 @@ TEST_P(PosixEndpointTest, ConnectExchangeBidiDataTransferTest) {
   Worker* worker = new Worker(GetPosixEE(), PosixPoller());
   worker->Start();
   {
-    auto connections = CreateConnectedEndpoints(*PosixPoller(), GetParam(), 1,
-                                                GetPosixEE(), GetOracleEE());
+    auto connections =
+        CreateConnectedEndpoints(*PosixPoller(), ZeroCopyEnabled(), 1,
+                                 GetPosixEE(), GetOracleEE());
     auto it = connections.begin();
     auto client_endpoint = std::move((*it).client_endpoint);
     auto server_endpoint = std::move((*it).server_endpoint);
@@ -266,6 +296,44 @@ TEST_P(PosixEndpointTest, ConnectExchangeBidiDataTransferTest) {
   worker->Wait();
 }
 
+TEST_P(PosixEndpointTest, TcpInfoSamplingTest) {
+  if (PosixPoller() == nullptr) {
+    return;
+  }
+  Worker* worker = new Worker(GetPosixEE(), PosixPoller());
+  worker->Start();
+  {
+    auto connections =
+        CreateConnectedEndpoints(*PosixPoller(), ZeroCopyEnabled(), 1,
+                                 GetPosixEE(), GetOracleEE());
+    auto client_endpoint = std::move(connections.front().client_endpoint);
+    auto server_endpoint = std::move(connections.front().server_endpoint);
+    auto* tcp_info =
+        QueryExtension<EndpointTcpInfoExtension>(client_endpoint.get());
+    ASSERT_NE(tcp_info, nullptr);
+    std::atomic<int> num_samples{0};
+    const bool sampling = tcp_info->EnableTcpInfoSampling(
+        std::chrono::milliseconds(1),
+        [&num_samples](const EndpointTcpInfoExtension::TcpInfo& sample) {
+          EXPECT_GT(sample.snd_cwnd, 0);
+          num_samples.fetch_add(1, std::memory_order_relaxed);
+        });
+    for (int i = 0; i < kNumExchangedMessages; i++) {
+      ASSERT_TRUE(SendValidatePayload(GetNextSendMessage(),
+                                      client_endpoint.get(),
+                                      server_endpoint.get())
+                      .ok());
+      absl::SleepFor(absl::Milliseconds(2));
+    }
+    if (sampling) {
+      EXPECT_GT(num_samples.load(std::memory_order_relaxed), 0);
+    } else {
+      EXPECT_EQ(num_samples.load(std::memory_order_relaxed), 0);
+    }
+  }
+  worker->Wait();
+}
+
 // Create  N connections and exchange and verify random number of messages over
 // each connection in parallel.
 TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
@@ -274,8 +342,9 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   }
   Worker* worker = new Worker(GetPosixEE(), PosixPoller());
   worker->Start();
-  auto connections = CreateConnectedEndpoints(
-      *PosixPoller(), GetParam(), kNumConnections, GetPosixEE(), GetOracleEE());
+  auto connections =
+      CreateConnectedEndpoints(*PosixPoller(), ZeroCopyEnabled(),
+                               kNumConnections, GetPosixEE(), GetOracleEE());
   std::vector<std::thread> threads;
   // Create one thread for each connection. For each connection, create
   // 2 more worker threads: to exchange and verify bi-directional data transfer.
@@ -325,9 +394,193 @@ TEST_P(PosixEndpointTest, MultipleIPv6ConnectionsToOneOracleListenerTest) {
   worker->Wait();
 }
 
-// Test with zero copy enabled and disabled.
+// Test with zero copy enabled and disabled, over the default and the io_uring
+// poller. The io_uring runs return early if the kernel does not support it.
 INSTANTIATE_TEST_SUITE_P(PosixEndpoint, PosixEndpointTest,
-                         ::testing::ValuesIn({false, true}), &TestScenarioName);
+                         ::testing::Combine(::testing::Bool(),
+                                            ::testing::Bool()),
+                         &TestScenarioName);
+
+// With GRPC_EVENT_ENGINE_POLLER_INLINE_BATCH set, reads that become ready in
+// the same poller wakeup all complete on the polling thread, one after the
+// other, rather than each being scheduled onto the thread pool.
+TEST(PosixEndpointInlineBatchTest, ReadyEndpointsAreDrainedInline) {
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.event_engine_poller_inline_batch = kNumConnections;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  auto posix_ee = std::make_shared<PosixEventEngine>();
+  grpc_core::ChannelArgs args = grpc_core::ChannelArgs().Set(
+      GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default());
+  ChannelArgsEndpointConfig config(args);
+  // The poller may wake up before the last of the peers below has written,
+  // splitting the reads over two wakeups; try a few times.
+  bool drained_inline = false;
+  for (int attempt = 0; attempt < 10 && !drained_inline; ++attempt) {
+    std::vector<std::unique_ptr<Endpoint>> endpoints;
+    std::vector<int> peer_fds;
+    for (int i = 0; i < kNumConnections; ++i) {
+      int fds[2];
+      ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+      endpoints.push_back(posix_ee->CreateEndpointFromFd(fds[0], config));
+      peer_fds.push_back(fds[1]);
+    }
+    std::vector<SliceBuffer> buffers(kNumConnections);
+    grpc_core::Mutex mu;
+    std::set<std::thread::id> read_threads;
+    std::atomic<int> pending_reads{kNumConnections};
+    grpc_core::Notification reads_done;
+    for (int i = 0; i < kNumConnections; ++i) {
+      ASSERT_FALSE(endpoints[i]->Read(
+          [&](absl::Status status) {
+            EXPECT_TRUE(status.ok()) << status;
+            {
+              grpc_core::MutexLock lock(&mu);
+              read_threads.insert(std::this_thread::get_id());
+            }
+            if (pending_reads.fetch_sub(1) == 1) reads_done.Notify();
+          },
+          &buffers[i], /*args=*/nullptr));
+    }
+    // Let the poller go back to waiting before all the peers write at once.
+    absl::SleepFor(absl::Milliseconds(10));
+    for (int fd : peer_fds) {
+      ASSERT_EQ(write(fd, "x", 1), 1);
+    }
+    reads_done.WaitForNotification();
+    {
+      grpc_core::MutexLock lock(&mu);
+      EXPECT_EQ(read_threads.count(std::this_thread::get_id()), 0);
+      drained_inline = read_threads.size() == 1;
+    }
+    endpoints.clear();
+    for (int fd : peer_fds) close(fd);
+  }
+  EXPECT_TRUE(drained_inline);
+  WaitForSingleOwner(std::move(posix_ee));
+  grpc_core::ConfigVars::SetOverrides(grpc_core::ConfigVars::Overrides());
+}
+
+namespace {
+
+// Returns a connected pair of TCP sockets on the loopback interface.
+std::pair<int, int> TcpSocketPair() {
+  int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  CHECK_GE(listen_fd, 0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addr_len = sizeof(addr);
+  CHECK_EQ(bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), addr_len), 0);
+  CHECK_EQ(listen(listen_fd, 1), 0);
+  CHECK_EQ(
+      getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr), &addr_len),
+      0);
+  int client_fd = socket(AF_INET, SOCK_STREAM, 0);
+  CHECK_GE(client_fd, 0);
+  CHECK_EQ(connect(client_fd, reinterpret_cast<sockaddr*>(&addr), addr_len),
+           0);
+  int server_fd = accept(listen_fd, nullptr, nullptr);
+  CHECK_GE(server_fd, 0);
+  close(listen_fd);
+  return {client_fd, server_fd};
+}
+
+// Reads from endpoint until num_bytes have arrived and returns them.
+std::string ReadExactly(Endpoint* endpoint, size_t num_bytes) {
+  std::string result;
+  while (result.size() < num_bytes) {
+    SliceBuffer buffer;
+    grpc_core::Notification read_done;
+    absl::Status read_status;
+    if (!endpoint->Read(
+            [&](absl::Status status) {
+              read_status = status;
+              read_done.Notify();
+            },
+            &buffer, /*args=*/nullptr)) {
+      read_done.WaitForNotification();
+    }
+    EXPECT_TRUE(read_status.ok()) << read_status;
+    if (!read_status.ok()) break;
+    while (buffer.Count() > 0) {
+      Slice slice = buffer.TakeFirst();
+      result.append(std::string(slice.as_string_view()));
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+// With GRPC_ARG_TCP_RELEASE_IDLE_READ_BUFFERS set, the spare space of each
+// read is dropped once the socket has been drained; whatever was read must
+// still come out intact, and in order, over many reads.
+TEST(PosixEndpointReleaseIdleReadBuffersTest, ReadsAreIntact) {
+  auto posix_ee = std::make_shared<PosixEventEngine>();
+  grpc_core::ChannelArgs args =
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_RESOURCE_QUOTA, grpc_core::ResourceQuota::Default())
+          .Set(GRPC_ARG_TCP_RELEASE_IDLE_READ_BUFFERS, 1);
+  ChannelArgsEndpointConfig config(args);
+  EXPECT_TRUE(
+      TcpOptionsFromEndpointConfig(config).tcp_release_idle_read_buffers);
+  auto fds = TcpSocketPair();
+  auto endpoint = posix_ee->CreateEndpointFromFd(fds.first, config);
+  for (int i = 0; i < 20; ++i) {
+    // Mostly smaller than a read, so that every read leaves space spare.
+    std::string message(1 + i * 997, static_cast<char>('a' + i));
+    ASSERT_EQ(write(fds.second, message.data(), message.size()),
+              static_cast<ssize_t>(message.size()));
+    EXPECT_EQ(ReadExactly(endpoint.get(), message.size()), message);
+  }
+  endpoint.reset();
+  close(fds.second);
+  WaitForSingleOwner(std::move(posix_ee));
+}
+
+TEST(TcpZerocopySendCtxTest, PoolOnlyGrowsInAdaptiveMode) {
+  TcpZerocopySendCtx fixed(/*zerocopy_enabled=*/true, /*max_sends=*/1);
+  TcpZerocopySendRecord* record = fixed.GetSendRecord();
+  ASSERT_NE(record, nullptr);
+  EXPECT_EQ(fixed.GetSendRecord(), nullptr);
+  fixed.PutSendRecord(record);
+  EXPECT_TRUE(fixed.AllSendRecordsEmpty());
+
+  TcpZerocopySendCtx adaptive(/*zerocopy_enabled=*/true, /*max_sends=*/1,
+                              kMinMessageSize, /*adaptive=*/true);
+  TcpZerocopySendRecord* first = adaptive.GetSendRecord();
+  TcpZerocopySendRecord* second = adaptive.GetSendRecord();
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(first, second);
+  EXPECT_FALSE(adaptive.AllSendRecordsEmpty());
+  adaptive.PutSendRecord(first);
+  adaptive.PutSendRecord(second);
+  EXPECT_TRUE(adaptive.AllSendRecordsEmpty());
+}
+
+TEST(TcpZerocopySendCtxTest, AdaptiveThresholdFollowsCopiedCompletions) {
+  constexpr int kWindow = TcpZerocopySendCtx::kAdaptiveWindow;
+  constexpr size_t kThreshold = kMinMessageSize;
+  TcpZerocopySendCtx ctx(/*zerocopy_enabled=*/true, /*max_sends=*/4,
+                         kThreshold, /*adaptive=*/true);
+  EXPECT_EQ(ctx.ThresholdBytes(), kThreshold);
+  // The kernel copied every send: only larger writes should keep trying.
+  ctx.NoteCompletions(kWindow, /*copied=*/true);
+  EXPECT_EQ(ctx.ThresholdBytes(), 2 * kThreshold);
+  ctx.NoteCompletions(kWindow, /*copied=*/true);
+  EXPECT_EQ(ctx.ThresholdBytes(), 4 * kThreshold);
+  // Genuine zerocopy completions decay back to, but not below, the floor.
+  for (int i = 0; i < 3; ++i) {
+    ctx.NoteCompletions(kWindow, /*copied=*/false);
+  }
+  EXPECT_EQ(ctx.ThresholdBytes(), kThreshold);
+
+  TcpZerocopySendCtx fixed(/*zerocopy_enabled=*/true, /*max_sends=*/4,
+                           kThreshold);
+  fixed.NoteCompletions(kWindow, /*copied=*/true);
+  EXPECT_EQ(fixed.ThresholdBytes(), kThreshold);
+}
 
 }  // namespace experimental
 }  // namespace grpc_event_engine
@@ -25,7 +25,9 @@
 #include "gtest/gtest.h"
 
 #include <grpc/event_engine/event_engine.h>
+#include <grpc/impl/channel_arg_names.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/iomgr/port.h"
 
 // This test won't work except with posix sockets enabled
@@ -99,6 +101,50 @@ TEST(PosixEngineListenerUtils, ListenerContainerAddWildcardAddressesTest) {
   }
 }
 
+TEST(PosixEngineListenerUtils, CreateListenerSocketShardsTest) {
+  if (!PosixSocketWrapper::IsSocketReusePortSupported()) {
+    LOG(INFO) << "Skipping CreateListenerSocketShardsTest because the "
+                 "system does not support SO_REUSEPORT.";
+    return;
+  }
+  int port = grpc_pick_unused_port_or_die();
+  ChannelArgsEndpointConfig config(
+      grpc_core::ChannelArgs()
+          .Set(GRPC_ARG_ALLOW_REUSEPORT, 1)
+          .Set(GRPC_ARG_TCP_LISTENER_SHARDS, 4)
+          .Set(GRPC_ARG_TCP_LISTENER_CPU_STEERING, 1));
+  PosixTcpOptions options = TcpOptionsFromEndpointConfig(config);
+  EXPECT_EQ(options.listener_shards, 4);
+  auto socket = CreateAndPrepareListenerSocket(
+      options, *URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", port)));
+  ASSERT_TRUE(socket.ok()) << socket.status();
+  auto shards = CreateListenerSocketShards(options, *socket);
+  ASSERT_TRUE(shards.ok()) << shards.status();
+  // All shards listen on the address and port of the first socket.
+  ASSERT_EQ(shards->size(), 3u);
+  for (auto& shard : *shards) {
+    EXPECT_EQ(shard.port, socket->port);
+    EXPECT_EQ(ResolvedAddressToNormalizedString(shard.addr).value(),
+              absl::StrCat("127.0.0.1:", socket->port));
+    close(shard.sock.Fd());
+  }
+  close(socket->sock.Fd());
+}
+
+TEST(PosixEngineListenerUtils, CreateListenerSocketShardsDisabledTest) {
+  int port = grpc_pick_unused_port_or_die();
+  ChannelArgsEndpointConfig config;
+  PosixTcpOptions options = TcpOptionsFromEndpointConfig(config);
+  EXPECT_EQ(options.listener_shards, 1);
+  auto socket = CreateAndPrepareListenerSocket(
+      options, *URIToResolvedAddress(absl::StrCat("ipv4:127.0.0.1:", port)));
+  ASSERT_TRUE(socket.ok()) << socket.status();
+  auto shards = CreateListenerSocketShards(options, *socket);
+  ASSERT_TRUE(shards.ok()) << shards.status();
+  EXPECT_TRUE(shards->empty());
+  close(socket->sock.Fd());
+}
+
 #ifdef GRPC_HAVE_IFADDRS
 TEST(PosixEngineListenerUtils, ListenerContainerAddAllLocalAddressesTest) {
   TestListenerSocketsContainer listener_sockets;
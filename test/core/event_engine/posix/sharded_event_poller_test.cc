@@ -0,0 +1,97 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/sharded_event_poller.h"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "gtest/gtest.h"
+
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine_closure.h"
+#include "src/core/lib/gprpp/notification.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+namespace {
+
+TEST(ShardedEventPollerTest, NeedsAtLeastTwoShards) {
+  EXPECT_EQ(MakeShardedEventPoller(0), nullptr);
+  EXPECT_EQ(MakeShardedEventPoller(1), nullptr);
+}
+
+// Every handle is owned by one shard: all of its notifications run on that
+// shard's thread, and consecutive handles are spread across the shards.
+TEST(ShardedEventPollerTest, HandlesStayOnTheirShard) {
+  constexpr int kShards = 3;
+  constexpr int kRounds = 4;
+  auto poller = MakeShardedEventPoller(kShards);
+  if (poller == nullptr) {
+    GTEST_SKIP() << "No poller available to shard";
+  }
+  EXPECT_EQ(poller->NumShards(), kShards);
+
+  struct Connection {
+    int fds[2];
+    EventHandle* handle;
+    std::vector<std::thread::id> threads;
+  };
+  std::vector<Connection> connections(kShards);
+  for (auto& c : connections) {
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, c.fds), 0);
+    c.handle = poller->CreateHandle(c.fds[0], "test", false);
+  }
+  for (int round = 0; round < kRounds; ++round) {
+    for (auto& c : connections) {
+      grpc_core::Notification read;
+      c.handle->NotifyOnRead(
+          PosixEngineClosure::TestOnlyToClosure([&](absl::Status status) {
+            EXPECT_TRUE(status.ok());
+            c.threads.push_back(std::this_thread::get_id());
+            char buf;
+            EXPECT_EQ(::read(c.fds[0], &buf, 1), 1);
+            read.Notify();
+          }));
+      ASSERT_EQ(::write(c.fds[1], "x", 1), 1);
+      read.WaitForNotification();
+    }
+  }
+
+  std::set<std::thread::id> shard_threads;
+  for (auto& c : connections) {
+    ASSERT_EQ(c.threads.size(), kRounds);
+    EXPECT_NE(c.threads[0], std::this_thread::get_id());
+    for (const auto& id : c.threads) EXPECT_EQ(id, c.threads[0]);
+    shard_threads.insert(c.threads[0]);
+    c.handle->OrphanHandle(nullptr, nullptr, "test");
+    close(c.fds[1]);
+  }
+  EXPECT_EQ(shard_threads.size(), kShards);
+  poller->Shutdown();
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,297 @@
+// Copyright 2024 gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/event_engine/posix_engine/shared_memory_endpoint.h"
+
+#include <stdint.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice_buffer.h>
+#include <grpc/grpc.h>
+
+#include "src/core/lib/event_engine/extensions/receive_coalescing.h"
+#include "src/core/lib/event_engine/poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller.h"
+#include "src/core/lib/event_engine/posix_engine/event_poller_posix_default.h"
+#include "src/core/lib/event_engine/posix_engine/posix_engine.h"
+#include "src/core/lib/event_engine/posix_engine/shared_memory_ring.h"
+#include "src/core/lib/event_engine/query_extensions.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/iomgr/port.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "test/core/event_engine/event_engine_test_utils.h"
+#include "test/core/event_engine/posix/posix_engine_test_utils.h"
+
+namespace grpc_event_engine {
+namespace experimental {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+constexpr size_t kCapacity = SharedMemoryRing::kMinCapacity;
+
+class SharedMemoryRingTest : public ::testing::Test {
+ protected:
+  SharedMemoryRingTest()
+      : region_(SharedMemoryRing::RegionSize(kCapacity) / sizeof(uint64_t)) {}
+
+  void* region() { return region_.data(); }
+  size_t region_size() { return region_.size() * sizeof(uint64_t); }
+
+ private:
+  std::vector<uint64_t> region_;
+};
+
+TEST_F(SharedMemoryRingTest, WrapsAround) {
+  auto producer = SharedMemoryRing::Create(region(), kCapacity);
+  ASSERT_TRUE(producer.ok());
+  auto consumer = SharedMemoryRing::Attach(region(), region_size());
+  ASSERT_TRUE(consumer.ok());
+  std::vector<uint8_t> in(kCapacity * 3 / 4);
+  std::vector<uint8_t> out(in.size());
+  for (int round = 0; round < 8; ++round) {
+    for (size_t i = 0; i < in.size(); ++i) in[i] = (round * 31 + i) & 0xff;
+    EXPECT_EQ(producer->Write(in.data(), in.size()), in.size());
+    EXPECT_EQ(consumer->ReadableBytes(), in.size());
+    EXPECT_EQ(consumer->Read(out.data(), out.size()), out.size());
+    EXPECT_EQ(in, out);
+  }
+}
+
+TEST_F(SharedMemoryRingTest, WritesStopWhenFull) {
+  auto producer = SharedMemoryRing::Create(region(), kCapacity);
+  ASSERT_TRUE(producer.ok());
+  auto consumer = SharedMemoryRing::Attach(region(), region_size());
+  ASSERT_TRUE(consumer.ok());
+  std::vector<uint8_t> data(kCapacity + 100, 7);
+  EXPECT_EQ(producer->Write(data.data(), data.size()), kCapacity);
+  EXPECT_EQ(producer->WritableBytes(), 0);
+  EXPECT_TRUE(producer->PrepareWriterWait());
+  EXPECT_EQ(consumer->Read(data.data(), 100), 100);
+  EXPECT_TRUE(consumer->TakeWriterWaiting());
+  EXPECT_FALSE(consumer->TakeWriterWaiting());
+  EXPECT_EQ(producer->WritableBytes(), 100);
+}
+
+TEST_F(SharedMemoryRingTest, ReaderWaitingIsTakenOnce) {
+  auto producer = SharedMemoryRing::Create(region(), kCapacity);
+  ASSERT_TRUE(producer.ok());
+  auto consumer = SharedMemoryRing::Attach(region(), region_size());
+  ASSERT_TRUE(consumer.ok());
+  uint8_t byte = 1;
+  EXPECT_FALSE(producer->TakeReaderWaiting());
+  EXPECT_TRUE(consumer->PrepareReaderWait());
+  EXPECT_EQ(producer->Write(&byte, 1), 1);
+  EXPECT_TRUE(producer->TakeReaderWaiting());
+  EXPECT_FALSE(producer->TakeReaderWaiting());
+  // Data is available, so there is nothing to wait for.
+  EXPECT_FALSE(consumer->PrepareReaderWait());
+}
+
+TEST_F(SharedMemoryRingTest, ClosedRingKeepsItsData) {
+  auto producer = SharedMemoryRing::Create(region(), kCapacity);
+  ASSERT_TRUE(producer.ok());
+  auto consumer = SharedMemoryRing::Attach(region(), region_size());
+  ASSERT_TRUE(consumer.ok());
+  uint8_t byte = 1;
+  EXPECT_EQ(producer->Write(&byte, 1), 1);
+  consumer->Close();
+  EXPECT_TRUE(producer->IsClosed());
+  EXPECT_EQ(producer->Write(&byte, 1), 0);
+  EXPECT_EQ(consumer->Read(&byte, 2), 1);
+}
+
+TEST_F(SharedMemoryRingTest, RejectsInvalidRegions) {
+  EXPECT_FALSE(SharedMemoryRing::Create(region(), kCapacity + 1).ok());
+  EXPECT_FALSE(SharedMemoryRing::Attach(region(), region_size()).ok());
+  ASSERT_TRUE(SharedMemoryRing::Create(region(), kCapacity).ok());
+  EXPECT_FALSE(SharedMemoryRing::Attach(region(), region_size() - 1).ok());
+}
+
+#ifdef GRPC_LINUX_MEMFD
+
+TEST(SharedMemoryChannelTest, PassesChannelOverUnixSocket) {
+  int sockets[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+  auto sent = CreateSharedMemoryChannel();
+  ASSERT_TRUE(sent.ok()) << sent.status();
+  ASSERT_TRUE(SendSharedMemoryChannel(sockets[0], *sent).ok());
+  auto received = ReceiveSharedMemoryChannel(sockets[1]);
+  ASSERT_TRUE(received.ok()) << received.status();
+  EXPECT_GE(received->memfd, 0);
+  EXPECT_NE(received->memfd, sent->memfd);
+  CloseSharedMemoryChannel(*sent);
+  CloseSharedMemoryChannel(*received);
+  // A socket that carries no file descriptors is rejected.
+  char byte = 0;
+  ASSERT_EQ(write(sockets[0], &byte, 1), 1);
+  EXPECT_FALSE(ReceiveSharedMemoryChannel(sockets[1]).ok());
+  close(sockets[0]);
+  close(sockets[1]);
+}
+
+class SharedMemoryEndpointTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    scheduler_ = std::make_unique<TestScheduler>(nullptr);
+    poller_ = MakeDefaultPoller(scheduler_.get());
+    if (poller_ == nullptr) GTEST_SKIP() << "No poller";
+    engine_ = PosixEventEngine::MakeTestOnlyPosixEventEngine(poller_);
+    scheduler_->ChangeCurrentEventEngine(engine_.get());
+    poll_thread_ = std::thread([this]() {
+      while (!done_.load()) {
+        poller_->Work(100ms, []() {});
+      }
+    });
+    auto fds = CreateSharedMemoryChannel(4 * kCapacity);
+    ASSERT_TRUE(fds.ok()) << fds.status();
+    SharedMemoryChannelFds peer_fds;
+    peer_fds.memfd = dup(fds->memfd);
+    peer_fds.eventfds[0] = dup(fds->eventfds[0]);
+    peer_fds.eventfds[1] = dup(fds->eventfds[1]);
+    auto client = CreateSharedMemoryEndpoint(
+        *fds, 0, poller_.get(), engine_, MakeAllocator(), {}, {});
+    auto server = CreateSharedMemoryEndpoint(
+        peer_fds, 1, poller_.get(), engine_, MakeAllocator(), {}, {});
+    ASSERT_TRUE(client.ok()) << client.status();
+    ASSERT_TRUE(server.ok()) << server.status();
+    client_ = std::move(*client);
+    server_ = std::move(*server);
+  }
+
+  void TearDown() override {
+    client_.reset();
+    server_.reset();
+    if (poller_ == nullptr) return;
+    done_.store(true);
+    poller_->Kick();
+    poll_thread_.join();
+    poller_->Shutdown();
+    WaitForSingleOwner(std::move(engine_));
+  }
+
+  MemoryAllocator MakeAllocator() {
+    return memory_quota_.CreateMemoryAllocator("shm");
+  }
+
+  grpc_core::MemoryQuota memory_quota_{"shm"};
+  std::unique_ptr<TestScheduler> scheduler_;
+  std::shared_ptr<PosixEventPoller> poller_;
+  std::shared_ptr<EventEngine> engine_;
+  std::thread poll_thread_;
+  std::atomic<bool> done_{false};
+  std::unique_ptr<EventEngine::Endpoint> client_;
+  std::unique_ptr<EventEngine::Endpoint> server_;
+};
+
+TEST_F(SharedMemoryEndpointTest, ExchangesMessages) {
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_TRUE(
+        SendValidatePayload(GetNextSendMessage(), client_.get(), server_.get())
+            .ok());
+    ASSERT_TRUE(
+        SendValidatePayload(GetNextSendMessage(), server_.get(), client_.get())
+            .ok());
+  }
+}
+
+TEST_F(SharedMemoryEndpointTest, ExchangesMessagesLargerThanTheRing) {
+  ASSERT_TRUE(SendValidatePayload(std::string(64 * kCapacity + 3, 'a'),
+                                  client_.get(), server_.get())
+                  .ok());
+}
+
+TEST_F(SharedMemoryEndpointTest, CoalescesRpcReceives) {
+  auto* extension = QueryExtension<ReceiveCoalescingExtension>(server_.get());
+  ASSERT_NE(extension, nullptr);
+  extension->EnforceRxMemoryAlignment();
+  extension->EnableRpcReceiveCoalescing();
+  const std::string message(10 * kCapacity + 5, 'b');
+  SliceBuffer read_buffer;
+  grpc_core::Notification read_done;
+  EventEngine::Endpoint::ReadArgs args = {
+      static_cast<int64_t>(message.size())};
+  ASSERT_FALSE(server_->Read(
+      [&](absl::Status status) {
+        EXPECT_TRUE(status.ok()) << status;
+        read_done.Notify();
+      },
+      &read_buffer, &args));
+  // Write the message in pieces: the read still sees a single slice.
+  for (size_t offset = 0; offset < message.size(); offset += kCapacity) {
+    SliceBuffer write_buffer;
+    write_buffer.Append(
+        Slice::FromCopiedString(message.substr(offset, kCapacity)));
+    grpc_core::Notification write_done;
+    if (client_->Write(
+            [&](absl::Status status) {
+              EXPECT_TRUE(status.ok()) << status;
+              write_done.Notify();
+            },
+            &write_buffer, nullptr)) {
+      write_done.Notify();
+    }
+    write_done.WaitForNotification();
+  }
+  read_done.WaitForNotification();
+  ASSERT_EQ(read_buffer.Count(), 1);
+  Slice slice = read_buffer.TakeFirst();
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(slice.begin()) % 64, 0);
+  EXPECT_EQ(slice.as_string_view(), message);
+}
+
+TEST_F(SharedMemoryEndpointTest, ReadFailsWhenPeerCloses) {
+  SliceBuffer buffer;
+  grpc_core::Notification read_done;
+  absl::Status read_status;
+  ASSERT_FALSE(server_->Read(
+      [&](absl::Status status) {
+        read_status = status;
+        read_done.Notify();
+      },
+      &buffer, nullptr));
+  client_.reset();
+  read_done.WaitForNotification();
+  EXPECT_FALSE(read_status.ok());
+}
+
+#endif  // GRPC_LINUX_MEMFD
+
+}  // namespace
+
+}  // namespace experimental
+}  // namespace grpc_event_engine
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  // TODO(ctiller): EventEngine temporarily needs grpc to be initialized first
+  // until we clear out the iomgr shutdown code.
+  grpc_init();
+  int r = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return r;
+}
@@ -28,10 +28,13 @@
 #include <grpc/support/time.h>
 
 #include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
 #include "src/core/lib/gprpp/time.h"
 
+using testing::AnyNumber;
 using testing::Mock;
 using testing::Return;
+using testing::ReturnPointee;
 using testing::StrictMock;
 
 namespace grpc_event_engine {
@@ -239,6 +242,173 @@ TEST(TimerListTest, LongRunningServiceCleanup) {
   EXPECT_TRUE(timer_list.TimerCancel(&timers[3]));
 }
 
+TEST(TimerWheelTest, Add) {
+  Timer timers[20];
+  StrictMock<MockClosure> closures[20];
+
+  auto now = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(100);
+  const auto kStart = now;
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillRepeatedly(ReturnPointee(&now));
+  EXPECT_CALL(host, Kick()).Times(AnyNumber());
+  TimerWheel timer_list(&host);
+
+  // 10 ms timers: land in the finest level of the wheel.
+  for (int i = 0; i < 10; i++) {
+    timer_list.TimerInit(&timers[i],
+                         kStart + grpc_core::Duration::Milliseconds(10),
+                         &closures[i]);
+  }
+  // 1010 ms timers: need to be cascaded down from the second level.
+  for (int i = 10; i < 20; i++) {
+    timer_list.TimerInit(&timers[i],
+                         kStart + grpc_core::Duration::Milliseconds(1010),
+                         &closures[i]);
+  }
+
+  // collect timers.  Only the first batch should be ready.
+  now = kStart + grpc_core::Duration::Milliseconds(500);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_CALL(closures[i], Run());
+  }
+  grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(&next)),
+            CheckResult::kTimersFired);
+  for (int i = 0; i < 10; i++) {
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+  // The wheel may ask to be checked early (to cascade), but never late.
+  EXPECT_GT(next, now);
+  EXPECT_LE(next, kStart + grpc_core::Duration::Milliseconds(1010));
+
+  now = kStart + grpc_core::Duration::Milliseconds(600);
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+
+  // collect the rest of the timers
+  now = kStart + grpc_core::Duration::Milliseconds(1500);
+  for (int i = 10; i < 20; i++) {
+    EXPECT_CALL(closures[i], Run());
+  }
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  for (int i = 10; i < 20; i++) {
+    Mock::VerifyAndClearExpectations(&closures[i]);
+  }
+
+  now = kStart + grpc_core::Duration::Milliseconds(1600);
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kCheckedAndEmpty);
+}
+
+// Timers never fire early, however far out in the wheel they start.
+TEST(TimerWheelTest, FiresAtDeadlineAcrossLevels) {
+  const grpc_core::Duration kDelays[] = {
+      grpc_core::Duration::Milliseconds(1),
+      grpc_core::Duration::Milliseconds(255),
+      grpc_core::Duration::Milliseconds(256),
+      grpc_core::Duration::Milliseconds(70000),
+      grpc_core::Duration::Hours(30),
+  };
+  for (auto delay : kDelays) {
+    Timer timer;
+    StrictMock<MockClosure> closure;
+    auto now = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(12345);
+    StrictMock<MockHost> host;
+    EXPECT_CALL(host, Now()).WillRepeatedly(ReturnPointee(&now));
+    EXPECT_CALL(host, Kick()).Times(AnyNumber());
+    TimerWheel timer_list(&host);
+    const auto deadline = now + delay;
+    timer_list.TimerInit(&timer, deadline, &closure);
+    // Jump to each time the wheel asks to be checked at until the timer fires.
+    int checks = 0;
+    while (true) {
+      grpc_core::Timestamp next = grpc_core::Timestamp::InfFuture();
+      auto result = timer_list.TimerCheck(&next);
+      ASSERT_TRUE(result.has_value());
+      if (!result->empty()) {
+        EXPECT_EQ(now, deadline) << delay.ToString();
+        EXPECT_CALL(closure, Run());
+        FinishCheck(std::move(result));
+        break;
+      }
+      ASSERT_LE(next, deadline) << delay.ToString();
+      ASSERT_GT(next, now) << delay.ToString();
+      now = next;
+      ASSERT_LT(++checks, 100) << delay.ToString();
+    }
+    EXPECT_FALSE(timer_list.TimerCancel(&timer));
+  }
+}
+
+TEST(TimerWheelTest, Cancel) {
+  Timer timers[3];
+  StrictMock<MockClosure> closures[3];
+
+  auto now = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(0);
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillRepeatedly(ReturnPointee(&now));
+  EXPECT_CALL(host, Kick()).Times(AnyNumber());
+  TimerWheel timer_list(&host);
+
+  // Three timers sharing one slot: cancel the one in the middle of its list.
+  for (int i = 0; i < 3; i++) {
+    timer_list.TimerInit(
+        &timers[i], grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(5),
+        &closures[i]);
+  }
+  EXPECT_TRUE(timer_list.TimerCancel(&timers[1]));
+  EXPECT_FALSE(timer_list.TimerCancel(&timers[1]));
+
+  now = grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(5);
+  EXPECT_CALL(closures[0], Run());
+  EXPECT_CALL(closures[2], Run());
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_FALSE(timer_list.TimerCancel(&timers[0]));
+  EXPECT_FALSE(timer_list.TimerCancel(&timers[2]));
+
+  // A timer whose deadline has already passed fires on the next check.
+  timer_list.TimerInit(&timers[1],
+                       grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1),
+                       &closures[1]);
+  EXPECT_CALL(closures[1], Run());
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+}
+
+// Same as TimerListTest.LongRunningServiceCleanup, for the wheel.
+TEST(TimerWheelTest, LongRunningServiceCleanup) {
+  Timer timers[3];
+  StrictMock<MockClosure> closures[3];
+
+  const auto kStart =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(k25Days.millis());
+  auto now = kStart;
+
+  StrictMock<MockHost> host;
+  EXPECT_CALL(host, Now()).WillRepeatedly(ReturnPointee(&now));
+  EXPECT_CALL(host, Kick()).Times(AnyNumber());
+  TimerWheel timer_list(&host);
+
+  timer_list.TimerInit(&timers[0], kStart + k25Days, &closures[0]);
+  timer_list.TimerInit(
+      &timers[1], kStart + grpc_core::Duration::Milliseconds(3), &closures[1]);
+  timer_list.TimerInit(&timers[2],
+                       grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(
+                           std::numeric_limits<int64_t>::max() - 1),
+                       &closures[2]);
+
+  now = kStart + grpc_core::Duration::Milliseconds(4);
+  EXPECT_CALL(closures[1], Run());
+  EXPECT_EQ(FinishCheck(timer_list.TimerCheck(nullptr)),
+            CheckResult::kTimersFired);
+  EXPECT_TRUE(timer_list.TimerCancel(&timers[0]));
+  EXPECT_FALSE(timer_list.TimerCancel(&timers[1]));
+  EXPECT_TRUE(timer_list.TimerCancel(&timers[2]));
+}
+
 }  // namespace experimental
 }  // namespace grpc_event_engine
 
@@ -21,16 +21,21 @@
 #include <memory>
 #include <thread>
 #include <tuple>
+#include <utility>
 #include <vector>
 
+#include "absl/functional/any_invocable.h"
 #include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "gtest/gtest.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/grpc.h>
 #include <grpc/support/thd_id.h>
 
+#include "src/core/lib/event_engine/extensions/run_with_priority.h"
 #include "src/core/lib/event_engine/thread_pool/thread_count.h"
+#include "src/core/lib/event_engine/thread_pool/thread_pool.h"
 #include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
 #include "src/core/lib/gprpp/notification.h"
 #include "src/core/lib/gprpp/thd.h"
@@ -40,10 +45,40 @@
 namespace grpc_event_engine {
 namespace experimental {
 
+using Priority = EventEngineRunWithPriorityExtension::Priority;
+
+// A WorkStealingThreadPool whose threads use lock-free local queues.
+class LockFreeQueueWorkStealingThreadPool final : public ThreadPool {
+ public:
+  explicit LockFreeQueueWorkStealingThreadPool(size_t reserve_threads)
+      : pool_(reserve_threads, /*numa_nodes=*/{},
+              /*lock_free_local_queues=*/true) {}
+  void Quiesce() override { pool_.Quiesce(); }
+  void Run(absl::AnyInvocable<void()> callback) override {
+    pool_.Run(std::move(callback));
+  }
+  void Run(EventEngine::Closure* closure) override { pool_.Run(closure); }
+  void RunWithPriority(Priority priority,
+                       absl::AnyInvocable<void()> callback) override {
+    pool_.RunWithPriority(priority, std::move(callback));
+  }
+  void RunWithPriority(Priority priority,
+                       EventEngine::Closure* closure) override {
+    pool_.RunWithPriority(priority, closure);
+  }
+  void PrepareFork() override { pool_.PrepareFork(); }
+  void PostforkParent() override { pool_.PostforkParent(); }
+  void PostforkChild() override { pool_.PostforkChild(); }
+
+ private:
+  WorkStealingThreadPool pool_;
+};
+
 template <typename T>
 class ThreadPoolTest : public testing::Test {};
 
-using ThreadPoolTypes = ::testing::Types<WorkStealingThreadPool>;
+using ThreadPoolTypes = ::testing::Types<WorkStealingThreadPool,
+                                         LockFreeQueueWorkStealingThreadPool>;
 TYPED_TEST_SUITE(ThreadPoolTest, ThreadPoolTypes);
 
 TYPED_TEST(ThreadPoolTest, CanRunAnyInvocable) {
@@ -290,6 +325,119 @@ TYPED_TEST(ThreadPoolTest, WorkerThreadLocalRunWorksWithOtherPools) {
   p1.Quiesce();
 }
 
+TYPED_TEST(ThreadPoolTest, HighPriorityClosureRunsAheadOfQueuedWork) {
+  constexpr int kNormalCount = 100;
+  TypeParam p(8);
+  std::atomic<int> normal_done{0};
+  std::atomic<int> normal_done_before_high{-1};
+  grpc_core::Notification high_ran;
+  p.Run([&]() {
+    // All of these land on this worker's local queue.
+    for (int i = 0; i < kNormalCount; i++) {
+      p.Run([&]() {
+        absl::SleepFor(absl::Milliseconds(1));
+        normal_done.fetch_add(1);
+      });
+    }
+    p.RunWithPriority(Priority::kHigh, [&]() {
+      normal_done_before_high.store(normal_done.load());
+      high_ran.Notify();
+    });
+  });
+  high_ran.WaitForNotification();
+  p.Quiesce();
+  EXPECT_EQ(normal_done.load(), kNormalCount);
+  EXPECT_LT(normal_done_before_high.load(), kNormalCount / 2);
+}
+
+TYPED_TEST(ThreadPoolTest, LowPriorityClosureIsNotStarvedByNormalWork) {
+  TypeParam p(8);
+  std::atomic<bool> low_ran{false};
+  std::atomic<int> low_count{0};
+  // Keeps every worker busy with normal priority work until the low priority
+  // closure has run.
+  std::function<void()> spin = [&]() {
+    if (!low_ran.load()) p.Run(spin);
+  };
+  p.Run([&]() {
+    for (int i = 0; i < 16; i++) p.Run(spin);
+    p.RunWithPriority(Priority::kLow, [&]() {
+      low_count.fetch_add(1);
+      low_ran.store(true);
+    });
+  });
+  for (int i = 0; i < 100; i++) {
+    p.RunWithPriority(Priority::kLow,
+                      [&]() { low_count.fetch_add(1); });
+  }
+  p.Quiesce();
+  EXPECT_TRUE(low_ran.load());
+  EXPECT_EQ(low_count.load(), 101);
+}
+
+// Every node is given CPU 0, which exists on every host.
+TEST(WorkStealingThreadPoolNumaTest, SpreadsThreadsAcrossNodes) {
+  WorkStealingThreadPool p(8, {{0}, {0}});
+  EXPECT_EQ(p.ThreadsPerNumaNode(), std::vector<size_t>({4, 4}));
+  p.Quiesce();
+}
+
+TEST(WorkStealingThreadPoolNumaTest, CanStartLotsOfClosures) {
+  WorkStealingThreadPool p(8, {{0}, {0}, {0}});
+  std::atomic<int> runcount{0};
+  int branch_factor = 16;
+  ScheduleTwiceUntilZero(&p, runcount, branch_factor);
+  p.Quiesce();
+  ASSERT_EQ(runcount.load(), pow(2, branch_factor + 1) - 1);
+}
+
+TEST(WorkStealingThreadPoolNumaTest, IsNotNumaAwareWithOneNode) {
+  WorkStealingThreadPool p(8, {{0}});
+  EXPECT_EQ(p.ThreadsPerNumaNode(), std::vector<size_t>({8}));
+  p.Quiesce();
+}
+
+TEST(WorkStealingThreadPoolForkTest, LazyRestartWaitsForWork) {
+  WorkStealingThreadPool p(8, /*numa_nodes=*/{},
+                           /*lock_free_local_queues=*/false,
+                           /*lazy_postfork_restart=*/true);
+  // Forking several workers in a row only stops the threads once.
+  for (int i = 0; i < 3; ++i) {
+    p.PrepareFork();
+    p.PostforkParent();
+    EXPECT_EQ(p.ThreadsPerNumaNode(), std::vector<size_t>({0}));
+  }
+  grpc_core::Notification n;
+  p.Run([&n] { n.Notify(); });
+  n.WaitForNotification();
+  EXPECT_GE(p.ThreadsPerNumaNode()[0], 8u);
+  p.Quiesce();
+}
+
+TEST(WorkStealingThreadPoolForkTest, LazyRestartRunsSavedWork) {
+  WorkStealingThreadPool p(8, /*numa_nodes=*/{},
+                           /*lock_free_local_queues=*/false,
+                           /*lazy_postfork_restart=*/true);
+  grpc_core::Notification inner_closure_ran;
+  p.Run([&inner_closure_ran, &p] {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    p.Run([&inner_closure_ran] { inner_closure_ran.Notify(); });
+  });
+  p.PrepareFork();
+  p.PostforkChild();
+  inner_closure_ran.WaitForNotification();
+  p.Quiesce();
+}
+
+TEST(WorkStealingThreadPoolForkTest, LazyRestartCanQuiesceUnstarted) {
+  WorkStealingThreadPool p(8, /*numa_nodes=*/{},
+                           /*lock_free_local_queues=*/false,
+                           /*lazy_postfork_restart=*/true);
+  p.PrepareFork();
+  p.PostforkChild();
+  p.Quiesce();
+}
+
 TYPED_TEST(ThreadPoolTest, DISABLED_TestDumpStack) {
   TypeParam p1(8);
   for (size_t i = 0; i < 8; i++) {
@@ -252,6 +252,29 @@ TEST_F(IOCPTest, KickThenShutdownCasusesNextWorkerToBeKicked) {
   thread_pool->Quiesce();
 }
 
+// Kicks that are dequeued together in one batch still each end a worker.
+TEST_F(IOCPTest, EachOfSeveralQueuedKicksEndsAWorker) {
+  auto thread_pool = grpc_event_engine::experimental::MakeThreadPool(8);
+  IOCP iocp(thread_pool.get());
+  constexpr int kNumKicks = 5;
+  for (int i = 0; i < kNumKicks; ++i) {
+    iocp.Kick();
+  }
+  bool cb_invoked = false;
+  for (int i = 0; i < kNumKicks; ++i) {
+    auto result = iocp.Work(std::chrono::milliseconds(1),
+                            [&cb_invoked]() { cb_invoked = true; });
+    ASSERT_TRUE(result == Poller::WorkResult::kKicked) << "kick " << i;
+  }
+  auto result = iocp.Work(std::chrono::milliseconds(1),
+                          [&cb_invoked]() { cb_invoked = true; });
+  ASSERT_TRUE(result == Poller::WorkResult::kDeadlineExceeded);
+  ASSERT_FALSE(cb_invoked);
+  // No kicks are left outstanding, so this does not block.
+  iocp.Shutdown();
+  thread_pool->Quiesce();
+}
+
 TEST_F(IOCPTest, CrashOnWatchingAClosedSocket) {
   auto thread_pool = grpc_event_engine::experimental::MakeThreadPool(8);
   IOCP iocp(thread_pool.get());
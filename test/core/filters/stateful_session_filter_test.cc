@@ -0,0 +1,102 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/filters/stateful_session/stateful_session_filter.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "absl/strings/escaping.h"
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Decodes \a encoded in the context of a new call arena, and returns a copy.
+std::string Decode(SessionCookieCache& cache, absl::string_view encoded) {
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  promise_detail::Context<Arena> context(arena.get());
+  return std::string(cache.Decode(encoded));
+}
+
+std::string SessionCookie(int session) {
+  return absl::Base64Escape(
+      absl::StrCat("127.0.0.", session, ":443;cluster", session));
+}
+
+TEST(SessionCookieCacheTest, DecodesCookie) {
+  SessionCookieCache cache;
+  EXPECT_EQ(Decode(cache, SessionCookie(1)), "127.0.0.1:443;cluster1");
+  // The second time, the cookie comes from the cache.
+  EXPECT_EQ(Decode(cache, SessionCookie(1)), "127.0.0.1:443;cluster1");
+}
+
+TEST(SessionCookieCacheTest, InvalidCookieDecodesToEmptyString) {
+  SessionCookieCache cache;
+  EXPECT_EQ(Decode(cache, ""), "");
+  EXPECT_EQ(Decode(cache, "!!! not base64 !!!"), "");
+  // An invalid cookie does not take the place of a valid one.
+  EXPECT_EQ(Decode(cache, SessionCookie(1)), "127.0.0.1:443;cluster1");
+  EXPECT_EQ(Decode(cache, "!!! not base64 !!!"), "");
+  EXPECT_EQ(Decode(cache, SessionCookie(1)), "127.0.0.1:443;cluster1");
+}
+
+TEST(SessionCookieCacheTest, InterleavedSessions) {
+  SessionCookieCache cache;
+  // Calls from many more sessions than the cache holds, so that entries are
+  // evicted and decoded again along the way.
+  constexpr int kNumSessions = 200;
+  for (int round = 0; round < 3; ++round) {
+    for (int session = 0; session < kNumSessions; ++session) {
+      EXPECT_EQ(Decode(cache, SessionCookie(session)),
+                absl::StrCat("127.0.0.", session, ":443;cluster", session));
+    }
+  }
+}
+
+TEST(SessionCookieCacheTest, ConcurrentSessions) {
+  SessionCookieCache cache;
+  constexpr int kNumThreads = 8;
+  constexpr int kNumSessions = 20;
+  constexpr int kNumCalls = 1000;
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&cache, t]() {
+      // Each thread mixes calls of several sessions, some of which it
+      // shares with the other threads.
+      for (int i = 0; i < kNumCalls; ++i) {
+        const int session = (t + i * 7) % kNumSessions;
+        EXPECT_EQ(Decode(cache, SessionCookie(session)),
+                  absl::StrCat("127.0.0.", session, ":443;cluster", session));
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
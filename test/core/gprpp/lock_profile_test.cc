@@ -0,0 +1,130 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/gprpp/lock_profile.h"
+
+#include <string>
+#include <thread>
+
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// Profiles are never unregistered, so the tests leak theirs.
+
+// Holds \a mu until another thread has started waiting on it through
+// \a profile.
+void Contend(Mutex* mu, LockProfile* profile) {
+  mu->Lock();
+  Notification waiting;
+  std::thread t([&] {
+    waiting.Notify();
+    ProfiledMutexLock lock(mu, profile);
+  });
+  waiting.WaitForNotification();
+  absl::SleepFor(absl::Milliseconds(100));
+  mu->Unlock();
+  t.join();
+}
+
+TEST(LockProfileTest, DisabledRecordsNothing) {
+  LockProfile::SetSamplingPeriod(0);
+  auto* profile = new LockProfile("disabled");
+  Mutex mu;
+  for (int i = 0; i < 100; i++) {
+    ProfiledMutexLock lock(&mu, profile);
+  }
+  Contend(&mu, profile);
+  EXPECT_EQ(profile->GetStats().samples, 0u);
+  EXPECT_EQ(profile->GetStats().contended, 0u);
+}
+
+TEST(LockProfileTest, RecordsUncontendedAcquisitions) {
+  LockProfile::SetSamplingPeriod(1);
+  auto* profile = new LockProfile("uncontended");
+  Mutex mu;
+  for (int i = 0; i < 100; i++) {
+    ProfiledMutexLock lock(&mu, profile);
+  }
+  LockProfile::Stats stats = profile->GetStats();
+  EXPECT_EQ(stats.name, "uncontended");
+  EXPECT_EQ(stats.samples, 100u);
+  EXPECT_EQ(stats.contended, 0u);
+  EXPECT_EQ(stats.total_wait.count(), 0);
+}
+
+TEST(LockProfileTest, SamplesOneInPeriod) {
+  LockProfile::SetSamplingPeriod(10);
+  auto* profile = new LockProfile("sampled");
+  Mutex mu;
+  for (int i = 0; i < 1000; i++) {
+    ProfiledMutexLock lock(&mu, profile);
+  }
+  // The countdown carries over from earlier acquisitions on this thread.
+  EXPECT_GE(profile->GetStats().samples, 99u);
+  EXPECT_LE(profile->GetStats().samples, 101u);
+}
+
+TEST(LockProfileTest, RecordsWaitTime) {
+  LockProfile::SetSamplingPeriod(1);
+  auto* profile = new LockProfile("contended");
+  Mutex mu;
+  Contend(&mu, profile);
+  LockProfile::Stats stats = profile->GetStats();
+  EXPECT_EQ(stats.samples, 1u);
+  EXPECT_EQ(stats.contended, 1u);
+  EXPECT_GT(stats.total_wait.count(), 0);
+  EXPECT_EQ(stats.max_wait, stats.total_wait);
+}
+
+TEST(LockProfileTest, TopContendedOrdersByWaitTime) {
+  LockProfile::SetSamplingPeriod(1);
+  auto* less = new LockProfile("top_less");
+  auto* more = new LockProfile("top_more");
+  new LockProfile("top_unused");
+  Mutex mu;
+  Contend(&mu, less);
+  Contend(&mu, more);
+  Contend(&mu, more);
+  auto top = LockProfile::TopContended(1000);
+  int less_index = -1;
+  int more_index = -1;
+  for (size_t i = 0; i < top.size(); i++) {
+    EXPECT_NE(top[i].name, "top_unused");
+    if (top[i].name == "top_less") less_index = static_cast<int>(i);
+    if (top[i].name == "top_more") more_index = static_cast<int>(i);
+  }
+  ASSERT_NE(less_index, -1);
+  ASSERT_NE(more_index, -1);
+  EXPECT_LT(more_index, less_index);
+  EXPECT_EQ(LockProfile::TopContended(1).size(), 1u);
+  EXPECT_NE(LockProfile::TopContendedToString(1000).find("top_more: samples=2"),
+            std::string::npos);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
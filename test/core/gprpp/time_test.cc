@@ -50,6 +50,20 @@ TEST(TimestampTest, ToString) {
   EXPECT_EQ(Timestamp::InfPast().ToString(), "@-∞");
 }
 
+TEST(TimestampTest, NowCoarseTrailsNow) {
+  const Timestamp before = Timestamp::Now();
+  const Timestamp coarse = Timestamp::NowCoarse();
+  EXPECT_GE(coarse, before);
+  EXPECT_LE(coarse, Timestamp::Now());
+}
+
+TEST(TimestampTest, NowCoarseUsesCachedTime) {
+  ScopedTimeCache cache;
+  const Timestamp now = Timestamp::FromMillisecondsAfterProcessEpoch(1234);
+  cache.TestOnlySetNow(now);
+  EXPECT_EQ(Timestamp::NowCoarse(), now);
+}
+
 TEST(DurationTest, Empty) { EXPECT_EQ(Duration(), Duration::Zero()); }
 
 TEST(DurationTest, Scales) {
@@ -35,6 +35,7 @@
 #include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/notification.h"
@@ -377,6 +378,44 @@ TEST(WorkSerializerTest, MetricsWork) {
   WaitForSingleOwner(GetDefaultEventEngine());
 }
 
+TEST(WorkSerializerTest, DrainBudgetRunsQueuedCallbacksOnOneThread) {
+  if (!IsWorkSerializerDispatchEnabled()) {
+    GTEST_SKIP() << "Work serializer dispatch experiment not enabled";
+  }
+  ConfigVars::Overrides overrides;
+  overrides.work_serializer_drain_budget_us = 10000000;
+  ConfigVars::SetOverrides(overrides);
+  auto serializer = std::make_unique<WorkSerializer>(GetDefaultEventEngine());
+  constexpr int kNumCallbacks = 10;
+  std::vector<int> order;
+  std::vector<std::thread::id> threads;
+  Notification done;
+  // Queue the callbacks from within the WorkSerializer so that they are all
+  // waiting when the first one finishes.
+  serializer->Run(
+      [&]() {
+        for (int i = 0; i < kNumCallbacks; ++i) {
+          serializer->Run(
+              [&, i]() {
+                order.push_back(i);
+                threads.push_back(std::this_thread::get_id());
+                if (i == kNumCallbacks - 1) done.Notify();
+              },
+              DEBUG_LOCATION);
+        }
+      },
+      DEBUG_LOCATION);
+  done.WaitForNotification();
+  ASSERT_EQ(order.size(), kNumCallbacks);
+  for (int i = 0; i < kNumCallbacks; ++i) {
+    EXPECT_EQ(order[i], i);
+    EXPECT_EQ(threads[i], threads[0]);
+  }
+  serializer.reset();
+  WaitForSingleOwner(GetDefaultEventEngine());
+  ConfigVars::Reset();
+}
+
 #ifndef NDEBUG
 TEST(WorkSerializerTest, RunningInWorkSerializer) {
   auto work_serializer1 =
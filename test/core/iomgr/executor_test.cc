@@ -0,0 +1,294 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/iomgr/executor.h"
+
+#include "src/core/lib/iomgr/port.h"
+
+#ifdef GRPC_POSIX_FORK_ALLOW_PTHREAD_ATFORK
+#include <pthread.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif  // GRPC_POSIX_FORK_ALLOW_PTHREAD_ATFORK
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/support/cpu.h>
+
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/ev_posix.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+class ExecutorTest : public ::testing::Test {
+ protected:
+  ExecutorTest() : executor_("test-executor", Executor::Priority::kNormal) {}
+
+  ~ExecutorTest() override { executor_.Shutdown(); }
+
+  void Enqueue(std::function<void()> f, bool is_short = true) {
+    executor_.Enqueue(
+        NewClosure([f = std::move(f)](grpc_error_handle) { f(); }),
+        absl::OkStatus(), is_short);
+  }
+
+  Executor executor_;
+};
+
+TEST_F(ExecutorTest, RunsClosuresInOrderWhenNotThreaded) {
+  ASSERT_FALSE(executor_.IsThreaded());
+  std::vector<int> order;
+  ExecCtx exec_ctx;
+  for (int i = 0; i < 10; ++i) {
+    Enqueue([&order, i]() { order.push_back(i); });
+  }
+  // The closures are queued on the exec ctx rather than run right away.
+  EXPECT_TRUE(order.empty());
+  exec_ctx.Flush();
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(ExecutorTest, RunsEveryClosureOffThreadWhenThreaded) {
+  executor_.Init();
+  ASSERT_TRUE(executor_.IsThreaded());
+  constexpr int kNumClosures = 1000;
+  const std::thread::id test_thread = std::this_thread::get_id();
+  std::atomic<int> ran{0};
+  std::atomic<int> inline_runs{0};
+  Notification all_ran;
+  {
+    ExecCtx exec_ctx;
+    for (int i = 0; i < kNumClosures; ++i) {
+      Enqueue([&]() {
+        if (std::this_thread::get_id() == test_thread) ++inline_runs;
+        if (++ran == kNumClosures) all_ran.Notify();
+      });
+    }
+  }
+  ASSERT_TRUE(all_ran.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  executor_.Shutdown();
+  EXPECT_EQ(ran.load(), kNumClosures);
+  EXPECT_EQ(inline_runs.load(), 0);
+}
+
+// Closures the EventEngine has not started when threading is turned off are
+// run by SetThreading(false) itself, each of them once.
+TEST_F(ExecutorTest, ShutdownRunsClosuresTheEngineHasNotStarted) {
+  executor_.Init();
+  const int num_blocking = 2 * static_cast<int>(gpr_cpu_num_cores()) + 4;
+  Notification release;
+  std::atomic<int> blocked{0};
+  std::atomic<int> ran{0};
+  {
+    ExecCtx exec_ctx;
+    for (int i = 0; i < num_blocking; ++i) {
+      Enqueue(
+          [&]() {
+            ++blocked;
+            release.WaitForNotification();
+          },
+          /*is_short=*/false);
+    }
+    for (int i = 0; i < 100; ++i) {
+      Enqueue([&ran]() { ++ran; });
+    }
+  }
+  std::thread releaser([&]() {
+    absl::SleepFor(absl::Milliseconds(200));
+    release.Notify();
+  });
+  executor_.Shutdown();
+  releaser.join();
+  EXPECT_EQ(blocked.load(), num_blocking);
+  EXPECT_EQ(ran.load(), 100);
+  // The EventEngine tasks left behind find nothing to run.
+  absl::SleepFor(absl::Milliseconds(200));
+  EXPECT_EQ(ran.load(), 100);
+}
+
+TEST_F(ExecutorTest, ClosureRunsAfterTheOneThatEnqueuedIt) {
+  executor_.Init();
+  constexpr int kChainLength = 100;
+  std::vector<int> order;
+  Notification done;
+  std::function<void(int)> step = [&](int i) {
+    order.push_back(i);
+    if (i + 1 == kChainLength) {
+      done.Notify();
+      return;
+    }
+    Enqueue([&step, i]() { step(i + 1); });
+  };
+  {
+    ExecCtx exec_ctx;
+    Enqueue([&step]() { step(0); });
+  }
+  ASSERT_TRUE(done.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  ASSERT_EQ(order.size(), static_cast<size_t>(kChainLength));
+  for (int i = 0; i < kChainLength; ++i) EXPECT_EQ(order[i], i);
+}
+
+TEST_F(ExecutorTest, ShutdownWaitsForRunningClosure) {
+  executor_.Init();
+  Notification started;
+  Notification release;
+  std::atomic<bool> finished{false};
+  {
+    ExecCtx exec_ctx;
+    Enqueue(
+        [&]() {
+          started.Notify();
+          release.WaitForNotification();
+          finished.store(true);
+        },
+        /*is_short=*/false);
+  }
+  started.WaitForNotification();
+  Notification shutdown_done;
+  std::thread shutdown_thread([&]() {
+    executor_.Shutdown();
+    shutdown_done.Notify();
+  });
+  EXPECT_FALSE(
+      shutdown_done.WaitForNotificationWithTimeout(absl::Milliseconds(200)));
+  release.Notify();
+  shutdown_thread.join();
+  EXPECT_TRUE(finished.load());
+  EXPECT_FALSE(executor_.IsThreaded());
+}
+
+TEST_F(ExecutorTest, ClosureEnqueuedAfterShutdownRunsOnExecCtx) {
+  executor_.Init();
+  executor_.Shutdown();
+  ASSERT_FALSE(executor_.IsThreaded());
+  bool ran = false;
+  ExecCtx exec_ctx;
+  Enqueue([&ran]() { ran = true; });
+  EXPECT_FALSE(ran);
+  exec_ctx.Flush();
+  EXPECT_TRUE(ran);
+}
+
+// Executor closures share the EventEngine's threads. Closures that block for
+// a long time, as resolver closures do, must not keep other work from
+// running on the EventEngine or the executor.
+TEST_F(ExecutorTest, BlockingClosuresDoNotStarveEventEngine) {
+  executor_.Init();
+  const int num_blocking = 2 * static_cast<int>(gpr_cpu_num_cores()) + 4;
+  Notification release;
+  std::atomic<int> blocked{0};
+  {
+    ExecCtx exec_ctx;
+    for (int i = 0; i < num_blocking; ++i) {
+      Enqueue(
+          [&]() {
+            ++blocked;
+            release.WaitForNotification();
+          },
+          /*is_short=*/false);
+    }
+  }
+  Notification engine_ran;
+  grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+      [&engine_ran]() { engine_ran.Notify(); });
+  Notification executor_ran;
+  {
+    ExecCtx exec_ctx;
+    Enqueue([&executor_ran]() { executor_ran.Notify(); });
+  }
+  EXPECT_TRUE(engine_ran.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  EXPECT_TRUE(executor_ran.WaitForNotificationWithTimeout(absl::Seconds(30)));
+  // Only now are the blocking closures let go.
+  release.Notify();
+  executor_.Shutdown();
+  EXPECT_EQ(blocked.load(), num_blocking);
+}
+
+#ifdef GRPC_POSIX_FORK_ALLOW_PTHREAD_ATFORK
+
+std::atomic<int> g_fork_closure_runs{0};
+
+// A fork() handler that runs ahead of the EventEngine's, as it is registered
+// after it. It keeps one EventEngine thread busy until the EventEngine has
+// begun to stop its threads for fork(), and only then hands a closure to the
+// executor. The closure is left queued on the EventEngine.
+void EnqueueClosureWhileEventEngineStopsForFork() {
+  Notification started;
+  grpc_event_engine::experimental::GetDefaultEventEngine()->Run([&started]() {
+    started.Notify();
+    absl::SleepFor(absl::Milliseconds(500));
+    Executor::Run(
+        NewClosure([](grpc_error_handle) { g_fork_closure_runs.fetch_add(1); }),
+        absl::OkStatus());
+  });
+  started.WaitForNotification();
+}
+
+// The EventEngine's fork() handler stops its threads before the executor's
+// does. The executor must not wait for the closures those threads left
+// behind, but run them itself, once.
+TEST(ExecutorForkTest, ClosureQueuedOnEventEngineRunsBeforeFork) {
+  const char* poll_strategy = grpc_get_poll_strategy_name();
+  if (poll_strategy == nullptr || (strcmp(poll_strategy, "epoll1") != 0 &&
+                                   strcmp(poll_strategy, "poll") != 0)) {
+    GTEST_SKIP() << "gRPC fork handlers need the epoll1 or poll strategy";
+  }
+  pthread_atfork(EnqueueClosureWhileEventEngineStopsForFork, nullptr, nullptr);
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    // Nor may the child run it again once its threads are back.
+    absl::SleepFor(absl::Milliseconds(500));
+    _exit(g_fork_closure_runs.load() == 1 ? 0 : 1);
+  }
+  EXPECT_EQ(g_fork_closure_runs.load(), 1);
+  int status;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+  absl::SleepFor(absl::Milliseconds(500));
+  EXPECT_EQ(g_fork_closure_runs.load(), 1);
+}
+
+#endif  // GRPC_POSIX_FORK_ALLOW_PTHREAD_ATFORK
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  // The fork test needs the fork handlers of gRPC and of the EventEngine.
+  grpc_core::ConfigVars::Overrides config_overrides;
+  config_overrides.enable_fork_support = true;
+  grpc_core::ConfigVars::SetOverrides(config_overrides);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
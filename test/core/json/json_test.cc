@@ -249,6 +249,31 @@ TEST(Json, EmbeddedInvalidWhitechars) {
   RunParseFailureTest("\"\t\"");
 }
 
+TEST(Json, LongStrings) {
+  // Put the characters that need processing at every offset of the words
+  // plain characters are scanned by.
+  for (size_t offset = 0; offset < 17; ++offset) {
+    std::string prefix(offset, 'a');
+    std::string suffix(20, 'b');
+    RunSuccessTest(
+        absl::StrCat("{\"", prefix, "\\n", suffix, "\":\"", prefix, "ß",
+                     suffix, "\"}")
+            .c_str(),
+        Json::FromObject({{absl::StrCat(prefix, "\n", suffix),
+                           Json::FromString(
+                               absl::StrCat(prefix, "ß", suffix))}}),
+        absl::StrCat("{\"", prefix, "\\n", suffix, "\":\"", prefix,
+                     "\\u00df", suffix, "\"}")
+            .c_str());
+    RunParseFailureTest(absl::StrCat("\"", prefix, "\t", suffix, "\"").c_str());
+    RunParseFailureTest(
+        absl::StrCat("\"", prefix, "\xc0\xbc", suffix, "\"").c_str());
+    RunParseFailureTest(
+        absl::StrCat("\"", prefix, "\\ud834", suffix, "\"").c_str());
+    RunParseFailureTest(absl::StrCat("\"", prefix, suffix).c_str());
+  }
+}
+
 TEST(Json, EmptyString) { RunParseFailureTest(""); }
 
 TEST(Json, ExtraCharsAtEndOfParsing) {
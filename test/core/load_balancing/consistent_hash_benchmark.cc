@@ -0,0 +1,134 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Compares the hash ring used by ring_hash with the lookup table used by
+// maglev, both with their default sizes unless noted: ring_hash rings have
+// at most 4096 entries, maglev tables have 65537.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/random/random.h"
+#include "absl/strings/str_cat.h"
+
+#include "src/core/load_balancing/ring_hash/consistent_hash.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr size_t kMinRingSize = 1024;
+constexpr size_t kMaxRingSize = 4096;
+
+std::vector<ConsistentHashEndpoint> MakeEndpoints(size_t count) {
+  std::vector<ConsistentHashEndpoint> endpoints;
+  endpoints.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    endpoints.push_back({absl::StrCat("10.0.", i / 256, ".", i % 256, ":443")});
+  }
+  return endpoints;
+}
+
+std::vector<uint64_t> MakeHashes() {
+  absl::BitGen bit_gen;
+  std::vector<uint64_t> hashes(4096);
+  for (uint64_t& hash : hashes) hash = absl::Uniform<uint64_t>(bit_gen);
+  return hashes;
+}
+
+template <typename Lookup>
+void PickLoop(benchmark::State& state, const Lookup& lookup) {
+  const std::vector<uint64_t> hashes = MakeHashes();
+  size_t i = 0;
+  for (auto s : state) {
+    benchmark::DoNotOptimize(
+        lookup.endpoint_index(lookup.Find(hashes[i++ % hashes.size()])));
+  }
+}
+
+void BM_HashRingBuild(benchmark::State& state) {
+  const auto endpoints = MakeEndpoints(state.range(0));
+  for (auto s : state) {
+    HashRing ring(endpoints, kMinRingSize, kMaxRingSize);
+    benchmark::DoNotOptimize(ring.size());
+  }
+}
+BENCHMARK(BM_HashRingBuild)->Arg(1000)->Arg(10000);
+
+// Rebuilds a ring after one endpoint's weight changed. The second argument
+// is the minimum (and maximum) ring size.
+void BM_HashRingUpdate(benchmark::State& state) {
+  auto endpoints = MakeEndpoints(state.range(0));
+  const size_t ring_size = state.range(1);
+  HashRing previous(endpoints, ring_size, ring_size);
+  endpoints[0].weight = 2;
+  for (auto s : state) {
+    HashRing ring(endpoints, ring_size, ring_size, &previous);
+    benchmark::DoNotOptimize(ring.size());
+  }
+}
+BENCHMARK(BM_HashRingUpdate)
+    ->Args({1000, kMaxRingSize})
+    ->Args({10000, kMaxRingSize})
+    ->Args({10000, 1 << 20});
+
+void BM_HashRingBuildLarge(benchmark::State& state) {
+  const auto endpoints = MakeEndpoints(state.range(0));
+  for (auto s : state) {
+    HashRing ring(endpoints, 1 << 20, 1 << 20);
+    benchmark::DoNotOptimize(ring.size());
+  }
+}
+BENCHMARK(BM_HashRingBuildLarge)->Arg(10000);
+
+void BM_MaglevTableBuild(benchmark::State& state) {
+  const auto endpoints = MakeEndpoints(state.range(0));
+  for (auto s : state) {
+    MaglevTable table(endpoints, MaglevTable::kDefaultTableSize);
+    benchmark::DoNotOptimize(table.size());
+  }
+}
+BENCHMARK(BM_MaglevTableBuild)->Arg(1000)->Arg(10000);
+
+void BM_HashRingPick(benchmark::State& state) {
+  PickLoop(state, HashRing(MakeEndpoints(state.range(0)), kMinRingSize,
+                           kMaxRingSize));
+}
+BENCHMARK(BM_HashRingPick)->Arg(1000)->Arg(10000);
+
+void BM_MaglevTablePick(benchmark::State& state) {
+  PickLoop(state, MaglevTable(MakeEndpoints(state.range(0)),
+                              MaglevTable::kDefaultTableSize));
+}
+BENCHMARK(BM_MaglevTablePick)->Arg(1000)->Arg(10000);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
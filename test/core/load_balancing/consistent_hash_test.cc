@@ -0,0 +1,163 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/ring_hash/consistent_hash.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+std::vector<ConsistentHashEndpoint> MakeEndpoints(size_t count) {
+  std::vector<ConsistentHashEndpoint> endpoints;
+  for (size_t i = 0; i < count; ++i) {
+    endpoints.push_back({absl::StrCat("10.0.", i / 256, ".", i % 256, ":443")});
+  }
+  return endpoints;
+}
+
+template <typename Lookup>
+std::vector<size_t> CountEntries(const Lookup& lookup, size_t num_endpoints) {
+  std::vector<size_t> counts(num_endpoints);
+  for (size_t i = 0; i < lookup.size(); ++i) {
+    ++counts[lookup.endpoint_index(i)];
+  }
+  return counts;
+}
+
+TEST(HashRingTest, EntriesFollowWeights) {
+  auto endpoints = MakeEndpoints(3);
+  endpoints[2].weight = 2;
+  HashRing ring(endpoints, 1024, 4096);
+  EXPECT_EQ(CountEntries(ring, 3), (std::vector<size_t>{256, 256, 512}));
+  // Every hash finds a position on the ring.
+  EXPECT_LT(ring.Find(0), ring.size());
+  EXPECT_LT(ring.Find(UINT64_MAX), ring.size());
+}
+
+void ExpectSameRing(const HashRing& ring, const HashRing& expected) {
+  ASSERT_EQ(ring.size(), expected.size());
+  for (size_t i = 0; i < ring.size(); ++i) {
+    ASSERT_EQ(ring.endpoint_index(i), expected.endpoint_index(i)) << i;
+  }
+}
+
+TEST(HashRingTest, UpdateMatchesBuildingFromScratch) {
+  auto endpoints = MakeEndpoints(100);
+  HashRing previous(endpoints, 1024, 4096);
+  // Remove some endpoints, add some, and change some weights.
+  endpoints.erase(endpoints.begin() + 10, endpoints.begin() + 20);
+  auto added = MakeEndpoints(120);
+  endpoints.insert(endpoints.begin() + 5, added.begin() + 100, added.end());
+  endpoints[0].weight = 3;
+  endpoints[50].weight = 2;
+  HashRing updated(endpoints, 1024, 4096, &previous);
+  ExpectSameRing(updated, HashRing(endpoints, 1024, 4096));
+  // Going back works too, including to a smaller ring.
+  auto original = MakeEndpoints(100);
+  ExpectSameRing(HashRing(original, 512, 512, &updated),
+                 HashRing(original, 512, 512));
+}
+
+TEST(HashRingTest, UpdateWeightsOnly) {
+  auto endpoints = MakeEndpoints(100);
+  HashRing previous(endpoints, 1024, 4096);
+  endpoints[7].weight = 5;
+  ExpectSameRing(HashRing(endpoints, 1024, 4096, &previous),
+                 HashRing(endpoints, 1024, 4096));
+}
+
+TEST(HashRingTest, UpdateWithDuplicateKeys) {
+  auto endpoints = MakeEndpoints(10);
+  HashRing previous(endpoints, 1024, 4096);
+  endpoints.push_back(endpoints[3]);
+  ExpectSameRing(HashRing(endpoints, 1024, 4096, &previous),
+                 HashRing(endpoints, 1024, 4096));
+}
+
+TEST(MaglevTableTest, ValidTableSizes) {
+  EXPECT_FALSE(MaglevTable::IsValidTableSize(0));
+  EXPECT_FALSE(MaglevTable::IsValidTableSize(1));
+  EXPECT_TRUE(MaglevTable::IsValidTableSize(2));
+  EXPECT_TRUE(MaglevTable::IsValidTableSize(251));
+  EXPECT_FALSE(MaglevTable::IsValidTableSize(1000));
+  EXPECT_TRUE(MaglevTable::IsValidTableSize(MaglevTable::kDefaultTableSize));
+  EXPECT_TRUE(MaglevTable::IsValidTableSize(MaglevTable::kMaxTableSize));
+  EXPECT_FALSE(MaglevTable::IsValidTableSize(5000077));
+}
+
+TEST(MaglevTableTest, EntriesAreSpreadEvenly) {
+  const auto endpoints = MakeEndpoints(10);
+  MaglevTable table(endpoints, 65537);
+  ASSERT_EQ(table.size(), 65537);
+  // The rounds give each endpoint one entry in turn, so the counts differ
+  // by at most one.
+  for (size_t count : CountEntries(table, endpoints.size())) {
+    EXPECT_GE(count, 6553);
+    EXPECT_LE(count, 6554);
+  }
+}
+
+TEST(MaglevTableTest, EntriesFollowWeights) {
+  auto endpoints = MakeEndpoints(3);
+  endpoints[0].weight = 1;
+  endpoints[1].weight = 2;
+  endpoints[2].weight = 3;
+  MaglevTable table(endpoints, 65537);
+  const auto counts = CountEntries(table, endpoints.size());
+  EXPECT_NEAR(counts[0], 65537 / 6, 2);
+  EXPECT_NEAR(counts[1], 65537 * 2 / 6, 2);
+  EXPECT_NEAR(counts[2], 65537 * 3 / 6, 2);
+}
+
+TEST(MaglevTableTest, RemovingAnEndpointMovesFewOtherEntries) {
+  auto endpoints = MakeEndpoints(100);
+  MaglevTable before(endpoints, 65537);
+  // Remove the last endpoint: indices of the others do not change.
+  endpoints.pop_back();
+  MaglevTable after(endpoints, 65537);
+  size_t moved = 0;
+  for (size_t i = 0; i < before.size(); ++i) {
+    if (before.endpoint_index(i) == 99) continue;
+    if (before.endpoint_index(i) != after.endpoint_index(i)) ++moved;
+  }
+  // Entries of the removed endpoint go to the others; only a small share of
+  // the other entries changes hands.
+  EXPECT_LT(moved, before.size() / 50) << moved;
+}
+
+TEST(MaglevTableTest, FindReturnsAPosition) {
+  const auto endpoints = MakeEndpoints(3);
+  MaglevTable table(endpoints, 251);
+  EXPECT_EQ(table.Find(0), 0);
+  EXPECT_EQ(table.Find(252), 1);
+  EXPECT_LT(table.Find(UINT64_MAX), table.size());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
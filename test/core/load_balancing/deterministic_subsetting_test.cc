@@ -0,0 +1,142 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/load_balancing/deterministic_subsetting/deterministic_subsetting.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+TEST(DeterministicSubsetTest, ARoundOfClientsCoversEveryEndpointOnce) {
+  // 10 subsets of 10 endpoints: clients 10 to 19 form the second round.
+  std::vector<int> uses(100, 0);
+  for (uint64_t client_index = 10; client_index < 20; ++client_index) {
+    auto subset = DeterministicSubset(100, 10, client_index);
+    ASSERT_EQ(subset.size(), 10);
+    for (size_t index : subset) ++uses[index];
+  }
+  EXPECT_EQ(uses, std::vector<int>(100, 1));
+}
+
+TEST(DeterministicSubsetTest, LeftoverEndpointsChangeFromRoundToRound) {
+  // 105 endpoints make 10 subsets of 10, and each round leaves 5 out. Over
+  // many rounds, every endpoint gets used.
+  std::vector<int> uses(105, 0);
+  for (uint64_t client_index = 0; client_index < 1000; ++client_index) {
+    for (size_t index : DeterministicSubset(105, 10, client_index)) {
+      ++uses[index];
+    }
+  }
+  for (int count : uses) {
+    EXPECT_GT(count, 80);
+    EXPECT_LE(count, 100);
+  }
+}
+
+TEST(DeterministicSubsetTest, SameInputsGiveSameSubset) {
+  EXPECT_EQ(DeterministicSubset(1000, 20, 12345),
+            DeterministicSubset(1000, 20, 12345));
+  EXPECT_NE(DeterministicSubset(1000, 20, 12345),
+            DeterministicSubset(1000, 20, 12346));
+}
+
+TEST(DeterministicSubsetTest, SmallFleetIsNotSubset) {
+  EXPECT_EQ(DeterministicSubset(3, 10, 7), (std::vector<size_t>{0, 1, 2}));
+}
+
+class DeterministicSubsettingTest : public LoadBalancingPolicyTest {
+ protected:
+  DeterministicSubsettingTest()
+      : LoadBalancingPolicyTest("deterministic_subsetting_experimental") {}
+
+  RefCountedPtr<LoadBalancingPolicy::Config> MakeDeterministicSubsettingConfig(
+      uint64_t client_index, uint32_t subset_size) {
+    Json child_policy = Json::FromArray(
+        {Json::FromObject({{"round_robin", Json::FromObject({})}})});
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"deterministic_subsetting_experimental",
+          Json::FromObject({{"clientIndex", Json::FromNumber(client_index)},
+                            {"subsetSize", Json::FromNumber(subset_size)},
+                            {"childPolicy", std::move(child_policy)}})}})}));
+  }
+};
+
+TEST_F(DeterministicSubsettingTest, ConnectsOnlyToSubset) {
+  const std::array<absl::string_view, 6> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443",
+      "ipv4:127.0.0.1:444", "ipv4:127.0.0.1:445", "ipv4:127.0.0.1:446"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses,
+                                    MakeDeterministicSubsettingConfig(4, 2)),
+                        lb_policy()),
+            absl::OkStatus());
+  // The addresses are already sorted.
+  const std::vector<size_t> subset = DeterministicSubset(6, 2, 4);
+  for (size_t i = 0; i < kAddresses.size(); ++i) {
+    const bool in_subset =
+        std::find(subset.begin(), subset.end(), i) != subset.end();
+    auto* subchannel = FindSubchannel(kAddresses[i]);
+    EXPECT_EQ(subchannel != nullptr, in_subset) << kAddresses[i];
+    if (subchannel != nullptr) {
+      EXPECT_TRUE(subchannel->ConnectionRequested()) << kAddresses[i];
+    }
+  }
+}
+
+TEST(DeterministicSubsettingConfigTest, SubsetSizeZero) {
+  auto json = JsonParse(
+      "[{\"deterministic_subsetting_experimental\":{"
+      "\"subsetSize\":0,\"childPolicy\":[{\"round_robin\":{}}]}}]");
+  ASSERT_TRUE(json.ok()) << json.status();
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          *json);
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating deterministic_subsetting LB policy config: ["
+                "field:subsetSize error:must be greater than 0]"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
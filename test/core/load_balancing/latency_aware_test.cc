@@ -0,0 +1,171 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class LatencyAwareTest : public LoadBalancingPolicyTest {
+ protected:
+  LatencyAwareTest() : LoadBalancingPolicyTest("latency_aware_experimental") {}
+
+  RefCountedPtr<LoadBalancingPolicy::Config> MakeLatencyAwareConfig(
+      bool peak_ewma = false) {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"latency_aware_experimental",
+          Json::FromObject({{"peakEwma", Json::FromBool(peak_ewma)}})}})}));
+  }
+
+  // Brings up one subchannel per address, and returns the picker that uses
+  // all of them.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> Startup(
+      absl::Span<const absl::string_view> addresses, bool peak_ewma = false) {
+    EXPECT_EQ(ApplyUpdate(BuildUpdate(addresses,
+                                      MakeLatencyAwareConfig(peak_ewma)),
+                          lb_policy()),
+              absl::OkStatus());
+    std::vector<SubchannelState*> subchannels;
+    for (absl::string_view address : addresses) {
+      auto* subchannel = FindSubchannel(address);
+      EXPECT_NE(subchannel, nullptr) << address;
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested()) << address;
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      subchannels.push_back(subchannel);
+    }
+    ExpectConnectingUpdate();
+    subchannels[0]->SetConnectivityState(GRPC_CHANNEL_READY);
+    auto picker = WaitForConnected();
+    for (size_t i = 1; i < subchannels.size(); ++i) {
+      subchannels[i]->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = ExpectState(GRPC_CHANNEL_READY);
+    }
+    return picker;
+  }
+
+  // Runs a call that takes \a latency on \a address.
+  void RunCall(LoadBalancingPolicy::SubchannelPicker* picker,
+               absl::string_view address, absl::Duration latency) {
+    for (int attempt = 0; attempt < 1000; ++attempt) {
+      std::vector<
+          std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+          trackers;
+      auto picks = GetCompletePicks(picker, 1, {}, &trackers);
+      ASSERT_TRUE(picks.has_value());
+      ASSERT_NE(trackers[0], nullptr);
+      if ((*picks)[0] != address) {
+        ReportCompletionToCallTracker(std::move(trackers[0]), (*picks)[0]);
+        continue;
+      }
+      trackers[0]->Start();
+      absl::SleepFor(latency);
+      FakeMetadata metadata({});
+      FakeBackendMetricAccessor backend_metric_accessor({});
+      trackers[0]->Finish(
+          {address, absl::OkStatus(), &metadata, &backend_metric_accessor});
+      return;
+    }
+    FAIL() << "never picked " << address;
+  }
+};
+
+TEST_F(LatencyAwareTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker = Startup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Every endpoint gets picked.
+  auto picks = GetCompletePicks(picker.get(), 100);
+  ASSERT_TRUE(picks.has_value());
+  for (absl::string_view address : kAddresses) {
+    EXPECT_NE(std::find(picks->begin(), picks->end(), address), picks->end())
+        << address;
+  }
+}
+
+TEST_F(LatencyAwareTest, PrefersLowerLatency) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = Startup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  RunCall(picker.get(), kAddresses[0], absl::Milliseconds(50));
+  RunCall(picker.get(), kAddresses[1], absl::Milliseconds(1));
+  // The second endpoint wins whenever it is one of the two candidates.
+  auto picks = GetCompletePicks(picker.get(), 100);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_GE(std::count(picks->begin(), picks->end(), kAddresses[1]), 60);
+}
+
+TEST_F(LatencyAwareTest, PeakEwmaPenalizesSpikesAtOnce) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = Startup(kAddresses, /*peak_ewma=*/true);
+  ASSERT_NE(picker, nullptr);
+  RunCall(picker.get(), kAddresses[0], absl::Milliseconds(10));
+  RunCall(picker.get(), kAddresses[1], absl::Milliseconds(1));
+  // One slow call is enough to move the traffic to the other endpoint.
+  RunCall(picker.get(), kAddresses[1], absl::Milliseconds(50));
+  auto picks = GetCompletePicks(picker.get(), 100);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_GE(std::count(picks->begin(), picks->end(), kAddresses[0]), 60);
+}
+
+TEST(LatencyAwareConfigTest, DecayTimeZero) {
+  auto json = JsonParse(
+      "[{\"latency_aware_experimental\":{\"decayTime\":\"0s\"}}]");
+  ASSERT_TRUE(json.ok()) << json.status();
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          *json);
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating latency_aware LB policy config: ["
+                "field:decayTime error:must be greater than 0]"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
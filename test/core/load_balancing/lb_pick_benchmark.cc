@@ -0,0 +1,311 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// Benchmark the pickers of the LB policies, which run on the critical path
+// of every call, from a growing number of threads sharing one picker.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/log/check.h"
+#include "absl/random/random.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
+#include "absl/types/span.h"
+#include "absl/types/variant.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/address_utils/sockaddr_utils.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/ref_counted_string.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/gprpp/xxhash_inline.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/load_balancing/address_filtering.h"
+#include "src/core/load_balancing/backend_metric_data.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/ring_hash/ring_hash.h"
+#include "src/core/resolver/endpoint_addresses.h"
+#include "src/core/util/json/json.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+constexpr size_t kNumEndpoints = 16;
+constexpr size_t kNumLocalities = 4;
+// The number of distinct request hashes each thread cycles through.
+constexpr size_t kNumHashes = 1024;
+
+// Reuses the LB policy test fixture to get a READY picker from a policy,
+// outside of any gtest test.
+class PickerFixture : public LoadBalancingPolicyTest {
+ public:
+  explicit PickerFixture(absl::string_view lb_policy_name)
+      : LoadBalancingPolicyTest(lb_policy_name) {
+    SetUp();
+  }
+
+  ~PickerFixture() override {
+    DrainStateUpdates();
+    picker_.reset();
+    TearDown();
+  }
+
+  using LoadBalancingPolicyTest::CallAttributes;
+  using LoadBalancingPolicyTest::FakeCallState;
+  using LoadBalancingPolicyTest::FakeMetadata;
+  using LoadBalancingPolicyTest::MakeConfig;
+
+  void TestBody() override {}
+
+  LoadBalancingPolicy::SubchannelPicker* picker() const {
+    return picker_.get();
+  }
+
+  static std::vector<std::string> Addresses() {
+    std::vector<std::string> addresses;
+    for (size_t i = 0; i < kNumEndpoints; ++i) {
+      addresses.push_back(absl::StrCat("ipv4:127.0.0.1:", 1000 + i));
+    }
+    return addresses;
+  }
+
+  // Splits the addresses between kNumLocalities weighted_target children.
+  static std::vector<EndpointAddresses> LocalityEndpoints() {
+    std::vector<EndpointAddresses> endpoints;
+    std::vector<std::string> addresses = Addresses();
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      endpoints.emplace_back(
+          MakeAddress(addresses[i]),
+          ChannelArgs().SetObject(MakeRefCounted<HierarchicalPathArg>(
+              std::vector<RefCountedStringValue>{RefCountedStringValue(
+                  absl::StrCat("locality", i % kNumLocalities))})));
+    }
+    return endpoints;
+  }
+
+  // The hash that makes ring_hash pick the endpoint at address.
+  static uint64_t EndpointHash(absl::string_view address) {
+    std::string hash_input =
+        absl::StrCat(absl::StripPrefix(address, "ipv4:"), "_0");
+    return XXH64(hash_input.data(), hash_input.size(), 0);
+  }
+
+  // Sends the update and brings all of its subchannels to READY.
+  void Connect(absl::Span<const EndpointAddresses> endpoints,
+               RefCountedPtr<LoadBalancingPolicy::Config> config) {
+    CHECK_OK(ApplyUpdate(BuildUpdate(endpoints, std::move(config)),
+                         lb_policy()));
+    std::vector<std::string> addresses;
+    for (const EndpointAddresses& endpoint : endpoints) {
+      addresses.push_back(grpc_sockaddr_to_uri(&endpoint.address()).value());
+    }
+    // ring_hash only connects to the endpoints that are picked.
+    if (lb_policy()->name() == "ring_hash_experimental") {
+      DrainStateUpdates();
+      for (const std::string& address : addresses) {
+        RequestHashAttribute attribute(EndpointHash(address));
+        DoPick(picker_.get(), {&attribute});
+      }
+      WaitForWorkSerializerToFlush();
+      WaitForWorkSerializerToFlush();
+    }
+    for (const std::string& address : addresses) {
+      SubchannelState* subchannel = FindSubchannel(address);
+      CHECK_NE(subchannel, nullptr) << address;
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+    }
+    DrainStateUpdates();
+    CHECK(absl::holds_alternative<LoadBalancingPolicy::PickResult::Complete>(
+        DoPick(picker_.get()).result));
+  }
+
+  void Connect(absl::Span<const std::string> addresses,
+               RefCountedPtr<LoadBalancingPolicy::Config> config) {
+    std::vector<EndpointAddresses> endpoints;
+    for (const std::string& address : addresses) {
+      endpoints.emplace_back(MakeAddress(address), ChannelArgs());
+    }
+    Connect(endpoints, std::move(config));
+  }
+
+  // Reports different loads for the backends through the calls' trackers,
+  // then lets weighted_round_robin update its weights, so that the picker
+  // uses its StaticStrideScheduler.
+  void ReportWeights(Duration weight_update_period) {
+    for (size_t i = 0; i < 10 * kNumEndpoints; ++i) {
+      auto result = DoPick(picker_.get());
+      auto* complete = absl::get_if<LoadBalancingPolicy::PickResult::Complete>(
+          &result.result);
+      CHECK_NE(complete, nullptr);
+      CHECK(complete->subchannel_call_tracker != nullptr);
+      auto* subchannel = static_cast<SubchannelState::FakeSubchannel*>(
+          complete->subchannel.get());
+      const std::string& address = subchannel->state()->address();
+      BackendMetricData backend_metric_data;
+      backend_metric_data.qps = 100;
+      backend_metric_data.application_utilization =
+          0.1 * (1 + (EndpointHash(address) % 9));
+      complete->subchannel_call_tracker->Start();
+      FakeMetadata metadata({});
+      FakeBackendMetricAccessor backend_metric_accessor(backend_metric_data);
+      complete->subchannel_call_tracker->Finish(
+          {address, absl::OkStatus(), &metadata, &backend_metric_accessor});
+    }
+    IncrementTimeBy(weight_update_period);
+  }
+
+ private:
+  // Keeps the picker from the last state update reported by the policy.
+  void DrainStateUpdates() {
+    while (!helper_->QueueEmpty()) {
+      auto update = helper_->GetNextStateUpdate();
+      CHECK(update.has_value());
+      picker_ = std::move(update->picker);
+    }
+  }
+
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker_;
+};
+
+// Set up by the first thread before the threads start picking.
+PickerFixture* g_fixture = nullptr;
+
+template <typename Setup>
+void RunPickBenchmark(benchmark::State& state, Setup setup) {
+  if (state.thread_index() == 0) g_fixture = setup();
+  // Each thread cycles through its own request hashes, which only ring_hash
+  // looks at.
+  absl::BitGen bit_gen;
+  std::vector<std::unique_ptr<RequestHashAttribute>> attributes;
+  std::vector<std::unique_ptr<PickerFixture::FakeCallState>> call_states;
+  for (size_t i = 0; i < kNumHashes; ++i) {
+    attributes.push_back(std::make_unique<RequestHashAttribute>(
+        absl::Uniform<uint64_t>(bit_gen)));
+    call_states.push_back(std::make_unique<PickerFixture::FakeCallState>(
+        PickerFixture::CallAttributes{attributes.back().get()}));
+  }
+  ExecCtx exec_ctx;
+  PickerFixture::FakeMetadata metadata({});
+  size_t i = 0;
+  // The fixture is only read in the loop, whose start waits for the setup
+  // of the first thread.
+  for (auto _ : state) {
+    auto result = g_fixture->picker()->Pick(
+        {"/service/method", &metadata, call_states[i].get()});
+    benchmark::DoNotOptimize(result);
+    if (++i == kNumHashes) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    delete g_fixture;
+    g_fixture = nullptr;
+  }
+}
+
+RefCountedPtr<LoadBalancingPolicy::Config> PolicyConfig(Json::Object config) {
+  return PickerFixture::MakeConfig(
+      Json::FromArray({Json::FromObject(std::move(config))}));
+}
+
+void BM_RoundRobinPick(benchmark::State& state) {
+  RunPickBenchmark(state, [] {
+    auto* fixture = new PickerFixture("round_robin");
+    fixture->Connect(PickerFixture::Addresses(),
+                     PolicyConfig({{"round_robin", Json::FromObject({})}}));
+    return fixture;
+  });
+}
+BENCHMARK(BM_RoundRobinPick)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_WeightedRoundRobinPick(benchmark::State& state) {
+  RunPickBenchmark(state, [] {
+    auto* fixture = new PickerFixture("weighted_round_robin");
+    // Weights are used as soon as they are reported.
+    Json::Object config = {{"blackoutPeriod", Json::FromString("0s")},
+                           {"weightUpdatePeriod", Json::FromString("0.1s")}};
+    fixture->Connect(
+        PickerFixture::Addresses(),
+        PolicyConfig(
+            {{"weighted_round_robin", Json::FromObject(std::move(config))}}));
+    fixture->ReportWeights(Duration::Milliseconds(100));
+    return fixture;
+  });
+}
+BENCHMARK(BM_WeightedRoundRobinPick)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_RingHashPick(benchmark::State& state) {
+  RunPickBenchmark(state, [] {
+    auto* fixture = new PickerFixture("ring_hash_experimental");
+    fixture->Connect(
+        PickerFixture::Addresses(),
+        PolicyConfig({{"ring_hash_experimental", Json::FromObject({})}}));
+    return fixture;
+  });
+}
+BENCHMARK(BM_RingHashPick)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_WeightedTargetPick(benchmark::State& state) {
+  RunPickBenchmark(state, [] {
+    auto* fixture = new PickerFixture("weighted_target_experimental");
+    Json::Object targets;
+    for (size_t i = 0; i < kNumLocalities; ++i) {
+      targets[absl::StrCat("locality", i)] = Json::FromObject(
+          {{"weight", Json::FromNumber(i + 1)},
+           {"childPolicy",
+            Json::FromArray({Json::FromObject(
+                {{"round_robin", Json::FromObject({})}})})}});
+    }
+    Json::Object config = {{"targets", Json::FromObject(std::move(targets))}};
+    fixture->Connect(PickerFixture::LocalityEndpoints(),
+                     PolicyConfig({{"weighted_target_experimental",
+                                    Json::FromObject(std::move(config))}}));
+    return fixture;
+  });
+}
+BENCHMARK(BM_WeightedTargetPick)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
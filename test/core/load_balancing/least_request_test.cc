@@ -0,0 +1,154 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/load_balancing/lb_policy.h"
+#include "src/core/util/json/json.h"
+#include "src/core/util/json/json_reader.h"
+#include "test/core/load_balancing/lb_policy_test_lib.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class LeastRequestTest : public LoadBalancingPolicyTest {
+ protected:
+  LeastRequestTest() : LoadBalancingPolicyTest("least_request_experimental") {}
+
+  RefCountedPtr<LoadBalancingPolicy::Config> MakeLeastRequestConfig(
+      int choice_count = 2) {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"least_request_experimental",
+          Json::FromObject(
+              {{"choiceCount", Json::FromNumber(choice_count)}})}})}));
+  }
+
+  // Brings up one subchannel per address, and returns the picker that uses
+  // all of them.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> Startup(
+      absl::Span<const absl::string_view> addresses) {
+    EXPECT_EQ(ApplyUpdate(BuildUpdate(addresses, MakeLeastRequestConfig()),
+                          lb_policy()),
+              absl::OkStatus());
+    std::vector<SubchannelState*> subchannels;
+    for (absl::string_view address : addresses) {
+      auto* subchannel = FindSubchannel(address);
+      EXPECT_NE(subchannel, nullptr) << address;
+      if (subchannel == nullptr) return nullptr;
+      EXPECT_TRUE(subchannel->ConnectionRequested()) << address;
+      subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+      subchannels.push_back(subchannel);
+    }
+    ExpectConnectingUpdate();
+    subchannels[0]->SetConnectivityState(GRPC_CHANNEL_READY);
+    auto picker = WaitForConnected();
+    for (size_t i = 1; i < subchannels.size(); ++i) {
+      subchannels[i]->SetConnectivityState(GRPC_CHANNEL_READY);
+      picker = ExpectState(GRPC_CHANNEL_READY);
+    }
+    return picker;
+  }
+};
+
+TEST_F(LeastRequestTest, Basic) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  auto picker = Startup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Every endpoint gets picked.
+  auto picks = GetCompletePicks(picker.get(), 100);
+  ASSERT_TRUE(picks.has_value());
+  for (absl::string_view address : kAddresses) {
+    EXPECT_NE(std::find(picks->begin(), picks->end(), address), picks->end())
+        << address;
+  }
+}
+
+TEST_F(LeastRequestTest, PrefersEndpointsWithFewerCallsInFlight) {
+  const std::array<absl::string_view, 2> kAddresses = {"ipv4:127.0.0.1:441",
+                                                       "ipv4:127.0.0.1:442"};
+  auto picker = Startup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Start 100 calls and keep them in flight: they spread evenly.
+  std::vector<
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+      trackers;
+  auto picks = GetCompletePicks(picker.get(), 100, {}, &trackers);
+  ASSERT_TRUE(picks.has_value());
+  int in_flight[2] = {0, 0};
+  for (size_t i = 0; i < picks->size(); ++i) {
+    ASSERT_NE(trackers[i], nullptr);
+    trackers[i]->Start();
+    ++in_flight[(*picks)[i] == kAddresses[0] ? 0 : 1];
+  }
+  EXPECT_LE(abs(in_flight[0] - in_flight[1]), 10)
+      << in_flight[0] << " vs " << in_flight[1];
+  // Finish the calls to the first endpoint.
+  for (size_t i = 0; i < picks->size(); ++i) {
+    if ((*picks)[i] != kAddresses[0]) continue;
+    ReportCompletionToCallTracker(std::move(trackers[i]), (*picks)[i]);
+  }
+  // Short calls now mostly go to the first endpoint: the second one is only
+  // picked when it is the only candidate.
+  picks = GetCompletePicks(picker.get(), 100);
+  ASSERT_TRUE(picks.has_value());
+  EXPECT_GE(std::count(picks->begin(), picks->end(), kAddresses[0]), 60);
+  // Finish the remaining calls.
+  for (size_t i = 0; i < trackers.size(); ++i) {
+    if (trackers[i] == nullptr) continue;
+    ReportCompletionToCallTracker(std::move(trackers[i]), kAddresses[1]);
+  }
+}
+
+TEST(LeastRequestConfigTest, ChoiceCountTooSmall) {
+  auto json = JsonParse(
+      "[{\"least_request_experimental\":{\"choiceCount\":1}}]");
+  ASSERT_TRUE(json.ok()) << json.status();
+  auto config =
+      CoreConfiguration::Get().lb_policy_registry().ParseLoadBalancingConfig(
+          *json);
+  EXPECT_EQ(config.status(),
+            absl::InvalidArgumentError(
+                "errors validating least_request LB policy config: ["
+                "field:choiceCount error:must be at least 2]"));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -22,6 +22,7 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -168,6 +169,26 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
     }
     return address;
   }
+
+  // Does picks until num_calls of them have gone to address, reporting
+  // those as failed calls and the others as successful ones.
+  void FailCallsTo(LoadBalancingPolicy::SubchannelPicker* picker,
+                   absl::string_view address, size_t num_calls) {
+    size_t num_failed = 0;
+    while (num_failed < num_calls) {
+      std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
+          subchannel_call_tracker;
+      auto picked = ExpectPickComplete(picker, {}, &subchannel_call_tracker);
+      if (!picked.has_value()) return;
+      absl::Status status;
+      if (*picked == address) {
+        status = absl::UnavailableError("uh oh");
+        ++num_failed;
+      }
+      ReportCompletionToCallTracker(std::move(subchannel_call_tracker),
+                                    *picked, status);
+    }
+  }
 };
 
 TEST_F(OutlierDetectionTest, Basic) {
@@ -236,6 +257,74 @@ TEST_F(OutlierDetectionTest, FailurePercentage) {
   WaitForRoundRobinListChange(remaining_addresses, kAddresses);
 }
 
+// Calls are counted per CPU, so calls that finish on different threads at
+// the same time must all make it into the interval's totals. The request
+// volume is exactly the number of failed calls, so losing any one of them
+// would keep the endpoint from being ejected.
+TEST_F(OutlierDetectionTest, CallsFinishingOnManyThreadsAreAllCounted) {
+  constexpr std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:440", "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442"};
+  constexpr size_t kNumThreads = 8;
+  constexpr size_t kCallsPerThread = 100;
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses,
+                  ConfigBuilder()
+                      .SetFailurePercentageThreshold(50)
+                      .SetFailurePercentageMinimumHosts(1)
+                      .SetFailurePercentageRequestVolume(kNumThreads *
+                                                         kCallsPerThread)
+                      .SetMaxEjectionTime(Duration::Seconds(1))
+                      .SetBaseEjectionTime(Duration::Seconds(1))
+                      .Build()),
+      lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  auto picker = ExpectRoundRobinStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&]() {
+      FailCallsTo(picker.get(), kAddresses[0], kCallsPerThread);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  LOG(INFO) << "### failed RPCs reported";
+  IncrementTimeBy(Duration::Seconds(10));
+  WaitForRoundRobinListChange(kAddresses, {kAddresses[1], kAddresses[2]});
+}
+
+// The counts that the ejection sweep looks at are those of the interval that
+// just ended, not the totals since the endpoint was created.
+TEST_F(OutlierDetectionTest, CallCountsStartOverEachInterval) {
+  constexpr std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:440", "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442"};
+  constexpr size_t kRequestVolume = 10;
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses,
+                  ConfigBuilder()
+                      .SetFailurePercentageThreshold(50)
+                      .SetFailurePercentageMinimumHosts(1)
+                      .SetFailurePercentageRequestVolume(kRequestVolume)
+                      .SetMaxEjectionTime(Duration::Seconds(1))
+                      .SetBaseEjectionTime(Duration::Seconds(1))
+                      .Build()),
+      lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  auto picker = ExpectRoundRobinStartup(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Two intervals with half the request volume each: together they reach
+  // it, but neither does on its own, so nothing is ejected.
+  for (int i = 0; i < 2; ++i) {
+    FailCallsTo(picker.get(), kAddresses[0], kRequestVolume / 2);
+    IncrementTimeBy(Duration::Seconds(10));
+    ExpectQueueEmpty();
+  }
+  LOG(INFO) << "### no ejection after two short intervals";
+  // An interval with the full request volume gets the endpoint ejected.
+  FailCallsTo(picker.get(), kAddresses[0], kRequestVolume);
+  IncrementTimeBy(Duration::Seconds(10));
+  WaitForRoundRobinListChange(kAddresses, {kAddresses[1], kAddresses[2]});
+}
+
 TEST_F(OutlierDetectionTest, MultipleAddressesPerEndpoint) {
   // Can't use timer duration expectation here, because the Happy
   // Eyeballs timer inside pick_first will use a different duration than
@@ -35,6 +35,7 @@
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
 #include <grpc/support/json.h>
 
 #include "src/core/lib/experiments/experiments.h"
@@ -1379,6 +1380,36 @@ TEST_F(PickFirstHealthCheckingEnabledTest, UpdateWithReadyChannel) {
   EXPECT_EQ(subchannel->NumWatchers(), 2);
 }
 
+class PickFirstRememberConnectedAddressTest : public PickFirstTest {
+ protected:
+  PickFirstRememberConnectedAddressTest()
+      : PickFirstTest(ChannelArgs().Set(
+            GRPC_ARG_EXPERIMENTAL_PICK_FIRST_REMEMBER_CONNECTED_ADDRESS,
+            true)) {}
+};
+
+TEST_F(PickFirstRememberConnectedAddressTest, TriesLastConnectedAddressFirst) {
+  if (!IsPickFirstNewEnabled()) return;
+  constexpr std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444", "ipv4:127.0.0.1:445"};
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses, MakePickFirstConfig(false)), lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  // The first two addresses fail, and the last one connects.
+  std::vector<absl::string_view> address_order;
+  GetOrderAddressesArePicked(kAddresses, &address_order);
+  EXPECT_THAT(address_order, ::testing::ElementsAreArray(kAddresses));
+  // The next update tries the address that connected first, and then the
+  // others in order.
+  status = ApplyUpdate(BuildUpdate(kAddresses, MakePickFirstConfig(false)),
+                       lb_policy());
+  EXPECT_TRUE(status.ok()) << status;
+  GetOrderAddressesArePicked(kAddresses, &address_order);
+  EXPECT_THAT(address_order,
+              ::testing::ElementsAre(kAddresses[2], kAddresses[0],
+                                     kAddresses[1]));
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
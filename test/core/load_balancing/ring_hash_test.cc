@@ -37,6 +37,7 @@
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/xxhash_inline.h"
 #include "src/core/load_balancing/lb_policy.h"
+#include "src/core/load_balancing/ring_hash/consistent_hash.h"
 #include "src/core/resolver/endpoint_addresses.h"
 #include "src/core/util/json/json.h"
 #include "test/core/load_balancing/lb_policy_test_lib.h"
@@ -184,6 +185,48 @@ TEST_F(RingHashTest, MultipleAddressesPerEndpoint) {
   EXPECT_EQ(address, kEndpoint1Addresses[1]);
 }
 
+class MaglevTest : public LoadBalancingPolicyTest {
+ protected:
+  MaglevTest() : LoadBalancingPolicyTest("maglev_experimental") {}
+
+  static RefCountedPtr<LoadBalancingPolicy::Config> MakeMaglevConfig(
+      int table_size) {
+    return MakeConfig(Json::FromArray({Json::FromObject(
+        {{"maglev_experimental",
+          Json::FromObject({{"tableSize", Json::FromNumber(table_size)}})}})}));
+  }
+};
+
+TEST_F(MaglevTest, PicksFollowTheTable) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(kAddresses, MakeMaglevConfig(251)), lb_policy()),
+      absl::OkStatus());
+  auto picker = ExpectState(GRPC_CHANNEL_IDLE);
+  // The policy keys the table by address, as the ring_hash ring.
+  std::vector<ConsistentHashEndpoint> endpoints;
+  for (absl::string_view address : kAddresses) {
+    endpoints.push_back({std::string(absl::StripPrefix(address, "ipv4:"))});
+  }
+  MaglevTable table(endpoints, 251);
+  RequestHashAttribute hash_attribute(1234);
+  const absl::string_view expected_address =
+      kAddresses[table.endpoint_index(table.Find(1234))];
+  ExpectPickQueued(picker.get(), {&hash_attribute});
+  WaitForWorkSerializerToFlush();
+  WaitForWorkSerializerToFlush();
+  auto* subchannel = FindSubchannel(expected_address);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  picker = ExpectState(GRPC_CHANNEL_CONNECTING);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  auto address = ExpectPickComplete(picker.get(), {&hash_attribute});
+  EXPECT_EQ(address, expected_address);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
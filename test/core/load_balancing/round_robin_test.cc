@@ -68,6 +68,31 @@ TEST_F(RoundRobinTest, AddressUpdates) {
                               absl::MakeSpan(kAddresses).last(2));
 }
 
+TEST_F(RoundRobinTest, UnchangedEndpointsKeepTheirChildPolicies) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, nullptr), lb_policy()),
+            absl::OkStatus());
+  ExpectRoundRobinStartup(kAddresses);
+  // Send update to remove address 2.  The other endpoints keep their
+  // pick_first children, so no new watchers are started on their
+  // subchannels.
+  EXPECT_EQ(
+      ApplyUpdate(BuildUpdate(absl::MakeSpan(kAddresses).first(2), nullptr),
+                  lb_policy()),
+      absl::OkStatus());
+  for (size_t i = 0; i < 2; ++i) {
+    auto* subchannel = FindSubchannel(kAddresses[i]);
+    ASSERT_NE(subchannel, nullptr);
+    EXPECT_EQ(subchannel->NumWatchers(), 1) << kAddresses[i];
+  }
+  WaitForRoundRobinListChange(kAddresses, absl::MakeSpan(kAddresses).first(2));
+  // Re-add address 2, which gets a new child.
+  EXPECT_EQ(ApplyUpdate(BuildUpdate(kAddresses, nullptr), lb_policy()),
+            absl::OkStatus());
+  WaitForRoundRobinListChange(absl::MakeSpan(kAddresses).first(2), kAddresses);
+}
+
 TEST_F(RoundRobinTest, MultipleAddressesPerEndpoint) {
   constexpr std::array<absl::string_view, 2> kEndpoint1Addresses = {
       "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
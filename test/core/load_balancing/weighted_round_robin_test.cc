@@ -19,11 +19,13 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -35,6 +37,7 @@
 #include "absl/time/time.h"
 #include "absl/types/optional.h"
 #include "absl/types/span.h"
+#include "absl/types/variant.h"
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
@@ -675,6 +678,68 @@ TEST_F(WeightedRoundRobinTest, WeightUpdatePeriodLowerBound) {
       {{kAddresses[0], 1}, {kAddresses[1], 3}, {kAddresses[2], 3}});
 }
 
+// Every run of the weight update timer swaps in a new scheduler, while
+// picks keep using the current one without taking a lock.
+TEST_F(WeightedRoundRobinTest, PicksRaceWithSchedulerSwaps) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  const std::map<absl::string_view, BackendMetricData> kBackendMetrics = {
+      {kAddresses[0], MakeBackendMetricData(/*app_utilization=*/0.9,
+                                            /*qps=*/100.0, /*eps=*/0.0)},
+      {kAddresses[1], MakeBackendMetricData(/*app_utilization=*/0.3,
+                                            /*qps=*/100.0, /*eps=*/0.0)},
+      {kAddresses[2], MakeBackendMetricData(/*app_utilization=*/0.3,
+                                            /*qps=*/100.0, /*eps=*/0.0)}};
+  auto picker = SendInitialUpdateAndWaitForConnected(kAddresses);
+  ASSERT_NE(picker, nullptr);
+  WaitForWeightedRoundRobinPicks(
+      &picker, kBackendMetrics,
+      {{kAddresses[0], 1}, {kAddresses[1], 3}, {kAddresses[2], 3}});
+  constexpr size_t kNumThreads = 8;
+  std::atomic<bool> done{false};
+  std::atomic<size_t> num_picks{0};
+  std::atomic<size_t> num_bad_picks{0};
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  for (size_t i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&]() {
+      while (!done.load(std::memory_order_relaxed)) {
+        auto pick_result = DoPick(picker.get());
+        auto* complete =
+            absl::get_if<LoadBalancingPolicy::PickResult::Complete>(
+                &pick_result.result);
+        if (complete == nullptr ||
+            std::find(kAddresses.begin(), kAddresses.end(),
+                      static_cast<SubchannelState::FakeSubchannel*>(
+                          complete->subchannel.get())
+                          ->state()
+                          ->address()) == kAddresses.end()) {
+          num_bad_picks.fetch_add(1, std::memory_order_relaxed);
+        }
+        num_picks.fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+  // Each second of the fake clock runs the timer, and so a swap. Wait for
+  // some picks in between, so that swaps find picks in flight.
+  for (int i = 0; i < 50; ++i) {
+    const size_t picks_before = num_picks.load(std::memory_order_relaxed);
+    while (num_picks.load(std::memory_order_relaxed) <
+           picks_before + kNumThreads) {
+      std::this_thread::yield();
+    }
+    IncrementTimeBy(Duration::Seconds(1));
+  }
+  done.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(num_bad_picks.load(), 0u);
+  // The weights were not reported again, but have not expired yet either,
+  // so the latest scheduler still uses them.
+  ExpectWeightedRoundRobinPicks(
+      picker.get(), kBackendMetrics,
+      {{kAddresses[0], 1}, {kAddresses[1], 3}, {kAddresses[2], 3}});
+}
+
 TEST_F(WeightedRoundRobinTest, WeightExpirationPeriod) {
   // Send address list to LB policy.
   const std::array<absl::string_view, 3> kAddresses = {
@@ -143,7 +143,7 @@ int main(int argc, char** argv) {
   long before_server_memory;
   GetBeforeSnapshot(get_memory_channel, before_server_memory)
       ->done.WaitForNotification();
-  long before_client_memory = GetMemUsage();
+  MemStats before_client_memory = MemStats::Snapshot();
 
   // Create the channels and send an RPC to confirm they're open
   int size = absl::GetFlag(FLAGS_size);
@@ -158,7 +158,7 @@ int main(int argc, char** argv) {
   long peak_server_memory = absl::GetFlag(FLAGS_server_pid) > 0
                                 ? GetMemUsage(absl::GetFlag(FLAGS_server_pid))
                                 : 0;
-  long peak_client_memory = GetMemUsage();
+  MemStats peak_client_memory = MemStats::Snapshot();
 
   // Checking that all channels are still open
   for (int i = 0; i < size; ++i) {
@@ -176,8 +176,11 @@ int main(int argc, char** argv) {
   printf("---------Client channel stats--------\n");
   printf("%sclient channel memory usage: %f bytes per channel\n",
          prefix.c_str(),
-         static_cast<double>(peak_client_memory - before_client_memory) / size *
-             1024);
+         static_cast<double>(peak_client_memory.rss -
+                             before_client_memory.rss) /
+             size * 1024);
+  PrintQuotaUsage(absl::StrCat(prefix, "client channel"), before_client_memory,
+                  peak_client_memory, size, "channel");
   if (absl::GetFlag(FLAGS_server_pid) > 0) {
     printf("---------Server channel stats--------\n");
     printf("%sserver channel memory usage: %f bytes per channel\n",
@@ -30,6 +30,7 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpc/byte_buffer.h>
 #include <grpc/byte_buffer_reader.h>
@@ -309,11 +310,18 @@ int main(int argc, char** argv) {
                              client_benchmark_calls_start.rss) /
              benchmark_iterations * 1024);
 
+  PrintQuotaUsage(absl::StrCat(prefix, "client call"),
+                  client_benchmark_calls_start, client_calls_inflight,
+                  benchmark_iterations, "call");
+
   printf("---------server stats--------\n");
   printf("%sserver call memory usage: %f bytes per call\n", prefix,
          static_cast<double>(server_calls_inflight.rss -
                              server_benchmark_calls_start.rss) /
              benchmark_iterations * 1024);
+  PrintQuotaUsage(absl::StrCat(prefix, "server call"),
+                  server_benchmark_calls_start, server_calls_inflight,
+                  benchmark_iterations, "call");
 
   return 0;
 }
@@ -33,6 +33,7 @@
 #include "absl/flags/flag.h"
 #include "absl/flags/parse.h"
 #include "absl/log/log.h"
+#include "absl/strings/numbers.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/str_split.h"
@@ -65,10 +66,14 @@ ABSL_FLAG(std::string, benchmark_names, "",
           "if --use_xds is true.");
 
 ABSL_FLAG(int, size, 1000, "Number of channels/calls");
+ABSL_FLAG(std::vector<std::string>, sweep, {},
+          "Numbers of channels/calls to run each benchmark with in turn, "
+          "instead of --size, to see how memory usage scales");
 ABSL_FLAG(
     std::string, scenario_config, "insecure",
     "Possible Values: minstack (Use minimal stack), resource_quota, insecure, "
-    "secure (Use SSL credentials on server), chaotic_good");
+    "secure (Use SSL credentials on server), chaotic_good, slab_allocator "
+    "(Allocate slices from the slab allocator)");
 ABSL_FLAG(bool, memory_profiling, false,
           "Run memory profiling");  // TODO (chennancy) Connect this flag
 ABSL_FLAG(bool, use_xds, false, "Use xDS");
@@ -98,7 +103,7 @@ class Subprocess {
 };
 
 // per-call memory usage benchmark
-int RunCallBenchmark(int port, char* root,
+int RunCallBenchmark(int port, char* root, int size,
                      std::vector<std::string> server_scenario_flags,
                      std::vector<std::string> client_scenario_flags) {
   int status;
@@ -133,7 +138,7 @@ int RunCallBenchmark(int port, char* root,
       "--grpc_experiments",
       std::string(grpc_core::ConfigVars::Get().Experiments()),
       absl::StrCat("--warmup=", 10000),
-      absl::StrCat("--benchmark=", absl::GetFlag(FLAGS_size))};
+      absl::StrCat("--benchmark=", size)};
   // Add scenario-specific client flags to the end of the client_flags
   absl::c_move(client_scenario_flags, std::back_inserter(client_flags));
   Subprocess cli(client_flags);
@@ -149,7 +154,8 @@ int RunCallBenchmark(int port, char* root,
 }
 
 // Per-channel benchmark
-int RunChannelBenchmark(const std::vector<int>& server_ports, char* root) {
+int RunChannelBenchmark(const std::vector<int>& server_ports, char* root,
+                        int size) {
   // TODO(chennancy) Add the scenario specific flags
 
   // start the servers
@@ -179,7 +185,7 @@ int RunChannelBenchmark(const std::vector<int>& server_ports, char* root) {
       absl::GetFlag(FLAGS_use_xds)
           ? absl::StrCat("xds:", XdsResourceUtils::kServerName)
           : grpc_core::LocalIpAndPort(server_ports[0]),
-      "--nosecure", absl::StrCat("--size=", absl::GetFlag(FLAGS_size))};
+      "--nosecure", absl::StrCat("--size=", size)};
   if (server_ports.size() == 1) {
     client_flags.emplace_back(
         absl::StrCat("--server_pid=", servers[0].GetPID()));
@@ -253,10 +259,10 @@ XdsServer StartXdsServerAndConfigureBootstrap(
   return xds_server;
 }
 
-int RunBenchmark(char* root, absl::string_view benchmark,
+int RunBenchmark(char* root, absl::string_view benchmark, int size,
                  std::vector<std::string> server_scenario_flags,
                  std::vector<std::string> client_scenario_flags) {
-  LOG(INFO) << "running benchmark: " << benchmark;
+  LOG(INFO) << "running benchmark: " << benchmark << " with size " << size;
   const size_t num_ports = benchmark == "channel_multi_address" ? 10 : 1;
   std::vector<int> server_ports;
   server_ports.reserve(num_ports);
@@ -270,10 +276,10 @@ int RunBenchmark(char* root, absl::string_view benchmark,
   }
   int retval;
   if (benchmark == "call") {
-    retval = RunCallBenchmark(server_ports[0], root, server_scenario_flags,
-                              client_scenario_flags);
+    retval = RunCallBenchmark(server_ports[0], root, size,
+                              server_scenario_flags, client_scenario_flags);
   } else if (benchmark == "channel" || benchmark == "channel_multi_address") {
-    retval = RunChannelBenchmark(server_ports, root);
+    retval = RunChannelBenchmark(server_ports, root, size);
   } else {
     LOG(INFO) << "Not a valid benchmark name";
     retval = 4;
@@ -310,6 +316,8 @@ int main(int argc, char** argv) {
       {"resource_quota", {/*client=*/{}, /*server=*/{"--secure"}}},
       {"minstack", {/*client=*/{"--minstack"}, /*server=*/{"--minstack"}}},
       {"insecure", {{}, {}}},
+      {"slab_allocator",
+       {{"--grpc_slice_slab_allocator"}, {"--grpc_slice_slab_allocator"}}},
       {"chaotic_good", {{"--chaotic_good"}, {"--chaotic_good"}}}};
   auto it_scenario = scenarios.find(absl::GetFlag(FLAGS_scenario_config));
   if (it_scenario == scenarios.end()) {
@@ -326,11 +334,28 @@ int main(int argc, char** argv) {
                           : "call,channel";
   }
   auto benchmarks = absl::StrSplit(benchmark_names, ',');
+  std::vector<int> sizes;
+  for (const std::string& size : absl::GetFlag(FLAGS_sweep)) {
+    int value;
+    if (!absl::SimpleAtoi(size, &value) || value <= 0) {
+      printf("Invalid size in --sweep: %s\n", size.c_str());
+      return 3;
+    }
+    sizes.push_back(value);
+  }
+  if (sizes.empty()) sizes.push_back(absl::GetFlag(FLAGS_size));
   grpc_init();
   for (const auto& benchmark : benchmarks) {
-    int r = RunBenchmark(root, benchmark, it_scenario->second.server,
-                         it_scenario->second.client);
-    if (r != 0) return r;
+    for (int size : sizes) {
+      if (sizes.size() > 1) {
+        printf("---------%s benchmark with size %d--------\n",
+               std::string(benchmark).c_str(), size);
+        fflush(stdout);
+      }
+      int r = RunBenchmark(root, benchmark, size, it_scenario->second.server,
+                           it_scenario->second.client);
+      if (r != 0) return r;
+    }
   }
   grpc_shutdown();
   return 0;
@@ -14,16 +14,20 @@
 
 #include "test/core/memory_usage/memstats.h"
 
+#include <stdio.h>
 #include <unistd.h>
 
 #include <fstream>
 #include <string>
 
+
 #include "absl/log/check.h"
 #include "absl/strings/str_cat.h"
 
 #include <grpc/support/log.h>
 
+#include "src/core/lib/resource_quota/memory_quota.h"
+
 long GetMemUsage(absl::optional<int> pid) {
   // Default is getting memory usage for self (calling process)
   std::string path = "/proc/self/stat";
@@ -56,3 +60,26 @@ long GetMemUsage(absl::optional<int> pid) {
   // Memory in KB
   return resident_set;
 }
+
+MemStats MemStats::Snapshot() {
+  MemStats stats{GetMemUsage(), {}};
+  for (const auto& quota : grpc_core::AllMemoryQuotas()) {
+    for (const auto& usage : quota->MemoryUsageByTag()) {
+      size_t i = 0;
+      while (i + 1 < kNumMemStatsTags && usage.first != kMemStatsTags[i]) ++i;
+      stats.quota_bytes[i] += usage.second;
+    }
+  }
+  return stats;
+}
+
+void PrintQuotaUsage(absl::string_view what, const MemStats& before,
+                     const MemStats& after, int count, absl::string_view unit) {
+  for (size_t i = 0; i < kNumMemStatsTags; ++i) {
+    printf("%s %s memory usage: %f bytes per %s\n", std::string(what).c_str(),
+           kMemStatsTags[i],
+           static_cast<double>(after.quota_bytes[i] - before.quota_bytes[i]) /
+               count,
+           std::string(unit).c_str());
+  }
+}
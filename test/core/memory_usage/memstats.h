@@ -15,6 +15,9 @@
 #ifndef GRPC_TEST_CORE_MEMORY_USAGE_MEMSTATS_H
 #define GRPC_TEST_CORE_MEMORY_USAGE_MEMSTATS_H
 
+#include <stddef.h>
+
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 // IWYU pragma: no_include <bits/types/struct_rusage.h>
@@ -23,9 +26,25 @@
 // the pid
 long GetMemUsage(absl::optional<int> pid = absl::nullopt);
 
+// The memory quota tags the usage of the memory quotas is broken down into.
+// The usage of any other tag is counted in the last one.
+constexpr const char* kMemStatsTags[] = {
+    "call_arena", "chttp2_transport", "chttp2_server_connection",
+    "endpoint",   "secure_endpoint",  "other"};
+constexpr size_t kNumMemStatsTags =
+    sizeof(kMemStatsTags) / sizeof(kMemStatsTags[0]);
+
+// Sent as is between processes: keep it trivially copyable.
 struct MemStats {
   long rss;  // Resident set size, in kb
-  static MemStats Snapshot() { return MemStats{GetMemUsage()}; }
+  // Bytes in use in all memory quotas, by tag of kMemStatsTags.
+  long quota_bytes[kNumMemStatsTags];
+  static MemStats Snapshot();
 };
 
+// Prints the memory quota usage between two snapshots, per item and by tag, as
+// "<what> <tag> memory usage: <bytes> bytes per <unit>".
+void PrintQuotaUsage(absl::string_view what, const MemStats& before,
+                     const MemStats& after, int count, absl::string_view unit);
+
 #endif  // GRPC_TEST_CORE_MEMORY_USAGE_MEMSTATS_H
@@ -56,6 +56,43 @@ void BM_WakeupParticipant(benchmark::State& state) {
 }
 BENCHMARK(BM_WakeupParticipant);
 
+// Occupy all the directly tracked participant slots, so that further
+// participants spill over.
+void FillParticipantSlots(Party* party) {
+  for (size_t i = 0; i < party_detail::kMaxParticipants; i++) {
+    party->Spawn(
+        "filler", []() -> Poll<StatusFlag> { return Pending{}; },
+        [](StatusFlag) {});
+  }
+}
+
+void BM_AddSpilledParticipant(benchmark::State& state) {
+  auto party = Party::Make(SimpleArenaAllocator()->MakeArena());
+  FillParticipantSlots(party.get());
+  for (auto _ : state) {
+    party->Spawn(
+        "participant", []() { return Success{}; }, [](StatusFlag) {});
+  }
+}
+BENCHMARK(BM_AddSpilledParticipant);
+
+void BM_WakeupSpilledParticipant(benchmark::State& state) {
+  auto party = Party::Make(SimpleArenaAllocator()->MakeArena());
+  FillParticipantSlots(party.get());
+  party->Spawn(
+      "driver",
+      [&state, w = IntraActivityWaiter()]() mutable -> Poll<StatusFlag> {
+        w.pending();
+        if (state.KeepRunning()) {
+          w.Wake();
+          return Pending{};
+        }
+        return Success{};
+      },
+      [party](StatusFlag) {});
+}
+BENCHMARK(BM_WakeupSpilledParticipant);
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -16,6 +16,8 @@
 
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "absl/types/optional.h"
 #include "gmock/gmock.h"
@@ -28,6 +30,7 @@
 #include "test/core/promise/poll_matcher.h"
 
 using testing::Mock;
+using testing::NiceMock;
 using testing::StrictMock;
 
 namespace grpc_core {
@@ -180,6 +183,68 @@ TEST(MpscTest, ImmediateSendWorks) {
   activity.Deactivate();
 }
 
+TEST(MpscTest, NextBatchTakesEverythingQueued) {
+  StrictMock<MockActivity> activity;
+  MpscReceiver<Payload> receiver(10);
+  MpscSender<Payload> sender = receiver.MakeSender();
+
+  activity.Activate();
+  auto batch = receiver.NextBatch();
+  EXPECT_THAT(batch(), IsPending());
+  EXPECT_CALL(activity, WakeupRequested());
+  EXPECT_EQ(sender.UnbufferedImmediateSend(MakePayload(1)), true);
+  Mock::VerifyAndClearExpectations(&activity);
+  EXPECT_EQ(sender.UnbufferedImmediateSend(MakePayload(2)), true);
+  EXPECT_EQ(sender.UnbufferedImmediateSend(MakePayload(3)), true);
+  auto items = batch();
+  ASSERT_TRUE(items.ready());
+  EXPECT_EQ(items.value().size(), 3u);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(items.value()[i], MakePayload(i + 1));
+  }
+  // Items received one at a time and left over are returned by NextBatch.
+  for (int i = 4; i <= 6; i++) {
+    EXPECT_EQ(sender.UnbufferedImmediateSend(MakePayload(i)), true);
+  }
+  EXPECT_THAT(receiver.Next()(), IsReady(MakePayload(4)));
+  auto rest = receiver.NextBatch()();
+  ASSERT_TRUE(rest.ready());
+  ASSERT_EQ(rest.value().size(), 2u);
+  EXPECT_EQ(rest.value()[0], MakePayload(5));
+  EXPECT_EQ(rest.value()[1], MakePayload(6));
+  activity.Deactivate();
+}
+
+TEST(MpscTest, ConcurrentSendersKeepTheirOrder) {
+  constexpr int kSenders = 4;
+  constexpr int kItemsPerSender = 10000;
+  NiceMock<MockActivity> activity;
+  MpscReceiver<Payload> receiver(16);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kSenders; i++) {
+    threads.emplace_back([sender = receiver.MakeSender(), i]() mutable {
+      for (int j = 0; j < kItemsPerSender; j++) {
+        EXPECT_TRUE(sender.UnbufferedImmediateSend(
+            MakePayload(i * kItemsPerSender + j)));
+      }
+    });
+  }
+  activity.Activate();
+  std::vector<int> next(kSenders, 0);
+  int received = 0;
+  while (received < kSenders * kItemsPerSender) {
+    auto items = receiver.NextBatch()();
+    if (items.pending()) continue;
+    for (const Payload& item : items.value()) {
+      const int sender = *item.x / kItemsPerSender;
+      EXPECT_EQ(*item.x % kItemsPerSender, next[sender]++);
+      ++received;
+    }
+  }
+  activity.Deactivate();
+  for (auto& thread : threads) thread.join();
+}
+
 }  // namespace
 }  // namespace grpc_core
 
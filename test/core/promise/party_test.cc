@@ -39,6 +39,7 @@
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/context.h"
 #include "src/core/lib/promise/inter_activity_latch.h"
+#include "src/core/lib/promise/party_profile.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/promise/sleep.h"
@@ -230,6 +231,33 @@ TYPED_TEST(PartySyncTest, UnrefWhileRunning) {
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+TYPED_TEST(PartySyncTest, SpillsParticipantsBeyondMax) {
+  TypeParam sync(1);
+  std::vector<size_t> slots;
+  auto store = [&slots](size_t* idxs) {
+    for (size_t i = 0; i < 10; i++) slots.push_back(idxs[i]);
+  };
+  EXPECT_TRUE(sync.AddParticipantsAndRef(10, store));
+  EXPECT_FALSE(sync.AddParticipantsAndRef(10, store));
+  ASSERT_EQ(slots.size(), 20u);
+  for (size_t i = 0; i < party_detail::kMaxParticipants; i++) {
+    EXPECT_EQ(slots[i], i);
+  }
+  for (size_t i = party_detail::kMaxParticipants; i < 20; i++) {
+    EXPECT_EQ(slots[i], party_detail::kSpillSlot);
+  }
+  std::vector<int> polled;
+  EXPECT_FALSE(sync.RunParty([&polled](int slot) {
+    polled.push_back(slot);
+    return true;
+  }));
+  ASSERT_EQ(polled.size(), party_detail::kMaxParticipants + 1);
+  EXPECT_EQ(polled.back(), static_cast<int>(party_detail::kSpillSlot));
+  EXPECT_FALSE(sync.Unref());
+  EXPECT_FALSE(sync.Unref());
+  EXPECT_TRUE(sync.Unref());
+}
+
 // PartyTest
 
 class PartyTest : public ::testing::Test {
@@ -346,6 +374,37 @@ TEST_F(PartyTest, CanWakeupWithOwningWaker) {
   complete.WaitForNotification();
 }
 
+TEST_F(PartyTest, ProfiledPartyCountsPolls) {
+  PartyProfile::SetSamplingPeriod(1);
+  auto party = MakeParty();
+  PartyProfile::SetSamplingPeriod(0);
+  Notification n[3];
+  Waker waker;
+  party->Spawn(
+      "ProfiledSpawn",
+      [i = 0, &waker, &n]() mutable -> Poll<int> {
+        waker = GetContext<Activity>()->MakeOwningWaker();
+        n[i].Notify();
+        i++;
+        if (i == 3) return 42;
+        return Pending{};
+      },
+      [](int x) { EXPECT_EQ(x, 42); });
+  for (int i = 0; i < 2; i++) {
+    n[i].WaitForNotification();
+    waker.Wakeup();
+  }
+  n[2].WaitForNotification();
+  // The poll is recorded after the participant completes.
+  PartyProfile::Stats stats;
+  do {
+    stats = PartyProfile::ForName("ProfiledSpawn")->GetStats();
+  } while (stats.completed == 0);
+  EXPECT_EQ(stats.polls, 3);
+  EXPECT_EQ(stats.completed, 1);
+  EXPECT_EQ(stats.spurious_wakeups, 1);
+}
+
 TEST_F(PartyTest, CanWakeupWithNonOwningWaker) {
   auto party = MakeParty();
   Notification n[10];
@@ -451,6 +510,91 @@ TEST_F(PartyTest, CanBulkSpawn) {
   n2.WaitForNotification();
 }
 
+TEST_F(PartyTest, CanWakeupFromSameParty) {
+  auto party = MakeParty();
+  Waker waker;
+  int polls = 0;
+  Notification done;
+  party->Spawn(
+      "waiter",
+      [&polls, &waker]() -> Poll<int> {
+        ++polls;
+        if (polls == 1) {
+          waker = GetContext<Activity>()->MakeOwningWaker();
+          return Pending{};
+        }
+        return 42;
+      },
+      [&done](int x) {
+        EXPECT_EQ(x, 42);
+        done.Notify();
+      });
+  EXPECT_EQ(polls, 1);
+  party->Spawn(
+      "waker",
+      [&waker]() {
+        waker.Wakeup();
+        return Empty{};
+      },
+      [](Empty) {});
+  // The waiter is repolled by the thread that woke it, before Spawn returns.
+  EXPECT_TRUE(done.HasBeenNotified());
+  EXPECT_EQ(polls, 2);
+}
+
+TEST_F(PartyTest, CanRunMoreThanMaxParticipants) {
+  constexpr int kParticipants = 3 * party_detail::kMaxParticipants + 5;
+  auto party = MakeParty();
+  Waker wakers[kParticipants];
+  Notification started[kParticipants];
+  Notification done[kParticipants];
+  for (int i = 0; i < kParticipants; i++) {
+    party->Spawn(
+        "participant",
+        [i, polls = 0, &wakers, &started]() mutable -> Poll<int> {
+          ++polls;
+          if (polls == 1) {
+            // Forced repolls must reach spilled participants too.
+            GetContext<Activity>()->ForceImmediateRepoll();
+            return Pending{};
+          }
+          if (polls == 2) {
+            wakers[i] = i % 2 == 0
+                            ? GetContext<Activity>()->MakeOwningWaker()
+                            : GetContext<Activity>()->MakeNonOwningWaker();
+            started[i].Notify();
+            return Pending{};
+          }
+          return i;
+        },
+        [i, &done](int x) {
+          EXPECT_EQ(x, i);
+          done[i].Notify();
+        });
+  }
+  for (int i = 0; i < kParticipants; i++) started[i].WaitForNotification();
+  // Wake in reverse so spilled participants complete before the others.
+  for (int i = kParticipants - 1; i >= 0; i--) {
+    EXPECT_FALSE(done[i].HasBeenNotified());
+    wakers[i].Wakeup();
+    done[i].WaitForNotification();
+  }
+}
+
+TEST_F(PartyTest, CancelsSpilledParticipants) {
+  constexpr int kParticipants = party_detail::kMaxParticipants + 5;
+  auto party = MakeParty();
+  {
+    Party::BulkSpawner spawner(party.get());
+    for (int i = 0; i < kParticipants; i++) {
+      spawner.Spawn(
+          "pending", []() -> Poll<Empty> { return Pending{}; },
+          [](Empty) { Crash("unreachable"); });
+    }
+  }
+  party.reset();
+}
+
 TEST_F(PartyTest, ThreadStressTest) {
   auto party = MakeParty();
   std::vector<std::thread> threads;
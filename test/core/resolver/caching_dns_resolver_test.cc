@@ -0,0 +1,272 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "src/core/resolver/dns/event_engine/caching_dns_resolver.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/event_engine/mock_event_engine.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::MockEventEngine;
+using ::testing::_;
+
+using Addresses = std::vector<EventEngine::ResolvedAddress>;
+
+// Lookups sent to DNS, completed by the test.
+struct PendingLookups {
+  std::vector<std::string> names;
+  std::vector<EventEngine::DNSResolver::LookupHostnameCallback> callbacks;
+};
+
+class FakeDNSResolver final : public EventEngine::DNSResolver {
+ public:
+  explicit FakeDNSResolver(PendingLookups* pending) : pending_(pending) {}
+
+  void LookupHostname(LookupHostnameCallback on_resolve,
+                      absl::string_view name,
+                      absl::string_view /*default_port*/) override {
+    pending_->names.emplace_back(name);
+    pending_->callbacks.push_back(std::move(on_resolve));
+  }
+  void LookupSRV(LookupSRVCallback on_resolve,
+                 absl::string_view /*name*/) override {
+    on_resolve(absl::UnimplementedError("SRV"));
+  }
+  void LookupTXT(LookupTXTCallback on_resolve,
+                 absl::string_view /*name*/) override {
+    on_resolve(absl::UnimplementedError("TXT"));
+  }
+
+ private:
+  PendingLookups* pending_;
+};
+
+class CachingDNSResolverTest : public ::testing::Test {
+ protected:
+  CachingDNSResolverTest()
+      : engine_(std::make_shared<::testing::NiceMock<MockEventEngine>>()) {
+    CachingDNSResolver::ResetCacheForTesting();
+    time_cache_.TestOnlySetNow(Timestamp::ProcessEpoch() +
+                               Duration::Hours(1));
+    ON_CALL(*engine_, GetDNSResolver(_))
+        .WillByDefault([this](const EventEngine::DNSResolver::ResolverOptions&)
+                           -> absl::StatusOr<
+                               std::unique_ptr<EventEngine::DNSResolver>> {
+          return std::make_unique<FakeDNSResolver>(&pending_);
+        });
+    ON_CALL(*engine_, Run(::testing::An<absl::AnyInvocable<void()>>()))
+        .WillByDefault([this](absl::AnyInvocable<void()> closure) {
+          closures_.push_back(std::move(closure));
+        });
+  }
+
+  ~CachingDNSResolverTest() override {
+    DrainClosures();
+    CachingDNSResolver::ResetCacheForTesting();
+  }
+
+  std::unique_ptr<CachingDNSResolver> MakeResolver(
+      Duration negative_ttl = Duration::Zero()) {
+    return std::make_unique<CachingDNSResolver>(
+        engine_, "", CachingDNSResolver::Options{kTtl, negative_ttl});
+  }
+
+  // Starts a lookup of \a name, with the result stored in \a result.
+  static void Lookup(CachingDNSResolver* resolver, absl::string_view name,
+                     absl::optional<absl::StatusOr<Addresses>>* result) {
+    resolver->LookupHostname(
+        [result](absl::StatusOr<Addresses> addresses) {
+          *result = std::move(addresses);
+        },
+        name, "443");
+  }
+
+  // Completes the oldest lookup sent to DNS.
+  void CompleteLookup(absl::StatusOr<Addresses> result) {
+    ASSERT_FALSE(pending_.callbacks.empty());
+    auto callback = std::move(pending_.callbacks.front());
+    pending_.callbacks.erase(pending_.callbacks.begin());
+    callback(std::move(result));
+  }
+
+  void DrainClosures() {
+    while (!closures_.empty()) {
+      auto closure = std::move(closures_.front());
+      closures_.erase(closures_.begin());
+      closure();
+    }
+  }
+
+  void AdvanceTime(Duration duration) {
+    time_cache_.TestOnlySetNow(Timestamp::Now() + duration);
+  }
+
+  static Addresses OneAddress() { return Addresses(1); }
+
+  static constexpr Duration kTtl = Duration::Seconds(10);
+
+  ScopedTimeCache time_cache_;
+  std::shared_ptr<::testing::NiceMock<MockEventEngine>> engine_;
+  PendingLookups pending_;
+  std::vector<absl::AnyInvocable<void()>> closures_;
+};
+
+constexpr Duration CachingDNSResolverTest::kTtl;
+
+TEST_F(CachingDNSResolverTest, ConcurrentLookupsAreSentOnce) {
+  auto resolver1 = MakeResolver();
+  auto resolver2 = MakeResolver();
+  absl::optional<absl::StatusOr<Addresses>> result1;
+  absl::optional<absl::StatusOr<Addresses>> result2;
+  Lookup(resolver1.get(), "foo.test", &result1);
+  Lookup(resolver2.get(), "foo.test", &result2);
+  EXPECT_THAT(pending_.names, ::testing::ElementsAre("foo.test"));
+  CompleteLookup(OneAddress());
+  ASSERT_TRUE(result1.has_value());
+  ASSERT_TRUE(result2.has_value());
+  EXPECT_EQ(result1->value().size(), 1);
+  EXPECT_EQ(result2->value().size(), 1);
+}
+
+TEST_F(CachingDNSResolverTest, ResultIsReusedUntilExpired) {
+  auto resolver = MakeResolver();
+  absl::optional<absl::StatusOr<Addresses>> result;
+  Lookup(resolver.get(), "foo.test", &result);
+  CompleteLookup(OneAddress());
+  DrainClosures();
+  // A cache hit is delivered asynchronously.
+  result.reset();
+  AdvanceTime(Duration::Seconds(5));
+  Lookup(resolver.get(), "foo.test", &result);
+  EXPECT_FALSE(result.has_value());
+  DrainClosures();
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result->ok());
+  EXPECT_EQ(pending_.names.size(), 1);
+  // Once expired, the lookup goes to DNS again.
+  result.reset();
+  AdvanceTime(Duration::Seconds(6));
+  Lookup(resolver.get(), "foo.test", &result);
+  DrainClosures();
+  EXPECT_FALSE(result.has_value());
+  EXPECT_EQ(pending_.names.size(), 2);
+  CompleteLookup(OneAddress());
+  EXPECT_TRUE(result.has_value());
+}
+
+TEST_F(CachingDNSResolverTest, ResultIsRefreshedBeforeExpiration) {
+  auto resolver = MakeResolver();
+  absl::optional<absl::StatusOr<Addresses>> result;
+  Lookup(resolver.get(), "foo.test", &result);
+  CompleteLookup(OneAddress());
+  AdvanceTime(Duration::Seconds(9));
+  // The cached result is returned, and a refresh is started.
+  result.reset();
+  Lookup(resolver.get(), "foo.test", &result);
+  DrainClosures();
+  EXPECT_TRUE(result.has_value());
+  EXPECT_EQ(pending_.names.size(), 2);
+  CompleteLookup(Addresses(2));
+  DrainClosures();
+  AdvanceTime(Duration::Seconds(2));
+  result.reset();
+  Lookup(resolver.get(), "foo.test", &result);
+  DrainClosures();
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->value().size(), 2);
+  EXPECT_EQ(pending_.names.size(), 2);
+}
+
+TEST_F(CachingDNSResolverTest, FailuresAreNotCachedByDefault) {
+  auto resolver = MakeResolver();
+  absl::optional<absl::StatusOr<Addresses>> result;
+  Lookup(resolver.get(), "foo.test", &result);
+  CompleteLookup(absl::NotFoundError("no such host"));
+  DrainClosures();
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->status().code(), absl::StatusCode::kNotFound);
+  result.reset();
+  Lookup(resolver.get(), "foo.test", &result);
+  EXPECT_EQ(pending_.names.size(), 2);
+  CompleteLookup(OneAddress());
+  EXPECT_TRUE(result.has_value());
+}
+
+TEST_F(CachingDNSResolverTest, FailuresAreCachedForNegativeTtl) {
+  auto resolver = MakeResolver(/*negative_ttl=*/Duration::Seconds(2));
+  absl::optional<absl::StatusOr<Addresses>> result;
+  Lookup(resolver.get(), "foo.test", &result);
+  CompleteLookup(absl::NotFoundError("no such host"));
+  DrainClosures();
+  result.reset();
+  AdvanceTime(Duration::Seconds(1));
+  Lookup(resolver.get(), "foo.test", &result);
+  DrainClosures();
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result->status().code(), absl::StatusCode::kNotFound);
+  EXPECT_EQ(pending_.names.size(), 1);
+  result.reset();
+  AdvanceTime(Duration::Seconds(2));
+  Lookup(resolver.get(), "foo.test", &result);
+  DrainClosures();
+  EXPECT_EQ(pending_.names.size(), 2);
+  CompleteLookup(OneAddress());
+  EXPECT_TRUE(result.has_value());
+}
+
+TEST_F(CachingDNSResolverTest, DestroyingResolverCancelsItsLookups) {
+  auto resolver1 = MakeResolver();
+  auto resolver2 = MakeResolver();
+  absl::optional<absl::StatusOr<Addresses>> result1;
+  absl::optional<absl::StatusOr<Addresses>> result2;
+  Lookup(resolver1.get(), "foo.test", &result1);
+  Lookup(resolver2.get(), "foo.test", &result2);
+  resolver1.reset();
+  DrainClosures();
+  ASSERT_TRUE(result1.has_value());
+  EXPECT_EQ(result1->status().code(), absl::StatusCode::kCancelled);
+  EXPECT_FALSE(result2.has_value());
+  CompleteLookup(OneAddress());
+  ASSERT_TRUE(result2.has_value());
+  EXPECT_TRUE(result2->ok());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
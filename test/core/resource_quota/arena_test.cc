@@ -128,6 +128,21 @@ TEST(ArenaTest, SubsequentReservationCorrect) {
   EXPECT_CALL(*allocator_impl, Shutdown());
 }
 
+#ifndef GRPC_ASAN_ENABLED
+TEST(ArenaTest, InitialBlockRecycled) {
+  auto allocator = SimpleArenaAllocator(4096);
+  auto arena = allocator->MakeArena();
+  const Arena* first = arena.get();
+  arena.reset();
+  // A new arena of the same size reuses the block of the destroyed one...
+  arena = allocator->MakeArena();
+  EXPECT_EQ(arena.get(), first);
+  // ... but one of a different size does not.
+  auto other = SimpleArenaAllocator(8192)->MakeArena();
+  EXPECT_NE(other.get(), first);
+}
+#endif
+
 #define CONCURRENT_TEST_THREADS 10
 
 size_t concurrent_test_iterations() {
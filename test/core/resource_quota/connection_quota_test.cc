@@ -0,0 +1,89 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/connection_quota.h"
+
+#include "gtest/gtest.h"
+
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+
+MemoryQuotaRefPtr TestMemoryQuota() {
+  return ResourceQuota::Default()->memory_quota();
+}
+
+TEST(ConnectionQuotaTest, UnlimitedByDefault) {
+  auto q = MakeRefCounted<ConnectionQuota>();
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(
+        q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:127.0.0.1:1234"));
+  }
+  q->ReleaseConnections(100, "ipv4:127.0.0.1:1234");
+}
+
+TEST(ConnectionQuotaTest, MaxIncomingConnections) {
+  auto q = MakeRefCounted<ConnectionQuota>();
+  q->SetMaxIncomingConnections(2);
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:1.2.3.4:1"));
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:5.6.7.8:1"));
+  EXPECT_FALSE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:9.9.9.9:1"));
+  q->ReleaseConnections(1, "ipv4:1.2.3.4:1");
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:9.9.9.9:1"));
+  q->ReleaseConnections(1, "ipv4:5.6.7.8:1");
+  q->ReleaseConnections(1, "ipv4:9.9.9.9:1");
+}
+
+TEST(ConnectionQuotaTest, MaxIncomingConnectionsPerPeer) {
+  auto q = MakeRefCounted<ConnectionQuota>();
+  q->SetMaxIncomingConnectionsPerPeer(2);
+  // The port does not matter.
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:1.2.3.4:1"));
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:1.2.3.4:2"));
+  EXPECT_FALSE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:1.2.3.4:3"));
+  // Other peers are unaffected.
+  EXPECT_TRUE(
+      q->AllowIncomingConnection(TestMemoryQuota(), "ipv6:%5B::1%5D:1"));
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "unix:/tmp/s"));
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "unix:/tmp/s"));
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "unix:/tmp/s"));
+  q->ReleaseConnections(1, "ipv4:1.2.3.4:2");
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:1.2.3.4:3"));
+  q->ReleaseConnections(2, "ipv4:1.2.3.4:1");
+  q->ReleaseConnections(1, "ipv6:%5B::1%5D:1");
+  q->ReleaseConnections(3, "unix:/tmp/s");
+}
+
+TEST(ConnectionQuotaTest, PerPeerRejectionDoesNotUseOverallQuota) {
+  auto q = MakeRefCounted<ConnectionQuota>();
+  q->SetMaxIncomingConnections(2);
+  q->SetMaxIncomingConnectionsPerPeer(1);
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:1.2.3.4:1"));
+  EXPECT_FALSE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:1.2.3.4:2"));
+  EXPECT_FALSE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:1.2.3.4:3"));
+  EXPECT_TRUE(q->AllowIncomingConnection(TestMemoryQuota(), "ipv4:5.6.7.8:1"));
+  q->ReleaseConnections(1, "ipv4:1.2.3.4:1");
+  q->ReleaseConnections(1, "ipv4:5.6.7.8:1");
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment give_me_a_name(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/handshake_quota.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+
+using Admission = HandshakeQuota::Admission;
+
+MemoryQuota* TestMemoryQuota() {
+  return ResourceQuota::Default()->memory_quota().get();
+}
+
+// Admits a handshake with \a peer, recording its name in \a admitted once it
+// is admitted from the queue.
+Admission Admit(HandshakeQuota* q, absl::string_view peer,
+                std::vector<std::string>* admitted, uint64_t* ticket) {
+  return q->Admit(
+      peer, TestMemoryQuota(),
+      [admitted, peer = std::string(peer)]() { admitted->push_back(peer); },
+      ticket);
+}
+
+TEST(HandshakeQuotaTest, UnlimitedByDefault) {
+  auto q = MakeRefCounted<HandshakeQuota>();
+  std::vector<std::string> admitted;
+  uint64_t ticket;
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(Admit(q.get(), "ipv4:127.0.0.1:1234", &admitted, &ticket),
+              Admission::kAdmitted);
+  }
+  for (int i = 0; i < 100; ++i) q->Release("ipv4:127.0.0.1:1234", true);
+  EXPECT_TRUE(admitted.empty());
+}
+
+TEST(HandshakeQuotaTest, QueuesHandshakesOverTheLimit) {
+  auto q = MakeRefCounted<HandshakeQuota>();
+  q->SetMaxConcurrentHandshakes(1);
+  std::vector<std::string> admitted;
+  uint64_t ticket;
+  EXPECT_EQ(Admit(q.get(), "ipv4:1.2.3.4:1", &admitted, &ticket),
+            Admission::kAdmitted);
+  EXPECT_EQ(Admit(q.get(), "ipv4:5.6.7.8:1", &admitted, &ticket),
+            Admission::kQueued);
+  EXPECT_EQ(Admit(q.get(), "ipv4:9.9.9.9:1", &admitted, &ticket),
+            Admission::kQueued);
+  EXPECT_EQ(q->NumQueuedHandshakes(), 2);
+  // Queued handshakes start in order, as running ones complete.
+  q->Release("ipv4:1.2.3.4:1", false);
+  EXPECT_EQ(admitted, std::vector<std::string>({"ipv4:5.6.7.8:1"}));
+  q->Release("ipv4:5.6.7.8:1", false);
+  EXPECT_EQ(admitted,
+            std::vector<std::string>({"ipv4:5.6.7.8:1", "ipv4:9.9.9.9:1"}));
+  q->Release("ipv4:9.9.9.9:1", false);
+  EXPECT_EQ(q->NumQueuedHandshakes(), 0);
+  EXPECT_EQ(Admit(q.get(), "ipv4:1.2.3.4:1", &admitted, &ticket),
+            Admission::kAdmitted);
+  q->Release("ipv4:1.2.3.4:1", false);
+}
+
+TEST(HandshakeQuotaTest, ReturningPeersGoFirst) {
+  auto q = MakeRefCounted<HandshakeQuota>();
+  q->SetMaxConcurrentHandshakes(1);
+  std::vector<std::string> admitted;
+  uint64_t ticket;
+  EXPECT_EQ(Admit(q.get(), "ipv4:1.2.3.4:1", &admitted, &ticket),
+            Admission::kAdmitted);
+  q->Release("ipv4:1.2.3.4:1", true);
+  EXPECT_EQ(Admit(q.get(), "ipv4:5.6.7.8:1", &admitted, &ticket),
+            Admission::kAdmitted);
+  EXPECT_EQ(Admit(q.get(), "ipv4:9.9.9.9:1", &admitted, &ticket),
+            Admission::kQueued);
+  // The port does not matter.
+  EXPECT_EQ(Admit(q.get(), "ipv4:1.2.3.4:2", &admitted, &ticket),
+            Admission::kQueued);
+  q->Release("ipv4:5.6.7.8:1", false);
+  q->Release("ipv4:1.2.3.4:2", false);
+  q->Release("ipv4:9.9.9.9:1", false);
+  EXPECT_EQ(admitted,
+            std::vector<std::string>({"ipv4:1.2.3.4:2", "ipv4:9.9.9.9:1"}));
+}
+
+TEST(HandshakeQuotaTest, CancelledHandshakesLeaveTheQueue) {
+  auto q = MakeRefCounted<HandshakeQuota>();
+  q->SetMaxConcurrentHandshakes(1);
+  std::vector<std::string> admitted;
+  uint64_t first_ticket;
+  uint64_t second_ticket;
+  uint64_t ticket;
+  EXPECT_EQ(Admit(q.get(), "ipv4:1.2.3.4:1", &admitted, &ticket),
+            Admission::kAdmitted);
+  EXPECT_EQ(Admit(q.get(), "ipv4:5.6.7.8:1", &admitted, &first_ticket),
+            Admission::kQueued);
+  EXPECT_EQ(Admit(q.get(), "ipv4:9.9.9.9:1", &admitted, &second_ticket),
+            Admission::kQueued);
+  EXPECT_TRUE(q->Cancel(first_ticket));
+  EXPECT_FALSE(q->Cancel(first_ticket));
+  q->Release("ipv4:1.2.3.4:1", false);
+  EXPECT_EQ(admitted, std::vector<std::string>({"ipv4:9.9.9.9:1"}));
+  // Already admitted.
+  EXPECT_FALSE(q->Cancel(second_ticket));
+  q->Release("ipv4:9.9.9.9:1", false);
+}
+
+TEST(HandshakeQuotaTest, RejectsHandshakesOverTheQueueLimit) {
+  auto q = MakeRefCounted<HandshakeQuota>();
+  q->SetMaxConcurrentHandshakes(1);
+  q->SetMaxQueuedHandshakes(1);
+  std::vector<std::string> admitted;
+  uint64_t ticket;
+  EXPECT_EQ(Admit(q.get(), "ipv4:1.2.3.4:1", &admitted, &ticket),
+            Admission::kAdmitted);
+  EXPECT_EQ(Admit(q.get(), "ipv4:5.6.7.8:1", &admitted, &ticket),
+            Admission::kQueued);
+  EXPECT_EQ(Admit(q.get(), "ipv4:9.9.9.9:1", &admitted, &ticket),
+            Admission::kRejected);
+  q->Release("ipv4:1.2.3.4:1", false);
+  q->Release("ipv4:5.6.7.8:1", false);
+}
+
+TEST(HandshakeQuotaTest, RaisingTheLimitAdmitsQueuedHandshakes) {
+  auto q = MakeRefCounted<HandshakeQuota>();
+  q->SetMaxConcurrentHandshakes(1);
+  std::vector<std::string> admitted;
+  uint64_t ticket;
+  EXPECT_EQ(Admit(q.get(), "ipv4:1.2.3.4:1", &admitted, &ticket),
+            Admission::kAdmitted);
+  EXPECT_EQ(Admit(q.get(), "ipv4:5.6.7.8:1", &admitted, &ticket),
+            Admission::kQueued);
+  q->SetMaxConcurrentHandshakes(2);
+  EXPECT_EQ(admitted, std::vector<std::string>({"ipv4:5.6.7.8:1"}));
+  q->Release("ipv4:1.2.3.4:1", false);
+  q->Release("ipv4:5.6.7.8:1", false);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
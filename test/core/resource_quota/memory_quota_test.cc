@@ -27,6 +27,8 @@
 #include <grpc/slice.h>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "test/core/resource_quota/call_checker.h"
 #include "test/core/test_util/test_config.h"
 
@@ -187,6 +189,71 @@ TEST(MemoryQuotaTest, AllMemoryQuotas) {
   EXPECT_EQ(gather(), std::set<std::string>({"m2"}));
 }
 
+TEST(MemoryQuotaTest, MemoryUsageByTag) {
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota("foo");
+  auto a = memory_quota.CreateMemoryOwner("a");
+  auto b = memory_quota.CreateMemoryOwner("b");
+  auto untagged = memory_quota.CreateMemoryAllocator("bar");
+  a.Reserve(4096);
+  b.Reserve(1024);
+  auto usage = memory_quota.MemoryUsageByTag();
+  EXPECT_EQ(usage.size(), 3u);
+  EXPECT_GE(usage["a"], 4096);
+  EXPECT_EQ(usage["a"] - usage["b"], 3072);
+  EXPECT_EQ(usage["untagged"], usage["b"] - 1024);
+  a.Release(4096);
+  b.Release(1024);
+  usage = memory_quota.MemoryUsageByTag();
+  EXPECT_EQ(usage["a"], usage["untagged"]);
+  EXPECT_EQ(usage["b"], usage["untagged"]);
+}
+
+//
+// ReadBufferSizeForMemoryPressureTest
+//
+
+uint64_t ReadBuffersShrunk() {
+  return global_stats().Collect()->tcp_read_buffer_shrunk_for_memory_pressure;
+}
+
+TEST(ReadBufferSizeForMemoryPressureTest, FullTargetUpToShrinkPressure) {
+  const uint64_t shrunk = ReadBuffersShrunk();
+  EXPECT_EQ(ReadBufferSizeForMemoryPressure(1000, 11000, 0.0), 11000u);
+  EXPECT_EQ(ReadBufferSizeForMemoryPressure(1000, 11000, 0.3), 11000u);
+  EXPECT_EQ(ReadBufferSizeForMemoryPressure(
+                1000, 11000, kReadBufferShrinkMemoryPressure),
+            11000u);
+  EXPECT_EQ(ReadBuffersShrunk(), shrunk);
+}
+
+TEST(ReadBufferSizeForMemoryPressureTest, ExtraShrinksLinearly) {
+  const uint64_t shrunk = ReadBuffersShrunk();
+  // A quarter, half and three quarters of the way to high pressure.
+  EXPECT_NEAR(ReadBufferSizeForMemoryPressure(1000, 11000, 0.575), 8500, 1);
+  EXPECT_NEAR(ReadBufferSizeForMemoryPressure(1000, 11000, 0.65), 6000, 1);
+  EXPECT_NEAR(ReadBufferSizeForMemoryPressure(1000, 11000, 0.725), 3500, 1);
+  EXPECT_EQ(ReadBuffersShrunk(), shrunk + 3u);
+}
+
+TEST(ReadBufferSizeForMemoryPressureTest, NoExtraFromHighPressure) {
+  const uint64_t shrunk = ReadBuffersShrunk();
+  EXPECT_EQ(ReadBufferSizeForMemoryPressure(1000, 11000,
+                                            kReadBufferHighMemoryPressure),
+            1000u);
+  EXPECT_EQ(ReadBufferSizeForMemoryPressure(1000, 11000, 1.0), 1000u);
+  EXPECT_EQ(ReadBuffersShrunk(), shrunk + 2u);
+}
+
+TEST(ReadBufferSizeForMemoryPressureTest, NeverBelowMinProgressSize) {
+  const uint64_t shrunk = ReadBuffersShrunk();
+  EXPECT_EQ(ReadBufferSizeForMemoryPressure(5000, 1000, 0.0), 5000u);
+  EXPECT_EQ(ReadBufferSizeForMemoryPressure(5000, 1000, 1.0), 5000u);
+  EXPECT_EQ(ReadBufferSizeForMemoryPressure(5000, 5000, 1.0), 5000u);
+  // There was nothing to shrink.
+  EXPECT_EQ(ReadBuffersShrunk(), shrunk);
+}
+
 }  // namespace testing
 
 namespace memory_quota_detail {
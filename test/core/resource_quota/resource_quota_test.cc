@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc_core {
@@ -27,6 +28,57 @@ TEST(ResourceQuotaTest, Works) {
   EXPECT_NE(q->memory_quota(), nullptr);
 }
 
+TEST(ResourceQuotaTest, ChildrenShareThreadsByWeight) {
+  auto parent = MakeRefCounted<ResourceQuota>("parent");
+  ResourceQuota::ChildOptions a_options;
+  a_options.min_threads = 2;
+  auto a = parent->CreateChild("a", a_options);
+  auto b = parent->CreateChild("b", ResourceQuota::ChildOptions());
+  EXPECT_EQ(parent->FindChild("a"), a);
+  EXPECT_EQ(parent->FindChild("c"), nullptr);
+  // Unbounded until the parent is.
+  EXPECT_TRUE(b->thread_quota()->Reserve(100));
+  b->thread_quota()->Release(100);
+  parent->SetMaxThreads(10);
+  // a gets its 2 threads and half of the other 8, b the other half.
+  EXPECT_TRUE(b->thread_quota()->Reserve(4));
+  EXPECT_FALSE(b->thread_quota()->Reserve(1));
+  EXPECT_TRUE(a->thread_quota()->Reserve(6));
+  EXPECT_FALSE(a->thread_quota()->Reserve(1));
+  // Children's threads count against the parent.
+  EXPECT_FALSE(parent->thread_quota()->Reserve(1));
+  b->thread_quota()->Release(4);
+  EXPECT_TRUE(parent->thread_quota()->Reserve(1));
+  parent->thread_quota()->Release(1);
+  parent->RemoveChild("b");
+  EXPECT_TRUE(a->thread_quota()->Reserve(4));
+  a->thread_quota()->Release(10);
+}
+
+TEST(ResourceQuotaTest, ChildrenShareMemoryByWeight) {
+  ExecCtx exec_ctx;
+  constexpr size_t kMiB = 1024 * 1024;
+  auto parent = MakeRefCounted<ResourceQuota>("parent");
+  parent->SetMemorySize(4 * kMiB);
+  ResourceQuota::ChildOptions a_options;
+  a_options.min_memory = kMiB;
+  a_options.weight = 2;
+  auto a = parent->CreateChild("a", a_options);
+  auto b = parent->CreateChild("b", ResourceQuota::ChildOptions());
+  // a gets 1MiB and two thirds of the other 3MiB, b a third.
+  auto allocator = b->memory_quota()->CreateMemoryAllocator("b");
+  allocator.Reserve(kMiB / 2);
+  const double b_pressure =
+      b->memory_quota()->GetPressureInfo().instantaneous_pressure;
+  const double parent_pressure =
+      parent->memory_quota()->GetPressureInfo().instantaneous_pressure;
+  EXPECT_GE(b_pressure, 0.5);
+  // The same bytes are charged to the parent, and not to a.
+  EXPECT_NEAR(b_pressure * kMiB, parent_pressure * 4 * kMiB, 1);
+  EXPECT_EQ(a->memory_quota()->GetPressureInfo().instantaneous_pressure, 0);
+  allocator.Release(kMiB / 2);
+}
+
 }  // namespace testing
 }  // namespace grpc_core
 
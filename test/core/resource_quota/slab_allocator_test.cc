@@ -0,0 +1,140 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/slab_allocator.h"
+
+#include <string.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/slice.h>
+
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+
+// Starts each test with empty caches, and counts what happens from there.
+class SlabAllocatorTest : public ::testing::Test {
+ protected:
+  SlabAllocatorTest() { SlabAllocator::TestOnlyReleaseCachedBlocks(); }
+  ~SlabAllocatorTest() override {
+    SlabAllocator::TestOnlyReleaseCachedBlocks();
+  }
+
+  std::unique_ptr<GlobalStats> StatsSinceStart() const {
+    return global_stats().Collect()->Diff(*start_);
+  }
+
+ private:
+  std::unique_ptr<GlobalStats> start_ = global_stats().Collect();
+};
+
+TEST_F(SlabAllocatorTest, SizeClassesFitTransportReads) {
+  for (size_t read_size : {8192, 12288, 65536}) {
+    const size_t size = read_size + SlabAllocator::kHeaderBytes;
+    const int size_class = SlabAllocator::SizeClassFor(size);
+    ASSERT_GE(size_class, 0);
+    EXPECT_EQ(SlabAllocator::SizeOf(size_class), size);
+  }
+  EXPECT_EQ(SlabAllocator::SizeClassFor(0), 0);
+  EXPECT_EQ(SlabAllocator::SizeClassFor(
+                SlabAllocator::SizeOf(SlabAllocator::kNumSizeClasses - 1) + 1),
+            -1);
+  for (int size_class = 1; size_class < SlabAllocator::kNumSizeClasses;
+       ++size_class) {
+    EXPECT_LT(SlabAllocator::SizeOf(size_class - 1),
+              SlabAllocator::SizeOf(size_class));
+  }
+}
+
+TEST_F(SlabAllocatorTest, ReusesFreedBlocks) {
+  void* block = SlabAllocator::Allocate(3);
+  SlabAllocator::Free(3, block);
+  EXPECT_EQ(SlabAllocator::Allocate(3), block);
+  SlabAllocator::Free(3, block);
+  auto stats = StatsSinceStart();
+  EXPECT_EQ(stats->slab_allocator_cache_misses, 1);
+  EXPECT_EQ(stats->slab_allocator_cache_hits, 1);
+}
+
+TEST_F(SlabAllocatorTest, ReusesBlocksFreedByExitedThreads) {
+  constexpr int kBlocks = 16;
+  std::vector<void*> blocks;
+  for (int i = 0; i < kBlocks; ++i) {
+    blocks.push_back(SlabAllocator::Allocate(0));
+  }
+  std::thread([&blocks]() {
+    for (void* block : blocks) SlabAllocator::Free(0, block);
+  }).join();
+  for (int i = 0; i < kBlocks; ++i) {
+    blocks[i] = SlabAllocator::Allocate(0);
+  }
+  for (void* block : blocks) SlabAllocator::Free(0, block);
+  auto stats = StatsSinceStart();
+  EXPECT_EQ(stats->slab_allocator_cache_misses, kBlocks);
+  EXPECT_EQ(stats->slab_allocator_cache_hits, kBlocks);
+}
+
+TEST_F(SlabAllocatorTest, CachesAreBounded) {
+  constexpr int kBlocks = 100;
+  const int size_class = SlabAllocator::kNumSizeClasses - 1;
+  std::vector<void*> blocks;
+  for (int i = 0; i < kBlocks; ++i) {
+    blocks.push_back(SlabAllocator::Allocate(size_class));
+  }
+  for (void* block : blocks) SlabAllocator::Free(size_class, block);
+  // 100 blocks of 64k are more than the caches hold for a single size class.
+  EXPECT_GT(StatsSinceStart()->slab_allocator_blocks_released, 0);
+}
+
+TEST_F(SlabAllocatorTest, MemoryAllocatorSlices) {
+  ExecCtx exec_ctx;
+  MemoryQuota memory_quota("foo");
+  auto memory_allocator = memory_quota.CreateMemoryAllocator("bar");
+  for (int i = 0; i < 2; ++i) {
+    std::vector<grpc_slice> slices;
+    for (size_t size : {1, 100, 8192, 10000, 65536, 100000}) {
+      slices.push_back(memory_allocator.MakeSlice(MemoryRequest(size)));
+      EXPECT_EQ(GRPC_SLICE_LENGTH(slices.back()), size);
+      memset(GRPC_SLICE_START_PTR(slices.back()), 0, size);
+    }
+    for (grpc_slice slice : slices) grpc_slice_unref(slice);
+  }
+  auto stats = StatsSinceStart();
+  // The 100000 byte slices are too large for the slab allocator.
+  EXPECT_EQ(stats->slab_allocator_cache_misses, 5);
+  EXPECT_EQ(stats->slab_allocator_cache_hits, 5);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment give_me_a_name(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.slice_slab_allocator = true;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  return RUN_ALL_TESTS();
+}
@@ -23,6 +23,7 @@
 #include <grpc/grpc_security_constants.h>
 #include <grpc/support/port_platform.h>
 
+#include "src/core/lib/matchers/matchers.h"
 #include "src/core/lib/security/authorization/audit_logging.h"
 #include "src/core/util/json/json.h"
 #include "test/core/test_util/audit_logging_utils.h"
@@ -40,6 +41,13 @@ using experimental::AuditLoggerRegistry;
 using experimental::RegisterAuditLoggerFactory;
 using testing::TestAuditLoggerFactory;
 
+Rbac::Permission MakeExactPathPermission(absl::string_view path) {
+  return Rbac::Permission::MakePathPermission(
+      StringMatcher::Create(StringMatcher::Type::kExact, path,
+                            /*case_sensitive=*/true)
+          .value());
+}
+
 class GrpcAuthorizationEngineTest : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -140,6 +148,60 @@ TEST_F(GrpcAuthorizationEngineTest, DenyEngineWithEmptyPolicies) {
   EXPECT_TRUE(decision.matching_policy_name.empty());
 }
 
+TEST_F(GrpcAuthorizationEngineTest, ExactPathPoliciesKeepPolicyOrder) {
+  std::vector<std::unique_ptr<Rbac::Permission>> paths;
+  paths.push_back(
+      std::make_unique<Rbac::Permission>(MakeExactPathPermission("/other")));
+  paths.push_back(
+      std::make_unique<Rbac::Permission>(MakeExactPathPermission(kRpcMethod)));
+  std::map<std::string, Rbac::Policy> policies;
+  policies["policy1"] = Rbac::Policy(
+      Rbac::Permission::MakeAnyPermission(),
+      Rbac::Principal::MakeNotPrincipal(Rbac::Principal::MakeAnyPrincipal()));
+  policies["policy2"] = Rbac::Policy(MakeExactPathPermission("/other"),
+                                     Rbac::Principal::MakeAnyPrincipal());
+  policies["policy3"] =
+      Rbac::Policy(Rbac::Permission::MakeOrPermission(std::move(paths)),
+                   Rbac::Principal::MakeAnyPrincipal());
+  policies["policy4"] = Rbac::Policy(Rbac::Permission::MakeAnyPermission(),
+                                     Rbac::Principal::MakeAnyPrincipal());
+  GrpcAuthorizationEngine engine(
+      Rbac("authz", Rbac::Action::kAllow, std::move(policies)));
+  AuthorizationEngine::Decision decision =
+      engine.Evaluate(evaluate_args_util_.MakeEvaluateArgs());
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "policy3");
+  // Calls without a path only match the policies that can match any path.
+  decision = engine.Evaluate(EvaluateArgs(nullptr, nullptr));
+  EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+  EXPECT_EQ(decision.matching_policy_name, "policy4");
+}
+
+TEST_F(GrpcAuthorizationEngineTest, PrincipalMatchesAreCachedPerEngine) {
+  std::map<std::string, Rbac::Policy> allow_policies;
+  allow_policies["policy"] = Rbac::Policy(Rbac::Permission::MakeAnyPermission(),
+                                          Rbac::Principal::MakeAnyPrincipal());
+  GrpcAuthorizationEngine allow_engine(
+      Rbac("allow", Rbac::Action::kAllow, std::move(allow_policies)));
+  std::map<std::string, Rbac::Policy> deny_policies;
+  deny_policies["policy"] = Rbac::Policy(
+      Rbac::Permission::MakeAnyPermission(),
+      Rbac::Principal::MakeNotPrincipal(Rbac::Principal::MakeAnyPrincipal()));
+  GrpcAuthorizationEngine deny_engine(
+      Rbac("deny", Rbac::Action::kDeny, std::move(deny_policies)));
+  // Both engines share the per-channel args of the call, each must get its
+  // own principal matches.
+  EvaluateArgs args = evaluate_args_util_.MakeEvaluateArgs();
+  for (int i = 0; i < 2; ++i) {
+    AuthorizationEngine::Decision decision = allow_engine.Evaluate(args);
+    EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+    EXPECT_EQ(decision.matching_policy_name, "policy");
+    decision = deny_engine.Evaluate(args);
+    EXPECT_EQ(decision.type, AuthorizationEngine::Decision::Type::kAllow);
+    EXPECT_TRUE(decision.matching_policy_name.empty());
+  }
+}
+
 TEST_F(GrpcAuthorizationEngineTest, AuditLoggerNoneNotInvokedOnAllowedRequest) {
   Rbac::Policy policy1(Rbac::Permission::MakeAnyPermission(),
                        Rbac::Principal::MakeAnyPrincipal());
@@ -0,0 +1,240 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/server/admission_control.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "test/core/event_engine/mock_event_engine.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using grpc_event_engine::experimental::MockEventEngine;
+
+class TestTimeSource final : public Timestamp::ScopedSource {
+ public:
+  Timestamp Now() override { return now_; }
+  void Advance(Duration duration) { now_ += duration; }
+
+ private:
+  Timestamp now_ = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+};
+
+class AdmissionControlTest : public ::testing::Test {
+ protected:
+  AdmissionControlTest() : engine_(std::make_shared<MockEventEngine>()) {
+    EXPECT_CALL(*engine_, Run(::testing::An<absl::AnyInvocable<void()>>()))
+        .WillRepeatedly([this](absl::AnyInvocable<void()> closure) {
+          probes_.push_back(std::move(closure));
+        });
+  }
+
+  RefCountedPtr<ServerAdmissionController> MakeController(
+      ServerAdmissionController::Options options = {}) {
+    return MakeRefCounted<ServerAdmissionController>(std::move(options),
+                                                     engine_, nullptr);
+  }
+
+  void RunProbes() {
+    auto probes = std::move(probes_);
+    for (auto& probe : probes) probe();
+  }
+
+  static ClientMetadataHandle Metadata(absl::string_view path,
+                                       absl::string_view priority = "") {
+    auto md = Arena::MakePooled<ClientMetadata>();
+    md->Set(HttpPathMetadata(), Slice::FromCopiedString(path));
+    if (!priority.empty()) {
+      md->Append(kAdmissionPriorityMetadataKey,
+                 Slice::FromCopiedString(priority),
+                 [](absl::string_view, const Slice&) { abort(); });
+    }
+    return md;
+  }
+
+  TestTimeSource time_source_;
+  std::shared_ptr<MockEventEngine> engine_;
+  std::vector<absl::AnyInvocable<void()>> probes_;
+};
+
+TEST(AdmissionPriorityTest, Parse) {
+  EXPECT_EQ(ParseAdmissionPriority("sheddable"), AdmissionPriority::kSheddable);
+  EXPECT_EQ(ParseAdmissionPriority("default"), AdmissionPriority::kDefault);
+  EXPECT_EQ(ParseAdmissionPriority("critical"), AdmissionPriority::kCritical);
+  EXPECT_EQ(ParseAdmissionPriority("urgent"), absl::nullopt);
+}
+
+TEST(AdmissionRejectTest, RejectsByPriority) {
+  absl::BitGen bitgen;
+  for (auto priority :
+       {AdmissionPriority::kSheddable, AdmissionPriority::kDefault,
+        AdmissionPriority::kCritical}) {
+    EXPECT_FALSE(ServerAdmissionController::Reject(priority, 0, bitgen));
+    EXPECT_TRUE(ServerAdmissionController::Reject(priority, 1, bitgen));
+  }
+  EXPECT_TRUE(ServerAdmissionController::Reject(AdmissionPriority::kSheddable,
+                                                0.5, bitgen));
+  EXPECT_FALSE(ServerAdmissionController::Reject(AdmissionPriority::kCritical,
+                                                 0.99, bitgen));
+  int rejected = 0;
+  for (int i = 0; i < 1000; i++) {
+    if (ServerAdmissionController::Reject(AdmissionPriority::kDefault, 0.5,
+                                          bitgen)) {
+      ++rejected;
+    }
+  }
+  EXPECT_GT(rejected, 350);
+  EXPECT_LT(rejected, 650);
+}
+
+TEST(AdmissionControlCreateTest, DisabledByDefault) {
+  EXPECT_EQ(ServerAdmissionController::CreateFromChannelArgs(ChannelArgs()),
+            nullptr);
+  EXPECT_NE(ServerAdmissionController::CreateFromChannelArgs(
+                ChannelArgs().Set(GRPC_ARG_SERVER_ADMISSION_CONTROL, true)),
+            nullptr);
+}
+
+TEST_F(AdmissionControlTest, CpuUtilization) {
+  auto controller = MakeController();
+  double cpu_utilization = 0.5;
+  controller->SetCpuUtilizationSource(
+      [&cpu_utilization]() { return cpu_utilization; });
+  EXPECT_EQ(controller->Load(), 0);
+  EXPECT_TRUE(controller->AdmitCall(*Metadata("/foo/bar")).ok());
+  cpu_utilization = 0.95;
+  // The load is only recomputed once per update interval.
+  EXPECT_EQ(controller->Load(), 0);
+  time_source_.Advance(ServerAdmissionController::kUpdateInterval);
+  RunProbes();
+  EXPECT_EQ(controller->Load(), 1);
+  absl::Status status = controller->AdmitCall(*Metadata("/foo/bar"));
+  EXPECT_EQ(status.code(), absl::StatusCode::kResourceExhausted);
+  cpu_utilization = 0.875;
+  time_source_.Advance(ServerAdmissionController::kUpdateInterval);
+  EXPECT_NEAR(controller->Load(), 0.5, 1e-9);
+  // Sheddable calls are always rejected at half the load, critical ones never.
+  EXPECT_FALSE(controller->AdmitCall(*Metadata("/foo/bar", "sheddable")).ok());
+  EXPECT_TRUE(controller->AdmitCall(*Metadata("/foo/bar", "critical")).ok());
+  // A negative utilization is unknown.
+  cpu_utilization = -1;
+  time_source_.Advance(ServerAdmissionController::kUpdateInterval);
+  RunProbes();
+  EXPECT_EQ(controller->Load(), 0);
+}
+
+TEST_F(AdmissionControlTest, QueueDelay) {
+  auto controller = MakeController();
+  EXPECT_EQ(controller->Load(), 0);
+  ASSERT_EQ(probes_.size(), 1);
+  // While the probe is stuck in the queue, its age is the delay.
+  time_source_.Advance(Duration::Milliseconds(60));
+  EXPECT_NEAR(controller->Load(), 0.5, 1e-9);
+  EXPECT_EQ(probes_.size(), 1);
+  time_source_.Advance(Duration::Milliseconds(60));
+  EXPECT_EQ(controller->Load(), 1);
+  RunProbes();
+  // The probe ran after 120ms, and a new one starts.
+  time_source_.Advance(ServerAdmissionController::kUpdateInterval);
+  EXPECT_EQ(controller->Load(), 1);
+  ASSERT_EQ(probes_.size(), 1);
+  RunProbes();
+  time_source_.Advance(ServerAdmissionController::kUpdateInterval);
+  EXPECT_EQ(controller->Load(), 0);
+}
+
+TEST_F(AdmissionControlTest, MethodPriorities) {
+  ServerAdmissionController::Options options;
+  options.method_priorities.emplace("/foo/critical",
+                                    AdmissionPriority::kCritical);
+  auto controller = MakeController(std::move(options));
+  controller->SetCpuUtilizationSource([]() { return 0.875; });
+  EXPECT_NEAR(controller->Load(), 0.5, 1e-9);
+  EXPECT_TRUE(controller->AdmitCall(*Metadata("/foo/critical")).ok());
+  // Metadata overrides the priority of the method.
+  EXPECT_FALSE(
+      controller->AdmitCall(*Metadata("/foo/critical", "sheddable")).ok());
+}
+
+TEST_F(AdmissionControlTest, TenantMemoryPressure) {
+  ExecCtx exec_ctx;
+  constexpr size_t kMiB = 1024 * 1024;
+  auto quota = MakeRefCounted<ResourceQuota>("server");
+  quota->SetMemorySize(4 * kMiB);
+  auto noisy = quota->CreateChild("noisy", ResourceQuota::ChildOptions());
+  quota->CreateChild("quiet", ResourceQuota::ChildOptions());
+  ServerAdmissionController::Options options;
+  options.tenant_metadata_key = "x-tenant";
+  auto controller = MakeController(std::move(options));
+  controller->SetTenantQuotas(quota);
+  auto tenant_metadata = [](absl::string_view tenant) {
+    auto md = Metadata("/foo/bar");
+    md->Append("x-tenant", Slice::FromCopiedString(tenant),
+               [](absl::string_view, const Slice&) { abort(); });
+    return md;
+  };
+  // The noisy tenant uses all of its half of the server's quota.
+  auto allocator = noisy->memory_quota()->CreateMemoryAllocator("noisy");
+  allocator.Reserve(2 * kMiB);
+  EXPECT_EQ(controller->Load(), 0);
+  EXPECT_EQ(controller->AdmitCall(*tenant_metadata("noisy")).code(),
+            absl::StatusCode::kResourceExhausted);
+  EXPECT_TRUE(controller->AdmitCall(*tenant_metadata("quiet")).ok());
+  EXPECT_TRUE(controller->AdmitCall(*tenant_metadata("unknown")).ok());
+  EXPECT_TRUE(controller->AdmitCall(*Metadata("/foo/bar")).ok());
+  allocator.Release(2 * kMiB);
+}
+
+TEST(AdmissionControlCreateTest, MethodPrioritiesFromChannelArgs) {
+  auto controller = ServerAdmissionController::CreateFromChannelArgs(
+      ChannelArgs()
+          .Set(GRPC_ARG_SERVER_ADMISSION_CONTROL, true)
+          .Set(GRPC_ARG_SERVER_ADMISSION_CONTROL_CPU_UTILIZATION_PERCENT, 50)
+          .Set(
+              GRPC_ARG_SERVER_ADMISSION_CONTROL_CPU_UTILIZATION_PERCENT_HARD_LIMIT,
+              60)
+          .Set(GRPC_ARG_SERVER_ADMISSION_CONTROL_METHOD_PRIORITIES,
+               "/foo/a=critical, /foo/b = sheddable,/foo/c=bogus"));
+  ASSERT_NE(controller, nullptr);
+  controller->SetCpuUtilizationSource([]() { return 0.58; });
+  EXPECT_NEAR(controller->Load(), 0.8, 1e-9);
+  for (absl::string_view path : {"/foo/a", "/foo/b"}) {
+    auto md = Arena::MakePooled<ClientMetadata>();
+    md->Set(HttpPathMetadata(), Slice::FromCopiedString(path));
+    EXPECT_EQ(controller->AdmitCall(*md).ok(), path == "/foo/a");
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
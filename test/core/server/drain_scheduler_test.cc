@@ -0,0 +1,155 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/server/drain_scheduler.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/random/random.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/event_engine/mock_event_engine.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::MockEventEngine;
+using ::testing::ElementsAre;
+
+class TestTimeSource final : public Timestamp::ScopedSource {
+ public:
+  Timestamp Now() override { return now_; }
+  void Advance(Duration duration) { now_ += duration; }
+
+ private:
+  Timestamp now_ = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+};
+
+class DrainSchedulerTest : public ::testing::Test {
+ protected:
+  DrainSchedulerTest() : engine_(std::make_shared<MockEventEngine>()) {
+    EXPECT_CALL(*engine_, RunAfter(::testing::_,
+                                   ::testing::An<absl::AnyInvocable<void()>>()))
+        .WillRepeatedly(
+            [this](EventEngine::Duration delay,
+                   absl::AnyInvocable<void()> closure) {
+              timers_.emplace_back(delay, std::move(closure));
+              return EventEngine::TaskHandle::kInvalid;
+            });
+  }
+
+  DrainScheduler::Connection MakeConnection(int id, size_t active_calls,
+                                            Duration age) {
+    DrainScheduler::Connection connection;
+    connection.active_calls = active_calls;
+    connection.established = Timestamp::Now() - age;
+    connection.send_goaway = [this, id]() { drained_.push_back(id); };
+    return connection;
+  }
+
+  // Advances the time to the next timer and runs it.
+  void RunNextTimer() {
+    ASSERT_EQ(timers_.size(), 1);
+    auto timer = std::move(timers_.back());
+    timers_.pop_back();
+    time_source_.Advance(Duration::NanosecondsRoundUp(timer.first.count()));
+    timer.second();
+  }
+
+  // Before the time source, so that its time cache does not hide it.
+  ExecCtx exec_ctx_;
+  TestTimeSource time_source_;
+  std::shared_ptr<MockEventEngine> engine_;
+  std::vector<std::pair<EventEngine::Duration, absl::AnyInvocable<void()>>>
+      timers_;
+  std::vector<int> drained_;
+};
+
+TEST_F(DrainSchedulerTest, IdleAndOldestConnectionsFirst) {
+  std::vector<DrainScheduler::Connection> connections;
+  connections.push_back(MakeConnection(0, 3, Duration::Hours(1)));
+  connections.push_back(MakeConnection(1, 0, Duration::Minutes(1)));
+  connections.push_back(MakeConnection(2, 1, Duration::Hours(2)));
+  connections.push_back(MakeConnection(3, 0, Duration::Hours(1)));
+  absl::BitGen bitgen;
+  auto scheduler = MakeRefCounted<DrainScheduler>(
+      engine_, nullptr, Duration::Seconds(4), std::move(connections), bitgen);
+  scheduler->Start();
+  const Timestamp start = Timestamp::Now();
+  while (scheduler->goaways_sent() < scheduler->connections()) {
+    const size_t sent = scheduler->goaways_sent();
+    RunNextTimer();
+    // Each GOAWAY is sent within its own second of the window.
+    EXPECT_GT(scheduler->goaways_sent(), sent);
+    EXPECT_LE(Timestamp::Now() - start,
+              Duration::Seconds(scheduler->goaways_sent()));
+  }
+  EXPECT_TRUE(timers_.empty());
+  EXPECT_THAT(drained_, ElementsAre(3, 1, 2, 0));
+}
+
+TEST_F(DrainSchedulerTest, DestructionSendsRemainingGoaways) {
+  std::vector<DrainScheduler::Connection> connections;
+  for (int i = 0; i < 10; ++i) {
+    connections.push_back(MakeConnection(i, 0, Duration::Seconds(10 - i)));
+  }
+  absl::BitGen bitgen;
+  MakeRefCounted<DrainScheduler>(engine_, nullptr, Duration::Seconds(10),
+                                 std::move(connections), bitgen)
+      ->Start();
+  EXPECT_LE(drained_.size(), 1);
+  // The event engine drops the timer, as it does when shutting down.
+  timers_.clear();
+  EXPECT_THAT(drained_, ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+}
+
+TEST_F(DrainSchedulerTest, NoWindowDrainsAtOnce) {
+  std::vector<DrainScheduler::Connection> connections;
+  connections.push_back(MakeConnection(0, 1, Duration::Seconds(1)));
+  connections.push_back(MakeConnection(1, 0, Duration::Seconds(1)));
+  DrainScheduler::Drain(ChannelArgs().Set(GRPC_ARG_SERVER_DRAIN_WINDOW_MS, 0),
+                        nullptr, std::move(connections));
+  EXPECT_THAT(drained_, ElementsAre(0, 1));
+  EXPECT_TRUE(timers_.empty());
+}
+
+TEST(DrainSchedulerWindowTest, FromChannelArgs) {
+  EXPECT_EQ(DrainScheduler::WindowFromChannelArgs(ChannelArgs()),
+            Duration::Zero());
+  EXPECT_EQ(DrainScheduler::WindowFromChannelArgs(
+                ChannelArgs().Set(GRPC_ARG_SERVER_DRAIN_WINDOW_MS, 30000)),
+            Duration::Seconds(30));
+  EXPECT_EQ(DrainScheduler::WindowFromChannelArgs(
+                ChannelArgs().Set(GRPC_ARG_SERVER_DRAIN_WINDOW_MS, -1)),
+            Duration::Zero());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -327,6 +327,50 @@ TEST_F(ServiceConfigTest, Parser2BasicTest) {
   EXPECT_EQ(static_cast<TestParsedConfig1*>(parsed_config)->value(), 5);
 }
 
+TEST_F(ServiceConfigTest, MethodConfigsWithSameParamsShareParsedConfigs) {
+  const char* test_json =
+      "{\"methodConfig\": ["
+      "{\"name\":[{\"service\":\"Serv1\"}], \"method_param\":5},"
+      "{\"name\":[{\"service\":\"Serv2\"}], \"method_param\":5},"
+      "{\"name\":[{\"service\":\"Serv3\"}], \"method_param\":6}]}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* vector_ptr1 =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/Serv1/TestMethod"));
+  const auto* vector_ptr2 =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/Serv2/TestMethod"));
+  const auto* vector_ptr3 =
+      (*service_config)
+          ->GetMethodParsedConfigVector(
+              grpc_slice_from_static_string("/Serv3/TestMethod"));
+  ASSERT_NE(vector_ptr1, nullptr);
+  ASSERT_NE(vector_ptr3, nullptr);
+  EXPECT_EQ(vector_ptr1, vector_ptr2);
+  EXPECT_NE(vector_ptr1, vector_ptr3);
+  EXPECT_EQ(
+      static_cast<TestParsedConfig1*>(((*vector_ptr1)[1]).get())->value(), 5);
+  EXPECT_EQ(
+      static_cast<TestParsedConfig1*>(((*vector_ptr3)[1]).get())->value(), 6);
+}
+
+TEST_F(ServiceConfigTest, ErrorsReportedForEachMethodConfigWithSameParams) {
+  const char* test_json =
+      "{\"methodConfig\": ["
+      "{\"name\":[{\"service\":\"Serv1\"}], \"method_param\":[]},"
+      "{\"name\":[{\"service\":\"Serv2\"}], \"method_param\":[]}]}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:methodConfig[0].method_param error:is not a number; "
+            "field:methodConfig[1].method_param error:is not a number]")
+      << service_config.status();
+}
+
 TEST_F(ServiceConfigTest, Parser2DisabledViaChannelArg) {
   const ChannelArgs args = ChannelArgs().Set(GRPC_ARG_DISABLE_PARSING, 1);
   const char* test_json =
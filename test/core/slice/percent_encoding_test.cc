@@ -120,6 +120,26 @@ TEST(PercentEncodingTest, MainTest) {
   TEST_NONCONFORMANT_VECTOR("\0", "\0");
 }
 
+TEST(PercentEncodingTest, CompatibleLongMessages) {
+  // Long enough to be scanned a word at a time, with the byte needing
+  // escaping in the first word, a later word, and the tail.
+  TEST_VECTOR("resource exhausted: overloaded, retry later",
+              "resource exhausted: overloaded, retry later",
+              grpc_core::PercentEncodingType::Compatible);
+  TEST_VECTOR("100% of quota used by this tenant",
+              "100%25 of quota used by this tenant",
+              grpc_core::PercentEncodingType::Compatible);
+  TEST_VECTOR("deadline exceeded\nafter 10s",
+              "deadline exceeded%0Aafter 10s",
+              grpc_core::PercentEncodingType::Compatible);
+  TEST_VECTOR("unavailable: backend is down\x7f",
+              "unavailable: backend is down%7F",
+              grpc_core::PercentEncodingType::Compatible);
+  TEST_VECTOR("invalid argument: \xc3\xa9t\xc3\xa9",
+              "invalid argument: %C3%A9t%C3%A9",
+              grpc_core::PercentEncodingType::Compatible);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
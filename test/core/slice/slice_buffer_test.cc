@@ -17,9 +17,11 @@
 #include <string.h>
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "absl/log/check.h"
+#include "absl/strings/cord.h"
 #include "gtest/gtest.h"
 
 #include <grpc/slice.h>
@@ -79,6 +81,82 @@ TEST(SliceBufferTest, SliceRefTest) {
   sb.Clear();
 }
 
+TEST(SliceBufferTest, CoalesceSmallSlicesTest) {
+  SliceBuffer sb;
+  sb.Append(Slice::FromCopiedString(std::string(40, 'h')));
+  sb.Append(Slice::FromCopiedString(std::string(30, 'i')));
+  sb.Append(MakeSlice(4096));
+  sb.Append(Slice::FromCopiedString(std::string(50, 'j')));
+  sb.Append(MakeSlice(4096));
+  sb.Append(Slice::FromCopiedString(std::string(60, 'k')));
+  sb.Append(Slice::FromCopiedString(std::string(70, 'l')));
+  sb.Append(Slice::FromCopiedString(std::string(80, 'm')));
+  const std::string before = sb.JoinIntoString();
+  const uint8_t* big_payload = sb[2].data();
+  ASSERT_EQ(sb.Count(), 8);
+  sb.CoalesceSmallSlices(kNewSliceLength);
+  // Runs of small slices are merged, singletons and large slices are kept.
+  ASSERT_EQ(sb.Count(), 5);
+  EXPECT_EQ(sb[0].length(), 70);
+  EXPECT_EQ(sb[2].length(), 50);
+  EXPECT_EQ(sb[4].length(), 210);
+  // Large payloads are referenced, not copied.
+  EXPECT_EQ(sb[1].data(), big_payload);
+  // Coalesced runs share a single backing allocation.
+  EXPECT_EQ(sb[0].data() + 70, sb[4].data());
+  EXPECT_EQ(sb.JoinIntoString(), before);
+  // Nothing left to merge: a second pass is a no-op.
+  sb.CoalesceSmallSlices(kNewSliceLength);
+  EXPECT_EQ(sb.Count(), 5);
+  EXPECT_EQ(sb.JoinIntoString(), before);
+}
+
+TEST(SliceBufferTest, CopyInlinesSmallSlices) {
+  std::string backing(1024, 'x');
+  SliceBuffer sb;
+  for (int i = 0; i < 4; i++) {
+    sb.Append(Slice(grpc_slice_new(&backing[i * 10], 10, [](void*) {})));
+  }
+  sb.Append(MakeSlice(4096));
+  ASSERT_EQ(sb.Count(), 5);
+  SliceBuffer copy = sb.Copy();
+  EXPECT_EQ(copy.JoinIntoString(), sb.JoinIntoString());
+  // The small slices are merged into two inlined ones, the large one is shared.
+  ASSERT_EQ(copy.Count(), 3);
+  EXPECT_EQ(copy.c_slice_at(0).refcount, nullptr);
+  EXPECT_EQ(copy.c_slice_at(1).refcount, nullptr);
+  EXPECT_EQ(copy[2].data(), sb[4].data());
+}
+
+TEST(SliceBufferTest, JoinIntoCordReferencesLargeSlices) {
+  SliceBuffer sb;
+  sb.Append(Slice::FromCopiedString("hello"));
+  sb.Append(MakeSlice(4096));
+  const uint8_t* big_payload = sb[1].data();
+  absl::Cord cord = sb.JoinIntoCord();
+  sb.Clear();
+  EXPECT_EQ(std::string(cord), "hello" + std::string(4096, 'a'));
+  bool found_payload = false;
+  for (absl::string_view chunk : cord.Chunks()) {
+    if (chunk.data() == reinterpret_cast<const char*>(big_payload)) {
+      EXPECT_EQ(chunk.size(), 4096u);
+      found_payload = true;
+    }
+  }
+  EXPECT_TRUE(found_payload);
+}
+
+TEST(SliceBufferTest, AppendCordReferencesLargeChunks) {
+  const std::string big(4096, 'b');
+  absl::Cord cord("hello");
+  cord.Append(absl::MakeCordFromExternal(big, [](absl::string_view) {}));
+  SliceBuffer sb;
+  sb.AppendCord(cord);
+  EXPECT_EQ(sb.JoinIntoString(), "hello" + big);
+  ASSERT_EQ(sb.Count(), 2);
+  EXPECT_EQ(sb[1].data(), reinterpret_cast<const uint8_t*>(big.data()));
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -17,13 +17,18 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
 
+#include <grpc/impl/channel_arg_names.h>
+
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder_impl.h"
 #include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/promise/map.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/surface/channel_stack_type.h"
 #include "src/core/lib/transport/call_arena_allocator.h"
@@ -140,6 +145,48 @@ TEST(ChannelInitTest, PredicatesCanFilter) {
             std::vector<std::string>({"bar", "aaa"}));
 }
 
+TEST(ChannelInitTest, ExcludeFromMinimalStack) {
+  ChannelInit::Builder b;
+  b.RegisterFilter(GRPC_CLIENT_CHANNEL, FilterNamed("foo"))
+      .ExcludeFromMinimalStack();
+  b.RegisterFilter(GRPC_CLIENT_CHANNEL, FilterNamed("bar"));
+  b.RegisterFilter(GRPC_CLIENT_CHANNEL, FilterNamed("aaa")).Terminal();
+  auto init = b.Build();
+  EXPECT_EQ(GetFilterNames(init, GRPC_CLIENT_CHANNEL, ChannelArgs()),
+            std::vector<std::string>({"bar", "foo", "aaa"}));
+  EXPECT_EQ(GetFilterNames(init, GRPC_CLIENT_CHANNEL,
+                           ChannelArgs().Set(GRPC_ARG_MINIMAL_STACK, true)),
+            std::vector<std::string>({"bar", "aaa"}));
+}
+
+TEST(ChannelInitTest, StacksWithTheSameFiltersAreReused) {
+  ChannelInit::Builder b;
+  b.RegisterFilter(GRPC_CLIENT_CHANNEL, FilterNamed("foo"))
+      .IfChannelArg("foo", true);
+  b.RegisterFilter(GRPC_CLIENT_CHANNEL, FilterNamed("aaa")).Terminal();
+  b.RegisterPostProcessor(
+      GRPC_CLIENT_CHANNEL,
+      ChannelInit::PostProcessorSlot::kXdsChannelStackModifier,
+      [](ChannelStackBuilder& builder) {
+        if (builder.channel_args().Contains("bar")) {
+          builder.mutable_stack()->push_back(FilterNamed("bar"));
+        }
+      });
+  auto init = b.Build();
+  // Each stack gets the filters its args select, whichever stacks were built
+  // before it, and post-processing one does not change the next ones.
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(GetFilterNames(init, GRPC_CLIENT_CHANNEL,
+                             ChannelArgs().Set("bar", true)),
+              std::vector<std::string>({"foo", "aaa", "bar"}));
+    EXPECT_EQ(GetFilterNames(init, GRPC_CLIENT_CHANNEL, ChannelArgs()),
+              std::vector<std::string>({"foo", "aaa"}));
+    EXPECT_EQ(GetFilterNames(init, GRPC_CLIENT_CHANNEL,
+                             ChannelArgs().Set("foo", false)),
+              std::vector<std::string>({"aaa"}));
+  }
+}
+
 TEST(ChannelInitTest, CanAddTerminalFilter) {
   ChannelInit::Builder b;
   b.RegisterFilter(GRPC_CLIENT_CHANNEL, FilterNamed("foo"));
@@ -345,6 +392,134 @@ TEST(ChannelInitTest, CanCreateFilterWithCall) {
   EXPECT_EQ(handled, 1);
 }
 
+// Records, in the vector<int> channel arg "order", the order that calls pass
+// through it.
+template <int I>
+class OrderRecordingFilter {
+ public:
+  explicit OrderRecordingFilter(std::vector<int>* order) : order_(order) {}
+
+  static absl::string_view TypeName() {
+    static const std::string name = absl::StrCat("order_recording_", I);
+    return name;
+  }
+
+  static absl::StatusOr<std::unique_ptr<OrderRecordingFilter>> Create(
+      const ChannelArgs& args, ChannelFilter::Args) {
+    return std::make_unique<OrderRecordingFilter>(
+        args.GetPointer<std::vector<int>>("order"));
+  }
+
+  static const grpc_channel_filter kFilter;
+
+  class Call {
+   public:
+    void OnClientInitialMetadata(ClientMetadata&,
+                                 OrderRecordingFilter* filter) {
+      filter->order_->push_back(I);
+    }
+    static const NoInterceptor OnServerInitialMetadata;
+    static const NoInterceptor OnServerTrailingMetadata;
+    static const NoInterceptor OnClientToServerMessage;
+    static const NoInterceptor OnClientToServerHalfClose;
+    static const NoInterceptor OnServerToClientMessage;
+    static const NoInterceptor OnFinalize;
+  };
+
+ private:
+  std::vector<int>* const order_;
+};
+
+template <int I>
+const grpc_channel_filter OrderRecordingFilter<I>::kFilter = {
+    nullptr, nullptr, 0,       nullptr,
+    nullptr, nullptr, 0,       nullptr,
+    nullptr, nullptr, nullptr, UniqueTypeNameFor<OrderRecordingFilter<I>>()};
+template <int I>
+const NoInterceptor OrderRecordingFilter<I>::Call::OnServerInitialMetadata;
+template <int I>
+const NoInterceptor OrderRecordingFilter<I>::Call::OnServerTrailingMetadata;
+template <int I>
+const NoInterceptor OrderRecordingFilter<I>::Call::OnClientToServerMessage;
+template <int I>
+const NoInterceptor OrderRecordingFilter<I>::Call::OnClientToServerHalfClose;
+template <int I>
+const NoInterceptor OrderRecordingFilter<I>::Call::OnServerToClientMessage;
+template <int I>
+const NoInterceptor OrderRecordingFilter<I>::Call::OnFinalize;
+
+// Builds the v3 stack of GRPC_CLIENT_CHANNEL for args, runs a call through
+// it, and returns the order of the OrderRecordingFilters the call passed.
+std::vector<int> RunCallThroughFilters(const ChannelInit& init,
+                                       const ChannelArgs& args) {
+  std::vector<int> order;
+  InterceptionChainBuilder chain_builder{
+      args.Set("order", ChannelArgs::UnownedPointer(&order))};
+  init.AddToInterceptionChainBuilder(GRPC_CLIENT_CHANNEL, chain_builder);
+  auto stack = chain_builder.Build(
+      MakeCallDestinationFromHandlerFunction([](CallHandler handler) {
+        handler.SpawnInfallible("pull", [handler]() mutable {
+          return Map(handler.PullClientInitialMetadata(),
+                     [](ValueOrFailure<ClientMetadataHandle>) {
+                       return Empty{};
+                     });
+        });
+      }));
+  EXPECT_TRUE(stack.ok()) << stack.status();
+  if (!stack.ok()) return order;
+  RefCountedPtr<CallArenaAllocator> allocator =
+      MakeRefCounted<CallArenaAllocator>(
+          ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+              "test"),
+          1024);
+  auto event_engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+  auto arena = allocator->MakeArena();
+  arena->SetContext<grpc_event_engine::experimental::EventEngine>(
+      event_engine.get());
+  auto call =
+      MakeCallPair(Arena::MakePooled<ClientMetadata>(), std::move(arena));
+  (*stack)->StartCall(std::move(call.handler));
+  return order;
+}
+
+ChannelInit BuildWithFusedFilters() {
+  ChannelInit::Builder b;
+  b.RegisterFilter<OrderRecordingFilter<1>>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFilter<OrderRecordingFilter<2>>(GRPC_CLIENT_CHANNEL)
+      .IfChannelArg("include_2", false);
+  b.RegisterFilter<OrderRecordingFilter<3>>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFusedFilters<OrderRecordingFilter<1>, OrderRecordingFilter<3>>(
+      GRPC_CLIENT_CHANNEL);
+  return b.Build();
+}
+
+TEST(ChannelInitTest, FusedFiltersRunInOrder) {
+  grpc::testing::TestGrpcScope g;
+  EXPECT_EQ(RunCallThroughFilters(BuildWithFusedFilters(), ChannelArgs()),
+            std::vector<int>({1, 3}));
+}
+
+TEST(ChannelInitTest, FusedFiltersAreNotFusedAroundAnotherFilter) {
+  grpc::testing::TestGrpcScope g;
+  // Filter 2 sits between the fused filters, so each is added on its own: if
+  // they were fused, 3 would run before 2.
+  EXPECT_EQ(RunCallThroughFilters(BuildWithFusedFilters(),
+                                  ChannelArgs().Set("include_2", true)),
+            std::vector<int>({1, 2, 3}));
+}
+
+TEST(ChannelInitTest, FusedFiltersFallBackWhenNotAllSelected) {
+  grpc::testing::TestGrpcScope g;
+  ChannelInit::Builder b;
+  b.RegisterFilter<OrderRecordingFilter<1>>(GRPC_CLIENT_CHANNEL);
+  b.RegisterFilter<OrderRecordingFilter<2>>(GRPC_CLIENT_CHANNEL)
+      .IfChannelArg("include_2", false);
+  b.RegisterFusedFilters<OrderRecordingFilter<1>, OrderRecordingFilter<2>>(
+      GRPC_CLIENT_CHANNEL);
+  EXPECT_EQ(RunCallThroughFilters(b.Build(), ChannelArgs()),
+            std::vector<int>({1}));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
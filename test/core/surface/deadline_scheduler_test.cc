@@ -0,0 +1,164 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/surface/deadline_scheduler.h"
+
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include "absl/functional/any_invocable.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/event_engine/mock_event_engine.h"
+
+using grpc_event_engine::experimental::EventEngine;
+using grpc_event_engine::experimental::MockEventEngine;
+using testing::_;
+
+namespace grpc_core {
+namespace {
+
+class CountingClosure : public EventEngine::Closure {
+ public:
+  void Run() override { ++runs; }
+  int runs = 0;
+};
+
+// Keeps the timers started on a MockEventEngine, to be run by the test.
+class DeadlineSchedulerTest : public ::testing::Test {
+ protected:
+  DeadlineSchedulerTest() {
+    ON_CALL(event_engine_,
+            RunAfter(_, testing::Matcher<absl::AnyInvocable<void()>>(_)))
+        .WillByDefault([this](EventEngine::Duration when,
+                              absl::AnyInvocable<void()> callback) {
+          timers_.push_back({when, std::move(callback)});
+          return EventEngine::TaskHandle{
+              static_cast<intptr_t>(timers_.size()), 0};
+        });
+  }
+
+  void RunTimer(size_t index) {
+    auto callback = std::move(timers_[index].callback);
+    callback();
+  }
+
+  struct Timer {
+    EventEngine::Duration when;
+    absl::AnyInvocable<void()> callback;
+  };
+
+  const Duration kSlot = Duration::Milliseconds(100);
+  const Timestamp kSlotStart =
+      Timestamp::Now() + Duration::Seconds(10) -
+      Duration::Milliseconds(
+          Timestamp::Now().milliseconds_after_process_epoch() % 100);
+  testing::NiceMock<MockEventEngine> event_engine_;
+  std::vector<Timer> timers_;
+};
+
+TEST_F(DeadlineSchedulerTest, DeadlinesInASlotShareATimer) {
+  CountingClosure closures[4];
+  DeadlineScheduler::Entry entries[4];
+  const Duration deadlines[4] = {
+      Duration::Milliseconds(1), Duration::Milliseconds(50),
+      Duration::Milliseconds(100), Duration::Milliseconds(101)};
+  for (int i = 0; i < 4; ++i) {
+    DeadlineScheduler::Schedule(&event_engine_, kSlotStart + deadlines[i],
+                                kSlot, &closures[i], &entries[i]);
+  }
+  // The first three deadlines round up to the end of the first slot, the
+  // last one to the end of the next.
+  ASSERT_EQ(timers_.size(), 2);
+  EXPECT_GE(timers_[0].when, EventEngine::Duration::zero());
+  RunTimer(0);
+  EXPECT_EQ(closures[0].runs, 1);
+  EXPECT_EQ(closures[1].runs, 1);
+  EXPECT_EQ(closures[2].runs, 1);
+  EXPECT_EQ(closures[3].runs, 0);
+  EXPECT_FALSE(DeadlineScheduler::Cancel(&entries[0]));
+  RunTimer(1);
+  EXPECT_EQ(closures[3].runs, 1);
+}
+
+TEST_F(DeadlineSchedulerTest, CancelledEntriesDoNotRun) {
+  CountingClosure closures[2];
+  DeadlineScheduler::Entry entries[2];
+  for (int i = 0; i < 2; ++i) {
+    DeadlineScheduler::Schedule(&event_engine_,
+                                kSlotStart + Duration::Milliseconds(10), kSlot,
+                                &closures[i], &entries[i]);
+  }
+  ASSERT_EQ(timers_.size(), 1);
+  EXPECT_TRUE(DeadlineScheduler::Cancel(&entries[0]));
+  EXPECT_FALSE(DeadlineScheduler::Cancel(&entries[0]));
+  RunTimer(0);
+  EXPECT_EQ(closures[0].runs, 0);
+  EXPECT_EQ(closures[1].runs, 1);
+}
+
+TEST_F(DeadlineSchedulerTest, CancellingTheLastEntryStopsTheTimer) {
+  CountingClosure closure;
+  DeadlineScheduler::Entry entry;
+  DeadlineScheduler::Schedule(&event_engine_,
+                              kSlotStart + Duration::Milliseconds(10), kSlot,
+                              &closure, &entry);
+  ASSERT_EQ(timers_.size(), 1);
+  EXPECT_CALL(event_engine_, Cancel(EventEngine::TaskHandle{1, 0}))
+      .WillOnce(testing::Return(true));
+  EXPECT_TRUE(DeadlineScheduler::Cancel(&entry));
+  // The slot is gone: scheduling into it again starts a new timer.
+  DeadlineScheduler::Schedule(&event_engine_,
+                              kSlotStart + Duration::Milliseconds(20), kSlot,
+                              &closure, &entry);
+  ASSERT_EQ(timers_.size(), 2);
+  RunTimer(1);
+  EXPECT_EQ(closure.runs, 1);
+}
+
+TEST_F(DeadlineSchedulerTest, CancelRacingTheTimer) {
+  CountingClosure closures[2];
+  DeadlineScheduler::Entry entries[2];
+  DeadlineScheduler::Schedule(&event_engine_,
+                              kSlotStart + Duration::Milliseconds(10), kSlot,
+                              &closures[0], &entries[0]);
+  // The timer has started running, and can no longer be cancelled.
+  EXPECT_CALL(event_engine_, Cancel(_)).WillOnce(testing::Return(false));
+  EXPECT_TRUE(DeadlineScheduler::Cancel(&entries[0]));
+  // New deadlines for the slot do not join the one that is being run...
+  DeadlineScheduler::Schedule(&event_engine_,
+                              kSlotStart + Duration::Milliseconds(20), kSlot,
+                              &closures[1], &entries[1]);
+  ASSERT_EQ(timers_.size(), 2);
+  // ... which finds nothing to do.
+  RunTimer(0);
+  EXPECT_EQ(closures[0].runs, 0);
+  EXPECT_EQ(closures[1].runs, 0);
+  RunTimer(1);
+  EXPECT_EQ(closures[1].runs, 1);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/telemetry/call_phase_timestamps.h"
+
+#include "gtest/gtest.h"
+
+#include <grpc/support/time.h>
+
+#include "src/core/lib/resource_quota/arena.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using Phase = CallPhaseTimestamps::Phase;
+
+struct Exported {
+  gpr_timespec first_byte_received;
+  gpr_timespec initial_metadata_received;
+  gpr_timespec handler_invoked;
+  gpr_timespec initial_metadata_written;
+  gpr_timespec end_of_stream_written;
+};
+
+bool IsUnset(gpr_timespec t) {
+  return gpr_time_cmp(t, gpr_inf_past(GPR_CLOCK_MONOTONIC)) == 0;
+}
+
+TEST(CallPhaseTimestampsTest, RecordsEachPhaseOnce) {
+  CallPhaseTimestamps timestamps;
+  EXPECT_TRUE(IsUnset(timestamps.Get(Phase::kFirstByteReceived)));
+  timestamps.Record(Phase::kFirstByteReceived,
+                    gpr_time_from_nanos(1000, GPR_CLOCK_MONOTONIC));
+  timestamps.Record(Phase::kFirstByteReceived,
+                    gpr_time_from_nanos(2000, GPR_CLOCK_MONOTONIC));
+  EXPECT_EQ(gpr_time_cmp(timestamps.Get(Phase::kFirstByteReceived),
+                         gpr_time_from_nanos(1000, GPR_CLOCK_MONOTONIC)),
+            0);
+  EXPECT_TRUE(IsUnset(timestamps.Get(Phase::kEndOfStreamWritten)));
+}
+
+TEST(CallPhaseTimestampsTest, Export) {
+  CallPhaseTimestamps timestamps;
+  timestamps.Record(Phase::kHandlerInvoked);
+  Exported exported;
+  timestamps.ExportTo(exported);
+  EXPECT_TRUE(IsUnset(exported.first_byte_received));
+  EXPECT_FALSE(IsUnset(exported.handler_invoked));
+  EXPECT_LE(gpr_time_cmp(exported.handler_invoked,
+                         gpr_now(GPR_CLOCK_MONOTONIC)),
+            0);
+  CallPhaseTimestamps::ExportUnsetTo(exported);
+  EXPECT_TRUE(IsUnset(exported.handler_invoked));
+}
+
+TEST(CallPhaseTimestampsTest, RecordCallPhaseNeedsAnArenaContext) {
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  // Calls that do not record phases have no context: nothing to do.
+  RecordCallPhase(arena.get(), Phase::kInitialMetadataWritten);
+  auto* timestamps = arena->New<CallPhaseTimestamps>();
+  arena->SetContext<CallPhaseTimestamps>(timestamps);
+  RecordCallPhase(arena.get(), Phase::kInitialMetadataWritten);
+  EXPECT_FALSE(IsUnset(timestamps->Get(Phase::kInitialMetadataWritten)));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
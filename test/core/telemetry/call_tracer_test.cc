@@ -18,6 +18,7 @@
 
 #include "src/core/telemetry/call_tracer.h"
 
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -100,6 +101,27 @@ TEST_F(CallTracerTest, MultipleServerCallTracers) {
             std::vector<std::string>({"Test", "Test", "Test"}));
 }
 
+TEST_F(CallTracerTest, LazyAnnotationIsOnlyBuiltWhenSampled) {
+  class SampledClientCallTracer : public FakeClientCallTracer {
+   public:
+    using FakeClientCallTracer::FakeClientCallTracer;
+    bool IsSampled() override { return true; }
+  };
+  int annotations_built = 0;
+  auto make_annotation = [&annotations_built]() {
+    ++annotations_built;
+    return std::string("Test");
+  };
+  FakeClientCallTracer unsampled_call_tracer(&annotation_logger_);
+  unsampled_call_tracer.RecordLazyAnnotation(make_annotation);
+  EXPECT_EQ(annotations_built, 0);
+  EXPECT_TRUE(annotation_logger_.empty());
+  SampledClientCallTracer sampled_call_tracer(&annotation_logger_);
+  sampled_call_tracer.RecordLazyAnnotation(make_annotation);
+  EXPECT_EQ(annotations_built, 1);
+  EXPECT_EQ(annotation_logger_, std::vector<std::string>{"Test"});
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -26,7 +26,9 @@
 #include <grpc/grpc.h>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/telemetry/metrics.h"
 #include "src/core/telemetry/stats_data.h"
+#include "test/core/test_util/fake_stats_plugin.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc_core {
@@ -57,6 +59,33 @@ TEST(StatsTest, IncrementHttp2MetadataSize) {
   global_stats().IncrementHttp2MetadataSize(0);
 }
 
+TEST(StatsTest, ExportedToStatsPlugins) {
+  auto plugin = FakeStatsPluginBuilder()
+                    .UseDisabledByDefaultMetrics(true)
+                    .BuildAndRegister();
+  auto counter_handle =
+      GlobalInstrumentsRegistryTestPeer::FindCallbackInt64GaugeHandleByName(
+          "grpc.core.stats.client_calls_created");
+  ASSERT_TRUE(counter_handle.has_value());
+  auto histogram_handle =
+      GlobalInstrumentsRegistryTestPeer::FindCallbackInt64GaugeHandleByName(
+          "grpc.core.stats.tcp_write_size");
+  ASSERT_TRUE(histogram_handle.has_value());
+  {
+    ExecCtx exec_ctx;
+    global_stats().IncrementClientCallsCreated();
+    global_stats().IncrementTcpWriteSize(1);
+  }
+  plugin->TriggerCallbacks();
+  auto stats = global_stats().Collect();
+  EXPECT_EQ(plugin->GetInt64CallbackGaugeValue(*counter_handle, {}, {}),
+            stats->client_calls_created);
+  // The last bucket counts every value.
+  EXPECT_EQ(plugin->GetInt64CallbackGaugeValue(*histogram_handle, {"+Inf"}, {}),
+            stats->histogram(GlobalStats::Histogram::kTcpWriteSize).Count());
+  GlobalStatsPluginRegistryTestPeer::ResetGlobalStatsPluginRegistry();
+}
+
 static int FindExpectedBucket(const HistogramView& h, int value) {
   if (value < 0) {
     return 0;
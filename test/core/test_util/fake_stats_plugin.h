@@ -699,6 +699,7 @@ class GlobalStatsPluginRegistryTestPeer {
  public:
   static void ResetGlobalStatsPluginRegistry() {
     MutexLock lock(&*GlobalStatsPluginRegistry::mutex_);
+    GlobalStatsPluginRegistry::global_stats_exports_->clear();
     GlobalStatsPluginRegistry::plugins_->clear();
   }
 };
@@ -34,6 +34,8 @@
 #include "src/core/ext/transport/binder/transport/binder_stream.h"
 #include "src/core/lib/gprpp/notification.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "test/core/test_util/test_config.h"
 #include "test/core/transport/binder/mock_objects.h"
 
@@ -357,6 +359,12 @@ Metadata AppendStatus(const Metadata& md, int status) {
   return result;
 }
 
+grpc_core::SliceBuffer MessageSliceBuffer(const std::string& message) {
+  grpc_core::SliceBuffer result;
+  result.Append(grpc_core::Slice::FromCopiedString(message));
+  return result;
+}
+
 }  // namespace
 
 TEST_F(BinderTransportTest, CreateBinderTransport) {
@@ -552,7 +560,8 @@ TEST_F(BinderTransportTest, PerformRecvMessage) {
 
   auto* gbt = reinterpret_cast<grpc_binder_transport*>(transport_);
   const std::string kMessage = kDefaultMessage;
-  gbt->transport_stream_receiver->NotifyRecvMessage(gbs->tx_code, kMessage);
+  gbt->transport_stream_receiver->NotifyRecvMessage(
+      gbs->tx_code, MessageSliceBuffer(kMessage));
 
   PerformStreamOp(gbs, &op);
   grpc_core::ExecCtx::Get()->Flush();
@@ -601,7 +610,8 @@ TEST_F(BinderTransportTest, PerformRecvAll) {
       gbs->tx_code, kInitialMetadataWithMethodRef);
 
   const std::string kMessage = kDefaultMessage;
-  gbt->transport_stream_receiver->NotifyRecvMessage(gbs->tx_code, kMessage);
+  gbt->transport_stream_receiver->NotifyRecvMessage(
+      gbs->tx_code, MessageSliceBuffer(kMessage));
 
   Metadata trailing_metadata = kDefaultMetadata;
   constexpr int kStatus = kDefaultStatus;
@@ -671,7 +681,8 @@ TEST_F(BinderTransportTest, PerformAllOps) {
   gbt->transport_stream_receiver->NotifyRecvInitialMetadata(
       gbs->tx_code, kRecvInitialMetadata);
   const std::string kRecvMessage = kDefaultMessage;
-  gbt->transport_stream_receiver->NotifyRecvMessage(gbs->tx_code, kRecvMessage);
+  gbt->transport_stream_receiver->NotifyRecvMessage(
+      gbs->tx_code, MessageSliceBuffer(kRecvMessage));
   const Metadata kRecvTrailingMetadata = kDefaultMetadata;
   constexpr int kStatus = 0x1234;
   gbt->transport_stream_receiver->NotifyRecvTrailingMetadata(
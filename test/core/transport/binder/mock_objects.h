@@ -79,10 +79,15 @@ class MockTransactionReceiver : public TransactionReceiver {
                                    BinderTransportTxCode code,
                                    MockReadableParcel* output) {
     if (code == BinderTransportTxCode::SETUP_TRANSPORT) {
-      EXPECT_CALL(*output, ReadInt32).WillOnce([](int32_t* version) {
-        *version = 1;
-        return absl::OkStatus();
-      });
+      EXPECT_CALL(*output, ReadInt32)
+          .WillOnce([](int32_t* version) {
+            *version = 1;
+            return absl::OkStatus();
+          })
+          .WillOnce([](int32_t* features) {
+            *features = 0;
+            return absl::OkStatus();
+          });
     }
     transact_cb(static_cast<transaction_code_t>(code), output, /*uid=*/0)
         .IgnoreError();
@@ -110,7 +115,8 @@ class MockTransportStreamReceiver : public TransportStreamReceiver {
   MOCK_METHOD(void, NotifyRecvInitialMetadata,
               (StreamIdentifier, absl::StatusOr<Metadata>), (override));
   MOCK_METHOD(void, NotifyRecvMessage,
-              (StreamIdentifier, absl::StatusOr<std::string>), (override));
+              (StreamIdentifier, absl::StatusOr<grpc_core::SliceBuffer>),
+              (override));
   MOCK_METHOD(void, NotifyRecvTrailingMetadata,
               (StreamIdentifier, absl::StatusOr<Metadata>, int), (override));
   MOCK_METHOD(void, CancelStream, (StreamIdentifier), (override));
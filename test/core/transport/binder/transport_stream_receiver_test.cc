@@ -23,6 +23,8 @@
 #include "absl/memory/memory.h"
 
 #include "src/core/ext/transport/binder/utils/transport_stream_receiver_impl.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc_binder {
@@ -53,6 +55,12 @@ std::pair<StreamIdentifier, int> Decode<Metadata>(const Metadata& data) {
   return Decode(encoding);
 }
 
+template <>
+std::pair<StreamIdentifier, int> Decode<grpc_core::SliceBuffer>(
+    const grpc_core::SliceBuffer& data) {
+  return Decode(data.JoinIntoString());
+}
+
 template <typename T>
 T Encode(StreamIdentifier /*id*/, int /*seq_num*/) {
   assert(false && "This should not be called");
@@ -72,6 +80,15 @@ Metadata Encode<Metadata>(StreamIdentifier id, int seq_num) {
   return {{Encode<std::string>(id, seq_num), ""}};
 }
 
+template <>
+grpc_core::SliceBuffer Encode<grpc_core::SliceBuffer>(StreamIdentifier id,
+                                                      int seq_num) {
+  grpc_core::SliceBuffer result;
+  result.Append(
+      grpc_core::Slice::FromCopiedString(Encode<std::string>(id, seq_num)));
+  return result;
+}
+
 MATCHER_P2(StreamIdAndSeqNumMatch, id, seq_num, "") {
   auto p = Decode(arg.value());
   return p.first == id && p.second == seq_num;
@@ -90,7 +107,7 @@ class MockCallback {
 
   std::function<void(FirstArg, TrailingArgs...)> GetHandle() {
     return [this](FirstArg first_arg, TrailingArgs...) {
-      this->ActualCallback(first_arg);
+      this->ActualCallback(std::move(first_arg));
     };
   }
 
@@ -104,7 +121,8 @@ class MockCallback {
 };
 
 using MockInitialMetadataCallback = MockCallback<absl::StatusOr<Metadata>>;
-using MockMessageCallback = MockCallback<absl::StatusOr<std::string>>;
+using MockMessageCallback =
+    MockCallback<absl::StatusOr<grpc_core::SliceBuffer>>;
 using MockTrailingMetadataCallback =
     MockCallback<absl::StatusOr<Metadata>, int>;
 
@@ -132,7 +150,8 @@ class MockOpBatch {
     }
     if (flag_ & kFlagMessageData) {
       message_callback_->ExpectCallbackInvocation();
-      receiver.NotifyRecvMessage(id_, Encode<std::string>(id_, seq_num_));
+      receiver.NotifyRecvMessage(
+          id_, Encode<grpc_core::SliceBuffer>(id_, seq_num_));
     }
     if (flag_ & kFlagSuffix) {
       trailing_metadata_callback_->ExpectCallbackInvocation();
@@ -31,6 +31,7 @@
 #include <grpc/grpc.h>
 #include <grpcpp/security/binder_security_policy.h>
 
+#include "src/core/ext/transport/binder/utils/shared_memory.h"
 #include "src/core/ext/transport/binder/wire_format/wire_reader_impl.h"
 #include "test/core/test_util/test_config.h"
 #include "test/core/transport/binder/mock_objects.h"
@@ -101,9 +102,11 @@ class WireReaderTest : public ::testing::Test {
   MockReadableParcel mock_readable_parcel_;
 };
 
+MATCHER(IsOk, "") { return arg.ok(); }
+
 MATCHER_P(StatusOrStrEq, target, "") {
   if (!arg.ok()) return false;
-  return arg.value() == target;
+  return arg->JoinIntoString() == target;
 }
 
 MATCHER_P(StatusOrContainerEq, target, "") {
@@ -125,6 +128,11 @@ TEST_F(WireReaderTest, SetupTransport) {
 
   // Write version.
   EXPECT_CALL(mock_binder_ref.GetWriter(), WriteInt32(1));
+  // Write features.
+  EXPECT_CALL(mock_binder_ref.GetWriter(),
+              WriteInt32(SharedMemoryIsSupported()
+                             ? kSetupTransportFeatureSharedMemory
+                             : 0));
 
   wire_reader_->SetupTransport(std::move(mock_binder));
 }
@@ -242,6 +250,27 @@ TEST_F(WireReaderTest, ProcessTransactionServerRpcDataFlagMessageDataEmpty) {
   EXPECT_TRUE(CallProcessTransaction(kFirstCallId).ok());
 }
 
+TEST_F(WireReaderTest,
+       ProcessTransactionServerRpcDataSharedMemoryRejectedIfUnsupported) {
+  if (SharedMemoryIsSupported()) {
+    GTEST_SKIP() << "Shared memory is supported on this platform";
+  }
+  ::testing::InSequence sequence;
+  UnblockSetupTransport();
+
+  // flag
+  ExpectReadInt32(kFlagMessageData | kFlagMessageDataIsSharedMemory);
+  // sequence number
+  ExpectReadInt32(0);
+  // region size
+  ExpectReadInt32(1 << 20);
+  // The message is cancelled without reading the file descriptor.
+  EXPECT_CALL(*transport_stream_receiver_,
+              NotifyRecvMessage(kFirstCallId, ::testing::Not(IsOk())));
+
+  EXPECT_FALSE(CallProcessTransaction(kFirstCallId).ok());
+}
+
 TEST_F(WireReaderTest, ProcessTransactionServerRpcDataFlagSuffixWithStatus) {
   ::testing::InSequence sequence;
   UnblockSetupTransport();
@@ -312,8 +341,8 @@ TEST_F(WireReaderTest, InBoundFlowControl) {
 
   EXPECT_CALL(*transport_stream_receiver_,
               NotifyRecvMessage(kFirstCallId,
-                                StatusOrContainerEq(std::string(1000, 'a') +
-                                                    std::string(1000, 'b'))));
+                                StatusOrStrEq(std::string(1000, 'a') +
+                                              std::string(1000, 'b'))));
   EXPECT_TRUE(CallProcessTransaction(kFirstCallId).ok());
 }
 
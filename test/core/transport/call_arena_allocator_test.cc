@@ -28,6 +28,7 @@
 #include <string>
 #include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -73,6 +74,39 @@ TEST(CallArenaAllocatorTest, SettlesWithAllocation) {
   LOG(INFO) << estimate;
 }
 
+TEST(CallArenaAllocatorTest, MethodsHaveTheirOwnEstimates) {
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "test-allocator"),
+      1);
+  for (int i = 0; i < 10000; i++) {
+    allocator->MakeArenaForMethod("/big")->Alloc(10000);
+    allocator->MakeArenaForMethod("/small");
+  }
+  EXPECT_GE(allocator->CallSizeEstimateForMethod("/big"), 10000);
+  EXPECT_LT(allocator->CallSizeEstimateForMethod("/small"), 1000);
+}
+
+TEST(CallArenaAllocatorTest, MethodEstimatesAreBounded) {
+  auto allocator = MakeRefCounted<CallArenaAllocator>(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+          "test-allocator"),
+      1);
+  for (size_t i = 0; i < CallArenaAllocator::kMaxMethods; i++) {
+    allocator->MakeArenaForMethod(absl::StrCat("/method", i))->Alloc(10000);
+  }
+  // Past the limit, methods share the channel-wide estimate.
+  const std::string extra_method =
+      absl::StrCat("/method", CallArenaAllocator::kMaxMethods);
+  EXPECT_EQ(allocator->CallSizeEstimateForMethod(extra_method),
+            allocator->CallSizeEstimate());
+  for (int i = 0; i < 10000; i++) {
+    allocator->MakeArenaForMethod(extra_method);
+  }
+  EXPECT_EQ(allocator->CallSizeEstimateForMethod(extra_method),
+            allocator->CallSizeEstimate());
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char* argv[]) {
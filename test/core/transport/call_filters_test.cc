@@ -956,6 +956,98 @@ TEST(StackBuilderTest, AddOnServerTrailingMetadata) {
   EXPECT_NE(data.server_trailing_metadata[0].channel_data, nullptr);
 }
 
+namespace {
+// Intercepts client initial metadata in place, and fails calls that it has
+// already seen the path of.
+class FusiblePathFilter {
+ public:
+  class Call {
+   public:
+    absl::Status OnClientInitialMetadata(ClientMetadata& md,
+                                         FusiblePathFilter* filter) {
+      ++filter->client_initial_metadata_count;
+      if (md.get_pointer(HttpPathMetadata()) != nullptr) {
+        return absl::CancelledError();
+      }
+      md.Set(HttpPathMetadata(), Slice::FromStaticString("hello"));
+      return absl::OkStatus();
+    }
+    static const NoInterceptor OnServerInitialMetadata;
+    static const NoInterceptor OnClientToServerMessage;
+    static const NoInterceptor OnClientToServerHalfClose;
+    void OnServerToClientMessage(Message&) {}
+    static const NoInterceptor OnServerTrailingMetadata;
+    static const NoInterceptor OnFinalize;
+  };
+
+  int client_initial_metadata_count = 0;
+};
+const NoInterceptor FusiblePathFilter::Call::OnServerInitialMetadata;
+const NoInterceptor FusiblePathFilter::Call::OnClientToServerMessage;
+const NoInterceptor FusiblePathFilter::Call::OnClientToServerHalfClose;
+const NoInterceptor FusiblePathFilter::Call::OnServerTrailingMetadata;
+const NoInterceptor FusiblePathFilter::Call::OnFinalize;
+
+// Replaces client to server messages, which cannot be fused.
+class MessageReplacingFilter {
+ public:
+  class Call {
+   public:
+    void OnClientInitialMetadata(ClientMetadata&) {}
+    static const NoInterceptor OnServerInitialMetadata;
+    MessageHandle OnClientToServerMessage(MessageHandle message,
+                                          MessageReplacingFilter*) {
+      return message;
+    }
+    static const NoInterceptor OnClientToServerHalfClose;
+    static const NoInterceptor OnServerToClientMessage;
+    static const NoInterceptor OnServerTrailingMetadata;
+    static const NoInterceptor OnFinalize;
+  };
+};
+const NoInterceptor MessageReplacingFilter::Call::OnServerInitialMetadata;
+const NoInterceptor MessageReplacingFilter::Call::OnClientToServerHalfClose;
+const NoInterceptor MessageReplacingFilter::Call::OnServerToClientMessage;
+const NoInterceptor MessageReplacingFilter::Call::OnServerTrailingMetadata;
+const NoInterceptor MessageReplacingFilter::Call::OnFinalize;
+}  // namespace
+
+TEST(StackBuilderTest, AddFused) {
+  FusiblePathFilter f1;
+  MessageReplacingFilter f2;
+  FusiblePathFilter f3;
+  FusiblePathFilter f4;
+  CallFilters::StackBuilder b;
+  b.AddFused(&f1, &f2, &f3, &f4);
+  auto stack = b.Build();
+  const auto& data = CallFilters::StackTestSpouse().StackDataFrom(*stack);
+  // All three filters intercept client initial metadata in place.
+  ASSERT_EQ(data.client_initial_metadata.ops.size(), 1u);
+  // Nobody intercepts server initial metadata.
+  EXPECT_EQ(data.server_initial_metadata.ops.size(), 0u);
+  // Only one filter does client to server messages, and it can't be fused.
+  EXPECT_EQ(data.client_to_server_messages.ops.size(), 1u);
+  EXPECT_EQ(data.server_to_client_messages.ops.size(), 1u);
+  EXPECT_EQ(data.client_to_server_half_close.size(), 0u);
+  EXPECT_EQ(data.server_trailing_metadata.size(), 0u);
+  EXPECT_EQ(data.finalizers.size(), 0u);
+  // The fused operation runs the filters in order, and stops at the first
+  // failure.
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  promise_detail::Context<Arena> ctx(arena.get());
+  filters_detail::OperationExecutor<ClientMetadataHandle> executor;
+  char call_data;
+  auto r = executor.Start(&data.client_initial_metadata,
+                          Arena::MakePooled<ClientMetadata>(), &call_data);
+  ASSERT_TRUE(r.ready());
+  EXPECT_EQ(r.value().ok, nullptr);
+  EXPECT_EQ(r.value().error->get(GrpcStatusMetadata()),
+            GRPC_STATUS_CANCELLED);
+  EXPECT_EQ(f1.client_initial_metadata_count, 1);
+  EXPECT_EQ(f3.client_initial_metadata_count, 1);
+  EXPECT_EQ(f4.client_initial_metadata_count, 0);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // OperationExecutor
 
@@ -1214,6 +1306,148 @@ TEST(CallFiltersTest, UnaryCall) {
                   "f1:OnFinalize", "f2:OnFinalize"));
 }
 
+TEST(CallFiltersTest, FusedUnaryCall) {
+  struct Filter {
+    struct Call {
+      void OnClientInitialMetadata(ClientMetadata&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnClientInitialMetadata"));
+      }
+      void OnServerInitialMetadata(ServerMetadata&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnServerInitialMetadata"));
+      }
+      void OnClientToServerMessage(Message&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnClientToServerMessage"));
+      }
+      void OnClientToServerHalfClose(Filter* f) {
+        f->steps.push_back(
+            absl::StrCat(f->label, ":OnClientToServerHalfClose"));
+      }
+      void OnServerToClientMessage(Message&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnServerToClientMessage"));
+      }
+      void OnServerTrailingMetadata(ServerMetadata&, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnServerTrailingMetadata"));
+      }
+      void OnFinalize(const grpc_call_final_info*, Filter* f) {
+        f->steps.push_back(absl::StrCat(f->label, ":OnFinalize"));
+      }
+      std::unique_ptr<int> i = std::make_unique<int>(3);
+    };
+
+    const std::string label;
+    std::vector<std::string>& steps;
+  };
+  std::vector<std::string> steps;
+  Filter f1{"f1", steps};
+  Filter f2{"f2", steps};
+  CallFilters::StackBuilder builder;
+  builder.AddFused(&f1, &f2);
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  CallFilters filters(Arena::MakePooled<ClientMetadata>());
+  filters.AddStack(builder.Build());
+  filters.Start();
+  promise_detail::Context<Arena> ctx(arena.get());
+  StrictMock<MockActivity> activity;
+  activity.Activate();
+  // Pull client initial metadata
+  auto pull_client_initial_metadata = filters.PullClientInitialMetadata();
+  EXPECT_THAT(pull_client_initial_metadata(), IsReady());
+  Mock::VerifyAndClearExpectations(&activity);
+  // Push client to server message
+  auto push_client_to_server_message = filters.PushClientToServerMessage(
+      Arena::MakePooled<Message>(SliceBuffer(), 0));
+  EXPECT_THAT(push_client_to_server_message(), IsPending());
+  auto pull_client_to_server_message = filters.PullClientToServerMessage();
+  // Pull client to server message, expect a wakeup
+  EXPECT_WAKEUP(activity,
+                EXPECT_THAT(pull_client_to_server_message(), IsReady()));
+  // Push should be done
+  EXPECT_THAT(push_client_to_server_message(), IsReady(Success{}));
+  // Push server initial metadata
+  filters.PushServerInitialMetadata(Arena::MakePooled<ServerMetadata>());
+  auto pull_server_initial_metadata = filters.PullServerInitialMetadata();
+  // Pull server initial metadata
+  EXPECT_THAT(pull_server_initial_metadata(), IsReady());
+  Mock::VerifyAndClearExpectations(&activity);
+  // Push server to client message
+  auto push_server_to_client_message = filters.PushServerToClientMessage(
+      Arena::MakePooled<Message>(SliceBuffer(), 0));
+  EXPECT_THAT(push_server_to_client_message(), IsPending());
+  auto pull_server_to_client_message = filters.PullServerToClientMessage();
+  // Pull server to client message, expect a wakeup
+  EXPECT_WAKEUP(activity,
+                EXPECT_THAT(pull_server_to_client_message(), IsReady()));
+  // Push should be done
+  EXPECT_THAT(push_server_to_client_message(), IsReady(Success{}));
+  // Push server trailing metadata
+  filters.PushServerTrailingMetadata(Arena::MakePooled<ServerMetadata>());
+  // Pull server trailing metadata
+  auto pull_server_trailing_metadata = filters.PullServerTrailingMetadata();
+  // Should be done
+  EXPECT_THAT(pull_server_trailing_metadata(), IsReady());
+  filters.Finalize(nullptr);
+  EXPECT_THAT(steps,
+              ::testing::ElementsAre(
+                  "f1:OnClientInitialMetadata", "f2:OnClientInitialMetadata",
+                  "f1:OnClientToServerMessage", "f2:OnClientToServerMessage",
+                  "f2:OnServerInitialMetadata", "f1:OnServerInitialMetadata",
+                  "f2:OnServerToClientMessage", "f1:OnServerToClientMessage",
+                  "f2:OnServerTrailingMetadata", "f1:OnServerTrailingMetadata",
+                  "f1:OnFinalize", "f2:OnFinalize"));
+}
+
+TEST(CallFiltersTest, PushClientToServerMessageAndFinishSends) {
+  struct Filter {
+    struct Call {
+      void OnClientInitialMetadata(ClientMetadata&) {}
+      void OnServerInitialMetadata(ServerMetadata&) {}
+      void OnClientToServerMessage(Message&, Filter* f) {
+        f->steps.push_back("OnClientToServerMessage");
+      }
+      void OnClientToServerHalfClose(Filter* f) {
+        f->steps.push_back("OnClientToServerHalfClose");
+      }
+      void OnServerToClientMessage(Message&) {}
+      void OnServerTrailingMetadata(ServerMetadata&) {}
+      void OnFinalize(const grpc_call_final_info*) {}
+    };
+
+    std::vector<std::string> steps;
+  };
+  Filter f;
+  CallFilters::StackBuilder builder;
+  builder.Add(&f);
+  auto arena = SimpleArenaAllocator()->MakeArena();
+  CallFilters filters(Arena::MakePooled<ClientMetadata>());
+  filters.AddStack(builder.Build());
+  filters.Start();
+  promise_detail::Context<Arena> ctx(arena.get());
+  StrictMock<MockActivity> activity;
+  activity.Activate();
+  auto pull_client_initial_metadata = filters.PullClientInitialMetadata();
+  EXPECT_THAT(pull_client_initial_metadata(), IsReady());
+  Mock::VerifyAndClearExpectations(&activity);
+  auto push_client_to_server_message =
+      filters.PushClientToServerMessageAndFinishSends(
+          Arena::MakePooled<Message>(SliceBuffer(), 0));
+  EXPECT_THAT(push_client_to_server_message(), IsPending());
+  auto pull_client_to_server_message = filters.PullClientToServerMessage();
+  EXPECT_WAKEUP(activity,
+                EXPECT_THAT(pull_client_to_server_message(), IsReady()));
+  EXPECT_THAT(push_client_to_server_message(), IsReady(Success{}));
+  // The half close was pushed along with the message, so the next pull sees
+  // it without the client doing anything further.
+  auto pull_half_close = filters.PullClientToServerMessage();
+  auto half_close = pull_half_close();
+  ASSERT_TRUE(half_close.ready());
+  ASSERT_TRUE(half_close.value().ok());
+  EXPECT_FALSE(half_close.value()->has_value());
+  filters.PushServerTrailingMetadata(Arena::MakePooled<ServerMetadata>());
+  filters.Finalize(nullptr);
+  EXPECT_THAT(f.steps, ::testing::ElementsAre("OnClientToServerMessage",
+                                              "OnClientToServerHalfClose"));
+}
+
 TEST(CallFiltersTest, UnaryCallWithMultiStack) {
   struct Filter {
     struct Call {
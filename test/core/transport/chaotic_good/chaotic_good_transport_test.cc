@@ -0,0 +1,120 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chaotic_good/chaotic_good_transport.h"
+
+#include <utility>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/strings/string_view.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/slice.h>
+#include <grpc/grpc.h>
+
+#include "src/core/ext/transport/chaotic_good/frame.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/mpsc.h"
+#include "src/core/lib/promise/seq.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/transport/message.h"
+#include "test/core/promise/test_wakeup_schedulers.h"
+#include "test/core/transport/chaotic_good/mock_promise_endpoint.h"
+#include "test/core/transport/chaotic_good/transport_test.h"
+
+using testing::MockFunction;
+using testing::StrictMock;
+
+using EventEngineSlice = grpc_event_engine::experimental::Slice;
+
+namespace grpc_core {
+namespace chaotic_good {
+namespace testing {
+
+ClientFrame MessageFrame(uint32_t stream_id, absl::string_view payload,
+                         bool end_of_stream = false) {
+  ClientFragmentFrame frame;
+  frame.stream_id = stream_id;
+  frame.message.emplace(
+      Arena::MakePooled<Message>(
+          SliceBuffer(Slice::FromCopiedString(payload)), 0),
+      0, payload.size());
+  frame.end_of_stream = end_of_stream;
+  return frame;
+}
+
+ClientFrame CancelStream(uint32_t stream_id) {
+  CancelFrame frame;
+  frame.stream_id = stream_id;
+  return frame;
+}
+
+// The frames that the streams queue while the transport is busy all go out
+// in the next write: one write of their headers to the control endpoint and
+// one of their messages to the data endpoint, each in the order in which the
+// frames were queued.
+TEST_F(TransportTest, QueuedFramesGoOutInOneWriteInOrder) {
+  ExecCtx exec_ctx;
+  MockPromiseEndpoint control_endpoint;
+  MockPromiseEndpoint data_endpoint;
+  auto transport = MakeRefCounted<ChaoticGoodTransport>(
+      std::move(control_endpoint.promise_endpoint),
+      OneDataEndpoint(std::move(data_endpoint.promise_endpoint)),
+      HPackParser(), HPackCompressor(), ChaoticGoodTransport::Options());
+  MpscReceiver<ClientFrame> outgoing_frames(8);
+  MpscSender<ClientFrame> stream1 = outgoing_frames.MakeSender();
+  MpscSender<ClientFrame> stream2 = outgoing_frames.MakeSender();
+  ASSERT_TRUE(stream1.UnbufferedImmediateSend(MessageFrame(1, "abc")));
+  ASSERT_TRUE(stream2.UnbufferedImmediateSend(MessageFrame(2, "de")));
+  ASSERT_TRUE(stream2.UnbufferedImmediateSend(CancelStream(2)));
+  ASSERT_TRUE(stream1.UnbufferedImmediateSend(
+      MessageFrame(1, "fghi", /*end_of_stream=*/true)));
+  control_endpoint.ExpectWrite(
+      {SerializedFrameHeader(FrameType::kFragment, 2, 1, 0, 3, 0, 0),
+       SerializedFrameHeader(FrameType::kFragment, 2, 2, 0, 2, 0, 0),
+       SerializedFrameHeader(FrameType::kCancel, 0, 2, 0, 0, 0, 0),
+       SerializedFrameHeader(FrameType::kFragment, 6, 1, 0, 4, 0, 0)},
+      nullptr);
+  data_endpoint.ExpectWrite({EventEngineSlice::FromCopiedString("abc"),
+                             EventEngineSlice::FromCopiedString("de"),
+                             EventEngineSlice::FromCopiedString("fghi")},
+                            nullptr);
+  StrictMock<MockFunction<void(absl::Status)>> on_done;
+  EXPECT_CALL(on_done, Call(absl::OkStatus()));
+  auto activity = MakeActivity(
+      Seq(transport->NextFrames(outgoing_frames),
+          [transport](std::vector<ClientFrame> frames) {
+            EXPECT_EQ(frames.size(), 4u);
+            return transport->WriteFrames(std::move(frames));
+          }),
+      InlineWakeupScheduler(),
+      [&on_done](absl::Status status) { on_done.Call(std::move(status)); });
+}
+
+}  // namespace testing
+}  // namespace chaotic_good
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  // Must call to create default EventEngine.
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
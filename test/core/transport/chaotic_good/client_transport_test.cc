@@ -279,6 +279,102 @@ TEST_F(TransportTest, AddOneStreamMultipleMessages) {
   event_engine()->UnsetGlobalHooks();
 }
 
+TEST_F(TransportTest, AddOneStreamStripedMessages) {
+  MockPromiseEndpoint control_endpoint;
+  MockPromiseEndpoint data_endpoint0;
+  MockPromiseEndpoint data_endpoint1;
+  control_endpoint.ExpectRead(
+      {SerializedFrameHeader(FrameType::kFragment, 3, 1, 26, 8, 56, 0, 1),
+       EventEngineSlice::FromCopiedBuffer(kPathDemoServiceStep,
+                                          sizeof(kPathDemoServiceStep))},
+      event_engine().get());
+  control_endpoint.ExpectRead(
+      {SerializedFrameHeader(FrameType::kFragment, 6, 1, 0, 8, 56, 15, 0),
+       EventEngineSlice::FromCopiedBuffer(kGrpcStatus0, sizeof(kGrpcStatus0))},
+      event_engine().get());
+  data_endpoint1.ExpectRead(
+      {EventEngineSlice::FromCopiedString("12345678"), Zeros(56)}, nullptr);
+  data_endpoint0.ExpectRead(
+      {EventEngineSlice::FromCopiedString("87654321"), Zeros(56)}, nullptr);
+  EXPECT_CALL(*control_endpoint.endpoint, Read)
+      .InSequence(control_endpoint.read_sequence)
+      .WillOnce(Return(false));
+  std::vector<PromiseEndpoint> data_endpoints;
+  data_endpoints.push_back(std::move(data_endpoint0.promise_endpoint));
+  data_endpoints.push_back(std::move(data_endpoint1.promise_endpoint));
+  auto transport = MakeOrphanable<ChaoticGoodClientTransport>(
+      std::move(control_endpoint.promise_endpoint), std::move(data_endpoints),
+      MakeChannelArgs(), event_engine(), HPackParser(), HPackCompressor());
+  auto call = MakeCall(TestInitialMetadata());
+  transport->StartCall(call.handler.StartCall());
+  StrictMock<MockFunction<void()>> on_done;
+  EXPECT_CALL(on_done, Call());
+  control_endpoint.ExpectWrite(
+      {SerializedFrameHeader(FrameType::kFragment, 1, 1,
+                             sizeof(kPathDemoServiceStep), 0, 0, 0),
+       EventEngineSlice::FromCopiedBuffer(kPathDemoServiceStep,
+                                          sizeof(kPathDemoServiceStep))},
+      nullptr);
+  // The first message stays in flight on the first data endpoint, so the
+  // second one goes to the other data endpoint.
+  control_endpoint.ExpectWrite(
+      {SerializedFrameHeader(FrameType::kFragment, 2, 1, 0, 1, 63, 0, 0)},
+      nullptr);
+  EXPECT_CALL(*data_endpoint0.endpoint, Write).WillOnce(Return(false));
+  control_endpoint.ExpectWrite(
+      {SerializedFrameHeader(FrameType::kFragment, 2, 1, 0, 1, 63, 0, 1)},
+      nullptr);
+  data_endpoint1.ExpectWrite(
+      {EventEngineSlice::FromCopiedString("1"), Zeros(63)}, nullptr);
+  control_endpoint.ExpectWrite(
+      {SerializedFrameHeader(FrameType::kFragment, 4, 1, 0, 0, 0, 0)}, nullptr);
+  call.initiator.SpawnGuarded("test-send",
+                              [initiator = call.initiator]() mutable {
+                                return SendClientToServerMessages(initiator, 2);
+                              });
+  call.initiator.SpawnInfallible(
+      "test-read", [&on_done, initiator = call.initiator]() mutable {
+        return Seq(
+            initiator.PullServerInitialMetadata(),
+            [](ValueOrFailure<absl::optional<ServerMetadataHandle>> md) {
+              EXPECT_TRUE(md.ok());
+              EXPECT_TRUE(md.value().has_value());
+              return Empty{};
+            },
+            initiator.PullMessage(),
+            [](ValueOrFailure<absl::optional<MessageHandle>> msg) {
+              EXPECT_TRUE(msg.ok());
+              EXPECT_TRUE(msg.value().has_value());
+              EXPECT_EQ(msg.value().value()->payload()->JoinIntoString(),
+                        "12345678");
+              return Empty{};
+            },
+            initiator.PullMessage(),
+            [](ValueOrFailure<absl::optional<MessageHandle>> msg) {
+              EXPECT_TRUE(msg.ok());
+              EXPECT_TRUE(msg.value().has_value());
+              EXPECT_EQ(msg.value().value()->payload()->JoinIntoString(),
+                        "87654321");
+              return Empty{};
+            },
+            initiator.PullMessage(),
+            [](ValueOrFailure<absl::optional<MessageHandle>> msg) {
+              EXPECT_TRUE(msg.ok());
+              EXPECT_FALSE(msg.value().has_value());
+              return Empty{};
+            },
+            initiator.PullServerTrailingMetadata(),
+            [&on_done](ServerMetadataHandle md) {
+              EXPECT_EQ(md->get(GrpcStatusMetadata()).value(), GRPC_STATUS_OK);
+              on_done.Call();
+              return Empty{};
+            });
+      });
+  // Wait until ClientTransport's internal activities to finish.
+  event_engine()->TickUntilIdle();
+  event_engine()->UnsetGlobalHooks();
+}
+
 }  // namespace testing
 }  // namespace chaotic_good
 }  // namespace grpc_core
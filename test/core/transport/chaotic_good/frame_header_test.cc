@@ -73,6 +73,27 @@ TEST(FrameHeaderTest, SimpleDeserialize) {
             absl::InvalidArgumentError("Invalid flags"));
 }
 
+TEST(FrameHeaderTest, DataConnection) {
+  FrameHeader header{FrameType::kFragment, BitSet<3>::FromInt(2), 1, 0, 8, 56,
+                     0};
+  header.data_connection = 3;
+  EXPECT_EQ(Serialize(header),
+            std::vector<uint8_t>({
+                0x80, 0x02, 0,    0x03,  // type, flags, data_connection
+                0x01, 0x00, 0x00, 0x00,  // stream_id
+                0x00, 0x00, 0x00, 0x00,  // header_length
+                0x08, 0x00, 0x00, 0x00,  // message_length
+                0x38, 0x00, 0x00, 0x00,  // mesage_padding
+                0x00, 0x00, 0x00, 0x00   // trailer_length
+            }));
+  EXPECT_EQ(Deserialize(Serialize(header)),
+            absl::StatusOr<FrameHeader>(header));
+  std::vector<uint8_t> serialized = Serialize(header);
+  FrameHeader::SetDataConnection(7, serialized.data());
+  header.data_connection = 7;
+  EXPECT_EQ(Deserialize(serialized), absl::StatusOr<FrameHeader>(header));
+}
+
 TEST(FrameHeaderTest, GetFrameLength) {
   EXPECT_EQ(
       (FrameHeader{FrameType::kFragment, BitSet<3>::FromInt(5), 1, 0, 0, 0, 0})
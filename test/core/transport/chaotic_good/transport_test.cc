@@ -20,12 +20,12 @@ namespace testing {
 
 grpc_event_engine::experimental::Slice SerializedFrameHeader(
     FrameType type, uint8_t flags, uint32_t stream_id, uint32_t header_length,
-    uint32_t message_length, uint32_t message_padding,
-    uint32_t trailer_length) {
+    uint32_t message_length, uint32_t message_padding, uint32_t trailer_length,
+    uint8_t data_connection) {
   uint8_t buffer[24] = {static_cast<uint8_t>(type),
                         flags,
                         0,
-                        0,
+                        data_connection,
                         static_cast<uint8_t>(stream_id),
                         static_cast<uint8_t>(stream_id >> 8),
                         static_cast<uint8_t>(stream_id >> 16),
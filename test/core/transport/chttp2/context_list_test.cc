@@ -0,0 +1,176 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/context_list_entry.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/time/time.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include <grpc/support/time.h>
+
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/lib/iomgr/buffer_list.h"
+#include "src/core/telemetry/tcp_tracer.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+class FakeTcpTracer : public TcpTracerInterface {
+ public:
+  struct Event {
+    Type type;
+    absl::Time time;
+    size_t byte_offset;
+  };
+
+  void RecordEvent(Type type, absl::Time time, size_t byte_offset,
+                   absl::optional<ConnectionMetrics> /*metrics*/) override {
+    events_.push_back({type, time, byte_offset});
+  }
+
+  const std::vector<Event>& events() const { return events_; }
+
+ private:
+  std::vector<Event> events_;
+};
+
+struct WriteTimestampsCall {
+  void* context;
+  uint32_t byte_offset;
+};
+
+std::vector<WriteTimestampsCall>* g_write_timestamps_calls;
+
+void RecordWriteTimestamps(void* context, Timestamps* ts,
+                           grpc_error_handle /*error*/) {
+  g_write_timestamps_calls->push_back(
+      {context, ts == nullptr ? 0 : ts->byte_offset});
+}
+
+gpr_timespec RealtimeSeconds(int64_t seconds) {
+  return gpr_time_from_seconds(seconds, GPR_CLOCK_REALTIME);
+}
+
+class ContextListTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    g_write_timestamps_calls = &write_timestamps_calls_;
+    GrpcHttp2SetWriteTimestampsCallback(RecordWriteTimestamps);
+  }
+
+  void TearDown() override {
+    GrpcHttp2SetWriteTimestampsCallback(nullptr);
+    g_write_timestamps_calls = nullptr;
+  }
+
+  std::vector<WriteTimestampsCall> write_timestamps_calls_;
+};
+
+// The TCP tracer of each chunk gets the timestamps that were collected, in
+// the order the events happened, at the chunk's offset in its stream.
+TEST_F(ContextListTest, TimestampsAreRecordedOnTcpTracers) {
+  auto tcp_tracer1 = std::make_shared<FakeTcpTracer>();
+  auto tcp_tracer2 = std::make_shared<FakeTcpTracer>();
+  auto* context_list = new ContextList();
+  context_list->emplace_back(/*context=*/nullptr, /*outbuf_offset=*/0,
+                             /*num_traced_bytes=*/10, /*byte_offset=*/100,
+                             /*stream_index=*/0, tcp_tracer1);
+  context_list->emplace_back(/*context=*/nullptr, /*outbuf_offset=*/10,
+                             /*num_traced_bytes=*/20, /*byte_offset=*/200,
+                             /*stream_index=*/1, tcp_tracer2);
+  Timestamps ts;
+  ts.sendmsg_time.time = RealtimeSeconds(1);
+  // Not collected, e.g. because the packet skipped the qdisc.
+  ts.scheduled_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
+  ts.sent_time.time = RealtimeSeconds(2);
+  ts.acked_time.time = RealtimeSeconds(3);
+  ForEachContextListEntryExecute(context_list, &ts, absl::OkStatus());
+  for (const auto& tracer_and_offset :
+       {std::make_pair(tcp_tracer1.get(), size_t{100}),
+        std::make_pair(tcp_tracer2.get(), size_t{200})}) {
+    const auto& events = tracer_and_offset.first->events();
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[0].type, TcpTracerInterface::Type::kSendMsg);
+    EXPECT_EQ(events[0].time, absl::FromUnixSeconds(1));
+    EXPECT_EQ(events[1].type, TcpTracerInterface::Type::kSent);
+    EXPECT_EQ(events[1].time, absl::FromUnixSeconds(2));
+    EXPECT_EQ(events[2].type, TcpTracerInterface::Type::kAcked);
+    EXPECT_EQ(events[2].time, absl::FromUnixSeconds(3));
+    for (const auto& event : events) {
+      EXPECT_EQ(event.byte_offset, tracer_and_offset.second);
+    }
+  }
+  // None of the chunks had a trace context.
+  EXPECT_TRUE(write_timestamps_calls_.empty());
+}
+
+// The write timestamps callback only sees the chunks of traced streams, and
+// the TCP tracers only those of streams that have one.
+TEST_F(ContextListTest, WriteTimestampsCallbackOnlySeesTracedChunks) {
+  int trace_context;
+  auto tcp_tracer = std::make_shared<FakeTcpTracer>();
+  auto* context_list = new ContextList();
+  context_list->emplace_back(&trace_context, /*outbuf_offset=*/0,
+                             /*num_traced_bytes=*/10, /*byte_offset=*/100,
+                             /*stream_index=*/0, /*tcp_tracer=*/nullptr);
+  context_list->emplace_back(/*context=*/nullptr, /*outbuf_offset=*/10,
+                             /*num_traced_bytes=*/20, /*byte_offset=*/200,
+                             /*stream_index=*/0, tcp_tracer);
+  Timestamps ts;
+  ts.sendmsg_time.time = RealtimeSeconds(1);
+  ts.scheduled_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
+  ts.sent_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
+  ts.acked_time.time = gpr_inf_past(GPR_CLOCK_REALTIME);
+  ForEachContextListEntryExecute(context_list, &ts, absl::OkStatus());
+  ASSERT_EQ(write_timestamps_calls_.size(), 1u);
+  EXPECT_EQ(write_timestamps_calls_[0].context, &trace_context);
+  EXPECT_EQ(write_timestamps_calls_[0].byte_offset, 100u);
+  ASSERT_EQ(tcp_tracer->events().size(), 1u);
+  EXPECT_EQ(tcp_tracer->events()[0].type, TcpTracerInterface::Type::kSendMsg);
+  EXPECT_EQ(tcp_tracer->events()[0].byte_offset, 200u);
+}
+
+// When the write failed before any timestamps were collected, the traced
+// streams still hear about it, but there is nothing to record.
+TEST_F(ContextListTest, NoTimestampsAreRecordedWithoutTimestamps) {
+  int trace_context;
+  auto tcp_tracer = std::make_shared<FakeTcpTracer>();
+  auto* context_list = new ContextList();
+  context_list->emplace_back(&trace_context, /*outbuf_offset=*/0,
+                             /*num_traced_bytes=*/10, /*byte_offset=*/100,
+                             /*stream_index=*/0, tcp_tracer);
+  ForEachContextListEntryExecute(context_list, /*ts=*/nullptr,
+                                 absl::UnavailableError("write failed"));
+  EXPECT_TRUE(tcp_tracer->events().empty());
+  ASSERT_EQ(write_timestamps_calls_.size(), 1u);
+  EXPECT_EQ(write_timestamps_calls_[0].context, &trace_context);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
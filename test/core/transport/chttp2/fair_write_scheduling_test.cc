@@ -0,0 +1,177 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/transport.h"
+#include "test/core/test_util/mock_endpoint.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+class FairWriteSchedulingTest : public ::testing::Test {
+ protected:
+  FairWriteSchedulingTest() {
+    auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+    mock_endpoint_controller_ =
+        grpc_event_engine::experimental::MockEndpointController::Create(engine);
+    mock_endpoint_controller_->NoMoreReads();
+    args_ = args_.SetObject(ResourceQuota::Default());
+    args_ = args_.SetObject(std::move(engine));
+    GRPC_STREAM_REF_INIT(&refcount_, 1, nullptr, nullptr, "test");
+  }
+
+  ~FairWriteSchedulingTest() override {
+    ExecCtx exec_ctx;
+    for (grpc_chttp2_stream* s : streams_) {
+      // Never opened on the wire, so nothing is left to close.
+      s->write_closed = true;
+      s->read_closed = true;
+      s->destroy_stream_arg = nullptr;
+      delete s;
+    }
+    if (t_ != nullptr) t_->Orphan();
+  }
+
+  void CreateTransport() {
+    ExecCtx exec_ctx;
+    t_ = reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+        args_,
+        OrphanablePtr<grpc_endpoint>(
+            mock_endpoint_controller_->TakeCEndpoint()),
+        /*is_client=*/true));
+  }
+
+  // Creates a stream with pending_bytes of DATA waiting to be written.
+  grpc_chttp2_stream* CreateStream(size_t pending_bytes) {
+    auto* s = new grpc_chttp2_stream(t_, &refcount_, nullptr, arena_.get());
+    s->id = 2 * streams_.size() + 1;
+    grpc_slice_buffer_add(&s->flow_controlled_buffer,
+                          grpc_slice_malloc(pending_bytes));
+    streams_.push_back(s);
+    return s;
+  }
+
+  // Pops every writable stream and returns them in the order they came out.
+  std::vector<grpc_chttp2_stream*> PopAll() {
+    std::vector<grpc_chttp2_stream*> popped;
+    grpc_chttp2_stream* s;
+    while (grpc_chttp2_list_pop_writable_stream(t_, &s)) popped.push_back(s);
+    return popped;
+  }
+
+  std::shared_ptr<grpc_event_engine::experimental::MockEndpointController>
+      mock_endpoint_controller_;
+  ChannelArgs args_;
+  RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+  grpc_stream_refcount refcount_;
+  grpc_chttp2_transport* t_ = nullptr;
+  std::vector<grpc_chttp2_stream*> streams_;
+};
+
+TEST_F(FairWriteSchedulingTest, DisabledByDefault) {
+  CreateTransport();
+  EXPECT_EQ(t_->write_scheduler_quantum, 0u);
+  // Writable streams are served in the order they became writable.
+  grpc_chttp2_stream* bulk = CreateStream(100000);
+  grpc_chttp2_stream* small = CreateStream(10);
+  EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t_, bulk));
+  EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t_, small));
+  EXPECT_EQ(PopAll(), (std::vector<grpc_chttp2_stream*>{bulk, small}));
+}
+
+TEST_F(FairWriteSchedulingTest, QuantumDefaultsTo16KiB) {
+  args_ = args_.Set("grpc.http2.fair_write_scheduling", true);
+  CreateTransport();
+  EXPECT_EQ(t_->write_scheduler_quantum, 16384u);
+}
+
+TEST_F(FairWriteSchedulingTest, SmallStreamsAreServedFirst) {
+  args_ = args_.Set("grpc.http2.fair_write_scheduling", true)
+              .Set("grpc.http2.write_scheduler_quantum_bytes", 100);
+  CreateTransport();
+  EXPECT_EQ(t_->write_scheduler_quantum, 100u);
+  grpc_chttp2_stream* bulk = CreateStream(101);
+  grpc_chttp2_stream* small = CreateStream(100);
+  EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t_, bulk));
+  EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t_, small));
+  // Already queued, whichever lane it is in.
+  EXPECT_FALSE(grpc_chttp2_list_add_writable_stream(t_, bulk));
+  EXPECT_FALSE(grpc_chttp2_list_add_writable_stream(t_, small));
+  EXPECT_EQ(PopAll(), (std::vector<grpc_chttp2_stream*>{small, bulk}));
+}
+
+TEST_F(FairWriteSchedulingTest, BulkStreamsAreNotStarved) {
+  args_ = args_.Set("grpc.http2.fair_write_scheduling", true)
+              .Set("grpc.http2.write_scheduler_quantum_bytes", 100);
+  CreateTransport();
+  grpc_chttp2_stream* bulk = CreateStream(1000);
+  EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t_, bulk));
+  std::vector<grpc_chttp2_stream*> small;
+  for (int i = 0; i < 10; ++i) {
+    small.push_back(CreateStream(10));
+    EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t_, small.back()));
+  }
+  // Eight streams from the fast lane, then the bulk stream gets its turn.
+  std::vector<grpc_chttp2_stream*> expected(small.begin(), small.begin() + 8);
+  expected.push_back(bulk);
+  expected.push_back(small[8]);
+  expected.push_back(small[9]);
+  EXPECT_EQ(PopAll(), expected);
+}
+
+TEST_F(FairWriteSchedulingTest, RemovedStreamsLeaveEitherLane) {
+  args_ = args_.Set("grpc.http2.fair_write_scheduling", true)
+              .Set("grpc.http2.write_scheduler_quantum_bytes", 100);
+  CreateTransport();
+  grpc_chttp2_stream* bulk = CreateStream(1000);
+  grpc_chttp2_stream* small = CreateStream(10);
+  EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t_, bulk));
+  EXPECT_TRUE(grpc_chttp2_list_add_writable_stream(t_, small));
+  EXPECT_TRUE(grpc_chttp2_list_remove_writable_stream(t_, small));
+  EXPECT_TRUE(grpc_chttp2_list_remove_writable_stream(t_, bulk));
+  EXPECT_FALSE(grpc_chttp2_list_remove_writable_stream(t_, bulk));
+  EXPECT_TRUE(PopAll().empty());
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
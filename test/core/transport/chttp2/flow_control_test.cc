@@ -14,6 +14,7 @@
 
 #include "src/core/ext/transport/chttp2/transport/flow_control.h"
 
+#include <limits>
 #include <memory>
 #include <tuple>
 
@@ -264,6 +265,41 @@ TEST_F(FlowControlTest, GradualReadsUpdate) {
   EXPECT_EQ(immediate_updates + queued_updates, 65535);
 }
 
+TEST_F(FlowControlTest, ReadRateWindowBoundsSlowStreams) {
+  ExecCtx exec_ctx;
+  TransportFlowControl tfc("test", true, &memory_owner_);
+  tfc.SetReadRateStreamWindows(true);
+  std::ignore = tfc.SetAckedInitialWindow(1024 * 1024);
+  StreamFlowControl sfc(&tfc);
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    EXPECT_EQ(sfc_upd.RecvData(60000), absl::OkStatus());
+    sfc_upd.SetPendingSize(60000);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_EQ(sfc.read_rate_window(), std::numeric_limits<int64_t>::max());
+  // The application reads 10000 bytes in a second: the stream keeps no more
+  // than the minimum read rate window in flight and buffered, so nothing is
+  // announced for what it read.
+  AdvanceClockMillis(1000);
+  exec_ctx.InvalidateNow();
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    sfc_upd.SetPendingSize(50000);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_EQ(sfc.read_rate_window(), 65535);
+  EXPECT_EQ(sfc.DesiredAnnounceSize(), 0);
+  // Once it has caught up, the stream window is no longer bounded.
+  {
+    StreamFlowControl::IncomingUpdateContext sfc_upd(&sfc);
+    sfc_upd.SetPendingSize(0);
+    std::ignore = sfc_upd.MakeAction();
+  }
+  EXPECT_EQ(sfc.read_rate_window(), std::numeric_limits<int64_t>::max());
+  EXPECT_EQ(sfc.DesiredAnnounceSize(), 60000);
+}
+
 }  // namespace chttp2
 }  // namespace grpc_core
 
@@ -0,0 +1,192 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/frame_data.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
+#include "src/core/lib/transport/transport.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "test/core/test_util/mock_endpoint.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Returns the gRPC message framing for a payload of the given length.
+std::string MessageHeader(uint32_t length) {
+  std::string header(5, '\0');
+  header[1] = static_cast<char>(length >> 24);
+  header[2] = static_cast<char>(length >> 16);
+  header[3] = static_cast<char>(length >> 8);
+  header[4] = static_cast<char>(length);
+  return header;
+}
+
+bool PointsInto(const grpc_slice& piece, const grpc_slice& read) {
+  const uint8_t* start = GRPC_SLICE_START_PTR(read);
+  return piece.refcount != nullptr && GRPC_SLICE_START_PTR(piece) >= start &&
+         GRPC_SLICE_END_PTR(piece) <= start + GRPC_SLICE_LENGTH(read);
+}
+
+class FrameDataTest : public ::testing::Test {
+ protected:
+  FrameDataTest() {
+    auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+    mock_endpoint_controller_ =
+        grpc_event_engine::experimental::MockEndpointController::Create(engine);
+    mock_endpoint_controller_->NoMoreReads();
+    ChannelArgs args = ChannelArgs()
+                           .SetObject(ResourceQuota::Default())
+                           .SetObject(std::move(engine));
+    GRPC_STREAM_REF_INIT(&refcount_, 1, nullptr, nullptr, "test");
+    ExecCtx exec_ctx;
+    t_ = reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+        args,
+        OrphanablePtr<grpc_endpoint>(
+            mock_endpoint_controller_->TakeCEndpoint()),
+        /*is_client=*/true));
+    s_ = new grpc_chttp2_stream(t_, &refcount_, nullptr, arena_.get());
+    s_->id = 1;
+  }
+
+  ~FrameDataTest() override {
+    ExecCtx exec_ctx;
+    // Never opened on the wire, so nothing is left to close.
+    s_->write_closed = true;
+    s_->read_closed = true;
+    s_->destroy_stream_arg = nullptr;
+    delete s_;
+    t_->Orphan();
+  }
+
+  // Appends bytes to the stream as one refcounted slice, the way the
+  // endpoint reads them, and keeps a ref to that slice for the checks.
+  grpc_slice Read(const std::string& bytes) {
+    grpc_slice slice = grpc_slice_malloc_large(bytes.size());
+    memcpy(GRPC_SLICE_START_PTR(slice), bytes.data(), bytes.size());
+    reads_.emplace_back(slice);
+    grpc_slice_buffer_add(&s_->frame_storage, reads_.back().Ref().TakeCSlice());
+    return slice;
+  }
+
+  // Deframes the next message into out.
+  bool Deframe(SliceBuffer* out) {
+    auto result = grpc_deframe_unprocessed_incoming_frames(
+        s_, /*min_progress_size=*/nullptr, out, /*message_flags=*/nullptr);
+    return result.ready() && result.value().ok();
+  }
+
+  std::shared_ptr<grpc_event_engine::experimental::MockEndpointController>
+      mock_endpoint_controller_;
+  RefCountedPtr<Arena> arena_ = SimpleArenaAllocator()->MakeArena();
+  grpc_stream_refcount refcount_;
+  grpc_chttp2_transport* t_;
+  grpc_chttp2_stream* s_;
+  std::vector<Slice> reads_;
+};
+
+// Messages much shorter than the inline slice size, all in one read: the
+// pieces after the first message boundary must not be copied either.
+TEST_F(FrameDataTest, SmallMessagesInOneReadAreReferenced) {
+  auto before = global_stats().Collect();
+  std::string bytes;
+  for (char c : {'a', 'b', 'c'}) {
+    bytes += MessageHeader(4) + std::string(4, c);
+  }
+  const grpc_slice read = Read(bytes);
+  for (char c : {'a', 'b', 'c'}) {
+    SliceBuffer out;
+    ASSERT_TRUE(Deframe(&out));
+    EXPECT_EQ(out.JoinIntoString(), std::string(4, c));
+    for (size_t i = 0; i < out.Count(); i++) {
+      EXPECT_TRUE(PointsInto(out.c_slice_at(i), read));
+    }
+  }
+  EXPECT_EQ(s_->frame_storage.length, 0u);
+  EXPECT_EQ(
+      global_stats().Collect()->Diff(*before)->http2_recv_data_copied_slices,
+      0u);
+}
+
+// A message whose start and end fall part way into two reads is made of
+// references into both.
+TEST_F(FrameDataTest, MessageSpanningReadsIsReferenced) {
+  auto before = global_stats().Collect();
+  const std::string first = MessageHeader(2) + "xy" + MessageHeader(6) + "012";
+  const std::string second = "345" + MessageHeader(1) + "z";
+  const grpc_slice read1 = Read(first);
+  const grpc_slice read2 = Read(second);
+  SliceBuffer out;
+  ASSERT_TRUE(Deframe(&out));
+  EXPECT_EQ(out.JoinIntoString(), "xy");
+  out.Clear();
+  ASSERT_TRUE(Deframe(&out));
+  EXPECT_EQ(out.JoinIntoString(), "012345");
+  ASSERT_EQ(out.Count(), 2u);
+  EXPECT_TRUE(PointsInto(out.c_slice_at(0), read1));
+  EXPECT_TRUE(PointsInto(out.c_slice_at(1), read2));
+  out.Clear();
+  ASSERT_TRUE(Deframe(&out));
+  EXPECT_EQ(out.JoinIntoString(), "z");
+  EXPECT_TRUE(PointsInto(out.c_slice_at(0), read2));
+  EXPECT_EQ(
+      global_stats().Collect()->Diff(*before)->http2_recv_data_copied_slices,
+      0u);
+}
+
+TEST_F(FrameDataTest, IncompleteMessageIsPending) {
+  Read(MessageHeader(8) + "0123");
+  int64_t min_progress_size;
+  SliceBuffer out;
+  EXPECT_TRUE(grpc_deframe_unprocessed_incoming_frames(
+                  s_, &min_progress_size, &out, /*message_flags=*/nullptr)
+                  .pending());
+  EXPECT_EQ(min_progress_size, 4);
+  EXPECT_EQ(out.Length(), 0u);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
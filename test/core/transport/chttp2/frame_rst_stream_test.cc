@@ -0,0 +1,98 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/frame_rst_stream.h"
+
+#include <stdint.h>
+
+#include <string>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/status.h>
+
+#include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/transport/error_utils.h"
+#include "src/core/lib/transport/http2_errors.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+void ExpectRstStreamError(uint32_t reason) {
+  grpc_error_handle error = grpc_chttp2_rst_stream_error(reason);
+  EXPECT_FALSE(error.ok());
+  intptr_t http2_error;
+  ASSERT_TRUE(
+      grpc_error_get_int(error, StatusIntProperty::kHttp2Error, &http2_error));
+  EXPECT_EQ(http2_error, static_cast<intptr_t>(reason));
+  std::string message;
+  ASSERT_TRUE(
+      grpc_error_get_str(error, StatusStrProperty::kGrpcMessage, &message));
+  EXPECT_EQ(message,
+            absl::StrCat("Received RST_STREAM with error code ", reason));
+}
+
+grpc_status_code StatusOfRstStream(uint32_t reason) {
+  grpc_status_code code;
+  grpc_error_get_status(grpc_chttp2_rst_stream_error(reason),
+                        Timestamp::InfFuture(), &code, nullptr, nullptr,
+                        nullptr);
+  return code;
+}
+
+// Standard codes get a shared error, others one of their own: both must
+// carry the code the peer sent.
+TEST(RstStreamErrorTest, CarriesTheResetCode) {
+  for (uint32_t reason :
+       {uint32_t{GRPC_HTTP2_NO_ERROR}, uint32_t{GRPC_HTTP2_REFUSED_STREAM},
+        uint32_t{GRPC_HTTP2_CANCEL}, uint32_t{GRPC_HTTP2_INADEQUATE_SECURITY},
+        uint32_t{0x1234}}) {
+    ExpectRstStreamError(reason);
+  }
+}
+
+TEST(RstStreamErrorTest, CarriesTheResetCodeWithCallErrorTracing) {
+  grpc_tracer_set_enabled("call_error", 1);
+  ASSERT_TRUE(grpc_error_detail_enabled());
+  ExpectRstStreamError(GRPC_HTTP2_CANCEL);
+  ExpectRstStreamError(0x1234);
+  grpc_tracer_set_enabled("call_error", 0);
+}
+
+TEST(RstStreamErrorTest, MapsToTheStatusOfTheResetCode) {
+  EXPECT_EQ(StatusOfRstStream(GRPC_HTTP2_CANCEL), GRPC_STATUS_CANCELLED);
+  EXPECT_EQ(StatusOfRstStream(GRPC_HTTP2_REFUSED_STREAM),
+            GRPC_STATUS_UNAVAILABLE);
+  EXPECT_EQ(StatusOfRstStream(GRPC_HTTP2_ENHANCE_YOUR_CALM),
+            GRPC_STATUS_RESOURCE_EXHAUSTED);
+  // The same status each time the shared error is handed out.
+  EXPECT_EQ(StatusOfRstStream(GRPC_HTTP2_CANCEL), GRPC_STATUS_CANCELLED);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
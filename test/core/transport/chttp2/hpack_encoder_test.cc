@@ -25,6 +25,7 @@
 #include <string>
 
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -415,6 +416,88 @@ TEST(HpackEncoderTest, EncodeBinaryAsTrueBinary) {
   EXPECT_EQ(compressor.test_only_table_size(), 114);
 }
 
+TEST(HpackEncoderTest, AdaptiveIndexing) {
+  using Mode = grpc_core::hpack_encoder_detail::AdaptiveIndexer::Mode;
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_core::HPackCompressor compressor;
+  compressor.SetAdaptiveIndexing(true);
+  for (uint32_t i = 0;
+       i < grpc_core::hpack_encoder_detail::AdaptiveIndexer::kSampleWindow * 2;
+       i++) {
+    grpc_metadata_batch b;
+    // Low cardinality: should end up indexed.
+    b.Append("x-tenant", grpc_core::Slice::FromCopiedString(i % 2 ? "a" : "b"),
+             CrashOnAppendError);
+    // Unique per request: should end up never indexed.
+    b.Append("x-request-id",
+             grpc_core::Slice::FromCopiedString(absl::StrCat("req-", i)),
+             CrashOnAppendError);
+    // Mostly unique with occasional repeats: literals without indexing.
+    b.Append("x-span",
+             grpc_core::Slice::FromCopiedString(
+                 absl::StrCat("span-", i % 5 == 0 ? 0 : i)),
+             CrashOnAppendError);
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&output);
+    compressor.EncodeHeaders(
+        grpc_core::HPackCompressor::EncodeHeaderOptions{
+            0xdeadbeef, false, false, 16384, &call_tracer},
+        b, &output);
+    verify_frames(output, false);
+    grpc_slice_buffer_destroy(&output);
+  }
+  const auto& indexer = compressor.adaptive_indexer();
+  EXPECT_EQ(indexer.ModeForKey("x-tenant"), Mode::kIndexed);
+  EXPECT_EQ(indexer.ModeForKey("x-request-id"), Mode::kNeverIndexed);
+  EXPECT_EQ(indexer.ModeForKey("x-span"), Mode::kNotIndexed);
+  // Only the two tenant values occupy the dynamic table.
+  EXPECT_EQ(indexer.stats().dynamic_table_inserts, 2);
+  EXPECT_GT(indexer.stats().dynamic_table_hits, 0);
+  EXPECT_EQ(compressor.test_only_table_size(),
+            2 * (strlen("x-tenant") + 1 + 32));
+}
+
+TEST(HpackEncoderTest, HeaderBlockCache) {
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_core::HPackCompressor compressor;
+  compressor.SetHeaderBlockCaching(true);
+  auto encode = [&](absl::string_view server) {
+    grpc_metadata_batch b;
+    b.Set(grpc_core::ContentTypeMetadata(),
+          grpc_core::ContentTypeMetadata::kApplicationGrpc);
+    b.Append("server", grpc_core::Slice::FromCopiedString(server),
+             CrashOnAppendError);
+    grpc_slice_buffer output;
+    grpc_slice_buffer_init(&output);
+    compressor.EncodeHeaders(
+        grpc_core::HPackCompressor::EncodeHeaderOptions{1, false, false, 16384,
+                                                        &call_tracer},
+        b, &output);
+    verify_frames(output, false);
+    std::string result =
+        grpc_core::SliceBuffer(grpc_core::Slice(grpc_slice_merge(
+                                   output.slices, output.count)))
+            .JoinIntoString();
+    grpc_slice_buffer_destroy(&output);
+    return result;
+  };
+  // The first block indexes content-type, so it is not cached.
+  const std::string first = encode("a");
+  const std::string second = encode("a");
+  EXPECT_EQ(compressor.header_block_cache().hits(), 0);
+  // Nothing changed the table since: repeats are served from the cache, and
+  // are identical to a fresh encoding.
+  EXPECT_EQ(encode("a"), second);
+  EXPECT_EQ(encode("a"), second);
+  EXPECT_EQ(compressor.header_block_cache().hits(), 2);
+  // Different values are cached separately.
+  const std::string other = encode("b");
+  EXPECT_NE(other, second);
+  EXPECT_EQ(encode("b"), other);
+  EXPECT_EQ(compressor.header_block_cache().hits(), 3);
+  EXPECT_NE(first, second);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -696,6 +696,15 @@ INSTANTIATE_TEST_SUITE_P(
                 {"c0", absl::InternalError("Invalid HPACK index received"),
                  kFailureIsConnectionError},
             }},
+        Test{"IndexedRun",
+             {},
+             {},
+             {{"400361626303646566", "abc: def\n", 0},
+              // Static and dynamic indexed fields only.
+              {"82be", ":method: GET\nabc: def\n", 0},
+              // A run ending in an unknown index still reports it.
+              {"82bec8", absl::InternalError("Invalid HPACK index received"),
+               kFailureIsConnectionError}}},
         Test{"SingleByte7a", {}, {}, {{"7a", "", 0}}},
         Test{"SingleByte60",
              {},
@@ -0,0 +1,60 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/ext/transport/chttp2/transport/keepalive_coordinator.h"
+
+#include "gtest/gtest.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(KeepaliveCoordinator, SamePeerIsShared) {
+  Chttp2KeepaliveCoordinator coordinator;
+  auto a = coordinator.GetPeer("ipv4:10.0.0.1:443");
+  auto b = coordinator.GetPeer("ipv4:10.0.0.1:443");
+  auto c = coordinator.GetPeer("ipv4:10.0.0.2:443");
+  EXPECT_EQ(a.get(), b.get());
+  EXPECT_NE(a.get(), c.get());
+  EXPECT_EQ(coordinator.TestOnlyNumPeers(), 2);
+}
+
+TEST(KeepaliveCoordinator, PingAckIsSeenByAllConnections) {
+  Chttp2KeepaliveCoordinator coordinator;
+  auto a = coordinator.GetPeer("ipv4:10.0.0.1:443");
+  auto b = coordinator.GetPeer("ipv4:10.0.0.1:443");
+  const Timestamp now = Timestamp::FromMillisecondsAfterProcessEpoch(10000);
+  EXPECT_FALSE(b->AliveSince(now - Duration::Seconds(1)));
+  a->OnPingAck(now);
+  EXPECT_TRUE(b->AliveSince(now - Duration::Seconds(1)));
+  EXPECT_FALSE(b->AliveSince(now));
+}
+
+TEST(KeepaliveCoordinator, PeerIsForgottenWhenReleased) {
+  Chttp2KeepaliveCoordinator coordinator;
+  auto a = coordinator.GetPeer("ipv4:10.0.0.1:443");
+  const Timestamp now = Timestamp::FromMillisecondsAfterProcessEpoch(10000);
+  a->OnPingAck(now);
+  a.reset();
+  EXPECT_EQ(coordinator.TestOnlyNumPeers(), 0);
+  auto b = coordinator.GetPeer("ipv4:10.0.0.1:443");
+  EXPECT_FALSE(b->AliveSince(now - Duration::Seconds(1)));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,178 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "absl/log/check.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/impl/channel_arg_names.h>
+
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_args_preconditioning.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/endpoint_pair.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/surface/completion_queue.h"
+#include "src/core/lib/transport/transport.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// A client transport to a peer that either runs a server transport, which
+// acks pings, or never reads anything, so that the connection is dead.
+class TestConnection {
+ public:
+  TestConnection(const ChannelArgs& client_args,
+                 const ChannelArgs& server_args, bool alive,
+                 grpc_pollset* pollset) {
+    ExecCtx exec_ctx;
+    grpc_endpoint_pair fds =
+        grpc_iomgr_create_endpoint_pair("keepalive", nullptr);
+    grpc_endpoint_add_to_pollset(fds.client, pollset);
+    if (alive) {
+      grpc_endpoint_add_to_pollset(fds.server, pollset);
+      server_ = grpc_create_chttp2_transport(
+          server_args, OrphanablePtr<grpc_endpoint>(fds.server),
+          /*is_client=*/false);
+      grpc_chttp2_transport_start_reading(server_, nullptr, nullptr, nullptr,
+                                          nullptr);
+    } else {
+      dead_peer_.reset(fds.server);
+    }
+    client_ = grpc_create_chttp2_transport(
+        client_args, OrphanablePtr<grpc_endpoint>(fds.client),
+        /*is_client=*/true);
+    grpc_chttp2_transport_start_reading(
+        client_, nullptr, nullptr, nullptr,
+        NewClosure([closed = closed_](grpc_error_handle) {
+          closed->Notify();
+        }));
+  }
+
+  ~TestConnection() {
+    ExecCtx exec_ctx;
+    client_->Orphan();
+    if (server_ != nullptr) server_->Orphan();
+    dead_peer_.reset();
+  }
+
+  bool WaitForClose(absl::Duration timeout) {
+    return closed_->WaitForNotificationWithTimeout(timeout);
+  }
+
+ private:
+  Transport* client_ = nullptr;
+  Transport* server_ = nullptr;
+  OrphanablePtr<grpc_endpoint> dead_peer_;
+  std::shared_ptr<Notification> closed_ = std::make_shared<Notification>();
+};
+
+class KeepaliveTest : public ::testing::Test {
+ protected:
+  KeepaliveTest() {
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    poller_ = std::thread([this]() {
+      while (!shutdown_.load()) {
+        CHECK(grpc_completion_queue_next(
+                  cq_, grpc_timeout_milliseconds_to_deadline(10), nullptr)
+                  .type == GRPC_QUEUE_TIMEOUT);
+      }
+    });
+  }
+
+  ~KeepaliveTest() override {
+    shutdown_.store(true);
+    poller_.join();
+    grpc_completion_queue_shutdown(cq_);
+    CHECK(grpc_completion_queue_next(cq_, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                     nullptr)
+              .type == GRPC_QUEUE_SHUTDOWN);
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  static ChannelArgs BaseArgs() {
+    return CoreConfiguration::Get()
+        .channel_args_preconditioning()
+        .PreconditionChannelArgs(nullptr)
+        .Set(GRPC_ARG_HTTP2_BDP_PROBE, false);
+  }
+
+  static ChannelArgs ClientArgs() {
+    return BaseArgs()
+        .Set(GRPC_ARG_KEEPALIVE_TIME_MS, 100)
+        .Set(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, 1000)
+        .Set(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, true)
+        .Set(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+  }
+
+  static ChannelArgs ServerArgs() {
+    return BaseArgs()
+        .Set(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, true)
+        .Set(GRPC_ARG_HTTP2_MAX_PING_STRIKES, 0);
+  }
+
+  grpc_pollset* pollset() { return grpc_cq_pollset(cq_); }
+
+ private:
+  grpc_completion_queue* cq_;
+  std::atomic<bool> shutdown_{false};
+  std::thread poller_;
+};
+
+// Each connection must find out on its own whether its peer is alive: a dead
+// connection is closed by its keepalive pings going unacked, even though
+// another connection to the same peer keeps getting its pings acked.
+TEST_F(KeepaliveTest, DeadConnectionIsClosedNextToLiveOne) {
+  TestConnection live(ClientArgs(), ServerArgs(), /*alive=*/true, pollset());
+  TestConnection dead(ClientArgs(), ServerArgs(), /*alive=*/false, pollset());
+  EXPECT_TRUE(dead.WaitForClose(absl::Seconds(30)));
+  // The live connection kept getting its pings acked all along, and keeps
+  // doing so for many more keepalive times.
+  EXPECT_FALSE(live.WaitForClose(absl::Seconds(2)));
+}
+
+// With shared keepalive, the dead connection may put off its pings while the
+// live one gets its acked, but only so many times: it still finds out on its
+// own that its peer is gone.
+TEST_F(KeepaliveTest, DeadConnectionIsClosedWithSharedKeepalive) {
+  const ChannelArgs client_args =
+      ClientArgs().Set(GRPC_ARG_EXPERIMENTAL_HTTP2_SHARED_KEEPALIVE, 3);
+  TestConnection live(client_args, ServerArgs(), /*alive=*/true, pollset());
+  TestConnection dead(client_args, ServerArgs(), /*alive=*/false, pollset());
+  EXPECT_TRUE(dead.WaitForClose(absl::Seconds(30)));
+  EXPECT_FALSE(live.WaitForClose(absl::Seconds(2)));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
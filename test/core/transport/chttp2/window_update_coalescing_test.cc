@@ -0,0 +1,170 @@
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
+#include "src/core/ext/transport/chttp2/transport/flow_control.h"
+#include "src/core/ext/transport/chttp2/transport/internal.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
+#include "test/core/test_util/mock_endpoint.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::EventEngine;
+
+class WindowUpdateCoalescingTest : public ::testing::Test {
+ protected:
+  WindowUpdateCoalescingTest() {
+    auto engine = grpc_event_engine::experimental::GetDefaultEventEngine();
+    mock_endpoint_controller_ =
+        grpc_event_engine::experimental::MockEndpointController::Create(engine);
+    mock_endpoint_controller_->NoMoreReads();
+    args_ = args_.SetObject(ResourceQuota::Default());
+    args_ = args_.SetObject(std::move(engine));
+  }
+
+  ~WindowUpdateCoalescingTest() override {
+    if (t_ != nullptr) {
+      ExecCtx exec_ctx;
+      t_->Orphan();
+    }
+  }
+
+  void CreateTransport() {
+    ExecCtx exec_ctx;
+    t_ = reinterpret_cast<grpc_chttp2_transport*>(grpc_create_chttp2_transport(
+        args_,
+        OrphanablePtr<grpc_endpoint>(
+            mock_endpoint_controller_->TakeCEndpoint()),
+        /*is_client=*/true));
+  }
+
+  // Receives num_bytes of DATA on the connection (but on no stream) and acts
+  // on the transport flow control update that results. Returns whether a
+  // timer was left running to force the window update out.
+  bool ReceiveData(int64_t num_bytes) {
+    bool timer_pending = false;
+    Notification done;
+    ExecCtx exec_ctx;
+    t_->combiner->Run(
+        NewClosure([this, num_bytes, &timer_pending, &done](grpc_error_handle) {
+          chttp2::TransportFlowControl::IncomingUpdateContext upd(
+              &t_->flow_control);
+          EXPECT_TRUE(upd.RecvData(num_bytes).ok());
+          grpc_chttp2_act_on_flowctl_action(upd.MakeAction(), t_, nullptr);
+          timer_pending = t_->window_update_coalesce_timer_handle !=
+                          EventEngine::TaskHandle::kInvalid;
+          done.Notify();
+        }),
+        absl::OkStatus());
+    ExecCtx::Get()->Flush();
+    done.WaitForNotification();
+    return timer_pending;
+  }
+
+  // Waits until the transport has written a window update since before was
+  // collected.
+  static bool WaitForWindowUpdateSent(const GlobalStats& before) {
+    const absl::Time deadline = absl::Now() + absl::Seconds(10);
+    while (absl::Now() < deadline) {
+      if (global_stats().Collect()->Diff(before)->http2_window_updates_sent >
+          0) {
+        return true;
+      }
+      absl::SleepFor(absl::Milliseconds(1));
+    }
+    return false;
+  }
+
+  std::shared_ptr<grpc_event_engine::experimental::MockEndpointController>
+      mock_endpoint_controller_;
+  ChannelArgs args_;
+  grpc_chttp2_transport* t_ = nullptr;
+};
+
+TEST_F(WindowUpdateCoalescingTest, DisabledByDefault) {
+  CreateTransport();
+  EXPECT_EQ(t_->window_update_coalesce_delay, Duration::Zero());
+  auto before = global_stats().Collect();
+  EXPECT_FALSE(ReceiveData(40000));
+  EXPECT_EQ(
+      global_stats().Collect()->Diff(*before)->http2_window_updates_deferred,
+      0u);
+  EXPECT_TRUE(WaitForWindowUpdateSent(*before));
+}
+
+TEST_F(WindowUpdateCoalescingTest, DelayIsCappedAtOneSecond) {
+  args_ = args_.Set("grpc.http2.window_update_coalesce_ms", 5000);
+  CreateTransport();
+  EXPECT_EQ(t_->window_update_coalesce_delay, Duration::Seconds(1));
+}
+
+// With most of the window still open, the update waits for the next write,
+// and the timer makes sure that write happens.
+TEST_F(WindowUpdateCoalescingTest, UpdateIsDeferredWhilePeerHasWindow) {
+  args_ = args_.Set("grpc.http2.window_update_coalesce_ms", 100);
+  CreateTransport();
+  auto before = global_stats().Collect();
+  // Past the point where flow control wants an update sent, but the peer
+  // still has more than a quarter of the window.
+  EXPECT_TRUE(ReceiveData(40000));
+  EXPECT_EQ(
+      global_stats().Collect()->Diff(*before)->http2_window_updates_deferred,
+      1u);
+  EXPECT_TRUE(WaitForWindowUpdateSent(*before));
+}
+
+TEST_F(WindowUpdateCoalescingTest, UpdateIsSentWhenPeerRunsOutOfWindow) {
+  args_ = args_.Set("grpc.http2.window_update_coalesce_ms", 1000);
+  CreateTransport();
+  auto before = global_stats().Collect();
+  // Less than a quarter of the window left.
+  EXPECT_FALSE(ReceiveData(60000));
+  EXPECT_EQ(
+      global_stats().Collect()->Diff(*before)->http2_window_updates_deferred,
+      0u);
+  EXPECT_TRUE(WaitForWindowUpdateSent(*before));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -116,6 +116,30 @@ TEST(WriteSizePolicyTest, MediumWritesJustHangOut) {
   EXPECT_EQ(policy.WriteTargetSize(), 131072);
 }
 
+TEST(WriteSizePolicyTest, SendQueueLimitsTarget) {
+  Chttp2SendQueueAwareWriteSizePolicy policy;
+  // Without send queue state, behave like the default policy.
+  EXPECT_EQ(policy.WriteTargetSize(), 131072);
+  Chttp2WriteSizePolicy::SendQueueState state;
+  // Plenty of congestion window and nothing queued: no limit.
+  state.congestion_window = 1024 * 1024;
+  policy.UpdateSendQueueState(state);
+  EXPECT_EQ(policy.WriteTargetSize(), 131072);
+  // Queued data eats into two congestion windows worth of budget.
+  state.congestion_window = 64 * 1024;
+  state.notsent = 64 * 1024;
+  policy.UpdateSendQueueState(state);
+  EXPECT_EQ(policy.WriteTargetSize(), 65536);
+  // A full kernel buffer still lets minimum sized writes through.
+  state.notsent = 1024 * 1024;
+  policy.UpdateSendQueueState(state);
+  EXPECT_EQ(policy.WriteTargetSize(), 32768);
+  // Once the queue drains the target recovers.
+  state.notsent = 0;
+  policy.UpdateSendQueueState(state);
+  EXPECT_EQ(policy.WriteTargetSize(), 131072);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
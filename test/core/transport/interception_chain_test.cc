@@ -437,6 +437,47 @@ TEST_F(InterceptionChainTest, CreationOrderCorrect) {
                                CreationLogEntry{2, 1}));
 }
 
+TEST_F(InterceptionChainTest, FusedFilters) {
+  CreationLog log;
+  auto r = InterceptionChainBuilder(ChannelArgs().SetObject(&log))
+               .Add<TestFilter<1>>()
+               .AddFused<TestFilter<2>, TestFilter<3>, TestFilter<4>>()
+               .Add<TestFilter<5>>()
+               .Add<TestHijackingInterceptor<6>>()
+               .Build(destination());
+  ASSERT_TRUE(r.ok()) << r.status();
+  EXPECT_THAT(log.entries, ::testing::ElementsAre(
+                               CreationLogEntry{0, 1}, CreationLogEntry{0, 2},
+                               CreationLogEntry{0, 3}, CreationLogEntry{0, 4},
+                               CreationLogEntry{0, 5}, CreationLogEntry{0, 6}));
+  auto finished_call = RunCall(r.value().get());
+  EXPECT_EQ(finished_call.server_metadata->get(GrpcStatusMetadata()),
+            GRPC_STATUS_INTERNAL);
+  // The hijacker passes on the metadata as the filters left it.
+  ASSERT_NE(finished_call.client_metadata, nullptr);
+  std::string backing;
+  for (int i = 1; i <= 5; i++) {
+    const std::string key = absl::StrCat("passed-through-", i);
+    EXPECT_EQ(finished_call.client_metadata->GetStringValue(key, &backing),
+              "true")
+        << key;
+  }
+}
+
+TEST_F(InterceptionChainTest, FailsToInstantiateFusedFilter) {
+  CreationLog log;
+  auto r = InterceptionChainBuilder(ChannelArgs().SetObject(&log))
+               .AddFused<TestFilter<1>, FailsToInstantiateFilter<2>,
+                         TestFilter<3>>()
+               .Build(destination());
+  EXPECT_FALSE(r.ok());
+  EXPECT_EQ(r.status().code(), absl::StatusCode::kInternal);
+  EXPECT_EQ(r.status().message(), "👊 failed to instantiate 2");
+  // Filters after the one that failed are not created.
+  EXPECT_THAT(log.entries, ::testing::ElementsAre(CreationLogEntry{0, 1},
+                                                  CreationLogEntry{0, 2}));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -148,6 +148,53 @@ TEST(MetadataMapTest, NonTraitKeyWithMultipleValues) {
   EXPECT_EQ(map.GetStringValue(kKey, &buffer), "value1,value2");
 }
 
+TEST(MetadataMapTest, KnownAndUnknownKeys) {
+  grpc_metadata_batch map;
+  auto on_error = [](absl::string_view error, const Slice& value) {
+    LOG(ERROR) << error << " value:" << value.as_string_view();
+  };
+  map.Append(":path", Slice::FromStaticString("/foo/bar"), on_error);
+  map.Append("user-agent", Slice::FromStaticString("test"), on_error);
+  // Same length, first, middle and last characters as "user-agent".
+  map.Append("usXr-agent", Slice::FromStaticString("other"), on_error);
+  for (int i = 0; i < 8; ++i) {
+    map.Append(absl::StrCat("custom-", i), Slice::FromStaticString("value"),
+               on_error);
+  }
+  EXPECT_EQ(map.get_pointer(HttpPathMetadata())->as_string_view(), "/foo/bar");
+  std::string buffer;
+  EXPECT_EQ(map.GetStringValue("user-agent", &buffer), "test");
+  EXPECT_EQ(map.GetStringValue("usXr-agent", &buffer), "other");
+  EXPECT_EQ(map.GetStringValue("custom-7", &buffer), "value");
+  EXPECT_EQ(map.GetStringValue("custom-8", &buffer), absl::nullopt);
+  map.Remove("usXr-agent");
+  EXPECT_EQ(map.GetStringValue("usXr-agent", &buffer), absl::nullopt);
+  EXPECT_EQ(map.GetStringValue("user-agent", &buffer), "test");
+}
+
+TEST(NameIndexTest, FindsKeys) {
+  std::vector<absl::string_view> keys = {
+      ":path", ":authority", ":method",      ":scheme",      ":status",
+      "te",    "host",       "grpc-timeout", "grpc-message", "grpc-status",
+  };
+  metadata_detail::NameIndex index(keys);
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(index.Find(keys[i]), static_cast<int>(i)) << keys[i];
+  }
+  EXPECT_EQ(index.Find(""), -1);
+  EXPECT_EQ(index.Find(":pat"), -1);
+  EXPECT_EQ(index.Find(":pXth"), -1);
+  EXPECT_EQ(index.Find("grpc-statuses"), -1);
+}
+
+TEST(NameIndexTest, KeysThatCannotBeHashedApart) {
+  // Same length, first, middle and last characters: no multiplier helps.
+  metadata_detail::NameIndex index({"abcd", "aXcd"});
+  EXPECT_EQ(index.Find("abcd"), 0);
+  EXPECT_EQ(index.Find("aXcd"), 1);
+  EXPECT_EQ(index.Find("abce"), -1);
+}
+
 TEST(DebugStringBuilderTest, OneAddAfterRedaction) {
   metadata_detail::DebugStringBuilder b;
   b.AddAfterRedaction(ContentTypeMetadata::key(), "AddValue01");
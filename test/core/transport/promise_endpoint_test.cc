@@ -667,6 +667,115 @@ TEST_F(PromiseEndpointTest, DestroyedBeforeReadCompletes) {
   activity.Deactivate();
 }
 
+TEST_F(PromiseEndpointTest, ReadAheadServesReadsFromBufferedBytes) {
+  MockActivity activity;
+  const std::string kBuffer = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+  absl::AnyInvocable<void(absl::Status)> read_callback;
+  promise_endpoint_->EnableReadAhead();
+  activity.Activate();
+  EXPECT_CALL(activity, WakeupRequested).Times(1);
+  Sequence s;
+  EXPECT_CALL(mock_endpoint_, Read)
+      .InSequence(s)
+      .WillOnce(WithArg<1>(
+          [&kBuffer](grpc_event_engine::experimental::SliceBuffer* buffer) {
+            // The header and payload of a frame arrive together.
+            grpc_event_engine::experimental::Slice slice(
+                grpc_slice_from_cpp_string(kBuffer.substr(0, 6)));
+            buffer->Append(std::move(slice));
+            return true;
+          }));
+  EXPECT_CALL(mock_endpoint_, Read)
+      .InSequence(s)
+      .WillOnce(WithArgs<0, 1>(
+          [&read_callback, &kBuffer](
+              absl::AnyInvocable<void(absl::Status)> on_read,
+              grpc_event_engine::experimental::SliceBuffer* buffer) {
+            read_callback = std::move(on_read);
+            grpc_event_engine::experimental::Slice slice(
+                grpc_slice_from_cpp_string(kBuffer.substr(6)));
+            buffer->Append(std::move(slice));
+            return false;
+          }));
+  // Started once the last read is served, and dropped with the endpoint.
+  EXPECT_CALL(mock_endpoint_, Read).InSequence(s).WillOnce(Return(false));
+  {
+    auto promise = promise_endpoint_->ReadSlice(2u);
+    auto poll = promise();
+    ASSERT_TRUE(poll.ready());
+    ASSERT_TRUE(poll.value().ok());
+    EXPECT_EQ(poll.value()->as_string_view(), kBuffer.substr(0, 2));
+  }
+  {
+    // Served from the first endpoint read, while the second is outstanding.
+    auto promise = promise_endpoint_->Read(4u);
+    auto poll = promise();
+    ASSERT_TRUE(poll.ready());
+    ASSERT_TRUE(poll.value().ok());
+    EXPECT_EQ(poll.value()->JoinIntoString(), kBuffer.substr(2, 4));
+  }
+  {
+    // Waits for the outstanding read rather than starting another.
+    auto promise = promise_endpoint_->Read(2u);
+    EXPECT_TRUE(promise().pending());
+    read_callback(absl::OkStatus());
+    auto poll = promise();
+    ASSERT_TRUE(poll.ready());
+    ASSERT_TRUE(poll.value().ok());
+    EXPECT_EQ(poll.value()->JoinIntoString(), kBuffer.substr(6));
+  }
+  activity.Deactivate();
+}
+
+TEST_F(PromiseEndpointTest, ReadAheadFailsAfterBufferedBytesAreRead) {
+  MockActivity activity;
+  const std::string kBuffer = {0x01, 0x02, 0x03, 0x04};
+  absl::AnyInvocable<void(absl::Status)> read_callback;
+  promise_endpoint_->EnableReadAhead();
+  activity.Activate();
+  EXPECT_CALL(activity, WakeupRequested).Times(0);
+  Sequence s;
+  EXPECT_CALL(mock_endpoint_, Read)
+      .InSequence(s)
+      .WillOnce(WithArg<1>(
+          [&kBuffer](grpc_event_engine::experimental::SliceBuffer* buffer) {
+            grpc_event_engine::experimental::Slice slice(
+                grpc_slice_from_cpp_string(kBuffer));
+            buffer->Append(std::move(slice));
+            return true;
+          }));
+  EXPECT_CALL(mock_endpoint_, Read)
+      .InSequence(s)
+      .WillOnce(WithArg<0>(
+          [&read_callback](absl::AnyInvocable<void(absl::Status)> on_read) {
+            read_callback = std::move(on_read);
+            return false;
+          }));
+  {
+    auto promise = promise_endpoint_->Read(2u);
+    auto poll = promise();
+    ASSERT_TRUE(poll.ready());
+    ASSERT_TRUE(poll.value().ok());
+    EXPECT_EQ(poll.value()->JoinIntoString(), kBuffer.substr(0, 2));
+  }
+  read_callback(kDummyErrorStatus);
+  {
+    auto promise = promise_endpoint_->Read(2u);
+    auto poll = promise();
+    ASSERT_TRUE(poll.ready());
+    ASSERT_TRUE(poll.value().ok());
+    EXPECT_EQ(poll.value()->JoinIntoString(), kBuffer.substr(2));
+  }
+  {
+    auto promise = promise_endpoint_->Read(1u);
+    auto poll = promise();
+    ASSERT_TRUE(poll.ready());
+    ASSERT_FALSE(poll.value().ok());
+    EXPECT_EQ(kDummyErrorStatus, poll.value().status());
+  }
+  activity.Deactivate();
+}
+
 class MultiplePromiseEndpointTest : public ::testing::Test {
  public:
   MultiplePromiseEndpointTest()
@@ -100,6 +100,18 @@ TEST(TimeoutTest, DecodingSucceeds) {
   assert_decodes_as("9999999999S", Duration::Infinity());
 }
 
+TEST(TimeoutTest, DecodingOfUnusualForms) {
+  // Shortest and longest forms without whitespace, which take the same path.
+  assert_decodes_as("0m", Duration::Zero());
+  assert_decodes_as("99999999S", Duration::Seconds(99999999));
+  assert_decodes_as("00000001m", Duration::Milliseconds(1));
+  // Longer forms, and forms with whitespace.
+  assert_decodes_as("000000001m", Duration::Milliseconds(1));
+  assert_decodes_as("100000000m", Duration::Milliseconds(100000000));
+  assert_decodes_as("1m ", Duration::Milliseconds(1));
+  assert_decodes_as(" 1m", Duration::Milliseconds(1));
+}
+
 void assert_decoding_fails(const char* s) {
   EXPECT_EQ(absl::nullopt, ParseTimeout(Slice::FromCopiedString(s)))
       << " s=" << s;
@@ -115,6 +127,9 @@ TEST(TimeoutTest, DecodingFails) {
   assert_decoding_fails("!");
   assert_decoding_fails("n1");
   assert_decoding_fails("-1u");
+  assert_decoding_fails("1.5S");
+  assert_decoding_fails("1m1");
+  assert_decoding_fails("mm");
 }
 
 }  // namespace
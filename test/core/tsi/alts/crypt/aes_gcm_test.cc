@@ -431,6 +431,65 @@ static void gsec_test_multiple_encrypt_decrypt(gsec_aead_crypter* crypter) {
   gpr_free(message_lengths);
 }
 
+static void gsec_test_batch_encrypt_decrypt(gsec_aead_crypter* crypter) {
+  ASSERT_NE(crypter, nullptr);
+  constexpr size_t kNumFrames = 3;
+  const size_t message_lengths[kNumFrames] = {0, 1, 2000};
+  size_t nonce_length, tag_length;
+  gsec_aead_crypter_nonce_length(crypter, &nonce_length,
+                                 /*error_details=*/nullptr);
+  gsec_aead_crypter_tag_length(crypter, &tag_length, /*error_details=*/nullptr);
+  uint8_t* nonces[kNumFrames];
+  uint8_t* messages[kNumFrames];
+  uint8_t* ciphertexts[kNumFrames];
+  // Each message is split in two iovecs, the first one possibly empty.
+  struct iovec plaintext_vecs[kNumFrames][2];
+  gsec_aead_frame frames[kNumFrames];
+  for (size_t i = 0; i < kNumFrames; i++) {
+    gsec_test_random_array(&nonces[i], nonce_length);
+    gsec_test_random_array(&messages[i], message_lengths[i]);
+    ciphertexts[i] = static_cast<uint8_t*>(
+        gpr_malloc(message_lengths[i] + tag_length));
+    size_t split = message_lengths[i] / 3;
+    plaintext_vecs[i][0] = {messages[i], split};
+    plaintext_vecs[i][1] = {messages[i] + split, message_lengths[i] - split};
+    frames[i].nonce = nonces[i];
+    frames[i].plaintext_vec = plaintext_vecs[i];
+    frames[i].plaintext_vec_length = 2;
+    frames[i].ciphertext_vec = {ciphertexts[i],
+                                message_lengths[i] + tag_length};
+    frames[i].ciphertext_bytes_written = 0;
+  }
+  char* error_buffer = nullptr;
+  gsec_assert_ok(gsec_aead_crypter_encrypt_iovec_batch(
+                     crypter, nonce_length, frames, kNumFrames, &error_buffer),
+                 error_buffer);
+  // Each frame decrypts on its own.
+  for (size_t i = 0; i < kNumFrames; i++) {
+    ASSERT_EQ(frames[i].ciphertext_bytes_written,
+              message_lengths[i] + tag_length);
+    uint8_t* plaintext =
+        static_cast<uint8_t*>(gpr_malloc(message_lengths[i] + 1));
+    size_t plaintext_bytes_written = 0;
+    gsec_assert_ok(
+        gsec_aead_crypter_decrypt(crypter, nonces[i], nonce_length,
+                                  /*aad=*/nullptr, /*aad_length=*/0,
+                                  ciphertexts[i],
+                                  frames[i].ciphertext_bytes_written, plaintext,
+                                  message_lengths[i], &plaintext_bytes_written,
+                                  &error_buffer),
+        error_buffer);
+    ASSERT_EQ(plaintext_bytes_written, message_lengths[i]);
+    if (message_lengths[i] > 0) {
+      ASSERT_EQ(memcmp(plaintext, messages[i], message_lengths[i]), 0);
+    }
+    gpr_free(plaintext);
+    gpr_free(nonces[i]);
+    gpr_free(messages[i]);
+    gpr_free(ciphertexts[i]);
+  }
+}
+
 static void gsec_test_encryption_failure(gsec_aead_crypter* crypter) {
   ASSERT_NE(crypter, nullptr);
   size_t aad_length = kTestMaxLength;
@@ -872,6 +931,7 @@ TEST(AltsCryptTest, GsecTestDoGenericCrypterTests) {
   for (ind = 0; ind < kTestNumCrypters; ind++) {
     gsec_test_encrypt_decrypt(crypters[ind]);
     gsec_test_multiple_encrypt_decrypt(crypters[ind]);
+    gsec_test_batch_encrypt_decrypt(crypters[ind]);
     gsec_test_encryption_failure(crypters[ind]);
     gsec_test_decryption_failure(crypters[ind]);
   }
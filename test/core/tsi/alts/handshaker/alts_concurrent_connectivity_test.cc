@@ -55,6 +55,7 @@
 #include "src/core/lib/security/credentials/credentials.h"
 #include "src/core/lib/security/security_connector/alts/alts_security_connector.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
+#include "src/core/tsi/alts/handshaker/alts_handshaker_client.h"
 #include "src/core/util/useful.h"
 #include "test/core/end2end/cq_verifier.h"
 #include "test/core/test_util/fake_udp_and_tcp_server.h"
@@ -293,6 +294,8 @@ TEST(AltsConcurrentConnectivityTest, TestConcurrentClientServerHandshakes) {
   {
     TestServer test_server;
     size_t num_concurrent_connects = 50;
+    const AltsHandshakeQueueStats stats_before =
+        GetAltsHandshakeQueueStats(/*is_client=*/true);
     std::vector<std::unique_ptr<ConnectLoopRunner>> connect_loop_runners;
     VLOG(2) << "start performing concurrent expected-to-succeed connects";
     for (size_t i = 0; i < num_concurrent_connects; i++) {
@@ -304,6 +307,11 @@ TEST(AltsConcurrentConnectivityTest, TestConcurrentClientServerHandshakes) {
     }
     connect_loop_runners.clear();
     VLOG(2) << "done performing concurrent expected-to-succeed connects";
+    const AltsHandshakeQueueStats stats_after =
+        GetAltsHandshakeQueueStats(/*is_client=*/true);
+    EXPECT_GE(stats_after.total_requested - stats_before.total_requested,
+              num_concurrent_connects * 5);
+    EXPECT_LE(stats_after.outstanding, MaxNumberOfConcurrentHandshakes());
   }
 }
 
@@ -28,6 +28,7 @@
 #include <grpc/grpc.h>
 #include <grpc/support/sync.h>
 
+#include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/tsi/alts/handshaker/alts_handshaker_client.h"
@@ -60,6 +61,9 @@
 #define ALTS_TSI_HANDSHAKER_TEST_PEER_ATTRIBUTES_KEY "peer"
 #define ALTS_TSI_HANDSHAKER_TEST_PEER_ATTRIBUTES_VALUE "attributes"
 
+const char kChannelPoolSizeEnvironmentVariable[] =
+    "GRPC_ALTS_HANDSHAKER_CHANNEL_POOL_SIZE";
+
 using grpc_core::internal::alts_handshaker_client_check_fields_for_testing;
 using grpc_core::internal::alts_handshaker_client_get_handshaker_for_testing;
 using grpc_core::internal::
@@ -1099,6 +1103,26 @@ TEST(AltsTsiHandshakerTest, CheckHandshakerSuccess) {
   notification_destroy(&tsi_to_caller_notification);
 }
 
+TEST(AltsHandshakerChannelPoolSizeTest, Default) {
+  grpc_core::UnsetEnv(kChannelPoolSizeEnvironmentVariable);
+  EXPECT_EQ(AltsHandshakerChannelPoolSize(), 1);
+}
+
+TEST(AltsHandshakerChannelPoolSizeTest, EnvVarNotInt) {
+  grpc_core::SetEnv(kChannelPoolSizeEnvironmentVariable, "not-a-number");
+  EXPECT_EQ(AltsHandshakerChannelPoolSize(), 1);
+}
+
+TEST(AltsHandshakerChannelPoolSizeTest, EnvVarZero) {
+  grpc_core::SetEnv(kChannelPoolSizeEnvironmentVariable, "0");
+  EXPECT_EQ(AltsHandshakerChannelPoolSize(), 1);
+}
+
+TEST(AltsHandshakerChannelPoolSizeTest, EnvVarSuccess) {
+  grpc_core::SetEnv(kChannelPoolSizeEnvironmentVariable, "4");
+  EXPECT_EQ(AltsHandshakerChannelPoolSize(), 4);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
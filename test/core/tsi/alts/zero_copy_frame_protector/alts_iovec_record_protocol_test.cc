@@ -18,6 +18,7 @@
 
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_iovec_record_protocol.h"
 
+#include <algorithm>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -469,6 +470,53 @@ static void privacy_integrity_random_seal_unseal(
   }
 }
 
+static void privacy_integrity_multi_frame_seal_unseal(
+    alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
+  for (size_t i = 0; i < kSealRepeatTimes; i++) {
+    alts_iovec_record_protocol_test_var* var =
+        alts_iovec_record_protocol_test_var_create();
+    size_t max_frame_data_size =
+        gsec_test_bias_random_uint32(static_cast<uint32_t>(var->data_length)) +
+        1;
+    size_t num_frames = alts_iovec_record_protocol_num_frames(
+        var->data_length, max_frame_data_size);
+    size_t protected_frames_length =
+        var->data_length + num_frames * (var->header_length + var->tag_length);
+    uint8_t* protected_frames =
+        static_cast<uint8_t*>(gpr_malloc(protected_frames_length));
+    // Seals all frames at once.
+    grpc_status_code status =
+        alts_iovec_record_protocol_privacy_integrity_protect_frames(
+            sender, var->data_iovec, var->data_iovec_length,
+            max_frame_data_size, {protected_frames, protected_frames_length},
+            nullptr);
+    ASSERT_EQ(status, GRPC_STATUS_OK);
+    // Unseals the frames one by one.
+    uint8_t* frame = protected_frames;
+    size_t unprotected_length = 0;
+    for (size_t j = 0; j < num_frames; j++) {
+      size_t frame_data_length = std::min(
+          max_frame_data_size, var->data_length - unprotected_length);
+      iovec_t header_iovec = {frame, var->header_length};
+      iovec_t protected_iovec = {frame + var->header_length,
+                                 frame_data_length + var->tag_length};
+      iovec_t unprotected_iovec = {var->data_buf + unprotected_length,
+                                   frame_data_length};
+      status = alts_iovec_record_protocol_privacy_integrity_unprotect(
+          receiver, header_iovec, &protected_iovec, 1, unprotected_iovec,
+          nullptr);
+      ASSERT_EQ(status, GRPC_STATUS_OK);
+      frame += var->header_length + frame_data_length + var->tag_length;
+      unprotected_length += frame_data_length;
+    }
+    ASSERT_EQ(unprotected_length, var->data_length);
+    // Makes sure unprotected data are the same as the original.
+    ASSERT_EQ(memcmp(var->data_buf, var->dup_buf, var->data_length), 0);
+    gpr_free(protected_frames);
+    alts_iovec_record_protocol_test_var_destroy(var);
+  }
+}
+
 static void privacy_integrity_empty_seal_unseal(
     alts_iovec_record_protocol* sender, alts_iovec_record_protocol* receiver) {
   alts_iovec_record_protocol_test_var* var =
@@ -788,6 +836,26 @@ TEST(AltsIovecRecordProtocolTest,
   alts_iovec_record_protocol_test_fixture_destroy(fixture);
 }
 
+TEST(AltsIovecRecordProtocolTest,
+     AltsIovecRecordProtocolMultiFrameSealUnsealTests) {
+  alts_iovec_record_protocol_test_fixture* fixture =
+      alts_iovec_record_protocol_test_fixture_create(
+          /*rekey=*/false, /*integrity_only=*/false);
+  privacy_integrity_multi_frame_seal_unseal(fixture->client_protect,
+                                            fixture->server_unprotect);
+  privacy_integrity_multi_frame_seal_unseal(fixture->server_protect,
+                                            fixture->client_unprotect);
+  alts_iovec_record_protocol_test_fixture_destroy(fixture);
+
+  fixture = alts_iovec_record_protocol_test_fixture_create(
+      /*rekey=*/true, /*integrity_only=*/false);
+  privacy_integrity_multi_frame_seal_unseal(fixture->client_protect,
+                                            fixture->server_unprotect);
+  privacy_integrity_multi_frame_seal_unseal(fixture->server_protect,
+                                            fixture->client_unprotect);
+  alts_iovec_record_protocol_test_fixture_destroy(fixture);
+}
+
 TEST(AltsIovecRecordProtocolTest, AltsIovecRecordProtocolEmptySealUnsealTests) {
   alts_iovec_record_protocol_test_fixture* fixture =
       alts_iovec_record_protocol_test_fixture_create(
@@ -26,6 +26,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/tsi/alts/crypt/gsec.h"
 #include "src/core/tsi/alts/zero_copy_frame_protector/alts_iovec_record_protocol.h"
 #include "src/core/tsi/transport_security_grpc.h"
@@ -310,6 +311,56 @@ static void alts_zero_copy_protector_seal_unseal_large_buffer_tests(
   alts_zero_copy_grpc_protector_test_fixture_destroy(fixture);
 }
 
+// Checks that a protector sealing large writes in parallel produces the same
+// frames as one sealing them serially, across several writes.
+static void alts_zero_copy_protector_parallel_protect_tests(
+    bool rekey, bool integrity_only) {
+  size_t key_length = rekey ? kAes128GcmRekeyKeyLength : kAes128GcmKeyLength;
+  uint8_t* key;
+  gsec_test_random_array(&key, key_length);
+  tsi_zero_copy_grpc_protector* serial = nullptr;
+  tsi_zero_copy_grpc_protector* parallel = nullptr;
+  size_t max_protected_frame_size = 1024;
+  ASSERT_EQ(alts_zero_copy_grpc_protector_create(
+                grpc_core::GsecKeyFactory(absl::MakeConstSpan(key, key_length),
+                                          rekey),
+                /*is_client=*/true, integrity_only,
+                /*enable_extra_copy=*/false, &max_protected_frame_size,
+                &serial),
+            TSI_OK);
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.alts_parallel_protect_workers = 4;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  ASSERT_EQ(alts_zero_copy_grpc_protector_create(
+                grpc_core::GsecKeyFactory(absl::MakeConstSpan(key, key_length),
+                                          rekey),
+                /*is_client=*/true, integrity_only,
+                /*enable_extra_copy=*/false, &max_protected_frame_size,
+                &parallel),
+            TSI_OK);
+  grpc_core::ConfigVars::Reset();
+  // Large writes are split into runs, small ones are sealed serially.
+  for (size_t length : {kLargeBufferSize, kSmallBufferSize, size_t{5007},
+                        kLargeBufferSize * 4 + 1}) {
+    alts_zero_copy_grpc_protector_test_var* var =
+        alts_zero_copy_grpc_protector_test_var_create();
+    create_random_slice_buffer(&var->original_sb, &var->duplicate_sb, length);
+    ASSERT_EQ(tsi_zero_copy_grpc_protector_protect(serial, &var->original_sb,
+                                                   &var->protected_sb),
+              TSI_OK);
+    ASSERT_EQ(tsi_zero_copy_grpc_protector_protect(
+                  parallel, &var->duplicate_sb, &var->unprotected_sb),
+              TSI_OK);
+    ASSERT_EQ(var->duplicate_sb.length, 0);
+    ASSERT_TRUE(
+        are_slice_buffers_equal(&var->protected_sb, &var->unprotected_sb));
+    alts_zero_copy_grpc_protector_test_var_destroy(var);
+  }
+  tsi_zero_copy_grpc_protector_destroy(serial);
+  tsi_zero_copy_grpc_protector_destroy(parallel);
+  gpr_free(key);
+}
+
 TEST(AltsZeroCopyGrpcProtectorTest, MainTest) {
   grpc_init();
   alts_zero_copy_protector_seal_unseal_small_buffer_tests(
@@ -323,6 +374,17 @@ TEST(AltsZeroCopyGrpcProtectorTest, MainTest) {
   grpc_shutdown();
 }
 
+TEST(AltsZeroCopyGrpcProtectorTest, ParallelProtect) {
+  grpc_init();
+  alts_zero_copy_protector_parallel_protect_tests(/*rekey=*/false,
+                                                  /*integrity_only=*/false);
+  alts_zero_copy_protector_parallel_protect_tests(/*rekey=*/true,
+                                                  /*integrity_only=*/false);
+  alts_zero_copy_protector_parallel_protect_tests(/*rekey=*/false,
+                                                  /*integrity_only=*/true);
+  grpc_shutdown();
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
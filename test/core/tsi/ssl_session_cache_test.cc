@@ -18,6 +18,8 @@
 
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 
+#include <string.h>
+
 #include <string>
 #include <unordered_set>
 
@@ -29,6 +31,8 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/tsi/ssl/session_cache/ssl_session_ticket_keys.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc_core {
@@ -185,6 +189,54 @@ TEST(SslSessionCacheTest, CapacityZeroCache) {
   SSL_CTX_free(ssl_ctx);
 }
 
+bool SameKey(const tsi::SslSessionTicketKeys::Key& a,
+             const tsi::SslSessionTicketKeys::Key& b) {
+  return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+TEST(SslSessionTicketKeysTest, KeysRotateAndStayValidForOneMorePeriod) {
+  tsi::SslSessionTicketKeys keys(Duration::Seconds(100));
+  const Timestamp start = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  tsi::SslSessionTicketKeys::Key first = keys.EncryptionKey(start);
+  EXPECT_TRUE(
+      SameKey(keys.EncryptionKey(start + Duration::Seconds(99)), first));
+  tsi::SslSessionTicketKeys::Key key;
+  EXPECT_EQ(keys.DecryptionKey(first.name, start + Duration::Seconds(99), &key),
+            tsi::SslSessionTicketKeys::Match::kCurrent);
+  EXPECT_TRUE(SameKey(key, first));
+  // After one period, tickets get a new key, and old tickets are renewed.
+  tsi::SslSessionTicketKeys::Key second =
+      keys.EncryptionKey(start + Duration::Seconds(100));
+  EXPECT_FALSE(SameKey(second, first));
+  EXPECT_EQ(
+      keys.DecryptionKey(first.name, start + Duration::Seconds(150), &key),
+      tsi::SslSessionTicketKeys::Match::kPrevious);
+  EXPECT_TRUE(SameKey(key, first));
+  EXPECT_EQ(
+      keys.DecryptionKey(second.name, start + Duration::Seconds(150), &key),
+      tsi::SslSessionTicketKeys::Match::kCurrent);
+  // After another period, the first key is gone.
+  EXPECT_EQ(
+      keys.DecryptionKey(first.name, start + Duration::Seconds(200), &key),
+      tsi::SslSessionTicketKeys::Match::kNone);
+  EXPECT_EQ(
+      keys.DecryptionKey(second.name, start + Duration::Seconds(200), &key),
+      tsi::SslSessionTicketKeys::Match::kPrevious);
+}
+
+TEST(SslSessionTicketKeysTest, IdleKeysExpire) {
+  tsi::SslSessionTicketKeys keys(Duration::Seconds(100));
+  const Timestamp start = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+  tsi::SslSessionTicketKeys::Key first = keys.EncryptionKey(start);
+  // Nothing happened for two periods: tickets under the first key expired.
+  tsi::SslSessionTicketKeys::Key key;
+  EXPECT_EQ(
+      keys.DecryptionKey(first.name, start + Duration::Seconds(250), &key),
+      tsi::SslSessionTicketKeys::Match::kNone);
+  EXPECT_FALSE(
+      SameKey(keys.EncryptionKey(start + Duration::Seconds(250)), first));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -22,20 +22,35 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <openssl/crypto.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
 #include <openssl/pem.h>
 
+#include "absl/base/thread_annotations.h"
 #include "absl/log/log.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "test/core/test_util/build.h"
 #include "test/core/test_util/test_config.h"
@@ -319,6 +334,11 @@ class SslTransportSecurityTest
       ssl_bio_buf_size_ = ssl_bio_buf_size;
     }
 
+    void SetServerPrivateKeySigner(
+        std::shared_ptr<tsi::SslPrivateKeySigner> signer) {
+      server_private_key_signer_ = std::move(signer);
+    }
+
    private:
     static void SetupHandshakers(tsi_test_fixture* fixture) {
       SslTsiTestFixture* ssl_fixture =
@@ -397,6 +417,8 @@ class SslTransportSecurityTest
           ssl_fixture->session_ticket_key_size_;
       server_options.min_tls_version = ssl_fixture->tls_version_;
       server_options.max_tls_version = ssl_fixture->tls_version_;
+      server_options.private_key_signer =
+          ssl_fixture->server_private_key_signer_;
       ASSERT_EQ(tsi_create_ssl_server_handshaker_factory_with_options(
                     &server_options, &ssl_fixture->server_handshaker_factory_),
                 TSI_OK);
@@ -658,6 +680,7 @@ class SslTransportSecurityTest
     bool verify_root_cert_subject_;
     tsi_tls_version tls_version_;
     bool send_client_ca_list_;
+    std::shared_ptr<tsi::SslPrivateKeySigner> server_private_key_signer_;
     tsi_ssl_server_handshaker_factory* server_handshaker_factory_ = nullptr;
     tsi_ssl_client_handshaker_factory* client_handshaker_factory_ = nullptr;
   };
@@ -1018,6 +1041,181 @@ TEST_P(SslTransportSecurityTest, DoHandshakeWithCustomBioPair) {
   DoHandshake();
 }
 
+// Protects \a message with \a sender and unprotects it with \a receiver,
+// handing the protected bytes over in chunks of \a chunk_size. \a leftover
+// holds bytes that the receiver's handshaker did not consume.
+static void ZeroCopyRoundTrip(tsi_zero_copy_grpc_protector* sender,
+                              tsi_zero_copy_grpc_protector* receiver,
+                              absl::string_view leftover,
+                              const std::string& message, size_t chunk_size) {
+  grpc_slice_buffer unprotected;
+  grpc_slice_buffer protected_sb;
+  grpc_slice_buffer chunk;
+  grpc_slice_buffer received;
+  grpc_slice_buffer_init(&unprotected);
+  grpc_slice_buffer_init(&protected_sb);
+  grpc_slice_buffer_init(&chunk);
+  grpc_slice_buffer_init(&received);
+  // Split the message into uneven slices so that records span several of
+  // them.
+  for (size_t offset = 0; offset < message.size();) {
+    size_t size = std::min<size_t>(message.size() - offset, 1000 + offset % 7);
+    grpc_slice_buffer_add(&unprotected, grpc_slice_from_copied_buffer(
+                                            message.data() + offset, size));
+    offset += size;
+  }
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_protect(sender, &unprotected,
+                                                 &protected_sb),
+            TSI_OK);
+  EXPECT_EQ(unprotected.length, 0);
+  if (!leftover.empty()) {
+    grpc_slice_buffer_add(&chunk, grpc_slice_from_copied_buffer(
+                                      leftover.data(), leftover.size()));
+  }
+  while (protected_sb.length > 0 || chunk.length > 0) {
+    grpc_slice_buffer_move_first(
+        &protected_sb, std::min(chunk_size, protected_sb.length), &chunk);
+    int min_progress_size = 0;
+    ASSERT_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                  receiver, &chunk, &received, &min_progress_size),
+              TSI_OK);
+    EXPECT_EQ(chunk.length, 0);
+    EXPECT_GE(min_progress_size, 1);
+  }
+  std::string result(received.length, '\0');
+  grpc_slice_buffer_copy_first_into_buffer(&received, received.length,
+                                           &result[0]);
+  EXPECT_EQ(result, message);
+  grpc_slice_buffer_destroy(&unprotected);
+  grpc_slice_buffer_destroy(&protected_sb);
+  grpc_slice_buffer_destroy(&chunk);
+  grpc_slice_buffer_destroy(&received);
+}
+
+TEST_P(SslTransportSecurityTest, DoRoundTripZeroCopyProtector) {
+  LOG(INFO) << "ssl_tsi_test_do_round_trip_zero_copy_protector";
+  SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                  /*send_client_ca_list=*/std::get<1>(GetParam()));
+  DoHandshake();
+  tsi_handshaker_result* client_result = ssl_tsi_test_fixture_->client_result;
+  tsi_handshaker_result* server_result = ssl_tsi_test_fixture_->server_result;
+  ASSERT_NE(client_result, nullptr);
+  ASSERT_NE(server_result, nullptr);
+  tsi_zero_copy_grpc_protector* client_protector = nullptr;
+  tsi_zero_copy_grpc_protector* server_protector = nullptr;
+  ASSERT_EQ(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                client_result, nullptr, &client_protector),
+            TSI_OK);
+  ASSERT_EQ(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                server_result, nullptr, &server_protector),
+            TSI_OK);
+  const unsigned char* bytes = nullptr;
+  size_t bytes_size = 0;
+  ASSERT_EQ(
+      tsi_handshaker_result_get_unused_bytes(client_result, &bytes, &bytes_size),
+      TSI_OK);
+  absl::string_view client_leftover(reinterpret_cast<const char*>(bytes),
+                                    bytes_size);
+  ASSERT_EQ(
+      tsi_handshaker_result_get_unused_bytes(server_result, &bytes, &bytes_size),
+      TSI_OK);
+  absl::string_view server_leftover(reinterpret_cast<const char*>(bytes),
+                                    bytes_size);
+  std::string message(100000, '\0');
+  for (size_t i = 0; i < message.size(); ++i) message[i] = 'a' + i % 26;
+  ZeroCopyRoundTrip(client_protector, server_protector, server_leftover,
+                    message, /*chunk_size=*/7);
+  ZeroCopyRoundTrip(server_protector, client_protector, client_leftover,
+                    message, /*chunk_size=*/4096);
+  ZeroCopyRoundTrip(client_protector, server_protector, "", "x",
+                    /*chunk_size=*/1);
+  tsi_zero_copy_grpc_protector_destroy(client_protector);
+  tsi_zero_copy_grpc_protector_destroy(server_protector);
+}
+
+#if defined(OPENSSL_IS_BORINGSSL)
+// Signs with a PEM private key, each signature on a thread of its own.
+class ThreadedPrivateKeySigner : public tsi::SslPrivateKeySigner {
+ public:
+  explicit ThreadedPrivateKeySigner(const char* pem_key) {
+    BIO* pem = BIO_new_mem_buf(pem_key, strlen(pem_key));
+    key_ =
+        PEM_read_bio_PrivateKey(pem, nullptr, nullptr, const_cast<char*>(""));
+    BIO_free(pem);
+  }
+
+  ~ThreadedPrivateKeySigner() override {
+    for (std::thread& thread : threads_) thread.join();
+    EVP_PKEY_free(key_);
+  }
+
+  void Sign(absl::string_view input, uint16_t signature_algorithm,
+            absl::AnyInvocable<void(absl::StatusOr<std::string>)> on_done)
+      override {
+    grpc_core::MutexLock lock(&mu_);
+    threads_.emplace_back([this, input = std::string(input),
+                           signature_algorithm,
+                           on_done = std::move(on_done)]() mutable {
+      on_done(SignNow(input, signature_algorithm));
+    });
+  }
+
+  size_t num_signatures() {
+    grpc_core::MutexLock lock(&mu_);
+    return threads_.size();
+  }
+
+ private:
+  absl::StatusOr<std::string> SignNow(absl::string_view input,
+                                      uint16_t signature_algorithm) {
+    std::string signature;
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    EVP_PKEY_CTX* pkey_ctx = nullptr;
+    size_t signature_size = 0;
+    bool ok =
+        EVP_DigestSignInit(ctx, &pkey_ctx,
+                           SSL_get_signature_algorithm_digest(
+                               signature_algorithm),
+                           nullptr, key_) == 1 &&
+        (!SSL_is_signature_algorithm_rsa_pss(signature_algorithm) ||
+         (EVP_PKEY_CTX_set_rsa_padding(pkey_ctx, RSA_PKCS1_PSS_PADDING) == 1 &&
+          EVP_PKEY_CTX_set_rsa_pss_saltlen(pkey_ctx, -1) == 1)) &&
+        EVP_DigestSign(ctx, nullptr, &signature_size,
+                       reinterpret_cast<const uint8_t*>(input.data()),
+                       input.size()) == 1;
+    if (ok) {
+      signature.resize(signature_size);
+      ok = EVP_DigestSign(ctx, reinterpret_cast<uint8_t*>(&signature[0]),
+                          &signature_size,
+                          reinterpret_cast<const uint8_t*>(input.data()),
+                          input.size()) == 1;
+      signature.resize(signature_size);
+    }
+    EVP_MD_CTX_free(ctx);
+    if (!ok) return absl::InternalError("signing failed");
+    return signature;
+  }
+
+  EVP_PKEY* key_;
+  grpc_core::Mutex mu_;
+  std::vector<std::thread> threads_ ABSL_GUARDED_BY(mu_);
+};
+
+TEST_P(SslTransportSecurityTest, DoHandshakeWithAsyncPrivateKeySigner) {
+  LOG(INFO) << "ssl_tsi_test_do_handshake_with_async_private_key_signer";
+  SetUpSslFixture(/*tls_version=*/std::get<0>(GetParam()),
+                  /*send_client_ca_list=*/std::get<1>(GetParam()));
+  // Without server name indication, the handshake uses the first server
+  // certificate.
+  auto signer = std::make_shared<ThreadedPrivateKeySigner>(
+      ssl_fixture_->MutableKeyCertLib()->server_pem_key_cert_pairs[0]
+          .private_key);
+  ssl_fixture_->SetServerPrivateKeySigner(signer);
+  DoHandshake();
+  EXPECT_EQ(signer->num_signatures(), 1u);
+}
+#endif  // defined(OPENSSL_IS_BORINGSSL)
+
 static const tsi_ssl_handshaker_factory_vtable* original_vtable;
 static bool handshaker_factory_destructor_called;
 
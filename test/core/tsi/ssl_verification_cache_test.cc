@@ -0,0 +1,170 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/tsi/ssl/verification_cache/ssl_verification_cache.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <openssl/x509.h>
+
+#include "absl/strings/string_view.h"
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_crl_provider.h>
+
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using experimental::CertificateInfo;
+using experimental::CertificateInfoImpl;
+using experimental::Crl;
+using experimental::CrlProvider;
+using tsi::SslVerificationCache;
+
+class FakeCrl : public Crl {
+ public:
+  absl::string_view Issuer() override { return "issuer"; }
+};
+
+// Returns the same CRL until it is told to reload.
+class FakeCrlProvider : public CrlProvider {
+ public:
+  std::shared_ptr<Crl> GetCrl(const CertificateInfo& /*info*/) override {
+    return crl_;
+  }
+
+  void Reload() { crl_ = std::make_shared<FakeCrl>(); }
+
+ private:
+  std::shared_ptr<Crl> crl_ = std::make_shared<FakeCrl>();
+};
+
+// A leaf and a root that expire after the given number of seconds.
+class Chain {
+ public:
+  explicit Chain(long leaf_lifetime_s = 3600, long root_lifetime_s = 7200)
+      : chain_(sk_X509_new_null()) {
+    sk_X509_push(chain_, NewCert(leaf_lifetime_s));
+    sk_X509_push(chain_, NewCert(root_lifetime_s));
+  }
+  ~Chain() { sk_X509_pop_free(chain_, X509_free); }
+
+  STACK_OF(X509)* get() { return chain_; }
+  X509* root() { return sk_X509_value(chain_, 1); }
+
+ private:
+  static X509* NewCert(long lifetime_s) {
+    X509* cert = X509_new();
+    X509_gmtime_adj(X509_getm_notAfter(cert), lifetime_s);
+    return cert;
+  }
+
+  STACK_OF(X509)* chain_;
+};
+
+std::vector<SslVerificationCache::CrlDependency> Dependencies(
+    CrlProvider* provider) {
+  std::vector<SslVerificationCache::CrlDependency> dependencies;
+  CertificateInfoImpl info("issuer");
+  dependencies.push_back({info, provider->GetCrl(info)});
+  return dependencies;
+}
+
+TEST(SslVerificationCacheTest, ReturnsVerifiedRoot) {
+  SslVerificationCache cache(/*capacity=*/4);
+  Chain chain;
+  Timestamp now = Timestamp::Now();
+  EXPECT_EQ(cache.Lookup("chain", nullptr, now), nullptr);
+  cache.Insert("chain", chain.get(), {}, now);
+  X509* root = cache.Lookup("chain", nullptr, now);
+  EXPECT_EQ(root, chain.root());
+  X509_free(root);
+  EXPECT_EQ(cache.Lookup("other chain", nullptr, now), nullptr);
+  EXPECT_EQ(cache.Size(), 1);
+}
+
+TEST(SslVerificationCacheTest, EntryExpiresWithFirstCertOfChain) {
+  SslVerificationCache cache(/*capacity=*/4);
+  Chain chain(/*leaf_lifetime_s=*/7200, /*root_lifetime_s=*/3600);
+  Timestamp now = Timestamp::Now();
+  cache.Insert("chain", chain.get(), {}, now);
+  X509* root = cache.Lookup("chain", nullptr, now + Duration::Seconds(3000));
+  EXPECT_NE(root, nullptr);
+  X509_free(root);
+  EXPECT_EQ(cache.Lookup("chain", nullptr, now + Duration::Seconds(3700)),
+            nullptr);
+  EXPECT_EQ(cache.Size(), 0);
+}
+
+TEST(SslVerificationCacheTest, ExpiredChainIsNotCached) {
+  SslVerificationCache cache(/*capacity=*/4);
+  Chain chain(/*leaf_lifetime_s=*/-10);
+  cache.Insert("chain", chain.get(), {}, Timestamp::Now());
+  EXPECT_EQ(cache.Size(), 0);
+}
+
+TEST(SslVerificationCacheTest, EntryIsDroppedWhenCrlsChange) {
+  SslVerificationCache cache(/*capacity=*/4);
+  FakeCrlProvider provider;
+  Chain chain;
+  Timestamp now = Timestamp::Now();
+  cache.Insert("chain", chain.get(), Dependencies(&provider), now);
+  X509* root = cache.Lookup("chain", &provider, now);
+  EXPECT_NE(root, nullptr);
+  X509_free(root);
+  provider.Reload();
+  EXPECT_EQ(cache.Lookup("chain", &provider, now), nullptr);
+  EXPECT_EQ(cache.Size(), 0);
+}
+
+TEST(SslVerificationCacheTest, EvictsLeastRecentlyUsedEntry) {
+  SslVerificationCache cache(/*capacity=*/2);
+  Chain chain;
+  Timestamp now = Timestamp::Now();
+  cache.Insert("first", chain.get(), {}, now);
+  cache.Insert("second", chain.get(), {}, now);
+  X509_free(cache.Lookup("first", nullptr, now));
+  cache.Insert("third", chain.get(), {}, now);
+  EXPECT_EQ(cache.Size(), 2);
+  EXPECT_EQ(cache.Lookup("second", nullptr, now), nullptr);
+  X509* root = cache.Lookup("first", nullptr, now);
+  EXPECT_NE(root, nullptr);
+  X509_free(root);
+  root = cache.Lookup("third", nullptr, now);
+  EXPECT_NE(root, nullptr);
+  X509_free(root);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
@@ -360,6 +360,17 @@ TEST(TransportSecurityTest, TestProtectorInvalidArgs) {
   ASSERT_EQ(tsi_frame_protector_unprotect(nullptr, nullptr, nullptr, nullptr,
                                           nullptr),
             TSI_INVALID_ARGUMENT);
+  ASSERT_EQ(tsi_frame_protector_offload_protect(nullptr, 0),
+            TSI_INVALID_ARGUMENT);
+}
+
+TEST(TransportSecurityTest, TestProtectorOffloadUnimplemented) {
+  tsi_frame_protector* protector = tsi_create_fake_frame_protector(nullptr);
+  ASSERT_EQ(tsi_frame_protector_offload_protect(protector, -1),
+            TSI_INVALID_ARGUMENT);
+  ASSERT_EQ(tsi_frame_protector_offload_protect(protector, 0),
+            TSI_UNIMPLEMENTED);
+  tsi_frame_protector_destroy(protector);
 }
 
 TEST(TransportSecurityTest, TestHandshakerInvalidArgs) {
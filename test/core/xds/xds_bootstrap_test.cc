@@ -731,13 +731,15 @@ TEST(XdsBootstrapTest, XdsServerToJsonAndParse) {
       "      \"ignore\": 0,"
       "      \"server_features\": ["
       "        \"ignore_resource_deletion\","
-      "        \"trusted_xds_server\""
+      "        \"trusted_xds_server\","
+      "        \"delta_xds\""
       "      ]"
       "    }";
   auto json = JsonParse(json_str);
   ASSERT_TRUE(json.ok()) << json.status();
   auto xds_server = LoadFromJson<GrpcXdsServer>(*json);
   ASSERT_TRUE(xds_server.ok()) << xds_server.status();
+  EXPECT_TRUE(xds_server->UseDeltaProtocol());
   Json output = xds_server->ToJson();
   auto output_xds_server = LoadFromJson<GrpcXdsServer>(output);
   ASSERT_TRUE(output_xds_server.ok()) << output_xds_server.status();
@@ -72,6 +72,8 @@
 // IWYU pragma: no_include "google/protobuf/json/json.h"
 // IWYU pragma: no_include "google/protobuf/util/json_util.h"
 
+using envoy::service::discovery::v3::DeltaDiscoveryRequest;
+using envoy::service::discovery::v3::DeltaDiscoveryResponse;
 using envoy::service::discovery::v3::DiscoveryRequest;
 using envoy::service::discovery::v3::DiscoveryResponse;
 
@@ -131,25 +133,31 @@ class XdsClientTest : public ::testing::Test {
      public:
       explicit FakeXdsServer(
           absl::string_view server_uri = kDefaultXdsServerUrl,
-          bool ignore_resource_deletion = false)
+          bool ignore_resource_deletion = false,
+          bool use_delta_protocol = false)
           : server_uri_(server_uri),
-            ignore_resource_deletion_(ignore_resource_deletion) {}
+            ignore_resource_deletion_(ignore_resource_deletion),
+            use_delta_protocol_(use_delta_protocol) {}
       const std::string& server_uri() const override { return server_uri_; }
       bool IgnoreResourceDeletion() const override {
         return ignore_resource_deletion_;
       }
+      bool UseDeltaProtocol() const override { return use_delta_protocol_; }
       bool Equals(const XdsServer& other) const override {
         const auto& o = static_cast<const FakeXdsServer&>(other);
         return server_uri_ == o.server_uri_ &&
-               ignore_resource_deletion_ == o.ignore_resource_deletion_;
+               ignore_resource_deletion_ == o.ignore_resource_deletion_ &&
+               use_delta_protocol_ == o.use_delta_protocol_;
       }
       std::string Key() const override {
-        return absl::StrCat(server_uri_, "#", ignore_resource_deletion_);
+        return absl::StrCat(server_uri_, "#", ignore_resource_deletion_, "#",
+                            use_delta_protocol_);
       }
 
      private:
       std::string server_uri_;
       bool ignore_resource_deletion_ = false;
+      bool use_delta_protocol_ = false;
     };
 
     class FakeAuthority : public Authority {
@@ -635,6 +643,10 @@ class XdsClientTest : public ::testing::Test {
       MutexLock lock(&mu_);
       return resource_updates_invalid_;
     }
+    ResourceUpdateMap resource_decodes_skipped() const {
+      MutexLock lock(&mu_);
+      return resource_decodes_skipped_;
+    }
     const ServerFailureMap& server_failures() const { return server_failures_; }
 
     // Returns true if matchers return true before the timeout.
@@ -685,6 +697,14 @@ class XdsClientTest : public ::testing::Test {
       cond_.SignalAll();
     }
 
+    void ReportResourceDecodesSkipped(absl::string_view xds_server,
+                                      absl::string_view resource_type,
+                                      uint64_t num_skipped) override {
+      MutexLock lock(&mu_);
+      resource_decodes_skipped_[std::make_pair(
+          std::string(xds_server), std::string(resource_type))] += num_skipped;
+    }
+
     void ReportServerFailure(absl::string_view xds_server) override {
       MutexLock lock(&mu_);
       ++server_failures_[std::string(xds_server)];
@@ -694,6 +714,7 @@ class XdsClientTest : public ::testing::Test {
     mutable Mutex mu_;
     ResourceUpdateMap resource_updates_valid_ ABSL_GUARDED_BY(mu_);
     ResourceUpdateMap resource_updates_invalid_ ABSL_GUARDED_BY(mu_);
+    ResourceUpdateMap resource_decodes_skipped_ ABSL_GUARDED_BY(mu_);
     ServerFailureMap server_failures_ ABSL_GUARDED_BY(mu_);
     CondVar cond_;
   };
@@ -821,6 +842,22 @@ class XdsClientTest : public ::testing::Test {
     return std::move(request);
   }
 
+  // Gets the latest request sent to the fake xDS server on a delta stream.
+  absl::optional<DeltaDiscoveryRequest> WaitForDeltaRequest(
+      FakeXdsTransportFactory::FakeStreamingCall* stream,
+      absl::Duration timeout = absl::Seconds(3),
+      SourceLocation location = SourceLocation()) {
+    auto message =
+        stream->WaitForMessageFromClient(timeout * grpc_test_slowdown_factor());
+    if (!message.has_value()) return absl::nullopt;
+    DeltaDiscoveryRequest request;
+    bool success = request.ParseFromString(*message);
+    EXPECT_TRUE(success) << "Failed to deserialize DeltaDiscoveryRequest at "
+                         << location.file() << ":" << location.line();
+    if (!success) return absl::nullopt;
+    return std::move(request);
+  }
+
   // Helper function to check the fields of a DiscoveryRequest.
   void CheckRequest(const DiscoveryRequest& request, absl::string_view type_url,
                     absl::string_view version_info,
@@ -1445,6 +1482,57 @@ TEST_F(XdsClientTest, UpdateContainsOnlyChangedResource) {
   EXPECT_TRUE(stream->Orphaned());
 }
 
+TEST_F(XdsClientTest, UnchangedResourceNotDecodedAgain) {
+  InitXdsClient();
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Send a response.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // The server resends the same resource, both unwrapped and wrapped.
+  for (bool in_resource_wrapper : {false, true}) {
+    stream->SendMessageToClient(
+        ResponseBuilder(XdsFooResourceType::Get()->type_url())
+            .set_version_info("2")
+            .set_nonce("B")
+            .AddFooResource(XdsFooResource("foo1", 6), in_resource_wrapper)
+            .Serialize());
+    request = WaitForRequest(stream.get());
+    ASSERT_TRUE(request.has_value());
+    CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+                 /*version_info=*/"2", /*response_nonce=*/"B",
+                 /*error_detail=*/absl::OkStatus(),
+                 /*resource_names=*/{"foo1"});
+  }
+  // The resource is still counted as valid, but was not decoded again.
+  EXPECT_TRUE(metrics_reporter_->WaitForMetricsReporterData(
+      ::testing::ElementsAre(::testing::Pair(
+          ::testing::Pair(kDefaultXdsServerUrl,
+                          XdsFooResourceType::Get()->type_url()),
+          3)),
+      ::testing::ElementsAre(), ::testing::_));
+  EXPECT_THAT(metrics_reporter_->resource_decodes_skipped(),
+              ::testing::ElementsAre(::testing::Pair(
+                  ::testing::Pair(kDefaultXdsServerUrl,
+                                  XdsFooResourceType::Get()->type_url()),
+                  2)));
+  EXPECT_FALSE(watcher->HasEvent());
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
 TEST_F(XdsClientTest, ResourceValidationFailure) {
   InitXdsClient();
   // Start a watch for "foo1".
@@ -2217,6 +2305,74 @@ TEST_F(XdsClientTest, ResourceDeletionIgnoredWhenConfigured) {
   EXPECT_TRUE(stream->Orphaned());
 }
 
+TEST_F(XdsClientTest, DeltaProtocol) {
+  InitXdsClient(FakeXdsBootstrap::Builder().SetServers(
+      {FakeXdsBootstrap::FakeXdsServer(kDefaultXdsServerUrl,
+                                       /*ignore_resource_deletion=*/false,
+                                       /*use_delta_protocol=*/true)}));
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created a delta ADS stream.
+  auto stream = transport_factory_->WaitForStream(
+      *xds_client_->bootstrap().servers().front(),
+      FakeXdsTransportFactory::kDeltaAdsMethod,
+      absl::Seconds(5) * grpc_test_slowdown_factor());
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_EQ(request->type_url(),
+            absl::StrCat("type.googleapis.com/",
+                         XdsFooResourceType::Get()->type_url()));
+  EXPECT_THAT(request->resource_names_subscribe(),
+              ::testing::ElementsAre("foo1"));
+  EXPECT_THAT(request->resource_names_unsubscribe(), ::testing::ElementsAre());
+  EXPECT_EQ(request->node().user_agent_name(), "foo agent");
+  // Send a response.
+  DeltaDiscoveryResponse response;
+  response.set_type_url(absl::StrCat("type.googleapis.com/",
+                                     XdsFooResourceType::Get()->type_url()));
+  response.set_nonce("A");
+  auto* resource = response.add_resources();
+  resource->set_name("foo1");
+  resource->set_version("7");
+  *resource->mutable_resource() =
+      XdsFooResourceType::EncodeAsAny(XdsFooResource("foo1", 6));
+  stream->SendMessageToClient(response.SerializeAsString());
+  auto foo = watcher->WaitForNextResource();
+  ASSERT_NE(foo, nullptr);
+  EXPECT_EQ(foo->value, 6);
+  // The ACK carries the nonce and no subscription changes.
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_EQ(request->response_nonce(), "A");
+  EXPECT_FALSE(request->has_error_detail());
+  EXPECT_THAT(request->resource_names_subscribe(), ::testing::ElementsAre());
+  EXPECT_FALSE(request->has_node());
+  // Subscribing to another resource sends only the new name.
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_THAT(request->resource_names_subscribe(),
+              ::testing::ElementsAre("foo2"));
+  // An explicit removal reports the resource as not existing.
+  response.clear_resources();
+  response.set_nonce("B");
+  response.add_removed_resources("foo2");
+  stream->SendMessageToClient(response.SerializeAsString());
+  EXPECT_TRUE(watcher2->WaitForDoesNotExist(absl::Seconds(1)));
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_EQ(request->response_nonce(), "B");
+  // Cancelling a watch sends only the removed name.
+  CancelFooWatch(watcher2.get(), "foo2");
+  request = WaitForDeltaRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  EXPECT_THAT(request->resource_names_subscribe(), ::testing::ElementsAre());
+  EXPECT_THAT(request->resource_names_unsubscribe(),
+              ::testing::ElementsAre("foo2"));
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
 TEST_F(XdsClientTest, StreamClosedByServer) {
   InitXdsClient();
   // Metrics should initially be empty.
@@ -18,6 +18,7 @@
 #define GRPC_TEST_CORE_XDS_XDS_CLIENT_TEST_PEER_H
 
 #include <set>
+#include <vector>
 
 #include "absl/functional/function_ref.h"
 #include "absl/strings/str_cat.h"
@@ -37,8 +38,13 @@ class XdsClientTestPeer {
     upb::Arena arena;
     auto client_config = envoy_service_status_v3_ClientConfig_new(arena.ptr());
     std::set<std::string> string_pool;
-    MutexLock lock(xds_client_->mu());
-    xds_client_->DumpClientConfig(&string_pool, arena.ptr(), client_config);
+    std::vector<XdsClient::ResourceConfigSnapshot> snapshot;
+    {
+      MutexLock lock(xds_client_->mu());
+      snapshot = xds_client_->SnapshotResourceConfigs();
+    }
+    xds_client_->DumpClientConfig(snapshot, &string_pool, arena.ptr(),
+                                  client_config);
   }
 
   struct ResourceCountLabels {
@@ -787,12 +787,124 @@ TEST_F(LbPolicyTest, EnumLbPolicyRingHashUnsupportedHashFunction) {
       << decode_result.resource.status();
 }
 
-TEST_F(LbPolicyTest, EnumUnsupportedPolicy) {
+TEST_F(LbPolicyTest, EnumLbPolicyLeastRequest) {
+  Cluster cluster;
+  cluster.set_name("foo");
+  cluster.set_type(cluster.EDS);
+  cluster.mutable_eds_cluster_config()->mutable_eds_config()->mutable_self();
+  cluster.set_lb_policy(cluster.LEAST_REQUEST);
+  cluster.mutable_least_request_lb_config()->mutable_choice_count()->set_value(
+      3);
+  std::string serialized_resource;
+  ASSERT_TRUE(cluster.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsClusterResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  ASSERT_TRUE(decode_result.resource.ok()) << decode_result.resource.status();
+  ASSERT_TRUE(decode_result.name.has_value());
+  EXPECT_EQ(*decode_result.name, "foo");
+  auto& resource =
+      static_cast<const XdsClusterResource&>(**decode_result.resource);
+  EXPECT_EQ(JsonDump(Json::FromArray(resource.lb_policy_config)),
+            "[{\"xds_wrr_locality_experimental\":{"
+            "\"childPolicy\":[{\"least_request_experimental\":{"
+            "\"choiceCount\":3}}]}}]");
+}
+
+TEST_F(LbPolicyTest, EnumLbPolicyLeastRequestChoiceCountTooSmall) {
+  Cluster cluster;
+  cluster.set_name("foo");
+  cluster.set_type(cluster.EDS);
+  cluster.mutable_eds_cluster_config()->mutable_eds_config()->mutable_self();
+  cluster.set_lb_policy(cluster.LEAST_REQUEST);
+  cluster.mutable_least_request_lb_config()->mutable_choice_count()->set_value(
+      1);
+  std::string serialized_resource;
+  ASSERT_TRUE(cluster.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsClusterResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  ASSERT_TRUE(decode_result.name.has_value());
+  EXPECT_EQ(*decode_result.name, "foo");
+  EXPECT_EQ(decode_result.resource.status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(decode_result.resource.status().message(),
+            "errors validating Cluster resource: ["
+            "field:least_request_lb_config.choice_count "
+            "error:must be at least 2]")
+      << decode_result.resource.status();
+}
+
+TEST_F(LbPolicyTest, EnumLbPolicyMaglev) {
+  Cluster cluster;
+  cluster.set_name("foo");
+  cluster.set_type(cluster.EDS);
+  cluster.mutable_eds_cluster_config()->mutable_eds_config()->mutable_self();
+  cluster.set_lb_policy(cluster.MAGLEV);
+  std::string serialized_resource;
+  ASSERT_TRUE(cluster.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsClusterResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  ASSERT_TRUE(decode_result.resource.ok()) << decode_result.resource.status();
+  ASSERT_TRUE(decode_result.name.has_value());
+  EXPECT_EQ(*decode_result.name, "foo");
+  auto& resource =
+      static_cast<const XdsClusterResource&>(**decode_result.resource);
+  EXPECT_EQ(JsonDump(Json::FromArray(resource.lb_policy_config)),
+            "[{\"maglev_experimental\":{\"tableSize\":65537}}]");
+}
+
+TEST_F(LbPolicyTest, EnumLbPolicyMaglevSetTableSize) {
+  Cluster cluster;
+  cluster.set_name("foo");
+  cluster.set_type(cluster.EDS);
+  cluster.mutable_eds_cluster_config()->mutable_eds_config()->mutable_self();
+  cluster.set_lb_policy(cluster.MAGLEV);
+  cluster.mutable_maglev_lb_config()->mutable_table_size()->set_value(251);
+  std::string serialized_resource;
+  ASSERT_TRUE(cluster.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsClusterResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  ASSERT_TRUE(decode_result.resource.ok()) << decode_result.resource.status();
+  ASSERT_TRUE(decode_result.name.has_value());
+  EXPECT_EQ(*decode_result.name, "foo");
+  auto& resource =
+      static_cast<const XdsClusterResource&>(**decode_result.resource);
+  EXPECT_EQ(JsonDump(Json::FromArray(resource.lb_policy_config)),
+            "[{\"maglev_experimental\":{\"tableSize\":251}}]");
+}
+
+TEST_F(LbPolicyTest, EnumLbPolicyMaglevTableSizeNotPrime) {
   Cluster cluster;
   cluster.set_name("foo");
   cluster.set_type(cluster.EDS);
   cluster.mutable_eds_cluster_config()->mutable_eds_config()->mutable_self();
   cluster.set_lb_policy(cluster.MAGLEV);
+  cluster.mutable_maglev_lb_config()->mutable_table_size()->set_value(1000);
+  std::string serialized_resource;
+  ASSERT_TRUE(cluster.SerializeToString(&serialized_resource));
+  auto* resource_type = XdsClusterResourceType::Get();
+  auto decode_result =
+      resource_type->Decode(decode_context_, serialized_resource);
+  ASSERT_TRUE(decode_result.name.has_value());
+  EXPECT_EQ(*decode_result.name, "foo");
+  EXPECT_EQ(decode_result.resource.status().code(),
+            absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(decode_result.resource.status().message(),
+            "errors validating Cluster resource: ["
+            "field:maglev_lb_config.table_size "
+            "error:must be a prime number no larger than 5000011]")
+      << decode_result.resource.status();
+}
+
+TEST_F(LbPolicyTest, EnumUnsupportedPolicy) {
+  Cluster cluster;
+  cluster.set_name("foo");
+  cluster.set_type(cluster.EDS);
+  cluster.mutable_eds_cluster_config()->mutable_eds_config()->mutable_self();
+  cluster.set_lb_policy(cluster.CLUSTER_PROVIDED);
   std::string serialized_resource;
   ASSERT_TRUE(cluster.SerializeToString(&serialized_resource));
   auto* resource_type = XdsClusterResourceType::Get();
@@ -0,0 +1,232 @@
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/xds/grpc/xds_routing.h"
+
+#include <stddef.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include "src/core/lib/matchers/matchers.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "src/core/xds/grpc/xds_route_config.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class VirtualHostList final : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHostList(std::vector<std::vector<std::string>> domains)
+      : domains_(std::move(domains)) {}
+
+  size_t Size() const override { return domains_.size(); }
+
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  std::vector<std::vector<std::string>> domains_;
+};
+
+// Checks that the index gives the same result as matching the domain
+// against each pattern.
+void ExpectVirtualHost(const VirtualHostList& vhosts, absl::string_view domain,
+                       absl::optional<size_t> expected) {
+  XdsVirtualHostIndex index(vhosts);
+  EXPECT_EQ(index.Find(domain), expected) << domain;
+  EXPECT_EQ(XdsRouting::FindVirtualHostForDomain(vhosts, domain), expected)
+      << domain;
+}
+
+TEST(XdsVirtualHostIndexTest, MatchTypePrecedence) {
+  VirtualHostList vhosts({{"*"},
+                          {"foo.*"},
+                          {"*.example.com"},
+                          {"Foo.Example.com", "bar.example.com"}});
+  ExpectVirtualHost(vhosts, "foo.example.com", 3);
+  ExpectVirtualHost(vhosts, "BAR.example.com", 3);
+  ExpectVirtualHost(vhosts, "baz.example.com", 2);
+  ExpectVirtualHost(vhosts, "foo.test", 1);
+  ExpectVirtualHost(vhosts, "bar.test", 0);
+}
+
+TEST(XdsVirtualHostIndexTest, LongestWildcardWins) {
+  VirtualHostList vhosts({{"*.com", "foo.*"},
+                          {"*.example.com"},
+                          {"foo.example.*"},
+                          {"*.example.com"}});
+  ExpectVirtualHost(vhosts, "a.example.com", 1);
+  ExpectVirtualHost(vhosts, "a.test.com", 0);
+  ExpectVirtualHost(vhosts, "foo.example.org", 2);
+  ExpectVirtualHost(vhosts, "foo.bar", 0);
+}
+
+TEST(XdsVirtualHostIndexTest, AsteriskMatchesAtLeastOneChar) {
+  VirtualHostList vhosts({{"*foo.com"}, {"bar*"}});
+  ExpectVirtualHost(vhosts, "foo.com", absl::nullopt);
+  ExpectVirtualHost(vhosts, "xfoo.com", 0);
+  ExpectVirtualHost(vhosts, "bar", absl::nullopt);
+  ExpectVirtualHost(vhosts, "bar1", 1);
+}
+
+using Matchers = XdsRouteConfigResource::Route::Matchers;
+
+class RouteList final : public XdsRouting::RouteListIterator {
+ public:
+  size_t Size() const override { return routes_.size(); }
+
+  const Matchers& GetMatchersForRoute(size_t index) const override {
+    return routes_[index];
+  }
+
+  RouteList& Add(StringMatcher::Type type, absl::string_view path,
+                 bool case_sensitive = true,
+                 std::vector<HeaderMatcher> header_matchers = {}) {
+    Matchers matchers;
+    matchers.path_matcher =
+        StringMatcher::Create(type, path, case_sensitive).value();
+    matchers.header_matchers = std::move(header_matchers);
+    routes_.push_back(std::move(matchers));
+    return *this;
+  }
+
+ private:
+  std::vector<Matchers> routes_;
+};
+
+// Checks that the route table gives the same result as evaluating the
+// routes one by one.
+void ExpectRoute(const RouteList& routes, absl::string_view path,
+                 absl::optional<size_t> expected,
+                 grpc_metadata_batch* initial_metadata = nullptr) {
+  grpc_metadata_batch empty_metadata;
+  if (initial_metadata == nullptr) initial_metadata = &empty_metadata;
+  XdsRouting::RouteTable route_table(routes);
+  EXPECT_EQ(route_table.GetRouteForRequest(path, initial_metadata), expected)
+      << path;
+  EXPECT_EQ(XdsRouting::GetRouteForRequest(routes, path, initial_metadata),
+            expected)
+      << path;
+}
+
+TEST(XdsRoutingRouteTableTest, FirstMatchingRouteWins) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kPrefix, "/foo.Service/")
+      .Add(StringMatcher::Type::kExact, "/foo.Service/Method")
+      .Add(StringMatcher::Type::kExact, "/bar.Service/Method")
+      .Add(StringMatcher::Type::kPrefix, "/bar.")
+      .Add(StringMatcher::Type::kPrefix, "");
+  ExpectRoute(routes, "/foo.Service/Method", 0);
+  ExpectRoute(routes, "/bar.Service/Method", 2);
+  ExpectRoute(routes, "/bar.Service/Other", 3);
+  ExpectRoute(routes, "/baz.Service/Method", 4);
+}
+
+TEST(XdsRoutingRouteTableTest, NoMatch) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/foo.Service/Method")
+      .Add(StringMatcher::Type::kPrefix, "/bar.Service/");
+  ExpectRoute(routes, "/foo.Service/Other", absl::nullopt);
+  ExpectRoute(routes, "/bar.Service", absl::nullopt);
+}
+
+TEST(XdsRoutingRouteTableTest, CaseInsensitive) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/Foo.Service/Method")
+      .Add(StringMatcher::Type::kExact, "/FOO.service/method",
+           /*case_sensitive=*/false)
+      .Add(StringMatcher::Type::kPrefix, "/BAR.", /*case_sensitive=*/false);
+  ExpectRoute(routes, "/Foo.Service/Method", 0);
+  ExpectRoute(routes, "/foo.Service/Method", 1);
+  ExpectRoute(routes, "/bar.Service/Method", 2);
+  ExpectRoute(routes, "/baz.Service/Method", absl::nullopt);
+}
+
+TEST(XdsRoutingRouteTableTest, Regex) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kSafeRegex, "/foo\\..*/Get.*")
+      .Add(StringMatcher::Type::kExact, "/foo.Service/GetThing")
+      .Add(StringMatcher::Type::kSafeRegex, "/foo\\..*")
+      .Add(StringMatcher::Type::kSafeRegex, "/foo");
+  ExpectRoute(routes, "/foo.Service/GetThing", 0);
+  ExpectRoute(routes, "/foo.Service/SetThing", 2);
+  // Regexes must match the whole path.
+  ExpectRoute(routes, "/foobar", absl::nullopt);
+}
+
+TEST(XdsRoutingRouteTableTest, HeadersEvaluatedForCandidatesInOrder) {
+  RouteList routes;
+  routes
+      .Add(StringMatcher::Type::kPrefix, "/",
+           /*case_sensitive=*/true,
+           {HeaderMatcher::Create("x-env", HeaderMatcher::Type::kExact,
+                                  "canary")
+                .value()})
+      .Add(StringMatcher::Type::kExact, "/foo.Service/Method",
+           /*case_sensitive=*/true,
+           {HeaderMatcher::Create("x-env", HeaderMatcher::Type::kExact,
+                                  "prod")
+                .value()})
+      .Add(StringMatcher::Type::kPrefix, "/foo.");
+  ExpectRoute(routes, "/foo.Service/Method", 2);
+  for (const auto& p : std::vector<std::pair<std::string, size_t>>{
+           {"canary", 0}, {"prod", 1}}) {
+    grpc_metadata_batch metadata;
+    metadata.Append("x-env", Slice::FromCopiedString(p.first),
+                    [&](absl::string_view error, const Slice& value) {
+                      FAIL() << error << " value:" << value.as_string_view();
+                    });
+    ExpectRoute(routes, "/foo.Service/Method", p.second, &metadata);
+  }
+}
+
+TEST(XdsRoutingRouteTableTest, ManyRoutes) {
+  RouteList routes;
+  for (int i = 0; i < 2000; ++i) {
+    routes.Add(StringMatcher::Type::kExact,
+               absl::StrCat("/pkg.Service", i / 10, "/Method", i % 10));
+  }
+  for (int i = 0; i < 200; ++i) {
+    routes.Add(StringMatcher::Type::kPrefix,
+               absl::StrCat("/pkg.Service", i, "/"));
+  }
+  ExpectRoute(routes, "/pkg.Service12/Method3", 123);
+  ExpectRoute(routes, "/pkg.Service12/Method10", 2012);
+  ExpectRoute(routes, "/pkg.Service1/Method10", 2001);
+  ExpectRoute(routes, "/pkg.Service200/Method0", absl::nullopt);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
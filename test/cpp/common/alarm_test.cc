@@ -19,6 +19,7 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -434,6 +435,35 @@ TEST(AlarmTest, CallbackSetDestruction) {
       [c] { return c->completed; }));
 }
 
+TEST(AlarmTest, CancelledAlarmsReadInBatches) {
+  CompletionQueue cq;
+  constexpr size_t kNumAlarms = 5;
+  Alarm alarms[kNumAlarms];
+  for (size_t i = 0; i < kNumAlarms; i++) {
+    alarms[i].Set(&cq, grpc_timeout_seconds_to_deadline(10),
+                  reinterpret_cast<void*>(i + 1));
+    alarms[i].Cancel();
+  }
+
+  std::set<void*> tags;
+  while (tags.size() < kNumAlarms) {
+    CompletionQueue::Event events[3];
+    const size_t n = cq.NextBatch(events, 3);
+    ASSERT_GE(n, 1u);
+    ASSERT_LE(n, 3u);
+    for (size_t i = 0; i < n; i++) {
+      EXPECT_FALSE(events[i].ok);
+      EXPECT_TRUE(tags.insert(events[i].tag).second);
+    }
+  }
+  EXPECT_EQ(*tags.begin(), reinterpret_cast<void*>(1));
+  EXPECT_EQ(*tags.rbegin(), reinterpret_cast<void*>(kNumAlarms));
+
+  cq.Shutdown();
+  CompletionQueue::Event event;
+  EXPECT_EQ(cq.NextBatch(&event, 1), 0u);
+}
+
 TEST(AlarmTest, UnsetDestruction) {
   CompletionQueue cq;
   Alarm alarm;
@@ -88,6 +88,13 @@ TEST_F(AdminServicesTest, ValidateRegisteredServices) {
               ::testing::Contains(
                   "envoy.service.status.v3.ClientStatusDiscoveryService"));
 #endif  // GRPC_NO_XDS or DISABLED_XDS_PROTO_IN_CC
+#ifdef GRPC_ENABLE_LATENT_SEE
+  EXPECT_THAT(GetServiceList(),
+              ::testing::Contains("grpc.latent_see.v1.LatentSee"));
+#else
+  EXPECT_THAT(GetServiceList(), ::testing::Not(::testing::Contains(
+                                    "grpc.latent_see.v1.LatentSee")));
+#endif  // GRPC_ENABLE_LATENT_SEE
 }
 
 }  // namespace testing
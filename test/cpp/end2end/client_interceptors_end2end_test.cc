@@ -16,6 +16,7 @@
 //
 //
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -711,6 +712,35 @@ class LoggingInterceptorFactory
   }
 };
 
+// Counts the batches it is run for, and the ones with the status of the RPC.
+// Shared by all the RPCs, and run for the batches with the status only.
+class StatusCountingInterceptor : public experimental::Interceptor {
+ public:
+  struct Counts {
+    std::atomic<int> batches{0};
+    std::atomic<int> statuses{0};
+  };
+
+  explicit StatusCountingInterceptor(Counts* counts) : counts_(counts) {}
+
+  void Intercept(experimental::InterceptorBatchMethods* methods) override {
+    counts_->batches++;
+    if (methods->QueryInterceptionHookPoint(
+            experimental::InterceptionHookPoints::POST_RECV_STATUS)) {
+      counts_->statuses++;
+    }
+    methods->Proceed();
+  }
+
+ private:
+  Counts* const counts_;
+};
+
+using StatusCountingInterceptorFactory =
+    experimental::StatelessClientInterceptorFactory<
+        StatusCountingInterceptor,
+        experimental::InterceptionHookPoints::POST_RECV_STATUS>;
+
 class TestScenario {
  public:
   explicit TestScenario(const ChannelType& channel_type,
@@ -944,6 +974,47 @@ TEST_F(ClientInterceptorsEnd2endTest,
   EXPECT_EQ(PhonyInterceptor::GetNumTimesRun(), 12);
 }
 
+TEST_F(ClientInterceptorsEnd2endTest,
+       ClientInterceptorSubscribedHookPointsTest) {
+  ChannelArguments args;
+  StatusCountingInterceptor::Counts counts;
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+      creators;
+  creators.push_back(
+      std::make_unique<StatusCountingInterceptorFactory>(&counts));
+  creators.push_back(std::make_unique<LoggingInterceptorFactory>());
+  auto channel = experimental::CreateCustomChannelWithInterceptors(
+      server_address_, InsecureChannelCredentials(), args, std::move(creators));
+  for (int i = 0; i < 3; i++) {
+    MakeCall(channel);
+  }
+  LoggingInterceptor::VerifyUnaryCall();
+  // The shared interceptor only saw the batches with the status.
+  EXPECT_EQ(counts.batches, 3);
+  EXPECT_EQ(counts.statuses, 3);
+}
+
+TEST_F(ClientInterceptorsEnd2endTest,
+       ClientInterceptorSubscribedHookPointsHijackingTest) {
+  ChannelArguments args;
+  StatusCountingInterceptor::Counts before_hijacking;
+  StatusCountingInterceptor::Counts after_hijacking;
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+      creators;
+  creators.push_back(
+      std::make_unique<StatusCountingInterceptorFactory>(&before_hijacking));
+  creators.push_back(std::make_unique<HijackingInterceptorFactory>());
+  creators.push_back(
+      std::make_unique<StatusCountingInterceptorFactory>(&after_hijacking));
+  auto channel = experimental::CreateCustomChannelWithInterceptors(
+      server_address_, nullptr, args, std::move(creators));
+  MakeCall(channel);
+  // The status the hijacking interceptor makes up goes up the stack only.
+  EXPECT_EQ(before_hijacking.batches, 1);
+  EXPECT_EQ(before_hijacking.statuses, 1);
+  EXPECT_EQ(after_hijacking.batches, 0);
+}
+
 class ClientInterceptorsCallbackEnd2endTest : public ::testing::Test {
  protected:
   ClientInterceptorsCallbackEnd2endTest() {
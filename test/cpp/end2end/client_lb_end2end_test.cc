@@ -32,6 +32,8 @@
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 
 #include <grpc/event_engine/endpoint_config.h>
 #include <grpc/grpc.h>
@@ -992,6 +994,66 @@ TEST_F(PickFirstTest, BackOffInitialReconnect) {
             (kInitialBackOffMs * grpc_test_slowdown_factor()) * 1.3);
 }
 
+TEST_F(PickFirstTest, AllQueuedPicksResumedOnPickerUpdate) {
+  constexpr size_t kNumRpcs = 300;
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS,
+              100 * grpc_test_slowdown_factor());
+  const std::vector<int> ports = {grpc_pick_unused_port_or_die()};
+  FakeResolverResponseGeneratorWrapper response_generator;
+  auto channel = BuildChannel("pick_first", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(ports);
+  // The server is not up yet, so the channel goes into TRANSIENT_FAILURE.
+  ASSERT_TRUE(WaitForChannelState(
+      channel.get(),
+      [&](grpc_connectivity_state state) {
+        return state == GRPC_CHANNEL_TRANSIENT_FAILURE;
+      },
+      /*try_to_connect=*/true));
+  // Start wait_for_ready RPCs, whose picks are queued until the channel
+  // gets a picker that can pick the server.
+  struct Rpc {
+    ClientContext context;
+    EchoResponse response;
+    Status status;
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> reader;
+  };
+  std::vector<Rpc> rpcs(kNumRpcs);
+  CompletionQueue cq;
+  EchoRequest request;
+  request.set_message(kRequestMessage);
+  for (size_t i = 0; i < kNumRpcs; ++i) {
+    rpcs[i].context.set_wait_for_ready(true);
+    rpcs[i].context.set_deadline(grpc_timeout_milliseconds_to_deadline(
+        30000 * grpc_test_slowdown_factor()));
+    rpcs[i].reader = stub->AsyncEcho(&rpcs[i].context, request, &cq);
+    rpcs[i].reader->Finish(&rpcs[i].response, &rpcs[i].status,
+                           reinterpret_cast<void*>(i));
+  }
+  // Give the calls time to reach the LB queue.
+  absl::SleepFor(absl::Milliseconds(500 * grpc_test_slowdown_factor()));
+  // Once the server is up, the channel gets a new picker and every queued
+  // pick must be redone with it.
+  StartServers(1, ports);
+  for (size_t i = 0; i < kNumRpcs; ++i) {
+    void* tag;
+    bool ok;
+    ASSERT_TRUE(cq.Next(&tag, &ok));
+    EXPECT_TRUE(ok);
+  }
+  for (size_t i = 0; i < kNumRpcs; ++i) {
+    EXPECT_TRUE(rpcs[i].status.ok())
+        << "RPC " << i << ": " << rpcs[i].status.error_message();
+    EXPECT_EQ(rpcs[i].response.message(), kRequestMessage);
+  }
+  EXPECT_EQ(servers_[0]->service_.request_count(), kNumRpcs);
+  cq.Shutdown();
+  void* tag;
+  bool ok;
+  EXPECT_FALSE(cq.Next(&tag, &ok));
+}
+
 TEST_F(PickFirstTest, BackOffMinReconnect) {
   ChannelArguments args;
   constexpr int kMinReconnectBackOffMs = 1000;
@@ -2227,6 +2289,59 @@ TEST_F(RoundRobinTest, HealthCheckingServiceNamePerChannel) {
   EnableDefaultHealthCheckService(false);
 }
 
+TEST_F(RoundRobinTest, HealthCheckingSharedStreamsAcrossChannels) {
+  EnableDefaultHealthCheckService(true);
+  // Start server.
+  const int kNumServers = 1;
+  StartServers(kNumServers);
+  // Use the same channel creds for both channels, so that their subchannels
+  // to the backend share a health check stream.
+  auto channel_creds =
+      std::make_shared<FakeTransportSecurityChannelCredentials>();
+  // Each channel uses its own subchannel pool, so that it gets its own
+  // subchannel to the backend.
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  args.SetInt(GRPC_ARG_SHARE_HEALTH_CHECK_STREAMS, 1);
+  args.SetServiceConfigJSON(
+      "{\"healthCheckConfig\": "
+      "{\"serviceName\": \"health_check_service_name\"}}");
+  std::vector<int> ports = GetServersPorts();
+  FakeResolverResponseGeneratorWrapper response_generator1;
+  auto channel1 =
+      BuildChannel("round_robin", response_generator1, args, channel_creds);
+  auto stub1 = BuildStub(channel1);
+  response_generator1.SetNextResolution(ports);
+  FakeResolverResponseGeneratorWrapper response_generator2;
+  auto channel2 =
+      BuildChannel("round_robin", response_generator2, args, channel_creds);
+  auto stub2 = BuildStub(channel2);
+  response_generator2.SetNextResolution(ports);
+  // Neither channel becomes READY while the backend is not serving.
+  EXPECT_FALSE(WaitForChannelReady(channel1.get(), 1));
+  EXPECT_FALSE(WaitForChannelReady(channel2.get(), 1));
+  // Both channels see the backend becoming healthy.
+  servers_[0]->SetServingStatus("health_check_service_name", true);
+  CheckRpcSendOk(DEBUG_LOCATION, stub1, true /* wait_for_ready */);
+  CheckRpcSendOk(DEBUG_LOCATION, stub2, true /* wait_for_ready */);
+  // Each channel has its own connection to the backend.
+  EXPECT_EQ(2UL, servers_[0]->service_.clients().size());
+  // Both channels see the backend becoming unhealthy.
+  servers_[0]->SetServingStatus("health_check_service_name", false);
+  EXPECT_TRUE(WaitForChannelNotReady(channel1.get()));
+  EXPECT_TRUE(WaitForChannelNotReady(channel2.get()));
+  // Once the first channel is gone, the second one keeps following the
+  // health of the backend.
+  stub1.reset();
+  channel1.reset();
+  servers_[0]->SetServingStatus("health_check_service_name", true);
+  CheckRpcSendOk(DEBUG_LOCATION, stub2, true /* wait_for_ready */);
+  servers_[0]->SetServingStatus("health_check_service_name", false);
+  EXPECT_TRUE(WaitForChannelNotReady(channel2.get()));
+  // Clean up.
+  EnableDefaultHealthCheckService(false);
+}
+
 TEST_F(RoundRobinTest,
        HealthCheckingServiceNameChangesAfterSubchannelsCreated) {
   EnableDefaultHealthCheckService(true);
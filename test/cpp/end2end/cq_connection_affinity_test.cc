@@ -0,0 +1,167 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+void* tag(int i) { return reinterpret_cast<void*>(static_cast<intptr_t>(i)); }
+
+// A call requested on a server completion queue.
+struct RequestedCall {
+  ServerContext ctx;
+  EchoRequest request;
+  ServerAsyncResponseWriter<EchoResponse> responder{&ctx};
+};
+
+// A call started by the client.
+struct ClientCall {
+  ClientContext ctx;
+  EchoResponse response;
+  Status status;
+  std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> reader;
+};
+
+class CqConnectionAffinityTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumCqs = 2;
+
+  void SetUp() override {
+    port_ = grpc_pick_unused_port_or_die();
+    std::ostringstream server_address;
+    server_address << "localhost:" << port_;
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address.str(),
+                             InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    builder.experimental().EnableCompletionQueueConnectionAffinity();
+    for (int i = 0; i < kNumCqs; i++) {
+      cqs_.push_back(builder.AddCompletionQueue());
+    }
+    server_ = builder.BuildAndStart();
+    stub_ = EchoTestService::NewStub(CreateChannel(
+        server_address.str(), InsecureChannelCredentials()));
+  }
+
+  void TearDown() override {
+    // Cancels the calls the test leaves unfinished.
+    server_->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+    for (auto& cq : cqs_) {
+      cq->Shutdown();
+      void* ignored_tag;
+      bool ignored_ok;
+      while (cq->Next(&ignored_tag, &ignored_ok)) {
+      }
+    }
+    client_cq_.Shutdown();
+    void* ignored_tag;
+    bool ignored_ok;
+    while (client_cq_.Next(&ignored_tag, &ignored_ok)) {
+    }
+    grpc_recycle_unused_port(port_);
+  }
+
+  // Requests a call on the server completion queue \a cq_idx, with tag
+  // cq_idx + 1.
+  RequestedCall* RequestCall(int cq_idx) {
+    requested_calls_.push_back(std::make_unique<RequestedCall>());
+    RequestedCall* call = requested_calls_.back().get();
+    service_.RequestEcho(&call->ctx, &call->request, &call->responder,
+                         cqs_[cq_idx].get(), cqs_[cq_idx].get(),
+                         tag(cq_idx + 1));
+    return call;
+  }
+
+  ClientCall* StartCall() {
+    client_calls_.push_back(std::make_unique<ClientCall>());
+    ClientCall* call = client_calls_.back().get();
+    EchoRequest request;
+    request.set_message("affinity");
+    call->reader = stub_->AsyncEcho(&call->ctx, request, &client_cq_);
+    call->reader->Finish(&call->response, &call->status, call);
+    return call;
+  }
+
+  // Waits up to \a timeout_ms for a new call on the server completion queue
+  // \a cq_idx.
+  bool GotCall(int cq_idx, int timeout_ms) {
+    void* got_tag;
+    bool ok;
+    return cqs_[cq_idx]->AsyncNext(&got_tag, &ok,
+                                   grpc_timeout_milliseconds_to_deadline(
+                                       timeout_ms)) ==
+               CompletionQueue::GOT_EVENT &&
+           got_tag == tag(cq_idx + 1) && ok;
+  }
+
+  int port_;
+  EchoTestService::AsyncService service_;
+  std::vector<std::unique_ptr<ServerCompletionQueue>> cqs_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+  CompletionQueue client_cq_;
+  std::vector<std::unique_ptr<RequestedCall>> requested_calls_;
+  std::vector<std::unique_ptr<ClientCall>> client_calls_;
+};
+
+TEST_F(CqConnectionAffinityTest, CallsOfAConnectionStayOnItsCq) {
+  for (int i = 0; i < kNumCqs; i++) RequestCall(i);
+  StartCall();
+  // The first call lands on the CQ the connection is bound to.
+  int connection_cq = -1;
+  for (int attempt = 0; connection_cq < 0 && attempt < 100; attempt++) {
+    for (int i = 0; i < kNumCqs && connection_cq < 0; i++) {
+      if (GotCall(i, 100)) connection_cq = i;
+    }
+  }
+  ASSERT_GE(connection_cq, 0);
+  // The second call waits for a request on that CQ, even though the other
+  // one has a request for it.
+  StartCall();
+  const int other_cq = (connection_cq + 1) % kNumCqs;
+  EXPECT_FALSE(GotCall(other_cq, 1000));
+  RequestCall(connection_cq);
+  EXPECT_TRUE(GotCall(connection_cq, 10000));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
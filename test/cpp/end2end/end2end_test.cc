@@ -18,6 +18,7 @@
 
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include "absl/log/check.h"
 #include "absl/log/log.h"
@@ -1004,6 +1005,25 @@ TEST_P(End2endTest, RequestStreamTwoRequestsWithCoalescingApi) {
   EXPECT_TRUE(s.ok());
 }
 
+TEST_P(End2endTest, RequestStreamWriteBatch) {
+  ResetStub();
+  std::vector<EchoRequest> requests(3);
+  requests[0].set_message("a");
+  requests[1].set_message("b");
+  requests[2].set_message("c");
+  EchoResponse response;
+  ClientContext context;
+
+  auto stream = stub_->RequestStream(&context, &response);
+  EXPECT_TRUE(stream->WriteBatch(requests.begin(), requests.end(),
+                                 WriteOptions()));
+  EXPECT_TRUE(stream->WriteBatch(requests.begin(), requests.end(),
+                                 WriteOptions().set_last_message()));
+  Status s = stream->Finish();
+  EXPECT_EQ(response.message(), "abcabc");
+  EXPECT_TRUE(s.ok());
+}
+
 TEST_P(End2endTest, ResponseStream) {
   ResetStub();
   EchoRequest request;
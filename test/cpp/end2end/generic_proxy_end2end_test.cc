@@ -0,0 +1,169 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpcpp/generic/generic_proxy.h>
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/end2end/test_service_impl.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+using experimental::CallbackGenericProxyService;
+
+std::string Address(int port) { return "localhost:" + std::to_string(port); }
+
+class GenericProxyEnd2endTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    backend_port_ = grpc_pick_unused_port_or_die();
+    ServerBuilder backend_builder;
+    backend_builder.AddListeningPort(Address(backend_port_),
+                                     InsecureServerCredentials());
+    backend_builder.RegisterService(&backend_service_);
+    backend_ = backend_builder.BuildAndStart();
+
+    CallbackGenericProxyService::Options options;
+    options.rewrite_request =
+        [](const GenericCallbackServerContext& /*context*/,
+           std::string* /*method*/,
+           CallbackGenericProxyService::Metadata* metadata) {
+          metadata->emplace("x-proxied", "request");
+        };
+    options.rewrite_response =
+        [](CallbackGenericProxyService::Metadata* metadata) {
+          metadata->emplace("x-proxied-response", "response");
+        };
+    proxy_service_ = std::make_unique<CallbackGenericProxyService>(
+        CreateChannel(Address(backend_port_), InsecureChannelCredentials()),
+        std::move(options));
+    proxy_port_ = grpc_pick_unused_port_or_die();
+    ServerBuilder proxy_builder;
+    proxy_builder.AddListeningPort(Address(proxy_port_),
+                                   InsecureServerCredentials());
+    proxy_builder.RegisterCallbackGenericService(proxy_service_.get());
+    proxy_ = proxy_builder.BuildAndStart();
+
+    stub_ = EchoTestService::NewStub(
+        CreateChannel(Address(proxy_port_), InsecureChannelCredentials()));
+  }
+
+  void TearDown() override {
+    proxy_->Shutdown();
+    backend_->Shutdown();
+    grpc_recycle_unused_port(proxy_port_);
+    grpc_recycle_unused_port(backend_port_);
+  }
+
+  int backend_port_;
+  int proxy_port_;
+  TestServiceImpl backend_service_;
+  std::unique_ptr<Server> backend_;
+  std::unique_ptr<CallbackGenericProxyService> proxy_service_;
+  std::unique_ptr<Server> proxy_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(GenericProxyEnd2endTest, UnaryForwardsMessagesAndMetadata) {
+  ClientContext context;
+  context.AddMetadata("x-client", "hello");
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("through the proxy");
+  request.mutable_param()->set_echo_metadata_initially(true);
+  request.mutable_param()->set_echo_metadata(true);
+  Status status = stub_->Echo(&context, request, &response);
+  ASSERT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(response.message(), request.message());
+  const auto& initial_metadata = context.GetServerInitialMetadata();
+  EXPECT_EQ(initial_metadata.count("x-client"), 1u);
+  EXPECT_EQ(initial_metadata.count("x-proxied"), 1u);
+  EXPECT_EQ(initial_metadata.count("x-proxied-response"), 1u);
+  const auto& trailing_metadata = context.GetServerTrailingMetadata();
+  EXPECT_EQ(trailing_metadata.count("x-client"), 1u);
+  EXPECT_EQ(trailing_metadata.count("x-proxied"), 1u);
+  EXPECT_EQ(trailing_metadata.count("x-proxied-response"), 1u);
+}
+
+TEST_F(GenericProxyEnd2endTest, UnaryForwardsStatus) {
+  ClientContext context;
+  EchoRequest request;
+  EchoResponse response;
+  request.set_message("error");
+  request.mutable_param()->mutable_expected_error()->set_code(
+      StatusCode::FAILED_PRECONDITION);
+  request.mutable_param()->mutable_expected_error()->set_error_message(
+      "from the backend");
+  Status status = stub_->Echo(&context, request, &response);
+  EXPECT_EQ(status.error_code(), StatusCode::FAILED_PRECONDITION);
+  EXPECT_EQ(status.error_message(), "from the backend");
+}
+
+TEST_F(GenericProxyEnd2endTest, BidiStreaming) {
+  ClientContext context;
+  auto stream = stub_->BidiStream(&context);
+  for (int i = 0; i < 5; i++) {
+    EchoRequest request;
+    EchoResponse response;
+    request.set_message("message " + std::to_string(i));
+    ASSERT_TRUE(stream->Write(request));
+    ASSERT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message());
+  }
+  ASSERT_TRUE(stream->WritesDone());
+  EchoResponse response;
+  EXPECT_FALSE(stream->Read(&response));
+  Status status = stream->Finish();
+  EXPECT_TRUE(status.ok()) << status.error_message();
+}
+
+TEST_F(GenericProxyEnd2endTest, ManyCalls) {
+  for (int i = 0; i < 100; i++) {
+    ClientContext context;
+    EchoRequest request;
+    EchoResponse response;
+    request.set_message(std::string(i * 100, 'a'));
+    Status status = stub_->Echo(&context, request, &response);
+    ASSERT_TRUE(status.ok()) << status.error_message();
+    EXPECT_EQ(response.message(), request.message());
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
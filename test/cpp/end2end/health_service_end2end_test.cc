@@ -311,6 +311,40 @@ TEST_F(HealthServiceEnd2endTest, DefaultHealthService) {
                      Status(StatusCode::INVALID_ARGUMENT, ""));
 }
 
+TEST_F(HealthServiceEnd2endTest, DefaultHealthServiceManyWatchers) {
+  EnableDefaultHealthCheckService(true);
+  EXPECT_TRUE(DefaultHealthCheckServiceEnabled());
+  SetUpServer(true, false, false, nullptr);
+  ResetStubs();
+  const std::string kServiceName("service_name");
+  HealthCheckServiceInterface* service = server_->GetHealthCheckService();
+  service->SetServingStatus(kServiceName, false);
+  constexpr int kNumWatchers = 10;
+  ClientContext contexts[kNumWatchers];
+  std::vector<std::unique_ptr<grpc::ClientReaderInterface<HealthCheckResponse>>>
+      readers;
+  HealthCheckRequest request;
+  request.set_service(kServiceName);
+  for (int i = 0; i < kNumWatchers; i++) {
+    readers.push_back(hc_stub_->Watch(&contexts[i], request));
+    HealthCheckResponse response;
+    EXPECT_TRUE(readers.back()->Read(&response));
+    EXPECT_EQ(response.NOT_SERVING, response.status());
+  }
+  // Setting the status the service already has sends nothing: the next update
+  // every watcher gets is the one to SERVING.
+  service->SetServingStatus(kServiceName, false);
+  service->SetServingStatus(kServiceName, true);
+  for (auto& reader : readers) {
+    HealthCheckResponse response;
+    EXPECT_TRUE(reader->Read(&response));
+    EXPECT_EQ(response.SERVING, response.status());
+  }
+  for (auto& context : contexts) {
+    context.TryCancel();
+  }
+}
+
 TEST_F(HealthServiceEnd2endTest, DefaultHealthServiceShutdown) {
   EnableDefaultHealthCheckService(true);
   EXPECT_TRUE(DefaultHealthCheckServiceEnabled());
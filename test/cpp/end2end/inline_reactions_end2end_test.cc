@@ -0,0 +1,147 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+// Echoes requests from reactions that never block, run inline.
+class InlineEchoService : public EchoTestService::CallbackService {
+ public:
+  InlineEchoService() { MarkAllMethodsInlineReactions(); }
+
+  ServerUnaryReactor* Echo(CallbackServerContext* context,
+                           const EchoRequest* request,
+                           EchoResponse* response) override {
+    response->set_message(request->message());
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+    reactor->Finish(Status::OK);
+    return reactor;
+  }
+
+  ServerBidiReactor<EchoRequest, EchoResponse>* BidiStream(
+      CallbackServerContext* /*context*/) override {
+    class Reactor : public ServerBidiReactor<EchoRequest, EchoResponse> {
+     public:
+      Reactor() { StartRead(&request_); }
+
+      void OnReadDone(bool ok) override {
+        if (!ok) {
+          Finish(Status::OK);
+          return;
+        }
+        response_.set_message(request_.message());
+        StartWrite(&response_);
+      }
+      void OnWriteDone(bool ok) override {
+        if (!ok) {
+          Finish(Status(StatusCode::UNKNOWN, "write failed"));
+          return;
+        }
+        StartRead(&request_);
+      }
+      void OnDone() override { delete this; }
+
+     private:
+      EchoRequest request_;
+      EchoResponse response_;
+    };
+    return new Reactor();
+  }
+};
+
+class InlineReactionsEnd2endTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    port_ = grpc_pick_unused_port_or_die();
+    std::ostringstream server_address;
+    server_address << "localhost:" << port_;
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address.str(),
+                             InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    stub_ = EchoTestService::NewStub(CreateChannel(
+        server_address.str(), InsecureChannelCredentials()));
+  }
+
+  void TearDown() override {
+    server_->Shutdown();
+    grpc_recycle_unused_port(port_);
+  }
+
+  int port_;
+  InlineEchoService service_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(InlineReactionsEnd2endTest, Unary) {
+  for (int i = 0; i < 10; i++) {
+    ClientContext context;
+    EchoRequest request;
+    EchoResponse response;
+    request.set_message("hello " + std::to_string(i));
+    Status status = stub_->Echo(&context, request, &response);
+    ASSERT_TRUE(status.ok()) << status.error_message();
+    EXPECT_EQ(response.message(), request.message());
+  }
+}
+
+TEST_F(InlineReactionsEnd2endTest, BidiStreaming) {
+  ClientContext context;
+  auto stream = stub_->BidiStream(&context);
+  for (int i = 0; i < 10; i++) {
+    EchoRequest request;
+    EchoResponse response;
+    request.set_message("hello " + std::to_string(i));
+    ASSERT_TRUE(stream->Write(request));
+    ASSERT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message());
+  }
+  ASSERT_TRUE(stream->WritesDone());
+  Status status = stream->Finish();
+  EXPECT_TRUE(status.ok()) << status.error_message();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
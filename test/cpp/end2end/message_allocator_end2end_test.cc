@@ -73,6 +73,25 @@ class CallbackTestServiceImpl : public EchoTestService::CallbackService {
     return reactor;
   }
 
+  ServerWriteReactor<EchoResponse>* ResponseStream(
+      CallbackServerContext* context, const EchoRequest* request) override {
+    if (allocator_mutator_) {
+      allocator_mutator_(context->GetRpcAllocatorState(), request, nullptr);
+    }
+    class Reactor : public ServerWriteReactor<EchoResponse> {
+     public:
+      explicit Reactor(const EchoRequest* request) {
+        response_.set_message(request->message());
+        StartWriteAndFinish(&response_, WriteOptions(), Status::OK);
+      }
+      void OnDone() override { delete this; }
+
+     private:
+      EchoResponse response_;
+    };
+    return new Reactor(request);
+  }
+
  private:
   std::function<void(RpcAllocatorState* allocator_state, const EchoRequest* req,
                      EchoResponse* resp)>
@@ -120,6 +139,7 @@ class MessageAllocatorEnd2endTestBase
       builder.AddListeningPort(server_address_.str(), server_creds);
     }
     callback_service_.SetMessageAllocatorFor_Echo(allocator);
+    callback_service_.SetMessageAllocatorFor_ResponseStream(allocator);
     builder.RegisterService(&callback_service_);
 
     server_ = builder.BuildAndStart();
@@ -189,6 +209,20 @@ class MessageAllocatorEnd2endTestBase
     }
   }
 
+  void SendServerStreamingRpcs(int num_rpcs) {
+    for (int i = 0; i < num_rpcs; i++) {
+      EchoRequest request;
+      EchoResponse response;
+      ClientContext cli_ctx;
+      request.set_message(std::string(1024 * (i + 1), 'x'));
+      auto reader = stub_->ResponseStream(&cli_ctx, request);
+      ASSERT_TRUE(reader->Read(&response));
+      EXPECT_EQ(request.message(), response.message());
+      EXPECT_FALSE(reader->Read(&response));
+      EXPECT_TRUE(reader->Finish().ok());
+    }
+  }
+
   int picked_port_{0};
   std::shared_ptr<Channel> channel_;
   std::unique_ptr<EchoTestService::Stub> stub_;
@@ -319,6 +353,26 @@ TEST_P(SimpleAllocatorTest, RpcWithReleaseRequest) {
   }
 }
 
+TEST_P(SimpleAllocatorTest, ServerStreamingRpc) {
+  const int kRpcCount = 10;
+  std::unique_ptr<SimpleAllocator> allocator(new SimpleAllocator);
+  auto mutator = [](RpcAllocatorState* allocator_state, const EchoRequest* req,
+                    EchoResponse* /*resp*/) {
+    auto* info =
+        static_cast<SimpleAllocator::MessageHolderImpl*>(allocator_state);
+    EXPECT_EQ(req, info->request());
+  };
+  callback_service_.SetAllocatorMutator(mutator);
+  CreateServer(allocator.get());
+  ResetStub();
+  SendServerStreamingRpcs(kRpcCount);
+  // messages_deallocaton_count is updated in Release after server side OnDone.
+  // Destroy server to make sure it has been updated.
+  DestroyServer();
+  EXPECT_EQ(kRpcCount, allocator->allocation_count);
+  EXPECT_EQ(kRpcCount, allocator->messages_deallocation_count);
+}
+
 class ArenaAllocatorTest : public MessageAllocatorEnd2endTestBase {
  public:
   class ArenaAllocator : public MessageAllocator<EchoRequest, EchoResponse> {
@@ -0,0 +1,155 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+// Reads the messages of its streaming calls ahead.
+class ReadAheadEchoService : public EchoTestService::Service {
+ public:
+  ReadAheadEchoService() { MarkAllMethodsReadAhead(); }
+
+  Status RequestStream(ServerContext* /*context*/,
+                       ServerReader<EchoRequest>* reader,
+                       EchoResponse* response) override {
+    EchoRequest request;
+    std::string messages;
+    while (reader->Read(&request)) {
+      messages += request.message();
+    }
+    response->set_message(messages);
+    return Status::OK;
+  }
+
+  // Echoes requests until one asks to stop, without reading the next ones.
+  Status BidiStream(
+      ServerContext* /*context*/,
+      ServerReaderWriter<EchoResponse, EchoRequest>* stream) override {
+    EchoRequest request;
+    EchoResponse response;
+    while (stream->Read(&request)) {
+      if (request.message() == "stop") return Status::OK;
+      response.set_message(request.message());
+      stream->Write(response);
+    }
+    return Status::OK;
+  }
+};
+
+class ReadAheadEnd2endTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    port_ = grpc_pick_unused_port_or_die();
+    std::ostringstream server_address;
+    server_address << "localhost:" << port_;
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address.str(),
+                             InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    server_ = builder.BuildAndStart();
+    stub_ = EchoTestService::NewStub(CreateChannel(
+        server_address.str(), InsecureChannelCredentials()));
+  }
+
+  void TearDown() override {
+    server_->Shutdown();
+    grpc_recycle_unused_port(port_);
+  }
+
+  int port_;
+  ReadAheadEchoService service_;
+  std::unique_ptr<Server> server_;
+  std::unique_ptr<EchoTestService::Stub> stub_;
+};
+
+TEST_F(ReadAheadEnd2endTest, ClientStreaming) {
+  ClientContext context;
+  EchoResponse response;
+  auto writer = stub_->RequestStream(&context, &response);
+  std::string messages;
+  for (int i = 0; i < 100; i++) {
+    EchoRequest request;
+    request.set_message(std::to_string(i));
+    messages += request.message();
+    ASSERT_TRUE(writer->Write(request));
+  }
+  ASSERT_TRUE(writer->WritesDone());
+  Status status = writer->Finish();
+  ASSERT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(response.message(), messages);
+}
+
+TEST_F(ReadAheadEnd2endTest, BidiStreaming) {
+  ClientContext context;
+  auto stream = stub_->BidiStream(&context);
+  for (int i = 0; i < 100; i++) {
+    EchoRequest request;
+    EchoResponse response;
+    request.set_message("hello " + std::to_string(i));
+    ASSERT_TRUE(stream->Write(request));
+    ASSERT_TRUE(stream->Read(&response));
+    EXPECT_EQ(response.message(), request.message());
+  }
+  ASSERT_TRUE(stream->WritesDone());
+  EchoResponse response;
+  EXPECT_FALSE(stream->Read(&response));
+  Status status = stream->Finish();
+  EXPECT_TRUE(status.ok()) << status.error_message();
+}
+
+// The handler returns while the next message is being read ahead, and the
+// client does not half-close: the call still finishes.
+TEST_F(ReadAheadEnd2endTest, HandlerReturnsWhileReadingAhead) {
+  ClientContext context;
+  auto stream = stub_->BidiStream(&context);
+  EchoRequest request;
+  request.set_message("stop");
+  ASSERT_TRUE(stream->Write(request));
+  EchoResponse response;
+  EXPECT_FALSE(stream->Read(&response));
+  Status status = stream->Finish();
+  EXPECT_TRUE(status.ok()) << status.error_message();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
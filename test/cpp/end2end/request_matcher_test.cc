@@ -0,0 +1,346 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Tests of how a server with several completion queues matches the calls it
+// receives to the calls the application requests, in particular the calls
+// that arrive before any is requested and wait in the pending lists.
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+
+#include <grpc/impl/channel_arg_names.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+
+#include "src/core/channelz/channelz.h"
+#include "src/core/server/server.h"
+#include "src/core/util/json/json.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+void* tag(intptr_t i) { return reinterpret_cast<void*>(i); }
+
+// A call requested on a server completion queue.
+struct RequestedCall {
+  ServerContext ctx;
+  EchoRequest request;
+  ServerAsyncResponseWriter<EchoResponse> responder{&ctx};
+};
+
+// A call started by the client.
+struct ClientCall {
+  ClientContext ctx;
+  EchoResponse response;
+  Status status;
+  std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> reader;
+};
+
+class RequestMatcherTest : public ::testing::Test {
+ protected:
+  static constexpr int kNumCqs = 3;
+
+  void StartServer(int max_unrequested_time_seconds = 30) {
+    port_ = grpc_pick_unused_port_or_die();
+    server_address_ = absl::StrCat("localhost:", port_);
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address_, InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    builder.AddChannelArgument(
+        GRPC_ARG_SERVER_MAX_UNREQUESTED_TIME_IN_SERVER_SECONDS,
+        max_unrequested_time_seconds);
+    for (int i = 0; i < kNumCqs; i++) {
+      cqs_.push_back(builder.AddCompletionQueue());
+    }
+    server_ = builder.BuildAndStart();
+  }
+
+  void TearDown() override {
+    // Cancels the calls the test leaves unfinished.
+    server_->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+    for (auto& cq : cqs_) {
+      cq->Shutdown();
+      void* ignored_tag;
+      bool ignored_ok;
+      while (cq->Next(&ignored_tag, &ignored_ok)) {
+      }
+    }
+    client_cq_.Shutdown();
+    void* ignored_tag;
+    bool ignored_ok;
+    while (client_cq_.Next(&ignored_tag, &ignored_ok)) {
+    }
+    grpc_recycle_unused_port(port_);
+  }
+
+  // Each stub has a channel, and so a connection, of its own. The server
+  // puts the calls of each connection in the pending list of one shard.
+  std::unique_ptr<EchoTestService::Stub> NewStub() {
+    ChannelArguments args;
+    args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    return EchoTestService::NewStub(CreateCustomChannel(
+        server_address_, InsecureChannelCredentials(), args));
+  }
+
+  // Starts a call with \a message, and waits until the server has received
+  // it. No call is requested, so the call waits in a pending list.
+  ClientCall* StartPendingCall(EchoTestService::Stub* stub,
+                               const std::string& message,
+                               int timeout_seconds = 60) {
+    const int64_t calls_started = ServerCallsStarted();
+    client_calls_.push_back(std::make_unique<ClientCall>());
+    ClientCall* call = client_calls_.back().get();
+    call->ctx.set_deadline(grpc_timeout_seconds_to_deadline(timeout_seconds));
+    EchoRequest request;
+    request.set_message(message);
+    call->reader = stub->AsyncEcho(&call->ctx, request, &client_cq_);
+    call->reader->Finish(&call->response, &call->status, call);
+    const absl::Time deadline = absl::Now() + absl::Seconds(30);
+    while (ServerCallsStarted() == calls_started) {
+      EXPECT_LT(absl::Now(), deadline);
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    // The server call is created when its stream arrives, and goes to the
+    // request matcher right after.
+    absl::SleepFor(absl::Milliseconds(100));
+    return call;
+  }
+
+  // Requests a call on the server completion queue \a cq_idx, and returns
+  // the message of the call it is matched to, or an empty string if none is
+  // within \a timeout_ms. The call is then finished with that message.
+  std::string RequestAndFinishCall(int cq_idx, int timeout_ms = 10000) {
+    requested_calls_.push_back(std::make_unique<RequestedCall>());
+    RequestedCall* call = requested_calls_.back().get();
+    service_.RequestEcho(&call->ctx, &call->request, &call->responder,
+                         cqs_[cq_idx].get(), cqs_[cq_idx].get(), call);
+    void* got_tag;
+    bool ok;
+    if (cqs_[cq_idx]->AsyncNext(
+            &got_tag, &ok,
+            grpc_timeout_milliseconds_to_deadline(timeout_ms)) !=
+            CompletionQueue::GOT_EVENT ||
+        got_tag != call || !ok) {
+      return "";
+    }
+    EchoResponse response;
+    response.set_message(call->request.message());
+    call->responder.Finish(response, Status::OK, tag(-1));
+    EXPECT_EQ(cqs_[cq_idx]->AsyncNext(&got_tag, &ok,
+                                      grpc_timeout_seconds_to_deadline(10)),
+              CompletionQueue::GOT_EVENT);
+    EXPECT_EQ(got_tag, tag(-1));
+    return call->request.message();
+  }
+
+  // Waits for \a call to finish on the client, and returns its status.
+  Status WaitForClientCall(ClientCall* call) {
+    while (std::find(finished_calls_.begin(), finished_calls_.end(), call) ==
+           finished_calls_.end()) {
+      void* got_tag;
+      bool ok;
+      EXPECT_EQ(client_cq_.AsyncNext(&got_tag, &ok,
+                                     grpc_timeout_seconds_to_deadline(30)),
+                CompletionQueue::GOT_EVENT);
+      finished_calls_.push_back(static_cast<ClientCall*>(got_tag));
+    }
+    return call->status;
+  }
+
+  int64_t ServerCallsStarted() {
+    grpc_core::Json json = grpc_core::Server::FromC(server_->c_server())
+                               ->channelz_node()
+                               ->RenderJson();
+    const auto& data = json.object().at("data").object();
+    auto it = data.find("callsStarted");
+    if (it == data.end()) return 0;
+    int64_t calls_started = 0;
+    EXPECT_TRUE(absl::SimpleAtoi(it->second.string(), &calls_started));
+    return calls_started;
+  }
+
+  int port_;
+  std::string server_address_;
+  EchoTestService::AsyncService service_;
+  std::vector<std::unique_ptr<ServerCompletionQueue>> cqs_;
+  std::unique_ptr<Server> server_;
+  CompletionQueue client_cq_;
+  std::vector<std::unique_ptr<RequestedCall>> requested_calls_;
+  // The calls requested by each of the server threads of a test. Like
+  // requested_calls_, they must outlive the server shutdown.
+  std::vector<std::unique_ptr<RequestedCall>> server_thread_calls_[kNumCqs];
+  std::vector<std::unique_ptr<ClientCall>> client_calls_;
+  std::vector<ClientCall*> finished_calls_;
+};
+
+// The pending calls of a connection are matched in the order in which they
+// arrived, whichever completion queue requests them: a request on the CQ of
+// the connection's shard takes them from that shard, and a request on any
+// other CQ takes them from there when its own shard is empty.
+TEST_F(RequestMatcherTest, PendingCallsAreMatchedInOrderFromAnyCq) {
+  StartServer();
+  constexpr int kNumCalls = 2 * kNumCqs;
+  auto stub = NewStub();
+  std::vector<ClientCall*> calls;
+  for (int i = 0; i < kNumCalls; i++) {
+    calls.push_back(StartPendingCall(stub.get(), absl::StrCat("call", i)));
+  }
+  for (int i = 0; i < kNumCalls; i++) {
+    EXPECT_EQ(RequestAndFinishCall(i % kNumCqs), absl::StrCat("call", i));
+  }
+  for (ClientCall* call : calls) EXPECT_TRUE(WaitForClientCall(call).ok());
+}
+
+// With calls pending in the shards of several connections, each connection's
+// calls still come out in order, and requests on any CQ drain all of them.
+TEST_F(RequestMatcherTest, PendingCallsOfSeveralConnectionsStayInOrder) {
+  StartServer();
+  constexpr int kNumConnections = 4;
+  constexpr int kCallsPerConnection = 3;
+  std::vector<std::unique_ptr<EchoTestService::Stub>> stubs;
+  for (int c = 0; c < kNumConnections; c++) stubs.push_back(NewStub());
+  std::vector<ClientCall*> calls;
+  for (int i = 0; i < kCallsPerConnection; i++) {
+    for (int c = 0; c < kNumConnections; c++) {
+      calls.push_back(
+          StartPendingCall(stubs[c].get(), absl::StrCat(c, ":", i)));
+    }
+  }
+  std::vector<int> next_call(kNumConnections, 0);
+  for (int i = 0; i < kNumConnections * kCallsPerConnection; i++) {
+    const std::string message = RequestAndFinishCall(i % kNumCqs);
+    ASSERT_FALSE(message.empty());
+    int connection;
+    int call_index;
+    ASSERT_EQ(sscanf(message.c_str(), "%d:%d", &connection, &call_index), 2);
+    EXPECT_EQ(call_index, next_call[connection]++) << message;
+  }
+  for (ClientCall* call : calls) EXPECT_TRUE(WaitForClientCall(call).ok());
+}
+
+// A call that waited longer than GRPC_ARG_SERVER_MAX_UNREQUESTED_TIME_IN_
+// SERVER_SECONDS is dropped instead of being matched, and the next request
+// gets the call behind it.
+TEST_F(RequestMatcherTest, PendingCallTimesOut) {
+  StartServer(/*max_unrequested_time_seconds=*/1);
+  auto stub = NewStub();
+  ClientCall* stale =
+      StartPendingCall(stub.get(), "stale", /*timeout_seconds=*/5);
+  absl::SleepFor(absl::Milliseconds(1500));
+  ClientCall* fresh = StartPendingCall(stub.get(), "fresh");
+  EXPECT_EQ(RequestAndFinishCall(0), "fresh");
+  EXPECT_TRUE(WaitForClientCall(fresh).ok());
+  EXPECT_FALSE(WaitForClientCall(stale).ok());
+  // Nothing else is pending.
+  EXPECT_EQ(RequestAndFinishCall(1, /*timeout_ms=*/500), "");
+}
+
+// Calls arrive while the application requests calls on every CQ at the same
+// time, so that requests pushed to empty queues race with calls being added
+// to the pending lists. Every call must be matched.
+TEST_F(RequestMatcherTest, ConcurrentRequestsAndCallsAreAllMatched) {
+  StartServer();
+  constexpr int kNumConnections = 4;
+  constexpr int kCallsPerConnection = 100;
+  constexpr int kNumCalls = kNumConnections * kCallsPerConnection;
+  std::atomic<int> matched{0};
+  std::vector<std::thread> server_threads;
+  for (int i = 0; i < kNumCqs; i++) {
+    server_threads.emplace_back([this, i, &matched]() {
+      ServerCompletionQueue* cq = cqs_[i].get();
+      auto& calls = server_thread_calls_[i];
+      RequestedCall* requested = nullptr;
+      // Requests that are still unmatched at the end are cancelled by the
+      // shutdown in TearDown().
+      while (matched.load() < kNumCalls) {
+        if (requested == nullptr) {
+          calls.push_back(std::make_unique<RequestedCall>());
+          requested = calls.back().get();
+          service_.RequestEcho(&requested->ctx, &requested->request,
+                               &requested->responder, cq, cq, requested);
+        }
+        void* got_tag;
+        bool ok;
+        if (cq->AsyncNext(&got_tag, &ok,
+                          grpc_timeout_milliseconds_to_deadline(10)) !=
+            CompletionQueue::GOT_EVENT) {
+          continue;
+        }
+        // The completion of a Finish().
+        if (got_tag == tag(-1)) continue;
+        if (!ok) return;
+        ++matched;
+        RequestedCall* call = static_cast<RequestedCall*>(got_tag);
+        requested = nullptr;
+        EchoResponse response;
+        response.set_message(call->request.message());
+        call->responder.Finish(response, Status::OK, tag(-1));
+      }
+    });
+  }
+  std::vector<std::thread> client_threads;
+  std::atomic<int> succeeded{0};
+  for (int c = 0; c < kNumConnections; c++) {
+    client_threads.emplace_back([this, &succeeded]() {
+      auto stub = NewStub();
+      for (int i = 0; i < kCallsPerConnection; i++) {
+        ClientContext ctx;
+        ctx.set_deadline(grpc_timeout_seconds_to_deadline(30));
+        EchoRequest request;
+        request.set_message("race");
+        EchoResponse response;
+        if (stub->Echo(&ctx, request, &response).ok()) ++succeeded;
+      }
+    });
+  }
+  for (auto& thread : client_threads) thread.join();
+  EXPECT_EQ(succeeded.load(), kNumCalls);
+  EXPECT_EQ(matched.load(), kNumCalls);
+  for (auto& thread : server_threads) thread.join();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1685,6 +1685,76 @@ TEST_F(RlsMetricsEnd2endTest, MetricValuesDefaultTargetRpcs) {
       ::testing::Optional(1));
 }
 
+// Uses the cache entries gauge to tell whether an entry is still cached,
+// since another RPC for it would mark it as recently used again.
+TEST_F(RlsMetricsEnd2endTest, CacheSizeLimitSecondChance) {
+  auto kMetricCacheEntries =
+      grpc_core::GlobalInstrumentsRegistryTestPeer::
+          FindCallbackInt64GaugeHandleByName("grpc.lb.rls.cache_entries")
+              .value();
+  StartBackends(1);
+  const std::string rls_target = grpc_core::LocalIpUri(backends_[0]->port_);
+  SetNextResolution(
+      MakeServiceConfigBuilder()
+          .AddKeyBuilder(absl::StrFormat("\"names\":[{"
+                                         "  \"service\":\"%s\","
+                                         "  \"method\":\"%s\""
+                                         "}],"
+                                         "\"headers\":["
+                                         "  {"
+                                         "    \"key\":\"%s\","
+                                         "    \"names\":["
+                                         "      \"key1\""
+                                         "    ]"
+                                         "  }"
+                                         "]",
+                                         kServiceValue, kMethodValue, kTestKey))
+          .set_cache_size_bytes(1)  // Every insertion evicts all it can.
+          .Build());
+  for (const char* value : {"a", "b", "c", "d", "e"}) {
+    rls_server_->service_.SetResponse(BuildRlsRequest({{kTestKey, value}}),
+                                      BuildRlsResponse({rls_target}));
+  }
+  auto send_rpc = [&](const char* value) {
+    CheckRpcSendOk(DEBUG_LOCATION,
+                   RpcOptions().set_metadata({{"key1", value}}));
+  };
+  auto cache_entries = [&]() {
+    stats_plugin_->TriggerCallbacks();
+    return stats_plugin_->GetInt64CallbackGaugeValue(
+        kMetricCacheEntries,
+        {target_uri_, rls_server_target_, kRlsInstanceUuid}, {});
+  };
+  // Each entry is marked as recently used by the pick that follows its RLS
+  // response. Nothing can be evicted yet, because of min_eviction_time, but
+  // the passes clear the marks of "a" and "b", leaving the list a, b, c.
+  send_rpc("a");
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(3));
+  send_rpc("b");
+  send_rpc("a");
+  send_rpc("c");
+  EXPECT_EQ(rls_server_->service_.request_count(), 3);
+  EXPECT_THAT(cache_entries(), ::testing::Optional(3));
+  // Once "a" is past min_eviction_time, use it again. Inserting "d" moves
+  // it to the back of the list instead of evicting it, and the pass stops
+  // at "b", which is still held by min_eviction_time.
+  gpr_sleep_until(grpc_timeout_seconds_to_deadline(3));
+  send_rpc("a");
+  EXPECT_EQ(rls_server_->service_.request_count(), 3);
+  send_rpc("d");
+  EXPECT_EQ(rls_server_->service_.request_count(), 4);
+  EXPECT_THAT(cache_entries(), ::testing::Optional(4));
+  // Without another use, "a" is evicted by the next pass, along with "b"
+  // and "c", once they are past min_eviction_time. "d" is not.
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(3500));
+  send_rpc("e");
+  EXPECT_EQ(rls_server_->service_.request_count(), 5);
+  EXPECT_THAT(cache_entries(), ::testing::Optional(2));
+  send_rpc("a");
+  EXPECT_EQ(rls_server_->service_.request_count(), 6);
+  EXPECT_EQ(backends_[0]->service_.request_count(), 8);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc
@@ -13,8 +13,11 @@
 // limitations under the License.
 //
 
+#include <atomic>
+#include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -23,10 +26,13 @@
 #include "absl/log/log.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 
 #include "src/core/client_channel/backup_poller.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/telemetry/call_tracer.h"
 #include "src/proto/grpc/testing/xds/v3/orca_load_report.pb.h"
@@ -358,6 +364,185 @@ TEST_P(CdsTest, MetricLabels) {
                           LocalityNameString("locality1"))));
 }
 
+//
+// Circuit breaking tests
+//
+
+// Covers the call counter that the circuit breaker keeps per cluster, whose
+// per-cpu shards lease tokens from a shared reservation.
+class CircuitBreakingTest : public XdsEnd2endTest {
+ protected:
+  static constexpr size_t kMaxConcurrentRequests = 10;
+
+  void SetUp() override {
+    XdsEnd2endTest::SetUp();
+    CreateAndStartBackends(1);
+    EdsResourceArgs args({{"locality0", CreateEndpointsForBackends()}});
+    balancer_->ads_service()->SetEdsResource(BuildEdsResource(args));
+    Cluster cluster = default_cluster_;
+    auto* threshold = cluster.mutable_circuit_breakers()->add_thresholds();
+    threshold->set_priority(RoutingPriority::DEFAULT);
+    threshold->mutable_max_requests()->set_value(kMaxConcurrentRequests);
+    balancer_->ads_service()->SetCdsResource(cluster);
+    // Makes sure the limit is in place before the test starts.
+    CheckRpcSendOk(DEBUG_LOCATION);
+  }
+
+  static RpcOptions LongRpcOptions() {
+    return RpcOptions().set_timeout_ms(0).set_client_cancel_after_us(
+        100 * 1000);
+  }
+
+  size_t RpcsInFlight() {
+    return backends_[0]->backend_service()->RpcsWaitingForClientCancel();
+  }
+
+  // Waits for the number of RPCs waiting at the backend to reach \a count.
+  void WaitForRpcsInFlight(size_t count) {
+    absl::Time deadline =
+        absl::Now() + absl::Seconds(10 * grpc_test_slowdown_factor());
+    while (RpcsInFlight() < count) {
+      ASSERT_LT(absl::Now(), deadline)
+          << "RPCs in flight: " << RpcsInFlight() << ", want " << count;
+      absl::SleepFor(absl::Milliseconds(1));
+    }
+  }
+
+  // Starts long-running RPCs one at a time until there are as many in flight
+  // as the limit allows, each of which must get through, then checks that
+  // the next RPC is dropped.
+  void FillUpToLimitAndExpectDrop(
+      std::vector<std::unique_ptr<LongRunningRpc>>* rpcs) {
+    while (RpcsInFlight() < kMaxConcurrentRequests) {
+      const size_t in_flight = RpcsInFlight();
+      rpcs->push_back(std::make_unique<LongRunningRpc>());
+      rpcs->back()->StartRpc(stub_.get(), LongRpcOptions());
+      WaitForRpcsInFlight(in_flight + 1);
+      if (HasFatalFailure()) return;
+    }
+    CheckRpcSendFailure(DEBUG_LOCATION, StatusCode::UNAVAILABLE,
+                        "circuit breaker drop");
+  }
+
+  // Cancels \a rpcs and waits for the call counter to have seen them finish.
+  void CancelAll(std::vector<std::unique_ptr<LongRunningRpc>>* rpcs) {
+    for (auto& rpc : *rpcs) rpc->CancelRpc();
+    rpcs->clear();
+    WaitForRpcsInFlight(0);
+    // The counter is decremented shortly after the RPC status is returned.
+    absl::SleepFor(absl::Milliseconds(500));
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(XdsTest, CircuitBreakingTest,
+                         ::testing::Values(XdsTestType()), &XdsTestType::Name);
+
+// Many picks at once, from threads that each lease tokens, may overshoot the
+// limit, as picks always could, but once they settle the limit must hold
+// exactly, and every token must come back when the RPCs finish.
+TEST_P(CircuitBreakingTest, ConcurrentPicks) {
+  constexpr size_t kNumThreads = 2 * kMaxConcurrentRequests;
+  constexpr size_t kRpcsPerThread = 3;
+  grpc_core::Mutex mu;
+  std::vector<std::unique_ptr<ClientContext>> contexts;
+  std::atomic<size_t> threads_done{0};
+  std::atomic<size_t> failed{0};
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&]() {
+      for (size_t i = 0; i < kRpcsPerThread; ++i) {
+        auto context = std::make_unique<ClientContext>();
+        EchoRequest request;
+        LongRpcOptions().SetupRpc(context.get(), &request);
+        ClientContext* context_ptr = context.get();
+        {
+          grpc_core::MutexLock lock(&mu);
+          contexts.push_back(std::move(context));
+        }
+        EchoResponse response;
+        Status status = stub_->Echo(context_ptr, request, &response);
+        if (status.error_code() != StatusCode::CANCELLED &&
+            status.error_message() != "circuit breaker drop") {
+          ++failed;
+        }
+      }
+      ++threads_done;
+    });
+  }
+  // A thread's RPCs are dropped until one gets through, which then waits for
+  // the test to cancel it. Wait until every thread has one RPC waiting at
+  // the backend or has had all of its RPCs dropped.
+  absl::Time deadline =
+      absl::Now() + absl::Seconds(30 * grpc_test_slowdown_factor());
+  bool settled = true;
+  while (RpcsInFlight() + threads_done.load() < kNumThreads) {
+    if (absl::Now() > deadline) {
+      ADD_FAILURE() << "timed out waiting for the picks to settle";
+      settled = false;
+      break;
+    }
+    absl::SleepFor(absl::Milliseconds(1));
+  }
+  std::vector<std::unique_ptr<LongRunningRpc>> rpcs;
+  if (settled) {
+    if (RpcsInFlight() < kMaxConcurrentRequests) {
+      FillUpToLimitAndExpectDrop(&rpcs);
+    } else {
+      CheckRpcSendFailure(DEBUG_LOCATION, StatusCode::UNAVAILABLE,
+                          "circuit breaker drop");
+    }
+  }
+  // Cancel everything, including the RPCs the threads start after theirs are
+  // cancelled.
+  while (true) {
+    {
+      grpc_core::MutexLock lock(&mu);
+      for (auto& context : contexts) context->TryCancel();
+      if (contexts.size() == kNumThreads * kRpcsPerThread) break;
+    }
+    absl::SleepFor(absl::Milliseconds(10));
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(failed.load(), 0u);
+  CancelAll(&rpcs);
+  // All the tokens leased during the storm are back.
+  FillUpToLimitAndExpectDrop(&rpcs);
+  CancelAll(&rpcs);
+}
+
+// Short RPCs that start and finish on many threads, and so on different
+// shards of the counter, must not leave tokens behind.
+TEST_P(CircuitBreakingTest, TokensAreReturnedWhenRpcsFinish) {
+  constexpr size_t kNumThreads = 8;
+  constexpr size_t kRpcsPerThread = 200;
+  std::vector<std::unique_ptr<LongRunningRpc>> rpcs;
+  for (int round = 0; round < 3; ++round) {
+    std::atomic<size_t> failed{0};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < kNumThreads; ++t) {
+      threads.emplace_back([&]() {
+        for (size_t i = 0; i < kRpcsPerThread; ++i) {
+          ClientContext context;
+          EchoRequest request;
+          request.set_message(kRequestMessage);
+          EchoResponse response;
+          Status status = stub_->Echo(&context, request, &response);
+          // Only the circuit breaker may turn RPCs away.
+          if (!status.ok() &&
+              status.error_message() != "circuit breaker drop") {
+            ++failed;
+          }
+        }
+      });
+    }
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(failed.load(), 0u);
+    absl::SleepFor(absl::Milliseconds(500));
+    FillUpToLimitAndExpectDrop(&rpcs);
+    CancelAll(&rpcs);
+  }
+}
+
 //
 // CDS deletion tests
 //
@@ -24,6 +24,8 @@
 
 #include "absl/log/log.h"
 #include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 
 #include "src/core/client_channel/backup_poller.h"
 #include "src/core/lib/config/config_vars.h"
@@ -267,6 +269,84 @@ TEST_P(
   WaitForBackend(DEBUG_LOCATION, 1);
 }
 
+//
+// SharedXdsClientTest - tests with GRPC_XDS_SHARED_CLIENT set
+//
+
+class SharedXdsClientTest : public XdsEnd2endTest {
+ protected:
+  void SetUp() override {
+    SetOverrides(/*xds_shared_client=*/true);
+    XdsEnd2endTest::SetUp();
+  }
+
+  void TearDown() override {
+    XdsEnd2endTest::TearDown();
+    SetOverrides(/*xds_shared_client=*/false);
+  }
+
+ private:
+  // Keeps the backup poller setting from main().
+  static void SetOverrides(bool xds_shared_client) {
+    grpc_core::ConfigVars::Overrides overrides;
+    overrides.client_channel_backup_poll_interval_ms = 1;
+    overrides.xds_shared_client = xds_shared_client;
+    grpc_core::ConfigVars::SetOverrides(overrides);
+  }
+};
+
+INSTANTIATE_TEST_SUITE_P(XdsTest, SharedXdsClientTest,
+                         ::testing::Values(XdsTestType().set_bootstrap_source(
+                             XdsTestType::kBootstrapFromEnvVar)),
+                         &XdsTestType::Name);
+
+TEST_P(SharedXdsClientTest, MultipleChannelsDifferentTargetShareXdsClient) {
+  CreateAndStartBackends(2);
+  const char* kNewServerName = "new-server.example.com";
+  Listener listener = default_listener_;
+  listener.set_name(kNewServerName);
+  SetListenerAndRouteConfiguration(balancer_.get(), listener,
+                                   default_route_config_);
+  balancer_->ads_service()->SetEdsResource(BuildEdsResource(EdsResourceArgs({
+      {"locality0", CreateEndpointsForBackends(0, 1)},
+  })));
+  WaitForBackend(DEBUG_LOCATION, 0);
+  // Create second channel and tell it to connect to kNewServerName.
+  auto channel2 = CreateChannel(/*failover_timeout_ms=*/0, kNewServerName);
+  channel2->GetState(/*try_to_connect=*/true);
+  ASSERT_TRUE(channel2->WaitForConnected(grpc_timeout_seconds_to_deadline(1)));
+  // Both targets are served by the same XdsClient, so there is only one
+  // client connected.
+  EXPECT_EQ(1UL, balancer_->ads_service()->clients().size());
+  // Both channels keep getting updates through the shared watches.
+  balancer_->ads_service()->SetEdsResource(BuildEdsResource(EdsResourceArgs({
+      {"locality0", CreateEndpointsForBackends(1, 2)},
+  })));
+  WaitForBackend(DEBUG_LOCATION, 1);
+  // The second channel may see the update a little later than the first.
+  auto stub2 = grpc::testing::EchoTestService::NewStub(channel2);
+  const size_t backend1_requests =
+      backends_[1]->backend_service()->request_count();
+  const absl::Time deadline = absl::Now() + absl::Seconds(10);
+  while (backends_[1]->backend_service()->request_count() ==
+         backend1_requests) {
+    ASSERT_LT(absl::Now(), deadline);
+    ClientContext context;
+    EchoRequest request;
+    request.set_message(kRequestMessage);
+    EchoResponse response;
+    Status status = stub2->Echo(&context, request, &response);
+    EXPECT_TRUE(status.ok()) << "code=" << status.error_code()
+                             << " message=" << status.error_message();
+  }
+  // Once the second channel goes away, the first one still gets updates.
+  channel2.reset();
+  balancer_->ads_service()->SetEdsResource(BuildEdsResource(EdsResourceArgs({
+      {"locality0", CreateEndpointsForBackends(0, 1)},
+  })));
+  WaitForBackend(DEBUG_LOCATION, 0);
+}
+
 // Tests that the NACK for multiple bad LDS resources includes both errors.
 // This needs to use xDS server as this is the only scenario when XdsClient
 // is shared.
@@ -567,6 +567,33 @@ TEST(MeshLabelsIterableTest, RemoteGkeTypeMetadata) {
       << PrettyPrintLabels(labels);
 }
 
+TEST(MeshLabelsIterableTest, SameRemoteMetadataOnManyCalls) {
+  std::vector<std::pair<absl::string_view, std::string>> local_labels = {
+      {"csm.workload_canonical_service", "canonical_service"},
+      {"csm.mesh_id", "mesh"}};
+  auto remote_metadata = RemoteMetadataSliceFromResource(TestGceResource());
+  // The labels decoded for the first call are reused by the next ones, and
+  // outlive the metadata they were decoded from.
+  auto first = std::make_unique<grpc::internal::MeshLabelsIterable>(
+      local_labels, remote_metadata.Ref());
+  grpc::internal::MeshLabelsIterable second(local_labels,
+                                            std::move(remote_metadata));
+  first.reset();
+  auto labels = LabelsFromIterable(&second);
+  EXPECT_TRUE(second.GotRemoteLabels());
+  EXPECT_THAT(
+      labels,
+      ElementsAre(
+          Pair("csm.workload_canonical_service", "canonical_service"),
+          Pair("csm.mesh_id", "mesh"),
+          Pair("csm.remote_workload_type", "gcp_compute_engine"),
+          Pair("csm.remote_workload_canonical_service", "canonical_service"),
+          Pair("csm.remote_workload_name", "workload"),
+          Pair("csm.remote_workload_location", "zone"),
+          Pair("csm.remote_workload_project_id", "id")))
+      << PrettyPrintLabels(labels);
+}
+
 TEST(MeshLabelsIterableTest, RemoteUnknownTypeMetadata) {
   std::vector<std::pair<absl::string_view, std::string>> local_labels = {
       {"csm.workload_canonical_service", "canonical_service"},
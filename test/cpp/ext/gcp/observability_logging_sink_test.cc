@@ -22,6 +22,8 @@
 #include "google/protobuf/text_format.h"
 #include "gtest/gtest.h"
 
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/util/json/json_reader.h"
 #include "test/core/test_util/test_config.h"
 
@@ -660,6 +662,23 @@ TEST(EntryToJsonStructTest, ClientMessage) {
   EXPECT_EQ(output, pb_str);
 }
 
+TEST(EntryToJsonStructTest, ClientMessageAsSlices) {
+  LoggingSink::Entry entry;
+  entry.type = LoggingSink::Entry::EventType::kClientMessage;
+  auto slices = std::make_shared<grpc_core::SliceBuffer>();
+  slices->Append(grpc_core::Slice::FromCopiedString("hel"));
+  slices->Append(grpc_core::Slice::FromCopiedString("lo"));
+  entry.payload.message_slices = std::move(slices);
+  entry.payload.message_length = 5;
+
+  google::protobuf::Struct proto;
+  EntryToJsonStructProto(std::move(entry), &proto);
+  const auto& payload = proto.fields().at("payload").struct_value();
+  EXPECT_EQ(payload.fields().at("message").string_value(),
+            absl::Base64Escape("hello"));
+  EXPECT_EQ(payload.fields().at("messageLength").number_value(), 5);
+}
+
 TEST(EntryToJsonStructTest, ServerMessage) {
   LoggingSink::Entry entry;
   entry.call_id = 1234;
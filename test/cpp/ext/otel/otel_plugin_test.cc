@@ -24,6 +24,9 @@
 #include <type_traits>
 
 #include "absl/functional/any_invocable.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "opentelemetry/common/timestamp.h"
@@ -40,7 +43,13 @@
 
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/event_engine/channel_args_endpoint_config.h"
+#include "src/core/lib/gprpp/down_cast.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
 #include "src/core/telemetry/call_tracer.h"
+#include "src/core/telemetry/metrics.h"
+#include "src/core/telemetry/tcp_tracer.h"
 #include "test/core/test_util/fake_stats_plugin.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/end2end/test_service_impl.h"
@@ -347,6 +356,123 @@ TEST_F(OpenTelemetryPluginEnd2EndTest,
   EXPECT_EQ(*status_value, "OK");
 }
 
+// The transport hands the TCP tracer of a call attempt the transmit
+// timestamps the kernel collected for each chunk the attempt wrote. These
+// tests stand in for the transport.
+class OpenTelemetryPluginTcpLatencyTest
+    : public OpenTelemetryPluginEnd2EndTest {
+ protected:
+  OpenTelemetryPluginTcpLatencyTest()
+      : endpoint_config_(grpc_core::ChannelArgs()) {}
+
+  // Starts a call attempt on a channel to the server, and returns the TCP
+  // tracer that the transport would get for it. The attempt itself ends
+  // right away, as it may well do before the timestamps arrive.
+  std::shared_ptr<grpc_core::TcpTracerInterface> StartTcpTrace(
+      grpc_core::Arena* arena) {
+    grpc_core::promise_detail::Context<grpc_core::Arena> arena_ctx(arena);
+    auto stats_plugins =
+        grpc_core::GlobalStatsPluginRegistry::GetStatsPluginsForChannel(
+            grpc_core::experimental::StatsPluginChannelScope(
+                canonical_server_address_, "", endpoint_config_));
+    stats_plugins.AddClientCallTracers(
+        grpc_core::Slice::FromCopiedString(absl::StrCat("/", kMethodName)),
+        /*registered_method=*/true, arena);
+    auto* call_tracer = grpc_core::DownCast<grpc_core::ClientCallTracer*>(
+        arena->GetContext<grpc_core::CallTracerAnnotationInterface>());
+    auto* attempt_tracer =
+        call_tracer->StartNewAttempt(/*is_transparent_retry=*/false);
+    auto tcp_tracer = attempt_tracer->StartNewTcpTrace();
+    attempt_tracer->RecordEnd(gpr_time_0(GPR_TIMESPAN));
+    return tcp_tracer;
+  }
+
+  grpc_event_engine::experimental::ChannelArgsEndpointConfig endpoint_config_;
+};
+
+TEST_F(OpenTelemetryPluginTcpLatencyTest, NoTcpTraceUnlessEnabled) {
+  Init(std::move(
+      Options().set_metric_names({grpc::OpenTelemetryPluginBuilder::
+                                      kClientAttemptDurationInstrumentName})));
+  auto arena = grpc_core::SimpleArenaAllocator()->MakeArena();
+  EXPECT_EQ(StartTcpTrace(arena.get()), nullptr);
+}
+
+TEST_F(OpenTelemetryPluginTcpLatencyTest, RecordsTcpDurationsOfEachChunk) {
+  Init(std::move(Options().set_metric_names(
+      {grpc::OpenTelemetryPluginBuilder::
+           kClientAttemptTcpQueueDurationInstrumentName,
+       grpc::OpenTelemetryPluginBuilder::
+           kClientAttemptTcpKernelDurationInstrumentName,
+       grpc::OpenTelemetryPluginBuilder::
+           kClientAttemptTcpWireDurationInstrumentName})));
+  auto arena = grpc_core::SimpleArenaAllocator()->MakeArena();
+  const absl::Time start = absl::Now();
+  auto tcp_tracer = StartTcpTrace(arena.get());
+  ASSERT_NE(tcp_tracer, nullptr);
+  using Type = grpc_core::TcpTracerInterface::Type;
+  // A chunk that made it all the way to the peer.
+  const absl::Time sendmsg_time = start + absl::Seconds(1);
+  tcp_tracer->RecordEvent(Type::kSendMsg, sendmsg_time, 0, absl::nullopt);
+  tcp_tracer->RecordEvent(Type::kScheduled,
+                          sendmsg_time + absl::Milliseconds(1), 0,
+                          absl::nullopt);
+  tcp_tracer->RecordEvent(Type::kSent, sendmsg_time + absl::Milliseconds(2),
+                          0, absl::nullopt);
+  tcp_tracer->RecordEvent(Type::kAcked, sendmsg_time + absl::Milliseconds(7),
+                          0, absl::nullopt);
+  // A chunk for which the kernel did not report when it reached the NIC. Only
+  // the time it spent queued is known.
+  tcp_tracer->RecordEvent(Type::kSendMsg, sendmsg_time, 100, absl::nullopt);
+  tcp_tracer->RecordEvent(Type::kAcked, sendmsg_time + absl::Milliseconds(9),
+                          100, absl::nullopt);
+  const char* kQueueMetricName = "grpc.client.attempt.tcp.queue_duration";
+  const char* kKernelMetricName = "grpc.client.attempt.tcp.kernel_duration";
+  const char* kWireMetricName = "grpc.client.attempt.tcp.wire_duration";
+  auto data = ReadCurrentMetricsData(
+      [&](const absl::flat_hash_map<
+          std::string,
+          std::vector<opentelemetry::sdk::metrics::PointDataAttributes>>&
+              data) {
+        return !data.contains(kQueueMetricName) ||
+               !data.contains(kKernelMetricName) ||
+               !data.contains(kWireMetricName);
+      });
+  struct Expected {
+    const char* metric_name;
+    uint64_t count;
+    double min;
+    double max;
+  } expectations[] = {
+      // The attempt started between start and the tracer's creation.
+      {kQueueMetricName, 2, 0.9, 1.0},
+      {kKernelMetricName, 1, 0.002, 0.002},
+      {kWireMetricName, 1, 0.005, 0.005},
+  };
+  for (const auto& expected : expectations) {
+    SCOPED_TRACE(expected.metric_name);
+    ASSERT_EQ(data[expected.metric_name].size(), 1);
+    auto point_data =
+        absl::get_if<opentelemetry::sdk::metrics::HistogramPointData>(
+            &data[expected.metric_name][0].point_data);
+    ASSERT_NE(point_data, nullptr);
+    EXPECT_EQ(point_data->count_, expected.count);
+    EXPECT_GE(absl::get<double>(point_data->min_), expected.min - 1e-9);
+    EXPECT_LE(absl::get<double>(point_data->max_), expected.max + 1e-9);
+    const auto& attributes =
+        data[expected.metric_name][0].attributes.GetAttributes();
+    EXPECT_EQ(attributes.size(), 2);
+    const auto* method_value =
+        absl::get_if<std::string>(&attributes.at("grpc.method"));
+    ASSERT_NE(method_value, nullptr);
+    EXPECT_EQ(*method_value, kMethodName);
+    const auto* target_value =
+        absl::get_if<std::string>(&attributes.at("grpc.target"));
+    ASSERT_NE(target_value, nullptr);
+    EXPECT_EQ(*target_value, canonical_server_address_);
+  }
+}
+
 TEST_F(OpenTelemetryPluginEnd2EndTest, ServerCallStarted) {
   Init(std::move(Options().set_metric_names(
       {grpc::OpenTelemetryPluginBuilder::kServerCallStartedInstrumentName})));
@@ -464,6 +590,63 @@ TEST_F(OpenTelemetryPluginEnd2EndTest,
   EXPECT_EQ(*status_value, "OK");
 }
 
+TEST_F(OpenTelemetryPluginEnd2EndTest, PreAggregatedPerCallMetrics) {
+  Init(std::move(
+      Options()
+          .set_metric_names(
+              {grpc::OpenTelemetryPluginBuilder::
+                   kClientAttemptStartedInstrumentName,
+               grpc::OpenTelemetryPluginBuilder::
+                   kServerCallRcvdTotalCompressedMessageSizeInstrumentName})
+          .set_per_call_metrics_pre_aggregation(true)));
+  SendRPC();
+  const char* kStartedName = "grpc.client.attempt.started";
+  const std::string kRcvdName =
+      "grpc.server.call.rcvd_total_compressed_message_size";
+  auto data = ReadCurrentMetricsData(
+      [&](const absl::flat_hash_map<
+          std::string,
+          std::vector<opentelemetry::sdk::metrics::PointDataAttributes>>&
+              data) {
+        return !data.contains(kStartedName) ||
+               !data.contains(kRcvdName + ".bucket");
+      });
+  // The data of several collections may have been read. Since the temporality
+  // is delta, the values add up.
+  auto sum = [&](absl::string_view name, absl::string_view le = "") {
+    double total = 0;
+    for (const auto& point : data[name]) {
+      const auto& attributes = point.attributes.GetAttributes();
+      auto it = attributes.find("le");
+      if (it != attributes.end() && absl::get<std::string>(it->second) != le) {
+        continue;
+      }
+      const auto& value =
+          absl::get<opentelemetry::sdk::metrics::SumPointData>(point.point_data)
+              .value_;
+      total += absl::holds_alternative<double>(value)
+                   ? absl::get<double>(value)
+                   : absl::get<int64_t>(value);
+    }
+    return total;
+  };
+  // Counters keep their name.
+  EXPECT_EQ(sum(kStartedName), 1);
+  const auto& attributes = data[kStartedName][0].attributes.GetAttributes();
+  EXPECT_EQ(attributes.size(), 2);
+  EXPECT_EQ(absl::get<std::string>(attributes.at("grpc.method")), kMethodName);
+  // Histograms are exported as a count, a sum and cumulative buckets.
+  EXPECT_EQ(sum(kRcvdName + ".count"), 1);
+  EXPECT_EQ(sum(kRcvdName + ".sum"), 5);
+  EXPECT_EQ(sum(kRcvdName + ".bucket", "0"), 0);
+  EXPECT_EQ(sum(kRcvdName + ".bucket", "1024"), 1);
+  EXPECT_EQ(sum(kRcvdName + ".bucket", "+Inf"), 1);
+  const auto& bucket_attributes =
+      data[kRcvdName + ".bucket"][0].attributes.GetAttributes();
+  EXPECT_EQ(bucket_attributes.size(), 3);
+  EXPECT_EQ(absl::get<std::string>(bucket_attributes.at("grpc.status")), "OK");
+}
+
 // Make sure that no meter provider results in normal operations.
 TEST_F(OpenTelemetryPluginEnd2EndTest, NoMeterProviderRegistered) {
   Init(
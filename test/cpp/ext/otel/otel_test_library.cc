@@ -306,6 +306,8 @@ OpenTelemetryPluginEnd2EndTest::ConfigureOTBuilder(
   for (auto& optional_label_key : options.optional_label_keys) {
     ot_builder->AddOptionalLabel(optional_label_key);
   }
+  ot_builder->EnablePerCallMetricsPreAggregation(
+      options.per_call_metrics_pre_aggregation);
   return reader;
 }
 
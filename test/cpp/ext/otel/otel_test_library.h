@@ -132,6 +132,11 @@ class OpenTelemetryPluginEnd2EndTest : public ::testing::Test {
       return *this;
     }
 
+    Options& set_per_call_metrics_pre_aggregation(bool flag) {
+      per_call_metrics_pre_aggregation = flag;
+      return *this;
+    }
+
     Options& add_per_channel_stats_plugin(
         std::shared_ptr<grpc::experimental::OpenTelemetryPlugin> plugin) {
       per_channel_stats_plugins.emplace_back(std::move(plugin));
@@ -174,6 +179,7 @@ class OpenTelemetryPluginEnd2EndTest : public ::testing::Test {
         per_channel_stats_plugins;
     std::vector<std::shared_ptr<grpc::experimental::OpenTelemetryPlugin>>
         per_server_stats_plugins;
+    bool per_call_metrics_pre_aggregation = false;
   };
 
   class MetricsCollectorThread {
@@ -20,6 +20,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "src/core/lib/config/config_vars.h"
 #include "src/core/lib/resource_quota/arena.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/test_util/test_config.h"
@@ -27,13 +28,29 @@
 #include "test/cpp/util/test_config.h"
 
 static void BM_Arena_NoOp(benchmark::State& state) {
-  auto factory = grpc_core::SimpleArenaAllocator();
+  auto factory = grpc_core::SimpleArenaAllocator(state.range(0));
   for (auto _ : state) {
     factory->MakeArena();
   }
 }
 BENCHMARK(BM_Arena_NoOp)->Range(1, 1024 * 1024);
 
+// Creates and destroys arenas the size of a typical call, with (range(1) == 1)
+// and without recycling of their initial blocks.
+static void BM_Arena_CreateDestroy(benchmark::State& state) {
+  grpc_core::ConfigVars::Overrides overrides;
+  overrides.arena_block_recycling = state.range(1) != 0;
+  grpc_core::ConfigVars::SetOverrides(overrides);
+  auto factory = grpc_core::SimpleArenaAllocator(state.range(0));
+  for (auto _ : state) {
+    auto a = factory->MakeArena();
+    benchmark::DoNotOptimize(a->Alloc(64));
+  }
+  grpc_core::ConfigVars::Reset();
+}
+BENCHMARK(BM_Arena_CreateDestroy)
+    ->ArgsProduct({{1024, 8192, 32 * 1024}, {0, 1}});
+
 static void BM_Arena_ManyAlloc(benchmark::State& state) {
   auto allocator = grpc_core::SimpleArenaAllocator(state.range(0));
   auto a = allocator->MakeArena();
@@ -23,6 +23,7 @@
 
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "test/core/test_util/test_config.h"
 
@@ -30,6 +31,7 @@ namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
 using ::grpc_event_engine::experimental::BasicWorkQueue;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
 using ::grpc_event_engine::experimental::EventEngine;
 
 grpc_core::Mutex globalMu;
@@ -125,10 +127,67 @@ void BM_MultithreadedStdDequeLIFO(benchmark::State& state) {
 }
 BENCHMARK(BM_MultithreadedStdDequeLIFO)->Apply(MultithreadedTestArguments);
 
+// --- Work Stealing Tests ---------------------------------------------------
+//
+// The usage pattern of the thread pool's thread-local queues: thread 0 owns
+// the queue, adding closures and popping the most recent ones, while every
+// other thread steals the oldest ones. Unlike the tests above, this one works
+// with single-owner queues. pop_rate counts the closures taken by all threads.
+
+void WorkStealingTestArguments(benchmark::internal::Benchmark* b) {
+  b->Range(8, 512)
+      ->UseRealTime()
+      ->MeasureProcessCPUTime()
+      ->Threads(1)
+      ->Threads(2)
+      ->Threads(4)
+      ->ThreadPerCpu();
+}
+
+template <typename Queue>
+Queue* WorkStealingQueue() {
+  static Queue* queue = new Queue();
+  return queue;
+}
+
+template <typename Queue>
+void BM_WorkQueueOwnerAndThieves(benchmark::State& state) {
+  Queue* queue = WorkStealingQueue<Queue>();
+  AnyInvocableClosure closure([] {});
+  int element_count = state.range(0);
+  double popped = 0;
+  double pop_attempts = 0;
+  if (state.thread_index() == 0) {
+    for (auto _ : state) {
+      for (int i = 0; i < element_count; i++) queue->Add(&closure);
+      // Race the thieves for everything that was just added.
+      while (!queue->Empty()) {
+        if (++pop_attempts && queue->PopMostRecent() != nullptr) ++popped;
+      }
+    }
+  } else {
+    for (auto _ : state) {
+      for (int i = 0; i < element_count; i++) {
+        if (++pop_attempts && queue->PopOldest() != nullptr) ++popped;
+      }
+    }
+  }
+  state.counters["pop_rate"] =
+      benchmark::Counter(popped, benchmark::Counter::kIsRate);
+  state.counters["hit_rate"] = benchmark::Counter(
+      pop_attempts > 0 ? popped / pop_attempts : 0,
+      benchmark::Counter::kAvgThreads);
+}
+BENCHMARK_TEMPLATE(BM_WorkQueueOwnerAndThieves, BasicWorkQueue)
+    ->Apply(WorkStealingTestArguments);
+BENCHMARK_TEMPLATE(BM_WorkQueueOwnerAndThieves, ChaseLevWorkQueue)
+    ->Apply(WorkStealingTestArguments);
+
 // --- Basic Functionality Tests ---------------------------------------------
 
+template <typename Queue>
 void BM_WorkQueueIntptrPopMostRecent(benchmark::State& state) {
-  BasicWorkQueue queue;
+  Queue queue;
   grpc_event_engine::experimental::AnyInvocableClosure closure([] {});
   int element_count = state.range(0);
   for (auto _ : state) {
@@ -143,13 +202,18 @@ void BM_WorkQueueIntptrPopMostRecent(benchmark::State& state) {
   state.counters["Pop Rate"] =
       benchmark::Counter(state.counters["Popped"], benchmark::Counter::kIsRate);
 }
-BENCHMARK(BM_WorkQueueIntptrPopMostRecent)
+BENCHMARK_TEMPLATE(BM_WorkQueueIntptrPopMostRecent, BasicWorkQueue)
+    ->Range(1, 512)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+BENCHMARK_TEMPLATE(BM_WorkQueueIntptrPopMostRecent, ChaseLevWorkQueue)
     ->Range(1, 512)
     ->UseRealTime()
     ->MeasureProcessCPUTime();
 
+template <typename Queue>
 void BM_WorkQueueClosureExecution(benchmark::State& state) {
-  BasicWorkQueue queue;
+  Queue queue;
   int element_count = state.range(0);
   int run_count = 0;
   grpc_event_engine::experimental::AnyInvocableClosure closure(
@@ -166,13 +230,18 @@ void BM_WorkQueueClosureExecution(benchmark::State& state) {
   state.counters["Pop Rate"] =
       benchmark::Counter(state.counters["Popped"], benchmark::Counter::kIsRate);
 }
-BENCHMARK(BM_WorkQueueClosureExecution)
+BENCHMARK_TEMPLATE(BM_WorkQueueClosureExecution, BasicWorkQueue)
+    ->Range(8, 128)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+BENCHMARK_TEMPLATE(BM_WorkQueueClosureExecution, ChaseLevWorkQueue)
     ->Range(8, 128)
     ->UseRealTime()
     ->MeasureProcessCPUTime();
 
+template <typename Queue>
 void BM_WorkQueueAnyInvocableExecution(benchmark::State& state) {
-  BasicWorkQueue queue;
+  Queue queue;
   int element_count = state.range(0);
   int run_count = 0;
   for (auto _ : state) {
@@ -189,7 +258,11 @@ void BM_WorkQueueAnyInvocableExecution(benchmark::State& state) {
   state.counters["Pop Rate"] =
       benchmark::Counter(state.counters["Popped"], benchmark::Counter::kIsRate);
 }
-BENCHMARK(BM_WorkQueueAnyInvocableExecution)
+BENCHMARK_TEMPLATE(BM_WorkQueueAnyInvocableExecution, BasicWorkQueue)
+    ->Range(8, 128)
+    ->UseRealTime()
+    ->MeasureProcessCPUTime();
+BENCHMARK_TEMPLATE(BM_WorkQueueAnyInvocableExecution, ChaseLevWorkQueue)
     ->Range(8, 128)
     ->UseRealTime()
     ->MeasureProcessCPUTime();
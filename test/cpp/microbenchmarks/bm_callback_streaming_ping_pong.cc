@@ -58,6 +58,14 @@ BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, MinInProcess, NoOpMutator,
                    NoOpMutator)
     ->Apply(StreamingPingPongArgs);
 
+// Streaming with the server reactions inline
+BENCHMARK_TEMPLATE(BM_CallbackBidiStreamingInlineReactions, InProcess,
+                   NoOpMutator, NoOpMutator)
+    ->Apply(StreamingPingPongArgs);
+BENCHMARK_TEMPLATE(BM_CallbackBidiStreamingInlineReactions, MinInProcess,
+                   NoOpMutator, NoOpMutator)
+    ->Apply(StreamingPingPongArgs);
+
 // Streaming with different message number
 BENCHMARK_TEMPLATE(BM_CallbackBidiStreaming, InProcess, NoOpMutator,
                    NoOpMutator)
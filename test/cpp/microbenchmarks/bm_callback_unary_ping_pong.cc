@@ -101,6 +101,17 @@ BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InProcess, NoOpMutator,
 BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPong, InProcess, NoOpMutator,
                    Server_AddInitialMetadata<RandomAsciiMetadata<10>, 100>)
     ->Args({0, 0});
+
+// Client interceptors run for all the batches and created per RPC, or
+// subscribed to the status only and shared between the RPCs
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPongWithInterceptors, InProcess,
+                   PerCallInterceptorFactory)
+    ->Args({0, 0, 1})
+    ->Args({0, 0, 4});
+BENCHMARK_TEMPLATE(BM_CallbackUnaryPingPongWithInterceptors, InProcess,
+                   StatelessInterceptorFactory)
+    ->Args({0, 0, 1})
+    ->Args({0, 0, 4});
 }  // namespace testing
 }  // namespace grpc
 
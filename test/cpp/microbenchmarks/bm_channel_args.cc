@@ -15,15 +15,22 @@
 // Benchmark ChannelArgs comparison performance between grpc_channel_args and
 // grpc_core::ChannelArgs
 
+#include <string.h>
+
+#include <map>
 #include <random>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
 #include "absl/container/btree_map.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpcpp/support/channel_arguments.h>
 
+#include "src/core/client_channel/subchannel_pool_interface.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/resolved_address.h"
 
 const char kKey[] = "a very long key";
 const char kValue[] = "a very long value";
@@ -82,6 +89,32 @@ void BM_ChannelArgsAsKeyIntoBTree(benchmark::State& state) {
 }
 BENCHMARK(BM_ChannelArgsAsKeyIntoBTree);
 
+// Subchannel pool lookups with many channels to the same address, whose args
+// share most of their entries, as they do when created from the same
+// template.
+void BM_SubchannelKeyAsKeyIntoMap(benchmark::State& state) {
+  grpc_core::ChannelArgs common;
+  for (int i = 0; i < state.range(0); i++) {
+    common = common.Set(absl::StrCat(kKey, i), kValue);
+  }
+  grpc_resolved_address address;
+  memset(&address, 0, sizeof(address));
+  address.len = 16;
+  std::map<grpc_core::SubchannelKey, int> m;
+  std::vector<grpc_core::SubchannelKey> v;
+  for (int i = 0; i < 10000; i++) {
+    grpc_core::SubchannelKey key(address, common.Set(kKey, i));
+    m.emplace(key, i);
+    v.push_back(std::move(key));
+  }
+  std::shuffle(v.begin(), v.end(), std::mt19937(std::random_device()()));
+  size_t n = 0;
+  for (auto s : state) {
+    benchmark::DoNotOptimize(m.find(v[n++ % v.size()]));
+  }
+}
+BENCHMARK(BM_SubchannelKeyAsKeyIntoMap)->Arg(1)->Arg(10)->Arg(50);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
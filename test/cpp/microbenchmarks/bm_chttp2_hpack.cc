@@ -20,21 +20,34 @@
 
 #include <string.h>
 
+#include <limits>
 #include <memory>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
+#include "absl/flags/flag.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/random/random.h"
+#include "absl/strings/escaping.h"
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/strings/strip.h"
 
 #include <grpc/slice.h>
 #include <grpc/support/alloc.h>
 
+#include "src/core/ext/transport/chttp2/transport/hpack_constants.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_encoder.h"
 #include "src/core/ext/transport/chttp2/transport/hpack_parser.h"
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/load_file.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -45,6 +58,16 @@
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
 
+ABSL_FLAG(std::vector<std::string>, hpack_corpus,
+          std::vector<std::string>(
+              {"test/cpp/microbenchmarks/hpack_corpus/"
+               "client_initial_metadata.headers",
+               "test/cpp/microbenchmarks/hpack_corpus/"
+               "server_metadata.headers"}),
+          "Header corpora replayed by the BM_HpackCorpus benchmarks: "
+          "'key: value' lines, with an empty line after each header block "
+          "and base64 values for -bin keys.");
+
 static grpc_slice MakeSlice(const std::vector<uint8_t>& bytes) {
   grpc_slice s = grpc_slice_malloc(bytes.size());
   uint8_t* p = GRPC_SLICE_START_PTR(s);
@@ -330,6 +353,9 @@ BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<31, false>)
     ->Args({0, 16384});
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<100, false>)
     ->Args({0, 16384});
+// auth token / tracing context sized binary values
+BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleBinaryElem<1024, false>)
+    ->Args({0, 16384});
 // test with a tiny frame size, to highlight continuation costs
 BENCHMARK_TEMPLATE(BM_HpackEncoderEncodeHeader, SingleNonBinaryElem)
     ->Args({0, 1});
@@ -629,6 +655,29 @@ class SameDeadline {
   }
 };
 
+// Server initial metadata once the tables are warm: every field indexed.
+class IndexedServerInitialMetadata {
+ public:
+  static std::vector<grpc_slice> GetInitSlices() {
+    return {grpc_slice_from_static_string(
+        "@\x0c"
+        "content-type"
+        "\x10"
+        "application/grpc"
+        "@\x0d"
+        "grpc-encoding"
+        "\x08"
+        "identity"
+        "@\x14"
+        "grpc-accept-encoding"
+        "\x0d"
+        "identity,gzip")};
+  }
+  static std::vector<grpc_slice> GetBenchmarkSlices() {
+    return {MakeSlice({0x88, 0xbe, 0xbf, 0xc0})};
+  }
+};
+
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, EmptyBatch);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, IndexedSingleStaticElem);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, AddIndexedSingleStaticElem);
@@ -662,9 +711,285 @@ BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader,
                    RepresentativeServerInitialMetadata);
 BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, SameDeadline);
+BENCHMARK_TEMPLATE(BM_HpackParserParseHeader, IndexedServerInitialMetadata);
 
 }  // namespace hpack_parser_fixtures
 
+////////////////////////////////////////////////////////////////////////////////
+// Corpus replay: the header blocks of a whole connection, shaped after
+// production traffic, through the encoder and the parser.
+//
+
+namespace hpack_corpus {
+
+// The header blocks sent in one direction of one connection.
+struct Corpus {
+  std::string name;
+  std::vector<std::vector<std::pair<std::string, std::string>>> blocks;
+  size_t num_headers = 0;
+  // Total length of the keys and values.
+  size_t raw_bytes = 0;
+};
+
+Corpus LoadCorpus(const std::string& path) {
+  auto contents = grpc_core::LoadFile(path, /*add_null_terminator=*/false);
+  CHECK(contents.ok()) << path << ": " << contents.status();
+  Corpus corpus;
+  corpus.name = std::string(absl::StripSuffix(
+      absl::string_view(path).substr(path.find_last_of('/') + 1),
+      ".headers"));
+  std::vector<std::pair<std::string, std::string>> block;
+  for (absl::string_view line :
+       absl::StrSplit(contents->as_string_view(), '\n')) {
+    if (absl::StartsWith(line, "#")) continue;
+    if (line.empty()) {
+      if (!block.empty()) corpus.blocks.push_back(std::move(block));
+      block.clear();
+      continue;
+    }
+    // Skip the colon of pseudo headers.
+    const size_t separator = line.find(": ", 1);
+    CHECK_NE(separator, absl::string_view::npos) << path << ": " << line;
+    std::string key(line.substr(0, separator));
+    std::string value(line.substr(separator + 2));
+    if (absl::EndsWith(key, "-bin")) {
+      std::string decoded;
+      CHECK(absl::Base64Unescape(value, &decoded)) << path << ": " << line;
+      value = std::move(decoded);
+    }
+    ++corpus.num_headers;
+    corpus.raw_bytes += key.size() + value.size();
+    block.emplace_back(std::move(key), std::move(value));
+  }
+  if (!block.empty()) corpus.blocks.push_back(std::move(block));
+  CHECK(!corpus.blocks.empty()) << path;
+  return corpus;
+}
+
+std::vector<grpc_metadata_batch> MakeBatches(const Corpus& corpus) {
+  std::vector<grpc_metadata_batch> batches(corpus.blocks.size());
+  for (size_t i = 0; i < corpus.blocks.size(); ++i) {
+    for (const auto& header : corpus.blocks[i]) {
+      batches[i].Append(header.first,
+                        grpc_core::Slice::FromCopiedString(header.second),
+                        [&header](absl::string_view error,
+                                  const grpc_core::Slice&) {
+                          grpc_core::Crash(absl::StrCat(
+                              "Bad corpus header ", header.first, ": ",
+                              error));
+                        });
+    }
+  }
+  return batches;
+}
+
+// The encoder features to evaluate.
+enum class Mode { kDefault, kAdaptiveIndexing, kHeaderBlockCaching };
+
+const char* ModeName(Mode mode) {
+  switch (mode) {
+    case Mode::kDefault:
+      return "default";
+    case Mode::kAdaptiveIndexing:
+      return "adaptive_indexing";
+    case Mode::kHeaderBlockCaching:
+      return "header_block_caching";
+  }
+  GPR_UNREACHABLE_CODE(return "unknown");
+}
+
+void Configure(Mode mode, grpc_core::HPackCompressor* compressor) {
+  compressor->SetAdaptiveIndexing(mode == Mode::kAdaptiveIndexing);
+  compressor->SetHeaderBlockCaching(mode == Mode::kHeaderBlockCaching);
+}
+
+grpc_core::HPackCompressor::EncodeHeaderOptions EncodeOptions(
+    uint32_t stream_id, grpc_core::FakeCallTracer* call_tracer) {
+  return grpc_core::HPackCompressor::EncodeHeaderOptions{
+      stream_id, false, true, 1024 * 1024, call_tracer};
+}
+
+// Encodes the batches as one connection does, and returns the header blocks
+// without their HTTP/2 frame header.
+std::vector<grpc_core::Slice> EncodeBlocks(
+    const std::vector<grpc_metadata_batch>& batches, Mode mode) {
+  grpc_core::HPackCompressor compressor;
+  Configure(mode, &compressor);
+  grpc_core::FakeCallTracer call_tracer;
+  std::vector<grpc_core::Slice> blocks;
+  uint32_t stream_id = 1;
+  for (const auto& batch : batches) {
+    grpc_core::SliceBuffer frame;
+    compressor.EncodeHeaders(EncodeOptions(stream_id, &call_tracer), batch,
+                             frame.c_slice_buffer());
+    stream_id += 2;
+    std::string bytes = frame.JoinIntoString();
+    CHECK_GT(bytes.size(), 9u);
+    // Everything fits in a single HEADERS frame.
+    const size_t length = (static_cast<uint8_t>(bytes[0]) << 16) |
+                          (static_cast<uint8_t>(bytes[1]) << 8) |
+                          static_cast<uint8_t>(bytes[2]);
+    CHECK_EQ(length, bytes.size() - 9);
+    blocks.push_back(grpc_core::Slice::FromCopiedString(bytes.substr(9)));
+  }
+  return blocks;
+}
+
+// What the header blocks of a corpus look like on the wire.
+class WireStats {
+ public:
+  explicit WireStats(const std::vector<grpc_core::Slice>& blocks) {
+    for (const auto& block : blocks) Add(block.as_string_view());
+  }
+
+  void SetCounters(const Corpus& corpus, benchmark::State& state) const {
+    state.counters["wire_bytes_per_block"] =
+        static_cast<double>(bytes_) / corpus.blocks.size();
+    state.counters["wire_bytes_per_header"] =
+        static_cast<double>(bytes_) / corpus.num_headers;
+    state.counters["compression_ratio"] =
+        static_cast<double>(corpus.raw_bytes) / bytes_;
+    // Fields sent as just an index into the dynamic table.
+    state.counters["dynamic_table_hit_rate"] =
+        static_cast<double>(dynamic_table_hits_) / fields_;
+    // Seconds per header.
+    state.counters["time_per_header"] = benchmark::Counter(
+        static_cast<double>(corpus.num_headers * state.iterations()),
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+  }
+
+ private:
+  static uint32_t ReadInteger(uint8_t prefix_bits, absl::string_view* input) {
+    CHECK(!input->empty());
+    const uint32_t mask = (1u << prefix_bits) - 1;
+    uint32_t value = static_cast<uint8_t>(input->front()) & mask;
+    input->remove_prefix(1);
+    if (value < mask) return value;
+    for (uint32_t shift = 0;; shift += 7) {
+      CHECK(!input->empty());
+      const uint8_t byte = input->front();
+      input->remove_prefix(1);
+      value += static_cast<uint32_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) return value;
+    }
+  }
+
+  static void SkipString(absl::string_view* input) {
+    const uint32_t length = ReadInteger(7, input);
+    CHECK_LE(length, input->size());
+    input->remove_prefix(length);
+  }
+
+  void Add(absl::string_view block) {
+    bytes_ += block.size();
+    while (!block.empty()) {
+      const uint8_t first = block.front();
+      if (first & 0x80) {
+        ++fields_;
+        const uint32_t index = ReadInteger(7, &block);
+        if (index > grpc_core::hpack_constants::kLastStaticEntry) {
+          ++dynamic_table_hits_;
+        }
+      } else if ((first & 0xe0) == 0x20) {
+        // Dynamic table size update.
+        ReadInteger(5, &block);
+      } else {
+        ++fields_;
+        // Literal, with or without incremental indexing.
+        if (ReadInteger((first & 0x40) ? 6 : 4, &block) == 0) {
+          SkipString(&block);
+        }
+        SkipString(&block);
+      }
+    }
+  }
+
+  size_t bytes_ = 0;
+  size_t fields_ = 0;
+  size_t dynamic_table_hits_ = 0;
+};
+
+// Each iteration encodes the whole corpus on a new connection.
+void BM_HpackCorpusEncode(benchmark::State& state, const Corpus& corpus,
+                          Mode mode) {
+  grpc_core::ExecCtx exec_ctx;
+  std::vector<grpc_metadata_batch> batches = MakeBatches(corpus);
+  WireStats wire_stats(EncodeBlocks(batches, mode));
+  grpc_core::FakeCallTracer call_tracer;
+  grpc_slice_buffer outbuf;
+  grpc_slice_buffer_init(&outbuf);
+  for (auto _ : state) {
+    grpc_core::HPackCompressor compressor;
+    Configure(mode, &compressor);
+    uint32_t stream_id = 1;
+    for (const auto& batch : batches) {
+      compressor.EncodeHeaders(EncodeOptions(stream_id, &call_tracer), batch,
+                               &outbuf);
+      stream_id += 2;
+      grpc_slice_buffer_reset_and_unref(&outbuf);
+    }
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  grpc_slice_buffer_destroy(&outbuf);
+  wire_stats.SetCounters(corpus, state);
+}
+
+// Each iteration parses the whole corpus, as encoded with the given mode, on
+// a new connection.
+void BM_HpackCorpusParse(benchmark::State& state, const Corpus& corpus,
+                         Mode mode) {
+  grpc_core::ExecCtx exec_ctx;
+  std::vector<grpc_core::Slice> blocks =
+      EncodeBlocks(MakeBatches(corpus), mode);
+  WireStats wire_stats(blocks);
+  absl::BitGen bitgen;
+  grpc_metadata_batch b;
+  for (auto _ : state) {
+    grpc_core::HPackParser p;
+    uint32_t stream_id = 1;
+    for (const auto& block : blocks) {
+      b.Clear();
+      p.BeginFrame(&b, std::numeric_limits<uint32_t>::max(),
+                   std::numeric_limits<uint32_t>::max(),
+                   grpc_core::HPackParser::Boundary::None,
+                   grpc_core::HPackParser::Priority::None,
+                   grpc_core::HPackParser::LogInfo{
+                       stream_id, grpc_core::HPackParser::LogInfo::kHeaders,
+                       false});
+      CHECK_OK(p.Parse(block.c_slice(), /*is_last=*/true,
+                       absl::BitGenRef(bitgen), /*call_tracer=*/nullptr));
+      p.FinishFrame();
+      stream_id += 2;
+    }
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  wire_stats.SetCounters(corpus, state);
+}
+
+void RegisterBenchmarks() {
+  for (const std::string& path : absl::GetFlag(FLAGS_hpack_corpus)) {
+    // Referenced by the benchmarks until the end of the process.
+    const Corpus* corpus = new Corpus(LoadCorpus(path));
+    for (Mode mode : {Mode::kDefault, Mode::kAdaptiveIndexing,
+                      Mode::kHeaderBlockCaching}) {
+      const std::string suffix =
+          absl::StrCat("/", corpus->name, "/", ModeName(mode));
+      benchmark::RegisterBenchmark(
+          absl::StrCat("BM_HpackCorpusEncode", suffix).c_str(),
+          [corpus, mode](benchmark::State& state) {
+            BM_HpackCorpusEncode(state, *corpus, mode);
+          });
+      benchmark::RegisterBenchmark(
+          absl::StrCat("BM_HpackCorpusParse", suffix).c_str(),
+          [corpus, mode](benchmark::State& state) {
+            BM_HpackCorpusParse(state, *corpus, mode);
+          });
+    }
+  }
+}
+
+}  // namespace hpack_corpus
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
@@ -676,6 +1001,7 @@ int main(int argc, char** argv) {
   LibraryInitializer libInit;
   ::benchmark::Initialize(&argc, argv);
   grpc::testing::InitTest(&argc, &argv, false);
+  hpack_corpus::RegisterBenchmarks();
   benchmark::RunTheBenchmarksNamespaced();
   return 0;
 }
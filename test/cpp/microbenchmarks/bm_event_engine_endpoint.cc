@@ -0,0 +1,272 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark the endpoints of the platform's EventEngine directly, without any
+// gRPC framing: ping-pong latency and streaming throughput over a loopback
+// connection, and the CPU time the process spends per byte.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <ctime>
+#include <limits>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/log/check.h"
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/event_engine/slice.h>
+#include <grpc/event_engine/slice_buffer.h>
+
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "test/core/event_engine/event_engine_test_utils.h"
+#include "test/core/test_util/port.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::ConnectionManager;
+using ::grpc_event_engine::experimental::CreateEventEngine;
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Slice;
+using ::grpc_event_engine::experimental::SliceBuffer;
+
+// Reads everything from the server endpoint of a connection, and optionally
+// writes it back, until the client closes the connection.
+class Peer : public std::enable_shared_from_this<Peer> {
+ public:
+  Peer(EventEngine::Endpoint* endpoint, bool echo)
+      : endpoint_(endpoint), echo_(echo) {
+    read_args_.read_hint_bytes = 1;
+    write_args_.max_frame_size = std::numeric_limits<int64_t>::max();
+  }
+
+  void Start() { Read(); }
+
+  void WaitForBytesRead(size_t bytes) {
+    grpc_core::MutexLock lock(&mu_);
+    while (bytes_read_ < bytes) cv_.Wait(&mu_);
+  }
+
+  // Once done, the endpoint is not used anymore.
+  void WaitUntilDone() {
+    grpc_core::MutexLock lock(&mu_);
+    while (!done_) cv_.Wait(&mu_);
+  }
+
+ private:
+  void Read() {
+    do {
+      buffer_.Clear();
+      if (!endpoint_->Read(
+              [self = shared_from_this()](absl::Status status) {
+                if (!status.ok()) return self->SetDone();
+                if (self->OnRead()) self->Read();
+              },
+              &buffer_, &read_args_)) {
+        return;
+      }
+    } while (OnRead());
+  }
+
+  // Returns true if the next read is to be started right away.
+  bool OnRead() {
+    {
+      grpc_core::MutexLock lock(&mu_);
+      bytes_read_ += buffer_.Length();
+      cv_.SignalAll();
+    }
+    if (!echo_) return true;
+    return endpoint_->Write(
+        [self = shared_from_this()](absl::Status status) {
+          if (!status.ok()) return self->SetDone();
+          self->Read();
+        },
+        &buffer_, &write_args_);
+  }
+
+  void SetDone() {
+    grpc_core::MutexLock lock(&mu_);
+    done_ = true;
+    cv_.SignalAll();
+  }
+
+  EventEngine::Endpoint* const endpoint_;
+  const bool echo_;
+  EventEngine::Endpoint::ReadArgs read_args_;
+  EventEngine::Endpoint::WriteArgs write_args_;
+  SliceBuffer buffer_;
+  grpc_core::Mutex mu_;
+  grpc_core::CondVar cv_;
+  size_t bytes_read_ ABSL_GUARDED_BY(mu_) = 0;
+  bool done_ ABSL_GUARDED_BY(mu_) = false;
+};
+
+// A loopback connection between two endpoints of the engine under test.
+class Connection {
+ public:
+  explicit Connection(bool echo)
+      : manager_(CreateEventEngine(), CreateEventEngine()) {
+    std::string address =
+        absl::StrCat("ipv4:127.0.0.1:", grpc_pick_unused_port_or_die());
+    CHECK_OK(manager_.BindAndStartListener({address},
+                                           /*listener_type_oracle=*/false));
+    auto endpoints = manager_.CreateConnection(
+        address, std::chrono::seconds(10), /*client_type_oracle=*/false);
+    CHECK_OK(endpoints.status());
+    std::tie(client_, server_) = std::move(*endpoints);
+    peer_ = std::make_shared<Peer>(server_.get(), echo);
+    peer_->Start();
+    write_args_.max_frame_size = std::numeric_limits<int64_t>::max();
+  }
+
+  ~Connection() {
+    client_.reset();
+    peer_->WaitUntilDone();
+    server_.reset();
+  }
+
+  Peer* peer() { return peer_.get(); }
+
+  void Write(const Slice& message) {
+    SliceBuffer data;
+    data.Append(message.Ref());
+    grpc_core::Notification done;
+    if (client_->Write(
+            [&done](absl::Status status) {
+              CHECK_OK(status);
+              done.Notify();
+            },
+            &data, &write_args_)) {
+      return;
+    }
+    done.WaitForNotification();
+  }
+
+  void Read(size_t size) {
+    SliceBuffer buffer;
+    size_t received = 0;
+    while (received < size) {
+      EventEngine::Endpoint::ReadArgs args;
+      args.read_hint_bytes = size - received;
+      grpc_core::Notification done;
+      if (!client_->Read(
+              [&done](absl::Status status) {
+                CHECK_OK(status);
+                done.Notify();
+              },
+              &buffer, &args)) {
+        done.WaitForNotification();
+      }
+      received += buffer.Length();
+      buffer.Clear();
+    }
+  }
+
+ private:
+  ConnectionManager manager_;
+  std::unique_ptr<EventEngine::Endpoint> client_;
+  std::unique_ptr<EventEngine::Endpoint> server_;
+  std::shared_ptr<Peer> peer_;
+  EventEngine::Endpoint::WriteArgs write_args_;
+};
+
+// Reports the CPU time of the whole process, across the threads of the
+// engine, per byte sent by the client.
+class CpuPerByte {
+ public:
+  explicit CpuPerByte(benchmark::State& state)
+      : state_(state), start_(std::clock()) {}
+
+  ~CpuPerByte() {
+    double cpu_ns =
+        static_cast<double>(std::clock() - start_) / CLOCKS_PER_SEC * 1e9;
+    state_.counters["cpu_ns_per_byte"] =
+        cpu_ns / (state_.iterations() * state_.range(0));
+    state_.SetBytesProcessed(state_.iterations() * state_.range(0));
+  }
+
+ private:
+  benchmark::State& state_;
+  const std::clock_t start_;
+};
+
+void BM_EndpointPingPong(benchmark::State& state) {
+  const size_t size = state.range(0);
+  Connection connection(/*echo=*/true);
+  Slice message = Slice::FromCopiedString(std::string(size, 'a'));
+  {
+    CpuPerByte cpu_per_byte(state);
+    for (auto _ : state) {
+      connection.Write(message);
+      connection.Read(size);
+    }
+  }
+}
+BENCHMARK(BM_EndpointPingPong)
+    ->RangeMultiplier(16)
+    ->Range(1, 1 << 20)
+    ->UseRealTime();
+
+void BM_EndpointStreaming(benchmark::State& state) {
+  const size_t size = state.range(0);
+  Connection connection(/*echo=*/false);
+  Slice message = Slice::FromCopiedString(std::string(size, 'a'));
+  {
+    CpuPerByte cpu_per_byte(state);
+    for (auto _ : state) {
+      connection.Write(message);
+    }
+    // Count the time until everything was received.
+    connection.peer()->WaitForBytesRead(state.iterations() * size);
+  }
+}
+BENCHMARK(BM_EndpointStreaming)
+    ->RangeMultiplier(16)
+    ->Range(1, 1 << 20)
+    ->UseRealTime();
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -107,6 +107,13 @@ BENCHMARK_TEMPLATE(BM_UnaryPingPong, InProcess, NoOpMutator,
                    Server_AddInitialMetadata<RandomAsciiMetadata<10>, 100>)
     ->Args({0, 0});
 
+// Compare the p50_us/p99_us counters of BusyPollTCP with those of TCP, and
+// between runs with and without GRPC_EVENT_ENGINE_POLLER_SPIN_US.
+BENCHMARK_TEMPLATE(BM_UnaryPingPongLatency, TCP)->Args({0, 0})->Args({64, 64});
+BENCHMARK_TEMPLATE(BM_UnaryPingPongLatency, BusyPollTCP)
+    ->Args({0, 0})
+    ->Args({64, 64});
+
 }  // namespace testing
 }  // namespace grpc
 
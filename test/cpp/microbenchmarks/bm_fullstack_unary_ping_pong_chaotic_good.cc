@@ -20,6 +20,11 @@
 // TODO(ctiller): fold back into bm_fullstack_unary_ping_pong.cc once chaotic
 // good can run without custom experiment configuration.
 
+#include "absl/log/check.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include "src/core/lib/gprpp/crash.h"
 #include "src/cpp/ext/chaotic_good.h"
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/fullstack_unary_ping_pong.h"
@@ -28,6 +33,8 @@
 namespace grpc {
 namespace testing {
 
+// Stripes messages over kDataConnections data connections.
+template <int kDataConnections>
 class ChaoticGoodFixture : public BaseFixture {
  public:
   explicit ChaoticGoodFixture(
@@ -44,6 +51,7 @@ class ChaoticGoodFixture : public BaseFixture {
     server_ = b.BuildAndStart();
     ChannelArguments args;
     config.ApplyCommonChannelArguments(&args);
+    args.SetInt(GRPC_ARG_CHAOTIC_GOOD_DATA_CONNECTIONS, kDataConnections);
     if (!address.empty()) {
       channel_ = grpc::CreateCustomChannel(
           address, ChaoticGoodInsecureChannelCredentials(), args);
@@ -79,6 +87,78 @@ class ChaoticGoodFixture : public BaseFixture {
   int port_;
 };
 
+// Streams messages of state.range(0) bytes from the client to the server, each
+// write starting as soon as the previous one completes.
+template <class Fixture>
+static void BM_StreamingThroughput(benchmark::State& state) {
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  {
+    EchoRequest send_request;
+    EchoRequest recv_request;
+    if (state.range(0) > 0) {
+      send_request.set_message(std::string(state.range(0), 'a'));
+    }
+    ServerContext svr_ctx;
+    ServerAsyncReaderWriter<EchoResponse, EchoRequest> response_rw(&svr_ctx);
+    service.RequestBidiStream(&svr_ctx, &response_rw, fixture->cq(),
+                              fixture->cq(), tag(0));
+    std::unique_ptr<EchoTestService::Stub> stub(
+        EchoTestService::NewStub(fixture->channel()));
+    ClientContext cli_ctx;
+    auto request_rw = stub->AsyncBidiStream(&cli_ctx, fixture->cq(), tag(1));
+    // Waits for both tags, which must succeed.
+    auto wait_for_both = [&fixture]() {
+      int need_tags = (1 << 0) | (1 << 1);
+      void* t;
+      bool ok;
+      while (need_tags) {
+        CHECK(fixture->cq()->Next(&t, &ok));
+        CHECK(ok);
+        int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+        CHECK(need_tags & (1 << i));
+        need_tags &= ~(1 << i);
+      }
+    };
+    wait_for_both();
+    response_rw.Read(&recv_request, tag(0));
+    void* t;
+    bool ok;
+    for (auto _ : state) {
+      request_rw->Write(send_request, tag(1));
+      while (true) {
+        CHECK(fixture->cq()->Next(&t, &ok));
+        if (t == tag(0)) {
+          response_rw.Read(&recv_request, tag(0));
+        } else if (t == tag(1)) {
+          break;
+        } else {
+          grpc_core::Crash("unreachable");
+        }
+      }
+    }
+    request_rw->WritesDone(tag(1));
+    // The last read fails once the client is done writing.
+    int need_tags = (1 << 0) | (1 << 1);
+    while (need_tags) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      int i = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      if (t == tag(0) && ok) {
+        response_rw.Read(&recv_request, tag(0));
+        continue;
+      }
+      need_tags &= ~(1 << i);
+    }
+    response_rw.Finish(Status::OK, tag(0));
+    Status final_status;
+    request_rw->Finish(&final_status, tag(1));
+    wait_for_both();
+    CHECK(final_status.ok());
+  }
+  fixture.reset();
+  state.SetBytesProcessed(state.range(0) * state.iterations());
+}
+
 //******************************************************************************
 // CONFIGURATIONS
 //
@@ -94,10 +174,21 @@ static void SweepSizesArgs(benchmark::internal::Benchmark* b) {
   }
 }
 
-BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodFixture, NoOpMutator,
+BENCHMARK_TEMPLATE(BM_UnaryPingPong, ChaoticGoodFixture<1>, NoOpMutator,
                    NoOpMutator)
     ->Apply(SweepSizesArgs);
 
+static void StreamingSizesArgs(benchmark::internal::Benchmark* b) {
+  for (int i = 1024; i <= 16 * 1024 * 1024; i *= 8) {
+    b->Arg(i);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_StreamingThroughput, ChaoticGoodFixture<1>)
+    ->Apply(StreamingSizesArgs);
+BENCHMARK_TEMPLATE(BM_StreamingThroughput, ChaoticGoodFixture<4>)
+    ->Apply(StreamingSizesArgs);
+
 }  // namespace testing
 }  // namespace grpc
 
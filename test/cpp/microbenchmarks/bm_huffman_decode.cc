@@ -26,7 +26,7 @@
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/microbenchmarks/huffman_geometries/index.h"
 
-std::vector<uint8_t> MakeInput(int min, int max) {
+std::vector<uint8_t> MakeUncompressedInput(int min, int max) {
   std::vector<uint8_t> v;
   std::uniform_int_distribution<> distribution(min, max);
   static std::mt19937 rd(0);
@@ -34,7 +34,12 @@ std::vector<uint8_t> MakeInput(int min, int max) {
   for (int i = 0; i < 1024 * 1024; i++) {
     v.push_back(distribution(rd));
   }
-  grpc_core::Slice s = grpc_core::Slice::FromCopiedBuffer(v);
+  return v;
+}
+
+std::vector<uint8_t> MakeInput(int min, int max) {
+  grpc_core::Slice s =
+      grpc_core::Slice::FromCopiedBuffer(MakeUncompressedInput(min, max));
   grpc_core::Slice c(grpc_chttp2_huffman_compress(s.c_slice()));
   return std::vector<uint8_t>(c.begin(), c.end());
 }
@@ -86,6 +91,49 @@ static void BM_Decode(benchmark::State& state, CharSet chars_gen) {
 
 DECL_HUFFMAN_VARIANTS();
 
+const grpc_core::Slice& UncompressedAllChars() {
+  static const grpc_core::NoDestruct<grpc_core::Slice> data(
+      grpc_core::Slice::FromCopiedBuffer(MakeUncompressedInput(0, 255)));
+  return *data;
+}
+const grpc_core::Slice& UncompressedAsciiChars() {
+  static const grpc_core::NoDestruct<grpc_core::Slice> data(
+      grpc_core::Slice::FromCopiedBuffer(MakeUncompressedInput(32, 126)));
+  return *data;
+}
+const grpc_core::Slice& UncompressedAlphaChars() {
+  static const grpc_core::NoDestruct<grpc_core::Slice> data(
+      grpc_core::Slice::FromCopiedBuffer(MakeUncompressedInput('a', 'z')));
+  return *data;
+}
+
+using UncompressedCharSet = const grpc_core::Slice& (*)();
+
+static void BM_HuffmanCompress(benchmark::State& state,
+                               UncompressedCharSet chars_gen) {
+  const grpc_core::Slice& chars = chars_gen();
+  for (auto _ : state) {
+    grpc_core::Slice out(grpc_chttp2_huffman_compress(chars.c_slice()));
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * chars.length());
+}
+BENCHMARK_CAPTURE(BM_HuffmanCompress, all_chars, UncompressedAllChars);
+BENCHMARK_CAPTURE(BM_HuffmanCompress, ascii_chars, UncompressedAsciiChars);
+BENCHMARK_CAPTURE(BM_HuffmanCompress, alpha_chars, UncompressedAlphaChars);
+
+static void BM_Base64EncodeAndHuffmanCompress(benchmark::State& state) {
+  const grpc_core::Slice& chars = UncompressedAllChars();
+  for (auto _ : state) {
+    uint32_t wire_size;
+    grpc_core::Slice out(grpc_chttp2_base64_encode_and_huffman_compress(
+        chars.c_slice(), &wire_size));
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * chars.length());
+}
+BENCHMARK(BM_Base64EncodeAndHuffmanCompress);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
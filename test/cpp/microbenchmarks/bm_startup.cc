@@ -0,0 +1,95 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark what a process pays before its first call: initializing the
+// library, building the core configuration, and creating a first channel.
+// Each iteration starts from a library that was shut down, and from a core
+// configuration that was dropped.
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/credentials.h>
+#include <grpc/event_engine/event_engine.h>
+#include <grpc/grpc.h>
+
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "test/core/event_engine/event_engine_test_utils.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+// Returns the process to the state it was in before the iteration.
+void ShutdownAndDropConfiguration() {
+  grpc_shutdown_blocking();
+  grpc_event_engine::experimental::WaitForSingleOwner(
+      grpc_event_engine::experimental::GetDefaultEventEngine());
+  grpc_core::CoreConfiguration::Reset();
+}
+
+void BM_InitShutdown(benchmark::State& state) {
+  for (auto _ : state) {
+    grpc_init();
+    state.PauseTiming();
+    ShutdownAndDropConfiguration();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(BM_InitShutdown);
+
+void BM_CoreConfigurationBuild(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&grpc_core::CoreConfiguration::Get());
+    state.PauseTiming();
+    grpc_core::CoreConfiguration::Reset();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(BM_CoreConfigurationBuild);
+
+void BM_FirstChannelCreate(benchmark::State& state) {
+  for (auto _ : state) {
+    grpc_init();
+    grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+    grpc_channel* channel =
+        grpc_channel_create("localhost:1234", creds, nullptr);
+    grpc_channel_credentials_release(creds);
+    state.PauseTiming();
+    grpc_channel_destroy(channel);
+    ShutdownAndDropConfiguration();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(BM_FirstChannelCreate);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -15,6 +15,7 @@
 #include <atomic>
 #include <cmath>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include <benchmark/benchmark.h>
@@ -27,6 +28,9 @@
 
 #include "src/core/lib/event_engine/common_closures.h"
 #include "src/core/lib/event_engine/thread_pool/thread_pool.h"
+#include "src/core/lib/event_engine/thread_pool/work_stealing_thread_pool.h"
+#include "src/core/lib/event_engine/work_queue/basic_work_queue.h"
+#include "src/core/lib/event_engine/work_queue/chase_lev_work_queue.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/notification.h"
 #include "src/core/util/useful.h"
@@ -37,8 +41,22 @@
 namespace {
 
 using ::grpc_event_engine::experimental::AnyInvocableClosure;
+using ::grpc_event_engine::experimental::BasicWorkQueue;
+using ::grpc_event_engine::experimental::ChaseLevWorkQueue;
 using ::grpc_event_engine::experimental::EventEngine;
 using ::grpc_event_engine::experimental::ThreadPool;
+using ::grpc_event_engine::experimental::WorkStealingThreadPool;
+
+// Every benchmark runs with each kind of thread-local queue, selected by the
+// LocalQueue template parameter.
+template <typename LocalQueue>
+std::shared_ptr<ThreadPool> MakeBenchmarkThreadPool() {
+  constexpr bool kLockFreeLocalQueues =
+      std::is_same<LocalQueue, ChaseLevWorkQueue>::value;
+  return std::make_shared<WorkStealingThreadPool>(
+      grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u),
+      /*numa_nodes=*/std::vector<std::vector<int>>(), kLockFreeLocalQueues);
+}
 
 struct FanoutParameters {
   int depth;
@@ -46,9 +64,9 @@ struct FanoutParameters {
   int limit;
 };
 
+template <typename LocalQueue>
 void BM_ThreadPool_RunSmallLambda(benchmark::State& state) {
-  auto pool = grpc_event_engine::experimental::MakeThreadPool(
-      grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u));
+  auto pool = MakeBenchmarkThreadPool<LocalQueue>();
   const int cb_count = state.range(0);
   std::atomic_int runcount{0};
   for (auto _ : state) {
@@ -69,11 +87,16 @@ void BM_ThreadPool_RunSmallLambda(benchmark::State& state) {
   state.SetItemsProcessed(cb_count * state.iterations());
   pool->Quiesce();
 }
-BENCHMARK(BM_ThreadPool_RunSmallLambda)
+BENCHMARK_TEMPLATE(BM_ThreadPool_RunSmallLambda, BasicWorkQueue)
+    ->Range(100, 4096)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPool_RunSmallLambda, ChaseLevWorkQueue)
     ->Range(100, 4096)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
 
+template <typename LocalQueue>
 void BM_ThreadPool_RunClosure(benchmark::State& state) {
   int cb_count = state.range(0);
   grpc_core::Notification* signal = new grpc_core::Notification();
@@ -84,8 +107,7 @@ void BM_ThreadPool_RunClosure(benchmark::State& state) {
           (*signal_holder)->Notify();
         }
       });
-  auto pool = grpc_event_engine::experimental::MakeThreadPool(
-      grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u));
+  auto pool = MakeBenchmarkThreadPool<LocalQueue>();
   for (auto _ : state) {
     for (int i = 0; i < cb_count; i++) {
       pool->Run(closure);
@@ -102,7 +124,11 @@ void BM_ThreadPool_RunClosure(benchmark::State& state) {
   pool->Quiesce();
   delete closure;
 }
-BENCHMARK(BM_ThreadPool_RunClosure)
+BENCHMARK_TEMPLATE(BM_ThreadPool_RunClosure, BasicWorkQueue)
+    ->Range(100, 4096)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadPool_RunClosure, ChaseLevWorkQueue)
     ->Range(100, 4096)
     ->MeasureProcessCPUTime()
     ->UseRealTime();
@@ -165,10 +191,10 @@ void FanOutCallback(std::shared_ptr<ThreadPool> pool,
   }
 }
 
+template <typename LocalQueue>
 void BM_ThreadPool_Lambda_FanOut(benchmark::State& state) {
   auto params = GetFanoutParameters(state);
-  auto pool = grpc_event_engine::experimental::MakeThreadPool(
-      grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u));
+  auto pool = MakeBenchmarkThreadPool<LocalQueue>();
   for (auto _ : state) {
     std::atomic_int count{0};
     grpc_core::Notification signal;
@@ -180,7 +206,10 @@ void BM_ThreadPool_Lambda_FanOut(benchmark::State& state) {
   state.SetItemsProcessed(params.limit * state.iterations());
   pool->Quiesce();
 }
-BENCHMARK(BM_ThreadPool_Lambda_FanOut)->Apply(FanoutTestArguments);
+BENCHMARK_TEMPLATE(BM_ThreadPool_Lambda_FanOut, BasicWorkQueue)
+    ->Apply(FanoutTestArguments);
+BENCHMARK_TEMPLATE(BM_ThreadPool_Lambda_FanOut, ChaseLevWorkQueue)
+    ->Apply(FanoutTestArguments);
 
 void ClosureFanOutCallback(EventEngine::Closure* child_closure,
                            std::shared_ptr<ThreadPool> pool,
@@ -202,10 +231,10 @@ void ClosureFanOutCallback(EventEngine::Closure* child_closure,
   }
 }
 
+template <typename LocalQueue>
 void BM_ThreadPool_Closure_FanOut(benchmark::State& state) {
   auto params = GetFanoutParameters(state);
-  auto pool = grpc_event_engine::experimental::MakeThreadPool(
-      grpc_core::Clamp(gpr_cpu_num_cores(), 2u, 16u));
+  auto pool = MakeBenchmarkThreadPool<LocalQueue>();
   std::vector<EventEngine::Closure*> closures;
   closures.reserve(params.depth + 2);
   closures.push_back(nullptr);
@@ -239,7 +268,10 @@ void BM_ThreadPool_Closure_FanOut(benchmark::State& state) {
   for (auto i : closures) delete i;
   pool->Quiesce();
 }
-BENCHMARK(BM_ThreadPool_Closure_FanOut)->Apply(FanoutTestArguments);
+BENCHMARK_TEMPLATE(BM_ThreadPool_Closure_FanOut, BasicWorkQueue)
+    ->Apply(FanoutTestArguments);
+BENCHMARK_TEMPLATE(BM_ThreadPool_Closure_FanOut, ChaseLevWorkQueue)
+    ->Apply(FanoutTestArguments);
 
 }  // namespace
 
@@ -0,0 +1,162 @@
+// Copyright 2024 The gRPC Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares the heap based TimerList with the TimerWheel on the operations the
+// timer manager performs: arming, cancelling, and expiring timers, with a
+// varying number of other timers already pending.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/log/check.h"
+
+#include <grpc/event_engine/event_engine.h>
+
+#include "src/core/lib/event_engine/posix_engine/timer.h"
+#include "src/core/lib/event_engine/posix_engine/timer_wheel.h"
+#include "src/core/lib/gprpp/time.h"
+#include "test/core/test_util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace {
+
+using ::grpc_event_engine::experimental::EventEngine;
+using ::grpc_event_engine::experimental::Timer;
+using ::grpc_event_engine::experimental::TimerList;
+using ::grpc_event_engine::experimental::TimerListHost;
+using ::grpc_event_engine::experimental::TimerWheel;
+
+// A manually advanced clock, so that the benchmarks measure the timer lists
+// and not the system clock.
+class FakeHost final : public TimerListHost {
+ public:
+  grpc_core::Timestamp Now() override { return now_; }
+  void Kick() override {}
+
+  void Advance(grpc_core::Duration d) { now_ += d; }
+
+ private:
+  grpc_core::Timestamp now_ =
+      grpc_core::Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+};
+
+class NoopClosure final : public EventEngine::Closure {
+ public:
+  void Run() override {}
+};
+
+// Arm long lived timers to give the lists a population to work around. Their
+// deadlines are spread over days, far enough out that none of them expires
+// while the clock is advanced by BM_TimerExpire.
+template <typename List>
+void ArmBackground(List& list, FakeHost& host, std::vector<Timer>& timers,
+                   NoopClosure* closure) {
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int64_t> minutes(24 * 60, 7 * 24 * 60);
+  for (auto& timer : timers) {
+    list.TimerInit(&timer,
+                   host.Now() + grpc_core::Duration::Minutes(minutes(rng)),
+                   closure);
+  }
+}
+
+template <typename List>
+void CancelBackground(List& list, std::vector<Timer>& timers) {
+  for (auto& timer : timers) {
+    CHECK(list.TimerCancel(&timer));
+  }
+}
+
+// The common case for deadlines and keepalives: a timer is armed and then
+// cancelled before it fires.
+template <typename List>
+void BM_TimerInitCancel(benchmark::State& state) {
+  FakeHost host;
+  List list(&host);
+  NoopClosure closure;
+  std::vector<Timer> background(state.range(0));
+  ArmBackground(list, host, background, &closure);
+  Timer timer;
+  for (auto _ : state) {
+    list.TimerInit(&timer, host.Now() + grpc_core::Duration::Seconds(30),
+                   &closure);
+    CHECK(list.TimerCancel(&timer));
+  }
+  CancelBackground(list, background);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_TimerInitCancel, TimerList)
+    ->RangeMultiplier(10)
+    ->Range(1, 100000);
+BENCHMARK_TEMPLATE(BM_TimerInitCancel, TimerWheel)
+    ->RangeMultiplier(10)
+    ->Range(1, 100000);
+
+// Timers that run to expiry: arm a batch with short deadlines, then advance
+// the clock and collect them.
+template <typename List>
+void BM_TimerExpire(benchmark::State& state) {
+  constexpr int kBatch = 64;
+  FakeHost host;
+  List list(&host);
+  NoopClosure closure;
+  std::vector<Timer> background(state.range(0));
+  ArmBackground(list, host, background, &closure);
+  Timer timers[kBatch];
+  for (auto _ : state) {
+    for (int i = 0; i < kBatch; ++i) {
+      list.TimerInit(&timers[i],
+                     host.Now() + grpc_core::Duration::Milliseconds(1 + i % 8),
+                     &closure);
+    }
+    host.Advance(grpc_core::Duration::Milliseconds(8));
+    size_t fired = 0;
+    while (fired < kBatch) {
+      auto expired = list.TimerCheck(nullptr);
+      CHECK(expired.has_value());
+      fired += expired->size();
+    }
+    CHECK_EQ(fired, static_cast<size_t>(kBatch));
+  }
+  CancelBackground(list, background);
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+BENCHMARK_TEMPLATE(BM_TimerExpire, TimerList)
+    ->RangeMultiplier(10)
+    ->Range(1, 100000);
+BENCHMARK_TEMPLATE(BM_TimerExpire, TimerWheel)
+    ->RangeMultiplier(10)
+    ->Range(1, 100000);
+
+}  // namespace
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,497 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark how long xDS updates take to be processed, from the moment a
+// response with many resources is received to the moment every watcher saw
+// it. The responses are fed through a fake transport, so the benchmarks
+// measure parsing, validation and watcher notification only.
+//
+// The work happens on the EventEngine threads, so times are wall times.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/time.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/resolver/xds/xds_dependency_manager.h"
+#include "src/core/xds/grpc/xds_bootstrap_grpc.h"
+#include "src/core/xds/grpc/xds_client_grpc.h"
+#include "src/core/xds/grpc/xds_cluster_parser.h"
+#include "src/core/xds/grpc/xds_endpoint_parser.h"
+#include "src/core/xds/grpc/xds_listener_parser.h"
+#include "src/core/xds/grpc/xds_route_config_parser.h"
+#include "src/proto/grpc/testing/xds/v3/cluster.pb.h"
+#include "src/proto/grpc/testing/xds/v3/discovery.pb.h"
+#include "src/proto/grpc/testing/xds/v3/endpoint.pb.h"
+#include "src/proto/grpc/testing/xds/v3/http_connection_manager.pb.h"
+#include "src/proto/grpc/testing/xds/v3/listener.pb.h"
+#include "src/proto/grpc/testing/xds/v3/route.pb.h"
+#include "src/proto/grpc/testing/xds/v3/router.pb.h"
+#include "test/core/test_util/test_config.h"
+#include "test/core/xds/xds_transport_fake.h"
+
+namespace grpc_core {
+namespace {
+
+using ::envoy::config::cluster::v3::Cluster;
+using ::envoy::config::endpoint::v3::ClusterLoadAssignment;
+using ::envoy::config::listener::v3::Listener;
+using ::envoy::config::route::v3::RouteConfiguration;
+using ::envoy::extensions::filters::http::router::v3::Router;
+using ::envoy::extensions::filters::network::http_connection_manager::v3::
+    HttpConnectionManager;
+using ::envoy::service::discovery::v3::DiscoveryRequest;
+using ::envoy::service::discovery::v3::DiscoveryResponse;
+
+constexpr absl::Duration kTimeout = absl::Seconds(30);
+
+constexpr char kBootstrap[] =
+    "{\n"
+    "  \"xds_servers\": [\n"
+    "    {\n"
+    "      \"server_uri\": \"xds.example.com\",\n"
+    "      \"channel_creds\": [{\"type\": \"insecure\"}]\n"
+    "    }\n"
+    "  ],\n"
+    "  \"node\": {\"id\": \"bm_xds_update\"}\n"
+    "}";
+
+std::string ListenerName() { return "server.example.com"; }
+std::string RouteConfigName() { return "route_config"; }
+std::string ClusterName(int i) { return absl::StrCat("cluster_", i); }
+std::string EdsServiceName(int i) { return absl::StrCat("eds_", i); }
+
+// Every resource comes in two variants, which the benchmarks alternate
+// between so that each response changes every resource.
+Listener MakeListener(const std::string& name, int variant) {
+  HttpConnectionManager hcm;
+  auto* rds = hcm.mutable_rds();
+  rds->set_route_config_name(variant == 0
+                                 ? RouteConfigName()
+                                 : absl::StrCat(RouteConfigName(), "_1"));
+  rds->mutable_config_source()->mutable_ads();
+  auto* filter = hcm.add_http_filters();
+  filter->set_name("router");
+  filter->mutable_typed_config()->PackFrom(Router());
+  Listener listener;
+  listener.set_name(name);
+  listener.mutable_api_listener()->mutable_api_listener()->PackFrom(hcm);
+  return listener;
+}
+
+// Routes /service<i>/ to cluster i, for each of the clusters.
+RouteConfiguration MakeRouteConfig(const std::string& name, int num_clusters,
+                                   int variant) {
+  RouteConfiguration route_config;
+  route_config.set_name(name);
+  auto* virtual_host = route_config.add_virtual_hosts();
+  virtual_host->add_domains("*");
+  if (variant != 0) virtual_host->add_domains("variant.example.com");
+  for (int i = 0; i < num_clusters; i++) {
+    auto* route = virtual_host->add_routes();
+    route->mutable_match()->set_prefix(absl::StrCat("/service", i, "/"));
+    route->mutable_route()->set_cluster(ClusterName(i));
+  }
+  return route_config;
+}
+
+Cluster MakeCluster(const std::string& name, int index, int variant) {
+  Cluster cluster;
+  cluster.set_name(name);
+  cluster.set_type(Cluster::EDS);
+  auto* eds_config = cluster.mutable_eds_cluster_config();
+  eds_config->mutable_eds_config()->mutable_self();
+  eds_config->set_service_name(variant == 0
+                                   ? EdsServiceName(index)
+                                   : absl::StrCat(EdsServiceName(index), "_1"));
+  return cluster;
+}
+
+ClusterLoadAssignment MakeEndpoints(const std::string& name, int variant) {
+  ClusterLoadAssignment endpoints;
+  endpoints.set_cluster_name(name);
+  auto* locality = endpoints.add_endpoints();
+  locality->mutable_locality()->set_region("region");
+  locality->mutable_load_balancing_weight()->set_value(1);
+  for (int port : {1000, 1001}) {
+    auto* socket_address = locality->add_lb_endpoints()
+                               ->mutable_endpoint()
+                               ->mutable_address()
+                               ->mutable_socket_address();
+    socket_address->set_address("127.0.0.1");
+    socket_address->set_port_value(port + 2 * variant);
+  }
+  return endpoints;
+}
+
+template <typename Proto>
+std::string TypeUrl() {
+  return absl::StrCat("type.googleapis.com/", Proto::descriptor()->full_name());
+}
+
+template <typename Proto>
+std::string MakeResponse(const std::vector<Proto>& resources,
+                         const std::string& version) {
+  DiscoveryResponse response;
+  response.set_type_url(TypeUrl<Proto>());
+  response.set_version_info(version);
+  response.set_nonce(version);
+  for (const auto& resource : resources) {
+    response.add_resources()->PackFrom(resource);
+  }
+  return response.SerializeAsString();
+}
+
+// Counts down the notifications an update is expected to cause.
+class Countdown {
+ public:
+  void Expect(int count) {
+    MutexLock lock(&mu_);
+    remaining_ = count;
+  }
+
+  void Notify() {
+    MutexLock lock(&mu_);
+    if (--remaining_ == 0) cv_.SignalAll();
+  }
+
+  void Wait() {
+    MutexLock lock(&mu_);
+    const absl::Time deadline = absl::Now() + kTimeout;
+    while (remaining_ > 0) {
+      if (cv_.WaitWithDeadline(&mu_, deadline)) {
+        Crash(absl::StrCat("timed out with ", remaining_,
+                           " notifications remaining"));
+      }
+    }
+  }
+
+ private:
+  Mutex mu_;
+  CondVar cv_;
+  int remaining_ ABSL_GUARDED_BY(mu_) = 0;
+};
+
+// An XdsClient talking to a fake xDS server.
+class FakeXdsServer {
+ public:
+  FakeXdsServer() {
+    auto bootstrap = GrpcXdsBootstrap::Create(kBootstrap);
+    CHECK(bootstrap.ok()) << bootstrap.status();
+    auto transport_factory = MakeOrphanable<FakeXdsTransportFactory>(
+        []() { Crash("Multiple concurrent reads"); });
+    // The requests of the client are drained between iterations.
+    transport_factory->SetAbortOnUndrainedMessages(false);
+    transport_factory_ =
+        transport_factory->Ref().TakeAsSubclass<FakeXdsTransportFactory>();
+    xds_client_ = MakeRefCounted<GrpcXdsClient>(
+        "bm_xds_update", std::move(*bootstrap), ChannelArgs(),
+        std::move(transport_factory));
+  }
+
+  ~FakeXdsServer() {
+    stream_.reset();
+    xds_client_.reset();
+    transport_factory_.reset();
+  }
+
+  const RefCountedPtr<GrpcXdsClient>& xds_client() const {
+    return xds_client_;
+  }
+
+  // Waits for the client to subscribe to num_resources resources of the
+  // type.
+  void WaitForSubscription(const std::string& type_url, int num_resources) {
+    if (stream_ == nullptr) {
+      stream_ = transport_factory_->WaitForStream(
+          *xds_client_->bootstrap().servers().front(),
+          FakeXdsTransportFactory::kAdsMethod, kTimeout);
+      CHECK(stream_ != nullptr);
+    }
+    while (true) {
+      auto message = stream_->WaitForMessageFromClient(kTimeout);
+      CHECK(message.has_value());
+      DiscoveryRequest request;
+      CHECK(request.ParseFromString(*message));
+      if (request.type_url() == type_url &&
+          request.resource_names_size() == num_resources) {
+        return;
+      }
+    }
+  }
+
+  void Send(const std::string& response) {
+    stream_->SendMessageToClient(response);
+  }
+
+  // Drops the requests (ACKs) the client sent so far.
+  void DrainRequests() {
+    while (stream_->HaveMessageFromClient()) {
+      stream_->WaitForMessageFromClient(kTimeout);
+    }
+  }
+
+ private:
+  RefCountedPtr<FakeXdsTransportFactory> transport_factory_;
+  RefCountedPtr<GrpcXdsClient> xds_client_;
+  RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall> stream_;
+};
+
+struct ListenerTraits {
+  using ResourceType = XdsListenerResourceType;
+  using Proto = Listener;
+  static std::string Name(int i) { return absl::StrCat("listener_", i); }
+  static Proto Make(int i, int variant) {
+    return MakeListener(Name(i), variant);
+  }
+};
+
+struct RouteConfigTraits {
+  using ResourceType = XdsRouteConfigResourceType;
+  using Proto = RouteConfiguration;
+  static std::string Name(int i) { return absl::StrCat("route_config_", i); }
+  static Proto Make(int i, int variant) {
+    return MakeRouteConfig(Name(i), /*num_clusters=*/1, variant);
+  }
+};
+
+struct ClusterTraits {
+  using ResourceType = XdsClusterResourceType;
+  using Proto = Cluster;
+  static std::string Name(int i) { return ClusterName(i); }
+  static Proto Make(int i, int variant) {
+    return MakeCluster(Name(i), i, variant);
+  }
+};
+
+struct EndpointTraits {
+  using ResourceType = XdsEndpointResourceType;
+  using Proto = ClusterLoadAssignment;
+  static std::string Name(int i) { return EdsServiceName(i); }
+  static Proto Make(int i, int variant) {
+    return MakeEndpoints(Name(i), variant);
+  }
+};
+
+template <typename Traits>
+class CountingWatcher : public Traits::ResourceType::WatcherInterface {
+ public:
+  explicit CountingWatcher(Countdown* countdown) : countdown_(countdown) {}
+
+  void OnResourceChanged(
+      std::shared_ptr<const typename Traits::ResourceType::ResourceType>
+      /*resource*/,
+      RefCountedPtr<XdsClient::ReadDelayHandle> /*read_delay_handle*/)
+      override {
+    countdown_->Notify();
+  }
+
+  void OnError(
+      absl::Status status,
+      RefCountedPtr<XdsClient::ReadDelayHandle> /*read_delay_handle*/)
+      override {
+    Crash(absl::StrCat("unexpected error: ", status.ToString()));
+  }
+
+  void OnResourceDoesNotExist(
+      RefCountedPtr<XdsClient::ReadDelayHandle> /*read_delay_handle*/)
+      override {
+    Crash("unexpected resource does not exist");
+  }
+
+ private:
+  Countdown* const countdown_;
+};
+
+// Watches state.range(0) resources of a type, and updates them all with
+// each response.
+template <typename Traits>
+void BM_XdsClientUpdate(benchmark::State& state) {
+  const int num_resources = state.range(0);
+  std::string responses[2];
+  for (int variant = 0; variant < 2; variant++) {
+    std::vector<typename Traits::Proto> resources;
+    resources.reserve(num_resources);
+    for (int i = 0; i < num_resources; i++) {
+      resources.push_back(Traits::Make(i, variant));
+    }
+    responses[variant] = MakeResponse(resources, absl::StrCat(variant));
+  }
+  FakeXdsServer server;
+  Countdown countdown;
+  std::vector<CountingWatcher<Traits>*> watchers;
+  for (int i = 0; i < num_resources; i++) {
+    auto watcher = MakeRefCounted<CountingWatcher<Traits>>(&countdown);
+    watchers.push_back(watcher.get());
+    Traits::ResourceType::StartWatch(server.xds_client().get(),
+                                     Traits::Name(i), std::move(watcher));
+  }
+  server.WaitForSubscription(TypeUrl<typename Traits::Proto>(),
+                             num_resources);
+  countdown.Expect(num_resources);
+  server.Send(responses[0]);
+  countdown.Wait();
+  int variant = 0;
+  for (auto _ : state) {
+    variant = 1 - variant;
+    countdown.Expect(num_resources);
+    server.Send(responses[variant]);
+    countdown.Wait();
+    state.PauseTiming();
+    server.DrainRequests();
+    state.ResumeTiming();
+  }
+  for (int i = 0; i < num_resources; i++) {
+    Traits::ResourceType::CancelWatch(server.xds_client().get(),
+                                      Traits::Name(i), watchers[i],
+                                      /*delay_unsubscription=*/false);
+  }
+  state.SetItemsProcessed(state.iterations() * num_resources);
+}
+BENCHMARK_TEMPLATE(BM_XdsClientUpdate, ListenerTraits)
+    ->RangeMultiplier(10)
+    ->Range(1000, 10000)
+    ->Arg(50000)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_XdsClientUpdate, RouteConfigTraits)
+    ->RangeMultiplier(10)
+    ->Range(1000, 10000)
+    ->Arg(50000)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_XdsClientUpdate, ClusterTraits)
+    ->RangeMultiplier(10)
+    ->Range(1000, 10000)
+    ->Arg(50000)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_XdsClientUpdate, EndpointTraits)
+    ->RangeMultiplier(10)
+    ->Range(1000, 10000)
+    ->Arg(50000)
+    ->UseRealTime();
+
+class ConfigWatcher : public XdsDependencyManager::Watcher {
+ public:
+  explicit ConfigWatcher(Countdown* countdown) : countdown_(countdown) {}
+
+  void OnUpdate(
+      RefCountedPtr<const XdsDependencyManager::XdsConfig> /*config*/)
+      override {
+    countdown_->Notify();
+  }
+
+  void OnError(absl::string_view context, absl::Status status) override {
+    Crash(absl::StrCat("unexpected error for ", context, ": ",
+                       status.ToString()));
+  }
+
+  void OnResourceDoesNotExist(std::string context) override {
+    Crash(absl::StrCat("unexpected resource does not exist: ", context));
+  }
+
+ private:
+  Countdown* const countdown_;
+};
+
+// Updates the route configuration of a channel routing to state.range(0)
+// EDS clusters, for which the dependency manager assembles a new config.
+void BM_XdsDependencyManagerRouteConfigUpdate(benchmark::State& state) {
+  const int num_clusters = state.range(0);
+  std::vector<Cluster> clusters;
+  std::vector<ClusterLoadAssignment> endpoints;
+  for (int i = 0; i < num_clusters; i++) {
+    clusters.push_back(MakeCluster(ClusterName(i), i, /*variant=*/0));
+    endpoints.push_back(MakeEndpoints(EdsServiceName(i), /*variant=*/0));
+  }
+  const std::string route_config_responses[2] = {
+      MakeResponse(std::vector<RouteConfiguration>{MakeRouteConfig(
+                       RouteConfigName(), num_clusters, /*variant=*/0)},
+                   "0"),
+      MakeResponse(std::vector<RouteConfiguration>{MakeRouteConfig(
+                       RouteConfigName(), num_clusters, /*variant=*/1)},
+                   "1"),
+  };
+  FakeXdsServer server;
+  Countdown countdown;
+  countdown.Expect(1);
+  auto dependency_manager = MakeOrphanable<XdsDependencyManager>(
+      server.xds_client(),
+      std::make_shared<WorkSerializer>(
+          grpc_event_engine::experimental::GetDefaultEventEngine()),
+      std::make_unique<ConfigWatcher>(&countdown), ListenerName(),
+      ListenerName(), ChannelArgs(), /*interested_parties=*/nullptr);
+  server.WaitForSubscription(TypeUrl<Listener>(), 1);
+  server.Send(MakeResponse(
+      std::vector<Listener>{MakeListener(ListenerName(), /*variant=*/0)}, "0"));
+  server.WaitForSubscription(TypeUrl<RouteConfiguration>(), 1);
+  server.Send(route_config_responses[0]);
+  server.WaitForSubscription(TypeUrl<Cluster>(), num_clusters);
+  server.Send(MakeResponse(clusters, "0"));
+  server.WaitForSubscription(TypeUrl<ClusterLoadAssignment>(), num_clusters);
+  server.Send(MakeResponse(endpoints, "0"));
+  countdown.Wait();
+  int variant = 0;
+  for (auto _ : state) {
+    variant = 1 - variant;
+    countdown.Expect(1);
+    server.Send(route_config_responses[variant]);
+    countdown.Wait();
+    state.PauseTiming();
+    server.DrainRequests();
+    state.ResumeTiming();
+  }
+  dependency_manager.reset();
+  state.SetItemsProcessed(state.iterations() * num_clusters);
+}
+BENCHMARK(BM_XdsDependencyManagerRouteConfigUpdate)
+    ->RangeMultiplier(10)
+    ->Range(1000, 10000)
+    ->Arg(50000)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::benchmark::Initialize(&argc, argv);
+  grpc_init();
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -121,11 +121,12 @@ class BidiClient : public grpc::ClientBidiReactor<EchoRequest, EchoResponse> {
   bool done = false;
 };
 
-template <class Fixture, class ClientContextMutator, class ServerContextMutator>
-static void BM_CallbackBidiStreaming(benchmark::State& state) {
+template <class Fixture>
+static void RunCallbackBidiStreaming(benchmark::State& state,
+                                     bool inline_reactions) {
   int message_size = state.range(0);
   int max_ping_pongs = state.range(1);
-  CallbackStreamingTestService service;
+  CallbackStreamingTestService service(inline_reactions);
   std::unique_ptr<Fixture> fixture(new Fixture(&service));
   std::unique_ptr<EchoTestService::Stub> stub_(
       EchoTestService::NewStub(fixture->channel()));
@@ -146,6 +147,17 @@ static void BM_CallbackBidiStreaming(benchmark::State& state) {
                           state.iterations());
 }
 
+template <class Fixture, class ClientContextMutator, class ServerContextMutator>
+static void BM_CallbackBidiStreaming(benchmark::State& state) {
+  RunCallbackBidiStreaming<Fixture>(state, /*inline_reactions=*/false);
+}
+
+// The server reactions run inline, without a thread hop per operation.
+template <class Fixture, class ClientContextMutator, class ServerContextMutator>
+static void BM_CallbackBidiStreamingInlineReactions(benchmark::State& state) {
+  RunCallbackBidiStreaming<Fixture>(state, /*inline_reactions=*/true);
+}
+
 }  // namespace testing
 }  // namespace grpc
 #endif  // GRPC_TEST_CPP_MICROBENCHMARKS_CALLBACK_STREAMING_PING_PONG_H
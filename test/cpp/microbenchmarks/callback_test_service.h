@@ -37,6 +37,10 @@ const char* const kServerMessageSize = "server_message_size";
 class CallbackStreamingTestService : public EchoTestService::CallbackService {
  public:
   CallbackStreamingTestService() {}
+  // The reactions of the service never block, so they may run inline.
+  explicit CallbackStreamingTestService(bool inline_reactions) {
+    if (inline_reactions) MarkAllMethodsInlineReactions();
+  }
 
   ServerUnaryReactor* Echo(CallbackServerContext* context,
                            const EchoRequest* request,
@@ -21,12 +21,16 @@
 #ifndef GRPC_TEST_CPP_MICROBENCHMARKS_CALLBACK_UNARY_PING_PONG_H
 #define GRPC_TEST_CPP_MICROBENCHMARKS_CALLBACK_UNARY_PING_PONG_H
 
+#include <memory>
 #include <sstream>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
 #include "absl/log/check.h"
 
+#include <grpcpp/support/client_interceptor.h>
+
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
 #include "test/cpp/microbenchmarks/callback_test_service.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
@@ -62,12 +66,11 @@ inline void SendCallbackUnaryPingPong(
       });
 };
 
-template <class Fixture, class ClientContextMutator, class ServerContextMutator>
-static void BM_CallbackUnaryPingPong(benchmark::State& state) {
+template <class Fixture>
+void RunCallbackUnaryPingPong(benchmark::State& state,
+                              std::unique_ptr<Fixture> fixture) {
   int request_msgs_size = state.range(0);
   int response_msgs_size = state.range(1);
-  CallbackStreamingTestService service;
-  std::unique_ptr<Fixture> fixture(new Fixture(&service));
   std::unique_ptr<EchoTestService::Stub> stub_(
       EchoTestService::NewStub(fixture->channel()));
   EchoRequest request;
@@ -96,6 +99,69 @@ static void BM_CallbackUnaryPingPong(benchmark::State& state) {
                           response_msgs_size * state.iterations());
 }
 
+template <class Fixture, class ClientContextMutator, class ServerContextMutator>
+static void BM_CallbackUnaryPingPong(benchmark::State& state) {
+  CallbackStreamingTestService service;
+  RunCallbackUnaryPingPong(state, std::make_unique<Fixture>(&service));
+}
+
+// Proceeds with every batch it is run for, like an interceptor that does
+// not need anything from the RPC.
+class ProceedingInterceptor : public experimental::Interceptor {
+ public:
+  void Intercept(experimental::InterceptorBatchMethods* methods) override {
+    methods->Proceed();
+  }
+};
+
+// Creates a ProceedingInterceptor per RPC, run for all of its batches.
+class PerCallInterceptorFactory
+    : public experimental::ClientInterceptorFactoryInterface {
+ public:
+  experimental::Interceptor* CreateClientInterceptor(
+      experimental::ClientRpcInfo* /*info*/) override {
+    return new ProceedingInterceptor();
+  }
+};
+
+// Shares a ProceedingInterceptor between the RPCs, only run for the batches
+// with their status.
+using StatelessInterceptorFactory =
+    experimental::StatelessClientInterceptorFactory<
+        ProceedingInterceptor,
+        experimental::InterceptionHookPoints::POST_RECV_STATUS>;
+
+// Gives the client channel \a num_interceptors InterceptorFactory
+// interceptors.
+template <class InterceptorFactory>
+class ClientInterceptorsConfiguration : public FixtureConfiguration {
+ public:
+  explicit ClientInterceptorsConfiguration(int num_interceptors)
+      : num_interceptors_(num_interceptors) {}
+
+  std::vector<std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+  CreateClientInterceptorFactories() const override {
+    std::vector<
+        std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+        factories;
+    for (int i = 0; i < num_interceptors_; i++) {
+      factories.push_back(std::make_unique<InterceptorFactory>());
+    }
+    return factories;
+  }
+
+ private:
+  const int num_interceptors_;
+};
+
+// The third argument is the number of client interceptors.
+template <class Fixture, class InterceptorFactory>
+static void BM_CallbackUnaryPingPongWithInterceptors(benchmark::State& state) {
+  CallbackStreamingTestService service;
+  ClientInterceptorsConfiguration<InterceptorFactory> config(state.range(2));
+  RunCallbackUnaryPingPong(state, std::make_unique<Fixture>(&service, config));
+}
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -19,6 +19,9 @@
 #ifndef GRPC_TEST_CPP_MICROBENCHMARKS_FULLSTACK_FIXTURES_H
 #define GRPC_TEST_CPP_MICROBENCHMARKS_FULLSTACK_FIXTURES_H
 
+#include <memory>
+#include <vector>
+
 #include "absl/log/check.h"
 
 #include <grpc/grpc.h>
@@ -30,6 +33,7 @@
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
+#include <grpcpp/support/client_interceptor.h>
 
 #include "src/core/ext/transport/chttp2/transport/chttp2_transport.h"
 #include "src/core/lib/channel/channel_args.h"
@@ -65,6 +69,13 @@ class FixtureConfiguration {
     b->SetMaxReceiveMessageSize(INT_MAX);
     b->SetMaxSendMessageSize(INT_MAX);
   }
+
+  // The interceptors of the client channel of the full stack fixtures.
+  virtual std::vector<
+      std::unique_ptr<experimental::ClientInterceptorFactoryInterface>>
+  CreateClientInterceptorFactories() const {
+    return {};
+  }
 };
 
 class BaseFixture {
@@ -86,11 +97,14 @@ class FullstackFixture : public BaseFixture {
     server_ = b.BuildAndStart();
     ChannelArguments args;
     config.ApplyCommonChannelArguments(&args);
+    auto interceptor_factories = config.CreateClientInterceptorFactories();
     if (!address.empty()) {
-      channel_ = grpc::CreateCustomChannel(address,
-                                           InsecureChannelCredentials(), args);
+      channel_ = experimental::CreateCustomChannelWithInterceptors(
+          address, InsecureChannelCredentials(), args,
+          std::move(interceptor_factories));
     } else {
-      channel_ = server_->InProcessChannel(args);
+      channel_ = server_->experimental().InProcessChannelWithInterceptors(
+          args, std::move(interceptor_factories));
     }
   }
 
@@ -288,6 +302,44 @@ typedef MinStackize<UDS> MinUDS;
 typedef MinStackize<InProcess> MinInProcess;
 typedef MinStackize<SockPair> MinSockPair;
 
+////////////////////////////////////////////////////////////////////////////////
+// Send queue aware write sizing fixtures
+
+class SendQueueAwareWriteSizeConfiguration : public FixtureConfiguration {
+  void ApplyCommonChannelArguments(ChannelArguments* a) const override {
+    a->SetInt("grpc.http2.send_queue_aware_write_size", 1);
+    FixtureConfiguration::ApplyCommonChannelArguments(a);
+  }
+
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument("grpc.http2.send_queue_aware_write_size", 1);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+class SendQueueAwareTCP : public TCP {
+ public:
+  explicit SendQueueAwareTCP(Service* service)
+      : TCP(service, SendQueueAwareWriteSizeConfiguration()) {}
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Busy polling fixtures: SO_BUSY_POLL on the server's accepted sockets. Run
+// with GRPC_EVENT_ENGINE_POLLER_SPIN_US set to also spin in the poller.
+
+class BusyPollConfiguration : public FixtureConfiguration {
+  void ApplyCommonServerBuilderConfig(ServerBuilder* b) const override {
+    b->AddChannelArgument(GRPC_ARG_TCP_BUSY_POLL_US, 50);
+    FixtureConfiguration::ApplyCommonServerBuilderConfig(b);
+  }
+};
+
+class BusyPollTCP : public TCP {
+ public:
+  explicit BusyPollTCP(Service* service)
+      : TCP(service, BusyPollConfiguration()) {}
+};
+
 }  // namespace testing
 }  // namespace grpc
 
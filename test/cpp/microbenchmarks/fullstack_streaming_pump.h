@@ -27,6 +27,8 @@
 
 #include "absl/log/check.h"
 
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "src/proto/grpc/testing/echo.grpc.pb.h"
 #include "test/cpp/microbenchmarks/fullstack_context_mutators.h"
 #include "test/cpp/microbenchmarks/fullstack_fixtures.h"
@@ -40,10 +42,21 @@ namespace testing {
 
 static void* tag(intptr_t x) { return reinterpret_cast<void*>(x); }
 
+// Reports how many slices of each received message the transport copied
+// instead of referencing the bytes it read: zero for zero-copy reassembly.
+static void RecordCopiedSlicesPerMessage(benchmark::State& state,
+                                         const grpc_core::GlobalStats& before) {
+  auto stats = grpc_core::global_stats().Collect()->Diff(before);
+  state.counters["copied_slices_per_msg"] = benchmark::Counter(
+      static_cast<double>(stats->http2_recv_data_copied_slices),
+      benchmark::Counter::kAvgIterations);
+}
+
 template <class Fixture>
 static void BM_PumpStreamClientToServer(benchmark::State& state) {
   EchoTestService::AsyncService service;
   std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<grpc_core::GlobalStats> stats_before;
   {
     EchoRequest send_request;
     EchoRequest recv_request;
@@ -70,6 +83,7 @@ static void BM_PumpStreamClientToServer(benchmark::State& state) {
       need_tags &= ~(1 << i);
     }
     response_rw.Read(&recv_request, tag(0));
+    stats_before = grpc_core::global_stats().Collect();
     for (auto _ : state) {
       request_rw->Write(send_request, tag(1));
       while (true) {
@@ -104,6 +118,7 @@ static void BM_PumpStreamClientToServer(benchmark::State& state) {
     CHECK(final_status.ok());
   }
   fixture.reset();
+  RecordCopiedSlicesPerMessage(state, *stats_before);
   state.SetBytesProcessed(state.range(0) * state.iterations());
 }
 
@@ -111,6 +126,7 @@ template <class Fixture>
 static void BM_PumpStreamServerToClient(benchmark::State& state) {
   EchoTestService::AsyncService service;
   std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<grpc_core::GlobalStats> stats_before;
   {
     EchoResponse send_response;
     EchoResponse recv_response;
@@ -137,6 +153,7 @@ static void BM_PumpStreamServerToClient(benchmark::State& state) {
       need_tags &= ~(1 << i);
     }
     request_rw->Read(&recv_response, tag(0));
+    stats_before = grpc_core::global_stats().Collect();
     for (auto _ : state) {
       response_rw.Write(send_response, tag(1));
       while (true) {
@@ -160,6 +177,7 @@ static void BM_PumpStreamServerToClient(benchmark::State& state) {
     }
   }
   fixture.reset();
+  RecordCopiedSlicesPerMessage(state, *stats_before);
   state.SetBytesProcessed(state.range(0) * state.iterations());
 }
 }  // namespace testing
@@ -21,7 +21,10 @@
 #ifndef GRPC_TEST_CPP_MICROBENCHMARKS_FULLSTACK_UNARY_PING_PONG_H
 #define GRPC_TEST_CPP_MICROBENCHMARKS_FULLSTACK_UNARY_PING_PONG_H
 
+#include <algorithm>
+#include <chrono>
 #include <sstream>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -111,6 +114,86 @@ static void BM_UnaryPingPong(benchmark::State& state) {
   state.SetBytesProcessed(state.range(0) * state.iterations() +
                           state.range(1) * state.iterations());
 }
+
+// Same ping pong as BM_UnaryPingPong, but also reports the median and tail of
+// the per-call latencies as p50_us/p99_us counters, since averages hide the
+// wakeup latency that polling modes trade against.
+template <class Fixture>
+static void BM_UnaryPingPongLatency(benchmark::State& state) {
+  EchoTestService::AsyncService service;
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  EchoRequest send_request;
+  EchoResponse send_response;
+  EchoResponse recv_response;
+  if (state.range(0) > 0) {
+    send_request.set_message(std::string(state.range(0), 'a'));
+  }
+  if (state.range(1) > 0) {
+    send_response.set_message(std::string(state.range(1), 'a'));
+  }
+  Status recv_status;
+  struct ServerEnv {
+    ServerContext ctx;
+    EchoRequest recv_request;
+    grpc::ServerAsyncResponseWriter<EchoResponse> response_writer;
+    ServerEnv() : response_writer(&ctx) {}
+  };
+  ServerEnv server_env[2];
+  for (intptr_t slot = 0; slot < 2; ++slot) {
+    service.RequestEcho(&server_env[slot].ctx, &server_env[slot].recv_request,
+                        &server_env[slot].response_writer, fixture->cq(),
+                        fixture->cq(), tag(slot));
+  }
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  std::vector<double> latencies_us;
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    recv_response.Clear();
+    ClientContext cli_ctx;
+    std::unique_ptr<ClientAsyncResponseReader<EchoResponse>> response_reader(
+        stub->AsyncEcho(&cli_ctx, send_request, fixture->cq()));
+    response_reader->Finish(&recv_response, &recv_status, tag(4));
+    void* t;
+    bool ok;
+    CHECK(fixture->cq()->Next(&t, &ok));
+    CHECK(ok);
+    CHECK(t == tag(0) || t == tag(1));
+    intptr_t slot = reinterpret_cast<intptr_t>(t);
+    ServerEnv* senv = &server_env[slot];
+    senv->response_writer.Finish(send_response, Status::OK, tag(3));
+    for (int i = (1 << 3) | (1 << 4); i != 0;) {
+      CHECK(fixture->cq()->Next(&t, &ok));
+      CHECK(ok);
+      int tagnum = static_cast<int>(reinterpret_cast<intptr_t>(t));
+      CHECK(i & (1 << tagnum));
+      i -= 1 << tagnum;
+    }
+    CHECK(recv_status.ok());
+    latencies_us.push_back(std::chrono::duration<double, std::micro>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
+
+    senv->~ServerEnv();
+    senv = new (senv) ServerEnv();
+    service.RequestEcho(&senv->ctx, &senv->recv_request, &senv->response_writer,
+                        fixture->cq(), fixture->cq(), tag(slot));
+  }
+  if (!latencies_us.empty()) {
+    auto percentile = [&latencies_us](double p) {
+      auto it = latencies_us.begin() +
+                static_cast<size_t>(p * (latencies_us.size() - 1));
+      std::nth_element(latencies_us.begin(), it, latencies_us.end());
+      return *it;
+    };
+    state.counters["p50_us"] = percentile(0.5);
+    state.counters["p99_us"] = percentile(0.99);
+  }
+  stub.reset();
+  fixture.reset();
+  state.SetBytesProcessed(state.range(0) * state.iterations() +
+                          state.range(1) * state.iterations());
+}
 }  // namespace testing
 }  // namespace grpc
 
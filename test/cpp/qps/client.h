@@ -23,8 +23,11 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
@@ -222,6 +225,14 @@ class Client {
     stats.set_time_system(timer_result.system);
     stats.set_time_user(timer_result.user);
     stats.set_cq_poll_count(poll_count);
+    stats.set_missed_schedules(
+        reset ? missed_schedules_.exchange(0, std::memory_order_relaxed)
+              : missed_schedules_.load(std::memory_order_relaxed));
+    stats.set_rss_bytes(timer_result.rss_bytes);
+    stats.set_connections(connections_);
+    stats.set_connections_churned(
+        reset ? connections_churned_.exchange(0, std::memory_order_relaxed)
+              : connections_churned_.load(std::memory_order_relaxed));
     return stats;
   }
 
@@ -255,9 +266,23 @@ class Client {
         gpr_time_add(next_time_[thread_idx],
                      gpr_time_from_nanos(interarrival_timer_.next(thread_idx),
                                          GPR_TIMESPAN));
+    // The request was due before the client was ready to issue it.
+    if (gpr_time_cmp(result, gpr_now(GPR_CLOCK_MONOTONIC)) < 0) {
+      missed_schedules_.fetch_add(1, std::memory_order_relaxed);
+    }
     return result;
   }
 
+  // Returns when a request of an open-loop load was due, on the clock of
+  // UsageTimer::Now(). Its latency is measured from then rather than from
+  // when it was issued, so that requests held back by slow ones are not left
+  // out of the tail latency.
+  static double ScheduledStart(gpr_timespec issue_time) {
+    const gpr_timespec t =
+        gpr_convert_clock_type(issue_time, GPR_CLOCK_REALTIME);
+    return t.tv_sec + 1e-9 * t.tv_nsec;
+  }
+
   bool ThreadCompleted() {
     return static_cast<bool>(gpr_atm_acq_load(&thread_pool_done_));
   }
@@ -405,6 +430,10 @@ class Client {
 
   InterarrivalTimer interarrival_timer_;
   std::vector<gpr_timespec> next_time_;
+  std::atomic<int64_t> missed_schedules_{0};
+  // Connections held open for the load, and connections churned on top.
+  uint64_t connections_ = 0;
+  std::atomic<uint64_t> connections_churned_{0};
 
   std::mutex thread_completion_mu_;
   size_t threads_remaining_;
@@ -444,12 +473,27 @@ class ClientImpl : public Client {
           create_stub_, i);
     }
     WaitForChannelsToConnect();
+    for (auto& c : channels_) {
+      if (!c.is_inproc()) connections_++;
+    }
     median_latency_collection_interval_seconds_ =
         config.median_latency_collection_interval_millis() / 1e3;
     ClientRequestCreator<RequestType> create_req(&request_,
                                                  config.payload_config());
+    if (config.connection_churn_per_second() > 0) {
+      churn_thread_ = std::thread(&ClientImpl::ChurnConnections, this, config);
+    }
+  }
+  ~ClientImpl() override {
+    if (churn_thread_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(churn_mu_);
+        churn_done_ = true;
+      }
+      churn_cv_.notify_all();
+      churn_thread_.join();
+    }
   }
-  ~ClientImpl() override {}
   const RequestType* request() { return &request_; }
 
   void WaitForChannelsToConnect() {
@@ -568,6 +612,48 @@ class ClientImpl : public Client {
   std::vector<ClientChannelInfo> channels_;
   std::function<std::unique_ptr<StubType>(const std::shared_ptr<Channel>&)>
       create_stub_;
+
+ private:
+  // Establishes a connection through a channel of its own, waits for it to
+  // be ready, then closes it, connection_churn_per_second times a second.
+  // Connections are established one at a time, so a rate the handshakes
+  // cannot keep up with churns connections as fast as they complete.
+  void ChurnConnections(const ClientConfig& config) {
+    const auto interval =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(
+                1 / config.connection_churn_per_second()));
+    auto next_connection = std::chrono::steady_clock::now();
+    // Shards distinct from the ones of channels_, so that no subchannel is
+    // shared with them or between churned connections.
+    for (int shard = config.client_channels();; shard++) {
+      {
+        std::unique_lock<std::mutex> lock(churn_mu_);
+        if (churn_cv_.wait_until(lock, next_connection,
+                                 [this] { return churn_done_; })) {
+          return;
+        }
+      }
+      next_connection += interval;
+      const std::string& target =
+          config.server_targets(shard % config.server_targets_size());
+      if (absl::StartsWith(target, INPROC_NAME_PREFIX)) continue;
+      ClientChannelInfo churned(target, config, create_stub_, shard);
+      if (churned.get_channel()->WaitForConnected(
+              gpr_time_add(gpr_now(GPR_CLOCK_REALTIME),
+                           gpr_time_from_seconds(10, GPR_TIMESPAN)))) {
+        connections_churned_.fetch_add(1, std::memory_order_relaxed);
+      } else {
+        LOG(ERROR) << "Churned connection to " << target
+                   << " failed to connect";
+      }
+    }
+  }
+
+  std::thread churn_thread_;
+  std::mutex churn_mu_;
+  std::condition_variable churn_cv_;
+  bool churn_done_ = false;
 };
 
 std::unique_ptr<Client> CreateSynchronousClient(const ClientConfig& config);
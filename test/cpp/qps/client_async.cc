@@ -93,7 +93,8 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
   bool RunNextState(bool /*ok*/, HistogramEntry* entry) override {
     switch (next_state_) {
       case State::READY:
-        start_ = UsageTimer::Now();
+        start_ = next_issue_ ? Client::ScheduledStart(issue_time_)
+                             : UsageTimer::Now();
         response_reader_ = prepare_req_(stub_, &context_, req_, cq_);
         response_reader_->StartCall();
         next_state_ = State::RESP_DONE;
@@ -136,6 +137,8 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
       prepare_req_;
   grpc::Status status_;
   double start_;
+  // When the request was due, for open-loop loads.
+  gpr_timespec issue_time_;
   std::unique_ptr<grpc::ClientAsyncResponseReader<ResponseType>>
       response_reader_;
 
@@ -145,7 +148,8 @@ class ClientRpcContextUnaryImpl : public ClientRpcContext {
       RunNextState(true, nullptr);
     } else {  // wait for the issue time
       alarm_ = std::make_unique<Alarm>();
-      alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+      issue_time_ = next_issue_();
+      alarm_->Set(cq_, issue_time_, ClientRpcContext::tag(this));
     }
   }
 };
@@ -374,13 +378,15 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
         case State::WAIT:
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          issue_time_ = next_issue_();
+          alarm_->Set(cq_, issue_time_, ClientRpcContext::tag(this));
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = next_issue_ ? Client::ScheduledStart(issue_time_)
+                               : UsageTimer::Now();
           next_state_ = State::WRITE_DONE;
           if (coalesce_ && messages_issued_ == messages_per_stream_ - 1) {
             stream_->WriteLast(req_, WriteOptions(),
@@ -460,6 +466,8 @@ class ClientRpcContextStreamingPingPongImpl : public ClientRpcContext {
       prepare_req_;
   grpc::Status status_;
   double start_;
+  // When the request was due, for open-loop loads.
+  gpr_timespec issue_time_;
   std::unique_ptr<grpc::ClientAsyncReaderWriter<RequestType, ResponseType>>
       stream_;
 
@@ -559,14 +567,16 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
           break;  // loop around, don't return
         case State::WAIT:
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          issue_time_ = next_issue_();
+          alarm_->Set(cq_, issue_time_, ClientRpcContext::tag(this));
           next_state_ = State::READY_TO_WRITE;
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = next_issue_ ? Client::ScheduledStart(issue_time_)
+                               : UsageTimer::Now();
           next_state_ = State::WRITE_DONE;
           stream_->Write(req_, ClientRpcContext::tag(this));
           return true;
@@ -613,6 +623,8 @@ class ClientRpcContextStreamingFromClientImpl : public ClientRpcContext {
       prepare_req_;
   grpc::Status status_;
   double start_;
+  // When the request was due, for open-loop loads.
+  gpr_timespec issue_time_;
   std::unique_ptr<grpc::ClientAsyncWriter<RequestType>> stream_;
 
   void StartInternal(CompletionQueue* cq) {
@@ -807,13 +819,15 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
         case State::WAIT:
           next_state_ = State::READY_TO_WRITE;
           alarm_ = std::make_unique<Alarm>();
-          alarm_->Set(cq_, next_issue_(), ClientRpcContext::tag(this));
+          issue_time_ = next_issue_();
+          alarm_->Set(cq_, issue_time_, ClientRpcContext::tag(this));
           return true;
         case State::READY_TO_WRITE:
           if (!ok) {
             return false;
           }
-          start_ = UsageTimer::Now();
+          start_ = next_issue_ ? Client::ScheduledStart(issue_time_)
+                               : UsageTimer::Now();
           next_state_ = State::WRITE_DONE;
           stream_->Write(req_, ClientRpcContext::tag(this));
           return true;
@@ -881,6 +895,8 @@ class ClientRpcContextGenericStreamingImpl : public ClientRpcContext {
       prepare_req_;
   grpc::Status status_;
   double start_;
+  // When the request was due, for open-loop loads.
+  gpr_timespec issue_time_;
   std::unique_ptr<grpc::GenericClientAsyncReaderWriter> stream_;
 
   // Allow a limit on number of messages in a stream
@@ -105,6 +105,15 @@ static double WallTime(const ClientStats& s) { return s.time_elapsed(); }
 static double SystemTime(const ClientStats& s) { return s.time_system(); }
 static double UserTime(const ClientStats& s) { return s.time_user(); }
 static double CliPollCount(const ClientStats& s) { return s.cq_poll_count(); }
+static double MissedSchedules(const ClientStats& s) {
+  return s.missed_schedules();
+}
+static double CliRss(const ClientStats& s) { return s.rss_bytes(); }
+static double SvrRss(const ServerStats& s) { return s.rss_bytes(); }
+static double Connections(const ClientStats& s) { return s.connections(); }
+static double ConnectionsChurned(const ClientStats& s) {
+  return s.connections_churned();
+}
 static double SvrPollCount(const ServerStats& s) { return s.cq_poll_count(); }
 static double ServerSystemTime(const ServerStats& s) { return s.time_system(); }
 static double ServerUserTime(const ServerStats& s) { return s.time_user(); }
@@ -203,14 +212,42 @@ static void postprocess_scenario_result(ScenarioResult* result) {
     result->mutable_summary()->set_failed_requests_per_second(failures /
                                                               time_estimate);
   }
+  result->mutable_summary()->set_missed_schedules_per_second(
+      sum(result->client_stats(), MissedSchedules) / time_estimate);
+
+  auto connections = sum(result->client_stats(), Connections);
+  if (connections > 0) {
+    result->mutable_summary()->set_client_rss_bytes_per_connection(
+        sum(result->client_stats(), CliRss) / connections);
+    result->mutable_summary()->set_server_rss_bytes_per_connection(
+        sum(result->server_stats(), SvrRss) / connections);
+  }
+  auto connections_churned = sum(result->client_stats(), ConnectionsChurned);
+  if (connections_churned > 0) {
+    result->mutable_summary()->set_connections_churned_per_second(
+        connections_churned / time_estimate);
+    result->mutable_summary()->set_client_cpu_us_per_churned_connection(
+        1e6 *
+        (sum(result->client_stats(), SystemTime) +
+         sum(result->client_stats(), UserTime)) /
+        connections_churned);
+    result->mutable_summary()->set_server_cpu_us_per_churned_connection(
+        1e6 *
+        (sum(result->server_stats(), ServerSystemTime) +
+         sum(result->server_stats(), ServerUserTime)) /
+        connections_churned);
+  }
 
   // Fill in data for other metrics required in result summary
   auto qps_per_server_core = qps / sum(result->server_cores(), Cores);
   result->mutable_summary()->set_qps_per_server_core(qps_per_server_core);
-  result->mutable_summary()->set_client_polls_per_request(
-      sum(result->client_stats(), CliPollCount) / histogram.Count());
-  result->mutable_summary()->set_server_polls_per_request(
-      sum(result->server_stats(), SvrPollCount) / histogram.Count());
+  // Scenarios that only hold connections open issue no request.
+  if (histogram.Count() > 0) {
+    result->mutable_summary()->set_client_polls_per_request(
+        sum(result->client_stats(), CliPollCount) / histogram.Count());
+    result->mutable_summary()->set_server_polls_per_request(
+        sum(result->server_stats(), SvrPollCount) / histogram.Count());
+  }
 
   auto server_queries_per_cpu_sec =
       histogram.Count() / (sum(result->server_stats(), ServerSystemTime) +
@@ -0,0 +1,146 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "test/cpp/qps/experiment_comparison.h"
+
+#include <cmath>
+#include <cstddef>
+
+#include "absl/log/check.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
+
+namespace grpc {
+namespace testing {
+
+namespace {
+
+// 0.975 quantiles of Student's t distribution, by degrees of freedom.
+constexpr double kTQuantiles[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+double TQuantile(double degrees_of_freedom) {
+  constexpr size_t kNumQuantiles = sizeof(kTQuantiles) / sizeof(double);
+  // Rounding down is conservative.
+  const size_t df = static_cast<size_t>(degrees_of_freedom);
+  if (df < 1) return kTQuantiles[0];
+  if (df > kNumQuantiles) return 1.960;
+  return kTQuantiles[df - 1];
+}
+
+void MeanAndVariance(const std::vector<double>& values, double* mean,
+                     double* variance) {
+  double sum = 0;
+  for (double value : values) sum += value;
+  *mean = sum / values.size();
+  double squares = 0;
+  for (double value : values) squares += (value - *mean) * (value - *mean);
+  *variance = squares / (values.size() - 1);
+}
+
+struct Metric {
+  const char* name;
+  double (ScenarioResultSummary::*value)() const;
+};
+
+constexpr Metric kMetrics[] = {
+    {"qps", &ScenarioResultSummary::qps},
+    {"qps_per_server_core", &ScenarioResultSummary::qps_per_server_core},
+    {"latency_50", &ScenarioResultSummary::latency_50},
+    {"latency_99", &ScenarioResultSummary::latency_99},
+    {"server_cpu_usage", &ScenarioResultSummary::server_cpu_usage},
+    {"server_queries_per_cpu_sec",
+     &ScenarioResultSummary::server_queries_per_cpu_sec},
+    {"client_queries_per_cpu_sec",
+     &ScenarioResultSummary::client_queries_per_cpu_sec},
+};
+
+std::vector<double> Values(const std::vector<ScenarioResult>& results,
+                           const Metric& metric) {
+  std::vector<double> values;
+  values.reserve(results.size());
+  for (const auto& result : results) {
+    values.push_back((result.summary().*metric.value)());
+  }
+  return values;
+}
+
+std::string ArmName(const ExperimentComparison::Arm& arm,
+                    const char* default_name) {
+  return arm.name().empty() ? default_name : arm.name();
+}
+
+}  // namespace
+
+MeanDifference CompareMeans(const std::vector<double>& baseline,
+                            const std::vector<double>& candidate) {
+  CHECK_GE(baseline.size(), 2u);
+  CHECK_GE(candidate.size(), 2u);
+  MeanDifference difference;
+  double baseline_variance;
+  double candidate_variance;
+  MeanAndVariance(baseline, &difference.baseline_mean, &baseline_variance);
+  MeanAndVariance(candidate, &difference.candidate_mean, &candidate_variance);
+  const double baseline_term = baseline_variance / baseline.size();
+  const double candidate_term = candidate_variance / candidate.size();
+  const double standard_error = std::sqrt(baseline_term + candidate_term);
+  const double mean_difference =
+      difference.candidate_mean - difference.baseline_mean;
+  if (standard_error == 0) {
+    difference.low = difference.high = mean_difference;
+    return difference;
+  }
+  // Welch-Satterthwaite degrees of freedom.
+  const double degrees_of_freedom =
+      std::pow(baseline_term + candidate_term, 2) /
+      (baseline_term * baseline_term / (baseline.size() - 1) +
+       candidate_term * candidate_term / (candidate.size() - 1));
+  const double margin = TQuantile(degrees_of_freedom) * standard_error;
+  difference.low = mean_difference - margin;
+  difference.high = mean_difference + margin;
+  return difference;
+}
+
+std::string ExperimentComparisonReport(
+    const ExperimentComparison& comparison,
+    const std::vector<ScenarioResult>& baseline,
+    const std::vector<ScenarioResult>& candidate) {
+  std::string report = absl::StrCat(
+      "Experiment comparison: ", ArmName(comparison.baseline(), "baseline"),
+      " -> ", ArmName(comparison.candidate(), "candidate"), " (",
+      baseline.size(), " vs ", candidate.size(), " runs)\n");
+  for (const Metric& metric : kMetrics) {
+    const MeanDifference difference =
+        CompareMeans(Values(baseline, metric), Values(candidate, metric));
+    const double scale = difference.baseline_mean != 0
+                             ? 100 / std::abs(difference.baseline_mean)
+                             : 0;
+    absl::StrAppendFormat(
+        &report, "  %s: %.2f -> %.2f (%+.2f%%, 95%% CI [%+.2f%%, %+.2f%%])%s\n",
+        metric.name, difference.baseline_mean, difference.candidate_mean,
+        (difference.candidate_mean - difference.baseline_mean) * scale,
+        difference.low * scale, difference.high * scale,
+        difference.low > 0 || difference.high < 0 ? " *" : "");
+  }
+  return report;
+}
+
+}  // namespace testing
+}  // namespace grpc
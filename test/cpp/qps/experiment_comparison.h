@@ -0,0 +1,54 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_TEST_CPP_QPS_EXPERIMENT_COMPARISON_H
+#define GRPC_TEST_CPP_QPS_EXPERIMENT_COMPARISON_H
+
+#include <string>
+#include <vector>
+
+#include "src/proto/grpc/testing/control.pb.h"
+
+namespace grpc {
+namespace testing {
+
+/// Difference between the means of a baseline and a candidate sample.
+struct MeanDifference {
+  double baseline_mean;
+  double candidate_mean;
+  /// Bounds of the 95% confidence interval of candidate_mean - baseline_mean
+  /// (Welch's t-interval, which does not assume equal variances).
+  double low;
+  double high;
+};
+
+/// Both samples need at least two values.
+MeanDifference CompareMeans(const std::vector<double>& baseline,
+                            const std::vector<double>& candidate);
+
+/// Returns a report of the differences between the summaries of the runs of
+/// each arm of \a comparison, one line per metric.
+std::string ExperimentComparisonReport(
+    const ExperimentComparison& comparison,
+    const std::vector<ScenarioResult>& baseline,
+    const std::vector<ScenarioResult>& candidate);
+
+}  // namespace testing
+}  // namespace grpc
+
+#endif  // GRPC_TEST_CPP_QPS_EXPERIMENT_COMPARISON_H
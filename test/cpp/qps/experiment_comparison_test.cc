@@ -0,0 +1,91 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "test/cpp/qps/experiment_comparison.h"
+
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+using ::testing::DoubleNear;
+using ::testing::HasSubstr;
+using ::testing::Not;
+
+TEST(CompareMeansTest, SameSamples) {
+  MeanDifference difference =
+      CompareMeans({10, 11, 12, 13}, {10, 11, 12, 13});
+  EXPECT_EQ(difference.baseline_mean, 11.5);
+  EXPECT_EQ(difference.candidate_mean, 11.5);
+  EXPECT_LT(difference.low, 0);
+  EXPECT_GT(difference.high, 0);
+}
+
+TEST(CompareMeansTest, ShiftedSamples) {
+  MeanDifference difference =
+      CompareMeans({10, 11, 12, 13}, {20, 21, 22, 23});
+  EXPECT_EQ(difference.candidate_mean - difference.baseline_mean, 10);
+  // Standard error sqrt(5/3/4 * 2), 6 degrees of freedom.
+  EXPECT_THAT(difference.low, DoubleNear(10 - 2.447 * 0.9129, 1e-3));
+  EXPECT_THAT(difference.high, DoubleNear(10 + 2.447 * 0.9129, 1e-3));
+}
+
+TEST(CompareMeansTest, NoVariance) {
+  MeanDifference difference = CompareMeans({5, 5}, {7, 7, 7});
+  EXPECT_EQ(difference.low, 2);
+  EXPECT_EQ(difference.high, 2);
+}
+
+ScenarioResult ResultWithQps(double qps) {
+  ScenarioResult result;
+  result.mutable_summary()->set_qps(qps);
+  result.mutable_summary()->set_latency_50(1000);
+  return result;
+}
+
+TEST(ExperimentComparisonReportTest, MarksSignificantDifferences) {
+  ExperimentComparison comparison;
+  comparison.mutable_baseline()->set_name("off");
+  comparison.mutable_candidate()->set_name("on");
+  std::string report = ExperimentComparisonReport(
+      comparison, {ResultWithQps(100), ResultWithQps(101), ResultWithQps(99)},
+      {ResultWithQps(110), ResultWithQps(111), ResultWithQps(109)});
+  EXPECT_THAT(report, HasSubstr("off -> on (3 vs 3 runs)"));
+  EXPECT_THAT(report, HasSubstr("qps: 100.00 -> 110.00 (+10.00%"));
+  // Standard error sqrt(2/3), 4 degrees of freedom.
+  EXPECT_THAT(report, HasSubstr("95% CI [+7.73%, +12.27%]) *\n"));
+  EXPECT_THAT(report, HasSubstr("latency_50: 1000.00 -> 1000.00 (+0.00%"));
+  EXPECT_THAT(report, Not(HasSubstr("+0.00%]) *")));
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -20,10 +20,12 @@
 #include <iostream>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "absl/flags/flag.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpcpp/impl/codegen/config_protobuf.h>
 
@@ -31,6 +33,7 @@
 #include "test/core/test_util/test_config.h"
 #include "test/cpp/qps/benchmark_config.h"
 #include "test/cpp/qps/driver.h"
+#include "test/cpp/qps/experiment_comparison.h"
 #include "test/cpp/qps/parse_json.h"
 #include "test/cpp/qps/report.h"
 #include "test/cpp/qps/server.h"
@@ -145,6 +148,7 @@ static std::unique_ptr<ScenarioResult> RunAndReport(
   GetReporter()->ReportCpuUsage(*result);
   GetReporter()->ReportPollCount(*result);
   GetReporter()->ReportQueriesPerCpuSec(*result);
+  GetReporter()->ReportConnections(*result);
 
   for (int i = 0; *success && i < result->client_success_size(); i++) {
     *success = result->client_success(i);
@@ -163,6 +167,41 @@ static std::unique_ptr<ScenarioResult> RunAndReport(
   return result;
 }
 
+// Runs the scenario with each arm of its experiment comparison in turn, and
+// reports the differences between arms.
+static void RunExperimentComparison(
+    const Scenario& scenario,
+    const std::map<std::string, std::string>& per_worker_credential_types,
+    bool* success) {
+  const ExperimentComparison& comparison = scenario.experiment_comparison();
+  CHECK_GE(comparison.repetitions(), 2);
+  const ExperimentComparison::Arm* arms[] = {&comparison.baseline(),
+                                             &comparison.candidate()};
+  std::vector<ScenarioResult> results[2];
+  for (int i = 0; *success && i < comparison.repetitions(); i++) {
+    for (int j = 0; *success && j < 2; j++) {
+      // Alternate which arm runs first (ABBA...), so that drift over time
+      // does not favor either of them.
+      const int arm = (i + j) % 2;
+      Scenario run = scenario;
+      run.clear_experiment_comparison();
+      run.set_name(absl::StrCat(scenario.name(), "/",
+                                arm == 0 ? "baseline" : "candidate", "/", i));
+      run.mutable_client_config()->set_experiments(
+          arms[arm]->client_experiments());
+      run.mutable_server_config()->set_experiments(
+          arms[arm]->server_experiments());
+      results[arm].push_back(
+          *RunAndReport(run, per_worker_credential_types, success));
+    }
+  }
+  if (!*success) {
+    LOG(ERROR) << "Client/Server Failure";
+    return;
+  }
+  std::cerr << ExperimentComparisonReport(comparison, results[0], results[1]);
+}
+
 static double GetCpuLoad(
     Scenario* scenario, double offered_load,
     const std::map<std::string, std::string>& per_worker_credential_types,
@@ -270,7 +309,12 @@ static bool QpsDriver() {
   for (int i = 0; i < scenarios.scenarios_size(); i++) {
     if (absl::GetFlag(FLAGS_search_param).empty()) {
       const Scenario& scenario = scenarios.scenarios(i);
-      RunAndReport(scenario, per_worker_credential_types, &success);
+      if (scenario.has_experiment_comparison()) {
+        RunExperimentComparison(scenario, per_worker_credential_types,
+                                &success);
+      } else {
+        RunAndReport(scenario, per_worker_credential_types, &success);
+      }
     } else {
       if (absl::GetFlag(FLAGS_search_param) == "offered_load") {
         Scenario* scenario = scenarios.mutable_scenarios(i);
@@ -37,6 +37,8 @@
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 
+#include "src/core/lib/config/config_vars.h"
+#include "src/core/lib/experiments/config.h"
 #include "src/core/lib/gprpp/crash.h"
 #include "src/core/lib/gprpp/host_port.h"
 #include "src/proto/grpc/testing/worker_service.grpc.pb.h"
@@ -48,9 +50,82 @@
 #include "test/cpp/util/create_test_channel.h"
 #include "test/cpp/util/test_credentials_provider.h"
 
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+
 namespace grpc {
 namespace testing {
 
+// Scenarios with many connections need a file descriptor for each of them,
+// more than the default soft limit allows.
+static void RaiseOpenFileLimit() {
+#ifdef __linux__
+  struct rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) != 0 ||
+      limit.rlim_cur == limit.rlim_max) {
+    return;
+  }
+  const rlim_t previous = limit.rlim_cur;
+  limit.rlim_cur = limit.rlim_max;
+  if (setrlimit(RLIMIT_NOFILE, &limit) == 0) {
+    LOG(INFO) << "Raised the open file limit from " << previous << " to "
+              << limit.rlim_cur;
+  }
+#endif
+}
+
+// Applies the experiments a client or server asks for while it runs.
+// Experiments are process wide: clients and servers running at the same time
+// in one process (local workers) must agree on them.
+class ScopedExperiments final {
+ public:
+  explicit ScopedExperiments(const std::string& experiments)
+      : status_(Acquire(experiments)) {}
+  ~ScopedExperiments() {
+    if (!status_.ok()) return;
+    std::lock_guard<std::mutex> lock(mu_);
+    --users_;
+  }
+
+  const Status& status() const { return status_; }
+
+ private:
+  static Status Acquire(const std::string& experiments) {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (experiments != *applied_) {
+      if (users_ > 0) {
+        return Status(StatusCode::FAILED_PRECONDITION,
+                      "Conflicting experiments in one worker process");
+      }
+#ifdef GRPC_EXPERIMENTS_ARE_FINAL
+      return Status(StatusCode::UNIMPLEMENTED,
+                    "Experiments are final in this build");
+#else
+      LOG(INFO) << "Reloading experiments with overrides: " << experiments;
+      grpc_core::ConfigVars::Overrides overrides;
+      if (!experiments.empty()) overrides.experiments = experiments;
+      grpc_core::ConfigVars::SetOverrides(overrides);
+      grpc_core::TestOnlyReloadExperimentsFromConfigVariables();
+      *applied_ = experiments;
+#endif
+    }
+    ++users_;
+    return Status::OK;
+  }
+
+  static std::mutex mu_;
+  // Overrides currently applied, empty for the process's own configuration.
+  static std::string* applied_;
+  static int users_;
+
+  const Status status_;
+};
+
+std::mutex ScopedExperiments::mu_;
+std::string* ScopedExperiments::applied_ = new std::string();
+int ScopedExperiments::users_ = 0;
+
 static std::unique_ptr<Client> CreateClient(const ClientConfig& config) {
   LOG(INFO) << "Starting client of type "
             << ClientType_Name(config.client_type()) << " "
@@ -194,6 +269,8 @@ class WorkerServiceImpl final : public WorkerService::Service {
     if (!args.has_setup()) {
       return Status(StatusCode::INVALID_ARGUMENT, "Invalid setup arg");
     }
+    ScopedExperiments experiments(args.setup().experiments());
+    if (!experiments.status().ok()) return experiments.status();
     LOG(INFO) << "RunClientBody: about to create client";
     std::unique_ptr<Client> client = CreateClient(args.setup());
     if (!client) {
@@ -237,6 +314,8 @@ class WorkerServiceImpl final : public WorkerService::Service {
     if (server_port_ > 0 && args.setup().port() == 0) {
       args.mutable_setup()->set_port(server_port_);
     }
+    ScopedExperiments experiments(args.setup().experiments());
+    if (!experiments.status().ok()) return experiments.status();
     LOG(INFO) << "RunServerBody: about to create server";
     std::unique_ptr<Server> server = CreateServer(args.setup());
     if (g_inproc_servers != nullptr) {
@@ -278,6 +357,7 @@ class WorkerServiceImpl final : public WorkerService::Service {
 
 QpsWorker::QpsWorker(int driver_port, int server_port,
                      const std::string& credential_type) {
+  RaiseOpenFileLimit();
   impl_ = std::make_unique<WorkerServiceImpl>(server_port, this);
   gpr_atm_rel_store(&done_, gpr_atm{0});
 
@@ -79,6 +79,12 @@ void CompositeReporter::ReportQueriesPerCpuSec(const ScenarioResult& result) {
   }
 }
 
+void CompositeReporter::ReportConnections(const ScenarioResult& result) {
+  for (size_t i = 0; i < reporters_.size(); ++i) {
+    reporters_[i]->ReportConnections(result);
+  }
+}
+
 void GprLogReporter::ReportQPS(const ScenarioResult& result) {
   LOG(INFO) << "QPS: " << result.summary().qps();
   if (result.summary().failed_requests_per_second() > 0) {
@@ -87,6 +93,10 @@ void GprLogReporter::ReportQPS(const ScenarioResult& result) {
     LOG(INFO) << "successful requests/second: "
               << result.summary().successful_requests_per_second();
   }
+  if (result.summary().missed_schedules_per_second() > 0) {
+    LOG(INFO) << "missed schedules/second: "
+              << result.summary().missed_schedules_per_second();
+  }
 }
 
 void GprLogReporter::ReportQPSPerCore(const ScenarioResult& result) {
@@ -128,6 +138,21 @@ void GprLogReporter::ReportQueriesPerCpuSec(const ScenarioResult& result) {
             << result.summary().client_queries_per_cpu_sec();
 }
 
+void GprLogReporter::ReportConnections(const ScenarioResult& result) {
+  if (result.summary().client_rss_bytes_per_connection() > 0) {
+    LOG(INFO) << "RSS bytes per connection (client/server): "
+              << result.summary().client_rss_bytes_per_connection() << "/"
+              << result.summary().server_rss_bytes_per_connection();
+  }
+  if (result.summary().connections_churned_per_second() > 0) {
+    LOG(INFO) << "Churned connections/second: "
+              << result.summary().connections_churned_per_second();
+    LOG(INFO) << "CPU us per churned connection (client/server): "
+              << result.summary().client_cpu_us_per_churned_connection() << "/"
+              << result.summary().server_cpu_us_per_churned_connection();
+  }
+}
+
 void JsonReporter::ReportQPS(const ScenarioResult& result) {
   std::string json_string =
       SerializeJson(result, "type.googleapis.com/grpc.testing.ScenarioResult");
@@ -160,6 +185,10 @@ void JsonReporter::ReportQueriesPerCpuSec(const ScenarioResult& /*result*/) {
   // NOP - all reporting is handled by ReportQPS.
 }
 
+void JsonReporter::ReportConnections(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportQPS.
+}
+
 void RpcReporter::ReportQPS(const ScenarioResult& result) {
   grpc::ClientContext context;
   grpc::Status status;
@@ -200,5 +229,9 @@ void RpcReporter::ReportQueriesPerCpuSec(const ScenarioResult& /*result*/) {
   // NOP - all reporting is handled by ReportQPS.
 }
 
+void RpcReporter::ReportConnections(const ScenarioResult& /*result*/) {
+  // NOP - all reporting is handled by ReportQPS.
+}
+
 }  // namespace testing
 }  // namespace grpc
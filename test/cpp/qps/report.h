@@ -66,6 +66,10 @@ class Reporter {
   /// Reports queries per cpu-sec.
   virtual void ReportQueriesPerCpuSec(const ScenarioResult& result) = 0;
 
+  /// Reports memory per connection, and the rate and cpu cost of churned
+  /// connections.
+  virtual void ReportConnections(const ScenarioResult& result) = 0;
+
  private:
   const string name_;
 };
@@ -85,6 +89,7 @@ class CompositeReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportConnections(const ScenarioResult& result) override;
 
  private:
   std::vector<std::unique_ptr<Reporter> > reporters_;
@@ -103,6 +108,7 @@ class GprLogReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportConnections(const ScenarioResult& result) override;
 };
 
 /// Dumps the report to a JSON file.
@@ -119,6 +125,7 @@ class JsonReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportConnections(const ScenarioResult& result) override;
 
   const string report_file_;
 };
@@ -136,6 +143,7 @@ class RpcReporter : public Reporter {
   void ReportCpuUsage(const ScenarioResult& result) override;
   void ReportPollCount(const ScenarioResult& result) override;
   void ReportQueriesPerCpuSec(const ScenarioResult& result) override;
+  void ReportConnections(const ScenarioResult& result) override;
 
   std::unique_ptr<ReportQpsScenarioService::Stub> stub_;
 };
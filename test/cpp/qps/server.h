@@ -73,6 +73,7 @@ class Server {
     stats.set_total_cpu_time(timer_result.total_cpu_time);
     stats.set_idle_cpu_time(timer_result.idle_cpu_time);
     stats.set_cq_poll_count(poll_count);
+    stats.set_rss_bytes(timer_result.rss_bytes);
     return stats;
   }
 
@@ -30,6 +30,7 @@
 #ifdef __linux__
 #include <sys/resource.h>
 #include <sys/time.h>
+#include <unistd.h>
 
 static double time_double(struct timeval* tv) {
   return tv->tv_sec + 1e-6 * tv->tv_usec;
@@ -79,6 +80,20 @@ static void get_cpu_usage(unsigned long long* total_cpu_time,
 #endif
 }
 
+static unsigned long long get_rss_bytes() {
+#ifdef __linux__
+  // The second field of statm is the number of resident pages.
+  std::ifstream proc_statm("/proc/self/statm");
+  unsigned long long size_pages = 0;
+  unsigned long long resident_pages = 0;
+  proc_statm >> size_pages >> resident_pages;
+  return resident_pages *
+         static_cast<unsigned long long>(sysconf(_SC_PAGESIZE));
+#else
+  return 0;
+#endif
+}
+
 UsageTimer::Result UsageTimer::Sample() {
   Result r;
   r.wall = Now();
@@ -86,6 +101,7 @@ UsageTimer::Result UsageTimer::Sample() {
   r.total_cpu_time = 0;
   r.idle_cpu_time = 0;
   get_cpu_usage(&r.total_cpu_time, &r.idle_cpu_time);
+  r.rss_bytes = get_rss_bytes();
   return r;
 }
 
@@ -97,6 +113,7 @@ UsageTimer::Result UsageTimer::Mark() const {
   r.system = s.system - start_.system;
   r.total_cpu_time = s.total_cpu_time - start_.total_cpu_time;
   r.idle_cpu_time = s.idle_cpu_time - start_.idle_cpu_time;
+  r.rss_bytes = s.rss_bytes;
 
   return r;
 }
@@ -29,6 +29,9 @@ class UsageTimer {
     double system;
     unsigned long long total_cpu_time;
     unsigned long long idle_cpu_time;
+    // Resident set size of the process when the result was sampled: unlike
+    // the other fields, Mark() does not report it as a difference.
+    unsigned long long rss_bytes;
   };
 
   Result Mark() const;
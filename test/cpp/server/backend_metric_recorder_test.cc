@@ -0,0 +1,93 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/cpp/server/backend_metric_recorder.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include <grpcpp/ext/server_metric_recorder.h>
+
+#include "src/core/lib/slice/slice.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+using experimental::ServerMetricRecorder;
+
+TEST(BackendMetricStateTest, ReusesSerializedServerMetrics) {
+  auto server_recorder = ServerMetricRecorder::Create();
+  server_recorder->SetCpuUtilization(0.5);
+  {
+    BackendMetricState call(server_recorder.get());
+    EXPECT_FALSE(call.GetCachedSerializedMetrics().has_value());
+    EXPECT_EQ(call.GetBackendMetricData().cpu_utilization, 0.5);
+    call.CacheSerializedMetrics(grpc_core::Slice::FromCopiedString("report"));
+  }
+  {
+    BackendMetricState call(server_recorder.get());
+    auto serialized = call.GetCachedSerializedMetrics();
+    ASSERT_TRUE(serialized.has_value());
+    EXPECT_EQ(serialized->as_string_view(), "report");
+  }
+  // An update of the server metrics invalidates the report.
+  server_recorder->SetCpuUtilization(0.75);
+  {
+    BackendMetricState call(server_recorder.get());
+    EXPECT_FALSE(call.GetCachedSerializedMetrics().has_value());
+    EXPECT_EQ(call.GetBackendMetricData().cpu_utilization, 0.75);
+  }
+}
+
+TEST(BackendMetricStateTest, CallMetricsAreNotCached) {
+  auto server_recorder = ServerMetricRecorder::Create();
+  server_recorder->SetCpuUtilization(0.5);
+  {
+    BackendMetricState call(server_recorder.get());
+    call.RecordNamedMetric("foo", 1);
+    EXPECT_FALSE(call.GetCachedSerializedMetrics().has_value());
+    EXPECT_EQ(call.GetBackendMetricData().named_metrics.size(), 1);
+    call.CacheSerializedMetrics(grpc_core::Slice::FromCopiedString("report"));
+  }
+  BackendMetricState call(server_recorder.get());
+  EXPECT_FALSE(call.GetCachedSerializedMetrics().has_value());
+}
+
+TEST(BackendMetricStateTest, NothingCachedWithoutServerMetricRecorder) {
+  {
+    BackendMetricState call(nullptr);
+    EXPECT_FALSE(call.GetCachedSerializedMetrics().has_value());
+    call.GetBackendMetricData();
+    call.CacheSerializedMetrics(grpc_core::Slice());
+  }
+  BackendMetricState call(nullptr);
+  EXPECT_FALSE(call.GetCachedSerializedMetrics().has_value());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,104 @@
+//
+//
+// Copyright 2024 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/cpp/server/method_load_stats.h"
+
+#include <memory>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/impl/channel_arg_names.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/cpp/server/backend_metric_recorder.h"
+#include "test/core/test_util/fake_stats_plugin.h"
+#include "test/core/test_util/test_config.h"
+
+namespace grpc {
+namespace testing {
+namespace {
+
+using grpc_core::FakeStatsPluginBuilder;
+using grpc_core::GlobalInstrumentsRegistryTestPeer;
+using grpc_core::GlobalStatsPluginRegistryTestPeer;
+using internal::ServerMethodLoadStats;
+
+class ServerMethodLoadStatsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    GlobalStatsPluginRegistryTestPeer::ResetGlobalStatsPluginRegistry();
+  }
+};
+
+TEST_F(ServerMethodLoadStatsTest, ExportsConcurrencyAndQueueDelay) {
+  auto plugin = FakeStatsPluginBuilder()
+                    .UseDisabledByDefaultMetrics(true)
+                    .BuildAndRegister();
+  auto concurrency =
+      GlobalInstrumentsRegistryTestPeer::FindCallbackInt64GaugeHandleByName(
+          "grpc.server.call.concurrency");
+  auto queue_delay =
+      GlobalInstrumentsRegistryTestPeer::FindDoubleHistogramHandleByName(
+          "grpc.server.call.queue_delay");
+  ASSERT_TRUE(concurrency.has_value());
+  ASSERT_TRUE(queue_delay.has_value());
+  ServerMethodLoadStats stats(grpc_core::ChannelArgs{});
+  ServerMethodLoadStats::Method* method = stats.AddMethod("/foo/bar");
+  EXPECT_EQ(stats.AddMethod("/foo/bar"), method);
+  method->HandlerStarted(gpr_get_cycle_counter(), nullptr);
+  method->HandlerStarted(gpr_get_cycle_counter(), nullptr);
+  EXPECT_EQ(method->Concurrency(), 2);
+  plugin->TriggerCallbacks();
+  EXPECT_EQ(plugin->GetInt64CallbackGaugeValue(*concurrency, {"/foo/bar"}, {}),
+            2);
+  auto delays = plugin->GetDoubleHistogramValue(*queue_delay, {"/foo/bar"}, {});
+  ASSERT_TRUE(delays.has_value());
+  EXPECT_THAT(*delays, ::testing::Each(::testing::Ge(0)));
+  EXPECT_EQ(delays->size(), 2);
+  method->HandlerFinished();
+  method->HandlerFinished();
+  EXPECT_EQ(method->Concurrency(), 0);
+  plugin->TriggerCallbacks();
+  EXPECT_EQ(plugin->GetInt64CallbackGaugeValue(*concurrency, {"/foo/bar"}, {}),
+            0);
+}
+
+TEST_F(ServerMethodLoadStatsTest, ReportsQueueDelayToOrcaWhenEnabled) {
+  for (bool enabled : {false, true}) {
+    ServerMethodLoadStats stats(grpc_core::ChannelArgs().Set(
+        GRPC_ARG_SERVER_ORCA_QUEUE_DELAY, enabled));
+    ServerMethodLoadStats::Method* method = stats.AddMethod("/foo/bar");
+    BackendMetricState recorder(nullptr);
+    method->HandlerStarted(gpr_get_cycle_counter(), &recorder);
+    method->HandlerFinished();
+    EXPECT_EQ(recorder.GetBackendMetricData().request_cost.count(
+                  "grpc.queue_delay"),
+              enabled ? 1 : 0);
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,12 +16,23 @@
 //
 //
 
+#include <fcntl.h>
 #include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "absl/strings/string_view.h"
+
+#include <grpc/event_engine/slice.h>
 #include <grpc/event_engine/slice_buffer.h>
 #include <grpc/grpc.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel_posix.h>
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/support/config.h>
@@ -121,6 +132,102 @@ TEST_F(ServerBuilderTest, PassiveListenerAcceptConnectedFd) {
   server->Shutdown();
 }
 
+TEST_F(ServerBuilderTest, PassiveListenerAcceptConnectedFds) {
+  std::unique_ptr<experimental::PassiveListener> passive_listener;
+  ServerBuilder builder;
+  auto cq = builder.AddCompletionQueue();
+  auto server =
+      builder.RegisterService(&g_service)
+          .experimental()
+          .AddPassiveListener(InsecureServerCredentials(), passive_listener)
+          .BuildAndStart();
+  ASSERT_NE(server.get(), nullptr);
+  std::vector<experimental::PassiveListener::ConnectedFd> fds(2);
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+  fds[0].fd = socket(AF_INET, SOCK_STREAM, 0);
+  fds[1].fd = socket(AF_INET, SOCK_STREAM, 0);
+  fds[1].initial_data.Append(grpc_event_engine::experimental::Slice::
+                                 FromCopiedString("PRI * HTTP/2.0\r\n"));
+  auto accept_statuses = passive_listener->AcceptConnectedFds(std::move(fds));
+  ASSERT_EQ(accept_statuses.size(), 2);
+  for (const absl::Status& status : accept_statuses) {
+    EXPECT_TRUE(status.ok()) << status;
+  }
+#else
+  auto accept_statuses = passive_listener->AcceptConnectedFds(std::move(fds));
+  ASSERT_EQ(accept_statuses.size(), 2);
+  for (const absl::Status& status : accept_statuses) {
+    EXPECT_FALSE(status.ok()) << status;
+  }
+#endif
+  server->Shutdown();
+}
+
+#ifdef GPR_SUPPORT_CHANNELS_FROM_FD
+class EchoServiceImpl : public testing::EchoTestService::Service {
+ public:
+  Status Echo(ServerContext* /*context*/, const testing::EchoRequest* request,
+              testing::EchoResponse* response) override {
+    response->set_message(request->message());
+    return Status::OK;
+  }
+};
+
+// Bytes read from a connection before it is handed off, here the client's
+// connection preface, as a proxy sniffing the protocol would read them, must
+// reach the server ahead of the rest of the connection.
+TEST_F(ServerBuilderTest, PassiveListenerAcceptConnectedFdsWithInitialData) {
+  EchoServiceImpl service;
+  std::unique_ptr<experimental::PassiveListener> passive_listener;
+  auto server =
+      ServerBuilder()
+          .RegisterService(&service)
+          .experimental()
+          .AddPassiveListener(InsecureServerCredentials(), passive_listener)
+          .BuildAndStart();
+  ASSERT_NE(server.get(), nullptr);
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  auto stub = testing::EchoTestService::NewStub(
+      CreateInsecureChannelFromFd("passive-listener", fds[0]));
+  ClientContext context;
+  context.set_deadline(grpc_timeout_seconds_to_deadline(30));
+  testing::EchoRequest request;
+  request.set_message("hello");
+  testing::EchoResponse response;
+  Status status;
+  std::thread rpc(
+      [&]() { status = stub->Echo(&context, request, &response); });
+  constexpr absl::string_view kPreface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+  std::string sniffed(kPreface.size(), '\0');
+  size_t sniffed_length = 0;
+  while (sniffed_length < sniffed.size()) {
+    ssize_t n = read(fds[1], &sniffed[sniffed_length],
+                     sniffed.size() - sniffed_length);
+    if (n <= 0) {
+      ADD_FAILURE() << "read() returned " << n;
+      break;
+    }
+    sniffed_length += n;
+  }
+  EXPECT_EQ(sniffed, kPreface);
+  // Like accepted connections, the ones handed off must not block.
+  EXPECT_EQ(fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL) | O_NONBLOCK), 0);
+  std::vector<experimental::PassiveListener::ConnectedFd> connected_fds(1);
+  connected_fds[0].fd = fds[1];
+  connected_fds[0].initial_data.Append(
+      grpc_event_engine::experimental::Slice::FromCopiedString(sniffed));
+  auto accept_statuses =
+      passive_listener->AcceptConnectedFds(std::move(connected_fds));
+  ASSERT_EQ(accept_statuses.size(), 1);
+  EXPECT_TRUE(accept_statuses[0].ok()) << accept_statuses[0];
+  rpc.join();
+  EXPECT_TRUE(status.ok()) << status.error_message();
+  EXPECT_EQ(response.message(), "hello");
+  server->Shutdown();
+}
+#endif  // GPR_SUPPORT_CHANNELS_FROM_FD
+
 TEST_F(ServerBuilderTest, PassiveListenerAcceptConnectedEndpoint) {
   std::unique_ptr<experimental::PassiveListener> passive_listener;
   auto server =
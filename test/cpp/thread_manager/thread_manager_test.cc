@@ -21,6 +21,7 @@
 #include <atomic>
 #include <chrono>
 #include <climits>
+#include <cstdint>
 #include <memory>
 #include <thread>
 
@@ -32,6 +33,8 @@
 #include <grpcpp/grpcpp.h>
 
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/telemetry/stats.h"
+#include "src/core/telemetry/stats_data.h"
 #include "test/core/test_util/test_config.h"
 
 namespace grpc {
@@ -179,6 +182,32 @@ TEST_P(ThreadManagerTest, TestThreadQuota) {
   }
 }
 
+// With a single poller wanted, the thread that finds a work item leaves the
+// thread manager short of a poller. Threads that finish their work while
+// another one is polling park in the warm pool, and the next shortfall
+// reuses one of them instead of creating a new thread.
+TEST(ThreadManagerWarmPoolTest, ParkedThreadsAreReused) {
+  const TestThreadManagerSettings settings = {
+      1 /* min_pollers */, 1 /* max_pollers */, 1 /* poll_duration_ms */,
+      10 /* work_duration_ms */, 300 /* max_poll_calls */,
+      INT_MAX /* thread_limit */, 1 /* thread_manager_count */};
+  const auto stats_before = grpc_core::global_stats().Collect();
+  grpc_resource_quota* rq =
+      grpc_resource_quota_create("Thread manager warm pool test");
+  TestThreadManager thread_manager("TestThreadManager", rq, settings);
+  grpc_resource_quota_unref(rq);
+  thread_manager.Initialize();
+  // Shutdown wakes the parked threads, so this does not wait for them to
+  // linger.
+  thread_manager.Wait();
+  const auto stats = grpc_core::global_stats().Collect()->Diff(*stats_before);
+  EXPECT_EQ(thread_manager.num_do_work(), thread_manager.num_work_found());
+  EXPECT_GT(stats->sync_server_warm_threads_reused, 0u);
+  // Without the warm pool about every work item would have created a thread.
+  EXPECT_LT(stats->sync_server_threads_created,
+            static_cast<uint64_t>(thread_manager.num_work_found()) / 2);
+}
+
 }  // namespace
 }  // namespace grpc
 
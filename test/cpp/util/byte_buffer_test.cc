@@ -17,6 +17,8 @@
 //
 
 #include <cstring>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -33,6 +35,53 @@ namespace grpc {
 
 namespace {
 
+// A message that counts how often it is serialized and deserialized.
+struct CountedMessage {
+  std::string text;
+  static int serializations;
+  static int deserializations;
+};
+int CountedMessage::serializations = 0;
+int CountedMessage::deserializations = 0;
+
+// The same message, passed as an object.
+struct ObjectMessage : public CountedMessage {};
+
+template <class M>
+class CountedMessageTraits {
+ public:
+  static Status Serialize(const M& message, ByteBuffer* buffer,
+                          bool* own_buffer) {
+    ++CountedMessage::serializations;
+    Slice slice(message.text);
+    *buffer = ByteBuffer(&slice, 1);
+    *own_buffer = true;
+    return Status::OK;
+  }
+  static Status Deserialize(ByteBuffer* buffer, M* message) {
+    ++CountedMessage::deserializations;
+    Slice slice;
+    Status status = buffer->DumpToSingleSlice(&slice);
+    message->text.assign(reinterpret_cast<const char*>(slice.begin()),
+                         slice.size());
+    buffer->Clear();
+    return status;
+  }
+};
+
+}  // namespace
+
+template <>
+class SerializationTraits<CountedMessage, void>
+    : public CountedMessageTraits<CountedMessage> {};
+template <>
+class SerializationTraits<ObjectMessage, void>
+    : public CountedMessageTraits<ObjectMessage> {};
+template <>
+struct PassMessageObjects<ObjectMessage> : std::true_type {};
+
+namespace {
+
 const char* kContent1 = "hello xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx";
 const char* kContent2 = "yyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyyy world";
 
@@ -150,6 +199,95 @@ TEST_F(ByteBufferTest, DumpToSingleSlice) {
   EXPECT_EQ(strlen(kContent1) + strlen(kContent2), slice.size());
 }
 
+TEST_F(ByteBufferTest, CordRoundTrip) {
+  absl::Cord cord(kContent1);
+  cord.Append(std::string(4096, 'x'));
+  ByteBuffer send_buffer;
+  bool owned = false;
+  EXPECT_TRUE(SerializationTraits<absl::Cord>::Serialize(cord, &send_buffer,
+                                                         &owned)
+                  .ok());
+  EXPECT_TRUE(owned);
+  EXPECT_EQ(send_buffer.Length(), cord.size());
+  absl::Cord received;
+  EXPECT_TRUE(
+      SerializationTraits<absl::Cord>::Deserialize(&send_buffer, &received)
+          .ok());
+  EXPECT_EQ(received, cord);
+}
+
+class MessageObjectTest : public ByteBufferTest {
+ protected:
+  void SetUp() override {
+    CountedMessage::serializations = 0;
+    CountedMessage::deserializations = 0;
+  }
+};
+
+TEST_F(MessageObjectTest, PassesObjectWithoutSerializingIt) {
+  ObjectMessage sent;
+  sent.text = kContent1;
+  ByteBuffer buffer;
+  bool own_buffer = false;
+  ASSERT_TRUE(internal::SerializeMessage(sent, &buffer, &own_buffer).ok());
+  EXPECT_TRUE(own_buffer);
+  ObjectMessage received;
+  ASSERT_TRUE(internal::DeserializeMessage(&buffer, &received).ok());
+  EXPECT_EQ(received.text, kContent1);
+  EXPECT_FALSE(buffer.Valid());
+  EXPECT_EQ(CountedMessage::serializations, 0);
+  EXPECT_EQ(CountedMessage::deserializations, 0);
+}
+
+TEST_F(MessageObjectTest, SerializesObjectWhenBytesAreNeeded) {
+  ObjectMessage sent;
+  sent.text = kContent1;
+  ByteBuffer buffer;
+  bool own_buffer = false;
+  ASSERT_TRUE(internal::SerializeMessage(sent, &buffer, &own_buffer).ok());
+  EXPECT_EQ(buffer.Length(), strlen(kContent1));
+  EXPECT_EQ(CountedMessage::serializations, 1);
+  ObjectMessage received;
+  ASSERT_TRUE(internal::DeserializeMessage(&buffer, &received).ok());
+  EXPECT_EQ(received.text, kContent1);
+  EXPECT_EQ(CountedMessage::deserializations, 1);
+}
+
+TEST_F(MessageObjectTest, ReceiverOfAnotherTypeDeserializesBytes) {
+  ObjectMessage sent;
+  sent.text = kContent2;
+  ByteBuffer buffer;
+  bool own_buffer = false;
+  ASSERT_TRUE(internal::SerializeMessage(sent, &buffer, &own_buffer).ok());
+  CountedMessage received;
+  ASSERT_TRUE(internal::DeserializeMessage(&buffer, &received).ok());
+  EXPECT_EQ(received.text, kContent2);
+  EXPECT_EQ(CountedMessage::serializations, 1);
+  EXPECT_EQ(CountedMessage::deserializations, 1);
+}
+
+TEST_F(MessageObjectTest, CopySerializesObject) {
+  ObjectMessage sent;
+  sent.text = kContent1;
+  ByteBuffer buffer;
+  bool own_buffer = false;
+  ASSERT_TRUE(internal::SerializeMessage(sent, &buffer, &own_buffer).ok());
+  ByteBuffer copy(buffer);
+  EXPECT_EQ(copy.Length(), strlen(kContent1));
+  EXPECT_EQ(buffer.Length(), strlen(kContent1));
+  EXPECT_EQ(CountedMessage::serializations, 1);
+}
+
+TEST_F(MessageObjectTest, DestroysObjectThatWasNotReceived) {
+  ObjectMessage sent;
+  sent.text = std::string(4096, 'x');
+  ByteBuffer buffer;
+  bool own_buffer = false;
+  ASSERT_TRUE(internal::SerializeMessage(sent, &buffer, &own_buffer).ok());
+  buffer.Clear();
+  EXPECT_EQ(CountedMessage::serializations, 0);
+}
+
 }  // namespace
 }  // namespace grpc
 
@@ -76,6 +76,25 @@ TEST(ProtoBufferReaderTest, ReadCord) {
   EXPECT_EQ(reader.ByteCount(), cord1.size() + cord2.size());
 }
 
+TEST(ProtoBufferReaderTest, ReadCordReferencesLargeSlices) {
+  Slice slice(std::string(16384, 'a'));
+  ByteBuffer buffer(&slice, 1);
+  ProtoBufferReader reader(&buffer);
+  absl::Cord cord;
+  EXPECT_TRUE(reader.ReadCord(&cord, 8192));
+  absl::optional<absl::string_view> flat = cord.TryFlat();
+  ASSERT_TRUE(flat.has_value());
+  EXPECT_EQ(flat->data(), reinterpret_cast<const char*>(slice.begin()));
+  EXPECT_EQ(flat->size(), size_t{8192});
+  // Then read the rest of the slice, after it was backed up.
+  absl::Cord rest;
+  EXPECT_TRUE(reader.ReadCord(&rest, 8192));
+  flat = rest.TryFlat();
+  ASSERT_TRUE(flat.has_value());
+  EXPECT_EQ(flat->data(), reinterpret_cast<const char*>(slice.begin()) + 8192);
+  EXPECT_EQ(reader.ByteCount(), 16384);
+}
+
 #endif  // GRPC_PROTOBUF_CORD_SUPPORT_ENABLED
 
 }  // namespace
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Generates the header corpora replayed by bm_chttp2_hpack.
+
+Each corpus is the sequence of header blocks sent in one direction of one
+connection, shaped after production traffic: a few methods with a skewed
+distribution, auth tokens rotating every few dozen calls, tracing headers
+unique to each call, and custom metadata of low to moderate cardinality.
+
+The format is that of the .headers files: 'key: value' lines, '#' comments,
+and an empty line after each header block. Values of -bin keys are base64.
+"""
+
+import base64
+import os
+import random
+
+_NUM_CALLS = 100
+_OUTPUT_DIR = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    "../../../test/cpp/microbenchmarks/hpack_corpus",
+)
+
+_METHODS = [
+    ("/acme.inventory.v1.InventoryService/GetItem", 50),
+    ("/acme.inventory.v1.InventoryService/ListItems", 20),
+    ("/acme.inventory.v1.InventoryService/UpdateItem", 10),
+    ("/acme.inventory.v1.InventoryService/WatchItems", 5),
+    ("/acme.pricing.v1.PricingService/GetQuote", 12),
+    ("/grpc.health.v1.Health/Check", 3),
+]
+_TIMEOUTS = ["100m", "250m", "1S", "5S", "30S"]
+_CLIENT_VERSIONS = ["web/4.18.2", "web/4.19.0", "ios/7.3.1"]
+_FEATURE_FLAGS = ["", "new-pricing", "new-pricing,dark-mode"]
+_NUM_TENANTS = 20
+# Calls between two rotations of the auth token.
+_TOKEN_LIFETIME = 50
+_NUM_BACKENDS = 4
+
+
+def _hex(rng, length):
+    return "".join(rng.choice("0123456789abcdef") for _ in range(length))
+
+
+def _token(rng):
+    alphabet = (
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+    )
+    parts = [36, 180, 43]
+    return ".".join(
+        "".join(rng.choice(alphabet) for _ in range(n)) for n in parts
+    )
+
+
+def _tenant(rng):
+    # Zipf like: a few tenants make most of the traffic.
+    return "tenant-%02d" % min(
+        int(rng.paretovariate(1.2)) - 1, _NUM_TENANTS - 1
+    )
+
+
+def _client_initial_metadata(rng):
+    token = None
+    blocks = []
+    for call in range(_NUM_CALLS):
+        if call % _TOKEN_LIFETIME == 0:
+            token = _token(rng)
+        method = rng.choices(
+            [m for m, _ in _METHODS], [w for _, w in _METHODS]
+        )[0]
+        trace_id = _hex(rng, 32)
+        span_id = _hex(rng, 16)
+        block = [
+            (":path", method),
+            (":authority", "inventory.prod.svc.cluster.local:443"),
+            (":method", "POST"),
+            (":scheme", "https"),
+            ("te", "trailers"),
+            ("content-type", "application/grpc"),
+            ("user-agent", "grpc-c++/1.66.0 grpc-c/42.0.0 (linux; chttp2)"),
+            ("grpc-accept-encoding", "identity,deflate,gzip"),
+            ("grpc-timeout", rng.choice(_TIMEOUTS)),
+            ("authorization", "Bearer " + token),
+            ("traceparent", "00-%s-%s-01" % (trace_id, span_id)),
+            (
+                "grpc-trace-bin",
+                base64.b64encode(
+                    bytes([0, 0])
+                    + bytes.fromhex(trace_id)
+                    + bytes([1])
+                    + bytes.fromhex(span_id)
+                    + bytes([2, 1])
+                ).decode(),
+            ),
+            (
+                "x-request-id",
+                "%s-%s-%s-%s-%s"
+                % (
+                    _hex(rng, 8),
+                    _hex(rng, 4),
+                    _hex(rng, 4),
+                    _hex(rng, 4),
+                    _hex(rng, 12),
+                ),
+            ),
+            ("x-tenant-id", _tenant(rng)),
+            ("x-client-version", rng.choice(_CLIENT_VERSIONS)),
+        ]
+        flags = rng.choice(_FEATURE_FLAGS)
+        if flags:
+            block.append(("x-feature-flags", flags))
+        blocks.append(block)
+    return blocks
+
+
+def _server_metadata(rng):
+    backend = "backend-%d" % rng.randrange(_NUM_BACKENDS)
+    blocks = []
+    for _ in range(_NUM_CALLS):
+        blocks.append(
+            [
+                (":status", "200"),
+                ("content-type", "application/grpc"),
+                ("grpc-accept-encoding", "identity,deflate,gzip"),
+                ("x-served-by", backend),
+            ]
+        )
+        trailers = [("grpc-status", "0")]
+        if rng.random() < 0.05:
+            trailers = [
+                ("grpc-status", "5"),
+                ("grpc-message", "item not found"),
+            ]
+        trailers.append(
+            ("x-backend-latency-ms", str(int(rng.expovariate(1 / 20.0))))
+        )
+        blocks.append(trailers)
+    return blocks
+
+
+def _write(name, description, blocks):
+    with open(os.path.join(_OUTPUT_DIR, name), "w") as f:
+        f.write("# %s\n" % description)
+        f.write("# generated by tools/codegen/core/gen_hpack_corpus.py\n")
+        for block in blocks:
+            for key, value in block:
+                f.write("%s: %s\n" % (key, value))
+            f.write("\n")
+
+
+rng = random.Random(42)
+os.makedirs(_OUTPUT_DIR, exist_ok=True)
+_write(
+    "client_initial_metadata.headers",
+    "client initial metadata of the calls of one connection",
+    _client_initial_metadata(rng),
+)
+_write(
+    "server_metadata.headers",
+    "server initial and trailing metadata of the calls of one connection",
+    _server_metadata(rng),
+)
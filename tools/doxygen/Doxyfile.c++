@@ -967,6 +967,7 @@ include/grpcpp/ext/health_check_service_server_builder_option.h \
 include/grpcpp/ext/server_metric_recorder.h \
 include/grpcpp/generic/async_generic_service.h \
 include/grpcpp/generic/callback_generic_service.h \
+include/grpcpp/generic/generic_proxy.h \
 include/grpcpp/generic/generic_stub.h \
 include/grpcpp/generic/generic_stub_callback.h \
 include/grpcpp/grpcpp.h \
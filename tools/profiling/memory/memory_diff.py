@@ -89,6 +89,7 @@ _SCENARIOS = {
     "default": [],
     "minstack": ["--scenario_config=minstack"],
     "chaotic_good": ["--scenario_config=chaotic_good"],
+    "slab_allocator": ["--scenario_config=slab_allocator"],
 }
 
 _BENCHMARKS = {
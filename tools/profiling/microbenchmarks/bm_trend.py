@@ -0,0 +1,271 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Tracks the hot-path microbenchmarks from commit to commit.
+
+  bm_trend.py run --store DIR
+    builds and runs the suite, and stores its results for the current commit
+    in DIR/<commit>.json.
+
+  bm_trend.py compare BASELINE.json NEW.json
+    compares the repetitions of each benchmark in both results with a
+    Mann-Whitney U test, and reports the significant changes.
+"""
+
+import argparse
+import datetime
+import json
+import math
+import multiprocessing
+import os
+import platform
+import subprocess
+import sys
+import tempfile
+
+# Version of the format of the stored results.
+_SCHEMA_VERSION = 1
+
+# The curated suite: bazel target -> benchmark filter (None runs them all).
+# Keep it to benchmarks of code on the path of every call, that run quickly.
+_SUITE = {
+    "//test/core/call:bm_client_call": None,
+    "//test/core/load_balancing:lb_pick_benchmark": None,
+    "//test/core/promise:bm_party": None,
+    "//test/core/transport:bm_call_spine": None,
+    "//test/cpp/microbenchmarks:bm_arena": None,
+    "//test/cpp/microbenchmarks:bm_channel_args": None,
+    "//test/cpp/microbenchmarks:bm_chttp2_hpack": None,
+    "//test/cpp/microbenchmarks:bm_closure": None,
+    "//test/cpp/microbenchmarks:bm_cq": None,
+    "//test/cpp/microbenchmarks:bm_fullstack_unary_ping_pong": (
+        "BM_UnaryPingPong<InProcess"
+    ),
+}
+
+
+def _check_output(cmd, **kwargs):
+    return subprocess.check_output(cmd, **kwargs).decode().strip()
+
+
+def _cpu_model():
+    try:
+        with open("/proc/cpuinfo") as f:
+            for line in f:
+                if line.startswith("model name"):
+                    return line.split(":", 1)[1].strip()
+    except OSError:
+        pass
+    return platform.processor() or platform.machine()
+
+
+def _compiler():
+    """Returns the version line of the C++ compiler bazel builds with."""
+    cc = os.environ.get("CC") or "cc"
+    try:
+        return _check_output([cc, "--version"]).splitlines()[0]
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def _environment(args):
+    return {
+        "commit": _check_output(["git", "rev-parse", "HEAD"]),
+        "date": datetime.datetime.now(datetime.timezone.utc).isoformat(),
+        "cpu_model": _cpu_model(),
+        "num_cpus": multiprocessing.cpu_count(),
+        "kernel": platform.release(),
+        "compiler": _compiler(),
+        "bazel_config": args.bazel_config,
+        "experiments": os.environ.get("GRPC_EXPERIMENTS", ""),
+        "repetitions": args.repetitions,
+    }
+
+
+def _target_binary(target):
+    package, name = target[2:].split(":")
+    return os.path.join("bazel-bin", package, name)
+
+
+def _run_target(target, benchmark_filter, args):
+    """Runs one benchmark binary, and returns its repetitions by benchmark."""
+    with tempfile.NamedTemporaryFile(suffix=".json") as out:
+        cmd = [
+            _target_binary(target),
+            "--benchmark_repetitions=%d" % args.repetitions,
+            "--benchmark_min_time=%s" % args.min_time,
+            "--benchmark_out_format=json",
+            "--benchmark_out=%s" % out.name,
+        ]
+        if benchmark_filter is not None:
+            cmd.append("--benchmark_filter=%s" % benchmark_filter)
+        subprocess.check_call(cmd, stdout=subprocess.DEVNULL)
+        report = json.load(out)
+    samples = {}
+    for benchmark in report["benchmarks"]:
+        # Only keep the repetitions, the aggregates are recomputed.
+        if benchmark.get("run_type") == "aggregate":
+            continue
+        entry = samples.setdefault(
+            "%s/%s" % (target, benchmark["run_name"]),
+            {"time_unit": benchmark["time_unit"], "cpu_time": []},
+        )
+        entry["cpu_time"].append(benchmark["cpu_time"])
+    return samples
+
+
+def _run(args):
+    subprocess.check_call(
+        [args.bazel, "build", "--config=%s" % args.bazel_config]
+        + sorted(_SUITE.keys())
+    )
+    result = {
+        "schema_version": _SCHEMA_VERSION,
+        "environment": _environment(args),
+        "benchmarks": {},
+    }
+    for target, benchmark_filter in sorted(_SUITE.items()):
+        print("Running %s" % target)
+        result["benchmarks"].update(
+            _run_target(target, benchmark_filter, args)
+        )
+    os.makedirs(args.store, exist_ok=True)
+    path = os.path.join(
+        args.store, "%s.json" % result["environment"]["commit"]
+    )
+    with open(path, "w") as f:
+        json.dump(result, f, indent=2, sort_keys=True)
+    print("Stored results in %s" % path)
+
+
+def _mann_whitney_u(xs, ys):
+    """Returns the two-sided p-value of a Mann-Whitney U test.
+
+    Uses the normal approximation with tie correction, which is good enough
+    from about 5 repetitions per side.
+    """
+    n1 = len(xs)
+    n2 = len(ys)
+    values = sorted([(x, 0) for x in xs] + [(y, 1) for y in ys])
+    # Assign the average rank to tied values.
+    ranks = [0.0] * len(values)
+    tie_term = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1
+        tied = j - i + 1
+        tie_term += tied**3 - tied
+        i = j + 1
+    rank_sum = sum(r for r, (_, side) in zip(ranks, values) if side == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (abs(u - n1 * n2 / 2.0) - 0.5) / math.sqrt(variance)
+    return math.erfc(max(z, 0) / math.sqrt(2))
+
+
+def _median(values):
+    values = sorted(values)
+    middle = len(values) // 2
+    if len(values) % 2:
+        return values[middle]
+    return (values[middle - 1] + values[middle]) / 2.0
+
+
+def _compare(args):
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    with open(args.new) as f:
+        new = json.load(f)
+    for result in (baseline, new):
+        if result.get("schema_version") != _SCHEMA_VERSION:
+            sys.exit("unsupported results version")
+    for key in ("cpu_model", "compiler", "experiments"):
+        if baseline["environment"][key] != new["environment"][key]:
+            print(
+                "WARNING: %s differs: %r vs %r"
+                % (key, baseline["environment"][key], new["environment"][key])
+            )
+    rows = []
+    for name in sorted(set(baseline["benchmarks"]) & set(new["benchmarks"])):
+        old_times = baseline["benchmarks"][name]["cpu_time"]
+        new_times = new["benchmarks"][name]["cpu_time"]
+        if len(old_times) < 2 or len(new_times) < 2:
+            continue
+        old_median = _median(old_times)
+        change = _median(new_times) / old_median - 1 if old_median else 0
+        p_value = _mann_whitney_u(old_times, new_times)
+        if p_value < args.alpha and abs(change) >= args.threshold:
+            rows.append((name, change, p_value))
+    regressions = 0
+    for name, change, p_value in sorted(rows, key=lambda row: -row[1]):
+        if change > 0:
+            regressions += 1
+        print("%+7.1f%%  p=%.4f  %s" % (change * 100, p_value, name))
+    if not rows:
+        print("No significant change")
+    if args.fail_on_regression and regressions:
+        sys.exit(1)
+
+
+argp = argparse.ArgumentParser(
+    description="Track microbenchmark results across commits"
+)
+subparsers = argp.add_subparsers(dest="command", required=True)
+
+run_parser = subparsers.add_parser("run", help="run the suite")
+run_parser.add_argument(
+    "--store", required=True, help="directory where results are stored"
+)
+run_parser.add_argument("--bazel", default="tools/bazel")
+run_parser.add_argument("--bazel_config", default="opt")
+run_parser.add_argument(
+    "--repetitions",
+    type=int,
+    default=10,
+    help="repetitions of each benchmark, to test significance on",
+)
+run_parser.add_argument("--min_time", default="0.5s")
+run_parser.set_defaults(func=_run)
+
+compare_parser = subparsers.add_parser(
+    "compare", help="compare results to a baseline"
+)
+compare_parser.add_argument("baseline")
+compare_parser.add_argument("new")
+compare_parser.add_argument(
+    "--alpha", type=float, default=0.01, help="significance level"
+)
+compare_parser.add_argument(
+    "--threshold",
+    type=float,
+    default=0.03,
+    help="smallest relative change of the median to report",
+)
+compare_parser.add_argument(
+    "--fail_on_regression",
+    action="store_true",
+    help="exit with an error on a significant slowdown",
+)
+compare_parser.set_defaults(func=_compare)
+
+args = argp.parse_args()
+args.func(args)
@@ -26,6 +26,9 @@ SCALABLE = "scalable"
 INPROC = "inproc"
 SWEEP = "sweep"
 PSM = "psm"
+# Scenarios with many connections or streams, or churning connections, which
+# need machines set up for them.
+CONNECTION_SCALE = "connection_scale"
 # A small superset of the benchmarks required to produce
 # https://grafana-dot-grpc-testing.appspot.com/
 DASHBOARD = "dashboard"
@@ -147,6 +150,7 @@ def _ping_pong_scenario(
     excluded_poll_engines=None,
     minimal_stack=False,
     offered_load=None,
+    connection_churn_per_second=None,
 ):
     """Creates a basic ping pong scenario."""
     scenario = {
@@ -239,6 +243,10 @@ def _ping_pong_scenario(
 
     if messages_per_stream:
         scenario["client_config"]["messages_per_stream"] = messages_per_stream
+    if connection_churn_per_second:
+        scenario["client_config"][
+            "connection_churn_per_second"
+        ] = connection_churn_per_second
     if client_language:
         # the CLIENT_LANGUAGE field is recognized by run_performance_tests.py
         scenario["CLIENT_LANGUAGE"] = client_language
@@ -320,6 +328,53 @@ class CXXLanguage(Language):
             warmup_seconds=CXX_WARMUP_SECONDS,
         )
 
+        # 100k idle connections, spread over clients so that each of them
+        # stays within the ephemeral ports of one address.
+        for secure in [True, False]:
+            secstr = "secure" if secure else "insecure"
+            yield _ping_pong_scenario(
+                "cpp_protobuf_async_unary_100k_idle_channels_%s" % secstr,
+                rpc_type="UNARY",
+                client_type="ASYNC_CLIENT",
+                server_type="ASYNC_SERVER",
+                unconstrained_client="async",
+                outstanding=0,
+                channels=25000,
+                num_clients=4,
+                secure=secure,
+                categories=[CONNECTION_SCALE],
+                warmup_seconds=CXX_WARMUP_SECONDS,
+            )
+
+        yield _ping_pong_scenario(
+            "cpp_protobuf_async_streaming_1channel_10k_streams",
+            rpc_type="STREAMING",
+            client_type="ASYNC_CLIENT",
+            server_type="ASYNC_SERVER",
+            unconstrained_client="async",
+            outstanding=10000,
+            channels=1,
+            num_clients=1,
+            secure=False,
+            categories=[CONNECTION_SCALE],
+            warmup_seconds=CXX_WARMUP_SECONDS,
+        )
+
+        for secure in [True, False]:
+            secstr = "secure" if secure else "insecure"
+            for churn in [100, 1000]:
+                yield _ping_pong_scenario(
+                    "cpp_protobuf_async_unary_ping_pong_churn_%scps_%s"
+                    % (churn, secstr),
+                    rpc_type="UNARY",
+                    client_type="ASYNC_CLIENT",
+                    server_type="ASYNC_SERVER",
+                    secure=secure,
+                    connection_churn_per_second=churn,
+                    categories=[CONNECTION_SCALE],
+                    warmup_seconds=CXX_WARMUP_SECONDS,
+                )
+
         # Scenario was added in https://github.com/grpc/grpc/pull/12987, but its purpose is unclear
         # (beyond excercising some params that other scenarios don't)
         yield _ping_pong_scenario(